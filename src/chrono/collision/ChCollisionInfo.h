@@ -34,7 +34,7 @@ class ChApi ChCollisionInfo {
     ChVector3d vN;             ///< coll.normal, respect to A, in abs coords
     double distance;           ///< distance (negative for penetration)
     double eff_radius;         ///< effective radius of curvature at contact (SMC only)
-    float* reaction_cache;     ///< pointer to some persistent user cache of reactions
+    float* reaction_cache;     ///< pointer to some persistent user cache of reactions (6 values: N,U,V, rolling)
 
     /// Basic default constructor.
     ChCollisionInfo();
@@ -25,7 +25,8 @@ namespace chrono {
 static double default_model_envelope = 0.03;
 static double default_safe_margin = 0.01;
 
-ChCollisionModel::ChCollisionModel() : contactable(nullptr), family_group(1), family_mask(0x7FFF), impl(nullptr) {
+ChCollisionModel::ChCollisionModel()
+    : model_ccd(false), contactable(nullptr), family_group(1), family_mask(0x7FFF), impl(nullptr) {
     model_envelope = (float)default_model_envelope;
     model_safe_margin = (float)default_safe_margin;
 }
@@ -39,6 +40,7 @@ ChCollisionModel::ChCollisionModel(const ChCollisionModel& other) : contactable(
     }
     model_envelope = other.model_envelope;
     model_safe_margin = other.model_safe_margin;
+    model_ccd = other.model_ccd;
     family_group = other.family_group;
     family_mask = other.family_mask;
 }
@@ -185,6 +187,7 @@ void ChCollisionModel::SetAllShapesMaterial(std::shared_ptr<ChContactMaterial> m
            m_shape_instances[0].first->m_material->GetContactMethod() == mat->GetContactMethod());
     for (auto& shape : m_shape_instances)
         shape.first->m_material = mat;
+    mat->AssignId();
 }
 
 void ChCollisionModel::ArchiveOut(ChArchiveOut& archive_out) {
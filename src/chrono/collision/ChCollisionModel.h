@@ -154,6 +154,19 @@ class ChApi ChCollisionModel {
     static double GetDefaultSuggestedEnvelope();
     static double GetDefaultSuggestedMargin();
 
+    /// Enable/disable continuous collision detection for this model (default: false).
+    /// If enabled, and if the motion of the model over the current step exceeds its envelope, the collision system
+    /// sweeps the model AABB from its current to its predicted pose (extrapolated from the current velocity) and
+    /// generates speculative contacts, i.e., contacts with positive distance up to the motion bound. For pairs of
+    /// convex shapes, the time of impact is also computed so that the contact features at impact are used. This allows
+    /// fast or thin objects to be simulated with larger step sizes without tunneling. Speculative contacts are
+    /// effective with the NSC contact method; they produce no force with SMC. Currently supported only by the Bullet
+    /// collision system.
+    void EnableContinuousCollision(bool val) { model_ccd = val; }
+
+    /// Return true if continuous collision detection is enabled for this model.
+    bool IsContinuousCollisionEnabled() const { return model_ccd; }
+
     /// Return the current axis aligned bounding box (AABB) of the collision model.
     /// Note that SyncPosition() should be invoked before calling this.
     ChAABB GetBoundingBox() const;
@@ -187,6 +200,7 @@ class ChApi ChCollisionModel {
   private:
     float model_envelope;        ///< Maximum envelope: surrounding volume from surface to the exterior
     float model_safe_margin;     ///< Maximum margin value to be used for fast penetration contact detection
+    bool model_ccd;              ///< Continuous collision detection enabled
     ChContactable* contactable;  ///< Pointer to the contactable object
 
     short int family_group;  ///< Collision family group
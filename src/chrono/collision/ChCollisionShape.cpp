@@ -40,6 +40,7 @@ class ChCollisionShape_Type_enum_mapper : public ChCollisionShape {
     CH_ENUM_VAL(Type::PATH2D);
     CH_ENUM_VAL(Type::SEGMENT2D);
     CH_ENUM_VAL(Type::ARC2D);
+    CH_ENUM_VAL(Type::HEIGHTFIELD);
     CH_ENUM_VAL(Type::UNKNOWN_SHAPE);
     CH_ENUM_MAPPER_END(Type);
 };
@@ -47,7 +48,10 @@ class ChCollisionShape_Type_enum_mapper : public ChCollisionShape {
 ChCollisionShape::ChCollisionShape(Type type) : m_type(type), m_material(nullptr) {}
 
 ChCollisionShape::ChCollisionShape(Type type, std::shared_ptr<ChContactMaterial> material)
-    : m_type(type), m_material(material) {}
+    : m_type(type), m_material(material) {
+    if (m_material)
+        m_material->AssignId();
+}
 
 void ChCollisionShape::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
@@ -65,6 +69,8 @@ void ChCollisionShape::ArchiveIn(ChArchiveIn& archive_in) {
     /*int version =*/archive_in.VersionRead<ChCollisionShape>();
     // stream in all member data:
     archive_in >> CHNVP(m_material);
+    if (m_material)
+        m_material->AssignId();
 
     ChCollisionShape_Type_enum_mapper::Type_mapper typemapper;
     Type type = GetType();
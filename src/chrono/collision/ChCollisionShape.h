@@ -47,6 +47,7 @@ class ChApi ChCollisionShape {
         PATH2D,       // 2D path (compound object)
         SEGMENT2D,    // line segment (part of a 2D path)
         ARC2D,        // circlular arc (part of a 2D path)
+        HEIGHTFIELD,  // regular grid of heights (Bullet collision system only)
         UNKNOWN_SHAPE
     };
 
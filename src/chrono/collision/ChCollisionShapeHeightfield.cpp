@@ -0,0 +1,74 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "chrono/collision/ChCollisionShapeHeightfield.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChCollisionShapeHeightfield)
+CH_UPCASTING(ChCollisionShapeHeightfield, ChCollisionShape)
+
+ChCollisionShapeHeightfield::ChCollisionShapeHeightfield()
+    : ChCollisionShape(Type::HEIGHTFIELD), nx(0), ny(0), dx(0), dy(0) {}
+
+ChCollisionShapeHeightfield::ChCollisionShapeHeightfield(std::shared_ptr<ChContactMaterial> material,
+                                                         int nx,
+                                                         int ny,
+                                                         double dx,
+                                                         double dy,
+                                                         const std::vector<double>& heights)
+    : ChCollisionShape(Type::HEIGHTFIELD, material), nx(nx), ny(ny), dx(dx), dy(dy), heights(heights) {
+    if (nx < 2 || ny < 2 || heights.size() != (size_t)nx * ny)
+        throw std::invalid_argument("ChCollisionShapeHeightfield: inconsistent grid dimensions");
+}
+
+double ChCollisionShapeHeightfield::GetMinHeight() const {
+    return heights.empty() ? 0 : *std::min_element(heights.begin(), heights.end());
+}
+
+double ChCollisionShapeHeightfield::GetMaxHeight() const {
+    return heights.empty() ? 0 : *std::max_element(heights.begin(), heights.end());
+}
+
+void ChCollisionShapeHeightfield::ArchiveOut(ChArchiveOut& archive_out) {
+    // version number
+    archive_out.VersionWrite<ChCollisionShapeHeightfield>();
+    // serialize parent class
+    ChCollisionShape::ArchiveOut(archive_out);
+    // serialize all member data:
+    archive_out << CHNVP(nx);
+    archive_out << CHNVP(ny);
+    archive_out << CHNVP(dx);
+    archive_out << CHNVP(dy);
+    archive_out << CHNVP(heights);
+}
+
+void ChCollisionShapeHeightfield::ArchiveIn(ChArchiveIn& archive_in) {
+    // version number
+    /*int version =*/archive_in.VersionRead<ChCollisionShapeHeightfield>();
+    // deserialize parent class
+    ChCollisionShape::ArchiveIn(archive_in);
+    // stream in all member data:
+    archive_in >> CHNVP(nx);
+    archive_in >> CHNVP(ny);
+    archive_in >> CHNVP(dx);
+    archive_in >> CHNVP(dy);
+    archive_in >> CHNVP(heights);
+}
+
+}  // end namespace chrono
@@ -0,0 +1,87 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_COLLISION_SHAPE_HEIGHTFIELD_H
+#define CH_COLLISION_SHAPE_HEIGHTFIELD_H
+
+#include <vector>
+
+#include "chrono/collision/ChCollisionShape.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_collision
+/// @{
+
+/// Collision heightfield shape.
+/// The heightfield is a regular grid of nx x ny height samples, with spacings dx and dy, centered at the origin of the
+/// shape frame in the x-y plane and with heights measured along the z axis of the shape frame. Heights are stored with
+/// the x index running fastest, i.e. the height at grid node (i,j) is heights[i + nx * j]. Each grid cell is split in
+/// two triangles along the diagonal from node (i+1,j) to node (i,j+1).
+/// Unlike a triangle mesh, a heightfield requires no acceleration structure and has a negligible construction cost.
+/// Currently supported only by the Bullet collision system.
+class ChApi ChCollisionShapeHeightfield : public ChCollisionShape {
+  public:
+    ChCollisionShapeHeightfield();
+    ChCollisionShapeHeightfield(                      //
+        std::shared_ptr<ChContactMaterial> material,  ///< surface contact material
+        int nx,                                       ///< number of grid nodes in x direction
+        int ny,                                       ///< number of grid nodes in y direction
+        double dx,                                    ///< grid spacing in x direction
+        double dy,                                    ///< grid spacing in y direction
+        const std::vector<double>& heights            ///< node heights (nx * ny values, x index running fastest)
+    );
+
+    ~ChCollisionShapeHeightfield() {}
+
+    /// Get the number of grid nodes in x direction.
+    int GetNumPointsX() const { return nx; }
+
+    /// Get the number of grid nodes in y direction.
+    int GetNumPointsY() const { return ny; }
+
+    /// Get the grid spacing in x direction.
+    double GetSpacingX() const { return dx; }
+
+    /// Get the grid spacing in y direction.
+    double GetSpacingY() const { return dy; }
+
+    /// Get the node heights.
+    const std::vector<double>& GetHeights() const { return heights; }
+
+    /// Get the minimum node height.
+    double GetMinHeight() const;
+
+    /// Get the maximum node height.
+    double GetMaxHeight() const;
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOut(ChArchiveOut& archive_out) override;
+
+    /// Method to allow de-serialization of transient data from archives.
+    virtual void ArchiveIn(ChArchiveIn& archive_in) override;
+
+  private:
+    int nx;
+    int ny;
+    double dx;
+    double dy;
+    std::vector<double> heights;
+};
+
+/// @} chrono_collision
+
+}  // end namespace chrono
+
+#endif
@@ -24,6 +24,7 @@
 #include "chrono/collision/ChCollisionShapeCylinder.h"
 #include "chrono/collision/ChCollisionShapeCylindricalShell.h"
 #include "chrono/collision/ChCollisionShapeEllipsoid.h"
+#include "chrono/collision/ChCollisionShapeHeightfield.h"
 #include "chrono/collision/ChCollisionShapePath2D.h"
 #include "chrono/collision/ChCollisionShapePoint.h"
 #include "chrono/collision/ChCollisionShapeRoundedBox.h"
@@ -17,6 +17,7 @@
 
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/ChCollisionInfo.h"
+#include "chrono/collision/ChContactReduction.h"
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChFrame.h"
 #include "chrono/geometry/ChGeometry.h"
@@ -48,6 +49,9 @@ class ChApi ChCollisionSystem {
 
     virtual ~ChCollisionSystem();
 
+    /// Return the type of this collision system.
+    virtual Type GetType() const = 0;
+
     /// Test if the collision system was initialized.
     bool IsInitialized() const { return m_initialized; }
 
@@ -96,6 +100,10 @@ class ChApi ChCollisionSystem {
     /// Return the time (in seconds) for narrowphase collision detection.
     virtual double GetTimerCollisionNarrow() const = 0;
 
+    /// Return an estimate of the memory (in bytes) used by the collision system (collision objects, broadphase pairs,
+    /// contact manifolds). By default, returns 0.
+    virtual size_t GetMemoryUsage() const { return 0; }
+
     /// Reset any timers associated with collision detection.
     virtual void ResetTimers() {}
 
@@ -103,6 +111,11 @@ class ChApi ChCollisionSystem {
     /// The default implementation does nothing. Derived classes implement this function as applicable.
     virtual void SetNumThreads(int nthreads) {}
 
+    /// Enable/disable deterministic contact generation (see ChSystem::EnableDeterministic).
+    /// If enabled, contacts are reported in an order that does not depend on thread scheduling. The default
+    /// implementation does nothing. Derived classes implement this function as applicable.
+    virtual void SetDeterministic(bool val) {}
+
     /// After the Run() has completed, you can call this function to
     /// fill a 'contact container', that is an object inherited from class
     /// ChContactContainer. For instance ChSystem, after each Run()
@@ -168,6 +181,18 @@ class ChApi ChCollisionSystem {
     /// callback object will be called for each collision pair found during narrow phase.
     void RegisterNarrowphaseCallback(std::shared_ptr<NarrowphaseCallback> callback) { narrow_callback = callback; }
 
+    /// Return the narrow-phase callback object, if any (nullptr otherwise).
+    std::shared_ptr<NarrowphaseCallback> GetNarrowphaseCallback() const { return narrow_callback; }
+
+    /// Specify a contact reduction stage to be applied to the contacts found during the narrow-phase collision step,
+    /// before they are added to the contact container (default: none).
+    /// Contacts are clustered per pair of collision models and only a representative subset of each cluster is
+    /// kept. The narrow-phase callback, if any, is invoked before contact reduction.
+    void SetContactReduction(std::shared_ptr<ChContactReduction> reduction) { contact_reduction = reduction; }
+
+    /// Return the contact reduction stage, if any (nullptr otherwise).
+    std::shared_ptr<ChContactReduction> GetContactReduction() const { return contact_reduction; }
+
     /// Recover results from RayHit() raycasting.
     struct ChRayhitResult {
         bool hit;                    ///< if true, there was an hit
@@ -186,6 +211,18 @@ class ChApi ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const = 0;
 
+    /// Ray segment for batched ray-hit tests.
+    struct ChRay {
+        ChVector3d from;  ///< ray start point
+        ChVector3d to;    ///< ray end point
+    };
+
+    /// Perform ray-hit tests with the collision models for a batch of rays.
+    /// On return, results[i] contains the result of the ray-hit test for rays[i]. Return the number of rays with a hit.
+    /// The default implementation calls RayHit() for each ray in turn; derived classes can provide more efficient
+    /// (e.g., parallel) implementations. Results are identical to those obtained by calling RayHit() for each ray.
+    virtual int RayHitBatch(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const;
+
     /// Class to be used as a callback interface for user-defined visualization of collision shapes.
     class ChApi VisualizationCallback {
       public:
@@ -234,8 +271,9 @@ class ChApi ChCollisionSystem {
 
     ChSystem* m_system;  ///< associated Chrono system
 
-    std::shared_ptr<BroadphaseCallback> broad_callback;    ///< user callback for each near-enough pair of shapes
-    std::shared_ptr<NarrowphaseCallback> narrow_callback;  ///< user callback for each collision pair
+    std::shared_ptr<BroadphaseCallback> broad_callback;     ///< user callback for each near-enough pair of shapes
+    std::shared_ptr<NarrowphaseCallback> narrow_callback;   ///< user callback for each collision pair
+    std::shared_ptr<ChContactReduction> contact_reduction;  ///< optional contact reduction stage
 
     std::shared_ptr<VisualizationCallback> vis_callback;  ///< user callback for debug visualization
     int m_vis_flags;
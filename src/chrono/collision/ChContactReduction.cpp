@@ -0,0 +1,193 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <utility>
+
+#include "chrono/collision/ChContactReduction.h"
+#include "chrono/physics/ChContactContainer.h"
+#include "chrono/utils/ChConstants.h"
+
+namespace chrono {
+
+ChContactReduction::ChContactReduction() : m_max_points(4), m_num_input(0), m_num_output(0) {
+    SetNormalTolerance(15 * CH_DEG_TO_RAD);
+}
+
+void ChContactReduction::SetMaxPoints(int num_points) {
+    assert(num_points > 0);
+    m_max_points = num_points;
+}
+
+void ChContactReduction::SetNormalTolerance(double angle) {
+    m_normal_angle = angle;
+    m_normal_cos = std::cos(angle);
+}
+
+void ChContactReduction::Reset() {
+    m_contacts.clear();
+}
+
+void ChContactReduction::AddContact(const ChCollisionInfo& cinfo) {
+    m_contacts.push_back(cinfo);
+}
+
+// Contact point (midpoint between the points on the two surfaces).
+static inline ChVector3d ContactPoint(const ChCollisionInfo& cinfo) {
+    return 0.5 * (cinfo.vpA + cinfo.vpB);
+}
+
+void ChContactReduction::ReduceCluster(const std::vector<unsigned int>& cluster) {
+    if (cluster.size() <= (size_t)m_max_points) {
+        m_selected.insert(m_selected.end(), cluster.begin(), cluster.end());
+        return;
+    }
+
+    // Reference normal and in-plane projection
+    const ChVector3d& n = m_contacts[cluster[0]].vN;
+    auto project = [&n](const ChVector3d& v) { return v - Vdot(v, n) * n; };
+
+    std::vector<unsigned int> sel;
+    std::vector<bool> used(cluster.size(), false);
+    auto select = [&](size_t k) {
+        sel.push_back(cluster[k]);
+        used[k] = true;
+    };
+
+    // Select the unused point maximizing the given score (if above the threshold)
+    auto select_max = [&](const std::function<double(const ChVector3d&)>& score, double threshold) {
+        size_t best = cluster.size();
+        double best_score = threshold;
+        for (size_t k = 0; k < cluster.size(); k++) {
+            if (used[k])
+                continue;
+            double s = score(ContactPoint(m_contacts[cluster[k]]));
+            if (s > best_score) {
+                best_score = s;
+                best = k;
+            }
+        }
+        if (best < cluster.size())
+            select(best);
+        return best < cluster.size();
+    };
+
+    // 1. Deepest point
+    size_t k0 = 0;
+    for (size_t k = 1; k < cluster.size(); k++) {
+        if (m_contacts[cluster[k]].distance < m_contacts[cluster[k0]].distance)
+            k0 = k;
+    }
+    select(k0);
+    ChVector3d p0 = ContactPoint(m_contacts[cluster[k0]]);
+
+    // Tolerance for coincident points, relative to the extent of the cluster
+    double extent2 = 0;
+    for (auto i : cluster)
+        extent2 = std::max(extent2, project(ContactPoint(m_contacts[i]) - p0).Length2());
+    double tol = 1e-12 * extent2;
+
+    // 2. Point farthest from the deepest point
+    auto dist0 = [&](const ChVector3d& p) { return project(p - p0).Length2(); };
+    if ((int)sel.size() < m_max_points && select_max(dist0, tol)) {
+        ChVector3d e = ContactPoint(m_contacts[sel.back()]) - p0;
+
+        // 3-4. Points spanning the largest triangles on either side of the first edge
+        auto area = [&](const ChVector3d& p) { return Vdot(Vcross(e, p - p0), n); };
+        double tol_area = 1e-6 * extent2;
+        if ((int)sel.size() < m_max_points)
+            select_max(area, tol_area);
+        if ((int)sel.size() < m_max_points)
+            select_max([&](const ChVector3d& p) { return -area(p); }, tol_area);
+    }
+
+    // 5+. Points farthest from the already selected ones
+    while ((int)sel.size() < m_max_points) {
+        auto min_dist = [&](const ChVector3d& p) {
+            double d2 = std::numeric_limits<double>::max();
+            for (auto i : sel)
+                d2 = std::min(d2, project(p - ContactPoint(m_contacts[i])).Length2());
+            return d2;
+        };
+        if (!select_max(min_dist, tol))
+            break;
+    }
+
+    m_selected.insert(m_selected.end(), sel.begin(), sel.end());
+}
+
+void ChContactReduction::ReportContacts(ChContactContainer* container) {
+    m_num_input = (unsigned int)m_contacts.size();
+
+    // Order contacts by (unordered) pair of collision models, preserving the order in which they were reported
+    typedef std::pair<ChCollisionModel*, ChCollisionModel*> ModelPair;
+    auto key = [](const ChCollisionInfo& cinfo) {
+        return std::less<ChCollisionModel*>()(cinfo.modelA, cinfo.modelB) ? ModelPair(cinfo.modelA, cinfo.modelB)
+                                                                          : ModelPair(cinfo.modelB, cinfo.modelA);
+    };
+    m_order.resize(m_contacts.size());
+    for (unsigned int i = 0; i < m_order.size(); i++)
+        m_order[i] = i;
+    std::stable_sort(m_order.begin(), m_order.end(), [&](unsigned int a, unsigned int b) {
+        return key(m_contacts[a]) < key(m_contacts[b]);
+    });
+
+    // Process each pair of collision models
+    m_selected.clear();
+    std::vector<std::vector<unsigned int>> clusters;
+    std::vector<ChVector3d> normals;
+    size_t start = 0;
+    while (start < m_order.size()) {
+        auto pair = key(m_contacts[m_order[start]]);
+        size_t end = start + 1;
+        while (end < m_order.size() && key(m_contacts[m_order[end]]) == pair)
+            end++;
+
+        if (end - start <= (size_t)m_max_points) {
+            m_selected.insert(m_selected.end(), m_order.begin() + start, m_order.begin() + end);
+        } else {
+            // Cluster contacts by normal direction (normals oriented consistently for the pair)
+            clusters.clear();
+            normals.clear();
+            for (size_t k = start; k < end; k++) {
+                const auto& cinfo = m_contacts[m_order[k]];
+                ChVector3d n = (cinfo.modelA == pair.first) ? cinfo.vN : -cinfo.vN;
+                size_t c = 0;
+                while (c < clusters.size() && Vdot(n, normals[c]) < m_normal_cos)
+                    c++;
+                if (c == clusters.size()) {
+                    clusters.push_back({});
+                    normals.push_back(n);
+                }
+                clusters[c].push_back(m_order[k]);
+            }
+            for (const auto& cluster : clusters)
+                ReduceCluster(cluster);
+        }
+
+        start = end;
+    }
+
+    // Report retained contacts in their original order
+    std::sort(m_selected.begin(), m_selected.end());
+    for (auto i : m_selected)
+        container->AddContact(m_contacts[i]);
+
+    m_num_output = (unsigned int)m_selected.size();
+}
+
+}  // end namespace chrono
@@ -0,0 +1,99 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_CONTACT_REDUCTION_H
+#define CH_CONTACT_REDUCTION_H
+
+#include <vector>
+
+#include "chrono/collision/ChCollisionInfo.h"
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+// forward references
+class ChContactContainer;
+
+/// @addtogroup chrono_collision
+/// @{
+
+/// Contact reduction stage, between the narrowphase of a collision system and the contact container.
+/// Contacts reported by the collision system are buffered and clustered per pair of collision models and, within each
+/// pair, by contact normal direction. Each cluster with more than the maximum number of points is replaced by a
+/// representative subset of its contacts, selected to preserve the extent of the contact patch:
+/// - the deepest contact point;
+/// - the point farthest from it (in the contact plane);
+/// - the two points spanning the largest triangle areas on either side of the first edge;
+/// - if more points are allowed, points farthest from those already selected.
+/// This is mostly useful for mesh-to-mesh contacts, which can otherwise generate a large number of near-duplicate
+/// contacts per pair of bodies. Note that, with penalty-based (SMC) contact, removing contact points reduces the
+/// total contact force for a given penetration; contact reduction is therefore better suited for NSC systems.
+class ChApi ChContactReduction {
+  public:
+    ChContactReduction();
+    ~ChContactReduction() {}
+
+    /// Set the maximum number of contact points kept in each cluster (default: 4).
+    void SetMaxPoints(int num_points);
+
+    /// Get the maximum number of contact points kept in each cluster.
+    int GetMaxPoints() const { return m_max_points; }
+
+    /// Set the maximum angle (in radians) between contact normals in the same cluster (default: 15 degrees).
+    /// Contacts of a pair of collision models with normals deviating by more than this angle from the first normal of a
+    /// cluster are assigned to a different cluster (e.g., contacts on different faces of an object).
+    void SetNormalTolerance(double angle);
+
+    /// Get the maximum angle between contact normals in the same cluster.
+    double GetNormalTolerance() const { return m_normal_angle; }
+
+    /// Discard all buffered contacts.
+    /// Called by the collision system before reporting contacts.
+    void Reset();
+
+    /// Buffer a contact generated by the collision system.
+    void AddContact(const ChCollisionInfo& cinfo);
+
+    /// Reduce the buffered contacts and add the retained ones to the specified contact container.
+    /// Called by the collision system after all contacts were buffered, before EndAddContact().
+    void ReportContacts(ChContactContainer* container);
+
+    /// Return the number of contacts buffered at the last report.
+    unsigned int GetNumInputContacts() const { return m_num_input; }
+
+    /// Return the number of contacts added to the contact container at the last report.
+    unsigned int GetNumOutputContacts() const { return m_num_output; }
+
+  private:
+    /// Select a representative subset of the contacts in the given cluster (indices in m_contacts).
+    /// The selected indices are appended to m_selected.
+    void ReduceCluster(const std::vector<unsigned int>& cluster);
+
+    int m_max_points;       ///< maximum number of contacts per cluster
+    double m_normal_angle;  ///< maximum angle between normals in the same cluster
+    double m_normal_cos;    ///< cosine of the above
+
+    std::vector<ChCollisionInfo> m_contacts;  ///< buffered contacts
+    std::vector<unsigned int> m_order;        ///< contact indices, sorted by pair of collision models
+    std::vector<unsigned int> m_selected;     ///< indices of retained contacts
+
+    unsigned int m_num_input;   ///< number of buffered contacts at last report
+    unsigned int m_num_output;  ///< number of retained contacts at last report
+};
+
+/// @} chrono_collision
+
+}  // end namespace chrono
+
+#endif
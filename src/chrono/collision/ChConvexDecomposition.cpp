@@ -12,29 +12,71 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <iomanip>
+#include <sstream>
+#include <unordered_map>
 
 #include "chrono/collision/ChConvexDecomposition.h"
+#include "chrono/core/ChTaskScheduler.h"
 #include "chrono_thirdparty/HACDv2/wavefront.h"
 
 namespace chrono {
 
 //
 // Utility functions to process bad topology in meshes with repeated vertices
-//  (to be optimized for performance; in future it is better to use hash lookup)
 //
 
-int GetIndex(ChVector3d vertex, std::vector<ChVector3d>& vertexOUT, double tol) {
-    // Suboptimal: search vertexes with same position and reuse, (in future: adopt hash map..)
-    for (unsigned int iv = 0; iv < vertexOUT.size(); iv++) {
-        if (vertex.Equals(vertexOUT[iv], tol)) {
-            return iv;
+// Lookup of vertices within a given tolerance, using a uniform grid of cells hashed by their integer coordinates.
+// Candidates are searched in the 27 cells around a vertex; the first inserted match is reused (as a linear search
+// through all vertices would do).
+class VertexGrid {
+  public:
+    VertexGrid(std::vector<ChVector3d>& vertices, double tol)
+        : m_vertices(vertices), m_tol(tol), m_cell(std::max(tol, 1e-9)) {}
+
+    int GetIndex(const ChVector3d& vertex) {
+        int64_t ix = (int64_t)std::floor(vertex.x() / m_cell);
+        int64_t iy = (int64_t)std::floor(vertex.y() / m_cell);
+        int64_t iz = (int64_t)std::floor(vertex.z() / m_cell);
+
+        int found = -1;
+        for (int64_t i = ix - 1; i <= ix + 1; i++) {
+            for (int64_t j = iy - 1; j <= iy + 1; j++) {
+                for (int64_t k = iz - 1; k <= iz + 1; k++) {
+                    auto cell = m_cells.find(Key(i, j, k));
+                    if (cell == m_cells.end())
+                        continue;
+                    for (int iv : cell->second) {
+                        if ((found < 0 || iv < found) && vertex.Equals(m_vertices[iv], m_tol))
+                            found = iv;
+                    }
+                }
+            }
         }
+        if (found >= 0)
+            return found;
+
+        // not found, so add it to new vertexes
+        m_vertices.push_back(vertex);
+        m_cells[Key(ix, iy, iz)].push_back((int)m_vertices.size() - 1);
+        return (int)m_vertices.size() - 1;
     }
-    // not found, so add it to new vertexes
-    vertexOUT.push_back(vertex);
-    return ((int)vertexOUT.size() - 1);
-}
+
+  private:
+    static uint64_t Key(int64_t i, int64_t j, int64_t k) {
+        return (uint64_t)i * 73856093ULL ^ (uint64_t)j * 19349663ULL ^ (uint64_t)k * 83492791ULL;
+    }
+
+    std::vector<ChVector3d>& m_vertices;
+    double m_tol;
+    double m_cell;
+    std::unordered_map<uint64_t, std::vector<int>> m_cells;
+};
 
 void FuseMesh(std::vector<ChVector3d>& vertexIN,
               std::vector<ChVector3i>& triangleIN,
@@ -43,10 +85,11 @@ void FuseMesh(std::vector<ChVector3d>& vertexIN,
               double tol = 0.0) {
     vertexOUT.clear();
     triangleOUT.clear();
+    VertexGrid grid(vertexOUT, tol);
     for (unsigned int it = 0; it < triangleIN.size(); it++) {
-        unsigned int i1 = GetIndex(vertexIN[triangleIN[it].x()], vertexOUT, tol);
-        unsigned int i2 = GetIndex(vertexIN[triangleIN[it].y()], vertexOUT, tol);
-        unsigned int i3 = GetIndex(vertexIN[triangleIN[it].z()], vertexOUT, tol);
+        unsigned int i1 = grid.GetIndex(vertexIN[triangleIN[it].x()]);
+        unsigned int i2 = grid.GetIndex(vertexIN[triangleIN[it].y()]);
+        unsigned int i3 = grid.GetIndex(vertexIN[triangleIN[it].z()]);
 
         ChVector3i merged_triangle(i1, i2, i3);
 
@@ -54,10 +97,42 @@ void FuseMesh(std::vector<ChVector3d>& vertexIN,
     }
 }
 
+// Split a mesh into its connected components (triangles sharing vertices), returned as lists of triangle indices
+// ordered by their first triangle.
+std::vector<std::vector<int>> SplitMesh(size_t num_vertices, const std::vector<ChVector3i>& triangles) {
+    std::vector<int> parent(num_vertices);
+    for (size_t iv = 0; iv < num_vertices; iv++)
+        parent[iv] = (int)iv;
+    auto root = [&parent](int iv) {
+        while (parent[iv] != iv)
+            iv = parent[iv] = parent[parent[iv]];
+        return iv;
+    };
+    for (const auto& t : triangles) {
+        int r1 = root(t.x());
+        int r2 = root(t.y());
+        int r3 = root(t.z());
+        parent[r2] = r1;
+        parent[r3] = r1;
+    }
+
+    std::vector<std::vector<int>> components;
+    std::unordered_map<int, int> component_index;
+    for (int it = 0; it < (int)triangles.size(); it++) {
+        auto c = component_index.insert({root(triangles[it].x()), (int)components.size()});
+        if (c.second)
+            components.push_back(std::vector<int>());
+        components[c.first->second].push_back(it);
+    }
+    return components;
+}
+
 ////////////////////////////////////////////////////////////////////////////
 
+static std::string default_cache_dir;
+
 /// Basic constructor
-ChConvexDecomposition::ChConvexDecomposition() {}
+ChConvexDecomposition::ChConvexDecomposition() : m_cache_dir(default_cache_dir), m_cache_hit(false) {}
 
 /// Destructor
 ChConvexDecomposition::~ChConvexDecomposition() {}
@@ -74,6 +149,32 @@ bool ChConvexDecomposition::AddTriangleMesh(const ChTriangleMesh& tm) {
     return true;
 }
 
+void ChConvexDecomposition::SetDefaultCacheDirectory(const std::string& dir) {
+    default_cache_dir = dir;
+}
+
+unsigned int ChConvexDecomposition::GetHullCount() {
+    return (unsigned int)m_hulls.size();
+}
+
+bool ChConvexDecomposition::GetConvexHullResult(unsigned int hullIndex, std::vector<ChVector3d>& convexhull) {
+    if (hullIndex >= m_hulls.size())
+        return false;
+
+    convexhull = m_hulls[hullIndex].vertices;
+    return true;
+}
+
+bool ChConvexDecomposition::GetConvexHullResult(unsigned int hullIndex, ChTriangleMesh& convextrimesh) {
+    if (hullIndex >= m_hulls.size())
+        return false;
+
+    const auto& hull = m_hulls[hullIndex];
+    for (const auto& f : hull.faces)
+        convextrimesh.AddTriangle(hull.vertices[f.x()], hull.vertices[f.y()], hull.vertices[f.z()]);
+    return true;
+}
+
 bool ChConvexDecomposition::WriteConvexHullsAsChullsFile(std::ostream& mstream) {
     mstream << std::setprecision(9) << std::defaultfloat;
     mstream << "# Convex hulls obtained with Chrono::Engine\n"
@@ -93,6 +194,126 @@ bool ChConvexDecomposition::WriteConvexHullsAsChullsFile(std::ostream& mstream)
     return true;
 }
 
+void ChConvexDecomposition::WriteConvexHullsAsWavefrontObj(std::ostream& mstream) {
+    mstream << "# Convex hulls obtained with Chrono::Engine \n# convex decomposition \n\n";
+    unsigned int vcount_base = 1;
+    char buffer[200];
+    for (unsigned int hullIndex = 0; hullIndex < m_hulls.size(); hullIndex++) {
+        const auto& hull = m_hulls[hullIndex];
+        mstream << "g hull_" << hullIndex << "\n";
+        for (const auto& v : hull.vertices) {
+            snprintf(buffer, sizeof(buffer), "v %0.9f %0.9f %0.9f\r\n", v.x(), v.y(), v.z());
+            mstream << buffer;
+        }
+        for (const auto& f : hull.faces) {
+            snprintf(buffer, sizeof(buffer), "f %d %d %d\r\n", f.x() + vcount_base, f.y() + vcount_base,
+                     f.z() + vcount_base);
+            mstream << buffer;
+        }
+        vcount_base += (unsigned int)hull.vertices.size();
+    }
+}
+
+//
+// ON-DISK CACHE
+//
+// Each cache entry is a binary file named after the 64-bit key (hash of input mesh and parameters), containing a
+// header followed, for each hull, by the number of vertices and faces, the vertex coordinates, and the face indices.
+//
+
+static const char cache_tag[4] = {'C', 'H', 'C', 'D'};
+static const uint32_t cache_version = 1;
+
+static std::string CacheFilename(const std::string& dir, uint64_t key) {
+    std::stringstream ss;
+    ss << dir << "/" << std::hex << std::setw(16) << std::setfill('0') << key << ".chcd";
+    return ss.str();
+}
+
+uint64_t ChConvexDecomposition::HashData(const void* data, size_t size, uint64_t hash) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+bool ChConvexDecomposition::ReadCache(uint64_t key) {
+    m_cache_hit = false;
+    if (m_cache_dir.empty())
+        return false;
+
+    std::ifstream file(CacheFilename(m_cache_dir, key), std::ios::binary);
+    if (!file.good())
+        return false;
+
+    char tag[4];
+    uint32_t version = 0;
+    uint64_t stored_key = 0;
+    uint32_t num_hulls = 0;
+    file.read(tag, 4);
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&stored_key), sizeof(stored_key));
+    file.read(reinterpret_cast<char*>(&num_hulls), sizeof(num_hulls));
+    if (!file.good() || std::memcmp(tag, cache_tag, 4) != 0 || version != cache_version || stored_key != key)
+        return false;
+
+    std::vector<Hull> hulls(num_hulls);
+    for (auto& hull : hulls) {
+        uint32_t sizes[2] = {0, 0};
+        file.read(reinterpret_cast<char*>(sizes), sizeof(sizes));
+        if (!file.good())
+            return false;
+        hull.vertices.resize(sizes[0]);
+        hull.faces.resize(sizes[1]);
+        for (auto& v : hull.vertices)
+            file.read(reinterpret_cast<char*>(v.data()), 3 * sizeof(double));
+        for (auto& f : hull.faces)
+            file.read(reinterpret_cast<char*>(f.data()), 3 * sizeof(int));
+        if (!file.good())
+            return false;
+    }
+
+    m_hulls = std::move(hulls);
+    m_cache_hit = true;
+    return true;
+}
+
+void ChConvexDecomposition::WriteCache(uint64_t key) const {
+    if (m_cache_dir.empty())
+        return;
+
+    // Write to a temporary file, then move it in place (the cache may be shared by concurrent processes)
+    std::string filename = CacheFilename(m_cache_dir, key);
+    std::string tmp_filename = filename + ".tmp";
+    {
+        std::ofstream file(tmp_filename, std::ios::binary);
+        uint32_t num_hulls = (uint32_t)m_hulls.size();
+        file.write(cache_tag, 4);
+        file.write(reinterpret_cast<const char*>(&cache_version), sizeof(cache_version));
+        file.write(reinterpret_cast<const char*>(&key), sizeof(key));
+        file.write(reinterpret_cast<const char*>(&num_hulls), sizeof(num_hulls));
+        for (const auto& hull : m_hulls) {
+            uint32_t sizes[2] = {(uint32_t)hull.vertices.size(), (uint32_t)hull.faces.size()};
+            file.write(reinterpret_cast<const char*>(sizes), sizeof(sizes));
+            for (const auto& v : hull.vertices)
+                file.write(reinterpret_cast<const char*>(v.data()), 3 * sizeof(double));
+            for (const auto& f : hull.faces)
+                file.write(reinterpret_cast<const char*>(f.data()), 3 * sizeof(int));
+        }
+        if (!file.good()) {
+            std::cerr << "ERROR: ChConvexDecomposition: cannot write cache file " << filename << std::endl;
+            file.close();
+            std::remove(tmp_filename.c_str());
+            return;
+        }
+    }
+    std::remove(filename.c_str());
+    if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0)
+        std::cerr << "ERROR: ChConvexDecomposition: cannot write cache file " << filename << std::endl;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -119,6 +340,7 @@ void ChConvexDecompositionHACD::Reset(void) {
     myHACD = HACD::CreateHACD();
     this->points.clear();
     this->triangles.clear();
+    this->m_hulls.clear();
 }
 
 bool ChConvexDecompositionHACD::AddTriangle(const ChVector3d& v1, const ChVector3d& v2, const ChVector3d& v3) {
@@ -165,6 +387,24 @@ void ChConvexDecompositionHACD::SetParameters(unsigned int nClusters,
 }
 
 int ChConvexDecompositionHACD::ComputeConvexDecomposition() {
+    // Cache key: hash of algorithm, parameters, and input mesh
+    double params[] = {(double)myHACD->GetNClusters(),
+                       (double)myHACD->GetTargetNTrianglesDecimatedMesh(),
+                       myHACD->GetSmallClusterThreshold(),
+                       (double)myHACD->GetAddFacesPoints(),
+                       (double)myHACD->GetAddExtraDistPoints(),
+                       myHACD->GetConcavity(),
+                       myHACD->GetConnectDist(),
+                       myHACD->GetVolumeWeight(),
+                       myHACD->GetCompacityWeight(),
+                       (double)myHACD->GetNVerticesPerCH()};
+    uint64_t key = HashData("HACD", 4);
+    key = HashData(params, sizeof(params), key);
+    key = HashData(points.data(), points.size() * sizeof(points[0]), key);
+    key = HashData(triangles.data(), triangles.size() * sizeof(triangles[0]), key);
+    if (ReadCache(key))
+        return (int)m_hulls.size();
+
     myHACD->SetPoints(&this->points[0]);
     myHACD->SetNPoints(points.size());
     myHACD->SetTriangles(&this->triangles[0]);
@@ -172,105 +412,27 @@ int ChConvexDecompositionHACD::ComputeConvexDecomposition() {
 
     myHACD->Compute();
 
-    return (int)myHACD->GetNClusters();
-}
-
-/// Get the number of computed hulls after the convex decomposition
-unsigned int ChConvexDecompositionHACD::GetHullCount() {
-    return (unsigned int)this->myHACD->GetNClusters();
-}
-
-bool ChConvexDecompositionHACD::GetConvexHullResult(unsigned int hullIndex, std::vector<ChVector3d>& convexhull) {
-    if (hullIndex > myHACD->GetNClusters())
-        return false;
-
-    size_t nPoints = myHACD->GetNPointsCH(hullIndex);
-    size_t nTriangles = myHACD->GetNTrianglesCH(hullIndex);
-
-    HACD::Vec3<HACD::Real>* pointsCH = new HACD::Vec3<HACD::Real>[nPoints];
-    HACD::Vec3<long>* trianglesCH = new HACD::Vec3<long>[nTriangles];
-    myHACD->GetCH(hullIndex, pointsCH, trianglesCH);
-
-    // convert to chrono data...
-    convexhull.clear();
-    for (unsigned int i = 0; i < nPoints; i++) {
-        ChVector3d point(pointsCH[i].X(), pointsCH[i].Y(), pointsCH[i].Z());
-        convexhull.push_back(point);
-    }
-
-    delete[] pointsCH;
-    delete[] trianglesCH;
-
-    return true;
-}
-
-/// Get the n-th computed convex hull, by filling a ChTriangleMesh object
-/// that is passed as a parameter.
-bool ChConvexDecompositionHACD::GetConvexHullResult(unsigned int hullIndex, ChTriangleMesh& convextrimesh) {
-    if (hullIndex > myHACD->GetNClusters())
-        return false;
-
-    size_t nPoints = myHACD->GetNPointsCH(hullIndex);
-    size_t nTriangles = myHACD->GetNTrianglesCH(hullIndex);
-
-    HACD::Vec3<HACD::Real>* pointsCH = new HACD::Vec3<HACD::Real>[nPoints];
-    HACD::Vec3<long>* trianglesCH = new HACD::Vec3<long>[nTriangles];
-    myHACD->GetCH(hullIndex, pointsCH, trianglesCH);
-
-    for (unsigned int i = 0; i < nTriangles; i++) {
-        unsigned int i1 = trianglesCH[i].X();
-        unsigned int i2 = trianglesCH[i].Y();
-        unsigned int i3 = trianglesCH[i].Z();
-        convextrimesh.AddTriangle(ChVector3d(pointsCH[i1].X(), pointsCH[i1].Y(), pointsCH[i1].Z()),
-                                  ChVector3d(pointsCH[i2].X(), pointsCH[i2].Y(), pointsCH[i2].Z()),
-                                  ChVector3d(pointsCH[i3].X(), pointsCH[i3].Y(), pointsCH[i3].Z()));
-    }
-
-    delete[] pointsCH;
-    delete[] trianglesCH;
-
-    return true;
-}
-
-//
-// SERIALIZATION
-//
-
-void ChConvexDecompositionHACD::WriteConvexHullsAsWavefrontObj(std::ostream& mstream) {
-    mstream << "# Convex hulls obtained with Chrono::Engine \n# convex decomposition \n\n";
-    NxU32 vcount_base = 1;
-    NxU32 vcount_total = 0;
-    NxU32 tcount_total = 0;
-    char buffer[200];
-    for (unsigned int hullIndex = 0; hullIndex < this->GetHullCount(); hullIndex++) {
-        mstream << "g hull_" << hullIndex << "\n";
-
+    // Extract the hulls
+    m_hulls.clear();
+    m_hulls.resize(myHACD->GetNClusters());
+    for (size_t hullIndex = 0; hullIndex < m_hulls.size(); hullIndex++) {
         size_t nPoints = myHACD->GetNPointsCH(hullIndex);
         size_t nTriangles = myHACD->GetNTrianglesCH(hullIndex);
 
-        HACD::Vec3<HACD::Real>* pointsCH = new HACD::Vec3<HACD::Real>[nPoints];
-        HACD::Vec3<long>* trianglesCH = new HACD::Vec3<long>[nTriangles];
-        myHACD->GetCH(hullIndex, pointsCH, trianglesCH);
-
-        vcount_total += (NxU32)nPoints;
-        tcount_total += (NxU32)nTriangles;
-        for (unsigned int i = 0; i < nPoints; i++) {
-            snprintf(buffer, sizeof(buffer), "v %0.9f %0.9f %0.9f\r\n", pointsCH[i].X(), pointsCH[i].Y(),
-                     pointsCH[i].Z());
-            mstream << buffer;
-        }
-        for (unsigned int i = 0; i < nTriangles; i++) {
-            unsigned int i1 = trianglesCH[i].X();
-            unsigned int i2 = trianglesCH[i].Y();
-            unsigned int i3 = trianglesCH[i].Z();
-            snprintf(buffer, sizeof(buffer), "f %d %d %d\r\n", i1 + vcount_base, i2 + vcount_base, i3 + vcount_base);
-            mstream << buffer;
-        }
-        vcount_base += (NxU32)nPoints;
+        std::vector<HACD::Vec3<HACD::Real>> pointsCH(nPoints);
+        std::vector<HACD::Vec3<long>> trianglesCH(nTriangles);
+        myHACD->GetCH(hullIndex, pointsCH.data(), trianglesCH.data());
 
-        delete[] pointsCH;
-        delete[] trianglesCH;
+        auto& hull = m_hulls[hullIndex];
+        for (const auto& p : pointsCH)
+            hull.vertices.push_back(ChVector3d(p.X(), p.Y(), p.Z()));
+        for (const auto& t : trianglesCH)
+            hull.faces.push_back(ChVector3i((int)t.X(), (int)t.Y(), (int)t.Z()));
     }
+
+    WriteCache(key);
+
+    return (int)m_hulls.size();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -287,6 +449,7 @@ ChConvexDecompositionHACDv2::ChConvexDecompositionHACDv2() {
     gHACD = HACD::createHACD_API();
 
     this->fuse_tol = 1e-9;
+    this->parallel = false;
 }
 
 /// Destructor
@@ -300,6 +463,7 @@ void ChConvexDecompositionHACDv2::Reset(void) {
 
     this->points.clear();
     this->triangles.clear();
+    this->m_hulls.clear();
 }
 
 bool ChConvexDecompositionHACDv2::AddTriangle(const ChVector3d& v1, const ChVector3d& v2, const ChVector3d& v3) {
@@ -348,127 +512,132 @@ class MyCallback : public hacd::ICallback {
     virtual void ReportProgress(const char* message, hacd::HaF32 progress) { std::cout << message; }
 };
 
-int ChConvexDecompositionHACDv2::ComputeConvexDecomposition() {
-    if (!gHACD)
-        return 0;
-
-    // Preprocess: fuse repeated vertices...
-
-    std::vector<ChVector3d> points_FUSED;
-    std::vector<ChVector3i> triangles_FUSED;
-    FuseMesh(this->points, this->triangles, points_FUSED, triangles_FUSED, this->fuse_tol);
+// Callback for decompositions running concurrently (no progress output)
+class SilentCallback : public hacd::ICallback {
+  public:
+    virtual bool Cancelled() { return false; }
+    virtual void ReportProgress(const char* message, hacd::HaF32 progress) {}
+};
 
+void ChConvexDecompositionHACDv2::Decompose(HACD::HACD_API* hacd,
+                                            HACD::HACD_API::Desc desc,
+                                            const std::vector<ChVector3d>& points,
+                                            const std::vector<ChVector3i>& triangles,
+                                            hacd::ICallback* callback,
+                                            std::vector<Hull>& hulls) {
     // Convert to HACD format
 
-    this->descriptor.mTriangleCount = (hacd::HaU32)triangles_FUSED.size();
-    this->descriptor.mVertexCount = (hacd::HaU32)points_FUSED.size();
-    this->descriptor.mIndices = new hacd::HaU32[3 * this->descriptor.mTriangleCount];
-    this->descriptor.mVertices = new hacd::HaF32[3 * this->descriptor.mVertexCount];
-    for (unsigned int mv = 0; mv < points_FUSED.size(); mv++) {
-        ((hacd::HaF32*)descriptor.mVertices)[mv * 3 + 0] = (float)points_FUSED[mv].x();
-        ((hacd::HaF32*)descriptor.mVertices)[mv * 3 + 1] = (float)points_FUSED[mv].y();
-        ((hacd::HaF32*)descriptor.mVertices)[mv * 3 + 2] = (float)points_FUSED[mv].z();
+    std::vector<hacd::HaU32> indices(3 * triangles.size());
+    std::vector<hacd::HaF32> vertices(3 * points.size());
+    for (unsigned int mv = 0; mv < points.size(); mv++) {
+        vertices[mv * 3 + 0] = (float)points[mv].x();
+        vertices[mv * 3 + 1] = (float)points[mv].y();
+        vertices[mv * 3 + 2] = (float)points[mv].z();
     }
-    for (unsigned int mt = 0; mt < triangles_FUSED.size(); mt++) {
-        ((hacd::HaU32*)descriptor.mIndices)[mt * 3 + 0] = triangles_FUSED[mt].x();
-        ((hacd::HaU32*)descriptor.mIndices)[mt * 3 + 1] = triangles_FUSED[mt].y();
-        ((hacd::HaU32*)descriptor.mIndices)[mt * 3 + 2] = triangles_FUSED[mt].z();
+    for (unsigned int mt = 0; mt < triangles.size(); mt++) {
+        indices[mt * 3 + 0] = triangles[mt].x();
+        indices[mt * 3 + 1] = triangles[mt].y();
+        indices[mt * 3 + 2] = triangles[mt].z();
     }
-
-    MyCallback callback;
-    descriptor.mCallback = static_cast<hacd::ICallback*>(&callback);
+    desc.mTriangleCount = (hacd::HaU32)triangles.size();
+    desc.mVertexCount = (hacd::HaU32)points.size();
+    desc.mIndices = indices.data();
+    desc.mVertices = vertices.data();
+    desc.mCallback = callback;
 
     // Perform the decomposition!
 
-    hacd::HaU32 hullCount = gHACD->performHACD(this->descriptor);
+    hacd::HaU32 hullCount = hacd->performHACD(desc);
 
-    delete[] this->descriptor.mIndices;
-    delete[] this->descriptor.mVertices;
-    this->descriptor.mTriangleCount = 0;
-    this->descriptor.mVertexCount = 0;
+    // Extract the hulls
 
-    return hullCount;
-}
-
-/// Get the number of computed hulls after the convex decomposition
-unsigned int ChConvexDecompositionHACDv2::GetHullCount() {
-    return this->gHACD->getHullCount();
-}
-
-bool ChConvexDecompositionHACDv2::GetConvexHullResult(unsigned int hullIndex, std::vector<ChVector3d>& convexhull) {
-    if (hullIndex > this->gHACD->getHullCount())
-        return false;
-
-    const HACD::HACD_API::Hull* hull = gHACD->getHull(hullIndex);
-    if (hull) {
-        for (hacd::HaU32 i = 0; i < hull->mVertexCount; i++) {
-            const hacd::HaF32* p = &hull->mVertices[i * 3];
-            ChVector3d point(p[0], p[1], p[2]);
-            convexhull.push_back(point);
+    for (hacd::HaU32 i = 0; i < hullCount; i++) {
+        const HACD::HACD_API::Hull* hacd_hull = hacd->getHull(i);
+        if (!hacd_hull)
+            continue;
+        Hull hull;
+        for (hacd::HaU32 j = 0; j < hacd_hull->mVertexCount; j++) {
+            const hacd::HaF32* p = &hacd_hull->mVertices[j * 3];
+            hull.vertices.push_back(ChVector3d(p[0], p[1], p[2]));
         }
-        return true;
-    }
-    return false;
-}
-
-/// Get the n-th computed convex hull, by filling a ChTriangleMesh object
-/// that is passed as a parameter.
-bool ChConvexDecompositionHACDv2::GetConvexHullResult(unsigned int hullIndex, ChTriangleMesh& convextrimesh) {
-    if (hullIndex > this->gHACD->getHullCount())
-        return false;
-
-    const HACD::HACD_API::Hull* hull = gHACD->getHull(hullIndex);
-    if (hull) {
-        for (unsigned int i = 0; i < hull->mTriangleCount; i++) {
-            unsigned int i1 = 3 * hull->mIndices[i * 3 + 0];
-            unsigned int i2 = 3 * hull->mIndices[i * 3 + 1];
-            unsigned int i3 = 3 * hull->mIndices[i * 3 + 2];
-            convextrimesh.AddTriangle(
-                ChVector3d(hull->mVertices[i1 + 0], hull->mVertices[i1 + 1], hull->mVertices[i1 + 2]),
-                ChVector3d(hull->mVertices[i2 + 0], hull->mVertices[i2 + 1], hull->mVertices[i2 + 2]),
-                ChVector3d(hull->mVertices[i3 + 0], hull->mVertices[i3 + 1], hull->mVertices[i3 + 2]));
+        for (hacd::HaU32 j = 0; j < hacd_hull->mTriangleCount; j++) {
+            const hacd::HaU32* f = &hacd_hull->mIndices[j * 3];
+            hull.faces.push_back(ChVector3i(f[0], f[1], f[2]));
         }
+        hulls.push_back(std::move(hull));
     }
-    return true;
+
+    hacd->releaseHACD();
 }
 
-//
-// SERIALIZATION
-//
+int ChConvexDecompositionHACDv2::ComputeConvexDecomposition() {
+    if (!gHACD)
+        return 0;
 
-void ChConvexDecompositionHACDv2::WriteConvexHullsAsWavefrontObj(std::ostream& mstream) {
-    mstream << "# Convex hulls obtained with Chrono::Engine \n# convex decomposition \n\n";
+    // Cache key: hash of algorithm, parameters, and input mesh
+    double params[] = {(double)descriptor.mMaxHullCount,
+                       (double)descriptor.mMaxMergeHullCount,
+                       (double)descriptor.mMaxHullVertices,
+                       (double)descriptor.mConcavity,
+                       (double)descriptor.mSmallClusterThreshold,
+                       fuse_tol,
+                       (double)parallel};
+    uint64_t key = HashData("HACDv2", 6);
+    key = HashData(params, sizeof(params), key);
+    key = HashData(points.data(), points.size() * sizeof(points[0]), key);
+    key = HashData(triangles.data(), triangles.size() * sizeof(triangles[0]), key);
+    if (ReadCache(key))
+        return (int)m_hulls.size();
 
-    char buffer[200];
+    // Preprocess: fuse repeated vertices...
 
-    hacd::HaU32* baseVertex = new hacd::HaU32[GetHullCount()];
-    hacd::HaU32 vertexCount = 0;
-    for (hacd::HaU32 i = 0; i < GetHullCount(); i++) {
-        const HACD::HACD_API::Hull* hull = gHACD->getHull(i);
-        if (hull) {
-            baseVertex[i] = vertexCount;
-            for (hacd::HaU32 j = 0; j < hull->mVertexCount; j++) {
-                const hacd::HaF32* p = &hull->mVertices[j * 3];
-                snprintf(buffer, sizeof(buffer), "v %0.9f %0.9f %0.9f\r\n", p[0], p[1], p[2]);
-                mstream << buffer;
-            }
-            vertexCount += hull->mVertexCount;
-        }
-    }
-    for (hacd::HaU32 i = 0; i < GetHullCount(); i++) {
-        const HACD::HACD_API::Hull* hull = gHACD->getHull(i);
-        if (hull) {
-            hacd::HaU32 startVertex = baseVertex[i];
-            for (hacd::HaU32 j = 0; j < hull->mTriangleCount; j++) {
-                hacd::HaU32 i1 = hull->mIndices[j * 3 + 0] + startVertex + 1;
-                hacd::HaU32 i2 = hull->mIndices[j * 3 + 1] + startVertex + 1;
-                hacd::HaU32 i3 = hull->mIndices[j * 3 + 2] + startVertex + 1;
-                snprintf(buffer, sizeof(buffer), "f %d %d %d\r\n", i1, i2, i3);
-                mstream << buffer;
-            }
-        }
+    std::vector<ChVector3d> points_FUSED;
+    std::vector<ChVector3i> triangles_FUSED;
+    FuseMesh(this->points, this->triangles, points_FUSED, triangles_FUSED, this->fuse_tol);
+
+    m_hulls.clear();
+
+    std::vector<std::vector<int>> components;
+    if (parallel)
+        components = SplitMesh(points_FUSED.size(), triangles_FUSED);
+
+    if (components.size() <= 1) {
+        MyCallback callback;
+        Decompose(gHACD, descriptor, points_FUSED, triangles_FUSED, &callback, m_hulls);
+    } else {
+        // Decompose each connected component separately, with its own HACD object
+        std::vector<std::vector<Hull>> component_hulls(components.size());
+        ChTaskScheduler::GetGlobal().ParallelFor(
+            0, (int)components.size(),
+            [&](int ic) {
+                std::vector<ChVector3d> c_points;
+                std::vector<ChVector3i> c_triangles;
+                std::unordered_map<int, int> c_index;
+                for (int it : components[ic]) {
+                    ChVector3i t;
+                    for (int k = 0; k < 3; k++) {
+                        auto v = c_index.insert({triangles_FUSED[it][k], (int)c_points.size()});
+                        if (v.second)
+                            c_points.push_back(points_FUSED[triangles_FUSED[it][k]]);
+                        t[k] = v.first->second;
+                    }
+                    c_triangles.push_back(t);
+                }
+
+                SilentCallback callback;
+                HACD::HACD_API* hacd = HACD::createHACD_API();
+                Decompose(hacd, descriptor, c_points, c_triangles, &callback, component_hulls[ic]);
+                hacd->release();
+            },
+            (int)components.size());
+
+        for (auto& hulls : component_hulls)
+            m_hulls.insert(m_hulls.end(), std::make_move_iterator(hulls.begin()), std::make_move_iterator(hulls.end()));
     }
-    delete[] baseVertex;
+
+    WriteCache(key);
+
+    return (int)m_hulls.size();
 }
 
 }  // end namespace chrono
@@ -15,6 +15,10 @@
 #ifndef CH_CONVEX_DECOMPOSITION_H
 #define CH_CONVEX_DECOMPOSITION_H
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
 #include "chrono/core/ChApiCE.h"
 #include "chrono/geometry/ChTriangleMeshSoup.h"
 
@@ -54,15 +58,15 @@ class ChApi ChConvexDecomposition {
     virtual int ComputeConvexDecomposition() = 0;
 
     /// Get the number of computed hulls after the convex decomposition
-    virtual unsigned int GetHullCount() = 0;
+    virtual unsigned int GetHullCount();
 
     /// Get the n-th computed convex hull, by filling a ChTriangleMesh object
     /// that is passed as a parameter.
-    virtual bool GetConvexHullResult(unsigned int hullIndex, ChTriangleMesh& convextrimesh) = 0;
+    virtual bool GetConvexHullResult(unsigned int hullIndex, ChTriangleMesh& convextrimesh);
 
     /// Get the n-th computed convex hull, by filling a vector of points of the vertexes of the n-th hull
-    /// that is passed as a parameter.
-    virtual bool GetConvexHullResult(unsigned int hullIndex, std::vector<ChVector3d>& convexhull) = 0;
+    /// that is passed as a parameter (any previous content is discarded).
+    virtual bool GetConvexHullResult(unsigned int hullIndex, std::vector<ChVector3d>& convexhull);
 
     /// Write the convex decomposition to a ".chulls" file,
     /// where each hull is a sequence of x y z coords. Can throw exceptions.
@@ -71,7 +75,41 @@ class ChApi ChConvexDecomposition {
     /// Save the computed convex hulls as a Wavefront file using the
     /// '.obj' fileformat, with each hull as a separate group.
     /// May throw exceptions if file locked etc.
-    virtual void WriteConvexHullsAsWavefrontObj(std::ostream& mstream) = 0;
+    virtual void WriteConvexHullsAsWavefrontObj(std::ostream& mstream);
+
+    /// Set the directory of the on-disk cache of decomposition results (default: see SetDefaultCacheDirectory).
+    /// If set, ComputeConvexDecomposition reuses the hulls previously computed for the same input mesh and the same
+    /// decomposition parameters, and saves newly computed hulls in this directory (which must exist).
+    /// An empty string disables the cache.
+    void SetCacheDirectory(const std::string& dir) { m_cache_dir = dir; }
+
+    /// Set the cache directory of all convex decomposition objects created afterwards (default: none).
+    /// This allows caching the decompositions performed internally, e.g., by the Bullet collision models.
+    static void SetDefaultCacheDirectory(const std::string& dir);
+
+    /// Return true if the results of the last decomposition were loaded from the on-disk cache.
+    bool IsCacheHit() const { return m_cache_hit; }
+
+  protected:
+    /// Convex hull resulting from the decomposition.
+    struct Hull {
+        std::vector<ChVector3d> vertices;  ///< hull vertices
+        std::vector<ChVector3i> faces;     ///< hull triangular faces (indices in the vertex list)
+    };
+
+    /// Update a 64-bit FNV-1a hash with the given data (used to build the cache keys).
+    static uint64_t HashData(const void* data, size_t size, uint64_t hash = 14695981039346656037ULL);
+
+    /// Load the hulls stored in the cache under the specified key.
+    /// Return false if the cache is disabled or if no valid entry is found.
+    bool ReadCache(uint64_t key);
+
+    /// Store the current hulls in the cache under the specified key.
+    void WriteCache(uint64_t key) const;
+
+    std::vector<Hull> m_hulls;  ///< results of the last decomposition
+    std::string m_cache_dir;    ///< directory of the on-disk cache (empty if disabled)
+    bool m_cache_hit;           ///< were the last results loaded from the cache?
 };
 
 /// Class for wrapping the HACD convex decomposition code by Khaled Mamou.
@@ -122,22 +160,6 @@ class ChApi ChConvexDecompositionHACD : public ChConvexDecomposition {
     /// or with gaps/holes, may give wrong results.
     virtual int ComputeConvexDecomposition();
 
-    /// Get the number of computed hulls after the convex decomposition
-    virtual unsigned int GetHullCount();
-
-    /// Get the n-th computed convex hull, by filling a ChTriangleMesh object
-    /// that is passed as a parameter.
-    virtual bool GetConvexHullResult(unsigned int hullIndex, ChTriangleMesh& convextrimesh);
-
-    /// Get the n-th computed convex hull, by filling a vector of points of the vertexes of the n-th hull
-    /// that is passed as a parameter.
-    virtual bool GetConvexHullResult(unsigned int hullIndex, std::vector<ChVector3d>& convexhull);
-
-    /// Save the computed convex hulls as a Wavefront file using the
-    /// '.obj' fileformat, with each hull as a separate group.
-    /// May throw exceptions if file locked etc.
-    virtual void WriteConvexHullsAsWavefrontObj(std::ostream& mstream);
-
   private:
     HACD::HACD* myHACD;
     std::vector<HACD::Vec3<HACD::Real> > points;
@@ -183,28 +205,27 @@ class ChApi ChConvexDecompositionHACDv2 : public ChConvexDecomposition {
     /// or with gaps/holes, may give wrong results.
     virtual int ComputeConvexDecomposition();
 
-    /// Get the number of computed hulls after the convex decomposition
-    virtual unsigned int GetHullCount();
-
-    /// Get the n-th computed convex hull, by filling a ChTriangleMesh object
-    /// that is passed as a parameter.
-    virtual bool GetConvexHullResult(unsigned int hullIndex, ChTriangleMesh& convextrimesh);
-
-    /// Get the n-th computed convex hull, by filling a vector of points of the vertexes of the n-th hull
-    /// that is passed as a parameter.
-    virtual bool GetConvexHullResult(unsigned int hullIndex, std::vector<ChVector3d>& convexhull);
-
-    /// Save the computed convex hulls as a Wavefront file using the
-    /// '.obj' fileformat, with each hull as a separate group.
-    /// May throw exceptions if file locked etc.
-    virtual void WriteConvexHullsAsWavefrontObj(std::ostream& mstream);
+    /// Enable/disable the parallel decomposition of disconnected mesh components (default: false).
+    /// If enabled, each connected component of the input mesh (after fusing repeated vertices) is decomposed
+    /// separately, as a task of the global ChTaskScheduler. Results are identical for single-component meshes;
+    /// otherwise, the hull count limits apply to each component.
+    void EnableParallelDecomposition(bool val) { parallel = val; }
 
   private:
+    /// Decompose the given mesh, using the specified HACD object, and append the resulting hulls to the list.
+    static void Decompose(HACD::HACD_API* hacd,
+                          HACD::HACD_API::Desc desc,
+                          const std::vector<ChVector3d>& points,
+                          const std::vector<ChVector3i>& triangles,
+                          hacd::ICallback* callback,
+                          std::vector<Hull>& hulls);
+
     HACD::HACD_API::Desc descriptor;
     HACD::HACD_API* gHACD;
     std::vector<ChVector3d> points;
     std::vector<ChVector3i> triangles;
     double fuse_tol;
+    bool parallel;
 };
 
 /// @} chrono_collision
@@ -19,4 +19,6 @@ subject to the following restrictions:
 cbtCollisionAlgorithm::cbtCollisionAlgorithm(const cbtCollisionAlgorithmConstructionInfo& ci)
 {
 	m_dispatcher = ci.m_dispatcher1;
+	m_cacheState = 0;       // ***CHRONO***
+	m_cacheReused = false;  // ***CHRONO***
 }
@@ -18,6 +18,7 @@ subject to the following restrictions:
 
 #include "LinearMath/cbtScalar.h"
 #include "LinearMath/cbtAlignedObjectArray.h"
+#include "LinearMath/cbtTransform.h"  // ***CHRONO***
 
 struct cbtBroadphaseProxy;
 class cbtDispatcher;
@@ -59,7 +60,7 @@ protected:
 	//	int	getDispatcherId();
 
 public:
-	cbtCollisionAlgorithm(){};
+	cbtCollisionAlgorithm() : m_cacheState(0), m_cacheReused(false){};
 
 	cbtCollisionAlgorithm(const cbtCollisionAlgorithmConstructionInfo& ci);
 
@@ -70,6 +71,11 @@ public:
 	virtual cbtScalar calculateTimeOfImpact(cbtCollisionObject* body0, cbtCollisionObject* body1, const cbtDispatcherInfo& dispatchInfo, cbtManifoldResult* resultOut) = 0;
 
 	virtual void getAllContactManifolds(cbtManifoldArray& manifoldArray) = 0;
+
+	/* ***CHRONO*** Narrowphase contact cache (see ChCollisionSystemBullet::EnableContactCache) */
+	cbtTransform m_cacheRelTransform;  ///< relative transform of the two objects at the last narrowphase evaluation
+	int m_cacheState;                  ///< -1: pair cannot be cached, 0: no valid cache, 1: valid cache
+	bool m_cacheReused;                ///< true if the narrowphase was skipped at the last dispatch
 };
 
 #endif  //BT_COLLISION_ALGORITHM_H
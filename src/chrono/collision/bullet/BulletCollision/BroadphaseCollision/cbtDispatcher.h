@@ -47,7 +47,9 @@ struct cbtDispatcherInfo
 		  m_allowedCcdPenetration(cbtScalar(0.04)),
 		  m_useConvexConservativeDistanceUtil(false),
 		  m_convexConservativeDistanceThreshold(0.0f),
-		  m_deterministicOverlappingPairs(false)
+		  m_deterministicOverlappingPairs(false),
+		  m_contactCacheLinTol(cbtScalar(0.)),  // ***CHRONO***
+		  m_contactCacheAngTol(cbtScalar(0.))   // ***CHRONO***
 	{
 	}
 	cbtScalar m_timeStep;
@@ -63,6 +65,8 @@ struct cbtDispatcherInfo
 	bool m_useConvexConservativeDistanceUtil;
 	cbtScalar m_convexConservativeDistanceThreshold;
 	bool m_deterministicOverlappingPairs;
+	cbtScalar m_contactCacheLinTol;  // ***CHRONO*** contact cache tolerance on relative translation
+	cbtScalar m_contactCacheAngTol;  // ***CHRONO*** contact cache tolerance on relative rotation
 };
 
 enum ecbtDispatcherQueryType
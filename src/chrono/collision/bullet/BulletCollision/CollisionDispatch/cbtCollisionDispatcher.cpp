@@ -71,8 +71,7 @@ cbtPersistentManifold* cbtCollisionDispatcher::getNewManifold(const cbtCollision
 
 	//optional relative contact breaking threshold, turned on by default (use setDispatcherFlags to switch off feature for improved performance)
 
-	cbtScalar contactBreakingThreshold = (m_dispatcherFlags & cbtCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD) ? cbtMin(body0->getCollisionShape()->getContactBreakingThreshold(gContactBreakingThreshold), body1->getCollisionShape()->getContactBreakingThreshold(gContactBreakingThreshold))
-																																: gContactBreakingThreshold;
+	cbtScalar contactBreakingThreshold = getManifoldBreakingThreshold(body0, body1);  // ***CHRONO***
 
 	cbtScalar contactProcessingThreshold = cbtMin(body0->getContactProcessingThreshold(), body1->getContactProcessingThreshold());
 
@@ -98,6 +97,15 @@ cbtPersistentManifold* cbtCollisionDispatcher::getNewManifold(const cbtCollision
 	return manifold;
 }
 
+// ***CHRONO*** factored out of getNewManifold; add the CCD motion bounds of the two objects
+cbtScalar cbtCollisionDispatcher::getManifoldBreakingThreshold(const cbtCollisionObject* body0, const cbtCollisionObject* body1) const
+{
+	cbtScalar contactBreakingThreshold = (m_dispatcherFlags & cbtCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD) ? cbtMin(body0->getCollisionShape()->getContactBreakingThreshold(gContactBreakingThreshold), body1->getCollisionShape()->getContactBreakingThreshold(gContactBreakingThreshold))
+																																: gContactBreakingThreshold;
+
+	return contactBreakingThreshold + body0->getCcdMotionBound() + body1->getCcdMotionBound();
+}
+
 void cbtCollisionDispatcher::clearManifold(cbtPersistentManifold* manifold)
 {
 	manifold->clearManifold();
@@ -109,6 +109,10 @@ public:
 
 	virtual cbtPersistentManifold* getNewManifold(const cbtCollisionObject* b0, const cbtCollisionObject* b1);
 
+	/// ***CHRONO*** Contact breaking threshold for a manifold between the two objects.
+	/// Includes the CCD motion bounds of the two objects, so that speculative contacts are kept in the manifold.
+	cbtScalar getManifoldBreakingThreshold(const cbtCollisionObject* b0, const cbtCollisionObject* b1) const;
+
 	virtual void releaseManifold(cbtPersistentManifold* manifold);
 
 	virtual void clearManifold(cbtPersistentManifold* manifold);
@@ -30,18 +30,73 @@ cbtCollisionDispatcherMt::cbtCollisionDispatcherMt(cbtCollisionConfiguration* co
 {
 	m_batchUpdating = false;
 	m_grainSize = grainSize;  // iterations per task
+
+	m_threadManifoldPools.resize(BT_MAX_THREAD_COUNT, NULL);   // ***CHRONO***
+	m_threadAlgorithmPools.resize(BT_MAX_THREAD_COUNT, NULL);  // ***CHRONO***
+}
+
+cbtCollisionDispatcherMt::~cbtCollisionDispatcherMt()
+{
+	for (int i = 0; i < m_threadManifoldPools.size(); i++)
+	{
+		if (m_threadManifoldPools[i])
+		{
+			m_threadManifoldPools[i]->~cbtPoolAllocator();
+			cbtAlignedFree(m_threadManifoldPools[i]);
+		}
+		if (m_threadAlgorithmPools[i])
+		{
+			m_threadAlgorithmPools[i]->~cbtPoolAllocator();
+			cbtAlignedFree(m_threadAlgorithmPools[i]);
+		}
+	}
+}
+
+cbtPoolAllocator* cbtCollisionDispatcherMt::getThreadPool(cbtAlignedObjectArray<cbtPoolAllocator*>& pools, cbtPoolAllocator* sharedPool)
+{
+	unsigned int index = cbtGetCurrentThreadIndex();
+	if (index == 0 || index >= (unsigned int)pools.size())
+		return sharedPool;
+
+	// Only the calling thread accesses its slot, so no synchronization is needed
+	if (!pools[index])
+	{
+		int numThreads = cbtMax(1, cbtGetTaskScheduler()->getNumThreads());
+		int maxElements = cbtMax(64, sharedPool->getMaxCount() / numThreads);
+		void* mem = cbtAlignedAlloc(sizeof(cbtPoolAllocator), 16);
+		pools[index] = new (mem) cbtPoolAllocator(sharedPool->getElementSize(), maxElements);
+	}
+	return pools[index];
+}
+
+bool cbtCollisionDispatcherMt::freeToPool(cbtAlignedObjectArray<cbtPoolAllocator*>& pools, cbtPoolAllocator* sharedPool, void* ptr)
+{
+	if (sharedPool->validPtr(ptr))
+	{
+		sharedPool->freeMemory(ptr);
+		return true;
+	}
+	// Memory may be freed by a thread other than the one that allocated it (each pool has its own lock)
+	for (int i = 1; i < pools.size(); i++)
+	{
+		if (pools[i] && pools[i]->validPtr(ptr))
+		{
+			pools[i]->freeMemory(ptr);
+			return true;
+		}
+	}
+	return false;
 }
 
 cbtPersistentManifold* cbtCollisionDispatcherMt::getNewManifold(const cbtCollisionObject* body0, const cbtCollisionObject* body1)
 {
 	//optional relative contact breaking threshold, turned on by default (use setDispatcherFlags to switch off feature for improved performance)
 
-	cbtScalar contactBreakingThreshold = (m_dispatcherFlags & cbtCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD) ? cbtMin(body0->getCollisionShape()->getContactBreakingThreshold(gContactBreakingThreshold), body1->getCollisionShape()->getContactBreakingThreshold(gContactBreakingThreshold))
-																																: gContactBreakingThreshold;
+	cbtScalar contactBreakingThreshold = getManifoldBreakingThreshold(body0, body1);  // ***CHRONO***
 
 	cbtScalar contactProcessingThreshold = cbtMin(body0->getContactProcessingThreshold(), body1->getContactProcessingThreshold());
 
-	void* mem = m_persistentManifoldPoolAllocator->allocate(sizeof(cbtPersistentManifold));
+	void* mem = getThreadPool(m_threadManifoldPools, m_persistentManifoldPoolAllocator)->allocate(sizeof(cbtPersistentManifold));  // ***CHRONO***
 	if (NULL == mem)
 	{
 		//we got a pool memory overflow, by default we fallback to dynamically allocate memory. If we require a contiguous contact pool then assert.
@@ -85,13 +140,27 @@ void cbtCollisionDispatcherMt::releaseManifold(cbtPersistentManifold* manifold)
 	}
 
 	manifold->~cbtPersistentManifold();
-	if (m_persistentManifoldPoolAllocator->validPtr(manifold))
+	if (!freeToPool(m_threadManifoldPools, m_persistentManifoldPoolAllocator, manifold))  // ***CHRONO***
+	{
+		cbtAlignedFree(manifold);
+	}
+}
+
+void* cbtCollisionDispatcherMt::allocateCollisionAlgorithm(int size)
+{
+	void* mem = getThreadPool(m_threadAlgorithmPools, m_collisionAlgorithmPoolAllocator)->allocate(size);
+	if (NULL == mem)
 	{
-		m_persistentManifoldPoolAllocator->freeMemory(manifold);
+		return cbtAlignedAlloc(static_cast<size_t>(size), 16);
 	}
-	else
+	return mem;
+}
+
+void cbtCollisionDispatcherMt::freeCollisionAlgorithm(void* ptr)
+{
+	if (!freeToPool(m_threadAlgorithmPools, m_collisionAlgorithmPoolAllocator, ptr))
 	{
-		cbtAlignedFree(manifold);
+		cbtAlignedFree(ptr);
 	}
 }
 
@@ -19,19 +19,36 @@ subject to the following restrictions:
 #include "BulletCollision/CollisionDispatch/cbtCollisionDispatcher.h"
 #include "LinearMath/cbtThreads.h"
 
+class cbtPoolAllocator;
+
 class cbtCollisionDispatcherMt : public cbtCollisionDispatcher
 {
 public:
 	cbtCollisionDispatcherMt(cbtCollisionConfiguration* config, int grainSize = 40);
 
+	virtual ~cbtCollisionDispatcherMt();
+
 	virtual cbtPersistentManifold* getNewManifold(const cbtCollisionObject* body0, const cbtCollisionObject* body1) BT_OVERRIDE;
 	virtual void releaseManifold(cbtPersistentManifold* manifold) BT_OVERRIDE;
 
+	virtual void* allocateCollisionAlgorithm(int size) BT_OVERRIDE;
+	virtual void freeCollisionAlgorithm(void* ptr) BT_OVERRIDE;
+
 	virtual void dispatchAllCollisionPairs(cbtOverlappingPairCache* pairCache, const cbtDispatcherInfo& info, cbtDispatcher* dispatcher) BT_OVERRIDE;
 
 protected:
+	/// ***CHRONO*** Return the pool of the calling thread (the shared pool for the main thread).
+	/// Worker threads allocate from their own pools, created on first use, to avoid contention on the shared pool.
+	cbtPoolAllocator* getThreadPool(cbtAlignedObjectArray<cbtPoolAllocator*>& pools, cbtPoolAllocator* sharedPool);
+
+	/// ***CHRONO*** Return memory to the pool (shared or per-thread) it was allocated from; return false if none.
+	static bool freeToPool(cbtAlignedObjectArray<cbtPoolAllocator*>& pools, cbtPoolAllocator* sharedPool, void* ptr);
+
 	bool m_batchUpdating;
 	int m_grainSize;
+
+	cbtAlignedObjectArray<cbtPoolAllocator*> m_threadManifoldPools;   // ***CHRONO*** indexed by thread
+	cbtAlignedObjectArray<cbtPoolAllocator*> m_threadAlgorithmPools;  // ***CHRONO*** indexed by thread
 };
 
 #endif  //BT_COLLISION_DISPATCHER_MT_H
@@ -47,6 +47,7 @@ cbtCollisionObject::cbtCollisionObject()
 	  m_hitFraction(cbtScalar(1.)),
 	  m_ccdSweptSphereRadius(cbtScalar(0)),
 	  m_ccdMotionThreshold(cbtScalar(0)),
+	  m_ccdMotionBound(cbtScalar(0)),  // ***CHRONO***
 	  m_checkCollideWith(false),
 	  m_updateRevision(0)
 {
@@ -112,6 +112,9 @@ protected:
 	/// Don't do continuous collision detection if the motion (in one step) is less then m_ccdMotionThreshold
 	cbtScalar m_ccdMotionThreshold;
 
+	/* ***CHRONO*** Continuous collision detection (see ChCollisionModel::EnableContinuousCollision) */
+	cbtScalar m_ccdMotionBound;  ///< bound on the motion of any point of the object over the current step (0 if no CCD)
+
 	/// If some object should have elaborate collision filtering by sub-classes
 	int m_checkCollideWith;
 
@@ -512,6 +515,19 @@ public:
 		m_ccdMotionThreshold = ccdMotionThreshold;
 	}
 
+	/// ***CHRONO*** Bound on the motion of any point of the object between the world and interpolation transforms.
+	/// A positive value enables swept AABBs and speculative contacts for this object.
+	cbtScalar getCcdMotionBound() const
+	{
+		return m_ccdMotionBound;
+	}
+
+	/// ***CHRONO*** Set the bound on the motion of any point of the object over the current step.
+	void setCcdMotionBound(cbtScalar bound)
+	{
+		m_ccdMotionBound = bound;
+	}
+
 	///users can point to their objects, userPointer is not used by Bullet
 	void* getUserPointer() const
 	{
@@ -34,6 +34,7 @@ subject to the following restrictions:
 #include "LinearMath/cbtAabbUtil2.h"
 #include "LinearMath/cbtQuickprof.h"
 #include "LinearMath/cbtSerializer.h"
+#include "LinearMath/cbtThreads.h"  // ***CHRONO***
 #include "BulletCollision/CollisionShapes/cbtConvexPolyhedron.h"
 #include "BulletCollision/CollisionDispatch/cbtCollisionObjectWrapper.h"
 
@@ -154,6 +155,12 @@ void cbtCollisionWorld::addCollisionObject(cbtCollisionObject* collisionObject,
 void cbtCollisionWorld::updateSingleAabb(cbtCollisionObject* colObj)
 {
 	cbtVector3 minAabb, maxAabb;
+	computeSingleAabb(colObj, minAabb, maxAabb);
+	setSingleAabb(colObj, minAabb, maxAabb);
+}
+
+void cbtCollisionWorld::computeSingleAabb(const cbtCollisionObject* colObj, cbtVector3& minAabb, cbtVector3& maxAabb) const
+{
 	colObj->getCollisionShape()->getAabb(colObj->getWorldTransform(), minAabb, maxAabb);
 	//need to increase the aabb for contact thresholds
 	cbtVector3 contactThreshold(gContactBreakingThreshold, gContactBreakingThreshold, gContactBreakingThreshold);
@@ -161,7 +168,8 @@ void cbtCollisionWorld::updateSingleAabb(cbtCollisionObject* colObj)
 	////minAabb -= contactThreshold;
 	////maxAabb += contactThreshold;
 
-	if (getDispatchInfo().m_useContinuous && colObj->getInternalType() == cbtCollisionObject::CO_RIGID_BODY && !colObj->isStaticOrKinematicObject())
+	/* ***CHRONO*** sweep the AABB of objects with continuous collision detection enabled (non-zero motion bound) */
+	if (getDispatchInfo().m_useContinuous && colObj->getCcdMotionBound() > 0 && !colObj->isStaticObject())
 	{
 		cbtVector3 minAabb2, maxAabb2;
 		colObj->getCollisionShape()->getAabb(colObj->getInterpolationWorldTransform(), minAabb2, maxAabb2);
@@ -170,7 +178,10 @@ void cbtCollisionWorld::updateSingleAabb(cbtCollisionObject* colObj)
 		minAabb.setMin(minAabb2);
 		maxAabb.setMax(maxAabb2);
 	}
+}
 
+void cbtCollisionWorld::setSingleAabb(cbtCollisionObject* colObj, const cbtVector3& minAabb, const cbtVector3& maxAabb)
+{
 	cbtBroadphaseInterface* bp = (cbtBroadphaseInterface*)m_broadphasePairCache;
 
 	//moving objects should be moderately sized, probably something wrong if not
@@ -196,12 +207,50 @@ void cbtCollisionWorld::updateSingleAabb(cbtCollisionObject* colObj)
 	}
 }
 
+// ***CHRONO*** parallel computation of the AABBs of the active objects (see updateAabbs)
+struct AabbUpdater : public cbtIParallelForBody
+{
+	const cbtCollisionWorld* mWorld;
+	cbtCollisionObject* const* mObjects;
+	cbtVector3* mAabbMin;
+	cbtVector3* mAabbMax;
+	bool mForceUpdateAll;
+
+	void forLoop(int iBegin, int iEnd) const
+	{
+		for (int i = iBegin; i < iEnd; ++i)
+		{
+			const cbtCollisionObject* colObj = mObjects[i];
+			if (mForceUpdateAll || colObj->isActive())
+			{
+				mWorld->computeSingleAabb(colObj, mAabbMin[i], mAabbMax[i]);
+			}
+		}
+	}
+};
+
 void cbtCollisionWorld::updateAabbs()
 {
 	BT_PROFILE("updateAabbs");
 
-	cbtTransform predictedTrans;
-	for (int i = 0; i < m_collisionObjects.size(); i++)
+	int numObjects = m_collisionObjects.size();
+	if (numObjects == 0)
+		return;
+
+	/* ***CHRONO*** The AABBs (expensive for compound and mesh shapes) are computed in parallel with the current task
+	   scheduler. The broadphase is not thread-safe, so the AABBs are then set in the broadphase serially. */
+	m_aabbMin.resizeNoInitialize(numObjects);
+	m_aabbMax.resizeNoInitialize(numObjects);
+
+	AabbUpdater updater;
+	updater.mWorld = this;
+	updater.mObjects = &m_collisionObjects[0];
+	updater.mAabbMin = &m_aabbMin[0];
+	updater.mAabbMax = &m_aabbMax[0];
+	updater.mForceUpdateAll = m_forceUpdateAllAabbs;
+	cbtParallelFor(0, numObjects, 64, updater);
+
+	for (int i = 0; i < numObjects; i++)
 	{
 		cbtCollisionObject* colObj = m_collisionObjects[i];
 		cbtAssert(colObj->getWorldArrayIndex() == i);
@@ -209,7 +258,7 @@ void cbtCollisionWorld::updateAabbs()
 		//only update aabb of active objects
 		if (m_forceUpdateAllAabbs || colObj->isActive())
 		{
-			updateSingleAabb(colObj);
+			setSingleAabb(colObj, m_aabbMin[i], m_aabbMax[i]);
 		}
 	}
 }
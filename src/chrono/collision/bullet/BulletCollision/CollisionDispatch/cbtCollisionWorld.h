@@ -98,6 +98,9 @@ protected:
 
 	cbtIDebugDraw* m_debugDrawer;
 
+	cbtAlignedObjectArray<cbtVector3> m_aabbMin;  // ***CHRONO*** AABBs computed in parallel in updateAabbs
+	cbtAlignedObjectArray<cbtVector3> m_aabbMax;  // ***CHRONO***
+
 	///m_forceUpdateAllAabbs can be set to false as an optimization to only update active object AABBs
 	///it is true by default, because it is error-prone (setting the position of static objects wouldn't update their AABB)
 	bool m_forceUpdateAllAabbs;
@@ -144,6 +147,12 @@ public:
 
 	void updateSingleAabb(cbtCollisionObject* colObj);
 
+	/// ***CHRONO*** Compute the (possibly swept) AABB of the given object. Thread-safe.
+	void computeSingleAabb(const cbtCollisionObject* colObj, cbtVector3& minAabb, cbtVector3& maxAabb) const;
+
+	/// ***CHRONO*** Set the AABB of the given object in the broadphase.
+	void setSingleAabb(cbtCollisionObject* colObj, const cbtVector3& minAabb, const cbtVector3& maxAabb);
+
 	virtual void updateAabbs();
 
 	///the computeOverlappingPairs is usually already called by performDiscreteCollisionDetection (or stepSimulation)
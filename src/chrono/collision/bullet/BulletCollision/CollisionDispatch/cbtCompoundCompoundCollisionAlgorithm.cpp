@@ -164,7 +164,7 @@ struct cbtCompoundCompoundLeafCallback : cbtDbvt::ICollide
 			cbtSimplePair* pair = m_childCollisionAlgorithmCache->findPair(childIndex0, childIndex1);
 			bool removePair = false;
 			cbtCollisionAlgorithm* colAlgo = 0;
-			if (m_resultOut->m_closestPointDistanceThreshold > 0)
+			if (m_resultOut->m_closestPointDistanceThreshold > 0 && !m_resultOut->m_speculative)  // ***CHRONO***
 			{
 				colAlgo = m_dispatcher->findAlgorithm(&compoundWrap0, &compoundWrap1, 0, BT_CLOSEST_POINT_ALGORITHMS);
 				removePair = true;
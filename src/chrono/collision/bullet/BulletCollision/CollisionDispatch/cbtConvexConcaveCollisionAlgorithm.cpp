@@ -109,7 +109,7 @@ void cbtConvexTriangleCallback::processTriangle(cbtVector3* triangle, int partId
 		cbtCollisionObjectWrapper triObWrap(m_triBodyWrap, &tm, m_triBodyWrap->getCollisionObject(), m_triBodyWrap->getWorldTransform(), partId, triangleIndex);  //correct transform?
 		cbtCollisionAlgorithm* colAlgo = 0;
 
-		if (m_resultOut->m_closestPointDistanceThreshold > 0)
+		if (m_resultOut->m_closestPointDistanceThreshold > 0 && !m_resultOut->m_speculative)  // ***CHRONO***
 		{
 			colAlgo = ci.m_dispatcher1->findAlgorithm(m_convexBodyWrap, &triObWrap, 0, BT_CLOSEST_POINT_ALGORITHMS);
 		}
@@ -98,7 +98,8 @@ cbtManifoldResult::cbtManifoldResult(const cbtCollisionObjectWrapper* body0Wrap,
 	  m_index1(-1)
 #endif  //DEBUG_PART_INDEX
 	  ,
-	  m_closestPointDistanceThreshold(0)
+	  m_closestPointDistanceThreshold(0),
+	  m_speculative(false)  // ***CHRONO***
 {
 }
 
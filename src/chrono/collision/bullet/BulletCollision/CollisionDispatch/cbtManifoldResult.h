@@ -66,7 +66,8 @@ public:
 		  m_index0(-1),
 		  m_index1(-1)
 #endif  //DEBUG_PART_INDEX
-			  m_closestPointDistanceThreshold(0)
+			  m_closestPointDistanceThreshold(0),
+			  m_speculative(false)  // ***CHRONO***
 	{
 	}
 
@@ -151,6 +152,10 @@ public:
 
 	cbtScalar m_closestPointDistanceThreshold;
 
+	/// ***CHRONO*** Closest points up to m_closestPointDistanceThreshold are requested for speculative contacts.
+	/// Child pairs of compound and concave shapes then keep using the persistent contact point algorithms.
+	bool m_speculative;
+
 	/// in the future we can let the user override the methods to combine restitution and friction
 	static cbtScalar calculateCombinedRestitution(const cbtCollisionObject* body0, const cbtCollisionObject* body1);
 	static cbtScalar calculateCombinedFriction(const cbtCollisionObject* body0, const cbtCollisionObject* body1);
@@ -15,6 +15,8 @@
 #include <memory>
 #include <array>
 #include <algorithm>
+#include <mutex>
+#include <unordered_map>
 
 #include "chrono/collision/bullet/ChCollisionSystemBullet.h"
 #include "chrono/collision/bullet/ChCollisionUtilsBullet.h"
@@ -22,13 +24,16 @@
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/cbt2DShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/cbtBarrelShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/cbtCEtriangleShape.h"
+#include "chrono/collision/bullet/BulletCollision/CollisionShapes/cbtHeightfieldTerrainShape.h"
 #include "chrono/collision/bullet/cbtBulletCollisionCommon.h"
+#include "chrono/collision/bullet/LinearMath/cbtTransformUtil.h"
 #include "chrono/collision/gimpact/GIMPACT/Bullet/cbtGImpactCollisionAlgorithm.h"
 #include "chrono/collision/gimpact/GIMPACTUtils/cbtGImpactConvexDecompositionShape.h"
 #include "chrono/collision/ChConvexDecomposition.h"
 #include "chrono/geometry/ChLineArc.h"
 #include "chrono/geometry/ChLineSegment.h"
 #include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/geometry/ChTriangleMeshCache.h"
 #include "chrono/physics/ChPhysicsItem.h"
 #include "chrono/physics/ChSystem.h"
 
@@ -215,6 +220,11 @@ void ChCollisionModelBullet::Populate() {
                 injectTriangleProxy(shape_triangle);
                 break;
             }
+            case ChCollisionShape::Type::HEIGHTFIELD: {
+                auto shape_hfield = std::static_pointer_cast<ChCollisionShapeHeightfield>(shape);
+                injectHeightfield(shape_hfield, frame);
+                break;
+            }
             default:
                 // Shape type not supported
                 break;
@@ -440,6 +450,99 @@ class cbtGImpactMeshShape_handlemesh : public cbtGImpactMeshShape {
     }
 };
 
+// Connectivity information for a triangle of a connected mesh, as needed for a triangle collision proxy.
+struct MeshTriangleTopology {
+    int edge_vertex[3];   // wing vertex of each edge (or opposite face vertex for a free edge)
+    bool owns_vertex[3];  // does this triangle own its vertices?
+    bool owns_edge[3];    // does this triangle own its edges?
+};
+
+typedef std::vector<MeshTriangleTopology> MeshTopology;
+
+static std::shared_ptr<const MeshTopology> ComputeMeshTopology(ChTriangleMeshConnected& mesh) {
+    std::vector<std::array<int, 4>> trimap;
+    mesh.ComputeNeighbouringTriangleMap(trimap);
+
+    std::map<std::pair<int, int>, std::pair<int, int>> winged_edges;
+    mesh.ComputeWingedEdges(winged_edges, true);
+
+    std::vector<bool> added_vertexes(mesh.m_vertices.size());
+
+    auto topology = chrono_types::make_shared<MeshTopology>(mesh.m_face_v_indices.size());
+
+    // iterate on triangles
+    for (int it = 0; it < mesh.m_face_v_indices.size(); ++it) {
+        const auto& face = mesh.m_face_v_indices[it];
+        auto& tri = (*topology)[it];
+
+        // edges = pairs of vertexes indexes
+        std::pair<int, int> medge[3] = {{face.x(), face.y()}, {face.y(), face.z()}, {face.z(), face.x()}};
+        std::map<std::pair<int, int>, std::pair<int, int>>::iterator wingedges[3];
+        for (int ie = 0; ie < 3; ie++) {
+            // vertex indexes in edges: always in increasing order to avoid ambiguous duplicated edges
+            if (medge[ie].first > medge[ie].second)
+                medge[ie] = std::pair<int, int>(medge[ie].second, medge[ie].first);
+            auto wingedge = winged_edges.find(medge[ie]);
+
+            // For a non-wing vertex (i.e. 'free' edge), point to opposite vertex, that is the vertex in triangle not
+            // belonging to edge.
+            int i_wingvertex = -1;
+            int neighbor = trimap[it][ie + 1];
+            if (neighbor != -1) {
+                const auto& nface = mesh.m_face_v_indices[neighbor];
+                i_wingvertex = nface.x();
+                if (nface.y() != wingedge->first.first && nface.y() != wingedge->first.second)
+                    i_wingvertex = nface.y();
+                if (nface.z() != wingedge->first.first && nface.z() != wingedge->first.second)
+                    i_wingvertex = nface.z();
+            }
+            tri.edge_vertex[ie] = wingedge->second.second != -1 ? i_wingvertex : face[(ie + 2) % 3];
+
+            // Indicate if an edge is owned by this triangle. Otherwise, it belongs to a neighboring triangle.
+            tri.owns_edge[ie] = wingedge->second.first != -1;
+            wingedges[ie] = wingedge;
+        }
+        for (int iv = 0; iv < 3; iv++)
+            tri.owns_vertex[iv] = !added_vertexes[face[iv]];
+
+        // Mark added vertexes and edges (setting to -1 the 'ti' id of 1st triangle in winged edge {{vi,vj}{ti,tj}})
+        for (int k = 0; k < 3; k++) {
+            added_vertexes[face[k]] = true;
+            wingedges[k]->second.first = -1;
+        }
+    }
+
+    return topology;
+}
+
+// Topology of meshes managed by ChTriangleMeshCache (immutable), shared by all collision models using these meshes.
+static std::mutex topology_mutex;
+static std::unordered_map<const ChTriangleMeshConnected*,
+                          std::pair<std::weak_ptr<ChTriangleMeshConnected>, std::shared_ptr<const MeshTopology>>>
+    topology_cache;
+
+static std::shared_ptr<const MeshTopology> GetMeshTopology(std::shared_ptr<ChTriangleMeshConnected> mesh) {
+    if (!ChTriangleMeshCache::IsCached(mesh.get()))
+        return ComputeMeshTopology(*mesh);
+
+    std::lock_guard<std::mutex> lock(topology_mutex);
+    auto entry = topology_cache.find(mesh.get());
+    if (entry != topology_cache.end() && entry->second.first.lock() == mesh)
+        return entry->second.second;
+
+    // Purge entries of meshes that no longer exist
+    for (auto e = topology_cache.begin(); e != topology_cache.end();) {
+        if (e->second.first.expired())
+            e = topology_cache.erase(e);
+        else
+            ++e;
+    }
+
+    auto topology = ComputeMeshTopology(*mesh);
+    topology_cache[mesh.get()] = std::make_pair(std::weak_ptr<ChTriangleMeshConnected>(mesh), topology);
+    return topology;
+}
+
 void ChCollisionModelBullet::injectTriangleMesh(std::shared_ptr<ChCollisionShapeTriangleMesh> shape_trimesh,
                                                 const ChFrame<>& frame) {
     auto envelope = GetEnvelope();
@@ -454,99 +557,27 @@ void ChCollisionModelBullet::injectTriangleMesh(std::shared_ptr<ChCollisionShape
         return;
 
     if (auto mesh = std::dynamic_pointer_cast<ChTriangleMeshConnected>(trimesh)) {
-        std::vector<std::array<int, 4>> trimap;
-        mesh->ComputeNeighbouringTriangleMap(trimap);
-
-        std::map<std::pair<int, int>, std::pair<int, int>> winged_edges;
-        mesh->ComputeWingedEdges(winged_edges, true);
-
-        std::vector<bool> added_vertexes(mesh->m_vertices.size());
+        // Connectivity information (shared with other models if the mesh is from the mesh cache)
+        auto topology = GetMeshTopology(mesh);
+        const auto& vertices = mesh->m_vertices;
 
-        // iterate on triangles
         for (int it = 0; it < mesh->m_face_v_indices.size(); ++it) {
-            // edges = pairs of vertexes indexes
-            std::pair<int, int> medgeA(mesh->m_face_v_indices[it].x(), mesh->m_face_v_indices[it].y());
-            std::pair<int, int> medgeB(mesh->m_face_v_indices[it].y(), mesh->m_face_v_indices[it].z());
-            std::pair<int, int> medgeC(mesh->m_face_v_indices[it].z(), mesh->m_face_v_indices[it].x());
-            // vertex indexes in edges: always in increasing order to avoid ambiguous duplicated edges
-            if (medgeA.first > medgeA.second)
-                medgeA = std::pair<int, int>(medgeA.second, medgeA.first);
-            if (medgeB.first > medgeB.second)
-                medgeB = std::pair<int, int>(medgeB.second, medgeB.first);
-            if (medgeC.first > medgeC.second)
-                medgeC = std::pair<int, int>(medgeC.second, medgeC.first);
-            auto wingedgeA = winged_edges.find(medgeA);
-            auto wingedgeB = winged_edges.find(medgeB);
-            auto wingedgeC = winged_edges.find(medgeC);
-
-            int i_wingvertex_A = -1;
-            int i_wingvertex_B = -1;
-            int i_wingvertex_C = -1;
-
-            if (trimap[it][1] != -1) {
-                i_wingvertex_A = mesh->m_face_v_indices[trimap[it][1]].x();
-                if (mesh->m_face_v_indices[trimap[it][1]].y() != wingedgeA->first.first &&
-                    mesh->m_face_v_indices[trimap[it][1]].y() != wingedgeA->first.second)
-                    i_wingvertex_A = mesh->m_face_v_indices[trimap[it][1]].y();
-                if (mesh->m_face_v_indices[trimap[it][1]].z() != wingedgeA->first.first &&
-                    mesh->m_face_v_indices[trimap[it][1]].z() != wingedgeA->first.second)
-                    i_wingvertex_A = mesh->m_face_v_indices[trimap[it][1]].z();
-            }
-
-            if (trimap[it][2] != -1) {
-                i_wingvertex_B = mesh->m_face_v_indices[trimap[it][2]].x();
-                if (mesh->m_face_v_indices[trimap[it][2]].y() != wingedgeB->first.first &&
-                    mesh->m_face_v_indices[trimap[it][2]].y() != wingedgeB->first.second)
-                    i_wingvertex_B = mesh->m_face_v_indices[trimap[it][2]].y();
-                if (mesh->m_face_v_indices[trimap[it][2]].z() != wingedgeB->first.first &&
-                    mesh->m_face_v_indices[trimap[it][2]].z() != wingedgeB->first.second)
-                    i_wingvertex_B = mesh->m_face_v_indices[trimap[it][2]].z();
-            }
-
-            if (trimap[it][3] != -1) {
-                i_wingvertex_C = mesh->m_face_v_indices[trimap[it][3]].x();
-                if (mesh->m_face_v_indices[trimap[it][3]].y() != wingedgeC->first.first &&
-                    mesh->m_face_v_indices[trimap[it][3]].y() != wingedgeC->first.second)
-                    i_wingvertex_C = mesh->m_face_v_indices[trimap[it][3]].y();
-                if (mesh->m_face_v_indices[trimap[it][3]].z() != wingedgeC->first.first &&
-                    mesh->m_face_v_indices[trimap[it][3]].z() != wingedgeC->first.second)
-                    i_wingvertex_C = mesh->m_face_v_indices[trimap[it][3]].z();
-            }
+            const auto& face = mesh->m_face_v_indices[it];
+            const auto& tri = (*topology)[it];
 
             // Add a mesh triangle collision shape (triangle with connectivity information).
-            // For a non-wing vertex (i.e. 'free' edge), point to opposite vertex, that is the vertex in triangle not
-            // belonging to edge. Indicate is an edge is owned by this triangle. Otherwise, they belong to a neighboring
-            // triangle.
             auto shape_triangle = chrono_types::make_shared<ChCollisionShapeMeshTriangle>(
-                shape_trimesh->GetMaterial(),                                                        // contact material
-                &mesh->m_vertices[mesh->m_face_v_indices[it].x()],                                   // face nodes
-                &mesh->m_vertices[mesh->m_face_v_indices[it].y()],                                   //
-                &mesh->m_vertices[mesh->m_face_v_indices[it].z()],                                   //
-                wingedgeA->second.second != -1 ? &mesh->m_vertices[i_wingvertex_A]                   // edge node 1
-                                               : &mesh->m_vertices[mesh->m_face_v_indices[it].z()],  //
-                wingedgeB->second.second != -1 ? &mesh->m_vertices[i_wingvertex_B]                   // edge node 2
-                                               : &mesh->m_vertices[mesh->m_face_v_indices[it].x()],  //
-                wingedgeC->second.second != -1 ? &mesh->m_vertices[i_wingvertex_C]                   // edge node 3
-                                               : &mesh->m_vertices[mesh->m_face_v_indices[it].y()],  //
-                !added_vertexes[mesh->m_face_v_indices[it].x()],                                     // face owns nodes?
-                !added_vertexes[mesh->m_face_v_indices[it].y()],                                     //
-                !added_vertexes[mesh->m_face_v_indices[it].z()],                                     //
-                wingedgeA->second.first != -1,                                                       // face owns edges?
-                wingedgeB->second.first != -1,                                                       //
-                wingedgeC->second.first != -1,                                                       //
-                radius                                                                               // thickness
+                shape_trimesh->GetMaterial(),                                    // contact material
+                &vertices[face.x()], &vertices[face.y()], &vertices[face.z()],   // face nodes
+                &vertices[tri.edge_vertex[0]],                                   // edge node 1
+                &vertices[tri.edge_vertex[1]],                                   // edge node 2
+                &vertices[tri.edge_vertex[2]],                                   // edge node 3
+                tri.owns_vertex[0], tri.owns_vertex[1], tri.owns_vertex[2],      // face owns nodes?
+                tri.owns_edge[0], tri.owns_edge[1], tri.owns_edge[2],            // face owns edges?
+                radius                                                           // thickness
             );
 
             injectTriangleProxy(shape_triangle);
-
-            // Mark added vertexes
-            added_vertexes[mesh->m_face_v_indices[it].x()] = true;
-            added_vertexes[mesh->m_face_v_indices[it].y()] = true;
-            added_vertexes[mesh->m_face_v_indices[it].z()] = true;
-            // Mark added edges, setting to -1 the 'ti' id of 1st triangle in winged edge {{vi,vj}{ti,tj}}
-            wingedgeA->second.first = -1;
-            wingedgeB->second.first = -1;
-            wingedgeC->second.first = -1;
         }
         return;
     }
@@ -619,6 +650,43 @@ void ChCollisionModelBullet::injectTriangleMesh(std::shared_ptr<ChCollisionShape
     }
 }
 
+// -----------------------------------------------------------------------------
+
+// This class inherits the Bullet heightfield shape and owns a copy of the height data (with the Bullet scalar type),
+// which must persist for the lifetime of the shape. Moving the data vector preserves its buffer, already referenced
+// by the base class.
+class cbtHeightfieldTerrainShape_handledata : public cbtHeightfieldTerrainShape {
+  public:
+    cbtHeightfieldTerrainShape_handledata(int nx, int ny, std::vector<cbtScalar>&& data, cbtScalar max_height)
+        : cbtHeightfieldTerrainShape(nx, ny, data.data(), 1, -max_height, max_height, 2, PHY_FLOAT, false),
+          mdata(std::move(data)) {}
+
+  private:
+    std::vector<cbtScalar> mdata;
+};
+
+void ChCollisionModelBullet::injectHeightfield(std::shared_ptr<ChCollisionShapeHeightfield> shape_hfield,
+                                               const ChFrame<>& frame) {
+    auto safe_margin = GetSafeMargin();
+
+    // The heightfield surface is not inflated by the envelope, so the envelope is not used in this collision primitive
+    model->SetEnvelope(0);
+
+    const auto& heights = shape_hfield->GetHeights();
+    std::vector<cbtScalar> data(heights.begin(), heights.end());
+
+    // Bullet centers the heightfield at the middle of its height range; use a range symmetric about 0 so that the
+    // shape origin coincides with the origin of the heightfield frame.
+    auto max_height = (cbtScalar)std::max(std::abs(shape_hfield->GetMinHeight()), shape_hfield->GetMaxHeight());
+
+    auto bt_shape = chrono_types::make_shared<cbtHeightfieldTerrainShape_handledata>(
+        shape_hfield->GetNumPointsX(), shape_hfield->GetNumPointsY(), std::move(data), max_height);
+    bt_shape->setLocalScaling(
+        cbtVector3((cbtScalar)shape_hfield->GetSpacingX(), (cbtScalar)shape_hfield->GetSpacingY(), 1));
+    bt_shape->setMargin((cbtScalar)safe_margin);
+    injectShape(shape_hfield, bt_shape, frame);
+}
+
 void ChCollisionModelBullet::injectTriangleProxy(std::shared_ptr<ChCollisionShapeMeshTriangle> shape_triangle) {
     model->SetSafeMargin(shape_triangle->sradius);
 
@@ -644,11 +712,28 @@ void ChCollisionModelBullet::OnFamilyChange(short int family_group, short int fa
 
     auto coll_sys = std::static_pointer_cast<ChCollisionSystemBullet>(
         model->GetContactable()->GetPhysicsItem()->GetSystem()->GetCollisionSystem());
+    auto bt_world = coll_sys->GetBulletCollisionWorld();
+    auto bt_broadphase = dynamic_cast<cbtDbvtBroadphase*>(bt_world->getBroadphase());
+
+    if (!bt_broadphase) {
+        // Generic broadphase: remove the object and add it back in with the new collision filters.
+        // No need to remove association with the owning ChCollisionModel.
+        coll_sys->Remove(this, false);
+        bt_world->addCollisionObject(bt_collision_object.get(), family_group, family_mask);
+        return;
+    }
 
-    // The only way to change the collision filters in Bullet is to remove the object and add it back in!
-    // No need to remove association with the owning ChCollisionModel.
-    coll_sys->Remove(this, false);
-    coll_sys->GetBulletCollisionWorld()->addCollisionObject(bt_collision_object.get(), family_group, family_mask);
+    // Update the collision filters in place, keeping the object (and its proxy) in the broadphase.
+    // Drop the overlapping pairs of this object, then force a broadphase query for the pairs allowed by new filters.
+    auto proxy = bt_collision_object->getBroadphaseHandle();
+    proxy->m_collisionFilterGroup = family_group;
+    proxy->m_collisionFilterMask = family_mask;
+    bt_broadphase->getOverlappingPairCache()->removeOverlappingPairsContainingProxy(proxy, bt_world->getDispatcher());
+
+    cbtVector3 aabb_min;
+    cbtVector3 aabb_max;
+    bt_world->computeSingleAabb(bt_collision_object.get(), aabb_min, aabb_max);
+    bt_broadphase->setAabbForceUpdate(proxy, aabb_min, aabb_max, bt_world->getDispatcher());
 }
 
 ChAABB ChCollisionModelBullet::GetBoundingBox() const {
@@ -674,6 +759,47 @@ void ChCollisionModelBullet::SyncPosition() {
     bt_collision_object->getWorldTransform().setBasis(basisA);
 }
 
+void ChCollisionModelBullet::SyncMotion(double step) {
+    auto bt_shape = bt_collision_object->getCollisionShape();
+    if (!bt_shape || !model->IsContinuousCollisionEnabled() || step <= 0) {
+        bt_collision_object->setCcdMotionThreshold(0);
+        bt_collision_object->setCcdMotionBound(0);
+        return;
+    }
+
+    // Motions within the envelope are captured by discrete collision detection
+    bt_collision_object->setCcdMotionThreshold((cbtScalar)std::max(GetEnvelope(), 1e-6f));
+
+    auto contactable = GetContactable();
+    const cbtTransform& transform = bt_collision_object->getWorldTransform();
+    const cbtVector3& origin = transform.getOrigin();
+
+    // Velocity of the model origin and, for contactables with rotational DOFs, angular velocity (world frame)
+    ChVector3d lin_vel = contactable->GetContactPointSpeed(ChVector3d(origin.x(), origin.y(), origin.z()));
+    ChVector3d ang_vel(0);
+    if (contactable->GetContactableNumCoordsPosLevel() == 7 && contactable->GetContactableNumCoordsVelLevel() == 6) {
+        ChState x(7, nullptr);
+        ChStateDelta w(6, nullptr);
+        contactable->ContactableGetStateBlockPosLevel(x);
+        contactable->ContactableGetStateBlockVelLevel(w);
+        ChQuaternion<> q(x(3), x(4), x(5), x(6));
+        ang_vel = q.Rotate(ChVector3d(w(3), w(4), w(5)));
+    }
+
+    cbtTransform predicted;
+    cbtTransformUtil::integrateTransform(transform, cbtVector3CH(lin_vel), cbtVector3CH(ang_vel), (cbtScalar)step,
+                                        predicted);
+    bt_collision_object->setInterpolationWorldTransform(predicted);
+
+    // Bound on the displacement of any point of the model (the chord of an arc does not exceed its length)
+    cbtVector3 center;
+    cbtScalar radius;
+    bt_shape->getBoundingSphere(center, radius);
+    double bound = step * (lin_vel.Length() + ang_vel.Length() * (center.length() + radius));
+
+    bt_collision_object->setCcdMotionBound(bound > bt_collision_object->getCcdMotionThreshold() ? (cbtScalar)bound : 0);
+}
+
 bool ChCollisionModelBullet::SetSphereRadius(double coll_radius, double out_envelope) {
     if (m_bt_shapes.size() != 1)
         return false;
@@ -66,6 +66,12 @@ class ChApi ChCollisionModelBullet : public ChCollisionModelImpl {
     /// Populate the collision system with the collision shapes defined in this model.
     void Populate();
 
+    /// Predict the pose of the model at the end of a step of given size, extrapolating from its current velocity.
+    /// Used for continuous collision detection; sets the Bullet interpolation transform, the CCD motion threshold (the
+    /// envelope, or zero if continuous collision detection is disabled), and the motion bound of the Bullet object
+    /// (zero if the motion does not exceed the threshold). SyncPosition() should be invoked before calling this.
+    void SyncMotion(double step);
+
     /// Additional operations to be performed on a change in collision family.
     virtual void OnFamilyChange(short int family_group, short int family_mask) override;
 
@@ -77,6 +83,7 @@ class ChApi ChCollisionModelBullet : public ChCollisionModelImpl {
     void injectConvexHull(std::shared_ptr<ChCollisionShapeConvexHull> shape_hull, const ChFrame<>& frame);
     void injectTriangleMesh(std::shared_ptr<ChCollisionShapeTriangleMesh> shape_trimesh, const ChFrame<>& frame);
     void injectTriangleProxy(std::shared_ptr<ChCollisionShapeMeshTriangle> shape_triangle);
+    void injectHeightfield(std::shared_ptr<ChCollisionShapeHeightfield> shape_hfield, const ChFrame<>& frame);
 
     cbtCollisionObject* GetBulletObject() { return bt_collision_object.get(); }
 
@@ -26,6 +26,9 @@
 #include "chrono/collision/bullet/ChCollisionAlgorithmsBullet.h"
 #include "chrono/collision/gimpact/GIMPACT/Bullet/cbtGImpactCollisionAlgorithm.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionDispatch/cbtCollisionDispatcherMt.h"
+#include "chrono/collision/bullet/BulletCollision/NarrowPhaseCollision/cbtContinuousConvexCollision.h"
+#include "chrono/collision/bullet/BulletCollision/NarrowPhaseCollision/cbtGjkEpaPenetrationDepthSolver.h"
+#include "chrono/collision/bullet/LinearMath/cbtTransformUtil.h"
 #include "chrono/collision/bullet/LinearMath/cbtIDebugDraw.h"
 
 extern cbtScalar gContactBreakingThreshold;
@@ -37,7 +40,14 @@ namespace chrono {
 CH_FACTORY_REGISTER(ChCollisionSystemBullet)
 CH_UPCASTING(ChCollisionSystemBullet, ChCollisionSystem)
 
-ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr) {
+ChCollisionSystemBullet::ChCollisionSystemBullet()
+    : m_debug_drawer(nullptr),
+      m_num_threads(1),
+      m_deterministic(false),
+      m_defer_add(false),
+      m_contact_cache(false),
+      m_num_cached_pairs(0),
+      m_num_ccd_models(0) {
     bt_collision_configuration = new cbtDefaultCollisionConfiguration();
 
 #ifdef BT_USE_OPENMP
@@ -125,12 +135,64 @@ ChCollisionSystemBullet::~ChCollisionSystemBullet() {
 }
 
 void ChCollisionSystemBullet::SetNumThreads(int nthreads) {
+    m_num_threads = std::max(1, nthreads);
 #ifdef BT_USE_OPENMP
     cbtGetOpenMPTaskScheduler()->setNumThreads(nthreads);
 #endif
 }
 
+void ChCollisionSystemBullet::BindAll() {
+    // Collect all collision models in the system, then process them at once
+    m_defer_add = true;
+    ChCollisionSystem::BindAll();
+    m_defer_add = false;
+
+    AddModels(m_deferred);
+    m_deferred.clear();
+}
+
+void ChCollisionSystemBullet::AddModels(const std::vector<std::shared_ptr<ChCollisionModel>>& models) {
+    std::vector<std::shared_ptr<ChCollisionModelBullet>> new_models;
+    new_models.reserve(models.size());
+    for (const auto& model : models) {
+        if (!model->HasImplementation())
+            new_models.push_back(chrono_types::make_shared<ChCollisionModelBullet>(model.get()));
+    }
+
+    // Create the Bullet collision shapes (the expensive part for convex hulls or meshes) in parallel
+    int num_models = (int)new_models.size();
+    int nthreads = std::min(m_num_threads, std::max(1, num_models / 64));
+
+#pragma omp parallel for num_threads(nthreads) if (nthreads > 1) schedule(dynamic, 16)
+    for (int i = 0; i < num_models; i++) {
+        new_models[i]->Populate();
+        new_models[i]->SyncPosition();
+    }
+
+    // Insert the models in the broadphase, then rebuild its AABB tree top-down instead of relying on incremental
+    // re-balancing of a tree built one insertion at a time
+    bt_models.reserve(bt_models.size() + new_models.size());
+    for (const auto& bt_model : new_models) {
+        if (bt_model->GetBulletObject()->getCollisionShape()) {
+            bt_collision_world->addCollisionObject(bt_model->bt_collision_object.get(),  //
+                                                   bt_model->model->GetFamilyGroup(),    //
+                                                   bt_model->model->GetFamilyMask());
+        }
+        bt_models.push_back(bt_model);
+    }
+
+    if (num_models > 0) {
+        if (auto dbvt_broadphase = dynamic_cast<cbtDbvtBroadphase*>(bt_broadphase))
+            dbvt_broadphase->optimize();
+    }
+}
+
 void ChCollisionSystemBullet::Add(std::shared_ptr<ChCollisionModel> model) {
+    if (m_defer_add) {
+        m_deferred.push_back(model);
+        return;
+    }
+
     if (model->HasImplementation())
         return;
 
@@ -151,6 +213,14 @@ void ChCollisionSystemBullet::Clear() {
         cbtPersistentManifold* contactManifold = bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
         contactManifold->clearManifold();
     }
+
+    // Cached narrowphase results are no longer backed by the (cleared) manifolds
+    auto pairCache = bt_collision_world->getBroadphase()->getOverlappingPairCache();
+    for (int i = 0; i < pairCache->getNumOverlappingPairs(); i++) {
+        if (auto algorithm = pairCache->getOverlappingPairArrayPtr()[i].m_algorithm)
+            algorithm->m_cacheState = std::min(algorithm->m_cacheState, 0);
+    }
+
     bt_models.clear();
 }
 
@@ -180,10 +250,244 @@ void ChCollisionSystemBullet::Remove(ChCollisionModelBullet* bt_model, bool eras
     }
 }
 
+// Return the convex shape of the given object and its transform relative to the object, if the object has a single
+// convex shape (possibly as the only child of a compound). Otherwise, return nullptr.
+static const cbtConvexShape* GetSingleConvexShape(const cbtCollisionObject* obj, cbtTransform& local) {
+    const cbtCollisionShape* shape = obj->getCollisionShape();
+    local.setIdentity();
+    if (shape->isCompound()) {
+        auto compound = static_cast<const cbtCompoundShape*>(shape);
+        if (compound->getNumChildShapes() != 1)
+            return nullptr;
+        local = compound->getChildTransform(0);
+        shape = compound->getChildShape(0);
+    }
+    return shape->isConvex() ? static_cast<const cbtConvexShape*>(shape) : nullptr;
+}
+
+// Add a speculative contact at the time of impact of two convex objects moving from their world transforms to their
+// interpolation transforms. The witness point and normal at impact are mapped back to the current configuration, so
+// that the contact constraint acts on the features that collide, even if these are not the closest features now.
+static void AddImpactContact(const cbtCollisionObject* colObj0,
+                             const cbtCollisionObject* colObj1,
+                             cbtManifoldResult& result) {
+    cbtTransform local0, local1;
+    auto shape0 = GetSingleConvexShape(colObj0, local0);
+    auto shape1 = GetSingleConvexShape(colObj1, local1);
+    if (!shape0 || !shape1)
+        return;
+
+    const cbtTransform from0 = colObj0->getWorldTransform() * local0;
+    const cbtTransform from1 = colObj1->getWorldTransform() * local1;
+    const cbtTransform to0 = colObj0->getInterpolationWorldTransform() * local0;
+    const cbtTransform to1 = colObj1->getInterpolationWorldTransform() * local1;
+
+    cbtVoronoiSimplexSolver simplex_solver;
+    cbtGjkEpaPenetrationDepthSolver penetration_solver;
+    cbtContinuousConvexCollision ccd(shape0, shape1, &simplex_solver, &penetration_solver);
+    cbtConvexCast::CastResult cast;
+    if (!ccd.calcTimeOfImpact(from0, to0, from1, to1, cast) || cast.m_fraction >= 1)
+        return;
+
+    // Poses at the time of impact (same interpolation as in the conservative advancement)
+    cbtVector3 lin0, ang0, lin1, ang1;
+    cbtTransformUtil::calculateVelocity(from0, to0, 1, lin0, ang0);
+    cbtTransformUtil::calculateVelocity(from1, to1, 1, lin1, ang1);
+    cbtTransform toi0, toi1;
+    cbtTransformUtil::integrateTransform(from0, lin0, ang0, cast.m_fraction, toi0);
+    cbtTransformUtil::integrateTransform(from1, lin1, ang1, cast.m_fraction, toi1);
+
+    // Map the witness point (on object 1) and normal back to the current configuration
+    cbtVector3 point1 = from1 * toi1.invXform(cast.m_hitPoint);
+    cbtVector3 point0 = from0 * toi0.invXform(cast.m_hitPoint);
+    cbtVector3 normal = from1.getBasis() * (toi1.getBasis().transpose() * cast.m_normal);
+    if (normal.fuzzyZero())
+        return;
+    normal.normalize();
+
+    // Child index 0 if the convex shape is the only child of a compound
+    if (colObj0->getCollisionShape()->isCompound())
+        result.setShapeIdentifiersA(-1, 0);
+    if (colObj1->getCollisionShape()->isCompound())
+        result.setShapeIdentifiersB(-1, 0);
+
+    result.addContactPoint(normal, point1, (point0 - point1).dot(normal));
+}
+
+// Return true if continuous collision detection is enabled for at least one of the two objects.
+static bool IsContinuousPair(const cbtCollisionObject* colObj0, const cbtCollisionObject* colObj1) {
+    return colObj0->getCcdMotionThreshold() > 0 || colObj1->getCcdMotionThreshold() > 0;
+}
+
+// Near callback used when continuous collision detection is enabled for some collision models.
+// For a pair involving such a model, the contact breaking threshold of the pair manifolds is extended by the current
+// motion bounds, so that the narrowphase reports speculative contacts (with positive distance) that may close during
+// the step. For convex pairs, a contact at the time of impact is added as well.
+static void ContinuousNearCallback(cbtBroadphasePair& collisionPair,
+                                   cbtCollisionDispatcher& dispatcher,
+                                   const cbtDispatcherInfo& dispatchInfo) {
+    auto colObj0 = static_cast<cbtCollisionObject*>(collisionPair.m_pProxy0->m_clientObject);
+    auto colObj1 = static_cast<cbtCollisionObject*>(collisionPair.m_pProxy1->m_clientObject);
+
+    if (!IsContinuousPair(colObj0, colObj1)) {
+        cbtCollisionDispatcher::defaultNearCallback(collisionPair, dispatcher, dispatchInfo);
+        return;
+    }
+
+    if (!dispatcher.needsCollision(colObj0, colObj1))
+        return;
+
+    cbtCollisionObjectWrapper obj0Wrap(0, colObj0->getCollisionShape(), colObj0, colObj0->getWorldTransform(), -1, -1);
+    cbtCollisionObjectWrapper obj1Wrap(0, colObj1->getCollisionShape(), colObj1, colObj1->getWorldTransform(), -1, -1);
+
+    if (!collisionPair.m_algorithm)
+        collisionPair.m_algorithm = dispatcher.findAlgorithm(&obj0Wrap, &obj1Wrap, 0, BT_CONTACT_POINT_ALGORITHMS);
+    if (!collisionPair.m_algorithm)
+        return;
+
+    // Existing manifolds were created with the motion bounds at a previous step (new ones use the current bounds)
+    cbtManifoldArray manifolds;
+    collisionPair.m_algorithm->getAllContactManifolds(manifolds);
+    cbtScalar threshold = dispatcher.getManifoldBreakingThreshold(colObj0, colObj1);
+    for (int i = 0; i < manifolds.size(); i++)
+        manifolds[i]->setContactBreakingThreshold(threshold);
+
+    cbtScalar bound = colObj0->getCcdMotionBound() + colObj1->getCcdMotionBound();
+
+    cbtManifoldResult result(&obj0Wrap, &obj1Wrap);
+    if (bound > 0) {
+        result.m_closestPointDistanceThreshold = bound;
+        result.m_speculative = true;
+    }
+    collisionPair.m_algorithm->processCollision(&obj0Wrap, &obj1Wrap, dispatchInfo, &result);
+
+    if (bound > 0 && result.getPersistentManifold())
+        AddImpactContact(colObj0, colObj1, result);
+}
+
+// Return false if the given shape (or any of its children) can change without a change of the object transform.
+static bool IsCacheable(const cbtCollisionShape* shape) {
+    if (shape->getShapeType() == CE_TRIANGLE_SHAPE_PROXYTYPE)
+        return false;
+    if (shape->isCompound()) {
+        auto compound = static_cast<const cbtCompoundShape*>(shape);
+        for (int i = 0; i < compound->getNumChildShapes(); i++) {
+            if (!IsCacheable(compound->getChildShape(i)))
+                return false;
+        }
+    }
+    return true;
+}
+
+// Near callback used when the contact cache is enabled.
+// The narrowphase is skipped if the relative transform of the two objects is within the cache tolerances of the
+// relative transform at the last narrowphase evaluation for this pair (so that errors do not accumulate over skipped
+// steps). The Bullet persistent manifolds of a skipped pair are left untouched; their points are refreshed in
+// ReportContacts.
+static void CachedNearCallback(cbtBroadphasePair& collisionPair,
+                               cbtCollisionDispatcher& dispatcher,
+                               const cbtDispatcherInfo& dispatchInfo) {
+    auto colObj0 = static_cast<cbtCollisionObject*>(collisionPair.m_pProxy0->m_clientObject);
+    auto colObj1 = static_cast<cbtCollisionObject*>(collisionPair.m_pProxy1->m_clientObject);
+
+    // Pairs processed with continuous collision detection are never cached
+    if (IsContinuousPair(colObj0, colObj1)) {
+        ContinuousNearCallback(collisionPair, dispatcher, dispatchInfo);
+        if (collisionPair.m_algorithm) {
+            collisionPair.m_algorithm->m_cacheState = std::min(collisionPair.m_algorithm->m_cacheState, 0);
+            collisionPair.m_algorithm->m_cacheReused = false;
+        }
+        return;
+    }
+
+    if (!dispatcher.needsCollision(colObj0, colObj1)) {
+        if (collisionPair.m_algorithm) {
+            collisionPair.m_algorithm->m_cacheState = std::min(collisionPair.m_algorithm->m_cacheState, 0);
+            collisionPair.m_algorithm->m_cacheReused = false;
+        }
+        return;
+    }
+
+    cbtTransform rel = colObj0->getWorldTransform().inverseTimes(colObj1->getWorldTransform());
+
+    cbtCollisionAlgorithm* algorithm = collisionPair.m_algorithm;
+    if (algorithm && algorithm->m_cacheState == 1) {
+        // For small angles, the Frobenius norm of the difference of two rotation matrices is sqrt(2) times the angle
+        const cbtTransform& cached = algorithm->m_cacheRelTransform;
+        cbtScalar lin_tol = dispatchInfo.m_contactCacheLinTol;
+        cbtScalar ang_tol = dispatchInfo.m_contactCacheAngTol;
+        cbtScalar dp2 = (rel.getOrigin() - cached.getOrigin()).length2();
+        cbtScalar dR2 = (rel.getBasis().getColumn(0) - cached.getBasis().getColumn(0)).length2() +
+                        (rel.getBasis().getColumn(1) - cached.getBasis().getColumn(1)).length2() +
+                        (rel.getBasis().getColumn(2) - cached.getBasis().getColumn(2)).length2();
+        if (dp2 <= lin_tol * lin_tol && dR2 <= 2 * ang_tol * ang_tol) {
+            algorithm->m_cacheReused = true;
+            return;
+        }
+    }
+
+    cbtCollisionDispatcher::defaultNearCallback(collisionPair, dispatcher, dispatchInfo);
+
+    algorithm = collisionPair.m_algorithm;
+    if (algorithm) {
+        if (algorithm->m_cacheState == 0) {
+            bool cacheable = IsCacheable(colObj0->getCollisionShape()) && IsCacheable(colObj1->getCollisionShape());
+            algorithm->m_cacheState = cacheable ? 1 : -1;
+        }
+        algorithm->m_cacheRelTransform = rel;
+        algorithm->m_cacheReused = false;
+    }
+}
+
+void ChCollisionSystemBullet::EnableContactCache(bool val, double lin_tol, double ang_tol) {
+    m_contact_cache = val;
+    m_num_cached_pairs = 0;
+
+    bt_dispatcher->setNearCallback(val ? CachedNearCallback : cbtCollisionDispatcher::defaultNearCallback);
+    bt_collision_world->getDispatchInfo().m_contactCacheLinTol = (cbtScalar)lin_tol;
+    bt_collision_world->getDispatchInfo().m_contactCacheAngTol = (cbtScalar)ang_tol;
+
+    // Discard results cached during a previous use of the contact cache
+    auto pairCache = bt_collision_world->getBroadphase()->getOverlappingPairCache();
+    for (int i = 0; i < pairCache->getNumOverlappingPairs(); i++) {
+        if (auto algorithm = pairCache->getOverlappingPairArrayPtr()[i].m_algorithm) {
+            algorithm->m_cacheState = std::min(algorithm->m_cacheState, 0);
+            algorithm->m_cacheReused = false;
+        }
+    }
+}
+
 void ChCollisionSystemBullet::Run() {
+    // Predict the motion over the current step of models with continuous collision detection
+    double step = m_system ? m_system->GetStep() : 0;
+    m_num_ccd_models = 0;
+    for (const auto& bt_model : bt_models) {
+        auto bt_object = bt_model->GetBulletObject();
+        if (bt_model->model->IsContinuousCollisionEnabled() || bt_object->getCcdMotionThreshold() > 0) {
+            bt_model->SyncMotion(step);
+            if (bt_model->model->IsContinuousCollisionEnabled())
+                m_num_ccd_models++;
+        }
+    }
+
+    if (!m_contact_cache) {
+        bt_dispatcher->setNearCallback(m_num_ccd_models > 0 ? ContinuousNearCallback
+                                                            : cbtCollisionDispatcher::defaultNearCallback);
+    }
+
     if (bt_collision_world) {
         bt_collision_world->performDiscreteCollisionDetection();
     }
+
+    if (m_contact_cache) {
+        m_num_cached_pairs = 0;
+        auto pairCache = bt_collision_world->getBroadphase()->getOverlappingPairCache();
+        for (int i = 0; i < pairCache->getNumOverlappingPairs(); i++) {
+            auto algorithm = pairCache->getOverlappingPairArrayPtr()[i].m_algorithm;
+            if (algorithm && algorithm->m_cacheReused)
+                m_num_cached_pairs++;
+        }
+    }
 }
 
 ChAABB ChCollisionSystemBullet::GetBoundingBox() const {
@@ -208,24 +512,75 @@ double ChCollisionSystemBullet::GetTimerCollisionNarrow() const {
     return bt_collision_world->timer_collision_narrow();
 }
 
+size_t ChCollisionSystemBullet::GetMemoryUsage() const {
+    size_t num_objects = (size_t)bt_collision_world->getNumCollisionObjects();
+    size_t num_pairs = (size_t)bt_collision_world->getBroadphase()->getOverlappingPairCache()->getNumOverlappingPairs();
+    size_t num_manifolds = (size_t)bt_collision_world->getDispatcher()->getNumManifolds();
+
+    return bt_models.capacity() * sizeof(std::shared_ptr<ChCollisionModelBullet>) +  //
+           num_objects * sizeof(cbtCollisionObject) +                               //
+           num_pairs * sizeof(cbtBroadphasePair) +                                  //
+           num_manifolds * sizeof(cbtPersistentManifold);
+}
+
 void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontainer) {
     // This should remove all old contacts (or at least rewind the index)
     mcontactcontainer->BeginAddContact();
-
-    // NOTE: Bullet does not provide information on radius of curvature at a contact point.
-    // As such, for all Bullet-identified contacts, the default value will be used (SMC only).
-    ChCollisionInfo icontact;
+    if (contact_reduction)
+        contact_reduction->Reset();
 
     int numManifolds = bt_collision_world->getDispatcher()->getNumManifolds();
+    std::vector<cbtPersistentManifold*> manifolds(numManifolds);
+    for (int i = 0; i < numManifolds; i++)
+        manifolds[i] = bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
+
+    // In deterministic mode, process the manifolds in the order of the indices of the colliding objects
+    // (manifolds for the same pair of compound objects are kept in their original order)
+    if (m_deterministic) {
+        std::stable_sort(manifolds.begin(), manifolds.end(),
+                         [](const cbtPersistentManifold* a, const cbtPersistentManifold* b) {
+                             int a0 = a->getBody0()->getWorldArrayIndex();
+                             int b0 = b->getBody0()->getWorldArrayIndex();
+                             if (a0 != b0)
+                                 return a0 < b0;
+                             return a->getBody1()->getWorldArrayIndex() < b->getBody1()->getWorldArrayIndex();
+                         });
+    }
+
+    // Refresh the manifold contact points and convert them to Chrono collision info in parallel (each manifold is
+    // independent). The contacts of each manifold are written to a contiguous range of a shared buffer, so that they
+    // are reported below in manifold order, regardless of the number of threads.
+    int nthreads = std::min(m_num_threads, std::max(1, numManifolds / 64));
+
+    m_report_offsets.resize(numManifolds + 1);
+    m_report_counts.resize(numManifolds);
+    m_report_offsets[0] = 0;
+
+#pragma omp parallel for num_threads(nthreads) if (nthreads > 1) schedule(static)
     for (int i = 0; i < numManifolds; i++) {
-        cbtPersistentManifold* contactManifold = bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
+        auto contactManifold = manifolds[i];
+        contactManifold->refreshContactPoints(contactManifold->getBody0()->getWorldTransform(),
+                                              contactManifold->getBody1()->getWorldTransform());
+        m_report_offsets[i + 1] = contactManifold->getNumContacts();
+    }
+
+    for (int i = 0; i < numManifolds; i++)
+        m_report_offsets[i + 1] += m_report_offsets[i];
+    if (m_report_contacts.size() < (size_t)m_report_offsets[numManifolds])
+        m_report_contacts.resize(m_report_offsets[numManifolds]);
+
+#pragma omp parallel for num_threads(nthreads) if (nthreads > 1) schedule(static)
+    for (int i = 0; i < numManifolds; i++) {
+        auto contactManifold = manifolds[i];
         const cbtCollisionObject* obA = contactManifold->getBody0();
         const cbtCollisionObject* obB = contactManifold->getBody1();
-        contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
 
         auto bt_modelA = (ChCollisionModelBullet*)obA->getUserPointer();
         auto bt_modelB = (ChCollisionModelBullet*)obB->getUserPointer();
 
+        // NOTE: Bullet does not provide information on radius of curvature at a contact point.
+        // As such, for all Bullet-identified contacts, the default value will be used (SMC only).
+        ChCollisionInfo icontact;
         icontact.modelA = bt_modelA->model;
         icontact.modelB = bt_modelB->model;
 
@@ -235,66 +590,80 @@ void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontain
         double marginA = icontact.modelA->GetSafeMargin();
         double marginB = icontact.modelB->GetSafeMargin();
 
-        // Execute custom broadphase callback, if any
-        bool do_narrow_contactgeneration = true;
-        if (broad_callback)
-            do_narrow_contactgeneration = broad_callback->OnBroadphase(icontact.modelA, icontact.modelB);
+        // Speculative contacts (continuous collision detection) are kept up to the motion bounds of the two models
+        double boundAB = obA->getCcdMotionBound() + obB->getCcdMotionBound();
 
-        if (do_narrow_contactgeneration) {
-            int numContacts = contactManifold->getNumContacts();
-            // std::cout << "numContacts=" << numContacts << std::endl;
-            for (int j = 0; j < numContacts; j++) {
-                cbtManifoldPoint& pt = contactManifold->getContactPoint(j);
+        bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+        bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
 
-                // Discard "too far" constraints (the Bullet engine also has its threshold)
-                if (pt.getDistance() < marginA + marginB) {
-                    cbtVector3 ptA = pt.getPositionWorldOnA();
-                    cbtVector3 ptB = pt.getPositionWorldOnB();
+        int count = 0;
+        int numContacts = contactManifold->getNumContacts();
+        for (int j = 0; j < numContacts; j++) {
+            cbtManifoldPoint& pt = contactManifold->getContactPoint(j);
 
-                    icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
-                    icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
+            // Discard "too far" constraints (the Bullet engine also has its threshold)
+            if (pt.getDistance() < marginA + marginB + boundAB) {
+                cbtVector3 ptA = pt.getPositionWorldOnA();
+                cbtVector3 ptB = pt.getPositionWorldOnB();
 
-                    icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(),
-                                    -pt.m_normalWorldOnB.getZ());
-                    icontact.vN.Normalize();
+                icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
+                icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
 
-                    double ptdist = pt.getDistance();
+                icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(),
+                                -pt.m_normalWorldOnB.getZ());
+                icontact.vN.Normalize();
 
-                    icontact.vpA = icontact.vpA - icontact.vN * envelopeA;
-                    icontact.vpB = icontact.vpB + icontact.vN * envelopeB;
-                    icontact.distance = ptdist + envelopeA + envelopeB;
+                double ptdist = pt.getDistance();
 
-                    icontact.reaction_cache = pt.reactions_cache;
+                icontact.vpA = icontact.vpA - icontact.vN * envelopeA;
+                icontact.vpB = icontact.vpB + icontact.vN * envelopeB;
+                icontact.distance = ptdist + envelopeA + envelopeB;
 
-                    bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
-                    bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+                icontact.reaction_cache = pt.reactions_cache;
 
-                    int indexA = compoundA ? pt.m_index0 : 0;
-                    int indexB = compoundB ? pt.m_index1 : 0;
+                int indexA = compoundA ? pt.m_index0 : 0;
+                int indexB = compoundB ? pt.m_index1 : 0;
 
-                    icontact.shapeA = bt_modelA->m_shapes[indexA].get();
-                    icontact.shapeB = bt_modelB->m_shapes[indexB].get();
+                icontact.shapeA = bt_modelA->m_shapes[indexA].get();
+                icontact.shapeB = bt_modelB->m_shapes[indexB].get();
 
-                    // Execute some user custom callback, if any
-                    bool add_contact = true;
-                    if (this->narrow_callback)
-                        add_contact = this->narrow_callback->OnNarrowphase(icontact);
+                m_report_contacts[m_report_offsets[i] + count] = icontact;
+                count++;
+            }
+        }
+        m_report_counts[i] = count;
+    }
 
-                    // Add to contact container
-                    if (add_contact) {
-                        ////std::cout << " add indexA=" << indexA << " indexB=" << indexB << std::endl;
-                        ////std::cout << "     typeA=" << icontact.shapeA->m_type << " typeB=" <<
-                        /// icontact.shapeB->m_type << std::endl;
+    // Execute the user callbacks (if any) and add the contacts to the container (serially, in manifold order)
+    for (int i = 0; i < numManifolds; i++) {
+        // Execute custom broadphase callback, if any
+        if (broad_callback) {
+            auto bt_modelA = (ChCollisionModelBullet*)manifolds[i]->getBody0()->getUserPointer();
+            auto bt_modelB = (ChCollisionModelBullet*)manifolds[i]->getBody1()->getUserPointer();
+            if (!broad_callback->OnBroadphase(bt_modelA->model, bt_modelB->model))
+                continue;
+        }
+
+        for (int k = m_report_offsets[i]; k < m_report_offsets[i] + m_report_counts[i]; k++) {
+            auto& icontact = m_report_contacts[k];
+
+            // Execute some user custom callback, if any
+            bool add_contact = true;
+            if (this->narrow_callback)
+                add_contact = this->narrow_callback->OnNarrowphase(icontact);
 
-                        mcontactcontainer->AddContact(icontact);
-                    }
-                }
+            // Add to contact container
+            if (add_contact) {
+                if (contact_reduction)
+                    contact_reduction->AddContact(icontact);
+                else
+                    mcontactcontainer->AddContact(icontact);
             }
         }
-
-        // Uncomment this line to remove all points
-        ////contactManifold->clearManifold();
     }
+
+    if (contact_reduction)
+        contact_reduction->ReportContacts(mcontactcontainer);
     mcontactcontainer->EndAddContact();
 }
 
@@ -321,6 +690,27 @@ void ChCollisionSystemBullet::ReportProximities(ChProximityContainer* mproximity
     mproximitycontainer->EndAddProximities();
 }
 
+bool ChCollisionSystemBullet::SetRayhitResult(const cbtCollisionWorld::ClosestRayResultCallback& rayCallback,
+                                              ChRayhitResult& result) {
+    if (rayCallback.hasHit()) {
+        auto bt_model = static_cast<ChCollisionModelBullet*>(rayCallback.m_collisionObject->getUserPointer());
+        result.hitModel = bt_model->model;
+        if (result.hitModel) {
+            result.hit = true;
+            result.abs_hitPoint.Set(rayCallback.m_hitPointWorld.x(), rayCallback.m_hitPointWorld.y(),
+                                    rayCallback.m_hitPointWorld.z());
+            result.abs_hitNormal.Set(rayCallback.m_hitNormalWorld.x(), rayCallback.m_hitNormalWorld.y(),
+                                     rayCallback.m_hitNormalWorld.z());
+            result.abs_hitNormal.Normalize();
+            result.dist_factor = rayCallback.m_closestHitFraction;
+            result.abs_hitPoint = result.abs_hitPoint - result.abs_hitNormal * result.hitModel->GetEnvelope();
+            return true;
+        }
+    }
+    result.hit = false;
+    return false;
+}
+
 bool ChCollisionSystemBullet::RayHit(const ChVector3d& from, const ChVector3d& to, ChRayhitResult& result) const {
     return RayHit(from, to, result, cbtBroadphaseProxy::DefaultFilter, cbtBroadphaseProxy::AllFilter);
 }
@@ -339,23 +729,7 @@ bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
 
     this->bt_collision_world->rayTest(btfrom, btto, rayCallback);
 
-    if (rayCallback.hasHit()) {
-        auto bt_model = static_cast<ChCollisionModelBullet*>(rayCallback.m_collisionObject->getUserPointer());
-        result.hitModel = bt_model->model;
-        if (result.hitModel) {
-            result.hit = true;
-            result.abs_hitPoint.Set(rayCallback.m_hitPointWorld.x(), rayCallback.m_hitPointWorld.y(),
-                                    rayCallback.m_hitPointWorld.z());
-            result.abs_hitNormal.Set(rayCallback.m_hitNormalWorld.x(), rayCallback.m_hitNormalWorld.y(),
-                                     rayCallback.m_hitNormalWorld.z());
-            result.abs_hitNormal.Normalize();
-            result.dist_factor = rayCallback.m_closestHitFraction;
-            result.abs_hitPoint = result.abs_hitPoint - result.abs_hitNormal * result.hitModel->GetEnvelope();
-            return true;
-        }
-    }
-    result.hit = false;
-    return false;
+    return SetRayhitResult(rayCallback, result);
 }
 
 bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
@@ -374,41 +748,122 @@ bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
     cbtVector3 btfrom((cbtScalar)from.x(), (cbtScalar)from.y(), (cbtScalar)from.z());
     cbtVector3 btto((cbtScalar)to.x(), (cbtScalar)to.y(), (cbtScalar)to.z());
 
-    cbtCollisionWorld::AllHitsRayResultCallback rayCallback(btfrom, btto);
+    // Test the ray directly against the Bullet collision object of the specified model, without traversing the
+    // broadphase (this also makes the function safe for concurrent calls from multiple threads)
+    result.hit = false;
+    if (!model->HasImplementation())
+        return false;
+    auto bt_object = static_cast<ChCollisionModelBullet*>(model->GetImplementation())->GetBulletObject();
+    auto bt_proxy = bt_object->getBroadphaseHandle();
+    if (!bt_proxy)
+        return false;
+
+    cbtCollisionWorld::ClosestRayResultCallback rayCallback(btfrom, btto);
     rayCallback.m_collisionFilterGroup = filter_group;
     rayCallback.m_collisionFilterMask = filter_mask;
+    if (!rayCallback.needsCollision(bt_proxy))
+        return false;
 
-    this->bt_collision_world->rayTest(btfrom, btto, rayCallback);
+    cbtTransform rayFromTrans;
+    cbtTransform rayToTrans;
+    rayFromTrans.setIdentity();
+    rayFromTrans.setOrigin(btfrom);
+    rayToTrans.setIdentity();
+    rayToTrans.setOrigin(btto);
+    cbtCollisionWorld::rayTestSingle(rayFromTrans, rayToTrans, bt_object, bt_object->getCollisionShape(),
+                                     bt_object->getWorldTransform(), rayCallback);
 
-    // Find the closest hit result on the specified model (if any)
-    int hit = -1;
-    cbtScalar fraction = 1;
-    for (int i = 0; i < rayCallback.m_collisionObjects.size(); ++i) {
-        auto bt_model = static_cast<ChCollisionModelBullet*>(rayCallback.m_collisionObject->getUserPointer());
-        if (bt_model->model == model && rayCallback.m_hitFractions[i] < fraction) {
-            hit = i;
-            fraction = rayCallback.m_hitFractions[i];
+    return SetRayhitResult(rayCallback, result);
+}
+
+// Ray tester for the leaves of the broadphase AABB tree, for use in batched ray-hit tests.
+// Equivalent to the ray callback used by cbtCollisionWorld::rayTest, but set up once per thread and reused for all
+// rays in a batch.
+struct ChBatchRayTester : cbtDbvt::ICollide {
+    ChBatchRayTester(const cbtCollisionWorld* world) : m_world(world), m_resultCallback(nullptr) {}
+
+    // Set the current ray and result callback.
+    void SetRay(const cbtVector3& from, const cbtVector3& to, cbtCollisionWorld::RayResultCallback& resultCallback) {
+        m_rayFromTrans.setIdentity();
+        m_rayFromTrans.setOrigin(from);
+        m_rayToTrans.setIdentity();
+        m_rayToTrans.setOrigin(to);
+
+        cbtVector3 rayDir = (to - from);
+        rayDir.normalize();
+        for (int i = 0; i < 3; i++) {
+            m_rayDirectionInverse[i] =
+                rayDir[i] == cbtScalar(0.0) ? cbtScalar(BT_LARGE_FLOAT) : cbtScalar(1.0) / rayDir[i];
+            m_signs[i] = m_rayDirectionInverse[i] < 0.0;
         }
+        m_lambda_max = rayDir.dot(to - from);
+
+        m_resultCallback = &resultCallback;
     }
 
-    // Ray does not hit specified model
-    if (hit == -1) {
-        result.hit = false;
-        return false;
+    // Perform the exact ray test for a leaf whose AABB is intersected by the current ray.
+    virtual void Process(const cbtDbvtNode* leaf) override {
+        // Terminate further ray tests once the closest hit fraction reached zero
+        if (m_resultCallback->m_closestHitFraction == cbtScalar(0))
+            return;
+
+        auto proxy = (cbtBroadphaseProxy*)leaf->data;
+        auto collisionObject = (cbtCollisionObject*)proxy->m_clientObject;
+        if (m_resultCallback->needsCollision(collisionObject->getBroadphaseHandle())) {
+            m_world->rayTestSingle(m_rayFromTrans, m_rayToTrans, collisionObject, collisionObject->getCollisionShape(),
+                                   collisionObject->getWorldTransform(), *m_resultCallback);
+        }
     }
 
-    // Return the closest hit on the specified model
-    auto bt_model = static_cast<ChCollisionModelBullet*>(rayCallback.m_collisionObjects[hit]->getUserPointer());
-    result.hit = true;
-    result.hitModel = bt_model->model;
-    result.abs_hitPoint.Set(rayCallback.m_hitPointWorld[hit].x(), rayCallback.m_hitPointWorld[hit].y(),
-                            rayCallback.m_hitPointWorld[hit].z());
-    result.abs_hitNormal.Set(rayCallback.m_hitNormalWorld[hit].x(), rayCallback.m_hitNormalWorld[hit].y(),
-                             rayCallback.m_hitNormalWorld[hit].z());
-    result.abs_hitNormal.Normalize();
-    result.dist_factor = fraction;
-    result.abs_hitPoint = result.abs_hitPoint - result.abs_hitNormal * result.hitModel->GetEnvelope();
-    return true;
+    const cbtCollisionWorld* m_world;
+    cbtCollisionWorld::RayResultCallback* m_resultCallback;
+    cbtTransform m_rayFromTrans;
+    cbtTransform m_rayToTrans;
+    cbtVector3 m_rayDirectionInverse;
+    unsigned int m_signs[3];
+    cbtScalar m_lambda_max;
+    cbtAlignedObjectArray<const cbtDbvtNode*> m_stack;  // traversal stack, reused across rays
+};
+
+int ChCollisionSystemBullet::RayHitBatch(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const {
+    auto dbvt_broadphase = dynamic_cast<cbtDbvtBroadphase*>(bt_broadphase);
+    if (!dbvt_broadphase)
+        return ChCollisionSystem::RayHitBatch(rays, results);
+
+    int num_rays = (int)rays.size();
+    results.resize(num_rays);
+
+    int num_hits = 0;
+    int nthreads = std::min(m_num_threads, std::max(1, num_rays / 64));
+
+#pragma omp parallel num_threads(nthreads) if (nthreads > 1) reduction(+ : num_hits)
+    {
+        ChBatchRayTester tester(bt_collision_world);
+
+#pragma omp for schedule(static)
+        for (int i = 0; i < num_rays; i++) {
+            cbtVector3 btfrom((cbtScalar)rays[i].from.x(), (cbtScalar)rays[i].from.y(), (cbtScalar)rays[i].from.z());
+            cbtVector3 btto((cbtScalar)rays[i].to.x(), (cbtScalar)rays[i].to.y(), (cbtScalar)rays[i].to.z());
+
+            cbtCollisionWorld::ClosestRayResultCallback rayCallback(btfrom, btto);
+            rayCallback.m_collisionFilterGroup = cbtBroadphaseProxy::DefaultFilter;
+            rayCallback.m_collisionFilterMask = cbtBroadphaseProxy::AllFilter;
+
+            tester.SetRay(btfrom, btto, rayCallback);
+
+            // Traverse the dynamic and static AABB trees of the broadphase
+            for (int k = 0; k < 2; k++) {
+                dbvt_broadphase->m_sets[k].rayTestInternal(
+                    dbvt_broadphase->m_sets[k].m_root, btfrom, btto, tester.m_rayDirectionInverse, tester.m_signs,
+                    tester.m_lambda_max, cbtVector3(0, 0, 0), cbtVector3(0, 0, 0), tester.m_stack, tester);
+            }
+
+            if (SetRayhitResult(rayCallback, results[i]))
+                num_hits++;
+        }
+    }
+
+    return num_hits;
 }
 
 void ChCollisionSystemBullet::SetContactBreakingThreshold(double threshold) {
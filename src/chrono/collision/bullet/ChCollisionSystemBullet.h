@@ -39,6 +39,14 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     /// if any (like persistent contact manifolds)
     virtual void Clear() override;
 
+    /// Process all collision models in the associated Chrono system.
+    /// The Bullet collision shapes of all models are created in parallel (using the OpenMP threads set with
+    /// SetNumThreads), after which all models are inserted in the broadphase and its AABB tree is rebuilt once.
+    virtual void BindAll() override;
+
+    /// Return the type of this collision system.
+    virtual Type GetType() const override { return Type::BULLET; }
+
     /// Add the specified collision model to the collision engine.
     virtual void Add(std::shared_ptr<ChCollisionModel> model) override;
 
@@ -50,12 +58,31 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     // virtual void RemoveAll();
 
     /// Set the number of OpenMP threads for collision detection.
+    /// These threads are used for reporting contacts and, if Chrono was configured with USE_BULLET_OPENMP, also for the
+    /// AABB update and the narrowphase.
     virtual void SetNumThreads(int nthreads) override;
 
+    /// Enable/disable deterministic contact generation (default: false).
+    /// If enabled, the contact manifolds are reported sorted by the indices of the two collision objects, so that the
+    /// order of the generated contacts does not depend on the history of the broadphase pair cache.
+    virtual void SetDeterministic(bool val) override { m_deterministic = val; }
+
     /// Run the algorithm and finds all the contacts.
     /// (Contacts will be managed by the Bullet persistent contact cache).
     virtual void Run() override;
 
+    /// Enable/disable caching of narrowphase results across calls to Run (default: false).
+    /// If enabled, the narrowphase is skipped for a pair of overlapping collision models whose relative transform
+    /// changed by less than the given tolerances (distance and angle) since the last narrowphase evaluation for that
+    /// pair. The contact points of such a pair, kept in its Bullet persistent manifolds, are only re-validated at the
+    /// current positions of the two models. This benefits models with many persistent contacts between bodies that move
+    /// together (e.g., track shoes engaged with a sprocket or resting on the terrain), at the cost of contact point
+    /// errors bounded by the tolerances. Pairs involving deformable (FEA) collision shapes are always processed.
+    void EnableContactCache(bool val, double lin_tol = 1e-5, double ang_tol = 1e-4);
+
+    /// Return the number of overlapping pairs for which the narrowphase was skipped during the last call to Run.
+    int GetNumCachedPairs() const { return m_num_cached_pairs; }
+
     /// Return an AABB bounding all collision shapes in the system.
     virtual ChAABB GetBoundingBox() const override;
 
@@ -68,6 +95,10 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     /// Return the time (in seconds) for narrowphase collision detection.
     virtual double GetTimerCollisionNarrow() const override;
 
+    /// Return an estimate of the memory (in bytes) used by the Bullet collision objects, the broadphase overlapping
+    /// pairs, and the contact manifolds. The memory of the collision shapes is not included.
+    virtual size_t GetMemoryUsage() const override;
+
     /// After the Run() has completed, you can call this function to
     /// fill a 'contact container', that is an object inherited from class
     /// ChContactContainer. For instance ChSystem, after each Run()
@@ -75,6 +106,8 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     /// The basic behavior of the implementation is the following: collision system
     /// will call in sequence the functions BeginAddContact(), AddContact() (x n times),
     /// EndAddContact() of the contact container.
+    /// The contact manifolds are refreshed and converted in parallel (using the OpenMP threads set with
+    /// SetNumThreads); the user callbacks and the contact container are invoked serially, in manifold order.
     virtual void ReportContacts(ChContactContainer* mcontactcontainer) override;
 
     /// After the Run() has completed, you can call this function to
@@ -90,11 +123,17 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     virtual bool RayHit(const ChVector3d& from, const ChVector3d& to, ChRayhitResult& result) const override;
 
     /// Perform a ray-hit test with the specified collision model.
+    /// The ray is tested directly against the model, so this function can be called concurrently from multiple threads.
     virtual bool RayHit(const ChVector3d& from,
                         const ChVector3d& to,
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform ray-hit tests with all collision models for a batch of rays.
+    /// The rays are distributed over the OpenMP threads set with SetNumThreads. Each thread traverses the broadphase
+    /// AABB tree directly, reusing its traversal stack across rays.
+    virtual int RayHitBatch(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const override;
+
     /// Specify a callback object to be used for debug rendering of collision shapes.
     virtual void RegisterVisualizationCallback(std::shared_ptr<VisualizationCallback> callback) override;
 
@@ -136,10 +175,16 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                 short int filter_group,
                 short int filter_mask) const;
 
+    /// Set the ray-hit result from the closest hit recorded by the given Bullet ray callback.
+    static bool SetRayhitResult(const cbtCollisionWorld::ClosestRayResultCallback& rayCallback, ChRayhitResult& result);
+
     /// Remove the specified Bullet model from this collision system.
     /// If erase=true, also remove from the bt_models list.
     void Remove(ChCollisionModelBullet* bt_model, bool erase);
 
+    /// Add the specified collision models to the collision engine, creating their Bullet shapes in parallel.
+    void AddModels(const std::vector<std::shared_ptr<ChCollisionModel>>& models);
+
     std::vector<std::shared_ptr<ChCollisionModelBullet>> bt_models;
 
     cbtCollisionConfiguration* bt_collision_configuration;
@@ -160,6 +205,21 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
 
     cbtIDebugDraw* m_debug_drawer;
 
+    int m_num_threads;     ///< number of OpenMP threads (used in BindAll, ReportContacts, and batched ray-hit tests)
+    bool m_deterministic;  ///< report contact manifolds in sorted order
+
+    bool m_defer_add;                                           ///< collect models in Add (during BindAll)
+    std::vector<std::shared_ptr<ChCollisionModel>> m_deferred;  ///< models collected during BindAll
+
+    bool m_contact_cache;    ///< skip narrowphase for pairs with unchanged relative transform
+    int m_num_cached_pairs;  ///< number of pairs with skipped narrowphase at last call to Run
+
+    int m_num_ccd_models;  ///< number of models with continuous collision detection at last call to Run
+
+    std::vector<ChCollisionInfo> m_report_contacts;  ///< contacts converted in parallel in ReportContacts
+    std::vector<int> m_report_offsets;               ///< start of the contacts of each manifold in m_report_contacts
+    std::vector<int> m_report_counts;                ///< number of contacts of each manifold in m_report_contacts
+
     friend class ChCollisionModelBullet;
 };
 
@@ -34,11 +34,14 @@ namespace chrono {
 using namespace chrono::mc_utils;
 
 ChBroadphase::ChBroadphase()
-    : grid_type(GridType::FIXED_RESOLUTION),
+    : cd_data(nullptr),
+      grid_type(GridType::FIXED_RESOLUTION),
       grid_resolution(vec3(10, 10, 10)),
       bin_size(real3(1, 1, 1)),
       grid_density(5),
-      cd_data(nullptr) {}
+      incremental(false),
+      backend(nullptr),
+      prev_valid(false) {}
 
 // -----------------------------------------------------------------------------
 
@@ -210,18 +213,101 @@ void ChBroadphase::ComputeTopLevelResolution() {
 
 // Use spatial subdivision to detect the list of POSSIBLE collisions
 void ChBroadphase::Process() {
-    // Compute overall AABB and then offset all AABBs
+    if (!incremental) {
+        prev_valid = false;
+
+        // Compute overall AABB and then offset all AABBs
+        DetermineBoundingBox();
+        OffsetAABB();
+
+        // Determine resolution of the top level grid
+        ComputeTopLevelResolution();
+
+        if (cd_data->num_rigid_shapes != 0) {
+            OneLevelBroadphase();
+            cd_data->num_rigid_contacts = cd_data->num_possible_collisions;
+        }
+        return;
+    }
+
+    // Incremental broadphase.
+    // Keep the grid from the previous call as long as it still contains all shapes (and the number of shapes and the
+    // grid settings did not change). Otherwise, construct a new grid, slightly inflated so that small changes of the
+    // overall bounding box do not trigger a new grid construction at the next call.
     DetermineBoundingBox();
-    OffsetAABB();
 
-    // Determine resolution of the top level grid
-    ComputeTopLevelResolution();
+    bool reuse_grid = CanReuseGrid();
+    if (reuse_grid) {
+        cd_data->min_bounding_point = prev_min_bounding_point;
+        cd_data->max_bounding_point = prev_max_bounding_point;
+        cd_data->global_origin = prev_min_bounding_point;
+    } else {
+        real fraction = real(0.05);
+        real3 size = cd_data->max_bounding_point - cd_data->min_bounding_point;
+        cd_data->min_bounding_point = cd_data->min_bounding_point - fraction * size;
+        cd_data->max_bounding_point = cd_data->max_bounding_point + fraction * size;
+        cd_data->global_origin = cd_data->min_bounding_point;
+        ComputeTopLevelResolution();
+
+        prev_grid_type = grid_type;
+        prev_grid_resolution = grid_resolution;
+        prev_bin_size = bin_size;
+        prev_grid_density = grid_density;
+        prev_min_bounding_point = cd_data->min_bounding_point;
+        prev_max_bounding_point = cd_data->max_bounding_point;
+    }
+
+    OffsetAABB();
 
     if (cd_data->num_rigid_shapes != 0) {
-        OneLevelBroadphase();
+        if (reuse_grid)
+            IncrementalBroadphase();
+        else
+            OneLevelBroadphase();
         cd_data->num_rigid_contacts = cd_data->num_possible_collisions;
     }
-    return;
+
+    SaveIncrementalState();
+}
+
+// Check whether the grid from the previous call can be reused.
+bool ChBroadphase::CanReuseGrid() const {
+    if (!prev_valid || cd_data->num_rigid_shapes != prev_num_shapes)
+        return false;
+
+    if (grid_type != prev_grid_type || grid_density != prev_grid_density || !(bin_size == prev_bin_size) ||
+        grid_resolution.x != prev_grid_resolution.x || grid_resolution.y != prev_grid_resolution.y ||
+        grid_resolution.z != prev_grid_resolution.z)
+        return false;
+
+    const real3& min_point = cd_data->min_bounding_point;
+    const real3& max_point = cd_data->max_bounding_point;
+    return min_point.x >= prev_min_bounding_point.x && min_point.y >= prev_min_bounding_point.y &&
+           min_point.z >= prev_min_bounding_point.z && max_point.x <= prev_max_bounding_point.x &&
+           max_point.y <= prev_max_bounding_point.y && max_point.z <= prev_max_bounding_point.z;
+}
+
+// Cache the current shape data, for use at the next call to the incremental broadphase.
+void ChBroadphase::SaveIncrementalState() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    prev_num_shapes = num_shapes;
+    prev_aabb_min = cd_data->aabb_min;
+    prev_aabb_max = cd_data->aabb_max;
+    prev_body_id = obj_data_id;
+    prev_fam = cd_data->shape_data.fam_rigid;
+
+    prev_body_state.resize(num_shapes);
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        uint body = obj_data_id[i];
+        prev_body_state[i] = (body == UINT_MAX) ? 0 : (obj_active[body] != 0) | ((obj_collide[body] != 0) << 1);
+    }
+
+    prev_valid = true;
 }
 
 void ChBroadphase::OneLevelBroadphase() {
@@ -239,7 +325,6 @@ void ChBroadphase::OneLevelBroadphase() {
     std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
     std::vector<uint>& bin_active = cd_data->bin_active;
     std::vector<uint>& bin_start_index = cd_data->bin_start_index;
-    std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
     std::vector<uint>& bin_num_contact = cd_data->bin_num_contact;
 
     const int num_shapes = cd_data->num_rigid_shapes;
@@ -253,6 +338,13 @@ void ChBroadphase::OneLevelBroadphase() {
 
     num_bins = bins_per_axis.x * bins_per_axis.y * bins_per_axis.z;
 
+    if (backend) {
+        backend->OneLevelBroadphase(*cd_data);
+        if (num_active_bins > 0)
+            ComputeExtendedStartIndex();
+        return;
+    }
+
     bin_intersections.resize(num_shapes + 1);
     bin_intersections[num_shapes] = 0;
 
@@ -323,8 +415,219 @@ void ChBroadphase::OneLevelBroadphase() {
 
     pair_shapeIDs.resize(num_possible_collisions);
 
-    // For use in ray intersection tests, also create an "extended" vector of start indices that also includes bins with
-    // no shape AABB intersections.
+    ComputeExtendedStartIndex();
+}
+
+// Incremental version of the one-level broadphase, using the grid from the previous call.
+// - Only shapes whose AABB intersects a different set of bins than at the previous call are re-binned. Bin-shape
+//   intersections of all other shapes are kept (in sorted order), and merged with the (sorted) new intersections.
+// - Pairs in bins with no changes since the previous call (same shapes, all with unchanged AABBs, collision families,
+//   and body states) are copied from the previous list of pairs.
+void ChBroadphase::IncrementalBroadphase() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    std::vector<uint>& bin_intersections = cd_data->bin_intersections;
+    std::vector<uint>& bin_number = cd_data->bin_number;
+    std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    std::vector<uint>& bin_active = cd_data->bin_active;
+    std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+    std::vector<uint>& bin_num_contact = cd_data->bin_num_contact;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+    uint& num_active_bins = cd_data->num_active_bins;
+    uint& num_bin_aabb_intersections = cd_data->num_bin_aabb_intersections;
+    uint& num_possible_collisions = cd_data->num_possible_collisions;
+
+    // Classify shapes
+    shape_static.resize(num_shapes);
+    shape_rebin.resize(num_shapes);
+    int num_rebin = 0;
+#pragma omp parallel for reduction(+ : num_rebin)
+    for (int i = 0; i < num_shapes; i++) {
+        uint body = obj_data_id[i];
+        char state = (body == UINT_MAX) ? 0 : (obj_active[body] != 0) | ((obj_collide[body] != 0) << 1);
+
+        bool same_body = (body == prev_body_id[i]);
+        shape_static[i] = same_body && state == prev_body_state[i] && fam_data[i].x == prev_fam[i].x &&
+                          fam_data[i].y == prev_fam[i].y && aabb_min[i] == prev_aabb_min[i] &&
+                          aabb_max[i] == prev_aabb_max[i];
+
+        bool rebin = !same_body;
+        if (!rebin && body != UINT_MAX && !shape_static[i]) {
+            vec3 gmin = HashMin(aabb_min[i], inv_bin_size);
+            vec3 gmax = HashMax(aabb_max[i], inv_bin_size);
+            vec3 pmin = HashMin(prev_aabb_min[i], inv_bin_size);
+            vec3 pmax = HashMax(prev_aabb_max[i], inv_bin_size);
+            rebin = gmin.x != pmin.x || gmin.y != pmin.y || gmin.z != pmin.z ||  //
+                    gmax.x != pmax.x || gmax.y != pmax.y || gmax.z != pmax.z;
+        }
+        shape_rebin[i] = rebin;
+        num_rebin += rebin;
+    }
+
+    // Update the list of bin-shape AABB intersections
+    if (num_rebin > 0) {
+        // Count and store the new bin intersections of re-binned shapes
+        bin_intersections.resize(num_shapes + 1);
+        bin_intersections[num_shapes] = 0;
+#pragma omp parallel for
+        for (int i = 0; i < num_shapes; i++) {
+            if (!shape_rebin[i] || obj_data_id[i] == UINT_MAX) {
+                bin_intersections[i] = 0;
+                continue;
+            }
+            f_Count_AABB_BIN_Intersection(i, inv_bin_size, aabb_min, aabb_max, bin_intersections);
+        }
+        Thrust_Exclusive_Scan(bin_intersections);
+        uint num_new = bin_intersections.back();
+
+        std::vector<uint> new_bin_number(num_new);
+        std::vector<uint> new_bin_aabb_number(num_new);
+#pragma omp parallel for
+        for (int i = 0; i < num_shapes; i++) {
+            if (!shape_rebin[i] || obj_data_id[i] == UINT_MAX)
+                continue;
+            f_Store_AABB_BIN_Intersection(i, bins_per_axis, inv_bin_size, aabb_min, aabb_max, bin_intersections,
+                                          new_bin_number, new_bin_aabb_number);
+        }
+        Thrust_Sort_By_Key(new_bin_number, new_bin_aabb_number);
+
+        // Merge the new intersections with the (sorted) intersections of all other shapes
+        std::vector<uint> merged_bin_number;
+        std::vector<uint> merged_bin_aabb_number;
+        merged_bin_number.reserve(num_bin_aabb_intersections + num_new);
+        merged_bin_aabb_number.reserve(num_bin_aabb_intersections + num_new);
+        uint j = 0;
+        for (uint k = 0; k < num_bin_aabb_intersections; k++) {
+            if (shape_rebin[bin_aabb_number[k]])
+                continue;
+            while (j < num_new && new_bin_number[j] < bin_number[k]) {
+                merged_bin_number.push_back(new_bin_number[j]);
+                merged_bin_aabb_number.push_back(new_bin_aabb_number[j]);
+                j++;
+            }
+            merged_bin_number.push_back(bin_number[k]);
+            merged_bin_aabb_number.push_back(bin_aabb_number[k]);
+        }
+        for (; j < num_new; j++) {
+            merged_bin_number.push_back(new_bin_number[j]);
+            merged_bin_aabb_number.push_back(new_bin_aabb_number[j]);
+        }
+
+        bin_number.swap(merged_bin_number);
+        bin_aabb_number.swap(merged_bin_aabb_number);
+        num_bin_aabb_intersections = (uint)bin_number.size();
+
+        // Find the active bins (keep the previous list for mapping bins to their previous index)
+        prev_bin_active.swap(bin_active);
+        prev_bin_start_index.swap(bin_start_index);
+
+        bin_active.resize(num_bin_aabb_intersections);
+        bin_start_index.resize(num_bin_aabb_intersections);
+        num_active_bins = (uint)(Run_Length_Encode(bin_number, bin_active, bin_start_index));
+
+        if (num_active_bins <= 0) {
+            num_possible_collisions = 0;
+            return;
+        }
+
+        bin_active.resize(num_active_bins);
+        bin_start_index.resize(num_active_bins + 1);
+        bin_start_index[num_active_bins] = 0;
+        Thrust_Exclusive_Scan(bin_start_index);
+
+        // Map active bins to their index in the previous list of active bins
+        bin_prev_index.resize(num_active_bins);
+        uint num_prev_active_bins = (uint)prev_bin_active.size();
+        uint p = 0;
+        for (uint i = 0; i < num_active_bins; i++) {
+            while (p < num_prev_active_bins && prev_bin_active[p] < bin_active[i])
+                p++;
+            bin_prev_index[i] = (p < num_prev_active_bins && prev_bin_active[p] == bin_active[i]) ? (int)p : -1;
+        }
+
+        ComputeExtendedStartIndex();
+    } else {
+        // Same bin-shape AABB intersections as in the previous call
+        if (num_active_bins <= 0) {
+            num_possible_collisions = 0;
+            return;
+        }
+
+        bin_prev_index.resize(num_active_bins);
+        for (uint i = 0; i < num_active_bins; i++)
+            bin_prev_index[i] = (int)i;
+    }
+
+    // Count the number of AABB-AABB intersections in each active bin -> bin_num_contact.
+    // A bin is unchanged if it still has the same number of shapes and all of them are static (a static shape cannot
+    // enter or leave a bin, so any change in the bin contents changes the number of shapes or involves a non-static
+    // shape).
+    const std::vector<uint>& prev_start_index = (num_rebin > 0) ? prev_bin_start_index : bin_start_index;
+    prev_bin_num_contact.swap(bin_num_contact);
+    prev_pair_shapeIDs.swap(pair_shapeIDs);
+
+    std::vector<char> bin_static(num_active_bins);
+    bin_num_contact.resize(num_active_bins + 1);
+    bin_num_contact[num_active_bins] = 0;
+
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_active_bins; i++) {
+        int p = bin_prev_index[i];
+        bool unchanged = (p >= 0) && (bin_start_index[i + 1] - bin_start_index[i] ==
+                                      prev_start_index[p + 1] - prev_start_index[p]);
+        for (uint k = bin_start_index[i]; unchanged && k < bin_start_index[i + 1]; k++)
+            unchanged = shape_static[bin_aabb_number[k]] != 0;
+        bin_static[i] = unchanged;
+
+        if (unchanged) {
+            bin_num_contact[i] = prev_bin_num_contact[p + 1] - prev_bin_num_contact[p];
+        } else {
+            f_Count_AABB_AABB_Intersection(i, inv_bin_size, bins_per_axis, aabb_min, aabb_max, bin_active,
+                                           bin_aabb_number, bin_start_index, fam_data, obj_active, obj_collide,
+                                           obj_data_id, bin_num_contact);
+        }
+    }
+
+    thrust::exclusive_scan(bin_num_contact.begin(), bin_num_contact.end(), bin_num_contact.begin());
+    num_possible_collisions = bin_num_contact.back();
+    pair_shapeIDs.resize(num_possible_collisions);
+
+    // Store the list of shape pairs in potential collision (copy pairs in unchanged bins)
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_active_bins; index++) {
+        if (bin_static[index]) {
+            int p = bin_prev_index[index];
+            std::copy(prev_pair_shapeIDs.begin() + prev_bin_num_contact[p],
+                      prev_pair_shapeIDs.begin() + prev_bin_num_contact[p + 1],
+                      pair_shapeIDs.begin() + bin_num_contact[index]);
+        } else {
+            f_Store_AABB_AABB_Intersection(index, inv_bin_size, bins_per_axis, aabb_min, aabb_max, bin_active,
+                                           bin_aabb_number, bin_start_index, bin_num_contact, fam_data, obj_active,
+                                           obj_collide, obj_data_id, pair_shapeIDs);
+        }
+    }
+}
+
+// Create an "extended" vector of start indices that also includes bins with no shape AABB intersections (for use in
+// ray intersection tests).
+void ChBroadphase::ComputeExtendedStartIndex() {
+    const std::vector<uint>& bin_active = cd_data->bin_active;
+    const std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+    std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
+    const uint num_bins = cd_data->num_bins;
+    const uint num_active_bins = cd_data->num_active_bins;
+
     bin_start_index_ext.resize(num_bins + 1);
 
 #pragma omp parallel for
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/multicore/ChCollisionData.h"
 
@@ -36,6 +38,20 @@ class ChApi ChBroadphase {
         FIXED_DENSITY      ///< user-specified density of shapes per bin
     };
 
+    /// Interface for an alternative implementation of the one-level grid broadphase (e.g., on a GPU device).
+    /// A backend is invoked each time the grid is constructed, with the shape AABBs already expressed relative to the
+    /// grid origin and the grid resolution and bin size set in the collision data. It must load the same data as the
+    /// default (host) implementation: the sorted bin-shape intersections (bin_number, bin_aabb_number), the active
+    /// bins (bin_active, bin_start_index), the pair offsets per active bin (bin_num_contact), the list of candidate
+    /// shape pairs (pair_shapeIDs), and the associated counters.
+    class ChApi Backend {
+      public:
+        virtual ~Backend() {}
+
+        /// Find the pairs of shapes with intersecting AABBs and load them in the collision data.
+        virtual void OneLevelBroadphase(ChCollisionData& cd_data) = 0;
+    };
+
     ChBroadphase();
 
     /// Perform broadphase collision detection.
@@ -44,6 +60,10 @@ class ChApi ChBroadphase {
 
   private:
     void OneLevelBroadphase();
+    void IncrementalBroadphase();
+    void ComputeExtendedStartIndex();
+    bool CanReuseGrid() const;
+    void SaveIncrementalState();
     void DetermineBoundingBox();
     void OffsetAABB();
     void ComputeTopLevelResolution();
@@ -57,6 +77,33 @@ class ChApi ChBroadphase {
     real3 bin_size;        ///< (input) desired bin dimensions (used for GridType::FIXED_BIN_SIZE)
     real grid_density;     ///< (input) collision grid density (used for GridType::FIXED_DENSITY)
 
+    bool incremental;  ///< (input) use incremental broadphase?
+
+    std::shared_ptr<Backend> backend;  ///< (input) alternative one-level broadphase implementation (if any)
+
+    // Data from the previous call, used by the incremental broadphase
+    bool prev_valid;                            ///< is the data from the previous call available?
+    GridType prev_grid_type;                    ///< grid type at last grid construction
+    vec3 prev_grid_resolution;                  ///< grid resolution at last grid construction
+    real3 prev_bin_size;                        ///< desired bin dimensions at last grid construction
+    real prev_grid_density;                     ///< grid density at last grid construction
+    real3 prev_min_bounding_point;              ///< grid lower corner at last grid construction
+    real3 prev_max_bounding_point;              ///< grid upper corner at last grid construction
+    uint prev_num_shapes;                       ///< number of rigid shapes
+    std::vector<real3> prev_aabb_min;           ///< shape AABB minimum points (relative to grid origin)
+    std::vector<real3> prev_aabb_max;           ///< shape AABB maximum points (relative to grid origin)
+    std::vector<uint> prev_body_id;             ///< shape body IDs
+    std::vector<short2> prev_fam;               ///< shape collision families
+    std::vector<char> prev_body_state;          ///< active/collide flags of shape bodies
+    std::vector<uint> prev_bin_active;          ///< active bins
+    std::vector<uint> prev_bin_start_index;     ///< start indices of active bins
+    std::vector<uint> prev_bin_num_contact;     ///< start indices of pairs in active bins
+    std::vector<long long> prev_pair_shapeIDs;  ///< shape pairs, grouped by active bin
+
+    std::vector<char> shape_static;   ///< shapes unchanged since the previous call
+    std::vector<char> shape_rebin;    ///< shapes with changed bin intersections since the previous call
+    std::vector<int> bin_prev_index;  ///< index of each active bin in the previous list of active bins (-1 if none)
+
     friend class ChCollisionSystemMulticore;
     friend class ChCollisionSystemChronoMulticore;
 };
@@ -56,6 +56,7 @@ struct shape_container {
     std::vector<real3> convex_rigid;     ///< points for convex hull shapes
 
     std::vector<real3> triangle_global;  ///< triangle vertices in global frame
+    std::vector<real4> sphere_global;    ///< sphere center (global frame) and radius (sphere-only fast path)
 };
 
 /// Structure of arrays containing state data.
@@ -96,6 +97,7 @@ class ChApi ChCollisionData {
           p_collision_envelope(0),
           p_kernel_radius(real(0.04)),
           p_collision_family(short2(1, 0x7FFF)),
+          p_verlet_skin(0),
           //
           bins_per_axis(vec3(10, 10, 10)),
           //
@@ -116,9 +118,12 @@ class ChApi ChCollisionData {
           ff_bins_per_axis(vec3(0)),
           //
           num_rigid_shapes(0),
+          num_rigid_spheres(0),
+          sphere_only(false),
           num_rigid_contacts(0),
           num_rigid_fluid_contacts(0),
-          num_fluid_contacts(0) {
+          num_fluid_contacts(0),
+          num_verlet_builds(0) {
         if (owns_data) {
             state_data.pos_rigid = new std::vector<real3>;
             state_data.rot_rigid = new std::vector<quaternion>;
@@ -152,6 +157,7 @@ class ChApi ChCollisionData {
     real p_collision_envelope;  ///< collision envelope for 3-dof particles
     real p_kernel_radius;       ///< 3-dof particle radius
     short2 p_collision_family;  ///< collision family and family mask for 3-dof particles
+    real p_verlet_skin;         ///< skin distance for reusing 3-dof neighbor lists across steps (0: rebuild each step)
 
     // Collision detection output data
     // -------------------------------
@@ -185,6 +191,11 @@ class ChApi ChCollisionData {
     std::vector<int> particle_indices_3dof;
     std::vector<int> reverse_mapping_3dof;
 
+    // 3dof particle Verlet lists (only used with a non-zero Verlet skin)
+    std::vector<int> verlet_3dof_3dof;    ///< [num_fluid_bodies * max_verlet_neighbors] candidate neighbors
+    std::vector<int> v_counts_3dof_3dof;  ///< [num_fluid_bodies] number of candidate neighbors
+    std::vector<real3> verlet_pos_3dof;   ///< [num_fluid_bodies] 3dof particle positions at the last list build
+
     // Broadphase Data
     vec3 bins_per_axis;               ///< number of slices along each axis of the collision detection grid
     real3 bin_size;                   ///< bin sizes in each direction
@@ -216,9 +227,12 @@ class ChApi ChCollisionData {
     // ------------------
 
     uint num_rigid_shapes;          ///< number of collision models in a system
+    uint num_rigid_spheres;         ///< number of sphere collision shapes in a system
+    bool sphere_only;               ///< use the sphere-only fast path in the current collision detection pass
     uint num_rigid_contacts;        ///< number of contacts between rigid bodies in a system
     uint num_rigid_fluid_contacts;  ///< number of contacts between rigid and fluid objects
     uint num_fluid_contacts;        ///< number of contacts between fluid objects
+    uint num_verlet_builds;         ///< number of times the 3dof particle Verlet lists were built
 };
 
 /// @} collision_mc
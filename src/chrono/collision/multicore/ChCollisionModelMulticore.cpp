@@ -20,6 +20,7 @@
 // =============================================================================
 
 #include "chrono/collision/multicore/ChCollisionModelMulticore.h"
+#include "chrono/collision/multicore/ChCollisionData.h"
 
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChBodyAuxRef.h"
@@ -32,7 +33,11 @@ CH_FACTORY_REGISTER(ChCollisionModelMulticore)
 CH_UPCASTING(ChCollisionModelMulticore, ChCollisionModelImpl)
 
 ChCollisionModelMulticore::ChCollisionModelMulticore(ChCollisionModel* collision_model)
-    : ChCollisionModelImpl(collision_model), aabb_min(C_REAL_MAX), aabb_max(-C_REAL_MAX) {
+    : ChCollisionModelImpl(collision_model),
+      aabb_min(C_REAL_MAX),
+      aabb_max(-C_REAL_MAX),
+      m_cd_data(nullptr),
+      m_shape_start(-1) {
     collision_model->SetSafeMargin(0);
 
     assert(collision_model->GetContactable());
@@ -285,4 +290,15 @@ void ChCollisionModelMulticore::SyncPosition() {
 #endif
 }
 
+void ChCollisionModelMulticore::OnFamilyChange(short int family_group, short int family_mask) {
+    // Nothing to do if this model was not yet processed by the collision system
+    if (!m_cd_data)
+        return;
+
+    // The broadphase detects the family change and re-bins the shapes of this model at the next collision detection
+    auto& fam_rigid = m_cd_data->shape_data.fam_rigid;
+    for (size_t i = 0; i < m_shapes.size(); i++)
+        fam_rigid[m_shape_start + i] = S2(family_group, family_mask);
+}
+
 }  // end namespace chrono
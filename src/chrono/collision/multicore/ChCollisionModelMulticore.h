@@ -25,6 +25,7 @@ namespace chrono {
 
 // Forward references
 class ChBody;
+class ChCollisionData;
 
 /// @addtogroup collision_mc
 /// @{
@@ -71,9 +72,12 @@ class ChApi ChCollisionModelMulticore : public ChCollisionModelImpl {
     void Populate();
 
     /// Additional operations to be performed on a change in collision family.
-    virtual void OnFamilyChange(short int family_group, short int family_mask) override {}
+    /// Updates in place the family information of the shapes of this model in the collision system data.
+    virtual void OnFamilyChange(short int family_group, short int family_mask) override;
 
     ChBody* mbody;                                               ///< associated contactable (rigid body only)
+    ChCollisionData* m_cd_data;                                  ///< collision system data (set when added)
+    int m_shape_start;                                           ///< index of first shape in collision system data
     std::vector<std::shared_ptr<ctCollisionShape>> m_ct_shapes;  ///< list of Chrono collision shapes in model
     std::vector<std::shared_ptr<ChCollisionShape>> m_shapes;     ///< extended list of collision shapes
 
@@ -17,6 +17,8 @@
 //
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/physics/ChSystem.h"
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChParticleCloud.h"
@@ -30,7 +32,7 @@ namespace chrono {
 CH_FACTORY_REGISTER(ChCollisionSystemMulticore)
 CH_UPCASTING(ChCollisionSystemMulticore, ChCollisionSystem)
 
-ChCollisionSystemMulticore::ChCollisionSystemMulticore() : use_aabb_active(false) {
+ChCollisionSystemMulticore::ChCollisionSystemMulticore() : use_aabb_active(false), use_sphere_fast_path(true) {
     // Create the shared data structure with own state data
     cd_data = chrono_types::make_shared<ChCollisionData>(true);
     cd_data->collision_envelope = ChCollisionModel::GetDefaultSuggestedEnvelope();
@@ -62,10 +64,26 @@ void ChCollisionSystemMulticore::SetBroadphaseGridDensity(double density) {
     broadphase.grid_type = ChBroadphase::GridType::FIXED_DENSITY;
 }
 
+void ChCollisionSystemMulticore::EnableIncrementalBroadphase(bool val) {
+    broadphase.incremental = val;
+}
+
+void ChCollisionSystemMulticore::SetBroadphaseBackend(std::shared_ptr<ChBroadphase::Backend> backend) {
+    broadphase.backend = backend;
+}
+
 void ChCollisionSystemMulticore::SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm) {
     narrowphase.algorithm = algorithm;
 }
 
+void ChCollisionSystemMulticore::EnableBatchedNarrowphase(bool val) {
+    narrowphase.batched = val;
+}
+
+void ChCollisionSystemMulticore::EnableSphereFastPath(bool val) {
+    use_sphere_fast_path = val;
+}
+
 void ChCollisionSystemMulticore::EnableActiveBoundingBox(const ChVector3d& aabb_min, const ChVector3d& aabb_max) {
     active_aabb_min = FromChVector(aabb_min);
     active_aabb_max = FromChVector(aabb_max);
@@ -101,6 +119,10 @@ void ChCollisionSystemMulticore::Add(std::shared_ptr<ChCollisionModel> model) {
     // Shape index in the collision model
     int local_shape_index = 0;
 
+    // Record the location of the model shapes in the collision system data (for in-place family changes)
+    ct_model->m_cd_data = cd_data.get();
+    ct_model->m_shape_start = (int)shape_data.fam_rigid.size();
+
     // Traverse all collision shapes in the model
     auto num_shapes = ct_model->m_shapes.size();
     assert(num_shapes == ct_model->m_ct_shapes.size());
@@ -143,7 +165,7 @@ void ChCollisionSystemMulticore::Add(std::shared_ptr<ChCollisionModel> model) {
                 break;
             case ChCollisionShape::Type::CAPSULE:
                 start = (int)shape_data.capsule_rigid.size();
-                shape_data.capsule_rigid.push_back(real2(obB.x, obB.y));
+                shape_data.capsule_rigid.push_back(real2(obB.x, obB.z));
                 break;
             case ChCollisionShape::Type::ROUNDEDBOX:
                 start = (int)shape_data.rbox_like_rigid.size();
@@ -178,6 +200,8 @@ void ChCollisionSystemMulticore::Add(std::shared_ptr<ChCollisionModel> model) {
         shape_data.id_rigid.push_back(body_id);
         shape_data.local_rigid.push_back(local_shape_index);
         cd_data->num_rigid_shapes++;
+        if (type == ChCollisionShape::Type::SPHERE)
+            cd_data->num_rigid_spheres++;
         local_shape_index++;
     }
 
@@ -301,11 +325,20 @@ void ChCollisionSystemMulticore::Run() {
         }
     }
 
+    // The sphere-only fast path requires that all rigid shapes are spheres and that there are no 3-dof particles
+    cd_data->sphere_only = use_sphere_fast_path && cd_data->num_rigid_shapes > 0 &&
+                           cd_data->num_rigid_spheres == cd_data->num_rigid_shapes &&
+                           cd_data->state_data.num_fluid_bodies == 0 &&
+                           narrowphase.algorithm != ChNarrowphase::Algorithm::MPR;
+
     // Broadphase
     {
         CH_PROFILE("Broad-phase");
         m_timer_broad.start();
-        GenerateAABB();
+        if (cd_data->sphere_only)
+            GenerateAABBSpheres();
+        else
+            GenerateAABB();
         broadphase.Process();
         m_timer_broad.stop();
     }
@@ -328,6 +361,8 @@ void ChCollisionSystemMulticore::ReportContacts(ChContactContainer* container) {
     // NOTE: important to do this here, to set size to zero if no contacts (in case some other added by a custom user
     // callback)
     container->BeginAddContact();
+    if (contact_reduction)
+        contact_reduction->Reset();
 
     const auto& bids = cd_data->bids_rigid_rigid;          // global IDs of bodies in contact
     const auto& sids = cd_data->contact_shapeIDs;          // global IDs of shapes in contact
@@ -362,10 +397,16 @@ void ChCollisionSystemMulticore::ReportContacts(ChContactContainer* container) {
         if (this->narrow_callback)
             add_contact = this->narrow_callback->OnNarrowphase(cinfo);
 
-        if (add_contact)
-            container->AddContact(cinfo);
+        if (add_contact) {
+            if (contact_reduction)
+                contact_reduction->AddContact(cinfo);
+            else
+                container->AddContact(cinfo);
+        }
     }
 
+    if (contact_reduction)
+        contact_reduction->ReportContacts(container);
     container->EndAddContact();
 }
 
@@ -509,7 +550,7 @@ void ChCollisionSystemMulticore::GenerateAABB() {
 
             } else if (type == ChCollisionShape::Type::CAPSULE) {
                 real2 T = cd_data->shape_data.capsule_rigid[start];
-                real3 B = real3(T.x, T.x + T.y, T.x) + envelope;
+                real3 B = real3(T.x, T.x, T.x + T.y) + envelope;
                 ComputeAABBBox(B, local_pos, position, rotation, body_rot[id], temp_min, temp_max);
 
             } else if (type == ChCollisionShape::Type::CONVEXHULL) {
@@ -542,6 +583,43 @@ void ChCollisionSystemMulticore::GenerateAABB() {
     }
 }
 
+// Generate sphere centers (in the global frame) and AABBs for a system with only sphere shapes.
+// Note that spheres are invariant to rotation, so only the shape position is transformed.
+void ChCollisionSystemMulticore::GenerateAABBSpheres() {
+    const real envelope = cd_data->collision_envelope;
+    const std::vector<int>& start_rigid = cd_data->shape_data.start_rigid;
+    const std::vector<uint>& id_rigid = cd_data->shape_data.id_rigid;
+    const std::vector<real3>& obj_data_A = cd_data->shape_data.ObA_rigid;
+    const std::vector<real>& sphere_rigid = cd_data->shape_data.sphere_rigid;
+
+    const std::vector<real3>& pos_rigid = *cd_data->state_data.pos_rigid;
+    const std::vector<quaternion>& body_rot = *cd_data->state_data.rot_rigid;
+
+    const uint num_rigid_shapes = cd_data->num_rigid_shapes;
+
+    std::vector<real4>& sphere_global = cd_data->shape_data.sphere_global;
+    std::vector<real3>& aabb_min = cd_data->aabb_min;
+    std::vector<real3>& aabb_max = cd_data->aabb_max;
+
+    sphere_global.resize(num_rigid_shapes);
+    aabb_min.resize(num_rigid_shapes);
+    aabb_max.resize(num_rigid_shapes);
+
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_rigid_shapes; index++) {
+        uint id = id_rigid[index];
+        if (id == UINT_MAX)
+            continue;
+
+        real3 center = Rotate(obj_data_A[index], body_rot[id]) + pos_rigid[id];
+        real radius = sphere_rigid[start_rigid[index]];
+
+        sphere_global[index] = real4(center, radius);
+        aabb_min[index] = center - (radius + envelope);
+        aabb_max[index] = center + (radius + envelope);
+    }
+}
+
 void ChCollisionSystemMulticore::GetOverlappingAABB(std::vector<char>& active_id, real3 Amin, real3 Amax) {
     GenerateAABB();
 
@@ -577,25 +655,90 @@ bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from, const ChVector3d
     }
 
     ChRayTest tester(cd_data);
+    return RayHit(tester, from, to, result);
+}
+
+// Set the ray-hit result from the ray test info.
+static void SetRayHitResult(bool hit,
+                            const ChRayTest::RayHitInfo& info,
+                            const ChCollisionData& cd_data,
+                            ChSystem* system,
+                            ChCollisionSystem::ChRayhitResult& result) {
+    result.hit = hit;
+    if (!hit)
+        return;
+
+    // Hit point
+    result.abs_hitNormal = ToChVector(info.normal);
+    result.abs_hitPoint = ToChVector(info.point);
+    result.dist_factor = info.t;
+
+    // ID of the body carring the closest hit shape
+    uint bid = cd_data.shape_data.id_rigid[info.shapeID];
+
+    // Collision model of hit body
+    result.hitModel = system->GetBodies()[bid]->GetCollisionModel().get();
+}
+
+bool ChCollisionSystemMulticore::RayHit(ChRayTest& tester,
+                                        const ChVector3d& from,
+                                        const ChVector3d& to,
+                                        ChRayhitResult& result) const {
     ChRayTest::RayHitInfo info;
-    if (tester.Check(FromChVector(from), FromChVector(to), info)) {
-        // Hit point
-        result.hit = true;
-        result.abs_hitNormal = ToChVector(info.normal);
-        result.abs_hitPoint = ToChVector(info.point);
-        result.dist_factor = info.t;
+    bool hit = tester.Check(FromChVector(from), FromChVector(to), info);
+    SetRayHitResult(hit, info, *cd_data, m_system, result);
+    return hit;
+}
+
+int ChCollisionSystemMulticore::RayHitPacket(ChRayTest& tester,
+                                             int num_rays,
+                                             const ChRay* rays,
+                                             ChRayhitResult* results) const {
+    real3 start[ChRayTest::PACKET_SIZE];
+    real3 end[ChRayTest::PACKET_SIZE];
+    ChRayTest::RayHitInfo info[ChRayTest::PACKET_SIZE];
+    bool hit[ChRayTest::PACKET_SIZE];
+
+    for (int i = 0; i < num_rays; i++) {
+        start[i] = FromChVector(rays[i].from);
+        end[i] = FromChVector(rays[i].to);
+    }
+
+    int num_hits = tester.CheckPacket(num_rays, start, end, info, hit);
+
+    for (int i = 0; i < num_rays; i++)
+        SetRayHitResult(hit[i], info[i], *cd_data, m_system, results[i]);
+
+    return num_hits;
+}
 
-        // ID of the body carring the closest hit shape
-        uint bid = cd_data->shape_data.id_rigid[info.shapeID];
+int ChCollisionSystemMulticore::RayHitBatch(const std::vector<ChRay>& rays,
+                                            std::vector<ChRayhitResult>& results) const {
+    int num_rays = (int)rays.size();
+    results.resize(num_rays);
 
-        // Collision model of hit body
-        result.hitModel = m_system->GetBodies()[bid]->GetCollisionModel().get();
+    if (cd_data->num_active_bins == 0) {
+        for (auto& result : results)
+            result.hit = false;
+        return 0;
+    }
 
-        return true;
+    int num_hits = 0;
+    int num_packets = (num_rays + ChRayTest::PACKET_SIZE - 1) / ChRayTest::PACKET_SIZE;
+
+#pragma omp parallel reduction(+ : num_hits)
+    {
+        ChRayTest tester(cd_data);
+
+#pragma omp for schedule(static)
+        for (int i = 0; i < num_packets; i++) {
+            int first = i * ChRayTest::PACKET_SIZE;
+            int size = std::min(num_rays - first, (int)ChRayTest::PACKET_SIZE);
+            num_hits += RayHitPacket(tester, size, &rays[first], &results[first]);
+        }
     }
 
-    result.hit = false;
-    return false;
+    return num_hits;
 }
 
 bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from,
@@ -35,6 +35,7 @@ namespace chrono {
 // forward references
 class ChAssembly;
 class ChParticleCloud;
+class ChRayTest;
 
 /// @addtogroup collision_mc
 /// @{
@@ -50,6 +51,9 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     /// if any (like persistent contact manifolds)
     virtual void Clear() override;
 
+    /// Return the type of this collision system.
+    virtual Type GetType() const override { return Type::MULTICORE; }
+
     /// Add the specified collision model to the collision engine.
     virtual void Add(std::shared_ptr<ChCollisionModel> model) override;
 
@@ -77,12 +81,38 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     /// By default, a fixed number of bins is used (see SetBroadphaseGridResolution).
     void SetBroadphaseGridDensity(double density);
 
+    /// Enable/disable the incremental broadphase (default: false).
+    /// If enabled, the broadphase grid is kept from one call to the next, as long as it contains all collision shapes
+    /// (the grid is otherwise reconstructed, slightly inflated). Only shapes whose AABB intersects a different set of
+    /// bins are re-binned, and candidate pairs in bins where nothing changed are reused from the previous call. This is
+    /// beneficial for systems where most shapes are at rest (e.g., settled granular material).
+    void EnableIncrementalBroadphase(bool val);
+
+    /// Set an alternative implementation of the one-level grid broadphase (default: none).
+    /// If set, the backend is used instead of the host implementation whenever the broadphase grid is constructed
+    /// (e.g., ChBroadphaseGPU in Chrono::Multicore runs it on a CUDA device). With the incremental broadphase enabled,
+    /// updates of a reused grid still run on the host. Pass an empty pointer to revert to the host implementation.
+    void SetBroadphaseBackend(std::shared_ptr<ChBroadphase::Backend> backend);
+
     /// Set the narrowphase algorithm (default: ChNarrowphase::Algorithm::HYBRID).
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
     /// Minkovski Portal Refinement algorithm (see ChNarrowphaseMPR).
     void SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm);
 
+    /// Enable/disable batched processing of sphere-sphere and box-sphere pairs in the narrowphase (default: true).
+    /// If enabled, candidate pairs of these shape types are grouped and evaluated in batches, with loops that the
+    /// compiler can vectorize; all other pairs are processed one at a time. Used only with the PRIMS and HYBRID
+    /// narrowphase algorithms.
+    void EnableBatchedNarrowphase(bool val);
+
+    /// Enable/disable the sphere-only fast path (default: true).
+    /// If enabled and all rigid collision shapes are spheres (and there are no 3-dof particles), the shape AABBs are
+    /// generated directly from compact arrays of sphere centers and radii and all candidate pairs are processed with
+    /// the analytical sphere-sphere test in batches, bypassing the per-pair shape type dispatch. Used only with the
+    /// PRIMS and HYBRID narrowphase algorithms.
+    void EnableSphereFastPath(bool val);
+
     /// Enable monitoring of shapes outside active bounding box (default: false).
     /// If enabled, objects whose collision shapes exit the active bounding box are deactivated (frozen).
     /// The size of the bounding box is specified by its min and max extents.
@@ -136,6 +166,12 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform ray-hit tests with all collision models for a batch of rays.
+    /// Consecutive rays are grouped in packets (see ChRayTest::CheckPacket) which traverse the broadphase grid
+    /// together; the packets are distributed over the OpenMP threads. For best performance, consecutive rays in the
+    /// batch should be coherent (e.g., neighboring rays of a sensor scan).
+    virtual int RayHitBatch(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const override;
+
     /// Method to trigger debug visualization of collision shapes.
     /// The 'flags' argument can be any of the VisualizationModes enums, or a combination thereof (using bit-wise
     /// operators). The calling program must invoke this function from within the simulation loop. No-op if a
@@ -158,6 +194,9 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     /// Generate the current axis-aligned bounding boxes of collision shapes.
     void GenerateAABB();
 
+    /// Generate the current sphere centers and axis-aligned bounding boxes in a system with only sphere shapes.
+    void GenerateAABBSpheres();
+
     /// Visualize collision shapes (wireframe).
     void VisualizeShapes();
 
@@ -167,6 +206,12 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     /// Visualize contact points and normals.
     void VisualizeContacts();
 
+    /// Perform a ray-hit test with all collision models, using the provided ray tester.
+    bool RayHit(ChRayTest& tester, const ChVector3d& from, const ChVector3d& to, ChRayhitResult& result) const;
+
+    /// Perform ray-hit tests with all collision models for a packet of rays, using the provided ray tester.
+    int RayHitPacket(ChRayTest& tester, int num_rays, const ChRay* rays, ChRayhitResult* results) const;
+
     std::vector<std::shared_ptr<ChCollisionModelMulticore>> ct_models;
 
     std::shared_ptr<ChCollisionData> cd_data;
@@ -176,9 +221,10 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
 
     std::vector<char> body_active;
 
-    bool use_aabb_active;   ///< enable freezing of objects outside the active bounding box
-    real3 active_aabb_min;  ///< lower corner of active bounding box
-    real3 active_aabb_max;  ///< upper corner of active bounding box
+    bool use_aabb_active;       ///< enable freezing of objects outside the active bounding box
+    bool use_sphere_fast_path;  ///< enable the sphere-only fast path
+    real3 active_aabb_min;      ///< lower corner of active bounding box
+    real3 active_aabb_max;      ///< upper corner of active bounding box
 
     ChTimer m_timer_broad;
     ChTimer m_timer_narrow;
@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <numeric>
 
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/ChCollisionInfo.h"
@@ -36,11 +37,12 @@ namespace chrono {
 using namespace chrono::mc_utils;
 
 ChNarrowphase::ChNarrowphase()
-    : algorithm(Algorithm::HYBRID),
+    : cd_data(nullptr),
       num_potential_rigid_contacts(0),
       num_potential_fluid_contacts(0),
       num_potential_rigid_fluid_contacts(0),
-      cd_data(nullptr) {}
+      algorithm(Algorithm::HYBRID),
+      batched(true) {}
 
 void ChNarrowphase::ClearContacts() {
     // Return now if no potential collisions.
@@ -74,7 +76,10 @@ void ChNarrowphase::ProcessRigids() {
     ClearContacts();
 
     // Transform Rigid body shapes to global coordinate system
-    PreprocessLocalToParent();
+    if (cd_data->sphere_only)
+        PreprocessSpheres();
+    else
+        PreprocessLocalToParent();
 
     if (num_potential_rigid_contacts != 0) {
         ProcessRigidRigid();
@@ -192,6 +197,37 @@ void ChNarrowphase::PreprocessLocalToParent() {
     }
 }
 
+int ChNarrowphase::PreprocessCountSpheres() {
+    // Each sphere-sphere pair produces at most one contact
+    contact_index.resize(num_potential_rigid_contacts + 1);
+    std::iota(contact_index.begin(), contact_index.end(), 0);
+    cd_data->contact_shapeIDs = cd_data->pair_shapeIDs;
+    return (int)num_potential_rigid_contacts;
+}
+
+void ChNarrowphase::PreprocessSpheres() {
+    // The sphere centers were already calculated with the shape AABBs
+    uint num_shapes = cd_data->num_rigid_shapes;
+
+    const std::vector<quaternion>& obj_data_R = cd_data->shape_data.ObR_rigid;
+    const std::vector<uint>& obj_data_ID = cd_data->shape_data.id_rigid;
+    const std::vector<real4>& sphere_global = cd_data->shape_data.sphere_global;
+    const std::vector<quaternion>& body_rot = *cd_data->state_data.rot_rigid;
+
+    cd_data->shape_data.obj_data_A_global.resize(num_shapes);
+    cd_data->shape_data.obj_data_R_global.resize(num_shapes);
+
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_shapes; index++) {
+        uint ID = obj_data_ID[index];
+        if (ID == UINT_MAX)
+            continue;
+        const real4& sphere = sphere_global[index];
+        cd_data->shape_data.obj_data_A_global[index] = real3(sphere.x, sphere.y, sphere.z);
+        cd_data->shape_data.obj_data_R_global[index] = Mult(body_rot[ID], obj_data_R[index]);
+    }
+}
+
 // -----------------------------------------------------------------------------
 
 void ChNarrowphase::Dispatch_Init(uint index,
@@ -268,8 +304,11 @@ void ChNarrowphase::DispatchPRIMS() {
     ConvexShape shapeA;
     ConvexShape shapeB;
 
+    int num_pairs = batched ? (int)generic_pairs.size() : (int)num_potential_rigid_contacts;
+
 #pragma omp parallel for private(shapeA, shapeB)
-    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+    for (int k = 0; k < num_pairs; k++) {
+        uint index = batched ? generic_pairs[k] : k;
         uint ID_A, ID_B, icoll;
 
         int nC;
@@ -296,8 +335,11 @@ void ChNarrowphase::DispatchHybridMPR() {
 
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
+    int num_pairs = batched ? (int)generic_pairs.size() : (int)num_potential_rigid_contacts;
+
 #pragma omp parallel for private(shapeA, shapeB)
-    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+    for (int k = 0; k < num_pairs; k++) {
+        uint index = batched ? generic_pairs[k] : k;
         uint ID_A, ID_B, icoll;
 
         int nC;
@@ -318,6 +360,306 @@ void ChNarrowphase::DispatchHybridMPR() {
 
 // -----------------------------------------------------------------------------
 
+// Rotate the vector v by the quaternion q (same operations as Rotate, on individual components).
+static inline void RotateComponents(real qw,
+                                    real qx,
+                                    real qy,
+                                    real qz,
+                                    real vx,
+                                    real vy,
+                                    real vz,
+                                    real& rx,
+                                    real& ry,
+                                    real& rz) {
+    real tx = 2 * (qy * vz - qz * vy);
+    real ty = 2 * (qz * vx - qx * vz);
+    real tz = 2 * (qx * vy - qy * vx);
+    rx = vx + qw * tx + (qy * tz - qz * ty);
+    ry = vy + qw * ty + (qz * tx - qx * tz);
+    rz = vz + qw * tz + (qx * ty - qy * tx);
+}
+
+// Evaluate a batch of sphere-sphere pairs given in structure-of-arrays form.
+static inline void SphereSphereBatch(uint count,
+                                     real separation,
+                                     const real* x1,
+                                     const real* y1,
+                                     const real* z1,
+                                     const real* r1,
+                                     const real* x2,
+                                     const real* y2,
+                                     const real* z2,
+                                     const real* r2,
+                                     real* nx,
+                                     real* ny,
+                                     real* nz,
+                                     real* depth,
+                                     real* erad,
+                                     char* hit) {
+#pragma omp simd
+    for (uint k = 0; k < count; k++) {
+        real dx = x2[k] - x1[k];
+        real dy = y2[k] - y1[k];
+        real dz = z2[k] - z1[k];
+        real dist2 = dx * dx + dy * dy + dz * dz;
+        real radSum = r1[k] + r2[k];
+        real radSum_s = radSum + separation;
+        hit[k] = (dist2 < radSum_s * radSum_s && dist2 >= 1e-12);
+        real dist = Sqrt(hit[k] ? dist2 : real(1));
+        nx[k] = dx / dist;
+        ny[k] = dy / dist;
+        nz[k] = dz / dist;
+        depth[k] = dist - radSum;
+        erad[k] = r1[k] * r2[k] / radSum;
+    }
+}
+
+void ChNarrowphase::DispatchBatched() {
+    const shape_type* obj_data_T = cd_data->shape_data.typ_rigid.data();
+    const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+
+    // Sort the candidate pairs by shape-type combination
+    ss_pairs.clear();
+    bs_pairs.clear();
+    generic_pairs.clear();
+    for (uint index = 0; index < num_potential_rigid_contacts; index++) {
+        shape_type type1 = obj_data_T[int(pair_shapeIDs[index] >> 32)];
+        shape_type type2 = obj_data_T[int(pair_shapeIDs[index] & 0xffffffff)];
+        if (type1 == ChCollisionShape::Type::SPHERE && type2 == ChCollisionShape::Type::SPHERE)
+            ss_pairs.push_back(index);
+        else if ((type1 == ChCollisionShape::Type::BOX && type2 == ChCollisionShape::Type::SPHERE) ||
+                 (type1 == ChCollisionShape::Type::SPHERE && type2 == ChCollisionShape::Type::BOX))
+            bs_pairs.push_back(index);
+        else
+            generic_pairs.push_back(index);
+    }
+
+    int num_ss_batches = ((int)ss_pairs.size() + batch_size - 1) / batch_size;
+    int num_bs_batches = ((int)bs_pairs.size() + batch_size - 1) / batch_size;
+
+#pragma omp parallel for
+    for (int b = 0; b < num_ss_batches; b++) {
+        uint start = b * batch_size;
+        DispatchSphereSphereBatch(start, std::min((uint)batch_size, (uint)ss_pairs.size() - start));
+    }
+
+#pragma omp parallel for
+    for (int b = 0; b < num_bs_batches; b++) {
+        uint start = b * batch_size;
+        DispatchBoxSphereBatch(start, std::min((uint)batch_size, (uint)bs_pairs.size() - start));
+    }
+}
+
+// Process 'count' sphere-sphere pairs from ss_pairs, starting at 'start' (see sphere_sphere in ChNarrowphasePRIMS).
+void ChNarrowphase::DispatchSphereSphereBatch(uint start, uint count) {
+    const shape_container& shape_data = cd_data->shape_data;
+    const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+    const real separation = 2 * cd_data->collision_envelope;
+
+    real x1[batch_size], y1[batch_size], z1[batch_size], r1[batch_size];
+    real x2[batch_size], y2[batch_size], z2[batch_size], r2[batch_size];
+    real nx[batch_size], ny[batch_size], nz[batch_size], depth[batch_size], erad[batch_size];
+    char hit[batch_size];
+
+    // Gather shape data
+    for (uint k = 0; k < count; k++) {
+        long long p = pair_shapeIDs[ss_pairs[start + k]];
+        int sA = int(p >> 32);
+        int sB = int(p & 0xffffffff);
+        const real3& posA = shape_data.obj_data_A_global[sA];
+        const real3& posB = shape_data.obj_data_A_global[sB];
+        x1[k] = posA.x;
+        y1[k] = posA.y;
+        z1[k] = posA.z;
+        r1[k] = shape_data.sphere_rigid[shape_data.start_rigid[sA]];
+        x2[k] = posB.x;
+        y2[k] = posB.y;
+        z2[k] = posB.z;
+        r2[k] = shape_data.sphere_rigid[shape_data.start_rigid[sB]];
+    }
+
+    // Evaluate all pairs in the batch
+    SphereSphereBatch(count, separation, x1, y1, z1, r1, x2, y2, z2, r2, nx, ny, nz, depth, erad, hit);
+
+    // Scatter contact data
+    for (uint k = 0; k < count; k++) {
+        if (!hit[k])
+            continue;
+        uint ID_A, ID_B, icoll;
+        ConvexShape shapeA, shapeB;
+        Dispatch_Init(ss_pairs[start + k], icoll, ID_A, ID_B, &shapeA, &shapeB);
+        real3 norm(nx[k], ny[k], nz[k]);
+        cd_data->norm_rigid_rigid[icoll] = norm;
+        cd_data->cpta_rigid_rigid[icoll] = real3(x1[k], y1[k], z1[k]) + norm * r1[k];
+        cd_data->cptb_rigid_rigid[icoll] = real3(x2[k], y2[k], z2[k]) - norm * r2[k];
+        cd_data->dpth_rigid_rigid[icoll] = depth[k];
+        cd_data->erad_rigid_rigid[icoll] = erad[k];
+        Dispatch_Finalize(icoll, ID_A, ID_B, 1);
+    }
+}
+
+// Process all candidate pairs in a system with only sphere shapes. Pairs are processed in batches of consecutive
+// candidate pairs, with the sphere data read from the compact sphere_global array and one potential contact per pair.
+void ChNarrowphase::DispatchSphereOnly() {
+    const std::vector<real4>& sphere_global = cd_data->shape_data.sphere_global;
+    const std::vector<uint>& obj_data_ID = cd_data->shape_data.id_rigid;
+    const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+    const real separation = 2 * cd_data->collision_envelope;
+
+    int num_batches = ((int)num_potential_rigid_contacts + batch_size - 1) / batch_size;
+
+#pragma omp parallel for
+    for (int b = 0; b < num_batches; b++) {
+        uint start = b * batch_size;
+        uint count = std::min((uint)batch_size, num_potential_rigid_contacts - start);
+
+        real x1[batch_size], y1[batch_size], z1[batch_size], r1[batch_size];
+        real x2[batch_size], y2[batch_size], z2[batch_size], r2[batch_size];
+        real nx[batch_size], ny[batch_size], nz[batch_size], depth[batch_size], erad[batch_size];
+        char hit[batch_size];
+
+        // Gather sphere data
+        for (uint k = 0; k < count; k++) {
+            long long p = pair_shapeIDs[start + k];
+            const real4& sA = sphere_global[int(p >> 32)];
+            const real4& sB = sphere_global[int(p & 0xffffffff)];
+            x1[k] = sA.x;
+            y1[k] = sA.y;
+            z1[k] = sA.z;
+            r1[k] = sA.w;
+            x2[k] = sB.x;
+            y2[k] = sB.y;
+            z2[k] = sB.z;
+            r2[k] = sB.w;
+        }
+
+        // Evaluate all pairs in the batch
+        SphereSphereBatch(count, separation, x1, y1, z1, r1, x2, y2, z2, r2, nx, ny, nz, depth, erad, hit);
+
+        // Scatter contact data (the potential contact of a pair has the same index as the pair)
+        for (uint k = 0; k < count; k++) {
+            if (!hit[k])
+                continue;
+            uint icoll = start + k;
+            long long p = pair_shapeIDs[icoll];
+            real3 norm(nx[k], ny[k], nz[k]);
+            cd_data->norm_rigid_rigid[icoll] = norm;
+            cd_data->cpta_rigid_rigid[icoll] = real3(x1[k], y1[k], z1[k]) + norm * r1[k];
+            cd_data->cptb_rigid_rigid[icoll] = real3(x2[k], y2[k], z2[k]) - norm * r2[k];
+            cd_data->dpth_rigid_rigid[icoll] = depth[k];
+            cd_data->erad_rigid_rigid[icoll] = erad[k];
+            Dispatch_Finalize(icoll, obj_data_ID[int(p >> 32)], obj_data_ID[int(p & 0xffffffff)], 1);
+        }
+    }
+}
+
+// Process 'count' box-sphere pairs from bs_pairs, starting at 'start' (see box_sphere in ChNarrowphasePRIMS).
+void ChNarrowphase::DispatchBoxSphereBatch(uint start, uint count) {
+    const shape_container& shape_data = cd_data->shape_data;
+    const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+    const real separation = 2 * cd_data->collision_envelope;
+    const real edge_radius = GetDefaultEdgeRadius();
+
+    real px[batch_size], py[batch_size], pz[batch_size];
+    real qw[batch_size], qx[batch_size], qy[batch_size], qz[batch_size];
+    real hx[batch_size], hy[batch_size], hz[batch_size];
+    real sx[batch_size], sy[batch_size], sz[batch_size], r[batch_size];
+    real nx[batch_size], ny[batch_size], nz[batch_size];
+    real bx[batch_size], by[batch_size], bz[batch_size];
+    real depth[batch_size], erad[batch_size];
+    char hit[batch_size];
+    char swapped[batch_size];
+
+    // Gather shape data (box first)
+    for (uint k = 0; k < count; k++) {
+        long long p = pair_shapeIDs[bs_pairs[start + k]];
+        int sA = int(p >> 32);
+        int sB = int(p & 0xffffffff);
+        swapped[k] = (shape_data.typ_rigid[sA] == ChCollisionShape::Type::SPHERE);
+        int box = swapped[k] ? sB : sA;
+        int sphere = swapped[k] ? sA : sB;
+        const real3& posB = shape_data.obj_data_A_global[box];
+        const quaternion& rotB = shape_data.obj_data_R_global[box];
+        const real3& hdims = shape_data.box_like_rigid[shape_data.start_rigid[box]];
+        const real3& posS = shape_data.obj_data_A_global[sphere];
+        px[k] = posB.x;
+        py[k] = posB.y;
+        pz[k] = posB.z;
+        qw[k] = rotB.w;
+        qx[k] = rotB.x;
+        qy[k] = rotB.y;
+        qz[k] = rotB.z;
+        hx[k] = hdims.x;
+        hy[k] = hdims.y;
+        hz[k] = hdims.z;
+        sx[k] = posS.x;
+        sy[k] = posS.y;
+        sz[k] = posS.z;
+        r[k] = shape_data.sphere_rigid[shape_data.start_rigid[sphere]];
+    }
+
+    // Evaluate all pairs in the batch
+#pragma omp simd
+    for (uint k = 0; k < count; k++) {
+        // Sphere position in the box frame
+        real lx, ly, lz;
+        RotateComponents(qw[k], -qx[k], -qy[k], -qz[k], sx[k] - px[k], sy[k] - py[k], sz[k] - pz[k], lx, ly, lz);
+
+        // Snap to the box surface
+        bool cx = Abs(lx) > hx[k];
+        bool cy = Abs(ly) > hy[k];
+        bool cz = Abs(lz) > hz[k];
+        real bxl = cx ? ((lx > 0) ? hx[k] : -hx[k]) : lx;
+        real byl = cy ? ((ly > 0) ? hy[k] : -hy[k]) : ly;
+        real bzl = cz ? ((lz > 0) ? hz[k] : -hz[k]) : lz;
+
+        real dx = lx - bxl;
+        real dy = ly - byl;
+        real dz = lz - bzl;
+        real dist2 = dx * dx + dy * dy + dz * dz;
+        real radius_s = r[k] + separation;
+        hit[k] = (dist2 < radius_s * radius_s && dist2 > 1e-12f);
+        real dist = Sqrt(hit[k] ? dist2 : real(1));
+        depth[k] = dist - r[k];
+
+        RotateComponents(qw[k], qx[k], qy[k], qz[k], dx / dist, dy / dist, dz / dist, nx[k], ny[k], nz[k]);
+        RotateComponents(qw[k], qx[k], qy[k], qz[k], bxl, byl, bzl, bx[k], by[k], bz[k]);
+        bx[k] += px[k];
+        by[k] += py[k];
+        bz[k] += pz[k];
+
+        // Face contact if snapped along exactly one direction
+        bool face = (int(cx) + int(cy) + int(cz)) == 1;
+        erad[k] = face ? r[k] : r[k] * edge_radius / (r[k] + edge_radius);
+    }
+
+    // Scatter contact data (normal from the sphere to the box, or reversed if the sphere is the first shape)
+    for (uint k = 0; k < count; k++) {
+        if (!hit[k])
+            continue;
+        uint ID_A, ID_B, icoll;
+        ConvexShape shapeA, shapeB;
+        Dispatch_Init(bs_pairs[start + k], icoll, ID_A, ID_B, &shapeA, &shapeB);
+        real3 norm(nx[k], ny[k], nz[k]);
+        real3 pt_box(bx[k], by[k], bz[k]);
+        real3 pt_sphere = real3(sx[k], sy[k], sz[k]) - norm * r[k];
+        if (swapped[k]) {
+            cd_data->norm_rigid_rigid[icoll] = -norm;
+            cd_data->cpta_rigid_rigid[icoll] = pt_sphere;
+            cd_data->cptb_rigid_rigid[icoll] = pt_box;
+        } else {
+            cd_data->norm_rigid_rigid[icoll] = norm;
+            cd_data->cpta_rigid_rigid[icoll] = pt_box;
+            cd_data->cptb_rigid_rigid[icoll] = pt_sphere;
+        }
+        cd_data->dpth_rigid_rigid[icoll] = depth[k];
+        cd_data->erad_rigid_rigid[icoll] = erad[k];
+        Dispatch_Finalize(icoll, ID_A, ID_B, 1);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
 void ChNarrowphase::ProcessRigidRigid() {
     std::vector<real3>& norm_data = cd_data->norm_rigid_rigid;
     std::vector<real3>& cpta_data = cd_data->cpta_rigid_rigid;
@@ -331,7 +673,7 @@ void ChNarrowphase::ProcessRigidRigid() {
     // Set maximum possible number of contacts for each potential collision
     // (depending on the narrowphase algorithm and on the types of shapes in
     // potential collision) and calculate the total number of potential contacts.
-    int num_potentialContacts = PreprocessCount();
+    int num_potentialContacts = cd_data->sphere_only ? PreprocessCountSpheres() : PreprocessCount();
 
     // Create storage to hold maximum number of contacts in worse case
     norm_data.resize(num_potentialContacts);
@@ -346,16 +688,24 @@ void ChNarrowphase::ProcessRigidRigid() {
     contact_rigid_active.resize(num_potentialContacts);
     thrust::fill(contact_rigid_active.begin(), contact_rigid_active.end(), false);
 
-    switch (algorithm) {
-        case Algorithm::MPR:
-            DispatchMPR();
-            break;
-        case Algorithm::PRIMS:
-            DispatchPRIMS();
-            break;
-        case Algorithm::HYBRID:
-            DispatchHybridMPR();
-            break;
+    if (cd_data->sphere_only) {
+        DispatchSphereOnly();
+    } else {
+        switch (algorithm) {
+            case Algorithm::MPR:
+                DispatchMPR();
+                break;
+            case Algorithm::PRIMS:
+                if (batched)
+                    DispatchBatched();
+                DispatchPRIMS();
+                break;
+            case Algorithm::HYBRID:
+                if (batched)
+                    DispatchBatched();
+                DispatchHybridMPR();
+                break;
+        }
     }
 
     // Calculate total number of actual (active) contacts
@@ -401,8 +751,7 @@ void ChNarrowphase::ProcessFluid() {
 
     const real radius = cd_data->p_kernel_radius + cd_data->p_collision_envelope;
     const real collision_envelope = cd_data->p_collision_envelope;
-    const real3& min_bounding_point = cd_data->ff_min_bounding_point;
-    const real3& max_bounding_point = cd_data->ff_max_bounding_point;
+    const real skin = cd_data->p_verlet_skin;
 
     const std::vector<real3>& pos_fluid = *cd_data->state_data.pos_3dof;
     std::vector<real3>& sorted_pos_fluid = *cd_data->state_data.sorted_pos_3dof;
@@ -410,20 +759,103 @@ void ChNarrowphase::ProcessFluid() {
     std::vector<int>& neighbor_fluid_fluid = cd_data->neighbor_3dof_3dof;
     std::vector<int>& contact_counts = cd_data->c_counts_3dof_3dof;
     std::vector<int>& particle_indices = cd_data->particle_indices_3dof;
-    std::vector<int>& reverse_mapping = cd_data->reverse_mapping_3dof;
-    vec3& bins_per_axis = cd_data->ff_bins_per_axis;
     uint& num_fluid_contacts = cd_data->num_fluid_contacts;
 
     const real radius_envelope = radius + collision_envelope;
     const real radius_squared = radius_envelope * radius_envelope;
 
+    if (skin <= 0) {
+        BuildFluidLists(radius_envelope, max_neighbors, neighbor_fluid_fluid, contact_counts);
+        num_fluid_contacts = Thrust_Total(contact_counts);
+        return;
+    }
+
+    std::vector<int>& verlet_fluid_fluid = cd_data->verlet_3dof_3dof;
+    std::vector<int>& verlet_counts = cd_data->v_counts_3dof_3dof;
+
+    if (!CheckVerletLists()) {
+        // Sort the particles and collect the candidates within the search radius enlarged by the skin
+        BuildFluidLists(radius_envelope + skin, max_verlet_neighbors, verlet_fluid_fluid, verlet_counts);
+        cd_data->verlet_pos_3dof.assign(pos_fluid.begin(), pos_fluid.end());
+        cd_data->num_verlet_builds++;
+    } else {
+        // Keep the particle ordering of the last build and only update the sorted positions
+#pragma omp parallel for
+        for (int i = 0; i < num_fluid_bodies; i++) {
+            sorted_pos_fluid[i] = pos_fluid[particle_indices[i]];
+        }
+    }
+
+    // Extract the neighbors within the search radius from the candidates (in the same order as a full search)
+    neighbor_fluid_fluid.resize(num_fluid_bodies * max_neighbors);
+    contact_counts.resize(num_fluid_bodies);
+
+#pragma omp parallel for
+    for (int p = 0; p < num_fluid_bodies; p++) {
+        real3 xi = sorted_pos_fluid[p];
+        int contact_count = 0;
+        for (int k = 0; k < verlet_counts[p]; k++) {
+            const int q = verlet_fluid_fluid[p * max_verlet_neighbors + k];
+            const real3 xij = xi - sorted_pos_fluid[q];
+            if (Dot(xij) < radius_squared && contact_count < max_neighbors) {
+                neighbor_fluid_fluid[p * max_neighbors + contact_count] = q;
+                ++contact_count;
+            }
+        }
+        contact_counts[p] = contact_count;
+    }
+
+    num_fluid_contacts = Thrust_Total(contact_counts);
+}
+
+bool ChNarrowphase::CheckVerletLists() const {
+    const int num_fluid_bodies = cd_data->state_data.num_fluid_bodies;
+    const std::vector<real3>& pos_fluid = *cd_data->state_data.pos_3dof;
+    const std::vector<real3>& verlet_pos = cd_data->verlet_pos_3dof;
+
+    if ((int)verlet_pos.size() != num_fluid_bodies || (int)cd_data->v_counts_3dof_3dof.size() != num_fluid_bodies ||
+        (int)cd_data->particle_indices_3dof.size() != num_fluid_bodies)
+        return false;
+
+    // The lists remain valid as long as no two particles can have closed the skin distance
+    const real half_skin = cd_data->p_verlet_skin / 2;
+    const real max_disp_squared = half_skin * half_skin;
+    int num_moved = 0;
+
+#pragma omp parallel for reduction(+ : num_moved)
+    for (int i = 0; i < num_fluid_bodies; i++) {
+        if (Dot(pos_fluid[i] - verlet_pos[i]) >= max_disp_squared)
+            num_moved++;
+    }
+
+    return num_moved == 0;
+}
+
+void ChNarrowphase::BuildFluidLists(real radius_envelope,
+                                    int capacity,
+                                    std::vector<int>& neighbor_fluid_fluid,
+                                    std::vector<int>& contact_counts) {
+    // Readability replacements
+    const int num_fluid_bodies = cd_data->state_data.num_fluid_bodies;
+    const real3& min_bounding_point = cd_data->ff_min_bounding_point;
+    const real3& max_bounding_point = cd_data->ff_max_bounding_point;
+
+    const std::vector<real3>& pos_fluid = *cd_data->state_data.pos_3dof;
+    std::vector<real3>& sorted_pos_fluid = *cd_data->state_data.sorted_pos_3dof;
+
+    std::vector<int>& particle_indices = cd_data->particle_indices_3dof;
+    std::vector<int>& reverse_mapping = cd_data->reverse_mapping_3dof;
+    vec3& bins_per_axis = cd_data->ff_bins_per_axis;
+
+    const real radius_squared = radius_envelope * radius_envelope;
+
     real3 diag = max_bounding_point - min_bounding_point;
     bins_per_axis = vec3(diag / (radius_envelope * 2));
     real inv_bin_edge = real(1.0) / (radius_envelope * 2);
     size_t grid_size = bins_per_axis.x * bins_per_axis.y * bins_per_axis.z;
 
     //====================================
-    neighbor_fluid_fluid.resize(num_fluid_bodies * max_neighbors);
+    neighbor_fluid_fluid.resize(num_fluid_bodies * capacity);
     contact_counts.resize(num_fluid_bodies);
     particle_indices.resize(num_fluid_bodies);
     reverse_mapping.resize(num_fluid_bodies);
@@ -492,8 +924,8 @@ void ChNarrowphase::ProcessFluid() {
                         const real3 xj = sorted_pos_fluid[q];
                         const real3 xij = xi - xj;
                         if (Dot(xij) < radius_squared) {
-                            if (contact_count < max_neighbors) {
-                                neighbor_fluid_fluid[p * max_neighbors + contact_count] = q;
+                            if (contact_count < capacity) {
+                                neighbor_fluid_fluid[p * capacity + contact_count] = q;
                                 ++contact_count;
                             }
                         }
@@ -503,8 +935,6 @@ void ChNarrowphase::ProcessFluid() {
         }
         contact_counts[p] = contact_count;
     }
-
-    num_fluid_contacts = Thrust_Total(contact_counts);
 }
 
 // -----------------------------------------------------------------------------
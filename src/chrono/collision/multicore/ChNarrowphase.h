@@ -111,19 +111,42 @@ class ChApi ChNarrowphase {
     static const int max_neighbors = 64;
     static const int max_rigid_neighbors = 32;
 
+    /// Maximum number of candidate neighbors per 3-dof particle in the Verlet lists.
+    /// Candidates are collected within the search radius enlarged by the Verlet skin, hence the larger capacity.
+    static const int max_verlet_neighbors = 2 * max_neighbors;
+
+    /// Size of the batches of sphere-sphere and box-sphere candidate pairs.
+    /// Candidate pairs in a batch are gathered in structure-of-arrays form and processed in a single loop, so that the
+    /// compiler can evaluate several pairs at once in SIMD registers.
+    static const int batch_size = 64;
+
   private:
     /// Calculate total number of potential contacts.
     int PreprocessCount();
 
+    /// Calculate total number of potential contacts in a system with only sphere shapes (one per candidate pair).
+    int PreprocessCountSpheres();
+
     /// Transform the shape data to the global reference frame.
     /// Perform this as a preprocessing step to improve performance. Performance is improved because the amount of data
     /// loaded is still the same but it does not have to be transformed per contact pair, now it is transformed once per
     /// shape.
     void PreprocessLocalToParent();
 
+    /// Set the shape data in the global reference frame for a system with only sphere shapes.
+    void PreprocessSpheres();
+
     /// Perform collision detection fluid-fluid.
+    /// With a non-zero Verlet skin, the particle sort and the cell search are only performed when some particle moved
+    /// more than half the skin since the last build; otherwise, the neighbor lists are filtered from the candidates.
     void ProcessFluid();
 
+    /// Sort the 3-dof particles by grid cell and collect, for each of them, the particles within the given radius.
+    void BuildFluidLists(real radius, int capacity, std::vector<int>& neighbors, std::vector<int>& counts);
+
+    /// Return true if the 3-dof particle Verlet lists are still valid for the current particle positions.
+    bool CheckVerletLists() const;
+
     /// Perform collision detection involving rigid shapes (rigid-rigid and rigid-fluid).
     void ProcessRigids();
     void ProcessRigidRigid();
@@ -132,6 +155,14 @@ class ChApi ChNarrowphase {
     void DispatchMPR();
     void DispatchPRIMS();
     void DispatchHybridMPR();
+
+    /// Process sphere-sphere and box-sphere candidate pairs in batches and collect all other pairs in generic_pairs.
+    void DispatchBatched();
+    void DispatchSphereSphereBatch(uint start, uint count);
+    void DispatchBoxSphereBatch(uint start, uint count);
+
+    /// Process all candidate pairs in a system with only sphere shapes.
+    void DispatchSphereOnly();
     void Dispatch_Init(uint index, uint& icoll, uint& ID_A, uint& ID_B, ConvexShape* shapeA, ConvexShape* shapeB);
     void Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC);
 
@@ -147,6 +178,11 @@ class ChApi ChNarrowphase {
     uint num_potential_rigid_fluid_contacts;
 
     Algorithm algorithm;
+    bool batched;  ///< process sphere-sphere and box-sphere pairs in batches (PRIMS and HYBRID only)
+
+    std::vector<uint> ss_pairs;       ///< candidate pairs of two spheres
+    std::vector<uint> bs_pairs;       ///< candidate pairs of a box and a sphere
+    std::vector<uint> generic_pairs;  ///< all other candidate pairs (processed one at a time)
 
     std::vector<uint> f_bin_intersections;
     std::vector<uint> f_bin_number;
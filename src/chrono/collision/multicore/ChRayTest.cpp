@@ -12,6 +12,8 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/collision/multicore/ChRayTest.h"
 #include "chrono/collision/multicore/ChCollisionUtils.h"
 
@@ -23,58 +25,11 @@ namespace chrono {
 
 using namespace chrono::mc_utils;
 
-ChRayTest::ChRayTest(std::shared_ptr<ChCollisionData> data) : cd_data(data), num_bin_tests(0), num_shape_tests(0) {}
+ChRayTest::ChRayTest(std::shared_ptr<ChCollisionData> data)
+    : cd_data(data), num_bin_tests(0), num_shape_tests(0), packet_stamp(0) {}
 
 // =============================================================================
 
-// Test for intersection between a sphere of given `radius` centered at `pos` and the specified oriented line
-// segment (from `start` to `end`). An intersection only exists if the square of the distance to the closest
-// point of intersection is less than `mindist2`. If an intersection exists, we return the new `mindist2`,
-// as well as the `normal` to the object at the intersection point.
-bool sphere_ray(const real3& pos,
-                const real& radius,
-                const real3& start,
-                const real3& end,
-                real3& normal,
-                real& mindist2) {
-    real3 vec = start - pos;
-    real3 ray = end - start;
-    real vv = Length2(vec);
-    real a = Length2(ray);
-    real b = Dot(vec, ray);
-    real c = vv - radius * radius;
-
-    // If the start point is inside or on the sphere, report intersection.
-    // Otherwise, no intersection if ray points away from sphere.
-    if (c <= 0) {
-        if (vv > 0)
-            normal = vec / Sqrt(vv);
-        else
-            normal = real3(0, 0, 1);
-        mindist2 = 0;
-        return true;
-    } else if (b > 0)
-        return false;
-
-    // Solve quadratic equation to find ray-sphere intersection: t*t + 2*b*t + c = 0.
-    // An intersection exists only if the equation has real solutions and if the smallest
-    // one is smaller than both the ray length and the provided 'mindist2'
-    real discr = b * b - a * c;
-    if (discr < 0)
-        return false;
-
-    real t = -(b + Sqrt(discr)) / a;
-    if (t >= 1)
-        return false;
-    real dist2 = a * (t * t);
-    if (dist2 > mindist2)
-        return false;
-
-    normal = Normalize(vec + t * ray);
-    mindist2 = dist2;
-    return true;
-}
-
 // This function returns true if the specified ray (expressed in the frame of the AABB) passes through the AABB. The
 // AABB is assumed to be centered at the origin with no rotation. If the ray intersects the AABB, the location where the
 // ray enters the AABB is returned in 'loc' and the normal to the box is returned in 'normal'. If the ray starts inside
@@ -133,37 +88,6 @@ bool aabb_ray(const real3& hdims, const real3& start, const real3& end, real& t,
     return !outside;
 }
 
-// Test for intersection between a box of given half-dimensions `hdims` centered at `pos` with orientation `rot` and the
-// specified oriented line segment (from `start` to `end`). An intersection only exists if the square of the distance to
-// the closest point of intersection is less than 'mindist2'. If an intersection exists, we return the new 'mindist2',
-// as well as the normal to the object at the intersection point.
-bool box_ray(const real3& pos,
-             const quaternion& rot,
-             const real3& hdims,
-             const real3& start,
-             const real3& end,
-             real3& normal,
-             real& mindist2) {
-    // Express the ray in the box frame
-    real3 start_B = RotateT(start - pos, rot);
-    real3 end_B = RotateT(end - pos, rot);
-
-    // Test intersection in local frame (ray against AABB)
-    real t_B;
-    real3 loc_B;
-    real3 normal_B;
-    if (aabb_ray(hdims, start_B, end_B, t_B, loc_B, normal_B)) {
-        real dist2 = Length2(loc_B - start_B);
-        if (dist2 < mindist2) {
-            normal = Rotate(normal_B, rot);
-            mindist2 = dist2;
-            return true;
-        }
-    }
-
-    return false;
-}
-
 // This utility function tests whether the specified line segment (expressed in the frame of the capsule/cylinder)
 // intersects the cylindrical portion of a capsule/cylinder. An intersection only exists if the square of the distance
 // to the closest point of intersection is less than 'mindist2'. If an intersection exists, we return the new mindist2,
@@ -208,27 +132,13 @@ bool cylsurf_ray(const real& radius,
     normal.x = start.x + t * ray.x;
     normal.y = 0;
     normal.z = start.z + t * ray.z;
+    normal = Normalize(normal);
 
     mindist2 = dist2;
 
     return true;
 }
 
-// This utility function tests whether the specified line segment (expressed in the frame of the capsule) intersects the
-// endcap sphere located at 'center' (which is either +hlen or -hlen). An intersection only exists if the square of the
-// distance to the closest point of intersection is less than 'minDist2'. If an intersection exists, we return the new
-// minDist2 as well as the normal to the endcap sphere at the intersection point.
-bool hemisphere_ray(int cap,
-                    const real& radius,
-                    const real& hlen,
-                    const real3& start,
-                    const real3& end,
-                    real3& normal,
-                    real& mindist2) {
-    //// TODO
-    return false;
-}
-
 // This utility function tests whether the specified line segment (expressed in the frame of the cylinder) intersects
 // the endcap disk located at 'center' (which is either +hlen or -hlen). An intersection only exists if the square of
 // the distance to the closest point of intersection is less than 'minDist2'. If an intersection exists, we return the
@@ -250,13 +160,8 @@ bool disk_ray(int cap,
     if (cap * start.y < hlen)
         return false;
 
-    // Normal to cap
-    normal.x = 0;
-    normal.y = 1.0 * cap;
-    normal.z = 0;
-
     // No intersection if ray points away from cap.
-    if (Dot(ray, normal) > 0)
+    if (cap * ray.y > 0)
         return false;
 
     // Intersect infinte ray with cap plane
@@ -272,41 +177,11 @@ bool disk_ray(int cap,
     if (u * u + v * v > radius * radius)
         return false;
 
+    normal = real3(0, 1.0 * cap, 0);
     mindist2 = dist2;
     return true;
 }
 
-// Test for intersection between a capsule (centered at 'pos' with orientation given by 'rot' and having given `radius`
-// and half-length `hlen`) and the specified oriented line segment (from `start` to `end`). An intersection only exists
-// if the square of the distance to the closest point of intersection is less than 'minDist2'. If an intersection
-// exists, we return the new 'minDist2', as well as the normal to the object at the intersection point.
-bool capsule_ray(const real3& pos,
-                 const quaternion& rot,
-                 const real& radius,
-                 const real& hlen,
-                 const real3& start,
-                 const real3& end,
-                 real3& normal,
-                 real& mindist2) {
-    // Express the line segment in the frame of the capsule. The capsule itself is centered at the origin and has its
-    // direction along the y-axis.
-    real3 start_C = RotateT(start - pos, rot);
-    real3 end_C = RotateT(end - pos, rot);
-
-    // Separate the capsule into three components, two endcap spheres and a cylindrical segment, and keep track of
-    // possible intersection with each one of them. If an intersection exists, express the calculated normal back into
-    // the global frame.
-    real3 normal_C;
-    bool found = cylsurf_ray(radius, hlen, start_C, end_C, normal_C, mindist2);
-    found = found || hemisphere_ray(+1, radius, hlen, start_C, end_C, normal_C, mindist2);
-    found = found || hemisphere_ray(-1, radius, hlen, start_C, end_C, normal_C, mindist2);
-
-    if (found)
-        normal = Rotate(normal_C, rot);
-
-    return found;
-}
-
 // Test for intersection between a cylinder (centered at 'pos' with orientation given by 'rot' and having given `radius`
 // and half-length `hlen`) and the specified oriented line segment (from `start` to `end`). An intersection only exists
 // if the square of the distance to the closest point of intersection is less than 'minDist2'. If an intersection
@@ -320,20 +195,23 @@ bool cylinder_ray(const real3& pos,
                   real3& normal,
                   real& mindist2) {
     // Express the line segment in the frame of the cylinder. The cylinder itself is centered at the origin and has its
-    // direction along the y-axis.
+    // direction along the z-axis; swap the y and z components so that the cylinder axis is along the y-axis, as
+    // assumed by the component tests below.
     real3 start_C = RotateT(start - pos, rot);
     real3 end_C = RotateT(end - pos, rot);
+    start_C = real3(start_C.x, start_C.z, start_C.y);
+    end_C = real3(end_C.x, end_C.z, end_C.y);
 
     // Separate the cylinder into three components, two endcap disks and a cylindrical segment, and keep track of
-    // possible intersection with each one of them. If an intersection exists, express the calculated normal back into
-    // the global frame.
+    // possible intersection with each one of them (keeping the closest one). If an intersection exists, express the
+    // calculated normal back into the global frame.
     real3 normal_C;
     bool found = cylsurf_ray(radius, hlen, start_C, end_C, normal_C, mindist2);
-    found = found || disk_ray(+1, radius, hlen, start_C, end_C, normal_C, mindist2);
-    found = found || disk_ray(-1, radius, hlen, start_C, end_C, normal_C, mindist2);
+    found |= disk_ray(+1, radius, hlen, start_C, end_C, normal_C, mindist2);
+    found |= disk_ray(-1, radius, hlen, start_C, end_C, normal_C, mindist2);
 
     if (found)
-        normal = Rotate(normal_C, rot);
+        normal = Rotate(real3(normal_C.x, normal_C.z, normal_C.y), rot);
 
     return found;
 }
@@ -375,9 +253,257 @@ bool triangle_ray(const real3& A,
 
 // =============================================================================
 
+// Packet of rays in SoA form, with the closest hit found so far for each ray.
+template <int W>
+struct RayPacket {
+    real sx[W], sy[W], sz[W];  // ray start points
+    real rx[W], ry[W], rz[W];  // ray directions (end - start)
+    real len2[W];              // squared ray lengths
+    bool active[W];            // ray still traversing the broadphase grid?
+    real mindist2[W];          // squared distance from ray origin to closest hit
+    real nx[W], ny[W], nz[W];  // normal at closest hit
+    int shape[W];              // identifier of closest hit shape (-1 if none)
+};
+
+// Packet rays expressed in the frame of a shape.
+template <int W>
+struct LocalRays {
+    real sx[W], sy[W], sz[W];
+    real rx[W], ry[W], rz[W];
+};
+
+// Set the (row-major) rotation matrix corresponding to the given quaternion.
+static void RotationMatrix(const quaternion& q, real A[9]) {
+    A[0] = 1 - 2 * (q.y * q.y + q.z * q.z);
+    A[1] = 2 * (q.x * q.y - q.w * q.z);
+    A[2] = 2 * (q.x * q.z + q.w * q.y);
+    A[3] = 2 * (q.x * q.y + q.w * q.z);
+    A[4] = 1 - 2 * (q.x * q.x + q.z * q.z);
+    A[5] = 2 * (q.y * q.z - q.w * q.x);
+    A[6] = 2 * (q.x * q.z - q.w * q.y);
+    A[7] = 2 * (q.y * q.z + q.w * q.x);
+    A[8] = 1 - 2 * (q.x * q.x + q.y * q.y);
+}
+
+// Express the rays of a packet in the frame with origin `pos` and rotation matrix `A`.
+template <int W>
+static void ToLocal(const RayPacket<W>& p, const real3& pos, const real A[9], LocalRays<W>& lr) {
+    for (int l = 0; l < W; l++) {
+        real dx = p.sx[l] - pos.x;
+        real dy = p.sy[l] - pos.y;
+        real dz = p.sz[l] - pos.z;
+        lr.sx[l] = A[0] * dx + A[3] * dy + A[6] * dz;
+        lr.sy[l] = A[1] * dx + A[4] * dy + A[7] * dz;
+        lr.sz[l] = A[2] * dx + A[5] * dy + A[8] * dz;
+        lr.rx[l] = A[0] * p.rx[l] + A[3] * p.ry[l] + A[6] * p.rz[l];
+        lr.ry[l] = A[1] * p.rx[l] + A[4] * p.ry[l] + A[7] * p.rz[l];
+        lr.rz[l] = A[2] * p.rx[l] + A[5] * p.ry[l] + A[8] * p.rz[l];
+    }
+}
+
+// Test all active rays in the packet for intersection with a sphere of given `radius` centered at `pos`. If a ray
+// starts inside the sphere, the intersection is at the ray start point. A ray's closest hit is updated if the
+// intersection is closer to its origin.
+template <int W>
+static void sphere_ray_packet(RayPacket<W>& p, int shape, const real3& pos, real radius) {
+    for (int l = 0; l < W; l++) {
+        real vx = p.sx[l] - pos.x;
+        real vy = p.sy[l] - pos.y;
+        real vz = p.sz[l] - pos.z;
+        real vv = vx * vx + vy * vy + vz * vz;
+        real b = vx * p.rx[l] + vy * p.ry[l] + vz * p.rz[l];
+        real c = vv - radius * radius;
+
+        // Solve quadratic equation to find ray-sphere intersection: a*t*t + 2*b*t + c = 0.
+        // An intersection exists if the start point is inside the sphere or if the ray points towards the sphere, the
+        // equation has real solutions, and the smallest one is smaller than the ray length.
+        real disc = b * b - p.len2[l] * c;
+        bool inside = c <= 0;
+        real t = inside ? 0 : -(b + Sqrt(Max(disc, real(0)))) / p.len2[l];
+        real dist2 = p.len2[l] * t * t;
+        bool found = inside || (b <= 0 && disc >= 0 && t < 1);
+
+        if (p.active[l] && found && dist2 < p.mindist2[l]) {
+            real nx = vx + t * p.rx[l];
+            real ny = vy + t * p.ry[l];
+            real nz = vz + t * p.rz[l];
+            real n = Sqrt(nx * nx + ny * ny + nz * nz);
+            p.mindist2[l] = dist2;
+            p.nx[l] = n > 0 ? nx / n : 0;
+            p.ny[l] = n > 0 ? ny / n : 0;
+            p.nz[l] = n > 0 ? nz / n : 1;
+            p.shape[l] = shape;
+        }
+    }
+}
+
+// Test all active rays in the packet for intersection with a box of given half-dimensions `hdims` centered at `pos`
+// with orientation `rot` (slab test in the box frame). If a ray starts inside the box, the intersection is at the ray
+// start point and the normal is opposite to the ray direction. A ray's closest hit is updated if the intersection is
+// closer to its origin.
+template <int W>
+static void box_ray_packet(RayPacket<W>& p, int shape, const real3& pos, const quaternion& rot, const real3& hdims) {
+    real A[9];
+    RotationMatrix(rot, A);
+    LocalRays<W> lr;
+    ToLocal(p, pos, A, lr);
+
+    for (int l = 0; l < W; l++) {
+        real s[3] = {lr.sx[l], lr.sy[l], lr.sz[l]};
+        real r[3] = {lr.rx[l], lr.ry[l], lr.rz[l]};
+
+        // Intersect the ray parameter intervals within each pair of box faces
+        real t_min = -C_REAL_MAX;
+        real t_max = C_REAL_MAX;
+        int axis = -1;
+        bool miss = false;
+        for (int i = 0; i < 3; i++) {
+            if (r[i] == 0) {
+                miss = miss || s[i] < -hdims[i] || s[i] > hdims[i];
+                continue;
+            }
+            real t1 = (-hdims[i] - s[i]) / r[i];
+            real t2 = (+hdims[i] - s[i]) / r[i];
+            if (Min(t1, t2) > t_min) {
+                t_min = Min(t1, t2);
+                axis = i;
+            }
+            t_max = Min(t_max, Max(t1, t2));
+        }
+
+        if (!p.active[l] || miss || t_min > t_max || t_max < 0 || t_min > 1)
+            continue;
+
+        bool inside = t_min <= 0;
+        real t = inside ? 0 : t_min;
+        real dist2 = p.len2[l] * t * t;
+        if (dist2 >= p.mindist2[l])
+            continue;
+
+        p.mindist2[l] = dist2;
+        if (inside) {
+            real len = Sqrt(p.len2[l]);
+            p.nx[l] = -p.rx[l] / len;
+            p.ny[l] = -p.ry[l] / len;
+            p.nz[l] = -p.rz[l] / len;
+        } else {
+            // Normal to the entry face, expressed in the absolute frame
+            real sign = r[axis] > 0 ? -1 : +1;
+            p.nx[l] = sign * A[axis];
+            p.ny[l] = sign * A[3 + axis];
+            p.nz[l] = sign * A[6 + axis];
+        }
+        p.shape[l] = shape;
+    }
+}
+
+// Test all active rays in the packet for intersection with a capsule centered at `pos` with orientation `rot` and
+// having given `radius` and half-length `hlen` (the capsule axis is the local z axis). The capsule is split into a
+// cylindrical surface and two hemispherical endcaps, keeping the closest intersection. If a ray starts inside the
+// capsule, the intersection is at the ray start point. A ray's closest hit is updated if the intersection is closer to
+// its origin.
+template <int W>
+static void capsule_ray_packet(RayPacket<W>& p,
+                               int shape,
+                               const real3& pos,
+                               const quaternion& rot,
+                               real radius,
+                               real hlen) {
+    real A[9];
+    RotationMatrix(rot, A);
+    LocalRays<W> lr;
+    ToLocal(p, pos, A, lr);
+
+    real r2 = radius * radius;
+
+    for (int l = 0; l < W; l++) {
+        real sx = lr.sx[l], sy = lr.sy[l], sz = lr.sz[l];
+        real rx = lr.rx[l], ry = lr.ry[l], rz = lr.rz[l];
+        real len2 = p.len2[l];
+
+        real best = C_REAL_MAX;
+        real nx = 0, ny = 0, nz = 0;
+
+        // Start point inside the cylindrical portion
+        real radial2 = sx * sx + sy * sy;
+        if (radial2 <= r2 && sz >= -hlen && sz <= hlen) {
+            real n = Sqrt(radial2);
+            real len = Sqrt(len2);
+            best = 0;
+            nx = n > 0 ? sx / n : -rx / len;
+            ny = n > 0 ? sy / n : -ry / len;
+            nz = n > 0 ? 0 : -rz / len;
+        }
+
+        // Cylindrical surface (not intersected by rays (near) parallel to the capsule axis)
+        if (rz * rz <= 0.9999 * len2) {
+            real a = rx * rx + ry * ry;
+            real b = sx * rx + sy * ry;
+            real c = radial2 - r2;
+            real disc = b * b - a * c;
+            if (disc >= 0) {
+                real t = -(b + Sqrt(disc)) / a;
+                real z = sz + t * rz;
+                real dist2 = t * t * len2;
+                if (t >= 0 && t <= 1 && z >= -hlen && z <= hlen && dist2 < best) {
+                    real hx = sx + t * rx;
+                    real hy = sy + t * ry;
+                    real n = Sqrt(hx * hx + hy * hy);
+                    best = dist2;
+                    nx = hx / n;
+                    ny = hy / n;
+                    nz = 0;
+                }
+            }
+        }
+
+        // Hemispherical endcaps (intersections with the endcap spheres on the outer side of the cap planes)
+        for (int cap = -1; cap <= 1; cap += 2) {
+            real vx = sx;
+            real vy = sy;
+            real vz = sz - cap * hlen;
+            real vv = vx * vx + vy * vy + vz * vz;
+            real b = vx * rx + vy * ry + vz * rz;
+            real c = vv - r2;
+            real t = -1;
+            if (c <= 0) {
+                t = 0;
+            } else if (b <= 0 && b * b - len2 * c >= 0) {
+                t = -(b + Sqrt(b * b - len2 * c)) / len2;
+            }
+            real dist2 = t * t * len2;
+            if (t >= 0 && t < 1 && cap * (sz + t * rz) >= hlen && dist2 < best) {
+                real hx = vx + t * rx;
+                real hy = vy + t * ry;
+                real hz = vz + t * rz;
+                real n = Sqrt(hx * hx + hy * hy + hz * hz);
+                best = dist2;
+                nx = n > 0 ? hx / n : 0;
+                ny = n > 0 ? hy / n : 0;
+                nz = n > 0 ? hz / n : cap;
+            }
+        }
+
+        if (!p.active[l] || best >= p.mindist2[l])
+            continue;
+
+        // Express the normal in the absolute frame
+        p.mindist2[l] = best;
+        p.nx[l] = A[0] * nx + A[1] * ny + A[2] * nz;
+        p.ny[l] = A[3] * nx + A[4] * ny + A[5] * nz;
+        p.nz[l] = A[6] * nx + A[7] * ny + A[8] * nz;
+        p.shape[l] = shape;
+    }
+}
+
+// =============================================================================
+
 // Use a variant of the 3D Digital Differential Analyser (Akira Fujimoto, "ARTS: Accelerated Ray Tracing Systems", 1986)
-// to efficiently traverse the broadphase grid and analytical shape-ray intersection tests.
-bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
+// to efficiently traverse the broadphase grid with each ray in the packet. At each step, the shapes in the bins
+// visited by the active rays are tested against all active rays. A ray terminates when it exits the grid or when its
+// closest hit lies within the bins visited so far.
+template <int W>
+int ChRayTest::Traverse(int num_rays, const real3* start, const real3* end, RayHitInfo* info, bool* hit) {
     // Readability replacements
     const vec3& bins_per_axis = cd_data->bins_per_axis;
     const real3& bin_size = cd_data->bin_size;
@@ -387,92 +513,215 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
     const std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
     const std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
 
-    // Calculate ray parameter at intersection of overall AABB. Return now if no intersection
-    real3 center = 0.5 * (rtf + lbr), loc, normal;
-    real t_min;
-    if (!aabb_ray(0.5 * (rtf - lbr), start - center, end - center, t_min, loc, normal))
-        return false;
+    // Per-ray DDA state
+    vec3 bin[W];
+    vec3 step[W];
+    vec3 exit[W];
+    real3 t_next[W];
+    real3 delta[W];
+
+    RayPacket<W> p;
+    real3 center = 0.5 * (rtf + lbr);
+    real3 hdims = 0.5 * (rtf - lbr);
+
+    for (int l = 0; l < W; l++) {
+        p.active[l] = false;
+        p.mindist2[l] = C_REAL_MAX;
+        p.nx[l] = p.ny[l] = p.nz[l] = 0;
+        p.shape[l] = -1;
+        p.sx[l] = p.sy[l] = p.sz[l] = 0;
+        p.rx[l] = p.ry[l] = p.rz[l] = 0;
+        p.len2[l] = 1;
+        if (l >= num_rays)
+            continue;
 
-    // Ray direction
-    real3 ray = end - start;
+        real3 ray = end[l] - start[l];
+        p.sx[l] = start[l].x;
+        p.sy[l] = start[l].y;
+        p.sz[l] = start[l].z;
+        p.rx[l] = ray.x;
+        p.ry[l] = ray.y;
+        p.rz[l] = ray.z;
+        if (Length2(ray) == 0)
+            continue;
+        p.len2[l] = Length2(ray);
+
+        // Calculate ray parameter at intersection of overall AABB. Skip ray if no intersection
+        real3 loc, normal;
+        real t_min;
+        if (!aabb_ray(hdims, start[l] - center, end[l] - center, t_min, loc, normal))
+            continue;
+        p.active[l] = true;
+
+        // Find entry bin
+        bin[l] = Clamp(HashMin(start[l] + t_min * ray - lbr, inv_bin_size), vec3(0, 0, 0),
+                       bins_per_axis - vec3(1, 1, 1));
+
+        // Depending on ray sign in each direction:
+        // - Initialize next crossing
+        // - Set increment in ray parameter at each crossing
+        // - Set increment in bin index at each crossing
+        // - Set termination criteria (grid exit condition)
+        t_next[l] = real3(C_REAL_MAX);
+        delta[l] = real3(0);
+        step[l] = vec3(0, 0, 0);
+        exit[l] = vec3(-1, -1, -1);
+        for (int i = 0; i < 3; i++) {
+            real start0 = (start[l][i] - lbr[i]) + t_min * ray[i];  // ray start point relative to grid LRB
+            if (ray[i] < 0) {
+                t_next[l][i] = t_min + (bin[l][i] * bin_size[i] - start0) / ray[i];
+                delta[l][i] = -bin_size[i] / ray[i];
+                step[l][i] = -1;
+                exit[l][i] = -1;
+            }
+            if (ray[i] > 0) {
+                t_next[l][i] = t_min + ((bin[l][i] + 1) * bin_size[i] - start0) / ray[i];
+                delta[l][i] = bin_size[i] / ray[i];
+                step[l][i] = +1;
+                exit[l][i] = bins_per_axis[i];
+            }
+        }
+    }
 
-    // Find entry bin
-    auto bin = Clamp(HashMin(start - lbr, inv_bin_size), vec3(0, 0, 0), bins_per_axis - vec3(1, 1, 1));
-
-    // Depending on ray sign in each direction:
-    // - Initialize next crossing
-    // - Set increment in ray parameter at each crossing
-    // - Set increment in bin index at each crossing
-    // - Set termination criteria (grid exit condition)
-    real3 t_next(C_REAL_MAX);
-    real3 delta(0);
-    vec3 step;
-    vec3 exit;
-    for (int i = 0; i < 3; i++) {
-        real start0 = (start[i] - lbr[i]) + t_min * ray[i];  // ray start point relative to grid LRB
-        if (ray[i] < 0) {
-            t_next[i] = t_min + (bin[i] * bin_size[i] - start0) / ray[i];
-            delta[i] = -bin_size[i] / ray[i];
-            step[i] = -1;
-            exit[i] = -1;
+    // With more than one ray, mark shapes already tested in this packet, as they may be found in several bins
+    bool use_stamps = W > 1;
+    if (use_stamps) {
+        if (shape_stamp.size() != cd_data->num_rigid_shapes) {
+            shape_stamp.assign(cd_data->num_rigid_shapes, 0);
+            packet_stamp = 0;
         }
-        if (ray[i] > 0) {
-            t_next[i] = t_min + ((bin[i] + 1) * bin_size[i] - start0) / ray[i];
-            delta[i] = bin_size[i] / ray[i];
-            step[i] = +1;
-            exit[i] = bins_per_axis[i];
+        if (++packet_stamp == 0) {
+            std::fill(shape_stamp.begin(), shape_stamp.end(), 0);
+            packet_stamp = 1;
         }
     }
 
-    // Walk through each bin intersected by the ray (DDA).
     ConvexShape shape(-1, &cd_data->shape_data);
-    real mindist2 = C_REAL_MAX;
-    bool hit = false;
-
-    ////std::cout << "Ray start: [" << start.x << "," << start.y << "," << start.z << "]" << std::endl;
-    ////std::cout << "Ray end:   [" << end.x << "," << end.y << "," << end.z << "]" << std::endl;
 
     while (true) {
-        ////std::cout << "  Test BIN:  [" << bin.x << "," << bin.y << "," << bin.z << "]" << std::endl;
-        num_bin_tests++;
-
-        // Test ray against all shapes in current bin.
-        auto bin_index = Hash_Index(bin, bins_per_axis);
-        auto start_index = bin_start_index_ext[bin_index];
-        auto end_index = bin_start_index_ext[bin_index + 1];
-
-        for (uint j = start_index; j < end_index; j++) {
-            num_shape_tests++;
-            shape.index = bin_aabb_number[j];
-            ////std::cout << "    Test SHAPE: " << shape.index << std::endl;
-            if (CheckShape(shape, start, end, info.normal, mindist2))
-                hit = true;
+        // Collect the bins visited by the active rays (without duplicates)
+        uint bins[W];
+        int num_bins = 0;
+        int num_active = 0;
+        for (int l = 0; l < W; l++) {
+            if (!p.active[l])
+                continue;
+            num_active++;
+            num_bin_tests++;
+            uint b = Hash_Index(bin[l], bins_per_axis);
+            if (std::find(bins, bins + num_bins, b) == bins + num_bins)
+                bins[num_bins++] = b;
         }
-
-        // If a shape in the current bin was hit, stop.
-        if (hit) {
-            info.shapeID = shape.index;         // Identifier of closest hit shape
-            info.dist = Sqrt(mindist2);         // Distance from ray origin
-            info.t = info.dist / Length(ray);   // Ray parameter at intersection with closest shape
-            info.point = start + info.t * ray;  // Intersection point
+        if (num_active == 0)
             break;
+
+        // Test the active rays against all shapes in the current bins
+        for (int k = 0; k < num_bins; k++) {
+            for (uint j = bin_start_index_ext[bins[k]]; j < bin_start_index_ext[bins[k] + 1]; j++) {
+                shape.index = bin_aabb_number[j];
+                if (use_stamps) {
+                    if (shape_stamp[shape.index] == packet_stamp)
+                        continue;
+                    shape_stamp[shape.index] = packet_stamp;
+                }
+                num_shape_tests += num_active;
+
+                switch (shape.Type()) {
+                    case ChCollisionShape::Type::SPHERE:
+                        sphere_ray_packet(p, shape.index, shape.A(), shape.Radius());
+                        break;
+                    case ChCollisionShape::Type::BOX:
+                        box_ray_packet(p, shape.index, shape.A(), shape.R(), shape.Box());
+                        break;
+                    case ChCollisionShape::Type::CAPSULE:
+                        capsule_ray_packet(p, shape.index, shape.A(), shape.R(), shape.Capsule().x,
+                                           shape.Capsule().y);
+                        break;
+                    default:
+                        for (int l = 0; l < W; l++) {
+                            if (!p.active[l])
+                                continue;
+                            real3 s(p.sx[l], p.sy[l], p.sz[l]);
+                            real3 e = s + real3(p.rx[l], p.ry[l], p.rz[l]);
+                            real3 normal;
+                            if (CheckShape(shape, s, e, normal, p.mindist2[l])) {
+                                p.nx[l] = normal.x;
+                                p.ny[l] = normal.y;
+                                p.nz[l] = normal.z;
+                                p.shape[l] = shape.index;
+                            }
+                        }
+                        break;
+                }
+            }
         }
 
-        // Move to the next cell (the one with lowest t_next)
+        // Terminate rays with a hit within the current bin; move the other rays to their next bin (the one with lowest
+        // t_next)
         static const int map[8] = {2, 1, 2, 1, 2, 2, 0, 0};
-        int k = ((t_next[0] < t_next[1]) << 2) + ((t_next[0] < t_next[2]) << 1) + ((t_next[1] < t_next[2]));
-        int axis = map[k];
-        bin[axis] += step[axis];
-        if (bin[axis] == exit[axis])
-            break;
-        t_next[axis] += delta[axis];
+        for (int l = 0; l < W; l++) {
+            if (!p.active[l])
+                continue;
+
+            real t_exit = Min(t_next[l].x, t_next[l].y, t_next[l].z);
+            if (p.shape[l] >= 0 && p.mindist2[l] <= t_exit * t_exit * p.len2[l]) {
+                p.active[l] = false;
+                continue;
+            }
+
+            int k = ((t_next[l][0] < t_next[l][1]) << 2) + ((t_next[l][0] < t_next[l][2]) << 1) +
+                    ((t_next[l][1] < t_next[l][2]));
+            int axis = map[k];
+            bin[l][axis] += step[l][axis];
+            if (bin[l][axis] == exit[l][axis]) {
+                p.active[l] = false;
+                continue;
+            }
+            t_next[l][axis] += delta[l][axis];
+        }
+    }
+
+    // Collect results
+    int num_hits = 0;
+    for (int l = 0; l < num_rays; l++) {
+        hit[l] = p.shape[l] >= 0;
+        if (!hit[l])
+            continue;
+        num_hits++;
+        real3 ray = end[l] - start[l];
+        info[l].shapeID = p.shape[l];                             // Identifier of closest hit shape
+        info[l].normal = real3(p.nx[l], p.ny[l], p.nz[l]);        // Normal at intersection point
+        info[l].dist = Sqrt(p.mindist2[l]);                       // Distance from ray origin
+        info[l].t = info[l].dist / Sqrt(p.len2[l]);               // Ray parameter at intersection with closest shape
+        info[l].point = start[l] + info[l].t * ray;               // Intersection point
+    }
+
+    return num_hits;
+}
+
+bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
+    num_bin_tests = 0;
+    num_shape_tests = 0;
+
+    bool hit;
+    return Traverse<1>(1, &start, &end, &info, &hit) > 0;
+}
+
+int ChRayTest::CheckPacket(int num_rays, const real3* start, const real3* end, RayHitInfo* info, bool* hit) {
+    num_bin_tests = 0;
+    num_shape_tests = 0;
+
+    int num_hits = 0;
+    for (int i = 0; i < num_rays; i += PACKET_SIZE) {
+        int n = num_rays - i < PACKET_SIZE ? num_rays - i : PACKET_SIZE;
+        num_hits += Traverse<PACKET_SIZE>(n, start + i, end + i, info + i, hit + i);
     }
 
-    return hit;
+    return num_hits;
 }
 
-// Narrowphase dispatcher for ray intersection test.  It uses analytical formulaes for known primitive shapes with
-// fallback on a generic ray-convex intersection test.
+// Narrowphase dispatcher for ray intersection test, for shapes without a packet test. It uses analytical formulaes for
+// known primitive shapes with fallback on a generic ray-convex intersection test.
 bool ChRayTest::CheckShape(const ConvexBase& shape,
                            const real3& start,
                            const real3& end,
@@ -481,15 +730,8 @@ bool ChRayTest::CheckShape(const ConvexBase& shape,
     auto shape_type = shape.Type();
 
     switch (shape_type) {
-        case ChCollisionShape::Type::SPHERE:
-            return sphere_ray(shape.A(), shape.Radius(), start, end, normal, mindist2);
-        case ChCollisionShape::Type::BOX:
-            return box_ray(shape.A(), shape.R(), shape.Box(), start, end, normal, mindist2);
         case ChCollisionShape::Type::CYLINDER:
-            return cylinder_ray(shape.A(), shape.R(), shape.Box().x, shape.Box().y, start, end, normal, mindist2);
-        case ChCollisionShape::Type::CAPSULE:
-            return capsule_ray(shape.A(), shape.R(), shape.Capsule().x, shape.Capsule().y, start, end, normal,
-                               mindist2);
+            return cylinder_ray(shape.A(), shape.R(), shape.Box().x, shape.Box().z, start, end, normal, mindist2);
         case ChCollisionShape::Type::TRIANGLE:
             return triangle_ray(shape.Triangles()[0], shape.Triangles()[1], shape.Triangles()[2], start, end, normal,
                                 mindist2);
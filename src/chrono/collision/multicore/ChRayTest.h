@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "chrono/collision/multicore/ChCollisionData.h"
 #include "chrono/collision/multicore/ChConvexShape.h"
 
@@ -38,6 +40,9 @@ class ChApi ChRayTest {
         real dist;     ///< distance to hit point from ray origin
     };
 
+    /// Number of rays traversing the broadphase grid together in CheckPacket.
+    static const int PACKET_SIZE = 8;
+
     ChRayTest(std::shared_ptr<ChCollisionData> data);
 
     /// Check for intersection of the given ray with all collision shapes in the system.
@@ -48,14 +53,31 @@ class ChApi ChRayTest {
                RayHitInfo& info     ///< [output] test result info
     );
 
-    /// Return the number of bins visited by the DDA algorithm during the last ray test.
+    /// Check for intersection of a set of rays with all collision shapes in the system.
+    /// The rays are processed in packets of PACKET_SIZE rays which traverse the broadphase grid together: at each step,
+    /// the shapes in the bins visited by the rays of the packet are tested against all active rays at once, with the
+    /// ray data in SoA form, and each shape is tested at most once per packet. Packets are most efficient for coherent
+    /// rays (nearby origins and similar directions), such as consecutive rays of a sensor scan. The results are the
+    /// same as those of Check for each individual ray. Return the number of rays that hit a shape.
+    int CheckPacket(int num_rays,         ///< number of rays
+                    const real3* start,   ///< ray start points
+                    const real3* end,     ///< ray end points
+                    RayHitInfo* info,     ///< [output] test result info (valid only for rays with a hit)
+                    bool* hit             ///< [output] hit flags
+    );
+
+    /// Return the number of bins visited by the DDA algorithm during the last ray test (summed over all rays).
     uint GetNumBinTests() const { return num_bin_tests; }
 
-    /// Return the number of ray-shape checks required by the last ray test.
+    /// Return the number of ray-shape checks required by the last ray test (summed over all rays).
     uint GetNumShapeTests() const { return num_shape_tests; }
 
   private:
-    /// Dispatcher for analytic functions for ray intersection with primitive shapes.
+    /// Traverse the broadphase grid with a packet of at most W rays.
+    template <int W>
+    int Traverse(int num_rays, const real3* start, const real3* end, RayHitInfo* info, bool* hit);
+
+    /// Dispatcher for analytic functions for ray intersection with primitive shapes without a packet test.
     bool CheckShape(const ConvexBase& shape,  ///< candidate shape
                     const real3& start,       ///< ray start point
                     const real3& end,         ///< ray end point
@@ -66,6 +88,8 @@ class ChApi ChRayTest {
     std::shared_ptr<ChCollisionData> cd_data;  ///< shared collision detection data
     uint num_bin_tests;                        ///< number of bins visited during last ray test
     uint num_shape_tests;                      ///< number of shape checked during last ray test
+    std::vector<uint> shape_stamp;             ///< last packet which tested each shape
+    uint packet_stamp;                         ///< current packet identifier
 };
 
 /// @} collision_mc
@@ -45,8 +45,10 @@
 #endif
 
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <cstddef>
+#include <type_traits>
 
 namespace chrono {
 
@@ -157,6 +159,60 @@ void aligned_allocator<T, N>::deallocate(pointer p, size_type) {
     aligned_free(p);
 }
 
+/// Aligned allocator with parallel first-touch initialization, for NUMA-aware placement of large arrays.
+/// On NUMA systems, the operating system places a memory page on the memory domain of the thread which first writes
+/// to it. This allocator zero-fills newly allocated arrays in a parallel loop with static schedule over the array
+/// elements, using the specified number of OpenMP threads. As such, the pages holding a contiguous block of elements
+/// are placed on the domain of the thread that will process that block in subsequent loops with static schedule (and
+/// the same number of threads), rather than all on the domain of the allocating thread.
+/// Effective only if threads are bound to cores (e.g., with OMP_PROC_BIND=close, or see ChOMP::BindThreads) and for
+/// arrays large enough to be served with fresh pages by the system allocator. Subsequent element construction by a
+/// single thread (e.g., in std::vector::resize) does not change the page placement.
+template <class T, int N>
+class first_touch_allocator : public aligned_allocator<T, N> {
+  public:
+    typedef typename aligned_allocator<T, N>::pointer pointer;
+    typedef typename aligned_allocator<T, N>::size_type size_type;
+    typedef std::true_type propagate_on_container_copy_assignment;
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    template <class U>
+    struct rebind {
+        typedef first_touch_allocator<U, N> other;
+    };
+
+    first_touch_allocator(int num_threads = 1) throw() : m_num_threads(num_threads) {}
+    first_touch_allocator(const first_touch_allocator& other) throw()
+        : aligned_allocator<T, N>(other), m_num_threads(other.m_num_threads) {}
+
+    template <class U>
+    first_touch_allocator(const first_touch_allocator<U, N>& other) throw()
+        : aligned_allocator<T, N>(other), m_num_threads(other.GetNumThreads()) {}
+
+    /// Get the number of threads used for first-touch initialization.
+    int GetNumThreads() const { return m_num_threads; }
+
+    pointer allocate(size_type n, const void* hint = 0) {
+        (void)hint;
+        pointer res = aligned_allocator<T, N>::allocate(n);
+        char* bytes = reinterpret_cast<char*>(res);
+        const int num = (int)n;
+        const int nthreads = m_num_threads;
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+        for (int i = 0; i < num; i++)
+            std::memset(bytes + i * sizeof(T), 0, sizeof(T));
+        return res;
+    }
+
+    // All instances can deallocate memory obtained from any other instance
+    inline bool operator==(const first_touch_allocator&) const { return true; }
+    inline bool operator!=(const first_touch_allocator&) const { return false; }
+
+  private:
+    int m_num_threads;  ///< number of threads for first-touch initialization
+};
+
 }  // end namespace chrono
 
 #endif
@@ -82,6 +82,8 @@ ChBezierCurve::ChBezierCurve(const std::vector<ChVector3d>& points,
             m_outCV.push_back(m_outCV.front());
         }
     }
+
+    BuildIndex();
 }
 
 ChBezierCurve::ChBezierCurve(const std::vector<ChVector3d>& points, bool closed) : m_points(points), m_closed(closed) {
@@ -112,6 +114,7 @@ ChBezierCurve::ChBezierCurve(const std::vector<ChVector3d>& points, bool closed)
         m_outCV[0] = (2.0 * m_points[0] + m_points[1]) / 3;
         m_inCV[1] = (2.0 * m_points[1] + m_points[0]) / 3;
         m_closed = false;
+        BuildIndex();
         return;
     }
 
@@ -228,6 +231,8 @@ ChBezierCurve::ChBezierCurve(const std::vector<ChVector3d>& points, bool closed)
         delete[] y;
         delete[] z;
     }
+
+    BuildIndex();
 }
 
 void ChBezierCurve::setPoints(const std::vector<ChVector3d>& points,
@@ -239,6 +244,8 @@ void ChBezierCurve::setPoints(const std::vector<ChVector3d>& points,
     m_points = points;
     m_inCV = inCV;
     m_outCV = outCV;
+
+    BuildIndex();
 }
 
 // Utility function for solving the tridiagonal system for one of the
@@ -553,6 +560,163 @@ ChVector3d ChBezierCurve::CalcClosestPoint(const ChVector3d& loc, size_t i, doub
     */
 }
 
+// -----------------------------------------------------------------------------
+// ChBezierCurve::BuildIndex()
+//
+// This function builds the spatial index used for global closest-point queries.
+// Each segment is bounded by the axis-aligned box of its control polygon (which,
+// by the convex hull property, contains the curve segment). The segments are
+// registered with all cells of a uniform grid in the horizontal plane overlapped
+// by their bounding box. The cell size is set to the average horizontal extent
+// of a segment, enlarged if necessary so that the grid has at most 4 cells per
+// segment.
+// -----------------------------------------------------------------------------
+void ChBezierCurve::BuildIndex() {
+    size_t ns = GetNumSegments();
+
+    m_seg_min.resize(ns);
+    m_seg_max.resize(ns);
+
+    ChVector3d pmin(+std::numeric_limits<double>::max());
+    ChVector3d pmax(-std::numeric_limits<double>::max());
+    double size = 0;
+
+    for (size_t i = 0; i < ns; i++) {
+        const ChVector3d cp[4] = {m_points[i], m_outCV[i], m_inCV[i + 1], m_points[i + 1]};
+        m_seg_min[i] = cp[0];
+        m_seg_max[i] = cp[0];
+        for (int k = 1; k < 4; k++) {
+            for (int j = 0; j < 3; j++) {
+                m_seg_min[i][j] = std::min(m_seg_min[i][j], cp[k][j]);
+                m_seg_max[i][j] = std::max(m_seg_max[i][j], cp[k][j]);
+            }
+        }
+        for (int j = 0; j < 3; j++) {
+            pmin[j] = std::min(pmin[j], m_seg_min[i][j]);
+            pmax[j] = std::max(pmax[j], m_seg_max[i][j]);
+        }
+        size += std::max(m_seg_max[i].x() - m_seg_min[i].x(), m_seg_max[i].y() - m_seg_min[i].y());
+    }
+
+    double lx = pmax.x() - pmin.x();
+    double ly = pmax.y() - pmin.y();
+    m_grid_h = std::max(size / ns, std::sqrt(lx * ly / (4 * ns)));
+    if (m_grid_h <= 0)
+        m_grid_h = 1;
+    m_grid_x0 = pmin.x();
+    m_grid_y0 = pmin.y();
+    m_grid_nx = static_cast<int>(lx / m_grid_h) + 1;
+    m_grid_ny = static_cast<int>(ly / m_grid_h) + 1;
+
+    // Count the segments in each cell, then fill the cell lists
+    size_t nc = static_cast<size_t>(m_grid_nx) * m_grid_ny;
+    m_grid_start.assign(nc + 1, 0);
+    for (int pass = 0; pass < 2; pass++) {
+        if (pass == 1) {
+            for (size_t c = 0; c < nc; c++)
+                m_grid_start[c + 1] += m_grid_start[c];
+            m_grid_segs.resize(m_grid_start.back());
+        }
+        for (size_t i = 0; i < ns; i++) {
+            int ix0 = ChClamp(static_cast<int>((m_seg_min[i].x() - m_grid_x0) / m_grid_h), 0, m_grid_nx - 1);
+            int ix1 = ChClamp(static_cast<int>((m_seg_max[i].x() - m_grid_x0) / m_grid_h), 0, m_grid_nx - 1);
+            int iy0 = ChClamp(static_cast<int>((m_seg_min[i].y() - m_grid_y0) / m_grid_h), 0, m_grid_ny - 1);
+            int iy1 = ChClamp(static_cast<int>((m_seg_max[i].y() - m_grid_y0) / m_grid_h), 0, m_grid_ny - 1);
+            for (int ix = ix0; ix <= ix1; ix++) {
+                for (int iy = iy0; iy <= iy1; iy++) {
+                    size_t c = static_cast<size_t>(ix) * m_grid_ny + iy;
+                    if (pass == 0)
+                        m_grid_start[c + 1]++;
+                    else
+                        m_grid_segs[m_grid_start[c]++] = i;
+                }
+            }
+        }
+    }
+
+    // Restore the cell start offsets (shifted while filling the lists)
+    for (size_t c = nc; c > 0; c--)
+        m_grid_start[c] = m_grid_start[c - 1];
+    m_grid_start[0] = 0;
+}
+
+double ChBezierCurve::CalcBoxDistance2(const ChVector3d& loc, size_t i) const {
+    double d2 = 0;
+    for (int j = 0; j < 3; j++) {
+        double d = std::max(0.0, std::max(m_seg_min[i][j] - loc[j], loc[j] - m_seg_max[i][j]));
+        d2 += d * d;
+    }
+    return d2;
+}
+
+// -----------------------------------------------------------------------------
+// ChBezierCurve::FindClosestPoint()
+//
+// This function searches the entire curve for the closest point to the specified
+// location. Grid cells are visited in rings of increasing size around the cell
+// containing the location; segments whose bounding box is farther than the
+// current closest point are skipped. The search stops when the distance from the
+// location to the next ring exceeds the distance to the current closest point.
+// -----------------------------------------------------------------------------
+ChVector3d ChBezierCurve::FindClosestPoint(const ChVector3d& loc, size_t& i, double& t) const {
+    int cx = ChClamp(static_cast<int>(std::floor((loc.x() - m_grid_x0) / m_grid_h)), 0, m_grid_nx - 1);
+    int cy = ChClamp(static_cast<int>(std::floor((loc.y() - m_grid_y0) / m_grid_h)), 0, m_grid_ny - 1);
+
+    double d2_min = std::numeric_limits<double>::max();
+    ChVector3d point = m_points[0];
+    i = 0;
+    t = 0;
+
+    std::vector<size_t> tested;
+
+    for (int r = 0;; r++) {
+        if (r > 0) {
+            // Lower bound on the distance from the location to cells in ring r (ignore sides beyond the grid)
+            double inf = std::numeric_limits<double>::max();
+            double d_xm = (cx - r + 1 > 0) ? loc.x() - (m_grid_x0 + (cx - r + 1) * m_grid_h) : inf;
+            double d_xp = (cx + r < m_grid_nx) ? (m_grid_x0 + (cx + r) * m_grid_h) - loc.x() : inf;
+            double d_ym = (cy - r + 1 > 0) ? loc.y() - (m_grid_y0 + (cy - r + 1) * m_grid_h) : inf;
+            double d_yp = (cy + r < m_grid_ny) ? (m_grid_y0 + (cy + r) * m_grid_h) - loc.y() : inf;
+            double d = std::min(std::min(d_xm, d_xp), std::min(d_ym, d_yp));
+            if (d == inf)
+                break;
+            if (d > 0 && d * d >= d2_min)
+                break;
+        }
+
+        for (int ix = cx - r; ix <= cx + r; ix++) {
+            if (ix < 0 || ix >= m_grid_nx)
+                continue;
+            // Cells on the ring: all cells in the first and last columns, only two cells in other columns
+            int step = (ix == cx - r || ix == cx + r) ? 1 : std::max(1, 2 * r);
+            for (int iy = cy - r; iy <= cy + r; iy += step) {
+                if (iy < 0 || iy >= m_grid_ny)
+                    continue;
+                size_t c = static_cast<size_t>(ix) * m_grid_ny + iy;
+                for (size_t k = m_grid_start[c]; k < m_grid_start[c + 1]; k++) {
+                    size_t is = m_grid_segs[k];
+                    if (CalcBoxDistance2(loc, is) >= d2_min)
+                        continue;
+                    if (std::find(tested.begin(), tested.end(), is) != tested.end())
+                        continue;
+                    tested.push_back(is);
+                    double ts;
+                    auto pt = CalcClosestPoint(loc, is, ts);
+                    double d2 = (pt - loc).Length2();
+                    if (d2 < d2_min) {
+                        d2_min = d2;
+                        point = pt;
+                        i = is;
+                        t = ts;
+                    }
+                }
+            }
+        }
+    }
+
+    return point;
+}
+
 // -----------------------------------------------------------------------------
 
 void ChBezierCurve::ArchiveOut(ChArchiveOut& archive_out) {
@@ -581,6 +745,8 @@ void ChBezierCurve::ArchiveIn(ChArchiveIn& archive_in) {
     archive_in >> CHNVP(m_sqrDistTol);
     archive_in >> CHNVP(m_cosAngleTol);
     archive_in >> CHNVP(m_paramTol);
+
+    BuildIndex();
 }
 
 // -----------------------------------------------------------------------------
@@ -592,50 +758,11 @@ ChBezierCurveTracker::ChBezierCurveTracker(std::shared_ptr<ChBezierCurve> path)
 // ChBezierCurveTracker::Reset()
 //
 // This function reinitializes the pathTracker at the specified location. It
-// calculates an appropriate initial guess for the curve segment and sets the
-// curve parameter to 0.5.
+// performs a global search (using the spatial index of the curve) for the
+// curve interval and parameter of the closest point.
 // -----------------------------------------------------------------------------
-class PointSpec {
-  public:
-    PointSpec() {}
-    PointSpec(size_t index, double dist2) : m_index(index), m_dist2(dist2) {}
-
-    size_t m_index;
-    double m_dist2;
-};
-
-static bool comparePoints(const PointSpec& p1, const PointSpec& p2) {
-    return p1.m_dist2 < p2.m_dist2;
-}
-
 void ChBezierCurveTracker::Reset(const ChVector3d& loc) {
-    // Walk all curve points and calculate the distance to the specified reset
-    // location, then sort them in increasing order.
-    std::vector<PointSpec> points;
-
-    for (size_t i = 0; i < m_path->GetNumPoints(); i++)
-        points.push_back(PointSpec(i, (loc - m_path->m_points[i]).Length2()));
-
-    std::sort(points.begin(), points.end(), comparePoints);
-
-    // Set the initial guess to be at t=0.5 in either the interval starting at
-    // the point with minimum distance or in the previous interval.
-    m_curParam = 0.5f;
-    m_curInterval = points[0].m_index;
-
-    if (m_curInterval == 0)
-        return;
-
-    if (m_curInterval == m_path->GetNumPoints() - 1) {
-        m_curInterval--;
-        return;
-    }
-
-    ChVector3d loc2cur = m_path->m_points[m_curInterval] - loc;
-    ChVector3d loc2prev = m_path->m_points[m_curInterval - 1] - loc;
-
-    if (Vdot(loc2cur, loc2prev) < 0)
-        m_curInterval--;
+    m_path->FindClosestPoint(loc, m_curInterval, m_curParam);
 }
 
 // -----------------------------------------------------------------------------
@@ -653,111 +780,63 @@ void ChBezierCurveTracker::Reset(const ChVector3d& loc) {
 //  - find the closest point in the current interval of the Bezier curve to the
 //    specified location;
 //  - stop if the curve parameter is in (0, 1);
-//  - if the curve parameter is close to 0, check the previous interval, unless
-//    at the previous iteration the parameter was close to 1;
-//  - if the curve parameter is close to 1, check the next interval, unless at
-//    the previous iteration the parameter was close to 0.
+//  - if the curve parameter is close to 0, check the previous interval and move
+//    to it if it provides a closer point, unless the search is moving forward;
+//  - if the curve parameter is close to 1, check the next interval and move to
+//    it if it provides a closer point, unless the search is moving backward;
+//  - repeat until no neighboring interval provides a closer point.
+// This local search visits a number of intervals proportional to the distance
+// travelled since the last query, independent of the total number of intervals.
 // -----------------------------------------------------------------------------
 int ChBezierCurveTracker::CalcClosestPoint(const ChVector3d& loc, ChVector3d& point) {
+    size_t numIntervals = m_path->GetNumSegments();
+
     // Evaluate in current interval
     point = m_path->CalcClosestPoint(loc, m_curInterval, m_curParam);
-
-    if (m_curParam < ChBezierCurve::m_paramTol) {
-        // Close to lower limit. Consider previous interval
-        size_t prevInterval = m_curInterval - 1;
-        if (m_curInterval == 0) {
-            if (m_path->IsClosed())
-                prevInterval = m_path->GetNumPoints() - 2;
-            else
-                return -1;
-        }
-
-        // Check previous interval
-        double p_m;
-        auto pt_m = m_path->CalcClosestPoint(loc, prevInterval, p_m);
-
-        if ((pt_m - loc).Length2() < (point - loc).Length2()) {
-            ////std::cout << "loc = " << loc << "  DECREASE to " << m_curInterval - 1 << "  p = " << p_m
-            ////          << "    point: " << point << "  point minus: " << pt_m << std::endl;
-            m_curInterval = prevInterval;
-            m_curParam = p_m;
-            point = pt_m;
-        }
-
-        return 0;
-    } else if (m_curParam > 1 - ChBezierCurve::m_paramTol) {
-        // Close to upper limit. Consider next interval
-        size_t nextInterval = m_curInterval + 1;
-        if (m_curInterval == m_path->GetNumPoints() - 2) {
-            if (m_path->IsClosed())
-                nextInterval = 0;
-            else
-                return +1;
+    double d2 = (point - loc).Length2();
+
+    int dir = 0;
+    for (size_t k = 0; k < numIntervals; k++) {
+        size_t interval;
+        if (m_curParam < ChBezierCurve::m_paramTol && dir <= 0) {
+            // Close to lower limit. Consider previous interval
+            if (m_curInterval == 0) {
+                if (!m_path->IsClosed())
+                    return -1;
+                interval = numIntervals - 1;
+            } else {
+                interval = m_curInterval - 1;
+            }
+            dir = -1;
+        } else if (m_curParam > 1 - ChBezierCurve::m_paramTol && dir >= 0) {
+            // Close to upper limit. Consider next interval
+            if (m_curInterval == numIntervals - 1) {
+                if (!m_path->IsClosed())
+                    return +1;
+                interval = 0;
+            } else {
+                interval = m_curInterval + 1;
+            }
+            dir = +1;
+        } else {
+            // Not close to interval bounds. Done
+            break;
         }
 
-        // Check next interval
-        double p_p;
-        auto pt_p = m_path->CalcClosestPoint(loc, m_curInterval + 1, p_p);
-
-        if ((pt_p - loc).Length2() < (point - loc).Length2()) {
-            ////std::cout << "loc = " << loc << "  INCREASE to " << m_curInterval + 1 << "  p = " << p_p
-            ////          << "    point: " << point << "  point plus: " << pt_p << std::endl;
-            m_curInterval = nextInterval;
-            m_curParam = p_p;
-            point = pt_p;
-        }
+        // Check neighbor interval
+        double param;
+        auto pt = m_path->CalcClosestPoint(loc, interval, param);
+        double pt_d2 = (pt - loc).Length2();
+        if (pt_d2 >= d2)
+            break;
 
-        return 0;
-    } else {
-        // Not close to interval bounds. Done
-        return 0;
+        m_curInterval = interval;
+        m_curParam = param;
+        point = pt;
+        d2 = pt_d2;
     }
 
-    /*
-    bool lastAtMin = false;
-    bool lastAtMax = false;
-
-    while (true) {
-        point = m_path->CalcClosestPoint(loc, m_curInterval, m_curParam);
-
-        if (m_curParam < ChBezierCurve::m_paramTol) {
-            if ((m_curInterval == 0) && (!m_isClosedPath))
-                return -1;
-
-            if (lastAtMax)
-                return 0;
-
-            // If the search region is at the beginning of the interval check the
-            // previous interval.  Loop to the last interval if the path is a
-            // closed loop and is it is currently in the first interval
-            if ((m_curInterval == 0) && (m_isClosedPath))
-                m_curInterval = m_path->GetNumPoints() - 2;
-            else
-                m_curInterval--;
-
-            lastAtMin = true;
-            m_curParam = 1;
-        } else if (m_curParam > 1 - ChBezierCurve::m_paramTol) {
-            if ((m_curInterval == m_path->GetNumPoints() - 2) && (!m_isClosedPath))
-                return +1;
-
-            if (lastAtMin)
-                return 0;
-
-            // If the search region is at the end of the interval check the
-            // next interval.  Loop to the first interval if the path is a
-            // closed loop and is it is currently in the last interval
-            if ((m_curInterval == m_path->GetNumPoints() - 2) && (m_isClosedPath))
-                m_curInterval = 0;
-            else
-                m_curInterval++;
-
-            lastAtMax = true;
-            m_curParam = 0;
-        } else
-            return 0;
-    }
-    */
+    return 0;
 }
 
 int ChBezierCurveTracker::CalcClosestPoint(const ChVector3d& loc, ChFrame<>& tnb, double& curvature) {
@@ -138,6 +138,13 @@ class ChApi ChBezierCurve {
     /// to the closest point.
     ChVector3d CalcClosestPoint(const ChVector3d& loc, size_t i, double& t) const;
 
+    /// Find the closest point on the curve to the given location.
+    /// Unlike CalcClosestPoint, this function searches the entire curve. It uses a spatial index of the curve segments
+    /// (a uniform grid in the horizontal plane over the bounding boxes of the segment control polygons), such that
+    /// only segments near the given location are evaluated. On return, 'i' and 't' contain the interval and the curve
+    /// parameter corresponding to the closest point.
+    ChVector3d FindClosestPoint(const ChVector3d& loc, size_t& i, double& t) const;
+
     /// Write the knots and control points to the specified file.
     void Write(const std::string& filename);
 
@@ -165,12 +172,29 @@ class ChApi ChBezierCurve {
     /// resulting Bezier curve is a spline interpolant of the knots.
     static void SolveTriDiag(size_t n, double* rhs, double* x);
 
+    /// Build the spatial index of the curve segments.
+    /// This function must be called whenever the knots or the control points are modified.
+    void BuildIndex();
+
+    /// Return the squared distance from the given location to the bounding box of the specified segment.
+    double CalcBoxDistance2(const ChVector3d& loc, size_t i) const;
+
     std::vector<ChVector3d> m_points;  ///< set of knot points
     std::vector<ChVector3d> m_inCV;    ///< set on "incident" control points
     std::vector<ChVector3d> m_outCV;   ///< set of "outgoing" control points
 
     bool m_closed;  ///< treat the path as a closed loop curve
 
+    std::vector<ChVector3d> m_seg_min;  ///< lower corners of segment bounding boxes
+    std::vector<ChVector3d> m_seg_max;  ///< upper corners of segment bounding boxes
+    double m_grid_x0;                   ///< x coordinate of grid origin
+    double m_grid_y0;                   ///< y coordinate of grid origin
+    double m_grid_h;                    ///< grid cell size
+    int m_grid_nx;                      ///< number of grid cells in x direction
+    int m_grid_ny;                      ///< number of grid cells in y direction
+    std::vector<size_t> m_grid_start;   ///< start of each cell's list in m_grid_segs
+    std::vector<size_t> m_grid_segs;    ///< segments overlapping each grid cell
+
     static const size_t m_maxNumIters;  ///< maximum number of Newton iterations
     static const double m_sqrDistTol;   ///< tolerance on squared distance
     static const double m_cosAngleTol;  ///< tolerance for orthogonality test
@@ -184,7 +208,8 @@ class ChApi ChBezierCurve {
 ///
 /// This utility class implements a tracker for a given path. It uses time
 /// coherence in order to provide an appropriate initial guess for the
-/// iterative (Newton) root finder.
+/// iterative (Newton) root finder: the closest point is searched locally,
+/// starting from the curve interval of the previous query.
 // -----------------------------------------------------------------------------
 class ChApi ChBezierCurveTracker {
   public:
@@ -196,8 +221,8 @@ class ChApi ChBezierCurveTracker {
 
     /// Reset the tracker at the specified location.
     /// This function reinitializes the pathTracker at the specified location. It
-    /// calculates an appropriate initial guess for the curve segment and sets the
-    /// curve parameter to 0.5.
+    /// performs a global search (using the spatial index of the curve) for the
+    /// curve interval and parameter of the closest point.
     void Reset(const ChVector3d& loc);
 
     /// Calculate the closest point on the underlying curve to the specified location.
@@ -206,8 +231,10 @@ class ChApi ChBezierCurveTracker {
     /// first point of the path, +1 if it coincides with the last point of the path,
     /// and 0 otherwise. Note that, in order to provide a reasonable initial guess
     /// for the Newton iteration, we use time coherence (by keeping track of the path
-    /// interval and curve parameter within that interval from the last query). As
-    /// such, this function should be called with a continuous sequence of locations.
+    /// interval and curve parameter within that interval from the last query). The
+    /// search proceeds to neighboring intervals for as long as the distance decreases.
+    /// As such, this function should be called with a continuous sequence of locations
+    /// (call Reset after a discontinuous jump).
     int CalcClosestPoint(const ChVector3d& loc, ChVector3d& point);
 
     /// Calculate the closest point on the underlying curve to the specified location.
@@ -19,6 +19,13 @@
 
 namespace chrono {
 
+/// Derivative levels computed in compositions of moving frames.
+enum class ChFrameLevel {
+    POSITION,     ///< position and rotation only
+    VELOCITY,     ///< position, rotation, and their first derivatives
+    ACCELERATION  ///< position, rotation, and their first and second derivatives
+};
+
 /// Representation of a moving 3D.
 /// A ChFrameMoving is a ChFrame that also keeps track of the frame velocity and acceleration.
 ///
@@ -293,8 +300,7 @@ class ChFrameMoving : public ChFrame<Real> {
     ///  or
     ///     this' = this >> F
     void ConcatenatePreTransformation(const ChFrameMoving<Real>& F) {
-        auto tmp = F.TransformLocalToParent(*this);
-        *this = tmp;
+        F.template TransformLocalToParent<ChFrameLevel::ACCELERATION>(*this, *this);
     }
 
     /// Apply a transformation (rotation and translation) represented by another frame F in local coordinate.
@@ -303,8 +309,7 @@ class ChFrameMoving : public ChFrame<Real> {
     ///  or
     ///    this'= F >> this
     void ConcatenatePostTransformation(const ChFrameMoving<Real>& F) {
-        auto tmp = this->TransformLocalToParent(F);
-        *this = tmp;
+        this->template TransformLocalToParent<ChFrameLevel::ACCELERATION>(F, *this);
     }
 
     // FUNCTIONS FOR COORDINATE TRANSFORMATIONS
@@ -371,22 +376,42 @@ class ChFrameMoving : public ChFrame<Real> {
 
     /// Transform a moving frame from 'this' local coordinate system to parent frame coordinate system.
     ChFrameMoving<Real> TransformLocalToParent(const ChFrameMoving<Real>& F) const {
-        ChFrameMoving<Real> Fp(this->TransformPointLocalToParent(F.m_csys.pos), this->m_csys.rot * F.m_csys.rot);
+        ChFrameMoving<Real> Fp;
+        TransformLocalToParent<ChFrameLevel::ACCELERATION>(F, Fp);
+        return Fp;
+    }
 
-        // pos_dt
-        Fp.m_csys_dt.pos = PointSpeedLocalToParent(F.m_csys.pos, F.m_csys_dt.pos);
+    /// Transform a moving frame from 'this' local coordinate system to parent frame coordinate system, computing only
+    /// the derivatives up to the specified level and writing the result in Fp.
+    /// Derivatives above the specified level are left unchanged in Fp. The output frame may coincide with F or with
+    /// this frame (in-place composition).
+    template <ChFrameLevel L>
+    void TransformLocalToParent(const ChFrameMoving<Real>& F, ChFrameMoving<Real>& Fp) const {
+        ChVector3<Real> pos = this->TransformPointLocalToParent(F.m_csys.pos);
+        ChQuaternion<Real> rot = this->m_csys.rot * F.m_csys.rot;
 
-        // pos_dtdt
-        Fp.m_csys_dtdt.pos = PointAccelerationLocalToParent(F.m_csys.pos, F.m_csys_dt.pos, F.m_csys_dtdt.pos);
+        ChCoordsys<Real> csys_dt;
+        ChCoordsys<Real> csys_dtdt;
 
-        // rot_dt
-        Fp.m_csys_dt.rot = this->m_csys_dt.rot * F.m_csys.rot + this->m_csys.rot * F.m_csys_dt.rot;
+        if (L != ChFrameLevel::POSITION) {
+            // pos_dt and rot_dt
+            csys_dt.pos = PointSpeedLocalToParent(F.m_csys.pos, F.m_csys_dt.pos);
+            csys_dt.rot = this->m_csys_dt.rot * F.m_csys.rot + this->m_csys.rot * F.m_csys_dt.rot;
+        }
 
-        // rot_dtdt
-        Fp.m_csys_dtdt.rot = this->m_csys_dtdt.rot * F.m_csys.rot + (this->m_csys_dt.rot * F.m_csys_dt.rot) * 2 +
-                             this->m_csys.rot * F.m_csys_dtdt.rot;
+        if (L == ChFrameLevel::ACCELERATION) {
+            // pos_dtdt and rot_dtdt
+            csys_dtdt.pos = PointAccelerationLocalToParent(F.m_csys.pos, F.m_csys_dt.pos, F.m_csys_dtdt.pos);
+            csys_dtdt.rot = this->m_csys_dtdt.rot * F.m_csys.rot + (this->m_csys_dt.rot * F.m_csys_dt.rot) * 2 +
+                            this->m_csys.rot * F.m_csys_dtdt.rot;
+        }
 
-        return Fp;
+        // Assign only after all terms were evaluated, to allow aliasing of Fp with F or this frame
+        Fp.SetCoordsys(pos, rot);
+        if (L != ChFrameLevel::POSITION)
+            Fp.m_csys_dt = csys_dt;
+        if (L == ChFrameLevel::ACCELERATION)
+            Fp.m_csys_dtdt = csys_dtdt;
     }
 
     /// Transform a moving frame from the parent coordinate system to 'this' local frame coordinate system.
@@ -476,6 +501,27 @@ class ChFrameMoving : public ChFrame<Real> {
 CH_CLASS_VERSION(ChFrameMoving<double>, 0)
 CH_CLASS_VERSION(ChFrameMoving<float>, 0)
 
+// COMPOSITION OF FRAME CHAINS
+
+/// Compose a chain of moving frames, result = F1 * F2 * ... * Fn, computing only the derivatives up to level L.
+/// The chain is evaluated in place in the result frame, without intermediate temporary frames. The result frame may
+/// coincide with F1 (but not with the other frames in the chain).
+template <ChFrameLevel L, class Real>
+void ComposeFrames(ChFrameMoving<Real>& result, const ChFrameMoving<Real>& F1) {
+    if (&result != &F1)
+        result = F1;
+}
+
+template <ChFrameLevel L, class Real, class... Frames>
+void ComposeFrames(ChFrameMoving<Real>& result,
+                   const ChFrameMoving<Real>& F1,
+                   const ChFrameMoving<Real>& F2,
+                   const Frames&... others) {
+    ComposeFrames<L>(result, F1);
+    result.template TransformLocalToParent<L>(F2, result);
+    ComposeFrames<L>(result, result, others...);
+}
+
 // MIXED ARGUMENT OPERATORS
 
 // Mixing with ChFrame
@@ -0,0 +1,254 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Work-stealing task scheduler shared by all Chrono modules.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#elif defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+#include "chrono/core/ChTaskScheduler.h"
+
+namespace chrono {
+
+// Scheduler owning the current thread (if a worker) and index of its queue
+static thread_local const ChTaskScheduler* tl_scheduler = nullptr;
+static thread_local int tl_index = -1;
+
+// -----------------------------------------------------------------------------
+
+ChTaskScheduler::TaskGroup::TaskGroup(ChTaskScheduler& scheduler) : m_scheduler(scheduler), m_pending(0) {}
+
+ChTaskScheduler::TaskGroup::~TaskGroup() {
+    // Do not propagate exceptions from the destructor
+    while (m_pending.load() > 0) {
+        if (!m_scheduler.RunPendingTask())
+            std::this_thread::yield();
+    }
+}
+
+void ChTaskScheduler::TaskGroup::Run(std::function<void()> task) {
+    m_pending++;
+    m_scheduler.Push({std::move(task), this});
+}
+
+void ChTaskScheduler::TaskGroup::Wait() {
+    while (m_pending.load() > 0) {
+        if (!m_scheduler.RunPendingTask())
+            std::this_thread::yield();
+    }
+
+    std::exception_ptr e;
+    {
+        std::lock_guard<std::mutex> lock(m_exception_mutex);
+        std::swap(e, m_exception);
+    }
+    if (e)
+        std::rethrow_exception(e);
+}
+
+// -----------------------------------------------------------------------------
+
+ChTaskScheduler::ChTaskScheduler(int num_threads) : m_stop(false), m_num_queued(0), m_pin(false) {
+    Start(num_threads);
+}
+
+ChTaskScheduler::~ChTaskScheduler() {
+    Stop();
+}
+
+bool ChTaskScheduler::PinThread(int cpu) {
+#if defined(_WIN32)
+    return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu) != 0;
+#elif defined(__linux__)
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(cpu, &cpuset);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+ChTaskScheduler& ChTaskScheduler::GetGlobal() {
+    static ChTaskScheduler scheduler;
+    return scheduler;
+}
+
+void ChTaskScheduler::SetNumThreads(int num_threads) {
+    Stop();
+    Start(num_threads);
+}
+
+void ChTaskScheduler::EnableCorePinning(bool val) {
+    if (val == m_pin)
+        return;
+    int num_threads = GetNumThreads();
+    Stop();
+    m_pin = val;
+    Start(num_threads);
+}
+
+void ChTaskScheduler::Start(int num_threads) {
+    if (num_threads <= 0)
+        num_threads = std::max(1, (int)std::thread::hardware_concurrency());
+    int num_workers = num_threads - 1;
+
+    m_queues.clear();
+    for (int i = 0; i <= num_workers; i++)
+        m_queues.push_back(std::unique_ptr<Queue>(new Queue));
+
+    m_stop = false;
+    for (int i = 0; i < num_workers; i++)
+        m_workers.push_back(std::thread(&ChTaskScheduler::WorkerLoop, this, i));
+}
+
+void ChTaskScheduler::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (auto& worker : m_workers)
+        worker.join();
+    m_workers.clear();
+}
+
+void ChTaskScheduler::WorkerLoop(int index) {
+    tl_scheduler = this;
+    tl_index = index;
+
+    if (m_pin) {
+        int num_cpus = std::max(1, (int)std::thread::hardware_concurrency());
+        PinThread((index + 1) % num_cpus);
+    }
+
+    while (!m_stop) {
+        if (RunPendingTask())
+            continue;
+        std::unique_lock<std::mutex> lock(m_sleep_mutex);
+        m_wake.wait(lock, [this]() { return m_stop || m_num_queued.load() > 0; });
+    }
+
+    tl_scheduler = nullptr;
+    tl_index = -1;
+}
+
+int ChTaskScheduler::QueueIndex() const {
+    return (tl_scheduler == this) ? tl_index : (int)m_queues.size() - 1;
+}
+
+void ChTaskScheduler::Push(Task&& task) {
+    auto& queue = *m_queues[QueueIndex()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        m_num_queued++;
+    }
+    m_wake.notify_one();
+}
+
+bool ChTaskScheduler::RunPendingTask() {
+    int num_queues = (int)m_queues.size();
+    int own = QueueIndex();
+    Task task;
+    bool found = false;
+
+    // Pop the most recently pushed task from the own queue (LIFO, for locality of nested tasks)
+    {
+        auto& queue = *m_queues[own];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            found = true;
+        }
+    }
+
+    // Otherwise, steal the oldest task from another queue (FIFO, largest remaining work)
+    for (int k = 1; k < num_queues && !found; k++) {
+        auto& queue = *m_queues[(own + k) % num_queues];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            found = true;
+        }
+    }
+
+    if (!found)
+        return false;
+
+    m_num_queued--;
+
+    try {
+        task.func();
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(task.group->m_exception_mutex);
+        if (!task.group->m_exception)
+            task.group->m_exception = std::current_exception();
+    }
+    task.group->m_pending--;
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChTaskScheduler::ParallelFor(int begin, int end, const std::function<void(int)>& body, int num_tasks) {
+    int n = end - begin;
+    if (n <= 0)
+        return;
+
+    if (num_tasks <= 0)
+        num_tasks = 4 * GetNumThreads();
+    num_tasks = std::min(num_tasks, n);
+
+    if (num_tasks == 1 || GetNumThreads() == 1) {
+        for (int i = begin; i < end; i++)
+            body(i);
+        return;
+    }
+
+    // Split the range in chunks of nearly equal size
+    TaskGroup group(*this);
+    int chunk = n / num_tasks;
+    int extra = n % num_tasks;
+    int start = begin;
+    for (int t = 0; t < num_tasks; t++) {
+        int stop = start + chunk + (t < extra ? 1 : 0);
+        group.Run([start, stop, &body]() {
+            for (int i = start; i < stop; i++)
+                body(i);
+        });
+        start = stop;
+    }
+    group.Wait();
+}
+
+}  // end namespace chrono
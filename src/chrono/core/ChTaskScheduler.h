@@ -0,0 +1,145 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Work-stealing task scheduler shared by all Chrono modules.
+//
+// =============================================================================
+
+#ifndef CH_TASK_SCHEDULER_H
+#define CH_TASK_SCHEDULER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+/// @addtogroup chrono
+/// @{
+
+/// Work-stealing task scheduler.
+/// The scheduler manages a pool of worker threads, each with its own double-ended task queue. A worker pushes and pops
+/// tasks at the back of its own queue and, when that is empty, steals tasks from the front of the queues of other
+/// workers. Tasks submitted from threads outside the pool are placed in a separate injection queue.
+///
+/// Threads waiting on a task group participate in the execution of pending tasks, so that tasks can themselves spawn
+/// and wait on nested task groups (nested parallelism) without deadlock or thread oversubscription.
+///
+/// A single global scheduler (see GetGlobal) is meant to be shared by all Chrono modules, so that running several
+/// parallel components together (e.g., a vehicle on SCM terrain with sensors) does not oversubscribe the cores.
+class ChApi ChTaskScheduler {
+  public:
+    /// Group of tasks that can be waited on collectively.
+    class ChApi TaskGroup {
+      public:
+        TaskGroup(ChTaskScheduler& scheduler);
+
+        /// Destructor; waits for completion of all tasks in the group.
+        ~TaskGroup();
+
+        /// Submit a task for asynchronous execution.
+        void Run(std::function<void()> task);
+
+        /// Wait until all tasks in this group were executed.
+        /// The calling thread executes pending tasks while waiting. If any task in the group threw an exception, the
+        /// first such exception is rethrown here.
+        void Wait();
+
+      private:
+        ChTaskScheduler& m_scheduler;
+        std::atomic<int> m_pending;      ///< number of submitted tasks not yet completed
+        std::mutex m_exception_mutex;    ///< protects the stored exception
+        std::exception_ptr m_exception;  ///< first exception thrown by a task in this group
+
+        friend class ChTaskScheduler;
+    };
+
+    /// Create a scheduler using the specified total number of threads.
+    /// This number includes the calling threads, which participate in task execution while waiting: a scheduler with
+    /// N threads spawns N-1 workers. If num_threads = 0, the number of hardware threads is used.
+    ChTaskScheduler(int num_threads = 0);
+
+    ~ChTaskScheduler();
+
+    /// Return the global scheduler shared by all Chrono modules.
+    static ChTaskScheduler& GetGlobal();
+
+    /// Set the total number of threads (see constructor). The worker pool is restarted.
+    /// This function must not be called while tasks are being executed.
+    void SetNumThreads(int num_threads);
+
+    /// Get the total number of threads (workers and calling thread).
+    int GetNumThreads() const { return (int)m_workers.size() + 1; }
+
+    /// Enable/disable pinning of the worker threads to cores (default: false).
+    /// If enabled, worker k is pinned to core (k+1) modulo the number of hardware threads, leaving core 0 to the
+    /// calling (main) thread. Supported on Windows and Linux only. The worker pool is restarted.
+    void EnableCorePinning(bool val);
+
+    /// Pin the calling thread to the specified core (logical CPU index).
+    /// Supported on Windows and Linux only. Return false on failure or if not supported.
+    static bool PinThread(int cpu);
+
+    /// Execute body(i) for all i in [begin, end).
+    /// The range is split in num_tasks contiguous chunks executed in parallel; the calling thread blocks (helping with
+    /// task execution) until all iterations were performed. If num_tasks = 0, the range is split in 4 chunks per
+    /// thread; if num_tasks = 1, the loop is executed sequentially in the calling thread.
+    void ParallelFor(int begin, int end, const std::function<void(int)>& body, int num_tasks = 0);
+
+  private:
+    struct Task {
+        std::function<void()> func;  ///< task function
+        TaskGroup* group;            ///< owning task group
+    };
+
+    struct Queue {
+        std::mutex mutex;         ///< protects the task deque
+        std::deque<Task> tasks;   ///< pending tasks
+    };
+
+    void Start(int num_threads);
+    void Stop();
+    void WorkerLoop(int index);
+
+    /// Submit a task to the queue of the current thread (or to the injection queue).
+    void Push(Task&& task);
+
+    /// Execute one pending task, if any. Return false if no task was found.
+    bool RunPendingTask();
+
+    /// Index of the queue owned by the current thread (the injection queue for external threads).
+    int QueueIndex() const;
+
+    std::vector<std::unique_ptr<Queue>> m_queues;  ///< worker queues, followed by the injection queue
+    std::vector<std::thread> m_workers;            ///< worker threads
+    std::atomic<bool> m_stop;                      ///< signal workers to exit
+    std::atomic<int> m_num_queued;                 ///< number of tasks in all queues
+    std::mutex m_sleep_mutex;                      ///< mutex for idle workers
+    std::condition_variable m_wake;                ///< idle workers wait on this condition
+    bool m_pin;                                    ///< pin workers to cores?
+};
+
+/// @} chrono
+
+}  // end namespace chrono
+
+#endif
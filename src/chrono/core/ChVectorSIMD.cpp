@@ -0,0 +1,123 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/core/ChVectorSIMD.h"
+
+namespace chrono {
+
+void TransformPointsSIMD(const ChMatrix33<>& A,
+                         const ChVector3d& displ,
+                         size_t n,
+                         const double* x,
+                         const double* y,
+                         const double* z,
+                         double* X,
+                         double* Y,
+                         double* Z) {
+    size_t i = 0;
+
+#ifdef CHRONO_VECTOR_SIMD_AVX
+    // Process 4 points at a time, with broadcast matrix coefficients
+    const __m256d a00 = _mm256_set1_pd(A(0, 0));
+    const __m256d a01 = _mm256_set1_pd(A(0, 1));
+    const __m256d a02 = _mm256_set1_pd(A(0, 2));
+    const __m256d a10 = _mm256_set1_pd(A(1, 0));
+    const __m256d a11 = _mm256_set1_pd(A(1, 1));
+    const __m256d a12 = _mm256_set1_pd(A(1, 2));
+    const __m256d a20 = _mm256_set1_pd(A(2, 0));
+    const __m256d a21 = _mm256_set1_pd(A(2, 1));
+    const __m256d a22 = _mm256_set1_pd(A(2, 2));
+    const __m256d d0 = _mm256_set1_pd(displ.x());
+    const __m256d d1 = _mm256_set1_pd(displ.y());
+    const __m256d d2 = _mm256_set1_pd(displ.z());
+
+    for (; i + 4 <= n; i += 4) {
+        __m256d vx = _mm256_loadu_pd(x + i);
+        __m256d vy = _mm256_loadu_pd(y + i);
+        __m256d vz = _mm256_loadu_pd(z + i);
+
+        __m256d rx = _mm256_add_pd(_mm256_mul_pd(a00, vx), _mm256_mul_pd(a01, vy));
+        __m256d ry = _mm256_add_pd(_mm256_mul_pd(a10, vx), _mm256_mul_pd(a11, vy));
+        __m256d rz = _mm256_add_pd(_mm256_mul_pd(a20, vx), _mm256_mul_pd(a21, vy));
+        rx = _mm256_add_pd(rx, _mm256_mul_pd(a02, vz));
+        ry = _mm256_add_pd(ry, _mm256_mul_pd(a12, vz));
+        rz = _mm256_add_pd(rz, _mm256_mul_pd(a22, vz));
+
+        _mm256_storeu_pd(X + i, _mm256_add_pd(d0, rx));
+        _mm256_storeu_pd(Y + i, _mm256_add_pd(d1, ry));
+        _mm256_storeu_pd(Z + i, _mm256_add_pd(d2, rz));
+    }
+#endif
+
+    // Remaining points (all points if AVX not available)
+    for (; i < n; i++) {
+        double vx = x[i];
+        double vy = y[i];
+        double vz = z[i];
+        X[i] = displ.x() + (A(0, 0) * vx + A(0, 1) * vy + A(0, 2) * vz);
+        Y[i] = displ.y() + (A(1, 0) * vx + A(1, 1) * vy + A(1, 2) * vz);
+        Z[i] = displ.z() + (A(2, 0) * vx + A(2, 1) * vy + A(2, 2) * vz);
+    }
+}
+
+void TransformPointsLocalToParentSIMD(const ChFrame<double>& frame,
+                                      size_t n,
+                                      const double* x,
+                                      const double* y,
+                                      const double* z,
+                                      double* X,
+                                      double* Y,
+                                      double* Z) {
+    TransformPointsSIMD(frame.GetRotMat(), frame.GetPos(), n, x, y, z, X, Y, Z);
+}
+
+void TransformPointsParentToLocalSIMD(const ChFrame<double>& frame,
+                                      size_t n,
+                                      const double* x,
+                                      const double* y,
+                                      const double* z,
+                                      double* X,
+                                      double* Y,
+                                      double* Z) {
+    // v_local = A^T * (v - p) = A^T * v - A^T * p
+    ChMatrix33<> At = frame.GetRotMat().transpose();
+    ChVector3d displ = -(At * frame.GetPos());
+    TransformPointsSIMD(At, displ, n, x, y, z, X, Y, Z);
+}
+
+void TransformPointsSIMD(const ChMatrix33<>& A, const ChVector3d& displ, std::vector<ChVector3d>& points) {
+    // Convert blocks of points to structure-of-arrays form, transform, and copy back
+    const size_t block = 256;
+    alignas(32) double x[block];
+    alignas(32) double y[block];
+    alignas(32) double z[block];
+
+    size_t n = points.size();
+    for (size_t start = 0; start < n; start += block) {
+        size_t count = std::min(block, n - start);
+        for (size_t k = 0; k < count; k++) {
+            const auto& p = points[start + k];
+            x[k] = p.x();
+            y[k] = p.y();
+            z[k] = p.z();
+        }
+        TransformPointsSIMD(A, displ, count, x, y, z, x, y, z);
+        for (size_t k = 0; k < count; k++)
+            points[start + k].Set(x[k], y[k], z[k]);
+    }
+}
+
+}  // end namespace chrono
@@ -0,0 +1,144 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// SIMD kernels for frame and quaternion operations.
+//
+// These are opt-in alternatives to the scalar ChVector3d/ChQuaterniond/ChFrame
+// operations for use in hot loops. If Chrono is configured with AVX support, the
+// kernels use 4-wide double-precision AVX instructions; otherwise they fall back
+// to scalar code. Results agree with the scalar operations to round-off.
+//
+// =============================================================================
+
+#ifndef CH_VECTOR_SIMD_H
+#define CH_VECTOR_SIMD_H
+
+#include <cstddef>
+#include <vector>
+
+#include "chrono/ChConfig.h"
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChFrame.h"
+
+#if defined(CHRONO_HAS_AVX) && defined(CHRONO_SIMD_ENABLED) && !defined(__CUDACC__)
+    #include <immintrin.h>
+    #define CHRONO_VECTOR_SIMD_AVX
+#endif
+
+namespace chrono {
+
+/// @addtogroup chrono_linalg
+/// @{
+
+/// 3D vector padded to 4 components and aligned for SIMD loads and stores.
+/// The 4th component is always zero.
+struct alignas(32) ChVector3dPadded {
+    ChVector3d ToVector() const { return ChVector3d(data[0], data[1], data[2]); }
+
+    ChVector3dPadded() : data{0, 0, 0, 0} {}
+    ChVector3dPadded(const ChVector3d& v) : data{v.x(), v.y(), v.z(), 0} {}
+
+    double data[4];  ///< vector components (x, y, z, 0)
+};
+
+/// Quaternion product, q = qa * qb (same as ChQuaterniond::operator*).
+inline ChQuaterniond QuatProductSIMD(const ChQuaterniond& qa, const ChQuaterniond& qb) {
+#ifdef CHRONO_VECTOR_SIMD_AVX
+    // q = a0 * [b0, b1, b2, b3] + a1 * [-b1, b0, -b3, b2] + a2 * [-b2, b3, b0, -b1] + a3 * [-b3, -b2, b1, b0]
+    const __m256d sign1 = _mm256_set_pd(0.0, -0.0, 0.0, -0.0);
+    const __m256d sign2 = _mm256_set_pd(-0.0, 0.0, 0.0, -0.0);
+    const __m256d sign3 = _mm256_set_pd(0.0, 0.0, -0.0, -0.0);
+
+    __m256d b = _mm256_loadu_pd(qb.data());
+    __m256d b1 = _mm256_xor_pd(_mm256_permute_pd(b, 0x5), sign1);   // [b1, b0, b3, b2]
+    __m256d b2 = _mm256_permute2f128_pd(b, b, 0x1);                 // [b2, b3, b0, b1]
+    __m256d b3 = _mm256_xor_pd(_mm256_permute_pd(b2, 0x5), sign3);  // [b3, b2, b1, b0]
+    b2 = _mm256_xor_pd(b2, sign2);
+
+    __m256d q = _mm256_mul_pd(_mm256_set1_pd(qa.e0()), b);
+    q = _mm256_add_pd(q, _mm256_mul_pd(_mm256_set1_pd(qa.e1()), b1));
+    q = _mm256_add_pd(q, _mm256_mul_pd(_mm256_set1_pd(qa.e2()), b2));
+    q = _mm256_add_pd(q, _mm256_mul_pd(_mm256_set1_pd(qa.e3()), b3));
+
+    ChQuaterniond res;
+    _mm256_storeu_pd(res.data(), q);
+    return res;
+#else
+    return qa * qb;
+#endif
+}
+
+/// Transform a point from the local coordinate system of the given frame to the parent coordinate system
+/// (same as ChFrame::TransformPointLocalToParent).
+inline ChVector3d TransformPointLocalToParentSIMD(const ChFrame<double>& frame, const ChVector3d& v) {
+#ifdef CHRONO_VECTOR_SIMD_AVX
+    // Columns of the (row-major) rotation matrix, padded to 4 components
+    const double* A = frame.GetRotMat().data();
+    const ChVector3d& p = frame.GetPos();
+    __m256d r = _mm256_set_pd(0.0, p.z(), p.y(), p.x());
+    r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_set_pd(0.0, A[6], A[3], A[0]), _mm256_set1_pd(v.x())));
+    r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_set_pd(0.0, A[7], A[4], A[1]), _mm256_set1_pd(v.y())));
+    r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_set_pd(0.0, A[8], A[5], A[2]), _mm256_set1_pd(v.z())));
+
+    ChVector3dPadded res;
+    _mm256_store_pd(res.data, r);
+    return res.ToVector();
+#else
+    return frame.TransformPointLocalToParent(v);
+#endif
+}
+
+/// Batched transformation of points in structure-of-arrays form, X = displ + A * x.
+/// The input and output arrays, of length n, may coincide (in-place transformation).
+ChApi void TransformPointsSIMD(const ChMatrix33<>& A,
+                               const ChVector3d& displ,
+                               size_t n,
+                               const double* x,
+                               const double* y,
+                               const double* z,
+                               double* X,
+                               double* Y,
+                               double* Z);
+
+/// Batched transformation of points in structure-of-arrays form, from the local coordinate system of the given frame
+/// to the parent coordinate system. The input and output arrays, of length n, may coincide.
+ChApi void TransformPointsLocalToParentSIMD(const ChFrame<double>& frame,
+                                            size_t n,
+                                            const double* x,
+                                            const double* y,
+                                            const double* z,
+                                            double* X,
+                                            double* Y,
+                                            double* Z);
+
+/// Batched transformation of points in structure-of-arrays form, from the parent coordinate system to the local
+/// coordinate system of the given frame. The input and output arrays, of length n, may coincide.
+ChApi void TransformPointsParentToLocalSIMD(const ChFrame<double>& frame,
+                                            size_t n,
+                                            const double* x,
+                                            const double* y,
+                                            const double* z,
+                                            double* X,
+                                            double* Y,
+                                            double* Z);
+
+/// Batched in-place transformation of an array of points, p = displ + A * p.
+/// The points are processed in blocks, converted to structure-of-arrays form.
+ChApi void TransformPointsSIMD(const ChMatrix33<>& A, const ChVector3d& displ, std::vector<ChVector3d>& points);
+
+/// @} chrono_linalg
+
+}  // end namespace chrono
+
+#endif
@@ -565,7 +565,7 @@ void ChContactTriangleXYZRot::ComputeUVfromP(const ChVector3d P, double& u, doub
 // ChContactSurfaceMesh
 
 ChContactSurfaceMesh::ChContactSurfaceMesh(std::shared_ptr<ChContactMaterial> material, ChMesh* mesh)
-    : ChContactSurface(material, mesh) {}
+    : ChContactSurface(material, mesh), m_use_collision_system(true) {}
 
 void ChContactSurfaceMesh::AddFace(std::shared_ptr<ChNodeFEAxyz> node1,
                                    std::shared_ptr<ChNodeFEAxyz> node2,
@@ -1323,6 +1323,8 @@ unsigned int ChContactSurfaceMesh::GetNumVertices() const {
 }
 
 void ChContactSurfaceMesh::SyncCollisionModels() const {
+    if (!m_use_collision_system)
+        return;
     for (auto& face : m_faces) {
         face->GetCollisionModel()->SyncPosition();
     }
@@ -1332,6 +1334,8 @@ void ChContactSurfaceMesh::SyncCollisionModels() const {
 }
 
 void ChContactSurfaceMesh::AddCollisionModelsToSystem(ChCollisionSystem* coll_sys) const {
+    if (!m_use_collision_system)
+        return;
     SyncCollisionModels();
     for (const auto& face : m_faces) {
         coll_sys->Add(face->GetCollisionModel());
@@ -1342,6 +1346,8 @@ void ChContactSurfaceMesh::AddCollisionModelsToSystem(ChCollisionSystem* coll_sy
 }
 
 void ChContactSurfaceMesh::RemoveCollisionModelsFromSystem(ChCollisionSystem* coll_sys) const {
+    if (!m_use_collision_system)
+        return;
     for (const auto& face : m_faces) {
         coll_sys->Remove(face->GetCollisionModel());
     }
@@ -516,6 +516,15 @@ class ChApi ChContactSurfaceMesh : public ChContactSurface {
     /// Get the number of vertices.
     unsigned int GetNumVertices() const;
 
+    /// Enable/disable the use of the collision system for this contact surface (default: true).
+    /// If disabled, the collision models of the triangles are not added to the system's collision system and collision
+    /// detection for this surface must be performed by a custom collision stage (see ChContactSurfaceMeshBVH).
+    /// Note: this function must be called before the system is initialized.
+    void EnableCollisionSystem(bool val) { m_use_collision_system = val; }
+
+    /// Return true if the triangles of this contact surface are processed by the collision system.
+    bool IsCollisionSystemEnabled() const { return m_use_collision_system; }
+
     // Functions to interface this with ChPhysicsItem container
     virtual void SyncCollisionModels() const override;
     virtual void AddCollisionModelsToSystem(ChCollisionSystem* coll_sys) const override;
@@ -540,6 +549,7 @@ class ChApi ChContactSurfaceMesh : public ChContactSurface {
 
     std::vector<std::shared_ptr<ChContactTriangleXYZ>> m_faces;         ///< collision faces with XYZ nodes
     std::vector<std::shared_ptr<ChContactTriangleXYZRot>> m_faces_rot;  ///< collision faces with XYZRot nodes
+    bool m_use_collision_system;                                        ///< collision models in collision system?
 };
 
 /// @} fea_contact
@@ -0,0 +1,259 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/collision/ChCollisionShapePoint.h"
+#include "chrono/collision/ChCollisionShapeSphere.h"
+#include "chrono/fea/ChContactSurfaceMeshBVH.h"
+#include "chrono/physics/ChContactContainer.h"
+#include "chrono/utils/ChUtilsGeometry.h"
+
+namespace chrono {
+namespace fea {
+
+// Maximum number of triangles in a leaf of the hierarchy
+static const unsigned int max_leaf_size = 4;
+
+ChContactSurfaceMeshBVH::ChContactSurfaceMeshBVH(std::shared_ptr<ChContactSurfaceMesh> surface)
+    : m_surface(surface),
+      m_envelope(ChCollisionModel::GetDefaultSuggestedEnvelope()),
+      m_valid(false),
+      m_num_builds(0),
+      m_num_contacts(0) {
+    m_surface->EnableCollisionSystem(false);
+}
+
+void ChContactSurfaceMeshBVH::AddNodeCloud(std::shared_ptr<ChContactSurfaceNodeCloud> cloud) {
+    m_clouds.push_back(cloud);
+}
+
+void ChContactSurfaceMeshBVH::AddBody(std::shared_ptr<ChBody> body) {
+    m_bodies.push_back(body);
+}
+
+void ChContactSurfaceMeshBVH::CollectTriangles() {
+    m_triangles.clear();
+    m_triangles.reserve(m_surface->GetNumTriangles());
+
+    auto add = [this](ChContactable* face) {
+        auto model = face->GetCollisionModel().get();
+        auto shape = std::static_pointer_cast<ChCollisionShapeMeshTriangle>(model->GetShapeInstance(0).first);
+        m_triangles.push_back({model, shape.get(), shape->GetMaterial()});
+    };
+    for (const auto& face : m_surface->GetTrianglesXYZ())
+        add(face.get());
+    for (const auto& face : m_surface->GetTrianglesXYZRot())
+        add(face.get());
+}
+
+void ChContactSurfaceMeshBVH::Build() {
+    CollectTriangles();
+
+    auto num_triangles = (unsigned int)m_triangles.size();
+    m_order.resize(num_triangles);
+    for (unsigned int i = 0; i < num_triangles; i++)
+        m_order[i] = i;
+
+    std::vector<ChVector3d> centroids(num_triangles);
+    for (unsigned int i = 0; i < num_triangles; i++) {
+        const auto& tri = *m_triangles[i].shape;
+        centroids[i] = (*tri.V1 + *tri.V2 + *tri.V3) / 3;
+    }
+
+    m_tree.clear();
+    m_tree.reserve(2 * (num_triangles / max_leaf_size + 1));
+    if (num_triangles > 0)
+        BuildNode(0, num_triangles, centroids);
+
+    m_valid = true;
+    m_num_builds++;
+}
+
+// Recursively build the subtree for the triangles m_order[first, first+count), splitting at the median of the
+// triangle centroids along the longest axis of their bounding box. Return the index of the subtree root.
+unsigned int ChContactSurfaceMeshBVH::BuildNode(unsigned int first,
+                                                unsigned int count,
+                                                std::vector<ChVector3d>& centroids) {
+    auto index = (unsigned int)m_tree.size();
+    m_tree.push_back({ChAABB(), 0, first, 0});
+
+    if (count <= max_leaf_size) {
+        m_tree[index].count = count;
+        return index;
+    }
+
+    ChAABB cbox;
+    for (unsigned int i = first; i < first + count; i++) {
+        cbox.min = Vmin(cbox.min, centroids[m_order[i]]);
+        cbox.max = Vmax(cbox.max, centroids[m_order[i]]);
+    }
+    ChVector3d size = cbox.Size();
+    int axis = (size.x() >= size.y() && size.x() >= size.z()) ? 0 : (size.y() >= size.z() ? 1 : 2);
+
+    unsigned int half = count / 2;
+    auto less = [&centroids, axis](unsigned int a, unsigned int b) { return centroids[a][axis] < centroids[b][axis]; };
+    std::nth_element(m_order.begin() + first, m_order.begin() + first + half, m_order.begin() + first + count, less);
+
+    BuildNode(first, half, centroids);
+    auto right = BuildNode(first + half, count - half, centroids);
+    m_tree[index].right = right;
+
+    return index;
+}
+
+// Update the node bounding boxes for the current triangle vertex positions. Since children always follow their parent,
+// a reverse traversal of the node array processes children before parents.
+void ChContactSurfaceMeshBVH::Refit() {
+    for (auto i = (int)m_tree.size() - 1; i >= 0; i--) {
+        auto& node = m_tree[i];
+        ChAABB box;
+        if (node.count > 0) {
+            for (unsigned int j = node.first; j < node.first + node.count; j++) {
+                const auto& tri = *m_triangles[m_order[j]].shape;
+                double margin = tri.sradius + m_envelope;
+                ChVector3d tri_min = Vmin(Vmin(*tri.V1, *tri.V2), *tri.V3) - margin;
+                ChVector3d tri_max = Vmax(Vmax(*tri.V1, *tri.V2), *tri.V3) + margin;
+                box.min = Vmin(box.min, tri_min);
+                box.max = Vmax(box.max, tri_max);
+            }
+        } else {
+            const auto& left = m_tree[i + 1].box;
+            const auto& right = m_tree[node.right].box;
+            box.min = Vmin(left.min, right.min);
+            box.max = Vmax(left.max, right.max);
+        }
+        node.box = box;
+    }
+}
+
+void ChContactSurfaceMeshBVH::CollideSphere(const Sphere& sphere,
+                                            ChContactContainer* container,
+                                            std::vector<unsigned int>& stack) {
+    const ChVector3d& c = sphere.center;
+    double r = sphere.radius;
+
+    stack.clear();
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const auto& node = m_tree[stack.back()];
+        auto index = stack.back();
+        stack.pop_back();
+
+        const auto& box = node.box;
+        if (c.x() + r < box.min.x() || c.x() - r > box.max.x() ||  //
+            c.y() + r < box.min.y() || c.y() - r > box.max.y() ||  //
+            c.z() + r < box.min.z() || c.z() - r > box.max.z())
+            continue;
+
+        if (node.count == 0) {
+            stack.push_back(node.right);
+            stack.push_back(index + 1);
+            continue;
+        }
+
+        for (unsigned int j = node.first; j < node.first + node.count; j++) {
+            const auto& tri = m_triangles[m_order[j]];
+            const auto& shape = *tri.shape;
+
+            // Skip the triangles of which the FEA node is a vertex
+            if (sphere.node_pos &&
+                (sphere.node_pos == shape.V1 || sphere.node_pos == shape.V2 || sphere.node_pos == shape.V3))
+                continue;
+
+            // Distance along the outward triangle normal; only consider projections inside the triangle
+            double u, v;
+            bool is_into;
+            ChVector3d proj;
+            double dist = utils::PointTriangleDistance(c, *shape.V1, *shape.V2, *shape.V3, u, v, is_into, proj);
+            if (!is_into)
+                continue;
+
+            double gap = dist - shape.sradius - r;
+            if (gap > m_envelope || dist < -(shape.sradius + r + m_envelope))
+                continue;
+
+            ChVector3d normal = Vcross(*shape.V2 - *shape.V1, *shape.V3 - *shape.V1).GetNormalized();
+
+            ChCollisionInfo cinfo;
+            cinfo.modelA = tri.model;
+            cinfo.modelB = sphere.model;
+            cinfo.shapeA = tri.shape;
+            cinfo.shapeB = sphere.shape;
+            cinfo.vN = normal;
+            cinfo.vpA = proj + normal * shape.sradius;
+            cinfo.vpB = c - normal * r;
+            cinfo.distance = gap;
+            cinfo.eff_radius = r;
+            container->AddContact(cinfo, tri.mat, sphere.mat);
+            m_num_contacts++;
+        }
+    }
+}
+
+void ChContactSurfaceMeshBVH::OnCustomCollision(ChSystem* sys) {
+    m_num_contacts = 0;
+
+    if (!m_valid || m_triangles.size() != m_surface->GetNumTriangles())
+        Build();
+    if (m_tree.empty())
+        return;
+    Refit();
+
+    auto container = sys->GetContactContainer().get();
+    std::vector<unsigned int> stack;
+    Sphere sphere;
+
+    // FEA node clouds
+    for (const auto& cloud : m_clouds) {
+        auto process = [&](ChContactable* cnode, const ChVector3d& pos) {
+            auto model = cnode->GetCollisionModel().get();
+            auto shape = std::static_pointer_cast<ChCollisionShapePoint>(model->GetShapeInstance(0).first);
+            sphere.model = model;
+            sphere.shape = shape.get();
+            sphere.mat = shape->GetMaterial();
+            sphere.node_pos = &pos;
+            sphere.center = pos;
+            sphere.radius = shape->GetRadius();
+            CollideSphere(sphere, container, stack);
+        };
+        for (const auto& cnode : cloud->GetNodes())
+            process(cnode.get(), cnode->GetNode()->GetPos());
+        for (const auto& cnode : cloud->GetNodesRot())
+            process(cnode.get(), cnode->GetNode()->GetPos());
+    }
+
+    // Sphere collision shapes of rigid bodies
+    for (const auto& body : m_bodies) {
+        if (!body->IsCollisionEnabled())
+            continue;
+        auto model = body->GetCollisionModel().get();
+        ChFrame<> frame = static_cast<ChContactable*>(body.get())->GetCollisionModelFrame();
+        for (const auto& instance : model->GetShapeInstances()) {
+            if (instance.first->GetType() != ChCollisionShape::Type::SPHERE)
+                continue;
+            auto shape = std::static_pointer_cast<ChCollisionShapeSphere>(instance.first);
+            sphere.model = model;
+            sphere.shape = shape.get();
+            sphere.mat = shape->GetMaterial();
+            sphere.node_pos = nullptr;
+            sphere.center = frame.TransformPointLocalToParent(instance.second.GetPos());
+            sphere.radius = shape->GetRadius();
+            CollideSphere(sphere, container, stack);
+        }
+    }
+}
+
+}  // end namespace fea
+}  // end namespace chrono
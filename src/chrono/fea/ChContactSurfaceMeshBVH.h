@@ -0,0 +1,140 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_CONTACT_SURFACE_MESH_BVH_H
+#define CH_CONTACT_SURFACE_MESH_BVH_H
+
+#include <vector>
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChSystem.h"
+#include "chrono/geometry/ChGeometry.h"
+#include "chrono/collision/ChCollisionShapeMeshTriangle.h"
+#include "chrono/fea/ChContactSurfaceMesh.h"
+#include "chrono/fea/ChContactSurfaceNodeCloud.h"
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup fea_contact
+/// @{
+
+/// Collision detection for a deformable contact surface mesh, using a refittable bounding volume hierarchy.
+/// The triangles of the contact surface are not added to the collision system (one collision object per triangle);
+/// instead, the whole surface is processed as a single object with an internal AABB tree. The tree is built once
+/// (top-down, median split) and only refit (bottom-up bounding box update, linear in the number of triangles) at each
+/// collision detection, as the mesh deforms.
+///
+/// The hierarchy is queried against spheres:
+/// - the nodes of FEA node clouds (ChContactSurfaceNodeCloud), with their point radius;
+/// - the sphere collision shapes of rigid bodies (other shape types are ignored).
+/// Node-to-face contacts are generated when the sphere center projects inside a triangle and lies within the contact
+/// envelope on the outer side of the triangle (as given by the counter-clockwise vertex ordering). Nodes of a triangle
+/// are never in contact with that triangle.
+///
+/// The object is used as a custom collision callback (see ChSystem::RegisterCustomCollisionCallback). The tree can
+/// lose efficiency under large distortions of the mesh relative to its configuration at build time; use Rebuild() to
+/// force a new build.
+class ChApi ChContactSurfaceMeshBVH : public ChSystem::CustomCollisionCallback {
+  public:
+    /// Create a BVH collision stage for the given contact surface.
+    /// This disables the use of the collision system for the contact surface and must therefore be called before the
+    /// system is initialized.
+    ChContactSurfaceMeshBVH(std::shared_ptr<ChContactSurfaceMesh> surface);
+
+    ~ChContactSurfaceMeshBVH() {}
+
+    /// Add a node cloud to be tested for collision against the contact surface.
+    void AddNodeCloud(std::shared_ptr<ChContactSurfaceNodeCloud> cloud);
+
+    /// Add a rigid body whose sphere collision shapes are to be tested for collision against the contact surface.
+    void AddBody(std::shared_ptr<ChBody> body);
+
+    /// Set the contact envelope (default: ChCollisionModel::GetDefaultSuggestedEnvelope()).
+    /// Contacts are generated for separation distances smaller than the envelope and for penetrations smaller than the
+    /// sum of the envelope, the sphere radius, and the triangle sphere-swept radius.
+    void SetEnvelope(double envelope) { m_envelope = envelope; }
+
+    /// Get the contact envelope.
+    double GetEnvelope() const { return m_envelope; }
+
+    /// Force a rebuild of the hierarchy at the next collision detection.
+    /// The hierarchy is automatically rebuilt if the number of triangles in the contact surface changes.
+    void Rebuild() { m_valid = false; }
+
+    /// Get the number of nodes in the hierarchy.
+    unsigned int GetNumTreeNodes() const { return (unsigned int)m_tree.size(); }
+
+    /// Get the number of hierarchy builds so far.
+    unsigned int GetNumBuilds() const { return m_num_builds; }
+
+    /// Get the number of contacts added at the last collision detection.
+    unsigned int GetNumContacts() const { return m_num_contacts; }
+
+    /// Refit the hierarchy and add all contacts to the system's contact container.
+    virtual void OnCustomCollision(ChSystem* sys) override;
+
+  private:
+    /// Collision triangle of the contact surface.
+    struct Triangle {
+        ChCollisionModel* model;                 ///< collision model of the contact triangle
+        ChCollisionShapeMeshTriangle* shape;     ///< triangle collision shape
+        std::shared_ptr<ChContactMaterial> mat;  ///< contact material
+    };
+
+    /// Node of the bounding volume hierarchy.
+    /// The left child of an internal node immediately follows the node; children always follow their parent.
+    struct TreeNode {
+        ChAABB box;          ///< bounding box (includes sphere-swept radius and envelope)
+        unsigned int right;  ///< index of right child (internal nodes)
+        unsigned int first;  ///< index of first triangle in m_order (leaves)
+        unsigned int count;  ///< number of triangles (0 for internal nodes)
+    };
+
+    /// Query sphere.
+    struct Sphere {
+        ChCollisionModel* model;                 ///< collision model
+        ChCollisionShape* shape;                 ///< collision shape
+        std::shared_ptr<ChContactMaterial> mat;  ///< contact material
+        const ChVector3d* node_pos;              ///< position of FEA node (nullptr for body shapes)
+        ChVector3d center;                       ///< sphere center
+        double radius;                           ///< sphere radius
+    };
+
+    void CollectTriangles();
+    void Build();
+    unsigned int BuildNode(unsigned int first, unsigned int count, std::vector<ChVector3d>& centroids);
+    void Refit();
+    void CollideSphere(const Sphere& sphere, ChContactContainer* container, std::vector<unsigned int>& stack);
+
+    std::shared_ptr<ChContactSurfaceMesh> m_surface;
+    std::vector<std::shared_ptr<ChContactSurfaceNodeCloud>> m_clouds;
+    std::vector<std::shared_ptr<ChBody>> m_bodies;
+    double m_envelope;
+
+    std::vector<Triangle> m_triangles;  ///< collision triangles
+    std::vector<unsigned int> m_order;  ///< triangle indices, in leaf order
+    std::vector<TreeNode> m_tree;       ///< hierarchy nodes (root at index 0)
+    bool m_valid;                       ///< hierarchy up to date?
+
+    unsigned int m_num_builds;
+    unsigned int m_num_contacts;
+};
+
+/// @} fea_contact
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
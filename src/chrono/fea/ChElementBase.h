@@ -19,6 +19,7 @@
 #include "chrono/core/ChFrame.h"
 #include "chrono/solver/ChSystemDescriptor.h"
 #include "chrono/fea/ChContinuumMaterial.h"
+#include "chrono/fea/ChElementBatch.h"
 #include "chrono/fea/ChNodeFEAbase.h"
 
 namespace chrono {
@@ -104,6 +105,11 @@ class ChApi ChElementBase {
     ///   R += forces * c
     virtual void EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c) {}
 
+    /// Create a kernel for the batched evaluation of the internal forces of this element together with other elements
+    /// of the same type (see ChElementBatch). The returned batch contains only this element.
+    /// Return nullptr (default) if the element type does not support batched evaluation of internal forces.
+    virtual std::shared_ptr<ChElementBatch> CreateBatch() { return nullptr; }
+
     /// Add the product of element mass M by a vector w (pasted at global nodes offsets) into
     /// a global vector R, multiplied by a scaling factor c, as
     ///   R += M * w * c
@@ -132,6 +138,11 @@ class ChApi ChElementBase {
     /// coefficients Kfactor, Rfactor,and Mfactor, respectively.
     virtual void LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) = 0;
 
+    /// Return true if the last call to LoadKRMMatrices changed the encapsulated KRM block (default: true).
+    /// Elements with lazy KRM recomputation (see ChElementCorotational::SetLazyKRM) return false if they kept the
+    /// previously loaded block.
+    virtual bool HasKRMChanged() const { return true; }
+
     /// Add the internal forces, expressed as nodal forces, into the encapsulated ChVariables.
     /// Update the 'fb' part: qf+=forces*factor
     /// WILL BE DEPRECATED - see EleIntLoadResidual_F
@@ -0,0 +1,72 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHELEMENTBATCH_H
+#define CHELEMENTBATCH_H
+
+#include <memory>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+namespace fea {
+
+class ChElementBase;
+
+/// @addtogroup fea_elements
+/// @{
+
+/// Base class for kernels evaluating the internal forces of a group of elements of the same type at once.
+/// A batch stores the data of its elements in a structure-of-arrays layout (one lane per element), so that the
+/// arithmetic of the internal force calculation is vectorized across the elements in the batch rather than within a
+/// single element. Batches are created by ChMesh (see ChMesh::SetBatchedInternalForces) from elements of the same
+/// color, i.e. elements which share no nodes, through ChElementBase::CreateBatch. A batch may cache element data
+/// computed during the element initial setup; ChMesh re-creates all batches each time the mesh is initialized.
+class ChApi ChElementBatch {
+  public:
+    virtual ~ChElementBatch() {}
+
+    /// Add the specified element to this batch.
+    /// Return false if the batch is full or if the element cannot be processed together with the other elements in the
+    /// batch (e.g., different element type or incompatible settings).
+    virtual bool AddElement(ChElementBase* element) = 0;
+
+    /// Get the number of elements in this batch.
+    virtual unsigned int GetNumElements() const = 0;
+
+    /// Add the internal forces of all elements in the batch (pasted at global nodes offsets) into a global vector R,
+    /// multiplied by a scaling factor c, as
+    ///   R += forces * c
+    virtual void LoadResidual_F(ChVectorDynamic<>& R, const double c) = 0;
+};
+
+/// Interface for creating element batches other than the default ones (see ChElementBase::CreateBatch), for example
+/// batches evaluating the internal forces on a GPU device. See ChMesh::SetElementBatchFactory.
+class ChApi ChElementBatchFactory {
+  public:
+    virtual ~ChElementBatchFactory() {}
+
+    /// Create a batch containing only the specified element.
+    /// Return nullptr if this factory does not support the element (or its current settings), in which case the
+    /// element default batch is used, if any.
+    virtual std::shared_ptr<ChElementBatch> CreateBatch(ChElementBase* element) = 0;
+};
+
+/// @} fea_elements
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
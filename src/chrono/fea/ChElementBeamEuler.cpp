@@ -713,6 +713,23 @@ void ChElementBeamEuler::ComputeKRMmatricesGlobal(ChMatrixRef H, double Kfactor,
     }
 }
 
+void ChElementBeamEuler::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
+    // The corotated material stiffness only depends on the element and node rotations. The numerical, geometric, and
+    // inertial stiffness/damping matrices also depend on the element deformation and on the nodal velocities, so they
+    // are always recomputed.
+    bool lazy = !use_numerical_diff_for_KR && !use_geometric_stiffness &&
+                !section->compute_inertia_damping_matrix && !section->compute_inertia_stiffness_matrix;
+    if (!lazy) {
+        KRM_changed = true;
+        KRM_valid = false;
+        ChElementGeneric::LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+        return;
+    }
+
+    if (TestKRMUpdate({A, nodes[0]->GetRotMat(), nodes[1]->GetRotMat()}, Kfactor, Rfactor, Mfactor))
+        ChElementGeneric::LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+}
+
 void ChElementBeamEuler::ComputeInternalForces(ChVectorDynamic<>& Fi) {
     assert(Fi.size() == 12);
     assert(section);
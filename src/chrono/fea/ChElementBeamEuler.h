@@ -158,6 +158,16 @@ class ChApi ChElementBeamEuler : public ChElementBeam,
                                           double Rfactor = 0,
                                           double Mfactor = 0) override;
 
+    /// Compute and load the KRM block of this element.
+    /// If lazy KRM recomputation is enabled (see SetLazyKRM), the block is recomputed only if needed. Lazy
+    /// recomputation is not used with numerical differentiation, geometric stiffness, or the inertial damping and
+    /// stiffness matrices of the section (see ChBeamSectionEuler::compute_inertia_damping_matrix), which depend on the
+    /// current state.
+    virtual void LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) override;
+
+    /// Return true if the last call to LoadKRMMatrices recomputed the KRM block.
+    virtual bool HasKRMChanged() const override { return KRM_changed; }
+
     /// Computes the internal forces (e.g. the actual position of nodes is not in relaxed reference position) and set
     /// values in the Fi vector.
     virtual void ComputeInternalForces(ChVectorDynamic<>& Fi) override;
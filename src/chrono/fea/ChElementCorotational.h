@@ -15,6 +15,8 @@
 #ifndef CHCOROTATIONAL_H
 #define CHCOROTATIONAL_H
 
+#include <vector>
+
 #include "chrono/fea/ChPolarDecomposition.h"
 #include "chrono/fea/ChMatrixCorotation.h"
 
@@ -27,7 +29,9 @@ namespace fea {
 /// Class for corotational elements (elements with rotation matrices that follow the global motion of the element).
 class ChApi ChElementCorotational {
   public:
-    ChElementCorotational() { A.setIdentity(); }
+    ChElementCorotational() : lazy_KRM(false), lazy_KRM_tol(1e-6), KRM_valid(false), KRM_changed(true) {
+        A.setIdentity();
+    }
 
     virtual ~ChElementCorotational() {}
 
@@ -38,9 +42,55 @@ class ChApi ChElementCorotational {
     /// Given the actual position of the nodes, recompute the cumulative rotation matrix A.
     virtual void UpdateRotation() = 0;
 
+    /// Enable/disable lazy recomputation of the KRM block of the element (default: false).
+    /// If enabled, the KRM block is recomputed only if the element rotation changed by more than the specified
+    /// tolerance (maximum absolute change of the entries of the rotation matrices) or if the K, R, M factors changed
+    /// since the last recomputation. Otherwise, the previously loaded block is kept. This only affects the Jacobian
+    /// used by implicit integrators (the internal forces are always evaluated in the current configuration) and is
+    /// appropriate for small-strain elements, whose local stiffness matrix is constant.
+    void SetLazyKRM(bool lazy, double rot_tol = 1e-6) {
+        lazy_KRM = lazy;
+        lazy_KRM_tol = rot_tol;
+        KRM_valid = false;
+    }
+
+    /// Return true if lazy recomputation of the KRM block is enabled.
+    bool GetLazyKRM() const { return lazy_KRM; }
+
   protected:
+    /// Check whether the KRM block must be recomputed, given the current rotations on which it depends.
+    /// If so, record the rotations and the K, R, M factors for subsequent checks and return true.
+    bool TestKRMUpdate(const std::vector<ChMatrix33<>>& rotations, double Kfactor, double Rfactor, double Mfactor) {
+        KRM_changed = true;
+        if (lazy_KRM && KRM_valid && Kfactor == KRM_factors[0] && Rfactor == KRM_factors[1] &&
+            Mfactor == KRM_factors[2] && rotations.size() == KRM_rotations.size()) {
+            KRM_changed = false;
+            for (size_t i = 0; i < rotations.size(); i++) {
+                if ((rotations[i] - KRM_rotations[i]).lpNorm<Eigen::Infinity>() > lazy_KRM_tol) {
+                    KRM_changed = true;
+                    break;
+                }
+            }
+        }
+        if (KRM_changed) {
+            KRM_rotations = rotations;
+            KRM_factors[0] = Kfactor;
+            KRM_factors[1] = Rfactor;
+            KRM_factors[2] = Mfactor;
+            KRM_valid = lazy_KRM;
+        }
+        return KRM_changed;
+    }
+
     ChMatrix33<> A;  // rotation matrix
 
+    bool lazy_KRM;                            // lazy recomputation of the KRM block?
+    double lazy_KRM_tol;                      // tolerance on rotation change for KRM recomputation
+    bool KRM_valid;                           // cached rotations and factors valid?
+    bool KRM_changed;                         // KRM block recomputed at last load?
+    std::vector<ChMatrix33<>> KRM_rotations;  // rotations at last KRM recomputation
+    double KRM_factors[3];                    // K, R, M factors at last KRM recomputation
+
   public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
@@ -339,6 +339,12 @@ void ChElementHexaCorot_8::ComputeKRMmatricesGlobal(ChMatrixRef H, double Kfacto
     //// TODO  better per-node lumping, or 12x12 consistent mass matrix.
 }
 
+void ChElementHexaCorot_8::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
+    // The local stiffness matrix is constant, so the KRM block only depends on the element rotation
+    if (TestKRMUpdate({A}, Kfactor, Rfactor, Mfactor))
+        ChElementGeneric::LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+}
+
 void ChElementHexaCorot_8::ComputeInternalForces(ChVectorDynamic<>& Fi) {
     assert(Fi.size() == GetNumCoordsPosLevel());
 
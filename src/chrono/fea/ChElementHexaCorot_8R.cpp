@@ -0,0 +1,359 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Andrea Favali, Radu Serban, agent
+// =============================================================================
+
+#include "chrono/fea/ChElementHexaCorot_8R.h"
+
+namespace chrono {
+namespace fea {
+
+// Natural coordinates of the element nodes
+static const double node_sign[8][3] = {{-1, -1, -1}, {+1, -1, -1}, {+1, +1, -1}, {-1, +1, -1},
+                                       {-1, -1, +1}, {+1, -1, +1}, {+1, +1, +1}, {-1, +1, +1}};
+
+// Hourglass base vectors (xi*eta, eta*zeta, zeta*xi, xi*eta*zeta evaluated at the nodes)
+static const double hg_base[4][8] = {{+1, -1, +1, -1, +1, -1, +1, -1},
+                                     {+1, +1, -1, -1, -1, -1, +1, +1},
+                                     {+1, -1, -1, +1, -1, +1, +1, -1},
+                                     {-1, +1, -1, +1, +1, -1, +1, -1}};
+
+// Derivatives of the shape function of the i-th node with respect to the natural coordinates
+static ChVector3d ShapeDerivatives(int i, double z0, double z1, double z2) {
+    const double* s = node_sign[i];
+    return ChVector3d(s[0] * (1 + s[1] * z1) * (1 + s[2] * z2) / 8,  //
+                      s[1] * (1 + s[0] * z0) * (1 + s[2] * z2) / 8,  //
+                      s[2] * (1 + s[0] * z0) * (1 + s[1] * z1) / 8);
+}
+
+ChElementHexaCorot_8R::ChElementHexaCorot_8R() : hg_coefficient(0.1), hg_stiffness(0), Volume(0) {
+    nodes.resize(8);
+    StiffnessMatrix.setZero(24, 24);
+}
+
+void ChElementHexaCorot_8R::SetNodes(std::shared_ptr<ChNodeFEAxyz> nodeA,
+                                     std::shared_ptr<ChNodeFEAxyz> nodeB,
+                                     std::shared_ptr<ChNodeFEAxyz> nodeC,
+                                     std::shared_ptr<ChNodeFEAxyz> nodeD,
+                                     std::shared_ptr<ChNodeFEAxyz> nodeE,
+                                     std::shared_ptr<ChNodeFEAxyz> nodeF,
+                                     std::shared_ptr<ChNodeFEAxyz> nodeG,
+                                     std::shared_ptr<ChNodeFEAxyz> nodeH) {
+    nodes[0] = nodeA;
+    nodes[1] = nodeB;
+    nodes[2] = nodeC;
+    nodes[3] = nodeD;
+    nodes[4] = nodeE;
+    nodes[5] = nodeF;
+    nodes[6] = nodeG;
+    nodes[7] = nodeH;
+    std::vector<ChVariables*> mvars;
+    for (const auto& node : nodes)
+        mvars.push_back(&node->Variables());
+    Kmatr.SetVariables(mvars);
+}
+
+void ChElementHexaCorot_8R::ShapeFunctions(ShapeVector& N, double z0, double z1, double z2) {
+    double sc = 1. / 8.;
+    N(0) = sc * (1 - z0) * (1 - z1) * (1 - z2);
+    N(1) = sc * (1 + z0) * (1 - z1) * (1 - z2);
+    N(2) = sc * (1 + z0) * (1 + z1) * (1 - z2);
+    N(3) = sc * (1 - z0) * (1 + z1) * (1 - z2);
+    N(4) = sc * (1 - z0) * (1 - z1) * (1 + z2);
+    N(5) = sc * (1 + z0) * (1 - z1) * (1 + z2);
+    N(6) = sc * (1 + z0) * (1 + z1) * (1 + z2);
+    N(7) = sc * (1 - z0) * (1 + z1) * (1 + z2);
+}
+
+void ChElementHexaCorot_8R::GetStateBlock(ChVectorDynamic<>& mD) {
+    mD.setZero(this->GetNumCoordsPosLevel());
+
+    for (unsigned int i = 0; i < GetNumNodes(); i++)
+        mD.segment(i * 3, 3) = (A.transpose() * this->nodes[i]->GetPos() - nodes[i]->GetX0()).eigen();
+}
+
+void ChElementHexaCorot_8R::ComputeStiffnessMatrix() {
+    // Jacobian of the map from natural to reference coordinates, J(r,c) = sum_i dNi/dz_r * X0_i[c]
+    auto jacobian = [this](double z0, double z1, double z2) {
+        ChMatrix33<> J(0.0);
+        for (int i = 0; i < 8; i++)
+            J += TensorProduct(ShapeDerivatives(i, z0, z1, z2), nodes[i]->GetX0());
+        return J;
+    };
+
+    // Volume and mean shape function gradients (1/V) * int(dN/dX dV), with 2x2x2 quadrature (exact, since the Jacobian
+    // determinant is at most quadratic in each natural coordinate). The mean gradients coincide with the gradients at
+    // the element center for parallelepiped elements.
+    double g = 1 / std::sqrt(3.0);
+    this->Volume = 0;
+    for (int i = 0; i < 8; i++)
+        grad[i] = VNULL;
+    for (int k = 0; k < 8; k++) {
+        double z0 = g * node_sign[k][0];
+        double z1 = g * node_sign[k][1];
+        double z2 = g * node_sign[k][2];
+        ChMatrix33<> J = jacobian(z0, z1, z2);
+        double detJ = J.determinant();
+        ChMatrix33<> Jinv = J.inverse();
+        for (int i = 0; i < 8; i++)
+            grad[i] += detJ * (Jinv * ShapeDerivatives(i, z0, z1, z2));
+        this->Volume += detJ;
+    }
+    double bb = 0;
+    for (int i = 0; i < 8; i++) {
+        grad[i] /= Volume;
+        bb += grad[i].Length2();
+    }
+
+    // Hourglass shape vectors, orthogonal to all linear displacement fields
+    for (int a = 0; a < 4; a++) {
+        ChVector3d hX(0);
+        for (int j = 0; j < 8; j++)
+            hX += hg_base[a][j] * nodes[j]->GetX0();
+        for (int i = 0; i < 8; i++)
+            hg[a][i] = hg_base[a][i] - Vdot(hX, grad[i]);
+    }
+
+    double pwave_modulus = Material->GetLameFirstParam() + 2 * Material->GetShearModulus();
+    hg_stiffness = hg_coefficient * pwave_modulus * Volume * bb / 8;
+
+    // Mean strain-displacement matrix
+    ChMatrixDynamic<> B0(6, 24);
+    B0.setZero();
+    for (int i = 0; i < 8; i++) {
+        const ChVector3d& b = grad[i];
+        B0(0, 3 * i + 0) = b.x();
+        B0(1, 3 * i + 1) = b.y();
+        B0(2, 3 * i + 2) = b.z();
+        B0(3, 3 * i + 0) = b.y();
+        B0(3, 3 * i + 1) = b.x();
+        B0(4, 3 * i + 1) = b.z();
+        B0(4, 3 * i + 2) = b.y();
+        B0(5, 3 * i + 0) = b.z();
+        B0(5, 3 * i + 2) = b.x();
+    }
+
+    StiffnessMatrix = Volume * B0.transpose() * Material->GetStressStrainMatrix() * B0;
+
+    for (int a = 0; a < 4; a++) {
+        for (int i = 0; i < 8; i++) {
+            for (int j = 0; j < 8; j++) {
+                double k = hg_stiffness * hg[a][i] * hg[a][j];
+                StiffnessMatrix(3 * i + 0, 3 * j + 0) += k;
+                StiffnessMatrix(3 * i + 1, 3 * j + 1) += k;
+                StiffnessMatrix(3 * i + 2, 3 * j + 2) += k;
+            }
+        }
+    }
+}
+
+void ChElementHexaCorot_8R::Update() {
+    // parent class update:
+    ChElementGeneric::Update();
+    // always keep updated the rotation matrix A:
+    this->UpdateRotation();
+}
+
+void ChElementHexaCorot_8R::UpdateRotation() {
+    ChVector3d avgX1;
+    avgX1 = nodes[0]->GetX0() + nodes[1]->GetX0() + nodes[2]->GetX0() + nodes[3]->GetX0();
+    ChVector3d avgX2;
+    avgX2 = nodes[4]->GetX0() + nodes[5]->GetX0() + nodes[6]->GetX0() + nodes[7]->GetX0();
+    ChVector3d Xdir = avgX2 - avgX1;
+
+    ChVector3d avgY1;
+    avgY1 = nodes[0]->GetX0() + nodes[1]->GetX0() + nodes[4]->GetX0() + nodes[5]->GetX0();
+    ChVector3d avgY2;
+    avgY2 = nodes[2]->GetX0() + nodes[3]->GetX0() + nodes[6]->GetX0() + nodes[7]->GetX0();
+    ChVector3d Ydir = avgY2 - avgY1;
+    ChMatrix33<> rotX0;
+    rotX0.SetFromAxisX(Xdir.GetNormalized(), Ydir.GetNormalized());
+
+    avgX1 = nodes[0]->pos + nodes[1]->pos + nodes[2]->pos + nodes[3]->pos;
+    avgX2 = nodes[4]->pos + nodes[5]->pos + nodes[6]->pos + nodes[7]->pos;
+    Xdir = avgX2 - avgX1;
+
+    avgY1 = nodes[0]->pos + nodes[1]->pos + nodes[4]->pos + nodes[5]->pos;
+    avgY2 = nodes[2]->pos + nodes[3]->pos + nodes[6]->pos + nodes[7]->pos;
+    Ydir = avgY2 - avgY1;
+    ChMatrix33<> rotXcurrent;
+    rotXcurrent.SetFromAxisX(Xdir.GetNormalized(), Ydir.GetNormalized());
+
+    this->A = rotXcurrent * rotX0.transpose();
+}
+
+ChVectorN<double, 6> ChElementHexaCorot_8R::ComputeLocalStrain(const std::array<ChVector3d, 8>& u) const {
+    ChVectorN<double, 6> strain;
+    strain.setZero();
+    for (int i = 0; i < 8; i++) {
+        const ChVector3d& b = grad[i];
+        strain(0) += b.x() * u[i].x();
+        strain(1) += b.y() * u[i].y();
+        strain(2) += b.z() * u[i].z();
+        strain(3) += b.y() * u[i].x() + b.x() * u[i].y();
+        strain(4) += b.z() * u[i].y() + b.y() * u[i].z();
+        strain(5) += b.z() * u[i].x() + b.x() * u[i].z();
+    }
+    return strain;
+}
+
+ChStrainTensor<> ChElementHexaCorot_8R::GetStrain() {
+    // nodal displacements in local element system, u_l = R*p - p0
+    std::array<ChVector3d, 8> displ;
+    for (int i = 0; i < 8; i++)
+        displ[i] = A.transpose() * nodes[i]->GetPos() - nodes[i]->GetX0();
+
+    ChStrainTensor<> mstrain = ComputeLocalStrain(displ);
+    return mstrain;
+}
+
+ChStressTensor<> ChElementHexaCorot_8R::GetStress() {
+    ChStressTensor<> mstress = this->Material->GetStressStrainMatrix() * this->GetStrain();
+    return mstress;
+}
+
+void ChElementHexaCorot_8R::ComputeKRMmatricesGlobal(ChMatrixRef H, double Kfactor, double Rfactor, double Mfactor) {
+    assert((H.rows() == GetNumCoordsPosLevel()) && (H.cols() == GetNumCoordsPosLevel()));
+
+    // warp the local stiffness matrix K in order to obtain global tangent stiffness CKCt
+    ChMatrixDynamic<> CK(GetNumCoordsPosLevel(), GetNumCoordsPosLevel());
+    ChMatrixDynamic<> CKCt(GetNumCoordsPosLevel(), GetNumCoordsPosLevel());
+    ChMatrixCorotation::ComputeCK(StiffnessMatrix, this->A, 8, CK);
+    ChMatrixCorotation::ComputeKCt(CK, this->A, 8, CKCt);
+
+    // For K stiffness matrix and R damping matrix:
+    double mkfactor = Kfactor + Rfactor * this->GetMaterial()->GetRayleighDampingBeta();
+    H = mkfactor * CKCt;
+
+    // For M mass matrix (lumped):
+    if (Mfactor) {
+        double lumped_node_mass = (this->Volume * this->Material->GetDensity()) / 8.0;
+        double amfactor = Mfactor + Rfactor * this->GetMaterial()->GetRayleighDampingAlpha();
+        for (unsigned int id = 0; id < GetNumCoordsPosLevel(); id++)
+            H(id, id) += amfactor * lumped_node_mass;
+    }
+}
+
+void ChElementHexaCorot_8R::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
+    // The local stiffness matrix is constant, so the KRM block only depends on the element rotation
+    if (TestKRMUpdate({A}, Kfactor, Rfactor, Mfactor))
+        ChElementGeneric::LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+}
+
+void ChElementHexaCorot_8R::ComputeInternalForces(ChVectorDynamic<>& Fi) {
+    assert(Fi.size() == GetNumCoordsPosLevel());
+
+    double beta = Material->GetRayleighDampingBeta();
+    double alpha = Material->GetRayleighDampingAlpha();
+    double lumped_node_mass = (this->Volume * this->Material->GetDensity()) / 8.0;
+
+    // local nodal displacements u_l = R*p - p0 and local nodal speeds
+    std::array<ChVector3d, 8> displ;
+    std::array<ChVector3d, 8> speed;
+    for (int i = 0; i < 8; i++) {
+        displ[i] = A.transpose() * nodes[i]->GetPos() - nodes[i]->GetX0();
+        speed[i] = A.transpose() * nodes[i]->GetPosDt();
+    }
+
+    // uniform element stress, including stiffness-proportional damping
+    std::array<ChVector3d, 8> displ_damped;
+    for (int i = 0; i < 8; i++)
+        displ_damped[i] = displ[i] + beta * speed[i];
+    ChVectorN<double, 6> stress = Material->GetStressStrainMatrix() * ComputeLocalStrain(displ_damped);
+    stress *= Volume;
+
+    // hourglass generalized displacements
+    ChVector3d q[4];
+    for (int a = 0; a < 4; a++) {
+        q[a] = VNULL;
+        for (int i = 0; i < 8; i++)
+            q[a] += hg[a][i] * displ_damped[i];
+        q[a] *= hg_stiffness;
+    }
+
+    for (int i = 0; i < 8; i++) {
+        const ChVector3d& b = grad[i];
+        ChVector3d f(b.x() * stress(0) + b.y() * stress(3) + b.z() * stress(5),
+                     b.y() * stress(1) + b.x() * stress(3) + b.z() * stress(4),
+                     b.z() * stress(2) + b.y() * stress(4) + b.x() * stress(5));
+        for (int a = 0; a < 4; a++)
+            f += hg[a][i] * q[a];
+        f += (lumped_node_mass * alpha) * speed[i];
+
+        // Fi = - C * Fi_local  with C block-diagonal rotations A
+        Fi.segment(3 * i, 3) = -(A * f).eigen();
+    }
+}
+
+void ChElementHexaCorot_8R::EleIntLoadLumpedMass_Md(ChVectorDynamic<>& Md, double& error, const double c) {
+    double lumped_node_mass = (this->Volume * this->Material->GetDensity()) / 8.0;
+    for (const auto& node : nodes) {
+        if (!node->IsFixed())
+            Md.segment(node->NodeGetOffsetVelLevel(), 3).array() += c * lumped_node_mass;
+    }
+}
+
+void ChElementHexaCorot_8R::EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVectorDynamic<>& w, const double c) {
+    double lumped_node_mass = (this->Volume * this->Material->GetDensity()) / 8.0;
+    for (const auto& node : nodes) {
+        if (!node->IsFixed()) {
+            auto offset = node->NodeGetOffsetVelLevel();
+            R.segment(offset, 3) += (c * lumped_node_mass) * w.segment(offset, 3);
+        }
+    }
+}
+
+void ChElementHexaCorot_8R::LoadableGetStateBlockPosLevel(int block_offset, ChState& mD) {
+    for (int i = 0; i < 8; ++i)
+        mD.segment(block_offset + 3 * i, 3) = nodes[i]->GetPos().eigen();
+}
+
+void ChElementHexaCorot_8R::LoadableGetStateBlockVelLevel(int block_offset, ChStateDelta& mD) {
+    for (int i = 0; i < 8; ++i)
+        mD.segment(block_offset + 3 * i, 3) = nodes[i]->GetPosDt().eigen();
+}
+
+void ChElementHexaCorot_8R::LoadableStateIncrement(const unsigned int off_x,
+                                                   ChState& x_new,
+                                                   const ChState& x,
+                                                   const unsigned int off_v,
+                                                   const ChStateDelta& Dv) {
+    for (int i = 0; i < 8; ++i) {
+        nodes[i]->NodeIntStateIncrement(off_x + i * 3, x_new, x, off_v + i * 3, Dv);
+    }
+}
+
+void ChElementHexaCorot_8R::LoadableGetVariables(std::vector<ChVariables*>& mvars) {
+    for (size_t i = 0; i < nodes.size(); ++i)
+        mvars.push_back(&this->nodes[i]->Variables());
+}
+
+void ChElementHexaCorot_8R::ComputeNF(const double U,
+                                      const double V,
+                                      const double W,
+                                      ChVectorDynamic<>& Qi,
+                                      double& detJ,
+                                      const ChVectorDynamic<>& F,
+                                      ChVectorDynamic<>* state_x,
+                                      ChVectorDynamic<>* state_w) {
+    // evaluate shape functions (in compressed vector), btw. not dependant on state
+    ShapeVector N;
+    ShapeFunctions(N, U, V, W);  // note: U,V,W in -1..1 range
+
+    detJ = this->GetVolume() / 8.0;
+
+    for (int i = 0; i < 8; i++)
+        Qi.segment(3 * i, 3) = N(i) * F.segment(0, 3);
+}
+
+}  // end namespace fea
+}  // end namespace chrono
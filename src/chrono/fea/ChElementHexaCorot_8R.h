@@ -0,0 +1,237 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Andrea Favali, Radu Serban, agent
+// =============================================================================
+
+#ifndef CH_ELEMENT_HEXA_COROT_8R_H
+#define CH_ELEMENT_HEXA_COROT_8R_H
+
+#include <array>
+
+#include "chrono/fea/ChElementHexahedron.h"
+#include "chrono/fea/ChElementGeneric.h"
+#include "chrono/fea/ChElementCorotational.h"
+#include "chrono/fea/ChContinuumMaterial.h"
+#include "chrono/fea/ChNodeFEAxyz.h"
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup fea_elements
+/// @{
+
+/// Class for FEA elements of hexahedron type (isoparametric 3D bricks) with 8 nodes, with one-point reduced
+/// integration and hourglass control.
+/// This element has a linear displacement field and uses the same corotational formulation and node ordering as
+/// ChElementHexaCorot_8. The strain is uniform over the element and is evaluated with the mean strain-displacement
+/// matrix (equal to the one at the element center for parallelepiped elements), which makes the internal force
+/// evaluation much cheaper than with the full 2x2x2 quadrature and removes volumetric and shear locking. The four
+/// zero-energy (hourglass) modes of the one-point quadrature are stabilized with the stiffness-type hourglass control
+/// of Flanagan and Belytschko (1981), which does not act on linear displacement fields (the element passes the patch
+/// test).
+///
+/// The element mass is lumped to the nodes (1/8 of the element mass at each node), so that the element can be used
+/// with explicit integrators with mass lumping (e.g. ChTimestepperEulerExplIIorder, ChTimestepperLeapfrog) at a cost
+/// per step dominated by a single strain evaluation.
+class ChApi ChElementHexaCorot_8R : public ChElementHexahedron,
+                                    public ChElementGeneric,
+                                    public ChElementCorotational,
+                                    public ChLoadableUVW {
+  public:
+    using ShapeVector = ChMatrixNM<double, 1, 8>;
+
+    ChElementHexaCorot_8R();
+    ~ChElementHexaCorot_8R() {}
+
+    virtual unsigned int GetNumNodes() override { return 8; }
+    virtual unsigned int GetNumCoordsPosLevel() override { return 8 * 3; }
+    virtual unsigned int GetNodeNumCoordsPosLevel(unsigned int n) override { return 3; }
+
+    double GetVolume() { return Volume; }
+
+    virtual std::shared_ptr<ChNodeFEAbase> GetNode(unsigned int n) override { return nodes[n]; }
+
+    /// Return the specified hexahedron node (0 <= n <= 7).
+    virtual std::shared_ptr<ChNodeFEAxyz> GetHexahedronNode(unsigned int n) override { return nodes[n]; }
+
+    virtual void SetNodes(std::shared_ptr<ChNodeFEAxyz> nodeA,
+                          std::shared_ptr<ChNodeFEAxyz> nodeB,
+                          std::shared_ptr<ChNodeFEAxyz> nodeC,
+                          std::shared_ptr<ChNodeFEAxyz> nodeD,
+                          std::shared_ptr<ChNodeFEAxyz> nodeE,
+                          std::shared_ptr<ChNodeFEAxyz> nodeF,
+                          std::shared_ptr<ChNodeFEAxyz> nodeG,
+                          std::shared_ptr<ChNodeFEAxyz> nodeH);
+
+    /// Set the hourglass control coefficient (default: 0.1).
+    /// The hourglass stiffness is kappa * (lambda + 2 mu) * V * (b:b) / 8, with b the mean shape function gradients;
+    /// with the default value, the hourglass (bending) stiffness of a cube is close to that of the fully integrated
+    /// element. A value of 0 disables hourglass control. Must be set before initialization.
+    void SetHourglassCoefficient(double kappa) { hg_coefficient = kappa; }
+
+    /// Get the hourglass control coefficient.
+    double GetHourglassCoefficient() const { return hg_coefficient; }
+
+    //
+    // FEA functions
+    //
+
+    /// Fills the N shape function matrix with the
+    /// values of shape functions at z0,z1,z2 parametric coordinates, where
+    /// each zi is in [-1...+1] range.
+    /// It stores the Ni(z0,z1,z2) values in a 1 row, 8 columns matrix.
+    void ShapeFunctions(ShapeVector& N, double z0, double z1, double z2);
+
+    /// Fills the D vector (displacement) with the current field values at the nodes of the element, with proper
+    /// ordering. If the D vector has not the size of this->GetNumCoordsPosLevel(), it will be resized. For corotational
+    /// elements, field is assumed in local reference!
+    virtual void GetStateBlock(ChVectorDynamic<>& mD) override;
+
+    /// Computes the local STIFFNESS MATRIX of the element:
+    /// K = V * [B0]' * [D] * [B0] + K_hourglass
+    /// with B0 the mean strain-displacement matrix.
+    void ComputeStiffnessMatrix();
+
+    /// Update element at each time step.
+    virtual void Update() override;
+
+    // Compute large rotation of element for corotational approach
+    virtual void UpdateRotation() override;
+
+    /// Returns the (constant) strain tensor.
+    /// The tensor is in the original undeformed unrotated reference.
+    ChStrainTensor<> GetStrain();
+
+    /// Returns the (constant) stress tensor.
+    /// The tensor is in the original undeformed unrotated reference.
+    ChStressTensor<> GetStress();
+
+    /// Sets H as the global stiffness matrix K, scaled  by Kfactor. Optionally, also
+    /// superimposes global damping matrix R, scaled by Rfactor, and global mass matrix M multiplied by Mfactor.
+    virtual void ComputeKRMmatricesGlobal(ChMatrixRef H,
+                                          double Kfactor,
+                                          double Rfactor = 0,
+                                          double Mfactor = 0) override;
+
+    /// Compute and load the KRM block of this element.
+    /// If lazy KRM recomputation is enabled (see SetLazyKRM), the block is recomputed only if needed.
+    virtual void LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) override;
+
+    /// Return true if the last call to LoadKRMMatrices recomputed the KRM block.
+    virtual bool HasKRMChanged() const override { return KRM_changed; }
+
+    /// Computes the internal forces (ex. the actual position of nodes is not in relaxed reference position) and set
+    /// values in the Fi vector.
+    /// The forces are evaluated from the uniform element stress and the hourglass generalized displacements,
+    /// without forming the stiffness matrix product.
+    virtual void ComputeInternalForces(ChVectorDynamic<>& Fi) override;
+
+    /// Add the lumped mass of the element (1/8 of the element mass at each node) to the Md vector.
+    virtual void EleIntLoadLumpedMass_Md(ChVectorDynamic<>& Md, double& error, const double c) override;
+
+    /// Add the product of the (lumped) element mass by a vector w to the vector R, as R += M * w * c.
+    virtual void EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVectorDynamic<>& w, const double c) override;
+
+    //
+    // Custom properties functions
+    //
+
+    /// Set the material of the element
+    void SetMaterial(std::shared_ptr<ChContinuumElastic> my_material) { Material = my_material; }
+    std::shared_ptr<ChContinuumElastic> GetMaterial() { return Material; }
+
+    /// Get the StiffnessMatrix
+    const ChMatrixDynamic<>& GetStiffnessMatrix() const { return StiffnessMatrix; }
+
+    //
+    // Functions for ChLoadable interface
+    //
+
+    /// Gets the number of DOFs affected by this element (position part)
+    virtual unsigned int GetLoadableNumCoordsPosLevel() override { return 8 * 3; }
+
+    /// Gets the number of DOFs affected by this element (speed part)
+    virtual unsigned int GetLoadableNumCoordsVelLevel() override { return 8 * 3; }
+
+    /// Gets all the DOFs packed in a single vector (position part)
+    virtual void LoadableGetStateBlockPosLevel(int block_offset, ChState& mD) override;
+
+    /// Gets all the DOFs packed in a single vector (speed part)
+    virtual void LoadableGetStateBlockVelLevel(int block_offset, ChStateDelta& mD) override;
+
+    /// Increment all DOFs using a delta.
+    virtual void LoadableStateIncrement(const unsigned int off_x,
+                                        ChState& x_new,
+                                        const ChState& x,
+                                        const unsigned int off_v,
+                                        const ChStateDelta& Dv) override;
+
+    /// Number of coordinates in the interpolated field: here the {x,y,z} displacement
+    virtual unsigned int GetNumFieldCoords() override { return 3; }
+
+    /// Get the number of DOFs sub-blocks.
+    virtual unsigned int GetNumSubBlocks() override { return 8; }
+
+    /// Get the offset of the specified sub-block of DOFs in global vector.
+    virtual unsigned int GetSubBlockOffset(unsigned int nblock) override {
+        return nodes[nblock]->NodeGetOffsetVelLevel();
+    }
+
+    /// Get the size of the specified sub-block of DOFs in global vector.
+    virtual unsigned int GetSubBlockSize(unsigned int nblock) override { return 3; }
+
+    /// Check if the specified sub-block of DOFs is active.
+    virtual bool IsSubBlockActive(unsigned int nblock) const override { return !nodes[nblock]->IsFixed(); }
+
+    /// Get the pointers to the contained ChVariables, appending to the mvars vector.
+    virtual void LoadableGetVariables(std::vector<ChVariables*>& mvars) override;
+
+    /// Evaluate N'*F , where N is some type of shape function
+    /// evaluated at U,V,W coordinates of the volume, each ranging in -1..+1
+    /// F is a load, N'*F is the resulting generalized load
+    /// Returns also det[J] with J=[dx/du,..], that might be useful in gauss quadrature.
+    virtual void ComputeNF(const double U,              ///< parametric coordinate in volume
+                           const double V,              ///< parametric coordinate in volume
+                           const double W,              ///< parametric coordinate in volume
+                           ChVectorDynamic<>& Qi,       ///< Return result of N'*F  here, maybe with offset block_offset
+                           double& detJ,                ///< Return det[J] here
+                           const ChVectorDynamic<>& F,  ///< Input F vector, size is = n.field coords.
+                           ChVectorDynamic<>* state_x,  ///< if != 0, update state (pos. part) to this, then evaluate Q
+                           ChVectorDynamic<>* state_w   ///< if != 0, update state (speed part) to this, then evaluate Q
+                           ) override;
+
+    /// This is needed so that it can be accessed by ChLoaderVolumeGravity
+    virtual double GetDensity() override { return this->Material->GetDensity(); }
+
+  private:
+    virtual void SetupInitial(ChSystem* system) override { ComputeStiffnessMatrix(); }
+
+    /// Compute the local strain (Voigt notation) for the given local nodal displacements.
+    ChVectorN<double, 6> ComputeLocalStrain(const std::array<ChVector3d, 8>& u) const;
+
+    std::vector<std::shared_ptr<ChNodeFEAxyz> > nodes;
+    std::shared_ptr<ChContinuumElastic> Material;
+    ChMatrixDynamic<> StiffnessMatrix;
+
+    double hg_coefficient;                    ///< hourglass control coefficient
+    double hg_stiffness;                      ///< hourglass stiffness
+    std::array<ChVector3d, 8> grad;           ///< mean shape function gradients (reference configuration)
+    std::array<std::array<double, 8>, 4> hg;  ///< hourglass shape vectors (Flanagan-Belytschko gamma vectors)
+    double Volume;
+};
+
+/// @} fea_elements
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
@@ -1576,6 +1576,244 @@ void ChElementShellANCF_3833::ComputeInternalForcesContIntPreInt(ChVectorDynamic
     Fi = QiReshapedLiu;
 }
 
+// -----------------------------------------------------------------------------
+// Batched elastic force calculation
+// -----------------------------------------------------------------------------
+
+// Batched calculation of the generalized internal force vector of up to NL elements at once, using the "Continuous
+// Integration" style of method (with or without damping). The calculations are identical to those performed in
+// ComputeInternalForcesContIntDamping and ComputeInternalForcesContIntNoDamping, but all quantities are stored in a
+// structure-of-arrays layout: each quantity evaluated at the Gauss quadrature points of a layer is stored as an
+// NIP x NL array with one column per element in the batch. As a result, all of the arithmetic is performed on arrays of
+// NIP*NL entries and is vectorized across the Gauss quadrature points and across the elements in the batch.
+
+class ChElementShellANCF_3833::Batch : public ChElementBatch {
+  public:
+    static const int NL = 4;  ///< maximum number of elements in a batch
+
+    using ArrayNIP = Eigen::Array<double, NIP, NL>;      ///< quantity at the Gauss quadrature points of a layer
+    using ArrayL = Eigen::Array<double, 1, NL>;          ///< scalar quantity
+    using Matrix3NxL = ChMatrixNM<double, 3 * NSF, NL>;  ///< nodal coordinates or generalized forces
+
+    Batch(ChElementShellANCF_3833* element) : m_num_layers(element->m_numLayers), m_packed(false) {
+        m_elements.push_back(element);
+    }
+
+    virtual bool AddElement(ChElementBase* element) override {
+        auto shell = dynamic_cast<ChElementShellANCF_3833*>(element);
+        if (!shell || m_elements.size() == NL || shell->m_numLayers != m_num_layers)
+            return false;
+        m_elements.push_back(shell);
+        m_packed = false;
+        return true;
+    }
+
+    virtual unsigned int GetNumElements() const override { return (unsigned int)m_elements.size(); }
+
+    virtual void LoadResidual_F(ChVectorDynamic<>& R, const double c) override;
+
+  private:
+    /// Gather the precomputed shape function derivatives and Gauss quadrature scale factors of all elements.
+    void Pack();
+
+    std::vector<ChElementShellANCF_3833*> m_elements;  ///< elements in this batch
+    int m_num_layers;                                   ///< number of layers (same for all elements)
+    bool m_packed;                                      ///< precomputed element data was gathered
+
+    /// Shape function derivatives, for each layer, shape function, and direction (see m_SD in the element)
+    std::vector<ArrayNIP, Eigen::aligned_allocator<ArrayNIP>> m_SD;
+    /// Gauss quadrature weight times element Jacobian scale factors, for each layer (see m_kGQ in the element)
+    std::vector<ArrayNIP, Eigen::aligned_allocator<ArrayNIP>> m_kGQ;
+};
+
+std::shared_ptr<ChElementBatch> ChElementShellANCF_3833::CreateBatch() {
+    return chrono_types::make_shared<Batch>(this);
+}
+
+ChMatrix66d ChElementShellANCF_3833::GetLayerStiffnessMatrix(size_t layer) {
+    ChMatrix66d D = m_layers[layer].GetMaterial()->Get_E_eps();
+    RotateReorderStiffnessMatrix(D, m_layers[layer].GetFiberAngle());
+    return D;
+}
+
+void ChElementShellANCF_3833::Batch::Pack() {
+    // Unused lanes have zero shape function derivatives and scale factors and therefore produce zero forces
+    m_SD.assign(m_num_layers * NSF * 3, ArrayNIP::Zero());
+    m_kGQ.assign(m_num_layers, ArrayNIP::Zero());
+
+    for (size_t l = 0; l < m_elements.size(); l++) {
+        const auto& SD = m_elements[l]->m_SD;
+        const auto& kGQ = m_elements[l]->m_kGQ;
+        for (int kl = 0; kl < m_num_layers; kl++) {
+            m_kGQ[kl].col(l) = kGQ.block<NIP, 1>(kl * NIP, 0).array();
+            for (int k = 0; k < NSF; k++) {
+                for (int d = 0; d < 3; d++) {
+                    m_SD[(kl * NSF + k) * 3 + d].col(l) =
+                        SD.block<1, NIP>(k, 3 * kl * NIP + d * NIP).transpose().array();
+                }
+            }
+        }
+    }
+
+    m_packed = true;
+}
+
+void ChElementShellANCF_3833::Batch::LoadResidual_F(ChVectorDynamic<>& R, const double c) {
+    // Fall back on the per-element calculation if any of the elements is currently set to use a different method
+    bool damping_enabled = false;
+    for (auto element : m_elements) {
+        if (element->m_method != IntFrcMethod::ContInt || element->m_numLayers != m_num_layers) {
+            for (auto e : m_elements)
+                e->EleIntLoadResidual_F(R, c);
+            return;
+        }
+        damping_enabled |= element->m_damping_enabled;
+    }
+
+    if (!m_packed)
+        Pack();
+
+    // Gather the nodal coordinates (and their time derivatives) of all elements, one element per column
+    Matrix3NxL e = Matrix3NxL::Zero();
+    Matrix3NxL edot = Matrix3NxL::Zero();
+    ArrayL alpha = ArrayL::Zero();
+    for (size_t l = 0; l < m_elements.size(); l++) {
+        Vector3N e_l;
+        m_elements[l]->CalcCoordVector(e_l);
+        e.col(l) = e_l;
+        if (m_elements[l]->m_damping_enabled) {
+            m_elements[l]->CalcCoordDtVector(e_l);
+            edot.col(l) = e_l;
+            alpha(l) = m_elements[l]->m_Alpha;
+        }
+    }
+
+    Matrix3NxL Q = Matrix3NxL::Zero();
+
+    for (int kl = 0; kl < m_num_layers; kl++) {
+        // =============================================================================
+        // Calculate the deformation gradient (and its time derivative) using the same ordering as the per-element
+        // calculation: F[3 * d + j] holds the block component (d, j) of FC, i.e. the entries F_(j+1)(d+1) at all Gauss
+        // quadrature points of the current layer for all the elements in the batch.
+        // =============================================================================
+
+        ArrayNIP F[9];
+        ArrayNIP Fdot[9];
+        for (int i = 0; i < 9; i++) {
+            F[i].setZero();
+            Fdot[i].setZero();
+        }
+
+        for (int k = 0; k < NSF; k++) {
+            for (int d = 0; d < 3; d++) {
+                const ArrayNIP& SD = m_SD[(kl * NSF + k) * 3 + d];
+                for (int j = 0; j < 3; j++) {
+                    F[3 * d + j] += SD.rowwise() * e.row(3 * k + j).array();
+                    if (damping_enabled)
+                        Fdot[3 * d + j] += SD.rowwise() * edot.row(3 * k + j).array();
+                }
+            }
+        }
+
+        // =============================================================================
+        // Calculate the Green-Lagrange strain components (combined with their scaled time derivatives), scaled by minus
+        // the Gauss quadrature weight times the element Jacobian at the corresponding Gauss point.
+        // Results are written in Voigt notation: epsilon = [E11,E22,E33,2*E23,2*E13,2*E12]
+        // =============================================================================
+
+        // Dot product of the columns a and b of the deformation gradient
+        auto FF = [&F](int a, int b) -> ArrayNIP {
+            return F[3 * a] * F[3 * b] + F[3 * a + 1] * F[3 * b + 1] + F[3 * a + 2] * F[3 * b + 2];
+        };
+        // Dot product of the column a of the deformation gradient and the column b of its time derivative
+        auto FFdot = [&F, &Fdot](int a, int b) -> ArrayNIP {
+            return F[3 * a] * Fdot[3 * b] + F[3 * a + 1] * Fdot[3 * b + 1] + F[3 * a + 2] * Fdot[3 * b + 2];
+        };
+
+        ArrayNIP E[6];
+        E[0] = 0.5 * (FF(0, 0) - 1);
+        E[1] = 0.5 * (FF(1, 1) - 1);
+        E[2] = 0.5 * (FF(2, 2) - 1);
+        E[3] = FF(1, 2);
+        E[4] = FF(0, 2);
+        E[5] = FF(0, 1);
+        if (damping_enabled) {
+            E[0] += FFdot(0, 0).rowwise() * alpha;
+            E[1] += FFdot(1, 1).rowwise() * alpha;
+            E[2] += FFdot(2, 2).rowwise() * alpha;
+            E[3] += (FFdot(1, 2) + FFdot(2, 1)).rowwise() * alpha;
+            E[4] += (FFdot(0, 2) + FFdot(2, 0)).rowwise() * alpha;
+            E[5] += (FFdot(0, 1) + FFdot(1, 0)).rowwise() * alpha;
+        }
+        for (int i = 0; i < 6; i++)
+            E[i] *= m_kGQ[kl];
+
+        // =============================================================================
+        // Get the rotated and reordered stiffness tensor of the current layer of each element and calculate the scaled
+        // 2nd Piola-Kirchoff stresses in Voigt notation
+        //  kGQ*SPK2 = kGQ*[SPK2_11,SPK2_22,SPK2_33,SPK2_23,SPK2_13,SPK2_12] = D * E_Combined
+        // =============================================================================
+
+        Eigen::Array<double, 36, NL> D = Eigen::Array<double, 36, NL>::Zero();
+        for (size_t l = 0; l < m_elements.size(); l++) {
+            ChMatrix66d D_l = m_elements[l]->GetLayerStiffnessMatrix(kl);
+            for (int i = 0; i < 6; i++)
+                for (int j = 0; j < 6; j++)
+                    D(6 * i + j, l) = D_l(i, j);
+        }
+
+        ArrayNIP SPK2[6];
+        for (int i = 0; i < 6; i++) {
+            SPK2[i] = E[0].rowwise() * D.row(6 * i);
+            for (int j = 1; j < 6; j++)
+                SPK2[i] += E[j].rowwise() * D.row(6 * i + j);
+        }
+
+        // =============================================================================
+        // Calculate the transpose of the scaled 1st Piola-Kirchoff stresses, P_Block = kGQ*SPK2*F_transpose, with the
+        // same block ordering as the deformation gradient
+        // =============================================================================
+
+        // Indices of the stress components in the symmetric 3x3 stress tensor
+        static const int S_idx[3][3] = {{0, 5, 4}, {5, 1, 3}, {4, 3, 2}};
+
+        ArrayNIP P[9];
+        for (int d = 0; d < 3; d++) {
+            for (int j = 0; j < 3; j++) {
+                P[3 * d + j] = F[j] * SPK2[S_idx[d][0]] + F[3 + j] * SPK2[S_idx[d][1]] + F[6 + j] * SPK2[S_idx[d][2]];
+            }
+        }
+
+        // =============================================================================
+        // Multiply the scaled first Piola-Kirchoff stresses by the shape function derivatives for the current layer,
+        // summing over the Gauss quadrature points, to get the generalized force vectors (one column per element)
+        // =============================================================================
+
+        for (int k = 0; k < NSF; k++) {
+            const ArrayNIP& SD0 = m_SD[(kl * NSF + k) * 3 + 0];
+            const ArrayNIP& SD1 = m_SD[(kl * NSF + k) * 3 + 1];
+            const ArrayNIP& SD2 = m_SD[(kl * NSF + k) * 3 + 2];
+            for (int j = 0; j < 3; j++) {
+                Q.row(3 * k + j).array() += (SD0 * P[j] + SD1 * P[3 + j] + SD2 * P[6 + j]).colwise().sum();
+            }
+        }
+    }
+
+    // Add the generalized internal forces of each element to the global vector. Batches are evaluated concurrently only
+    // for elements of the same color, which share no nodes (see ChMesh), so there is no need for atomic increments.
+    for (size_t l = 0; l < m_elements.size(); l++) {
+        auto element = m_elements[l];
+        Vector3N Fi = c * Q.col(l);
+        unsigned int stride = 0;
+        for (unsigned int in = 0; in < element->GetNumNodes(); in++) {
+            unsigned int node_dofs = element->GetNodeNumCoordsPosLevelActive(in);
+            if (!element->m_nodes[in]->IsFixed())
+                R.segment(element->m_nodes[in]->NodeGetOffsetVelLevel(), node_dofs) += Fi.segment(stride, node_dofs);
+            stride += element->GetNodeNumCoordsPosLevel(in);
+        }
+    }
+}
+
 // -----------------------------------------------------------------------------
 // Jacobians of internal forces
 // -----------------------------------------------------------------------------
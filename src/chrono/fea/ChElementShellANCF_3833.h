@@ -218,6 +218,12 @@ class ChApi ChElementShellANCF_3833 : public ChElementANCF,
     /// calculations.
     IntFrcMethod GetIntFrcCalcMethod() { return m_method; }
 
+    /// Return true if structural damping is included in the internal force calculations.
+    bool IsDampingEnabled() const { return m_damping_enabled; }
+
+    /// Get the structural damping.
+    double GetAlphaDamp() const { return m_Alpha; }
+
     /// Get the Green-Lagrange strain tensor at the normalized element coordinates (xi, eta, zeta) at the current state
     /// of the element.  Normalized element coordinates span from -1 to 1.
     ChMatrix33<> GetGreenLagrangeStrain(const double xi, const double eta, const double zeta);
@@ -262,6 +268,25 @@ class ChApi ChElementShellANCF_3833 : public ChElementANCF,
     /// vector.
     virtual void ComputeInternalForces(ChVectorDynamic<>& Fi) override;
 
+    /// Create a kernel for the batched evaluation of the internal forces of this element together with other
+    /// ChElementShellANCF_3833 elements with the same number of layers. Batched evaluation only applies to the
+    /// "Continuous Integration" style method (with or without damping), see ChMesh::SetBatchedInternalForces.
+    virtual std::shared_ptr<ChElementBatch> CreateBatch() override;
+
+    /// [INTERNAL USE] Get the precomputed shape function derivatives used by the "Continuous Integration" style method.
+    /// Row k holds the derivatives of the k-th shape function. For each layer kl, the NIP columns starting at column
+    /// (3 * kl + d) * NIP hold the derivatives with respect to the d-th direction at the Gauss quadrature points of the
+    /// layer. Intended for batch kernels implemented outside of this class (see ChMesh::SetElementBatchFactory).
+    const ChMatrixDynamic<>& GetContIntShapeFunctionDerivatives() const { return m_SD; }
+
+    /// [INTERNAL USE] Get the precomputed Gauss quadrature weight times element Jacobian scale factors used by the
+    /// "Continuous Integration" style method (NIP consecutive values for each layer).
+    const ChMatrixDynamic_col<>& GetContIntScaleFactors() const { return m_kGQ; }
+
+    /// [INTERNAL USE] Get the stiffness matrix of the specified layer, rotated and reordered to match the Voigt
+    /// notation order used with this element.
+    ChMatrix66d GetLayerStiffnessMatrix(size_t layer);
+
     /// Set H as a linear combination of M, K, and R.
     ///   H = Mfactor * [M] + Kfactor * [K] + Rfactor * [R],
     /// where [M] is the mass matrix, [K] is the stiffness matrix, and [R] is the damping matrix.
@@ -404,6 +429,9 @@ class ChApi ChElementShellANCF_3833 : public ChElementANCF,
     /// Precalculate constant matrices and scalars for the "Pre-Integration" style method
     void PrecomputeInternalForceMatricesWeightsPreInt();
 
+    /// Batched evaluation of the internal forces of several elements using the "Continuous Integration" style method.
+    class Batch;
+
     /// Calculate the generalized internal force for the element at the current nodal coordinates and time derivatives
     /// of the nodal coordinates using the "Continuous Integration" style method assuming damping is included
     void ComputeInternalForcesContIntDamping(ChVectorDynamic<>& Fi);
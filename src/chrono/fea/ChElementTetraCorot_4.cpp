@@ -249,6 +249,12 @@ void ChElementTetraCorot_4::ComputeKRMmatricesGlobal(ChMatrixRef H, double Kfact
     //// TODO  better per-node lumping, or 12x12 consistent mass matrix.
 }
 
+void ChElementTetraCorot_4::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
+    // The local stiffness matrix is constant, so the KRM block only depends on the element rotation
+    if (TestKRMUpdate({A}, Kfactor, Rfactor, Mfactor))
+        ChElementGeneric::LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+}
+
 void ChElementTetraCorot_4::ComputeInternalForces(ChVectorDynamic<>& Fi) {
     assert(Fi.size() == 12);
 
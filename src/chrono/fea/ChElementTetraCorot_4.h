@@ -98,6 +98,13 @@ class ChApi ChElementTetraCorot_4 : public ChElementTetrahedron,
                                           double Rfactor = 0,
                                           double Mfactor = 0) override;
 
+    /// Compute and load the KRM block of this element.
+    /// If lazy KRM recomputation is enabled (see SetLazyKRM), the block is recomputed only if needed.
+    virtual void LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) override;
+
+    /// Return true if the last call to LoadKRMMatrices recomputed the KRM block.
+    virtual bool HasKRMChanged() const override { return KRM_changed; }
+
     /// Computes the internal forces (ex. the actual position of nodes is not in relaxed reference position) and set
     /// values in the Fi vector.
     virtual void ComputeInternalForces(ChVectorDynamic<>& Fi) override;
@@ -18,12 +18,16 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 
 #include "chrono/core/ChFrame.h"
 #include "chrono/physics/ChLoad.h"
 #include "chrono/physics/ChObject.h"
 #include "chrono/physics/ChSystem.h"
 
+#include "chrono/fea/ChElementCorotational.h"
 #include "chrono/fea/ChElementTetraCorot_4.h"
 #include "chrono/fea/ChMesh.h"
 #include "chrono/fea/ChNodeFEAxyz.h"
@@ -47,6 +51,13 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
 
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
+    num_KRM_changed = 0;
+
+    elem_colors_valid = false;
+
+    use_elem_batches = other.use_elem_batches;
+    elem_batches_valid = false;
+    elem_batch_factory = other.elem_batch_factory;
 }
 
 void ChMesh::SetupInitial() {
@@ -67,6 +78,9 @@ void ChMesh::SetupInitial() {
         // precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
     }
+
+    // element batches may cache data precomputed by the elements
+    elem_batches_valid = false;
 }
 
 void ChMesh::Relax() {
@@ -96,6 +110,7 @@ void ChMesh::AddNode(std::shared_ptr<ChNodeFEAbase> node) {
 
 void ChMesh::AddElement(std::shared_ptr<ChElementBase> elem) {
     velements.push_back(elem);
+    elem_colors_valid = false;
 
     // If the mesh is already added to a system, mark the system uninitialized and out-of-date
     if (system) {
@@ -104,8 +119,28 @@ void ChMesh::AddElement(std::shared_ptr<ChElementBase> elem) {
     }
 }
 
+size_t ChMesh::GetMemoryUsage() const {
+    size_t mem = vnodes.capacity() * sizeof(std::shared_ptr<ChNodeFEAbase>) +
+                 velements.capacity() * sizeof(std::shared_ptr<ChElementBase>) +
+                 vcontactsurfaces.capacity() * sizeof(std::shared_ptr<ChContactSurface>) +
+                 vmeshsurfaces.capacity() * sizeof(std::shared_ptr<ChMeshSurface>);
+
+    for (const auto& element : velements)
+        mem += element->GetNumNodes() * sizeof(std::shared_ptr<ChNodeFEAbase>);
+
+    for (const auto& color : elem_colors)
+        mem += color.capacity() * sizeof(unsigned int);
+    for (const auto& batches : elem_batches)
+        mem += batches.capacity() * sizeof(std::shared_ptr<ChElementBatch>);
+    for (const auto& unbatched : elem_unbatched)
+        mem += unbatched.capacity() * sizeof(unsigned int);
+
+    return mem;
+}
+
 void ChMesh::ClearElements() {
     velements.clear();
+    elem_colors_valid = false;
     vcontactsurfaces.clear();
 
     // If the mesh is already added to a system, mark the system out-of-date
@@ -116,6 +151,7 @@ void ChMesh::ClearElements() {
 
 void ChMesh::ClearNodes() {
     velements.clear();
+    elem_colors_valid = false;
     vnodes.clear();
     vcontactsurfaces.clear();
 
@@ -155,6 +191,109 @@ void ChMesh::Setup() {
             n_dofs_w += vnodes[i]->GetNumCoordsVelLevelActive();
         }
     }
+
+    UpdateElementColoring();
+}
+
+void ChMesh::UpdateElementColoring() {
+    if (elem_colors_valid)
+        return;
+
+    elem_colors.clear();
+    elem_batches_valid = false;
+
+    // Index the nodes of the mesh (elements may also reference nodes not explicitly added to the mesh)
+    std::unordered_map<ChNodeFEAbase*, unsigned int> node_index;
+    for (unsigned int i = 0; i < vnodes.size(); i++)
+        node_index.emplace(vnodes[i].get(), i);
+
+    // Greedy coloring: assign each element the smallest color not used by any element sharing one of its nodes
+    std::vector<std::vector<unsigned int>> node_colors(vnodes.size());  // colors of elements connected to each node
+    std::vector<unsigned int> mark;                                     // last element that excluded each color
+    std::vector<unsigned int> elem_nodes;
+    for (unsigned int ie = 0; ie < velements.size(); ie++) {
+        elem_nodes.clear();
+        for (unsigned int in = 0; in < velements[ie]->GetNumNodes(); in++) {
+            auto res = node_index.emplace(velements[ie]->GetNode(in).get(), (unsigned int)node_colors.size());
+            if (res.second)
+                node_colors.push_back({});
+            elem_nodes.push_back(res.first->second);
+        }
+
+        for (auto n : elem_nodes)
+            for (auto col : node_colors[n])
+                mark[col] = ie + 1;
+
+        unsigned int color = 0;
+        while (color < elem_colors.size() && mark[color] == ie + 1)
+            color++;
+        if (color == elem_colors.size()) {
+            elem_colors.push_back({});
+            mark.push_back(0);
+        }
+
+        elem_colors[color].push_back(ie);
+        for (auto n : elem_nodes) {
+            if (std::find(node_colors[n].begin(), node_colors[n].end(), color) == node_colors[n].end())
+                node_colors[n].push_back(color);
+        }
+    }
+
+    elem_colors_valid = true;
+}
+
+const std::vector<std::vector<unsigned int>>& ChMesh::GetElementColors() {
+    UpdateElementColoring();
+    return elem_colors;
+}
+
+void ChMesh::SetBatchedInternalForces(bool val) {
+    use_elem_batches = val;
+    elem_batches_valid = false;
+}
+
+void ChMesh::SetElementBatchFactory(std::shared_ptr<ChElementBatchFactory> factory) {
+    elem_batch_factory = factory;
+    elem_batches_valid = false;
+}
+
+void ChMesh::SetLazyKRM(bool lazy, double rot_tol) {
+    for (auto& element : velements) {
+        if (auto corot = std::dynamic_pointer_cast<ChElementCorotational>(element))
+            corot->SetLazyKRM(lazy, rot_tol);
+    }
+}
+
+void ChMesh::UpdateElementBatches() {
+    UpdateElementColoring();
+    if (elem_batches_valid)
+        return;
+
+    elem_batches.assign(elem_colors.size(), {});
+    elem_unbatched.assign(elem_colors.size(), {});
+
+    // Within each color, add each element to the currently open batch for its type (if any and if it accepts the
+    // element) or else start a new batch with this element (from the custom batch factory, if any, or else from the
+    // element itself)
+    std::unordered_map<std::type_index, std::shared_ptr<ChElementBatch>> open_batches;
+    for (size_t ic = 0; ic < elem_colors.size(); ic++) {
+        open_batches.clear();
+        for (auto ie : elem_colors[ic]) {
+            auto element = velements[ie].get();
+            auto& batch = open_batches[std::type_index(typeid(*element))];
+            if (batch && batch->AddElement(element))
+                continue;
+            batch = elem_batch_factory ? elem_batch_factory->CreateBatch(element) : nullptr;
+            if (!batch)
+                batch = element->CreateBatch();
+            if (batch)
+                elem_batches[ic].push_back(batch);
+            else
+                elem_unbatched[ic].push_back(ie);
+        }
+    }
+
+    elem_batches_valid = true;
 }
 
 // Updates all time-dependant variables, if any...
@@ -289,23 +428,47 @@ void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, con
     }
 
     int nthreads = GetSystem()->nthreads_chrono;
+    UpdateElementColoring();
 
     // elements internal forces
+    // Elements of the same color share no nodes and can therefore write to R concurrently
     timer_internal_forces.start();
-    //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
-#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+    if (use_elem_batches) {
+        UpdateElementBatches();
+#pragma omp parallel num_threads(nthreads)
+        for (size_t ic = 0; ic < elem_colors.size(); ic++) {
+            const auto& batches = elem_batches[ic];
+            const auto& unbatched = elem_unbatched[ic];
+#pragma omp for schedule(dynamic, 1) nowait
+            for (int k = 0; k < (int)batches.size(); k++) {
+                batches[k]->LoadResidual_F(R, c);
+            }
+#pragma omp for schedule(dynamic, 4)
+            for (int k = 0; k < (int)unbatched.size(); k++) {
+                velements[unbatched[k]]->EleIntLoadResidual_F(R, c);
+            }
+        }
+    } else {
+#pragma omp parallel num_threads(nthreads)
+        for (const auto& color : elem_colors) {
+#pragma omp for schedule(dynamic, 4)
+            for (int k = 0; k < (int)color.size(); k++) {
+                velements[color[k]]->EleIntLoadResidual_F(R, c);
+            }
+        }
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
 
     // elements gravity forces
     if (automatic_gravity_load) {
-        //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
-#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        for (int ie = 0; ie < velements.size(); ie++) {
-            velements[ie]->EleIntLoadResidual_F_gravity(R, GetSystem()->GetGravitationalAcceleration(), c);
+        const ChVector3d& G_acc = GetSystem()->GetGravitationalAcceleration();
+#pragma omp parallel num_threads(nthreads)
+        for (const auto& color : elem_colors) {
+#pragma omp for schedule(dynamic, 4)
+            for (int k = 0; k < (int)color.size(); k++) {
+                velements[color[k]]->EleIntLoadResidual_F_gravity(R, G_acc, c);
+            }
         }
     }
 
@@ -351,9 +514,15 @@ void ChMesh::ComputeMassProperties(double& mass,           // ChMesh object mass
     for (unsigned int j = 0; j < vnodes.size(); j++) {
         vnodes[j]->m_TotalMass = 0.0;
     }
-    // Loop over all elements and calculate contribution to nodal mass
-    for (unsigned int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->ComputeNodalMass();
+    // Loop over all elements and calculate contribution to nodal mass (elements of the same color share no nodes)
+    int nthreads = GetSystem() ? GetSystem()->nthreads_chrono : 1;
+    UpdateElementColoring();
+#pragma omp parallel num_threads(nthreads)
+    for (const auto& color : elem_colors) {
+#pragma omp for schedule(dynamic, 4)
+        for (int k = 0; k < (int)color.size(); k++) {
+            velements[color[k]]->ComputeNodalMass();
+        }
     }
 
     // Loop over all the nodes of the mesh to obtain total object mass.
@@ -415,9 +584,15 @@ void ChMesh::IntLoadResidual_Mv(const unsigned int off,      ///< offset in R re
         }
     }
 
-    // internal masses
-    for (unsigned int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_Mv(R, w, c);
+    // internal masses (elements of the same color share no nodes and can write to R concurrently)
+    int nthreads = GetSystem()->nthreads_chrono;
+    UpdateElementColoring();
+#pragma omp parallel num_threads(nthreads)
+    for (const auto& color : elem_colors) {
+#pragma omp for schedule(dynamic, 4)
+        for (int k = 0; k < (int)color.size(); k++) {
+            velements[color[k]]->EleIntLoadResidual_Mv(R, w, c);
+        }
     }
 }
 
@@ -476,9 +651,15 @@ void ChMesh::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
     int nthreads = GetSystem()->nthreads_chrono;
 
     timer_KRMload.start();
-#pragma omp parallel for num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++)
+    // KRM blocks are owned by each element, so no coloring is needed here
+    int num_changed = 0;
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads) reduction(+ : num_changed)
+    for (int ie = 0; ie < (int)velements.size(); ie++) {
         velements[ie]->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+        if (velements[ie]->HasKRMChanged())
+            num_changed++;
+    }
+    num_KRM_changed = (unsigned int)num_changed;
     timer_KRMload.stop();
     ncalls_KRMload++;
 }
@@ -44,13 +44,24 @@ class ChApi ChMesh : public ChIndexedNodes {
           automatic_gravity_load(true),
           num_points_gravity(1),
           ncalls_internal_forces(0),
-          ncalls_KRMload(0) {}
+          ncalls_KRMload(0),
+          num_KRM_changed(0),
+          elem_colors_valid(false),
+          use_elem_batches(false),
+          elem_batches_valid(false) {}
     ChMesh(const ChMesh& other);
     ~ChMesh() {}
 
     /// "Virtual" copy constructor (covariant return type).
     virtual ChMesh* Clone() const override { return new ChMesh(*this); }
 
+    /// Reserve storage for the specified number of nodes and elements.
+    /// This is optional and can be used to avoid reallocations when adding a large number of nodes and elements.
+    void Reserve(unsigned int num_nodes, unsigned int num_elements) {
+        vnodes.reserve(num_nodes);
+        velements.reserve(num_elements);
+    }
+
     /// Add provided node to the mesh.
     void AddNode(std::shared_ptr<ChNodeFEAbase> node);
 
@@ -84,6 +95,11 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Override default in ChPhysicsItem.
     virtual bool IsCollisionEnabled() const override { return true; }
 
+    /// Return an estimate of the memory (in bytes) allocated by the mesh for its node and element lists (including the
+    /// node lists of all elements), element coloring, and element batches.
+    /// The element stiffness matrices (KRM blocks) are reported by the system descriptor.
+    virtual size_t GetMemoryUsage() const override;
+
     /// Reset counters for internal force and Jacobian evaluations.
     void ResetCounters() {
         ncalls_internal_forces = 0;
@@ -104,6 +120,18 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Get cumulative time for Jacobian load calls.
     double GetTimeJacobianLoad() { return timer_KRMload(); }
 
+    /// Enable/disable lazy recomputation of the KRM blocks of all corotational elements in the mesh.
+    /// See ChElementCorotational::SetLazyKRM. Must be called after all elements were added to the mesh.
+    void SetLazyKRM(bool lazy, double rot_tol = 1e-6);
+
+    /// Get the number of element KRM blocks that were recomputed in the last Jacobian load.
+    unsigned int GetNumKRMChanged() const { return num_KRM_changed; }
+
+    /// Return true if any element KRM block was recomputed in the last Jacobian load.
+    /// If false, the mesh contribution to the system matrix did not change since the previous Jacobian load, and the
+    /// mesh does not require a new system matrix assembly and factorization.
+    bool HasKRMChanged() const { return num_KRM_changed > 0; }
+
     /// Add a contact surface.
     void AddContactSurface(std::shared_ptr<ChContactSurface> m_surf);
 
@@ -144,6 +172,28 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// as well as state offsets of contained items.
     virtual void Setup() override;
 
+    /// Get the element coloring, as lists of element indices for each color.
+    /// Elements of the same color share no nodes, so that their contributions to global vectors and to nodal
+    /// quantities can be loaded in parallel without synchronization. The coloring is computed at Setup() and
+    /// recomputed after any change to the list of elements.
+    const std::vector<std::vector<unsigned int>>& GetElementColors();
+
+    /// Enable or disable the batched evaluation of element internal forces (default: false).
+    /// If enabled, elements of the same color and type are grouped in batches (see ChElementBatch) whose internal
+    /// forces are evaluated together, with the arithmetic vectorized across the elements of a batch. Only element types
+    /// which implement ChElementBase::CreateBatch are batched; all other elements are processed individually. Note that
+    /// results may differ from those obtained with per-element evaluation by round-off errors.
+    void SetBatchedInternalForces(bool val);
+
+    /// Return true if batched evaluation of element internal forces is enabled.
+    bool GetBatchedInternalForces() const { return use_elem_batches; }
+
+    /// Set a factory for element batches other than the default ones (default: none).
+    /// If set, the factory is asked first to create the batch for each new group of elements, falling back on
+    /// ChElementBase::CreateBatch if it returns nullptr. Only used if batched evaluation of internal forces is enabled
+    /// (see SetBatchedInternalForces).
+    void SetElementBatchFactory(std::shared_ptr<ChElementBatchFactory> factory);
+
     /// Update time dependent data, for all elements.
     /// Updates all [A] coord.systems for all (corotational) elements.
     virtual void Update(double m_time, bool update_assets = true) override;
@@ -276,6 +326,13 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// </pre>
     virtual void SetupInitial() override;
 
+    /// Partition the mesh elements in groups (colors) of elements sharing no nodes, if not already up to date.
+    /// Uses a greedy coloring of the element graph (elements connected if they share a node).
+    void UpdateElementColoring();
+
+    /// Group elements of the same color in batches for the evaluation of internal forces, if not already up to date.
+    void UpdateElementBatches();
+
     std::vector<std::shared_ptr<ChNodeFEAbase>> vnodes;     ///<  nodes
     std::vector<std::shared_ptr<ChElementBase>> velements;  ///<  elements
 
@@ -292,6 +349,16 @@ class ChApi ChMesh : public ChIndexedNodes {
     ChTimer timer_KRMload;
     unsigned int ncalls_internal_forces;
     unsigned int ncalls_KRMload;
+    unsigned int num_KRM_changed;
+
+    std::vector<std::vector<unsigned int>> elem_colors;  ///< element indices, grouped by color
+    bool elem_colors_valid;                              ///< element coloring is up to date
+
+    bool use_elem_batches;                                                   ///< batched evaluation of internal forces
+    std::vector<std::vector<std::shared_ptr<ChElementBatch>>> elem_batches;  ///< element batches, per color
+    std::vector<std::vector<unsigned int>> elem_unbatched;                   ///< unbatched element indices, per color
+    bool elem_batches_valid;                                                 ///< element batches are up to date
+    std::shared_ptr<ChElementBatchFactory> elem_batch_factory;               ///< custom element batch factory
 
     friend class chrono::ChSystem;
     friend class chrono::ChAssembly;
@@ -15,11 +15,13 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cstdint>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <cctype>
 
 #include "chrono/core/ChFrame.h"
@@ -802,5 +804,167 @@ void ChMeshFileLoader::BSTShellFromObjFile(
     }
 }
 
+// -----------------------------------------------------------------------------
+
+static const char binary_mesh_magic[8] = {'C', 'H', 'M', 'E', 'S', 'H', 'B', '1'};
+static const uint32_t binary_mesh_version = 1;
+
+void ChMeshFileLoader::FromBinaryFile(std::shared_ptr<ChMesh> mesh,
+                                      const std::string& filename,
+                                      const std::vector<std::shared_ptr<ChContinuumMaterial>>& materials,
+                                      ChVector3d pos_transform,
+                                      ChMatrix33<> rot_transform) {
+    std::ifstream fin(filename, std::ios::binary);
+    if (!fin.good())
+        throw std::invalid_argument("ERROR opening binary mesh file: " + filename + "\n");
+
+    // Header
+    char magic[8];
+    uint32_t header[4];
+    fin.read(magic, sizeof(magic));
+    fin.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (!fin || !std::equal(magic, magic + 8, binary_mesh_magic))
+        throw std::invalid_argument("ERROR in binary mesh file: not a Chrono binary mesh file: " + filename + "\n");
+    if (header[0] != binary_mesh_version)
+        throw std::invalid_argument("ERROR in binary mesh file: unsupported version: " + filename + "\n");
+    if (header[3] != 4)
+        throw std::invalid_argument("ERROR in binary mesh file: only 4-node tetrahedrons supported: " + filename +
+                                    "\n");
+    size_t num_nodes = header[1];
+    size_t num_elements = header[2];
+
+    // Bulk read of node coordinates, connectivity, and material ids
+    std::vector<double> coords(3 * num_nodes);
+    std::vector<uint32_t> connectivity(4 * num_elements);
+    std::vector<int32_t> material_ids(num_elements);
+    fin.read(reinterpret_cast<char*>(coords.data()), coords.size() * sizeof(double));
+    fin.read(reinterpret_cast<char*>(connectivity.data()), connectivity.size() * sizeof(uint32_t));
+    fin.read(reinterpret_cast<char*>(material_ids.data()), material_ids.size() * sizeof(int32_t));
+    if (!fin)
+        throw std::invalid_argument("ERROR in binary mesh file: unexpected end of file: " + filename + "\n");
+
+    // Check the materials and the element data
+    if (materials.empty())
+        throw std::invalid_argument("ERROR in binary mesh loader: no materials specified.\n");
+    bool elastic = std::dynamic_pointer_cast<ChContinuumElastic>(materials[0]) != nullptr;
+    for (const auto& mat : materials) {
+        bool is_elastic = std::dynamic_pointer_cast<ChContinuumElastic>(mat) != nullptr;
+        bool is_poisson = std::dynamic_pointer_cast<ChContinuumPoisson3D>(mat) != nullptr;
+        if ((!is_elastic && !is_poisson) || is_elastic != elastic)
+            throw std::invalid_argument("ERROR in binary mesh loader. Material type not supported or mixed. \n");
+    }
+    for (auto id : material_ids) {
+        if (id < 0 || id >= (int32_t)materials.size())
+            throw std::invalid_argument("ERROR in binary mesh file: material id out of range: " + filename + "\n");
+    }
+    for (auto id : connectivity) {
+        if (id >= num_nodes)
+            throw std::invalid_argument("ERROR in binary mesh file: node id out of range: " + filename + "\n");
+    }
+
+    // Create the nodes and elements in parallel
+    std::vector<std::shared_ptr<ChNodeFEAbase>> nodes(num_nodes);
+    std::vector<std::shared_ptr<ChElementBase>> elements(num_elements);
+
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < (int)num_nodes; i++) {
+        ChVector3d pos(coords[3 * i + 0], coords[3 * i + 1], coords[3 * i + 2]);
+        pos = pos_transform + rot_transform * pos;
+        if (elastic)
+            nodes[i] = chrono_types::make_shared<ChNodeFEAxyz>(pos);
+        else
+            nodes[i] = chrono_types::make_shared<ChNodeFEAxyzP>(pos);
+    }
+
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < (int)num_elements; i++) {
+        const uint32_t* n = &connectivity[4 * i];
+        const auto& mat = materials[material_ids[i]];
+        if (elastic) {
+            auto element = chrono_types::make_shared<ChElementTetraCorot_4>();
+            element->SetNodes(std::static_pointer_cast<ChNodeFEAxyz>(nodes[n[0]]),
+                              std::static_pointer_cast<ChNodeFEAxyz>(nodes[n[1]]),
+                              std::static_pointer_cast<ChNodeFEAxyz>(nodes[n[2]]),
+                              std::static_pointer_cast<ChNodeFEAxyz>(nodes[n[3]]));
+            element->SetMaterial(std::static_pointer_cast<ChContinuumElastic>(mat));
+            elements[i] = element;
+        } else {
+            auto element = chrono_types::make_shared<ChElementTetraCorot_4_P>();
+            element->SetNodes(std::static_pointer_cast<ChNodeFEAxyzP>(nodes[n[0]]),
+                              std::static_pointer_cast<ChNodeFEAxyzP>(nodes[n[1]]),
+                              std::static_pointer_cast<ChNodeFEAxyzP>(nodes[n[2]]),
+                              std::static_pointer_cast<ChNodeFEAxyzP>(nodes[n[3]]));
+            element->SetMaterial(std::static_pointer_cast<ChContinuumPoisson3D>(mat));
+            elements[i] = element;
+        }
+    }
+
+    // Add to the mesh, in reserved storage
+    mesh->Reserve(mesh->GetNumNodes() + (unsigned int)num_nodes, mesh->GetNumElements() + (unsigned int)num_elements);
+    for (const auto& node : nodes)
+        mesh->AddNode(node);
+    for (const auto& element : elements)
+        mesh->AddElement(element);
+}
+
+std::vector<std::shared_ptr<ChContinuumMaterial>> ChMeshFileLoader::ToBinaryFile(std::shared_ptr<ChMesh> mesh,
+                                                                                 const std::string& filename) {
+    std::unordered_map<ChNodeFEAbase*, uint32_t> node_ids;
+    std::vector<double> coords;
+    coords.reserve(3 * mesh->GetNumNodes());
+    for (unsigned int i = 0; i < mesh->GetNumNodes(); i++) {
+        auto node = mesh->GetNode(i);
+        ChVector3d pos;
+        if (auto node_xyz = std::dynamic_pointer_cast<ChNodeFEAxyz>(node))
+            pos = node_xyz->GetPos();
+        else if (auto node_xyzp = std::dynamic_pointer_cast<ChNodeFEAxyzP>(node))
+            pos = node_xyzp->GetPos();
+        else
+            throw std::invalid_argument("ERROR in binary mesh export. Node type not supported. \n");
+        node_ids[std::dynamic_pointer_cast<ChNodeFEAbase>(node).get()] = i;
+        coords.push_back(pos.x());
+        coords.push_back(pos.y());
+        coords.push_back(pos.z());
+    }
+
+    std::vector<std::shared_ptr<ChContinuumMaterial>> materials;
+    std::vector<uint32_t> connectivity;
+    std::vector<int32_t> material_ids;
+    connectivity.reserve(4 * mesh->GetNumElements());
+    material_ids.reserve(mesh->GetNumElements());
+    for (const auto& element : mesh->GetElements()) {
+        std::shared_ptr<ChContinuumMaterial> mat;
+        if (auto tet = std::dynamic_pointer_cast<ChElementTetraCorot_4>(element))
+            mat = tet->GetMaterial();
+        else if (auto tet_p = std::dynamic_pointer_cast<ChElementTetraCorot_4_P>(element))
+            mat = tet_p->GetMaterial();
+        else
+            throw std::invalid_argument("ERROR in binary mesh export. Element type not supported. \n");
+
+        for (unsigned int i = 0; i < 4; i++)
+            connectivity.push_back(node_ids.at(element->GetNode(i).get()));
+
+        auto mat_itr = std::find(materials.begin(), materials.end(), mat);
+        material_ids.push_back((int32_t)(mat_itr - materials.begin()));
+        if (mat_itr == materials.end())
+            materials.push_back(mat);
+    }
+
+    std::ofstream fout(filename, std::ios::binary);
+    if (!fout.good())
+        throw std::invalid_argument("ERROR opening binary mesh file for writing: " + filename + "\n");
+
+    uint32_t header[4] = {binary_mesh_version, mesh->GetNumNodes(), mesh->GetNumElements(), 4};
+    fout.write(binary_mesh_magic, sizeof(binary_mesh_magic));
+    fout.write(reinterpret_cast<const char*>(header), sizeof(header));
+    fout.write(reinterpret_cast<const char*>(coords.data()), coords.size() * sizeof(double));
+    fout.write(reinterpret_cast<const char*>(connectivity.data()), connectivity.size() * sizeof(uint32_t));
+    fout.write(reinterpret_cast<const char*>(material_ids.data()), material_ids.size() * sizeof(int32_t));
+    if (!fout)
+        throw std::invalid_argument("ERROR writing binary mesh file: " + filename + "\n");
+
+    return materials;
+}
+
 }  // end namespace fea
 }  // end namespace chrono
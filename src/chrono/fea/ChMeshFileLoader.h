@@ -18,6 +18,8 @@
 #define CHMESH_FILE_LOADER_H
 
 #include <map>
+#include <string>
+#include <vector>
 
 #include "chrono/fea/ChElementShellANCF_3423.h"
 #include "chrono/fea/ChElementShellBST.h"
@@ -91,6 +93,36 @@ class ChApi ChMeshFileLoader {
         ChVector3d pos_transform = VNULL,                       ///< optional displacement of imported mesh
         ChMatrix33<> rot_transform = ChMatrix33<>(1)            ///< optional rotation/scaling of imported mesh
     );
+
+    /// Load tetrahedrons from a binary mesh file (see ToBinaryFile).
+    /// The binary file format (native byte order) is:
+    ///   [magic "CHMESHB1" (8 chars)] [version (uint32)]
+    ///   [# of nodes (uint32)] [# of elements (uint32)] [# of nodes per element (uint32, only 4)]
+    ///   [x y z (double)] for each node
+    ///   [node indices (uint32, 0-based)] for each element
+    ///   [material id (int32)] for each element
+    /// Each block is read with a single bulk read, and nodes and elements are created in parallel into pre-reserved
+    /// mesh storage, which is considerably faster than parsing text files for large meshes.
+    /// Material ids index into the provided list of materials. As for FromTetGenFile, ChContinuumElastic materials
+    /// result in corotational elements with 3D motion nodes and ChContinuumPoisson3D materials in elements with scalar
+    /// field nodes; all materials must be of the same kind.
+    static void FromBinaryFile(
+        std::shared_ptr<ChMesh> mesh,                                        ///< destination mesh
+        const std::string& filename,                                         ///< input file name
+        const std::vector<std::shared_ptr<ChContinuumMaterial>>& materials,  ///< materials, indexed by material id
+        ChVector3d pos_transform = VNULL,                                    ///< optional displacement
+        ChMatrix33<> rot_transform = ChMatrix33<>(1)                         ///< optional rotation/scaling
+    );
+
+    /// Save the tetrahedrons of a mesh (ChElementTetraCorot_4 or ChElementTetraCorot_4_P) to a binary mesh file.
+    /// This can be used to convert meshes loaded from text files (e.g., with FromTetGenFile or FromAbaqusFile) to the
+    /// binary format read by FromBinaryFile. Material ids are assigned to the distinct element materials, in order of
+    /// first appearance, and the list of these materials is returned.
+    /// All mesh nodes are saved, with their current positions. Other element types are not supported.
+    static std::vector<std::shared_ptr<ChContinuumMaterial>> ToBinaryFile(
+        std::shared_ptr<ChMesh> mesh,  ///< source mesh
+        const std::string& filename    ///< output file name
+    );
 };
 
 /// @} fea_utils
@@ -0,0 +1,247 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <deque>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "chrono/fea/ChMeshPartitioner.h"
+
+namespace chrono {
+namespace fea {
+
+ChMeshPartitioner::ChMeshPartitioner() : num_passes(4), imbalance_tol(0.03), edge_cut(0) {}
+
+void ChMeshPartitioner::Partition(ChMesh& mesh, unsigned int num_parts) {
+    if (num_parts == 0)
+        throw std::invalid_argument("ChMeshPartitioner: the number of partitions must be positive");
+
+    const auto& nodes = mesh.GetNodes();
+    const auto& elements = mesh.GetElements();
+    unsigned int num_nodes = (unsigned int)nodes.size();
+    unsigned int num_elements = (unsigned int)elements.size();
+
+    std::unordered_map<ChNodeFEAbase*, unsigned int> node_index;
+    for (unsigned int i = 0; i < num_nodes; i++)
+        node_index.emplace(nodes[i].get(), i);
+
+    // Element connectivity and node-to-element lists
+    std::vector<std::vector<unsigned int>> elem_nodes(num_elements);
+    std::vector<std::vector<unsigned int>> node_elems(num_nodes);
+    for (unsigned int ie = 0; ie < num_elements; ie++) {
+        for (unsigned int in = 0; in < elements[ie]->GetNumNodes(); in++) {
+            auto it = node_index.find(elements[ie]->GetNode(in).get());
+            if (it == node_index.end())
+                throw std::invalid_argument("ChMeshPartitioner: element node not included in the mesh");
+            if (std::find(elem_nodes[ie].begin(), elem_nodes[ie].end(), it->second) != elem_nodes[ie].end())
+                continue;
+            elem_nodes[ie].push_back(it->second);
+            node_elems[it->second].push_back(ie);
+        }
+    }
+
+    // Element dual graph
+    adjacency.assign(num_elements, {});
+    std::vector<unsigned int> mark(num_elements, 0);
+    for (unsigned int ie = 0; ie < num_elements; ie++) {
+        mark[ie] = ie + 1;
+        for (auto n : elem_nodes[ie]) {
+            for (auto je : node_elems[n]) {
+                if (mark[je] != ie + 1) {
+                    mark[je] = ie + 1;
+                    adjacency[ie].push_back(je);
+                }
+            }
+        }
+    }
+
+    // Partition the elements by recursive bisection
+    elem_part.assign(num_elements, 0);
+    side.assign(num_elements, 0);
+    std::vector<unsigned int> all_elements(num_elements);
+    for (unsigned int ie = 0; ie < num_elements; ie++)
+        all_elements[ie] = ie;
+    Bisect(all_elements, num_parts, 0);
+
+    edge_cut = 0;
+    for (unsigned int ie = 0; ie < num_elements; ie++) {
+        for (auto je : adjacency[ie])
+            if (je > ie && elem_part[je] != elem_part[ie])
+                edge_cut++;
+    }
+
+    // Assign each node to the partition containing most of its elements
+    node_part.assign(num_nodes, 0);
+    std::vector<unsigned int> count(num_parts, 0);
+    for (unsigned int n = 0; n < num_nodes; n++) {
+        for (auto ie : node_elems[n])
+            count[elem_part[ie]]++;
+        unsigned int owner = 0;
+        for (auto ie : node_elems[n]) {
+            unsigned int p = elem_part[ie];
+            if (count[p] > count[owner] || (count[p] == count[owner] && p < owner))
+                owner = p;
+        }
+        for (auto ie : node_elems[n])
+            count[elem_part[ie]] = 0;
+        node_part[n] = owner;
+    }
+
+    // Collect the elements, owned nodes, and ghost nodes of each partition
+    parts.assign(num_parts, {});
+    for (unsigned int ie = 0; ie < num_elements; ie++)
+        parts[elem_part[ie]].elements.push_back(ie);
+    for (unsigned int n = 0; n < num_nodes; n++)
+        parts[node_part[n]].nodes.push_back(n);
+
+    std::vector<unsigned int> node_mark(num_nodes, 0);
+    for (unsigned int p = 0; p < num_parts; p++) {
+        for (auto ie : parts[p].elements) {
+            for (auto n : elem_nodes[ie]) {
+                if (node_part[n] != p && node_mark[n] != p + 1) {
+                    node_mark[n] = p + 1;
+                    parts[p].ghost_nodes.push_back(n);
+                }
+            }
+        }
+        std::sort(parts[p].ghost_nodes.begin(), parts[p].ghost_nodes.end());
+    }
+
+    adjacency.clear();
+    side.clear();
+}
+
+void ChMeshPartitioner::Bisect(std::vector<unsigned int>& elements, unsigned int num_parts, unsigned int first_part) {
+    if (num_parts == 1 || elements.empty()) {
+        for (auto ie : elements)
+            elem_part[ie] = first_part;
+        return;
+    }
+
+    // Target number of elements in the first half
+    unsigned int num_parts_0 = num_parts / 2;
+    unsigned int n = (unsigned int)elements.size();
+    unsigned int target = (unsigned int)(((size_t)n * num_parts_0 + num_parts / 2) / num_parts);
+    unsigned int tol = (unsigned int)(imbalance_tol * target);
+
+    // Side of each element in the current set: 0 (first half), 1 (second half), 2 (queued), 3 (visited); elem_part
+    // temporarily flags the elements of the current set
+    const unsigned int in_set = (unsigned int)(-1);
+    for (auto ie : elements)
+        elem_part[ie] = in_set;
+    for (auto ie : elements)
+        side[ie] = 1;
+
+    // Breadth-first traversal from the given element, returning the last element visited
+    auto bfs_last = [&](unsigned int start) {
+        std::vector<unsigned int> queue{start};
+        side[start] = 3;
+        for (size_t i = 0; i < queue.size(); i++) {
+            for (auto je : adjacency[queue[i]]) {
+                if (elem_part[je] == in_set && side[je] == 1) {
+                    side[je] = 3;
+                    queue.push_back(je);
+                }
+            }
+        }
+        for (auto ie : queue)
+            side[ie] = 1;
+        return queue.back();
+    };
+
+    // Graph growing from a pseudo-peripheral element (restarted in each connected component, if necessary)
+    unsigned int count = 0;
+    unsigned int next_seed = 0;
+    bool first_seed = true;
+    while (count < target) {
+        unsigned int seed;
+        if (first_seed) {
+            seed = bfs_last(bfs_last(elements[0]));
+            first_seed = false;
+        } else {
+            while (side[elements[next_seed]] != 1)
+                next_seed++;
+            seed = elements[next_seed];
+        }
+
+        std::deque<unsigned int> queue{seed};
+        side[seed] = 2;
+        while (!queue.empty() && count < target) {
+            unsigned int ie = queue.front();
+            queue.pop_front();
+            side[ie] = 0;
+            count++;
+            for (auto je : adjacency[ie]) {
+                if (elem_part[je] == in_set && side[je] == 1) {
+                    side[je] = 2;
+                    queue.push_back(je);
+                }
+            }
+        }
+        for (auto ie : queue)
+            side[ie] = 1;
+    }
+
+    // Boundary refinement: move elements with positive gain (reduction of the edge cut) within the balance tolerance
+    for (int pass = 0; pass < num_passes; pass++) {
+        bool moved = false;
+        for (auto ie : elements) {
+            char s = side[ie];
+            int gain = 0;
+            for (auto je : adjacency[ie]) {
+                if (elem_part[je] == in_set)
+                    gain += (side[je] == s) ? -1 : 1;
+            }
+            if (gain <= 0)
+                continue;
+            unsigned int new_count = (s == 0) ? count - 1 : count + 1;
+            if (new_count + tol < target || new_count > target + tol || new_count == 0 || new_count == n)
+                continue;
+            side[ie] = 1 - s;
+            count = new_count;
+            moved = true;
+        }
+        if (!moved)
+            break;
+    }
+
+    std::vector<unsigned int> elements_0;
+    std::vector<unsigned int> elements_1;
+    elements_0.reserve(count);
+    elements_1.reserve(n - count);
+    for (auto ie : elements) {
+        if (side[ie] == 0)
+            elements_0.push_back(ie);
+        else
+            elements_1.push_back(ie);
+    }
+    for (auto ie : elements)
+        elem_part[ie] = first_part;
+
+    Bisect(elements_0, num_parts_0, first_part);
+    Bisect(elements_1, num_parts - num_parts_0, first_part + num_parts_0);
+}
+
+double ChMeshPartitioner::GetImbalance() const {
+    if (parts.empty() || elem_part.empty())
+        return 1;
+    size_t max_size = 0;
+    for (const auto& part : parts)
+        max_size = std::max(max_size, part.elements.size());
+    return max_size * (double)parts.size() / elem_part.size();
+}
+
+}  // end namespace fea
+}  // end namespace chrono
@@ -0,0 +1,96 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_MESH_PARTITIONER_H
+#define CH_MESH_PARTITIONER_H
+
+#include <vector>
+
+#include "chrono/fea/ChMesh.h"
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup fea_utils
+/// @{
+
+/// Partitioning of the elements and nodes of a ChMesh in a given number of sub-domains.
+/// The elements are partitioned by recursive bisection of the element dual graph (two elements are adjacent if they
+/// share at least one node). Each bisection uses graph growing from a pseudo-peripheral element, followed by a few
+/// boundary refinement passes (Fiduccia-Mattheyses gains) which reduce the edge cut while keeping the two halves
+/// balanced, similar to the initial partitioning phase of METIS.
+///
+/// Each node is owned by exactly one partition (the one containing most of the elements connected to the node).
+/// The nodes referenced by the elements of a partition, but owned by other partitions, are the ghost nodes of that
+/// partition: these are the nodes whose internal force contributions must be exchanged between sub-domains.
+class ChApi ChMeshPartitioner {
+  public:
+    /// Elements, owned nodes, and ghost nodes of one partition (as indices in the mesh element and node lists).
+    struct Part {
+        std::vector<unsigned int> elements;     ///< elements in this partition
+        std::vector<unsigned int> nodes;        ///< nodes owned by this partition
+        std::vector<unsigned int> ghost_nodes;  ///< nodes of the partition elements owned by other partitions
+    };
+
+    ChMeshPartitioner();
+
+    /// Set the number of boundary refinement passes for each bisection (default: 4).
+    void SetNumRefinementPasses(int passes) { num_passes = passes; }
+
+    /// Set the allowed load imbalance for each bisection, as a fraction of the target size (default: 0.03).
+    void SetImbalanceTolerance(double tol) { imbalance_tol = tol; }
+
+    /// Partition the given mesh in the specified number of parts.
+    /// Nodes referenced by elements must be included in the mesh node list. Nodes not connected to any element are
+    /// assigned to the partition 0.
+    void Partition(ChMesh& mesh, unsigned int num_parts);
+
+    /// Get the number of partitions.
+    unsigned int GetNumParts() const { return (unsigned int)parts.size(); }
+
+    /// Get the specified partition.
+    const Part& GetPartition(unsigned int p) const { return parts[p]; }
+
+    /// Get the partition of each element of the mesh.
+    const std::vector<unsigned int>& GetElementPartition() const { return elem_part; }
+
+    /// Get the partition owning each node of the mesh.
+    const std::vector<unsigned int>& GetNodePartition() const { return node_part; }
+
+    /// Get the number of edges of the element dual graph which connect elements in different partitions.
+    unsigned int GetEdgeCut() const { return edge_cut; }
+
+    /// Get the load imbalance, as the ratio of the largest partition size over the average partition size.
+    double GetImbalance() const;
+
+  private:
+    void Bisect(std::vector<unsigned int>& elements, unsigned int num_parts, unsigned int first_part);
+
+    int num_passes;
+    double imbalance_tol;
+
+    std::vector<std::vector<unsigned int>> adjacency;  ///< element dual graph
+    std::vector<char> side;                            ///< element sides in the current bisection
+    std::vector<unsigned int> elem_part;
+    std::vector<unsigned int> node_part;
+    std::vector<Part> parts;
+    unsigned int edge_cut;
+};
+
+/// @} fea_utils
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
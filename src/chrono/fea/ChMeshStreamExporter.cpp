@@ -0,0 +1,344 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "chrono/fea/ChMeshStreamExporter.h"
+#include "chrono/fea/ChElementHexaCorot_8.h"
+#include "chrono/fea/ChElementHexaCorot_20.h"
+#include "chrono/fea/ChElementHexahedron.h"
+#include "chrono/fea/ChElementShell.h"
+#include "chrono/fea/ChElementTetraCorot_4.h"
+#include "chrono/fea/ChElementTetraCorot_10.h"
+#include "chrono/fea/ChElementTetrahedron.h"
+#include "chrono/fea/ChNodeFEAxyz.h"
+#include "chrono/fea/ChNodeFEAxyzP.h"
+#include "chrono/fea/ChNodeFEAxyzrot.h"
+
+namespace chrono {
+namespace fea {
+
+// XDMF cell type codes for mixed topologies
+static const int32_t XDMF_POLYLINE = 2;
+static const int32_t XDMF_TRIANGLE = 4;
+static const int32_t XDMF_QUADRILATERAL = 5;
+static const int32_t XDMF_TETRAHEDRON = 6;
+static const int32_t XDMF_HEXAHEDRON = 9;
+
+// Get the position and velocity of an FEA node (zero velocity for nodes without one).
+static bool GetNodeState(ChNodeFEAbase* node, ChVector3d& pos, ChVector3d& vel) {
+    if (auto n = dynamic_cast<ChNodeXYZ*>(node)) {
+        pos = n->GetPos();
+        vel = n->GetPosDt();
+        return true;
+    }
+    if (auto n = dynamic_cast<ChNodeFEAxyzrot*>(node)) {
+        pos = n->GetPos();
+        vel = n->GetPosDt();
+        return true;
+    }
+    if (auto n = dynamic_cast<ChNodeFEAxyzP*>(node)) {
+        pos = n->GetPos();
+        vel = VNULL;
+        return true;
+    }
+    pos = VNULL;
+    vel = VNULL;
+    return false;
+}
+
+// Get the von Mises stress at the center of an element (0 if not available).
+static double GetElementStress(ChElementBase* element) {
+    if (auto e = dynamic_cast<ChElementTetraCorot_4*>(element))
+        return e->GetStress().GetEquivalentVonMises();
+    if (auto e = dynamic_cast<ChElementTetraCorot_10*>(element))
+        return e->GetStress(0.25, 0.25, 0.25, 0.25).GetEquivalentVonMises();
+    if (auto e = dynamic_cast<ChElementHexaCorot_8*>(element))
+        return e->GetStress(0, 0, 0).GetEquivalentVonMises();
+    if (auto e = dynamic_cast<ChElementHexaCorot_20*>(element))
+        return e->GetStress(0, 0, 0).GetEquivalentVonMises();
+    return 0;
+}
+
+ChMeshStreamExporter::ChMeshStreamExporter(std::shared_ptr<ChMesh> mesh,
+                                           const std::string& base_filename,
+                                           Precision precision,
+                                           size_t max_pending)
+    : m_mesh(mesh),
+      m_precision(precision),
+      m_bin_filename(base_filename + ".bin"),
+      m_xmf_filename(base_filename + ".xmf"),
+      m_num_frames(0),
+      m_file_size(0),
+      m_writer(max_pending) {
+    m_num_nodes = mesh->GetNumNodes();
+    m_num_cells = mesh->GetNumElements();
+
+    // Mesh indices of the nodes
+    std::unordered_map<ChNodeFEAbase*, int32_t> node_index;
+    for (unsigned int i = 0; i < m_num_nodes; i++)
+        node_index[mesh->GetNodes()[i].get()] = (int32_t)i;
+    auto index = [&](ChNodeFEAbase* node) {
+        auto it = node_index.find(node);
+        if (it == node_index.end())
+            throw std::runtime_error("ChMeshStreamExporter - element node not in mesh");
+        return it->second;
+    };
+
+    // Mixed topology: cell type followed by the cell node indices (and the node count for polylines)
+    std::vector<int32_t> topology;
+    for (unsigned int i = 0; i < m_num_cells; i++) {
+        auto element = mesh->GetElement(i);
+        if (auto tet = std::dynamic_pointer_cast<ChElementTetrahedron>(element)) {
+            topology.push_back(XDMF_TETRAHEDRON);
+            for (unsigned int k = 0; k < 4; k++)
+                topology.push_back(index(tet->GetTetrahedronNode(k).get()));
+        } else if (auto hex = std::dynamic_pointer_cast<ChElementHexahedron>(element)) {
+            topology.push_back(XDMF_HEXAHEDRON);
+            for (unsigned int k = 0; k < 8; k++)
+                topology.push_back(index(hex->GetHexahedronNode(k).get()));
+        } else if (std::dynamic_pointer_cast<ChElementShell>(element) && element->GetNumNodes() >= 3) {
+            unsigned int n = element->GetNumNodes() == 3 ? 3 : 4;
+            topology.push_back(n == 3 ? XDMF_TRIANGLE : XDMF_QUADRILATERAL);
+            for (unsigned int k = 0; k < n; k++)
+                topology.push_back(index(element->GetNode(k).get()));
+        } else if (element->GetNumNodes() >= 2) {
+            topology.push_back(XDMF_POLYLINE);
+            topology.push_back(2);
+            for (unsigned int k = 0; k < 2; k++)
+                topology.push_back(index(element->GetNode(k).get()));
+        } else {
+            throw std::runtime_error("ChMeshStreamExporter - unsupported element with fewer than 2 nodes");
+        }
+    }
+    m_topology_size = topology.size();
+
+    // Reference node positions
+    m_ref.resize(3 * m_num_nodes);
+    for (unsigned int i = 0; i < m_num_nodes; i++) {
+        ChVector3d pos, vel;
+        GetNodeState(mesh->GetNodes()[i].get(), pos, vel);
+        m_ref[3 * i + 0] = pos.x();
+        m_ref[3 * i + 1] = pos.y();
+        m_ref[3 * i + 2] = pos.z();
+    }
+
+    // Write the static part of the binary file (truncating any existing file) and an index with no frames
+    std::ofstream bin(m_bin_filename, std::ios::binary | std::ios::trunc);
+    if (!bin.is_open())
+        throw std::runtime_error("ChMeshStreamExporter - cannot open file " + m_bin_filename);
+    bin.write(reinterpret_cast<const char*>(topology.data()), topology.size() * sizeof(int32_t));
+    bin.write(reinterpret_cast<const char*>(m_ref.data()), m_ref.size() * sizeof(double));
+    if (!bin)
+        throw std::runtime_error("ChMeshStreamExporter - error writing file " + m_bin_filename);
+    m_file_size = topology.size() * sizeof(int32_t) + m_ref.size() * sizeof(double);
+
+    WriteIndexHeader();
+}
+
+ChMeshStreamExporter::~ChMeshStreamExporter() {
+    try {
+        m_writer.Flush();
+    } catch (const std::exception& e) {
+        std::cerr << "ChMeshStreamExporter ERROR: " << e.what() << std::endl;
+    }
+}
+
+void ChMeshStreamExporter::WriteFrame(double time) {
+    if (m_mesh->GetNumNodes() != m_num_nodes || m_mesh->GetNumElements() != m_num_cells)
+        throw std::runtime_error("ChMeshStreamExporter::WriteFrame - mesh topology changed");
+
+    // Snapshot of the current mesh state (taken on the calling thread)
+    auto data = std::make_shared<FrameData>();
+    data->time = time;
+    data->displacement.resize(3 * m_num_nodes);
+    data->velocity.resize(3 * m_num_nodes);
+    data->stress.resize(m_num_cells);
+
+    for (unsigned int i = 0; i < m_num_nodes; i++) {
+        ChVector3d pos, vel;
+        GetNodeState(m_mesh->GetNodes()[i].get(), pos, vel);
+        for (int k = 0; k < 3; k++) {
+            data->displacement[3 * i + k] = pos[k] - m_ref[3 * i + k];
+            data->velocity[3 * i + k] = vel[k];
+        }
+    }
+    for (unsigned int i = 0; i < m_num_cells; i++)
+        data->stress[i] = GetElementStress(m_mesh->GetElement(i).get());
+
+    m_num_frames++;
+    m_writer.Submit([this, data]() { ProcessFrame(*data); });
+}
+
+void ChMeshStreamExporter::Flush() {
+    m_writer.Flush();
+}
+
+void ChMeshStreamExporter::ProcessFrame(const FrameData& data) {
+    FrameInfo info;
+    info.time = data.time;
+    info.displacement = AppendArray(data.displacement);
+    info.velocity = AppendArray(data.velocity);
+    info.stress = AppendArray(data.stress);
+
+    // Index the frame only after all its arrays were written
+    AppendIndex(info);
+}
+
+ChMeshStreamExporter::ArrayInfo ChMeshStreamExporter::AppendArray(const std::vector<double>& values) {
+    ArrayInfo info;
+    info.offset = m_file_size;
+    info.scale = 1;
+    info.shift = 0;
+
+    switch (m_precision) {
+        case Precision::DOUBLE: {
+            m_buffer.resize(values.size() * sizeof(double));
+            std::memcpy(m_buffer.data(), values.data(), m_buffer.size());
+            break;
+        }
+        case Precision::FLOAT: {
+            m_buffer.resize(values.size() * sizeof(float));
+            float* dst = reinterpret_cast<float*>(m_buffer.data());
+            for (size_t i = 0; i < values.size(); i++)
+                dst[i] = (float)values[i];
+            break;
+        }
+        case Precision::QUANTIZED: {
+            double vmin = 0;
+            double vmax = 0;
+            if (!values.empty()) {
+                auto range = std::minmax_element(values.begin(), values.end());
+                vmin = *range.first;
+                vmax = *range.second;
+            }
+            info.shift = vmin;
+            info.scale = (vmax > vmin) ? (vmax - vmin) / 65535 : 1;
+            m_buffer.resize(values.size() * sizeof(uint16_t));
+            uint16_t* dst = reinterpret_cast<uint16_t*>(m_buffer.data());
+            for (size_t i = 0; i < values.size(); i++)
+                dst[i] = (uint16_t)std::lround((values[i] - info.shift) / info.scale);
+            break;
+        }
+    }
+
+    std::ofstream bin(m_bin_filename, std::ios::binary | std::ios::app);
+    bin.write(reinterpret_cast<const char*>(m_buffer.data()), m_buffer.size());
+    if (!bin)
+        throw std::runtime_error("ChMeshStreamExporter - error writing file " + m_bin_filename);
+    m_file_size += m_buffer.size();
+
+    return info;
+}
+
+// Closing tags of the XDMF index, rewritten after the last frame
+static const char* xdmf_trailer = "    </Grid>\n  </Domain>\n</Xdmf>\n";
+
+void ChMeshStreamExporter::WriteIndexHeader() {
+    m_index.open(m_xmf_filename, std::ios::out | std::ios::trunc);
+    if (!m_index.is_open())
+        throw std::runtime_error("ChMeshStreamExporter - cannot open file " + m_xmf_filename);
+
+    m_index << "<?xml version=\"1.0\" ?>\n";
+    m_index << "<Xdmf Version=\"3.0\">\n";
+    m_index << "  <Domain>\n";
+    m_index << "    <Grid Name=\"mesh\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+    m_index_end = m_index.tellp();
+    m_index << xdmf_trailer << std::flush;
+    if (!m_index)
+        throw std::runtime_error("ChMeshStreamExporter - error writing file " + m_xmf_filename);
+}
+
+void ChMeshStreamExporter::AppendIndex(const FrameInfo& frame) {
+    std::string bin_name = m_bin_filename.substr(m_bin_filename.find_last_of("/\\") + 1);
+
+    std::string number_type;
+    int precision = 0;
+    switch (m_precision) {
+        case Precision::DOUBLE:
+            number_type = "Float";
+            precision = 8;
+            break;
+        case Precision::FLOAT:
+            number_type = "Float";
+            precision = 4;
+            break;
+        case Precision::QUANTIZED:
+            number_type = "UInt";
+            precision = 2;
+            break;
+    }
+
+    auto data_item = [&](std::ostream& os, const ArrayInfo& info, const std::string& dims) {
+        if (m_precision == Precision::QUANTIZED) {
+            os << "          <DataItem ItemType=\"Function\" Dimensions=\"" << dims << "\" Function=\"$0 * "
+               << info.scale << " + " << info.shift << "\">\n";
+            os << "            <DataItem Format=\"Binary\" Endian=\"Native\" NumberType=\"UInt\" Precision=\"2\" "
+                  "Seek=\""
+               << info.offset << "\" Dimensions=\"" << dims << "\">" << bin_name << "</DataItem>\n";
+            os << "          </DataItem>\n";
+        } else {
+            os << "          <DataItem Format=\"Binary\" Endian=\"Native\" NumberType=\"" << number_type
+               << "\" Precision=\"" << precision << "\" Seek=\"" << info.offset << "\" Dimensions=\"" << dims << "\">"
+               << bin_name << "</DataItem>\n";
+        }
+    };
+
+    std::string node_dims = std::to_string(m_num_nodes) + " 3";
+    std::string cell_dims = std::to_string(m_num_cells);
+    uint64_t geometry_offset = m_topology_size * sizeof(int32_t);
+
+    std::ostringstream os;
+    os.precision(17);
+    os << "      <Grid Name=\"frame\" GridType=\"Uniform\">\n";
+    os << "        <Time Value=\"" << frame.time << "\"/>\n";
+    os << "        <Topology TopologyType=\"Mixed\" NumberOfElements=\"" << m_num_cells << "\">\n";
+    os << "          <DataItem Format=\"Binary\" Endian=\"Native\" NumberType=\"Int\" Precision=\"4\" Seek=\"0\" "
+          "Dimensions=\""
+       << m_topology_size << "\">" << bin_name << "</DataItem>\n";
+    os << "        </Topology>\n";
+    os << "        <Geometry GeometryType=\"XYZ\">\n";
+    os << "          <DataItem Format=\"Binary\" Endian=\"Native\" NumberType=\"Float\" Precision=\"8\" Seek=\""
+       << geometry_offset << "\" Dimensions=\"" << node_dims << "\">" << bin_name << "</DataItem>\n";
+    os << "        </Geometry>\n";
+    os << "        <Attribute Name=\"displacement\" AttributeType=\"Vector\" Center=\"Node\">\n";
+    data_item(os, frame.displacement, node_dims);
+    os << "        </Attribute>\n";
+    os << "        <Attribute Name=\"velocity\" AttributeType=\"Vector\" Center=\"Node\">\n";
+    data_item(os, frame.velocity, node_dims);
+    os << "        </Attribute>\n";
+    os << "        <Attribute Name=\"stress_vM\" AttributeType=\"Scalar\" Center=\"Cell\">\n";
+    data_item(os, frame.stress, cell_dims);
+    os << "        </Attribute>\n";
+    os << "      </Grid>\n";
+
+    // Overwrite the closing tags with the new frame, then close the document again
+    m_index.seekp(m_index_end);
+    m_index << os.str();
+    m_index_end = m_index.tellp();
+    m_index << xdmf_trailer << std::flush;
+    if (!m_index)
+        throw std::runtime_error("ChMeshStreamExporter - error writing file " + m_xmf_filename);
+}
+
+}  // end namespace fea
+}  // end namespace chrono
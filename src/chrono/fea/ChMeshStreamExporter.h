@@ -0,0 +1,149 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_MESH_STREAM_EXPORTER_H
+#define CH_MESH_STREAM_EXPORTER_H
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chrono/fea/ChMesh.h"
+#include "chrono/utils/ChAsyncWriter.h"
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup fea_utils
+/// @{
+
+/// Streaming binary exporter of FEA mesh results.
+/// Unlike ChMeshExporter, which writes a complete text file per frame, this exporter appends all frames to a single
+/// raw binary file '<base>.bin': the mesh connectivity and reference node positions are written once, followed by the
+/// per-frame arrays of node displacements, node velocities, and element von Mises stresses. A companion XDMF file
+/// '<base>.xmf' indexes the binary file (offset and layout of each array) as a temporal collection of grids; each new
+/// frame is appended to it in place (only the closing tags are rewritten), so that the index always describes all
+/// complete frames, and it can be opened directly with Paraview or Visit. Since the arrays are stored
+/// uncompressed at known offsets, the binary file can also be memory-mapped for post-processing.
+///
+/// Frame data is copied from the mesh on the calling thread, then converted and written by a background writer, so
+/// that file output overlaps with the simulation. Arrays are stored in native byte order.
+///
+/// Supported cells are tetrahedra (ChElementTetrahedron), hexahedra (ChElementHexahedron), triangular and
+/// quadrilateral shells (ChElementShell); any other element is output as a line segment between its first two nodes.
+/// Element stresses are available for the corotational tetrahedron and hexahedron elements and are set to 0 for all
+/// other elements.
+class ChApi ChMeshStreamExporter {
+  public:
+    /// Storage precision of the per-frame arrays.
+    enum class Precision {
+        DOUBLE,    ///< 64-bit floating point
+        FLOAT,     ///< 32-bit floating point
+        QUANTIZED  ///< 16-bit unsigned integers, linearly mapped to the range of each array in each frame
+    };
+
+    /// Create a streaming exporter for the given mesh, writing to files '<base_filename>.bin' and
+    /// '<base_filename>.xmf'. The mesh connectivity and the current node positions (used as reference configuration
+    /// for displacements) are written immediately. The mesh topology must not change afterwards. At most
+    /// 'max_pending' frames are buffered by the background writer.
+    ChMeshStreamExporter(std::shared_ptr<ChMesh> mesh,
+                         const std::string& base_filename,
+                         Precision precision = Precision::FLOAT,
+                         size_t max_pending = 4);
+
+    /// Write all pending frames and close the output files.
+    ~ChMeshStreamExporter();
+
+    ChMeshStreamExporter(const ChMeshStreamExporter&) = delete;
+    ChMeshStreamExporter& operator=(const ChMeshStreamExporter&) = delete;
+
+    /// Output the current state of the mesh as a new frame at the specified time.
+    /// Only a copy of the mesh state is made here; the frame is written in the background.
+    void WriteFrame(double time);
+
+    /// Wait until all frames are written.
+    /// An error encountered while writing a frame is reported here as an exception.
+    void Flush();
+
+    /// Get the number of output frames.
+    unsigned int GetNumFrames() const { return m_num_frames; }
+
+    /// Get the number of exported nodes.
+    unsigned int GetNumNodes() const { return m_num_nodes; }
+
+    /// Get the number of exported cells (one per element).
+    unsigned int GetNumCells() const { return m_num_cells; }
+
+    /// Get the name of the binary data file.
+    const std::string& GetDataFilename() const { return m_bin_filename; }
+
+    /// Get the name of the XDMF index file.
+    const std::string& GetIndexFilename() const { return m_xmf_filename; }
+
+  private:
+    /// Location and encoding of one array in the binary file.
+    struct ArrayInfo {
+        uint64_t offset;  ///< byte offset in binary file
+        double scale;     ///< dequantization scale (QUANTIZED only)
+        double shift;     ///< dequantization offset (QUANTIZED only)
+    };
+
+    /// Index of one frame in the binary file.
+    struct FrameInfo {
+        double time;
+        ArrayInfo displacement;
+        ArrayInfo velocity;
+        ArrayInfo stress;
+    };
+
+    /// Snapshot of the mesh state for one frame.
+    struct FrameData {
+        double time;
+        std::vector<double> displacement;
+        std::vector<double> velocity;
+        std::vector<double> stress;
+    };
+
+    void ProcessFrame(const FrameData& data);
+    ArrayInfo AppendArray(const std::vector<double>& values);
+    void WriteIndexHeader();
+    void AppendIndex(const FrameInfo& frame);
+
+    std::shared_ptr<ChMesh> m_mesh;
+    Precision m_precision;
+    std::string m_bin_filename;
+    std::string m_xmf_filename;
+
+    unsigned int m_num_nodes;
+    unsigned int m_num_cells;
+    size_t m_topology_size;      ///< number of entries in the mixed topology array
+    std::vector<double> m_ref;   ///< reference node positions
+
+    unsigned int m_num_frames;
+    uint64_t m_file_size;            ///< current size of the binary file (writer thread)
+    std::vector<uint8_t> m_buffer;   ///< encoding buffer (writer thread)
+    std::ofstream m_index;           ///< XDMF index file (writer thread)
+    std::streampos m_index_end;      ///< position of the closing tags in the index file (writer thread)
+
+    utils::ChAsyncWriter m_writer;
+};
+
+/// @} fea_utils
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
@@ -14,6 +14,7 @@
 #define CHFUNCT_H
 
 #include "chrono/functions/ChFunctionBSpline.h"
+#include "chrono/functions/ChFunctionCompiled.h"
 #include "chrono/functions/ChFunctionConst.h"
 #include "chrono/functions/ChFunctionConstAcc.h"
 #include "chrono/functions/ChFunctionConstJerk.h"
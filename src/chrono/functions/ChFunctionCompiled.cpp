@@ -0,0 +1,369 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <typeinfo>
+
+#include "chrono/functions/ChFunctionCompiled.h"
+#include "chrono/functions/ChFunctionConst.h"
+#include "chrono/functions/ChFunctionMirror.h"
+#include "chrono/functions/ChFunctionOperator.h"
+#include "chrono/functions/ChFunctionPoly.h"
+#include "chrono/functions/ChFunctionRamp.h"
+#include "chrono/functions/ChFunctionRepeat.h"
+#include "chrono/functions/ChFunctionSequence.h"
+#include "chrono/functions/ChFunctionSine.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChFunctionCompiled)
+
+// Number of registers for which the tape is executed without heap allocation
+static const int NUM_LOCAL_REGS = 64;
+
+ChFunctionCompiled::ChFunctionCompiled(std::shared_ptr<ChFunction> fun) : m_num_regs(1), m_out(0) {
+    SetFunction(fun);
+}
+
+ChFunctionCompiled::ChFunctionCompiled(const ChFunctionCompiled& other) : m_num_regs(1), m_out(0) {
+    if (other.m_fun)
+        SetFunction(std::shared_ptr<ChFunction>(other.m_fun->Clone()));
+}
+
+void ChFunctionCompiled::SetFunction(std::shared_ptr<ChFunction> fun) {
+    m_fun = fun;
+    Compile();
+}
+
+// -----------------------------------------------------------------------------
+// Compilation
+// -----------------------------------------------------------------------------
+
+void ChFunctionCompiled::Compile() {
+    m_tape.clear();
+    m_consts.clear();
+    m_leaves.clear();
+    m_sequences.clear();
+    m_num_regs = 1;
+
+    if (!m_fun) {
+        m_consts.push_back(0);
+        m_out = Append(OpCode::CONST, 0, 0, 0);
+        return;
+    }
+
+    m_out = Emit(m_fun, 0);
+}
+
+int ChFunctionCompiled::Append(OpCode op, int a, int b, size_t idx, int n) {
+    m_tape.push_back({op, m_num_regs, a, b, n, idx});
+    return m_num_regs++;
+}
+
+int ChFunctionCompiled::Emit(std::shared_ptr<ChFunction> fun, int arg) {
+    // Only exact types are translated, as derived classes may redefine the function
+    const auto& type = typeid(*fun);
+    size_t idx = m_consts.size();
+
+    if (type == typeid(ChFunctionConst)) {
+        m_consts.push_back(std::static_pointer_cast<ChFunctionConst>(fun)->GetConstant());
+        return Append(OpCode::CONST, arg, 0, idx);
+    }
+
+    if (type == typeid(ChFunctionRamp)) {
+        auto ramp = std::static_pointer_cast<ChFunctionRamp>(fun);
+        m_consts.push_back(ramp->GetStartVal());
+        m_consts.push_back(ramp->GetAngularCoeff());
+        return Append(OpCode::RAMP, arg, 0, idx);
+    }
+
+    if (type == typeid(ChFunctionSine)) {
+        auto sine = std::static_pointer_cast<ChFunctionSine>(fun);
+        m_consts.push_back(sine->GetAmplitude());
+        m_consts.push_back(sine->GetAngularRate());
+        m_consts.push_back(sine->GetPhase());
+        return Append(OpCode::SINE, arg, 0, idx);
+    }
+
+    if (type == typeid(ChFunctionPoly)) {
+        auto coeffs = std::static_pointer_cast<ChFunctionPoly>(fun)->GetCoefficients();
+        m_consts.insert(m_consts.end(), coeffs.begin(), coeffs.end());
+        return Append(OpCode::POLY, arg, 0, idx, (int)coeffs.size());
+    }
+
+    if (type == typeid(ChFunctionOperator)) {
+        auto oper = std::static_pointer_cast<ChFunctionOperator>(fun);
+        switch (oper->GetOperationType()) {
+            case ChFunctionOperator::FUNCT:
+                return Emit(oper->GetFirstOperandFunction(), Emit(oper->GetSecondOperandFunction(), arg));
+            case ChFunctionOperator::FABS:
+                return Append(OpCode::FABS, Emit(oper->GetFirstOperandFunction(), arg), 0, 0);
+            default:
+                break;
+        }
+
+        int a = Emit(oper->GetFirstOperandFunction(), arg);
+        int b = Emit(oper->GetSecondOperandFunction(), arg);
+        switch (oper->GetOperationType()) {
+            case ChFunctionOperator::ADD:
+                return Append(OpCode::ADD, a, b, 0);
+            case ChFunctionOperator::SUB:
+                return Append(OpCode::SUB, a, b, 0);
+            case ChFunctionOperator::MUL:
+                return Append(OpCode::MUL, a, b, 0);
+            case ChFunctionOperator::DIV:
+                return Append(OpCode::DIV, a, b, 0);
+            case ChFunctionOperator::POW:
+                return Append(OpCode::POW, a, b, 0);
+            case ChFunctionOperator::MAX:
+                return Append(OpCode::MAX, a, b, 0);
+            case ChFunctionOperator::MIN:
+                return Append(OpCode::MIN, a, b, 0);
+            case ChFunctionOperator::MODULO:
+                return Append(OpCode::MODULO, a, b, 0);
+            default:
+                m_consts.push_back(0);
+                return Append(OpCode::CONST, arg, 0, idx);
+        }
+    }
+
+    if (type == typeid(ChFunctionMirror)) {
+        auto mirror = std::static_pointer_cast<ChFunctionMirror>(fun);
+        m_consts.push_back(mirror->GetMirrorAxis());
+        return Emit(mirror->GetOperandFunction(), Append(OpCode::MIRROR, arg, 0, idx));
+    }
+
+    if (type == typeid(ChFunctionRepeat)) {
+        auto repeat = std::static_pointer_cast<ChFunctionRepeat>(fun);
+        m_consts.push_back(repeat->GetSliceStart());
+        m_consts.push_back(repeat->GetSliceWidth());
+        m_consts.push_back(repeat->GetSliceShift());
+        return Emit(repeat->GetRepeatedFunction(), Append(OpCode::REPEAT, arg, 0, idx));
+    }
+
+    if (type == typeid(ChFunctionSequence)) {
+        // The SEQ instruction selects the segment containing the argument and jumps to its block. Each block ends
+        // with a SEQ_END instruction which adds the segment continuity offsets and jumps past all blocks. All blocks
+        // write their result in the output register of the SEQ instruction.
+        auto& nodes = std::static_pointer_cast<ChFunctionSequence>(fun)->GetFunctions();
+        size_t iseq = m_sequences.size();
+        m_sequences.push_back(Sequence());
+        int out = Append(OpCode::SEQ, arg, 0, iseq);
+
+        std::vector<Segment> segments;
+        for (auto& node : nodes) {
+            Segment seg{node.t_start, node.t_end, node.Iy, node.Iydt, node.Iydtdt, m_tape.size(), m_num_regs++};
+            int res = Emit(node.fx, seg.arg);
+            m_tape.push_back({OpCode::SEQ_END, out, res, 0, (int)segments.size(), iseq});
+            segments.push_back(seg);
+        }
+
+        m_sequences[iseq].segments = segments;
+        m_sequences[iseq].end_pc = m_tape.size();
+        return out;
+    }
+
+    // Any other function is evaluated through virtual calls
+    m_leaves.push_back(fun.get());
+    return Append(OpCode::LEAF, arg, 0, m_leaves.size() - 1);
+}
+
+// -----------------------------------------------------------------------------
+// Execution
+// -----------------------------------------------------------------------------
+
+ChFunctionCompiled::Jet ChFunctionCompiled::Execute(double x, int order) const {
+    Jet local[NUM_LOCAL_REGS];
+    std::vector<Jet> heap;
+    Jet* regs = local;
+    if (m_num_regs > NUM_LOCAL_REGS) {
+        heap.resize(m_num_regs);
+        regs = heap.data();
+    }
+
+    regs[0] = {x, 1, 0};
+
+    // Compose a function, with value and derivatives f0, f1, f2 at a.v, with the argument a
+    auto chain = [order](const Jet& a, double f0, double f1, double f2) {
+        return Jet{f0, order > 0 ? f1 * a.d : 0, order > 1 ? f2 * a.d * a.d + f1 * a.dd : 0};
+    };
+
+    size_t pc = 0;
+    while (pc < m_tape.size()) {
+        const Instruction& in = m_tape[pc++];
+        const Jet& a = regs[in.a];
+        const Jet& b = regs[in.b];
+        Jet& r = regs[in.out];
+        const double* c = (in.idx < m_consts.size()) ? &m_consts[in.idx] : nullptr;
+
+        switch (in.op) {
+            case OpCode::CONST:
+                r = {c[0], 0, 0};
+                break;
+            case OpCode::RAMP:
+                r = chain(a, c[0] + c[1] * a.v, c[1], 0);
+                break;
+            case OpCode::SINE: {
+                double s = std::sin(c[2] + c[1] * a.v);
+                double co = order > 0 ? std::cos(c[2] + c[1] * a.v) : 0;
+                r = chain(a, c[0] * s, c[0] * c[1] * co, -c[0] * c[1] * c[1] * s);
+                break;
+            }
+            case OpCode::POLY: {
+                // Horner evaluation of the polynomial and its first two derivatives
+                double p0 = 0, p1 = 0, p2 = 0;
+                for (int i = in.n - 1; i >= 0; i--) {
+                    p2 = p2 * a.v + 2 * p1;
+                    p1 = p1 * a.v + p0;
+                    p0 = p0 * a.v + c[i];
+                }
+                r = chain(a, p0, p1, p2);
+                break;
+            }
+            case OpCode::LEAF: {
+                const ChFunction* fun = m_leaves[in.idx];
+                double f1 = order > 0 ? fun->GetDer(a.v) : 0;
+                double f2 = order > 1 ? fun->GetDer2(a.v) : 0;
+                r = chain(a, fun->GetVal(a.v), f1, f2);
+                break;
+            }
+            case OpCode::ADD:
+                r = {a.v + b.v, a.d + b.d, a.dd + b.dd};
+                break;
+            case OpCode::SUB:
+                r = {a.v - b.v, a.d - b.d, a.dd - b.dd};
+                break;
+            case OpCode::MUL:
+                r = {a.v * b.v, a.d * b.v + a.v * b.d, a.dd * b.v + 2 * a.d * b.d + a.v * b.dd};
+                break;
+            case OpCode::DIV: {
+                double q = a.v / b.v;
+                double q1 = (a.d - q * b.d) / b.v;
+                r = {q, q1, (a.dd - 2 * q1 * b.d - q * b.dd) / b.v};
+                break;
+            }
+            case OpCode::POW: {
+                double y = std::pow(a.v, b.v);
+                if (order == 0) {
+                    r = {y, 0, 0};
+                } else if (b.d == 0 && b.dd == 0) {
+                    // constant exponent, also valid for a negative base
+                    double y1 = b.v * std::pow(a.v, b.v - 1);
+                    double y2 = b.v * (b.v - 1) * std::pow(a.v, b.v - 2);
+                    r = chain(a, y, y1, y2);
+                } else {
+                    // y = exp(w), with w = b * ln(a)
+                    double la = std::log(a.v);
+                    double w1 = b.d * la + b.v * a.d / a.v;
+                    double w2 = b.dd * la + 2 * b.d * a.d / a.v + b.v * (a.dd / a.v - a.d * a.d / (a.v * a.v));
+                    r = {y, y * w1, y * (w2 + w1 * w1)};
+                }
+                break;
+            }
+            case OpCode::MAX:
+                r = (a.v < b.v) ? b : a;
+                break;
+            case OpCode::MIN:
+                r = (b.v < a.v) ? b : a;
+                break;
+            case OpCode::MODULO: {
+                double n = std::trunc(a.v / b.v);
+                r = {std::fmod(a.v, b.v), a.d - n * b.d, a.dd - n * b.dd};
+                break;
+            }
+            case OpCode::FABS:
+                r = (a.v < 0) ? Jet{-a.v, -a.d, -a.dd} : a;
+                break;
+            case OpCode::MIRROR:
+                r = (a.v <= c[0]) ? a : Jet{2 * c[0] - a.v, -a.d, -a.dd};
+                break;
+            case OpCode::REPEAT:
+                r = {c[0] + std::fmod(a.v + c[2], c[1]), a.d, a.dd};
+                break;
+            case OpCode::SEQ: {
+                // segment with the largest start not greater than the argument
+                const Sequence& seq = m_sequences[in.idx];
+                auto seg = std::upper_bound(seq.segments.begin(), seq.segments.end(), a.v,
+                                            [](double t, const Segment& s) { return t < s.t_start; });
+                if (seg == seq.segments.begin() || a.v >= std::prev(seg)->t_end) {
+                    r = {0, 0, 0};
+                    pc = seq.end_pc;
+                    break;
+                }
+                --seg;
+                regs[seg->arg] = {a.v - seg->t_start, a.d, a.dd};
+                pc = seg->pc;
+                break;
+            }
+            case OpCode::SEQ_END: {
+                // same continuity offsets as ChFunctionSequence
+                const Sequence& seq = m_sequences[in.idx];
+                const Segment& seg = seq.segments[in.n];
+                const Jet& t = regs[seg.arg];
+                double p1 = seg.Iydt + seg.Iydtdt * t.v;
+                r = {a.v + seg.Iy + seg.Iydt * t.v + seg.Iydtdt * t.v * t.v,  //
+                     a.d + p1 * t.d,                                          //
+                     a.dd + seg.Iydtdt * t.d * t.d + p1 * t.dd};
+                pc = seq.end_pc;
+                break;
+            }
+        }
+    }
+
+    return regs[m_out];
+}
+
+double ChFunctionCompiled::GetVal(double x) const {
+    return Execute(x, 0).v;
+}
+
+double ChFunctionCompiled::GetDer(double x) const {
+    return Execute(x, 1).d;
+}
+
+double ChFunctionCompiled::GetDer2(double x) const {
+    return Execute(x, 2).dd;
+}
+
+void ChFunctionCompiled::GetValDer2(double x, double& y, double& y_dx, double& y_dxdx) const {
+    Jet r = Execute(x, 2);
+    y = r.v;
+    y_dx = r.d;
+    y_dxdx = r.dd;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChFunctionCompiled::ArchiveOut(ChArchiveOut& archive_out) {
+    // version number
+    archive_out.VersionWrite<ChFunctionCompiled>();
+    // serialize parent class
+    ChFunction::ArchiveOut(archive_out);
+    // serialize the source function (the tape is rebuilt when loading)
+    archive_out << CHNVP(m_fun);
+}
+
+void ChFunctionCompiled::ArchiveIn(ChArchiveIn& archive_in) {
+    // version number
+    /*int version =*/archive_in.VersionRead<ChFunctionCompiled>();
+    // deserialize parent class
+    ChFunction::ArchiveIn(archive_in);
+    // stream in the source function and compile it
+    archive_in >> CHNVP(m_fun);
+    Compile();
+}
+
+}  // end namespace chrono
@@ -0,0 +1,158 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHFUNCT_COMPILED_H
+#define CHFUNCT_COMPILED_H
+
+#include <vector>
+
+#include "chrono/functions/ChFunctionBase.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_functions
+/// @{
+
+/// Compiled function.
+/// Flattens a graph of functions into a linear evaluation tape, evaluated without recursion through the graph.
+/// Operators (ChFunctionOperator), sequences (ChFunctionSequence), mirror and repeat functions are translated into tape
+/// instructions, as are constant, ramp, sine, and polynomial functions. Any other function is a leaf of the tape and is
+/// evaluated through its own GetVal, GetDer, and GetDer2.
+///
+/// Derivatives are propagated through the tape in forward mode (value, first and second derivative at once), so they
+/// are exact wherever the source functions provide analytical derivatives, instead of the numerical differentiation
+/// used by the base class for composite functions.
+///
+/// The tape refers to the source graph, which must be recompiled (see Compile) if modified.
+class ChApi ChFunctionCompiled : public ChFunction {
+  public:
+    ChFunctionCompiled() : m_num_regs(1), m_out(0) {}
+    ChFunctionCompiled(std::shared_ptr<ChFunction> fun);
+    ChFunctionCompiled(const ChFunctionCompiled& other);
+    ~ChFunctionCompiled() {}
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChFunctionCompiled* Clone() const override { return new ChFunctionCompiled(*this); }
+
+    virtual double GetVal(double x) const override;
+    virtual double GetDer(double x) const override;
+    virtual double GetDer2(double x) const override;
+
+    /// Evaluate the function value and its first two derivatives in a single pass.
+    void GetValDer2(double x, double& y, double& y_dx, double& y_dxdx) const;
+
+    /// Set the source function and compile it.
+    void SetFunction(std::shared_ptr<ChFunction> fun);
+
+    /// Get the source function.
+    std::shared_ptr<ChFunction> GetFunction() const { return m_fun; }
+
+    /// Rebuild the evaluation tape from the source function.
+    /// This must be called if the source function graph is modified after it was compiled.
+    void Compile();
+
+    /// Return the number of instructions in the evaluation tape.
+    size_t GetTapeSize() const { return m_tape.size(); }
+
+    /// Return the number of functions in the tape that are evaluated through virtual calls.
+    size_t GetNumLeaves() const { return m_leaves.size(); }
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOut(ChArchiveOut& archive_out) override;
+
+    /// Method to allow de-serialization of transient data from archives.
+    virtual void ArchiveIn(ChArchiveIn& archive_in) override;
+
+  private:
+    /// Value and first two derivatives with respect to the function argument.
+    struct Jet {
+        double v;
+        double d;
+        double dd;
+    };
+
+    enum class OpCode {
+        CONST,    ///< constant
+        RAMP,     ///< linear function of the operand
+        SINE,     ///< sine of the operand
+        POLY,     ///< polynomial in the operand
+        LEAF,     ///< function of the operand evaluated through virtual calls
+        ADD,      ///< sum of the operands
+        SUB,      ///< difference of the operands
+        MUL,      ///< product of the operands
+        DIV,      ///< ratio of the operands
+        POW,      ///< first operand raised to the second
+        MAX,      ///< maximum of the operands
+        MIN,      ///< minimum of the operands
+        MODULO,   ///< floating-point remainder of the operands
+        FABS,     ///< absolute value of the operand
+        MIRROR,   ///< mirrored argument
+        REPEAT,   ///< repeated argument
+        SEQ,      ///< select a sequence segment and jump to its block
+        SEQ_END   ///< add the segment offsets and jump past the sequence blocks
+    };
+
+    struct Instruction {
+        OpCode op;
+        int out;     ///< output register
+        int a;       ///< first operand register
+        int b;       ///< second operand register
+        int n;       ///< number of coefficients (POLY) or segment index (SEQ_END)
+        size_t idx;  ///< index of constants, leaf function, or sequence
+    };
+
+    /// Segment of a compiled ChFunctionSequence.
+    struct Segment {
+        double t_start;
+        double t_end;
+        double Iy;
+        double Iydt;
+        double Iydtdt;
+        size_t pc;  ///< first instruction of the segment block
+        int arg;    ///< register with the local argument of the segment
+    };
+
+    /// Compiled ChFunctionSequence.
+    struct Sequence {
+        std::vector<Segment> segments;
+        size_t end_pc;  ///< first instruction after the segment blocks
+    };
+
+    /// Append the instructions evaluating the given function at the argument in register 'arg'.
+    /// Return the register holding the result.
+    int Emit(std::shared_ptr<ChFunction> fun, int arg);
+
+    /// Append an instruction and return its output register.
+    int Append(OpCode op, int a, int b, size_t idx, int n = 0);
+
+    /// Execute the tape, computing derivatives up to the specified order.
+    Jet Execute(double x, int order) const;
+
+    std::shared_ptr<ChFunction> m_fun;  ///< source function
+
+    std::vector<Instruction> m_tape;          ///< evaluation tape
+    std::vector<double> m_consts;             ///< constants used by the instructions
+    std::vector<const ChFunction*> m_leaves;  ///< functions evaluated through virtual calls
+    std::vector<Sequence> m_sequences;        ///< compiled sequences
+    int m_num_regs;                           ///< number of registers (register 0 holds the argument)
+    int m_out;                                ///< register holding the result
+};
+
+/// @} chrono_functions
+
+CH_CLASS_VERSION(ChFunctionCompiled, 0)
+
+}  // end namespace chrono
+
+#endif
@@ -12,17 +12,15 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+
 #include "chrono/functions/ChFunctionInterp.h"
 
 namespace chrono {
 
 CH_FACTORY_REGISTER(ChFunctionInterp)
 
-ChFunctionInterp::ChFunctionInterp(const ChFunctionInterp& other) {
-    m_table = other.m_table;
-    m_last_greater = m_table.end();
-}
-
 void ChFunctionInterp::AddPoint(double x, double y, bool overwrite_if_existing) {
     std::pair<std::map<double, double>::iterator, bool> ret = m_table.emplace(x, y);
 
@@ -30,95 +28,123 @@ void ChFunctionInterp::AddPoint(double x, double y, bool overwrite_if_existing)
         // no insertion took place, so the point already exists
         if (overwrite_if_existing) {
             ret.first->second = y;
+            m_y[std::lower_bound(m_x.begin(), m_x.end(), x) - m_x.begin()] = y;
         } else {
             throw std::invalid_argument("Point already exists and overwrite flag was not set.");
         }
+        return;
     }
-}
 
-double ChFunctionInterp::GetVal(double x) const {
-    if (m_table.empty()) {
-        return 0.0;
+    // Points are typically added in increasing order of x; in that case, only check the spacing of the last interval
+    if (!m_x.empty() && x > m_x.back()) {
+        double dx = x - m_x.back();
+        if (m_x.size() == 1)
+            m_dx = dx;
+        else if (std::abs(dx - m_dx) > 1e-9 * m_dx)
+            m_dx = 0;
+        m_x.push_back(x);
+        m_y.push_back(y);
+        return;
     }
 
-    if (x <= m_table.begin()->first) {
-        // if the extrapolation is not allowed, the derivative will be zero
-        return m_table.begin()->second - GetDer(x) * (m_table.begin()->first - x);
-    }
+    UpdateArrays();
+}
 
-    if (x >= m_table.rbegin()->first) {
-        // if the extrapolation is not allowed, the derivative will be zero
-        return m_table.rbegin()->second + GetDer(x) * (x - m_table.rbegin()->first);
+void ChFunctionInterp::UpdateArrays() {
+    m_x.clear();
+    m_y.clear();
+    m_x.reserve(m_table.size());
+    m_y.reserve(m_table.size());
+    for (const auto& p : m_table) {
+        m_x.push_back(p.first);
+        m_y.push_back(p.second);
     }
 
-    if (m_last_greater == m_table.end()) {
-        m_last_greater = std::next(m_table.begin());
+    m_dx = 0;
+    if (m_x.size() < 2)
+        return;
+
+    double dx = (m_x.back() - m_x.front()) / (m_x.size() - 1);
+    for (size_t i = 1; i < m_x.size(); i++) {
+        if (std::abs(m_x[i] - m_x[i - 1] - dx) > 1e-9 * dx)
+            return;
     }
+    m_dx = dx;
+}
 
-    // there shouldn't be any case in which this happens, but if it does add a check if m_last_greater==m_table.begin
-    // and then set it to ++m_table.begin()
-    assert(m_last_greater != m_table.begin());
+size_t ChFunctionInterp::FindInterval(double x, size_t hint) const {
+    size_t n = m_x.size();
 
-    //// Find the pair of points for which 'x' is in between
-    // - the point is surely bigger than m_table.begin()->first and smaller than m_table.rbegin()->first
+    // with uniform spacing, the interval index is computed directly (up to roundoff, fixed by the checks below)
+    if (m_dx > 0)
+        hint = std::min(static_cast<size_t>((x - m_x.front()) / m_dx), n - 2);
 
-    // if m_last_greater is not valid anymore make a full search
-    if (!(x > std::prev(m_last_greater)->first && x <= m_last_greater->first)) {
-        m_last_greater = m_table.upper_bound(x);
+    // check the hint and the next interval (typical of increasing queries)
+    if (hint < n - 1 && m_x[hint] <= x) {
+        if (x < m_x[hint + 1])
+            return hint;
+        if (hint + 2 < n && x < m_x[hint + 2])
+            return hint + 1;
     }
 
-    double x_prev = std::prev(m_last_greater)->first;
-    double y_prev = std::prev(m_last_greater)->second;
-    double val = y_prev + (m_last_greater->second - y_prev) * (x - x_prev) / (m_last_greater->first - x_prev);
+    // full search; x is strictly inside the table range, so the result is in [0, n-2]
+    return std::upper_bound(m_x.begin(), m_x.end(), x) - m_x.begin() - 1;
+}
 
-    return val;
+double ChFunctionInterp::GetDerOutside(double x) const {
+    // if the extrapolation is not allowed, the derivative is zero
+    if (!m_extrapolate || m_x.size() < 2)
+        return 0.0;
+
+    size_t i = (x <= m_x.front()) ? 0 : m_x.size() - 2;
+    return (m_y[i + 1] - m_y[i]) / (m_x[i + 1] - m_x[i]);
 }
 
-double ChFunctionInterp::GetDer(double x) const {
-    if (m_table.empty()) {
+double ChFunctionInterp::GetVal(double x) const {
+    size_t hint = 0;
+    return GetVal(x, hint);
+}
+
+double ChFunctionInterp::GetVal(double x, size_t& hint) const {
+    if (m_x.empty()) {
         return 0.0;
     }
 
-    if (x <= m_table.begin()->first) {
-        if (m_extrapolate && m_table.size() > 1) {
-            double der_first = (std::next(m_table.begin())->second - m_table.begin()->second) /
-                               (std::next(m_table.begin())->first - m_table.begin()->first);
-            return der_first;
-        } else {
-            return 0.0;
-        }
+    if (x <= m_x.front()) {
+        return m_y.front() - GetDerOutside(x) * (m_x.front() - x);
     }
 
-    if (x >= m_table.rbegin()->first) {
-        if (m_extrapolate && m_table.size() > 1) {
-            double der_last = (m_table.rbegin()->second - std::next(m_table.rbegin())->second) /
-                              (m_table.rbegin()->first - std::next(m_table.rbegin())->first);
-            return der_last;
-        } else {
-            return 0.0;
-        }
+    if (x >= m_x.back()) {
+        return m_y.back() + GetDerOutside(x) * (x - m_x.back());
     }
 
-    if (m_last_greater == m_table.end()) {
-        m_last_greater = std::next(m_table.begin());
-    }
+    hint = FindInterval(x, hint);
+    return m_y[hint] + (m_y[hint + 1] - m_y[hint]) * (x - m_x[hint]) / (m_x[hint + 1] - m_x[hint]);
+}
 
-    // there shouldn't be any case in which this happens, but if it does add a check if m_last_greater==m_table.begin
-    // and then set it to ++m_table.begin()
-    assert(m_last_greater != m_table.begin());
+void ChFunctionInterp::GetVal(const ChVectorDynamic<>& x, ChVectorDynamic<>& y) const {
+    y.resize(x.size());
+    size_t hint = 0;
+    for (Eigen::Index i = 0; i < x.size(); i++)
+        y(i) = GetVal(x(i), hint);
+}
 
-    //// Find the pair of points for which 'x' is in between
-    // - the point is surely bigger than m_table.begin()->first and smaller than m_table.rbegin()->first
+double ChFunctionInterp::GetDer(double x) const {
+    size_t hint = 0;
+    return GetDer(x, hint);
+}
 
-    // if m_last_greater is not valid anymore make a full search
-    if (!(x >= std::prev(m_last_greater)->first && x < m_last_greater->first)) {
-        m_last_greater = m_table.upper_bound(x);
+double ChFunctionInterp::GetDer(double x, size_t& hint) const {
+    if (m_x.empty()) {
+        return 0.0;
     }
 
-    double der = (m_last_greater->second - std::prev(m_last_greater)->second) /
-                 (m_last_greater->first - std::prev(m_last_greater)->first);
+    if (x <= m_x.front() || x >= m_x.back()) {
+        return GetDerOutside(x);
+    }
 
-    return der;
+    hint = FindInterval(x, hint);
+    return (m_y[hint + 1] - m_y[hint]) / (m_x[hint + 1] - m_x[hint]);
 }
 
 double ChFunctionInterp::GetDer2(double x) const {
@@ -127,17 +153,11 @@ double ChFunctionInterp::GetDer2(double x) const {
 }
 
 double ChFunctionInterp::GetMax() const {
-    using pType = std::pair<double, double>;
-    auto ptr = std::max_element(m_table.begin(), m_table.end(),
-                                [](const pType& p1, const pType& p2) { return p1.second < p2.second; });
-    return ptr->second;
+    return *std::max_element(m_y.begin(), m_y.end());
 }
 
 double ChFunctionInterp::GetMin() const {
-    using pType = std::pair<double, double>;
-    auto ptr = std::min_element(m_table.begin(), m_table.end(),
-                                [](const pType& p1, const pType& p2) { return p1.second < p2.second; });
-    return ptr->second;
+    return *std::min_element(m_y.begin(), m_y.end());
 }
 
 void ChFunctionInterp::ArchiveOut(ChArchiveOut& archive_out) {
@@ -159,7 +179,7 @@ void ChFunctionInterp::ArchiveIn(ChArchiveIn& archive_in) {
     archive_in >> CHNVP(m_table);
     archive_in >> CHNVP(m_extrapolate);
 
-    m_last_greater = m_table.end();
+    UpdateArrays();
 }
 
 }  // end namespace chrono
@@ -15,8 +15,8 @@
 #ifndef CHFUNCT_INTERP_H
 #define CHFUNCT_INTERP_H
 
-#include <iterator>
 #include <map>
+#include <vector>
 
 #include "chrono/functions/ChFunctionBase.h"
 
@@ -27,15 +27,20 @@ namespace chrono {
 
 /// Interpolation function.
 /// Linear interpolation `y=f(x)` given a list of points `(x,y)`.
+/// The points are also stored in contiguous sorted arrays used for evaluation. The interval containing a query is
+/// found in constant time if the x values are equally spaced, with a binary search otherwise. Evaluation does not
+/// modify the object, so a function can be shared across threads; callers with coherent queries can carry an interval
+/// hint between calls.
 class ChApi ChFunctionInterp : public ChFunction {
   private:
-    std::map<double, double> m_table;                                 ///< map with x-y points
-    mutable std::map<double, double>::const_iterator m_last_greater;  ///< pointer to element greater than last 'x'
-    bool m_extrapolate = false;  ///< enable linear extrapolation for out-of-range values
+    std::map<double, double> m_table;  ///< map with x-y points
+    std::vector<double> m_x;           ///< sorted x values of the table points
+    std::vector<double> m_y;           ///< y values of the table points
+    double m_dx;                       ///< spacing of the x values if uniform, 0 otherwise
+    bool m_extrapolate = false;        ///< enable linear extrapolation for out-of-range values
 
   public:
-    ChFunctionInterp() : m_last_greater(m_table.end()), m_extrapolate(false) {}
-    ChFunctionInterp(const ChFunctionInterp& other);
+    ChFunctionInterp() : m_dx(0), m_extrapolate(false) {}
     ~ChFunctionInterp() {}
 
     /// "Virtual" copy constructor (covariant return type).
@@ -47,6 +52,19 @@ class ChApi ChFunctionInterp : public ChFunction {
     virtual double GetDer(double x) const override;
     virtual double GetDer2(double x) const override;
 
+    /// Return the function value at \a x, starting the search from the interval with index \a hint.
+    /// On return, \a hint is the index of the interval containing \a x. Any initial value is valid.
+    double GetVal(double x, size_t& hint) const;
+
+    /// Return the function derivative at \a x, starting the search from the interval with index \a hint.
+    /// On return, \a hint is the index of the interval containing \a x. Any initial value is valid.
+    double GetDer(double x, size_t& hint) const;
+
+    /// Evaluate the function at all values in \a x.
+    /// The interval found for each query is used as hint for the next one, so sorted or slowly varying values are
+    /// evaluated in amortized constant time.
+    void GetVal(const ChVectorDynamic<>& x, ChVectorDynamic<>& y) const;
+
     /// Add a point to the table.
     /// By default, adding a point with an \a x value that already exists in the table will lead to an exception.
     /// If \a overwrite_if_existing is set to \c true, the existing point will be overwritten instead.
@@ -54,17 +72,22 @@ class ChApi ChFunctionInterp : public ChFunction {
 
     void Reset() {
         m_table.clear();
-        m_last_greater = m_table.end();
+        m_x.clear();
+        m_y.clear();
+        m_dx = 0;
     }
 
     /// Retrieve the underlying table of points.
     const std::map<double, double>& GetTable() { return m_table; }
 
     /// Return the smallest value of x in the table.
-    double GetStart() const { return m_table.begin()->first; }
+    double GetStart() const { return m_x.front(); }
 
     /// Return the biggest value of x in the table.
-    double GetEnd() const { return m_table.rbegin()->first; }
+    double GetEnd() const { return m_x.back(); }
+
+    /// Return true if the x values in the table are equally spaced.
+    bool IsUniform() const { return m_dx > 0; }
 
     /// Return the maximum function value in the table.
     double GetMax() const;
@@ -83,6 +106,16 @@ class ChApi ChFunctionInterp : public ChFunction {
 
     /// Method to allow de-serialization of transient data from archives.
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
+
+  private:
+    /// Rebuild the evaluation arrays from the table.
+    void UpdateArrays();
+
+    /// Return the index i of the interval such that m_x[i] <= x < m_x[i+1], for x strictly inside the table range.
+    size_t FindInterval(double x, size_t hint) const;
+
+    /// Return the derivative used outside the table range.
+    double GetDerOutside(double x) const;
 };
 
 /// @} chrono_functions
@@ -0,0 +1,179 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Process-wide cache of triangle meshes loaded from files.
+//
+// =============================================================================
+
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <sys/stat.h>
+
+#include "chrono/geometry/ChTriangleMeshCache.h"
+
+namespace chrono {
+
+// Content hash of a file, together with the file attributes at the time of hashing
+struct FileRecord {
+    uint64_t size;
+    int64_t time;
+    uint64_t hash;
+};
+
+static std::mutex cache_mutex;
+static std::unordered_map<std::string, std::shared_ptr<ChTriangleMeshConnected>> cache_meshes;  // key -> mesh
+static std::unordered_set<const ChTriangleMeshConnected*> cache_pointers;                       // cached meshes
+static std::unordered_map<std::string, FileRecord> cache_files;                                 // file -> hash
+static unsigned int cache_hits = 0;
+static unsigned int cache_misses = 0;
+
+static bool GetFileInfo(const std::string& filename, uint64_t& size, int64_t& time) {
+#if defined(_WIN32)
+    struct _stat64 sb;
+    if (_stat64(filename.c_str(), &sb) != 0)
+        return false;
+#else
+    struct stat sb;
+    if (stat(filename.c_str(), &sb) != 0)
+        return false;
+#endif
+    size = (uint64_t)sb.st_size;
+    time = (int64_t)sb.st_mtime;
+    return true;
+}
+
+bool ChTriangleMeshCache::ComputeFileHash(const std::string& filename, uint64_t& hash) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.good())
+        return false;
+
+    // 64-bit FNV-1a
+    hash = 14695981039346656037ULL;
+    std::vector<char> buffer(1 << 16);
+    while (file) {
+        file.read(buffer.data(), buffer.size());
+        std::streamsize n = file.gcount();
+        for (std::streamsize i = 0; i < n; i++) {
+            hash ^= (unsigned char)buffer[i];
+            hash *= 1099511628211ULL;
+        }
+    }
+    return true;
+}
+
+// Cache key for the specified file (must be called with the cache mutex locked)
+static std::string GetKey(const std::string& filename, const std::string& variant) {
+    uint64_t size;
+    int64_t time;
+    if (!GetFileInfo(filename, size, time))
+        return "file:" + filename + "|" + variant;
+
+    auto record = cache_files.find(filename);
+    if (record == cache_files.end() || record->second.size != size || record->second.time != time) {
+        uint64_t hash;
+        if (!ChTriangleMeshCache::ComputeFileHash(filename, hash))
+            return "file:" + filename + "|" + variant;
+        cache_files[filename] = FileRecord{size, time, hash};
+        record = cache_files.find(filename);
+    }
+
+    return "hash:" + std::to_string(record->second.hash) + ":" + std::to_string(size) + "|" + variant;
+}
+
+std::shared_ptr<ChTriangleMeshConnected> ChTriangleMeshCache::Load(const std::string& filename,
+                                                                   const std::string& variant,
+                                                                   const Loader& loader) {
+    // The lock is held while loading, so that concurrent requests for the same mesh load it only once
+    std::lock_guard<std::mutex> lock(cache_mutex);
+
+    auto key = GetKey(filename, variant);
+    auto entry = cache_meshes.find(key);
+    if (entry != cache_meshes.end()) {
+        cache_hits++;
+        return entry->second;
+    }
+
+    cache_misses++;
+    auto trimesh = loader(filename);
+    if (!trimesh)
+        return nullptr;
+
+    cache_meshes.emplace(key, trimesh);
+    cache_pointers.insert(trimesh.get());
+    return trimesh;
+}
+
+std::shared_ptr<ChTriangleMeshConnected> ChTriangleMeshCache::LoadWavefrontMesh(const std::string& filename,
+                                                                                bool load_normals,
+                                                                                bool load_uv) {
+    std::string variant = std::string("obj") + (load_normals ? "n" : "") + (load_uv ? "t" : "");
+    return Load(filename, variant, [load_normals, load_uv](const std::string& file) {
+        return ChTriangleMeshConnected::CreateFromWavefrontFile(file, load_normals, load_uv);
+    });
+}
+
+std::shared_ptr<ChTriangleMeshConnected> ChTriangleMeshCache::LoadSTLMesh(const std::string& filename,
+                                                                          bool load_normals) {
+    std::string variant = std::string("stl") + (load_normals ? "n" : "");
+    return Load(filename, variant, [load_normals](const std::string& file) {
+        return ChTriangleMeshConnected::CreateFromSTLFile(file, load_normals);
+    });
+}
+
+bool ChTriangleMeshCache::IsCached(const ChTriangleMeshConnected* mesh) {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return cache_pointers.count(mesh) > 0;
+}
+
+size_t ChTriangleMeshCache::GetNumEntries() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return cache_meshes.size();
+}
+
+unsigned int ChTriangleMeshCache::GetNumHits() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return cache_hits;
+}
+
+unsigned int ChTriangleMeshCache::GetNumMisses() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return cache_misses;
+}
+
+void ChTriangleMeshCache::ReleaseUnused() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    for (auto entry = cache_meshes.begin(); entry != cache_meshes.end();) {
+        if (entry->second.use_count() == 1) {
+            cache_pointers.erase(entry->second.get());
+            entry = cache_meshes.erase(entry);
+        } else {
+            ++entry;
+        }
+    }
+}
+
+void ChTriangleMeshCache::Clear() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    cache_meshes.clear();
+    cache_pointers.clear();
+    cache_files.clear();
+    cache_hits = 0;
+    cache_misses = 0;
+}
+
+}  // end namespace chrono
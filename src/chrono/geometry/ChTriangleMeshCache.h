@@ -0,0 +1,94 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Process-wide cache of triangle meshes loaded from files.
+//
+// =============================================================================
+
+#ifndef CH_TRIANGLEMESH_CACHE_H
+#define CH_TRIANGLEMESH_CACHE_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_geometry
+/// @{
+
+/// Process-wide cache of triangle meshes loaded from files.
+/// Cache entries are keyed by a hash of the file contents (so that identical files with different names share an
+/// entry) and by the load options. Meshes obtained from the cache are shared by all callers and must be treated as
+/// immutable; use Clone() to obtain a modifiable copy. Collision systems may also share the preprocessed collision data
+/// (e.g., mesh connectivity) of cached meshes across collision models.
+///
+/// The content hash of a file is recomputed only if the file size or modification time changed since the last lookup.
+/// All functions are thread-safe.
+class ChApi ChTriangleMeshCache {
+  public:
+    /// Function creating a mesh from the specified file, called on a cache miss.
+    /// The function should return an empty pointer if the mesh cannot be loaded.
+    typedef std::function<std::shared_ptr<ChTriangleMeshConnected>(const std::string& filename)> Loader;
+
+    /// Get from the cache (or load and add to the cache) a mesh from the specified Wavefront OBJ file.
+    /// This function can be used in place of ChTriangleMeshConnected::CreateFromWavefrontFile.
+    /// If an error occurs during loading, an empty shared pointer is returned.
+    static std::shared_ptr<ChTriangleMeshConnected> LoadWavefrontMesh(const std::string& filename,
+                                                                      bool load_normals = true,
+                                                                      bool load_uv = false);
+
+    /// Get from the cache (or load and add to the cache) a mesh from the specified STL file.
+    /// This function can be used in place of ChTriangleMeshConnected::CreateFromSTLFile.
+    /// If an error occurs during loading, an empty shared pointer is returned.
+    static std::shared_ptr<ChTriangleMeshConnected> LoadSTLMesh(const std::string& filename, bool load_normals = true);
+
+    /// Get from the cache (or create with the given loader and add to the cache) the mesh for the specified file.
+    /// The 'variant' string identifies the load options (meshes loaded from the same file with different options are
+    /// cached separately). If the file cannot be read, the entry is keyed by the file name instead.
+    static std::shared_ptr<ChTriangleMeshConnected> Load(const std::string& filename,
+                                                         const std::string& variant,
+                                                         const Loader& loader);
+
+    /// Return true if the given mesh is managed by the cache (and hence shared and immutable).
+    static bool IsCached(const ChTriangleMeshConnected* mesh);
+
+    /// Compute a 64-bit hash (FNV-1a) of the contents of the specified file.
+    /// Return false if the file cannot be read.
+    static bool ComputeFileHash(const std::string& filename, uint64_t& hash);
+
+    /// Get the number of meshes currently in the cache.
+    static size_t GetNumEntries();
+
+    /// Get the number of lookups satisfied from the cache.
+    static unsigned int GetNumHits();
+
+    /// Get the number of lookups that required loading a mesh.
+    static unsigned int GetNumMisses();
+
+    /// Remove from the cache all meshes that are not referenced elsewhere.
+    static void ReleaseUnused();
+
+    /// Remove all meshes from the cache (meshes still in use remain valid) and reset the hit/miss counters.
+    static void Clear();
+};
+
+/// @} chrono_geometry
+
+}  // end namespace chrono
+
+#endif
@@ -24,6 +24,7 @@
 #include <fstream>
 #include <map>
 
+#include "chrono/core/ChVectorSIMD.h"
 #include "chrono/geometry/ChTriangleMeshConnected.h"
 
 #include "chrono_thirdparty/filesystem/path.h"
@@ -509,10 +510,7 @@ ChTriangleMeshConnected ChTriangleMeshConnected::Merge(std::vector<ChTriangleMes
 }
 
 void ChTriangleMeshConnected::Transform(const ChVector3d displ, const ChMatrix33<> rotscale) {
-    for (int i = 0; i < m_vertices.size(); ++i) {
-        m_vertices[i] = rotscale * m_vertices[i];
-        m_vertices[i] += displ;
-    }
+    TransformPointsSIMD(rotscale, displ, m_vertices);
     for (int i = 0; i < m_normals.size(); ++i) {
         m_normals[i] = rotscale * m_normals[i];
         m_normals[i].Normalize();
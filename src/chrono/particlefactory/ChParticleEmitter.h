@@ -19,6 +19,7 @@
 #include "chrono/particlefactory/ChRandomParticlePosition.h"
 #include "chrono/particlefactory/ChRandomParticleAlignment.h"
 #include "chrono/particlefactory/ChRandomParticleVelocity.h"
+#include "chrono/particlefactory/ChParticlePool.h"
 
 #include "chrono/core/ChRandom.h"
 #include "chrono/core/ChVector3.h"
@@ -121,8 +122,19 @@ class ChParticleEmitter {
             mcoords_abs = mcoords >> pre_transform.GetCoordsys();
 
             // 3)
-            // Random creation of particle
-            std::shared_ptr<ChBody> mbody = particle_creator->RandomGenerateAndCallbacks(mcoords_abs);
+            // Random creation of particle (or reinitialization of a pooled particle, if possible)
+            std::shared_ptr<ChBody> mbody;
+            bool recycled = false;
+            if (particle_pool) {
+                mbody = particle_pool->Acquire();
+                if (mbody) {
+                    recycled = particle_creator->RandomRecycleAndCallbacks(mbody, mcoords_abs);
+                    if (!recycled)
+                        particle_pool->Release(mbody);
+                }
+            }
+            if (!recycled)
+                mbody = particle_creator->RandomGenerateAndCallbacks(mcoords_abs);
 
             // 4)
             // Random velocity and angular speed
@@ -152,8 +164,12 @@ class ChParticleEmitter {
                 mbody->Move(jitter);
             }
 
-            msystem.AddBatch(
-                mbody);  // the Add() alone woud not be thread safe if called from items inserted in system's lists
+            // Recycled particles are already in the system.
+            // Note: the Add() alone woud not be thread safe if called from items inserted in system's lists.
+            if (recycled)
+                particle_pool->Activate(mbody);
+            else
+                msystem.AddBatch(mbody);
 
             if (this->creation_callback)
                 this->creation_callback->OnAddBody(mbody, mcoords_abs, *particle_creator.get());
@@ -176,6 +192,11 @@ class ChParticleEmitter {
         creation_callback = callback;
     }
 
+    /// Set a pool of deactivated particles to be recycled (default: none).
+    /// If set, particles are obtained by reinitializing bodies from the pool, if available and if supported by the
+    /// particle creator (see ChRandomShapeCreator::RandomRecycle). Otherwise, new bodies are created.
+    void SetParticlePool(std::shared_ptr<ChParticlePool> pool) { particle_pool = pool; }
+
     /// Set the particle creator, that is an object whose class is
     /// inherited from ChRandomShapeCreator
     void SetParticleCreator(std::shared_ptr<ChRandomShapeCreator> mc) { particle_creator = mc; }
@@ -250,6 +271,8 @@ class ChParticleEmitter {
 
     std::shared_ptr<ChRandomShapeCreator::AddBodyCallback> creation_callback;
 
+    std::shared_ptr<ChParticlePool> particle_pool;
+
     int particle_reservoir;
     bool use_particle_reservoir;
 
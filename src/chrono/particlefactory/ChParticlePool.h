@@ -0,0 +1,104 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHPARTICLEPOOL_H
+#define CHPARTICLEPOOL_H
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "chrono/physics/ChBody.h"
+
+namespace chrono {
+namespace particlefactory {
+
+/// Pool of deactivated particles, for recycling by a particle emitter.
+/// Particles released to the pool are not removed from the system: they are fixed, their visual shapes are hidden, and
+/// their collision models are parked. A parked collision model stays in the collision system, with a collision family
+/// mask set to collide with no family (the original mask is restored on activation). A ChParticleEmitter using this
+/// pool reinitializes pooled bodies with new shape, pose, and velocity (see ChRandomShapeCreator::RandomRecycle)
+/// instead of creating new bodies. This avoids allocating bodies and their collision and visual models, and
+/// inserting/removing them in the system lists and in the collision system, in continuous flow simulations. Note that
+/// pooled bodies are still visited by particle processors.
+class ChParticlePool {
+  public:
+    ChParticlePool() {}
+
+    /// Deactivate the given body and add it to the pool.
+    /// No action is taken if the body is already in the pool.
+    void Release(std::shared_ptr<ChBody> body) {
+        if (!pooled.insert(body.get()).second)
+            return;
+
+        body->SetFixed(true);
+        if (auto coll_model = body->GetCollisionModel()) {
+            // Keep the mask of a body released again after a failed recycling (already parked)
+            parked_masks.emplace(body.get(), coll_model->GetFamilyMask());
+            coll_model->SetFamilyMask(0);
+        }
+        body->SetPosDt(VNULL);
+        body->SetAngVelParent(VNULL);
+        body->EmptyAccumulators();
+        if (auto vis_model = body->GetVisualModel()) {
+            for (auto& shape_instance : vis_model->GetShapeInstances())
+                shape_instance.first->SetVisible(false);
+        }
+
+        bodies.push_back(body);
+    }
+
+    /// Extract a (deactivated) body from the pool.
+    /// Return an empty pointer if the pool is empty.
+    std::shared_ptr<ChBody> Acquire() {
+        if (bodies.empty())
+            return nullptr;
+
+        auto body = bodies.back();
+        bodies.pop_back();
+        pooled.erase(body.get());
+        return body;
+    }
+
+    /// Reactivate a body extracted from the pool.
+    /// The collision family mask of the body, as set before its release to the pool, is restored.
+    void Activate(std::shared_ptr<ChBody> body) {
+        body->SetFixed(false);
+        auto parked = parked_masks.find(body.get());
+        if (parked != parked_masks.end()) {
+            body->GetCollisionModel()->SetFamilyMask(parked->second);
+            parked_masks.erase(parked);
+        }
+        if (auto vis_model = body->GetVisualModel()) {
+            for (auto& shape_instance : vis_model->GetShapeInstances())
+                shape_instance.first->SetVisible(true);
+        }
+    }
+
+    /// Return true if the given body is currently in the pool.
+    bool Contains(const ChBody* body) const { return pooled.find(body) != pooled.end(); }
+
+    /// Get the number of bodies currently in the pool.
+    size_t GetNumBodies() const { return bodies.size(); }
+
+  private:
+    std::vector<std::shared_ptr<ChBody>> bodies;                ///< pooled bodies
+    std::unordered_set<const ChBody*> pooled;                   ///< set of pooled bodies, for fast lookup
+    std::unordered_map<const ChBody*, short int> parked_masks;  ///< collision family masks of parked bodies
+};
+
+}  // end of namespace particlefactory
+}  // end of namespace chrono
+
+#endif
@@ -17,6 +17,7 @@
 
 #include "chrono/physics/ChSystem.h"
 #include "chrono/particlefactory/ChParticleEventTrigger.h"
+#include "chrono/particlefactory/ChParticlePool.h"
 
 namespace chrono {
 namespace particlefactory {
@@ -83,6 +84,33 @@ class ChParticleProcessEventRemove : public ChParticleProcessEvent {
     }
 };
 
+/// Processed particle will be deactivated and released to a ChParticlePool.
+/// The particle is not removed from the system, so that it can be recycled
+/// by a ChParticleEmitter using the same pool.
+class ChParticleProcessEventRecycle : public ChParticleProcessEvent {
+  private:
+    std::shared_ptr<ChParticlePool> pool;
+    std::list<std::shared_ptr<ChBody> > to_release;
+
+  public:
+    ChParticleProcessEventRecycle(std::shared_ptr<ChParticlePool> mpool) : pool(mpool) {}
+
+    /// Deactivate the particle and release it to the pool (the particle is not removed from the system).
+    virtual void ParticleProcessEvent(std::shared_ptr<ChBody> mbody,
+                                      ChSystem& msystem,
+                                      std::shared_ptr<ChParticleEventTrigger> mprocessor) override {
+        if (!pool->Contains(mbody.get()))
+            to_release.push_back(mbody);
+    }
+
+    virtual void SetupPreProcess(ChSystem& msystem) override { to_release.clear(); }
+
+    virtual void SetupPostProcess(ChSystem& msystem) override {
+        for (auto& body : to_release)
+            pool->Release(body);
+    }
+};
+
 /// Processed particle will be counted.
 /// Note that you have to use this processor with triggers that
 /// make some sense, such as ChParticleEventFlowInRectangle, because
@@ -47,6 +47,12 @@ class ChParticleRemoverBox : public ChParticleProcessor {
         return trigbox->m_box;
     }
 
+    /// Recycle the removed particles into the given pool, instead of removing them from the system.
+    /// The pool can then be used by a ChParticleEmitter (see ChParticleEmitter::SetParticlePool).
+    void SetParticlePool(std::shared_ptr<ChParticlePool> pool) {
+        this->SetParticleEventProcessor(chrono_types::make_shared<ChParticleProcessEventRecycle>(pool));
+    }
+
     /// Toggle inside/outside trigger.
     void SetRemoveOutside(bool invert) {
         auto trigbox = std::dynamic_pointer_cast<ChParticleEventTriggerBox>(trigger);
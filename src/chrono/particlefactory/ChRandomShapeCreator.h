@@ -26,7 +26,14 @@
 #include "chrono/geometry/ChSphere.h"
 #include "chrono/geometry/ChBox.h"
 #include "chrono/geometry/ChCylinder.h"
+#include "chrono/collision/ChCollisionShapeSphere.h"
+#include "chrono/collision/ChCollisionShapeBox.h"
+#include "chrono/collision/ChCollisionShapeCylinder.h"
+#include "chrono/assets/ChVisualShapeSphere.h"
+#include "chrono/assets/ChVisualShapeBox.h"
+#include "chrono/assets/ChVisualShapeCylinder.h"
 #include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystem.h"
 #include "chrono/physics/ChContactMaterialNSC.h"
 
 namespace chrono {
@@ -61,6 +68,25 @@ class ChRandomShapeCreator {
         return mbody;
     }
 
+    /// Function that reinitializes a deactivated particle (see ChParticlePool), previously created by this generator,
+    /// as a new random particle at the given position. The body collision is enabled as for a newly created particle.
+    /// Return false if the body cannot be recycled (in which case it is left unchanged). Children classes that support
+    /// recycling reuse the collision and visual shapes of the body if the newly generated dimensions are the same;
+    /// otherwise the shapes are replaced and the collision model is re-inserted in the collision system, which is not
+    /// supported by the multicore collision system (the body is then not recycled, see ResetShapes).
+    /// The default implementation does not support recycling.
+    virtual bool RandomRecycle(std::shared_ptr<ChBody> mbody, ChCoordsys<> mcoords) { return false; }
+
+    /// This function does RandomRecycle and also executes the custom callback, if provided.
+    virtual bool RandomRecycleAndCallbacks(std::shared_ptr<ChBody> mbody, ChCoordsys<> mcoords) {
+        if (!this->RandomRecycle(mbody, mcoords))
+            return false;
+
+        if (callback_post_creation)
+            callback_post_creation->OnAddBody(mbody, mcoords, *this);
+        return true;
+    }
+
     /// Class to be used as a callback interface for some user-defined action to be
     /// taken each time a body is generated and added to the system.
     class AddBodyCallback {
@@ -88,6 +114,53 @@ class ChRandomShapeCreator {
     void SetAddVisualizationAsset(bool addvisual) { this->add_visualization_asset = addvisual; }
 
   protected:
+    /// Replace the collision and visual shapes of a recycled body, according to the creator settings.
+    /// A collision model already processed by the collision system is removed from it and added back in with the new
+    /// shapes. Return false (and leave the body unchanged) if the collision system does not support removal.
+    bool ResetShapes(ChBody& body,
+                     std::shared_ptr<ChCollisionShape> cshape,
+                     std::shared_ptr<ChVisualShape> vshape,
+                     const ChFrame<>& frame = ChFrame<>()) {
+        auto coll_model = body.GetCollisionModel();
+        std::shared_ptr<ChCollisionSystem> coll_sys;
+        if (coll_model && coll_model->HasImplementation()) {
+            coll_sys = body.GetSystem()->GetCollisionSystem();
+            if (coll_sys->GetType() == ChCollisionSystem::Type::MULTICORE)
+                return false;
+            coll_sys->Remove(coll_model);
+        }
+
+        if (coll_model)
+            coll_model->Clear();
+        if (body.GetVisualModel())
+            body.GetVisualModel()->Clear();
+        if (add_collision_shape)
+            body.AddCollisionShape(cshape, frame);
+        if (add_visualization_asset)
+            body.AddVisualShape(vshape, frame);
+
+        if (coll_sys && add_collision_shape)
+            coll_sys->Add(body.GetCollisionModel());
+        return true;
+    }
+
+    /// Enable or disable collision for a recycled body, according to the creator settings.
+    /// Collision models of recycled bodies are not removed from (or re-inserted in) the collision system, unless the
+    /// collision setting of the creator was changed.
+    void ResetCollision(ChBody& body) {
+        if (body.IsCollisionEnabled() != add_collision_shape)
+            body.EnableCollision(add_collision_shape);
+    }
+
+    /// Return the first collision shape of a body, if of the specified type.
+    template <class T>
+    static std::shared_ptr<T> GetFirstCollisionShape(const ChBody& body) {
+        auto model = body.GetCollisionModel();
+        if (!model || model->GetNumShapes() == 0)
+            return nullptr;
+        return std::dynamic_pointer_cast<T>(model->GetShapeInstance(0).first);
+    }
+
     std::shared_ptr<AddBodyCallback> callback_post_creation;
     bool add_collision_shape;
     bool add_visualization_asset;
@@ -116,6 +189,28 @@ class ChRandomShapeCreatorSpheres : public ChRandomShapeCreator {
         return mbody;
     };
 
+    /// Reinitialize a recycled sphere particle with random radius and density.
+    virtual bool RandomRecycle(std::shared_ptr<ChBody> mbody, ChCoordsys<> mcoords) override {
+        if (!std::dynamic_pointer_cast<ChBodyEasySphere>(mbody))
+            return false;
+
+        double mrad = 0.5 * diameter->GetRandom();
+        double mmass = density->GetRandom() * ((4.0 / 3.0) * CH_PI * pow(mrad, 3));
+        double inertia = (2.0 / 5.0) * mmass * pow(mrad, 2);
+
+        auto cshape = GetFirstCollisionShape<ChCollisionShapeSphere>(*mbody);
+        if ((!cshape || cshape->GetRadius() != mrad) &&
+            !ResetShapes(*mbody, chrono_types::make_shared<ChCollisionShapeSphere>(material, mrad),
+                         chrono_types::make_shared<ChVisualShapeSphere>(mrad)))
+            return false;
+
+        mbody->SetMass(mmass);
+        mbody->SetInertiaXX(ChVector3d(inertia, inertia, inertia));
+        mbody->SetCoordsys(mcoords);
+        ResetCollision(*mbody);
+        return true;
+    }
+
     /// Set the statistical distribution for the random diameter.
     void SetDiameterDistribution(std::shared_ptr<ChDistribution> mdistr) { diameter = mdistr; }
 
@@ -156,6 +251,31 @@ class ChRandomShapeCreatorBoxes : public ChRandomShapeCreator {
         return mbody;
     };
 
+    /// Reinitialize a recycled box particle with random sizes and density.
+    virtual bool RandomRecycle(std::shared_ptr<ChBody> mbody, ChCoordsys<> mcoords) override {
+        if (!std::dynamic_pointer_cast<ChBodyEasyBox>(mbody))
+            return false;
+
+        double sx = fabs(x_size->GetRandom());
+        double sy = fabs(sx * sizeratioYZ->GetRandom());
+        double sz = fabs(sx * sizeratioYZ->GetRandom() * sizeratioZ->GetRandom());
+        double mmass = fabs(density->GetRandom()) * (sx * sy * sz);
+
+        auto cshape = GetFirstCollisionShape<ChCollisionShapeBox>(*mbody);
+        if ((!cshape || cshape->GetLengths() != ChVector3d(sx, sy, sz)) &&
+            !ResetShapes(*mbody, chrono_types::make_shared<ChCollisionShapeBox>(material, sx, sy, sz),
+                         chrono_types::make_shared<ChVisualShapeBox>(sx, sy, sz)))
+            return false;
+
+        mbody->SetMass(mmass);
+        mbody->SetInertiaXX(ChVector3d((1.0 / 12.0) * mmass * (pow(sy, 2) + pow(sz, 2)),
+                                       (1.0 / 12.0) * mmass * (pow(sx, 2) + pow(sz, 2)),
+                                       (1.0 / 12.0) * mmass * (pow(sx, 2) + pow(sy, 2))));
+        mbody->SetCoordsys(mcoords);
+        ResetCollision(*mbody);
+        return true;
+    }
+
     /// Set the statistical distribution for the x size, that is the longest axis.
     void SetXsizeDistribution(std::shared_ptr<ChDistribution> mdistr) { x_size = mdistr; }
     /// Set the statistical distribution for scaling on both Y,Z widths (the lower <1, the thinner, as a needle).
@@ -201,6 +321,32 @@ class ChRandomShapeCreatorCylinders : public ChRandomShapeCreator {
         return mbody;
     };
 
+    /// Reinitialize a recycled cylinder particle with random diameter, length, and density.
+    virtual bool RandomRecycle(std::shared_ptr<ChBody> mbody, ChCoordsys<> mcoords) override {
+        if (!std::dynamic_pointer_cast<ChBodyEasyCylinder>(mbody))
+            return false;
+
+        double rad = 0.5 * diameter->GetRandom();
+        double height = length_factor->GetRandom() * 2.0 * rad;
+        double mass = density->GetRandom() * (CH_PI * pow(rad, 2) * height);
+        double I_axis = 0.5 * mass * pow(rad, 2);
+        double I_orth = (1 / 12.0) * mass * (3 * pow(rad, 2) + pow(height, 2));
+
+        // Cylinder shapes along the body Y axis (as in ChBodyEasyCylinder)
+        auto cshape = GetFirstCollisionShape<ChCollisionShapeCylinder>(*mbody);
+        if ((!cshape || cshape->GetRadius() != rad || cshape->GetHeight() != height) &&
+            !ResetShapes(*mbody, chrono_types::make_shared<ChCollisionShapeCylinder>(material, rad, height),
+                         chrono_types::make_shared<ChVisualShapeCylinder>(rad, height),
+                         ChFrame<>(VNULL, QuatFromAngleX(CH_PI_2))))
+            return false;
+
+        mbody->SetMass(mass);
+        mbody->SetInertiaXX(ChVector3d(I_orth, I_axis, I_orth));
+        mbody->SetCoordsys(mcoords);
+        ResetCollision(*mbody);
+        return true;
+    }
+
     /// Set the statistical distribution for the diameter.
     void SetDiameterDistribution(std::shared_ptr<ChDistribution> mdistr) { diameter = mdistr; }
     /// Set the statistical distribution for the length ratio (length = diameter*length_factor).
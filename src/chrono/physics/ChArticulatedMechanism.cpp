@@ -0,0 +1,853 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Tree-structured mechanism in reduced (joint) coordinates, with recursive
+// O(n) dynamics algorithms and optional loop-closure constraints.
+//
+// Spatial vectors are [angular; linear], expressed in the centroidal frame of
+// each link (see R. Featherstone, Rigid Body Dynamics Algorithms, 2008).
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+#include "chrono/physics/ChArticulatedMechanism.h"
+#include "chrono/physics/ChSystem.h"
+#include "chrono/solver/ChSystemDescriptor.h"
+
+namespace chrono {
+
+// Spatial cross products for motion and force vectors
+static Eigen::Matrix<double, 6, 1> CrossMotion(const Eigen::Matrix<double, 6, 1>& V,
+                                               const Eigen::Matrix<double, 6, 1>& m) {
+    Eigen::Vector3d w = V.head<3>();
+    Eigen::Vector3d v = V.tail<3>();
+    Eigen::Matrix<double, 6, 1> res;
+    res.head<3>() = w.cross(m.head<3>());
+    res.tail<3>() = w.cross(m.tail<3>()) + v.cross(m.head<3>());
+    return res;
+}
+
+static Eigen::Matrix<double, 6, 1> CrossForce(const Eigen::Matrix<double, 6, 1>& V,
+                                              const Eigen::Matrix<double, 6, 1>& f) {
+    Eigen::Vector3d w = V.head<3>();
+    Eigen::Vector3d v = V.tail<3>();
+    Eigen::Matrix<double, 6, 1> res;
+    res.head<3>() = w.cross(f.head<3>()) + v.cross(f.tail<3>());
+    res.tail<3>() = w.cross(f.tail<3>());
+    return res;
+}
+
+static Eigen::Matrix3d Skew(const ChVector3d& r) {
+    Eigen::Matrix3d S;
+    S << 0, -r.z(), r.y(), r.z(), 0, -r.x(), -r.y(), r.x(), 0;
+    return S;
+}
+
+// -----------------------------------------------------------------------------
+
+ChArticulatedLink::ChArticulatedLink() : m_mechanism(nullptr), m_index(0) {}
+
+ChArticulatedLink::ChArticulatedLink(const ChArticulatedLink& other) : ChBody(other) {
+    m_mechanism = nullptr;
+    m_index = 0;
+}
+
+void ChArticulatedLink::ContactForceLoadResidual_F(const ChVector3d& F,
+                                                   const ChVector3d& T,
+                                                   const ChVector3d& abs_point,
+                                                   ChVectorDynamic<>& R) {
+    if (m_mechanism)
+        m_mechanism->LoadLinkForce(m_index, F, T, abs_point, m_mechanism->GetOffset_w(), R);
+}
+
+// -----------------------------------------------------------------------------
+
+ChVariablesArticulated::ChVariablesArticulated(ChArticulatedMechanism* mechanism, unsigned int dof)
+    : ChVariables(dof), m_mechanism(mechanism) {}
+
+void ChVariablesArticulated::SetNumDOF(unsigned int dof) {
+    ChVariables::operator=(ChVariablesArticulated(m_mechanism, dof));
+}
+
+void ChVariablesArticulated::ComputeMassInverseTimesVector(ChVectorRef result, ChVectorConstRef vect) const {
+    m_mechanism->ComputeMassInverseTimesVector(vect, result);
+}
+
+void ChVariablesArticulated::AddMassTimesVector(ChVectorRef result, ChVectorConstRef vect) const {
+    ChVectorDynamic<> tmp(ndof);
+    m_mechanism->ComputeMassTimesVector(vect, tmp);
+    result += tmp;
+}
+
+void ChVariablesArticulated::AddMassTimesVectorInto(ChVectorRef result, ChVectorConstRef vect, const double ca) const {
+    ChVectorDynamic<> tmp(ndof);
+    m_mechanism->ComputeMassTimesVector(vect.segment(offset, ndof), tmp);
+    result.segment(offset, ndof) += ca * tmp;
+}
+
+void ChVariablesArticulated::AddMassDiagonalInto(ChVectorRef result, const double ca) const {
+    result.segment(offset, ndof) += ca * m_mechanism->m_M.diagonal();
+}
+
+void ChVariablesArticulated::PasteMassInto(ChSparseMatrix& mat,
+                                           unsigned int start_row,
+                                           unsigned int start_col,
+                                           const double ca) const {
+    const auto& M = m_mechanism->m_M;
+    for (int row = 0; row < M.rows(); ++row)
+        for (int col = 0; col < M.cols(); ++col)
+            mat.SetElement(offset + start_row + row, offset + start_col + col, ca * M(row, col));
+}
+
+// -----------------------------------------------------------------------------
+
+ChArticulatedMechanism::ChArticulatedMechanism() : m_nq(0), m_nv(0), m_nc(0), m_variables(this) {}
+
+ChArticulatedMechanism::ChArticulatedMechanism(const ChArticulatedMechanism& other)
+    : ChPhysicsItem(other), m_variables(this) {
+    m_links = other.m_links;
+    m_closures = other.m_closures;
+    m_nq = other.m_nq;
+    m_nv = other.m_nv;
+    m_nc = other.m_nc;
+    m_q = other.m_q;
+    m_v = other.m_v;
+    m_a = other.m_a;
+    m_tau = other.m_tau;
+    m_bias = other.m_bias;
+    m_M = other.m_M;
+    ResizeStates();
+}
+
+unsigned int ChArticulatedMechanism::AddLink(std::shared_ptr<ChArticulatedLink> link,
+                                             std::shared_ptr<ChArticulatedLink> parent,
+                                             JointType type,
+                                             const ChFrame<>& joint_frame) {
+    if (link->m_mechanism)
+        throw std::invalid_argument("ChArticulatedMechanism::AddLink: the link already belongs to a mechanism");
+    if (parent && parent->m_mechanism != this)
+        throw std::invalid_argument("ChArticulatedMechanism::AddLink: the parent link must be added first");
+    if (parent && type == JointType::FREE)
+        throw std::invalid_argument("ChArticulatedMechanism::AddLink: a free joint can only connect to the ground");
+
+    Link data;
+    data.link = link;
+    data.parent = parent ? (int)parent->m_index : -1;
+    data.type = type;
+    ChFrame<> X_parent = parent ? ChFrame<>(parent->GetCoordsys()) : ChFrame<>();
+    data.frame_p = X_parent.GetInverse() * joint_frame;
+    data.frame_c = ChFrame<>(link->GetCoordsys()).GetInverse() * joint_frame;
+    data.off_q = m_nq;
+    data.off_v = m_nv;
+    data.nq = (type == JointType::FREE) ? 7 : 1;
+    data.nv = (type == JointType::FREE) ? 6 : 1;
+    data.V.setZero();
+    data.c.setZero();
+    data.f_ext.setZero();
+
+    link->SetFixed(true);
+    link->m_mechanism = this;
+    link->m_index = (unsigned int)m_links.size();
+    m_links.push_back(data);
+
+    m_nq += data.nq;
+    m_nv += data.nv;
+    ResizeStates();
+
+    // Initial joint coordinates and velocities
+    if (type == JointType::FREE) {
+        m_q.segment(data.off_q, 3) = link->GetPos().eigen();
+        m_q.segment(data.off_q + 3, 4) = link->GetRot().eigen();
+        m_v.segment(data.off_v, 3) = link->GetPosDt().eigen();
+        m_v.segment(data.off_v + 3, 3) = link->GetAngVelLocal().eigen();
+    }
+
+    if (system && !link->GetSystem())
+        system->AddBody(link);
+
+    UpdateKinematics();
+
+    return link->m_index;
+}
+
+unsigned int ChArticulatedMechanism::AddLoopClosure(std::shared_ptr<ChArticulatedLink> link_A,
+                                                    std::shared_ptr<ChArticulatedLink> link_B,
+                                                    const ChFrame<>& frame,
+                                                    bool c_x,
+                                                    bool c_y,
+                                                    bool c_z,
+                                                    bool c_rx,
+                                                    bool c_ry,
+                                                    bool c_rz) {
+    if (link_A->m_mechanism != this || (link_B && link_B->m_mechanism != this))
+        throw std::invalid_argument("ChArticulatedMechanism::AddLoopClosure: the links must belong to the mechanism");
+
+    LoopClosure closure;
+    closure.link_A = (int)link_A->m_index;
+    closure.link_B = link_B ? (int)link_B->m_index : -1;
+    closure.frame_A = ChFrame<>(link_A->GetCoordsys()).GetInverse() * frame;
+    closure.frame_B = link_B ? ChFrame<>(link_B->GetCoordsys()).GetInverse() * frame : frame;
+    bool mask[6] = {c_x, c_y, c_z, c_rx, c_ry, c_rz};
+    int num_rows = 0;
+    for (int k = 0; k < 6; k++) {
+        closure.mask[k] = mask[k];
+        num_rows += mask[k] ? 1 : 0;
+    }
+    closure.C.setZero();
+    closure.rows.resize(num_rows);
+    closure.react.assign(num_rows, 0.0);
+
+    // Copying constraints does not preserve their activity flags, so refresh all rows
+    m_closures.push_back(closure);
+    for (auto& c : m_closures) {
+        for (auto& row : c.rows) {
+            row.SetVariables({&m_variables});
+            row.SetValid(true);
+        }
+    }
+    m_nc += num_rows;
+
+    UpdateLoopClosures();
+
+    return (unsigned int)m_closures.size() - 1;
+}
+
+void ChArticulatedMechanism::ResizeStates() {
+    auto resize = [](ChVectorDynamic<>& vec, unsigned int n) {
+        auto old_size = vec.size();
+        vec.conservativeResize(n);
+        if (n > old_size)
+            vec.tail(n - old_size).setZero();
+    };
+    resize(m_q, m_nq);
+    resize(m_v, m_nv);
+    resize(m_a, m_nv);
+    resize(m_tau, m_nv);
+    resize(m_bias, m_nv);
+    m_M.setZero(m_nv, m_nv);
+
+    m_variables.SetNumDOF(m_nv);
+    for (auto& closure : m_closures)
+        for (auto& row : closure.rows) {
+            row.SetVariables({&m_variables});
+            row.SetValid(true);
+        }
+}
+
+void ChArticulatedMechanism::SetJointPos(unsigned int i, double pos) {
+    assert(m_links[i].type != JointType::FREE);
+    m_q(m_links[i].off_q) = pos;
+    UpdateKinematics();
+}
+
+void ChArticulatedMechanism::SetJointVel(unsigned int i, double vel) {
+    assert(m_links[i].type != JointType::FREE);
+    m_v(m_links[i].off_v) = vel;
+    UpdateKinematics();
+}
+
+ChVectorDynamic<> ChArticulatedMechanism::GetLoopClosureViolation(unsigned int i) const {
+    const auto& closure = m_closures[i];
+    ChVectorDynamic<> violation(closure.rows.size());
+    int k = 0;
+    for (int d = 0; d < 6; d++) {
+        if (closure.mask[d])
+            violation(k++) = closure.C(d);
+    }
+    return violation;
+}
+
+ChVectorDynamic<> ChArticulatedMechanism::GetLoopClosureReaction(unsigned int i) const {
+    const auto& closure = m_closures[i];
+    ChVectorDynamic<> reaction(closure.react.size());
+    for (size_t k = 0; k < closure.react.size(); k++)
+        reaction((int)k) = closure.react[k];
+    return reaction;
+}
+
+void ChArticulatedMechanism::SetSystem(ChSystem* m_system) {
+    ChPhysicsItem::SetSystem(m_system);
+    if (!m_system)
+        return;
+    CheckContactMethod();
+    for (auto& data : m_links) {
+        if (!data.link->GetSystem())
+            m_system->AddBody(data.link);
+    }
+}
+
+void ChArticulatedMechanism::SetupInitial() {
+    // Collision may have been enabled on links after adding the mechanism to the system
+    CheckContactMethod();
+}
+
+void ChArticulatedMechanism::CheckContactMethod() const {
+    if (!system || system->GetContactMethod() != ChContactMethod::NSC)
+        return;
+    for (const auto& data : m_links) {
+        if (data.link->IsCollisionEnabled())
+            throw std::runtime_error(
+                "ChArticulatedMechanism - NSC contact is not supported for links (collision enabled on link " +
+                std::to_string(data.link->m_index) + ")");
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Recursive algorithms
+
+void ChArticulatedMechanism::UpdateKinematics() {
+    std::vector<ChFrame<>> X_abs(m_links.size());
+
+    for (size_t i = 0; i < m_links.size(); i++) {
+        auto& data = m_links[i];
+
+        // Link frame relative to the parent link frame
+        ChFrame<> X_rel;
+        switch (data.type) {
+            case JointType::REVOLUTE:
+                X_rel = data.frame_p * ChFrame<>(VNULL, QuatFromAngleZ(m_q(data.off_q))) * data.frame_c.GetInverse();
+                break;
+            case JointType::PRISMATIC:
+                X_rel = data.frame_p * ChFrame<>(ChVector3d(0, 0, m_q(data.off_q)), QUNIT) *
+                        data.frame_c.GetInverse();
+                break;
+            case JointType::FREE: {
+                ChQuaternion<> rot(m_q.segment(data.off_q + 3, 4));
+                X_rel = ChFrame<>(ChVector3d(m_q.segment(data.off_q, 3)), rot.GetNormalized());
+                break;
+            }
+        }
+        X_abs[i] = (data.parent >= 0) ? X_abs[data.parent] * X_rel : X_rel;
+
+        // Motion transform from parent frame to link frame
+        Eigen::Matrix3d Rt = X_rel.GetRotMat().transpose();
+        data.X.setZero();
+        data.X.topLeftCorner<3, 3>() = Rt;
+        data.X.bottomRightCorner<3, 3>() = Rt;
+        data.X.bottomLeftCorner<3, 3>() = -Rt * Skew(X_rel.GetPos());
+
+        // Joint motion subspace
+        ChVector3d axis = data.frame_c.GetRotMat().GetAxisZ();
+        data.S.resize(6, data.nv);
+        switch (data.type) {
+            case JointType::REVOLUTE:
+                data.S.col(0) << axis.eigen(), Vcross(data.frame_c.GetPos(), axis).eigen();
+                break;
+            case JointType::PRISMATIC:
+                data.S.col(0) << Eigen::Vector3d::Zero(), axis.eigen();
+                break;
+            case JointType::FREE:
+                data.S.setZero();
+                data.S.topRightCorner<3, 3>().setIdentity();
+                data.S.bottomLeftCorner<3, 3>() = Rt;
+                break;
+        }
+
+        // Link velocity and velocity-product acceleration
+        Vector6 vJ = data.S * m_v.segment(data.off_v, data.nv);
+        data.V = vJ;
+        if (data.parent >= 0)
+            data.V += data.X * m_links[data.parent].V;
+        if (data.type == JointType::FREE) {
+            data.c.head<3>().setZero();
+            data.c.tail<3>() = -data.V.head<3>().cross(data.V.tail<3>());
+        } else {
+            data.c = CrossMotion(data.V, vJ);
+        }
+
+        // Joint motion subspace in absolute frame
+        const ChMatrix33<>& R = X_abs[i].GetRotMat();
+        data.W.resize(6, data.nv);
+        data.W.topRows<3>() = R * data.S.topRows<3>();
+        data.W.bottomRows<3>() = R * data.S.bottomRows<3>();
+
+        // Set state of link body
+        data.link->SetCoordsys(X_abs[i].GetCoordsys());
+        data.link->SetAngVelLocal(ChVector3d(data.V.head<3>()));
+        data.link->SetPosDt(R * ChVector3d(data.V.tail<3>()));
+    }
+}
+
+void ChArticulatedMechanism::UpdateDynamics() {
+    int n = (int)m_links.size();
+
+    // Spatial inertias and external forces (applied to the link bodies, including gravity)
+    for (auto& data : m_links) {
+        const auto& link = data.link;
+        data.I.setZero();
+        data.I.topLeftCorner<3, 3>() = link->GetInertia();
+        data.I.bottomRightCorner<3, 3>() = link->GetMass() * Eigen::Matrix3d::Identity();
+
+        ChVector3d force = link->Xforce;
+        ChVector3d torque = link->TransformDirectionLocalToParent(link->Xtorque);
+        data.f_ext.head<3>() = link->TransformDirectionParentToLocal(torque).eigen();
+        data.f_ext.tail<3>() = link->TransformDirectionParentToLocal(force).eigen();
+    }
+
+    // Generalized forces: actuation minus velocity-product terms, plus external forces
+    InverseDynamics(ChVectorDynamic<>::Zero(m_nv), true, m_bias);
+    m_bias = m_tau - m_bias;
+
+    // Composite-rigid-body algorithm for the joint-space mass matrix
+    std::vector<Matrix6> Ic(n);
+    for (int i = 0; i < n; i++)
+        Ic[i] = m_links[i].I;
+    for (int i = n - 1; i >= 0; i--) {
+        const auto& data = m_links[i];
+        if (data.parent >= 0)
+            Ic[data.parent] += data.X.transpose() * Ic[i] * data.X;
+    }
+    m_M.setZero(m_nv, m_nv);
+    for (int i = 0; i < n; i++) {
+        const auto& data = m_links[i];
+        Matrix6N F = Ic[i] * data.S;
+        m_M.block(data.off_v, data.off_v, data.nv, data.nv) = data.S.transpose() * F;
+        int j = i;
+        while (m_links[j].parent >= 0) {
+            F = m_links[j].X.transpose() * F;
+            j = m_links[j].parent;
+            const auto& anc = m_links[j];
+            m_M.block(anc.off_v, data.off_v, anc.nv, data.nv) = anc.S.transpose() * F;
+            m_M.block(data.off_v, anc.off_v, data.nv, anc.nv) =
+                m_M.block(anc.off_v, data.off_v, anc.nv, data.nv).transpose();
+        }
+    }
+
+    // Articulated-body inertias
+    for (auto& data : m_links)
+        data.IA = data.I;
+    for (int i = n - 1; i >= 0; i--) {
+        auto& data = m_links[i];
+        data.U = data.IA * data.S;
+        data.D_inv = (data.S.transpose() * data.U).inverse();
+        if (data.parent >= 0) {
+            Matrix6 Ia = data.IA - data.U * data.D_inv * data.U.transpose();
+            m_links[data.parent].IA += data.X.transpose() * Ia * data.X;
+        }
+    }
+}
+
+void ChArticulatedMechanism::InverseDynamics(ChVectorConstRef acc, bool bias, ChVectorRef tau) const {
+    size_t n = m_links.size();
+    std::vector<Vector6> A(n);
+    std::vector<Vector6> f(n);
+
+    for (size_t i = 0; i < n; i++) {
+        const auto& data = m_links[i];
+        A[i] = data.S * acc.segment(data.off_v, data.nv);
+        if (data.parent >= 0)
+            A[i] += data.X * A[data.parent];
+        if (bias)
+            A[i] += data.c;
+        f[i] = data.I * A[i];
+        if (bias)
+            f[i] += CrossForce(data.V, data.I * data.V) - data.f_ext;
+    }
+
+    for (size_t i = n; i-- > 0;) {
+        const auto& data = m_links[i];
+        tau.segment(data.off_v, data.nv) = data.S.transpose() * f[i];
+        if (data.parent >= 0)
+            f[data.parent] += data.X.transpose() * f[i];
+    }
+}
+
+void ChArticulatedMechanism::ComputeMassTimesVector(ChVectorConstRef vect, ChVectorRef result) const {
+    InverseDynamics(vect, false, result);
+}
+
+void ChArticulatedMechanism::ComputeMassInverseTimesVector(ChVectorConstRef vect, ChVectorRef result) const {
+    using VectorN = Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor, 6, 1>;
+    size_t n = m_links.size();
+    std::vector<Vector6> p(n, Vector6::Zero());
+    std::vector<Vector6> a(n);
+    std::vector<VectorN> u(n);
+
+    // Articulated-body algorithm, with zero velocities (articulated-body inertias computed in UpdateDynamics)
+    for (size_t i = n; i-- > 0;) {
+        const auto& data = m_links[i];
+        u[i] = vect.segment(data.off_v, data.nv) - data.S.transpose() * p[i];
+        if (data.parent >= 0)
+            p[data.parent] += data.X.transpose() * (p[i] + data.U * (data.D_inv * u[i]));
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        const auto& data = m_links[i];
+        Vector6 a_parent = (data.parent >= 0) ? Vector6(data.X * a[data.parent]) : Vector6(Vector6::Zero());
+        VectorN x = data.D_inv * (u[i] - data.U.transpose() * a_parent);
+        result.segment(data.off_v, data.nv) = x;
+        a[i] = a_parent + data.S * x;
+    }
+}
+
+void ChArticulatedMechanism::AddPointJacobian(int i,
+                                              const ChVector3d& point,
+                                              double scale,
+                                              ChMatrixDynamic<>& J) const {
+    for (int k = i; k >= 0; k = m_links[k].parent) {
+        const auto& data = m_links[k];
+        ChVector3d r = point - data.link->GetPos();
+        for (unsigned int col = 0; col < data.nv; col++) {
+            ChVector3d w(data.W.col(col).head<3>());
+            ChVector3d v(data.W.col(col).tail<3>());
+            J.block<3, 1>(0, data.off_v + col) += scale * w.eigen();
+            J.block<3, 1>(3, data.off_v + col) += scale * (v + Vcross(w, r)).eigen();
+        }
+    }
+}
+
+void ChArticulatedMechanism::LoadLinkForce(unsigned int i,
+                                           const ChVector3d& F,
+                                           const ChVector3d& T,
+                                           const ChVector3d& abs_point,
+                                           unsigned int off,
+                                           ChVectorDynamic<>& R) const {
+    for (int k = (int)i; k >= 0; k = m_links[k].parent) {
+        const auto& data = m_links[k];
+        ChVector3d torque = T + Vcross(abs_point - data.link->GetPos(), F);
+        R.segment(off + data.off_v, data.nv) +=
+            data.W.topRows<3>().transpose() * torque.eigen() + data.W.bottomRows<3>().transpose() * F.eigen();
+    }
+}
+
+void ChArticulatedMechanism::UpdateLoopClosures() {
+    for (auto& closure : m_closures) {
+        const auto& link_A = m_links[closure.link_A].link;
+        ChFrame<> G_A = ChFrame<>(link_A->GetCoordsys()) * closure.frame_A;
+        ChFrame<> G_B = closure.frame_B;
+        if (closure.link_B >= 0)
+            G_B = ChFrame<>(m_links[closure.link_B].link->GetCoordsys()) * closure.frame_B;
+
+        // Violation: relative position and rotation of frame B, in frame A
+        const ChMatrix33<>& R_A = G_A.GetRotMat();
+        ChVector3d d = G_B.GetPos() - G_A.GetPos();
+        ChQuaternion<> q_rel = G_A.GetRot().GetConjugate() * G_B.GetRot();
+        if (q_rel.e0() < 0)
+            q_rel = -q_rel;
+        closure.C.head<3>() = R_A.transpose() * d.eigen();
+        closure.C.tail<3>() = 2 * q_rel.GetVector().eigen();
+
+        // Jacobian: relative velocity of frame B, in frame A
+        ChMatrixDynamic<> J_A = ChMatrixDynamic<>::Zero(6, m_nv);
+        ChMatrixDynamic<> J_B = ChMatrixDynamic<>::Zero(6, m_nv);
+        AddPointJacobian(closure.link_A, G_A.GetPos(), 1, J_A);
+        if (closure.link_B >= 0)
+            AddPointJacobian(closure.link_B, G_B.GetPos(), 1, J_B);
+        closure.Cq.resize(6, m_nv);
+        closure.Cq.topRows(3) =
+            R_A.transpose() * (J_B.bottomRows(3) - J_A.bottomRows(3) + Skew(d) * J_A.topRows(3));
+        closure.Cq.bottomRows(3) = R_A.transpose() * (J_B.topRows(3) - J_A.topRows(3));
+
+        int k = 0;
+        for (int dir = 0; dir < 6; dir++) {
+            if (closure.mask[dir])
+                closure.rows[k++].Get_Cq_N(0) = closure.Cq.row(dir);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void ChArticulatedMechanism::Setup() {
+    if (m_variables.GetDOF() != m_nv)
+        ResizeStates();
+}
+
+void ChArticulatedMechanism::Update(double time, bool update_assets) {
+    ChPhysicsItem::Update(time, update_assets);
+
+    UpdateDynamics();
+    UpdateLoopClosures();
+}
+
+// STATE BOOKKEEPING FUNCTIONS
+
+void ChArticulatedMechanism::IntStateGather(const unsigned int off_x,  // offset in x state vector
+                                            ChState& x,                // state vector, position part
+                                            const unsigned int off_v,  // offset in v state vector
+                                            ChStateDelta& v,           // state vector, speed part
+                                            double& T                  // time
+) {
+    x.segment(off_x, m_nq) = m_q;
+    v.segment(off_v, m_nv) = m_v;
+    T = GetChTime();
+}
+
+void ChArticulatedMechanism::IntStateScatter(const unsigned int off_x,  // offset in x state vector
+                                             const ChState& x,          // state vector, position part
+                                             const unsigned int off_v,  // offset in v state vector
+                                             const ChStateDelta& v,     // state vector, speed part
+                                             const double T,            // time
+                                             bool full_update           // perform complete update
+) {
+    m_q = x.segment(off_x, m_nq);
+    m_v = v.segment(off_v, m_nv);
+    UpdateKinematics();
+
+    // The link bodies were already updated by the containing assembly, with their previous state
+    for (auto& data : m_links)
+        data.link->Update(T, full_update);
+
+    Update(T, full_update);
+}
+
+void ChArticulatedMechanism::IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) {
+    a.segment(off_a, m_nv) = m_a;
+}
+
+void ChArticulatedMechanism::IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) {
+    m_a = a.segment(off_a, m_nv);
+
+    // Link accelerations
+    std::vector<Vector6> A(m_links.size());
+    for (size_t i = 0; i < m_links.size(); i++) {
+        const auto& data = m_links[i];
+        A[i] = data.S * m_a.segment(data.off_v, data.nv) + data.c;
+        if (data.parent >= 0)
+            A[i] += data.X * A[data.parent];
+        Eigen::Vector3d acc = A[i].tail<3>() + data.V.head<3>().cross(data.V.tail<3>());
+        data.link->SetAngAccLocal(ChVector3d(A[i].head<3>()));
+        data.link->SetPosDt2(data.link->TransformDirectionLocalToParent(ChVector3d(acc)));
+    }
+}
+
+void ChArticulatedMechanism::IntStateGatherReactions(const unsigned int off_L, ChVectorDynamic<>& L) {
+    unsigned int k = 0;
+    for (const auto& closure : m_closures)
+        for (double react : closure.react)
+            L(off_L + k++) = react;
+}
+
+void ChArticulatedMechanism::IntStateScatterReactions(const unsigned int off_L, const ChVectorDynamic<>& L) {
+    unsigned int k = 0;
+    for (auto& closure : m_closures)
+        for (double& react : closure.react)
+            react = L(off_L + k++);
+}
+
+void ChArticulatedMechanism::IntStateIncrement(const unsigned int off_x,  // offset in x state vector
+                                               ChState& x_new,            // state vector, position part, incremented
+                                               const ChState& x,          // state vector, initial position part
+                                               const unsigned int off_v,  // offset in v state vector
+                                               const ChStateDelta& Dv     // state vector, increment
+) {
+    for (const auto& data : m_links) {
+        unsigned int ox = off_x + data.off_q;
+        unsigned int ov = off_v + data.off_v;
+        if (data.type == JointType::FREE) {
+            x_new.segment(ox, 3) = x.segment(ox, 3) + Dv.segment(ov, 3);
+            ChQuaternion<> q_old(x.segment(ox + 3, 4));
+            ChQuaternion<> rel_q;
+            rel_q.SetFromRotVec(Dv.segment(ov + 3, 3));
+            x_new.segment(ox + 3, 4) = (q_old * rel_q).eigen();
+        } else {
+            x_new(ox) = x(ox) + Dv(ov);
+        }
+    }
+}
+
+void ChArticulatedMechanism::IntStateGetIncrement(const unsigned int off_x,  // offset in x state vector
+                                                  const ChState& x_new,      // state vector, position part, incremented
+                                                  const ChState& x,          // state vector, initial position part
+                                                  const unsigned int off_v,  // offset in v state vector
+                                                  ChStateDelta& Dv           // state vector, increment
+) {
+    for (const auto& data : m_links) {
+        unsigned int ox = off_x + data.off_q;
+        unsigned int ov = off_v + data.off_v;
+        if (data.type == JointType::FREE) {
+            Dv.segment(ov, 3) = x_new.segment(ox, 3) - x.segment(ox, 3);
+            ChQuaternion<> q_old(x.segment(ox + 3, 4));
+            ChQuaternion<> q_new(x_new.segment(ox + 3, 4));
+            ChQuaternion<> rel_q = q_old.GetConjugate() * q_new;
+            Dv.segment(ov + 3, 3) = rel_q.GetRotVec().eigen();
+        } else {
+            Dv(ov) = x_new(ox) - x(ox);
+        }
+    }
+}
+
+void ChArticulatedMechanism::IntLoadResidual_F(const unsigned int off,  // offset in R residual
+                                               ChVectorDynamic<>& R,    // result: the R residual, R += c*F
+                                               const double c           // a scaling factor
+) {
+    R.segment(off, m_nv) += c * m_bias;
+}
+
+void ChArticulatedMechanism::IntLoadResidual_Mv(const unsigned int off,      // offset in R residual
+                                                ChVectorDynamic<>& R,        // result: the R residual, R += c*M*v
+                                                const ChVectorDynamic<>& w,  // the w vector
+                                                const double c               // a scaling factor
+) {
+    ChVectorDynamic<> Mw(m_nv);
+    ComputeMassTimesVector(w.segment(off, m_nv), Mw);
+    R.segment(off, m_nv) += c * Mw;
+}
+
+void ChArticulatedMechanism::IntLoadLumpedMass_Md(const unsigned int off,
+                                                  ChVectorDynamic<>& Md,
+                                                  double& err,
+                                                  const double c) {
+    Md.segment(off, m_nv) += c * m_M.diagonal();
+    // joint-space mass matrices are not diagonal, so lumping can give inconsistent results
+    err += m_M.cwiseAbs().sum() - m_M.diagonal().cwiseAbs().sum();
+}
+
+void ChArticulatedMechanism::IntLoadResidual_CqL(const unsigned int off_L,    // offset in L multipliers
+                                                 ChVectorDynamic<>& R,        // result: the R residual, R += c*Cq'*L
+                                                 const ChVectorDynamic<>& L,  // the L vector
+                                                 const double c               // a scaling factor
+) {
+    unsigned int k = 0;
+    for (auto& closure : m_closures)
+        for (auto& row : closure.rows)
+            row.AddJacobianTransposedTimesScalarInto(R, L(off_L + k++) * c);
+}
+
+void ChArticulatedMechanism::IntLoadConstraint_C(const unsigned int off_L,  // offset in Qc residual
+                                                 ChVectorDynamic<>& Qc,     // result: the Qc residual, Qc += c*C
+                                                 const double c,            // a scaling factor
+                                                 bool do_clamp,             // apply clamping to c*C?
+                                                 double recovery_clamp      // value for min/max clamping of c*C
+) {
+    unsigned int k = 0;
+    for (const auto& closure : m_closures) {
+        for (int dir = 0; dir < 6; dir++) {
+            if (!closure.mask[dir])
+                continue;
+            double cnstr_violation = c * closure.C(dir);
+            if (do_clamp)
+                cnstr_violation = std::min(std::max(cnstr_violation, -recovery_clamp), recovery_clamp);
+            Qc(off_L + k++) += cnstr_violation;
+        }
+    }
+}
+
+void ChArticulatedMechanism::IntToDescriptor(const unsigned int off_v,  // offset in v, R
+                                             const ChStateDelta& v,
+                                             const ChVectorDynamic<>& R,
+                                             const unsigned int off_L,  // offset in L, Qc
+                                             const ChVectorDynamic<>& L,
+                                             const ChVectorDynamic<>& Qc) {
+    m_variables.State() = v.segment(off_v, m_nv);
+    m_variables.Force() = R.segment(off_v, m_nv);
+
+    unsigned int k = 0;
+    for (auto& closure : m_closures) {
+        for (auto& row : closure.rows) {
+            row.SetLagrangeMultiplier(L(off_L + k));
+            row.SetRightHandSide(Qc(off_L + k));
+            k++;
+        }
+    }
+}
+
+void ChArticulatedMechanism::IntFromDescriptor(const unsigned int off_v,  // offset in v
+                                               ChStateDelta& v,
+                                               const unsigned int off_L,  // offset in L
+                                               ChVectorDynamic<>& L) {
+    v.segment(off_v, m_nv) = m_variables.State();
+
+    unsigned int k = 0;
+    for (auto& closure : m_closures)
+        for (auto& row : closure.rows)
+            L(off_L + k++) = row.GetLagrangeMultiplier();
+}
+
+// SOLVER INTERFACE
+
+void ChArticulatedMechanism::InjectVariables(ChSystemDescriptor& descriptor) {
+    descriptor.InsertVariables(&m_variables);
+}
+
+void ChArticulatedMechanism::InjectConstraints(ChSystemDescriptor& descriptor) {
+    for (auto& closure : m_closures)
+        for (auto& row : closure.rows)
+            descriptor.InsertConstraint(&row);
+}
+
+void ChArticulatedMechanism::LoadConstraintJacobians() {
+    // Jacobians already loaded in Update
+}
+
+void ChArticulatedMechanism::VariablesFbReset() {
+    m_variables.Force().setZero();
+}
+
+void ChArticulatedMechanism::VariablesFbLoadForces(double factor) {
+    m_variables.Force() += factor * m_bias;
+}
+
+void ChArticulatedMechanism::VariablesFbIncrementMq() {
+    m_variables.AddMassTimesVector(m_variables.Force(), m_variables.State());
+}
+
+void ChArticulatedMechanism::VariablesQbLoadSpeed() {
+    m_variables.State() = m_v;
+}
+
+void ChArticulatedMechanism::VariablesQbSetSpeed(double step) {
+    ChVectorDynamic<> old_v = m_v;
+    m_v = m_variables.State();
+
+    // Compute accelerations by BDF (approximate by differentiation)
+    if (step)
+        m_a = (m_v - old_v) / step;
+
+    UpdateKinematics();
+}
+
+void ChArticulatedMechanism::VariablesQbIncrementPosition(double step) {
+    ChState x(m_nq, nullptr);
+    x.segment(0, m_nq) = m_q;
+    ChStateDelta Dv(m_nv, nullptr);
+    Dv.segment(0, m_nv) = step * m_variables.State();
+    ChState x_new(m_nq, nullptr);
+    IntStateIncrement(0, x_new, x, 0, Dv);
+    m_q = x_new.segment(0, m_nq);
+
+    UpdateKinematics();
+}
+
+void ChArticulatedMechanism::ConstraintsBiReset() {
+    for (auto& closure : m_closures)
+        for (auto& row : closure.rows)
+            row.SetRightHandSide(0);
+}
+
+void ChArticulatedMechanism::ConstraintsBiLoad_C(double factor, double recovery_clamp, bool do_clamp) {
+    for (auto& closure : m_closures) {
+        int k = 0;
+        for (int dir = 0; dir < 6; dir++) {
+            if (!closure.mask[dir])
+                continue;
+            double cnstr_violation = factor * closure.C(dir);
+            if (do_clamp)
+                cnstr_violation = std::min(std::max(cnstr_violation, -recovery_clamp), recovery_clamp);
+            auto& row = closure.rows[k++];
+            row.SetRightHandSide(row.GetRightHandSide() + cnstr_violation);
+        }
+    }
+}
+
+void ChArticulatedMechanism::ConstraintsFetch_react(double factor) {
+    for (auto& closure : m_closures)
+        for (size_t k = 0; k < closure.rows.size(); k++)
+            closure.react[k] = closure.rows[k].GetLagrangeMultiplier() * factor;
+}
+
+}  // end namespace chrono
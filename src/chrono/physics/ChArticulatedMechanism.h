@@ -0,0 +1,413 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Tree-structured mechanism in reduced (joint) coordinates, with recursive
+// O(n) dynamics algorithms and optional loop-closure constraints.
+//
+// =============================================================================
+
+#ifndef CH_ARTICULATED_MECHANISM_H
+#define CH_ARTICULATED_MECHANISM_H
+
+#include <vector>
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/solver/ChConstraintNgeneric.h"
+#include "chrono/solver/ChVariables.h"
+
+namespace chrono {
+
+class ChArticulatedMechanism;
+
+/// @addtogroup chrono_physics
+/// @{
+
+/// Link of an articulated mechanism.
+/// A link is a rigid body (with its own mass properties, collision and visual models) whose state is not integrated
+/// directly but obtained from the joint coordinates of the owning ChArticulatedMechanism. Links are added to the
+/// containing system by the mechanism, as fixed bodies. Contact forces on a link are mapped to the joint coordinates of
+/// the mechanism; forces applied to a link (accumulated forces, ChForce objects, gravity) are included in the dynamics
+/// of the mechanism. Other constraints (ChLink) and loads (ChLoad) acting on a link are not supported.
+class ChApi ChArticulatedLink : public ChBody {
+  public:
+    ChArticulatedLink();
+    ChArticulatedLink(const ChArticulatedLink& other);
+    ~ChArticulatedLink() {}
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChArticulatedLink* Clone() const override { return new ChArticulatedLink(*this); }
+
+    /// Get the owning mechanism (nullptr if not added to a mechanism).
+    ChArticulatedMechanism* GetMechanism() const { return m_mechanism; }
+
+    /// Get the index of this link in the owning mechanism.
+    unsigned int GetIndex() const { return m_index; }
+
+    /// Links always participate in contact, although they are fixed bodies of the containing system.
+    virtual bool IsContactActive() override { return true; }
+
+    /// Apply the given force and torque (expressed in the absolute frame, with the force applied at the given point) to
+    /// the joint coordinates of the owning mechanism.
+    virtual void ContactForceLoadResidual_F(const ChVector3d& F,
+                                            const ChVector3d& T,
+                                            const ChVector3d& abs_point,
+                                            ChVectorDynamic<>& R) override;
+
+    /// Contact forces on a link update the joint coordinates of the mechanism, shared by all its links.
+    virtual bool IsContactResidualExclusive() const override { return false; }
+
+  private:
+    ChArticulatedMechanism* m_mechanism;  ///< owning mechanism
+    unsigned int m_index;                 ///< index in the owning mechanism
+
+    friend class ChArticulatedMechanism;
+};
+
+/// Variables of an articulated mechanism (joint velocities).
+/// The mass matrix is never assembled explicitly, except when requested by a direct solver. Products with the mass
+/// matrix and its inverse are calculated with the O(n) recursive algorithms of the owning mechanism.
+class ChApi ChVariablesArticulated : public ChVariables {
+  public:
+    ChVariablesArticulated(ChArticulatedMechanism* mechanism, unsigned int dof = 0);
+    virtual ~ChVariablesArticulated() {}
+
+    /// Set the number of degrees of freedom.
+    void SetNumDOF(unsigned int dof);
+
+    /// Compute the product of the inverse mass matrix by a given vector and store in result: result = [invMb]*vect.
+    virtual void ComputeMassInverseTimesVector(ChVectorRef result, ChVectorConstRef vect) const override;
+
+    /// Compute the product of the mass matrix by a given vector and increment result: result += [Mb]*vect.
+    virtual void AddMassTimesVector(ChVectorRef result, ChVectorConstRef vect) const override;
+
+    /// Add the product of the mass submatrix by a given vector, scaled by ca, to result.
+    /// Note: 'result' and 'vect' are system-level vectors of appropriate size. This function must index into these
+    /// vectors using the offsets of each variable.
+    virtual void AddMassTimesVectorInto(ChVectorRef result, ChVectorConstRef vect, const double ca) const override;
+
+    /// Add the diagonal of the mass matrix, as a vector scaled by ca, to result.
+    /// Note: 'result' is a system-level vector of appropriate size. This function must index into this vector using the
+    /// offsets of each variable.
+    virtual void AddMassDiagonalInto(ChVectorRef result, const double ca) const override;
+
+    /// Write the mass submatrix for these variables into the specified global matrix at the offsets of each variable.
+    virtual void PasteMassInto(ChSparseMatrix& mat,
+                               unsigned int start_row,
+                               unsigned int start_col,
+                               const double ca) const override;
+
+  private:
+    ChArticulatedMechanism* m_mechanism;
+};
+
+/// Tree-structured mechanism in reduced (joint) coordinates.
+/// Each link is connected to its parent link (or to the ground) through one joint and the state of the mechanism
+/// consists of the joint coordinates only. The dynamics are formulated with recursive algorithms whose cost is linear
+/// in the number of links: the recursive Newton-Euler algorithm for the generalized forces (including gyroscopic and
+/// Coriolis terms) and for products with the mass matrix, and the articulated-body algorithm for products with the
+/// inverse mass matrix (used by iterative solvers). The dense joint-space mass matrix (composite-rigid-body algorithm)
+/// is formed only when requested by a direct solver.
+///
+/// Kinematic loops are closed with loop-closure constraints, the only constraints introduced by the mechanism. Links
+/// are rigid bodies of the containing system (see ChArticulatedLink), so they are visualized and they collide with
+/// other collision models. With SMC contact, contact forces on the links are mapped to the joint coordinates at each
+/// evaluation of the generalized forces. Stiff contact Jacobians (see ChSystemSMC::SetStiffContact) are not supported.
+///
+/// \note NSC contact is not supported: the NSC contact constraints act on the variables of the contactable objects,
+/// while the link bodies have no variables of their own (their motion is set by the joint coordinates). A mechanism
+/// with collision-enabled links cannot be used in a system with NSC contact (an exception is thrown when adding the
+/// mechanism to such a system or at system initialization). Mechanisms without collision can be used with NSC systems.
+class ChApi ChArticulatedMechanism : public ChPhysicsItem {
+  public:
+    /// Joint types.
+    /// Revolute and prismatic joints act along the z axis of the joint frame. A free joint (floating base) can only
+    /// connect a link to the ground; its coordinates are the link position and orientation quaternion and its
+    /// velocities are the link linear velocity (absolute frame) and angular velocity (link frame), as for a ChBody.
+    enum class JointType {
+        REVOLUTE,   ///< rotation about the joint z axis (1 DOF)
+        PRISMATIC,  ///< translation along the joint z axis (1 DOF)
+        FREE        ///< floating base (6 DOFs)
+    };
+
+    ChArticulatedMechanism();
+    ChArticulatedMechanism(const ChArticulatedMechanism& other);
+    ~ChArticulatedMechanism() {}
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChArticulatedMechanism* Clone() const override { return new ChArticulatedMechanism(*this); }
+
+    /// Add a link connected to the specified parent link (or to the ground if parent is nullptr).
+    /// The joint frame is provided in the absolute frame; both the link and its parent must be positioned in their
+    /// initial configuration, which corresponds to zero joint coordinates. The initial joint velocities are zero,
+    /// except for a free joint, whose initial velocities are those of the link. The parent link must have been added
+    /// before. Return the link index.
+    unsigned int AddLink(std::shared_ptr<ChArticulatedLink> link,
+                         std::shared_ptr<ChArticulatedLink> parent,
+                         JointType type,
+                         const ChFrame<>& joint_frame = ChFrame<>());
+
+    /// Add a loop-closure constraint between two frames, attached to link A and to link B (or to the ground if link B
+    /// is nullptr). The frames are provided in the absolute frame and coincide in the current configuration. The mask
+    /// selects the constrained directions (translations and rotations about the axes of the frame on link A), as in
+    /// ChLinkMateGeneric. Return the constraint index.
+    unsigned int AddLoopClosure(std::shared_ptr<ChArticulatedLink> link_A,
+                                std::shared_ptr<ChArticulatedLink> link_B,
+                                const ChFrame<>& frame,
+                                bool c_x = true,
+                                bool c_y = true,
+                                bool c_z = true,
+                                bool c_rx = false,
+                                bool c_ry = false,
+                                bool c_rz = false);
+
+    /// Get the number of links.
+    unsigned int GetNumLinks() const { return (unsigned int)m_links.size(); }
+
+    /// Get the specified link.
+    std::shared_ptr<ChArticulatedLink> GetLink(unsigned int i) const { return m_links[i].link; }
+
+    /// Get the number of degrees of freedom (joint velocities).
+    unsigned int GetNumDOFs() const { return m_nv; }
+
+    /// Get the number of loop-closure constraints.
+    unsigned int GetNumLoopClosures() const { return (unsigned int)m_closures.size(); }
+
+    /// Set the coordinate of the joint of the specified link (revolute and prismatic joints only).
+    void SetJointPos(unsigned int i, double pos);
+
+    /// Set the velocity of the joint of the specified link (revolute and prismatic joints only).
+    void SetJointVel(unsigned int i, double vel);
+
+    /// Get the coordinate of the joint of the specified link (revolute and prismatic joints only).
+    double GetJointPos(unsigned int i) const { return m_q(m_links[i].off_q); }
+
+    /// Get the velocity of the joint of the specified link (revolute and prismatic joints only).
+    double GetJointVel(unsigned int i) const { return m_v(m_links[i].off_v); }
+
+    /// Get the acceleration of the joint of the specified link (revolute and prismatic joints only).
+    double GetJointAcc(unsigned int i) const { return m_a(m_links[i].off_v); }
+
+    /// Set the actuation force (or torque) of the joint of the specified link (revolute and prismatic joints only).
+    /// The actuation is held constant until changed.
+    void SetJointForce(unsigned int i, double force) { m_tau(m_links[i].off_v) = force; }
+
+    /// Get the actuation force (or torque) of the joint of the specified link.
+    double GetJointForce(unsigned int i) const { return m_tau(m_links[i].off_v); }
+
+    /// Get the vector of joint coordinates.
+    const ChVectorDynamic<>& GetJointCoordinates() const { return m_q; }
+
+    /// Get the vector of joint velocities.
+    const ChVectorDynamic<>& GetJointVelocities() const { return m_v; }
+
+    /// Get the current violation of the specified loop-closure constraint.
+    /// The components correspond to the constrained directions, in the order of the mask flags.
+    ChVectorDynamic<> GetLoopClosureViolation(unsigned int i) const;
+
+    /// Get the current reaction of the specified loop-closure constraint (Lagrange multipliers).
+    /// The components correspond to the constrained directions, in the order of the mask flags.
+    ChVectorDynamic<> GetLoopClosureReaction(unsigned int i) const;
+
+    /// Get the dense joint-space mass matrix, as calculated at the last update.
+    void GetMassMatrix(ChMatrixDynamic<>& M) const { M = m_M; }
+
+    /// Access the variables of this mechanism.
+    ChVariablesArticulated& Variables() { return m_variables; }
+
+    /// Compute the product of the mass matrix by the given vector of joint accelerations: result = M*vect (RNEA).
+    void ComputeMassTimesVector(ChVectorConstRef vect, ChVectorRef result) const;
+
+    /// Compute the product of the inverse mass matrix by the given vector of joint forces: result = M^{-1}*vect (ABA).
+    void ComputeMassInverseTimesVector(ChVectorConstRef vect, ChVectorRef result) const;
+
+    /// Load the generalized force corresponding to the given force and torque (in the absolute frame, with the force
+    /// applied at the given point) acting on the specified link: R += J'*[F; T].
+    void LoadLinkForce(unsigned int i,
+                       const ChVector3d& F,
+                       const ChVector3d& T,
+                       const ChVector3d& abs_point,
+                       unsigned int off,
+                       ChVectorDynamic<>& R) const;
+
+    // PHYSICS ITEM INTERFACE
+
+    /// Add the links to the system, as fixed bodies.
+    /// Throws an exception if any link has collision enabled and the system uses NSC contact.
+    virtual void SetSystem(ChSystem* m_system) override;
+
+    /// Check that no link has collision enabled if the system uses NSC contact (otherwise, throws an exception).
+    virtual void SetupInitial() override;
+
+    virtual unsigned int GetNumCoordsPosLevel() override { return m_nq; }
+    virtual unsigned int GetNumCoordsVelLevel() override { return m_nv; }
+    virtual unsigned int GetNumConstraintsBilateral() override { return m_nc; }
+
+    virtual void Setup() override;
+    virtual void Update(double time, bool update_assets = true) override;
+
+    virtual void IntStateGather(const unsigned int off_x,
+                                ChState& x,
+                                const unsigned int off_v,
+                                ChStateDelta& v,
+                                double& T) override;
+    virtual void IntStateScatter(const unsigned int off_x,
+                                 const ChState& x,
+                                 const unsigned int off_v,
+                                 const ChStateDelta& v,
+                                 const double T,
+                                 bool full_update) override;
+    virtual void IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) override;
+    virtual void IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) override;
+    virtual void IntStateGatherReactions(const unsigned int off_L, ChVectorDynamic<>& L) override;
+    virtual void IntStateScatterReactions(const unsigned int off_L, const ChVectorDynamic<>& L) override;
+    virtual void IntStateIncrement(const unsigned int off_x,
+                                   ChState& x_new,
+                                   const ChState& x,
+                                   const unsigned int off_v,
+                                   const ChStateDelta& Dv) override;
+    virtual void IntStateGetIncrement(const unsigned int off_x,
+                                      const ChState& x_new,
+                                      const ChState& x,
+                                      const unsigned int off_v,
+                                      ChStateDelta& Dv) override;
+    virtual void IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) override;
+    virtual void IntLoadResidual_Mv(const unsigned int off,
+                                    ChVectorDynamic<>& R,
+                                    const ChVectorDynamic<>& w,
+                                    const double c) override;
+    virtual void IntLoadLumpedMass_Md(const unsigned int off,
+                                      ChVectorDynamic<>& Md,
+                                      double& err,
+                                      const double c) override;
+    virtual void IntLoadResidual_CqL(const unsigned int off_L,
+                                     ChVectorDynamic<>& R,
+                                     const ChVectorDynamic<>& L,
+                                     const double c) override;
+    virtual void IntLoadConstraint_C(const unsigned int off,
+                                     ChVectorDynamic<>& Qc,
+                                     const double c,
+                                     bool do_clamp,
+                                     double recovery_clamp) override;
+    virtual void IntToDescriptor(const unsigned int off_v,
+                                 const ChStateDelta& v,
+                                 const ChVectorDynamic<>& R,
+                                 const unsigned int off_L,
+                                 const ChVectorDynamic<>& L,
+                                 const ChVectorDynamic<>& Qc) override;
+    virtual void IntFromDescriptor(const unsigned int off_v,
+                                   ChStateDelta& v,
+                                   const unsigned int off_L,
+                                   ChVectorDynamic<>& L) override;
+
+    virtual void InjectVariables(ChSystemDescriptor& descriptor) override;
+    virtual void InjectConstraints(ChSystemDescriptor& descriptor) override;
+    virtual void LoadConstraintJacobians() override;
+
+    virtual void VariablesFbReset() override;
+    virtual void VariablesFbLoadForces(double factor = 1) override;
+    virtual void VariablesQbLoadSpeed() override;
+    virtual void VariablesFbIncrementMq() override;
+    virtual void VariablesQbSetSpeed(double step = 0) override;
+    virtual void VariablesQbIncrementPosition(double step) override;
+
+    virtual void ConstraintsBiReset() override;
+    virtual void ConstraintsBiLoad_C(double factor = 1, double recovery_clamp = 0.1, bool do_clamp = false) override;
+    virtual void ConstraintsFetch_react(double factor = 1) override;
+
+  private:
+    using Vector6 = Eigen::Matrix<double, 6, 1>;
+    using Matrix6 = Eigen::Matrix<double, 6, 6>;
+    using Matrix6N = Eigen::Matrix<double, 6, Eigen::Dynamic, Eigen::ColMajor, 6, 6>;
+    using MatrixNN = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor, 6, 6>;
+
+    /// Link data. Spatial vectors are [angular; linear], expressed in the link (centroidal) frame.
+    struct Link {
+        std::shared_ptr<ChArticulatedLink> link;  ///< link body
+        int parent;                               ///< index of parent link (-1 for the ground)
+        JointType type;                           ///< joint type
+        ChFrame<> frame_p;                        ///< joint frame, relative to the parent link (or absolute)
+        ChFrame<> frame_c;                        ///< joint frame, relative to this link
+        unsigned int off_q;                       ///< offset of joint coordinates
+        unsigned int off_v;                       ///< offset of joint velocities
+        unsigned int nq;                          ///< number of joint coordinates
+        unsigned int nv;                          ///< number of joint velocities
+        Matrix6 X;                                ///< motion transform from parent to link frame
+        Matrix6N S;                               ///< joint motion subspace
+        Matrix6N W;                               ///< joint motion subspace, absolute frame (COM velocity)
+        Vector6 V;                                ///< link spatial velocity
+        Vector6 c;                                ///< velocity-product acceleration
+        Vector6 f_ext;                            ///< external force on link
+        Matrix6 I;                                ///< link spatial inertia
+        Matrix6 IA;                               ///< articulated-body inertia
+        Matrix6N U;                               ///< IA*S
+        MatrixNN D_inv;                           ///< inverse of S'*IA*S
+    };
+
+    /// Loop-closure constraint.
+    struct LoopClosure {
+        int link_A;                                ///< index of link A
+        int link_B;                                ///< index of link B (-1 for the ground)
+        ChFrame<> frame_A;                         ///< constraint frame, relative to link A
+        ChFrame<> frame_B;                         ///< constraint frame, relative to link B (or absolute)
+        bool mask[6];                              ///< constrained directions
+        Vector6 C;                                 ///< constraint violation (all directions)
+        ChMatrixDynamic<> Cq;                      ///< constraint Jacobian (all directions)
+        std::vector<ChConstraintNgeneric> rows;    ///< constraints (constrained directions only)
+        std::vector<double> react;                 ///< reactions (constrained directions only)
+    };
+
+    /// Calculate link poses and velocities from the current joint coordinates and velocities.
+    void UpdateKinematics();
+
+    /// Calculate the dynamics quantities at the current configuration (mass matrix, articulated inertias, etc.).
+    void UpdateDynamics();
+
+    /// Calculate the loop-closure violations and Jacobians at the current configuration.
+    void UpdateLoopClosures();
+
+    /// Recursive Newton-Euler algorithm: calculate the joint forces corresponding to the given joint accelerations.
+    /// If 'bias' is true, velocity-product terms and external forces are included.
+    void InverseDynamics(ChVectorConstRef acc, bool bias, ChVectorRef tau) const;
+
+    /// Accumulate the Jacobian of a point on the specified link (rows: angular and linear velocity, absolute frame).
+    void AddPointJacobian(int i, const ChVector3d& point, double scale, ChMatrixDynamic<>& J) const;
+
+    /// Resize the mechanism states after adding a link.
+    void ResizeStates();
+
+    /// Throw an exception if the system uses NSC contact and any link has collision enabled.
+    void CheckContactMethod() const;
+
+    std::vector<Link> m_links;                ///< mechanism links, parents before children
+    std::vector<LoopClosure> m_closures;      ///< loop-closure constraints
+    unsigned int m_nq;                        ///< number of joint coordinates
+    unsigned int m_nv;                        ///< number of joint velocities
+    unsigned int m_nc;                        ///< number of loop-closure constraint equations
+    ChVectorDynamic<> m_q;                    ///< joint coordinates
+    ChVectorDynamic<> m_v;                    ///< joint velocities
+    ChVectorDynamic<> m_a;                    ///< joint accelerations
+    ChVectorDynamic<> m_tau;                  ///< joint actuation forces
+    ChVectorDynamic<> m_bias;                 ///< generalized forces (actuation minus bias terms)
+    ChMatrixDynamic<> m_M;                    ///< joint-space mass matrix
+
+    ChVariablesArticulated m_variables;       ///< joint velocities, for the solver
+
+    friend class ChVariablesArticulated;
+};
+
+/// @} chrono_physics
+
+}  // end namespace chrono
+
+#endif
@@ -40,7 +40,10 @@ ChAssembly::ChAssembly()
       m_num_coords_vel(0),
       m_num_constr(0),
       m_num_constr_bil(0),
-      m_num_constr_uni(0) {}
+      m_num_constr_uni(0),
+      m_parallel_state_passes(false),
+      m_use_link_batch(false),
+      m_fused_state_passes(false) {}
 
 ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     m_num_bodies_active = other.m_num_bodies_active;
@@ -57,6 +60,9 @@ ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     m_num_constr = other.m_num_constr;
     m_num_constr_bil = other.m_num_constr_bil;
     m_num_constr_uni = other.m_num_constr_uni;
+    m_parallel_state_passes = other.m_parallel_state_passes;
+    m_use_link_batch = other.m_use_link_batch;
+    m_fused_state_passes = other.m_fused_state_passes;
 
     //// RADU
     //// TODO:  deep copy of the object lists (bodylist, shaftlist, linklist, meshlist,  otherphysicslist)
@@ -94,6 +100,10 @@ void swap(ChAssembly& first, ChAssembly& second) {
     swap(first.m_num_constr, second.m_num_constr);
     swap(first.m_num_constr_bil, second.m_num_constr_bil);
     swap(first.m_num_constr_uni, second.m_num_constr_uni);
+    swap(first.m_parallel_state_passes, second.m_parallel_state_passes);
+    swap(first.m_use_link_batch, second.m_use_link_batch);
+    swap(first.m_link_batch, second.m_link_batch);
+    swap(first.m_fused_state_passes, second.m_fused_state_passes);
 
     //// RADU
     //// TODO: deal with all other member variables...
@@ -137,6 +147,17 @@ void ChAssembly::AddBody(std::shared_ptr<ChBody> body) {
     system->is_updated = false;
 }
 
+void ChAssembly::AddBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    bodylist.reserve(bodylist.size() + bodies.size());
+    for (const auto& body : bodies) {
+        assert(body->GetSystem() == nullptr);  // should remove from other system before adding here
+        body->SetSystem(system);
+        bodylist.push_back(body);
+    }
+
+    system->is_updated = false;
+}
+
 void ChAssembly::RemoveBody(std::shared_ptr<ChBody> body) {
     auto itr = std::find(std::begin(bodylist), std::end(bodylist), body);
     assert(itr != bodylist.end());
@@ -174,17 +195,31 @@ void ChAssembly::AddLink(std::shared_ptr<ChLinkBase> link) {
 
     link->SetSystem(system);
     linklist.push_back(link);
+    m_link_batch.Clear();
 
     ////system->is_initialized = false;  // Not needed, unless/until ChLink::SetupInitial does something
     system->is_updated = false;
 }
 
+void ChAssembly::AddLinks(const std::vector<std::shared_ptr<ChLinkBase>>& links) {
+    linklist.reserve(linklist.size() + links.size());
+    for (const auto& link : links) {
+        assert(link->GetSystem() == nullptr || link->GetSystem() == system);
+        link->SetSystem(system);
+        linklist.push_back(link);
+    }
+    m_link_batch.Clear();
+
+    system->is_updated = false;
+}
+
 void ChAssembly::RemoveLink(std::shared_ptr<ChLinkBase> link) {
     auto itr = std::find(std::begin(linklist), std::end(linklist), link);
     assert(itr != linklist.end());
 
     linklist.erase(itr);
     link->SetSystem(nullptr);
+    m_link_batch.Clear();
 
     system->is_updated = false;
 }
@@ -322,6 +357,7 @@ void ChAssembly::RemoveAllLinks() {
         link->SetSystem(nullptr);
     }
     linklist.clear();
+    m_link_batch.Clear();
 
     if (system)
         system->is_updated = false;
@@ -602,6 +638,9 @@ void ChAssembly::Setup() {
         }
     }
 
+    if (m_use_link_batch)
+        m_link_batch.Build(linklist);
+
     for (auto& mesh : meshlist) {
         m_num_meshes++;
 
@@ -663,6 +702,14 @@ void ChAssembly::Update(bool update_assets) {
     }
     // The state of links depends on the bodylist,shaftlist,meshlist,otherphysicslist,
     // thus the update of linklist must be at the end.
+    if (UseLinkBatch()) {
+        m_link_batch.Update(ChTime, update_assets, system ? system->nthreads_chrono : 1);
+        for (unsigned int i = 0; i < linklist.size(); i++) {
+            if (!m_link_batch.IsBatched(i))
+                linklist[i]->Update(ChTime, update_assets);
+        }
+        return;
+    }
     for (auto& link : linklist) {
         link->Update(ChTime, update_assets);
     }
@@ -686,6 +733,23 @@ void ChAssembly::ForceToRest() {
     }
 }
 
+void ChAssembly::EnableLinkBatching(bool val) {
+    m_use_link_batch = val;
+    if (!val)
+        m_link_batch.Clear();
+}
+
+bool ChAssembly::UseLinkBatch() const {
+    // The batch is only used if it was built for the current link list (i.e., after a call to Setup)
+    return m_use_link_batch && m_link_batch.IsValid(linklist.size());
+}
+
+int ChAssembly::GetNumThreadsStatePasses() const {
+    if (!m_parallel_state_passes || !system)
+        return 1;
+    return system->nthreads_chrono;
+}
+
 void ChAssembly::IntStateGather(const unsigned int off_x,
                                 ChState& x,
                                 const unsigned int off_v,
@@ -694,13 +758,25 @@ void ChAssembly::IntStateGather(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
+    // Bodies and shafts only write to their own state segments, so they can be processed concurrently.
+    // The time value reported by each item is discarded (T is overwritten below).
+    int nthreads = GetNumThreadsStatePasses();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ib = 0; ib < num_bodies; ib++) {
+        auto& body = bodylist[ib];
+        double T_item;
         if (body->IsActive())
-            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T);
+            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T_item);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int is = 0; is < num_shafts; is++) {
+        auto& shaft = shaftlist[is];
+        double T_item;
         if (shaft->IsActive())
-            shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T);
+            shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T_item);
     }
     for (auto& link : linklist) {
         if (link->IsActive())
@@ -733,13 +809,23 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
+    // Bodies and shafts only read their own state segments and update their own data (including owned markers and
+    // forces), so they can be processed concurrently.
+    int nthreads = GetNumThreadsStatePasses();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ib = 0; ib < num_bodies; ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T, full_update);
         else
             body->Update(T, full_update);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int is = 0; is < num_shafts; is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntStateScatter(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T,
                                    full_update);
@@ -759,7 +845,13 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
     // must be behind of bodylist,shaftlist,meshlist,otherphysicslist; otherwise, the Update() of ChLink() would
     // use the old (un-updated) status of bodylist,shaftlist,meshlist, resulting in a delay of Update() of ChLink()
     // for one time step, then the simulation might diverge!
-    for (auto& link : linklist) {
+    bool use_batch = UseLinkBatch();
+    if (use_batch)
+        m_link_batch.Update(T, full_update, system ? system->nthreads_chrono : 1);
+    for (unsigned int i = 0; i < linklist.size(); i++) {
+        auto& link = linklist[i];
+        if (use_batch && m_link_batch.IsBatched(i))
+            continue;  // mate links without states, already updated in the batch
         if (link->IsActive())
             link->IntStateScatter(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T, full_update);
         else
@@ -941,11 +1033,22 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
 {
     unsigned int displ_v = off - this->offset_w;
 
-    for (auto& body : bodylist) {
+    // Bodies and shafts only load forces in their own residual segments, so they can be processed concurrently.
+    // Links and other items (e.g. contact containers) may add to body segments and are processed sequentially after,
+    // such that the order of the floating point additions is the same as in the sequential case.
+    int nthreads = GetNumThreadsStatePasses();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ib = 0; ib < num_bodies; ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int is = 0; is < num_shafts; is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntLoadResidual_F(displ_v + shaft->GetOffset_w(), R, c);
     }
@@ -969,11 +1072,20 @@ void ChAssembly::IntLoadResidual_Mv(const unsigned int off,      ///< offset in
 ) {
     unsigned int displ_v = off - this->offset_w;
 
-    for (auto& body : bodylist) {
+    // See IntLoadResidual_F for the rationale of the parallel loops below.
+    int nthreads = GetNumThreadsStatePasses();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ib = 0; ib < num_bodies; ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntLoadResidual_Mv(displ_v + body->GetOffset_w(), R, w, c);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int is = 0; is < num_shafts; is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntLoadResidual_Mv(displ_v + shaft->GetOffset_w(), R, w, c);
     }
@@ -1098,6 +1210,99 @@ void ChAssembly::IntLoadConstraint_Ct(const unsigned int off_L,  ///< offset in
     }
 }
 
+void ChAssembly::IntStateScatterLoadResiduals(const unsigned int off_x,
+                                              const ChState& x,
+                                              const unsigned int off_v,
+                                              const ChStateDelta& v,
+                                              const double T,
+                                              bool full_update,
+                                              const unsigned int off_L,
+                                              ChVectorDynamic<>& R,
+                                              ChVectorDynamic<>& Qc,
+                                              const ChVectorDynamic<>& w,
+                                              const ChVectorDynamic<>& L,
+                                              const double c_F,
+                                              const double c_M,
+                                              const double c_L,
+                                              const double c_C,
+                                              bool do_clamp,
+                                              double recovery_clamp) {
+    unsigned int displ_x = off_x - this->offset_x;
+    unsigned int displ_v = off_v - this->offset_w;
+    unsigned int displ_L = off_L - this->offset_L;
+
+    // Items are visited in the same order as in IntStateScatter, so that each item is updated after the items it
+    // depends on, and loads its residual terms right after its own update.
+    // Bodies and shafts carry no constraints and only load forces in their own residual segments, so they can be
+    // processed concurrently (see IntLoadResidual_F).
+    int nthreads = GetNumThreadsStatePasses();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ib = 0; ib < num_bodies; ib++) {
+        auto& body = bodylist[ib];
+        if (body->IsActive()) {
+            body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T, full_update);
+            body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c_F);
+            body->IntLoadResidual_Mv(displ_v + body->GetOffset_w(), R, w, c_M);
+        } else {
+            body->Update(T, full_update);
+        }
+    }
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int is = 0; is < num_shafts; is++) {
+        auto& shaft = shaftlist[is];
+        if (shaft->IsActive()) {
+            shaft->IntStateScatter(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T,
+                                   full_update);
+            shaft->IntLoadResidual_F(displ_v + shaft->GetOffset_w(), R, c_F);
+            shaft->IntLoadResidual_Mv(displ_v + shaft->GetOffset_w(), R, w, c_M);
+        } else {
+            shaft->Update(T, full_update);
+        }
+    }
+    for (auto& mesh : meshlist) {
+        mesh->IntStateScatter(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T, full_update);
+        mesh->IntLoadResidual_F(displ_v + mesh->GetOffset_w(), R, c_F);
+        mesh->IntLoadResidual_Mv(displ_v + mesh->GetOffset_w(), R, w, c_M);
+        mesh->IntLoadResidual_CqL(displ_L + mesh->GetOffset_L(), R, L, c_L);
+        mesh->IntLoadConstraint_C(displ_L + mesh->GetOffset_L(), Qc, c_C, do_clamp, recovery_clamp);
+    }
+    for (auto& item : otherphysicslist) {
+        if (item->IsActive()) {
+            item->IntStateScatter(displ_x + item->GetOffset_x(), x, displ_v + item->GetOffset_w(), v, T, full_update);
+            item->IntLoadResidual_F(displ_v + item->GetOffset_w(), R, c_F);
+            item->IntLoadResidual_Mv(displ_v + item->GetOffset_w(), R, w, c_M);
+            item->IntLoadResidual_CqL(displ_L + item->GetOffset_L(), R, L, c_L);
+            item->IntLoadConstraint_C(displ_L + item->GetOffset_L(), Qc, c_C, do_clamp, recovery_clamp);
+        } else {
+            item->Update(T, full_update);
+        }
+    }
+    // Links last, since their update depends on the state of the connected bodies, shafts, and mesh nodes
+    bool use_batch = UseLinkBatch();
+    if (use_batch)
+        m_link_batch.Update(T, full_update, system ? system->nthreads_chrono : 1);
+    for (unsigned int i = 0; i < linklist.size(); i++) {
+        auto& link = linklist[i];
+        bool batched = use_batch && m_link_batch.IsBatched(i);  // if so, already updated in the batch
+        if (!link->IsActive()) {
+            if (!batched)
+                link->Update(T, full_update);
+            continue;
+        }
+        if (!batched)
+            link->IntStateScatter(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T, full_update);
+        link->IntLoadResidual_F(displ_v + link->GetOffset_w(), R, c_F);
+        link->IntLoadResidual_Mv(displ_v + link->GetOffset_w(), R, w, c_M);
+        link->IntLoadResidual_CqL(displ_L + link->GetOffset_L(), R, L, c_L);
+        link->IntLoadConstraint_C(displ_L + link->GetOffset_L(), Qc, c_C, do_clamp, recovery_clamp);
+    }
+
+    SetChTime(T);
+}
+
 void ChAssembly::IntToDescriptor(const unsigned int off_v,
                                  const ChStateDelta& v,
                                  const ChVectorDynamic<>& R,
@@ -18,6 +18,7 @@
 #include <cmath>
 #include "chrono/fea/ChMesh.h"
 #include "chrono/physics/ChBodyAuxRef.h"
+#include "chrono/physics/ChLinkMateBatch.h"
 #include "chrono/physics/ChShaft.h"
 #include "chrono/physics/ChLinksAll.h"
 
@@ -51,12 +52,20 @@ class ChApi ChAssembly : public ChPhysicsItem {
     /// Attach a body to this assembly.
     void AddBody(std::shared_ptr<ChBody> body);
 
+    /// Attach the given bodies to this assembly.
+    /// Equivalent to calling AddBody for each body, but storage is reserved once for the entire set.
+    void AddBodies(const std::vector<std::shared_ptr<ChBody>>& bodies);
+
     /// Attach a shaft to this assembly.
     void AddShaft(std::shared_ptr<ChShaft> shaft);
 
     /// Attach a link to this assembly.
     void AddLink(std::shared_ptr<ChLinkBase> link);
 
+    /// Attach the given links to this assembly.
+    /// Equivalent to calling AddLink for each link, but storage is reserved once for the entire set.
+    void AddLinks(const std::vector<std::shared_ptr<ChLinkBase>>& links);
+
     /// Attach a mesh to this assembly.
     void AddMesh(std::shared_ptr<fea::ChMesh> mesh);
 
@@ -191,6 +200,43 @@ class ChApi ChAssembly : public ChPhysicsItem {
     /// Get the number of scalar unilateral constraints in the assembly.
     virtual unsigned int GetNumConstraintsUnilateral() override { return m_num_constr_uni; }
 
+    // PARALLEL EXECUTION
+
+    /// Enable/disable multithreaded execution of the state gather/scatter and residual loading passes (default: false).
+    /// If enabled, the loops over bodies and shafts in IntStateGather, IntStateScatter, IntLoadResidual_F, and
+    /// IntLoadResidual_Mv are executed in parallel, using the number of threads set through ChSystem::SetNumThreads.
+    /// Each of these items only writes to its own (disjoint) segment of the state vectors, at the offsets set in
+    /// Setup(), while all other items (links, meshes, other physics items) are still processed sequentially and in
+    /// the same order. As a result, the parallel passes produce results bit-identical to the sequential ones.
+    void EnableParallelStatePasses(bool val) { m_parallel_state_passes = val; }
+
+    /// Return true if multithreaded state gather/scatter and residual loading passes are enabled.
+    bool IsParallelStatePassesEnabled() const { return m_parallel_state_passes; }
+
+    /// Enable/disable batched updates of the mate links (default: false).
+    /// If enabled, the constraint residuals and Jacobians of all active mate links using the generic mate update
+    /// (see ChLinkMateBatch) are evaluated in a single structure-of-arrays pass, multithreaded with the number of
+    /// threads set through ChSystem::SetNumThreads. Lock-formulation revolute and spherical joints are updated in the
+    /// same multithreaded pass. All other links are updated individually. The batch is rebuilt at
+    /// each Setup. Results agree with those obtained without batching to round-off.
+    void EnableLinkBatching(bool val);
+
+    /// Return true if batched updates of the mate links are enabled.
+    bool IsLinkBatchingEnabled() const { return m_use_link_batch; }
+
+    /// Enable/disable fused state scatter and residual loading passes (default: false).
+    /// If enabled, the Newton iterations of the implicit integrators (Euler implicit and HHT) scatter the state and
+    /// load the F, M*w, Cq'*L, and C residual terms in a single traversal of the physics items, such that each item is
+    /// updated and immediately queried for its contributions, instead of a separate traversal for each term (see
+    /// IntStateScatterLoadResiduals). Items are visited in the same order as in IntStateScatter. The parallel state
+    /// passes, body store, and link batching settings also apply to the fused pass. Since the contributions of
+    /// different items are summed in a different order, results agree with those obtained with separate passes only
+    /// to round-off.
+    void EnableFusedStatePasses(bool val) { m_fused_state_passes = val; }
+
+    /// Return true if fused state scatter and residual loading passes are enabled.
+    bool IsFusedStatePassesEnabled() const { return m_fused_state_passes; }
+
     // PHYSICS ITEM INTERFACE
 
     /// Set the pointer to the parent ChSystem() and
@@ -268,6 +314,29 @@ class ChApi ChAssembly : public ChPhysicsItem {
                                      bool do_clamp,
                                      double recovery_clamp) override;
     virtual void IntLoadConstraint_Ct(const unsigned int off, ChVectorDynamic<>& Qc, const double c) override;
+
+    /// Scatter the state and load the residual terms of all items in a single traversal:
+    ///    R += c_F*F + c_M*M*w + c_L*Cq'*L
+    ///    Qc += c_C*C
+    /// Equivalent to IntStateScatter followed by IntLoadResidual_F, IntLoadResidual_Mv, IntLoadResidual_CqL, and
+    /// IntLoadConstraint_C, up to the order in which contributions are summed.
+    void IntStateScatterLoadResiduals(const unsigned int off_x,
+                                      const ChState& x,
+                                      const unsigned int off_v,
+                                      const ChStateDelta& v,
+                                      const double T,
+                                      bool full_update,
+                                      const unsigned int off_L,
+                                      ChVectorDynamic<>& R,
+                                      ChVectorDynamic<>& Qc,
+                                      const ChVectorDynamic<>& w,
+                                      const ChVectorDynamic<>& L,
+                                      const double c_F,
+                                      const double c_M,
+                                      const double c_L,
+                                      const double c_C,
+                                      bool do_clamp,
+                                      double recovery_clamp);
     virtual void IntToDescriptor(const unsigned int off_v,
                                  const ChStateDelta& v,
                                  const ChVectorDynamic<>& R,
@@ -323,6 +392,12 @@ class ChApi ChAssembly : public ChPhysicsItem {
   protected:
     virtual void SetupInitial() override;
 
+    /// Number of threads to be used in the parallel state passes (1 if these are disabled).
+    int GetNumThreadsStatePasses() const;
+
+    /// Return true if batched link updates are enabled and the batch is up-to-date with the link list.
+    bool UseLinkBatch() const;
+
     std::vector<std::shared_ptr<ChBody>> bodylist;                 ///< list of rigid bodies
     std::vector<std::shared_ptr<ChShaft>> shaftlist;               ///< list of 1-D shafts
     std::vector<std::shared_ptr<ChLinkBase>> linklist;             ///< list of joints (links)
@@ -347,6 +422,11 @@ class ChApi ChAssembly : public ChPhysicsItem {
     unsigned int m_num_constr_bil;  ///< number of scalar bilateral constraints
     unsigned int m_num_constr_uni;  ///< number of scalar unilateral constraints
 
+    bool m_parallel_state_passes;  ///< use multithreaded loops over bodies and shafts in the Int* state passes
+    bool m_use_link_batch;         ///< use batched updates of the mate links
+    ChLinkMateBatch m_link_batch;  ///< batch of mate links updated in a single pass
+    bool m_fused_state_passes;     ///< scatter state and load residuals in a single traversal
+
     friend class ChSystem;
     friend class ChSystemMulticore;
 };
@@ -563,6 +563,9 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
                                             const ChVector3d& abs_point,
                                             ChVectorDynamic<>& R) override;
 
+    /// Contact forces on a body only update the body coordinates.
+    virtual bool IsContactResidualExclusive() const override { return true; }
+
     /// Compute a contiguous vector of generalized forces Q from a given force & torque at the given point.
     /// Used for computing stiffness matrix (square force jacobian) by backward differentiation.
     /// The force and its application point are specified in the global frame.
@@ -71,7 +71,7 @@ void ChBodyAuxRef::Update(bool update_assets) {
     ChBody::Update(update_assets);
 
     // update own data
-    ref_to_abs = TransformLocalToParent(ref_to_com);
+    TransformLocalToParent<ChFrameLevel::ACCELERATION>(ref_to_com, ref_to_abs);
 }
 
 //////// FILE I/O
@@ -0,0 +1,141 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_CONTACT_ARENA_H
+#define CH_CONTACT_ARENA_H
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace chrono {
+
+/// Arena-backed storage for contact objects of a given type.
+/// Contact objects are constructed in place in blocks of contiguous memory and are never moved, so that pointers to
+/// contacts (and to the constraints and Jacobian blocks they own) remain valid and each contact has a stable index.
+/// The first size() contacts are active. Contacts beyond size() were used in previous steps and are kept, fully
+/// constructed, for reuse: Rewind() marks all contacts inactive and ReuseNext() re-activates them in order, so that
+/// the global heap is only used when the number of contacts exceeds the largest number seen so far.
+/// Iterating over the active contacts yields pointers to contact objects, in the order in which they were added.
+template <class Tcont, size_t BlockSize = 128>
+class ChContactArena {
+  public:
+    /// Forward iterator over the active contacts (dereferences to a pointer to a contact object).
+    class iterator {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Tcont* value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Tcont* const* pointer;
+        typedef Tcont* reference;
+
+        iterator(const ChContactArena* arena, size_t index) : m_arena(arena), m_index(index) {}
+
+        Tcont* operator*() const { return (*m_arena)[m_index]; }
+        iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator tmp(*this);
+            ++m_index;
+            return tmp;
+        }
+        bool operator==(const iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const iterator& other) const { return m_index != other.m_index; }
+
+      private:
+        const ChContactArena* m_arena;
+        size_t m_index;
+    };
+
+    ChContactArena() : m_size(0), m_num_constructed(0) {}
+    ~ChContactArena() { Clear(); }
+
+    ChContactArena(const ChContactArena&) = delete;
+    ChContactArena& operator=(const ChContactArena&) = delete;
+
+    /// Return the number of active contacts.
+    size_t size() const { return m_size; }
+
+    /// Return true if there are no active contacts.
+    bool empty() const { return m_size == 0; }
+
+    /// Return the number of constructed contacts (active and available for reuse).
+    size_t capacity() const { return m_num_constructed; }
+
+    /// Return the memory (in bytes) allocated by the arena for contact objects.
+    size_t GetMemoryUsage() const {
+        return m_blocks.size() * BlockSize * sizeof(Slot) + m_blocks.capacity() * sizeof(std::unique_ptr<Slot[]>);
+    }
+
+    /// Return the contact with specified index (no range check).
+    Tcont* operator[](size_t index) const {
+        return reinterpret_cast<Tcont*>(m_blocks[index / BlockSize].get() + index % BlockSize);
+    }
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, m_size); }
+
+    /// Mark all contacts as inactive, keeping them for reuse.
+    void Rewind() { m_size = 0; }
+
+    /// Re-activate the next inactive contact, if any, and return it (the caller is responsible for resetting it).
+    /// Return nullptr if all constructed contacts are active.
+    Tcont* ReuseNext() {
+        if (m_size == m_num_constructed)
+            return nullptr;
+        return (*this)[m_size++];
+    }
+
+    /// Construct a new active contact in place, with the given constructor arguments.
+    /// This function must only be called if all constructed contacts are active (i.e., ReuseNext returned nullptr).
+    template <typename... Args>
+    Tcont* Emplace(Args&&... args) {
+        assert(m_size == m_num_constructed);
+        if (m_num_constructed == m_blocks.size() * BlockSize)
+            m_blocks.push_back(std::unique_ptr<Slot[]>(new Slot[BlockSize]));
+        Tcont* contact = new ((*this)[m_num_constructed]) Tcont(std::forward<Args>(args)...);
+        m_num_constructed++;
+        m_size++;
+        return contact;
+    }
+
+    /// Destroy all contacts and release the arena memory.
+    void Clear() {
+        for (size_t i = 0; i < m_num_constructed; i++)
+            (*this)[i]->~Tcont();
+        m_blocks.clear();
+        m_size = 0;
+        m_num_constructed = 0;
+    }
+
+  private:
+    /// Raw, suitably aligned storage for one contact object.
+    struct Slot {
+        alignas(Tcont) unsigned char bytes[sizeof(Tcont)];
+    };
+
+    std::vector<std::unique_ptr<Slot[]>> m_blocks;  ///< memory blocks, each holding BlockSize contacts
+    size_t m_size;                                  ///< number of active contacts
+    size_t m_num_constructed;                       ///< number of constructed contacts
+};
+
+}  // end namespace chrono
+
+#endif
@@ -15,9 +15,13 @@
 #ifndef CH_CONTACTCONTAINER_NSC_H
 #define CH_CONTACTCONTAINER_NSC_H
 
-#include <list>
+#include <deque>
+#include <unordered_map>
+#include <vector>
 
+#include "chrono/physics/ChContactArena.h"
 #include "chrono/physics/ChContactContainer.h"
+#include "chrono/physics/ChContactMaterialTable.h"
 #include "chrono/physics/ChContactNSC.h"
 #include "chrono/physics/ChContactNSCrolling.h"
 #include "chrono/physics/ChContactable.h"
@@ -25,9 +29,9 @@
 namespace chrono {
 
 /// Class representing a container of many non-smooth contacts.
-/// Implemented using linked lists of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
-/// reactions). It might also contain ChContactNSCrolling objects (extended versions of ChContactNSC, with 6 reactions,
-/// that account also for rolling and spinning resistance), but also for '6dof vs 6dof' contactables.
+/// Implemented using arenas (see ChContactArena) of ChContactNSC objects (that is, contacts between two ChContactable
+/// objects, with 3 reactions). It might also contain ChContactNSCrolling objects (extended versions of ChContactNSC,
+/// with 6 reactions, that account also for rolling and spinning resistance), but also for '6dof vs 6dof' contactables.
 class ChApi ChContactContainerNSC : public ChContactContainer {
   public:
     typedef ChContactNSC<ChContactable_1vars<6>, ChContactable_1vars<6> > ChContactNSC_6_6;
@@ -53,21 +57,26 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
     /// Report the number of added contacts.
     virtual unsigned int GetNumContacts() const override {
-        return n_added_3_3 + n_added_6_3 + n_added_6_6 + n_added_333_3 + n_added_333_6 + n_added_333_333 +
-               n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666 + n_added_6_6_rolling;
+        return GetNumContactsSliding() + (unsigned int)contactlist_6_6_rolling.size();
     }
 
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() override;
 
+    /// Return the memory (in bytes) allocated for contact objects (including contacts kept for reuse), for the
+    /// warm start caches, and for the material-pair table.
+    virtual size_t GetMemoryUsage() const override;
+
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
-    /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
-    /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
+    /// similar). Instead of simply deleting all the previous contacts, this optimized implementation rewinds the
+    /// contact arenas and tries to reuse previous contact objects until possible, to avoid too much
     /// allocation/deallocation.
     virtual void BeginAddContact() override;
 
     /// Add a contact between two collision shapes, storing it into this container.
-    /// A compositecontact material is created from the two given materials.
+    /// A composite contact material is created from the two given materials. Composite materials are cached per
+    /// material pair (see ChContactMaterialTable), so that the composition strategy is invoked only once per pair and
+    /// step.
     /// In this case, the collision info object may have null pointers to collision shapes.
     virtual void AddContact(const ChCollisionInfo& cinfo,
                             std::shared_ptr<ChContactMaterial> mat1,
@@ -79,7 +88,7 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     virtual void AddContact(const ChCollisionInfo& cinfo) override;
 
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// similar). Contacts that were not reused (if any) are kept in the contact arenas for reuse in subsequent steps.
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
@@ -119,14 +128,58 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// Report the number of scalar unilateral constraints.
     /// Note: friction constraints aren't exactly unilaterals, but they are still counted.
     virtual unsigned int GetNumConstraintsUnilateral() override {
-        return 3 * (n_added_3_3 + n_added_6_3 + n_added_6_6 + n_added_333_3 + n_added_333_6 + n_added_333_333 +
-                    n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666) +
-               6 * (n_added_6_6_rolling);
+        return 3 * GetNumContactsSliding() + 6 * (unsigned int)contactlist_6_6_rolling.size();
     }
 
     /// Objects will rebounce only if their relative colliding speed is above this threshold.
     double GetMinBounceSpeed() const { return min_bounce_speed; }
 
+    /// Enable persistent contact identity for warm starting the contact multipliers (default: false).
+    /// If enabled, contacts are matched across steps by the pair of collision shapes and the location of the contact
+    /// point on the first shape (expressed in the frame of its collision model). A newly added contact that matches a
+    /// contact from the previous step is initialized with the normal, tangential, and rolling reactions of that
+    /// contact, scaled by the warm start decay factor. Contacts for which the collision system already provides a
+    /// persistent reaction cache (see ChCollisionInfo::reaction_cache) are not affected.
+    /// Note that these initial reactions are used only by iterative solvers with warm start enabled (see
+    /// ChIterativeSolver::EnableWarmStart).
+    void EnableWarmStart(bool val) { m_warm_start = val; }
+
+    /// Return true if warm starting of contact multipliers is enabled.
+    bool IsWarmStartEnabled() const { return m_warm_start; }
+
+    /// Set the factor used to scale the reactions carried over from the previous step (default: 1).
+    /// Values in [0,1] are expected; a value of 0 effectively disables warm starting.
+    void SetWarmStartDecay(double decay) { m_warm_start_decay = decay; }
+
+    /// Get the factor used to scale the reactions carried over from the previous step.
+    double GetWarmStartDecay() const { return m_warm_start_decay; }
+
+    /// Set the maximum distance between the current and previous contact points for a contact to be matched with one
+    /// from the previous step (default: 0.01).
+    void SetWarmStartTolerance(double tol) { m_warm_start_tol = tol; }
+
+    /// Get the maximum distance for matching contacts across steps.
+    double GetWarmStartTolerance() const { return m_warm_start_tol; }
+
+    /// Persistent contact point of the warm start cache.
+    /// The two shapes are identified by their collision shape (or by their collision model, if the collision system
+    /// does not report shapes). The contact point is expressed in the frame of the collision model of the first shape.
+    struct WarmStartEntry {
+        const void* shapeA;  ///< first collision shape (or model)
+        const void* shapeB;  ///< second collision shape (or model)
+        ChVector3d pos;      ///< contact point on shape A, in the frame of collision model A
+        float reactions[6];  ///< reactions at the end of the last step
+    };
+
+    /// Export the persistent contact points of the last step, with their current reactions (e.g., for checkpoints).
+    /// Empty if warm starting is disabled.
+    std::vector<WarmStartEntry> ExportWarmStartCache() const;
+
+    /// Replace the persistent contact points of the last step with the given ones (e.g., from a checkpoint).
+    /// These are matched with the contacts added at the next step, as if they were added during the last step. All
+    /// current contacts are removed (contacts are re-detected at the next step). No-op if warm starting is disabled.
+    void ImportWarmStartCache(const std::vector<WarmStartEntry>& entries);
+
     /// Update state of this contact container: compute jacobians, violations, etc.
     /// and store results in inner structures of contacts.
     virtual void Update(double mtime, bool update_assets = true) override;
@@ -182,51 +235,79 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   protected:
-    std::list<ChContactNSC_6_6*> contactlist_6_6;
-    std::list<ChContactNSC_6_3*> contactlist_6_3;
-    std::list<ChContactNSC_3_3*> contactlist_3_3;
-    std::list<ChContactNSC_333_3*> contactlist_333_3;
-    std::list<ChContactNSC_333_6*> contactlist_333_6;
-    std::list<ChContactNSC_333_333*> contactlist_333_333;
-    std::list<ChContactNSC_666_3*> contactlist_666_3;
-    std::list<ChContactNSC_666_6*> contactlist_666_6;
-    std::list<ChContactNSC_666_333*> contactlist_666_333;
-    std::list<ChContactNSC_666_666*> contactlist_666_666;
-
-    std::list<ChContactNSCrolling_6_6*> contactlist_6_6_rolling;
-
-    int n_added_6_6;
-    int n_added_6_3;
-    int n_added_3_3;
-    int n_added_333_3;
-    int n_added_333_6;
-    int n_added_333_333;
-    int n_added_666_3;
-    int n_added_666_6;
-    int n_added_666_333;
-    int n_added_666_666;
-    int n_added_6_6_rolling;
-
-    std::list<ChContactNSC_6_6*>::iterator lastcontact_6_6;
-    std::list<ChContactNSC_6_3*>::iterator lastcontact_6_3;
-    std::list<ChContactNSC_3_3*>::iterator lastcontact_3_3;
-    std::list<ChContactNSC_333_3*>::iterator lastcontact_333_3;
-    std::list<ChContactNSC_333_6*>::iterator lastcontact_333_6;
-    std::list<ChContactNSC_333_333*>::iterator lastcontact_333_333;
-    std::list<ChContactNSC_666_3*>::iterator lastcontact_666_3;
-    std::list<ChContactNSC_666_6*>::iterator lastcontact_666_6;
-    std::list<ChContactNSC_666_333*>::iterator lastcontact_666_333;
-    std::list<ChContactNSC_666_666*>::iterator lastcontact_666_666;
-
-    std::list<ChContactNSCrolling_6_6*>::iterator lastcontact_6_6_rolling;
+    ChContactArena<ChContactNSC_6_6> contactlist_6_6;
+    ChContactArena<ChContactNSC_6_3> contactlist_6_3;
+    ChContactArena<ChContactNSC_3_3> contactlist_3_3;
+    ChContactArena<ChContactNSC_333_3> contactlist_333_3;
+    ChContactArena<ChContactNSC_333_6> contactlist_333_6;
+    ChContactArena<ChContactNSC_333_333> contactlist_333_333;
+    ChContactArena<ChContactNSC_666_3> contactlist_666_3;
+    ChContactArena<ChContactNSC_666_6> contactlist_666_6;
+    ChContactArena<ChContactNSC_666_333> contactlist_666_333;
+    ChContactArena<ChContactNSC_666_666> contactlist_666_666;
+
+    ChContactArena<ChContactNSCrolling_6_6> contactlist_6_6_rolling;
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
   private:
-    void InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeNSC& cmat);
+    /// Return the number of contacts without rolling and spinning resistance.
+    unsigned int GetNumContactsSliding() const {
+        return (unsigned int)(contactlist_3_3.size() + contactlist_6_3.size() + contactlist_6_6.size() +
+                              contactlist_333_3.size() + contactlist_333_6.size() + contactlist_333_333.size() +
+                              contactlist_666_3.size() + contactlist_666_6.size() + contactlist_666_333.size() +
+                              contactlist_666_666.size());
+    }
+
+    /// Identity of a contact between two collision shapes.
+    struct WarmStartKey {
+        const void* shapeA;
+        const void* shapeB;
+        bool operator==(const WarmStartKey& other) const {
+            return shapeA == other.shapeA && shapeB == other.shapeB;
+        }
+    };
+
+    struct WarmStartKeyHash {
+        size_t operator()(const WarmStartKey& key) const {
+            size_t h = std::hash<const void*>()(key.shapeA);
+            return h ^ (std::hash<const void*>()(key.shapeB) + 0x9e3779b9 + (h << 6) + (h >> 2));
+        }
+    };
+
+    /// Persistent contact point, used as reaction cache (N,U,V and rolling reactions) by the contact objects.
+    struct WarmStartPoint {
+        ChVector3d pos;      ///< contact point on shape A, in the frame of collision model A
+        float reactions[6];  ///< cached reactions
+        bool matched;        ///< already matched with a contact in the following step
+    };
+
+    /// Storage for the persistent contact points added during one step.
+    struct WarmStartCache {
+        std::deque<WarmStartPoint> points;  ///< deque guarantees stable addresses of the cached reactions
+        std::unordered_map<WarmStartKey, std::vector<size_t>, WarmStartKeyHash> pairs;
+        void Clear() {
+            points.clear();
+            pairs.clear();
+        }
+    };
+
+    void InsertContact(const ChCollisionInfo& cinfo_in, const ChContactMaterialCompositeNSC& cmat);
+
+    /// Find or create the persistent reaction cache for the given collision pair.
+    float* GetWarmStartCache(const ChCollisionInfo& cinfo);
 
     double min_bounce_speed;  ///< minimum speed for rebounce after impacts. Lower speeds are clamped to 0
 
+    bool m_warm_start;               ///< enable persistent contacts for warm starting
+    double m_warm_start_decay;       ///< scaling of reactions carried over from previous step
+    double m_warm_start_tol;         ///< tolerance for matching contact points across steps
+    WarmStartCache m_ws_cache;       ///< persistent contacts for current step
+    WarmStartCache m_ws_cache_prev;  ///< persistent contacts from previous step
+
+    /// Composite materials for the material pairs encountered during the current step.
+    ChContactMaterialTable<ChContactMaterialNSC, ChContactMaterialCompositeNSC> m_material_table;
+
     friend class ChSystemNSC;
 };
 
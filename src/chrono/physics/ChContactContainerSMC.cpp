@@ -14,35 +14,18 @@
 
 #include "chrono/physics/ChContactContainerSMC.h"
 #include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChOpenMP.h"
 
 namespace chrono {
 
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChContactContainerSMC)
 
-ChContactContainerSMC::ChContactContainerSMC()
-    : n_added_3_3(0),
-      n_added_6_3(0),
-      n_added_6_6(0),
-      n_added_333_3(0),
-      n_added_333_6(0),
-      n_added_333_333(0),
-      n_added_666_3(0),
-      n_added_666_6(0),
-      n_added_666_333(0),
-      n_added_666_666(0) {}
+ChContactContainerSMC::ChContactContainerSMC() : m_parallel_forces(false), m_defer_forces(false) {}
 
 ChContactContainerSMC::ChContactContainerSMC(const ChContactContainerSMC& other) : ChContactContainer(other) {
-    n_added_3_3 = 0;
-    n_added_6_3 = 0;
-    n_added_6_6 = 0;
-    n_added_333_3 = 0;
-    n_added_333_6 = 0;
-    n_added_333_333 = 0;
-    n_added_666_3 = 0;
-    n_added_666_6 = 0;
-    n_added_666_333 = 0;
-    n_added_666_666 = 0;
+    m_parallel_forces = other.m_parallel_forces;
+    m_defer_forces = false;
 }
 
 ChContactContainerSMC::~ChContactContainerSMC() {
@@ -54,138 +37,98 @@ void ChContactContainerSMC::Update(double mytime, bool update_assets) {
     ChContactContainer::Update(mytime, update_assets);
 }
 
-template <class Tcont, class Titer>
-void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int& n_added) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        delete (*itercontact);
-        (*itercontact) = 0;
-        ++itercontact;
-    }
-    contactlist.clear();
-    lastcontact = contactlist.begin();
-    n_added = 0;
-}
-
 void ChContactContainerSMC::RemoveAllContacts() {
-    _RemoveAllContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3);
-    _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3);
-    _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6);
-    _RemoveAllContacts(contactlist_333_3, lastcontact_333_3, n_added_333_3);
-    _RemoveAllContacts(contactlist_333_6, lastcontact_333_6, n_added_333_6);
-    _RemoveAllContacts(contactlist_333_333, lastcontact_333_333, n_added_333_333);
-    _RemoveAllContacts(contactlist_666_3, lastcontact_666_3, n_added_666_3);
-    _RemoveAllContacts(contactlist_666_6, lastcontact_666_6, n_added_666_6);
-    _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
-    _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
+    contactlist_3_3.Clear();
+    contactlist_6_3.Clear();
+    contactlist_6_6.Clear();
+    contactlist_333_3.Clear();
+    contactlist_333_6.Clear();
+    contactlist_333_333.Clear();
+    contactlist_666_3.Clear();
+    contactlist_666_6.Clear();
+    contactlist_666_333.Clear();
+    contactlist_666_666.Clear();
     //**TODO*** cont. roll.
 }
 
-void ChContactContainerSMC::BeginAddContact() {
-    lastcontact_3_3 = contactlist_3_3.begin();
-    n_added_3_3 = 0;
-
-    lastcontact_6_3 = contactlist_6_3.begin();
-    n_added_6_3 = 0;
-
-    lastcontact_6_6 = contactlist_6_6.begin();
-    n_added_6_6 = 0;
-
-    lastcontact_333_3 = contactlist_333_3.begin();
-    n_added_333_3 = 0;
-
-    lastcontact_333_6 = contactlist_333_6.begin();
-    n_added_333_6 = 0;
-
-    lastcontact_333_333 = contactlist_333_333.begin();
-    n_added_333_333 = 0;
+size_t ChContactContainerSMC::GetMemoryUsage() const {
+    size_t mem = contactlist_3_3.GetMemoryUsage() + contactlist_6_3.GetMemoryUsage() +
+                 contactlist_6_6.GetMemoryUsage() + contactlist_333_3.GetMemoryUsage() +
+                 contactlist_333_6.GetMemoryUsage() + contactlist_333_333.GetMemoryUsage() +
+                 contactlist_666_3.GetMemoryUsage() + contactlist_666_6.GetMemoryUsage() +
+                 contactlist_666_333.GetMemoryUsage() + contactlist_666_666.GetMemoryUsage();
 
-    lastcontact_666_3 = contactlist_666_3.begin();
-    n_added_666_3 = 0;
+    mem += m_loads.capacity() * sizeof(ContactLoad);
+    mem += (m_load_group.capacity() + m_group_start.capacity() + m_group_loads.capacity()) * sizeof(int);
+    mem += m_group_index.size() * (sizeof(ChContactable*) + sizeof(int));
 
-    lastcontact_666_6 = contactlist_666_6.begin();
-    n_added_666_6 = 0;
+    mem += m_material_table.GetMemoryUsage();
 
-    lastcontact_666_333 = contactlist_666_333.begin();
-    n_added_666_333 = 0;
+    return mem;
+}
 
-    lastcontact_666_666 = contactlist_666_666.begin();
-    n_added_666_666 = 0;
+void ChContactContainerSMC::BeginAddContact() {
+    contactlist_3_3.Rewind();
+    contactlist_6_3.Rewind();
+    contactlist_6_6.Rewind();
+    contactlist_333_3.Rewind();
+    contactlist_333_6.Rewind();
+    contactlist_333_333.Rewind();
+    contactlist_666_3.Rewind();
+    contactlist_666_6.Rewind();
+    contactlist_666_333.Rewind();
+    contactlist_666_666.Rewind();
+
+    // Material properties or the composition strategy may have changed since the last step
+    m_material_table.Reset();
+
+    m_defer_forces = m_parallel_forces;
+}
 
-    // lastcontact_roll = contactlist_roll.begin();
-    // n_added_roll = 0;
+template <class Tcont>
+void _EvaluateContacts(ChContactArena<Tcont>& contactlist, int nthreads) {
+    // Each contact only modifies its own data, so no synchronization is needed.
+    int num_contacts = (int)contactlist.size();
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1 && num_contacts > 1)
+    for (int i = 0; i < num_contacts; i++)
+        contactlist[i]->Evaluate();
 }
 
 void ChContactContainerSMC::EndAddContact() {
-    // remove contacts that are beyond last contact
-    while (lastcontact_3_3 != contactlist_3_3.end()) {
-        delete (*lastcontact_3_3);
-        lastcontact_3_3 = contactlist_3_3.erase(lastcontact_3_3);
-    }
-    while (lastcontact_6_3 != contactlist_6_3.end()) {
-        delete (*lastcontact_6_3);
-        lastcontact_6_3 = contactlist_6_3.erase(lastcontact_6_3);
-    }
-    while (lastcontact_6_6 != contactlist_6_6.end()) {
-        delete (*lastcontact_6_6);
-        lastcontact_6_6 = contactlist_6_6.erase(lastcontact_6_6);
-    }
-    while (lastcontact_333_3 != contactlist_333_3.end()) {
-        delete (*lastcontact_333_3);
-        lastcontact_333_3 = contactlist_333_3.erase(lastcontact_333_3);
-    }
-    while (lastcontact_333_6 != contactlist_333_6.end()) {
-        delete (*lastcontact_333_6);
-        lastcontact_333_6 = contactlist_333_6.erase(lastcontact_333_6);
-    }
-    while (lastcontact_333_333 != contactlist_333_333.end()) {
-        delete (*lastcontact_333_333);
-        lastcontact_333_333 = contactlist_333_333.erase(lastcontact_333_333);
-    }
-    while (lastcontact_666_3 != contactlist_666_3.end()) {
-        delete (*lastcontact_666_3);
-        lastcontact_666_3 = contactlist_666_3.erase(lastcontact_666_3);
-    }
-    while (lastcontact_666_6 != contactlist_666_6.end()) {
-        delete (*lastcontact_666_6);
-        lastcontact_666_6 = contactlist_666_6.erase(lastcontact_666_6);
+    // Contacts that were not reused are kept in the arenas for subsequent steps.
+    // Calculate contact forces deferred in AddContact.
+    if (m_defer_forces) {
+        int nthreads = GetNumThreadsForces();
+        _EvaluateContacts(contactlist_3_3, nthreads);
+        _EvaluateContacts(contactlist_6_3, nthreads);
+        _EvaluateContacts(contactlist_6_6, nthreads);
+        _EvaluateContacts(contactlist_333_3, nthreads);
+        _EvaluateContacts(contactlist_333_6, nthreads);
+        _EvaluateContacts(contactlist_333_333, nthreads);
+        _EvaluateContacts(contactlist_666_3, nthreads);
+        _EvaluateContacts(contactlist_666_6, nthreads);
+        _EvaluateContacts(contactlist_666_333, nthreads);
+        _EvaluateContacts(contactlist_666_666, nthreads);
     }
-    while (lastcontact_666_333 != contactlist_666_333.end()) {
-        delete (*lastcontact_666_333);
-        lastcontact_666_333 = contactlist_666_333.erase(lastcontact_666_333);
-    }
-    while (lastcontact_666_666 != contactlist_666_666.end()) {
-        delete (*lastcontact_666_666);
-        lastcontact_666_666 = contactlist_666_666.erase(lastcontact_666_666);
-    }
-
-    // while (lastcontact_roll != contactlist_roll.end()) {
-    //    delete (*lastcontact_roll);
-    //    lastcontact_roll = contactlist_roll.erase(lastcontact_roll);
-    //}
+    m_defer_forces = false;
 }
 
-template <class Tcont, class Titer, class Ta, class Tb>
-void _OptimalContactInsert(std::list<Tcont*>& contactlist,            // contact list
-                           Titer& lastcontact,                        // last contact acquired
-                           int& n_added,                              // number of contacts inserted
-                           ChContactContainerSMC* container,          // contact container
-                           Ta* objA,                                  // collidable object A
-                           Tb* objB,                                  // collidable object B
-                           const ChCollisionInfo& cinfo,              // collision information
-                           const ChContactMaterialCompositeSMC& cmat  // composite material
+template <class Tcont, class Ta, class Tb>
+void _OptimalContactInsert(ChContactArena<Tcont>& contactlist,         // contact arena
+                           ChContactContainerSMC* container,           // contact container
+                           Ta* objA,                                   // collidable object A
+                           Tb* objB,                                   // collidable object B
+                           const ChCollisionInfo& cinfo,               // collision information
+                           const ChContactMaterialCompositeSMC& cmat,  // composite material
+                           bool evaluate                               // calculate contact force now
 ) {
-    if (lastcontact != contactlist.end()) {
+    if (Tcont* mc = contactlist.ReuseNext()) {
         // reuse old contacts
-        (*lastcontact)->Reset(objA, objB, cinfo, cmat);
-        lastcontact++;
+        mc->Reset(objA, objB, cinfo, cmat, evaluate);
     } else {
         // add new contact
-        Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat);
-        contactlist.push_back(mc);
-        lastcontact = contactlist.end();
+        contactlist.Emplace(container, objA, objB, cinfo, cmat, evaluate);
     }
-    n_added++;
 }
 
 void ChContactContainerSMC::AddContact(const ChCollisionInfo& cinfo,
@@ -210,10 +153,9 @@ void ChContactContainerSMC::AddContact(const ChCollisionInfo& cinfo,
         return;
     }
 
-    // Create the composite material
-    ChContactMaterialCompositeSMC cmat(GetSystem()->composition_strategy.get(),
-                                       std::static_pointer_cast<ChContactMaterialSMC>(mat1),
-                                       std::static_pointer_cast<ChContactMaterialSMC>(mat2));
+    // Get the composite material from the material-pair table
+    ChContactMaterialCompositeSMC cmat =
+        m_material_table.GetComposite(GetSystem()->composition_strategy.get(), mat1, mat2);
 
     InsertContact(cinfo, cmat);
 }
@@ -239,10 +181,9 @@ void ChContactContainerSMC::AddContact(const ChCollisionInfo& cinfo) {
         return;
     }
 
-    // Create the composite material
-    ChContactMaterialCompositeSMC cmat(GetSystem()->composition_strategy.get(),
-                                       std::static_pointer_cast<ChContactMaterialSMC>(cinfo.shapeA->GetMaterial()),
-                                       std::static_pointer_cast<ChContactMaterialSMC>(cinfo.shapeB->GetMaterial()));
+    // Get the composite material from the material-pair table
+    ChContactMaterialCompositeSMC cmat = m_material_table.GetComposite(
+        GetSystem()->composition_strategy.get(), cinfo.shapeA->GetMaterial(), cinfo.shapeB->GetMaterial());
 
     // Check for a user-provided callback to modify the material
     if (GetAddContactCallback()) {
@@ -256,6 +197,9 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
     auto contactableA = cinfo.modelA->GetContactable();
     auto contactableB = cinfo.modelB->GetContactable();
 
+    // With parallel force evaluation, contact forces are calculated for all contacts in EndAddContact
+    bool evaluate = !m_defer_forces;
+
     // CREATE THE CONTACTS
     //
     // Switch among the various cases of contacts: i.e. between a 6-dof variable and another 6-dof variable,
@@ -273,25 +217,22 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 3_3
-                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_3_3, this, objA, objB, cinfo, cmat, evaluate);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 3_6 -> 6_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA, swapped_cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_6_3, this, objB, objA, swapped_cinfo, cmat, evaluate);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 3_333 -> 333_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_3, this, objB, objA, swapped_cinfo, cmat, evaluate);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 3_666 -> 666_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_3, this, objB, objA, swapped_cinfo, cmat, evaluate);
             }
         } break;
 
@@ -300,23 +241,21 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 6_3
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_3, this, objA, objB, cinfo, cmat, evaluate);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 6_6
-                _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_6, this, objA, objB, cinfo, cmat, evaluate);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 6_333 -> 333_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_6, this, objB, objA, swapped_cinfo, cmat, evaluate);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 6_666 -> 666_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_6, this, objB, objA, swapped_cinfo, cmat, evaluate);
             }
         } break;
 
@@ -325,24 +264,20 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 333_3
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_333_3, this, objA, objB, cinfo, cmat, evaluate);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 333_6
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_333_6, this, objA, objB, cinfo, cmat, evaluate);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 333_333
-                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_333, this, objA, objB, cinfo, cmat, evaluate);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 333_666 -> 666_333
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, this, objB, objA, swapped_cinfo, cmat, evaluate);
             }
         } break;
 
@@ -351,23 +286,19 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 666_3
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_666_3, this, objA, objB, cinfo, cmat, evaluate);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 666_6
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_666_6, this, objA, objB, cinfo, cmat, evaluate);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 666_333
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, this, objA, objB, cinfo, cmat, evaluate);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 666_666
-                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_666, this, objA, objB, cinfo, cmat, evaluate);
             }
         } break;
 
@@ -409,8 +340,8 @@ ChVector3d ChContactContainerSMC::GetContactableTorque(ChContactable* contactabl
 }
 
 template <class Tcont>
-void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContacts(ChContactArena<Tcont>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -438,53 +369,160 @@ void ChContactContainerSMC::ReportAllContacts(std::shared_ptr<ReportContactCallb
 
 // STATE INTERFACE
 
+int ChContactContainerSMC::GetNumThreadsForces() const {
+    if (!m_parallel_forces || !GetSystem())
+        return 1;
+    return (int)GetSystem()->GetNumThreadsChrono();
+}
+
 template <class Tcont>
-void _IntLoadResidual_F(std::list<Tcont*>& contactlist, ChVectorDynamic<>& R, const double c) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _IntLoadResidual_F(ChContactArena<Tcont>& contactlist, ChVectorDynamic<>& R, const double c) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntLoadResidual_F(R, c);
         ++itercontact;
     }
 }
 
+template <class Tcont, class Tload>
+void _GatherContactLoads(ChContactArena<Tcont>& contactlist, const double c, Tload* loads, int nthreads) {
+    // Each contact produces two loads: the force on objA, followed by the reaction force on objB
+    int num_contacts = (int)contactlist.size();
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = 0; i < num_contacts; i++) {
+        auto contact = contactlist[i];
+        ChVector3d abs_force_scaled(contact->GetContactForceAbs() * c);
+        ChVector3d abs_torque_scaled(contact->GetContactTorqueAbs() * c);
+
+        Tload& loadA = loads[2 * i];
+        loadA.obj = contact->GetObjA()->IsContactActive() ? contact->GetObjA() : nullptr;
+        loadA.force = -abs_force_scaled;
+        loadA.torque = -abs_torque_scaled;
+        loadA.point = contact->GetContactP1();
+
+        Tload& loadB = loads[2 * i + 1];
+        loadB.obj = contact->GetObjB()->IsContactActive() ? contact->GetObjB() : nullptr;
+        loadB.force = abs_force_scaled;
+        loadB.torque = abs_torque_scaled;
+        loadB.point = contact->GetContactP2();
+    }
+}
+
 void ChContactContainerSMC::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
-    _IntLoadResidual_F(contactlist_3_3, R, c);
-    _IntLoadResidual_F(contactlist_6_3, R, c);
-    _IntLoadResidual_F(contactlist_6_6, R, c);
-    _IntLoadResidual_F(contactlist_333_3, R, c);
-    _IntLoadResidual_F(contactlist_333_6, R, c);
-    _IntLoadResidual_F(contactlist_333_333, R, c);
-    _IntLoadResidual_F(contactlist_666_3, R, c);
-    _IntLoadResidual_F(contactlist_666_6, R, c);
-    _IntLoadResidual_F(contactlist_666_333, R, c);
-    _IntLoadResidual_F(contactlist_666_666, R, c);
+    int nthreads = GetNumThreadsForces();
+
+    if (nthreads <= 1 || GetNumContacts() == 0) {
+        _IntLoadResidual_F(contactlist_3_3, R, c);
+        _IntLoadResidual_F(contactlist_6_3, R, c);
+        _IntLoadResidual_F(contactlist_6_6, R, c);
+        _IntLoadResidual_F(contactlist_333_3, R, c);
+        _IntLoadResidual_F(contactlist_333_6, R, c);
+        _IntLoadResidual_F(contactlist_333_333, R, c);
+        _IntLoadResidual_F(contactlist_666_3, R, c);
+        _IntLoadResidual_F(contactlist_666_6, R, c);
+        _IntLoadResidual_F(contactlist_666_333, R, c);
+        _IntLoadResidual_F(contactlist_666_666, R, c);
+        return;
+    }
+
+    // Collect the scaled contact forces, in the same order in which they are loaded sequentially
+    int num_loads = 2 * (int)GetNumContacts();
+    m_loads.resize(num_loads);
+    ContactLoad* loads = m_loads.data();
+    _GatherContactLoads(contactlist_3_3, c, loads, nthreads);
+    loads += 2 * contactlist_3_3.size();
+    _GatherContactLoads(contactlist_6_3, c, loads, nthreads);
+    loads += 2 * contactlist_6_3.size();
+    _GatherContactLoads(contactlist_6_6, c, loads, nthreads);
+    loads += 2 * contactlist_6_6.size();
+    _GatherContactLoads(contactlist_333_3, c, loads, nthreads);
+    loads += 2 * contactlist_333_3.size();
+    _GatherContactLoads(contactlist_333_6, c, loads, nthreads);
+    loads += 2 * contactlist_333_6.size();
+    _GatherContactLoads(contactlist_333_333, c, loads, nthreads);
+    loads += 2 * contactlist_333_333.size();
+    _GatherContactLoads(contactlist_666_3, c, loads, nthreads);
+    loads += 2 * contactlist_666_3.size();
+    _GatherContactLoads(contactlist_666_6, c, loads, nthreads);
+    loads += 2 * contactlist_666_6.size();
+    _GatherContactLoads(contactlist_666_333, c, loads, nthreads);
+    loads += 2 * contactlist_666_333.size();
+    _GatherContactLoads(contactlist_666_666, c, loads, nthreads);
+
+    // Group the loads on objects which exclusively own their residual entries, one group per object (numbered in order
+    // of first encounter), preserving the contact order within each group
+    m_load_group.resize(num_loads);
+    m_group_index.clear();
+    for (int i = 0; i < num_loads; i++) {
+        ChContactable* obj = m_loads[i].obj;
+        if (obj && obj->IsContactResidualExclusive())
+            m_load_group[i] = m_group_index.emplace(obj, (int)m_group_index.size()).first->second;
+        else
+            m_load_group[i] = -1;
+    }
+
+    int num_groups = (int)m_group_index.size();
+    m_group_start.assign(num_groups + 1, 0);
+    for (int i = 0; i < num_loads; i++) {
+        if (m_load_group[i] >= 0)
+            m_group_start[m_load_group[i] + 1]++;
+    }
+    for (int g = 0; g < num_groups; g++)
+        m_group_start[g + 1] += m_group_start[g];
+
+    m_group_loads.resize(m_group_start[num_groups]);
+    for (int i = 0; i < num_loads; i++) {
+        int g = m_load_group[i];
+        if (g >= 0)
+            m_group_loads[m_group_start[g]++] = i;
+    }
+    for (int g = num_groups; g > 0; g--)
+        m_group_start[g] = m_group_start[g - 1];
+    m_group_start[0] = 0;
+
+    // Different groups update disjoint residual entries, so they can be loaded concurrently
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthreads)
+    for (int g = 0; g < num_groups; g++) {
+        for (int k = m_group_start[g]; k < m_group_start[g + 1]; k++) {
+            const ContactLoad& load = m_loads[m_group_loads[k]];
+            load.obj->ContactForceLoadResidual_F(load.force, load.torque, load.point, R);
+        }
+    }
+
+    // Loads on objects sharing residual entries with other objects (e.g., FEA contact surfaces) are loaded sequentially
+    for (int i = 0; i < num_loads; i++) {
+        const ContactLoad& load = m_loads[i];
+        if (load.obj && m_load_group[i] < 0)
+            load.obj->ContactForceLoadResidual_F(load.force, load.torque, load.point, R);
+    }
 }
 
 template <class Tcont>
-void _KRMmatricesLoad(std::list<Tcont*> contactlist, double Kfactor, double Rfactor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContKRMmatricesLoad(Kfactor, Rfactor);
-        ++itercontact;
-    }
+void _KRMmatricesLoad(ChContactArena<Tcont>& contactlist, double Kfactor, double Rfactor, int nthreads) {
+    // Each contact only modifies its own KRM block, so contacts can be processed concurrently.
+    int num_contacts = (int)contactlist.size();
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1 && num_contacts > 1)
+    for (int i = 0; i < num_contacts; i++)
+        contactlist[i]->ContKRMmatricesLoad(Kfactor, Rfactor);
 }
 
 void ChContactContainerSMC::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
-    _KRMmatricesLoad(contactlist_3_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_6_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_6_6, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_333_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_333_6, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_333_333, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_6, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_333, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_666, Kfactor, Rfactor);
+    int nthreads = GetNumThreadsForces();
+    _KRMmatricesLoad(contactlist_3_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_6_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_6_6, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_333_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_333_6, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_333_333, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_6, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_333, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_666, Kfactor, Rfactor, nthreads);
 }
 
 template <class Tcont>
-void _InjectKRMmatrices(std::list<Tcont*> contactlist, ChSystemDescriptor& descriptor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _InjectKRMmatrices(ChContactArena<Tcont>& contactlist, ChSystemDescriptor& descriptor) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContInjectKRMmatrices(descriptor);
         ++itercontact;
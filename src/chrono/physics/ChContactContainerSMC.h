@@ -17,16 +17,19 @@
 
 #include <algorithm>
 #include <cmath>
-#include <list>
+#include <vector>
 
+#include "chrono/physics/ChContactArena.h"
 #include "chrono/physics/ChContactContainer.h"
+#include "chrono/physics/ChContactMaterialTable.h"
 #include "chrono/physics/ChContactSMC.h"
 #include "chrono/physics/ChContactable.h"
 
 namespace chrono {
 
 /// Class representing a container of many smooth (penalty) contacts.
-/// Implemented using linked lists of ChContactSMC objects (that is, contacts between two ChContactable objects).
+/// Implemented using arenas of ChContactSMC objects (that is, contacts between two ChContactable objects), one for each
+/// combination of contactable types. See ChContactArena.
 class ChApi ChContactContainerSMC : public ChContactContainer {
   public:
     typedef ChContactSMC<ChContactable_1vars<3>, ChContactable_1vars<3> > ChContactSMC_3_3;
@@ -41,38 +44,36 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     typedef ChContactSMC<ChContactable_3vars<6, 6, 6>, ChContactable_3vars<6, 6, 6> > ChContactSMC_666_666;
 
   protected:
-    std::list<ChContactSMC_3_3*> contactlist_3_3;
-    std::list<ChContactSMC_6_3*> contactlist_6_3;
-    std::list<ChContactSMC_6_6*> contactlist_6_6;
-    std::list<ChContactSMC_333_3*> contactlist_333_3;
-    std::list<ChContactSMC_333_6*> contactlist_333_6;
-    std::list<ChContactSMC_333_333*> contactlist_333_333;
-    std::list<ChContactSMC_666_3*> contactlist_666_3;
-    std::list<ChContactSMC_666_6*> contactlist_666_6;
-    std::list<ChContactSMC_666_333*> contactlist_666_333;
-    std::list<ChContactSMC_666_666*> contactlist_666_666;
-
-    int n_added_3_3;
-    int n_added_6_3;
-    int n_added_6_6;
-    int n_added_333_3;
-    int n_added_333_6;
-    int n_added_333_333;
-    int n_added_666_3;
-    int n_added_666_6;
-    int n_added_666_333;
-    int n_added_666_666;
-
-    std::list<ChContactSMC_3_3*>::iterator lastcontact_3_3;
-    std::list<ChContactSMC_6_3*>::iterator lastcontact_6_3;
-    std::list<ChContactSMC_6_6*>::iterator lastcontact_6_6;
-    std::list<ChContactSMC_333_3*>::iterator lastcontact_333_3;
-    std::list<ChContactSMC_333_6*>::iterator lastcontact_333_6;
-    std::list<ChContactSMC_333_333*>::iterator lastcontact_333_333;
-    std::list<ChContactSMC_666_3*>::iterator lastcontact_666_3;
-    std::list<ChContactSMC_666_6*>::iterator lastcontact_666_6;
-    std::list<ChContactSMC_666_333*>::iterator lastcontact_666_333;
-    std::list<ChContactSMC_666_666*>::iterator lastcontact_666_666;
+    ChContactArena<ChContactSMC_3_3> contactlist_3_3;
+    ChContactArena<ChContactSMC_6_3> contactlist_6_3;
+    ChContactArena<ChContactSMC_6_6> contactlist_6_6;
+    ChContactArena<ChContactSMC_333_3> contactlist_333_3;
+    ChContactArena<ChContactSMC_333_6> contactlist_333_6;
+    ChContactArena<ChContactSMC_333_333> contactlist_333_333;
+    ChContactArena<ChContactSMC_666_3> contactlist_666_3;
+    ChContactArena<ChContactSMC_666_6> contactlist_666_6;
+    ChContactArena<ChContactSMC_666_333> contactlist_666_333;
+    ChContactArena<ChContactSMC_666_666> contactlist_666_666;
+
+    /// Scaled contact force on one of the two objects of a contact, to be loaded into the residual.
+    struct ContactLoad {
+        ChContactable* obj;  ///< object acted upon (nullptr if contact-inactive)
+        ChVector3d force;    ///< force, in absolute frame
+        ChVector3d torque;   ///< torque, in absolute frame
+        ChVector3d point;    ///< application point, in absolute frame
+    };
+
+    bool m_parallel_forces;  ///< use multithreaded contact force evaluation and loading
+    bool m_defer_forces;     ///< defer force evaluation of added contacts to EndAddContact
+
+    std::vector<ContactLoad> m_loads;                       ///< contact loads (on objA, then objB, for each contact)
+    std::vector<int> m_load_group;                          ///< group of each load (-1 if loaded sequentially)
+    std::vector<int> m_group_start;                         ///< start of each group in m_group_loads
+    std::vector<int> m_group_loads;                         ///< load indices, grouped by object, in contact order
+    std::unordered_map<ChContactable*, int> m_group_index;  ///< group index of each object
+
+    /// Composite materials for the material pairs encountered during the current step.
+    ChContactMaterialTable<ChContactMaterialSMC, ChContactMaterialCompositeSMC> m_material_table;
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
@@ -86,21 +87,44 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
 
     /// Report the number of added contacts.
     virtual unsigned int GetNumContacts() const override {
-        return n_added_3_3 + n_added_6_3 + n_added_6_6 + n_added_333_3 + n_added_333_6 + n_added_333_333 +
-               n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666;
+        return (unsigned int)(contactlist_3_3.size() + contactlist_6_3.size() + contactlist_6_6.size() +
+                              contactlist_333_3.size() + contactlist_333_6.size() + contactlist_333_333.size() +
+                              contactlist_666_3.size() + contactlist_666_6.size() + contactlist_666_333.size() +
+                              contactlist_666_666.size());
     }
 
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() override;
 
+    /// Return the memory (in bytes) allocated for contact objects (including contacts kept for reuse), for the
+    /// contact loads used in multithreaded residual loading, and for the material-pair table.
+    virtual size_t GetMemoryUsage() const override;
+
+    /// Enable/disable multithreaded evaluation of contact forces (default: false).
+    /// If enabled, the force (and Jacobian) calculation for new contacts is deferred from AddContact() to
+    /// EndAddContact() and performed concurrently, using the number of Chrono threads set for the containing system
+    /// (see ChSystem::SetNumThreads). Loading of contact forces into the residual and of contact Jacobians is also
+    /// multithreaded. Contact forces are grouped by the object they act upon and the groups are loaded concurrently,
+    /// each in contact order; forces on objects which share residual entries with other objects (see
+    /// ChContactable::IsContactResidualExclusive) are loaded sequentially. As such, each residual entry is updated in
+    /// the same order as with sequential loading and the results do not depend on the number of threads.
+    /// Note that a user-provided contact force algorithm (see ChSystemSMC::SetContactForceTorqueAlgorithm) must be
+    /// thread-safe if this option is enabled.
+    void EnableParallelForces(bool val) { m_parallel_forces = val; }
+
+    /// Return true if multithreaded evaluation of contact forces is enabled.
+    bool IsParallelForcesEnabled() const { return m_parallel_forces; }
+
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
-    /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
-    /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
+    /// similar). Instead of simply deleting all the previous contacts, this optimized implementation rewinds the
+    /// contact arenas and tries to reuse previous contact objects until possible, to avoid too much
     /// allocation/deallocation.
     virtual void BeginAddContact() override;
 
     /// Add a contact between two collision shapes, storing it into this container.
-    /// A compositecontact material is created from the two given materials.
+    /// A composite contact material is created from the two given materials. Composite materials are cached per
+    /// material pair (see ChContactMaterialTable), so that the composition strategy is invoked only once per pair and
+    /// step.
     /// In this case, the collision info object may have null pointers to collision shapes.
     virtual void AddContact(const ChCollisionInfo& cinfo,
                             std::shared_ptr<ChContactMaterial> mat1,
@@ -112,7 +136,9 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     virtual void AddContact(const ChCollisionInfo& cinfo) override;
 
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// similar). Contacts that were not reused (if any) are kept in the contact arenas for reuse in subsequent steps.
+    /// If parallel force evaluation is enabled, contact forces are calculated here. Forces of contacts added after this
+    /// call (e.g., from a custom collision callback) are calculated immediately.
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
@@ -153,6 +179,7 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
 
   private:
     void InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeSMC& cmat);
+    int GetNumThreadsForces() const;
 };
 
 CH_CLASS_VERSION(ChContactContainerSMC, 0)
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 
 #include "chrono/physics/ChContactMaterial.h"
@@ -29,9 +30,14 @@ CH_FACTORY_REGISTER(ChContactMaterialCompositionStrategy);
 // -----------------------------------------------------------------------------
 
 ChContactMaterial::ChContactMaterial()
-    : static_friction(0.6f), sliding_friction(0.6f), rolling_friction(0), spinning_friction(0), restitution(0.4f) {}
-
-ChContactMaterial::ChContactMaterial(const ChContactMaterial& other) {
+    : static_friction(0.6f),
+      sliding_friction(0.6f),
+      rolling_friction(0),
+      spinning_friction(0),
+      restitution(0.4f),
+      m_id(-1) {}
+
+ChContactMaterial::ChContactMaterial(const ChContactMaterial& other) : m_id(-1) {
     static_friction = other.static_friction;
     sliding_friction = other.sliding_friction;
     rolling_friction = other.rolling_friction;
@@ -44,6 +50,12 @@ void ChContactMaterial::SetFriction(float val) {
     SetSlidingFriction(val);
 }
 
+void ChContactMaterial::AssignId() {
+    static std::atomic<int> next_id(0);
+    if (m_id < 0)
+        m_id = next_id++;
+}
+
 void ChContactMaterial::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChContactMaterial>();
@@ -90,6 +90,15 @@ class ChApi ChContactMaterial {
     /// Construct and return a contact material of the specified type with default properties.
     static std::shared_ptr<ChContactMaterial> DefaultMaterial(ChContactMethod contact_method);
 
+    /// Return the material identifier (-1 if not yet assigned).
+    /// Identifiers are unique during a program run and are assigned when the material is attached to a collision
+    /// shape. They are used to index precomputed properties of material pairs (see ChContactMaterialTable).
+    /// A copy of a material does not inherit the identifier of the original.
+    int GetId() const { return m_id; }
+
+    /// Assign a unique identifier to this material, if not already assigned.
+    void AssignId();
+
     // Properties common to both NSC and SMC materials
     float static_friction;    ///< static coefficient of friction
     float sliding_friction;   ///< sliding coefficient of friction
@@ -100,6 +109,8 @@ class ChApi ChContactMaterial {
   protected:
     ChContactMaterial();
     ChContactMaterial(const ChContactMaterial& other);
+
+    int m_id;  ///< material identifier (-1 if not assigned)
 };
 
 CH_CLASS_VERSION(ChContactMaterial, 0)
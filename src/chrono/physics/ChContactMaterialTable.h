@@ -0,0 +1,110 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_CONTACT_MATERIAL_TABLE_H
+#define CH_CONTACT_MATERIAL_TABLE_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/physics/ChContactMaterial.h"
+
+namespace chrono {
+
+/// Table of composite contact materials, indexed by pairs of material identifiers.
+/// The composite material for a given (ordered) pair of materials is calculated with the composition strategy the
+/// first time that pair is encountered after a call to Reset(); subsequent look-ups for the same pair return the
+/// stored composite. Contact containers reset the table at the beginning of each collision step, so that changes to
+/// material properties or to the composition strategy between steps are picked up.
+/// Materials are mapped to table slots in the order in which they are encountered. Pairs involving a material without
+/// an identifier (see ChContactMaterial::GetId) or a material beyond the table capacity are composed directly.
+template <class Tmat, class Tcomposite>
+class ChContactMaterialTable {
+  public:
+    /// Construct a table for up to the specified number of distinct materials per step.
+    ChContactMaterialTable(int max_materials = 64) : m_max_materials(max_materials), m_num_slots(0) {}
+
+    /// Invalidate all stored composite materials and material slots.
+    void Reset() {
+        for (auto i : m_used_entries)
+            m_entries[i] = -1;
+        for (auto id : m_used_ids)
+            m_slots[id] = -1;
+        m_used_entries.clear();
+        m_used_ids.clear();
+        m_composites.clear();
+        m_num_slots = 0;
+    }
+
+    /// Return the composite material for the given pair of materials.
+    Tcomposite GetComposite(ChContactMaterialCompositionStrategy* strategy,
+                            const std::shared_ptr<ChContactMaterial>& mat1,
+                            const std::shared_ptr<ChContactMaterial>& mat2) {
+        int slot1 = GetSlot(mat1->GetId());
+        int slot2 = GetSlot(mat2->GetId());
+        if (slot1 < 0 || slot2 < 0)
+            return Tcomposite(strategy, std::static_pointer_cast<Tmat>(mat1), std::static_pointer_cast<Tmat>(mat2));
+
+        if (m_entries.empty())
+            m_entries.resize(m_max_materials * m_max_materials, -1);
+
+        int entry = slot1 * m_max_materials + slot2;
+        if (m_entries[entry] < 0) {
+            m_entries[entry] = (int)m_composites.size();
+            m_used_entries.push_back(entry);
+            m_composites.emplace_back(strategy, std::static_pointer_cast<Tmat>(mat1),
+                                      std::static_pointer_cast<Tmat>(mat2));
+        }
+
+        return m_composites[m_entries[entry]];
+    }
+
+    /// Return the number of composite materials currently stored.
+    size_t GetNumComposites() const { return m_composites.size(); }
+
+    /// Return the memory (in bytes) allocated for the table.
+    size_t GetMemoryUsage() const {
+        return (m_entries.capacity() + m_slots.capacity() + m_used_entries.capacity() + m_used_ids.capacity()) *
+                   sizeof(int) +
+               m_composites.capacity() * sizeof(Tcomposite);
+    }
+
+  private:
+    /// Return the table slot for the material with given identifier, assigning one if needed (-1 if not possible).
+    int GetSlot(int id) {
+        if (id < 0)
+            return -1;
+        if (id >= (int)m_slots.size())
+            m_slots.resize(id + 1, -1);
+        if (m_slots[id] < 0) {
+            if (m_num_slots == m_max_materials)
+                return -1;
+            m_slots[id] = m_num_slots++;
+            m_used_ids.push_back(id);
+        }
+        return m_slots[id];
+    }
+
+    int m_max_materials;                   ///< maximum number of material slots
+    int m_num_slots;                       ///< number of currently assigned material slots
+    std::vector<int> m_slots;              ///< material identifier -> table slot
+    std::vector<int> m_entries;            ///< slot pair -> index in composite list
+    std::vector<int> m_used_ids;           ///< material identifiers with an assigned slot
+    std::vector<int> m_used_entries;       ///< table entries currently in use
+    std::vector<Tcomposite> m_composites;  ///< stored composite materials
+};
+
+}  // end namespace chrono
+
+#endif
@@ -35,7 +35,7 @@ class ChContactNSC : public ChContactTuple<Ta, Tb> {
     typedef typename ChContactTuple<Ta, Tb>::typecarr_b typecarr_b;
 
   protected:
-    float* reactions_cache;  ///< N,U,V reactions which might be stored in a persistent contact manifold
+    float* reactions_cache;  ///< N,U,V (and rolling) reactions which might be stored in a persistent contact manifold
 
     /// The three scalar constraints, to be fed into the system solver.
     /// They contain jacobians data and special functions.
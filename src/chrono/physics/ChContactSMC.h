@@ -41,7 +41,8 @@ class ChDefaultContactForceTorqueSMC : public ChSystemSMC::ChContactForceTorqueS
   public:
     /// Default SMC force calculation algorithm.
     /// This implementation depends on various settings specified at the ChSystemSMC level (such as normal force model,
-    /// tangential force model, use of material physical properties, etc).
+    /// tangential force model, use of material physical properties, etc). The force is evaluated with the kernel that
+    /// ChSystemSMC specialized for the current settings (see ChSystemSMC::GetContactForceKernel).
     virtual ChWrenchd CalculateForceTorque(
         const ChSystemSMC& sys,                    ///< containing system
         const ChVector3d& normal_dir,              ///< normal contact direction (expressed in global frame)
@@ -62,162 +63,9 @@ class ChDefaultContactForceTorqueSMC : public ChSystemSMC::ChContactForceTorqueS
             return {VNULL, VNULL};
         }
 
-        // Extract parameters from containing system
-        double dT = sys.GetStep();
-        bool use_mat_props = sys.UsingMaterialProperties();
-        ChSystemSMC::ContactForceModel contact_model = sys.GetContactForceModel();
-        ChSystemSMC::AdhesionForceModel adhesion_model = sys.GetAdhesionForceModel();
-        ChSystemSMC::TangentialDisplacementModel tdispl_model = sys.GetTangentialDisplacementModel();
-
-        // Relative velocity at contact
-        ChVector3d relvel = vel2 - vel1;
-        double relvel_n_mag = relvel.Dot(normal_dir);
-        ChVector3d relvel_n = relvel_n_mag * normal_dir;
-        ChVector3d relvel_t = relvel - relvel_n;
-        double relvel_t_mag = relvel_t.Length();
-
-        // Calculate effective mass
-        double eff_mass = mass1 * mass2 / (mass1 + mass2);
-
-        // Calculate stiffness and viscous damping coefficients.
-        // All models use the following formulas for normal and tangential forces:
-        //     Fn = kn * delta_n - gn * v_n
-        //     Ft = kt * delta_t - gt * v_t
-        double kn = 0;
-        double kt = 0;
-        double gn = 0;
-        double gt = 0;
-
-        constexpr double eps = std::numeric_limits<double>::epsilon();
-
-        switch (contact_model) {
-            case ChSystemSMC::Flores:
-                // Currently not implemented.  Fall through to Hooke.
-            case ChSystemSMC::Hooke:
-                if (use_mat_props) {
-                    double tmp_k = (16.0 / 15) * std::sqrt(eff_radius) * mat.E_eff;
-                    double v2 = sys.GetCharacteristicImpactVelocity() * sys.GetCharacteristicImpactVelocity();
-                    double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
-                    loge = (mat.cr_eff > 1 - eps) ? std::log(1 - eps) : loge;
-                    double tmp_g = 1 + std::pow(CH_PI / loge, 2);
-                    kn = tmp_k * std::pow(eff_mass * v2 / tmp_k, 1.0 / 5);
-                    kt = kn;
-                    gn = std::sqrt(4 * eff_mass * kn / tmp_g);
-                    gt = gn;
-                } else {
-                    kn = mat.kn;
-                    kt = mat.kt;
-                    gn = eff_mass * mat.gn;
-                    gt = eff_mass * mat.gt;
-                }
-
-                break;
-
-            case ChSystemSMC::Hertz:
-                if (use_mat_props) {
-                    double sqrt_Rd = std::sqrt(eff_radius * delta);
-                    double Sn = 2 * mat.E_eff * sqrt_Rd;
-                    double St = 8 * mat.G_eff * sqrt_Rd;
-                    double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
-                    double beta = loge / std::sqrt(loge * loge + CH_PI * CH_PI);
-                    kn = (2.0 / 3) * Sn;
-                    kt = St;
-                    gn = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(Sn * eff_mass);
-                    gt = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(St * eff_mass);
-                } else {
-                    double tmp = eff_radius * std::sqrt(delta);
-                    kn = tmp * mat.kn;
-                    kt = tmp * mat.kt;
-                    gn = tmp * eff_mass * mat.gn;
-                    gt = tmp * eff_mass * mat.gt;
-                }
-
-                break;
-
-            case ChSystemSMC::PlainCoulomb:
-                if (use_mat_props) {
-                    double sqrt_Rd = std::sqrt(delta);
-                    double Sn = 2 * mat.E_eff * sqrt_Rd;
-                    double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
-                    double beta = loge / std::sqrt(loge * loge + CH_PI * CH_PI);
-                    kn = (2.0 / 3) * Sn;
-                    gn = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(Sn * eff_mass);
-                } else {
-                    double tmp = std::sqrt(delta);
-                    kn = tmp * mat.kn;
-                    gn = tmp * mat.gn;
-                }
-
-                kt = 0;
-                gt = 0;
-
-                {
-                    double forceN = kn * delta - gn * relvel_n_mag;
-                    if (forceN < 0)
-                        forceN = 0;
-                    double forceT = mat.mu_eff * std::tanh(5.0 * relvel_t_mag) * forceN;
-                    switch (adhesion_model) {
-                        case ChSystemSMC::AdhesionForceModel::Perko:
-                            // Currently not implemented.  Fall through to Constant.
-                        case ChSystemSMC::AdhesionForceModel::Constant:
-                            forceN -= mat.adhesion_eff;
-                            break;
-                        case ChSystemSMC::AdhesionForceModel::DMT:
-                            forceN -= mat.adhesionMultDMT_eff * sqrt(eff_radius);
-                            break;
-                    }
-                    ChVector3d force = forceN * normal_dir;
-                    if (relvel_t_mag >= sys.GetSlipVelocityThreshold())
-                        force -= (forceT / relvel_t_mag) * relvel_t;
-
-                    return {force, VNULL};  // zero torque anyway
-                }
-        }
-
-        // Tangential displacement (magnitude)
-        double delta_t = 0;
-        switch (tdispl_model) {
-            case ChSystemSMC::OneStep:
-                delta_t = relvel_t_mag * dT;
-                break;
-            case ChSystemSMC::MultiStep:
-                //// TODO: implement proper MultiStep mode
-                delta_t = relvel_t_mag * dT;
-                break;
-            default:
-                break;
-        }
-
-        // Calculate the magnitudes of the normal and tangential contact forces
-        double forceN = kn * delta - gn * relvel_n_mag;
-        double forceT = kt * delta_t + gt * relvel_t_mag;
-
-        // If the resulting normal contact force is negative, the two shapes are moving
-        // away from each other so fast that no contact force is generated.
-        if (forceN < 0) {
-            forceN = 0;
-            forceT = 0;
-        }
-
-        // Include adhesion force
-        switch (adhesion_model) {
-            case ChSystemSMC::AdhesionForceModel::Perko:
-                // Currently not implemented.  Fall through to Constant.
-            case ChSystemSMC::AdhesionForceModel::Constant:
-                forceN -= mat.adhesion_eff;
-                break;
-            case ChSystemSMC::AdhesionForceModel::DMT:
-                forceN -= mat.adhesionMultDMT_eff * sqrt(eff_radius);
-                break;
-        }
-
-        // Coulomb law
-        forceT = std::min<double>(forceT, mat.mu_eff * std::abs(forceN));
-
-        // Accumulate normal and tangential forces
-        ChVector3d force = forceN * normal_dir;
-        if (relvel_t_mag >= sys.GetSlipVelocityThreshold())
-            force -= (forceT / relvel_t_mag) * relvel_t;
+        // Use the force kernel specialized for the current model settings
+        auto kernel = sys.GetContactForceKernel();
+        ChVector3d force = kernel(sys, normal_dir, vel2 - vel1, mat, delta, eff_radius, mass1, mass2);
 
         return {force, VNULL};  // zero torque anyway
     }
@@ -238,9 +86,10 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         ChMatrixDynamic<double> m_R;  ///< R = dQ/dv
     };
 
-    ChVector3d m_force;        ///< contact force on objB
-    ChVector3d m_torque;       ///< contact torque on objB
-    ChContactJacobian* m_Jac;  ///< contact Jacobian data
+    ChVector3d m_force;                   ///< contact force on objB
+    ChVector3d m_torque;                  ///< contact torque on objB
+    ChContactJacobian* m_Jac;             ///< contact Jacobian data
+    ChContactMaterialCompositeSMC m_mat;  ///< composite material for contact pair
 
   public:
     ChContactSMC() : m_Jac(NULL) {}
@@ -248,11 +97,12 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
     ChContactSMC(ChContactContainer* contact_container,    ///< contact container
                  Ta* obj_A,                                ///< contactable object A
                  Tb* obj_B,                                ///< contactable object B
-                 const ChCollisionInfo& cinfo,             ///< data for the collision pair
-                 const ChContactMaterialCompositeSMC& mat  ///< composite material
+                 const ChCollisionInfo& cinfo,              ///< data for the collision pair
+                 const ChContactMaterialCompositeSMC& mat,  ///< composite material
+                 bool evaluate = true                       ///< if false, defer force calculation to Evaluate()
                  )
         : ChContactTuple<Ta, Tb>(contact_container, obj_A, obj_B), m_Jac(NULL) {
-        Reset(obj_A, obj_B, cinfo, mat);
+        Reset(obj_A, obj_B, cinfo, mat, evaluate);
     }
 
     ~ChContactSMC() { delete m_Jac; }
@@ -278,10 +128,13 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
     const ChMatrixDynamic<double>* GetJacobianR() const { return m_Jac ? &(m_Jac->m_R) : NULL; }
 
     /// Reinitialize this contact for reuse.
-    void Reset(Ta* obj_A,                                ///< contactable object A
-               Tb* obj_B,                                ///< contactable object B
-               const ChCollisionInfo& cinfo,             ///< data for the collision pair
-               const ChContactMaterialCompositeSMC& mat  ///< composite material
+    /// If evaluate = false, only the contact geometry and material are updated and the contact force (and Jacobians)
+    /// must be calculated with a subsequent call to Evaluate().
+    void Reset(Ta* obj_A,                                 ///< contactable object A
+               Tb* obj_B,                                 ///< contactable object B
+               const ChCollisionInfo& cinfo,              ///< data for the collision pair
+               const ChContactMaterialCompositeSMC& mat,  ///< composite material
+               bool evaluate = true                       ///< calculate contact force
     ) {
         // Reset geometric information
         this->Reset_cinfo(obj_A, obj_B, cinfo);
@@ -289,13 +142,24 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         // Note: cinfo.distance is the same as this->norm_dist.
         assert(cinfo.distance < 0);
 
+        m_mat = mat;
+
+        if (evaluate)
+            Evaluate();
+    }
+
+    /// Calculate the contact force and, if using stiff contact, the Jacobian matrices, for the current contact geometry
+    /// and composite material.
+    /// This function only modifies data owned by this contact and can be called concurrently for different contacts,
+    /// provided the contact force algorithm of the containing system is thread-safe.
+    void Evaluate() {
         // Calculate contact force.
         auto wrench =
             CalculateForceTorque(-this->norm_dist,                            // overlap (here, always positive)
                                  this->normal,                                // normal contact direction
                                  this->objA->GetContactPointSpeed(this->p1),  // velocity of contact point on objA
                                  this->objB->GetContactPointSpeed(this->p2),  // velocity of contact point on objB
-                                 mat                                          // composite material for contact pair
+                                 m_mat                                        // composite material for contact pair
             );
         m_force = wrench.force;
         m_torque = wrench.torque;
@@ -303,7 +167,7 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         // Set up and compute Jacobian matrices.
         if (static_cast<ChSystemSMC*>(this->container->GetSystem())->IsContactStiff()) {
             CreateJacobians();
-            CalculateJacobians(mat);
+            CalculateJacobians(m_mat);
         }
     }
 
@@ -379,10 +243,11 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
     }
 
     /// Create the Jacobian matrices.
-    /// These matrices are created/resized as needed.
+    /// These matrices are created/resized as needed. When a contact object is reused, its existing Jacobian storage
+    /// is also reused (no reallocation if the number of DOFs is unchanged).
     void CreateJacobians() {
-        delete m_Jac;
-        m_Jac = new ChContactJacobian;
+        if (!m_Jac)
+            m_Jac = new ChContactJacobian;
 
         // Set variables and resize Jacobian matrices.
         // NOTE: currently, only contactable objects derived from ChContactable_1vars<6>,
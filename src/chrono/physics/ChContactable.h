@@ -90,6 +90,12 @@ class ChApi ChContactable {
                                             ChVectorDynamic<>& R          ///< global generalized force vector
                                             ) = 0;
 
+    /// Indicate whether the entries of the global generalized force vector updated by ContactForceLoadResidual_F are
+    /// updated by this object only (e.g., the coordinates of a rigid body), so that contact forces on different such
+    /// objects can be loaded concurrently. Objects sharing entries with other contactables (e.g., the faces of an FEA
+    /// contact surface, which share mesh nodes) must return false (default).
+    virtual bool IsContactResidualExclusive() const { return false; }
+
     /// Compute a contiguous vector of generalized forces Q from a given force & torque at the given point.
     /// Used for computing stiffness matrix (square force jacobian) by backward differentiation.
     /// The force  F and its application point are specified in the global frame.
@@ -14,17 +14,33 @@
 
 #include <cstdlib>
 #include <algorithm>
+#include <stdexcept>
 
 #include "chrono/physics/ChConveyor.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono/collision/ChCollisionSystem.h"
+#include "chrono/collision/ChCollisionShapeBox.h"
 
 namespace chrono {
 
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChConveyor)
 
-ChConveyor::ChConveyor(double xlength, double ythick, double zwidth) : conveyor_speed(1) {
+// Custom collision callback generating the analytical belt-part contacts
+class ChConveyor::AnalyticalContactCallback : public ChSystem::CustomCollisionCallback {
+  public:
+    AnalyticalContactCallback(ChConveyor* conveyor) : m_conveyor(conveyor) {}
+    virtual void OnCustomCollision(ChSystem* sys) override {
+        if (m_conveyor->analytical_contact)
+            m_conveyor->AddAnalyticalContacts(sys->GetContactContainer().get());
+    }
+
+  private:
+    ChConveyor* m_conveyor;
+};
+
+ChConveyor::ChConveyor(double xlength, double ythick, double zwidth)
+    : conveyor_speed(1), analytical_contact(false) {
     conveyor_truss = new ChBody;
     conveyor_plate = new ChBody;
 
@@ -47,6 +63,8 @@ ChConveyor::ChConveyor(double xlength, double ythick, double zwidth) : conveyor_
 
 ChConveyor::ChConveyor(const ChConveyor& other) : ChPhysicsItem(other) {
     conveyor_speed = other.conveyor_speed;
+    analytical_contact = other.analytical_contact;
+    parts = other.parts;
     internal_link = other.internal_link->Clone();
     conveyor_plate = other.conveyor_plate->Clone();
     conveyor_truss = other.conveyor_truss->Clone();
@@ -55,6 +73,8 @@ ChConveyor::ChConveyor(const ChConveyor& other) : ChPhysicsItem(other) {
 }
 
 ChConveyor::~ChConveyor() {
+    if (system && collision_callback)
+        system->UnregisterCustomCollisionCallback(collision_callback);
     if (internal_link)
         delete internal_link;
     if (conveyor_plate)
@@ -252,6 +272,14 @@ void ChConveyor::ConstraintsFetch_react(double factor) {
 }
 
 void ChConveyor::SetSystem(ChSystem* m_system) {
+    if (system && collision_callback)
+        system->UnregisterCustomCollisionCallback(collision_callback);
+    if (m_system) {
+        if (!collision_callback)
+            collision_callback = chrono_types::make_shared<AnalyticalContactCallback>(this);
+        m_system->RegisterCustomCollisionCallback(collision_callback);
+    }
+
     system = m_system;
     conveyor_truss->SetSystem(m_system);
     conveyor_plate->SetSystem(m_system);
@@ -294,7 +322,8 @@ void ChConveyor::AddCollisionModelsToSystem(ChCollisionSystem* coll_sys) const {
     if (conveyor_truss->GetCollisionModel())
         coll_sys->Add(conveyor_truss->GetCollisionModel());
 
-    if (conveyor_plate->GetCollisionModel())
+    // With analytical contact, the belt plate is not processed by the collision system
+    if (conveyor_plate->GetCollisionModel() && !analytical_contact)
         coll_sys->Add(conveyor_plate->GetCollisionModel());
 }
 
@@ -314,6 +343,103 @@ void ChConveyor::SyncCollisionModels() {
     conveyor_plate->SyncCollisionModels();
 }
 
+// ANALYTICAL CONTACT
+
+void ChConveyor::EnableAnalyticalContact(bool val) {
+    if (val == analytical_contact)
+        return;
+    analytical_contact = val;
+
+    // If already processed by a collision system, move the belt plate out of (or back into) the collision system
+    auto coll_sys = system ? system->GetCollisionSystem() : nullptr;
+    auto plate_model = conveyor_plate->GetCollisionModel();
+    if (coll_sys && plate_model) {
+        if (analytical_contact)
+            coll_sys->Remove(plate_model);
+        else
+            coll_sys->Add(plate_model);
+    }
+}
+
+void ChConveyor::AddPart(std::shared_ptr<ChBody> part, const std::vector<ChVector3d>& points, double radius) {
+    if (!part->GetCollisionModel() || part->GetCollisionModel()->GetNumShapes() == 0)
+        throw std::invalid_argument("ChConveyor::AddPart: the part must have a collision model");
+
+    Part p;
+    p.body = part;
+    p.points = points;
+    p.radius = radius;
+    p.bound = 0;
+    for (const auto& point : points)
+        p.bound = std::max(p.bound, point.Length());
+    p.bound += radius;
+
+    parts.push_back(p);
+}
+
+void ChConveyor::AddBoxPart(std::shared_ptr<ChBody> part, const ChVector3d& lengths) {
+    ChVector3d hlen = lengths / 2;
+    std::vector<ChVector3d> corners;
+    for (int ix = -1; ix <= 1; ix += 2)
+        for (int iy = -1; iy <= 1; iy += 2)
+            for (int iz = -1; iz <= 1; iz += 2)
+                corners.push_back(ChVector3d(ix * hlen.x(), iy * hlen.y(), iz * hlen.z()));
+    AddPart(part, corners, 0);
+}
+
+void ChConveyor::AddAnalyticalContacts(ChContactContainer* container) {
+    auto plate_model = conveyor_plate->GetCollisionModel();
+    if (!plate_model || plate_model->GetNumShapes() == 0)
+        return;
+    auto plate_shape = std::dynamic_pointer_cast<ChCollisionShapeBox>(plate_model->GetShapeInstance(0).first);
+    if (!plate_shape)
+        return;
+
+    // The upper surface of the belt is the plate face with normal along the Y axis of the plate frame
+    const ChVector3d& hlen = plate_shape->GetHalflengths();
+    const ChFrameMoving<>& plate_frame = conveyor_plate->GetFrameRefToAbs();
+    ChVector3d normal = plate_frame.GetRotMat().GetAxisY();
+
+    ChCollisionInfo cinfo;
+    cinfo.modelA = plate_model.get();
+    cinfo.shapeA = plate_shape.get();
+    cinfo.vN = normal;
+
+    for (const auto& part : parts) {
+        const auto& part_model = part.body->GetCollisionModel();
+        if (!part.body->IsCollisionEnabled())
+            continue;
+
+        double envelope = plate_model->GetEnvelope() + part_model->GetEnvelope();
+        const ChFrameMoving<>& part_frame = part.body->GetFrameRefToAbs();
+
+        // Quick rejection test, using a bounding sphere of the part
+        ChVector3d center = plate_frame.TransformPointParentToLocal(part_frame.GetPos());
+        if (center.y() - part.bound > hlen.y() + envelope || std::abs(center.x()) - part.bound > hlen.x() ||
+            std::abs(center.z()) - part.bound > hlen.z())
+            continue;
+
+        cinfo.modelB = part_model.get();
+        cinfo.shapeB = part_model->GetShapeInstance(0).first.get();
+        cinfo.eff_radius = part.radius > 0 ? part.radius : ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
+
+        for (const auto& point : part.points) {
+            ChVector3d pos = part_frame.TransformPointLocalToParent(point);
+            ChVector3d loc = plate_frame.TransformPointParentToLocal(pos);
+            if (std::abs(loc.x()) > hlen.x() || std::abs(loc.z()) > hlen.z() || loc.y() < -hlen.y())
+                continue;
+            double distance = loc.y() - hlen.y() - part.radius;
+            if (distance > envelope)
+                continue;
+
+            cinfo.vpA = plate_frame.TransformPointLocalToParent(ChVector3d(loc.x(), hlen.y(), loc.z()));
+            cinfo.vpB = pos - normal * part.radius;
+            cinfo.distance = distance;
+            container->AddContact(cinfo);
+        }
+    }
+}
+
 // FILE I/O
 
 void ChConveyor::ArchiveOut(ChArchiveOut& archive_out) {
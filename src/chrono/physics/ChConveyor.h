@@ -18,9 +18,11 @@
 #define CHCONVEYOR_H
 
 #include <cmath>
+#include <vector>
 
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystem.h"
 
 namespace chrono {
 
@@ -71,6 +73,33 @@ class ChApi ChConveyor : public ChPhysicsItem {
     /// Access the material surface properties of the conveyor belt (shortcut).
     std::shared_ptr<ChContactMaterial> GetMaterialSurface() const { return conveyor_mat; }
 
+    /// Enable/disable analytical contact between the belt and the registered parts (default: false).
+    /// If enabled, the conveyor plate is not added to the collision system. Instead, at each collision detection step,
+    /// the contact points of the parts registered with AddPart() are tested against the upper surface of the belt and
+    /// the resulting contacts are added directly to the system contact container, bypassing the broadphase and
+    /// narrowphase for all belt-part contacts. These contacts still act on the moving plate, so parts are transported
+    /// at the belt speed. Other objects do not collide with the belt while this mode is enabled.
+    void EnableAnalyticalContact(bool val);
+
+    /// Return true if analytical contact with the registered parts is enabled.
+    bool IsAnalyticalContactEnabled() const { return analytical_contact; }
+
+    /// Register a part for analytical contact with the belt.
+    /// The part geometry is approximated by the given points (expressed in the part reference frame), each swept by a
+    /// sphere of the specified radius. The part must have a collision model; the first collision shape provides the
+    /// contact material of the part.
+    void AddPart(std::shared_ptr<ChBody> part, const std::vector<ChVector3d>& points, double radius = 0);
+
+    /// Register a box-shaped part for analytical contact with the belt.
+    /// The box, with given lengths, is assumed centered at the part reference frame and aligned with its axes.
+    void AddBoxPart(std::shared_ptr<ChBody> part, const ChVector3d& lengths);
+
+    /// Remove all parts registered for analytical contact.
+    void RemoveAllParts() { parts.clear(); }
+
+    /// Get the number of parts registered for analytical contact.
+    unsigned int GetNumParts() const { return (unsigned int)parts.size(); }
+
     /// Number of coordinates: this contains an auxiliary body, so it is 14 (with quaternions for rotations).
     virtual unsigned int GetNumCoordsPosLevel() override { return 7 + 7; }
 
@@ -92,11 +121,27 @@ class ChApi ChConveyor : public ChPhysicsItem {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   private:
+    /// Part registered for analytical contact with the belt.
+    struct Part {
+        std::shared_ptr<ChBody> body;    ///< part body
+        std::vector<ChVector3d> points;  ///< contact points, in the part reference frame
+        double radius;                   ///< radius of the spheres swept by the contact points
+        double bound;                    ///< radius of a bounding sphere centered at the part reference frame
+    };
+
+    class AnalyticalContactCallback;
+
+    /// Add the contacts between the belt and the registered parts to the given container.
+    void AddAnalyticalContacts(ChContactContainer* container);
+
     double conveyor_speed;                            ///< speed of conveyor, along the X direction of the box.
     ChLinkLockLock* internal_link;                    ///< link between this body and conveyor plate
     ChBody* conveyor_truss;                           ///< used for the conveyor truss
     ChBody* conveyor_plate;                           ///< used for the conveyor plate
     std::shared_ptr<ChContactMaterial> conveyor_mat;  ///< surface contact material for the conveyor plate
+    bool analytical_contact;                          ///< generate belt-part contacts analytically
+    std::vector<Part> parts;                          ///< parts registered for analytical contact
+    std::shared_ptr<ChSystem::CustomCollisionCallback> collision_callback;  ///< generator of analytical contacts
 
     // Solver and integrator interface functions
 
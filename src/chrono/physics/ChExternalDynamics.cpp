@@ -12,14 +12,26 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+
 #include "chrono/physics/ChExternalDynamics.h"
+#include "chrono/physics/ChSystem.h"
 
 namespace chrono {
 
 // Perturbation for finite-difference Jacobian approximation
 const double ChExternalDynamics::m_FD_delta = 1e-8;
 
-ChExternalDynamics::ChExternalDynamics() {}
+ChExternalDynamics::ChExternalDynamics()
+    : m_sub_integration(false),
+      m_num_substeps(1),
+      m_sub_rtol(1e-6),
+      m_sub_atol(1e-8),
+      m_sub_max_iters(10),
+      m_sub_step(0),
+      m_h_prev(0),
+      m_has_history(false) {}
 ChExternalDynamics::~ChExternalDynamics() {
     delete m_variables;
 }
@@ -34,13 +46,27 @@ void ChExternalDynamics::Initialize() {
     m_variables = new ChVariablesGenericDiagonalMass(m_nstates);
     m_variables->GetMassDiagonal().Constant(m_nstates, 1);
 
-    if (IsStiff()) {
+    if (IsStiff() || m_sub_integration) {
         m_jac.resize(m_nstates, m_nstates);
 
         std::vector<ChVariables*> vars;
         vars.push_back(m_variables);
         m_KRM.SetVariables(vars);
     }
+
+    m_sub_step = 0;
+    m_has_history = false;
+}
+
+void ChExternalDynamics::EnableSubIntegration(bool val, int num_substeps) {
+    m_sub_integration = val;
+    m_num_substeps = std::max(num_substeps, 1);
+}
+
+void ChExternalDynamics::SetSubIntegrationTolerances(double rtol, double atol, int max_iters) {
+    m_sub_rtol = rtol;
+    m_sub_atol = atol;
+    m_sub_max_iters = max_iters;
 }
 
 ChExternalDynamics* ChExternalDynamics::Clone() const {
@@ -75,9 +101,90 @@ void ChExternalDynamics::ComputeJac(double time) {
     }
 }
 
+// -----------------------------------------------------------------------------
+
+void ChExternalDynamics::Setup() {
+    if (!m_sub_integration || !system || !IsActive())
+        return;
+
+    // Advance the internal states only once per step of the containing system
+    // (Setup may also be invoked outside of a step, e.g. during assembly analysis or sleep management)
+    if (system->GetNumSteps() == m_sub_step)
+        return;
+    m_sub_step = system->GetNumSteps();
+
+    double time = system->GetChTime();
+    double step = system->GetStep();
+
+    OnSubIntegrationBegin(time, step, m_states);
+    AdvanceStates(time, step);
+}
+
+void ChExternalDynamics::AdvanceStates(double time, double step) {
+    double h = step / m_num_substeps;
+
+    // BDF2 requires a constant substep; restart with backward Euler if the step size changed
+    if (std::abs(h - m_h_prev) > 1e-10 * h)
+        m_has_history = false;
+    m_h_prev = h;
+
+    ChVectorDynamic<> alpha(m_nstates);
+    ChVectorDynamic<> G(m_nstates);
+    ChVectorDynamic<> dy(m_nstates);
+    ChMatrixDynamic<> A(m_nstates, m_nstates);
+
+    for (int k = 0; k < m_num_substeps; k++) {
+        double t = time + (k + 1) * h;
+
+        // Discretization y_new = alpha + beta * h * f(t, y_new):
+        //   BDF1: alpha = y_n,                      beta = 1
+        //   BDF2: alpha = (4 * y_n - y_{n-1}) / 3,  beta = 2/3
+        double beta;
+        if (m_has_history) {
+            alpha = (4.0 * m_states - m_states_prev) / 3.0;
+            beta = 2.0 / 3.0;
+        } else {
+            alpha = m_states;
+            beta = 1.0;
+        }
+        m_states_prev = m_states;
+
+        // Newton iterations, starting from the states at the previous substep
+        for (int iter = 0; iter < m_sub_max_iters; iter++) {
+            CalculateRHS(t, m_states, m_rhs);
+            ComputeJac(t);
+
+            G = m_states - alpha - (beta * h) * m_rhs;
+            A = ChMatrixDynamic<>::Identity(m_nstates, m_nstates) - (beta * h) * m_jac;
+            dy = A.partialPivLu().solve(G);
+            m_states -= dy;
+
+            // Weighted RMS norm of the Newton correction
+            double wrms = 0;
+            for (int i = 0; i < m_nstates; i++) {
+                double w = m_sub_rtol * std::abs(m_states(i)) + m_sub_atol;
+                wrms += (dy(i) / w) * (dy(i) / w);
+            }
+            if (wrms <= m_nstates)
+                break;
+        }
+
+        m_has_history = true;
+    }
+
+    // Right-hand side at the new states
+    CalculateRHS(time + step, m_states, m_rhs);
+}
+
 void ChExternalDynamics::Update(double time, bool update_assets) {
     ChTime = time;
 
+    // With sub-integration, the internal states (and right-hand side) only change at the beginning of a step
+    if (m_sub_integration) {
+        ChPhysicsItem::Update(ChTime, update_assets);
+        return;
+    }
+
     // Compute forcing terms at current states
     CalculateRHS(time, m_states, m_rhs);
 
@@ -93,12 +200,15 @@ void ChExternalDynamics::Update(double time, bool update_assets) {
 // -----------------------------------------------------------------------------
 
 void ChExternalDynamics::InjectVariables(ChSystemDescriptor& descriptor) {
+    if (m_sub_integration)
+        return;
+
     m_variables->SetDisabled(!IsActive());
     descriptor.InsertVariables(m_variables);
 }
 
 void ChExternalDynamics::InjectKRMMatrices(ChSystemDescriptor& descriptor) {
-    if (IsStiff()) {
+    if (IsStiff() && !m_sub_integration) {
         descriptor.InsertKRMBlock(&m_KRM);
     }
 }
@@ -109,7 +219,7 @@ void ChExternalDynamics::IntStateGather(const unsigned int off_x,  // offset in
                                         ChStateDelta& v,           // state vector, speed part
                                         double& T                  // time
 ) {
-    if (!IsActive())
+    if (!IsActive() || m_sub_integration)
         return;
 
     x.segment(off_x, m_nstates).setZero();
@@ -128,13 +238,15 @@ void ChExternalDynamics::IntStateScatter(const unsigned int off_x,  // offset in
         return;
 
     // Important: set the internal states first, as they will be used in Update.
-    m_states = v.segment(off_v, m_nstates);
+    // With sub-integration, the internal states are not part of the system states, but the item must still be updated.
+    if (!m_sub_integration)
+        m_states = v.segment(off_v, m_nstates);
 
     Update(T, full_update);
 }
 
 void ChExternalDynamics::IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) {
-    if (!IsActive())
+    if (!IsActive() || m_sub_integration)
         return;
 
     a.segment(off_a, m_nstates) = m_rhs;
@@ -148,7 +260,7 @@ void ChExternalDynamics::IntLoadResidual_F(const unsigned int off,  // offset in
                                            ChVectorDynamic<>& R,    // result: the R residual, R += c*F
                                            const double c           // a scaling factor
 ) {
-    if (!IsActive())
+    if (!IsActive() || m_sub_integration)
         return;
 
     // Add forcing term for internal variables
@@ -160,7 +272,7 @@ void ChExternalDynamics::IntLoadResidual_Mv(const unsigned int off,      // offs
                                             const ChVectorDynamic<>& v,  // the v vector
                                             const double c               // a scaling factor
 ) {
-    if (!IsActive())
+    if (!IsActive() || m_sub_integration)
         return;
 
     R.segment(off, m_nstates) += c * v.segment(off, m_nstates);
@@ -170,7 +282,7 @@ void ChExternalDynamics::IntLoadLumpedMass_Md(const unsigned int off,
                                               ChVectorDynamic<>& Md,
                                               double& err,
                                               const double c) {
-    if (!IsActive())
+    if (!IsActive() || m_sub_integration)
         return;
 
     Md.segment(off, m_nstates).array() += c * 1.0;
@@ -182,7 +294,7 @@ void ChExternalDynamics::IntToDescriptor(const unsigned int off_v,  // offset in
                                          const unsigned int off_L,  // offset in L, Qc
                                          const ChVectorDynamic<>& L,
                                          const ChVectorDynamic<>& Qc) {
-    if (!IsActive())
+    if (!IsActive() || m_sub_integration)
         return;
 
     m_variables->State() = v.segment(off_v, m_nstates);
@@ -193,7 +305,7 @@ void ChExternalDynamics::IntFromDescriptor(const unsigned int off_v,  // offset
                                            ChStateDelta& v,
                                            const unsigned int off_L,  // offset in L
                                            ChVectorDynamic<>& L) {
-    if (!IsActive())
+    if (!IsActive() || m_sub_integration)
         return;
 
     v.segment(off_v, m_nstates) = m_variables->State();
@@ -202,7 +314,7 @@ void ChExternalDynamics::IntFromDescriptor(const unsigned int off_v,  // offset
 // -----------------------------------------------------------------------------
 
 void ChExternalDynamics::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
-    if (IsStiff()) {
+    if (IsStiff() && !m_sub_integration) {
         // Recall to flip sign to load R = -dQ/dv (K is zero here)
         m_KRM.GetMatrix() = Mfactor * ChMatrixDynamic<>::Identity(m_nstates, m_nstates) - Rfactor * m_jac;
     }
@@ -211,22 +323,32 @@ void ChExternalDynamics::LoadKRMMatrices(double Kfactor, double Rfactor, double
 // -----------------------------------------------------------------------------
 
 void ChExternalDynamics::VariablesFbReset() {
+    if (m_sub_integration)
+        return;
     m_variables->Force().setZero();
 }
 
 void ChExternalDynamics::VariablesFbLoadForces(double factor) {
+    if (m_sub_integration)
+        return;
     m_variables->Force() = m_rhs;
 }
 
 void ChExternalDynamics::VariablesQbLoadSpeed() {
+    if (m_sub_integration)
+        return;
     m_variables->State() = m_states;
 }
 
 void ChExternalDynamics::VariablesQbSetSpeed(double step) {
+    if (m_sub_integration)
+        return;
     m_states = m_variables->State();
 }
 
 void ChExternalDynamics::VariablesFbIncrementMq() {
+    if (m_sub_integration)
+        return;
     m_variables->AddMassTimesVector(m_variables->Force(), m_variables->State());
 }
 
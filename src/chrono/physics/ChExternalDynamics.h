@@ -54,6 +54,22 @@ class ChApi ChExternalDynamics : public ChPhysicsItem {
     /// Get current RHS.
     const ChVectorDynamic<>& GetRHS() const { return m_rhs; }
 
+    /// Enable/disable sub-integration of the internal states (default: false).
+    /// If enabled, the internal states are not included in the states of the containing system. Instead, at the
+    /// beginning of each step of the containing system, they are advanced over that step with an implicit BDF2
+    /// integrator using the specified number of substeps. Any quantities coupling the internal dynamics to other
+    /// physics items are frozen at their values at the beginning of the step (see OnSubIntegrationBegin). This allows
+    /// integrating stiff internal dynamics without limiting the step size of the containing system.
+    /// Must be called before Initialize.
+    void EnableSubIntegration(bool val, int num_substeps = 1);
+
+    /// Return true if the internal states are sub-integrated.
+    bool IsSubIntegrated() const { return m_sub_integration; }
+
+    /// Set the tolerances and maximum number of Newton iterations for the sub-integrator.
+    /// By default, rtol = 1e-6, atol = 1e-8, and max_iters = 10.
+    void SetSubIntegrationTolerances(double rtol, double atol, int max_iters = 10);
+
   protected:
     ChExternalDynamics();
 
@@ -81,9 +97,19 @@ class ChApi ChExternalDynamics : public ChPhysicsItem {
         return false;
     }
 
+    /// Process the beginning of a sub-integration step.
+    /// Called at the beginning of each step of the containing system, before the internal states 'y' are advanced from
+    /// 'time' to 'time+step'. A derived class can use this function to update the coupling quantities (frozen during
+    /// sub-integration) and to apply corrections to the current states.
+    virtual void OnSubIntegrationBegin(double time, double step, ChVectorDynamic<>& y) {}
+
+    /// Perform setup operations at the beginning of a step.
+    /// If sub-integration is enabled, advance the internal states over the step of the containing system.
+    virtual void Setup() override;
+
     virtual void Update(double time, bool update_assets = true) override;
 
-    virtual unsigned int GetNumCoordsPosLevel() override { return m_nstates; }
+    virtual unsigned int GetNumCoordsPosLevel() override { return m_sub_integration ? 0 : m_nstates; }
 
     ChVariables& Variables() { return *m_variables; }
 
@@ -138,6 +164,9 @@ class ChApi ChExternalDynamics : public ChPhysicsItem {
     /// Compute the Jacobian at the current time and state.
     void ComputeJac(double time);
 
+    /// Advance the internal states from 'time' to 'time+step' with the BDF2 sub-integrator.
+    void AdvanceStates(double time, double step);
+
   private:
     int m_nstates;                                ///< number of internal ODE states
     ChVectorDynamic<> m_states;                   ///< vector of internal ODE states
@@ -148,6 +177,16 @@ class ChApi ChExternalDynamics : public ChPhysicsItem {
 
     ChKRMBlock m_KRM;  ///< linear combination of K, R, M for the variables associated with item
 
+    bool m_sub_integration;           ///< internal states advanced with own integrator?
+    int m_num_substeps;               ///< number of sub-integrator steps per step of the containing system
+    double m_sub_rtol;                ///< relative tolerance for sub-integrator Newton iterations
+    double m_sub_atol;                ///< absolute tolerance for sub-integrator Newton iterations
+    int m_sub_max_iters;              ///< maximum number of sub-integrator Newton iterations
+    size_t m_sub_step;                ///< last step of the containing system processed by the sub-integrator
+    ChVectorDynamic<> m_states_prev;  ///< internal states at previous substep (BDF2 history)
+    double m_h_prev;                  ///< previous substep size
+    bool m_has_history;               ///< true if BDF2 history available
+
     static const double m_FD_delta;  ///< perturbation for finite-difference Jacobian approximation
 };
 
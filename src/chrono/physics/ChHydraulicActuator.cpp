@@ -18,7 +18,7 @@
 namespace chrono {
 
 ChHydraulicActuatorBase::ChHydraulicActuatorBase()
-    : pP(7.6e6), pT(0.1e6), is_attached(false), calculate_consistent_IC(false) {}
+    : pP(7.6e6), pT(0.1e6), is_attached(false), s_pred(0), dpds(0.0, 0.0), calculate_consistent_IC(false) {}
 
 void ChHydraulicActuatorBase::SetPressures(double pump_pressure, double tank_pressure) {
     pP = pump_pressure;
@@ -29,6 +29,7 @@ void ChHydraulicActuatorBase::SetActuatorInitialLength(double len) {
     s_0 = len;
     s = len;
     sd = 0;
+    s_pred = len;
 }
 
 void ChHydraulicActuatorBase::SetActuatorLength(double len, double vel) {
@@ -80,9 +81,19 @@ void ChHydraulicActuatorBase::Initialize(std::shared_ptr<ChBody> body1,  // firs
     }
 
     s_0 = (m_aloc1 - m_aloc2).Length();
+    s = s_0;
+    sd = 0;
+    s_pred = s_0;
 
-    // Resize temporary vector of generalized body forces
+    // Resize temporary vector of generalized body forces and actuator length gradient
     m_Qforce.resize(12);
+    m_G.resize(12);
+
+    // Set the body variables associated with the force Jacobians
+    std::vector<ChVariables*> vars;
+    vars.push_back(&body1->Variables());
+    vars.push_back(&body2->Variables());
+    m_body_KRM.SetVariables(vars);
 }
 
 double ChHydraulicActuatorBase::GetValvePosition() {
@@ -90,19 +101,52 @@ double ChHydraulicActuatorBase::GetValvePosition() {
 }
 
 std::array<double, 2> ChHydraulicActuatorBase::GetCylinderPressures() {
-    Vec2 p = ExtractCylinderPressures();
+    Vec2 p = GetCorrectedPressures();
     return {p(0), p(1)};
 }
 
 double ChHydraulicActuatorBase::GetActuatorForce() {
-    Vec2 p = ExtractCylinderPressures();
+    Vec2 p = GetCorrectedPressures();
     return cyl.EvalForce(p, s - s_0, sd);
 }
 
+Vec2 ChHydraulicActuatorBase::GetCorrectedPressures() const {
+    Vec2 p = ExtractCylinderPressures();
+
+    // With sub-integration, the pressures were obtained for the predicted actuator length at the end of the step.
+    // Correct them (to first order) for the compression or expansion of the cylinder volumes due to the deviation of
+    // the current length from that prediction. This provides the hydraulic stiffness to the mechanical system.
+    if (IsSubIntegrated())
+        p += dpds * (s - s_pred);
+
+    return p;
+}
+
 double ChHydraulicActuatorBase::GetInput(double t) const {
     return ChClamp(ref_fun->GetVal(t), -1.0, +1.0);
 }
 
+void ChHydraulicActuatorBase::UpdateKinematics() {
+    m_aloc1 = m_body1->TransformPointLocalToParent(m_loc1);
+    m_aloc2 = m_body2->TransformPointLocalToParent(m_loc2);
+
+    auto avel1 = m_body1->PointSpeedLocalToParent(m_loc1);
+    auto avel2 = m_body2->PointSpeedLocalToParent(m_loc2);
+
+    ChVector3d dir = (m_aloc1 - m_aloc2).GetNormalized();
+
+    s = (m_aloc1 - m_aloc2).Length();
+    sd = Vdot(dir, avel1 - avel2);
+
+    // Gradient of actuator length w.r.t. body states (also gradient of actuator rate w.r.t. body velocities)
+    auto ldir1 = m_body1->TransformDirectionParentToLocal(Vcross(m_aloc1 - m_body1->GetPos(), dir));
+    auto ldir2 = m_body2->TransformDirectionParentToLocal(Vcross(m_aloc2 - m_body2->GetPos(), dir));
+    m_G.segment(0, 3) = dir.eigen();
+    m_G.segment(3, 3) = ldir1.eigen();
+    m_G.segment(6, 3) = -dir.eigen();
+    m_G.segment(9, 3) = -ldir2.eigen();
+}
+
 void ChHydraulicActuatorBase::Update(double time, bool update_assets) {
     // Update the external dynamics
     ChExternalDynamics::Update(time, update_assets);
@@ -110,35 +154,24 @@ void ChHydraulicActuatorBase::Update(double time, bool update_assets) {
     // If the actuator is attached to bodies, update its length and rate from the body states
     // and calculate the generated force to the two bodies.
     if (is_attached) {
-        m_aloc1 = m_body1->TransformPointLocalToParent(m_loc1);
-        m_aloc2 = m_body2->TransformPointLocalToParent(m_loc2);
+        UpdateKinematics();
 
-        auto avel1 = m_body1->PointSpeedLocalToParent(m_loc1);
-        auto avel2 = m_body2->PointSpeedLocalToParent(m_loc2);
+        ////std::cout << "time = " << time << "    s=" << s << "   sd=" << sd << std::endl;
 
-        ChVector3d dir = (m_aloc1 - m_aloc2).GetNormalized();
+        // Generalized forces on the two bodies (forces in absolute frame, torques in local frames)
+        m_Qforce = GetActuatorForce() * m_G;
+    }
+}
 
-        s = (m_aloc1 - m_aloc2).Length();
-        sd = Vdot(dir, avel1 - avel2);
+void ChHydraulicActuatorBase::OnSubIntegrationBegin(double time, double step, ChVectorDynamic<>& y) {
+    if (is_attached)
+        UpdateKinematics();
 
-        ////std::cout << "time = " << time << "    s=" << s << "   sd=" << sd << std::endl;
+    // Commit the pressure correction for the actual actuator length at the end of the previous step
+    LoadCylinderPressures(y, GetCorrectedPressures());
 
-        // Actuator force
-        auto f = GetActuatorForce();
-        ChVector3d force = f * dir;
-
-        // Force and moment acting on body 1
-        auto atorque1 = Vcross(m_aloc1 - m_body1->GetPos(), force);          // applied torque (absolute frame)
-        auto ltorque1 = m_body1->TransformDirectionParentToLocal(atorque1);  // applied torque (local frame)
-        m_Qforce.segment(0, 3) = force.eigen();
-        m_Qforce.segment(3, 3) = ltorque1.eigen();
-
-        // Force and moment acting on body 2
-        auto atorque2 = Vcross(m_aloc2 - m_body2->GetPos(), -force);         // applied torque (absolute frame)
-        auto ltorque2 = m_body2->TransformDirectionParentToLocal(atorque2);  // applied torque (local frame)
-        m_Qforce.segment(6, 3) = -force.eigen();
-        m_Qforce.segment(9, 3) = ltorque2.eigen();
-    }
+    // Freeze actuator length and rate over the step and predict the actuator length at the end of the step
+    s_pred = s + sd * step;
 }
 
 void ChHydraulicActuatorBase::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
@@ -161,6 +194,32 @@ void ChHydraulicActuatorBase::IntLoadResidual_F(const unsigned int off, ChVector
     }
 }
 
+void ChHydraulicActuatorBase::InjectKRMMatrices(ChSystemDescriptor& descriptor) {
+    ChExternalDynamics::InjectKRMMatrices(descriptor);
+
+    if (IsSubIntegrated() && is_attached)
+        descriptor.InsertKRMBlock(&m_body_KRM);
+}
+
+void ChHydraulicActuatorBase::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
+    ChExternalDynamics::LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+
+    if (!IsSubIntegrated() || !is_attached)
+        return;
+
+    // Sensitivities of the actuator force w.r.t. actuator length (including the pressure correction) and rate.
+    // Evaluate the rate sensitivity last, at the current length, to leave the cylinder end-damper flag consistent.
+    const double delta = 1e-8;
+    Vec2 p = GetCorrectedPressures();
+    double f = cyl.EvalForce(p, s - s_0, sd);
+    double dfds = (cyl.EvalForce(p + dpds * delta, s - s_0 + delta, sd) - f) / delta;
+    double dfdsd = (cyl.EvalForce(p, s - s_0, sd + delta) - f) / delta;
+
+    // Generalized forces are Q = f * G, with G the gradient of the actuator length w.r.t. body states.
+    // Neglecting the geometric stiffness (variation of G), K = -dQ/dq = -dfds * G * G' and R = -dQ/dv = -dfdsd * G * G'
+    m_body_KRM.GetMatrix() = -(Kfactor * dfds + Rfactor * dfdsd) * (m_G * m_G.transpose());
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 
 ChHydraulicActuator2::ChHydraulicActuator2() : hose1V(3.14e-5), hose2V(7.85e-5), Bo(1500e6), Bh(150e6), Bc(31500e6) {}
@@ -259,6 +318,11 @@ Vec2 ChHydraulicActuator2::ExtractCylinderPressures() const {
     return Vec2(y(1), y(2));
 }
 
+void ChHydraulicActuator2::LoadCylinderPressures(ChVectorDynamic<>& y, const Vec2& p) const {
+    y(1) = p(0);
+    y(2) = p(1);
+}
+
 Vec2 ChHydraulicActuator2::EvaluatePressureRates(double t, const Vec2& p, double U) {
     const auto& Ac = cyl.GetAreas();
     auto Lc = cyl.ComputeChamberLengths(s - s_0);
@@ -278,6 +342,10 @@ Vec2 ChHydraulicActuator2::EvaluatePressureRates(double t, const Vec2& p, double
     // Compute volume flows
     auto Q = dvalve.ComputeVolumeFlows(U, p.segment(0, 2), pP, pT);
 
+    // Sensitivity of cylinder pressures w.r.t. actuator length
+    dpds(0) = -(Be(0) / V(0)) * Ac(0);
+    dpds(1) = +(Be(1) / V(1)) * Ac(1);
+
     // Compute pressure rates
     Vec2 pd;
     pd(0) = (Be(0) / V(0)) * (Q(0) - Ac(0) * sd);
@@ -366,6 +434,11 @@ Vec2 ChHydraulicActuator3::ExtractCylinderPressures() const {
     return Vec2(y(1), y(2));
 }
 
+void ChHydraulicActuator3::LoadCylinderPressures(ChVectorDynamic<>& y, const Vec2& p) const {
+    y(1) = p(0);
+    y(2) = p(1);
+}
+
 Vec3 ChHydraulicActuator3::EvaluatePressureRates(double t, const Vec3& p, double U) {
     const auto& Ac = cyl.GetAreas();
     auto Lc = cyl.ComputeChamberLengths(s - s_0);
@@ -387,6 +460,10 @@ Vec3 ChHydraulicActuator3::EvaluatePressureRates(double t, const Vec3& p, double
     auto Q = dvalve.ComputeVolumeFlows(U, p.segment(0, 2), pP, pT);
     double Q31 = tvalve.ComputeVolumeFlow(p(2), p(0));
 
+    // Sensitivity of cylinder pressures w.r.t. actuator length
+    dpds(0) = -(Be(0) / V(0)) * Ac(0);
+    dpds(1) = +(Be(1) / V(1)) * Ac(1);
+
     // Compute pressure rates
     Vec3 pd;
     pd(0) = (Be(0) / V(0)) * (Q(0) - Ac(0) * sd);
@@ -43,6 +43,12 @@ namespace chrono {
 /// is inferred from the states of those two bodies. Alternatively, a hydraulic actuator can be instantiated stand-alone
 /// (e.g., for use in a co-simulation setting), in which case the actuator length and rate must be provided from
 /// outside.
+///
+/// The stiff hydraulic pressure dynamics can be integrated with a dedicated implicit sub-integrator (see
+/// ChExternalDynamics::EnableSubIntegration), so that the mechanical system can use larger step sizes. In that case,
+/// the actuator length and rate are frozen over each step of the containing system, the cylinder pressures are
+/// corrected for the deviation of the actuator length from its predicted value, and (for an actuator attached to
+/// bodies) the Jacobians of the actuator force with respect to the body states are provided to the system solver.
 class ChApi ChHydraulicActuatorBase : public ChExternalDynamics {
   public:
     virtual ~ChHydraulicActuatorBase() {}
@@ -122,6 +128,9 @@ class ChApi ChHydraulicActuatorBase : public ChExternalDynamics {
     /// Extract cylinder pressures from current state.
     virtual Vec2 ExtractCylinderPressures() const = 0;
 
+    /// Load the cylinder pressures in the given state vector.
+    virtual void LoadCylinderPressures(ChVectorDynamic<>& y, const Vec2& p) const = 0;
+
     /// Get current actuator input.
     double GetInput(double t) const;
 
@@ -131,9 +140,24 @@ class ChApi ChHydraulicActuatorBase : public ChExternalDynamics {
     /// Update the physics item at current state.
     virtual void Update(double time, bool update_assets = true) override;
 
+    /// Freeze the actuator length and rate for sub-integration of the hydraulic states over the next step.
+    virtual void OnSubIntegrationBegin(double time, double step, ChVectorDynamic<>& y) override;
+
     /// Load generalized forces.
     virtual void IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) override;
 
+    /// Register the Jacobians of the actuator force with respect to the states of the connected bodies.
+    virtual void InjectKRMMatrices(ChSystemDescriptor& descriptor) override;
+
+    /// Compute and load the Jacobians of the actuator force with respect to the states of the connected bodies.
+    virtual void LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) override;
+
+    /// Update the actuator length and rate from the states of the connected bodies.
+    void UpdateKinematics();
+
+    /// Get the cylinder pressures, corrected for the current actuator length (if sub-integrated).
+    Vec2 GetCorrectedPressures() const;
+
     bool is_attached;            ///< true if actuator attached to bodies
     ChBody* m_body1;             ///< first conected body
     ChBody* m_body2;             ///< second connected body
@@ -142,6 +166,8 @@ class ChApi ChHydraulicActuatorBase : public ChExternalDynamics {
     ChVector3d m_aloc1;          ///< point on body 1 (global frame)
     ChVector3d m_aloc2;          ///< point on body 2 (global frame)
     ChVectorDynamic<> m_Qforce;  ///< generalized forcing terms
+    ChVectorDynamic<> m_G;       ///< gradient of actuator length w.r.t. body states
+    ChKRMBlock m_body_KRM;       ///< force Jacobians w.r.t. states of the connected bodies
 
     ChHydraulicCylinder cyl;                ///< hydraulic cylinder
     ChHydraulicDirectionalValve4x3 dvalve;  ///< directional valve
@@ -152,6 +178,9 @@ class ChApi ChHydraulicActuatorBase : public ChExternalDynamics {
     double s;    ///< current actuator length [m]
     double sd;   ///< current actuator speed [m/s]
 
+    double s_pred;  ///< predicted actuator length at end of step (sub-integration) [m]
+    Vec2 dpds;      ///< sensitivity of cylinder pressures w.r.t. actuator length [Pa/m]
+
     double pP;  ///< pump pressure [Pa]
     double pT;  ///< tank pressure [Pa]
 
@@ -228,6 +257,9 @@ class ChApi ChHydraulicActuator2 : public ChHydraulicActuatorBase {
     /// Extract cylinder pressures from current state.
     virtual Vec2 ExtractCylinderPressures() const override;
 
+    /// Load the cylinder pressures in the given state vector.
+    virtual void LoadCylinderPressures(ChVectorDynamic<>& y, const Vec2& p) const override;
+
     /// Evaluate pressure rates at curent state.
     Vec2 EvaluatePressureRates(double t, const Vec2& p, double U);
 
@@ -318,6 +350,9 @@ class ChApi ChHydraulicActuator3 : public ChHydraulicActuatorBase {
     /// Extract cylinder pressures from current state.
     virtual Vec2 ExtractCylinderPressures() const override;
 
+    /// Load the cylinder pressures in the given state vector.
+    virtual void LoadCylinderPressures(ChVectorDynamic<>& y, const Vec2& p) const override;
+
     /// Evaluate pressure rates at curent state.
     Vec3 EvaluatePressureRates(double t, const Vec3& p, double U);
 
@@ -159,6 +159,8 @@ class ChApi ChLinkMateGeneric : public ChLinkMate {
 
     ChLinkMask mask;
 
+    friend class ChLinkMateBatch;
+
     ChConstraintVectorX C;  ///< residuals
 
     ChMatrix33<> P;  ///< projection matrix from Lagrange multiplier to reaction torque
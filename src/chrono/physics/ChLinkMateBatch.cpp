@@ -0,0 +1,356 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <typeinfo>
+
+#include "chrono/physics/ChLinkMateBatch.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkMate.h"
+
+namespace chrono {
+
+// Offsets of the link data components (each component is stored contiguously for all links).
+// 3x3 matrices are stored row-major, quaternions as (e0, e1, e2, e3).
+enum LinkComponent {
+    F1P = 0,    // position of frame 1, relative to body 1
+    F2P = 3,    // position of frame 2, relative to body 2
+    RF2 = 6,    // rotation matrix of frame 2, relative to body 2
+    F1Q = 15,   // rotation of frame 1, relative to body 1
+    F2Q = 19,   // rotation of frame 2, relative to body 2
+    A1 = 23,    // rotation matrix of body 1
+    P1 = 32,    // position of body 1
+    Q1 = 35,    // rotation of body 1
+    A2 = 39,    // rotation matrix of body 2
+    P2 = 48,    // position of body 2
+    Q2 = 51,    // rotation of body 2
+    RES = 55,   // residuals (relative position and imaginary part of relative rotation of frame 1 in frame 2)
+    JX = 61,    // translational Jacobian (body 1; negated for body 2)
+    JR1 = 70,   // rotational Jacobian of the translational constraints, body 1
+    JR2 = 79,   // rotational Jacobian of the translational constraints, body 2
+    JW1 = 88,   // rotational Jacobian of the rotational constraints, body 1
+    JW2 = 97,   // rotational Jacobian of the rotational constraints, body 2
+    PM = 106,   // projection matrix from Lagrange multipliers to reaction torque
+    NUM_COMPONENTS = 115
+};
+
+// Return true if the link uses the generic mate update (i.e., its type does not override ChLinkMateGeneric::Update).
+static bool UsesGenericUpdate(const ChLinkMateGeneric& link) {
+    const auto& type = typeid(link);
+    return type == typeid(ChLinkMateGeneric) || type == typeid(ChLinkMateSpherical) ||
+           type == typeid(ChLinkMateRevolute) || type == typeid(ChLinkMatePrismatic) ||
+           type == typeid(ChLinkMateCylindrical) || type == typeid(ChLinkMateParallel) ||
+           type == typeid(ChLinkMateFix);
+}
+
+// Return true if the link is a lock-formulation joint included in the batch.
+static bool IsBatchedLock(const ChLinkLock& link) {
+    const auto& type = typeid(link);
+    return type == typeid(ChLinkLockRevolute) || type == typeid(ChLinkLockSpherical);
+}
+
+void ChLinkMateBatch::Clear() {
+    m_links.clear();
+    m_locks.clear();
+    m_batched.clear();
+    m_data.clear();
+}
+
+void ChLinkMateBatch::Build(const std::vector<std::shared_ptr<ChLinkBase>>& links) {
+    m_links.clear();
+    m_locks.clear();
+    m_batched.assign(links.size(), 0);
+    for (size_t i = 0; i < links.size(); i++) {
+        if (!links[i]->IsActive())
+            continue;
+        if (auto mate = dynamic_cast<ChLinkMateGeneric*>(links[i].get())) {
+            if (mate->m_body1 && mate->m_body2 && UsesGenericUpdate(*mate)) {
+                m_links.push_back(mate);
+                m_batched[i] = 1;
+            }
+        } else if (auto lock = dynamic_cast<ChLinkLock*>(links[i].get())) {
+            if (lock->GetBody1() && lock->GetBody2() && IsBatchedLock(*lock)) {
+                m_locks.push_back(lock);
+                m_batched[i] = 1;
+            }
+        }
+    }
+
+    // Load the link frames (constant between setups)
+    int n = (int)m_links.size();
+    m_data.assign((size_t)NUM_COMPONENTS * n, 0.0);
+    double* d = m_data.data();
+    for (int k = 0; k < n; k++) {
+        const auto& frame1 = m_links[k]->frame1;
+        const auto& frame2 = m_links[k]->frame2;
+        for (int i = 0; i < 3; i++) {
+            d[(F1P + i) * n + k] = frame1.GetPos()[i];
+            d[(F2P + i) * n + k] = frame2.GetPos()[i];
+            for (int j = 0; j < 3; j++)
+                d[(RF2 + 3 * i + j) * n + k] = frame2.GetRotMat()(i, j);
+        }
+        for (int i = 0; i < 4; i++) {
+            d[(F1Q + i) * n + k] = frame1.GetRot()[i];
+            d[(F2Q + i) * n + k] = frame2.GetRot()[i];
+        }
+    }
+}
+
+void ChLinkMateBatch::Update(double time, bool update_assets, int nthreads) {
+    if (!m_links.empty()) {
+        Gather(nthreads);
+        Compute(nthreads);
+        Scatter(time, nthreads);
+    }
+
+    if (!m_locks.empty())
+        UpdateLocks(time, nthreads);
+
+    // Asset updates are performed sequentially, as in ChAssembly::Update
+    if (update_assets) {
+        for (auto link : m_links)
+            link->ChPhysicsItem::Update(time, true);
+        for (auto link : m_locks)
+            link->ChPhysicsItem::Update(time, true);
+    }
+}
+
+void ChLinkMateBatch::Gather(int nthreads) {
+    int n = (int)m_links.size();
+    double* d = m_data.data();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int k = 0; k < n; k++) {
+        const ChBodyFrame* b1 = m_links[k]->m_body1;
+        const ChBodyFrame* b2 = m_links[k]->m_body2;
+        for (int i = 0; i < 3; i++) {
+            d[(P1 + i) * n + k] = b1->GetPos()[i];
+            d[(P2 + i) * n + k] = b2->GetPos()[i];
+            for (int j = 0; j < 3; j++) {
+                d[(A1 + 3 * i + j) * n + k] = b1->GetRotMat()(i, j);
+                d[(A2 + 3 * i + j) * n + k] = b2->GetRotMat()(i, j);
+            }
+        }
+        for (int i = 0; i < 4; i++) {
+            d[(Q1 + i) * n + k] = b1->GetRot()[i];
+            d[(Q2 + i) * n + k] = b2->GetRot()[i];
+        }
+    }
+}
+
+// Kernels on row-major 3x3 matrices and quaternions stored in local arrays.
+
+// c = a * b
+static inline void Mul33(const double* a, const double* b, double* c) {
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            c[3 * i + j] = a[3 * i + 0] * b[0 + j] + a[3 * i + 1] * b[3 + j] + a[3 * i + 2] * b[6 + j];
+}
+
+// c = a' * b
+static inline void MulT33(const double* a, const double* b, double* c) {
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            c[3 * i + j] = a[0 + i] * b[0 + j] + a[3 + i] * b[3 + j] + a[6 + i] * b[6 + j];
+}
+
+// w = a' * v
+static inline void MulT3(const double* a, const double* v, double* w) {
+    for (int i = 0; i < 3; i++)
+        w[i] = a[0 + i] * v[0] + a[3 + i] * v[1] + a[6 + i] * v[2];
+}
+
+// c = a * [v]x, with [v]x the skew-symmetric matrix of v
+static inline void MulStar(const double* a, const double* v, double* c) {
+    for (int i = 0; i < 3; i++) {
+        c[3 * i + 0] = a[3 * i + 1] * v[2] - a[3 * i + 2] * v[1];
+        c[3 * i + 1] = a[3 * i + 2] * v[0] - a[3 * i + 0] * v[2];
+        c[3 * i + 2] = a[3 * i + 0] * v[1] - a[3 * i + 1] * v[0];
+    }
+}
+
+// q = a * b (quaternion product)
+static inline void QuatMul(const double* a, const double* b, double* q) {
+    q[0] = a[0] * b[0] - a[1] * b[1] - a[2] * b[2] - a[3] * b[3];
+    q[1] = a[0] * b[1] + a[1] * b[0] - a[3] * b[2] + a[2] * b[3];
+    q[2] = a[0] * b[2] + a[2] * b[0] + a[3] * b[1] - a[1] * b[3];
+    q[3] = a[0] * b[3] + a[3] * b[0] - a[2] * b[1] + a[1] * b[2];
+}
+
+void ChLinkMateBatch::Compute(int nthreads) {
+    int n = (int)m_links.size();
+    double* d = m_data.data();
+
+#pragma omp parallel for simd schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int k = 0; k < n; k++) {
+        double a1[9], a2[9], rf2[9];
+        double p1[3], p2[3], f1p[3], f2p[3];
+        double q1[4], q2[4], f1q[4], f2q[4];
+        for (int i = 0; i < 9; i++) {
+            a1[i] = d[(A1 + i) * n + k];
+            a2[i] = d[(A2 + i) * n + k];
+            rf2[i] = d[(RF2 + i) * n + k];
+        }
+        for (int i = 0; i < 3; i++) {
+            p1[i] = d[(P1 + i) * n + k];
+            p2[i] = d[(P2 + i) * n + k];
+            f1p[i] = d[(F1P + i) * n + k];
+            f2p[i] = d[(F2P + i) * n + k];
+        }
+        for (int i = 0; i < 4; i++) {
+            q1[i] = d[(Q1 + i) * n + k];
+            q2[i] = d[(Q2 + i) * n + k];
+            f1q[i] = d[(F1Q + i) * n + k];
+            f2q[i] = d[(F2Q + i) * n + k];
+        }
+
+        // Absolute rotation matrix of frame 2; its transpose is the translational Jacobian
+        double r2w[9];
+        double jx[9];
+        Mul33(a2, rf2, r2w);
+        for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+                jx[3 * i + j] = r2w[3 * j + i];
+
+        // Absolute positions of the frames and their difference
+        double dp[3];
+        for (int i = 0; i < 3; i++) {
+            double f1w = p1[i] + a1[3 * i + 0] * f1p[0] + a1[3 * i + 1] * f1p[1] + a1[3 * i + 2] * f1p[2];
+            double f2w = p2[i] + a2[3 * i + 0] * f2p[0] + a2[3 * i + 1] * f2p[1] + a2[3 * i + 2] * f2p[2];
+            dp[i] = f1w - f2w;
+        }
+
+        // Relative position and rotation of frame 1 with respect to frame 2
+        double pos12[3];
+        MulT3(r2w, dp, pos12);
+        double q1w[4], q2w[4], q12[4];
+        QuatMul(q1, f1q, q1w);
+        QuatMul(q2, f2q, q2w);
+        q2w[1] = -q2w[1];
+        q2w[2] = -q2w[2];
+        q2w[3] = -q2w[3];
+        QuatMul(q2w, q1w, q12);
+
+        // Jr1 = -Jx * A1 * [f1p]x
+        double m1[9];
+        double jr1[9];
+        Mul33(jx, a1, m1);
+        MulStar(m1, f1p, jr1);
+        for (int i = 0; i < 9; i++)
+            jr1[i] = -jr1[i];
+
+        // Jr2 = Rf2' * [f2p + A2' * dp]x
+        double r12[3];
+        MulT3(a2, dp, r12);
+        for (int i = 0; i < 3; i++)
+            r12[i] += f2p[i];
+        double rf2t[9];
+        double jr2[9];
+        for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+                rf2t[3 * i + j] = rf2[3 * j + i];
+        MulStar(rf2t, r12, jr2);
+
+        // P = 0.5 * (e0 * I + [e]x), with e the imaginary part of the relative rotation
+        double pm[9];
+        pm[0] = 0.5 * q12[0];
+        pm[1] = -0.5 * q12[3];
+        pm[2] = 0.5 * q12[2];
+        pm[3] = 0.5 * q12[3];
+        pm[4] = 0.5 * q12[0];
+        pm[5] = -0.5 * q12[1];
+        pm[6] = -0.5 * q12[2];
+        pm[7] = 0.5 * q12[1];
+        pm[8] = 0.5 * q12[0];
+
+        // Jw1 = P' * Jx * A1,  Jw2 = -P' * Jx * A2 = -P' * Rf2'
+        double jw1[9];
+        double jw2[9];
+        MulT33(pm, m1, jw1);
+        MulT33(pm, rf2t, jw2);
+        for (int i = 0; i < 9; i++)
+            jw2[i] = -jw2[i];
+
+        for (int i = 0; i < 3; i++) {
+            d[(RES + i) * n + k] = pos12[i];
+            d[(RES + 3 + i) * n + k] = q12[1 + i];
+        }
+        for (int i = 0; i < 9; i++) {
+            d[(JX + i) * n + k] = jx[i];
+            d[(JR1 + i) * n + k] = jr1[i];
+            d[(JR2 + i) * n + k] = jr2[i];
+            d[(JW1 + i) * n + k] = jw1[i];
+            d[(JW2 + i) * n + k] = jw2[i];
+            d[(PM + i) * n + k] = pm[i];
+        }
+    }
+}
+
+void ChLinkMateBatch::Scatter(double time, int nthreads) {
+    int n = (int)m_links.size();
+    const double* d = m_data.data();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int k = 0; k < n; k++) {
+        ChLinkMateGeneric* link = m_links[k];
+        link->UpdateTime(time);
+        link->mask.SetTwoBodiesVariables(&link->m_body1->Variables(), &link->m_body2->Variables());
+
+        for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+                link->P(i, j) = d[(PM + 3 * i + j) * n + k];
+
+        const bool flags[6] = {link->c_x, link->c_y, link->c_z, link->c_rx, link->c_ry, link->c_rz};
+        int nc = 0;
+        for (int r = 0; r < 6; r++) {
+            if (!flags[r])
+                continue;
+            link->C(nc) = d[(RES + r) * n + k];
+            auto& constraint = link->mask.GetConstraint(nc);
+            if (r < 3) {
+                for (int j = 0; j < 3; j++) {
+                    double jx = d[(JX + 3 * r + j) * n + k];
+                    constraint.Get_Cq_a()(j) = jx;
+                    constraint.Get_Cq_a()(3 + j) = d[(JR1 + 3 * r + j) * n + k];
+                    constraint.Get_Cq_b()(j) = -jx;
+                    constraint.Get_Cq_b()(3 + j) = d[(JR2 + 3 * r + j) * n + k];
+                }
+            } else {
+                for (int j = 0; j < 3; j++) {
+                    constraint.Get_Cq_a()(j) = 0;
+                    constraint.Get_Cq_a()(3 + j) = d[(JW1 + 3 * (r - 3) + j) * n + k];
+                    constraint.Get_Cq_b()(j) = 0;
+                    constraint.Get_Cq_b()(3 + j) = d[(JW2 + 3 * (r - 3) + j) * n + k];
+                }
+            }
+            nc++;
+        }
+    }
+}
+
+void ChLinkMateBatch::UpdateLocks(double time, int nthreads) {
+    int n = (int)m_locks.size();
+
+    // Same sequence as ChLinkLock::Update (without asset update); each link only modifies its own data
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int k = 0; k < n; k++) {
+        ChLinkLock* link = m_locks[k];
+        link->UpdateTime(time);
+        link->UpdateRelMarkerCoords();
+        link->UpdateState();
+        link->UpdateCqw();
+        link->UpdateForces(time);
+    }
+}
+
+}  // end namespace chrono
@@ -0,0 +1,89 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_LINK_MATE_BATCH_H
+#define CH_LINK_MATE_BATCH_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+class ChLinkBase;
+class ChLinkLock;
+class ChLinkMateGeneric;
+
+/// Batched update of the mate constraints in an assembly.
+/// The constraint residuals and Jacobians of all mate links that use the generic mate update (ChLinkMateGeneric,
+/// ChLinkMateSpherical, ChLinkMateRevolute, ChLinkMatePrismatic, ChLinkMateCylindrical, ChLinkMateParallel, and
+/// ChLinkMateFix) are evaluated in a single pass: the link frames and the states of the connected bodies are gathered
+/// in structure-of-arrays form, the kinematics are computed in one loop over these arrays (suitable for SIMD
+/// vectorization and multithreading), and the results are then scattered to the constraints of each link.
+/// Results agree with those of ChLinkMateGeneric::Update to round-off.
+///
+/// Revolute and spherical joints of the lock formulation (ChLinkLockRevolute and ChLinkLockSpherical) are updated in
+/// the same multithreaded pass. Their marker-based relative kinematics (including marker motions, link forces and
+/// limits) are evaluated with the update of ChLinkLock for each link, so results are identical to those of
+/// ChLinkLock::Update, but these links do not benefit from the structure-of-arrays layout.
+///
+/// The batch is rebuilt at each assembly Setup; links of other types or with overridden updates are not included and
+/// are updated individually.
+class ChApi ChLinkMateBatch {
+  public:
+    ChLinkMateBatch() {}
+    ~ChLinkMateBatch() {}
+
+    /// Remove all entries from the batch.
+    void Clear();
+
+    /// Rebuild the batch from the given list of links.
+    /// Only active links of the supported types, connecting two bodies, are included.
+    void Build(const std::vector<std::shared_ptr<ChLinkBase>>& links);
+
+    /// Return true if the batch is consistent with a list with the given number of links.
+    bool IsValid(size_t num_listed) const { return m_batched.size() == num_listed; }
+
+    /// Return true if the link with specified index in the list used in Build() is included in the batch.
+    bool IsBatched(unsigned int index) const { return m_batched[index] != 0; }
+
+    /// Get the number of links in the batch.
+    unsigned int GetNumLinks() const { return (unsigned int)(m_links.size() + m_locks.size()); }
+
+    /// Update all links in the batch (equivalent to calling Update for each of them).
+    void Update(double time, bool update_assets, int nthreads);
+
+  private:
+    /// Load the current state of the connected bodies.
+    void Gather(int nthreads);
+
+    /// Compute residuals and Jacobians of all links.
+    void Compute(int nthreads);
+
+    /// Load residuals and Jacobians into the constraints of each link.
+    void Scatter(double time, int nthreads);
+
+    /// Update the lock-formulation links in the batch.
+    void UpdateLocks(double time, int nthreads);
+
+    std::vector<ChLinkMateGeneric*> m_links;  ///< mate links in the batch
+    std::vector<ChLinkLock*> m_locks;         ///< lock-formulation links in the batch
+    std::vector<char> m_batched;              ///< flag for each listed link (included in the batch?)
+    std::vector<double> m_data;               ///< mate link data, stored by component (component-major)
+};
+
+}  // end namespace chrono
+
+#endif
@@ -96,6 +96,10 @@ void ChLoad::ComputeQ(ChState* state_x, ChStateDelta* state_w) {
 }
 
 void ChLoad::ComputeJacobian(ChState* state_x, ChStateDelta* state_w) {
+    // Use analytical Jacobians, if provided by the loader
+    if (loader->ComputeJacobians(state_x, state_w, m_jacobians->K, m_jacobians->R))
+        return;
+
     double Delta = 1e-8;
 
     int mrows_w = LoadGetNumCoordsVelLevel();
@@ -175,7 +175,8 @@ class ChApi ChLoad : public ChLoadBase {
                           ) override;
 
     /// Compute the K=-dQ/dx, R=-dQ/dv, M=-dQ/da Jacobians.
-    /// This default implementation uses finite differences for computing the K, R, M matrices if the load is stiff.
+    /// The K and R matrices are provided by the wrapped ChLoader if it implements analytical Jacobians (see
+    /// ChLoader::ComputeJacobians); otherwise, this default implementation uses finite differences.
     /// Note the sign that is flipped because we assume equations are written with Q moved to left-hand side.
     virtual void ComputeJacobian(ChState* state_x,      ///< state position to evaluate Jacobians
                                  ChStateDelta* state_w  ///< state speed to evaluate Jacobians
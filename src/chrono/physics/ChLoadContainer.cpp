@@ -13,14 +13,25 @@
 // =============================================================================
 
 #include "chrono/physics/ChLoadContainer.h"
+#include "chrono/physics/ChSystem.h"
+#include "chrono/utils/ChOpenMP.h"
 
 namespace chrono {
 
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChLoadContainer)
 
+ChLoadContainer::ChLoadContainer() : m_parallel(false) {}
+
 ChLoadContainer::ChLoadContainer(const ChLoadContainer& other) : ChPhysicsItem(other) {
     loadlist = other.loadlist;
+    m_parallel = other.m_parallel;
+}
+
+int ChLoadContainer::GetNumThreadsLoads() const {
+    if (!m_parallel || !GetSystem())
+        return 1;
+    return (int)GetSystem()->GetNumThreadsChrono();
 }
 
 void ChLoadContainer::Add(std::shared_ptr<ChLoadBase> newload) {
@@ -34,7 +45,12 @@ void ChLoadContainer::Add(std::shared_ptr<ChLoadBase> newload) {
 }
 
 void ChLoadContainer::Update(double mytime, bool update_assets) {
-    for (size_t i = 0; i < loadlist.size(); ++i) {
+    // Each load only modifies its own data (generalized forces and Jacobians), so no synchronization is needed.
+    // Dynamic scheduling, as the cost of evaluating a load can vary widely (e.g., stiff vs. non-stiff loads).
+    int nthreads = GetNumThreadsLoads();
+    int num_loads = (int)loadlist.size();
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthreads) if (nthreads > 1 && num_loads > 1)
+    for (int i = 0; i < num_loads; ++i) {
         loadlist[i]->Update(mytime);
     }
     // Overloading of base class:
@@ -45,8 +61,39 @@ void ChLoadContainer::IntLoadResidual_F(const unsigned int off,  // offset in R
                                         ChVectorDynamic<>& R,    // result: the R residual, R += c*F
                                         const double c           // a scaling factor
 ) {
-    for (size_t i = 0; i < loadlist.size(); ++i) {
-        loadlist[i]->LoadIntLoadResidual_F(R, c);
+    int nthreads = GetNumThreadsLoads();
+    int num_loads = (int)loadlist.size();
+
+    // In deterministic mode, loads (already evaluated in parallel) are added to the residual sequentially, in order
+    if (nthreads <= 1 || num_loads <= 1 || GetSystem()->IsDeterministic()) {
+        for (int i = 0; i < num_loads; ++i) {
+            loadlist[i]->LoadIntLoadResidual_F(R, c);
+        }
+        return;
+    }
+
+    // Different loads may act on the same object, so each thread accumulates generalized forces in its own residual
+    // vector. The per-thread vectors are then summed into R, in a fixed thread order.
+    m_R_threads.resize(nthreads);
+    int num_coords = (int)R.size();
+
+#pragma omp parallel num_threads(nthreads)
+    {
+        int num_threads = ChOMP::GetNumThreads();
+        int tid = ChOMP::GetThreadNum();
+        ChVectorDynamic<>& Rt = m_R_threads[tid];
+        Rt.setZero(num_coords);
+
+#pragma omp for schedule(static)
+        for (int i = 0; i < num_loads; ++i) {
+            loadlist[i]->LoadIntLoadResidual_F(Rt, c);
+        }
+
+#pragma omp for schedule(static)
+        for (int i = 0; i < num_coords; i++) {
+            for (int t = 0; t < num_threads; t++)
+                R(i) += m_R_threads[t](i);
+        }
     }
 }
 
@@ -78,7 +125,11 @@ void ChLoadContainer::InjectKRMMatrices(ChSystemDescriptor& descriptor) {
 }
 
 void ChLoadContainer::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
-    for (size_t i = 0; i < loadlist.size(); ++i) {
+    // Each load only modifies its own KRM block, so loads can be processed concurrently
+    int nthreads = GetNumThreadsLoads();
+    int num_loads = (int)loadlist.size();
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1 && num_loads > 1)
+    for (int i = 0; i < num_loads; ++i) {
         loadlist[i]->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
     }
 }
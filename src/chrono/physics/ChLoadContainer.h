@@ -25,7 +25,7 @@ namespace chrono {
 /// container, then  the container is added to a ChSystem.
 class ChApi ChLoadContainer : public ChPhysicsItem {
   public:
-    ChLoadContainer() {}
+    ChLoadContainer();
     ChLoadContainer(const ChLoadContainer& other);
     ~ChLoadContainer() {}
 
@@ -41,6 +41,20 @@ class ChApi ChLoadContainer : public ChPhysicsItem {
     /// Return the number of loads in this container.
     size_t GetNumLoads() const { return loadlist.size(); }
 
+    /// Enable/disable multithreaded evaluation of the loads in this container (default: false).
+    /// If enabled, the loads (generalized forces and, for stiff loads, Jacobians) are evaluated concurrently in
+    /// Update(), using the number of Chrono threads set for the containing system (see ChSystem::SetNumThreads).
+    /// Loading of the generalized forces into the residual is also multithreaded, with each thread accumulating into
+    /// its own residual vector; these are then summed into the system residual. Due to the different order of
+    /// summation, results may differ from those obtained with sequential processing by round-off errors. If the
+    /// containing system is deterministic (see ChSystem::EnableDeterministic), loads are added to the residual
+    /// sequentially. Note that all loads in this container must be thread-safe if this option is enabled (i.e., the
+    /// evaluation of a load must not modify data shared with other loads); this is the case for all Chrono loads.
+    void EnableParallelEvaluation(bool val) { m_parallel = val; }
+
+    /// Return true if multithreaded evaluation of loads is enabled.
+    bool IsParallelEvaluationEnabled() const { return m_parallel; }
+
     virtual void Setup() override {}
 
     virtual void Update(double mytime, bool update_assets = true) override;
@@ -77,7 +91,11 @@ class ChApi ChLoadContainer : public ChPhysicsItem {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   private:
+    int GetNumThreadsLoads() const;
+
     std::vector<std::shared_ptr<ChLoadBase> > loadlist;
+    bool m_parallel;                             ///< use multithreaded load evaluation
+    std::vector<ChVectorDynamic<>> m_R_threads;  ///< per-thread residual accumulators
 };
 
 CH_CLASS_VERSION(ChLoadContainer, 0)
@@ -37,6 +37,19 @@ class ChLoader {
     virtual std::shared_ptr<ChLoadable> GetLoadable() = 0;
 
     virtual bool IsStiff() { return false; }
+
+    /// Compute analytical Jacobians of the generalized load, K = -dQ/dx and R = -dQ/dv (square matrices, of size equal
+    /// to the number of velocity-level coordinates of the loadable). Only called for stiff loaders.
+    /// A derived class providing analytical Jacobians must override this function and return true. The default
+    /// implementation returns false, in which case the Jacobians are obtained through numerical differentiation.
+    virtual bool ComputeJacobians(
+        ChVectorDynamic<>* state_x,  ///< if not null, update state (pos. part) to this, then evaluate Jacobians
+        ChVectorDynamic<>* state_w,  ///< if not null, update state (speed part) to this, then evaluate Jacobians
+        ChMatrixRef K,               ///< result: stiffness matrix K = -dQ/dx
+        ChMatrixRef R                ///< result: damping matrix R = -dQ/dv
+    ) {
+        return false;
+    }
 };
 
 }  // end namespace chrono
@@ -91,7 +91,10 @@ ChLoadNodeXYZNodeXYZ::ChLoadNodeXYZNodeXYZ(std::shared_ptr<ChNodeXYZ> nodeA, std
     computed_abs_force = VNULL;
 }
 
-void ChLoadNodeXYZNodeXYZ::ComputeQ(ChState* state_x, ChStateDelta* state_w) {
+void ChLoadNodeXYZNodeXYZ::GetRelativeState(ChState* state_x,
+                                            ChStateDelta* state_w,
+                                            ChVector3d& rel_pos,
+                                            ChVector3d& rel_vel) {
     auto mnodeA = std::dynamic_pointer_cast<ChNodeXYZ>(this->loadables[0]);
     auto mnodeB = std::dynamic_pointer_cast<ChNodeXYZ>(this->loadables[1]);
 
@@ -118,7 +121,16 @@ void ChLoadNodeXYZNodeXYZ::ComputeQ(ChState* state_x, ChStateDelta* state_w) {
         nodeBpos_dt = mnodeB->GetPosDt();
     }
 
-    ComputeForce((nodeApos - nodeBpos), (nodeApos_dt - nodeBpos_dt), computed_abs_force);
+    rel_pos = nodeApos - nodeBpos;
+    rel_vel = nodeApos_dt - nodeBpos_dt;
+}
+
+void ChLoadNodeXYZNodeXYZ::ComputeQ(ChState* state_x, ChStateDelta* state_w) {
+    ChVector3d rel_pos;
+    ChVector3d rel_vel;
+    GetRelativeState(state_x, state_w, rel_pos, rel_vel);
+
+    ComputeForce(rel_pos, rel_vel, computed_abs_force);
 
     // Compute Q
     load_Q.segment(0, 3) = computed_abs_force.eigen();
@@ -129,6 +141,19 @@ void ChLoadNodeXYZNodeXYZ::Update(double time) {
     ChLoadCustomMultiple::Update(time);
 }
 
+void ChLoadNodeXYZNodeXYZ::LoadRelativeJacobians(const ChMatrix33<>& Kr, const ChMatrix33<>& Rr) {
+    // The force acts on node A and, with opposite sign, on node B
+    m_jacobians->K.block<3, 3>(0, 0) = Kr;
+    m_jacobians->K.block<3, 3>(0, 3) = -Kr;
+    m_jacobians->K.block<3, 3>(3, 0) = -Kr;
+    m_jacobians->K.block<3, 3>(3, 3) = Kr;
+
+    m_jacobians->R.block<3, 3>(0, 0) = Rr;
+    m_jacobians->R.block<3, 3>(0, 3) = -Rr;
+    m_jacobians->R.block<3, 3>(3, 0) = -Rr;
+    m_jacobians->R.block<3, 3>(3, 3) = Rr;
+}
+
 // -----------------------------------------------------------------------------
 // ChLoadNodeXYZNodeXYZSpring
 // -----------------------------------------------------------------------------
@@ -150,6 +175,29 @@ void ChLoadNodeXYZNodeXYZSpring::ComputeForce(const ChVector3d& rel_pos,
     abs_force = (-K * d - R * d_dt) * BA;
 }
 
+void ChLoadNodeXYZNodeXYZSpring::ComputeJacobian(ChState* state_x, ChStateDelta* state_w) {
+    ChVector3d rel_pos;
+    ChVector3d rel_vel;
+    GetRelativeState(state_x, state_w, rel_pos, rel_vel);
+
+    double len = rel_pos.Length();
+    if (len < 1e-20) {
+        // Force direction undefined
+        ChLoadCustomMultiple::ComputeJacobian(state_x, state_w);
+        return;
+    }
+
+    // Force on node A: F = -g * e, with e = rel_pos / len and g = K * (len - d0) + R * (rel_vel . e)
+    ChVector3d e = rel_pos / len;
+    double g = K * (len - d0) + R * Vdot(rel_vel, e);
+    ChMatrix33<> P = ChMatrix33<>(1) - TensorProduct(e, e);
+    ChVector3d Pv = P * rel_vel;
+
+    ChMatrix33<> Kr = K * TensorProduct(e, e) + (g / len) * P + (R / len) * TensorProduct(e, Pv);
+    ChMatrix33<> Rr = R * TensorProduct(e, e);
+    LoadRelativeJacobians(Kr, Rr);
+}
+
 // -----------------------------------------------------------------------------
 // ChLoadNodeXYZNodeXYZBushing
 // -----------------------------------------------------------------------------
@@ -171,6 +219,17 @@ void ChLoadNodeXYZNodeXYZBushing::ComputeForce(const ChVector3d& rel_pos,
                            force_dZ->GetVal(rel_pos.z()) - R.z() * rel_vel.z());
 }
 
+void ChLoadNodeXYZNodeXYZBushing::ComputeJacobian(ChState* state_x, ChStateDelta* state_w) {
+    ChVector3d rel_pos;
+    ChVector3d rel_vel;
+    GetRelativeState(state_x, state_w, rel_pos, rel_vel);
+
+    ChMatrix33<> Kr(ChVector3d(-force_dX->GetDer(rel_pos.x()), -force_dY->GetDer(rel_pos.y()),
+                               -force_dZ->GetDer(rel_pos.z())));
+    ChMatrix33<> Rr(R);
+    LoadRelativeJacobians(Kr, Rr);
+}
+
 // -----------------------------------------------------------------------------
 // ChLoadBodyBody
 // -----------------------------------------------------------------------------
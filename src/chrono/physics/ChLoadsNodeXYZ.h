@@ -183,6 +183,14 @@ class ChApi ChLoadNodeXYZNodeXYZ : public ChLoadCustomMultiple {
 
     virtual void Update(double time) override;
 
+    /// Extract the position and velocity of node A relative to node B, from the given states (if not null) or from
+    /// the current states of the two nodes.
+    void GetRelativeState(ChState* state_x, ChStateDelta* state_w, ChVector3d& rel_pos, ChVector3d& rel_vel);
+
+    /// Load the Jacobians of this load, given the Jacobians of the force on node A with respect to the relative
+    /// position and velocity of node A (Kr = -dF/d(rel_pos), Rr = -dF/d(rel_vel)).
+    void LoadRelativeJacobians(const ChMatrix33<>& Kr, const ChMatrix33<>& Rr);
+
     ChVector3d computed_abs_force;
 };
 
@@ -216,7 +224,7 @@ class ChApi ChLoadNodeXYZNodeXYZSpring : public ChLoadNodeXYZNodeXYZ {
     double GetRestLength() const { return d0; }
 
     /// Declare this load as stiff or non-stiff.
-    /// If set as a stiff load, this enables the automatic computation of the Jacobian through finite differences.
+    /// If set as a stiff load, this enables the computation of the (analytical) Jacobians.
     void SetStiff(bool stiff) { is_stiff = stiff; }
 
   protected:
@@ -226,6 +234,9 @@ class ChApi ChLoadNodeXYZNodeXYZSpring : public ChLoadNodeXYZNodeXYZ {
     bool is_stiff;
 
     virtual bool IsStiff() override { return is_stiff; }
+
+    /// Compute the K=-dQ/dx and R=-dQ/dv Jacobians analytically.
+    virtual void ComputeJacobian(ChState* state_x, ChStateDelta* state_w) override;
 };
 
 /// Load representing an XYZ bushing between two ChNodeXYZ.
@@ -258,7 +269,7 @@ class ChApi ChLoadNodeXYZNodeXYZBushing : public ChLoadNodeXYZNodeXYZ {
     ChVector3d GetDamping() const { return R; }
 
     /// Declare this load as stiff or non-stiff.
-    /// If set as a stiff load, this enables the automatic computation of the Jacobian through finite differences.
+    /// If set as a stiff load, this enables the computation of the (analytical) Jacobians.
     void SetStiff(bool ms) { is_stiff = ms; }
 
   protected:
@@ -270,6 +281,9 @@ class ChApi ChLoadNodeXYZNodeXYZBushing : public ChLoadNodeXYZNodeXYZ {
     bool is_stiff;  ///< flag indicating a stiff/non-stiff load
 
     virtual bool IsStiff() override { return is_stiff; }
+
+    /// Compute the K=-dQ/dx and R=-dQ/dv Jacobians analytically.
+    virtual void ComputeJacobian(ChState* state_x, ChStateDelta* state_w) override;
 };
 
 // -----------------------------------------------------------------------------
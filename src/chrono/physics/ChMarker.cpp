@@ -205,7 +205,7 @@ void ChMarker::UpdateTime(double mytime) {
 void ChMarker::UpdateState() {
     if (!GetBody())
         return;
-    m_abs_frame = GetBody()->TransformLocalToParent(*this);
+    GetBody()->TransformLocalToParent<ChFrameLevel::ACCELERATION>(*this, m_abs_frame);
 }
 
 void ChMarker::Update(double mytime) {
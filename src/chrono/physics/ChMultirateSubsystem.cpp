@@ -0,0 +1,192 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChMultirateSubsystem.h"
+
+namespace chrono {
+
+// -----------------------------------------------------------------------------
+
+// Position extrapolated with constant linear velocity from its value at a given time.
+class ChMultirateSubsystem::ExtrapolatedPosition : public ChFunctionPosition {
+  public:
+    ExtrapolatedPosition() : m_time(0), m_pos(VNULL), m_vel(VNULL) {}
+
+    virtual ExtrapolatedPosition* Clone() const override { return new ExtrapolatedPosition(*this); }
+
+    void Reset(double time, const ChVector3d& pos, const ChVector3d& vel) {
+        m_time = time;
+        m_pos = pos;
+        m_vel = vel;
+    }
+
+    virtual ChVector3d GetPos(double s) const override { return m_pos + (s - m_time) * m_vel; }
+    virtual ChVector3d GetLinVel(double s) const override { return m_vel; }
+    virtual ChVector3d GetLinAcc(double s) const override { return VNULL; }
+
+  private:
+    double m_time;
+    ChVector3d m_pos;
+    ChVector3d m_vel;
+};
+
+// Rotation extrapolated with constant angular velocity (expressed in the absolute frame) from its value at given time.
+class ChMultirateSubsystem::ExtrapolatedRotation : public ChFunctionRotation {
+  public:
+    ExtrapolatedRotation() : m_time(0), m_rot(QUNIT), m_angvel(VNULL) {}
+
+    virtual ExtrapolatedRotation* Clone() const override { return new ExtrapolatedRotation(*this); }
+
+    void Reset(double time, const ChQuaterniond& rot, const ChVector3d& angvel) {
+        m_time = time;
+        m_rot = rot;
+        m_angvel = angvel;
+    }
+
+    virtual ChQuaterniond GetQuat(double s) const override {
+        ChQuaterniond q;
+        q.SetFromRotVec((s - m_time) * m_angvel);
+        return q * m_rot;
+    }
+    virtual ChVector3d GetAngVel(double s) const override { return GetQuat(s).RotateBack(m_angvel); }
+    virtual ChVector3d GetAngAcc(double s) const override { return VNULL; }
+
+  private:
+    double m_time;
+    ChQuaterniond m_rot;
+    ChVector3d m_angvel;
+};
+
+// -----------------------------------------------------------------------------
+
+ChMultirateSubsystem::ChMultirateSubsystem(ChSystem* parent_system, ChSystem* subsystem)
+    : m_parent(parent_system), m_subsystem(subsystem), m_substep(1e-4) {
+    m_ground = chrono_types::make_shared<ChBody>();
+    m_ground->SetFixed(true);
+    m_ground->EnableCollision(false);
+    m_subsystem->AddBody(m_ground);
+}
+
+std::shared_ptr<ChBody> ChMultirateSubsystem::AddInterfaceBody(std::shared_ptr<ChBody> parent_body) {
+    Interface itf;
+    itf.parent = parent_body;
+
+    itf.proxy = chrono_types::make_shared<ChBody>();
+    itf.proxy->SetMass(1);
+    itf.proxy->SetInertiaXX(ChVector3d(1, 1, 1));
+    itf.proxy->SetPos(parent_body->GetPos());
+    itf.proxy->SetRot(parent_body->GetRot());
+    itf.proxy->SetPosDt(parent_body->GetPosDt());
+    itf.proxy->SetAngVelParent(parent_body->GetAngVelParent());
+    itf.proxy->EnableCollision(false);
+    m_subsystem->AddBody(itf.proxy);
+
+    // The imposed motion of the proxy body frame is expressed relative to the (absolute) frame of the fixed body
+    itf.position_fun = chrono_types::make_shared<ExtrapolatedPosition>();
+    itf.rotation_fun = chrono_types::make_shared<ExtrapolatedRotation>();
+    itf.position_fun->Reset(m_subsystem->GetChTime(), parent_body->GetPos(), parent_body->GetPosDt());
+    itf.rotation_fun->Reset(m_subsystem->GetChTime(), parent_body->GetRot(), parent_body->GetAngVelParent());
+
+    itf.motion = chrono_types::make_shared<ChLinkMotionImposed>();
+    itf.motion->Initialize(itf.proxy, m_ground, true, ChFramed(), ChFramed());
+    itf.motion->SetPositionFunction(itf.position_fun);
+    itf.motion->SetRotationFunction(itf.rotation_fun);
+    m_subsystem->AddLink(itf.motion);
+
+    // Interface force and torque, applied at the center of mass of the parent body
+    itf.force_load = chrono_types::make_shared<ChForce>();
+    itf.torque_load = chrono_types::make_shared<ChForce>();
+    parent_body->AddForce(itf.force_load);
+    parent_body->AddForce(itf.torque_load);
+    itf.force_load->SetMode(ChForce::FORCE);
+    itf.force_load->SetAlign(ChForce::WORLD_DIR);
+    itf.force_load->SetMforce(0);
+    itf.torque_load->SetMode(ChForce::TORQUE);
+    itf.torque_load->SetAlign(ChForce::WORLD_DIR);
+    itf.torque_load->SetMforce(0);
+
+    itf.force = VNULL;
+    itf.torque = VNULL;
+
+    m_interfaces.push_back(itf);
+
+    return itf.proxy;
+}
+
+// Set the magnitude and (absolute) direction of a ChForce from the given vector.
+static void SetForceVector(ChForce& force, const ChVector3d& v) {
+    double mag = v.Length();
+    force.SetMforce(mag);
+    if (mag > 0)
+        force.SetDir(v / mag);
+}
+
+int ChMultirateSubsystem::DoStepDynamics(double step) {
+    // Impose on the proxy bodies the motion of the parent bodies, extrapolated from their current states
+    double time = m_subsystem->GetChTime();
+    for (auto& itf : m_interfaces) {
+        const auto& parent = itf.parent;
+        itf.position_fun->Reset(time, parent->GetPos(), parent->GetPosDt());
+        itf.rotation_fun->Reset(time, parent->GetRot(), parent->GetAngVelParent());
+
+        itf.proxy->SetPos(parent->GetPos());
+        itf.proxy->SetRot(parent->GetRot());
+        itf.proxy->SetPosDt(parent->GetPosDt());
+        itf.proxy->SetAngVelParent(parent->GetAngVelParent());
+        itf.proxy->SetPosDt2(VNULL);
+        itf.proxy->SetAngAccParent(VNULL);
+
+        itf.force = VNULL;
+        itf.torque = VNULL;
+    }
+
+    // Advance the subsystem with substeps, accumulating the forces and torques exerted by the subsystem on the proxy
+    // bodies. Since the proxy bodies have no acceleration (and no gyroscopic torque, given their isotropic inertia),
+    // these are the reactions of the motion links on the fixed body, less the weight of the proxy bodies.
+    int num_substeps = (int)std::ceil(step / m_substep - 1e-6);
+    if (num_substeps < 1)
+        num_substeps = 1;
+    double h = step / num_substeps;
+
+    for (int i = 0; i < num_substeps; i++) {
+        m_subsystem->DoStepDynamics(h);
+
+        for (auto& itf : m_interfaces) {
+            auto frame2 = itf.motion->GetFrame2Abs();
+            auto reaction = itf.motion->GetReaction2();
+            itf.force += frame2.TransformDirectionLocalToParent(reaction.force);
+            itf.torque += frame2.TransformDirectionLocalToParent(reaction.torque);
+        }
+    }
+
+    const ChVector3d& g = m_subsystem->GetGravitationalAcceleration();
+    for (auto& itf : m_interfaces) {
+        itf.force = itf.force / num_substeps - itf.proxy->GetMass() * g;
+        itf.torque = itf.torque / num_substeps;
+    }
+
+    // Apply the average interface forces and torques on the parent bodies and advance the parent system
+    for (auto& itf : m_interfaces) {
+        SetForceVector(*itf.force_load, itf.force);
+        SetForceVector(*itf.torque_load, itf.torque);
+    }
+
+    m_parent->DoStepDynamics(step);
+
+    return num_substeps;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,118 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_MULTIRATE_SUBSYSTEM_H
+#define CH_MULTIRATE_SUBSYSTEM_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChForce.h"
+#include "chrono/physics/ChLinkMotionImposed.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+/// Multirate integration of a subsystem coupled to a parent system.
+/// The subsystem (for example, stiff FEA meshes such as tires or cables) is simulated in a separate ChSystem, with its
+/// own step size, timestepper, and solver, and interacts with the parent system only through a set of interface bodies.
+/// For each interface body of the parent system, a proxy body is created in the subsystem; the subsystem components
+/// are attached to the proxy body (e.g., with ChLinkNodeFrame constraints for mesh nodes) as they would be attached to
+/// the parent body in a monolithic model.
+///
+/// At each coarse step of the parent system, DoStepDynamics():
+/// - imposes on each proxy body the motion of its parent body, extrapolated with constant linear and angular velocities
+///   from the state of the parent body at the beginning of the step;
+/// - advances the subsystem over the coarse step with as many substeps as needed (so that the substep does not exceed
+///   the specified substep size), recording the average force and torque exerted by the subsystem on each proxy body;
+/// - applies these interface forces and torques on the parent bodies (at their centers of mass) and advances the parent
+///   system over the coarse step.
+/// This is the same explicit force-displacement coupling scheme used for co-simulation (e.g., with the Chrono::Vehicle
+/// co-simulation framework), but performed in-process. As with any explicit coupling, the coarse step must be small
+/// enough to resolve the interaction between the subsystem and the parent bodies.
+class ChApi ChMultirateSubsystem {
+  public:
+    /// Construct a multirate subsystem coupled to the specified parent system.
+    ChMultirateSubsystem(ChSystem* parent_system,  ///< parent (coarse step) system
+                         ChSystem* subsystem       ///< subsystem integrated with its own substep
+    );
+
+    ~ChMultirateSubsystem() {}
+
+    /// Set the maximum substep size for the subsystem integration (default: 1e-4).
+    void SetSubstepSize(double step) { m_substep = step; }
+
+    /// Get the maximum substep size for the subsystem integration.
+    double GetSubstepSize() const { return m_substep; }
+
+    /// Add an interface body of the parent system.
+    /// A corresponding proxy body, with the same pose and velocity, is created and added to the subsystem. Its motion
+    /// is imposed by the coupling and the subsystem components interacting with the parent body must be attached to it.
+    /// The proxy body has unit mass and unit isotropic inertia; since its imposed motion has constant velocities during
+    /// a coarse step, it generates no inertia forces. The weight of the proxy body is excluded from the interface
+    /// force. Return the proxy body.
+    std::shared_ptr<ChBody> AddInterfaceBody(std::shared_ptr<ChBody> parent_body);
+
+    /// Get the number of interface bodies.
+    unsigned int GetNumInterfaceBodies() const { return (unsigned int)m_interfaces.size(); }
+
+    /// Get the proxy body, in the subsystem, of the specified interface body.
+    std::shared_ptr<ChBody> GetProxyBody(unsigned int i) const { return m_interfaces[i].proxy; }
+
+    /// Get the force exerted by the subsystem on the specified interface body, averaged over the last coarse step.
+    /// The force is expressed in the absolute frame and applied at the body center of mass.
+    const ChVector3d& GetInterfaceForce(unsigned int i) const { return m_interfaces[i].force; }
+
+    /// Get the torque exerted by the subsystem on the specified interface body, averaged over the last coarse step.
+    /// The torque is expressed in the absolute frame.
+    const ChVector3d& GetInterfaceTorque(unsigned int i) const { return m_interfaces[i].torque; }
+
+    /// Advance the coupled simulation by a single coarse step: advance the subsystem (with substeps) over the coarse
+    /// step, then apply the resulting interface forces on the parent bodies and advance the parent system.
+    /// Return the number of substeps taken by the subsystem.
+    int DoStepDynamics(double step);
+
+    /// Get the parent system.
+    ChSystem* GetParentSystem() const { return m_parent; }
+
+    /// Get the subsystem.
+    ChSystem* GetSubsystem() const { return m_subsystem; }
+
+  private:
+    class ExtrapolatedPosition;
+    class ExtrapolatedRotation;
+
+    struct Interface {
+        std::shared_ptr<ChBody> parent;                      ///< interface body in the parent system
+        std::shared_ptr<ChBody> proxy;                       ///< proxy body in the subsystem
+        std::shared_ptr<ChLinkMotionImposed> motion;         ///< link imposing the parent body motion on the proxy
+        std::shared_ptr<ExtrapolatedPosition> position_fun;  ///< imposed position
+        std::shared_ptr<ExtrapolatedRotation> rotation_fun;  ///< imposed rotation
+        std::shared_ptr<ChForce> force_load;                 ///< interface force applied on the parent body
+        std::shared_ptr<ChForce> torque_load;                ///< interface torque applied on the parent body
+        ChVector3d force;                                    ///< average interface force over last step
+        ChVector3d torque;                                   ///< average interface torque over last step
+    };
+
+    ChSystem* m_parent;                   ///< parent system
+    ChSystem* m_subsystem;                ///< subsystem
+    std::shared_ptr<ChBody> m_ground;     ///< fixed body in the subsystem, used by the motion links
+    double m_substep;                     ///< maximum substep size
+    std::vector<Interface> m_interfaces;  ///< interface bodies
+};
+
+}  // end namespace chrono
+
+#endif
@@ -101,6 +101,9 @@ class ChApi ChParticle : public ChParticleBase, public ChContactable_1vars<6> {
                                             const ChVector3d& abs_point,
                                             ChVectorDynamic<>& R) override;
 
+    /// Contact forces on a particle only update the particle coordinates.
+    virtual bool IsContactResidualExclusive() const override { return true; }
+
     /// Compute a contiguous vector of generalized forces Q from a given force & torque at the given point.
     /// Used for computing stiffness matrix (square force jacobian) by backward differentiation.
     /// The force and its application point are specified in the global frame.
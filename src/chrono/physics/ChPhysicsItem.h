@@ -102,6 +102,11 @@ class ChApi ChPhysicsItem : public ChObj {
     /// Return true if the object is active and included in dynamics.
     virtual bool IsActive() const { return true; }
 
+    /// Return an estimate of the memory (in bytes) allocated by this item for its dynamic data.
+    /// This includes the storage of containers owned by the item, but not the size of the object itself.
+    /// Used in ChSystem::GetMemoryReport; by default, returns 0.
+    virtual size_t GetMemoryUsage() const { return 0; }
+
     // Collisions - override these in child classes if needed
 
     /// Tell if the object is subject to collision.
@@ -0,0 +1,223 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "chrono/physics/ChProximityContainerParticles.h"
+
+namespace chrono {
+
+ChProximityContainerParticles::ChProximityContainerParticles(std::shared_ptr<ChParticleCloud> cloud,
+                                                             double cutoff,
+                                                             double skin)
+    : m_cloud(cloud), m_cutoff(cutoff), m_skin(skin), m_valid(false), m_num_rebuilds(0) {
+    assert(cutoff > 0);
+    assert(skin >= 0);
+}
+
+ChProximityContainerParticles::ChProximityContainerParticles(const ChProximityContainerParticles& other)
+    : ChProximityContainer(other),
+      m_cloud(other.m_cloud),
+      m_cutoff(other.m_cutoff),
+      m_skin(other.m_skin),
+      m_force_callback(other.m_force_callback),
+      m_valid(false),
+      m_num_rebuilds(0) {}
+
+void ChProximityContainerParticles::SetCutoffDistance(double cutoff) {
+    assert(cutoff > 0);
+    m_cutoff = cutoff;
+    m_valid = false;
+}
+
+void ChProximityContainerParticles::SetSkinDistance(double skin) {
+    assert(skin >= 0);
+    m_skin = skin;
+    m_valid = false;
+}
+
+void ChProximityContainerParticles::RemoveAllProximities() {
+    m_nbr_start.clear();
+    m_nbr_list.clear();
+    m_valid = false;
+}
+
+bool ChProximityContainerParticles::NeedsRebuild() const {
+    auto num_particles = m_cloud->GetNumParticles();
+    if (!m_valid || m_ref_pos.size() != num_particles)
+        return true;
+
+    double max_disp2 = 0.25 * m_skin * m_skin;
+    for (unsigned int i = 0; i < num_particles; i++) {
+        if ((m_cloud->GetParticlePos(i) - m_ref_pos[i]).Length2() > max_disp2)
+            return true;
+    }
+
+    return false;
+}
+
+// Hash of the integer coordinates of a grid cell, reduced modulo the (power of two) table size.
+static inline unsigned int CellHash(int ix, int iy, int iz, unsigned int mask) {
+    uint32_t h = ((uint32_t)ix * 73856093u) ^ ((uint32_t)iy * 19349663u) ^ ((uint32_t)iz * 83492791u);
+    return h & mask;
+}
+
+void ChProximityContainerParticles::BuildNeighborList() {
+    auto num_particles = (unsigned int)m_cloud->GetNumParticles();
+    double range = m_cutoff + m_skin;
+    double range2 = range * range;
+    double inv_cell = 1 / range;
+
+    // Hash table with a power of two number of buckets, at least twice the number of particles
+    unsigned int num_buckets = 1;
+    while (num_buckets < 2 * num_particles)
+        num_buckets *= 2;
+    unsigned int mask = num_buckets - 1;
+
+    // Assign particles to hash buckets (counting sort)
+    m_ref_pos.resize(num_particles);
+    m_particle_cell.resize(num_particles);
+    m_cell_start.assign(num_buckets + 1, 0);
+    for (unsigned int i = 0; i < num_particles; i++) {
+        const auto& pos = m_cloud->GetParticlePos(i);
+        m_ref_pos[i] = pos;
+        int ix = (int)std::floor(pos.x() * inv_cell);
+        int iy = (int)std::floor(pos.y() * inv_cell);
+        int iz = (int)std::floor(pos.z() * inv_cell);
+        m_particle_cell[i] = CellHash(ix, iy, iz, mask);
+        m_cell_start[m_particle_cell[i] + 1]++;
+    }
+    for (unsigned int b = 0; b < num_buckets; b++)
+        m_cell_start[b + 1] += m_cell_start[b];
+    m_cell_particles.resize(num_particles);
+    {
+        std::vector<unsigned int> fill(m_cell_start.begin(), m_cell_start.end() - 1);
+        for (unsigned int i = 0; i < num_particles; i++)
+            m_cell_particles[fill[m_particle_cell[i]]++] = i;
+    }
+
+    // For each particle, scan the buckets of the 27 surrounding cells (distinct cells may share a bucket)
+    m_nbr_start.resize(num_particles + 1);
+    m_nbr_list.clear();
+    unsigned int buckets[27];
+    for (unsigned int i = 0; i < num_particles; i++) {
+        m_nbr_start[i] = (unsigned int)m_nbr_list.size();
+        const auto& pos = m_ref_pos[i];
+        int ix = (int)std::floor(pos.x() * inv_cell);
+        int iy = (int)std::floor(pos.y() * inv_cell);
+        int iz = (int)std::floor(pos.z() * inv_cell);
+
+        int nb = 0;
+        for (int dx = -1; dx <= 1; dx++)
+            for (int dy = -1; dy <= 1; dy++)
+                for (int dz = -1; dz <= 1; dz++)
+                    buckets[nb++] = CellHash(ix + dx, iy + dy, iz + dz, mask);
+        std::sort(buckets, buckets + nb);
+        nb = (int)(std::unique(buckets, buckets + nb) - buckets);
+
+        for (int k = 0; k < nb; k++) {
+            for (unsigned int s = m_cell_start[buckets[k]]; s < m_cell_start[buckets[k] + 1]; s++) {
+                unsigned int j = m_cell_particles[s];
+                if (j > i && (m_ref_pos[j] - pos).Length2() <= range2)
+                    m_nbr_list.push_back(j);
+            }
+        }
+    }
+    m_nbr_start[num_particles] = (unsigned int)m_nbr_list.size();
+
+    m_valid = true;
+    m_num_rebuilds++;
+}
+
+void ChProximityContainerParticles::Update(double mytime, bool update_assets) {
+    ChProximityContainer::Update(mytime, update_assets);
+
+    if (NeedsRebuild())
+        BuildNeighborList();
+}
+
+int ChProximityContainerParticles::GetNproximities() const {
+    if (!m_valid)
+        return 0;
+
+    double cutoff2 = m_cutoff * m_cutoff;
+    int count = 0;
+    auto num_particles = (unsigned int)m_ref_pos.size();
+    for (unsigned int i = 0; i < num_particles; i++) {
+        for (unsigned int k = m_nbr_start[i]; k < m_nbr_start[i + 1]; k++) {
+            if ((m_cloud->GetParticlePos(m_nbr_list[k]) - m_cloud->GetParticlePos(i)).Length2() <= cutoff2)
+                count++;
+        }
+    }
+
+    return count;
+}
+
+void ChProximityContainerParticles::ReportAllPairs(ReportPairCallback* callback) const {
+    if (!m_valid)
+        return;
+
+    double cutoff2 = m_cutoff * m_cutoff;
+    auto num_particles = (unsigned int)m_ref_pos.size();
+    for (unsigned int i = 0; i < num_particles; i++) {
+        for (unsigned int k = m_nbr_start[i]; k < m_nbr_start[i + 1]; k++) {
+            unsigned int j = m_nbr_list[k];
+            ChVector3d rel_pos = m_cloud->GetParticlePos(j) - m_cloud->GetParticlePos(i);
+            if (rel_pos.Length2() <= cutoff2) {
+                if (!callback->OnReportPair(i, j, rel_pos))
+                    return;
+            }
+        }
+    }
+}
+
+void ChProximityContainerParticles::ReportAllProximities(ReportProximityCallback* callback) {
+    class PairReporter : public ReportPairCallback {
+      public:
+        PairReporter(ReportProximityCallback* callback) : m_callback(callback) {}
+        virtual bool OnReportPair(unsigned int i, unsigned int j, const ChVector3d& rel_pos) override {
+            return m_callback->OnReportProximity(nullptr, nullptr);
+        }
+        ReportProximityCallback* m_callback;
+    };
+
+    PairReporter reporter(callback);
+    ReportAllPairs(&reporter);
+}
+
+void ChProximityContainerParticles::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
+    if (!m_force_callback || !m_valid || !m_cloud->IsActive())
+        return;
+
+    double cutoff2 = m_cutoff * m_cutoff;
+    auto num_particles = (unsigned int)m_ref_pos.size();
+    for (unsigned int i = 0; i < num_particles; i++) {
+        auto& particle_i = static_cast<ChParticle&>(m_cloud->Particle(i));
+        for (unsigned int k = m_nbr_start[i]; k < m_nbr_start[i + 1]; k++) {
+            unsigned int j = m_nbr_list[k];
+            auto& particle_j = static_cast<ChParticle&>(m_cloud->Particle(j));
+            ChVector3d rel_pos = particle_j.GetPos() - particle_i.GetPos();
+            if (rel_pos.Length2() > cutoff2)
+                continue;
+            ChVector3d rel_vel = particle_j.GetPosDt() - particle_i.GetPosDt();
+            ChVector3d force = c * m_force_callback->CalculateForce(*m_cloud, i, j, rel_pos, rel_vel);
+            R.segment(particle_i.Variables().GetOffset(), 3) -= force.eigen();
+            R.segment(particle_j.Variables().GetOffset(), 3) += force.eigen();
+        }
+    }
+}
+
+}  // end namespace chrono
@@ -0,0 +1,153 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_PROXIMITY_CONTAINER_PARTICLES_H
+#define CH_PROXIMITY_CONTAINER_PARTICLES_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/physics/ChParticleCloud.h"
+#include "chrono/physics/ChProximityContainer.h"
+
+namespace chrono {
+
+/// Proximity container for pairwise interactions between the particles of a ChParticleCloud.
+/// Unlike other proximity containers, this container does not rely on the collision system and does not require
+/// collision models for the particles. Instead, it maintains a Verlet neighbor list, i.e. the list of all particle
+/// pairs with center distance smaller than the cutoff distance plus a skin distance. The neighbor list is built in O(N)
+/// time with a hashed cell list (with cells of size equal to the cutoff plus skin) and is only rebuilt when the maximum
+/// particle displacement since the last build exceeds half the skin distance. Until then, the neighbor list is
+/// guaranteed to contain all pairs within the cutoff distance. Particle pairs currently within the cutoff distance are
+/// the proximity pairs of this container. If a pair force callback is provided, the resulting pairwise forces are
+/// applied at the particle centers.
+class ChApi ChProximityContainerParticles : public ChProximityContainer {
+  public:
+    /// Class to be used as a callback interface for calculating the interaction force between two particles.
+    class ChApi PairForceCallback {
+      public:
+        virtual ~PairForceCallback() {}
+
+        /// Return the force exerted by the first particle on the second one (expressed in the absolute frame).
+        /// The opposite force is applied to the first particle. Only called for pairs within the cutoff distance.
+        virtual ChVector3d CalculateForce(const ChParticleCloud& cloud,  ///< particle cloud
+                                          unsigned int i,                ///< index of first particle
+                                          unsigned int j,                ///< index of second particle
+                                          const ChVector3d& rel_pos,     ///< position of j relative to i
+                                          const ChVector3d& rel_vel      ///< velocity of j relative to i
+                                          ) = 0;
+    };
+
+    /// Class to be used as a callback interface for reporting particle pairs within the cutoff distance.
+    class ChApi ReportPairCallback {
+      public:
+        virtual ~ReportPairCallback() {}
+
+        /// Callback used to report a pair of particles within the cutoff distance.
+        /// If it returns false, the scanning of pairs will be stopped.
+        virtual bool OnReportPair(unsigned int i,            ///< index of first particle
+                                  unsigned int j,            ///< index of second particle
+                                  const ChVector3d& rel_pos  ///< position of j relative to i
+                                  ) = 0;
+    };
+
+    ChProximityContainerParticles(std::shared_ptr<ChParticleCloud> cloud,  ///< associated particle cloud
+                                  double cutoff,                           ///< interaction cutoff distance
+                                  double skin                              ///< Verlet list skin distance
+    );
+    ChProximityContainerParticles(const ChProximityContainerParticles& other);
+    ~ChProximityContainerParticles() {}
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChProximityContainerParticles* Clone() const override { return new ChProximityContainerParticles(*this); }
+
+    /// Get the associated particle cloud.
+    std::shared_ptr<ChParticleCloud> GetParticleCloud() const { return m_cloud; }
+
+    /// Set the cutoff distance (maximum distance between particle centers for interacting particles).
+    /// This forces a rebuild of the neighbor list at the next update.
+    void SetCutoffDistance(double cutoff);
+
+    /// Get the cutoff distance.
+    double GetCutoffDistance() const { return m_cutoff; }
+
+    /// Set the skin distance of the Verlet neighbor list.
+    /// A larger skin results in fewer rebuilds, but longer neighbor lists.
+    /// This forces a rebuild of the neighbor list at the next update.
+    void SetSkinDistance(double skin);
+
+    /// Get the skin distance of the Verlet neighbor list.
+    double GetSkinDistance() const { return m_skin; }
+
+    /// Set the callback object for calculating pairwise interaction forces.
+    void RegisterPairForceCallback(std::shared_ptr<PairForceCallback> callback) { m_force_callback = callback; }
+
+    /// Return the number of particle pairs currently within the cutoff distance.
+    virtual int GetNproximities() const override;
+
+    /// Return the number of particle pairs in the Verlet neighbor list.
+    size_t GetNumNeighborPairs() const { return m_nbr_list.size(); }
+
+    /// Return the number of times the neighbor list was (re)built.
+    unsigned int GetNumRebuilds() const { return m_num_rebuilds; }
+
+    /// Clear the neighbor list, forcing a rebuild at the next update.
+    virtual void RemoveAllProximities() override;
+
+    /// The collision system does not contribute to this container; the neighbor list is maintained in Update().
+    virtual void BeginAddProximities() override {}
+
+    /// The collision system does not contribute to this container (particle clouds have no collision models here).
+    virtual void AddProximity(ChCollisionModel* modA, ChCollisionModel* modB) override {}
+
+    /// Report all particle pairs within the cutoff distance (with null collision models, which these particles do not
+    /// use). Prefer ReportAllPairs, which provides the particle indices.
+    virtual void ReportAllProximities(ReportProximityCallback* callback) override;
+
+    /// Report all particle pairs within the cutoff distance.
+    void ReportAllPairs(ReportPairCallback* callback) const;
+
+    /// Update the neighbor list, rebuilding it if the maximum particle displacement exceeds half the skin distance.
+    virtual void Update(double mytime, bool update_assets = true) override;
+
+    // STATE FUNCTIONS
+
+    virtual void IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) override;
+
+  private:
+    /// Rebuild the Verlet neighbor list using a hashed cell list.
+    void BuildNeighborList();
+
+    /// Return true if the neighbor list must be rebuilt.
+    bool NeedsRebuild() const;
+
+    std::shared_ptr<ChParticleCloud> m_cloud;  ///< associated particle cloud
+    double m_cutoff;                           ///< interaction cutoff distance
+    double m_skin;                             ///< Verlet list skin distance
+
+    std::shared_ptr<PairForceCallback> m_force_callback;  ///< pairwise force calculation
+
+    std::vector<ChVector3d> m_ref_pos;          ///< particle positions at last build
+    std::vector<unsigned int> m_nbr_start;      ///< start of neighbors of each particle in the neighbor list
+    std::vector<unsigned int> m_nbr_list;       ///< neighbors (with larger index) of each particle
+    std::vector<unsigned int> m_cell_start;     ///< start of each hash bucket in the sorted particle list
+    std::vector<unsigned int> m_cell_particles; ///< particle indices, sorted by hash bucket
+    std::vector<unsigned int> m_particle_cell;  ///< hash bucket of each particle
+    bool m_valid;                               ///< neighbor list is valid
+    unsigned int m_num_rebuilds;                ///< number of neighbor list builds
+};
+
+}  // end namespace chrono
+
+#endif
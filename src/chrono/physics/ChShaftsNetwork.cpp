@@ -0,0 +1,480 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <Eigen/LU>
+#include <Eigen/QR>
+
+#include "chrono/physics/ChShaftsNetwork.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChShaftsNetwork)
+
+ChShaftsNetwork::ChShaftsNetwork() : m_active(true), m_initialized(false), m_nint(0), m_nred(0) {}
+
+int ChShaftsNetwork::AddShaft(double inertia, double speed) {
+    assert(!m_initialized);
+    assert(inertia > 0);
+
+    m_int_index.push_back((int)m_nint++);
+    m_inertia.push_back(inertia);
+    m_speed0.push_back(speed);
+    m_ext.push_back(nullptr);
+    m_load.push_back(0);
+
+    return (int)m_ext.size() - 1;
+}
+
+int ChShaftsNetwork::AddShaft(std::shared_ptr<ChShaft> shaft) {
+    assert(!m_initialized);
+    assert(shaft);
+
+    m_int_index.push_back(-1);
+    m_inertia.push_back(0);
+    m_speed0.push_back(0);
+    m_ext.push_back(shaft);
+    m_load.push_back(0);
+
+    return (int)m_ext.size() - 1;
+}
+
+void ChShaftsNetwork::AddGear(int shaft1, int shaft2, double t) {
+    assert(!m_initialized);
+
+    Coupling coupling;
+    coupling.shafts = {shaft1, shaft2};
+    coupling.coefs = {t, -1.0};
+    coupling.is_lock = false;
+    coupling.locked = false;
+    m_couplings.push_back(coupling);
+}
+
+void ChShaftsNetwork::AddPlanetary(int shaft1, int shaft2, int shaft3, double t0) {
+    assert(!m_initialized);
+
+    Coupling coupling;
+    coupling.shafts = {shaft1, shaft2, shaft3};
+    coupling.coefs = {1 - t0, t0, -1.0};
+    coupling.is_lock = false;
+    coupling.locked = false;
+    m_couplings.push_back(coupling);
+}
+
+int ChShaftsNetwork::AddLock(int shaft1, int shaft2) {
+    assert(!m_initialized);
+
+    Coupling coupling;
+    coupling.shafts = {shaft1, shaft2};
+    coupling.coefs = {1.0, -1.0};
+    coupling.is_lock = true;
+    coupling.locked = false;
+    m_couplings.push_back(coupling);
+
+    return (int)m_couplings.size() - 1;
+}
+
+void ChShaftsNetwork::SetLocked(int lock, bool val) {
+    auto& coupling = m_couplings[lock];
+    assert(coupling.is_lock);
+
+    if (val == coupling.locked)
+        return;
+
+    coupling.locked = val;
+
+    // Capture the current relative phase, so that the lock does not pull the shafts back
+    if (val && m_initialized) {
+        coupling.phase = 0;
+        coupling.phase = EvalPositionCoupling(coupling);
+        coupling.reaction = 0;
+    }
+}
+
+bool ChShaftsNetwork::IsLocked(int lock) const {
+    return m_couplings[lock].locked;
+}
+
+void ChShaftsNetwork::Initialize() {
+    if (m_nint == 0)
+        throw std::runtime_error("ChShaftsNetwork: no internal shafts");
+
+    // Collect the internal coupling equations (rigid couplings between internal shafts only)
+    std::vector<int> internal_rows;
+    for (int k = 0; k < (int)m_couplings.size(); k++) {
+        auto& coupling = m_couplings[k];
+        coupling.internal = !coupling.is_lock;
+        for (auto i : coupling.shafts) {
+            if (m_int_index[i] < 0)
+                coupling.internal = false;
+        }
+        if (coupling.internal)
+            internal_rows.push_back(k);
+    }
+
+    // Basis for the null space of the internal coupling equations.
+    // The basis is orthonormalized for a well-conditioned reduced mass matrix.
+    if (internal_rows.empty()) {
+        m_N.setIdentity(m_nint, m_nint);
+    } else {
+        ChMatrixDynamic<> A(internal_rows.size(), m_nint);
+        A.setZero();
+        for (int r = 0; r < (int)internal_rows.size(); r++) {
+            const auto& coupling = m_couplings[internal_rows[r]];
+            for (size_t j = 0; j < coupling.shafts.size(); j++)
+                A(r, m_int_index[coupling.shafts[j]]) += coupling.coefs[j];
+        }
+
+        Eigen::FullPivLU<ChMatrixDynamic<>> lu(A);
+        if (lu.dimensionOfKernel() == 0)
+            throw std::runtime_error("ChShaftsNetwork: internal couplings leave no degrees of freedom");
+
+        ChMatrixDynamic<> kernel = lu.kernel();
+        Eigen::HouseholderQR<ChMatrixDynamic<>> qr(kernel);
+        m_N = qr.householderQ() * ChMatrixDynamic<>::Identity(m_nint, kernel.cols());
+    }
+    m_nred = (unsigned int)m_N.cols();
+
+    // Reduced mass matrix and reduced initial speeds (mass-weighted projection of the specified speeds)
+    ChVectorDynamic<> J(m_nint);
+    ChVectorDynamic<> w0(m_nint);
+    for (size_t i = 0; i < m_ext.size(); i++) {
+        if (m_int_index[i] >= 0) {
+            J(m_int_index[i]) = m_inertia[i];
+            w0(m_int_index[i]) = m_speed0[i];
+        }
+    }
+    ChMatrixDynamic<> M = m_N.transpose() * J.asDiagonal() * m_N;
+    ChMatrixDynamic<> Minv = M.inverse();
+
+    m_variables = ChVariablesGeneric(m_nred);
+    m_variables.GetMass() = M;
+    m_variables.GetInvMass() = Minv;
+
+    m_pos.setZero(m_nred);
+    m_pos_dt = Minv * (m_N.transpose() * J.asDiagonal() * w0);
+    m_pos_dtdt.setZero(m_nred);
+
+    m_load_red.setZero(m_nred);
+    for (size_t i = 0; i < m_ext.size(); i++) {
+        if (m_int_index[i] >= 0)
+            m_load_red += m_load[i] * m_N.row(m_int_index[i]).transpose();
+    }
+
+    // Boundary couplings and locks
+    for (auto& coupling : m_couplings) {
+        if (coupling.internal)
+            continue;
+
+        std::vector<ChVariables*> vars = {&m_variables};
+        coupling.cq_red.setZero(m_nred);
+        for (size_t j = 0; j < coupling.shafts.size(); j++) {
+            int i = coupling.shafts[j];
+            if (m_int_index[i] >= 0)
+                coupling.cq_red += coupling.coefs[j] * m_N.row(m_int_index[i]);
+            else
+                vars.push_back(&m_ext[i]->Variables());
+        }
+        coupling.constraint.SetVariables(vars);
+
+        coupling.phase = 0;
+        coupling.phase = EvalPositionCoupling(coupling);
+        coupling.reaction = 0;
+    }
+
+    m_initialized = true;
+}
+
+void ChShaftsNetwork::SetAppliedLoad(int shaft, double torque) {
+    assert(m_int_index[shaft] >= 0);
+
+    // Keep the generalized forces on the reduced coordinates in sync
+    if (m_initialized)
+        m_load_red += (torque - m_load[shaft]) * m_N.row(m_int_index[shaft]).transpose();
+    m_load[shaft] = torque;
+}
+
+double ChShaftsNetwork::GetShaftSpeed(int shaft) const {
+    if (m_int_index[shaft] < 0)
+        return m_ext[shaft]->GetPosDt();
+    return m_N.row(m_int_index[shaft]) * m_pos_dt;
+}
+
+double ChShaftsNetwork::GetReactionTorque(int shaft) const {
+    double torque = 0;
+    for (const auto& coupling : m_couplings) {
+        if (!IsCouplingEnabled(coupling))
+            continue;
+        for (size_t j = 0; j < coupling.shafts.size(); j++) {
+            if (coupling.shafts[j] == shaft)
+                torque += coupling.coefs[j] * coupling.reaction;
+        }
+    }
+    return torque;
+}
+
+bool ChShaftsNetwork::IsCouplingEnabled(const Coupling& coupling) const {
+    return m_active && !coupling.internal && (!coupling.is_lock || coupling.locked);
+}
+
+double ChShaftsNetwork::EvalPositionCoupling(const Coupling& coupling) const {
+    double res = coupling.cq_red * m_pos;
+    for (size_t j = 0; j < coupling.shafts.size(); j++) {
+        int i = coupling.shafts[j];
+        if (m_int_index[i] < 0)
+            res += coupling.coefs[j] * m_ext[i]->GetPos();
+    }
+    return res - coupling.phase;
+}
+
+unsigned int ChShaftsNetwork::GetNumConstraintsBilateral() {
+    unsigned int n = 0;
+    for (const auto& coupling : m_couplings) {
+        if (IsCouplingEnabled(coupling))
+            n++;
+    }
+    return n;
+}
+
+void ChShaftsNetwork::Update(double time, bool update_assets) {
+    // Inherit time changes of parent class
+    ChPhysicsItem::Update(time, update_assets);
+}
+
+// -----------------------------------------------------------------------------
+
+void ChShaftsNetwork::IntStateGather(const unsigned int off_x,
+                                     ChState& x,
+                                     const unsigned int off_v,
+                                     ChStateDelta& v,
+                                     double& T) {
+    x.segment(off_x, m_nred) = m_pos;
+    v.segment(off_v, m_nred) = m_pos_dt;
+    T = GetChTime();
+}
+
+void ChShaftsNetwork::IntStateScatter(const unsigned int off_x,
+                                      const ChState& x,
+                                      const unsigned int off_v,
+                                      const ChStateDelta& v,
+                                      const double T,
+                                      bool full_update) {
+    m_pos = x.segment(off_x, m_nred);
+    m_pos_dt = v.segment(off_v, m_nred);
+    Update(T, full_update);
+}
+
+void ChShaftsNetwork::IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) {
+    a.segment(off_a, m_nred) = m_pos_dtdt;
+}
+
+void ChShaftsNetwork::IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) {
+    m_pos_dtdt = a.segment(off_a, m_nred);
+}
+
+void ChShaftsNetwork::IntStateGatherReactions(const unsigned int off_L, ChVectorDynamic<>& L) {
+    unsigned int k = 0;
+    for (const auto& coupling : m_couplings) {
+        if (IsCouplingEnabled(coupling))
+            L(off_L + k++) = coupling.reaction;
+    }
+}
+
+void ChShaftsNetwork::IntStateScatterReactions(const unsigned int off_L, const ChVectorDynamic<>& L) {
+    unsigned int k = 0;
+    for (auto& coupling : m_couplings) {
+        if (IsCouplingEnabled(coupling))
+            coupling.reaction = L(off_L + k++);
+    }
+}
+
+void ChShaftsNetwork::IntLoadResidual_F(const unsigned int off,  // offset in R residual
+                                        ChVectorDynamic<>& R,    // result: the R residual, R += c*F
+                                        const double c           // a scaling factor
+) {
+    R.segment(off, m_nred) += c * m_load_red;
+}
+
+void ChShaftsNetwork::IntLoadResidual_Mv(const unsigned int off,      // offset in R residual
+                                         ChVectorDynamic<>& R,        // result: the R residual, R += c*M*v
+                                         const ChVectorDynamic<>& w,  // the w vector
+                                         const double c               // a scaling factor
+) {
+    R.segment(off, m_nred) += c * (m_variables.GetMass() * w.segment(off, m_nred));
+}
+
+void ChShaftsNetwork::IntLoadLumpedMass_Md(const unsigned int off,
+                                           ChVectorDynamic<>& Md,
+                                           double& err,
+                                           const double c) {
+    const auto& M = m_variables.GetMass();
+    Md.segment(off, m_nred) += c * M.diagonal();
+    err += c * (M.cwiseAbs().sum() - M.diagonal().cwiseAbs().sum());
+}
+
+void ChShaftsNetwork::IntLoadResidual_CqL(const unsigned int off_L,    // offset in L multipliers
+                                          ChVectorDynamic<>& R,        // result: the R residual, R += c*Cq'*L
+                                          const ChVectorDynamic<>& L,  // the L vector
+                                          const double c               // a scaling factor
+) {
+    unsigned int k = 0;
+    for (auto& coupling : m_couplings) {
+        if (IsCouplingEnabled(coupling))
+            coupling.constraint.AddJacobianTransposedTimesScalarInto(R, L(off_L + k++) * c);
+    }
+}
+
+void ChShaftsNetwork::IntLoadConstraint_C(const unsigned int off_L,  // offset in Qc residual
+                                          ChVectorDynamic<>& Qc,     // result: the Qc residual, Qc += c*C
+                                          const double c,            // a scaling factor
+                                          bool do_clamp,             // apply clamping to c*C?
+                                          double recovery_clamp      // value for min/max clamping of c*C
+) {
+    unsigned int k = 0;
+    for (const auto& coupling : m_couplings) {
+        if (!IsCouplingEnabled(coupling))
+            continue;
+
+        double cnstr_violation = c * EvalPositionCoupling(coupling);
+        if (do_clamp)
+            cnstr_violation = std::min(std::max(cnstr_violation, -recovery_clamp), recovery_clamp);
+
+        Qc(off_L + k++) += cnstr_violation;
+    }
+}
+
+void ChShaftsNetwork::IntToDescriptor(const unsigned int off_v,  // offset in v, R
+                                      const ChStateDelta& v,
+                                      const ChVectorDynamic<>& R,
+                                      const unsigned int off_L,  // offset in L, Qc
+                                      const ChVectorDynamic<>& L,
+                                      const ChVectorDynamic<>& Qc) {
+    m_variables.State() = v.segment(off_v, m_nred);
+    m_variables.Force() = R.segment(off_v, m_nred);
+
+    unsigned int k = 0;
+    for (auto& coupling : m_couplings) {
+        if (!IsCouplingEnabled(coupling))
+            continue;
+        coupling.constraint.SetLagrangeMultiplier(L(off_L + k));
+        coupling.constraint.SetRightHandSide(Qc(off_L + k));
+        k++;
+    }
+}
+
+void ChShaftsNetwork::IntFromDescriptor(const unsigned int off_v,  // offset in v
+                                        ChStateDelta& v,
+                                        const unsigned int off_L,  // offset in L
+                                        ChVectorDynamic<>& L) {
+    v.segment(off_v, m_nred) = m_variables.State();
+
+    unsigned int k = 0;
+    for (auto& coupling : m_couplings) {
+        if (IsCouplingEnabled(coupling))
+            L(off_L + k++) = coupling.constraint.GetLagrangeMultiplier();
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void ChShaftsNetwork::InjectVariables(ChSystemDescriptor& descriptor) {
+    m_variables.SetDisabled(!IsActive());
+
+    descriptor.InsertVariables(&m_variables);
+}
+
+void ChShaftsNetwork::InjectConstraints(ChSystemDescriptor& descriptor) {
+    for (auto& coupling : m_couplings) {
+        if (IsCouplingEnabled(coupling))
+            descriptor.InsertConstraint(&coupling.constraint);
+    }
+}
+
+void ChShaftsNetwork::LoadConstraintJacobians() {
+    for (auto& coupling : m_couplings) {
+        if (coupling.internal)
+            continue;
+
+        coupling.constraint.Get_Cq_N(0) = coupling.cq_red;
+        size_t n = 1;
+        for (size_t j = 0; j < coupling.shafts.size(); j++) {
+            if (m_int_index[coupling.shafts[j]] < 0)
+                coupling.constraint.Get_Cq_N(n++)(0) = coupling.coefs[j];
+        }
+    }
+}
+
+void ChShaftsNetwork::VariablesFbReset() {
+    m_variables.Force().setZero();
+}
+
+void ChShaftsNetwork::VariablesFbLoadForces(double factor) {
+    m_variables.Force() += factor * m_load_red;
+}
+
+void ChShaftsNetwork::VariablesQbLoadSpeed() {
+    m_variables.State() = m_pos_dt;
+}
+
+void ChShaftsNetwork::VariablesFbIncrementMq() {
+    m_variables.AddMassTimesVector(m_variables.Force(), m_variables.State());
+}
+
+void ChShaftsNetwork::VariablesQbSetSpeed(double step) {
+    ChVectorDynamic<> old_dt = m_pos_dt;
+    m_pos_dt = m_variables.State();
+    if (step)
+        m_pos_dtdt = (m_pos_dt - old_dt) / step;
+}
+
+void ChShaftsNetwork::VariablesQbIncrementPosition(double step) {
+    if (!IsActive())
+        return;
+
+    m_pos += step * m_variables.State();
+}
+
+void ChShaftsNetwork::ConstraintsBiReset() {
+    for (auto& coupling : m_couplings) {
+        if (!coupling.internal)
+            coupling.constraint.SetRightHandSide(0.);
+    }
+}
+
+void ChShaftsNetwork::ConstraintsBiLoad_C(double factor, double recovery_clamp, bool do_clamp) {
+    for (auto& coupling : m_couplings) {
+        if (!IsCouplingEnabled(coupling))
+            continue;
+
+        double cnstr_violation = factor * EvalPositionCoupling(coupling);
+        if (do_clamp)
+            cnstr_violation = std::min(std::max(cnstr_violation, -recovery_clamp), recovery_clamp);
+
+        coupling.constraint.SetRightHandSide(coupling.constraint.GetRightHandSide() + cnstr_violation);
+    }
+}
+
+void ChShaftsNetwork::ConstraintsFetch_react(double factor) {
+    for (auto& coupling : m_couplings) {
+        if (IsCouplingEnabled(coupling))
+            coupling.reaction = coupling.constraint.GetLagrangeMultiplier() * factor;
+    }
+}
+
+}  // end namespace chrono
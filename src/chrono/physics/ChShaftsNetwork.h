@@ -0,0 +1,212 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHSHAFTSNETWORK_H
+#define CHSHAFTSNETWORK_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/physics/ChPhysicsItem.h"
+#include "chrono/physics/ChShaft.h"
+#include "chrono/solver/ChConstraintNgeneric.h"
+#include "chrono/solver/ChVariablesGeneric.h"
+
+namespace chrono {
+
+/// Reduced model of a network of one-degree-of-freedom parts connected by ideal linear couplings.
+/// A shaft network (e.g., a vehicle driveline) consists of internal shafts, owned by the network, and external shafts,
+/// i.e. ChShaft objects in the containing system (e.g., wheel axles). Couplings are linear relations between shaft
+/// speeds (gears, planetary gears, optional locks).
+///
+/// At initialization, the couplings involving only internal shafts are eliminated: the internal shaft speeds are
+/// expressed as w = N * y in terms of a minimal set of reduced coordinates y, with N a basis for the null space of
+/// the internal coupling equations. The entire set of internal shafts is then represented in the containing system by
+/// a single block of variables, with the dense mass matrix N' * J * N, while only the couplings involving external
+/// shafts (and the enabled locks) are added to the system as constraints. Compared to a model of the same network with
+/// ChShaft, ChShaftsGear, and ChShaftsPlanetary objects, this reduces the number of variables and constraints in the
+/// system-level problem.
+///
+/// Notes:
+/// - couplings are rigid; torque-limited devices (e.g., clutches) must be modeled with separate elements between
+///   external shafts;
+/// - internal couplings are not reported to any truss body (e.g., the reaction torque of an angled gearbox on its
+///   support is not modeled).
+class ChApi ChShaftsNetwork : public ChPhysicsItem {
+  public:
+    ChShaftsNetwork();
+    ~ChShaftsNetwork() {}
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChShaftsNetwork* Clone() const override { return new ChShaftsNetwork(*this); }
+
+    /// Add an internal shaft with the given inertia and initial speed.
+    /// Return the index of the shaft in this network.
+    int AddShaft(double inertia, double speed = 0);
+
+    /// Add an external shaft.
+    /// The shaft must be part of the same system as this network. Return the index of the shaft in this network.
+    int AddShaft(std::shared_ptr<ChShaft> shaft);
+
+    /// Add a gear between the two specified shafts, as in w2 = t * w1 (see ChShaftsGear).
+    void AddGear(int shaft1, int shaft2, double t);
+
+    /// Add a planetary gear between the specified shafts (carrier, wheel, wheel), given the transmission ratio t0 of
+    /// the equivalent ordinary gearbox (see ChShaftsPlanetary). For a differential, t0 = -1.
+    void AddPlanetary(int shaft1, int shaft2, int shaft3, double t0);
+
+    /// Add a lock between the two specified shafts (initially disengaged).
+    /// When engaged, a lock imposes w1 = w2. Return the index of the lock.
+    int AddLock(int shaft1, int shaft2);
+
+    /// Engage/disengage the specified lock.
+    void SetLocked(int lock, bool val);
+
+    /// Return true if the specified lock is engaged.
+    bool IsLocked(int lock) const;
+
+    /// Assemble the reduced model.
+    /// Must be called after all shafts and couplings were added and before the network is added to a system.
+    /// Initial speeds of the internal shafts are projected onto the set of speeds consistent with the couplings.
+    void Initialize();
+
+    /// Disable this network (disable all couplings with external shafts).
+    void SetDisabled(bool val) { m_active = !val; }
+
+    /// Get the number of reduced coordinates.
+    unsigned int GetNumReducedCoords() const { return m_nred; }
+
+    /// Set the torque applied to the specified internal shaft.
+    void SetAppliedLoad(int shaft, double torque);
+
+    /// Get the speed of the specified shaft (internal or external).
+    double GetShaftSpeed(int shaft) const;
+
+    /// Get the total torque applied by the network couplings to the specified external shaft.
+    double GetReactionTorque(int shaft) const;
+
+    /// Access the variables for the reduced coordinates.
+    ChVariables& Variables() { return m_variables; }
+
+    // Physics item functions
+
+    virtual unsigned int GetNumCoordsPosLevel() override { return m_nred; }
+    virtual unsigned int GetNumConstraintsBilateral() override;
+
+    virtual void Update(double time, bool update_assets = true) override;
+
+    // State functions
+
+    virtual void IntStateGather(const unsigned int off_x,
+                                ChState& x,
+                                const unsigned int off_v,
+                                ChStateDelta& v,
+                                double& T) override;
+    virtual void IntStateScatter(const unsigned int off_x,
+                                 const ChState& x,
+                                 const unsigned int off_v,
+                                 const ChStateDelta& v,
+                                 const double T,
+                                 bool full_update) override;
+    virtual void IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) override;
+    virtual void IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) override;
+    virtual void IntStateGatherReactions(const unsigned int off_L, ChVectorDynamic<>& L) override;
+    virtual void IntStateScatterReactions(const unsigned int off_L, const ChVectorDynamic<>& L) override;
+    virtual void IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) override;
+    virtual void IntLoadResidual_Mv(const unsigned int off,
+                                    ChVectorDynamic<>& R,
+                                    const ChVectorDynamic<>& w,
+                                    const double c) override;
+    virtual void IntLoadLumpedMass_Md(const unsigned int off,
+                                      ChVectorDynamic<>& Md,
+                                      double& err,
+                                      const double c) override;
+    virtual void IntLoadResidual_CqL(const unsigned int off_L,
+                                     ChVectorDynamic<>& R,
+                                     const ChVectorDynamic<>& L,
+                                     const double c) override;
+    virtual void IntLoadConstraint_C(const unsigned int off,
+                                     ChVectorDynamic<>& Qc,
+                                     const double c,
+                                     bool do_clamp,
+                                     double recovery_clamp) override;
+    virtual void IntToDescriptor(const unsigned int off_v,
+                                 const ChStateDelta& v,
+                                 const ChVectorDynamic<>& R,
+                                 const unsigned int off_L,
+                                 const ChVectorDynamic<>& L,
+                                 const ChVectorDynamic<>& Qc) override;
+    virtual void IntFromDescriptor(const unsigned int off_v,
+                                   ChStateDelta& v,
+                                   const unsigned int off_L,
+                                   ChVectorDynamic<>& L) override;
+
+    // Solver functions
+
+    virtual void InjectVariables(ChSystemDescriptor& descriptor) override;
+    virtual void InjectConstraints(ChSystemDescriptor& descriptor) override;
+    virtual void LoadConstraintJacobians() override;
+
+    virtual void VariablesFbReset() override;
+    virtual void VariablesFbLoadForces(double factor = 1) override;
+    virtual void VariablesQbLoadSpeed() override;
+    virtual void VariablesFbIncrementMq() override;
+    virtual void VariablesQbSetSpeed(double step = 0) override;
+    virtual void VariablesQbIncrementPosition(double step) override;
+
+    virtual void ConstraintsBiReset() override;
+    virtual void ConstraintsBiLoad_C(double factor = 1, double recovery_clamp = 0.1, bool do_clamp = false) override;
+    virtual void ConstraintsFetch_react(double factor = 1) override;
+
+  private:
+    /// Linear coupling sum_i coefs[i] * w[shafts[i]] = 0.
+    struct Coupling {
+        std::vector<int> shafts;          ///< indexes of coupled shafts
+        std::vector<double> coefs;        ///< coupling coefficients
+        bool is_lock;                     ///< true for a lock (optional coupling)
+        bool locked;                      ///< lock engaged?
+        bool internal;                    ///< true if coupling eliminated (involves only internal shafts)
+        ChRowVectorDynamic<> cq_red;      ///< Jacobian w.r.t. reduced coordinates
+        double phase;                     ///< value of position-level coupling at engagement time
+        double reaction;                  ///< coupling reaction (Lagrange multiplier)
+        ChConstraintNgeneric constraint;  ///< interface to the solver (if not internal)
+    };
+
+    bool IsCouplingEnabled(const Coupling& coupling) const;
+    double EvalPositionCoupling(const Coupling& coupling) const;
+
+    std::vector<double> m_inertia;                ///< inertias of internal shafts (zero for external shafts)
+    std::vector<double> m_speed0;                 ///< initial speeds of internal shafts
+    std::vector<std::shared_ptr<ChShaft>> m_ext;  ///< external shafts (empty for internal shafts)
+    std::vector<int> m_int_index;                 ///< index among internal shafts (-1 for external shafts)
+    std::vector<double> m_load;                   ///< torques applied to internal shafts
+    std::vector<Coupling> m_couplings;            ///< shaft couplings
+
+    bool m_active;                   ///< network active?
+    bool m_initialized;              ///< reduced model assembled?
+    unsigned int m_nint;             ///< number of internal shafts
+    unsigned int m_nred;             ///< number of reduced coordinates
+    ChMatrixDynamic<> m_N;           ///< map from reduced coordinates to internal shaft speeds
+    ChVectorDynamic<> m_pos;         ///< reduced positions
+    ChVectorDynamic<> m_pos_dt;      ///< reduced speeds
+    ChVectorDynamic<> m_pos_dtdt;    ///< reduced accelerations
+    ChVectorDynamic<> m_load_red;    ///< generalized forces on reduced coordinates
+    ChVariablesGeneric m_variables;  ///< variables for reduced coordinates
+};
+
+CH_CLASS_VERSION(ChShaftsNetwork, 0)
+
+}  // end namespace chrono
+
+#endif
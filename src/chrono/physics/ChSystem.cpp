@@ -29,8 +29,11 @@
 #include "chrono/solver/ChSolverPMINRES.h"
 #include "chrono/solver/ChSolverPSOR.h"
 #include "chrono/solver/ChSolverPSSOR.h"
+#include "chrono/solver/ChSolverPSORcolored.h"
 #include "chrono/solver/ChIterativeSolverLS.h"
 #include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChSolverSparseSupernodal.h"
+#include "chrono/solver/ChSolverBlockTridiagonal.h"
 #include "chrono/core/ChMatrix.h"
 #include "chrono/utils/ChProfiler.h"
 #include "chrono/physics/ChLinkMate.h"
@@ -66,6 +69,9 @@ ChSystem::ChSystem()
       nthreads_chrono(1),
       nthreads_eigen(1),
       nthreads_collision(1),
+      m_deterministic(false),
+      assembly_reuse_factorization(false),
+      m_memory_tracking(false),
       applied_forces_current(false) {
     assembly.system = this;
 
@@ -77,7 +83,8 @@ ChSystem::ChSystem()
     timestepper = chrono_types::make_shared<ChTimestepperEulerImplicitLinearized>(this);
 }
 
-ChSystem::ChSystem(const ChSystem& other) : m_RTF(0), collision_system(nullptr), visual_system(nullptr) {
+ChSystem::ChSystem(const ChSystem& other)
+    : m_RTF(0), collision_system(nullptr), visual_system(nullptr), m_memory_tracking(false) {
     // Required by ChAssembly
     assembly = other.assembly;
     assembly.system = this;
@@ -99,6 +106,9 @@ ChSystem::ChSystem(const ChSystem& other) : m_RTF(0), collision_system(nullptr),
     nthreads_chrono = other.nthreads_chrono;
     nthreads_eigen = other.nthreads_eigen;
     nthreads_collision = other.nthreads_collision;
+    m_deterministic = other.m_deterministic;
+    assembly_cache = other.assembly_cache;
+    assembly_reuse_factorization = other.assembly_reuse_factorization;
     is_initialized = false;
     is_updated = false;
     applied_forces_current = false;
@@ -135,6 +145,13 @@ void ChSystem::AddBody(std::shared_ptr<ChBody> body) {
     body->SetSystem(this);
 }
 
+void ChSystem::AddBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    unsigned int index = static_cast<unsigned int>(GetBodies().size());
+    for (const auto& body : bodies)
+        body->index = index++;
+    assembly.AddBodies(bodies);
+}
+
 void ChSystem::AddShaft(std::shared_ptr<ChShaft> shaft) {
     shaft->index = static_cast<unsigned int>(GetShafts().size());
     assembly.AddShaft(shaft);
@@ -146,6 +163,10 @@ void ChSystem::AddLink(std::shared_ptr<ChLinkBase> link) {
     link->SetSystem(this);
 }
 
+void ChSystem::AddLinks(const std::vector<std::shared_ptr<ChLinkBase>>& links) {
+    assembly.AddLinks(links);
+}
+
 void ChSystem::AddMesh(std::shared_ptr<fea::ChMesh> mesh) {
     assembly.AddMesh(mesh);
     mesh->SetSystem(this);
@@ -251,7 +272,11 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
     if (type == ChSolver::Type::CUSTOM)
         return;
 
+    bool parallel_schur = descriptor && descriptor->IsParallelSchurComplementProductEnabled();
     descriptor = chrono_types::make_shared<ChSystemDescriptor>();
+    descriptor->SetNumThreads(nthreads_chrono);
+    descriptor->SetDeterministic(m_deterministic);
+    descriptor->EnableParallelSchurComplementProduct(parallel_schur);
 
     switch (type) {
         case ChSolver::Type::PSOR:
@@ -260,6 +285,9 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
         case ChSolver::Type::PSSOR:
             solver = chrono_types::make_shared<ChSolverPSSOR>();
             break;
+        case ChSolver::Type::PSOR_COLORED:
+            solver = chrono_types::make_shared<ChSolverPSORcolored>();
+            break;
         case ChSolver::Type::PJACOBI:
             solver = chrono_types::make_shared<ChSolverPJacobi>();
             break;
@@ -284,11 +312,20 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
         case ChSolver::Type::SPARSE_QR:
             solver = chrono_types::make_shared<ChSolverSparseQR>();
             break;
+        case ChSolver::Type::SPARSE_SUPERNODAL:
+            solver = chrono_types::make_shared<ChSolverSparseSupernodal>();
+            break;
+        case ChSolver::Type::BLOCK_TRIDIAGONAL:
+            solver = chrono_types::make_shared<ChSolverBlockTridiagonal>();
+            break;
         default:
             std::cout << "Unknown solver type. No solver was set." << std::endl;
             std::cout << "Use SetSolver()." << std::endl;
             break;
     }
+
+    if (solver)
+        solver->SetNumThreads(nthreads_chrono);
 }
 
 void ChSystem::EnableSolverMatrixWrite(bool val, const std::string& out_dir) {
@@ -314,11 +351,14 @@ void ChSystem::UnregisterCustomCollisionCallback(std::shared_ptr<CustomCollision
 void ChSystem::SetSystemDescriptor(std::shared_ptr<ChSystemDescriptor> newdescriptor) {
     assert(newdescriptor);
     descriptor = newdescriptor;
+    descriptor->SetNumThreads(nthreads_chrono);
+    descriptor->SetDeterministic(m_deterministic);
 }
 
 void ChSystem::SetSolver(std::shared_ptr<ChSolver> newsolver) {
     assert(newsolver);
     solver = newsolver;
+    solver->SetNumThreads(nthreads_chrono);
 }
 
 void ChSystem::SetCollisionSystemType(ChCollisionSystem::Type type) {
@@ -350,6 +390,7 @@ void ChSystem::SetCollisionSystemType(ChCollisionSystem::Type type) {
     }
 
     collision_system->SetNumThreads(nthreads_collision);
+    collision_system->SetDeterministic(m_deterministic);
     collision_system->SetSystem(this);
 }
 
@@ -357,6 +398,7 @@ void ChSystem::SetCollisionSystem(std::shared_ptr<ChCollisionSystem> coll_system
     assert(coll_system);
     collision_system = coll_system;
     collision_system->SetNumThreads(nthreads_collision);
+    collision_system->SetDeterministic(m_deterministic);
     collision_system->SetSystem(this);
 }
 
@@ -377,6 +419,19 @@ void ChSystem::SetNumThreads(int num_threads_chrono, int num_threads_collision,
 
     if (collision_system)
         collision_system->SetNumThreads(nthreads_collision);
+    if (descriptor)
+        descriptor->SetNumThreads(nthreads_chrono);
+    if (solver)
+        solver->SetNumThreads(nthreads_chrono);
+}
+
+void ChSystem::EnableDeterministic(bool val) {
+    m_deterministic = val;
+
+    if (collision_system)
+        collision_system->SetDeterministic(val);
+    if (descriptor)
+        descriptor->SetDeterministic(val);
 }
 
 // -----------------------------------------------------------------------------
@@ -458,6 +513,12 @@ void ChSystem::SetTimestepperType(ChTimestepper::Type type) {
         case ChTimestepper::Type::NEWMARK:
             timestepper = chrono_types::make_shared<ChTimestepperNewmark>(this);
             break;
+        case ChTimestepper::Type::RUNGEKUTTA_ADAPTIVE:
+            timestepper = chrono_types::make_shared<ChTimestepperRungeKuttaAdaptive>(this);
+            break;
+        case ChTimestepper::Type::EULER_IMEX_ADAPTIVE:
+            timestepper = chrono_types::make_shared<ChTimestepperEulerIMEXAdaptive>(this);
+            break;
         default:
             throw std::invalid_argument("SetTimestepperType: timestepper not supported");
     }
@@ -995,6 +1056,20 @@ void ChSystem::StateIncrementX(ChState& x_new, const ChState& x, const ChStateDe
                                          displ_v + contact_container->GetOffset_w(), Dx);
 }
 
+void ChSystem::StateGetIncrementX(const ChState& x_new, const ChState& x, ChStateDelta& Dx) {
+    unsigned int off_x = 0;
+    unsigned int off_v = 0;
+
+    // Operate on assembly sub-objects (bodies, links, etc.)
+    assembly.IntStateGetIncrement(off_x, x_new, x, off_v, Dx);
+
+    // Use also on contact container:
+    unsigned int displ_x = off_x - assembly.offset_x;
+    unsigned int displ_v = off_v - assembly.offset_w;
+    contact_container->IntStateGetIncrement(displ_x + contact_container->GetOffset_x(), x_new, x,
+                                            displ_v + contact_container->GetOffset_w(), Dx);
+}
+
 // Assuming a DAE of the form
 //       M*a = F(x,v,t) + Cq'*L
 //       C(x,t) = 0
@@ -1027,14 +1102,18 @@ bool ChSystem::StateSolveCorrection(
     // R and Qc vectors  --> solver sparse solver structures  (also sets Dl and Dv to warmstart)
     IntToDescriptor(0, Dv, R, 0, Dl, Qc);
 
+    // Cq matrix. Always loaded, since the constraint Jacobians are also used in the evaluation of the residual
+    // (Cq'*L terms), even if the Newton matrix is not updated.
+    timer_jacobian.start();
+    LoadConstraintJacobians();
+    timer_jacobian.stop();
+
     // If the solver's Setup() must be called or if the solver's Solve() requires it,
-    // fill the sparse system structures with information in G and Cq.
+    // fill the sparse system structures with information in G.
     if (force_setup || GetSolver()->SolveRequiresMatrix()) {
+        CH_PROFILE("LoadJacobians");
         timer_jacobian.start();
 
-        // Cq  matrix
-        LoadConstraintJacobians();
-
         // G matrix: M, K, R components
         if (c_a || c_v || c_x)
             LoadKRMMatrices(-c_x, -c_v, c_a);
@@ -1070,6 +1149,7 @@ bool ChSystem::StateSolveCorrection(
     // If indicated, first perform a solver setup.
     // Return 'false' if the setup phase fails.
     if (force_setup) {
+        CH_PROFILE("SolverSetup");
         timer_ls_setup.start();
         bool success = GetSolver()->Setup(*descriptor);
         timer_ls_setup.stop();
@@ -1080,9 +1160,30 @@ bool ChSystem::StateSolveCorrection(
 
     // Solve the problem
     // The solution is scattered in the provided system descriptor
-    timer_ls_solve.start();
-    GetSolver()->Solve(*descriptor);
-    timer_ls_solve.stop();
+    auto solver_vi = std::dynamic_pointer_cast<ChIterativeSolverVI>(GetSolver());
+    if (solver_vi)
+        solver_vi->StatisticsBeginSolve();
+    {
+        CH_PROFILE("SolverSolve");
+        timer_ls_solve.start();
+        GetSolver()->Solve(*descriptor);
+        timer_ls_solve.stop();
+    }
+    if (solver_vi) {
+        // If statistics were collected, identify the bodies involved in the maximum constraint violation
+        if (auto stats = solver_vi->StatisticsEndSolve(*descriptor)) {
+            for (auto variables : stats->max_violation_variables) {
+                int id = -1;
+                for (const auto& body : assembly.bodylist) {
+                    if (&body->Variables() == variables) {
+                        id = body->GetIdentifier();
+                        break;
+                    }
+                }
+                stats->max_violation_bodies.push_back(id);
+            }
+        }
+    }
 
     // Dv and Dl vectors  <-- sparse solver structures
     IntFromDescriptor(0, Dv, 0, Dl);
@@ -1221,6 +1322,50 @@ void ChSystem::LoadConstraint_Ct(ChVectorDynamic<>& Qc, const double c) {
     contact_container->IntLoadConstraint_Ct(displ_L + contact_container->GetOffset_L(), Qc, c);
 }
 
+// Scatter state Y={x,v} to system and increment the residuals R and Qc:
+//    R  += c_F*F + c_M*M*w + c_L*Cq'*L
+//    Qc += c_C*C
+void ChSystem::StateScatterLoadResiduals(const ChState& x,
+                                         const ChStateDelta& v,
+                                         const double T,
+                                         bool full_update,
+                                         ChVectorDynamic<>& R,
+                                         ChVectorDynamic<>& Qc,
+                                         const ChVectorDynamic<>& w,
+                                         const ChVectorDynamic<>& L,
+                                         const double c_F,
+                                         const double c_M,
+                                         const double c_L,
+                                         const double c_C,
+                                         const bool do_clamp,
+                                         const double clamp) {
+    if (!assembly.IsFusedStatePassesEnabled()) {
+        ChIntegrableIIorder::StateScatterLoadResiduals(x, v, T, full_update, R, Qc, w, L, c_F, c_M, c_L, c_C,
+                                                       do_clamp, clamp);
+        return;
+    }
+
+    unsigned int off_x = 0;
+    unsigned int off_v = 0;
+    unsigned int off_L = 0;
+
+    // Operate on assembly items (bodies, links, etc.) in a single traversal
+    assembly.IntStateScatterLoadResiduals(off_x, x, off_v, v, T, full_update, off_L, R, Qc, w, L, c_F, c_M, c_L, c_C,
+                                          do_clamp, clamp);
+
+    // Use also on contact container:
+    unsigned int displ_x = off_x - assembly.offset_x + contact_container->GetOffset_x();
+    unsigned int displ_v = off_v - assembly.offset_w + contact_container->GetOffset_w();
+    unsigned int displ_L = off_L - assembly.offset_L + contact_container->GetOffset_L();
+    contact_container->IntStateScatter(displ_x, x, displ_v, v, T, full_update);
+    contact_container->IntLoadResidual_F(displ_v, R, c_F);
+    contact_container->IntLoadResidual_Mv(displ_v, R, w, c_M);
+    contact_container->IntLoadResidual_CqL(displ_L, R, L, c_L);
+    contact_container->IntLoadConstraint_C(displ_L, Qc, c_C, do_clamp, clamp);
+
+    ch_time = T;
+}
+
 // -----------------------------------------------------------------------------
 //   COLLISION OPERATIONS
 // -----------------------------------------------------------------------------
@@ -1237,12 +1382,18 @@ double ChSystem::ComputeCollisions() {
     timer_collision.start();
 
     // Update all positions of collision models: delegate this to the ChAssembly
-    assembly.SyncCollisionModels();
+    {
+        CH_PROFILE("SyncCollisionModels");
+        assembly.SyncCollisionModels();
+    }
 
     // Perform the collision detection ( broadphase and narrowphase )
-    collision_system->PreProcess();
-    collision_system->Run();
-    collision_system->PostProcess();
+    {
+        CH_PROFILE("CollisionDetection");
+        collision_system->PreProcess();
+        collision_system->Run();
+        collision_system->PostProcess();
+    }
 
     // Report and store contacts and/or proximities, if there are some
     // containers in the physic system. The default contact container
@@ -1295,6 +1446,25 @@ double ChSystem::GetTimerCollisionNarrow() const {
     return 0;
 }
 
+ChSystem::MemoryReport ChSystem::GetMemoryReport() const {
+    MemoryReport report;
+
+    if (collision_system)
+        report.collision_system = collision_system->GetMemoryUsage();
+    if (contact_container)
+        report.contact_container = contact_container->GetMemoryUsage();
+    if (descriptor)
+        report.descriptor = descriptor->GetMemoryUsage();
+    if (solver)
+        report.solver = solver->GetMemoryUsage();
+    for (const auto& mesh : assembly.GetMeshes())
+        report.meshes += mesh->GetMemoryUsage();
+    for (const auto& item : assembly.GetOtherPhysicsItems())
+        report.other_items += item->GetMemoryUsage();
+
+    return report;
+}
+
 void ChSystem::ResetTimers() {
     timer_step.reset();
     timer_advance.reset();
@@ -1589,13 +1759,20 @@ bool ChSystem::AdvanceDynamics() {
     ManageSleepingBodies();
 
     // Prepare lists of variables and constraints.
-    DescriptorPrepareInject(*descriptor);
+    // An explicit integrator with diagonal mass lumping never solves a linear system: for a system without
+    // constraints (otherwise treated with penalty), the accelerations are obtained directly from the lumped masses and
+    // the descriptor is not needed.
+    auto explicit_timestepper = dynamic_cast<ChExplicitTimestepper*>(timestepper.get());
+    bool lumped_explicit = explicit_timestepper && explicit_timestepper->IsDiagonalLumpingON() && m_num_constr == 0;
+    if (!lumped_explicit)
+        DescriptorPrepareInject(*descriptor);
 
     // No need to update counts and offsets, as already done by the above call (in ChSystemDescriptor::EndInsertion)
     ////descriptor->UpdateCountsAndOffsets();
 
     // Set some settings in timestepper object
-    if (timestepper->GetType() == ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED) {
+    if (timestepper->GetType() == ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED ||
+        timestepper->GetType() == ChTimestepper::Type::EULER_IMEX_ADAPTIVE) {
         timestepper->Qc_do_clamp = true;
         timestepper->Qc_clamping = max_penetration_recovery_speed;
     } else {
@@ -1619,6 +1796,17 @@ bool ChSystem::AdvanceDynamics() {
     // Time elapsed for step
     timer_step.stop();
 
+    // Record memory high-water marks
+    if (m_memory_tracking) {
+        MemoryReport report = GetMemoryReport();
+        m_memory_peak.collision_system = std::max(m_memory_peak.collision_system, report.collision_system);
+        m_memory_peak.contact_container = std::max(m_memory_peak.contact_container, report.contact_container);
+        m_memory_peak.descriptor = std::max(m_memory_peak.descriptor, report.descriptor);
+        m_memory_peak.solver = std::max(m_memory_peak.solver, report.solver);
+        m_memory_peak.meshes = std::max(m_memory_peak.meshes, report.meshes);
+        m_memory_peak.other_items = std::max(m_memory_peak.other_items, report.other_items);
+    }
+
     // Update the run-time visualization system, if present
     if (visual_system)
         visual_system->OnUpdate(this);
@@ -1699,6 +1887,8 @@ bool ChSystem::DoAssembly(int action, int max_num_iterations) {
 
     ChAssemblyAnalysis manalysis(*this);
     manalysis.SetMaxAssemblyIters(max_num_iterations);
+    manalysis.SetReuseFactorization(assembly_reuse_factorization);
+    manalysis.SetCache(assembly_cache);
 
     // Perform analysis
     step = 1e-6;
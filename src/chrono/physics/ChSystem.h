@@ -37,6 +37,7 @@
 #include "chrono/timestepper/ChIntegrable.h"
 #include "chrono/timestepper/ChTimestepper.h"
 #include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/timestepper/ChTimestepperAdaptive.h"
 #include "chrono/timestepper/ChStaticAnalysis.h"
 
 namespace chrono {
@@ -237,6 +238,20 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Returns true if no errors and false if an error occurred (impossible assembly?)
     bool DoAssembly(int action, int max_num_iterations = 6);
 
+    /// Attach a cache of assembled configurations, used by DoAssembly (default: none).
+    /// If the assembly problem matches a cached entry, the assembled configuration is restored without solving.
+    /// A cache can be shared between systems and persisted across runs. See ChAssemblyCache.
+    void SetAssemblyCache(std::shared_ptr<ChAssemblyCache> cache) { assembly_cache = cache; }
+
+    /// Get the cache of assembled configurations (if any).
+    std::shared_ptr<ChAssemblyCache> GetAssemblyCache() const { return assembly_cache; }
+
+    /// Enable/disable reuse of the factorization across the position iterations of DoAssembly (default: false).
+    /// With a direct linear solver, the matrix is then factorized once and only refactorized if the constraint
+    /// violation is not reduced fast enough. Use a larger max_num_iterations in DoAssembly to allow for the slower
+    /// (linear) convergence. See ChAssemblyAnalysis::SetReuseFactorization.
+    void EnableAssemblyFactorizationReuse(bool val) { assembly_reuse_factorization = val; }
+
     /// Remove redundant constraints through QR decomposition of the constraints Jacobian matrix.
     /// This function can be used to improve the stability and performance of the system by removing redundant
     /// constraints. The function returns the number of redundant constraints that were deactivated/removed. Please
@@ -270,6 +285,33 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     unsigned int GetNumThreadsCollision() const { return nthreads_collision; }
     unsigned int GetNumThreadsEigen() const { return nthreads_eigen; }
 
+    /// Enable/disable multithreaded state gather/scatter and residual loading passes in the underlying assembly.
+    /// If enabled, these passes use the number of Chrono threads (see SetNumThreads). Results are bit-identical to
+    /// those obtained with sequential passes. See ChAssembly::EnableParallelStatePasses.
+    void EnableParallelStatePasses(bool val) { assembly.EnableParallelStatePasses(val); }
+
+    /// Enable/disable batched link updates in the underlying assembly.
+    /// See ChAssembly::EnableLinkBatching.
+    void EnableLinkBatching(bool val) { assembly.EnableLinkBatching(val); }
+
+    /// Enable/disable fused state scatter and residual loading passes in the underlying assembly.
+    /// See ChAssembly::EnableFusedStatePasses.
+    void EnableFusedStatePasses(bool val) { assembly.EnableFusedStatePasses(val); }
+
+    /// Enable/disable deterministic parallel execution (default: false).
+    /// If enabled, the parallel code paths whose results depend on the number of threads or on thread scheduling use
+    /// fixed-order reductions instead: load container forces and KRM blocks are summed sequentially, in a fixed order,
+    /// and contacts from the collision system are reported sorted by the pair of colliding objects. Results are then
+    /// bit-identical across runs and across thread counts, at the cost of some parallel efficiency. Smooth contact
+    /// forces are always loaded in a fixed order (see ChContactContainerSMC::EnableParallelForces).
+    /// This flag is ignored by Chrono::Multicore systems (ChSystemMulticore), which use their own solver and collision
+    /// data: there, contact forces are reduced per body in contact order, collision pairs are obtained by sorting, and
+    /// solver vector reductions are performed in a fixed order, so results do not depend on the number of threads.
+    void EnableDeterministic(bool val);
+
+    /// Return true if deterministic parallel execution is enabled.
+    bool IsDeterministic() const { return m_deterministic; }
+
     // DATABASE HANDLING
 
     /// Get the underlying assembly containing all physics items.
@@ -278,12 +320,19 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Attach a body to the underlying assembly.
     virtual void AddBody(std::shared_ptr<ChBody> body);
 
+    /// Attach the given bodies to the underlying assembly.
+    /// For large sets of bodies (e.g., granular beds), this is faster than adding bodies one at a time.
+    virtual void AddBodies(const std::vector<std::shared_ptr<ChBody>>& bodies);
+
     /// Attach a shaft to the underlying assembly.
     virtual void AddShaft(std::shared_ptr<ChShaft> shaft);
 
     /// Attach a link to the underlying assembly.
     virtual void AddLink(std::shared_ptr<ChLinkBase> link);
 
+    /// Attach the given links to the underlying assembly.
+    virtual void AddLinks(const std::vector<std::shared_ptr<ChLinkBase>>& links);
+
     /// Attach a mesh to the underlying assembly.
     virtual void AddMesh(std::shared_ptr<fea::ChMesh> mesh);
 
@@ -515,6 +564,40 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Resets the timers.
     void ResetTimers();
 
+    /// Estimates of the memory (in bytes) used by the main subsystems of a Chrono system.
+    /// Each value is an estimate of the dynamically allocated data of the corresponding subsystem, as reported by the
+    /// GetMemoryUsage functions of the collision system, contact container, system descriptor, solver, and physics
+    /// items (a value of 0 indicates that the component does not report its memory use).
+    struct MemoryReport {
+        size_t collision_system = 0;   ///< collision objects, broadphase pairs, contact manifolds
+        size_t contact_container = 0;  ///< contact objects (including contacts kept for reuse) and contact caches
+        size_t descriptor = 0;         ///< system descriptor, including the KRM block matrices
+        size_t solver = 0;             ///< solver data (for direct solvers, the matrix and its factorization)
+        size_t meshes = 0;             ///< FEA meshes
+        size_t other_items = 0;        ///< other physics items (e.g., SCM deformable terrain)
+
+        /// Return the total memory over all subsystems.
+        size_t GetTotal() const {
+            return collision_system + contact_container + descriptor + solver + meshes + other_items;
+        }
+    };
+
+    /// Return estimates of the current memory use of the main subsystems.
+    MemoryReport GetMemoryReport() const;
+
+    /// Enable/disable tracking of the memory high-water marks (default: false).
+    /// If enabled, the memory report is evaluated after each integration step and the per-subsystem maxima are
+    /// recorded (see GetMemoryPeakReport). The cost of evaluating the report is linear in the number of contacts, FEA
+    /// elements, and KRM blocks.
+    void EnableMemoryTracking(bool val) { m_memory_tracking = val; }
+
+    /// Return the per-subsystem memory high-water marks over all steps since tracking was enabled or reset.
+    /// Note that the maxima of different subsystems may occur at different steps.
+    const MemoryReport& GetMemoryPeakReport() const { return m_memory_peak; }
+
+    /// Reset the memory high-water marks.
+    void ResetMemoryPeakReport() { m_memory_peak = MemoryReport(); }
+
     /// DEBUGGING
 
     /// Enable/disable debug output of system matrices.
@@ -685,6 +768,13 @@ class ChApi ChSystem : public ChIntegrableIIorder {
                                  const ChStateDelta& Dx  ///< state increment Dx
                                  ) override;
 
+    /// Compute the increment Dx such that x_new = x + Dx, i.e. the inverse of StateIncrementX.
+    /// It takes care of the fact that x has quaternions, dx has angular vel etc.
+    void StateGetIncrementX(const ChState& x_new,  ///< final state x_new
+                            const ChState& x,      ///< initial state x
+                            ChStateDelta& Dx       ///< resulting state increment Dx
+    );
+
     /// Assuming a DAE of the form
     /// <pre>
     ///       M*a = F(x,v,t) + Cq'*L
@@ -756,6 +846,27 @@ class ChApi ChSystem : public ChIntegrableIIorder {
                                    const double c          ///< a scaling factor
                                    ) override;
 
+    /// Scatter the given state to the system and load the residual terms for one Newton iteration:
+    ///    R  += c_F*F + c_M*M*w + c_L*Cq'*L
+    ///    Qc += c_C*C
+    /// If fused state passes are enabled (see EnableFusedStatePasses), all terms are evaluated in a single traversal
+    /// of the physics items; otherwise, this falls back to separate passes.
+    virtual void StateScatterLoadResiduals(const ChState& x,             ///< state, x part
+                                           const ChStateDelta& v,        ///< state, v part
+                                           const double T,               ///< time T
+                                           bool full_update,             ///< perform a full update during scatter
+                                           ChVectorDynamic<>& R,         ///< result: the R residual
+                                           ChVectorDynamic<>& Qc,        ///< result: the Qc residual
+                                           const ChVectorDynamic<>& w,   ///< the w vector
+                                           const ChVectorDynamic<>& L,   ///< the L vector
+                                           const double c_F,             ///< scaling factor for F
+                                           const double c_M,             ///< scaling factor for M*w
+                                           const double c_L,             ///< scaling factor for Cq'*L
+                                           const double c_C,             ///< scaling factor for C
+                                           const bool do_clamp = false,  ///< enable optional clamping of Qc
+                                           const double clamp = 1e30     ///< clamping value
+                                           ) override;
+
   protected:
     /// Pushes all ChConstraints and ChVariables contained in links, bodies, etc. into the system descriptor.
     virtual void DescriptorPrepareInject(ChSystemDescriptor& sys_descriptor);
@@ -833,6 +944,10 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     int nthreads_chrono;
     int nthreads_eigen;
     int nthreads_collision;
+    bool m_deterministic;  ///< deterministic parallel execution
+
+    std::shared_ptr<ChAssemblyCache> assembly_cache;  ///< cache of assembled configurations
+    bool assembly_reuse_factorization;                ///< reuse factorization in position assembly
 
     // timers for profiling execution speed
     ChTimer timer_step;       ///< timer for integration step
@@ -845,6 +960,9 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     ChTimer timer_update;     ///< timer for system update
     double m_RTF;             ///< real-time factor (simulation time / simulated time)
 
+    bool m_memory_tracking;      ///< record memory high-water marks after each step?
+    MemoryReport m_memory_peak;  ///< memory high-water marks
+
     std::shared_ptr<ChTimestepper> timestepper;  ///< time-stepper object
 
     ChVectorDynamic<> applied_forces;  ///< system-wide vector of applied forces (lazy evaluation)
@@ -17,10 +17,12 @@
 //
 // =============================================================================
 
+#include <cmath>
 #include <limits>
 
 #include "chrono/physics/ChSystemSMC.h"
 #include "chrono/physics/ChContactContainerSMC.h"
+#include "chrono/physics/ChContactMaterialSMC.h"
 
 #include "chrono/solver/ChSystemDescriptor.h"
 #include "chrono/solver/ChIterativeSolverLS.h"
@@ -30,6 +32,214 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChSystemSMC)
 
+// -----------------------------------------------------------------------------
+// Default SMC contact force model, specialized at compile time on the model combination.
+// Flores falls back to Hooke, Perko adhesion to Constant, and MultiStep tangential displacement to OneStep, so the
+// kernels are templated only over the distinct combinations.
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// System settings used by the force model, extracted once per kernel invocation (or once per batch).
+struct ContactForceParams {
+    explicit ContactForceParams(const ChSystemSMC& sys)
+        : step(sys.GetStep()),
+          char_vel2(sys.GetCharacteristicImpactVelocity() * sys.GetCharacteristicImpactVelocity()),
+          min_slip_vel(sys.GetSlipVelocityThreshold()) {}
+
+    double step;
+    double char_vel2;
+    double min_slip_vel;
+};
+
+// Contact force on obj2, for a contact with positive overlap.
+// CM: normal force model; MP: use material properties; TD: accumulate tangential displacement; DMT: DMT adhesion.
+// All model choices are compile-time constants, so the branches below are resolved by the compiler.
+template <ChSystemSMC::ContactForceModel CM, bool MP, bool TD, bool DMT>
+inline ChVector3d ContactForce(const ContactForceParams& par,
+                               const ChVector3d& normal_dir,
+                               const ChVector3d& relvel,
+                               const ChContactMaterialCompositeSMC& mat,
+                               double delta,
+                               double eff_radius,
+                               double mass1,
+                               double mass2) {
+    constexpr double eps = std::numeric_limits<double>::epsilon();
+
+    // Relative velocity at contact
+    double relvel_n_mag = relvel.Dot(normal_dir);
+    ChVector3d relvel_n = relvel_n_mag * normal_dir;
+    ChVector3d relvel_t = relvel - relvel_n;
+    double relvel_t_mag = relvel_t.Length();
+
+    // Calculate effective mass
+    double eff_mass = mass1 * mass2 / (mass1 + mass2);
+
+    // Adhesion force
+    double adhesion = DMT ? mat.adhesionMultDMT_eff * std::sqrt(eff_radius) : mat.adhesion_eff;
+
+    // Calculate stiffness and viscous damping coefficients.
+    // All models use the following formulas for normal and tangential forces:
+    //     Fn = kn * delta_n - gn * v_n
+    //     Ft = kt * delta_t - gt * v_t
+    double kn = 0;
+    double kt = 0;
+    double gn = 0;
+    double gt = 0;
+
+    if (CM == ChSystemSMC::Hooke) {
+        if (MP) {
+            double tmp_k = (16.0 / 15) * std::sqrt(eff_radius) * mat.E_eff;
+            double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
+            loge = (mat.cr_eff > 1 - eps) ? std::log(1 - eps) : loge;
+            double tmp_g = 1 + std::pow(CH_PI / loge, 2);
+            kn = tmp_k * std::pow(eff_mass * par.char_vel2 / tmp_k, 1.0 / 5);
+            kt = kn;
+            gn = std::sqrt(4 * eff_mass * kn / tmp_g);
+            gt = gn;
+        } else {
+            kn = mat.kn;
+            kt = mat.kt;
+            gn = eff_mass * mat.gn;
+            gt = eff_mass * mat.gt;
+        }
+    } else if (CM == ChSystemSMC::Hertz) {
+        if (MP) {
+            double sqrt_Rd = std::sqrt(eff_radius * delta);
+            double Sn = 2 * mat.E_eff * sqrt_Rd;
+            double St = 8 * mat.G_eff * sqrt_Rd;
+            double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
+            double beta = loge / std::sqrt(loge * loge + CH_PI * CH_PI);
+            kn = (2.0 / 3) * Sn;
+            kt = St;
+            gn = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(Sn * eff_mass);
+            gt = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(St * eff_mass);
+        } else {
+            double tmp = eff_radius * std::sqrt(delta);
+            kn = tmp * mat.kn;
+            kt = tmp * mat.kt;
+            gn = tmp * eff_mass * mat.gn;
+            gt = tmp * eff_mass * mat.gt;
+        }
+    } else {  // PlainCoulomb
+        if (MP) {
+            double sqrt_Rd = std::sqrt(delta);
+            double Sn = 2 * mat.E_eff * sqrt_Rd;
+            double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
+            double beta = loge / std::sqrt(loge * loge + CH_PI * CH_PI);
+            kn = (2.0 / 3) * Sn;
+            gn = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(Sn * eff_mass);
+        } else {
+            double tmp = std::sqrt(delta);
+            kn = tmp * mat.kn;
+            gn = tmp * mat.gn;
+        }
+
+        double forceN = kn * delta - gn * relvel_n_mag;
+        if (forceN < 0)
+            forceN = 0;
+        double forceT = mat.mu_eff * std::tanh(5.0 * relvel_t_mag) * forceN;
+        forceN -= adhesion;
+
+        ChVector3d force = forceN * normal_dir;
+        if (relvel_t_mag >= par.min_slip_vel)
+            force -= (forceT / relvel_t_mag) * relvel_t;
+
+        return force;
+    }
+
+    // Tangential displacement (magnitude)
+    double delta_t = TD ? relvel_t_mag * par.step : 0;
+
+    // Calculate the magnitudes of the normal and tangential contact forces
+    double forceN = kn * delta - gn * relvel_n_mag;
+    double forceT = kt * delta_t + gt * relvel_t_mag;
+
+    // If the resulting normal contact force is negative, the two shapes are moving
+    // away from each other so fast that no contact force is generated.
+    if (forceN < 0) {
+        forceN = 0;
+        forceT = 0;
+    }
+
+    // Include adhesion force
+    forceN -= adhesion;
+
+    // Coulomb law
+    forceT = std::min<double>(forceT, mat.mu_eff * std::abs(forceN));
+
+    // Accumulate normal and tangential forces
+    ChVector3d force = forceN * normal_dir;
+    if (relvel_t_mag >= par.min_slip_vel)
+        force -= (forceT / relvel_t_mag) * relvel_t;
+
+    return force;
+}
+
+template <ChSystemSMC::ContactForceModel CM, bool MP, bool TD, bool DMT>
+ChVector3d ContactForceKernel(const ChSystemSMC& sys,
+                              const ChVector3d& normal_dir,
+                              const ChVector3d& relvel,
+                              const ChContactMaterialCompositeSMC& mat,
+                              double delta,
+                              double eff_radius,
+                              double mass1,
+                              double mass2) {
+    return ContactForce<CM, MP, TD, DMT>(ContactForceParams(sys), normal_dir, relvel, mat, delta, eff_radius, mass1,
+                                         mass2);
+}
+
+template <ChSystemSMC::ContactForceModel CM, bool MP, bool TD, bool DMT>
+void ContactForceBatchKernel(const ChSystemSMC& sys,
+                             int n,
+                             const double* delta,
+                             const double* eff_radius,
+                             const double* mass1,
+                             const double* mass2,
+                             const ChVector3d* normal_dir,
+                             const ChVector3d* relvel,
+                             const ChContactMaterialCompositeSMC* mat,
+                             ChVector3d* force) {
+    ContactForceParams par(sys);
+    for (int i = 0; i < n; i++) {
+        force[i] = (delta[i] > 0) ? ContactForce<CM, MP, TD, DMT>(par, normal_dir[i], relvel[i], mat[i], delta[i],
+                                                                   eff_radius[i], mass1[i], mass2[i])
+                                  : VNULL;
+    }
+}
+
+// Resolve the runtime model settings into template arguments, one setting at a time.
+template <ChSystemSMC::ContactForceModel CM, bool MP, bool TD, typename K, typename B>
+void SelectKernel(bool dmt, K& kernel, B& batch) {
+    if (dmt) {
+        kernel = &ContactForceKernel<CM, MP, TD, true>;
+        batch = &ContactForceBatchKernel<CM, MP, TD, true>;
+    } else {
+        kernel = &ContactForceKernel<CM, MP, TD, false>;
+        batch = &ContactForceBatchKernel<CM, MP, TD, false>;
+    }
+}
+
+template <ChSystemSMC::ContactForceModel CM, bool MP, typename K, typename B>
+void SelectKernel(bool td, bool dmt, K& kernel, B& batch) {
+    if (td)
+        SelectKernel<CM, MP, true>(dmt, kernel, batch);
+    else
+        SelectKernel<CM, MP, false>(dmt, kernel, batch);
+}
+
+template <ChSystemSMC::ContactForceModel CM, typename K, typename B>
+void SelectKernel(bool mp, bool td, bool dmt, K& kernel, B& batch) {
+    if (mp)
+        SelectKernel<CM, true>(td, dmt, kernel, batch);
+    else
+        SelectKernel<CM, false>(td, dmt, kernel, batch);
+}
+
+}  // end anonymous namespace
+
+// -----------------------------------------------------------------------------
+
 ChSystemSMC::ChSystemSMC()
     : ChSystem(),
       m_use_mat_props(true),
@@ -54,9 +264,22 @@ ChSystemSMC::ChSystemSMC()
 
     m_minSlipVelocity = 1e-4;
     m_characteristicVelocity = 1;
+
+    SelectContactForceKernel();
 }
 
-ChSystemSMC::ChSystemSMC(const ChSystemSMC& other) : ChSystem(other) {}
+ChSystemSMC::ChSystemSMC(const ChSystemSMC& other)
+    : ChSystem(other),
+      m_use_mat_props(other.m_use_mat_props),
+      m_contact_model(other.m_contact_model),
+      m_adhesion_model(other.m_adhesion_model),
+      m_tdispl_model(other.m_tdispl_model),
+      m_stiff_contact(other.m_stiff_contact),
+      m_minSlipVelocity(other.m_minSlipVelocity),
+      m_characteristicVelocity(other.m_characteristicVelocity),
+      m_force_algo(new ChDefaultContactForceTorqueSMC) {
+    SelectContactForceKernel();
+}
 
 void ChSystemSMC::SetContactContainer(std::shared_ptr<ChContactContainer> container) {
     if (std::dynamic_pointer_cast<ChContactContainerSMC>(container))
@@ -67,6 +290,38 @@ void ChSystemSMC::SetSlipVelocityThreshold(double vel) {
     m_minSlipVelocity = std::max(vel, std::numeric_limits<double>::epsilon());
 }
 
+void ChSystemSMC::SelectContactForceKernel() {
+    bool td = m_tdispl_model != None;
+    bool dmt = m_adhesion_model == AdhesionForceModel::DMT;
+
+    switch (m_contact_model) {
+        case Flores:
+            // Currently not implemented.  Fall through to Hooke.
+        case Hooke:
+            SelectKernel<Hooke>(m_use_mat_props, td, dmt, m_force_kernel, m_force_batch_kernel);
+            break;
+        case Hertz:
+            SelectKernel<Hertz>(m_use_mat_props, td, dmt, m_force_kernel, m_force_batch_kernel);
+            break;
+        case PlainCoulomb:
+            // The tangential displacement model does not affect the PlainCoulomb force.
+            SelectKernel<PlainCoulomb>(m_use_mat_props, false, dmt, m_force_kernel, m_force_batch_kernel);
+            break;
+    }
+}
+
+void ChSystemSMC::CalculateContactForces(int n,
+                                         const double* delta,
+                                         const double* eff_radius,
+                                         const double* mass1,
+                                         const double* mass2,
+                                         const ChVector3d* normal_dir,
+                                         const ChVector3d* relvel,
+                                         const ChContactMaterialCompositeSMC* mat,
+                                         ChVector3d* force) const {
+    m_force_batch_kernel(*this, n, delta, eff_radius, mass1, mass2, normal_dir, relvel, mat, force);
+}
+
 void ChSystemSMC::SetContactForceTorqueAlgorithm(std::unique_ptr<ChContactForceTorqueSMC>&& algorithm) {
     m_force_algo = std::move(algorithm);
 }
@@ -135,6 +390,8 @@ void ChSystemSMC::ArchiveIn(ChArchiveIn& archive_in) {
     archive_in >> CHNVP(mtangential_mapper(m_tdispl_model), "tangential_model");
     //// TODO  complete...
 
+    SelectContactForceKernel();
+
     // Recompute statistics, offsets, etc.
     this->Setup();
 }
@@ -72,26 +72,38 @@ class ChApi ChSystemSMC : public ChSystem {
     /// Enable/disable using physical contact material properties.
     /// If true, contact coefficients are estimated from physical material properties.
     /// Otherwise, explicit values of stiffness and damping coefficients are used.
-    void UseMaterialProperties(bool val) { m_use_mat_props = val; }
+    void UseMaterialProperties(bool val) {
+        m_use_mat_props = val;
+        SelectContactForceKernel();
+    }
 
     /// Return true if contact coefficients are estimated from physical material properties.
     bool UsingMaterialProperties() const { return m_use_mat_props; }
 
     /// Set the normal contact force model.
-    void SetContactForceModel(ContactForceModel model) { m_contact_model = model; }
+    void SetContactForceModel(ContactForceModel model) {
+        m_contact_model = model;
+        SelectContactForceKernel();
+    }
 
     /// Get the current normal contact force model.
     ContactForceModel GetContactForceModel() const { return m_contact_model; }
 
     /// Set the adhesion force model.
-    void SetAdhesionForceModel(AdhesionForceModel model) { m_adhesion_model = model; }
+    void SetAdhesionForceModel(AdhesionForceModel model) {
+        m_adhesion_model = model;
+        SelectContactForceKernel();
+    }
 
     /// Get the current adhesion force model.
     AdhesionForceModel GetAdhesionForceModel() const { return m_adhesion_model; }
 
     /// Set the tangential displacement model.
     /// Note that currently MultiStep falls back to OneStep.
-    void SetTangentialDisplacementModel(TangentialDisplacementModel model) { m_tdispl_model = model; }
+    void SetTangentialDisplacementModel(TangentialDisplacementModel model) {
+        m_tdispl_model = model;
+        SelectContactForceKernel();
+    }
 
     /// Get the current tangential displacement model.
     TangentialDisplacementModel GetTangentialDisplacementModel() const { return m_tdispl_model; }
@@ -146,6 +158,39 @@ class ChApi ChSystemSMC : public ChSystem {
     /// Accessor for the current SMC contact force calculation.
     const ChContactForceTorqueSMC& GetContactForceTorqueAlgorithm() const { return *m_force_algo; }
 
+    /// Signature of a compiled kernel for the default SMC contact force model.
+    /// The kernel returns the contact force on obj2 for a contact with positive overlap delta, given the velocity
+    /// relvel of the contact point on obj2 relative to the contact point on obj1 (expressed in global frame).
+    typedef ChVector3d (*ContactForceKernel)(const ChSystemSMC& sys,
+                                             const ChVector3d& normal_dir,
+                                             const ChVector3d& relvel,
+                                             const ChContactMaterialCompositeSMC& mat,
+                                             double delta,
+                                             double eff_radius,
+                                             double mass1,
+                                             double mass2);
+
+    /// Get the kernel of the default SMC contact force model for the current model settings.
+    /// The default force model is instantiated at compile time for each supported combination of normal force model,
+    /// use of material properties, tangential displacement model, and adhesion model. The matching kernel is selected
+    /// whenever one of these settings changes, so that no model dispatch takes place during contact force evaluation.
+    ContactForceKernel GetContactForceKernel() const { return m_force_kernel; }
+
+    /// Evaluate the default SMC contact force model for a batch of n contacts.
+    /// All input arrays and the output array must have length n. The relative velocity is that of the contact point on
+    /// obj2 with respect to the contact point on obj1. Contacts with non-positive overlap receive a zero force.
+    /// The loop over contacts is specialized for the current model settings and free of model dispatch.
+    void CalculateContactForces(int n,                                     ///< number of contacts
+                                const double* delta,                       ///< overlaps in normal direction
+                                const double* eff_radius,                  ///< effective radii of curvature
+                                const double* mass1,                       ///< masses of obj1
+                                const double* mass2,                       ///< masses of obj2
+                                const ChVector3d* normal_dir,              ///< normal contact directions
+                                const ChVector3d* relvel,                  ///< relative contact point velocities
+                                const ChContactMaterialCompositeSMC* mat,  ///< composite materials
+                                ChVector3d* force                          ///< output contact forces on obj2
+    ) const;
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive_out) override;
 
@@ -153,6 +198,20 @@ class ChApi ChSystemSMC : public ChSystem {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   private:
+    typedef void (*ContactForceBatchKernel)(const ChSystemSMC& sys,
+                                            int n,
+                                            const double* delta,
+                                            const double* eff_radius,
+                                            const double* mass1,
+                                            const double* mass2,
+                                            const ChVector3d* normal_dir,
+                                            const ChVector3d* relvel,
+                                            const ChContactMaterialCompositeSMC* mat,
+                                            ChVector3d* force);
+
+    /// Select the contact force kernels matching the current model settings.
+    void SelectContactForceKernel();
+
     bool m_use_mat_props;                        ///< if true, derive contact parameters from mat. props.
     ContactForceModel m_contact_model;           ///< type of the contact force model
     AdhesionForceModel m_adhesion_model;         ///< type of the adhesion force model
@@ -161,6 +220,8 @@ class ChApi ChSystemSMC : public ChSystem {
     double m_minSlipVelocity;                    ///< slip velocity below which no tangential forces are generated
     double m_characteristicVelocity;             ///< characteristic impact velocity (Hooke model)
     std::unique_ptr<ChContactForceTorqueSMC> m_force_algo;  /// contact force and torque calculation
+    ContactForceKernel m_force_kernel;                      ///< default force model, current settings
+    ContactForceBatchKernel m_force_batch_kernel;           ///< batched default force model, current settings
 };
 
 CH_CLASS_VERSION(ChSystemSMC, 0)
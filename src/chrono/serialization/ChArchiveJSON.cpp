@@ -248,19 +248,14 @@ void ChArchiveOutJSON::out_ref(ChValue& bVal, bool already_inserted, size_t obj_
     ++nitems.top();
 }
 ChArchiveInJSON::ChArchiveInJSON(std::ifstream& stream_in) : m_istream(stream_in) {
-    std::stringstream buffer;
-    buffer << m_istream.rdbuf();
-    std::string mstr = buffer.str();
-    const char* stringbuffer = mstr.c_str();
-
-    document.Parse<0>(stringbuffer);
+    // Parse directly from the input stream: for large archives, this avoids holding copies of the entire file
+    // content in memory in addition to the document.
+    rapidjson::IStreamWrapper isw(m_istream);
+    document.ParseStream<0>(isw);
     if (document.HasParseError()) {
-        std::string errstrA((const char*)(&stringbuffer[std::max((int)document.GetErrorOffset() - 10, 0)]));
-        errstrA.resize(10);
-        std::string errstrB((const char*)(&stringbuffer[document.GetErrorOffset()]));
-        errstrB.resize(20);
-        throw std::invalid_argument("ERROR: the file has bad JSON syntax," + std::to_string(document.GetParseError()) +
-                                    " \n\n[...]" + errstrA + " <--- " + errstrB + "[...]");
+        throw std::invalid_argument("ERROR: the file has bad JSON syntax, " +
+                                    std::string(rapidjson::GetParseError_En(document.GetParseError())) +
+                                    " at offset " + std::to_string(document.GetErrorOffset()));
     }
     if (!document.IsObject())
         throw std::invalid_argument("ERROR: the file is not a valid JSON document");
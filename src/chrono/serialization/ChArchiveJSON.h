@@ -18,6 +18,8 @@
 #include "chrono_thirdparty/rapidjson/prettywriter.h"
 #include "chrono_thirdparty/rapidjson/filereadstream.h"
 #include "chrono_thirdparty/rapidjson/filewritestream.h"
+#include "chrono_thirdparty/rapidjson/istreamwrapper.h"
+#include "chrono_thirdparty/rapidjson/error/en.h"
 
 #include <stack>
 #include <fstream>
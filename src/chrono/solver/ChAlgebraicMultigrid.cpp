@@ -0,0 +1,233 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include "chrono/solver/ChAlgebraicMultigrid.h"
+
+namespace chrono {
+
+ChAlgebraicMultigrid::ChAlgebraicMultigrid()
+    : m_threshold(0.08), m_max_levels(10), m_coarse_size(500), m_num_smoothing(1), m_direct_coarse(false) {}
+
+int ChAlgebraicMultigrid::Aggregate(const ChSparseMatrix& A, std::vector<int>& aggregate) const {
+    int n = (int)A.rows();
+
+    ChVectorDynamic<> diag = A.diagonal();
+    auto strength = [&](int i, int j, double a_ij) { return std::abs(a_ij) / std::sqrt(std::abs(diag(i) * diag(j))); };
+    auto strong = [&](int i, int j, double a_ij) { return j != i && strength(i, j, a_ij) >= m_threshold; };
+
+    aggregate.assign(n, -1);
+    int num_aggregates = 0;
+
+    // Pass 1: unknowns with no aggregated strong neighbors form new aggregates with their strong neighbors
+    for (int i = 0; i < n; i++) {
+        if (aggregate[i] >= 0)
+            continue;
+        bool free = true;
+        for (ChSparseMatrix::InnerIterator it(A, i); it && free; ++it) {
+            if (strong(i, (int)it.col(), it.value()) && aggregate[it.col()] >= 0)
+                free = false;
+        }
+        if (!free)
+            continue;
+        aggregate[i] = num_aggregates;
+        for (ChSparseMatrix::InnerIterator it(A, i); it; ++it) {
+            if (strong(i, (int)it.col(), it.value()))
+                aggregate[it.col()] = num_aggregates;
+        }
+        num_aggregates++;
+    }
+
+    // Pass 2: remaining unknowns join the aggregate of their strongest neighbor aggregated during pass 1
+    std::vector<int> aggregate1 = aggregate;
+    for (int i = 0; i < n; i++) {
+        if (aggregate1[i] >= 0)
+            continue;
+        double max_strength = 0;
+        for (ChSparseMatrix::InnerIterator it(A, i); it; ++it) {
+            int j = (int)it.col();
+            if (strong(i, j, it.value()) && aggregate1[j] >= 0 && strength(i, j, it.value()) > max_strength) {
+                max_strength = strength(i, j, it.value());
+                aggregate[i] = aggregate1[j];
+            }
+        }
+    }
+
+    // Pass 3: unknowns still not aggregated (e.g., with no strong connections) form new aggregates
+    for (int i = 0; i < n; i++) {
+        if (aggregate[i] >= 0)
+            continue;
+        aggregate[i] = num_aggregates;
+        for (ChSparseMatrix::InnerIterator it(A, i); it; ++it) {
+            if (strong(i, (int)it.col(), it.value()) && aggregate[it.col()] < 0)
+                aggregate[it.col()] = num_aggregates;
+        }
+        num_aggregates++;
+    }
+
+    return num_aggregates;
+}
+
+double ChAlgebraicMultigrid::SetupSmoother(Level& level) const {
+    const auto& A = level.A;
+    int n = (int)A.rows();
+
+    // Gershgorin bound on the spectral radius of D^(-1)*A
+    ChVectorDynamic<> diag = A.diagonal();
+    double rho = 0;
+    for (int i = 0; i < n; i++) {
+        if (diag(i) <= 0)
+            continue;
+        double sum = 0;
+        for (ChSparseMatrix::InnerIterator it(A, i); it; ++it)
+            sum += std::abs(it.value());
+        rho = std::max(rho, sum / diag(i));
+    }
+    if (rho == 0)
+        rho = 1;
+
+    // Damped Jacobi with weight 4/(3*rho), which also damps the smoothed prolongation
+    double weight = 4.0 / (3.0 * rho);
+    level.invdiag.resize(n);
+    for (int i = 0; i < n; i++)
+        level.invdiag(i) = (diag(i) > 0) ? weight / diag(i) : 0.0;
+
+    level.b.resize(n);
+    level.x.resize(n);
+    level.r.resize(n);
+
+    return rho;
+}
+
+bool ChAlgebraicMultigrid::Setup(const ChSparseMatrix& A, bool reuse) {
+    bool reused = reuse && !m_levels.empty() && m_levels[0].A.rows() == A.rows() &&
+                  m_levels[0].A.nonZeros() == A.nonZeros();
+
+    if (reused) {
+        // Recompute the level matrices with the current prolongation operators
+        m_levels[0].A = A;
+        for (size_t l = 0; l < m_levels.size(); l++) {
+            SetupSmoother(m_levels[l]);
+            if (l + 1 < m_levels.size()) {
+                ChSparseMatrix AP = m_levels[l].A * m_levels[l].P;
+                m_levels[l + 1].A = m_levels[l].R * AP;
+            }
+        }
+    } else {
+        m_levels.clear();
+        m_levels.emplace_back();
+        m_levels[0].A = A;
+
+        while (true) {
+            Level& fine = m_levels.back();
+            SetupSmoother(fine);
+
+            int n = (int)fine.A.rows();
+            if (n <= m_coarse_size || (int)m_levels.size() >= m_max_levels)
+                break;
+
+            // Tentative (piecewise constant) prolongation over aggregates
+            std::vector<int> aggregate;
+            int num_aggregates = Aggregate(fine.A, aggregate);
+            if (num_aggregates == 0 || num_aggregates > 0.9 * n)
+                break;
+
+            ChSparseMatrix P0(n, num_aggregates);
+            P0.reserve(Eigen::VectorXi::Constant(n, 1));
+            for (int i = 0; i < n; i++)
+                P0.insert(i, aggregate[i]) = 1.0;
+            P0.makeCompressed();
+
+            // Smoothed prolongation P = (I - w * D^(-1) * A) * P0
+            ChSparseMatrix AP0 = fine.A * P0;
+            for (int i = 0; i < n; i++) {
+                for (ChSparseMatrix::InnerIterator it(AP0, i); it; ++it)
+                    it.valueRef() *= -fine.invdiag(i);
+            }
+            fine.P = P0 + AP0;
+            fine.R = fine.P.transpose();
+
+            // Galerkin coarse matrix
+            ChSparseMatrix AP = fine.A * fine.P;
+            ChSparseMatrix Ac = fine.R * AP;
+
+            m_levels.emplace_back();
+            m_levels.back().A = std::move(Ac);
+        }
+    }
+
+    // Coarsest level solver
+    const auto& coarsest = m_levels.back();
+    m_direct_coarse = coarsest.A.rows() <= 2 * m_coarse_size;
+    if (m_direct_coarse)
+        m_coarse.compute(ChMatrixDynamic<>(coarsest.A));
+
+    return reused;
+}
+
+void ChAlgebraicMultigrid::Smooth(const Level& level, int num_sweeps) const {
+    for (int k = 0; k < num_sweeps; k++) {
+        level.r.noalias() = level.b - level.A * level.x;
+        level.x += level.invdiag.cwiseProduct(level.r);
+    }
+}
+
+void ChAlgebraicMultigrid::Cycle(int l) const {
+    const Level& level = m_levels[l];
+
+    if (l + 1 == (int)m_levels.size()) {
+        if (m_direct_coarse) {
+            level.x = m_coarse.solve(level.b);
+        } else {
+            level.x.setZero();
+            Smooth(level, 10 * m_num_smoothing);
+        }
+        return;
+    }
+
+    const Level& coarse = m_levels[l + 1];
+
+    level.x.setZero();
+    Smooth(level, m_num_smoothing);
+    level.r.noalias() = level.b - level.A * level.x;
+    coarse.b.noalias() = level.R * level.r;
+    Cycle(l + 1);
+    level.x.noalias() += level.P * coarse.x;
+    Smooth(level, m_num_smoothing);
+}
+
+void ChAlgebraicMultigrid::Apply(ChVectorConstRef b, ChVectorRef x) const {
+    if (m_levels.empty()) {
+        x = b;
+        return;
+    }
+
+    m_levels[0].b = b;
+    Cycle(0);
+    x = m_levels[0].x;
+}
+
+double ChAlgebraicMultigrid::GetOperatorComplexity() const {
+    if (m_levels.empty() || m_levels[0].A.nonZeros() == 0)
+        return 0;
+
+    double nnz = 0;
+    for (const auto& level : m_levels)
+        nnz += (double)level.A.nonZeros();
+    return nnz / m_levels[0].A.nonZeros();
+}
+
+}  // end namespace chrono
@@ -0,0 +1,124 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Smoothed aggregation algebraic multigrid, for use as a preconditioner.
+//
+// =============================================================================
+
+#ifndef CH_ALGEBRAIC_MULTIGRID_H
+#define CH_ALGEBRAIC_MULTIGRID_H
+
+#include <vector>
+
+#include <Eigen/LU>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Smoothed aggregation algebraic multigrid (AMG), for use as a preconditioner of symmetric positive definite sparse
+/// matrices (e.g., the stiffness and mass matrices of FEA models).
+///
+/// The hierarchy of coarse levels is built from the matrix alone. At each level, the unknowns are grouped in
+/// aggregates of strongly connected unknowns; the piecewise constant tentative prolongation is smoothed with a damped
+/// Jacobi step, and the coarse matrix is obtained through the Galerkin product R*A*P, with R = P'. Coarsening stops
+/// when the coarse size or the maximum number of levels is reached, or when aggregation no longer reduces the size.
+/// The coarsest level is solved with a dense LU factorization, if small enough, or smoothed otherwise.
+///
+/// The preconditioner applies one V-cycle with damped Jacobi pre- and post-smoothing, starting from a zero initial
+/// guess. The V-cycle is a symmetric positive definite operator for symmetric positive definite matrices, as
+/// required by MINRES.
+///
+/// When the matrix sparsity pattern does not change (e.g., between time steps of a simulation), the aggregates and
+/// the prolongation operators can be reused; only the coarse matrices and the coarse factorization are then
+/// recomputed.
+class ChApi ChAlgebraicMultigrid {
+  public:
+    ChAlgebraicMultigrid();
+
+    /// Set the strength threshold used in aggregation (default: 0.08).
+    /// Unknowns i and j are strongly connected if |a_ij| >= threshold * sqrt(|a_ii * a_jj|).
+    void SetStrengthThreshold(double threshold) { m_threshold = threshold; }
+
+    /// Set the maximum number of levels, including the fine level (default: 10).
+    void SetMaxLevels(int max_levels) { m_max_levels = max_levels; }
+
+    /// Set the size below which a level is not coarsened further and is solved directly (default: 500).
+    void SetCoarseSize(int coarse_size) { m_coarse_size = coarse_size; }
+
+    /// Set the number of pre- and post-smoothing Jacobi sweeps at each level (default: 1).
+    void SetNumSmoothingSteps(int num_steps) { m_num_smoothing = num_steps; }
+
+    /// Build the multigrid hierarchy for the given symmetric matrix.
+    /// If reuse is true and the matrix has the same size and number of non-zeros as in the previous setup, the
+    /// aggregates and the prolongation operators are reused and only the coarse matrices are recomputed.
+    /// Return true if the aggregates were reused.
+    bool Setup(const ChSparseMatrix& A, bool reuse);
+
+    /// Apply one V-cycle to the vector b, with a zero initial guess.
+    /// This function uses internal work vectors and must not be called concurrently on the same object.
+    void Apply(ChVectorConstRef b, ChVectorRef x) const;
+
+    /// Return the number of levels in the hierarchy, including the fine level.
+    int GetNumLevels() const { return (int)m_levels.size(); }
+
+    /// Return the size of the matrix at the specified level.
+    int GetLevelSize(int level) const { return (int)m_levels[level].A.rows(); }
+
+    /// Return the operator complexity (total number of non-zeros over all levels, relative to the fine matrix).
+    double GetOperatorComplexity() const;
+
+  private:
+    /// Data for one level of the multigrid hierarchy.
+    struct Level {
+        ChSparseMatrix A;             ///< level matrix
+        ChSparseMatrix P;             ///< prolongation to this level from the next coarser level
+        ChSparseMatrix R;             ///< restriction from this level to the next coarser level
+        ChVectorDynamic<> invdiag;    ///< inverse diagonal of the level matrix (scaled by the Jacobi weight)
+        mutable ChVectorDynamic<> b;  ///< work vector (right-hand side)
+        mutable ChVectorDynamic<> x;  ///< work vector (solution)
+        mutable ChVectorDynamic<> r;  ///< work vector (residual)
+    };
+
+    /// Compute the aggregates of the unknowns of the given matrix and return their number.
+    int Aggregate(const ChSparseMatrix& A, std::vector<int>& aggregate) const;
+
+    /// Set the smoother of the given level and return the estimated spectral radius of D^(-1)*A.
+    double SetupSmoother(Level& level) const;
+
+    /// Apply the given number of damped Jacobi sweeps at the given level.
+    void Smooth(const Level& level, int num_sweeps) const;
+
+    /// Apply the V-cycle at the given level, with the right-hand side in the level work vector b.
+    void Cycle(int l) const;
+
+    double m_threshold;   ///< strength threshold
+    int m_max_levels;     ///< maximum number of levels
+    int m_coarse_size;    ///< size of a directly solved level
+    int m_num_smoothing;  ///< number of smoothing sweeps
+
+    std::vector<Level> m_levels;                      ///< multigrid hierarchy
+    bool m_direct_coarse;                             ///< is the coarsest level solved directly?
+    Eigen::PartialPivLU<ChMatrixDynamic<>> m_coarse;  ///< factorization of the coarsest level matrix
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,236 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <cassert>
+
+#include <Eigen/Cholesky>
+
+#include "chrono/solver/ChBlockSparseMatrix.h"
+
+namespace chrono {
+
+using ChRowMajorBlock = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+// Dense block kernel y += A*x for a block of fixed size R x C, stored in row-major order.
+// Fixed-size Eigen maps let the compiler unroll and vectorize the product.
+template <int R, int C>
+static inline void BlockMultiplyAdd(const double* A, const double* x, double* y) {
+    constexpr int options = (C == 1 && R != 1) ? Eigen::ColMajor : Eigen::RowMajor;
+    Eigen::Map<const Eigen::Matrix<double, R, C, options>> a(A);
+    Eigen::Map<const Eigen::Matrix<double, C, 1>> xv(x);
+    Eigen::Map<Eigen::Matrix<double, R, 1>> yv(y);
+    yv.noalias() += a * xv;
+}
+
+static constexpr int BlockKey(int r, int c) {
+    return (r << 16) | c;
+}
+
+// Dense block kernel y += A*x for a block of size r x c, dispatched to the fixed-size kernels for the block sizes of
+// rigid bodies (6), FEA nodes (3), and the typical groups of constraints.
+static inline void BlockMultiplyAdd(int r, int c, const double* A, const double* x, double* y) {
+    switch (BlockKey(r, c)) {
+        case BlockKey(6, 6):
+            BlockMultiplyAdd<6, 6>(A, x, y);
+            return;
+        case BlockKey(3, 3):
+            BlockMultiplyAdd<3, 3>(A, x, y);
+            return;
+        case BlockKey(6, 3):
+            BlockMultiplyAdd<6, 3>(A, x, y);
+            return;
+        case BlockKey(3, 6):
+            BlockMultiplyAdd<3, 6>(A, x, y);
+            return;
+        case BlockKey(1, 1):
+            y[0] += A[0] * x[0];
+            return;
+        case BlockKey(1, 3):
+            BlockMultiplyAdd<1, 3>(A, x, y);
+            return;
+        case BlockKey(3, 1):
+            BlockMultiplyAdd<3, 1>(A, x, y);
+            return;
+        case BlockKey(1, 6):
+            BlockMultiplyAdd<1, 6>(A, x, y);
+            return;
+        case BlockKey(6, 1):
+            BlockMultiplyAdd<6, 1>(A, x, y);
+            return;
+        case BlockKey(5, 6):
+            BlockMultiplyAdd<5, 6>(A, x, y);
+            return;
+        case BlockKey(6, 5):
+            BlockMultiplyAdd<6, 5>(A, x, y);
+            return;
+        default:
+            Eigen::Map<const ChRowMajorBlock> a(A, r, c);
+            Eigen::Map<const ChVectorDynamic<>> xv(x, c);
+            Eigen::Map<ChVectorDynamic<>> yv(y, r);
+            yv.noalias() += a * xv;
+            return;
+    }
+}
+
+ChBlockSparseMatrix::ChBlockSparseMatrix() : m_nthreads(1) {}
+
+void ChBlockSparseMatrix::Build(const ChSparseMatrix& Z, const std::vector<int>& block_start) {
+    assert(Z.rows() == Z.cols());
+    assert(!block_start.empty() && block_start.front() == 0 && block_start.back() == Z.rows());
+
+    m_block_start = block_start;
+    int num_blocks = GetNumBlocks();
+
+    // Block index of each row (and column)
+    std::vector<int> block_of(Z.rows());
+    for (int i = 0; i < num_blocks; i++)
+        std::fill(block_of.begin() + m_block_start[i], block_of.begin() + m_block_start[i + 1], i);
+
+    // Block sparsity pattern, with sorted block columns in each block row
+    m_row_ptr.resize(num_blocks + 1);
+    m_block_col.clear();
+    std::vector<int> marker(num_blocks, -1);
+    for (int i = 0; i < num_blocks; i++) {
+        m_row_ptr[i] = (int)m_block_col.size();
+        for (int row = m_block_start[i]; row < m_block_start[i + 1]; row++) {
+            for (ChSparseMatrix::InnerIterator it(Z, row); it; ++it) {
+                int j = block_of[it.col()];
+                if (marker[j] != i) {
+                    marker[j] = i;
+                    m_block_col.push_back(j);
+                }
+            }
+        }
+        std::sort(m_block_col.begin() + m_row_ptr[i], m_block_col.end());
+    }
+    m_row_ptr[num_blocks] = (int)m_block_col.size();
+
+    // Storage of the blocks
+    m_val_ptr.resize(m_block_col.size());
+    size_t num_values = 0;
+    for (int i = 0; i < num_blocks; i++) {
+        int r = m_block_start[i + 1] - m_block_start[i];
+        for (int k = m_row_ptr[i]; k < m_row_ptr[i + 1]; k++) {
+            int j = m_block_col[k];
+            m_val_ptr[k] = num_values;
+            num_values += (size_t)r * (m_block_start[j + 1] - m_block_start[j]);
+        }
+    }
+    m_values.assign(num_values, 0.0);
+
+    // Block entries (marker reused for the position of each block column in the current block row)
+    for (int i = 0; i < num_blocks; i++) {
+        for (int k = m_row_ptr[i]; k < m_row_ptr[i + 1]; k++)
+            marker[m_block_col[k]] = k;
+        for (int row = m_block_start[i]; row < m_block_start[i + 1]; row++) {
+            for (ChSparseMatrix::InnerIterator it(Z, row); it; ++it) {
+                int j = block_of[it.col()];
+                size_t c = m_block_start[j + 1] - m_block_start[j];
+                size_t pos = m_val_ptr[marker[j]] + (row - m_block_start[i]) * c + (it.col() - m_block_start[j]);
+                m_values[pos] += it.value();
+            }
+        }
+    }
+
+    // Invalidate the block Jacobi preconditioner
+    m_inv_ptr.clear();
+    m_inv.clear();
+}
+
+void ChBlockSparseMatrix::Multiply(ChVectorConstRef x, ChVectorRef y) const {
+    assert(x.size() == GetNumRows() && y.size() == GetNumRows());
+
+    int num_blocks = GetNumBlocks();
+    const double* xd = x.data();
+    double* yd = y.data();
+
+#pragma omp parallel for schedule(static) num_threads(m_nthreads)
+    for (int i = 0; i < num_blocks; i++) {
+        int r = m_block_start[i + 1] - m_block_start[i];
+        double* yi = yd + m_block_start[i];
+        std::fill(yi, yi + r, 0.0);
+        for (int k = m_row_ptr[i]; k < m_row_ptr[i + 1]; k++) {
+            int j = m_block_col[k];
+            int c = m_block_start[j + 1] - m_block_start[j];
+            BlockMultiplyAdd(r, c, &m_values[m_val_ptr[k]], xd + m_block_start[j], yi);
+        }
+    }
+}
+
+int ChBlockSparseMatrix::SetupBlockJacobi() {
+    int num_blocks = GetNumBlocks();
+
+    m_inv_ptr.resize(num_blocks);
+    size_t num_values = 0;
+    for (int i = 0; i < num_blocks; i++) {
+        int r = m_block_start[i + 1] - m_block_start[i];
+        m_inv_ptr[i] = num_values;
+        num_values += (size_t)r * r;
+    }
+    m_inv.assign(num_values, 0.0);
+
+    int num_fallback = 0;
+
+#pragma omp parallel for schedule(dynamic, 64) reduction(+ : num_fallback) num_threads(m_nthreads)
+    for (int i = 0; i < num_blocks; i++) {
+        int r = m_block_start[i + 1] - m_block_start[i];
+        Eigen::Map<ChRowMajorBlock> inv(&m_inv[m_inv_ptr[i]], r, r);
+
+        // Diagonal block (zero if not stored)
+        ChMatrixDynamic<> D = ChMatrixDynamic<>::Zero(r, r);
+        auto first = m_block_col.begin() + m_row_ptr[i];
+        auto last = m_block_col.begin() + m_row_ptr[i + 1];
+        auto diag = std::lower_bound(first, last, i);
+        if (diag != last && *diag == i) {
+            auto k = diag - m_block_col.begin();
+            D = Eigen::Map<const ChRowMajorBlock>(&m_values[m_val_ptr[k]], r, r);
+        }
+
+        if (D.isApprox(D.transpose())) {
+            Eigen::LLT<ChMatrixDynamic<>> llt(D);
+            if (llt.info() == Eigen::Success) {
+                inv = llt.solve(ChMatrixDynamic<>::Identity(r, r));
+                continue;
+            }
+        }
+
+        // Fall back to diagonal scaling
+        inv.setZero();
+        for (int j = 0; j < r; j++)
+            inv(j, j) = (std::abs(D(j, j)) > 1e-9) ? 1.0 / D(j, j) : 1.0;
+        num_fallback++;
+    }
+
+    return num_fallback;
+}
+
+void ChBlockSparseMatrix::ApplyBlockJacobi(ChVectorConstRef x, ChVectorRef y) const {
+    assert(x.size() == GetNumRows() && y.size() == GetNumRows());
+    assert(m_inv_ptr.size() == (size_t)GetNumBlocks());
+
+    int num_blocks = GetNumBlocks();
+    const double* xd = x.data();
+    double* yd = y.data();
+
+#pragma omp parallel for schedule(static) num_threads(m_nthreads)
+    for (int i = 0; i < num_blocks; i++) {
+        int r = m_block_start[i + 1] - m_block_start[i];
+        double* yi = yd + m_block_start[i];
+        std::fill(yi, yi + r, 0.0);
+        BlockMultiplyAdd(r, r, &m_inv[m_inv_ptr[i]], xd + m_block_start[i], yi);
+    }
+}
+
+}  // end namespace chrono
@@ -0,0 +1,94 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Block-sparse (variable block CSR) matrix with small dense blocks.
+//
+// =============================================================================
+
+#ifndef CH_BLOCK_SPARSE_MATRIX_H
+#define CH_BLOCK_SPARSE_MATRIX_H
+
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Block-sparse matrix with small dense blocks, in block compressed sparse row format.
+/// Rows and columns are partitioned in the same blocks, typically one per variable object (e.g., 6 for a rigid body,
+/// 3 for an FEA node) and one per group of constraints acting on the same variables. Non-zero blocks are stored as
+/// dense row-major arrays, contiguous within a block row, so that the matrix-vector products use fixed-size kernels
+/// for the common block sizes (up to 6x6), vectorized by Eigen, with one index per block rather than one per entry.
+///
+/// The matrix also provides a block Jacobi preconditioner, obtained from the inverses of its diagonal blocks.
+class ChApi ChBlockSparseMatrix {
+  public:
+    ChBlockSparseMatrix();
+
+    /// Set the number of OpenMP threads used in the matrix-vector products (default: 1).
+    void SetNumThreads(int nthreads) { m_nthreads = (nthreads < 1) ? 1 : nthreads; }
+
+    /// Build the block matrix from the given (square) sparse matrix.
+    /// The block partition of rows and columns is specified through the offsets of the blocks: block i spans the rows
+    /// (and columns) block_start[i], ..., block_start[i+1]-1, with block_start.back() equal to the matrix size.
+    /// Any block containing a structural non-zero entry of Z is stored.
+    void Build(const ChSparseMatrix& Z, const std::vector<int>& block_start);
+
+    /// Return the number of rows (and columns) of the matrix.
+    int GetNumRows() const { return m_block_start.empty() ? 0 : m_block_start.back(); }
+
+    /// Return the number of block rows (and block columns) of the matrix.
+    int GetNumBlocks() const { return (int)m_block_start.size() - 1; }
+
+    /// Return the number of stored (non-zero) blocks.
+    int GetNumNonZeroBlocks() const { return (int)m_block_col.size(); }
+
+    /// Return the number of stored scalar entries.
+    size_t GetNumStoredEntries() const { return m_values.size(); }
+
+    /// Compute the product y = A*x.
+    void Multiply(ChVectorConstRef x, ChVectorRef y) const;
+
+    /// Compute the inverses of the diagonal blocks, used by the block Jacobi preconditioner.
+    /// Symmetric positive definite diagonal blocks are inverted through a Cholesky decomposition. Other blocks (e.g.,
+    /// the zero diagonal blocks of rigid constraints) fall back to scaling by the inverse diagonal entries, with unit
+    /// factors for vanishing entries. Return the number of blocks which fell back to diagonal scaling.
+    int SetupBlockJacobi();
+
+    /// Apply the block Jacobi preconditioner: y = D^(-1)*x, with D the block diagonal of the matrix.
+    /// SetupBlockJacobi must be called first.
+    void ApplyBlockJacobi(ChVectorConstRef x, ChVectorRef y) const;
+
+  private:
+    std::vector<int> m_block_start;  ///< row (and column) offsets of the blocks
+    std::vector<int> m_row_ptr;      ///< index of the first stored block of each block row
+    std::vector<int> m_block_col;    ///< block column of each stored block
+    std::vector<size_t> m_val_ptr;   ///< offset in the values array of each stored block
+    std::vector<double> m_values;    ///< entries of the stored blocks (row-major within each block)
+
+    std::vector<size_t> m_inv_ptr;  ///< offset in the inverse values array of each diagonal block
+    std::vector<double> m_inv;      ///< entries of the inverse diagonal blocks (row-major within each block)
+
+    int m_nthreads;  ///< number of OpenMP threads
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
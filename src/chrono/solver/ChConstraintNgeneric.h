@@ -45,6 +45,11 @@ class ChApi ChConstraintNgeneric : public ChConstraint {
     /// Access the Nth variable object.
     ChVariables* GetVariables_N(size_t n) { return variables[n]; }
 
+    /// Append all constrained variable objects to the given list.
+    virtual void GetReferencedVariables(std::vector<ChVariables*>& vars) const override {
+        vars.insert(vars.end(), variables.begin(), variables.end());
+    }
+
     /// Set references to the constrained ChVariables objects,automatically creating/resizing Jacobians as needed.
     void SetVariables(std::vector<ChVariables*> mvars);
 
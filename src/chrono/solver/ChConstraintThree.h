@@ -69,6 +69,13 @@ class ChApi ChConstraintThree : public ChConstraint {
     /// Access the second variable object.
     ChVariables* GetVariables_c() { return variables_c; }
 
+    /// Append the three constrained variable objects to the given list.
+    virtual void GetReferencedVariables(std::vector<ChVariables*>& variables) const override {
+        variables.push_back(variables_a);
+        variables.push_back(variables_b);
+        variables.push_back(variables_c);
+    }
+
     /// Set references to the constrained objects, each of ChVariables type,
     /// automatically creating/resizing jacobians if needed.
     virtual void SetVariables(ChVariables* mvariables_a, ChVariables* mvariables_b, ChVariables* mvariables_c) = 0;
@@ -61,6 +61,12 @@ class ChApi ChConstraintTwo : public ChConstraint {
     /// Access the second variable object.
     ChVariables* GetVariables_b() { return variables_b; }
 
+    /// Append the two constrained variable objects to the given list.
+    virtual void GetReferencedVariables(std::vector<ChVariables*>& variables) const override {
+        variables.push_back(variables_a);
+        variables.push_back(variables_b);
+    }
+
     /// Set references to the constrained objects, each of ChVariables type,
     /// automatically creating/resizing jacobians if needed.
     virtual void SetVariables(ChVariables* mvariables_a, ChVariables* mvariables_b) = 0;
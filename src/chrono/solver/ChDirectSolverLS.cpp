@@ -12,6 +12,8 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 
 #include "chrono/core/ChSparsityPatternLearner.h"
@@ -33,7 +35,33 @@ ChDirectSolverLS::ChDirectSolverLS()
       m_dim(0),
       m_sparsity(-1),
       m_solve_call(0),
-      m_setup_call(0) {}
+      m_setup_call(0),
+      m_analysis_call(0),
+      m_reuse_analysis(false),
+      m_parallel_assembly(false),
+      m_assembly_map_valid(false),
+      m_analyze(true),
+      m_topology_revision(0),
+      m_nnz(0),
+      m_mixed_precision(false),
+      m_mixed_fallback(false),
+      m_single_factor(false),
+      m_mat_norm(0),
+      m_max_refinement(10),
+      m_refinement_tol(1e-12),
+      m_refinement_steps(0),
+      m_num_fallbacks(0) {}
+
+void ChDirectSolverLS::UseMixedPrecision(bool val) {
+    m_mixed_precision = val;
+    m_mixed_fallback = false;
+    m_num_fallbacks = 0;
+}
+
+void ChDirectSolverLS::SetRefinementParameters(int max_iterations, double tolerance) {
+    m_max_refinement = max_iterations;
+    m_refinement_tol = tolerance;
+}
 
 void ChDirectSolverLS::ResetTimers() {
     m_timer_setup_assembly.reset();
@@ -49,6 +77,11 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
     // Note that ChSystemDescriptor::UpdateCountsAndOffsets was already called at the beginning of the step.
     m_dim = sysd.CountActiveVariables() + sysd.CountActiveConstraints();
 
+    // If reusing the symbolic analysis with a locked pattern, force a sparsity pattern update on topology changes
+    bool reuse = m_lock && m_reuse_analysis;
+    if (reuse && sysd.GetTopologyRevision() != m_topology_revision)
+        m_force_update = true;
+
     // If use of the sparsity pattern learner is enabled, call it if:
     // (a) an explicit update was requested (by default this is true at the first call), or
     // (b) the sparsity pattern is not locked and so has to be re-evaluated at each call
@@ -58,7 +91,7 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
     // using the current sparsity level estimate, if:
     // (a) this is the first call to setup, or
     // (b) the sparsity pattern is not locked and so has to be re-evaluated at each call
-    bool call_reserve = !m_use_learner && (m_setup_call == 0 || !m_lock);
+    bool call_reserve = !m_use_learner && (m_setup_call == 0 || !m_lock || (reuse && m_force_update));
 
     if (verbose) {
         std::cout << "Solver setup" << std::endl;
@@ -67,6 +100,7 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         std::cout << "  pattern locked? " << m_lock << std::endl;
         std::cout << "  CALL learner:   " << call_learner << std::endl;
         std::cout << "  CALL reserve:   " << call_reserve << std::endl;
+        std::cout << "  reuse analysis? " << reuse << std::endl;
     }
 
     if (call_learner) {
@@ -78,14 +112,33 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         double density = (m_sparsity > 0) ? 1 - m_sparsity : 1 - SPM_DEF_SPARSITY;
         m_mat.resize(m_dim, m_dim);
         m_mat.reserve(Eigen::VectorXi::Constant(m_dim, static_cast<int>(m_dim * density)));
+        m_force_update = false;
     }
 
-    // Let the system descriptor load the current matrix
-    sysd.BuildSystemMatrix(&m_mat, nullptr);
+    // Let the system descriptor load the current matrix.
+    // With a locked pattern, values are written in place in the existing (compressed) sparse storage, optionally in
+    // parallel at cached positions (recomputed if the last assembly was not performed in place).
+    bool in_place = false;
+    if (m_parallel_assembly && m_lock && !call_learner && !call_reserve)
+        in_place = sysd.BuildSystemMatrixInPlace(m_mat, !m_assembly_map_valid);
+    if (!in_place)
+        sysd.BuildSystemMatrix(&m_mat, nullptr);
+    m_assembly_map_valid = in_place;
+
+    // A symbolic analysis is required unless reusing it and the sparsity pattern is known to be unchanged.
+    // Note that inserting a new nonzero in a compressed matrix switches it to uncompressed mode.
+    m_analyze = !reuse || call_learner || call_reserve || m_analysis_call == 0 || !m_mat.isCompressed() ||
+                m_mat.nonZeros() != m_nnz;
 
     // Allow the matrix to be compressed
     m_mat.makeCompressed();
 
+    if (m_analyze) {
+        m_topology_revision = sysd.GetTopologyRevision();
+        m_nnz = m_mat.nonZeros();
+        m_analysis_call++;
+    }
+
     m_timer_setup_assembly.stop();
 
     if (write_matrix)
@@ -93,7 +146,7 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
 
     // Let the concrete solver perform the facorization
     m_timer_setup_solvercall.start();
-    bool result = FactorizeMatrix();
+    bool result = FactorizeWithPrecision();
     m_timer_setup_solvercall.stop();
 
     if (write_matrix)
@@ -130,7 +183,7 @@ double ChDirectSolverLS::Solve(ChSystemDescriptor& sysd) {
 
     // Let the concrete solver compute the solution
     m_timer_solve_solvercall.start();
-    bool result = SolveSystem();
+    bool result = SolveWithRefinement();
     m_timer_solve_solvercall.stop();
 
     if (write_matrix)
@@ -165,11 +218,16 @@ bool ChDirectSolverLS::SetupCurrent() {
     // Allow the matrix to be compressed, if not yet compressed
     m_mat.makeCompressed();
 
+    // The matrix was assembled externally, so always perform a symbolic analysis
+    m_analyze = true;
+    m_nnz = m_mat.nonZeros();
+    m_analysis_call++;
+
     m_timer_setup_assembly.stop();
 
     // Let the concrete solver perform the factorization
     m_timer_setup_solvercall.start();
-    bool result = FactorizeMatrix();
+    bool result = FactorizeWithPrecision();
     m_timer_setup_solvercall.stop();
 
     if (verbose) {
@@ -198,7 +256,7 @@ double ChDirectSolverLS::SolveCurrent() {
 
     // Let the concrete solver compute the solution
     m_timer_solve_solvercall.start();
-    bool result = SolveSystem();
+    bool result = SolveWithRefinement();
     m_timer_solve_solvercall.stop();
 
     if (verbose) {
@@ -222,6 +280,102 @@ double ChDirectSolverLS::SolveCurrent() {
 
 // ---------------------------------------------------------------------------
 
+bool ChDirectSolverLS::FactorizeWithPrecision() {
+    bool single = m_mixed_precision && !m_mixed_fallback && SupportsMixedPrecision();
+
+    // The factorization engine for the other precision has no valid symbolic analysis
+    if (single != m_single_factor)
+        m_analyze = true;
+    m_single_factor = single;
+
+    if (single) {
+        // Load the single precision matrix, in place if the sparsity pattern is unchanged
+        if (m_analyze || m_mat_single.nonZeros() != m_mat.nonZeros() || m_mat_single.rows() != m_mat.rows()) {
+            m_mat_single = m_mat.cast<float>();
+            m_mat_single.makeCompressed();
+        } else {
+            Eigen::Map<Eigen::VectorXf>(m_mat_single.valuePtr(), m_mat_single.nonZeros()) =
+                Eigen::Map<const Eigen::VectorXd>(m_mat.valuePtr(), m_mat.nonZeros()).cast<float>();
+        }
+
+        // Infinity norm of the matrix, for the refinement stopping criterion
+        m_mat_norm = 0;
+        for (int i = 0; i < m_mat.outerSize(); i++) {
+            double row_sum = 0;
+            for (ChSparseMatrix::InnerIterator it(m_mat, i); it; ++it)
+                row_sum += std::abs(it.value());
+            m_mat_norm = std::max(m_mat_norm, row_sum);
+        }
+    } else {
+        m_mat_single.resize(0, 0);
+        m_mat_single.data().squeeze();
+    }
+
+    return FactorizeMatrix();
+}
+
+bool ChDirectSolverLS::SolveWithRefinement() {
+    m_refinement_steps = 0;
+    bool result = SolveSystem();
+    if (result && m_single_factor)
+        result = RefineSolution();
+    return result;
+}
+
+bool ChDirectSolverLS::RefineSolution() {
+    ChVectorDynamic<double> b = m_rhs;
+    ChVectorDynamic<double> x = m_sol;
+    double b_norm = b.lpNorm<Eigen::Infinity>();
+
+    ChVectorDynamic<double> r = b - m_mat * x;
+    double r_norm = r.lpNorm<Eigen::Infinity>();
+    bool converged = false;
+    bool stagnated = false;
+
+    // Solve for corrections with the single precision factors, using residuals in double precision
+    while (true) {
+        if (r_norm <= m_refinement_tol * (m_mat_norm * x.lpNorm<Eigen::Infinity>() + b_norm)) {
+            converged = true;
+            break;
+        }
+        if (stagnated || m_refinement_steps >= m_max_refinement)
+            break;
+
+        m_rhs = r;
+        if (!SolveSystem())
+            break;
+        x += m_sol;
+        m_refinement_steps++;
+
+        r = b - m_mat * x;
+        double r_norm_new = r.lpNorm<Eigen::Infinity>();
+        stagnated = !(r_norm_new <= 0.5 * r_norm);
+        r_norm = r_norm_new;
+    }
+
+    m_rhs = b;
+    if (converged) {
+        m_sol = x;
+        return true;
+    }
+
+    // Fall back to a double precision factorization
+    if (verbose) {
+        std::cout << " Solver refinement stagnated after " << m_refinement_steps
+                  << " steps; falling back to double precision" << std::endl;
+    }
+    m_num_fallbacks++;
+    m_mixed_fallback = true;
+    m_single_factor = false;
+    m_analyze = true;
+    m_mat_single.resize(0, 0);
+    m_mat_single.data().squeeze();
+
+    return FactorizeMatrix() && SolveSystem();
+}
+
+// ---------------------------------------------------------------------------
+
 void ChDirectSolverLS::WriteMatrix(const std::string& filename, const ChSparseMatrix& M) {
     std::ofstream file(filename);
     file << std::setprecision(12) << std::scientific;
@@ -244,6 +398,17 @@ void ChDirectSolverLS::WriteVector(const std::string& filename, const ChVectorDy
 
 // ---------------------------------------------------------------------------
 
+// Memory used by the values and indices of a compressed sparse matrix.
+template <typename Scalar, int Options>
+static size_t SparseMatrixMemory(const Eigen::SparseMatrix<Scalar, Options, int>& A) {
+    return (size_t)A.nonZeros() * (sizeof(Scalar) + sizeof(int)) + (size_t)(A.outerSize() + 1) * sizeof(int);
+}
+
+size_t ChDirectSolverLS::GetMemoryUsage() const {
+    return SparseMatrixMemory(m_mat) + SparseMatrixMemory(m_mat_single) +
+           (size_t)(m_rhs.size() + m_sol.size()) * sizeof(double) + GetFactorizationMemoryUsage();
+}
+
 void ChDirectSolverLS::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChDirectSolverLS>();
@@ -275,18 +440,40 @@ void ChDirectSolverLS::ArchiveIn(ChArchiveIn& archive_in) {
 // ---------------------------------------------------------------------------
 
 bool ChSolverSparseLU::FactorizeMatrix() {
-    m_engine.compute(m_mat);
+    if (m_single_factor) {
+        if (m_analyze)
+            m_engine_single.analyzePattern(m_mat_single);
+        m_engine_single.factorize(m_mat_single);
+        return (m_engine_single.info() == Eigen::Success);
+    }
+
+    if (m_analyze)
+        m_engine.analyzePattern(m_mat);
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
 bool ChSolverSparseLU::SolveSystem() {
+    if (m_single_factor) {
+        m_sol = m_engine_single.solve(m_rhs.cast<float>()).cast<double>();
+        return (m_engine_single.info() == Eigen::Success);
+    }
+
     m_sol = m_engine.solve(m_rhs);
     return (m_engine.info() == Eigen::Success);
 }
 
+size_t ChSolverSparseLU::GetFactorizationMemoryUsage() const {
+    if (m_setup_call == 0)
+        return 0;
+    if (m_single_factor)
+        return (size_t)(m_engine_single.nnzL() + m_engine_single.nnzU()) * (sizeof(float) + sizeof(int));
+    return (size_t)(m_engine.nnzL() + m_engine.nnzU()) * (sizeof(double) + sizeof(int));
+}
+
 void ChSolverSparseLU::PrintErrorMessage() {
     // There are only three possible return codes (see Eigen SparseLU.h)
-    switch (m_engine.info()) {
+    switch (m_single_factor ? m_engine_single.info() : m_engine.info()) {
         case Eigen::Success:
             std::cout << "computation was successful" << std::endl;
             break;
@@ -304,7 +491,9 @@ void ChSolverSparseLU::PrintErrorMessage() {
 // ---------------------------------------------------------------------------
 
 bool ChSolverSparseQR::FactorizeMatrix() {
-    m_engine.compute(m_mat);
+    if (m_analyze)
+        m_engine.analyzePattern(m_mat);
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
@@ -313,6 +502,12 @@ bool ChSolverSparseQR::SolveSystem() {
     return (m_engine.info() == Eigen::Success);
 }
 
+size_t ChSolverSparseQR::GetFactorizationMemoryUsage() const {
+    if (m_setup_call == 0)
+        return 0;
+    return SparseMatrixMemory(m_engine.matrixR());
+}
+
 void ChSolverSparseQR::PrintErrorMessage() {
     // There are only three possible return codes (see Eigen SparseLU.h)
     switch (m_engine.info()) {
@@ -46,11 +46,25 @@ Setup. This feature is intended for problems where the system matrix sparsity pa
 call to call.\n
 See #LockSparsityPattern();
 
+The sparsity pattern \e lock can be combined with \e reuse of the symbolic analysis (reordering and symbolic
+factorization) of the problem matrix. In this mode, the matrix values are written in place in the existing sparse
+storage and only the numerical factorization is performed at each call to Setup. The symbolic analysis (and the
+sparsity pattern learning) is redone only when the problem topology changes, as reported by the topology revision
+counter of the system descriptor (see ChSystemDescriptor::GetTopologyRevision), or when new nonzeros must be inserted in
+the locked matrix.\n
+See #ReuseSymbolicAnalysis();
+
 The sparsity pattern \e learning feature acquires the sparsity pattern in advance, in order to speed up matrix assembly.
 Enabled by default, the sparsity matrix learner identifies the exact matrix sparsity pattern (without actually setting
 any nonzeros).\n
 See #UseSparsityPatternLearner();
 
+The matrix can optionally be factorized in single precision, with double precision accuracy recovered through
+iterative refinement of the solution using the double precision matrix. This halves the memory of the factors and
+speeds up the factorization, at the cost of a few additional triangular solves. If refinement stagnates (e.g., for an
+ill-conditioned matrix), the solver falls back to a double precision factorization.\n
+See #UseMixedPrecision();
+
 A further option allows the user to provide an estimate for the matrix sparsity (a value in [0,1], with 0 corresponding
 to a fully dense matrix). This value is used if the sparsity pattern learner is disabled if/when required to reserve
 space for matrix indices and nonzeros.
@@ -92,6 +106,45 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// or structure occurred. This function has no effect if the sparsity pattern learner is disabled.
     void ForceSparsityPatternUpdate() { m_force_update = true; }
 
+    /// Enable/disable reuse of the symbolic analysis of the problem matrix across calls to Setup (default: false).\n
+    /// This option is effective only if the sparsity pattern is also locked. If enabled, the sparsity pattern learner
+    /// and the symbolic analysis phase of the concrete solver are invoked only at the first call and whenever a change
+    /// in the problem topology is detected; all other calls only perform the numerical factorization.
+    /// A concrete direct sparse solver may or may not support this feature (in which case a full factorization is
+    /// always performed).
+    void ReuseSymbolicAnalysis(bool val) { m_reuse_analysis = val; }
+
+    /// Enable/disable parallel in-place assembly of the problem matrix (default: false).\n
+    /// This option is effective only if the sparsity pattern is also locked. If enabled, the positions of all matrix
+    /// entries in the sparse storage are computed once (and again only on topology changes), after which the system
+    /// descriptor writes the matrix values directly at these positions, in parallel over variables, KRM blocks, and
+    /// constraints (see ChSystemDescriptor::BuildSystemMatrixInPlace). The number of threads is that of the system
+    /// descriptor.
+    void UseParallelAssembly(bool val) { m_parallel_assembly = val; }
+
+    /// Enable/disable mixed precision factorization with iterative refinement (default: false).\n
+    /// If enabled, the matrix is factorized in single precision and each solution is refined with the residual
+    /// computed with the double precision matrix, until the normwise backward error is below the refinement tolerance
+    /// (see SetRefinementParameters). If refinement stagnates or does not converge, the matrix is refactorized in
+    /// double precision and the solution recomputed; double precision is then used for all subsequent calls, until
+    /// this function is called again. A concrete direct sparse solver may or may not support this feature (in which
+    /// case the factorization is always performed in double precision).
+    void UseMixedPrecision(bool val);
+
+    /// Set the parameters of the iterative refinement used with mixed precision (default: 10, 1e-12).\n
+    /// Refinement stops when |b - A*x| <= tolerance * (|A| |x| + |b|), in infinity norms, or after the specified
+    /// number of steps. Refinement is considered stagnated if a step does not halve the residual.
+    void SetRefinementParameters(int max_iterations, double tolerance);
+
+    /// Return true if the current factorization is in single precision.
+    bool IsSinglePrecisionFactorization() const { return m_single_factor; }
+
+    /// Return the number of refinement steps in the last solve.
+    int GetNumRefinementSteps() const { return m_refinement_steps; }
+
+    /// Return the number of fallbacks to double precision since mixed precision was enabled.
+    unsigned int GetNumPrecisionFallbacks() const { return m_num_fallbacks; }
+
     /// Set estimate for matrix sparsity, a value in [0,1], with 0 indicating a fully dense matrix (default: 0.9).\n
     /// Only used if the sparsity pattern learner is disabled.
     void SetSparsityEstimate(double sparsity) { m_sparsity = sparsity; }
@@ -127,6 +180,12 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     unsigned int GetNumSetupCalls() const { return m_setup_call; }
     /// Return the number of calls to the solver's Setup function.
     unsigned int GetNumSolveCalls() const { return m_solve_call; }
+    /// Return the number of calls to the solver's Setup function which required a symbolic analysis.
+    unsigned int GetNumAnalysisCalls() const { return m_analysis_call; }
+
+    /// Return an estimate of the memory (in bytes) used by the solver: problem matrix (and its single precision copy,
+    /// if any), right-hand side and solution vectors, and current factorization (if reported by the concrete solver).
+    virtual size_t GetMemoryUsage() const override;
 
     /// Get a handle to the underlying matrix.
     ChSparseMatrix& GetMatrix() { return m_mat; }
@@ -177,6 +236,9 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     virtual ChDirectSolverLS* AsDirect() override { return this; }
 
     /// Factorize the current sparse matrix and return true if successful.
+    /// A derived class supporting reuse of the symbolic analysis should perform the analysis phase only if
+    /// m_analyze is true and otherwise only refactorize the matrix (which is guaranteed to have the same sparsity
+    /// pattern as at the last analysis).
     virtual bool FactorizeMatrix() = 0;
 
     /// Solve the linear system using the current factorization and right-hand side vector.
@@ -187,6 +249,15 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// This function is only called if Factorize or Solve returned false.
     virtual void PrintErrorMessage() = 0;
 
+    /// Indicate whether or not the concrete solver supports a single precision factorization.
+    /// A derived class that supports it must factorize m_mat_single (instead of m_mat) if m_single_factor is true and
+    /// then solve with the single precision factors. Note that m_analyze is always set when the precision changes.
+    virtual bool SupportsMixedPrecision() const { return false; }
+
+    /// Return an estimate of the memory (in bytes) used by the current factorization.
+    /// The default implementation returns 0 (unknown).
+    virtual size_t GetFactorizationMemoryUsage() const { return 0; }
+
     /// Indicate whether or not the #Solve() phase requires an up-to-date problem matrix.
     /// Typically, direct solvers only require the matrix for their #Setup() phase.
     virtual bool SolveRequiresMatrix() const override { return false; }
@@ -198,13 +269,32 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     ChVectorDynamic<double> m_rhs;  ///< right-hand side vector
     ChVectorDynamic<double> m_sol;  ///< solution vector
 
-    unsigned int m_solve_call;  ///< counter for calls to Solve
-    unsigned int m_setup_call;  ///< counter for calls to Setup
+    unsigned int m_solve_call;     ///< counter for calls to Solve
+    unsigned int m_setup_call;     ///< counter for calls to Setup
+    unsigned int m_analysis_call;  ///< counter for calls to Setup with symbolic analysis
 
     bool m_lock;          ///< is the matrix sparsity pattern locked?
     bool m_use_learner;   ///< use the sparsity pattern learner?
     bool m_force_update;  ///< force a call to the sparsity pattern learner?
 
+    bool m_reuse_analysis;              ///< reuse symbolic analysis when the pattern is locked?
+    bool m_parallel_assembly;           ///< assemble the matrix in place and in parallel?
+    bool m_assembly_map_valid;          ///< was the last assembly performed in place?
+    bool m_analyze;                     ///< must the current factorization include the symbolic analysis?
+    unsigned int m_topology_revision;   ///< descriptor topology revision at last pattern update
+    Eigen::Index m_nnz;                 ///< number of nonzeros at last pattern update
+
+    bool m_mixed_precision;        ///< factorize in single precision and refine?
+    bool m_mixed_fallback;         ///< was mixed precision abandoned after a stagnated refinement?
+    bool m_single_factor;          ///< is the current factorization in single precision?
+    double m_mat_norm;             ///< infinity norm of the problem matrix
+    int m_max_refinement;          ///< maximum number of refinement steps
+    double m_refinement_tol;       ///< tolerance on the normwise backward error
+    int m_refinement_steps;        ///< number of refinement steps in the last solve
+    unsigned int m_num_fallbacks;  ///< number of fallbacks to double precision
+
+    Eigen::SparseMatrix<float, Eigen::RowMajor, int> m_mat_single;  ///< single precision copy of the problem matrix
+
     bool m_use_perm;              ///< use of the permutation vector?
     bool m_use_rhs_sparsity;      ///< leverage right-hand side sparsity?
     bool m_null_pivot_detection;  ///< enable detection of zero pivots?
@@ -215,6 +305,15 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     ChTimer m_timer_solve_solvercall;  ///< timer for solution
 
   private:
+    /// Select the factorization precision, load the single precision matrix if needed, and factorize.
+    bool FactorizeWithPrecision();
+
+    /// Solve with the current factorization, refining the solution if the factorization is in single precision.
+    bool SolveWithRefinement();
+
+    /// Refine the current solution and fall back to a double precision factorization if refinement stagnates.
+    bool RefineSolution();
+
     void WriteMatrix(const std::string& filename, const ChSparseMatrix& M);
     void WriteVector(const std::string& filename, const ChVectorDynamic<double>& v);
 };
@@ -243,7 +342,16 @@ class ChApi ChSolverSparseLU : public ChDirectSolverLS {
     /// This function is only called if Factorize or Solve returned false.
     virtual void PrintErrorMessage() override;
 
+    /// The SparseLU solver supports mixed precision factorization.
+    virtual bool SupportsMixedPrecision() const override { return true; }
+
+    /// Return the memory used by the L and U factors.
+    virtual size_t GetFactorizationMemoryUsage() const override;
+
     Eigen::SparseLU<ChSparseMatrix, Eigen::COLAMDOrdering<int>> m_engine;  ///< Eigen SparseLU solver
+
+    /// Eigen SparseLU solver for single precision factorization
+    Eigen::SparseLU<Eigen::SparseMatrix<float, Eigen::RowMajor, int>, Eigen::COLAMDOrdering<int>> m_engine_single;
 };
 
 /// Sparse QR direct solver.\n
@@ -268,6 +376,9 @@ class ChApi ChSolverSparseQR : public ChDirectSolverLS {
     /// This function is only called if Factorize or Solve returned false.
     virtual void PrintErrorMessage() override;
 
+    /// Return the memory used by the R factor (the Householder reflectors of Q are not included).
+    virtual size_t GetFactorizationMemoryUsage() const override;
+
     Eigen::SparseQR<ChSparseMatrix, Eigen::COLAMDOrdering<int>> m_engine;  ///< Eigen SparseQR solver
 };
 
@@ -16,6 +16,10 @@
 // All iterative linear solvers are implemented in a matrix-free context and
 // rely on the system descriptor for the required SPMV operations.
 // They can optionally use a diagonal preconditioner.
+// Alternatively, the system matrix can be assembled in block-sparse format,
+// used for the SPMV operations and for a block Jacobi preconditioner.
+// Incomplete factorization and algebraic multigrid preconditioners are also
+// available.
 //
 // Available solvers:
 //   GMRES
@@ -47,7 +51,7 @@ CH_UPCASTING(ChIterativeSolverLS, ChIterativeSolver)
 CH_UPCASTING(ChIterativeSolverLS, ChSolverLS)
 
 // Matrix-free wrapper from a user type to Eigen's compatible type.
-// We defer to the system descriptor to perform the SPMV operation.
+// We defer to the system descriptor (or to the block-sparse system matrix, if provided) to perform the SPMV operation.
 class ChMatrixSPMV : public Eigen::EigenBase<ChMatrixSPMV> {
   public:
     // Required typedefs, constants, and method
@@ -65,73 +69,72 @@ class ChMatrixSPMV : public Eigen::EigenBase<ChMatrixSPMV> {
     }
 
     // Custom API
-    ChMatrixSPMV() : m_N(0), m_sysd(nullptr) {}
-    void Setup(Index N, chrono::ChSystemDescriptor& sysd) {
+    ChMatrixSPMV() : m_N(0), m_sysd(nullptr), m_block(nullptr) {}
+    void Setup(Index N, chrono::ChSystemDescriptor& sysd, const ChBlockSparseMatrix* block = nullptr) {
         m_N = N;
         m_sysd = &sysd;
+        m_block = block;
         m_vect.resize(m_N);
     }
     chrono::ChSystemDescriptor* sysd() { return m_sysd; }
+    const chrono::ChBlockSparseMatrix* block() const { return m_block; }
     chrono::ChVectorDynamic<>& vect() { return m_vect; }
 
   private:
-    Index m_N;                           // problem dimension
-    chrono::ChSystemDescriptor* m_sysd;  // pointer to system descriptor
+    Index m_N;                                   // problem dimension
+    chrono::ChSystemDescriptor* m_sysd;          // pointer to system descriptor
+    const chrono::ChBlockSparseMatrix* m_block;  // pointer to block-sparse system matrix (if any)
     chrono::ChVectorDynamic<> m_vect;    // workspace for the result of the SPMV operation
 };
 
-/// Simple diagonal preconditioner
-class ChDiagonalPreconditioner {
+// Wrapper class for using the preconditioner of a Chrono iterative solver with the Eigen iterative solvers.
+// We defer to the solver to apply the preconditioner.
+class ChPreconditionerLS {
     typedef double Scalar;
 
   public:
     typedef int StorageIndex;
     enum { ColsAtCompileTime = Eigen::Dynamic, MaxColsAtCompileTime = Eigen::Dynamic };
 
-    ChDiagonalPreconditioner() : m_N(0), m_diag_precond(false), m_invdiag(nullptr) {}
+    ChPreconditionerLS() : m_N(0), m_solver(nullptr) {}
 
-    void Setup(Eigen::Index N, const ChVectorDynamic<>& invdiag) {
+    void Setup(Eigen::Index N, const ChIterativeSolverLS& solver) {
         m_N = N;
-        m_invdiag = &invdiag;
-        m_diag_precond = (invdiag.size() > 0);
+        m_solver = &solver;
     }
 
     Eigen::Index rows() const { return m_N; }
     Eigen::Index cols() const { return m_N; }
 
     template <typename MatType>
-    ChDiagonalPreconditioner& analyzePattern(const MatType&) {
+    ChPreconditionerLS& analyzePattern(const MatType&) {
         return *this;
     }
     template <typename MatType>
-    ChDiagonalPreconditioner& factorize(const MatType& mat) {
+    ChPreconditionerLS& factorize(const MatType& mat) {
         return *this;
     }
     template <typename MatType>
-    ChDiagonalPreconditioner& compute(const MatType& mat) {
+    ChPreconditionerLS& compute(const MatType& mat) {
         return *this;
     }
 
     template <typename Rhs, typename Dest>
     void _solve_impl(const Rhs& b, Dest& x) const {
-        if (m_diag_precond) {
-            x = m_invdiag->array() * b.array();
-        } else {
-            x = b;
-        }
+        x.resize(b.size());
+        m_solver->ApplyPreconditioner(b, x);
     }
 
     template <typename Rhs>
-    inline const Eigen::Solve<ChDiagonalPreconditioner, Rhs> solve(const Eigen::MatrixBase<Rhs>& b) const {
-        return Eigen::Solve<ChDiagonalPreconditioner, Rhs>(*this, b.derived());
+    inline const Eigen::Solve<ChPreconditionerLS, Rhs> solve(const Eigen::MatrixBase<Rhs>& b) const {
+        return Eigen::Solve<ChPreconditionerLS, Rhs>(*this, b.derived());
     }
 
     Eigen::ComputationInfo info() { return Eigen::Success; }
 
   protected:
-    Eigen::Index m_N;                    // problem dimension
-    const ChVectorDynamic<>* m_invdiag;  // pointer to (invcerse) diagonal entries
-    bool m_diag_precond;                 // if false, no preconditioning
+    Eigen::Index m_N;                     // problem dimension
+    const ChIterativeSolverLS* m_solver;  // pointer to the solver providing the preconditioner
 };
 
 }  // namespace chrono
@@ -155,7 +158,10 @@ struct generic_product_impl<chrono::ChMatrixSPMV, Rhs, SparseShape, DenseShape,
         // Hack to allow calling ChSystemDescriptor::SystemProduct
         auto lhs_ = const_cast<chrono::ChMatrixSPMV&>(lhs);
 
-        lhs_.sysd()->SystemProduct(lhs_.vect(), rhs);
+        if (lhs_.block())
+            lhs_.block()->Multiply(rhs, lhs_.vect());
+        else
+            lhs_.sysd()->SystemProduct(lhs_.vect(), rhs);
         dst += lhs_.vect();
     }
 };
@@ -172,8 +178,18 @@ CH_FACTORY_REGISTER(ChSolverGMRES)
 CH_FACTORY_REGISTER(ChSolverBiCGSTAB)
 CH_FACTORY_REGISTER(ChSolverMINRES)
 
-ChIterativeSolverLS::ChIterativeSolverLS() : ChIterativeSolver(-1, -1.0, true, false) {
+ChIterativeSolverLS::ChIterativeSolverLS()
+    : ChIterativeSolver(-1, -1.0, true, false),
+      m_use_block(false),
+      m_precond_type(Preconditioner::DIAGONAL),
+      m_precond_nq(0),
+      m_precond_valid(false),
+      m_precond_setup_type(Preconditioner::DIAGONAL),
+      m_precond_revision(0),
+      m_precond_nnz(0) {
     m_spmv = new ChMatrixSPMV();
+    m_ilu.setDroptol(1e-4);
+    m_ilu.setFillfactor(10);
 }
 
 ChIterativeSolverLS::~ChIterativeSolverLS() {
@@ -184,21 +200,21 @@ bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
     // Calculate problem size
     int dim = sysd.CountActiveVariables() + sysd.CountActiveConstraints();
 
-    // Set up the SPMV wrapper
-    m_spmv->Setup(dim, sysd);
-
-    // If needed, evaluate the inverse diagonal entries
-    if (m_use_precond) {
-        m_invdiag.resize(dim);
-        sysd.BuildDiagonalVector(m_invdiag);
-        for (int i = 0; i < dim; i++) {
-            if (std::abs(m_invdiag(i)) > 1e-9)
-                m_invdiag(i) = 1.0 / m_invdiag(i);
-            else
-                m_invdiag(i) = 1.0;
-        }
+    if (m_use_block) {
+        // Assemble the block-sparse system matrix and set up the SPMV wrapper to use it
+        sysd.BuildSystemMatrix(&m_mat, nullptr);
+        sysd.ComputeBlockPartition(m_block_start);
+        m_block.SetNumThreads(sysd.GetNumThreads());
+        m_block.Build(m_mat, m_block_start);
+        m_spmv->Setup(dim, sysd, &m_block);
+    } else {
+        // Set up the SPMV wrapper
+        m_spmv->Setup(dim, sysd);
     }
 
+    // If needed, set up the preconditioner
+    bool precond_ok = SetupPreconditioner(sysd);
+
     // If needed, evaluate the initial guess
     if (m_warm_start) {
         m_initguess.resize(dim);
@@ -206,7 +222,7 @@ bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
     }
 
     // Let the concrete solver initialize itself
-    bool result = SetupProblem();
+    bool result = SetupProblem() && precond_ok;
 
     //// ---- DEBUGGING
     ////SaveMatrix(sysd);
@@ -215,6 +231,130 @@ bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
     return result;
 }
 
+bool ChIterativeSolverLS::SetupPreconditioner(ChSystemDescriptor& sysd) {
+    m_invdiag.resize(0);
+    if (!m_use_precond)
+        return true;
+
+    if (m_precond_type == Preconditioner::DIAGONAL) {
+        // Inverse diagonal blocks of the block-sparse system matrix
+        if (m_use_block) {
+            m_block.SetupBlockJacobi();
+            return true;
+        }
+
+        // Inverse diagonal entries
+        int dim = sysd.CountActiveVariables() + sysd.CountActiveConstraints();
+        m_invdiag.resize(dim);
+        sysd.BuildDiagonalVector(m_invdiag);
+        for (int i = 0; i < dim; i++) {
+            if (std::abs(m_invdiag(i)) > 1e-9)
+                m_invdiag(i) = 1.0 / m_invdiag(i);
+            else
+                m_invdiag(i) = 1.0;
+        }
+        return true;
+    }
+
+    // Assemble the system matrix (already available with the block-sparse format)
+    if (!m_use_block)
+        sysd.BuildSystemMatrix(&m_mat, nullptr);
+
+    int nq = sysd.CountActiveVariables();
+    int nc = sysd.CountActiveConstraints();
+    ChSparseMatrix H = m_mat.topLeftCorner(nq, nq);
+
+    // Inverse diagonal of the approximate Schur complement  [Cq]*diag(H)^(-1)*[Cq]' + |E|
+    ChVectorDynamic<> Hdiag = H.diagonal();
+    m_schur_invdiag.resize(nc);
+    for (int i = 0; i < nc; i++) {
+        double s = 0;
+        for (ChSparseMatrix::InnerIterator it(m_mat, nq + i); it; ++it) {
+            if (it.col() < nq && Hdiag(it.col()) > 0)
+                s += it.value() * it.value() / Hdiag(it.col());
+            else if (it.col() == nq + i)
+                s += std::abs(it.value());
+        }
+        m_schur_invdiag(i) = (s > 1e-12) ? 1.0 / s : 1.0;
+    }
+
+    // Reuse the preconditioner structure if the problem structure did not change
+    bool reuse = m_precond_valid && m_precond_setup_type == m_precond_type &&
+                 m_precond_revision == sysd.GetTopologyRevision() && m_precond_nq == nq &&
+                 m_precond_nnz == H.nonZeros();
+
+    bool success = true;
+    switch (m_precond_type) {
+        case Preconditioner::INCOMPLETE_LU:
+            if (!reuse)
+                m_ilu.analyzePattern(H);
+            m_ilu.factorize(H);
+            success = (m_ilu.info() == Eigen::Success);
+            break;
+        case Preconditioner::INCOMPLETE_CHOLESKY: {
+            Eigen::SparseMatrix<double> Hc = H;
+            if (!reuse)
+                m_ic.analyzePattern(Hc);
+            m_ic.factorize(Hc);
+            success = (m_ic.info() == Eigen::Success);
+            break;
+        }
+        case Preconditioner::AMG:
+            m_amg.Setup(H, reuse);
+            break;
+        default:
+            break;
+    }
+
+    m_precond_valid = success;
+    m_precond_setup_type = m_precond_type;
+    m_precond_revision = sysd.GetTopologyRevision();
+    m_precond_nq = nq;
+    m_precond_nnz = H.nonZeros();
+
+    return success;
+}
+
+void ChIterativeSolverLS::ApplyPreconditioner(ChVectorConstRef b, ChVectorRef x) const {
+    if (!m_use_precond) {
+        x = b;
+        return;
+    }
+
+    if (m_precond_type == Preconditioner::DIAGONAL) {
+        if (m_use_block)
+            m_block.ApplyBlockJacobi(b, x);
+        else if (m_invdiag.size() == b.size())
+            x = m_invdiag.cwiseProduct(b);
+        else
+            x = b;
+        return;
+    }
+
+    int nq = m_precond_nq;
+    int nc = (int)b.size() - nq;
+    switch (m_precond_type) {
+        case Preconditioner::INCOMPLETE_LU:
+            x.head(nq) = m_ilu.solve(b.head(nq));
+            break;
+        case Preconditioner::INCOMPLETE_CHOLESKY:
+            x.head(nq) = m_ic.solve(b.head(nq));
+            break;
+        case Preconditioner::AMG:
+            m_amg.Apply(b.head(nq), x.head(nq));
+            break;
+        default:
+            break;
+    }
+    x.tail(nc) = m_schur_invdiag.cwiseProduct(b.tail(nc));
+}
+
+void ChIterativeSolverLS::SetIncompleteLUParameters(double drop_tol, int fill_factor) {
+    m_ilu.setDroptol(drop_tol);
+    m_ilu.setFillfactor(fill_factor);
+    m_precond_valid = false;
+}
+
 double ChIterativeSolverLS::Solve(ChSystemDescriptor& sysd) {
     // Assemble the problem right-hand side vector
     sysd.BuildSystemMatrix(nullptr, &m_rhs);
@@ -243,7 +383,7 @@ double ChIterativeSolverLS::Solve(ChSystemDescriptor& sysd) {
 // ---------------------------------------------------------------------------
 
 ChSolverGMRES::ChSolverGMRES() {
-    m_engine = new Eigen::GMRES<ChMatrixSPMV, ChDiagonalPreconditioner>();
+    m_engine = new Eigen::GMRES<ChMatrixSPMV, ChPreconditionerLS>();
 }
 
 ChSolverGMRES::~ChSolverGMRES() {
@@ -251,7 +391,7 @@ ChSolverGMRES::~ChSolverGMRES() {
 }
 
 bool ChSolverGMRES::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    m_engine->preconditioner().Setup(m_spmv->rows(), *this);
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
@@ -288,7 +428,7 @@ double ChSolverGMRES::GetError() const {
 // ---------------------------------------------------------------------------
 
 ChSolverBiCGSTAB::ChSolverBiCGSTAB() {
-    m_engine = new Eigen::BiCGSTAB<ChMatrixSPMV, ChDiagonalPreconditioner>();
+    m_engine = new Eigen::BiCGSTAB<ChMatrixSPMV, ChPreconditionerLS>();
 }
 
 ChSolverBiCGSTAB::~ChSolverBiCGSTAB() {
@@ -296,7 +436,7 @@ ChSolverBiCGSTAB::~ChSolverBiCGSTAB() {
 }
 
 bool ChSolverBiCGSTAB::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    m_engine->preconditioner().Setup(m_spmv->rows(), *this);
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
@@ -334,7 +474,7 @@ double ChSolverBiCGSTAB::GetError() const {
 // ---------------------------------------------------------------------------
 
 ChSolverMINRES::ChSolverMINRES() {
-    m_engine = new Eigen::MINRES<ChMatrixSPMV, Eigen::Lower | Eigen::Upper, ChDiagonalPreconditioner>();
+    m_engine = new Eigen::MINRES<ChMatrixSPMV, Eigen::Lower | Eigen::Upper, ChPreconditionerLS>();
 }
 
 ChSolverMINRES::~ChSolverMINRES() {
@@ -342,7 +482,7 @@ ChSolverMINRES::~ChSolverMINRES() {
 }
 
 bool ChSolverMINRES::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    m_engine->preconditioner().Setup(m_spmv->rows(), *this);
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
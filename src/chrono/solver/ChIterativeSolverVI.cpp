@@ -12,6 +12,9 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+
 #include "chrono/solver/ChIterativeSolverVI.h"
 
 namespace chrono {
@@ -25,7 +28,14 @@ ChIterativeSolverVI::ChIterativeSolverVI()
       m_omega(1.0),
       m_shlambda(1.0),
       m_iterations(0),
-      record_violation_history(false) {}
+      record_violation_history(false),
+      m_stats_enabled(false),
+      m_stats_interval(1),
+      m_stats_solves(0),
+      m_stats_sampling(false),
+      m_stats_record_violation(false),
+      m_stats_next(0),
+      m_stats_count(0) {}
 
 void ChIterativeSolverVI::SetOmega(double mval) {
     if (mval > 0.)
@@ -61,6 +71,150 @@ void ChIterativeSolverVI::AtIterationEnd(double mmaxviolation, double mdeltalamb
     dlambda_history[iternum] = mdeltalambda;
 }
 
+// -----------------------------------------------------------------------------
+
+void ChIterativeSolverVI::EnableStatistics(bool enable, unsigned int sampling_interval, size_t capacity) {
+    m_stats_enabled = enable;
+    m_stats_interval = std::max(sampling_interval, 1u);
+    m_stats_solves = 0;
+    m_stats.clear();
+    m_stats.resize(enable ? std::max(capacity, size_t(1)) : 0);
+    m_stats_next = 0;
+    m_stats_count = 0;
+    if (enable)
+        SetMaxIterations(m_max_iterations);
+}
+
+std::vector<ChIterativeSolverVI::SolveStatistics> ChIterativeSolverVI::GetStatistics() const {
+    std::vector<SolveStatistics> stats;
+    stats.reserve(m_stats_count);
+    size_t first = (m_stats_next + m_stats.size() - m_stats_count) % std::max(m_stats.size(), size_t(1));
+    for (size_t i = 0; i < m_stats_count; i++)
+        stats.push_back(m_stats[(first + i) % m_stats.size()]);
+    return stats;
+}
+
+const ChIterativeSolverVI::SolveStatistics& ChIterativeSolverVI::GetLastStatistics() const {
+    assert(m_stats_count > 0);
+    return m_stats[(m_stats_next + m_stats.size() - 1) % m_stats.size()];
+}
+
+void ChIterativeSolverVI::ClearStatistics() {
+    m_stats_next = 0;
+    m_stats_count = 0;
+}
+
+void ChIterativeSolverVI::StatisticsBeginSolve() {
+    m_stats_sampling = m_stats_enabled && (m_stats_solves % m_stats_interval == 0);
+    m_stats_solves++;
+    if (!m_stats_sampling)
+        return;
+
+    // Force recording of the violation history for this solve
+    m_stats_record_violation = record_violation_history;
+    record_violation_history = true;
+    if ((int)violation_history.size() != m_max_iterations)
+        SetMaxIterations(m_max_iterations);
+
+    m_stats_timer.reset();
+    m_stats_timer.start();
+}
+
+// Evaluate the residuals of all active constraints in the given mode and accumulate their violations.
+// For frictional contacts, only the normal component (first in each group of 3) contributes a violation.
+static void SweepConstraints(const std::vector<ChConstraint*>& constraints,
+                             ChConstraint::Mode mode,
+                             ChIterativeSolverVI::ClassStatistics& stats,
+                             double& max_violation,
+                             int& max_index) {
+    ChTimer timer;
+    timer.start();
+
+    int num_constraints = 0;
+    int i_friction_comp = 0;
+    double sum_sq = 0;
+    stats.max_violation = 0;
+
+    for (size_t ic = 0; ic < constraints.size(); ic++) {
+        ChConstraint* c = constraints[ic];
+        if (!c->IsActive() || c->GetMode() != mode)
+            continue;
+
+        double residual = c->ComputeJacobianTimesState() + c->GetRightHandSide() +
+                          c->GetComplianceTerm() * c->GetLagrangeMultiplier();
+
+        double violation;
+        if (mode == ChConstraint::Mode::FRICTION) {
+            bool normal = (i_friction_comp == 0);
+            i_friction_comp = (i_friction_comp + 1) % 3;
+            if (!normal)
+                continue;
+            violation = std::abs(std::min(0.0, residual));
+        } else {
+            violation = std::abs(c->Violation(residual));
+        }
+
+        num_constraints++;
+        sum_sq += violation * violation;
+        if (violation > stats.max_violation)
+            stats.max_violation = violation;
+        if (violation > max_violation) {
+            max_violation = violation;
+            max_index = (int)ic;
+        }
+    }
+
+    timer.stop();
+
+    stats.num_constraints = num_constraints;
+    stats.rms_violation = num_constraints > 0 ? std::sqrt(sum_sq / num_constraints) : 0;
+    stats.sweep_time = timer();
+}
+
+ChIterativeSolverVI::SolveStatistics* ChIterativeSolverVI::StatisticsEndSolve(ChSystemDescriptor& sysd) {
+    if (!m_stats_sampling)
+        return nullptr;
+    m_stats_sampling = false;
+
+    m_stats_timer.stop();
+    record_violation_history = m_stats_record_violation;
+
+    SolveStatistics& stats = m_stats[m_stats_next];
+    m_stats_next = (m_stats_next + 1) % m_stats.size();
+    m_stats_count = std::min(m_stats_count + 1, m_stats.size());
+
+    stats.solve_index = m_stats_solves - 1;
+    stats.iterations = m_iterations;
+    stats.solve_time = m_stats_timer();
+
+    const auto& constraints = sysd.GetConstraints();
+    stats.max_violation = 0;
+    stats.max_violation_constraint = -1;
+    SweepConstraints(constraints, ChConstraint::Mode::LOCK, stats.bilateral, stats.max_violation,
+                     stats.max_violation_constraint);
+    SweepConstraints(constraints, ChConstraint::Mode::UNILATERAL, stats.unilateral, stats.max_violation,
+                     stats.max_violation_constraint);
+    SweepConstraints(constraints, ChConstraint::Mode::FRICTION, stats.contact, stats.max_violation,
+                     stats.max_violation_constraint);
+
+    stats.max_violation_variables.clear();
+    stats.max_violation_bodies.clear();
+    stats.max_violation_mode = ChConstraint::Mode::FREE;
+    if (stats.max_violation_constraint >= 0) {
+        const ChConstraint* c = constraints[stats.max_violation_constraint];
+        stats.max_violation_mode = c->GetMode();
+        c->GetReferencedVariables(stats.max_violation_variables);
+    }
+
+    size_t n = std::min((size_t)std::max(m_iterations, 0), violation_history.size());
+    stats.violation_history.assign(violation_history.begin(), violation_history.begin() + n);
+    stats.dlambda_history.assign(dlambda_history.begin(), dlambda_history.begin() + n);
+
+    return &stats;
+}
+
+// -----------------------------------------------------------------------------
+
 void ChIterativeSolverVI::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChIterativeSolverVI>();
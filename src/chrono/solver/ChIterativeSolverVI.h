@@ -15,6 +15,9 @@
 #ifndef CH_ITERATIVESOLVER_VI_H
 #define CH_ITERATIVESOLVER_VI_H
 
+#include <vector>
+
+#include "chrono/core/ChTimer.h"
 #include "chrono/solver/ChSolverVI.h"
 #include "chrono/solver/ChIterativeSolver.h"
 
@@ -51,9 +54,40 @@ The 'tolerance' threshold value used in the stopping criteria may have different
 individual iterative VI solver for details.
 
 Diagonal preconditioning is enabled by default, but may not supported by all iterative VI solvers.
+
+Optionally, per-solve statistics can be collected on a subset of the solves (see EnableStatistics). For each sampled
+solve, these include the number of constraints, final violation, and cost of one sweep for each constraint class
+(bilaterals, unilaterals, frictional contacts), the constraint with maximum violation and the variables it acts on, and
+the violation history over the solver iterations. Statistics for the most recent sampled solves are kept in a ring
+buffer of fixed capacity.
 */
 class ChApi ChIterativeSolverVI : public ChIterativeSolver, public ChSolverVI {
   public:
+    /// Statistics for one class of constraints.
+    struct ClassStatistics {
+        int num_constraints;   ///< number of active constraints (for contacts, number of contacts)
+        double max_violation;  ///< maximum constraint violation at the end of the solve
+        double rms_violation;  ///< RMS of the constraint violations at the end of the solve
+        double sweep_time;     ///< time for one evaluation of the residuals of all constraints in this class
+    };
+
+    /// Statistics for one sampled solve.
+    struct SolveStatistics {
+        unsigned int solve_index;    ///< index of the sampled solve (counting all solves since statistics enabled)
+        int iterations;              ///< number of iterations
+        double solve_time;           ///< total solve time
+        ClassStatistics bilateral;   ///< statistics for bilateral constraints (LOCK mode)
+        ClassStatistics unilateral;  ///< statistics for unilateral constraints (UNILATERAL mode)
+        ClassStatistics contact;     ///< statistics for frictional contacts (FRICTION mode, in groups of 3)
+        double max_violation;        ///< maximum violation over all constraints
+        int max_violation_constraint;            ///< index of the constraint with maximum violation (-1 if none)
+        ChConstraint::Mode max_violation_mode;   ///< mode of the constraint with maximum violation
+        std::vector<ChVariables*> max_violation_variables;  ///< variables referenced by that constraint
+        std::vector<int> max_violation_bodies;   ///< identifiers of the owning bodies (set by ChSystem)
+        std::vector<double> violation_history;   ///< maximum violation at each iteration
+        std::vector<double> dlambda_history;     ///< maximum change in Lagrange multipliers at each iteration
+    };
+
     ChIterativeSolverVI();
 
     virtual ~ChIterativeSolverVI() {}
@@ -93,6 +127,38 @@ class ChApi ChIterativeSolverVI : public ChIterativeSolver, public ChSolverVI {
     /// Note that collection of constraint violations must be enabled through SetRecordViolation.
     const std::vector<double>& GetDeltalambdaHistory() const { return dlambda_history; }
 
+    /// Enable/disable collection of solver statistics.
+    /// If enabled, statistics are collected for every 'sampling_interval' solve and the statistics for the last
+    /// 'capacity' sampled solves are kept. On sampled solves, the violation history is recorded (see
+    /// SetRecordViolation), which may add some overhead to the solver iterations. Enabling statistics clears any
+    /// previously collected statistics.
+    void EnableStatistics(bool enable, unsigned int sampling_interval = 1, size_t capacity = 100);
+
+    /// Return true if collection of solver statistics is enabled.
+    bool IsStatisticsEnabled() const { return m_stats_enabled; }
+
+    /// Return the number of available statistics records (at most the ring buffer capacity).
+    size_t GetNumStatistics() const { return m_stats_count; }
+
+    /// Return the available statistics records, from oldest to most recent.
+    std::vector<SolveStatistics> GetStatistics() const;
+
+    /// Return the statistics of the most recent sampled solve.
+    /// Note that this function must not be called if no statistics are available (see GetNumStatistics).
+    const SolveStatistics& GetLastStatistics() const;
+
+    /// Remove all statistics records.
+    void ClearStatistics();
+
+    /// Start statistics collection for the next solve.
+    /// This function is called by the owning system before each call to Solve.
+    void StatisticsBeginSolve();
+
+    /// Complete statistics collection for the current solve.
+    /// This function is called by the owning system after each call to Solve. It returns the new statistics record
+    /// (which the caller may complete, e.g. with body identifiers) or nullptr if the current solve was not sampled.
+    SolveStatistics* StatisticsEndSolve(ChSystemDescriptor& sysd);
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive_out) override;
 
@@ -123,6 +189,17 @@ class ChApi ChIterativeSolverVI : public ChIterativeSolver, public ChSolverVI {
     bool record_violation_history;
     std::vector<double> violation_history;
     std::vector<double> dlambda_history;
+
+  private:
+    bool m_stats_enabled;                  ///< collect solver statistics?
+    unsigned int m_stats_interval;         ///< sampling interval (number of solves)
+    unsigned int m_stats_solves;           ///< number of solves since statistics enabled
+    bool m_stats_sampling;                 ///< is the current solve sampled?
+    bool m_stats_record_violation;         ///< user setting of violation history recording
+    std::vector<SolveStatistics> m_stats;  ///< ring buffer of statistics records
+    size_t m_stats_next;                   ///< index of next record in ring buffer
+    size_t m_stats_count;                  ///< number of valid records in ring buffer
+    ChTimer m_stats_timer;                 ///< timer for the current sampled solve
 };
 
 /// @} chrono_solver
@@ -53,6 +53,11 @@ class ChApi ChKRMBlock {
     /// Access the KRM matrix as a single block, corresponding to the referenced ChVariable objects.
     ChMatrixRef GetMatrix() { return KRM; }
 
+    /// Return the memory (in bytes) allocated for the KRM matrix and the list of referenced variables.
+    size_t GetMemoryUsage() const {
+        return KRM.size() * sizeof(double) + variables.capacity() * sizeof(ChVariables*);
+    }
+
     /// Add the product of the block matrix by a given vector and add to result.
     /// Note: 'result' and 'vect' are system-level vectors of appropriate size. This function must index into these
     /// vectors using the offsets of the associated variables variable.
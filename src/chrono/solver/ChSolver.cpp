@@ -23,6 +23,7 @@ class ChSolver_Type_enum_mapper : public ChSolver {
     CH_ENUM_MAPPER_BEGIN(Type);
     CH_ENUM_VAL(Type::PSOR);
     CH_ENUM_VAL(Type::PSSOR);
+    CH_ENUM_VAL(Type::PSOR_COLORED);
     CH_ENUM_VAL(Type::PJACOBI);
     CH_ENUM_VAL(Type::PMINRES);
     CH_ENUM_VAL(Type::BARZILAIBORWEIN);
@@ -30,8 +31,13 @@ class ChSolver_Type_enum_mapper : public ChSolver {
     CH_ENUM_VAL(Type::ADMM);
     CH_ENUM_VAL(Type::SPARSE_LU);
     CH_ENUM_VAL(Type::SPARSE_QR);
+    CH_ENUM_VAL(Type::SPARSE_SUPERNODAL);
+    CH_ENUM_VAL(Type::BLOCK_TRIDIAGONAL);
     CH_ENUM_VAL(Type::PARDISO_MKL);
     CH_ENUM_VAL(Type::MUMPS);
+#ifdef CHRONO_CUDSS
+    CH_ENUM_VAL(Type::CUDSS);
+#endif
     CH_ENUM_VAL(Type::GMRES);
     CH_ENUM_VAL(Type::MINRES);
     CH_ENUM_VAL(Type::BICGSTAB);
@@ -17,6 +17,8 @@
 
 #include <vector>
 
+#include "chrono/ChConfig.h"
+
 #include "chrono/solver/ChConstraint.h"
 #include "chrono/solver/ChSystemDescriptor.h"
 #include "chrono/solver/ChVariables.h"
@@ -39,16 +41,22 @@ class ChApi ChSolver {
         // Iterative VI solvers
         PSOR,             ///< Projected SOR (Successive Over-Relaxation)
         PSSOR,            ///< Projected symmetric SOR
+        PSOR_COLORED,     ///< Projected SOR with graph-colored parallel sweeps
         PJACOBI,          ///< Projected Jacobi
         PMINRES,          ///< Projected MINRES
         BARZILAIBORWEIN,  ///< Barzilai-Borwein
         APGD,             ///< Accelerated Projected Gradient Descent
         ADMM,             ///< Alternating Direction Method of Multipliers
         // Direct linear solvers
-        SPARSE_LU,    ///< Sparse supernodal LU factorization
-        SPARSE_QR,    ///< Sparse left-looking rank-revealing QR factorization
-        PARDISO_MKL,  ///< Pardiso MKL (super-nodal sparse direct solver)
-        MUMPS,        ///< Mumps (MUltifrontal Massively Parallel sparse direct Solver)
+        SPARSE_LU,          ///< Sparse supernodal LU factorization
+        SPARSE_QR,          ///< Sparse left-looking rank-revealing QR factorization
+        SPARSE_SUPERNODAL,  ///< Sparse multithreaded supernodal LU or LDLT factorization
+        BLOCK_TRIDIAGONAL,  ///< Block-tridiagonal factorization of chains with a sparse Schur complement border
+        PARDISO_MKL,        ///< Pardiso MKL (super-nodal sparse direct solver)
+        MUMPS,              ///< Mumps (MUltifrontal Massively Parallel sparse direct Solver)
+#ifdef CHRONO_CUDSS
+        CUDSS,  ///< cuDSS (NVIDIA GPU sparse direct solver; experimental, requires ENABLE_MODULE_CUDSS)
+#endif
         // Iterative linear solvers
         GMRES,     ///< Generalized Minimal RESidual Algorithm
         MINRES,    ///< MINimum RESidual method
@@ -91,6 +99,14 @@ class ChApi ChSolver {
     /// that it is appropriate to perform the setup phase.
     virtual bool Setup(ChSystemDescriptor& sysd) { return true; }
 
+    /// Set the number of OpenMP threads for the solver.
+    /// The default implementation does nothing. Derived classes implement this function as applicable.
+    virtual void SetNumThreads(int nthreads) {}
+
+    /// Return an estimate of the memory (in bytes) used by the solver (e.g., matrices and factorizations).
+    /// By default, returns 0.
+    virtual size_t GetMemoryUsage() const { return 0; }
+
     /// Set verbose output from solver.
     void SetVerbose(bool mv) { verbose = mv; }
 
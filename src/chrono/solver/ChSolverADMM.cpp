@@ -34,7 +34,10 @@ ChSolverADMM::ChSolverADMM()
       stepadjust_type(AdmmStepType::BALANCED_FAST),
       tol_prim(1e-6),
       tol_dual(1e-6),
-      acceleration(AdmmAcceleration::BASIC) {
+      acceleration(AdmmAcceleration::BASIC),
+      anderson_memory(5),
+      refactor_threshold(0),
+      num_factorizations(0) {
     LS_solver = chrono_types::make_shared<ChSolverSparseQR>();
 }
 
@@ -48,6 +51,8 @@ double ChSolverADMM::Solve(ChSystemDescriptor& sysd) {
             return _SolveBasic(sysd);
         case AdmmAcceleration::NESTEROV:
             return _SolveFast(sysd);
+        case AdmmAcceleration::ANDERSON:
+            return _SolveBasic(sysd);
         default:
             return _SolveBasic(sysd);
     }
@@ -62,6 +67,9 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
 
     double rho_i = this->rho;
 
+    m_iterations = 0;
+    num_factorizations = 0;
+
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
 
     int nc = sysd.CountActiveConstraints();
@@ -269,11 +277,18 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
     m_timer_factorize.start();
 
     LS_solver->SetupCurrent();  // LU decomposition ++++++++++++++++++++++++++++++++++++++
+    num_factorizations++;
 
     m_timer_factorize.stop();
     if (verbose)
         std::cout << " Time for factorize : << " << m_timer_factorize.GetTimeSeconds() << "s" << std::endl;
 
+    // rho steps used in the current factorization, and their difference from the current rho steps
+    double rho_fact = rho_i;
+    ChVectorDynamic<> vrho_fact = vrho;
+    ChVectorDynamic<> drho(nc);
+    drho.setZero();
+
     /*
     res_story.r_prim=zeros(1,1);
     res_story.r_dual_Nlry=zeros(1,1);
@@ -288,7 +303,19 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
     std::fill(violation_history.begin(), violation_history.end(), 0.0);
     std::fill(dlambda_history.begin(), dlambda_history.end(), 0.0);
 
+    // For Anderson acceleration of the fixed-point map w -> g(w), with w = [z; y./vrho]:
+    bool anderson = (this->acceleration == AdmmAcceleration::ANDERSON) && (this->anderson_memory > 0);
+    int aa_count = 0;  // number of fixed-point residuals since last restart
+    // differences of g(w) and of the fixed-point residuals f = g(w) - w
+    ChMatrixDynamic<> aa_dG(anderson ? 2 * nc : 0, this->anderson_memory);
+    ChMatrixDynamic<> aa_dF(anderson ? 2 * nc : 0, this->anderson_memory);
+    ChVectorDynamic<> aa_g_old;
+    ChVectorDynamic<> aa_f_old;
+    double aa_fnorm_old = 0;
+
     for (int iter = 0; iter < m_max_iterations; iter++) {
+        m_iterations = iter + 1;
+
         // diagnostic
         l_old = l;
         z_old = z;
@@ -300,11 +327,10 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
         // ckkt = -bkkt + (vsigma+vrho).*z - y;
 
         ChVectorDynamic<> ckkt = -b + (vsigma + vrho).cwiseProduct(z) - y;
-        LS_solver->b() << k, ckkt;  // B = [k;ckkt];
 
         m_timer_solve.start();
 
-        LS_solver->SolveCurrent();  // LU forward/backsolve ++++++++++++++++++++++++++++++++++++++
+        _SolveKKT(k, ckkt, drho, rho_i != rho_fact);  // B = [k;ckkt];  LU forward/backsolve ++++++++++++++++++++++++
 
         m_timer_solve.stop();
         if (verbose)
@@ -368,6 +394,45 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
             break;
         }
 
+        // Anderson acceleration (type-II), as in "Anderson Accelerated Douglas-Rachford Splitting", 2020, A. Fu et al.
+        // The extrapolated z, y are a valid starting point for the next ADMM iteration. The history is discarded when
+        // the fixed-point residual increases, or when rho changes (see below).
+        if (anderson) {
+            ChVectorDynamic<> aa_g(2 * nc);
+            ChVectorDynamic<> aa_w(2 * nc);
+            aa_g << z, y.cwiseQuotient(vrho);
+            aa_w << z_old, y_old.cwiseQuotient(vrho);
+            ChVectorDynamic<> aa_f = aa_g - aa_w;
+            double aa_fnorm = aa_f.norm();
+
+            if (aa_count > 0 && aa_fnorm > aa_fnorm_old)
+                aa_count = 0;
+
+            if (aa_count > 0) {
+                int col = (aa_count - 1) % this->anderson_memory;
+                aa_dG.col(col) = aa_g - aa_g_old;
+                aa_dF.col(col) = aa_f - aa_f_old;
+            }
+            int ncols = std::min(aa_count, this->anderson_memory);
+            aa_count++;
+
+            aa_g_old = aa_g;
+            aa_f_old = aa_f;
+            aa_fnorm_old = aa_fnorm;
+
+            if (ncols > 0) {
+                // gamma = argmin || f - dF * gamma ||, with a small Tikhonov regularization
+                auto dF = aa_dF.leftCols(ncols);
+                ChMatrixDynamic<> FtF = dF.transpose() * dF;
+                FtF.diagonal().array() += 1e-10 * (FtF.trace() + 1e-30);
+                ChVectorDynamic<> gamma = FtF.ldlt().solve(dF.transpose() * aa_f);
+
+                ChVectorDynamic<> aa_w_new = aa_g - aa_dG.leftCols(ncols) * gamma;
+                z = aa_w_new.head(nc);
+                y = aa_w_new.tail(nc).cwiseProduct(vrho);
+            }
+        }
+
         // once in a while update the rho step parameter
         if ((iter % this->stepadjust_each) == 0) {
             double rhofactor = 1;  // default do not shrink / enlarge
@@ -406,14 +471,6 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
             }
 
             if ((rhofactor > this->stepadjust_threshold) || (rhofactor < 1.0 / this->stepadjust_threshold)) {
-                ChTimer m_timer_refactorize;
-                m_timer_refactorize.start();
-
-                // Avoid rebuilding all sparse matrix:
-                // A) just remove old rho with -= :
-                for (int i = 0; i < nc; ++i)
-                    LS_solver->A().coeffRef(nv + i, nv + i) -= -(sigma + vrho(i));
-
                 // Update rho
                 rho_i = rho_i * rhofactor;
 
@@ -428,21 +485,40 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
                     }
                 }
 
-                // UPDATE FACTORIZATION
-                //
-                //  A = [M, Cq'; Cq, -diag(vsigma+vrho) + E ];
-                //
-                // To avoid rebuilding A, we just removed the rho step from the diagonal in A), and now:
-                // B) add old rho with += :
-                for (int i = 0; i < nc; ++i)
-                    LS_solver->A().coeffRef(nv + i, nv + i) += -(sigma + vrho(i));
+                // Keep the current factorization if rho did not change too much since it was computed
+                // (the KKT solves are then corrected by iterative refinement, see _SolveKKT)
+                if (std::abs(rho_i / rho_fact - 1) > this->refactor_threshold) {
+                    ChTimer m_timer_refactorize;
+                    m_timer_refactorize.start();
+
+                    // UPDATE FACTORIZATION
+                    //
+                    //  A = [M, Cq'; Cq, -diag(vsigma+vrho) + E ];
+                    //
+                    // Avoid rebuilding all sparse matrix:
+                    // A) just remove the rho used in the current factorization with -= :
+                    for (int i = 0; i < nc; ++i)
+                        LS_solver->A().coeffRef(nv + i, nv + i) -= -(sigma + vrho_fact(i));
+                    // B) add new rho with += :
+                    for (int i = 0; i < nc; ++i)
+                        LS_solver->A().coeffRef(nv + i, nv + i) += -(sigma + vrho(i));
+
+                    LS_solver->SetupCurrent();  // LU decomposition ++++++++++++++++++++++++++++++++++++++
+                    num_factorizations++;
+
+                    rho_fact = rho_i;
+                    vrho_fact = vrho;
+
+                    m_timer_refactorize.stop();
+                    if (verbose)
+                        std::cout << " Time for re-factorize : << " << m_timer_refactorize.GetTimeSeconds() << "s"
+                                  << std::endl;
+                }
 
-                LS_solver->SetupCurrent();  // LU decomposition ++++++++++++++++++++++++++++++++++++++
+                drho = vrho - vrho_fact;
 
-                m_timer_refactorize.stop();
-                if (verbose)
-                    std::cout << " Time for re-factorize : << " << m_timer_refactorize.GetTimeSeconds() << "s"
-                              << std::endl;
+                // the fixed-point map changed, so restart the Anderson acceleration
+                aa_count = 0;
             }
 
         }  // end step adjust
@@ -477,6 +553,9 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
 
     double rho_i = this->rho;
 
+    m_iterations = 0;
+    num_factorizations = 0;
+
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
 
     int nc = sysd.CountActiveConstraints();
@@ -682,11 +761,18 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
     m_timer_factorize.start();
 
     LS_solver->SetupCurrent();  // LU decomposition ++++++++++++++++++++++++++++++++++++++
+    num_factorizations++;
 
     m_timer_factorize.stop();
     if (verbose)
         std::cout << " Time for factorize : << " << m_timer_factorize.GetTimeSeconds() << "s" << std::endl;
 
+    // rho steps used in the current factorization, and their difference from the current rho steps
+    double rho_fact = rho_i;
+    ChVectorDynamic<> vrho_fact = vrho;
+    ChVectorDynamic<> drho(nc);
+    drho.setZero();
+
     /*
     res_story.r_prim=zeros(1,1);
     res_story.r_dual_Nlry=zeros(1,1);
@@ -699,6 +785,8 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
     */
 
     for (int iter = 0; iter < m_max_iterations; iter++) {
+        m_iterations = iter + 1;
+
         // diagnostic
         l_old = l;
         z_old = z;
@@ -717,11 +805,10 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
         // ckkt = -bkkt + (vsigma+vrho).*z - y;
 
         ChVectorDynamic<> ckkt = -b + (vsigma + vrho).cwiseProduct(z) - y;
-        LS_solver->b() << k, ckkt;  // B = [k;ckkt];
 
         m_timer_solve.start();
 
-        LS_solver->SolveCurrent();  // LU forward/backsolve ++++++++++++++++++++++++++++++++++++++
+        _SolveKKT(k, ckkt, drho, rho_i != rho_fact);  // B = [k;ckkt];  LU forward/backsolve ++++++++++++++++++++++++
 
         m_timer_solve.stop();
         if (verbose)
@@ -834,14 +921,6 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
             }
 
             if ((rhofactor > this->stepadjust_threshold) || (rhofactor < 1.0 / this->stepadjust_threshold)) {
-                ChTimer m_timer_refactorize;
-                m_timer_refactorize.start();
-
-                // Avoid rebuilding all sparse matrix:
-                // A) just remove old rho with -= :
-                for (int i = 0; i < nc; ++i)
-                    LS_solver->A().coeffRef(nv + i, nv + i) -= -(sigma + vrho(i));
-
                 // Update rho
                 rho_i = rho_i * rhofactor;
 
@@ -856,21 +935,37 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
                     }
                 }
 
-                // UPDATE FACTORIZATION
-                //
-                //  A = [M, Cq'; Cq, -diag(vsigma+vrho) + E ];
-                //
-                // To avoid rebuilding A, we just removed the rho step from the diagonal in A), and now:
-                // B) add old rho with += :
-                for (int i = 0; i < nc; ++i)
-                    LS_solver->A().coeffRef(nv + i, nv + i) += -(sigma + vrho(i));
-
-                LS_solver->SetupCurrent();  // LU decomposition ++++++++++++++++++++++++++++++++++++++
+                // Keep the current factorization if rho did not change too much since it was computed
+                // (the KKT solves are then corrected by iterative refinement, see _SolveKKT)
+                if (std::abs(rho_i / rho_fact - 1) > this->refactor_threshold) {
+                    ChTimer m_timer_refactorize;
+                    m_timer_refactorize.start();
+
+                    // UPDATE FACTORIZATION
+                    //
+                    //  A = [M, Cq'; Cq, -diag(vsigma+vrho) + E ];
+                    //
+                    // Avoid rebuilding all sparse matrix:
+                    // A) just remove the rho used in the current factorization with -= :
+                    for (int i = 0; i < nc; ++i)
+                        LS_solver->A().coeffRef(nv + i, nv + i) -= -(sigma + vrho_fact(i));
+                    // B) add new rho with += :
+                    for (int i = 0; i < nc; ++i)
+                        LS_solver->A().coeffRef(nv + i, nv + i) += -(sigma + vrho(i));
+
+                    LS_solver->SetupCurrent();  // LU decomposition ++++++++++++++++++++++++++++++++++++++
+                    num_factorizations++;
+
+                    rho_fact = rho_i;
+                    vrho_fact = vrho;
+
+                    m_timer_refactorize.stop();
+                    if (verbose)
+                        std::cout << " Time for re-factorize : << " << m_timer_refactorize.GetTimeSeconds() << "s"
+                                  << std::endl;
+                }
 
-                m_timer_refactorize.stop();
-                if (verbose)
-                    std::cout << " Time for re-factorize : << " << m_timer_refactorize.GetTimeSeconds() << "s"
-                              << std::endl;
+                drho = vrho - vrho_fact;
             }
 
         }  // end step adjust
@@ -891,6 +986,36 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
     return r_dual;
 }
 
+// Solve the KKT system A*x = [k; ckkt] with the current factorization.
+// If rho was changed without refactoring, the factorized matrix is Af = A + diag(0, drho), where
+// drho = vrho - vrho_fact.
+// The solution is then obtained by the fixed-point iterative refinement Af*x_j+1 = [k; ckkt] + diag(0, drho)*x_j,
+// starting from the solution of the previous ADMM iteration. The contraction factor is bounded approximately by the
+// relative rho change max |vrho/vrho_fact - 1|, hence the refactorization threshold must be below 1.
+
+void ChSolverADMM::_SolveKKT(const ChVectorDynamic<>& k,
+                             const ChVectorDynamic<>& ckkt,
+                             const ChVectorDynamic<>& drho,
+                             bool refine) {
+    if (!refine) {
+        LS_solver->b() << k, ckkt;
+        LS_solver->SolveCurrent();
+        return;
+    }
+
+    const int max_refine_iterations = 10;
+    int nc = (int)ckkt.size();
+
+    for (int j = 0; j < max_refine_iterations; j++) {
+        ChVectorDynamic<> x_old = LS_solver->x();
+        LS_solver->b() << k, ckkt + drho.cwiseProduct(x_old.tail(nc));
+        LS_solver->SolveCurrent();
+        // inexact solves are acceptable as long as the error is small relative to the current primal residual
+        if ((LS_solver->x() - x_old).lpNorm<Eigen::Infinity>() < 0.1 * std::max(this->tol_prim, this->r_prim))
+            break;
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
@@ -89,11 +89,27 @@ class ChApi ChSolverADMM : public ChIterativeSolverVI {
     enum AdmmAcceleration {
         BASIC = 0,  // basic ADMM
         NESTEROV,   // inspired to  FAST ALTERNATING DIRECTION OPTIMIZATION METHODS, 2015, T. Goldstein et al.
+        ANDERSON    // basic ADMM with Anderson acceleration of the fixed-point iteration, with safeguarded restarts
     };
     /// Set the type of ADMM iteration, enabling acceleration variants
     void SetAcceleration(AdmmAcceleration mr) { acceleration = mr; }
     AdmmAcceleration GetAcceleration() { return acceleration; }
 
+    /// Set the number of previous iterates used by the Anderson acceleration (default: 5).
+    void SetAndersonMemory(int mr) { anderson_memory = mr; }
+    int GetAndersonMemory() { return anderson_memory; }
+
+    /// Set the relative change of the rho step, since the last factorization, above which the KKT matrix is
+    /// re-factorized (default: 0, i.e. re-factorize at each rho adjustment). Below this threshold, the existing
+    /// factorization is kept and the inner linear solves are corrected by a few iterative refinement back-solves.
+    /// Values in [0,1) are expected, e.g. 0.5; larger values slow down (or prevent) the convergence of the refinement.
+    /// This pays off for large problems, where a factorization costs much more than a back-solve.
+    void SetRhoRefactorThreshold(double mr) { refactor_threshold = mr; }
+    double GetRhoRefactorThreshold() { return refactor_threshold; }
+
+    /// Return the number of factorizations of the KKT matrix performed during the last solve.
+    int GetNumFactorizations() const { return num_factorizations; }
+
     /// Set the absolute tolerance for the primal residual (force impulses error), if
     /// the iteration falls below this and the dual tolerance, it stops iterating.
     void SetTolerancePrimal(double mr) { tol_prim = mr; }
@@ -136,6 +152,9 @@ class ChApi ChSolverADMM : public ChIterativeSolverVI {
     double tol_prim;
     double tol_dual;
     AdmmAcceleration acceleration;
+    int anderson_memory;
+    double refactor_threshold;
+    int num_factorizations;
 
     std::shared_ptr<ChDirectSolverLS> LS_solver;
     // Eigen::SparseQR<ChSparseMatrix, Eigen::COLAMDOrdering<int>> m_engine;  ///< Eigen SparseQR solver (do not use
@@ -146,6 +165,12 @@ class ChApi ChSolverADMM : public ChIterativeSolverVI {
 
     /// Performs ADMM with Nesterov acceleration, as in solve_kkt_ADMMfast.m prototype
     virtual double _SolveFast(ChSystemDescriptor& sysd);
+
+    /// Solve the KKT system of the inner loop, with iterative refinement if rho changed after the last factorization.
+    void _SolveKKT(const ChVectorDynamic<>& k,
+                   const ChVectorDynamic<>& ckkt,
+                   const ChVectorDynamic<>& drho,
+                   bool refine);
 };
 
 /// @} chrono_solver
@@ -0,0 +1,501 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/solver/ChSolverBlockTridiagonal.h"
+#include "chrono/solver/ChSystemDescriptor.h"
+#include "chrono/solver/ChVariables.h"
+#include "chrono/utils/ChOpenMP.h"
+
+namespace chrono {
+
+// Number of chains processed by an OpenMP thread at a time
+static const int CHAIN_CHUNK_SIZE = 16;
+
+// Build the level structure of the connected component containing the specified root vertex.
+// On return, 'order' lists the component vertices level by level and 'level_ptr' holds the offsets of the levels in
+// 'order' (so that the number of levels is level_ptr.size() - 1). All component vertices are marked with 'tag'.
+static void BuildLevels(const std::vector<int>& xadj,
+                        const std::vector<int>& adj,
+                        int root,
+                        int tag,
+                        std::vector<int>& mark,
+                        std::vector<int>& order,
+                        std::vector<int>& level_ptr) {
+    order.clear();
+    order.push_back(root);
+    level_ptr.assign(1, 0);
+    mark[root] = tag;
+
+    size_t begin = 0;
+    while (begin < order.size()) {
+        size_t end = order.size();
+        level_ptr.push_back((int)end);
+        for (size_t k = begin; k < end; k++) {
+            int v = order[k];
+            for (int e = xadj[v]; e < xadj[v + 1]; e++) {
+                int w = adj[e];
+                if (mark[w] != tag) {
+                    mark[w] = tag;
+                    order.push_back(w);
+                }
+            }
+        }
+        begin = end;
+    }
+}
+
+// Return true if the given LU factorization has finite, nonzero pivots.
+static bool IsNonsingular(const Eigen::PartialPivLU<Eigen::MatrixXd>& lu) {
+    const auto& LU = lu.matrixLU();
+    return LU.allFinite() && (LU.rows() == 0 || LU.diagonal().cwiseAbs().minCoeff() > 0);
+}
+
+// -----------------------------------------------------------------------------
+
+ChSolverBlockTridiagonal::ChSolverBlockTridiagonal(int num_threads)
+    : m_max_block_size(36),
+      m_analyzed(false),
+      m_factorized(false),
+      m_pattern_error(false),
+      m_blocks_changed(false),
+      m_num_var_unknowns(0),
+      m_chain_size(0),
+      m_S_analyzed(false),
+      m_S_nnz(0) {
+    SetNumThreads(num_threads);
+}
+
+void ChSolverBlockTridiagonal::SetNumThreads(int num_threads) {
+    m_num_threads = num_threads > 0 ? num_threads : ChOMP::GetNumProcs();
+}
+
+bool ChSolverBlockTridiagonal::Setup(ChSystemDescriptor& sysd) {
+    // The unknowns of each active variable form one vertex of the coupling graph
+    std::vector<std::pair<int, int>> var_blocks;
+    for (auto var : sysd.GetVariables()) {
+        if (var->IsActive() && var->GetDOF() > 0)
+            var_blocks.push_back({(int)var->GetOffset(), (int)var->GetDOF()});
+    }
+    if (var_blocks != m_var_blocks) {
+        m_var_blocks = std::move(var_blocks);
+        m_blocks_changed = true;
+    }
+    m_num_var_unknowns = (int)sysd.CountActiveVariables();
+
+    return ChDirectSolverLS::Setup(sysd);
+}
+
+bool ChSolverBlockTridiagonal::SetupCurrent() {
+    // No variable information for a matrix loaded directly
+    if (!m_var_blocks.empty()) {
+        m_var_blocks.clear();
+        m_blocks_changed = true;
+    }
+    m_num_var_unknowns = 0;
+
+    return ChDirectSolverLS::SetupCurrent();
+}
+
+void ChSolverBlockTridiagonal::Analyze() {
+    int n = (int)m_mat.rows();
+
+    // Assign unknowns to the vertices of the coupling graph (-1 for unknowns always in the border)
+    std::vector<int> vertex(n, -1);
+    std::vector<int> vtx_ptr(1, 0);
+    std::vector<int> vtx_idx;
+    if (!m_var_blocks.empty() && m_num_var_unknowns <= n) {
+        for (const auto& vb : m_var_blocks) {
+            for (int i = vb.first; i < vb.first + vb.second; i++) {
+                vertex[i] = (int)vtx_ptr.size() - 1;
+                vtx_idx.push_back(i);
+            }
+            vtx_ptr.push_back((int)vtx_idx.size());
+        }
+    } else {
+        for (int i = 0; i < n; i++) {
+            if (m_mat.coeff(i, i) != 0) {
+                vertex[i] = (int)vtx_ptr.size() - 1;
+                vtx_idx.push_back(i);
+                vtx_ptr.push_back((int)vtx_idx.size());
+            }
+        }
+    }
+    int nv = (int)vtx_ptr.size() - 1;
+
+    // Build the (symmetrized) coupling graph of the vertices
+    std::vector<std::pair<int, int>> edges;
+    for (int i = 0; i < n; i++) {
+        int vi = vertex[i];
+        if (vi < 0)
+            continue;
+        for (ChSparseMatrix::InnerIterator it(m_mat, i); it; ++it) {
+            int vj = vertex[it.col()];
+            if (vj >= 0 && vj != vi) {
+                edges.push_back({vi, vj});
+                edges.push_back({vj, vi});
+            }
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    std::vector<int> xadj(nv + 1, 0);
+    std::vector<int> adj(edges.size());
+    for (size_t e = 0; e < edges.size(); e++) {
+        xadj[edges[e].first + 1]++;
+        adj[e] = edges[e].second;
+    }
+    for (int v = 0; v < nv; v++)
+        xadj[v + 1] += xadj[v];
+
+    // Order each connected component by levels, starting at a pseudo-peripheral vertex.
+    // Components with small levels become chains; all other unknowns are placed in the border.
+    m_perm.clear();
+    m_perm.reserve(n);
+    m_blocks.clear();
+    m_chains.clear();
+    std::vector<char> in_chain(n, 0);
+
+    std::vector<int> mark(nv, -1);
+    std::vector<int> order, level_ptr, order_tmp, level_ptr_tmp;
+    int tag = 0;
+    for (int v0 = 0; v0 < nv; v0++) {
+        if (mark[v0] >= 0)
+            continue;
+
+        // Find a pseudo-peripheral vertex, which maximizes the number of levels
+        BuildLevels(xadj, adj, v0, tag++, mark, order, level_ptr);
+        while (true) {
+            int num_levels = (int)level_ptr.size() - 1;
+            int cand = order[level_ptr[num_levels - 1]];
+            for (int k = level_ptr[num_levels - 1]; k < level_ptr[num_levels]; k++) {
+                int w = order[k];
+                if (xadj[w + 1] - xadj[w] < xadj[cand + 1] - xadj[cand])
+                    cand = w;
+            }
+            BuildLevels(xadj, adj, cand, tag++, mark, order_tmp, level_ptr_tmp);
+            if ((int)level_ptr_tmp.size() - 1 <= num_levels)
+                break;
+            std::swap(order, order_tmp);
+            std::swap(level_ptr, level_ptr_tmp);
+        }
+
+        // Check the block sizes
+        int num_levels = (int)level_ptr.size() - 1;
+        bool accept = true;
+        for (int l = 0; l < num_levels && accept; l++) {
+            int size = 0;
+            for (int k = level_ptr[l]; k < level_ptr[l + 1]; k++)
+                size += vtx_ptr[order[k] + 1] - vtx_ptr[order[k]];
+            accept = size <= m_max_block_size;
+        }
+        if (!accept)
+            continue;
+
+        // Append the chain, one block per level
+        Chain chain;
+        chain.first_block = (int)m_blocks.size();
+        chain.num_blocks = num_levels;
+        chain.first = (int)m_perm.size();
+        for (int l = 0; l < num_levels; l++) {
+            Block blk;
+            blk.first = (int)m_perm.size();
+            for (int k = level_ptr[l]; k < level_ptr[l + 1]; k++) {
+                for (int j = vtx_ptr[order[k]]; j < vtx_ptr[order[k] + 1]; j++) {
+                    m_perm.push_back(vtx_idx[j]);
+                    in_chain[vtx_idx[j]] = 1;
+                }
+            }
+            blk.size = (int)m_perm.size() - blk.first;
+            m_blocks.push_back(std::move(blk));
+        }
+        chain.size = (int)m_perm.size() - chain.first;
+        m_chains.push_back(std::move(chain));
+    }
+    m_chain_size = (int)m_perm.size();
+
+    // Border unknowns, in their original order
+    for (int i = 0; i < n; i++) {
+        if (!in_chain[i])
+            m_perm.push_back(i);
+    }
+
+    m_iperm.resize(n);
+    for (int k = 0; k < n; k++)
+        m_iperm[m_perm[k]] = k;
+
+    // Size the block matrices
+    m_pos_block.resize(m_chain_size);
+    for (const auto& chain : m_chains) {
+        int last = chain.first_block + chain.num_blocks - 1;
+        for (int k = chain.first_block; k <= last; k++) {
+            auto& blk = m_blocks[k];
+            std::fill(m_pos_block.begin() + blk.first, m_pos_block.begin() + blk.first + blk.size, k);
+            blk.D.resize(blk.size, blk.size);
+            blk.L.resize(blk.size, k > chain.first_block ? m_blocks[k - 1].size : 0);
+            blk.G.resize(blk.size, k < last ? m_blocks[k + 1].size : 0);
+        }
+    }
+
+    m_blocks_changed = false;
+    m_analyzed = true;
+    m_S_analyzed = false;
+}
+
+bool ChSolverBlockTridiagonal::FactorizeChain(int c) {
+    auto& chain = m_chains[c];
+    int last = chain.first_block + chain.num_blocks - 1;
+
+    // Block Thomas algorithm
+    for (int k = chain.first_block; k <= last; k++) {
+        auto& blk = m_blocks[k];
+        if (k > chain.first_block)
+            blk.D.noalias() -= blk.L * m_blocks[k - 1].G;
+        blk.lu.compute(blk.D);
+        if (!IsNonsingular(blk.lu))
+            return false;
+        if (k < last) {
+            Eigen::MatrixXd G = blk.lu.solve(blk.G);
+            blk.G = G;
+        }
+    }
+
+    // Border unknowns coupled to this chain
+    chain.border_cols.clear();
+    chain.border_rows.clear();
+    for (int p = chain.first; p < chain.first + chain.size; p++) {
+        for (ChSparseMatrix::InnerIterator it(m_B, p); it; ++it)
+            chain.border_cols.push_back((int)it.col());
+        for (ColMajorMatrix::InnerIterator it(m_C, p); it; ++it)
+            chain.border_rows.push_back((int)it.row());
+    }
+    std::sort(chain.border_cols.begin(), chain.border_cols.end());
+    chain.border_cols.erase(std::unique(chain.border_cols.begin(), chain.border_cols.end()), chain.border_cols.end());
+    std::sort(chain.border_rows.begin(), chain.border_rows.end());
+    chain.border_rows.erase(std::unique(chain.border_rows.begin(), chain.border_rows.end()), chain.border_rows.end());
+
+    if (chain.border_cols.empty() || chain.border_rows.empty()) {
+        chain.W.resize(0, 0);
+        return true;
+    }
+
+    // Contribution of this chain to the Schur complement: W = C * T^-1 * B
+    const auto& cols = chain.border_cols;
+    const auto& rows = chain.border_rows;
+    Eigen::MatrixXd X = Eigen::MatrixXd::Zero(chain.size, cols.size());
+    for (int p = chain.first; p < chain.first + chain.size; p++) {
+        for (ChSparseMatrix::InnerIterator it(m_B, p); it; ++it) {
+            auto j = std::lower_bound(cols.begin(), cols.end(), (int)it.col()) - cols.begin();
+            X(p - chain.first, j) = it.value();
+        }
+    }
+    SolveChain(c, X);
+
+    chain.W.setZero(rows.size(), cols.size());
+    for (int q = chain.first; q < chain.first + chain.size; q++) {
+        for (ColMajorMatrix::InnerIterator it(m_C, q); it; ++it) {
+            auto i = std::lower_bound(rows.begin(), rows.end(), (int)it.row()) - rows.begin();
+            chain.W.row(i) += it.value() * X.row(q - chain.first);
+        }
+    }
+
+    return chain.W.allFinite();
+}
+
+void ChSolverBlockTridiagonal::SolveChain(int c, Eigen::Ref<Eigen::MatrixXd> X) const {
+    const auto& chain = m_chains[c];
+    int last = chain.first_block + chain.num_blocks - 1;
+
+    // Forward elimination
+    for (int k = chain.first_block; k <= last; k++) {
+        const auto& blk = m_blocks[k];
+        auto Xk = X.middleRows(blk.first - chain.first, blk.size);
+        if (k > chain.first_block) {
+            const auto& prev = m_blocks[k - 1];
+            Xk.noalias() -= blk.L * X.middleRows(prev.first - chain.first, prev.size);
+        }
+        Eigen::MatrixXd Yk = blk.lu.solve(Xk);
+        Xk = Yk;
+    }
+
+    // Back substitution
+    for (int k = last - 1; k >= chain.first_block; k--) {
+        const auto& blk = m_blocks[k];
+        const auto& next = m_blocks[k + 1];
+        X.middleRows(blk.first - chain.first, blk.size).noalias() -=
+            blk.G * X.middleRows(next.first - chain.first, next.size);
+    }
+}
+
+bool ChSolverBlockTridiagonal::FactorizeMatrix() {
+    m_factorized = false;
+    m_pattern_error = false;
+    if (m_mat.rows() != m_mat.cols())
+        return false;
+
+    if (m_analyze || !m_analyzed || m_blocks_changed || (int)m_perm.size() != m_mat.rows())
+        Analyze();
+
+    int n = (int)m_perm.size();
+    int nc = m_chain_size;
+    int nb = n - nc;
+
+    // Load the chain blocks and the couplings with the border unknowns
+    for (auto& blk : m_blocks) {
+        blk.D.setZero();
+        blk.L.setZero();
+        blk.G.setZero();
+    }
+    std::vector<Eigen::Triplet<double>> triplets_B;
+    std::vector<Eigen::Triplet<double>> triplets_C;
+    std::vector<Eigen::Triplet<double>> triplets_S;
+    for (int i = 0; i < n; i++) {
+        int p = m_iperm[i];
+        for (ChSparseMatrix::InnerIterator it(m_mat, i); it; ++it) {
+            int q = m_iperm[it.col()];
+            if (p < nc && q < nc) {
+                int bp = m_pos_block[p];
+                int bq = m_pos_block[q];
+                auto& blk = m_blocks[bp];
+                if (bq == bp) {
+                    blk.D(p - blk.first, q - blk.first) = it.value();
+                } else if (bq == bp - 1 && blk.L.cols() > 0) {
+                    blk.L(p - blk.first, q - m_blocks[bq].first) = it.value();
+                } else if (bq == bp + 1 && blk.G.cols() > 0) {
+                    blk.G(p - blk.first, q - m_blocks[bq].first) = it.value();
+                } else {
+                    // Coupling not present in the analyzed pattern
+                    m_pattern_error = true;
+                    m_analyzed = false;
+                    return false;
+                }
+            } else if (p < nc) {
+                triplets_B.push_back({p, q - nc, it.value()});
+            } else if (q < nc) {
+                triplets_C.push_back({p - nc, q, it.value()});
+            } else {
+                triplets_S.push_back({p - nc, q - nc, it.value()});
+            }
+        }
+    }
+    m_B.resize(nc, nb);
+    m_B.setFromTriplets(triplets_B.begin(), triplets_B.end());
+    m_C.resize(nb, nc);
+    m_C.setFromTriplets(triplets_C.begin(), triplets_C.end());
+
+    // Factorize the chains (in parallel) and calculate their contributions to the Schur complement
+    int num_chains = (int)m_chains.size();
+    int num_threads = std::max(1, std::min(m_num_threads, num_chains / CHAIN_CHUNK_SIZE));
+    std::vector<char> success(num_chains);
+#pragma omp parallel for schedule(dynamic, CHAIN_CHUNK_SIZE) num_threads(num_threads) if (num_threads > 1)
+    for (int c = 0; c < num_chains; c++)
+        success[c] = FactorizeChain(c);
+    for (int c = 0; c < num_chains; c++) {
+        if (!success[c])
+            return false;
+    }
+
+    // Assemble and factorize the Schur complement
+    if (nb > 0) {
+        for (const auto& chain : m_chains) {
+            for (int j = 0; j < (int)chain.W.cols(); j++) {
+                for (int i = 0; i < (int)chain.W.rows(); i++)
+                    triplets_S.push_back({chain.border_rows[i], chain.border_cols[j], -chain.W(i, j)});
+            }
+        }
+        m_S.resize(nb, nb);
+        m_S.setFromTriplets(triplets_S.begin(), triplets_S.end());
+        m_S.makeCompressed();
+
+        if (!m_S_analyzed || m_S.nonZeros() != m_S_nnz) {
+            m_S_lu.analyzePattern(m_S);
+            m_S_nnz = m_S.nonZeros();
+            m_S_analyzed = true;
+        }
+        m_S_lu.factorize(m_S);
+        if (m_S_lu.info() != Eigen::Success)
+            return false;
+    }
+
+    m_factorized = true;
+    return true;
+}
+
+bool ChSolverBlockTridiagonal::SolveSystem() {
+    if (!m_factorized)
+        return false;
+
+    int n = (int)m_perm.size();
+    int nc = m_chain_size;
+    int nb = n - nc;
+    int num_chains = (int)m_chains.size();
+    int num_threads = std::max(1, std::min(m_num_threads, num_chains / CHAIN_CHUNK_SIZE));
+
+    Eigen::VectorXd y(n);
+    for (int k = 0; k < n; k++)
+        y(k) = m_rhs(m_perm[k]);
+
+    auto solve_chains = [&]() {
+#pragma omp parallel for schedule(dynamic, CHAIN_CHUNK_SIZE) num_threads(num_threads) if (num_threads > 1)
+        for (int c = 0; c < num_chains; c++) {
+            const auto& chain = m_chains[c];
+            SolveChain(c, Eigen::Map<Eigen::MatrixXd>(y.data() + chain.first, chain.size, 1));
+        }
+    };
+
+    if (nb == 0) {
+        solve_chains();
+    } else {
+        // Block elimination of the chain unknowns:
+        //   S * x_B = b_B - C * T^-1 * b_T
+        //   T * x_T = b_T - B * x_B
+        Eigen::VectorXd b_T = y.head(nc);
+        solve_chains();
+        Eigen::VectorXd r_B = y.tail(nb) - m_C * y.head(nc);
+        Eigen::VectorXd x_B = m_S_lu.solve(r_B);
+        y.head(nc) = b_T - m_B * x_B;
+        solve_chains();
+        y.tail(nb) = x_B;
+    }
+
+    for (int k = 0; k < n; k++)
+        m_sol(m_perm[k]) = y(k);
+
+    return m_sol.allFinite();
+}
+
+size_t ChSolverBlockTridiagonal::GetFactorizationMemoryUsage() const {
+    size_t mem = 0;
+    for (const auto& blk : m_blocks)
+        mem += (2 * blk.D.size() + blk.L.size() + blk.G.size()) * sizeof(double) + blk.size * sizeof(int);
+    for (const auto& chain : m_chains)
+        mem += chain.W.size() * sizeof(double);
+    mem += (m_B.nonZeros() + m_C.nonZeros() + m_S.nonZeros()) * (sizeof(double) + sizeof(int));
+    return mem;
+}
+
+void ChSolverBlockTridiagonal::PrintErrorMessage() {
+    if (m_mat.rows() != m_mat.cols())
+        std::cout << "the problem matrix is not square" << std::endl;
+    else if (m_pattern_error)
+        std::cout << "the matrix sparsity pattern changed without a new symbolic analysis" << std::endl;
+    else if (!m_factorized)
+        std::cout << "numerical factorization failed, singular block or Schur complement" << std::endl;
+    else
+        std::cout << "solution failed, non-finite entries in the solution vector" << std::endl;
+}
+
+}  // end namespace chrono
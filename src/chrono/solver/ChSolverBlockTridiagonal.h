@@ -0,0 +1,166 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Direct solver for systems dominated by chain-structured meshes (cables, beams),
+// using block-tridiagonal factorizations bordered by a sparse Schur complement.
+//
+// =============================================================================
+
+#ifndef CH_SOLVER_BLOCK_TRIDIAGONAL_H
+#define CH_SOLVER_BLOCK_TRIDIAGONAL_H
+
+#include <utility>
+#include <vector>
+
+#include "chrono/solver/ChDirectSolverLS.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Block-tridiagonal direct solver for chain-structured meshes.\n
+/// Intended for systems such as mooring lines and tethers (e.g., built with ChBuilderCableANCF or ChBuilderBeamEuler),
+/// for which the cost of the solution grows linearly with the number of elements.\n
+/// Cannot handle VI and complementarity problems, so it cannot be used with NSC formulations.\n
+///
+/// The symbolic analysis builds the coupling graph of the system variables (one vertex per ChVariables object) and
+/// orders each connected component with a level structure rooted at a pseudo-peripheral vertex. Consecutive levels
+/// only couple with each other, so a component with small levels (such as the nodes of a cable, or of a ring of cables)
+/// is a chain of small dense blocks. Components with levels larger than the maximum block size (see SetMaxBlockSize),
+/// as well as all constraint multipliers, form the border of the system.
+///
+/// Each chain is factorized with a block Thomas algorithm (dense LU with partial pivoting of each block); independent
+/// chains are processed in parallel. The border unknowns, which include boundary constraints and attachments to other
+/// bodies, are obtained from the Schur complement of the chains, assembled as a sparse matrix and factorized with
+/// Eigen's SparseLU. If no chains are detected, the solver thus reduces to a general sparse LU factorization.
+///
+/// If the matrix is loaded directly (see SetupCurrent), each unknown is a separate vertex of the coupling graph and
+/// unknowns with a zero diagonal entry (such as Lagrange multipliers) are placed in the border.\n
+/// The symbolic analysis can be reused across factorizations (see ReuseSymbolicAnalysis).\n
+/// See ChDirectSolverLS for more details.
+class ChApi ChSolverBlockTridiagonal : public ChDirectSolverLS {
+  public:
+    /// Construct a block-tridiagonal solver using the specified number of OpenMP threads.
+    /// If num_threads is not positive, the number of available processors is used.
+    ChSolverBlockTridiagonal(int num_threads = 0);
+
+    ~ChSolverBlockTridiagonal() {}
+
+    virtual Type GetType() const override { return Type::BLOCK_TRIDIAGONAL; }
+
+    /// Set the number of OpenMP threads used to factorize and solve independent chains.
+    /// If num_threads is not positive, the number of available processors is used.
+    void SetNumThreads(int num_threads);
+
+    /// Set the maximum size of the diagonal blocks of a chain (default: 36).
+    /// Components of the coupling graph that would require larger blocks are moved to the border.
+    void SetMaxBlockSize(int size) { m_max_block_size = size; }
+
+    /// Return the number of chains in the current symbolic analysis.
+    int GetNumChains() const { return (int)m_chains.size(); }
+
+    /// Return the number of diagonal blocks (over all chains) in the current symbolic analysis.
+    int GetNumBlocks() const { return (int)m_blocks.size(); }
+
+    /// Return the number of unknowns in the chains.
+    int GetChainSize() const { return m_chain_size; }
+
+    /// Return the number of border unknowns (size of the Schur complement).
+    int GetBorderSize() const { return (int)m_perm.size() - m_chain_size; }
+
+    /// Perform the solver setup operations.
+    /// In addition to the base class operations, this records the variable blocks of the given system descriptor.
+    virtual bool Setup(ChSystemDescriptor& sysd) override;
+
+    /// Perform the solver setup operations for the current matrix (loaded directly, without a system descriptor).
+    virtual bool SetupCurrent() override;
+
+  private:
+    /// Diagonal block of a chain, with its factors.
+    struct Block {
+        int first;                                ///< first (permuted) unknown
+        int size;                                 ///< number of unknowns
+        Eigen::MatrixXd D;                        ///< diagonal block (overwritten by the factorization)
+        Eigen::MatrixXd L;                        ///< coupling with the previous block of the chain
+        Eigen::MatrixXd G;                        ///< coupling with the next block, premultiplied by the inverse pivot
+        Eigen::PartialPivLU<Eigen::MatrixXd> lu;  ///< LU factors of the pivot block
+    };
+
+    /// Chain of consecutive diagonal blocks.
+    struct Chain {
+        int first_block;               ///< first block
+        int num_blocks;                ///< number of blocks
+        int first;                     ///< first (permuted) unknown
+        int size;                      ///< number of unknowns
+        std::vector<int> border_cols;  ///< border unknowns coupled to the chain through B
+        std::vector<int> border_rows;  ///< border unknowns coupled to the chain through C
+        Eigen::MatrixXd W;             ///< Schur complement contribution C * T^-1 * B (border rows x border cols)
+    };
+
+    typedef Eigen::SparseMatrix<double, Eigen::ColMajor, int> ColMajorMatrix;
+
+    /// Factorize the current sparse matrix and return true if successful.
+    virtual bool FactorizeMatrix() override;
+
+    /// Solve the linear system using the current factorization and right-hand side vector.
+    /// Load the solution vector (already of appropriate size) and return true if succesful.
+    virtual bool SolveSystem() override;
+
+    /// Display an error message corresponding to the last failure.
+    /// This function is only called if Factorize or Solve returned false.
+    virtual void PrintErrorMessage() override;
+
+    /// Return the memory used by the block factors and the Schur complement.
+    virtual size_t GetFactorizationMemoryUsage() const override;
+
+    /// Perform the symbolic analysis of the current matrix sparsity pattern.
+    void Analyze();
+
+    /// Factorize the (loaded) blocks of the specified chain and calculate its Schur complement contribution.
+    bool FactorizeChain(int c);
+
+    /// Overwrite the given rows of the specified chain with the product of the chain inverse and these rows.
+    void SolveChain(int c, Eigen::Ref<Eigen::MatrixXd> X) const;
+
+    int m_num_threads;      ///< number of OpenMP threads
+    int m_max_block_size;   ///< maximum number of unknowns in a diagonal block
+    bool m_analyzed;        ///< is there a valid symbolic analysis?
+    bool m_factorized;      ///< is there a valid factorization?
+    bool m_pattern_error;   ///< was a matrix entry found outside the analyzed pattern?
+    bool m_blocks_changed;  ///< did the variable blocks change since the last analysis?
+
+    std::vector<std::pair<int, int>> m_var_blocks;  ///< offsets and sizes of the active variables (if known)
+    int m_num_var_unknowns;                         ///< number of unknowns covered by variables (if known)
+
+    std::vector<int> m_perm;       ///< permutation (new to old): chain unknowns first, then border unknowns
+    std::vector<int> m_iperm;      ///< inverse permutation (old to new)
+    int m_chain_size;              ///< number of chain unknowns
+    std::vector<int> m_pos_block;  ///< block of each (permuted) chain unknown
+    std::vector<Block> m_blocks;   ///< diagonal blocks of all chains, in order
+    std::vector<Chain> m_chains;   ///< chains
+
+    ChSparseMatrix m_B;                      ///< coupling of chain rows with border columns (permuted)
+    ColMajorMatrix m_C;                      ///< coupling of border rows with chain columns (permuted)
+    ColMajorMatrix m_S;                      ///< Schur complement of the chains
+    Eigen::SparseLU<ColMajorMatrix> m_S_lu;  ///< factorization of the Schur complement
+    bool m_S_analyzed;                       ///< is there a valid symbolic factorization of the Schur complement?
+    Eigen::Index m_S_nnz;                    ///< number of Schur complement nonzeros at the last symbolic factorization
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,274 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "chrono/solver/ChSolverIslands.h"
+#include "chrono/solver/ChSolverAPGD.h"
+#include "chrono/solver/ChSolverBB.h"
+#include "chrono/solver/ChSolverPJacobi.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/solver/ChSolverPSORcolored.h"
+#include "chrono/utils/ChOpenMP.h"
+#include "chrono/utils/ChTraceProfiler.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSolverIslands)
+CH_UPCASTING(ChSolverIslands, ChIterativeSolverVI)
+
+// -----------------------------------------------------------------------------
+
+ChSolverIslands::ChSolverIslands(Type island_solver_type)
+    : m_nthreads(1), m_num_islands(0), m_num_constrained_islands(0), m_error(0) {
+    SetIslandSolverType(island_solver_type);
+}
+
+void ChSolverIslands::SetIslandSolverType(Type type) {
+    switch (type) {
+        case Type::PSOR:
+        case Type::PSOR_COLORED:
+        case Type::PJACOBI:
+        case Type::BARZILAIBORWEIN:
+        case Type::APGD:
+            break;
+        default:
+            throw std::invalid_argument("ChSolverIslands: unsupported island solver type");
+    }
+
+    m_island_solver_type = type;
+    m_solvers.clear();
+}
+
+std::shared_ptr<ChIterativeSolverVI> ChSolverIslands::CreateIslandSolver() const {
+    std::shared_ptr<ChIterativeSolverVI> solver;
+    switch (m_island_solver_type) {
+        default:
+        case Type::PSOR:
+            solver = chrono_types::make_shared<ChSolverPSOR>();
+            break;
+        case Type::PSOR_COLORED:
+            solver = chrono_types::make_shared<ChSolverPSORcolored>();
+            break;
+        case Type::PJACOBI:
+            solver = chrono_types::make_shared<ChSolverPJacobi>();
+            break;
+        case Type::BARZILAIBORWEIN:
+            solver = chrono_types::make_shared<ChSolverBB>();
+            break;
+        case Type::APGD:
+            solver = chrono_types::make_shared<ChSolverAPGD>();
+            break;
+    }
+    return solver;
+}
+
+double ChSolverIslands::Solve(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariables();
+    std::vector<ChKRMBlock*>& mKRMblocks = sysd.GetKRMBlocks();
+    int nConstr = (int)mconstraints.size();
+    int nVars = (int)mvariables.size();
+    int nKRM = (int)mKRMblocks.size();
+
+    m_iterations = 0;
+    m_error = 0;
+
+    // 1)  Build the connectivity graph of the active variables and find its connected components (union-find)
+    std::vector<int> var_start;
+    std::vector<int> var_index;
+    sysd.ComputeConstraintConnectivity(var_start, var_index);
+
+    std::vector<int> parent(nVars);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&parent](int i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+    auto unite = [&parent, &find](int i, int j) {
+        i = find(i);
+        j = find(j);
+        if (i != j)
+            parent[std::max(i, j)] = std::min(i, j);
+    };
+
+    for (int ic = 0; ic < nConstr; ic++) {
+        for (int k = var_start[ic] + 1; k < var_start[ic + 1]; k++)
+            unite(var_index[var_start[ic]], var_index[k]);
+    }
+
+    std::vector<int> krm_var(nKRM, -1);
+    if (nKRM > 0) {
+        std::unordered_map<ChVariables*, int> var_map;
+        for (int iv = 0; iv < nVars; iv++)
+            var_map[mvariables[iv]] = iv;
+        for (int ik = 0; ik < nKRM; ik++) {
+            for (unsigned int k = 0; k < (unsigned int)mKRMblocks[ik]->GetNumVariables(); k++) {
+                auto var = mKRMblocks[ik]->GetVariable(k);
+                if (!var->IsActive())
+                    continue;
+                int iv = var_map[var];
+                if (krm_var[ik] < 0)
+                    krm_var[ik] = iv;
+                else
+                    unite(krm_var[ik], iv);
+            }
+        }
+    }
+
+    // 2)  Assign island indices to active variables, constraints, and KRM blocks
+    std::vector<int> var_island(nVars, -1);
+    std::vector<int> root_island(nVars, -1);
+    m_num_islands = 0;
+    for (int iv = 0; iv < nVars; iv++) {
+        if (!mvariables[iv]->IsActive())
+            continue;
+        int root = find(iv);
+        if (root_island[root] < 0)
+            root_island[root] = m_num_islands++;
+        var_island[iv] = root_island[root];
+    }
+
+    std::vector<int> constr_island(nConstr, -1);
+    for (int ic = 0; ic < nConstr; ic++) {
+        if (!mconstraints[ic]->IsActive())
+            continue;
+        if (var_start[ic] == var_start[ic + 1]) {
+            // Constraint acting only on inactive variables
+            mconstraints[ic]->SetLagrangeMultiplier(0.);
+            continue;
+        }
+        constr_island[ic] = var_island[var_index[var_start[ic]]];
+    }
+
+    std::vector<int> krm_island(nKRM, -1);
+    for (int ik = 0; ik < nKRM; ik++) {
+        if (krm_var[ik] >= 0)
+            krm_island[ik] = var_island[krm_var[ik]];
+    }
+
+    // 3)  Collect the items of each island, in their original order
+    auto bucket = [](const std::vector<int>& item_island, int num_islands, std::vector<int>& start,
+                     std::vector<int>& items) {
+        start.assign(num_islands + 1, 0);
+        for (auto island : item_island) {
+            if (island >= 0)
+                start[island + 1]++;
+        }
+        for (int i = 0; i < num_islands; i++)
+            start[i + 1] += start[i];
+        items.resize(start[num_islands]);
+        std::vector<int> pos(start.begin(), start.end() - 1);
+        for (int item = 0; item < (int)item_island.size(); item++) {
+            if (item_island[item] >= 0)
+                items[pos[item_island[item]]++] = item;
+        }
+    };
+
+    std::vector<int> island_var_start, island_vars;
+    std::vector<int> island_constr_start, island_constr;
+    std::vector<int> island_krm_start, island_krm;
+    bucket(var_island, m_num_islands, island_var_start, island_vars);
+    bucket(constr_island, m_num_islands, island_constr_start, island_constr);
+    bucket(krm_island, m_num_islands, island_krm_start, island_krm);
+
+    // 4)  Islands without constraints: solve directly, q = [M]'*fb
+    std::vector<int> islands;
+    for (int i = 0; i < m_num_islands; i++) {
+        if (island_constr_start[i + 1] > island_constr_start[i]) {
+            islands.push_back(i);
+            continue;
+        }
+        for (int k = island_var_start[i]; k < island_var_start[i + 1]; k++) {
+            auto var = mvariables[island_vars[k]];
+            var->ComputeMassInverseTimesVector(var->State(), var->Force());
+        }
+    }
+    m_num_constrained_islands = (int)islands.size();
+
+    // Process the larger islands first, for better load balancing
+    auto island_size = [&](int i) {
+        return (island_constr_start[i + 1] - island_constr_start[i]) + (island_var_start[i + 1] - island_var_start[i]);
+    };
+    std::stable_sort(islands.begin(), islands.end(), [&](int a, int b) { return island_size(a) > island_size(b); });
+
+    // 5)  Solve the islands with constraints, each with its own descriptor and solver
+    int nthreads = std::max(1, std::min(m_nthreads, m_num_constrained_islands));
+    while ((int)m_solvers.size() < nthreads)
+        m_solvers.push_back(CreateIslandSolver());
+    while ((int)m_descriptors.size() < nthreads)
+        m_descriptors.push_back(chrono_types::make_shared<ChSystemDescriptor>());
+
+    for (int t = 0; t < nthreads; t++) {
+        auto& solver = m_solvers[t];
+        solver->SetMaxIterations(m_max_iterations);
+        solver->SetTolerance(m_tolerance);
+        solver->EnableWarmStart(m_warm_start);
+        solver->EnableDiagonalPreconditioner(m_use_precond);
+        solver->SetOmega(m_omega);
+        solver->SetSharpnessLambda(m_shlambda);
+        solver->SetNumThreads(1);
+        m_descriptors[t]->SetMassFactor(sysd.GetMassFactor());
+    }
+
+    std::vector<int> island_iterations(m_num_constrained_islands, 0);
+    std::vector<double> island_error(m_num_constrained_islands, 0.0);
+
+#pragma omp parallel for schedule(dynamic, 1) num_threads(nthreads) if (nthreads > 1)
+    for (int k = 0; k < m_num_constrained_islands; k++) {
+        CH_TRACE("SolveIsland");
+        int tid = ChOMP::GetThreadNum();
+        int i = islands[k];
+        auto& descriptor = *m_descriptors[tid];
+        auto& solver = *m_solvers[tid];
+
+        descriptor.BeginInsertion();
+        for (int j = island_var_start[i]; j < island_var_start[i + 1]; j++)
+            descriptor.InsertVariables(mvariables[island_vars[j]]);
+        for (int j = island_constr_start[i]; j < island_constr_start[i + 1]; j++)
+            descriptor.InsertConstraint(mconstraints[island_constr[j]]);
+        for (int j = island_krm_start[i]; j < island_krm_start[i + 1]; j++)
+            descriptor.InsertKRMBlock(mKRMblocks[island_krm[j]]);
+        descriptor.EndInsertion();
+
+        solver.Solve(descriptor);
+
+        island_iterations[k] = solver.GetIterations();
+        island_error[k] = solver.GetError();
+    }
+
+    for (int k = 0; k < m_num_constrained_islands; k++) {
+        m_iterations = std::max(m_iterations, island_iterations[k]);
+        m_error = std::max(m_error, island_error[k]);
+    }
+
+    // 6)  Restore the offsets of variables and constraints in the global descriptor
+    sysd.UpdateCountsAndOffsets();
+
+    if (verbose)
+        std::cout << "ChSolverIslands: " << m_num_islands << " islands (" << m_num_constrained_islands
+                  << " with constraints), max iterations: " << m_iterations << ", max error: " << m_error << std::endl;
+
+    return m_error;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,98 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHSOLVER_ISLANDS_H
+#define CHSOLVER_ISLANDS_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/solver/ChIterativeSolverVI.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// An iterative VI solver which decomposes the problem into independent subsystems (islands) and solves them
+/// concurrently.\n
+/// At each call to Solve(), the active variables are partitioned into islands, i.e. connected components of the graph
+/// in which two variables are connected if they are both referenced by an active constraint or by a KRM block. Each
+/// island is then solved independently, with a separate instance of the selected iterative VI solver (PSOR by
+/// default), with islands distributed over the available OpenMP threads.\n
+/// Islands without constraints are solved directly (q = [M]^-1 f). Constraints which act only on inactive variables
+/// (e.g., links between fixed or sleeping bodies) are not included in any island and their multipliers are set to
+/// zero.\n
+/// The settings of this solver (maximum iterations, tolerance, warm start, overrelaxation, sharpness, and diagonal
+/// preconditioning) are passed to the island solvers. The reported number of iterations and error are the maximum
+/// over all islands. Results do not depend on the number of threads.\n
+/// See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the
+/// solver.
+class ChApi ChSolverIslands : public ChIterativeSolverVI {
+  public:
+    ChSolverIslands(Type island_solver_type = Type::PSOR);
+
+    ~ChSolverIslands() {}
+
+    virtual Type GetType() const override { return Type::CUSTOM; }
+
+    /// Set the type of iterative VI solver used for each island (default: PSOR).
+    /// Supported types are PSOR, PSOR_COLORED, PJACOBI, BARZILAIBORWEIN, and APGD.
+    void SetIslandSolverType(Type type);
+
+    /// Get the type of iterative VI solver used for each island.
+    Type GetIslandSolverType() const { return m_island_solver_type; }
+
+    /// Set the number of OpenMP threads used to solve the islands concurrently (default: 1).
+    /// If the solver is attached to a ChSystem, this is set to the number of Chrono threads of that system.
+    virtual void SetNumThreads(int nthreads) override { m_nthreads = (nthreads < 1) ? 1 : nthreads; }
+
+    /// Get the number of OpenMP threads used by this solver.
+    int GetNumThreads() const { return m_nthreads; }
+
+    /// Return the number of islands found during the last solve.
+    int GetNumIslands() const { return m_num_islands; }
+
+    /// Return the number of islands with constraints found during the last solve.
+    int GetNumConstrainedIslands() const { return m_num_constrained_islands; }
+
+    /// Performs the solution of the problem.
+    /// \return  the maximum error over all islands after termination.
+    virtual double Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                         ) override;
+
+    /// Return the tolerance error reached during the last solve.
+    /// This is the maximum over all islands of the error reported by the island solvers.
+    virtual double GetError() const override { return m_error; }
+
+  private:
+    /// Create an island solver of the current type.
+    std::shared_ptr<ChIterativeSolverVI> CreateIslandSolver() const;
+
+    Type m_island_solver_type;  ///< type of the island solvers
+    int m_nthreads;             ///< number of OpenMP threads
+
+    std::vector<std::shared_ptr<ChIterativeSolverVI>> m_solvers;     ///< island solvers (one per thread)
+    std::vector<std::shared_ptr<ChSystemDescriptor>> m_descriptors;  ///< island descriptors (one per thread)
+
+    int m_num_islands;              ///< number of islands in last solve
+    int m_num_constrained_islands;  ///< number of islands with constraints in last solve
+    double m_error;                 ///< maximum error over all islands in last solve
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
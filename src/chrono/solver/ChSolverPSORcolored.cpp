@@ -0,0 +1,289 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/solver/ChSolverPSORcolored.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSolverPSORcolored)
+CH_UPCASTING(ChSolverPSORcolored, ChIterativeSolverVI)
+
+// -----------------------------------------------------------------------------
+
+ChSolverPSORcolored::ChSolverPSORcolored() : m_nthreads(1), m_symmetric(false), maxviolation(0) {
+    m_color_start.push_back(0);
+}
+
+void ChSolverPSORcolored::ColorConstraints(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariables();
+
+    // Collect the active variables of each constraint
+    std::vector<int> var_start;
+    std::vector<int> var_index;
+    sysd.ComputeConstraintConnectivity(var_start, var_index);
+
+    // Group active constraints in blocks (triplets of friction constraints or individual constraints) and collect the
+    // active variables of each block
+    m_block_constr.clear();
+    m_block_start.clear();
+    std::vector<int> block_vars;
+    std::vector<int> block_vars_start;
+
+    int i_friction_comp = 0;
+    for (size_t ic = 0; ic < mconstraints.size(); ic++) {
+        auto constr = mconstraints[ic];
+        if (!constr->IsActive())
+            continue;
+
+        bool friction = constr->GetMode() == ChConstraint::Mode::FRICTION;
+        if (!friction || i_friction_comp == 0) {
+            m_block_start.push_back((int)m_block_constr.size());
+            block_vars_start.push_back((int)block_vars.size());
+        }
+        m_block_constr.push_back(constr);
+
+        // Add the constraint variables to the current block (a variable may appear more than once)
+        block_vars.insert(block_vars.end(), var_index.begin() + var_start[ic], var_index.begin() + var_start[ic + 1]);
+
+        if (friction)
+            i_friction_comp = (i_friction_comp + 1) % 3;
+    }
+
+    int num_blocks = (int)m_block_start.size();
+    m_block_start.push_back((int)m_block_constr.size());
+    block_vars_start.push_back((int)block_vars.size());
+
+    // Greedy coloring: assign to each block the smallest color not used by any other block acting on the same variables
+    std::vector<std::vector<int>> var_colors(mvariables.size());
+    std::vector<int> color_mark;
+    std::vector<int> block_color(num_blocks);
+    std::vector<int> color_count;
+
+    for (int ib = 0; ib < num_blocks; ib++) {
+        for (int k = block_vars_start[ib]; k < block_vars_start[ib + 1]; k++) {
+            for (auto color : var_colors[block_vars[k]])
+                color_mark[color] = ib + 1;
+        }
+        int color = 0;
+        while (color < (int)color_mark.size() && color_mark[color] == ib + 1)
+            color++;
+        if (color == (int)color_mark.size()) {
+            color_mark.push_back(0);
+            color_count.push_back(0);
+        }
+        for (int k = block_vars_start[ib]; k < block_vars_start[ib + 1]; k++)
+            var_colors[block_vars[k]].push_back(color);
+        block_color[ib] = color;
+        color_count[color]++;
+    }
+
+    // Sort blocks by color (preserving the original order within each color)
+    int num_colors = (int)color_count.size();
+    m_color_start.assign(num_colors + 1, 0);
+    for (int c = 0; c < num_colors; c++)
+        m_color_start[c + 1] = m_color_start[c] + color_count[c];
+
+    std::vector<int> color_pos(m_color_start.begin(), m_color_start.end() - 1);
+    m_color_blocks.resize(num_blocks);
+    for (int ib = 0; ib < num_blocks; ib++)
+        m_color_blocks[color_pos[block_color[ib]]++] = ib;
+
+    m_block_violation.assign(num_blocks, 0.0);
+    m_block_dlambda.assign(num_blocks, 0.0);
+}
+
+void ChSolverPSORcolored::SolveBlock(int ib) {
+    int start = m_block_start[ib];
+    int size = m_block_start[ib + 1] - start;
+    ChConstraint** constr = &m_block_constr[start];
+
+    double candidate_violation = 0;
+    double max_delta = 0;
+
+    if (size == 3 && constr[0]->GetMode() == ChConstraint::Mode::FRICTION) {
+        // Triplet of contact constraints N,U,V.
+        // All residuals are evaluated before the variables are incremented.
+        double old_lambda[3];
+        double new_lambda[3];
+        for (int k = 0; k < 3; k++) {
+            // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+            double mresidual = constr[k]->ComputeJacobianTimesState() + constr[k]->GetRightHandSide() +
+                               constr[k]->GetComplianceTerm() * constr[k]->GetLagrangeMultiplier();
+            // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+            double deltal = (m_omega / constr[k]->GetSchurComplement()) * (-mresidual);
+            // update:   lambda += delta_lambda;
+            old_lambda[k] = constr[k]->GetLagrangeMultiplier();
+            constr[k]->SetLagrangeMultiplier(old_lambda[k] + deltal);
+            if (k == 0)
+                candidate_violation = std::abs(std::min(0.0, mresidual));
+        }
+
+        constr[0]->Project();  // the N normal component will take care of N,U,V
+
+        for (int k = 0; k < 3; k++) {
+            new_lambda[k] = constr[k]->GetLagrangeMultiplier();
+            // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+            if (m_shlambda != 1.0) {
+                new_lambda[k] = m_shlambda * new_lambda[k] + (1.0 - m_shlambda) * old_lambda[k];
+                constr[k]->SetLagrangeMultiplier(new_lambda[k]);
+            }
+        }
+
+        for (int k = 0; k < 3; k++) {
+            double true_delta = new_lambda[k] - old_lambda[k];
+            constr[k]->IncrementState(true_delta);
+            max_delta = std::max(max_delta, std::abs(true_delta));
+        }
+    } else {
+        // Individual constraints
+        for (int k = 0; k < size; k++) {
+            // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+            double mresidual = constr[k]->ComputeJacobianTimesState() + constr[k]->GetRightHandSide() +
+                               constr[k]->GetComplianceTerm() * constr[k]->GetLagrangeMultiplier();
+
+            // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+            double violation = constr[k]->GetMode() == ChConstraint::Mode::UNILATERAL
+                                   ? std::abs(std::min(0.0, mresidual))
+                                   : std::abs(constr[k]->Violation(mresidual));
+            candidate_violation = std::max(candidate_violation, violation);
+
+            // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+            double deltal = (m_omega / constr[k]->GetSchurComplement()) * (-mresidual);
+
+            // update:   lambda += delta_lambda, then project onto the admissible set
+            double old_lambda = constr[k]->GetLagrangeMultiplier();
+            constr[k]->SetLagrangeMultiplier(old_lambda + deltal);
+            constr[k]->Project();
+            double new_lambda = constr[k]->GetLagrangeMultiplier();
+
+            // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+            if (m_shlambda != 1.0) {
+                new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
+                constr[k]->SetLagrangeMultiplier(new_lambda);
+            }
+
+            double true_delta = new_lambda - old_lambda;
+            constr[k]->IncrementState(true_delta);
+            max_delta = std::max(max_delta, std::abs(true_delta));
+        }
+    }
+
+    m_block_violation[ib] = candidate_violation;
+    m_block_dlambda[ib] = max_delta;
+}
+
+double ChSolverPSORcolored::Solve(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariables();
+    int nConstr = (int)mconstraints.size();
+    int nVars = (int)mvariables.size();
+
+    m_iterations = 0;
+    maxviolation = 0;
+
+    // 1)  Update auxiliary data in all constraints before starting,
+    //     that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
+#pragma omp parallel for schedule(static) num_threads(m_nthreads) if (m_nthreads > 1)
+    for (int ic = 0; ic < nConstr; ic++)
+        mconstraints[ic]->Update_auxiliary();
+
+    // Average all g_i for the triplet of contact constraints n,u,v.
+    int j_friction_comp = 0;
+    double gi_values[3];
+    for (int ic = 0; ic < nConstr; ic++) {
+        if (mconstraints[ic]->GetMode() == ChConstraint::Mode::FRICTION) {
+            gi_values[j_friction_comp] = mconstraints[ic]->GetSchurComplement();
+            j_friction_comp++;
+            if (j_friction_comp == 3) {
+                double average_g_i = (gi_values[0] + gi_values[1] + gi_values[2]) / 3.0;
+                mconstraints[ic - 2]->SetSchurComplement(average_g_i);
+                mconstraints[ic - 1]->SetSchurComplement(average_g_i);
+                mconstraints[ic - 0]->SetSchurComplement(average_g_i);
+                j_friction_comp = 0;
+            }
+        }
+    }
+
+    // 2)  Compute, for all items with variables, the initial guess for
+    //     still unconstrained system:
+#pragma omp parallel for schedule(static) num_threads(m_nthreads) if (m_nthreads > 1)
+    for (int iv = 0; iv < nVars; iv++) {
+        if (mvariables[iv]->IsActive())  // q = [M]'*fb
+            mvariables[iv]->ComputeMassInverseTimesVector(mvariables[iv]->State(), mvariables[iv]->Force());
+    }
+
+    // 3)  For all items with variables, add the effect of initial (guessed)
+    //     lagrangian reactions of constraints, if a warm start is desired.
+    //     Otherwise, if no warm start, simply resets initial lagrangians to zero.
+    if (m_warm_start) {
+        for (int ic = 0; ic < nConstr; ic++)
+            if (mconstraints[ic]->IsActive())
+                mconstraints[ic]->IncrementState(mconstraints[ic]->GetLagrangeMultiplier());
+    } else {
+        for (int ic = 0; ic < nConstr; ic++)
+            mconstraints[ic]->SetLagrangeMultiplier(0.);
+    }
+
+    // 4)  Partition the constraint blocks in independent sets
+    ColorConstraints(sysd);
+    int num_colors = GetNumColors();
+    int num_blocks = (int)m_color_blocks.size();
+
+    // 5)  Perform the iteration loops
+    std::fill(violation_history.begin(), violation_history.end(), 0.0);
+    std::fill(dlambda_history.begin(), dlambda_history.end(), 0.0);
+
+    for (int iter = 0; iter < m_max_iterations; iter++) {
+        bool backward = m_symmetric && (iter % 2 == 1);
+
+        // Sweep over colors; blocks of the same color do not share any active variables and are processed
+        // concurrently. The implicit barrier at the end of each worksharing loop enforces the Gauss-Seidel order
+        // between colors.
+#pragma omp parallel num_threads(m_nthreads) if (m_nthreads > 1)
+        {
+            for (int i = 0; i < num_colors; i++) {
+                int c = backward ? num_colors - 1 - i : i;
+#pragma omp for schedule(static)
+                for (int k = m_color_start[c]; k < m_color_start[c + 1]; k++)
+                    SolveBlock(m_color_blocks[k]);
+            }
+        }
+
+        maxviolation = 0;
+        double maxdeltalambda = 0;
+        for (int ib = 0; ib < num_blocks; ib++) {
+            maxviolation = std::max(maxviolation, m_block_violation[ib]);
+            maxdeltalambda = std::max(maxdeltalambda, m_block_dlambda[ib]);
+        }
+
+        // For recording into violation history, if debugging
+        if (this->record_violation_history)
+            AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+        m_iterations++;
+
+        // Terminate the loop if violation in constraints has been successfully limited.
+        if (maxviolation < m_tolerance)
+            break;
+
+    }  // end iteration loop
+
+    return maxviolation;
+}
+
+}  // end namespace chrono
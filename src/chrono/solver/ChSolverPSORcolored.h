@@ -0,0 +1,96 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHSOLVER_PSOR_COLORED_H
+#define CHSOLVER_PSOR_COLORED_H
+
+#include <vector>
+
+#include "chrono/solver/ChIterativeSolverVI.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// An iterative solver based on projective fixed point method, with overrelaxation and immediate variable update as in
+/// SOR methods, using a graph coloring of the constraints for parallel execution.\n
+/// At each call to Solve(), the constraint blocks (individual constraints or triplets of contact constraints) are
+/// partitioned into colors such that no two blocks of the same color act on the same active variables. A Gauss-Seidel
+/// sweep then processes the colors in sequence, with all blocks of one color updated concurrently (OpenMP). The
+/// order in which constraints are visited therefore differs from that of ChSolverPSOR, but results do not depend on
+/// the number of threads.\n
+/// Optionally, forward and backward sweeps over the colors can be alternated (as in ChSolverPSSOR).\n
+/// See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the
+/// solver.
+class ChApi ChSolverPSORcolored : public ChIterativeSolverVI {
+  public:
+    ChSolverPSORcolored();
+
+    ~ChSolverPSORcolored() {}
+
+    virtual Type GetType() const override { return Type::PSOR_COLORED; }
+
+    /// Set the number of OpenMP threads used for the sweeps over each color (default: 1).
+    /// If the solver is attached to a ChSystem, this is set to the number of Chrono threads of that system.
+    virtual void SetNumThreads(int nthreads) override { m_nthreads = (nthreads < 1) ? 1 : nthreads; }
+
+    /// Get the number of OpenMP threads used by this solver.
+    int GetNumThreads() const { return m_nthreads; }
+
+    /// Enable alternating forward and backward sweeps over the colors, as in symmetric SOR (default: false).
+    /// As with ChSolverPSSOR, each sweep is counted as one iteration.
+    void EnableSymmetricSweep(bool val) { m_symmetric = val; }
+
+    /// Return true if alternating forward and backward sweeps are enabled.
+    bool IsSymmetricSweepEnabled() const { return m_symmetric; }
+
+    /// Return the number of colors generated during the last solve.
+    int GetNumColors() const { return (int)m_color_start.size() - 1; }
+
+    /// Performs the solution of the problem.
+    /// \return  the maximum constraint violation after termination.
+    virtual double Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                         ) override;
+
+    /// Return the tolerance error reached during the last solve.
+    /// For the PSOR solver, this is the maximum constraint violation.
+    virtual double GetError() const override { return maxviolation; }
+
+  private:
+    /// Group the active constraints into blocks and color them.
+    void ColorConstraints(ChSystemDescriptor& sysd);
+
+    /// Perform the PSOR update of the specified block.
+    /// The maximum constraint violation and change in Lagrange multipliers are stored in the per-block caches.
+    void SolveBlock(int ib);
+
+    int m_nthreads;    ///< number of OpenMP threads
+    bool m_symmetric;  ///< alternate forward and backward sweeps
+
+    std::vector<ChConstraint*> m_block_constr;  ///< constraints of all blocks, in block order
+    std::vector<int> m_block_start;             ///< start of each block in m_block_constr
+    std::vector<int> m_color_blocks;            ///< block indices, sorted by color
+    std::vector<int> m_color_start;             ///< start of each color in m_color_blocks
+    std::vector<double> m_block_violation;      ///< constraint violation for each block
+    std::vector<double> m_block_dlambda;        ///< maximum change in Lagrange multipliers for each block
+
+    double maxviolation;
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,876 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+#include "chrono/solver/ChSolverSparseSupernodal.h"
+#include "chrono/utils/ChOpenMP.h"
+
+#include <Eigen/OrderingMethods>
+
+namespace chrono {
+
+// Subgraphs of at most this size are not dissected further
+static const int ND_LEAF_SIZE = 128;
+
+// Block size of the dense partial factorization kernels
+static const int FRONT_BLOCK_SIZE = 32;
+
+// -----------------------------------------------------------------------------
+// Graph and ordering utilities
+// -----------------------------------------------------------------------------
+
+// Build the adjacency graph (without self loops) of the symmetrized sparsity pattern of the given matrix.
+static void BuildGraph(const ChSparseMatrix& A, std::vector<int>& xadj, std::vector<int>& adj) {
+    int n = (int)A.rows();
+
+    std::vector<int> ptr(n + 1, 0);
+    for (int i = 0; i < n; i++) {
+        for (ChSparseMatrix::InnerIterator it(A, i); it; ++it) {
+            int j = (int)it.col();
+            if (j != i) {
+                ptr[i + 1]++;
+                ptr[j + 1]++;
+            }
+        }
+    }
+    for (int i = 0; i < n; i++)
+        ptr[i + 1] += ptr[i];
+
+    std::vector<int> lst(ptr[n]);
+    std::vector<int> pos(ptr.begin(), ptr.end() - 1);
+    for (int i = 0; i < n; i++) {
+        for (ChSparseMatrix::InnerIterator it(A, i); it; ++it) {
+            int j = (int)it.col();
+            if (j != i) {
+                lst[pos[i]++] = j;
+                lst[pos[j]++] = i;
+            }
+        }
+    }
+
+    // Remove duplicate edges (from entries present in both triangles)
+    xadj.assign(n + 1, 0);
+    adj.clear();
+    adj.reserve(ptr[n] / 2 + n);
+    for (int i = 0; i < n; i++) {
+        std::sort(lst.begin() + ptr[i], lst.begin() + ptr[i + 1]);
+        auto last = std::unique(lst.begin() + ptr[i], lst.begin() + ptr[i + 1]);
+        adj.insert(adj.end(), lst.begin() + ptr[i], last);
+        xadj[i + 1] = (int)adj.size();
+    }
+}
+
+// Append an approximate minimum degree ordering of the subgraph induced by the given vertices.
+// The 'local' work array must be -1 for all vertices on entry and is restored on return.
+static void OrderMinimumDegree(const std::vector<int>& xadj,
+                               const std::vector<int>& adj,
+                               const std::vector<int>& verts,
+                               std::vector<int>& local,
+                               std::vector<int>& order) {
+    int k = (int)verts.size();
+    if (k <= 3) {
+        order.insert(order.end(), verts.begin(), verts.end());
+        return;
+    }
+
+    for (int t = 0; t < k; t++)
+        local[verts[t]] = t;
+
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int t = 0; t < k; t++) {
+        triplets.push_back(Eigen::Triplet<double>(t, t, 1.0));
+        for (int e = xadj[verts[t]]; e < xadj[verts[t] + 1]; e++) {
+            int u = local[adj[e]];
+            if (u >= 0)
+                triplets.push_back(Eigen::Triplet<double>(u, t, 1.0));
+        }
+    }
+    Eigen::SparseMatrix<double, Eigen::ColMajor, int> M(k, k);
+    M.setFromTriplets(triplets.begin(), triplets.end());
+
+    Eigen::AMDOrdering<int> amd;
+    Eigen::PermutationMatrix<Eigen::Dynamic, Eigen::Dynamic, int> P;
+    amd(M, P);
+    for (int t = 0; t < k; t++)
+        order.push_back(verts[P.indices()(t)]);
+
+    for (int t = 0; t < k; t++)
+        local[verts[t]] = -1;
+}
+
+// Nested dissection ordering, with vertex separators obtained from level structures rooted at pseudo-peripheral
+// vertices. Subgraphs are labeled; vertices already ordered in a separator are labeled -1.
+class NestedDissection {
+  public:
+    NestedDissection(const std::vector<int>& xadj, const std::vector<int>& adj, std::vector<int>& order)
+        : m_xadj(xadj), m_adj(adj), m_order(order), m_next_id(1) {
+        int n = (int)xadj.size() - 1;
+        m_label.assign(n, 0);
+        m_level.assign(n, -1);
+        m_local.assign(n, -1);
+    }
+
+    void Run() {
+        std::vector<int> verts(m_label.size());
+        for (int i = 0; i < (int)verts.size(); i++)
+            verts[i] = i;
+        Dissect(verts, 0);
+    }
+
+  private:
+    // Breadth-first search from the root within the subgraph with given label.
+    // On return, 'queue' holds the visited vertices by level and 'ptr' the level offsets.
+    void LevelStructure(int root, int id, std::vector<int>& queue, std::vector<int>& ptr) {
+        queue.clear();
+        ptr.clear();
+        queue.push_back(root);
+        m_level[root] = 0;
+        ptr.push_back(0);
+        int current = 0;
+        for (size_t head = 0; head < queue.size(); head++) {
+            int v = queue[head];
+            if (m_level[v] != current) {
+                ptr.push_back((int)head);
+                current++;
+            }
+            for (int e = m_xadj[v]; e < m_xadj[v + 1]; e++) {
+                int u = m_adj[e];
+                if (m_label[u] == id && m_level[u] < 0) {
+                    m_level[u] = m_level[v] + 1;
+                    queue.push_back(u);
+                }
+            }
+        }
+        ptr.push_back((int)queue.size());
+    }
+
+    void ResetLevels(const std::vector<int>& queue) {
+        for (auto v : queue)
+            m_level[v] = -1;
+    }
+
+    void Dissect(const std::vector<int>& verts, int id) {
+        if ((int)verts.size() <= ND_LEAF_SIZE) {
+            OrderMinimumDegree(m_xadj, m_adj, verts, m_local, m_order);
+            return;
+        }
+
+        std::vector<int> queue;
+        std::vector<int> ptr;
+        LevelStructure(verts[0], id, queue, ptr);
+
+        // Disconnected subgraph: order small components together and dissect the large ones separately
+        if (queue.size() < verts.size()) {
+            std::vector<int> small;
+            std::vector<std::vector<int>> large;
+            std::vector<int> component;
+            std::vector<int> component_ptr;
+            for (auto v : verts) {
+                if (m_level[v] >= 0)
+                    continue;
+                LevelStructure(v, id, component, component_ptr);
+                if ((int)component.size() <= ND_LEAF_SIZE)
+                    small.insert(small.end(), component.begin(), component.end());
+                else
+                    large.push_back(component);
+            }
+            ResetLevels(verts);
+            if ((int)queue.size() > ND_LEAF_SIZE)
+                large.push_back(queue);
+            else
+                small.insert(small.end(), queue.begin(), queue.end());
+
+            OrderMinimumDegree(m_xadj, m_adj, small, m_local, m_order);
+            for (const auto& c : large) {
+                int id_c = m_next_id++;
+                for (auto v : c)
+                    m_label[v] = id_c;
+                Dissect(c, id_c);
+            }
+            return;
+        }
+
+        // Find a pseudo-peripheral root, starting from a vertex of minimum degree in the last level
+        int num_levels = (int)ptr.size() - 1;
+        for (int iter = 0; iter < 5; iter++) {
+            int root = -1;
+            int min_degree = INT_MAX;
+            for (int t = ptr[num_levels - 1]; t < ptr[num_levels]; t++) {
+                int v = queue[t];
+                int degree = m_xadj[v + 1] - m_xadj[v];
+                if (degree < min_degree) {
+                    min_degree = degree;
+                    root = v;
+                }
+            }
+            ResetLevels(queue);
+            LevelStructure(root, id, queue, ptr);
+            int num_levels_new = (int)ptr.size() - 1;
+            bool deeper = num_levels_new > num_levels;
+            num_levels = num_levels_new;
+            if (!deeper)
+                break;
+        }
+
+        // Nearly complete subgraph
+        if (num_levels < 3) {
+            ResetLevels(queue);
+            OrderMinimumDegree(m_xadj, m_adj, verts, m_local, m_order);
+            return;
+        }
+
+        // Separator level: level at which half of the vertices are reached
+        int half = (int)verts.size() / 2;
+        int l = 1;
+        while (l < num_levels - 2 && ptr[l + 1] <= half)
+            l++;
+
+        std::vector<int> part_a(queue.begin(), queue.begin() + ptr[l]);
+        std::vector<int> part_b(queue.begin() + ptr[l + 1], queue.end());
+        std::vector<int> separator;
+
+        // Separator vertices not adjacent to the next level are moved to the first part
+        for (int t = ptr[l]; t < ptr[l + 1]; t++) {
+            int v = queue[t];
+            bool boundary = false;
+            for (int e = m_xadj[v]; e < m_xadj[v + 1] && !boundary; e++) {
+                int u = m_adj[e];
+                boundary = (m_label[u] == id && m_level[u] == l + 1);
+            }
+            if (boundary)
+                separator.push_back(v);
+            else
+                part_a.push_back(v);
+        }
+        ResetLevels(queue);
+
+        int id_a = m_next_id++;
+        int id_b = m_next_id++;
+        for (auto v : part_a)
+            m_label[v] = id_a;
+        for (auto v : part_b)
+            m_label[v] = id_b;
+        for (auto v : separator)
+            m_label[v] = -1;
+
+        Dissect(part_a, id_a);
+        Dissect(part_b, id_b);
+        m_order.insert(m_order.end(), separator.begin(), separator.end());
+    }
+
+    const std::vector<int>& m_xadj;
+    const std::vector<int>& m_adj;
+    std::vector<int>& m_order;
+    std::vector<int> m_label;
+    std::vector<int> m_level;
+    std::vector<int> m_local;
+    int m_next_id;
+};
+
+// Compute the elimination tree and the column counts (strictly below the diagonal) of the Cholesky factor of the
+// graph permuted with 'perm' (new to old). Return an estimate of the number of factorization operations.
+static double SymbolicFactorization(const std::vector<int>& xadj,
+                                    const std::vector<int>& adj,
+                                    const std::vector<int>& perm,
+                                    std::vector<int>& parent,
+                                    std::vector<int>& count) {
+    int n = (int)perm.size();
+    std::vector<int> iperm(n);
+    for (int k = 0; k < n; k++)
+        iperm[perm[k]] = k;
+
+    // Elimination tree, with path compression through the ancestor array
+    std::vector<int> ancestor(n, -1);
+    parent.assign(n, -1);
+    for (int k = 0; k < n; k++) {
+        int v = perm[k];
+        for (int e = xadj[v]; e < xadj[v + 1]; e++) {
+            int i = iperm[adj[e]];
+            while (i != -1 && i < k) {
+                int next = ancestor[i];
+                ancestor[i] = k;
+                if (next == -1)
+                    parent[i] = k;
+                i = next;
+            }
+        }
+    }
+
+    // Column counts, by traversal of the row subtrees
+    std::vector<int> mark(n, -1);
+    count.assign(n, 0);
+    for (int i = 0; i < n; i++) {
+        mark[i] = i;
+        int v = perm[i];
+        for (int e = xadj[v]; e < xadj[v + 1]; e++) {
+            int k = iperm[adj[e]];
+            if (k > i)
+                continue;
+            while (mark[k] != i) {
+                count[k]++;
+                mark[k] = i;
+                k = parent[k];
+            }
+        }
+    }
+
+    double ops = 0;
+    for (int k = 0; k < n; k++)
+        ops += (double)(count[k] + 1) * (count[k] + 1);
+    return ops;
+}
+
+// Postorder a forest given by its parent array. On return, post[k] is the k-th node in postorder.
+static void Postorder(const std::vector<int>& parent, std::vector<int>& post) {
+    int n = (int)parent.size();
+    std::vector<int> head(n, -1);
+    std::vector<int> next(n, -1);
+    for (int j = n - 1; j >= 0; j--) {
+        if (parent[j] != -1) {
+            next[j] = head[parent[j]];
+            head[parent[j]] = j;
+        }
+    }
+
+    post.clear();
+    post.reserve(n);
+    std::vector<int> stack;
+    for (int j = 0; j < n; j++) {
+        if (parent[j] != -1)
+            continue;
+        stack.push_back(j);
+        while (!stack.empty()) {
+            int p = stack.back();
+            int i = head[p];
+            if (i == -1) {
+                stack.pop_back();
+                post.push_back(p);
+            } else {
+                head[p] = next[i];
+                stack.push_back(i);
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+ChSolverSparseSupernodal::ChSolverSparseSupernodal(int num_threads)
+    : m_ordering(Ordering::AUTO),
+      m_ordering_used(Ordering::AMD),
+      m_pivot_threshold(1e-12),
+      m_ldlt(false),
+      m_analyzed(false),
+      m_factorized(false),
+      m_num_perturbed(0) {
+    SetNumThreads(num_threads);
+}
+
+void ChSolverSparseSupernodal::SetNumThreads(int num_threads) {
+    m_num_threads = num_threads > 0 ? num_threads : ChOMP::GetNumProcs();
+}
+
+void ChSolverSparseSupernodal::Analyze() {
+    int n = (int)m_mat.rows();
+
+    std::vector<int> xadj;
+    std::vector<int> adj;
+    BuildGraph(m_mat, xadj, adj);
+
+    // Fill-reducing ordering
+    std::vector<int> perm;
+    std::vector<int> parent;
+    std::vector<int> count;
+    std::vector<int> local(n, -1);
+    std::vector<int> all(n);
+    for (int i = 0; i < n; i++)
+        all[i] = i;
+
+    if (m_ordering == Ordering::AMD) {
+        OrderMinimumDegree(xadj, adj, all, local, perm);
+        m_ordering_used = Ordering::AMD;
+    } else {
+        perm.reserve(n);
+        NestedDissection(xadj, adj, perm).Run();
+        m_ordering_used = Ordering::NESTED_DISSECTION;
+        if (m_ordering == Ordering::AUTO && n > ND_LEAF_SIZE) {
+            // Keep nested dissection (which leads to wider elimination trees) unless it requires much more work
+            std::vector<int> perm_amd;
+            OrderMinimumDegree(xadj, adj, all, local, perm_amd);
+            double ops_nd = SymbolicFactorization(xadj, adj, perm, parent, count);
+            double ops_amd = SymbolicFactorization(xadj, adj, perm_amd, parent, count);
+            if (ops_nd > 1.25 * ops_amd) {
+                perm.swap(perm_amd);
+                m_ordering_used = Ordering::AMD;
+            }
+        }
+    }
+
+    // Postorder the elimination tree, so that all subtrees occupy contiguous ranges of columns
+    SymbolicFactorization(xadj, adj, perm, parent, count);
+    std::vector<int> post;
+    Postorder(parent, post);
+    m_perm.resize(n);
+    for (int k = 0; k < n; k++)
+        m_perm[k] = perm[post[k]];
+    SymbolicFactorization(xadj, adj, m_perm, parent, count);
+
+    std::vector<int> iperm(n);
+    for (int k = 0; k < n; k++)
+        iperm[m_perm[k]] = k;
+
+    // Fundamental supernodes: chains of columns, each the only child of the next, with nested structures
+    std::vector<int> num_children(n, 0);
+    for (int j = 0; j < n; j++) {
+        if (parent[j] != -1)
+            num_children[parent[j]]++;
+    }
+    std::vector<int> sn_first;
+    for (int j = 0; j < n; j++) {
+        if (j == 0 || parent[j - 1] != j || count[j - 1] != count[j] + 1 || num_children[j] != 1)
+            sn_first.push_back(j);
+    }
+    int num_fundamental = (int)sn_first.size();
+    sn_first.push_back(n);
+
+    // Relaxed supernodes: merge a supernode with its last child if few explicit zeros are introduced.
+    // Since columns are postordered, the last child ends right before the first column of its parent.
+    std::vector<int> first(num_fundamental);
+    std::vector<int> last(num_fundamental);
+    std::vector<double> nnz(num_fundamental, 0);
+    std::vector<int> ending(n, -1);
+    std::vector<bool> alive(num_fundamental, true);
+    for (int t = 0; t < num_fundamental; t++) {
+        first[t] = sn_first[t];
+        last[t] = sn_first[t + 1] - 1;
+        for (int j = first[t]; j <= last[t]; j++)
+            nnz[t] += count[j] + 1;
+        ending[last[t]] = t;
+    }
+    for (int t = 0; t < num_fundamental; t++) {
+        while (first[t] > 0) {
+            int c = ending[first[t] - 1];
+            int pc = parent[last[c]];
+            if (pc < first[t] || pc > last[t])
+                break;
+            double ncols = (double)(last[t] - first[c] + 1);
+            double total = ncols * (ncols + 1) / 2 + ncols * count[last[t]];
+            double zeros = (total - nnz[c] - nnz[t]) / total;
+            bool merge = ncols <= 4 || (ncols <= 16 && zeros <= 0.8) || (ncols <= 48 && zeros <= 0.1) || zeros <= 0.05;
+            if (!merge)
+                break;
+            first[t] = first[c];
+            nnz[t] += nnz[c];
+            alive[c] = false;
+        }
+    }
+
+    // Create the supernodes
+    std::vector<int> col_snode(n);
+    m_snodes.clear();
+    for (int t = 0; t < num_fundamental; t++) {
+        if (!alive[t])
+            continue;
+        Supernode sn;
+        sn.first = first[t];
+        sn.ncols = last[t] - first[t] + 1;
+        sn.parent = -1;
+        sn.first_desc = (int)m_snodes.size();
+        sn.num_perturbed = 0;
+        for (int j = first[t]; j <= last[t]; j++)
+            col_snode[j] = (int)m_snodes.size();
+        m_snodes.push_back(sn);
+    }
+    int num_snodes = (int)m_snodes.size();
+    for (int s = 0; s < num_snodes; s++) {
+        auto& sn = m_snodes[s];
+        int pc = parent[sn.first + sn.ncols - 1];
+        if (pc != -1) {
+            sn.parent = col_snode[pc];
+            m_snodes[sn.parent].children.push_back(s);
+            m_snodes[sn.parent].first_desc = std::min(m_snodes[sn.parent].first_desc, sn.first_desc);
+        }
+    }
+
+    // Row structures of the supernodes and relative locations of the children rows in the parent fronts
+    std::vector<int> mark(n, -1);
+    std::vector<int> loc(n, -1);
+    for (int s = 0; s < num_snodes; s++) {
+        auto& sn = m_snodes[s];
+        int last_col = sn.first + sn.ncols - 1;
+        sn.rows.clear();
+        for (int j = sn.first; j <= last_col; j++) {
+            int v = m_perm[j];
+            for (int e = xadj[v]; e < xadj[v + 1]; e++) {
+                int i = iperm[adj[e]];
+                if (i > last_col && mark[i] != s) {
+                    mark[i] = s;
+                    sn.rows.push_back(i);
+                }
+            }
+        }
+        for (auto c : sn.children) {
+            for (auto i : m_snodes[c].rows) {
+                if (i > last_col && mark[i] != s) {
+                    mark[i] = s;
+                    sn.rows.push_back(i);
+                }
+            }
+        }
+        std::sort(sn.rows.begin(), sn.rows.end());
+
+        for (int j = sn.first; j <= last_col; j++)
+            loc[j] = j - sn.first;
+        for (int r = 0; r < (int)sn.rows.size(); r++)
+            loc[sn.rows[r]] = sn.ncols + r;
+        for (auto c : sn.children) {
+            auto& cs = m_snodes[c];
+            cs.rel.resize(cs.rows.size());
+            for (int r = 0; r < (int)cs.rows.size(); r++)
+                cs.rel[r] = loc[cs.rows[r]];
+        }
+    }
+
+    // Assembly lists: locations in the supernode fronts of the (permuted) matrix entries.
+    // Only the lower triangle is assembled for an L*D*L' factorization.
+    std::vector<int> entry_row;
+    std::vector<int> entry_col;
+    std::vector<int> entry_val;
+    std::vector<int> entry_snode;
+    for (int i = 0; i < n; i++) {
+        for (ChSparseMatrix::InnerIterator it(m_mat, i); it; ++it) {
+            int pi = iperm[i];
+            int pj = iperm[it.col()];
+            if (m_ldlt && pi < pj)
+                continue;
+            entry_row.push_back(pi);
+            entry_col.push_back(pj);
+            entry_val.push_back((int)(&it.value() - m_mat.valuePtr()));
+            entry_snode.push_back(col_snode[std::min(pi, pj)]);
+        }
+    }
+    int num_entries = (int)entry_row.size();
+    m_asm_ptr.assign(num_snodes + 1, 0);
+    for (int k = 0; k < num_entries; k++)
+        m_asm_ptr[entry_snode[k] + 1]++;
+    for (int s = 0; s < num_snodes; s++)
+        m_asm_ptr[s + 1] += m_asm_ptr[s];
+    std::vector<int> bucket(num_entries);
+    std::vector<int> pos(m_asm_ptr.begin(), m_asm_ptr.end() - 1);
+    for (int k = 0; k < num_entries; k++)
+        bucket[pos[entry_snode[k]]++] = k;
+
+    m_asm_val.resize(num_entries);
+    m_asm_pos.resize(num_entries);
+    for (int s = 0; s < num_snodes; s++) {
+        const auto& sn = m_snodes[s];
+        Eigen::Index m = sn.ncols + (Eigen::Index)sn.rows.size();
+        for (int j = 0; j < sn.ncols; j++)
+            loc[sn.first + j] = j;
+        for (int r = 0; r < (int)sn.rows.size(); r++)
+            loc[sn.rows[r]] = sn.ncols + r;
+        for (int a = m_asm_ptr[s]; a < m_asm_ptr[s + 1]; a++) {
+            int k = bucket[a];
+            m_asm_val[a] = entry_val[k];
+            m_asm_pos[a] = loc[entry_row[k]] + m * loc[entry_col[k]];
+        }
+    }
+
+    // Schedule: split the largest subtrees until the remaining ones can be balanced over the threads.
+    // Split roots are factorized after the subtrees, with multithreaded dense kernels.
+    std::vector<double> cost(num_snodes, 0);
+    double total_cost = 0;
+    for (int s = 0; s < num_snodes; s++) {
+        const auto& sn = m_snodes[s];
+        double m = (double)(sn.ncols + sn.rows.size());
+        cost[s] += sn.ncols * m * m;
+        if (sn.parent != -1)
+            cost[sn.parent] += cost[s];
+        else
+            total_cost += cost[s];
+    }
+
+    std::vector<int> subtrees;
+    for (int s = 0; s < num_snodes; s++) {
+        if (m_snodes[s].parent == -1)
+            subtrees.push_back(s);
+    }
+    m_top.clear();
+    if (m_num_threads > 1) {
+        while (!subtrees.empty()) {
+            auto largest = std::max_element(subtrees.begin(), subtrees.end(),
+                                            [&cost](int a, int b) { return cost[a] < cost[b]; });
+            int s = *largest;
+            if (cost[s] <= total_cost / (2 * m_num_threads) || m_snodes[s].children.empty())
+                break;
+            subtrees.erase(largest);
+            m_top.push_back(s);
+            subtrees.insert(subtrees.end(), m_snodes[s].children.begin(), m_snodes[s].children.end());
+        }
+    }
+    std::sort(m_top.begin(), m_top.end());
+    std::sort(subtrees.begin(), subtrees.end(), [&cost](int a, int b) { return cost[a] > cost[b]; });
+    m_subtrees = subtrees;
+
+    m_analyzed = true;
+}
+
+void ChSolverSparseSupernodal::FactorizeSupernode(int s, double tol) {
+    auto& sn = m_snodes[s];
+    int p = sn.ncols;
+    int r = (int)sn.rows.size();
+    int m = p + r;
+
+    // Assemble the front from the matrix entries and the children contribution blocks
+    Eigen::MatrixXd F = Eigen::MatrixXd::Zero(m, m);
+    double* F_data = F.data();
+    const double* values = m_mat.valuePtr();
+    for (int a = m_asm_ptr[s]; a < m_asm_ptr[s + 1]; a++)
+        F_data[m_asm_pos[a]] += values[m_asm_val[a]];
+
+    for (auto c : sn.children) {
+        auto& cs = m_snodes[c];
+        int rc = (int)cs.rel.size();
+        for (int jj = 0; jj < rc; jj++) {
+            for (int ii = m_ldlt ? jj : 0; ii < rc; ii++)
+                F(cs.rel[ii], cs.rel[jj]) += cs.C(ii, jj);
+        }
+        cs.C.resize(0, 0);
+    }
+
+    // Partial factorization of the first p columns (blocked right-looking).
+    // For L*U, pivots are searched among the fully summed rows only.
+    sn.num_perturbed = 0;
+    sn.piv.resize(m_ldlt ? 0 : p);
+    Eigen::VectorXd w(m);
+    for (int kb = 0; kb < p; kb += FRONT_BLOCK_SIZE) {
+        int b = std::min(FRONT_BLOCK_SIZE, p - kb);
+
+        for (int k = kb; k < kb + b; k++) {
+            if (!m_ldlt) {
+                Eigen::Index ip;
+                F.col(k).segment(k, p - k).cwiseAbs().maxCoeff(&ip);
+                ip += k;
+                sn.piv[k] = (int)ip;
+                if (ip != k)
+                    F.row(k).swap(F.row(ip));
+            }
+
+            double d = F(k, k);
+            if (std::abs(d) < tol) {
+                d = (d < 0) ? -tol : tol;
+                F(k, k) = d;
+                sn.num_perturbed++;
+            }
+
+            int nr = m - k - 1;
+            int nc = kb + b - k - 1;
+            if (m_ldlt) {
+                w.head(nc) = F.col(k).segment(k + 1, nc);
+                F.col(k).tail(nr) /= d;
+                F.block(k + 1, k + 1, nr, nc).noalias() -= F.col(k).tail(nr) * w.head(nc).transpose();
+            } else {
+                F.col(k).tail(nr) /= d;
+                F.block(k + 1, k + 1, nr, nc).noalias() -= F.col(k).tail(nr) * F.row(k).segment(k + 1, nc);
+            }
+        }
+
+        int rest = m - kb - b;
+        if (rest == 0)
+            continue;
+
+        auto L21 = F.block(kb + b, kb, rest, b);
+        auto F22 = F.block(kb + b, kb + b, rest, rest);
+        if (m_ldlt) {
+            Eigen::MatrixXd W = L21 * F.diagonal().segment(kb, b).asDiagonal();
+            F22.triangularView<Eigen::Lower>() -= W * L21.transpose();
+        } else {
+            auto U12 = F.block(kb, kb + b, b, rest);
+            F.block(kb, kb, b, b).triangularView<Eigen::UnitLower>().solveInPlace(U12);
+            F22.noalias() -= L21 * U12;
+        }
+    }
+
+    // Store the factor panels and the contribution block
+    sn.L = F.leftCols(p);
+    if (!m_ldlt)
+        sn.U = F.topRightCorner(p, r);
+    sn.C = F.bottomRightCorner(r, r);
+}
+
+bool ChSolverSparseSupernodal::FactorizeMatrix() {
+    m_factorized = false;
+    if (m_mat.rows() != m_mat.cols())
+        return false;
+
+    bool ldlt = (m_symmetry == MatrixSymmetryType::SYMMETRIC_POSDEF);
+    if (m_analyze || !m_analyzed || ldlt != m_ldlt || (int)m_perm.size() != m_mat.rows()) {
+        m_ldlt = ldlt;
+        Analyze();
+    }
+
+    // Threshold for static pivoting and matrix norm for the refinement stopping criterion
+    double max_entry = 0;
+    m_mat_norm = 0;
+    for (int i = 0; i < m_mat.outerSize(); i++) {
+        double row_sum = 0;
+        for (ChSparseMatrix::InnerIterator it(m_mat, i); it; ++it) {
+            max_entry = std::max(max_entry, std::abs(it.value()));
+            row_sum += std::abs(it.value());
+        }
+        m_mat_norm = std::max(m_mat_norm, row_sum);
+    }
+    double tol = m_pivot_threshold * (max_entry > 0 ? max_entry : 1.0);
+
+    // Factorize independent subtrees in parallel, then the top supernodes
+    int num_subtrees = (int)m_subtrees.size();
+    int num_threads = std::max(1, std::min(m_num_threads, num_subtrees));
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads) if (num_threads > 1)
+    for (int t = 0; t < num_subtrees; t++) {
+        int root = m_subtrees[t];
+        for (int s = m_snodes[root].first_desc; s <= root; s++)
+            FactorizeSupernode(s, tol);
+    }
+    for (auto s : m_top)
+        FactorizeSupernode(s, tol);
+
+    m_num_perturbed = 0;
+    for (const auto& sn : m_snodes) {
+        m_num_perturbed += sn.num_perturbed;
+        if (!sn.L.allFinite() || !sn.U.allFinite())
+            return false;
+    }
+
+    m_factorized = true;
+    return true;
+}
+
+void ChSolverSparseSupernodal::SolveFactors(ChVectorDynamic<double>& y) const {
+    int num_snodes = (int)m_snodes.size();
+    size_t max_rows = 0;
+    for (const auto& sn : m_snodes)
+        max_rows = std::max(max_rows, sn.rows.size());
+    Eigen::VectorXd t(max_rows);
+
+    // Forward substitution
+    for (int s = 0; s < num_snodes; s++) {
+        const auto& sn = m_snodes[s];
+        int p = sn.ncols;
+        int r = (int)sn.rows.size();
+        auto ys = y.segment(sn.first, p);
+        for (int k = 0; k < (int)sn.piv.size(); k++) {
+            if (sn.piv[k] != k)
+                std::swap(ys(k), ys(sn.piv[k]));
+        }
+        sn.L.topRows(p).triangularView<Eigen::UnitLower>().solveInPlace(ys);
+        if (r > 0) {
+            t.head(r).noalias() = sn.L.bottomRows(r) * ys;
+            for (int i = 0; i < r; i++)
+                y(sn.rows[i]) -= t(i);
+        }
+    }
+
+    // Diagonal scaling
+    if (m_ldlt) {
+        for (const auto& sn : m_snodes)
+            y.segment(sn.first, sn.ncols).array() /= sn.L.topRows(sn.ncols).diagonal().array();
+    }
+
+    // Backward substitution
+    for (int s = num_snodes - 1; s >= 0; s--) {
+        const auto& sn = m_snodes[s];
+        int p = sn.ncols;
+        int r = (int)sn.rows.size();
+        auto ys = y.segment(sn.first, p);
+        if (r > 0) {
+            for (int i = 0; i < r; i++)
+                t(i) = y(sn.rows[i]);
+            if (m_ldlt)
+                ys.noalias() -= sn.L.bottomRows(r).transpose() * t.head(r);
+            else
+                ys.noalias() -= sn.U * t.head(r);
+        }
+        if (m_ldlt)
+            sn.L.topRows(p).transpose().triangularView<Eigen::UnitUpper>().solveInPlace(ys);
+        else
+            sn.L.topRows(p).triangularView<Eigen::Upper>().solveInPlace(ys);
+    }
+}
+
+bool ChSolverSparseSupernodal::SolveSystem() {
+    if (!m_factorized)
+        return false;
+
+    int n = (int)m_perm.size();
+    ChVectorDynamic<double> y(n);
+    for (int k = 0; k < n; k++)
+        y(k) = m_rhs(m_perm[k]);
+    SolveFactors(y);
+    for (int k = 0; k < n; k++)
+        m_sol(m_perm[k]) = y(k);
+
+    // Iterative refinement if the factorization includes perturbed pivots
+    if (m_num_perturbed > 0) {
+        double b_norm = m_rhs.lpNorm<Eigen::Infinity>();
+        while (m_refinement_steps < m_max_refinement) {
+            ChVectorDynamic<double> r = m_rhs - m_mat * m_sol;
+            double tol = m_refinement_tol * (m_mat_norm * m_sol.lpNorm<Eigen::Infinity>() + b_norm);
+            if (r.lpNorm<Eigen::Infinity>() <= tol)
+                break;
+            for (int k = 0; k < n; k++)
+                y(k) = r(m_perm[k]);
+            SolveFactors(y);
+            for (int k = 0; k < n; k++)
+                m_sol(m_perm[k]) += y(k);
+            m_refinement_steps++;
+        }
+    }
+
+    return m_sol.allFinite();
+}
+
+size_t ChSolverSparseSupernodal::GetFactorNonZeros() const {
+    size_t nnz = 0;
+    for (const auto& sn : m_snodes) {
+        size_t p = sn.ncols;
+        size_t r = sn.rows.size();
+        nnz += m_ldlt ? p * (p + 1) / 2 + p * r : p * p + 2 * p * r;
+    }
+    return nnz;
+}
+
+size_t ChSolverSparseSupernodal::GetFactorizationMemoryUsage() const {
+    if (!m_factorized)
+        return 0;
+    size_t mem = 0;
+    for (const auto& sn : m_snodes) {
+        mem += (size_t)(sn.L.size() + sn.U.size()) * sizeof(double);
+        mem += (sn.rows.size() + sn.rel.size() + sn.piv.size()) * sizeof(int);
+    }
+    return mem;
+}
+
+void ChSolverSparseSupernodal::PrintErrorMessage() {
+    if (m_mat.rows() != m_mat.cols())
+        std::cout << "the problem matrix is not square" << std::endl;
+    else if (!m_factorized)
+        std::cout << "numerical factorization failed, non-finite entries in the factors" << std::endl;
+    else
+        std::cout << "solution failed, non-finite entries in the solution vector" << std::endl;
+}
+
+}  // end namespace chrono
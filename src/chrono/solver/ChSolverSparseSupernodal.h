@@ -0,0 +1,157 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// In-tree multithreaded supernodal (multifrontal) sparse direct solver.
+//
+// =============================================================================
+
+#ifndef CH_SOLVER_SPARSE_SUPERNODAL_H
+#define CH_SOLVER_SPARSE_SUPERNODAL_H
+
+#include <vector>
+
+#include "chrono/solver/ChDirectSolverLS.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Sparse supernodal direct solver.\n
+/// In-tree multifrontal factorization, multithreaded with OpenMP and without external dependencies, intended as an
+/// alternative to the Pardiso MKL and MUMPS solvers when these are not available.\n
+/// Cannot handle VI and complementarity problems, so it cannot be used with NSC formulations.\n
+///
+/// The symbolic analysis computes a fill-reducing ordering of the matrix sparsity pattern (symmetrized if necessary),
+/// either a nested dissection ordering (recursive level-structure bisection, with approximate minimum degree ordering
+/// of the small subgraphs) or an approximate minimum degree ordering. The elimination tree is then postordered and
+/// consecutive columns with (nearly) identical structure are grouped in relaxed supernodes.
+///
+/// The numerical factorization processes one dense frontal matrix per supernode, using blocked dense kernels.
+/// Independent subtrees of the supernodal elimination tree are factorized in parallel; the remaining top supernodes,
+/// which include the largest fronts, are factorized afterwards with multithreaded dense kernels.
+///
+/// Symmetric positive definite matrices (see SetMatrixSymmetryType) are factorized as L*D*L'. All other matrices are
+/// factorized as L*U, with partial pivoting restricted to the fully summed rows of each front. Pivots that are too
+/// small are replaced by a small multiple of the largest matrix entry (static pivoting), in which case the solution is
+/// improved with iterative refinement (see SetRefinementParameters).
+///
+/// The symbolic analysis can be reused across factorizations (see ReuseSymbolicAnalysis).\n
+/// See ChDirectSolverLS for more details.
+class ChApi ChSolverSparseSupernodal : public ChDirectSolverLS {
+  public:
+    /// Fill-reducing ordering methods.
+    enum class Ordering {
+        AUTO,               ///< nested dissection, unless approximate minimum degree leads to much less work
+        NESTED_DISSECTION,  ///< nested dissection
+        AMD                 ///< approximate minimum degree
+    };
+
+    /// Construct a supernodal solver using the specified number of OpenMP threads.
+    /// If num_threads is not positive, the number of available processors is used.
+    ChSolverSparseSupernodal(int num_threads = 0);
+
+    ~ChSolverSparseSupernodal() {}
+
+    virtual Type GetType() const override { return Type::SPARSE_SUPERNODAL; }
+
+    /// Set the number of OpenMP threads used by the numerical factorization.
+    /// If num_threads is not positive, the number of available processors is used.
+    void SetNumThreads(int num_threads);
+
+    /// Set the fill-reducing ordering method (default: AUTO).
+    void SetOrdering(Ordering ordering) { m_ordering = ordering; }
+
+    /// Set the relative threshold for static pivoting (default: 1e-12).
+    /// Pivots smaller in magnitude than this value times the largest matrix entry are perturbed.
+    void SetPivotPerturbation(double threshold) { m_pivot_threshold = threshold; }
+
+    /// Return the number of supernodes in the current symbolic analysis.
+    int GetNumSupernodes() const { return (int)m_snodes.size(); }
+
+    /// Return the number of entries in the factors (including explicit zeros of relaxed supernodes).
+    size_t GetFactorNonZeros() const;
+
+    /// Return the number of pivots perturbed in the last factorization.
+    int GetNumPerturbedPivots() const { return m_num_perturbed; }
+
+    /// Return true if the last factorization was L*D*L' (and false if L*U).
+    bool IsSymmetricFactorization() const { return m_ldlt; }
+
+    /// Return the ordering method used in the current symbolic analysis (NESTED_DISSECTION or AMD).
+    Ordering GetOrderingUsed() const { return m_ordering_used; }
+
+  private:
+    /// Supernode of the elimination tree, with its dense factor panels.
+    struct Supernode {
+        int first;                  ///< first (permuted) column
+        int ncols;                  ///< number of columns
+        int parent;                 ///< parent supernode (-1 for a root)
+        int first_desc;             ///< first supernode in the subtree rooted at this supernode
+        int num_perturbed;          ///< number of perturbed pivots
+        std::vector<int> rows;      ///< (permuted) row structure below the supernode columns
+        std::vector<int> rel;       ///< locations of the rows in the front of the parent supernode
+        std::vector<int> children;  ///< children supernodes
+        std::vector<int> piv;       ///< local row interchanges (LU only)
+        Eigen::MatrixXd L;          ///< first columns of the factored front
+        Eigen::MatrixXd U;          ///< first rows of the factored front, right of the pivot block (LU only)
+        Eigen::MatrixXd C;          ///< contribution block, released after assembly in the parent front
+    };
+
+    /// Factorize the current sparse matrix and return true if successful.
+    virtual bool FactorizeMatrix() override;
+
+    /// Solve the linear system using the current factorization and right-hand side vector.
+    /// Load the solution vector (already of appropriate size) and return true if succesful.
+    virtual bool SolveSystem() override;
+
+    /// Display an error message corresponding to the last failure.
+    /// This function is only called if Factorize or Solve returned false.
+    virtual void PrintErrorMessage() override;
+
+    /// Return the memory used by the factor panels.
+    virtual size_t GetFactorizationMemoryUsage() const override;
+
+    /// Perform the symbolic analysis of the current matrix sparsity pattern.
+    void Analyze();
+
+    /// Assemble and factorize the front of the specified supernode.
+    void FactorizeSupernode(int s, double tol);
+
+    /// Solve with the current factors, overwriting the given vector (in permuted order) with the solution.
+    void SolveFactors(ChVectorDynamic<double>& y) const;
+
+    int m_num_threads;         ///< number of OpenMP threads
+    Ordering m_ordering;       ///< requested ordering method
+    Ordering m_ordering_used;  ///< ordering method of the current analysis
+    double m_pivot_threshold;  ///< relative threshold for static pivoting
+    bool m_ldlt;               ///< L*D*L' (true) or L*U (false) factorization
+    bool m_analyzed;           ///< is there a valid symbolic analysis?
+    bool m_factorized;         ///< is there a valid factorization?
+    int m_num_perturbed;       ///< number of perturbed pivots in the last factorization
+
+    std::vector<int> m_perm;              ///< fill-reducing permutation (new to old)
+    std::vector<Supernode> m_snodes;      ///< supernodes, in postorder
+    std::vector<int> m_subtrees;          ///< roots of the subtrees factorized in parallel
+    std::vector<int> m_top;               ///< supernodes factorized after the subtrees, in postorder
+    std::vector<int> m_asm_ptr;           ///< offsets of the supernode entries in the assembly lists
+    std::vector<int> m_asm_val;           ///< indices of matrix values assembled in the supernode fronts
+    std::vector<Eigen::Index> m_asm_pos;  ///< locations of the matrix values in the supernode fronts
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -12,12 +12,15 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <iomanip>
 
 #include "chrono/solver/ChSystemDescriptor.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
 #include "chrono/solver/ChConstraintTwoTuplesFrictionT.h"
 #include "chrono/core/ChMatrix.h"
+#include "chrono/utils/ChOpenMP.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -27,7 +30,17 @@ CH_FACTORY_REGISTER(ChSystemDescriptor)
 
 #define CH_SPINLOCK_HASHSIZE 203
 
-ChSystemDescriptor::ChSystemDescriptor() : n_q(0), n_c(0), c_a(1.0), freeze_count(false) {
+ChSystemDescriptor::ChSystemDescriptor()
+    : c_a(1.0),
+      m_topology_revision(0),
+      m_nthreads(1),
+      m_parallel_schur(false),
+      m_deterministic(false),
+      n_q(0),
+      n_c(0),
+      freeze_count(false),
+      m_topology_signature({0, 0, 0, 0, 0}) {
+    m_matrix_map.revision = 0;
     m_constraints.clear();
     m_variables.clear();
     m_KRMblocks.clear();
@@ -60,6 +73,21 @@ void ChSystemDescriptor::ComputeFeasabilityViolation(double& resulting_maxviolat
     }
 }
 
+size_t ChSystemDescriptor::GetMemoryUsage() const {
+    size_t mem = m_variables.capacity() * sizeof(ChVariables*) + m_constraints.capacity() * sizeof(ChConstraint*) +
+                 m_KRMblocks.capacity() * sizeof(ChKRMBlock*);
+
+    for (const auto& block : m_KRMblocks)
+        mem += block->GetMemoryUsage();
+
+    for (const auto& buffer : m_thread_buffers)
+        mem += buffer.size() * sizeof(double);
+
+    mem += m_matrix_map.start.capacity() * sizeof(size_t) + m_matrix_map.index.capacity() * sizeof(int);
+
+    return mem;
+}
+
 unsigned int ChSystemDescriptor::CountActiveVariables() const {
     if (freeze_count)  // optimization, avoid list count all times
         return n_q;
@@ -93,6 +121,13 @@ void ChSystemDescriptor::UpdateCountsAndOffsets() {
     CountActiveVariables();
     CountActiveConstraints();
     freeze_count = true;
+
+    // Check if the problem structure changed since last call
+    TopologySignature signature = {m_variables.size(), m_constraints.size(), m_KRMblocks.size(), n_q, n_c};
+    if (!(signature == m_topology_signature)) {
+        m_topology_signature = signature;
+        m_topology_revision++;
+    }
 }
 
 void ChSystemDescriptor::PasteMassKRMMatrixInto(ChSparseMatrix& Z,
@@ -181,6 +216,178 @@ void ChSystemDescriptor::BuildSystemMatrix(ChSparseMatrix* Z, ChVectorDynamic<>*
     }
 }
 
+// Sparse matrix recording the positions of the entries set through SetElement, without storing any value.
+class ChSparseEntryRecorder : public ChSparseMatrix {
+  public:
+    virtual void SetElement(int row, int col, double val, bool overwrite = true) override {
+        entries.push_back(std::make_pair(row, col));
+    }
+
+    std::vector<std::pair<int, int>> entries;
+};
+
+// Sparse matrix writing the values set through SetElement directly in the values array of another (compressed) matrix,
+// at a precomputed sequence of positions. The row and column of each entry are checked against those of the position
+// it is written to, so that entries moved by a change of connectivity are detected. Summed values are added atomically.
+class ChSparseValueWriter : public ChSparseMatrix {
+  public:
+    ChSparseValueWriter(double* values, const int* inner)
+        : m_values(values), m_inner(inner), m_next(nullptr), m_end(nullptr), m_row(nullptr), m_failed(false) {}
+
+    void Reset(const int* begin, const int* end, const int* rows) {
+        m_next = begin;
+        m_end = end;
+        m_row = rows;
+        m_failed = false;
+    }
+
+    // Return true if exactly the expected entries were written since the last reset.
+    bool Completed() const { return !m_failed && m_next == m_end; }
+
+    virtual void SetElement(int row, int col, double val, bool overwrite = true) override {
+        if (m_next == m_end || *m_row != row || m_inner[*m_next] != col) {
+            m_failed = true;
+            return;
+        }
+        m_row++;
+        double& dst = m_values[*m_next++];
+        if (overwrite) {
+            dst = val;
+        } else {
+#pragma omp atomic
+            dst += val;
+        }
+    }
+
+  private:
+    double* m_values;
+    const int* m_inner;
+    const int* m_next;
+    const int* m_end;
+    const int* m_row;
+    bool m_failed;
+};
+
+void ChSystemDescriptor::PasteItemInto(size_t i, ChSparseMatrix& Z) const {
+    if (i < m_variables.size()) {
+        if (m_variables[i]->IsActive())
+            m_variables[i]->PasteMassInto(Z, 0, 0, c_a);
+        return;
+    }
+    i -= m_variables.size();
+
+    if (i < m_KRMblocks.size()) {
+        m_KRMblocks[i]->PasteMatrixInto(Z, 0, 0, false);
+        return;
+    }
+    i -= m_KRMblocks.size();
+
+    const auto constr = m_constraints[i];
+    if (constr->IsActive()) {
+        unsigned int row = n_q + constr->GetOffset();
+        constr->PasteJacobianInto(Z, row, 0);
+        constr->PasteJacobianTransposedInto(Z, 0, row);
+        Z.SetElement(row, row, constr->GetComplianceTerm());
+    }
+}
+
+bool ChSystemDescriptor::UpdateSystemMatrixMap(const ChSparseMatrix& Z) const {
+    size_t num_items = m_variables.size() + m_KRMblocks.size() + m_constraints.size();
+    const int* outer = Z.outerIndexPtr();
+    const int* inner = Z.innerIndexPtr();
+
+    m_matrix_map.start.assign(1, 0);
+    m_matrix_map.index.clear();
+    m_matrix_map.row.clear();
+
+    ChSparseEntryRecorder recorder;
+    for (size_t i = 0; i < num_items; i++) {
+        recorder.entries.clear();
+        PasteItemInto(i, recorder);
+        for (const auto& entry : recorder.entries) {
+            // Column indices are sorted within each row of a compressed matrix
+            const int* first = inner + outer[entry.first];
+            const int* last = inner + outer[entry.first + 1];
+            const int* pos = std::lower_bound(first, last, entry.second);
+            if (pos == last || *pos != entry.second) {
+                m_matrix_map.start.clear();
+                return false;
+            }
+            m_matrix_map.index.push_back(static_cast<int>(pos - inner));
+            m_matrix_map.row.push_back(entry.first);
+        }
+        m_matrix_map.start.push_back(m_matrix_map.index.size());
+    }
+
+    m_matrix_map.revision = m_topology_revision;
+    return true;
+}
+
+bool ChSystemDescriptor::BuildSystemMatrixInPlace(ChSparseMatrix& Z, bool update_map) const {
+    n_q = CountActiveVariables();
+    n_c = CountActiveConstraints();
+
+    if (!Z.isCompressed() || Z.rows() != n_q + n_c || Z.cols() != n_q + n_c)
+        return false;
+
+    int num_vars = (int)m_variables.size();
+    int num_krm = (int)m_KRMblocks.size();
+    int num_items = (int)(m_variables.size() + m_KRMblocks.size() + m_constraints.size());
+    if (update_map || m_matrix_map.revision != m_topology_revision ||
+        m_matrix_map.start.size() != (size_t)num_items + 1) {
+        if (!UpdateSystemMatrixMap(Z))
+            return false;
+    }
+
+    double* values = Z.valuePtr();
+    std::fill(values, values + Z.nonZeros(), 0.0);
+
+    const int* index = m_matrix_map.index.data();
+    const int* row = m_matrix_map.row.data();
+    const size_t* start = m_matrix_map.start.data();
+    bool completed = true;
+
+    // Masses are pasted first, since they are overwritten; the diagonal blocks of the variables are disjoint.
+    // KRM blocks are summed (atomically) to the masses, while constraints write disjoint rows and columns.
+    // In deterministic mode, the KRM blocks are summed by a single thread, in a fixed order.
+#pragma omp parallel num_threads(m_nthreads) reduction(&& : completed)
+    {
+        ChSparseValueWriter writer(values, Z.innerIndexPtr());
+        auto paste = [&](int i) {
+            writer.Reset(index + start[i], index + start[i + 1], row + start[i]);
+            PasteItemInto(i, writer);
+            completed = completed && writer.Completed();
+        };
+
+#pragma omp for schedule(dynamic, 64)
+        for (int i = 0; i < num_vars; i++)
+            paste(i);
+
+        if (m_deterministic) {
+#pragma omp single nowait
+            for (int i = num_vars; i < num_vars + num_krm; i++)
+                paste(i);
+        } else {
+#pragma omp for schedule(dynamic, 16) nowait
+            for (int i = num_vars; i < num_vars + num_krm; i++)
+                paste(i);
+        }
+
+#pragma omp for schedule(dynamic, 16)
+        for (int i = num_vars + num_krm; i < num_items; i++)
+            paste(i);
+    }
+
+    // The items wrote different entries than at map construction (e.g., a constraint or KRM block now connecting
+    // different variables with the same number of entries, which does not change the topology revision)
+    if (!completed) {
+        m_matrix_map.start.clear();
+        return false;
+    }
+
+    return true;
+}
+
 unsigned int ChSystemDescriptor::BuildFbVector(ChVectorDynamic<>& Fvector, unsigned int start_row) const {
     n_q = CountActiveVariables();
     Fvector.setZero(n_q);
@@ -369,6 +576,88 @@ unsigned int ChSystemDescriptor::FromVectorToUnknowns(const ChVectorDynamic<>& m
     return n_q + n_c;
 }
 
+// Sparse matrix proxy which, instead of storing Jacobian entries, records the active variables a constraint acts upon.
+// A constraint pastes its Jacobian blocks only for active variables (see ChConstraintTuple), so this provides a generic
+// way of extracting the constraint-variable connectivity, independent of the constraint type.
+class ChConstraintVariablesRecorder : public ChSparseMatrix {
+  public:
+    ChConstraintVariablesRecorder(const std::vector<int>& col_to_var, std::vector<int>& vars)
+        : ChSparseMatrix(1, (int)col_to_var.size()), m_col_to_var(col_to_var), m_vars(vars), m_start(0) {}
+
+    void Start() { m_start = m_vars.size(); }
+
+    virtual void SetElement(int row, int col, double val, bool overwrite = true) override {
+        int var = m_col_to_var[col];
+        if (std::find(m_vars.begin() + m_start, m_vars.end(), var) == m_vars.end())
+            m_vars.push_back(var);
+    }
+
+  private:
+    const std::vector<int>& m_col_to_var;
+    std::vector<int>& m_vars;
+    size_t m_start;
+};
+
+void ChSystemDescriptor::ComputeConstraintConnectivity(std::vector<int>& var_start, std::vector<int>& var_index) const {
+    // Map each column of the constraint Jacobian to the index of the corresponding active variable
+    std::vector<int> col_to_var(n_q, -1);
+    for (int iv = 0; iv < (int)m_variables.size(); iv++) {
+        auto var = m_variables[iv];
+        if (var->IsActive())
+            std::fill(col_to_var.begin() + var->GetOffset(), col_to_var.begin() + var->GetOffset() + var->GetDOF(), iv);
+    }
+
+    var_start.resize(m_constraints.size() + 1);
+    var_index.clear();
+    ChConstraintVariablesRecorder recorder(col_to_var, var_index);
+
+    for (size_t ic = 0; ic < m_constraints.size(); ic++) {
+        var_start[ic] = (int)var_index.size();
+        if (m_constraints[ic]->IsActive()) {
+            recorder.Start();
+            m_constraints[ic]->PasteJacobianInto(recorder, 0, 0);
+        }
+    }
+    var_start[m_constraints.size()] = (int)var_index.size();
+}
+
+void ChSystemDescriptor::ComputeBlockPartition(std::vector<int>& block_start) const {
+    block_start.clear();
+
+    // One block per active variable object
+    for (const auto& var : m_variables) {
+        if (var->IsActive() && var->GetDOF() > 0)
+            block_start.push_back(var->GetOffset());
+    }
+
+    // Groups of consecutive constraints acting on the same variables
+    std::vector<int> var_start;
+    std::vector<int> var_index;
+    ComputeConstraintConnectivity(var_start, var_index);
+    for (size_t ic = 0; ic < m_constraints.size(); ic++)
+        std::sort(var_index.begin() + var_start[ic], var_index.begin() + var_start[ic + 1]);
+
+    int group_size = 0;
+    size_t group_first = 0;
+    for (size_t ic = 0; ic < m_constraints.size(); ic++) {
+        if (!m_constraints[ic]->IsActive())
+            continue;
+        bool same_vars = group_size > 0 && group_size < 6 &&
+                         std::equal(var_index.begin() + var_start[ic], var_index.begin() + var_start[ic + 1],
+                                    var_index.begin() + var_start[group_first],
+                                    var_index.begin() + var_start[group_first + 1]);
+        if (same_vars) {
+            group_size++;
+        } else {
+            block_start.push_back(n_q + m_constraints[ic]->GetOffset());
+            group_first = ic;
+            group_size = 1;
+        }
+    }
+
+    block_start.push_back(n_q + n_c);
+}
+
 void ChSystemDescriptor::SchurComplementProduct(ChVectorDynamic<>& result,
                                                 const ChVectorDynamic<>& lvector,
                                                 std::vector<bool>* enabled) {
@@ -376,6 +665,11 @@ void ChSystemDescriptor::SchurComplementProduct(ChVectorDynamic<>& result,
     assert(m_KRMblocks.size() == 0);
     assert(lvector.size() == CountActiveConstraints());
 
+    if (m_parallel_schur && !m_deterministic) {
+        SchurComplementProductParallel(result, lvector, enabled);
+        return;
+    }
+
     result.setZero(n_c);
 
     // Performs the sparse product    result = [N]*l = [ [Cq][M^(-1)][Cq'] - [E] ] *l
@@ -428,6 +722,89 @@ void ChSystemDescriptor::SchurComplementProduct(ChVectorDynamic<>& result,
     }
 }
 
+void ChSystemDescriptor::SchurComplementProductParallel(ChVectorDynamic<>& result,
+                                                        const ChVectorDynamic<>& lvector,
+                                                        std::vector<bool>* enabled) {
+    int nthreads = m_nthreads;
+    int num_constraints = (int)m_constraints.size();
+    int num_variables = (int)m_variables.size();
+    int num_coords = (int)n_q;
+
+    result.setZero(n_c);
+    m_thread_buffers.resize(nthreads);
+
+#pragma omp parallel num_threads(nthreads) if (nthreads > 1)
+    {
+        // The team may have fewer threads than requested (e.g., nested regions or a thread limit), in which case only
+        // the buffers of the threads in the team are initialized and reduced.
+        int num_threads = ChOMP::GetNumThreads();
+        ChVectorDynamic<>& buffer = m_thread_buffers[ChOMP::GetThreadNum()];
+        buffer.setZero(num_coords);
+
+        // 1 - accumulate  f = [Cq']*l  in per-thread buffers, iterating over constraints.
+        //     Also, begin to add the cfm term ( -[E]*l ) to the result.
+        //     Here and below, the barriers are placed outside the traced scopes, so that idle times appear as gaps.
+        {
+            CH_TRACE("SchurProduct::JacobianTransposed");
+#pragma omp for schedule(static) nowait
+            for (int ic = 0; ic < num_constraints; ic++) {
+                ChConstraint* constr = m_constraints[ic];
+                if (constr->IsActive()) {
+                    int s_c = constr->GetOffset();
+                    if (!enabled || (*enabled)[s_c]) {
+                        double li = lvector(s_c);
+                        constr->AddJacobianTransposedTimesScalarInto(buffer, li);
+                        result(s_c) = constr->GetComplianceTerm() * li;
+                    }
+                }
+            }
+        }
+#pragma omp barrier
+
+        // 2 - reduce the per-thread buffers into the first one
+        if (num_threads > 1) {
+            {
+                CH_TRACE("SchurProduct::Reduction");
+#pragma omp for schedule(static) nowait
+                for (int i = 0; i < num_coords; i++) {
+                    for (int t = 1; t < num_threads; t++)
+                        m_thread_buffers[0](i) += m_thread_buffers[t](i);
+                }
+            }
+#pragma omp barrier
+        }
+
+        // 3 - performs    qb=[M^(-1)]*f    by iterating over variables
+        {
+            CH_TRACE("SchurProduct::MassInverse");
+#pragma omp for schedule(static) nowait
+            for (int iv = 0; iv < num_variables; iv++) {
+                ChVariables* var = m_variables[iv];
+                if (var->IsActive())
+                    var->ComputeMassInverseTimesVector(var->State(),
+                                                       m_thread_buffers[0].segment(var->GetOffset(), var->GetDOF()));
+            }
+        }
+#pragma omp barrier
+
+        // 4 - performs    result=[Cq']*qb    by iterating over constraints
+        {
+            CH_TRACE("SchurProduct::Jacobian");
+#pragma omp for schedule(static) nowait
+            for (int ic = 0; ic < num_constraints; ic++) {
+                ChConstraint* constr = m_constraints[ic];
+                if (constr->IsActive()) {
+                    int s_c = constr->GetOffset();
+                    if (!enabled || (*enabled)[s_c])
+                        result(s_c) += constr->ComputeJacobianTimesState();
+                    else
+                        result(s_c) = 0;
+                }
+            }
+        }
+    }
+}
+
 void ChSystemDescriptor::SystemProduct(ChVectorDynamic<>& result, const ChVectorDynamic<>& x) {
     n_q = CountActiveVariables();
     n_c = CountActiveConstraints();
@@ -118,8 +118,65 @@ class ChApi ChSystemDescriptor {
     virtual unsigned int CountActiveConstraints() const;
 
     /// Update counts of scalar variables and scalar constraints.
+    /// This also updates the topology revision counter if the problem structure changed.
     virtual void UpdateCountsAndOffsets();
 
+    /// Get the current topology revision of the problem.
+    /// This counter is incremented every time a change in the structure of the problem is detected (i.e., a change in
+    /// the number of inserted variables, constraints, or KRM blocks, or in the number of active scalar variables or
+    /// constraints). Clients (e.g., direct sparse solvers) can cache data that depends only on the problem structure
+    /// (such as the matrix sparsity pattern and its symbolic factorization) and invalidate it on revision changes.
+    unsigned int GetTopologyRevision() const { return m_topology_revision; }
+
+    /// Explicitly increment the topology revision counter.
+    /// Use this to signal a structural change that is not detected automatically (e.g., a change in the connectivity of
+    /// existing constraints or KRM blocks).
+    void IncrementTopologyRevision() { m_topology_revision++; }
+
+    /// Compute the connectivity between constraints and variables.
+    /// For each constraint in the descriptor, collect the indices (in the list of variables) of the active variables
+    /// the constraint acts upon. The result is returned in compressed format: the variables of the i-th constraint are
+    /// var_index[var_start[i]], ..., var_index[var_start[i+1]-1]. Inactive constraints have no associated variables.
+    /// The variable offsets must be up to date (see UpdateCountsAndOffsets).
+    void ComputeConstraintConnectivity(std::vector<int>& var_start, std::vector<int>& var_index) const;
+
+    /// Compute a block partition of the unknowns, for the block-sparse format of the system matrix.
+    /// Each active variable object defines one block (e.g., 6 unknowns for a rigid body, 3 for an FEA node). Active
+    /// constraints define blocks of up to 6 consecutive constraints acting on the same variables (e.g., the equations
+    /// of a joint). On return, block i spans the unknowns block_start[i], ..., block_start[i+1]-1.
+    /// The variable and constraint offsets must be up to date (see UpdateCountsAndOffsets).
+    void ComputeBlockPartition(std::vector<int>& block_start) const;
+
+    /// Set the number of OpenMP threads used in the parallel descriptor operations (default: 1).
+    /// If the descriptor is attached to a ChSystem, this is set to the number of Chrono threads of that system.
+    void SetNumThreads(int nthreads) { m_nthreads = (nthreads < 1) ? 1 : nthreads; }
+
+    /// Get the number of OpenMP threads used in the parallel descriptor operations.
+    int GetNumThreads() const { return m_nthreads; }
+
+    /// Enable/disable deterministic parallel operations (default: false).
+    /// If enabled, KRM blocks are summed sequentially (in a fixed order) into the system matrix and the sequential
+    /// implementation of SchurComplementProduct() is always used, so that results do not depend on the number of
+    /// threads. If the descriptor is attached to a ChSystem, this is set from ChSystem::EnableDeterministic.
+    void SetDeterministic(bool val) { m_deterministic = val; }
+
+    /// Return true if deterministic parallel operations are enabled.
+    bool IsDeterministic() const { return m_deterministic; }
+
+    /// Return an estimate of the memory (in bytes) used by the descriptor.
+    /// This includes the lists of variables, constraints, and KRM blocks, the matrices of the registered KRM blocks,
+    /// and the internal work buffers.
+    virtual size_t GetMemoryUsage() const;
+
+    /// Enable the parallel implementation of SchurComplementProduct() (default: false).
+    /// If enabled, the product is evaluated in two phases: a constraint-parallel accumulation of [Cq']*l in per-thread
+    /// buffers, followed by a variable-parallel application of [M^(-1)]. Results differ from those of the sequential
+    /// implementation only by round-off, due to the different summation order.
+    void EnableParallelSchurComplementProduct(bool val) { m_parallel_schur = val; }
+
+    /// Return true if the parallel implementation of SchurComplementProduct() is enabled.
+    bool IsParallelSchurComplementProductEnabled() const { return m_parallel_schur; }
+
     /// Set the c_a coefficient (default=1) used for scaling the M masses of the m_variables.
     /// Used when performing SchurComplementProduct(), SystemProduct(), BuildSystemMatrix().
     virtual void SetMassFactor(const double mc_a) { c_a = mc_a; }
@@ -321,6 +378,19 @@ class ChApi ChSystemDescriptor {
                                    ChVectorDynamic<>* rhs  ///< [out] assembled RHS vector
     ) const;
 
+    /// Assemble the system matrix in place, in the existing sparsity pattern of the compressed matrix Z.
+    /// The position in the values array of Z of each entry written by the variables, KRM blocks, and constraints is
+    /// computed once and cached (it is recomputed if 'update_map' is true or if the topology revision changed). All
+    /// items then write their values directly at these positions, in parallel and without searching the sparse storage;
+    /// overlapping KRM block contributions are summed atomically. The row and column of each written entry are checked
+    /// against the cached position, so that items connecting different variables than at map construction are detected.
+    /// Return false if Z is not compressed, does not have the problem size, does not contain all entries of the problem
+    /// in its sparsity pattern, or if the entries do not match the cached positions; in that case, BuildSystemMatrix
+    /// must be used instead (and the map is recomputed at the next call).
+    bool BuildSystemMatrixInPlace(ChSparseMatrix& Z,  ///< [in,out] compressed system matrix
+                                  bool update_map     ///< force a recomputation of the cached value positions
+    ) const;
+
     /// Write the current system matrix blocks and right-hand side components.
     /// The system matrix is formed by calling BuildSystemMatrix() as used with direct linear solvers.
     /// The following files are written in the directory specified by [path]:
@@ -371,10 +441,56 @@ class ChApi ChSystemDescriptor {
 
     double c_a;  ///< coefficient form M mass matrices in m_variables
 
+    unsigned int m_topology_revision;  ///< counter of detected changes in the problem structure
+
+    int m_nthreads;         ///< number of OpenMP threads for parallel operations
+    bool m_parallel_schur;  ///< use parallel implementation of SchurComplementProduct
+    bool m_deterministic;   ///< use fixed-order reductions in parallel operations
+
   private:
+    /// Positions of the entries of all items (variables, KRM blocks, constraints) in the values of a sparse matrix.
+    /// The positions of the entries of the i-th item are index[start[i]], ..., index[start[i+1]-1].
+    struct SystemMatrixMap {
+        std::vector<size_t> start;  ///< start of the entries of each item
+        std::vector<int> index;     ///< position of each entry in the values array
+        std::vector<int> row;       ///< row of each entry (the column is given by the sparsity pattern)
+        unsigned int revision;      ///< topology revision at map construction
+    };
+
+    /// Paste the contribution of the i-th item (in the order: variables, KRM blocks, constraints) into Z.
+    void PasteItemInto(size_t i, ChSparseMatrix& Z) const;
+
+    /// Compute the positions of the entries of all items in the values of the compressed matrix Z.
+    /// Return false if some entry is not in the sparsity pattern of Z.
+    bool UpdateSystemMatrixMap(const ChSparseMatrix& Z) const;
+
+    /// Parallel implementation of SchurComplementProduct().
+    void SchurComplementProductParallel(ChVectorDynamic<>& result,
+                                        const ChVectorDynamic<>& lvector,
+                                        std::vector<bool>* enabled);
+
+    /// Signature of the problem structure, used to detect topology changes.
+    struct TopologySignature {
+        size_t num_variables;
+        size_t num_constraints;
+        size_t num_KRMblocks;
+        unsigned int n_q;
+        unsigned int n_c;
+        bool operator==(const TopologySignature& other) const {
+            return num_variables == other.num_variables && num_constraints == other.num_constraints &&
+                   num_KRMblocks == other.num_KRMblocks && n_q == other.n_q && n_c == other.n_c;
+        }
+    };
+
     mutable unsigned int n_q;  ///< number of active variables
     mutable unsigned int n_c;  ///< number of active constraints
     bool freeze_count;         ///< cache the number of active variables and constraints
+
+    TopologySignature m_topology_signature;  ///< structure signature at last topology revision
+
+    std::vector<ChVectorDynamic<>> m_thread_buffers;  ///< per-thread accumulation buffers
+
+    mutable SystemMatrixMap m_matrix_map;  ///< cached positions of the system matrix entries
 };
 
 CH_CLASS_VERSION(ChSystemDescriptor, 0)
@@ -17,12 +17,52 @@
 
 namespace chrono {
 
+// Minimum reduction of the constraint violation in one iteration with a reused factorization
+static const double ASSEMBLY_CONTRACTION_RATIO = 0.5;
+
 ChAssemblyAnalysis::ChAssemblyAnalysis(ChIntegrableIIorder& mintegrable) {
     integrable = &mintegrable;
     X.setZero(1, &mintegrable);
     V.setZero(1, &mintegrable);
     A.setZero(1, &mintegrable);
     max_assembly_iters = 4;
+    m_tolerance = 1e-10;
+    m_reuse_factorization = false;
+    m_cache_hit = false;
+    m_num_iterations = 0;
+    m_num_setups = 0;
+    m_violation = 0;
+}
+
+// The key combines the problem sizes, the requested assembly levels, and all data of the unassembled problem:
+// states, constraint violations, applied forces, and masses (through M*1), as well as the user parameter key.
+uint64_t ChAssemblyAnalysis::ComputeCacheKey(int action) {
+    double T;
+    integrable->StateGather(X, V, T);
+
+    ChVectorDynamic<> Qc(integrable->GetNumConstraints());
+    Qc.setZero();
+    integrable->LoadConstraint_C(Qc, 1.0);
+
+    ChVectorDynamic<> F(integrable->GetNumCoordsVelLevel());
+    F.setZero();
+    integrable->LoadResidual_F(F, 1.0);
+
+    ChVectorDynamic<> M1(integrable->GetNumCoordsVelLevel());
+    M1.setZero();
+    integrable->LoadResidual_Mv(M1, ChVectorDynamic<>::Ones(M1.size()), 1.0);
+
+    uint64_t sizes[4] = {(uint64_t)action, (uint64_t)X.size(), (uint64_t)V.size(), (uint64_t)Qc.size()};
+    uint64_t parameter_key = m_cache->GetParameterKey();
+    uint64_t key = ChAssemblyCache::Hash(sizes, sizeof(sizes));
+    key = ChAssemblyCache::Hash(X.data(), X.size() * sizeof(double), key);
+    key = ChAssemblyCache::Hash(V.data(), V.size() * sizeof(double), key);
+    key = ChAssemblyCache::Hash(Qc.data(), Qc.size() * sizeof(double), key);
+    key = ChAssemblyCache::Hash(F.data(), F.size() * sizeof(double), key);
+    key = ChAssemblyCache::Hash(M1.data(), M1.size() * sizeof(double), key);
+    key = ChAssemblyCache::Hash(&parameter_key, sizeof(parameter_key), key);
+
+    return key;
 }
 
 void ChAssemblyAnalysis::AssemblyAnalysis(int action, double dt) {
@@ -33,10 +73,38 @@ void ChAssemblyAnalysis::AssemblyAnalysis(int action, double dt) {
     // Set up main vectors
     integrable->StateSetup(X, V, A);
 
+    m_cache_hit = false;
+    m_num_iterations = 0;
+    m_num_setups = 0;
+    m_violation = 0;
+
+    // If a cache is attached, look for the result of an identical assembly problem
+    uint64_t key = 0;
+    if (m_cache) {
+        key = ComputeCacheKey(action);
+        ChAssemblyCache::Entry entry;
+        if (m_cache->Find(key, entry) && entry.action == action && entry.X.size() == X.size() &&
+            entry.V.size() == V.size() && entry.A.size() == (action & AssemblyLevel::ACCELERATION ? V.size() : 0)) {
+            integrable->StateGather(X, V, T);
+            X = entry.X;
+            V = entry.V;
+            integrable->StateScatter(X, V, T, true);
+            if (action & AssemblyLevel::ACCELERATION) {
+                A = entry.A;
+                L = entry.L;
+                integrable->StateScatterAcceleration(A);
+                integrable->StateScatterReactions(L);
+            }
+            m_cache_hit = true;
+            return;
+        }
+    }
+
     if (action & AssemblyLevel::POSITION) {
         ChStateDelta Dx;
+        double violation_prev = 0;
 
-        for (unsigned int m_iter = 0; m_iter < max_assembly_iters; m_iter++) {
+        while (true) {
             // Set up auxiliary vectors
             Dx.setZero(integrable->GetNumCoordsVelLevel(), GetIntegrable());
             R.setZero(integrable->GetNumCoordsVelLevel());
@@ -45,12 +113,21 @@ void ChAssemblyAnalysis::AssemblyAnalysis(int action, double dt) {
 
             integrable->StateGather(X, V, T);  // state <- system
 
+            integrable->LoadConstraint_C(Qc, 1.0);  // sign flipped later in StateSolveCorrection
+
+            m_violation = Qc.size() > 0 ? Qc.lpNorm<Eigen::Infinity>() : 0.0;
+            if (m_violation <= m_tolerance || m_num_iterations >= (int)max_assembly_iters)
+                break;
+
             // Solve:
             //
             // [M          Cq' ] [ dx  ] = [  0]
             // [ Cq        0   ] [ -l  ] = [ -C]
+            //
+            // A reused factorization is recomputed if the last correction did not reduce the violation enough.
 
-            integrable->LoadConstraint_C(Qc, 1.0);  // sign flipped later in StateSolveCorrection
+            bool setup = !m_reuse_factorization || m_num_setups == 0 ||
+                         m_violation > ASSEMBLY_CONTRACTION_RATIO * violation_prev;
 
             integrable->StateSolveCorrection(Dx, L, R, Qc,
                                              1.0,      // factor for  M
@@ -59,9 +136,14 @@ void ChAssemblyAnalysis::AssemblyAnalysis(int action, double dt) {
                                              X, V, T,  // not needed
                                              false,    // do not scatter Xnew Vnew T+dt before computing correction
                                              false,    // full update? (not used, since no scatter)
-                                             true      // force a call to the solver's Setup function
+                                             setup     // call the solver's Setup function?
             );
 
+            if (setup)
+                m_num_setups++;
+            m_num_iterations++;
+            violation_prev = m_violation;
+
             X += Dx;
 
             integrable->StateScatter(X, V, T, true);  // state -> system
@@ -106,12 +188,27 @@ void ChAssemblyAnalysis::AssemblyAnalysis(int action, double dt) {
         L *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of L
 
         if (action & AssemblyLevel::ACCELERATION) {
-            integrable->StateScatterAcceleration(
-                (V - Vold) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
+            // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
+            A = (V - Vold) * (1 / dt);
+            integrable->StateScatterAcceleration(A);
 
             integrable->StateScatterReactions(L);  // -> system auxiliary data
         }
     }
+
+    // Store the assembled configuration
+    if (m_cache) {
+        ChAssemblyCache::Entry entry;
+        entry.action = action;
+        integrable->StateGather(X, V, T);
+        entry.X = X;
+        entry.V = V;
+        if (action & AssemblyLevel::ACCELERATION) {
+            entry.A = A;
+            entry.L = L;
+        }
+        m_cache->Insert(key, entry);
+    }
 }
 
 }  // end namespace chrono
\ No newline at end of file
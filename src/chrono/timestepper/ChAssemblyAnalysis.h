@@ -15,9 +15,12 @@
 #ifndef CHASSEMBLYANALYSIS_H
 #define CHASSEMBLYANALYSIS_H
 
+#include <memory>
+
 #include "chrono/core/ChApiCE.h"
 #include "chrono/timestepper/ChState.h"
 #include "chrono/timestepper/ChIntegrable.h"
+#include "chrono/timestepper/ChAssemblyCache.h"
 
 namespace chrono {
 
@@ -36,6 +39,10 @@ enum Enum {
 /// Assembly at position level involves solving a non-linear problem. Assembly at velocity level is
 /// performed by taking a small integration step. Consistent accelerations are obtained through
 /// finite differencing.
+/// Each position correction is the mass-weighted projection of the current configuration onto the constraint
+/// manifold, obtained from the saddle-point system [M Cq'; Cq 0]. Optionally, the factorization of this matrix is
+/// reused across iterations (the constraint Jacobian of the first iteration is kept in the Newton matrix) and only
+/// recomputed if the constraint violation is not reduced fast enough.
 class ChApi ChAssemblyAnalysis {
   public:
     ChAssemblyAnalysis(ChIntegrableIIorder& mintegrable);
@@ -55,6 +62,30 @@ class ChApi ChAssemblyAnalysis {
     /// Get the max number of Newton-Raphson iterations for the position assembly procedure.
     int GetMaxAssemblyIters() { return max_assembly_iters; }
 
+    /// Set the tolerance on the constraint violation (infinity norm) for the position assembly procedure.
+    /// Iterations stop as soon as the violation is below this value (default: 1e-10).
+    void SetTolerance(double tol) { m_tolerance = tol; }
+
+    /// Enable/disable reuse of the factorization across the position assembly iterations (default: false).
+    /// The factorization is recomputed whenever an iteration does not halve the constraint violation.
+    void SetReuseFactorization(bool val) { m_reuse_factorization = val; }
+
+    /// Attach a cache of assembled configurations (default: none).
+    /// See ChAssemblyCache for the data identifying an assembly problem.
+    void SetCache(std::shared_ptr<ChAssemblyCache> cache) { m_cache = cache; }
+
+    /// Return true if the last analysis was resolved from the attached cache.
+    bool IsCacheHit() const { return m_cache_hit; }
+
+    /// Return the number of position corrections performed in the last analysis.
+    int GetNumIterations() const { return m_num_iterations; }
+
+    /// Return the number of factorizations performed for the position corrections in the last analysis.
+    int GetNumFactorizations() const { return m_num_setups; }
+
+    /// Return the constraint violation (infinity norm) at the end of the position assembly procedure.
+    double GetConstraintViolation() const { return m_violation; }
+
     /// Get the integrable object.
     ChIntegrable* GetIntegrable() { return integrable; }
 
@@ -71,6 +102,9 @@ class ChApi ChAssemblyAnalysis {
     const ChStateDelta& GetStateAcc() const { return A; }
 
   private:
+    /// Compute the cache key of the current assembly problem.
+    uint64_t ComputeCacheKey(int action);
+
     ChIntegrableIIorder* integrable;
 
     ChState X;
@@ -78,6 +112,14 @@ class ChApi ChAssemblyAnalysis {
     ChStateDelta A;
     ChVectorDynamic<> L;
     unsigned int max_assembly_iters;
+
+    double m_tolerance;
+    bool m_reuse_factorization;
+    std::shared_ptr<ChAssemblyCache> m_cache;
+    bool m_cache_hit;
+    int m_num_iterations;
+    int m_num_setups;
+    double m_violation;
 };
 
 }  // end namespace chrono
@@ -0,0 +1,150 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "chrono/timestepper/ChAssemblyCache.h"
+
+namespace chrono {
+
+// Cache file: header followed by the entries, each with a fixed-size entry header and its state vectors.
+struct AssemblyCacheHeader {
+    char magic[8];         // "CHASMBL1"
+    uint64_t num_entries;  // number of cached configurations
+};
+
+struct AssemblyCacheEntryHeader {
+    uint64_t key;
+    int64_t action;
+    uint64_t size_X;
+    uint64_t size_V;
+    uint64_t size_A;
+    uint64_t size_L;
+};
+
+static const char assembly_cache_magic[8] = {'C', 'H', 'A', 'S', 'M', 'B', 'L', '1'};
+
+ChAssemblyCache::ChAssemblyCache() : m_parameter_key(0), m_num_hits(0), m_num_misses(0) {}
+
+bool ChAssemblyCache::Find(uint64_t key, Entry& entry) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+        m_num_misses++;
+        return false;
+    }
+    m_num_hits++;
+    entry = it->second;
+    return true;
+}
+
+void ChAssemblyCache::Insert(uint64_t key, const Entry& entry) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries[key] = entry;
+}
+
+void ChAssemblyCache::Clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_num_hits = 0;
+    m_num_misses = 0;
+}
+
+size_t ChAssemblyCache::GetNumEntries() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+uint64_t ChAssemblyCache::Hash(const void* data, size_t size, uint64_t hash) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static void WriteVector(std::ofstream& ofile, const ChVectorDynamic<>& v) {
+    ofile.write(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(double));
+}
+
+static void ReadVector(std::ifstream& ifile, ChVectorDynamic<>& v, uint64_t size) {
+    v.resize(size);
+    ifile.read(reinterpret_cast<char*>(v.data()), size * sizeof(double));
+}
+
+bool ChAssemblyCache::Save(const std::string& filename) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    AssemblyCacheHeader header;
+    std::memcpy(header.magic, assembly_cache_magic, sizeof(header.magic));
+    header.num_entries = m_entries.size();
+
+    std::ofstream ofile(filename, std::ios::binary);
+    ofile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto& item : m_entries) {
+        const Entry& entry = item.second;
+        AssemblyCacheEntryHeader entry_header;
+        entry_header.key = item.first;
+        entry_header.action = entry.action;
+        entry_header.size_X = entry.X.size();
+        entry_header.size_V = entry.V.size();
+        entry_header.size_A = entry.A.size();
+        entry_header.size_L = entry.L.size();
+        ofile.write(reinterpret_cast<const char*>(&entry_header), sizeof(entry_header));
+        WriteVector(ofile, entry.X);
+        WriteVector(ofile, entry.V);
+        WriteVector(ofile, entry.A);
+        WriteVector(ofile, entry.L);
+    }
+
+    return ofile.good();
+}
+
+bool ChAssemblyCache::Load(const std::string& filename) {
+    std::ifstream ifile(filename, std::ios::binary);
+    AssemblyCacheHeader header;
+    if (!ifile.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, assembly_cache_magic, sizeof(header.magic)) != 0) {
+        std::cerr << "ChAssemblyCache::Load ERROR: " << filename << " is not an assembly cache file" << std::endl;
+        return false;
+    }
+
+    std::unordered_map<uint64_t, Entry> entries;
+    for (uint64_t i = 0; i < header.num_entries; i++) {
+        AssemblyCacheEntryHeader entry_header;
+        ifile.read(reinterpret_cast<char*>(&entry_header), sizeof(entry_header));
+        Entry entry;
+        entry.action = (int)entry_header.action;
+        ReadVector(ifile, entry.X, entry_header.size_X);
+        ReadVector(ifile, entry.V, entry_header.size_V);
+        ReadVector(ifile, entry.A, entry_header.size_A);
+        ReadVector(ifile, entry.L, entry_header.size_L);
+        if (!ifile) {
+            std::cerr << "ChAssemblyCache::Load ERROR: " << filename << " is truncated" << std::endl;
+            return false;
+        }
+        entries[entry_header.key] = entry;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& item : entries)
+        m_entries[item.first] = std::move(item.second);
+
+    return true;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,94 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHASSEMBLYCACHE_H
+#define CHASSEMBLYCACHE_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+
+/// Cache of assembled configurations.
+/// An assembly analysis with an attached cache (see ChSystem::SetAssemblyCache) first computes a key from the system
+/// topology (number of coordinates and constraints), the requested assembly levels, and the unassembled problem data:
+/// position and velocity states, constraint violations, applied forces, and masses. If an entry with that key exists,
+/// the assembled states, accelerations, and reactions are restored without solving; otherwise, the assembly result is
+/// stored under that key. Changes in model parameters which do not affect any of these quantities must be reflected in
+/// a user-provided parameter key (see SetParameterKey).
+/// A cache can be shared between systems (e.g., across the samples of a Monte-Carlo study, possibly run concurrently)
+/// and persisted to a file, to be reused across runs.
+class ChApi ChAssemblyCache {
+  public:
+    /// Assembled configuration.
+    struct Entry {
+        int action;            ///< assembly levels (see AssemblyLevel)
+        ChVectorDynamic<> X;   ///< position state
+        ChVectorDynamic<> V;   ///< velocity state
+        ChVectorDynamic<> A;   ///< acceleration state (only if assembled at acceleration level)
+        ChVectorDynamic<> L;   ///< constraint reactions (only if assembled at acceleration level)
+    };
+
+    ChAssemblyCache();
+    ~ChAssemblyCache() {}
+
+    /// Set a key identifying model parameters not reflected in the assembly problem data (default: 0).
+    void SetParameterKey(uint64_t key) { m_parameter_key = key; }
+
+    /// Get the user-provided parameter key.
+    uint64_t GetParameterKey() const { return m_parameter_key; }
+
+    /// Find the entry with the given key. Return false if there is none.
+    bool Find(uint64_t key, Entry& entry);
+
+    /// Insert an entry with the given key, replacing any existing entry with the same key.
+    void Insert(uint64_t key, const Entry& entry);
+
+    /// Remove all entries and reset the hit and miss counters.
+    void Clear();
+
+    /// Get the number of cached configurations.
+    size_t GetNumEntries() const;
+
+    /// Get the number of successful lookups.
+    unsigned int GetNumHits() const { return m_num_hits; }
+
+    /// Get the number of failed lookups.
+    unsigned int GetNumMisses() const { return m_num_misses; }
+
+    /// Write all entries to a binary file.
+    bool Save(const std::string& filename) const;
+
+    /// Add all entries from a binary file written by Save.
+    bool Load(const std::string& filename);
+
+    /// Hash a block of data (FNV-1a), continuing from the given hash value.
+    static uint64_t Hash(const void* data, size_t size, uint64_t hash = 14695981039346656037ULL);
+
+  private:
+    uint64_t m_parameter_key;
+    std::unordered_map<uint64_t, Entry> m_entries;
+    unsigned int m_num_hits;
+    unsigned int m_num_misses;
+    mutable std::mutex m_mutex;
+};
+
+}  // end namespace chrono
+
+#endif
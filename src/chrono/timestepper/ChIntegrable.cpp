@@ -121,6 +121,27 @@ bool ChIntegrableIIorder::StateSolveA(ChStateDelta& Dvdt,        // result: comp
     }
 }
 
+void ChIntegrableIIorder::StateScatterLoadResiduals(const ChState& x,
+                                                    const ChStateDelta& v,
+                                                    const double T,
+                                                    bool full_update,
+                                                    ChVectorDynamic<>& R,
+                                                    ChVectorDynamic<>& Qc,
+                                                    const ChVectorDynamic<>& w,
+                                                    const ChVectorDynamic<>& L,
+                                                    const double c_F,
+                                                    const double c_M,
+                                                    const double c_L,
+                                                    const double c_C,
+                                                    const bool do_clamp,
+                                                    const double clamp) {
+    StateScatter(x, v, T, full_update);
+    LoadResidual_F(R, c_F);
+    LoadResidual_Mv(R, w, c_M);
+    LoadResidual_CqL(R, L, c_L);
+    LoadConstraint_C(Qc, c_C, do_clamp, clamp);
+}
+
 void ChIntegrableIIorder::StateIncrementX(ChState& x_new, const ChState& x, const ChStateDelta& Dx) {
     //// RADU
     //// Fix this poor implementation!
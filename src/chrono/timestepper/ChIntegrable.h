@@ -29,6 +29,8 @@ namespace chrono {
 class ChLumpingParms {
   public:
     ChLumpingParms(double Ck = 1000, double Cr = 0) : Ck_penalty(Ck), Cr_penalty(Cr), error(0){};
+    virtual ~ChLumpingParms() {}
+
     double Ck_penalty;  // stiffness penalty for constraints if any
     double Cr_penalty;  // damping penalty for constraints if any
     double error;       // store here the error done when trying lumping masses
@@ -423,6 +425,28 @@ class ChApi ChIntegrableIIorder : public ChIntegrable {
         throw std::runtime_error("LoadConstraint_Ct() not implemented, implicit integrators cannot be used. ");
     }
 
+    /// Scatter the given state to the system and, for the updated system, load the residual terms needed at one
+    /// Newton iteration of an implicit integrator:
+    ///    R  += c_F*F + c_M*M*w + c_L*Cq'*L
+    ///    Qc += c_C*C
+    /// This default implementation calls StateScatter, LoadResidual_F, LoadResidual_Mv, LoadResidual_CqL, and
+    /// LoadConstraint_C in turn. Derived classes may override it to evaluate all terms in a single pass.
+    virtual void StateScatterLoadResiduals(const ChState& x,             ///< state, x part
+                                           const ChStateDelta& v,        ///< state, v part
+                                           const double T,               ///< time T
+                                           bool full_update,             ///< perform a full update during scatter
+                                           ChVectorDynamic<>& R,         ///< result: the R residual
+                                           ChVectorDynamic<>& Qc,        ///< result: the Qc residual
+                                           const ChVectorDynamic<>& w,   ///< the w vector
+                                           const ChVectorDynamic<>& L,   ///< the L vector
+                                           const double c_F,             ///< scaling factor for F
+                                           const double c_M,             ///< scaling factor for M*w
+                                           const double c_L,             ///< scaling factor for Cq'*L
+                                           const double c_C,             ///< scaling factor for C
+                                           const bool do_clamp = false,  ///< enable optional clamping of Qc
+                                           const double clamp = 1e30     ///< clamping value
+    );
+
     //
     // OVERRIDE ChIntegrable BASE MEMBERS TO SUPPORT 1st ORDER INTEGRATORS:
     //
@@ -10,12 +10,76 @@
 //
 // =============================================================================
 
+#include <cmath>
 #include <cstdlib>
+#include <functional>
+#include <stdexcept>
+#include <vector>
 
 #include "chrono/timestepper/ChStaticAnalysis.h"
 
 namespace chrono {
 
+// Ratio between successive correction norms above which a reused factorization of the Newton matrix is refreshed.
+static const double JACOBIAN_CONTRACTION_RATIO = 0.5;
+
+// Sufficient decrease parameter of the Armijo line search.
+static const double ARMIJO_ALPHA = 1e-4;
+
+// Broyden secant updates of the inverse of the Newton matrix, on top of a fixed factorization B0 and without ever
+// forming the updated matrix (Kelley, Iterative Methods for Linear and Nonlinear Equations, 1995, algorithm brsol).
+// Steps are stored in the combined (Dx, Dl) space. The recursion assumes full steps: the history must be reset after a
+// damped step, a change of the residual function, or a new factorization.
+class ChBroydenSteps {
+  public:
+    void Reset() { m_steps.clear(); }
+
+    int GetNumSteps() const { return (int)m_steps.size(); }
+
+    /// Transform the correction z = -B0^{-1} F into the Broyden step. Return false if the update is singular, in which
+    /// case z is left unchanged.
+    bool Correct(ChVectorDynamic<>& z) const {
+        int n = (int)m_steps.size();
+        if (n == 0)
+            return true;
+        ChVectorDynamic<> w = z;
+        for (int j = 0; j < n - 1; j++)
+            w += m_steps[j + 1] * (m_steps[j].dot(w) / m_steps[j].squaredNorm());
+        double den = 1 - m_steps[n - 1].dot(w) / m_steps[n - 1].squaredNorm();
+        if (std::abs(den) < 1e-12)
+            return false;
+        z = w / den;
+        return true;
+    }
+
+    void AddStep(const ChVectorDynamic<>& s) { m_steps.push_back(s); }
+
+  private:
+    std::vector<ChVectorDynamic<>> m_steps;
+};
+
+// Backtracking line search along (Dx, Dl) from (X, L), with the Armijo condition on the 2-norm of the residual.
+// The residual function loads R and Qc at the given state. Return the accepted step length, or 0 if none is accepted.
+static double LineSearch(const std::function<void(const ChState&, const ChVectorDynamic<>&)>& residual,
+                         const ChState& X,
+                         const ChVectorDynamic<>& L,
+                         const ChStateDelta& Dx,
+                         const ChVectorDynamic<>& Dl,
+                         ChVectorDynamic<>& R,
+                         ChVectorDynamic<>& Qc,
+                         int max_backtracks) {
+    double norm0 = std::sqrt(R.squaredNorm() + Qc.squaredNorm());
+    double alpha = 1;
+    for (int k = 0; k <= max_backtracks; k++) {
+        residual(X + Dx * alpha, L + Dl * alpha);
+        double norm = std::sqrt(R.squaredNorm() + Qc.squaredNorm());
+        if (norm <= (1 - ARMIJO_ALPHA * alpha) * norm0)
+            return alpha;
+        alpha *= 0.5;
+    }
+    return 0;
+}
+
 ChStaticAnalysis::ChStaticAnalysis() : m_integrable(nullptr){};
 
 void ChStaticAnalysis::SetIntegrable(ChIntegrableIIorder* integrable) {
@@ -84,7 +148,13 @@ ChStaticNonLinearAnalysis::ChStaticNonLinearAnalysis()
       m_use_correction_test(true),
       m_reltol(1e-4),
       m_abstol(1e-8),
-      m_verbose(false) {}
+      m_verbose(false),
+      m_jacobian_update(JacobianUpdate::EVERY_ITERATION),
+      m_max_reuse(10),
+      m_line_search(false),
+      m_max_backtracks(6),
+      m_num_iterations(0),
+      m_num_setups(0) {}
 
 void ChStaticNonLinearAnalysis::StaticAnalysis() {
     ChIntegrableIIorder* integrable = static_cast<ChIntegrableIIorder*>(m_integrable);
@@ -101,6 +171,10 @@ void ChStaticNonLinearAnalysis::StaticAnalysis() {
             std::cout << "   stopping test:      residual" << std::endl;
             std::cout << "      tolerance:       " << m_abstol << std::endl;
         }
+        if (m_jacobian_update != JacobianUpdate::EVERY_ITERATION)
+            std::cout << "   matrix reuse:       " << m_max_reuse << " iterations max" << std::endl;
+        if (m_line_search)
+            std::cout << "   line search:        " << m_max_backtracks << " backtracks max" << std::endl;
         std::cout << std::endl;
     }
 
@@ -118,28 +192,48 @@ void ChStaticNonLinearAnalysis::StaticAnalysis() {
     // Set up auxiliary vectors
     ChState Xnew;
     ChStateDelta Dx;
+    ChVectorDynamic<> Dl;
+    ChVectorDynamic<> Dz;
     ChVectorDynamic<> R;
     ChVectorDynamic<> Qc;
+    int nv = integrable->GetNumCoordsVelLevel();
+    int nc = integrable->GetNumConstraints();
     Xnew.setZero(integrable->GetNumCoordsPosLevel(), integrable);
-    Dx.setZero(integrable->GetNumCoordsVelLevel(), integrable);
-    R.setZero(integrable->GetNumCoordsVelLevel());
-    Qc.setZero(integrable->GetNumConstraints());
-    L.setZero(integrable->GetNumConstraints());
+    Dx.setZero(nv, integrable);
+    Dl.setZero(nc);
+    Dz.setZero(nv + nc);
+    R.setZero(nv);
+    Qc.setZero(nc);
+    L.setZero(nc);
+
+    // Residual at the given state, with the load scaling applied to the forces and constraint violations
+    double cfactor = 0;
+    auto residual = [&](const ChState& x, const ChVectorDynamic<>& l) {
+        integrable->StateScatter(x, V, T, true);  // state -> system
+        R.setZero();
+        Qc.setZero();
+        integrable->LoadResidual_F(R, cfactor);
+        integrable->LoadResidual_CqL(R, l, 1.0);
+        integrable->LoadConstraint_C(Qc, cfactor);
+    };
 
     // Use Newton Raphson iteration, solving for the increments
-    //      [ - dF/dx    Cq' ] [ Dx  ] = [ f ]
-    //      [ Cq         0   ] [ L   ] = [-C ]
+    //      [ - dF/dx    Cq' ] [ Dx  ] = [ f + Cq'*L ]
+    //      [ Cq         0   ] [-Dl  ] = [-C         ]
+
+    ChBroydenSteps broyden;
+    bool need_setup = true;
+    int num_reuse = 0;
+    double cfactor_old = -1;
+    double corr_norm_old = 0;
+    m_num_iterations = 0;
+    m_num_setups = 0;
 
     for (int i = 0; i < m_maxiters; ++i) {
-        integrable->StateScatter(X, V, T, true);  // state -> system
-        R.setZero();
-        Qc.setZero();
-        integrable->LoadResidual_F(R, 1.0);
-        integrable->LoadConstraint_C(Qc, 1.0);
+        m_num_iterations = i + 1;
 
-        double cfactor = std::min(1.0, (i + 2.0) / (m_incremental_steps + 1.0));
-        R *= cfactor;
-        Qc *= cfactor;
+        cfactor = std::min(1.0, (i + 2.0) / (m_incremental_steps + 1.0));
+        residual(X, L);
 
         if (!m_use_correction_test) {
             // Evaluate residual norms
@@ -160,19 +254,71 @@ void ChStaticNonLinearAnalysis::StaticAnalysis() {
             }
         }
 
+        // Decide whether the Newton matrix must be factorized again. Secant updates are only valid for a fixed
+        // residual function, so they are discarded while the load scaling changes.
+        bool setup = need_setup || m_jacobian_update == JacobianUpdate::EVERY_ITERATION || num_reuse >= m_max_reuse;
+        if (setup) {
+            num_reuse = 0;
+            m_num_setups++;
+            broyden.Reset();
+        } else {
+            num_reuse++;
+        }
+        if (cfactor != cfactor_old)
+            broyden.Reset();
+        cfactor_old = cfactor;
+        need_setup = false;
+
         // Solve linear system for correction
         integrable->StateSolveCorrection(  //
-            Dx, L, R, Qc,                  //
+            Dx, Dl, R, Qc,                 //
             0,                             // factor for  M
             0,                             // factor for  dF/dv
             -1.0,                          // factor for  dF/dx (the stiffness matrix)
             X, V, T,                       // not needed here
             false,                         // do not scatter Xnew Vnew T+dt before computing correction
             false,                         // full update? (not used, since no scatter)
-            true                           // force a call to the solver's Setup() function
+            setup                          // call the solver's Setup() function only for a new factorization
         );
 
-        Xnew = X + Dx;
+        if (m_jacobian_update == JacobianUpdate::BROYDEN) {
+            Dz << Dx, Dl;
+            if (!broyden.Correct(Dz))
+                broyden.Reset();
+            Dx = Dz.head(nv);
+            Dl = Dz.tail(nc);
+        }
+
+        double alpha = 1;
+        if (m_line_search) {
+            alpha = LineSearch(residual, X, L, Dx, Dl, R, Qc, m_max_backtracks);
+            if (alpha == 0) {
+                if (!setup) {
+                    // Discard the step and refresh the Newton matrix
+                    if (m_verbose)
+                        std::cout << "--- Nonlinear statics iteration " << i << "  line search failed" << std::endl;
+                    need_setup = true;
+                    continue;
+                }
+                alpha = std::pow(0.5, m_max_backtracks);
+            }
+        }
+
+        if (m_jacobian_update == JacobianUpdate::BROYDEN) {
+            if (alpha == 1)
+                broyden.AddStep(Dz);
+            else
+                broyden.Reset();
+        }
+
+        // Refresh the factorization at the next iteration if the corrections do not contract fast enough
+        double corr_norm = Dx.norm();
+        if (!setup && corr_norm > JACOBIAN_CONTRACTION_RATIO * corr_norm_old)
+            need_setup = true;
+        corr_norm_old = corr_norm;
+
+        Xnew = X + Dx * alpha;
+        L += Dl * alpha;
 
         if (m_use_correction_test) {
             // Calculate actual correction in X
@@ -229,6 +375,16 @@ void ChStaticNonLinearAnalysis::SetIncrementalSteps(int incr_steps) {
         m_maxiters = m_incremental_steps;
 }
 
+void ChStaticNonLinearAnalysis::SetJacobianUpdate(JacobianUpdate update, int max_reuse) {
+    m_jacobian_update = update;
+    m_max_reuse = std::max(1, max_reuse);
+}
+
+void ChStaticNonLinearAnalysis::SetLineSearch(bool enable, int max_backtracks) {
+    m_line_search = enable;
+    m_max_backtracks = std::max(1, max_backtracks);
+}
+
 // -----------------------------------------------------------------------------
 
 ChStaticNonLinearRheonomicAnalysis::ChStaticNonLinearRheonomicAnalysis()
@@ -239,7 +395,13 @@ ChStaticNonLinearRheonomicAnalysis::ChStaticNonLinearRheonomicAnalysis()
       m_reltol(1e-4),
       m_abstol(1e-8),
       m_verbose(false),
-      m_automatic_deriv_computation(false) {}
+      m_automatic_deriv_computation(false),
+      m_jacobian_update(JacobianUpdate::EVERY_ITERATION),
+      m_max_reuse(10),
+      m_line_search(false),
+      m_max_backtracks(6),
+      m_num_iterations(0),
+      m_num_setups(0) {}
 
 void ChStaticNonLinearRheonomicAnalysis::StaticAnalysis() {
     ChIntegrableIIorder* integrable = static_cast<ChIntegrableIIorder*>(m_integrable);
@@ -256,6 +418,10 @@ void ChStaticNonLinearRheonomicAnalysis::StaticAnalysis() {
             std::cout << "   stopping test:      residual" << std::endl;
             std::cout << "      tolerance:       " << m_abstol << std::endl;
         }
+        if (m_jacobian_update != JacobianUpdate::EVERY_ITERATION)
+            std::cout << "   matrix reuse:       " << m_max_reuse << " iterations max" << std::endl;
+        if (m_line_search)
+            std::cout << "   line search:        " << m_max_backtracks << " backtracks max" << std::endl;
         std::cout << std::endl;
     }
 
@@ -293,13 +459,39 @@ void ChStaticNonLinearRheonomicAnalysis::StaticAnalysis() {
     Dl.setZero(integrable->GetNumConstraints());
     double dt_perturbation = 1e-5;
 
+    int nv = integrable->GetNumCoordsVelLevel();
+    int nc = integrable->GetNumConstraints();
+    ChVectorDynamic<> Dz(nv + nc);
+
+    // Residual at the given state, including all inertial forces, scaled by the load scaling
+    double cfactor = 0;
+    auto residual = [&](const ChState& x, const ChVectorDynamic<>& l) {
+        integrable->StateScatter(x, V, T, true);  // state -> system
+        R.setZero(nv);
+        Qc.setZero(nc);
+        integrable->LoadResidual_F(R, cfactor);
+        integrable->LoadResidual_CqL(R, l, cfactor);
+        integrable->LoadResidual_Mv(R, A, -cfactor);
+        integrable->LoadConstraint_C(Qc, cfactor);  // C   (sign flipped later in StateSolveCorrection)
+    };
+
+    ChBroydenSteps broyden;
+    bool need_setup = true;
+    int num_reuse = 0;
+    double cfactor_old = -1;
+    double corr_norm_old = 0;
+    m_num_iterations = 0;
+    m_num_setups = 0;
+
     // Use Newton Raphson iteration
 
     for (int i = 0; i < m_maxiters; ++i) {
+        m_num_iterations = i + 1;
+
         integrable->StateScatter(X, V, T, true);  // state -> system
 
         // total load scaling factor
-        double cfactor = std::min(1.0, (i + 2.0) / (m_incremental_steps + 1.0));
+        cfactor = std::min(1.0, (i + 2.0) / (m_incremental_steps + 1.0));
 
         // Update nonzero speeds and accelerations, if any, calling
         // the iteration callback, if any:
@@ -390,15 +582,7 @@ void ChStaticNonLinearRheonomicAnalysis::StaticAnalysis() {
         //      [ - dF/dx    Cq' ] [ Dx  ] = [ f - M*a + Cq*L]
         //      [ Cq         0   ] [-Dl  ] = [ -C            ]
 
-        R.setZero(integrable->GetNumCoordsVelLevel());
-        Qc.setZero(integrable->GetNumConstraints());
-        integrable->LoadResidual_F(R, 1.0);
-        integrable->LoadResidual_CqL(R, L, 1.0);
-        integrable->LoadResidual_Mv(R, A, -1.0);
-        integrable->LoadConstraint_C(Qc, 1.0);  // C   (sign flipped later in StateSolveCorrection)
-
-        R *= cfactor;
-        Qc *= cfactor;
+        residual(X, L);
 
         if (!m_use_correction_test) {
             // Evaluate residual norms
@@ -419,6 +603,21 @@ void ChStaticNonLinearRheonomicAnalysis::StaticAnalysis() {
             }
         }
 
+        // Decide whether the Newton matrix must be factorized again. Secant updates are only valid for a fixed residual
+        // function, so they are discarded while the load scaling changes or if the callback updates the model.
+        bool setup = need_setup || m_jacobian_update == JacobianUpdate::EVERY_ITERATION || num_reuse >= m_max_reuse;
+        if (setup) {
+            num_reuse = 0;
+            m_num_setups++;
+            broyden.Reset();
+        } else {
+            num_reuse++;
+        }
+        if (cfactor != cfactor_old || m_callback)
+            broyden.Reset();
+        cfactor_old = cfactor;
+        need_setup = false;
+
         // Solve linear system for correction
         integrable->StateSolveCorrection(  //
             Dx, Dl, R, Qc,                 //
@@ -428,11 +627,47 @@ void ChStaticNonLinearRheonomicAnalysis::StaticAnalysis() {
             X, V, T,                       // not needed here
             false,                         // do not scatter Xnew Vnew T+dt before computing correction
             false,                         // full update? (not used, since no scatter)
-            true                           // force a call to the solver's Setup() function
+            setup                          // call the solver's Setup() function only for a new factorization
         );
 
-        Xnew = X + Dx;
-        L += Dl;
+        if (m_jacobian_update == JacobianUpdate::BROYDEN) {
+            Dz << Dx, Dl;
+            if (!broyden.Correct(Dz))
+                broyden.Reset();
+            Dx = Dz.head(nv);
+            Dl = Dz.tail(nc);
+        }
+
+        double alpha = 1;
+        if (m_line_search) {
+            alpha = LineSearch(residual, X, L, Dx, Dl, R, Qc, m_max_backtracks);
+            if (alpha == 0) {
+                if (!setup) {
+                    // Discard the step and refresh the Newton matrix
+                    if (m_verbose)
+                        std::cout << "--- Nonlinear statics iteration " << i << "  line search failed" << std::endl;
+                    need_setup = true;
+                    continue;
+                }
+                alpha = std::pow(0.5, m_max_backtracks);
+            }
+        }
+
+        if (m_jacobian_update == JacobianUpdate::BROYDEN) {
+            if (alpha == 1)
+                broyden.AddStep(Dz);
+            else
+                broyden.Reset();
+        }
+
+        // Refresh the factorization at the next iteration if the corrections do not contract fast enough
+        double corr_norm = Dx.norm();
+        if (!setup && corr_norm > JACOBIAN_CONTRACTION_RATIO * corr_norm_old)
+            need_setup = true;
+        corr_norm_old = corr_norm;
+
+        Xnew = X + Dx * alpha;
+        L += Dl * alpha;
 
         /*
         std::cout << "\n\n Iteration " << i << std::endl << std::endl;
@@ -569,6 +804,16 @@ void ChStaticNonLinearRheonomicAnalysis::SetIncrementalSteps(int incr_steps) {
         m_maxiters = m_incremental_steps;
 }
 
+void ChStaticNonLinearRheonomicAnalysis::SetJacobianUpdate(JacobianUpdate update, int max_reuse) {
+    m_jacobian_update = update;
+    m_max_reuse = std::max(1, max_reuse);
+}
+
+void ChStaticNonLinearRheonomicAnalysis::SetLineSearch(bool enable, int max_backtracks) {
+    m_line_search = enable;
+    m_max_backtracks = std::max(1, max_backtracks);
+}
+
 // -----------------------------------------------------------------------------
 
 ChStaticNonLinearIncremental::ChStaticNonLinearIncremental()
@@ -582,9 +827,17 @@ ChStaticNonLinearIncremental::ChStaticNonLinearIncremental()
       m_adaptive_newton(true),
       m_adaptive_newton_tolerance(1.0),
       m_adaptive_newton_delay(1),
-      m_newton_damping_factor(1.0) {}
+      m_newton_damping_factor(1.0),
+      m_arc_length(false),
+      m_arc_length_max_steps(100),
+      m_load_scaling(0) {}
 
 void ChStaticNonLinearIncremental::StaticAnalysis() {
+    if (m_arc_length) {
+        ArcLengthAnalysis();
+        return;
+    }
+
     ChIntegrableIIorder* integrable = static_cast<ChIntegrableIIorder*>(m_integrable);
 
     if (m_verbose) {
@@ -650,6 +903,7 @@ void ChStaticNonLinearIncremental::StaticAnalysis() {
                       << std::endl;
 
         m_callback->OnLoadScaling(cfactor, j, this);
+        m_load_scaling = cfactor;
 
         if (m_verbose) {
             std::cout << "--- Nonlinear statics, outer iteration " << j << ", load scaling: " << cfactor << std::endl;
@@ -770,6 +1024,246 @@ void ChStaticNonLinearIncremental::StaticAnalysis() {
     integrable->StateScatterReactions(L);     // -> system auxiliary data
 }
 
+void ChStaticNonLinearIncremental::ArcLengthAnalysis() {
+    ChIntegrableIIorder* integrable = static_cast<ChIntegrableIIorder*>(m_integrable);
+
+    if (!m_callback)
+        throw std::runtime_error(
+            "ChStaticNonLinearIncremental::StaticAnalysis - arc-length continuation requires a load callback.");
+
+    if (m_verbose) {
+        std::cout << "\nNonlinear statics with arc-length continuation of external load" << std::endl;
+        std::cout << "   max Newton iterations per load step:     " << max_newton_iters << std::endl;
+        std::cout << "   max arc-length steps:  " << m_arc_length_max_steps << std::endl;
+        if (m_use_correction_test) {
+            std::cout << "   stopping test:      correction" << std::endl;
+            std::cout << "      relative tol:    " << m_reltol << std::endl;
+            std::cout << "      absolute tol:    " << m_abstol << std::endl;
+        } else {
+            std::cout << "   stopping test:      residual" << std::endl;
+            std::cout << "      tolerance:       " << m_abstol << std::endl;
+        }
+        std::cout << std::endl;
+    }
+
+    // Set up main vectors
+    double T;
+    ChStateDelta V(integrable);
+    X.resize(integrable->GetNumCoordsPosLevel());
+    V.resize(integrable->GetNumCoordsVelLevel());
+    integrable->StateGather(X, V, T);  // state <- system
+
+    // Set speed to zero
+    V.setZero(integrable->GetNumCoordsVelLevel(), integrable);
+
+    // Set up auxiliary vectors
+    int nv = integrable->GetNumCoordsVelLevel();
+    int nc = integrable->GetNumConstraints();
+    ChState Xnew(integrable);
+    ChStateDelta Dx_q(integrable);     // displacement under the reference load
+    ChStateDelta Dx_r(integrable);     // displacement correcting the residual
+    ChStateDelta Dx_step(integrable);  // displacement over the current load step
+    ChStateDelta Dx_prev(integrable);  // displacement over the previous load step
+    ChVectorDynamic<> Dl_q(nc);
+    ChVectorDynamic<> Dl_r(nc);
+    ChVectorDynamic<> Dl_step(nc);
+    ChVectorDynamic<> R(nv);
+    ChVectorDynamic<> Qc(nc);
+    ChVectorDynamic<> Rq(nv);
+    ChVectorDynamic<> Qc_zero(nc);
+    Dx_q.setZero(nv, integrable);
+    Dx_r.setZero(nv, integrable);
+    Dx_step.setZero(nv, integrable);
+    Dx_prev.setZero(nv, integrable);
+    Qc_zero.setZero();
+    L.setZero(nc);
+
+    // Reference load, i.e. the derivative of the residual with respect to the load scaling.
+    // This assumes external loads scaling linearly and not depending on the state.
+    Rq.setZero();
+    m_callback->OnLoadScaling(1.0, 0, this);
+    integrable->StateScatter(X, V, T, true);  // state -> system
+    integrable->LoadResidual_F(Rq, 1.0);
+    m_callback->OnLoadScaling(0.0, 0, this);
+    integrable->StateScatter(X, V, T, true);  // state -> system
+    integrable->LoadResidual_F(Rq, -1.0);
+
+    // Solve for the displacement (and reactions) under the reference load, with the current factorization
+    auto solve_reference = [&](bool setup) {
+        integrable->StateSolveCorrection(  //
+            Dx_q, Dl_q, Rq, Qc_zero,       //
+            0,                             // factor for  M
+            0,                             // factor for  dF/dv
+            -1.0,                          // factor for  dF/dx (the stiffness matrix)
+            X, V, T,                       // not needed here
+            false,                         // do not scatter Xnew Vnew T+dt before computing correction
+            false,                         // full update? (not used, since no scatter)
+            setup                          // call the solver's Setup() function only for a new factorization
+        );
+    };
+
+    double ds = 0;      // arc length
+    double ds_min = 0;  // minimum arc length, below which the analysis is stopped
+    int target_iters = std::max(1, max_newton_iters / 2);
+    m_load_scaling = 0;
+
+    // Outer loop: arc-length steps along the equilibrium path
+
+    int j = 0;
+    for (; j < m_arc_length_max_steps && m_load_scaling < 1; ++j) {
+        // Predictor, tangent to the equilibrium path at the current (converged) state
+        integrable->StateScatter(X, V, T, true);  // state -> system
+        solve_reference(true);
+
+        double Dx_q_norm = Dx_q.norm();
+        if (Dx_q_norm == 0)
+            break;
+        if (ds == 0) {
+            ds = Dx_q_norm / m_incremental_steps;
+            ds_min = 1e-6 * ds;
+        }
+
+        // Keep moving forward along the path: past a limit point, the load scaling decreases
+        double dlambda = ds / Dx_q_norm;
+        if (j > 0 && Dx_q.dot(Dx_prev) < 0)
+            dlambda = -dlambda;
+
+        // Take the last step under load control, so that the analysis ends at load scaling 1
+        bool load_control = (m_load_scaling + dlambda >= 1);
+        if (load_control)
+            dlambda = 1 - m_load_scaling;
+
+        Dx_step = Dx_q * dlambda;
+        Dl_step = Dl_q * dlambda;
+
+        if (m_verbose) {
+            std::cout << "--- Nonlinear statics, arc-length step " << j << ", load scaling: " << m_load_scaling
+                      << " + " << dlambda << (load_control ? " (load control)" : "") << std::endl;
+        }
+
+        // Inner loop: Newton iterations on the state and on the load scaling, with the constraint
+        //      |Dx_step| = ds
+        // The correction is the combination of the solutions for the residual and for the reference load, both
+        // obtained with the same factorization:
+        //      [ - dF/dx    Cq' ] [ Dx_r  Dx_q ] = [ F + Cq'*L   Rq ]
+        //      [ Cq         0   ] [-Dl_r -Dl_q ] = [-C           0  ]
+
+        bool converged = false;
+        int num_iters = 0;
+        for (int i = 0; i < max_newton_iters; ++i) {
+            num_iters = i + 1;
+
+            Xnew = X + Dx_step;
+            m_callback->OnLoadScaling(m_load_scaling + dlambda, j, this);
+            integrable->StateScatter(Xnew, V, T, true);  // state -> system
+            R.setZero();
+            Qc.setZero();
+            integrable->LoadResidual_F(R, 1.0);
+            integrable->LoadResidual_CqL(R, L + Dl_step, 1.0);
+            integrable->LoadConstraint_C(Qc, 1.0);
+
+            // Evaluate residual norms
+            double R_norm = R.lpNorm<Eigen::Infinity>();
+            double Qc_norm = Qc.lpNorm<Eigen::Infinity>();
+
+            if (m_verbose) {
+                std::cout << "---   inner Newton iteration " << i << ",  |R|_inf = " << R_norm
+                          << "  |Qc|_inf = " << Qc_norm << std::endl;
+            }
+
+            if (!m_use_correction_test && R_norm < m_abstol && Qc_norm < m_abstol) {
+                converged = true;
+                break;
+            }
+
+            integrable->StateSolveCorrection(  //
+                Dx_r, Dl_r, R, Qc,             //
+                0,                             // factor for  M
+                0,                             // factor for  dF/dv
+                -1.0,                          // factor for  dF/dx (the stiffness matrix)
+                Xnew, V, T,                    // not needed here
+                false,                         // do not scatter Xnew Vnew T+dt before computing correction
+                false,                         // full update? (not used, since no scatter)
+                true                           // force a call to the solver's Setup() function
+            );
+
+            // Load scaling correction, from the arc-length constraint
+            //      |Dx_step + Dx_r + dl * Dx_q|^2 = ds^2
+            // taking the root that keeps the step closest to its current direction
+            double dl = 0;
+            if (!load_control) {
+                solve_reference(false);
+
+                ChStateDelta Dx_0 = Dx_step + Dx_r;
+                double a = Dx_q.squaredNorm();
+                double b = 2 * Dx_q.dot(Dx_0);
+                double c = Dx_0.squaredNorm() - ds * ds;
+                double disc = b * b - 4 * a * c;
+                if (disc < 0)
+                    break;
+                double dl1 = (-b + std::sqrt(disc)) / (2 * a);
+                double dl2 = (-b - std::sqrt(disc)) / (2 * a);
+                double cos1 = (Dx_0 + Dx_q * dl1).dot(Dx_step);
+                double cos2 = (Dx_0 + Dx_q * dl2).dot(Dx_step);
+                dl = (cos1 >= cos2) ? dl1 : dl2;
+            }
+
+            ChStateDelta correction = Dx_r + Dx_q * dl;
+            Dx_step = Dx_step + correction;
+            Dl_step += Dl_r + Dl_q * dl;
+            dlambda += dl;
+
+            if (m_use_correction_test) {
+                // Evaluate weights and correction WRMS norm
+                ChVectorDynamic<> ewt = (m_reltol * Xnew.cwiseAbs() + m_abstol).cwiseInverse();
+                double Dx_norm = correction.wrmsNorm(ewt);
+
+                if (Dx_norm < 1) {
+                    converged = true;
+                    break;
+                }
+            }
+        }
+
+        // The load scaling may overshoot 1 if the corrector moved it past the predicted value
+        if (converged && !load_control && m_load_scaling + dlambda > 1)
+            converged = false;
+
+        if (!converged) {
+            // Reject the step and retry with a shorter arc
+            ds *= 0.5;
+            if (m_verbose)
+                std::cout << "---     >>> step rejected, arc length reduced to " << ds << std::endl;
+            if (ds < ds_min)
+                break;
+            continue;
+        }
+
+        // Accept the step
+        X = X + Dx_step;
+        L += Dl_step;
+        m_load_scaling = load_control ? 1.0 : m_load_scaling + dlambda;
+        Dx_prev = Dx_step;
+
+        if (m_verbose) {
+            std::cout << "+++   converged in " << num_iters << " iterations, load scaling: " << m_load_scaling
+                      << std::endl;
+        }
+
+        // Adapt the arc length to the number of Newton iterations
+        ds *= std::max(0.5, std::min(2.0, std::sqrt((double)target_iters / num_iters)));
+    }
+
+    if (m_verbose && m_load_scaling < 1)
+        std::cerr << "WARNING: arc-length continuation stopped at load scaling " << m_load_scaling << std::endl;
+
+    // Restore the loads of the last converged state
+    m_callback->OnLoadScaling(m_load_scaling, j, this);
+
+    integrable->StateScatter(X, V, T, true);  // state -> system
+    integrable->StateScatterReactions(L);     // -> system auxiliary data
+}
+
 void ChStaticNonLinearIncremental::SetCorrectionTolerance(double reltol, double abstol) {
     m_use_correction_test = true;
     m_reltol = reltol;
@@ -802,6 +1296,11 @@ void ChStaticNonLinearIncremental::SetNewtonDamping(double damping_factor) {
     m_newton_damping_factor = damping_factor;
 }
 
+void ChStaticNonLinearIncremental::SetArcLength(bool enable, int max_steps) {
+    m_arc_length = enable;
+    m_arc_length_max_steps = max_steps;
+}
+
 // -----------------------------------------------------------------------------
 
 ChStaticNonLinearRigidMotion::ChStaticNonLinearRigidMotion()
@@ -33,6 +33,13 @@ class ChApi ChStaticAnalysis {
     /// Access the Lagrange multipliers, if any.
     const ChVectorDynamic<>& GetLagrangeMultipliers() const { return L; }
 
+    /// Strategy for updating the Newton matrix in nonlinear static analyses.
+    enum class JacobianUpdate {
+        EVERY_ITERATION,  ///< full Newton, the matrix is re-evaluated and factorized at each iteration
+        MODIFIED_NEWTON,  ///< the factorization is reused as long as the corrections keep contracting
+        BROYDEN           ///< the factorization is reused, with Broyden secant updates of its inverse
+    };
+
   protected:
     ChStaticAnalysis();
 
@@ -95,6 +102,24 @@ class ChApi ChStaticNonLinearAnalysis : public ChStaticAnalysis {
     /// Set the number of steps that, for the first iterations, make the residual grow linearly.
     int GetIncrementalSteps() const { return m_incremental_steps; }
 
+    /// Set the strategy for updating the Newton matrix (default: JacobianUpdate::EVERY_ITERATION).
+    /// With MODIFIED_NEWTON and BROYDEN, the factorization of the Newton matrix is reused over successive iterations
+    /// and refreshed only when the corrections stop contracting or after max_reuse iterations. This saves the
+    /// assembly and factorization cost only with direct linear solvers; iterative solvers assemble the matrix anyway.
+    void SetJacobianUpdate(JacobianUpdate update, int max_reuse = 10);
+
+    /// Enable/disable a backtracking line search along the Newton corrections (default: false).
+    /// The step is halved, at most max_backtracks times, until the 2-norm of the residual satisfies the Armijo
+    /// sufficient decrease condition. If no step is accepted with a reused factorization, the step is discarded and
+    /// the Newton matrix is refreshed.
+    void SetLineSearch(bool enable, int max_backtracks = 6);
+
+    /// Return the number of Newton iterations performed during the last analysis.
+    int GetNumIterations() const { return m_num_iterations; }
+
+    /// Return the number of factorizations of the Newton matrix performed during the last analysis.
+    int GetNumFactorizations() const { return m_num_setups; }
+
   private:
     /// Performs the static analysis, doing a non-linear solve.
     virtual void StaticAnalysis() override;
@@ -105,6 +130,12 @@ class ChApi ChStaticNonLinearAnalysis : public ChStaticAnalysis {
     bool m_use_correction_test;
     double m_reltol;
     double m_abstol;
+    JacobianUpdate m_jacobian_update;
+    int m_max_reuse;
+    bool m_line_search;
+    int m_max_backtracks;
+    int m_num_iterations;
+    int m_num_setups;
 
     friend class ChSystem;
 };
@@ -173,6 +204,24 @@ class ChApi ChStaticNonLinearRheonomicAnalysis : public ChStaticAnalysis {
     /// If not enabled, you can use an IterationCallback to update the speeds and accelerations in the caller code.
     void SetAutomaticSpeedAndAccelerationComputation(bool val) { m_automatic_deriv_computation = val; }
 
+    /// Set the strategy for updating the Newton matrix (default: JacobianUpdate::EVERY_ITERATION).
+    /// With MODIFIED_NEWTON and BROYDEN, the factorization of the Newton matrix is reused over successive iterations
+    /// and refreshed only when the corrections stop contracting or after max_reuse iterations. This saves the
+    /// assembly and factorization cost only with direct linear solvers; iterative solvers assemble the matrix anyway.
+    void SetJacobianUpdate(JacobianUpdate update, int max_reuse = 10);
+
+    /// Enable/disable a backtracking line search along the Newton corrections (default: false).
+    /// The step is halved, at most max_backtracks times, until the 2-norm of the residual satisfies the Armijo
+    /// sufficient decrease condition. If no step is accepted with a reused factorization, the step is discarded and
+    /// the Newton matrix is refreshed.
+    void SetLineSearch(bool enable, int max_backtracks = 6);
+
+    /// Return the number of Newton iterations performed during the last analysis.
+    int GetNumIterations() const { return m_num_iterations; }
+
+    /// Return the number of factorizations of the Newton matrix performed during the last analysis.
+    int GetNumFactorizations() const { return m_num_setups; }
+
   private:
     /// Performs the static analysis, doing a non-linear solve.
     virtual void StaticAnalysis() override;
@@ -184,6 +233,12 @@ class ChApi ChStaticNonLinearRheonomicAnalysis : public ChStaticAnalysis {
     bool m_use_correction_test;
     double m_reltol;
     double m_abstol;
+    JacobianUpdate m_jacobian_update;
+    int m_max_reuse;
+    bool m_line_search;
+    int m_max_backtracks;
+    int m_num_iterations;
+    int m_num_setups;
     std::shared_ptr<IterationCallback> m_callback;
 
     friend class ChSystem;
@@ -263,10 +318,26 @@ class ChApi ChStaticNonLinearIncremental : public ChStaticAnalysis {
     ///  Set the callback to be called at each iteration.
     void SetLoadIncrementCallback(std::shared_ptr<LoadIncrementCallback> callback) { m_callback = callback; }
 
+    /// Enable/disable arc-length continuation of the external load (default: false).
+    /// Instead of being prescribed, the load scaling passed to the LoadIncrementCallback is solved for together with
+    /// the state, under a constraint on the length of the displacement increment of each outer step (Crisfield's
+    /// cylindrical arc-length method). This follows the equilibrium path past limit points, as in snap-through
+    /// problems, where the load scaling must temporarily decrease. The first arc length is that of a load increment
+    /// of 1/incr_steps; it is then adapted to the number of Newton iterations. The last step is taken under load
+    /// control so that the analysis ends at load scaling 1, unless max_steps outer steps are reached first.
+    /// External loads must scale linearly with the load scaling and must not depend on the state.
+    void SetArcLength(bool enable, int max_steps = 100);
+
+    /// Return the load scaling reached at the end of the last analysis.
+    double GetLoadScaling() const { return m_load_scaling; }
+
   private:
     /// Performs the static analysis, doing a non-linear solve.
     virtual void StaticAnalysis() override;
 
+    /// Performs the static analysis with arc-length continuation of the external load.
+    void ArcLengthAnalysis();
+
     bool m_verbose;
     int max_newton_iters;
     int m_incremental_steps;
@@ -277,6 +348,9 @@ class ChApi ChStaticNonLinearIncremental : public ChStaticAnalysis {
     double m_newton_damping_factor;
     double m_reltol;
     double m_abstol;
+    bool m_arc_length;
+    int m_arc_length_max_steps;
+    double m_load_scaling;
     std::shared_ptr<LoadIncrementCallback> m_callback;
 
     friend class ChSystem;
@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepper.h"
+#include "chrono/utils/ChProfiler.h"
 
 namespace chrono {
 
@@ -40,6 +41,8 @@ class ChTimestepper_Type_enum_mapper : public ChTimestepper {
     CH_ENUM_VAL(Type::EULER_EXPLICIT);
     CH_ENUM_VAL(Type::LEAPFROG);
     CH_ENUM_VAL(Type::NEWMARK);
+    CH_ENUM_VAL(Type::RUNGEKUTTA_ADAPTIVE);
+    CH_ENUM_VAL(Type::EULER_IMEX_ADAPTIVE);
     CH_ENUM_VAL(Type::CUSTOM);
     CH_ENUM_MAPPER_END(Type);
 };
@@ -414,6 +417,8 @@ CH_UPCASTING(ChTimestepperEulerImplicit, ChImplicitIterativeTimestepper)
 
 // Performs a step of Euler implicit for II order systems
 void ChTimestepperEulerImplicit::Advance(const double dt) {
+    CH_PROFILE("EulerImplicit");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -445,22 +450,33 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
     numsetups = 0;
     numsolves = 0;
 
+    unsigned int n_v = mintegrable->GetNumCoordsVelLevel();
+    unsigned int n_c = mintegrable->GetNumConstraints();
+    bool call_setup = JacobianUpdateRequired(dt, n_v, n_c);
+    bool converged = false;
+    double Dv_norm_prev = 0;
+
     for (int i = 0; i < this->GetMaxIters(); ++i) {
-        mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
+        CH_PROFILE("NewtonIteration");
+
+        // state -> system, then
+        //   R  = dt*f + M*(v_old - v_new) + dt*Cq'*l
+        //   Qc = C/dt  (sign flipped later in StateSolveCorrection)
         R.setZero();
         Qc.setZero();
-        mintegrable->LoadResidual_F(R, dt);                // R  = dt*f
-        mintegrable->LoadResidual_Mv(R, (V - Vnew), 1.0);  // R += M*(v_old - v_new)
-        mintegrable->LoadResidual_CqL(R, L, dt);           // R += dt*Cq'*l
-        mintegrable->LoadConstraint_C(Qc, 1.0 / dt, Qc_do_clamp,
-                                      Qc_clamping);  // Qc= C/dt  (sign flipped later in StateSolveCorrection)
+        mintegrable->StateScatterLoadResiduals(Xnew, Vnew, T + dt, false,  //
+                                               R, Qc, V - Vnew, L,         //
+                                               dt, 1.0, dt, 1.0 / dt,      //
+                                               Qc_do_clamp, Qc_clamping);
 
         if (verbose)
             std::cout << " Euler iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
                       << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << std::endl;
 
-        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL))
+        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL)) {
+            converged = true;
             break;
+        }
 
         mintegrable->StateSolveCorrection(  //
             Dv, Dl, R, Qc,                  //
@@ -470,12 +486,30 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
             Xnew, Vnew, T + dt,             // not used here (scatter = false)
             false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
             false,                          // full update? (not used, since no scatter)
-            true                            // always call the solver's Setup
+            call_setup                      // call the solver's Setup only if the Newton matrix must be updated
         );
 
         numiters++;
-        numsetups++;
         numsolves++;
+        if (call_setup) {
+            numsetups++;
+            SetJacobianUpdated(dt, n_v, n_c);
+        }
+
+        // Decide whether the Newton matrix must be updated at the next iteration
+        double Dv_norm = Dv.lpNorm<Eigen::Infinity>();
+        switch (jacobian_update) {
+            case JacobianUpdate::EVERY_ITERATION:
+                call_setup = true;
+                break;
+            case JacobianUpdate::EVERY_STEP:
+                call_setup = false;
+                break;
+            case JacobianUpdate::AUTOMATIC:
+                call_setup = !call_setup && i > 0 && JacobianReuseFailed(Dv_norm, Dv_norm_prev);
+                break;
+        }
+        Dv_norm_prev = Dv_norm;
 
         Dl *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
         L += Dl;
@@ -485,6 +519,12 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
         Xnew = X + Vnew * dt;
     }
 
+    // If the iteration did not converge, force a Newton matrix update at the next step
+    if (!converged)
+        jacobian_valid = false;
+
+    AccumulateCounters();
+
     mintegrable->StateScatterAcceleration(
         (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
@@ -526,6 +566,8 @@ CH_UPCASTING(ChTimestepperEulerImplicitLinearized, ChImplicitTimestepper)
 // If the solver in StateSolveCorrection is a CCP complementarity
 // solver, this is the typical Anitescu stabilized timestepper for DVIs.
 void ChTimestepperEulerImplicitLinearized::Advance(const double dt) {
+    CH_PROFILE("EulerImplicitLinearized");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -813,6 +855,8 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
     mintegrable->StateScatter(X, V, T, true);  // state -> system
     mintegrable->StateScatterReactions(L *=
                                        0.5);  // -> system auxiliary data   (*=0.5 cause we used the hack of l_old = 0)
+
+    AccumulateCounters();
 }
 
 void ChTimestepperTrapezoidal::ArchiveOut(ChArchiveOut& archive) {
@@ -911,6 +955,8 @@ void ChTimestepperTrapezoidalLinearized::Advance(const double dt) {
     mintegrable->StateScatter(X, V, T, true);                 // state -> system
     mintegrable->StateScatterAcceleration((Dv *= (1 / dt)));  // -> system auxiliary data (i.e acceleration as measure)
     mintegrable->StateScatterReactions(L *= 0.5);             // -> system auxiliary data (*=0.5 because use l_old = 0)
+
+    AccumulateCounters();
 }
 
 void ChTimestepperTrapezoidalLinearized::ArchiveOut(ChArchiveOut& archive) {
@@ -1002,6 +1048,8 @@ void ChTimestepperTrapezoidalLinearized2::Advance(const double dt) {
 
     mintegrable->StateScatter(X, V, T, true);  // state -> system
     mintegrable->StateScatterReactions(L);     // -> system auxiliary data
+
+    AccumulateCounters();
 }
 
 void ChTimestepperTrapezoidalLinearized2::ArchiveOut(ChArchiveOut& archive) {
@@ -1142,6 +1190,8 @@ void ChTimestepperNewmark::Advance(const double dt) {
     mintegrable->StateScatter(X, V, T, true);  // state -> system
     mintegrable->StateScatterAcceleration(A);  // -> system auxiliary data
     mintegrable->StateScatterReactions(L);     // -> system auxiliary data
+
+    AccumulateCounters();
 }
 
 void ChTimestepperNewmark::ArchiveOut(ChArchiveOut& archive) {
@@ -44,6 +44,8 @@ class ChApi ChTimestepper {
         EULER_EXPLICIT = 8,
         LEAPFROG = 9,
         NEWMARK = 10,
+        RUNGEKUTTA_ADAPTIVE = 11,
+        EULER_IMEX_ADAPTIVE = 12,
         CUSTOM = 20
     };
 
@@ -186,14 +188,22 @@ class ChApi ChExplicitTimestepper {
     /// If lumping not supported because ChIntegrable::LoadLumpedMass_Md() not implemented, throw exception.
     /// If lumping introduces some approximation, you'll get nonzero in GetLumpingError().
     /// Optionally paramters: the stiffness penalty for constraints, and damping penalty for constraints.
-    void SetDiagonalLumpingON(double Ck = 1000, double Cr = 0) { lumping_parameters = new ChLumpingParms(Ck, Cr); }
+    /// With diagonal lumping, a ChSystem without constraints also skips the construction of the system descriptor at
+    /// each step, since no linear system is ever solved.
+    void SetDiagonalLumpingON(double Ck = 1000, double Cr = 0) {
+        delete lumping_parameters;
+        lumping_parameters = new ChLumpingParms(Ck, Cr);
+    }
 
     /// Turn off the diagonal lumping (default is off)
     void SetDiagonalLumpingOFF() {
-        if (lumping_parameters)
-            delete (lumping_parameters);
+        delete lumping_parameters;
+        lumping_parameters = nullptr;
     }
 
+    /// Return true if diagonal lumping is enabled.
+    bool IsDiagonalLumpingON() const { return lumping_parameters != nullptr; }
+
     /// Gets the diagonal lumping error done last time the integrator has been called
     double GetLumpingError() {
         if (this->lumping_parameters)
@@ -232,6 +242,15 @@ class ChApi ChImplicitTimestepper {};
 /// using an iterative process, up to a desired tolerance. At each iteration,
 /// a linear system must be solved.
 class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
+  public:
+    /// Policy for updating the Newton matrix (and calling the solver's Setup function, e.g. a matrix factorization).
+    /// Not all implicit integrators support all policies (see the documentation of derived classes).
+    enum class JacobianUpdate {
+        EVERY_ITERATION,  ///< update at every Newton iteration (full Newton)
+        EVERY_STEP,       ///< update at the first Newton iteration of each step (modified Newton)
+        AUTOMATIC         ///< reuse across steps, update only when needed
+    };
+
   protected:
     unsigned int maxiters;  ///< maximum number of iterations
     double reltol;          ///< relative tolerance
@@ -242,9 +261,35 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     unsigned int numsetups;  ///< number of calls to the solver's Setup function
     unsigned int numsolves;  ///< number of calls to the solver's Solve function
 
+    unsigned long total_numiters;   ///< cumulative number of iterations
+    unsigned long total_numsetups;  ///< cumulative number of calls to the solver's Setup function
+    unsigned long total_numsolves;  ///< cumulative number of calls to the solver's Solve function
+
+    JacobianUpdate jacobian_update;  ///< Newton matrix update policy
+    double jacobian_reuse_rate;      ///< maximum convergence rate with an out-of-date matrix (AUTOMATIC policy)
+    bool jacobian_valid;             ///< was the Newton matrix evaluated (solver Setup called) before?
+    double jacobian_h;               ///< step size at last Newton matrix update
+    unsigned int jacobian_nv;        ///< number of velocity-level coordinates at last Newton matrix update
+    unsigned int jacobian_nc;        ///< number of constraints at last Newton matrix update
+
   public:
     ChImplicitIterativeTimestepper()
-        : maxiters(6), reltol(1e-4), abstolS(1e-10), abstolL(1e-10), numiters(0), numsetups(0), numsolves(0) {}
+        : maxiters(6),
+          reltol(1e-4),
+          abstolS(1e-10),
+          abstolL(1e-10),
+          numiters(0),
+          numsetups(0),
+          numsolves(0),
+          total_numiters(0),
+          total_numsetups(0),
+          total_numsolves(0),
+          jacobian_update(JacobianUpdate::EVERY_ITERATION),
+          jacobian_reuse_rate(0.5),
+          jacobian_valid(false),
+          jacobian_h(0),
+          jacobian_nv(0),
+          jacobian_nc(0) {}
     virtual ~ChImplicitIterativeTimestepper() {}
 
     /// Set the max number of iterations using the Newton Raphson procedure
@@ -284,6 +329,42 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     /// Return the number of calls to the solver's Solve function.
     unsigned int GetNumSolveCalls() const { return numsolves; }
 
+    /// Set the policy for updating the Newton matrix.
+    /// With the AUTOMATIC policy, the Newton matrix (and its factorization, for a direct solver) is kept across steps
+    /// and updated only if:
+    /// - the step size or the problem size (number of coordinates or constraints) changed since the last update, or
+    /// - the Newton iteration converges too slowly with an out-of-date matrix (see SetJacobianReuseRate), or
+    /// - the Newton iteration fails to converge with an out-of-date matrix (in which case the step is re-attempted).
+    /// This is appropriate for problems where the Newton matrix changes slowly between steps.
+    void SetJacobianUpdateMethod(JacobianUpdate method) { jacobian_update = method; }
+
+    /// Get the current policy for updating the Newton matrix.
+    JacobianUpdate GetJacobianUpdateMethod() const { return jacobian_update; }
+
+    /// Set the maximum convergence rate accepted with an out-of-date Newton matrix (AUTOMATIC policy, default: 0.5).
+    /// The convergence rate is estimated as the ratio of the norms of successive Newton increments. If it exceeds this
+    /// value, the Newton matrix is updated at the next iteration.
+    void SetJacobianReuseRate(double rate) { jacobian_reuse_rate = rate; }
+
+    /// Get the maximum convergence rate accepted with an out-of-date Newton matrix.
+    double GetJacobianReuseRate() const { return jacobian_reuse_rate; }
+
+    /// Return the cumulative number of iterations (since construction or last call to ResetTotalCounters).
+    unsigned long GetTotalNumIterations() const { return total_numiters; }
+
+    /// Return the cumulative number of calls to the solver's Setup function (e.g., matrix factorizations).
+    unsigned long GetTotalNumSetupCalls() const { return total_numsetups; }
+
+    /// Return the cumulative number of calls to the solver's Solve function.
+    unsigned long GetTotalNumSolveCalls() const { return total_numsolves; }
+
+    /// Reset the cumulative counters of iterations, solver Setup calls, and solver Solve calls.
+    void ResetTotalCounters() {
+        total_numiters = 0;
+        total_numsetups = 0;
+        total_numsolves = 0;
+    }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive) {
         // version number
@@ -305,6 +386,36 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
         archive >> CHNVP(abstolS);
         archive >> CHNVP(abstolL);
     }
+
+  protected:
+    /// Return true if the Newton matrix must be updated at the first iteration of a step with given step size and
+    /// problem size, according to the current update policy.
+    bool JacobianUpdateRequired(double h, unsigned int nv, unsigned int nc) const {
+        if (jacobian_update != JacobianUpdate::AUTOMATIC)
+            return true;
+        return !jacobian_valid || h != jacobian_h || nv != jacobian_nv || nc != jacobian_nc;
+    }
+
+    /// Return true if the Newton matrix must be updated because of slow convergence, given the norms of the current and
+    /// previous Newton increments (AUTOMATIC policy only).
+    bool JacobianReuseFailed(double nrm, double nrm_prev) const {
+        return jacobian_update == JacobianUpdate::AUTOMATIC && nrm > jacobian_reuse_rate * nrm_prev;
+    }
+
+    /// Record an update of the Newton matrix for the given step size and problem size.
+    void SetJacobianUpdated(double h, unsigned int nv, unsigned int nc) {
+        jacobian_valid = true;
+        jacobian_h = h;
+        jacobian_nv = nv;
+        jacobian_nc = nc;
+    }
+
+    /// Add the counters for the current step to the cumulative counters.
+    void AccumulateCounters() {
+        total_numiters += numiters;
+        total_numsetups += numsetups;
+        total_numsolves += numsolves;
+    }
 };
 
 /// Euler explicit timestepper.
@@ -449,6 +560,7 @@ class ChApi ChTimestepperLeapfrog : public ChTimestepperIIorder, public ChExplic
 };
 
 /// Performs a step of Euler implicit for II order systems.
+/// All Newton matrix update policies are supported (default: JacobianUpdate::EVERY_ITERATION).
 class ChApi ChTimestepperEulerImplicit : public ChTimestepperIIorder, public ChImplicitIterativeTimestepper {
   protected:
     ChStateDelta Dv;
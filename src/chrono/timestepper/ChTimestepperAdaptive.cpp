@@ -0,0 +1,365 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include "chrono/timestepper/ChTimestepperAdaptive.h"
+#include "chrono/utils/ChProfiler.h"
+
+namespace chrono {
+
+// -----------------------------------------------------------------------------
+
+// Weighted RMS norm of the local error e, with weights based on the states y0 and y1 at both ends of the step.
+static double ErrorNorm(ChVectorConstRef e,
+                        ChVectorConstRef y0,
+                        ChVectorConstRef y1,
+                        double rel_tol,
+                        double abs_tol) {
+    if (e.size() == 0)
+        return 0;
+
+    double sum = 0;
+    for (Eigen::Index i = 0; i < e.size(); i++) {
+        double scale = abs_tol + rel_tol * std::max(std::abs(y0(i)), std::abs(y1(i)));
+        double ratio = e(i) / scale;
+        sum += ratio * ratio;
+    }
+    return std::sqrt(sum / e.size());
+}
+
+// Factor applied to the step size after a step with the given error norm, for a local error of order 'order'+1.
+// The step size is not increased after a rejected step.
+static double StepFactor(double err, int order, bool accepted) {
+    const double safety = 0.9;
+    const double fac_min = 0.2;
+    const double fac_max = accepted ? 5.0 : 1.0;
+
+    if (err <= 0)
+        return fac_max;
+    double fac = safety * std::pow(err, -1.0 / (order + 1));
+    return std::min(fac_max, std::max(fac_min, fac));
+}
+
+// -----------------------------------------------------------------------------
+
+// Coefficients of an embedded Runge-Kutta pair with the "first same as last" property: the weights of the higher order
+// method coincide with the last row of stage coefficients.
+struct ChTimestepperRungeKuttaAdaptive::Tableau {
+    unsigned int num_stages;  // number of stages s
+    int order;                // order of the embedded lower order method
+    const double* a;          // s x s matrix of stage coefficients (row major, lower triangular)
+    const double* b_low;      // weights of the embedded lower order method
+    const double* c;          // stage times
+};
+
+static const double BS_a[] = {
+    0,       0,       0,       0,  //
+    1.0 / 2, 0,       0,       0,  //
+    0,       3.0 / 4, 0,       0,  //
+    2.0 / 9, 1.0 / 3, 4.0 / 9, 0   //
+};
+static const double BS_b_low[] = {7.0 / 24, 1.0 / 4, 1.0 / 3, 1.0 / 8};
+static const double BS_c[] = {0, 1.0 / 2, 3.0 / 4, 1};
+
+static const double DP_a[] = {
+    0, 0, 0, 0, 0, 0, 0,                                                                    //
+    1.0 / 5, 0, 0, 0, 0, 0, 0,                                                              //
+    3.0 / 40, 9.0 / 40, 0, 0, 0, 0, 0,                                                      //
+    44.0 / 45, -56.0 / 15, 32.0 / 9, 0, 0, 0, 0,                                            //
+    19372.0 / 6561, -25360.0 / 2187, 64448.0 / 6561, -212.0 / 729, 0, 0, 0,                 //
+    9017.0 / 3168, -355.0 / 33, 46732.0 / 5247, 49.0 / 176, -5103.0 / 18656, 0, 0,          //
+    35.0 / 384, 0, 500.0 / 1113, 125.0 / 192, -2187.0 / 6784, 11.0 / 84, 0                  //
+};
+static const double DP_b_low[] = {5179.0 / 57600, 0,           7571.0 / 16695, 393.0 / 640, -92097.0 / 339200,
+                                  187.0 / 2100,   1.0 / 40};
+static const double DP_c[] = {0, 1.0 / 5, 3.0 / 10, 4.0 / 5, 8.0 / 9, 1, 1};
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChTimestepperRungeKuttaAdaptive)
+CH_UPCASTING(ChTimestepperRungeKuttaAdaptive, ChTimestepperIorder)
+CH_UPCASTING(ChTimestepperRungeKuttaAdaptive, ChExplicitTimestepper)
+
+ChTimestepperRungeKuttaAdaptive::ChTimestepperRungeKuttaAdaptive(ChIntegrable* intgr, Method method)
+    : ChTimestepperIorder(intgr),
+      m_rel_tol(1e-4),
+      m_abs_tol(1e-6),
+      m_h_min(1e-10),
+      m_h_max(0),
+      m_h(0),
+      m_num_accepted(0),
+      m_num_rejected(0) {
+    SetMethod(method);
+}
+
+void ChTimestepperRungeKuttaAdaptive::SetMethod(Method method) {
+    static const Tableau bogacki_shampine = {4, 2, BS_a, BS_b_low, BS_c};
+    static const Tableau dormand_prince = {7, 4, DP_a, DP_b_low, DP_c};
+
+    m_method = method;
+    m_tableau = (method == Method::BOGACKI_SHAMPINE) ? &bogacki_shampine : &dormand_prince;
+}
+
+void ChTimestepperRungeKuttaAdaptive::SetTolerances(double rel_tol, double abs_tol) {
+    m_rel_tol = rel_tol;
+    m_abs_tol = abs_tol;
+}
+
+// Performs a step of an embedded Runge-Kutta pair, as a sequence of error-controlled internal steps.
+void ChTimestepperRungeKuttaAdaptive::Advance(const double dt) {
+    const unsigned int s = m_tableau->num_stages;
+
+    // setup main vectors
+    GetIntegrable()->StateSetup(Y, dYdt);
+
+    // setup auxiliary vectors
+    int n_y = (GetIntegrable()->GetNumCoordsPosLevel() + GetIntegrable()->GetNumCoordsVelLevel());
+    int n_dy = (GetIntegrable()->GetNumCoordsVelLevel() + GetIntegrable()->GetNumCoordsAccLevel());
+    int n_c = GetIntegrable()->GetNumConstraints();
+    m_K.resize(s);
+    for (auto& K : m_K)
+        K.setZero(n_dy, GetIntegrable());
+    m_y_stage.setZero(n_y, GetIntegrable());
+    m_y_new.setZero(n_y, GetIntegrable());
+    m_y_low.setZero(n_y, GetIntegrable());
+    m_Dy.setZero(n_dy, GetIntegrable());
+    m_sum.setZero(n_dy);
+    L.setZero(n_c);
+
+    GetIntegrable()->StateGather(Y, T);  // state <- system
+
+    // The derivative at the beginning of the step is not reused from the previous call, since the integrable object
+    // (e.g. the set of contacts) may have changed in between.
+    GetIntegrable()->StateSolve(m_K[0], L, Y, T, dt,
+                                false,              // no need to scatter state before computation
+                                false,              // full update? (not used since no scatter)
+                                lumping_parameters  // optional lumping?
+    );
+
+    const double t_end = T + dt;
+    if (m_h <= 0)
+        m_h = dt;
+
+    bool done = false;
+    while (!done) {
+        // Size of the internal step, stretched to the end of the interval to avoid a final sliver step
+        double h = (m_h_max > 0) ? std::min(m_h, m_h_max) : m_h;
+        bool truncated = false;
+        if (T + 1.01 * h >= t_end) {
+            truncated = (t_end - T) < h;
+            h = t_end - T;
+            done = true;
+        }
+
+        // Stages (the last one is evaluated at the new state of the higher order method)
+        for (unsigned int i = 1; i < s; i++) {
+            m_sum.setZero();
+            for (unsigned int j = 0; j < i; j++) {
+                double a = m_tableau->a[i * s + j];
+                if (a != 0)
+                    m_sum += (h * a) * m_K[j];
+            }
+            m_Dy = m_sum;
+            m_y_stage = Y + m_Dy;  // integrable.StateIncrement(...);
+            GetIntegrable()->StateSolve(m_K[i], L, m_y_stage, T + m_tableau->c[i] * h, h, true, true,
+                                        lumping_parameters);
+        }
+        m_y_new = m_y_stage;
+
+        // Embedded lower order solution and local error
+        m_sum.setZero();
+        for (unsigned int j = 0; j < s; j++)
+            m_sum += (h * m_tableau->b_low[j]) * m_K[j];
+        m_Dy = m_sum;
+        m_y_low = Y + m_Dy;  // integrable.StateIncrement(...);
+
+        double err = ErrorNorm(m_y_new - m_y_low, Y, m_y_new, m_rel_tol, m_abs_tol);
+        bool accepted = (err <= 1) || (h <= m_h_min);
+
+        if (accepted) {
+            m_num_accepted++;
+            Y = m_y_new;
+            T += h;
+            m_K[0] = m_K[s - 1];  // first same as last
+        } else {
+            m_num_rejected++;
+            done = false;
+        }
+
+        // Next step size; a step shortened to reach the end of the interval does not reduce it
+        double h_next = h * StepFactor(err, m_tableau->order, accepted);
+        m_h = (accepted && truncated) ? std::max(m_h, h_next) : h_next;
+        m_h = std::max(m_h, m_h_min);
+    }
+
+    dYdt = m_K[0];
+
+    GetIntegrable()->StateScatter(Y, T, true);      // state -> system
+    GetIntegrable()->StateScatterDerivative(dYdt);  // -> system auxiliary data
+    GetIntegrable()->StateScatterReactions(L);      // -> system auxiliary data
+}
+
+// Trick to avoid putting the following mapper macro inside the class definition in .h file:
+// enclose macros in local 'ChTimestepperRungeKuttaAdaptive_Method_enum_mapper'.
+class ChTimestepperRungeKuttaAdaptive_Method_enum_mapper : public ChTimestepperRungeKuttaAdaptive {
+  public:
+    CH_ENUM_MAPPER_BEGIN(Method);
+    CH_ENUM_VAL(Method::BOGACKI_SHAMPINE);
+    CH_ENUM_VAL(Method::DORMAND_PRINCE);
+    CH_ENUM_MAPPER_END(Method);
+};
+
+void ChTimestepperRungeKuttaAdaptive::ArchiveOut(ChArchiveOut& archive) {
+    // version number
+    archive.VersionWrite<ChTimestepperRungeKuttaAdaptive>();
+    // serialize parent class:
+    ChTimestepperIorder::ArchiveOut(archive);
+    ChExplicitTimestepper::ArchiveOut(archive);
+    // serialize all member data:
+    ChTimestepperRungeKuttaAdaptive_Method_enum_mapper::Method_mapper methodmapper;
+    archive << CHNVP(methodmapper(m_method), "method");
+    archive << CHNVP(m_rel_tol);
+    archive << CHNVP(m_abs_tol);
+    archive << CHNVP(m_h_min);
+    archive << CHNVP(m_h_max);
+}
+
+void ChTimestepperRungeKuttaAdaptive::ArchiveIn(ChArchiveIn& archive) {
+    // version number
+    /*int version =*/archive.VersionRead<ChTimestepperRungeKuttaAdaptive>();
+    // deserialize parent class:
+    ChTimestepperIorder::ArchiveIn(archive);
+    ChExplicitTimestepper::ArchiveIn(archive);
+    // stream in all member data:
+    ChTimestepperRungeKuttaAdaptive_Method_enum_mapper::Method_mapper methodmapper;
+    Method method = m_method;
+    archive >> CHNVP(methodmapper(method), "method");
+    SetMethod(method);
+    archive >> CHNVP(m_rel_tol);
+    archive >> CHNVP(m_abs_tol);
+    archive >> CHNVP(m_h_min);
+    archive >> CHNVP(m_h_max);
+}
+
+// -----------------------------------------------------------------------------
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChTimestepperEulerIMEXAdaptive)
+CH_UPCASTING(ChTimestepperEulerIMEXAdaptive, ChTimestepperEulerImplicitLinearized)
+
+ChTimestepperEulerIMEXAdaptive::ChTimestepperEulerIMEXAdaptive(ChIntegrableIIorder* intgr)
+    : ChTimestepperEulerImplicitLinearized(intgr),
+      m_rel_tol(1e-3),
+      m_abs_tol(1e-4),
+      m_h_min(1e-6),
+      m_h_max(0),
+      m_h(0),
+      m_num_accepted(0),
+      m_num_rejected(0),
+      m_acc_valid(false) {}
+
+void ChTimestepperEulerIMEXAdaptive::SetTolerances(double rel_tol, double abs_tol) {
+    m_rel_tol = rel_tol;
+    m_abs_tol = abs_tol;
+}
+
+// Performs a step of linearized Euler implicit for II order systems, as a sequence of error-controlled internal steps.
+void ChTimestepperEulerIMEXAdaptive::Advance(const double dt) {
+    CH_PROFILE("EulerIMEXAdaptive");
+
+    // downcast
+    ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
+
+    // setup main vectors
+    mintegrable->StateSetup(X, V, A);
+    mintegrable->StateSetup(m_X0, m_V0, m_A0);
+
+    mintegrable->StateGather(X, V, T);        // state <- system
+    mintegrable->StateGatherAcceleration(A);  // accelerations at the end of the last step
+
+    const double t_end = T + dt;
+    if (m_h <= 0)
+        m_h = dt;
+
+    bool done = false;
+    while (!done) {
+        // Size of the internal step, stretched to the end of the interval to avoid a final sliver step
+        double h = (m_h_max > 0) ? std::min(m_h, m_h_max) : m_h;
+        bool truncated = false;
+        if (T + 1.01 * h >= t_end) {
+            truncated = (t_end - T) < h;
+            h = t_end - T;
+            done = true;
+        }
+
+        m_X0 = X;
+        m_V0 = V;
+        m_A0 = A;
+        double T0 = T;
+
+        // Linearized implicit Euler step (state -> system at T+h)
+        ChTimestepperEulerImplicitLinearized::Advance(h);
+        A = (V - Vold) * (1 / h);
+
+        // Local error: difference with the trapezoidal rule velocity update
+        double err = m_acc_valid ? ErrorNorm((A - m_A0) * (0.5 * h), m_V0, V, m_rel_tol, m_abs_tol) : 0;
+        bool accepted = !m_acc_valid || (err <= 1) || (h <= m_h_min);
+
+        if (accepted) {
+            m_num_accepted++;
+            m_acc_valid = true;
+        } else {
+            m_num_rejected++;
+            done = false;
+            X = m_X0;
+            V = m_V0;
+            A = m_A0;
+            T = T0;
+            mintegrable->StateScatter(X, V, T, true);  // state -> system
+            mintegrable->StateScatterAcceleration(A);  // -> system auxiliary data
+        }
+
+        // Next step size; a step shortened to reach the end of the interval does not reduce it
+        double h_next = h * StepFactor(err, 1, accepted);
+        m_h = (accepted && truncated) ? std::max(m_h, h_next) : h_next;
+        m_h = std::max(m_h, m_h_min);
+    }
+}
+
+void ChTimestepperEulerIMEXAdaptive::ArchiveOut(ChArchiveOut& archive) {
+    // version number
+    archive.VersionWrite<ChTimestepperEulerIMEXAdaptive>();
+    // serialize parent class:
+    ChTimestepperEulerImplicitLinearized::ArchiveOut(archive);
+    // serialize all member data:
+    archive << CHNVP(m_rel_tol);
+    archive << CHNVP(m_abs_tol);
+    archive << CHNVP(m_h_min);
+    archive << CHNVP(m_h_max);
+}
+
+void ChTimestepperEulerIMEXAdaptive::ArchiveIn(ChArchiveIn& archive) {
+    // version number
+    /*int version =*/archive.VersionRead<ChTimestepperEulerIMEXAdaptive>();
+    // deserialize parent class:
+    ChTimestepperEulerImplicitLinearized::ArchiveIn(archive);
+    // stream in all member data:
+    archive >> CHNVP(m_rel_tol);
+    archive >> CHNVP(m_abs_tol);
+    archive >> CHNVP(m_h_min);
+    archive >> CHNVP(m_h_max);
+}
+
+}  // end namespace chrono
@@ -0,0 +1,185 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHTIMESTEPPER_ADAPTIVE_H
+#define CHTIMESTEPPER_ADAPTIVE_H
+
+#include <vector>
+
+#include "chrono/timestepper/ChTimestepper.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_timestepper
+/// @{
+
+/// Adaptive explicit Runge-Kutta integrator, based on an embedded pair of methods.
+/// Each internal step is computed with a method of order p and with an embedded method of order p-1 sharing the same
+/// stages; their difference estimates the local error, which drives the size of the internal steps. A call to
+/// Advance(dt) covers the interval [T, T+dt] with as many internal steps as needed to satisfy the tolerances, and the
+/// internal step size is carried over to the following call. Both available pairs have the "first same as last"
+/// property, so that an accepted step of a method with s stages requires s-1 evaluations of the state derivative.
+class ChApi ChTimestepperRungeKuttaAdaptive : public ChTimestepperIorder, public ChExplicitTimestepper {
+  public:
+    /// Embedded Runge-Kutta pairs.
+    enum class Method {
+        BOGACKI_SHAMPINE,  ///< 3rd order method with embedded 2nd order method, 4 stages
+        DORMAND_PRINCE     ///< 5th order method with embedded 4th order method, 7 stages
+    };
+
+    ChTimestepperRungeKuttaAdaptive(ChIntegrable* intgr = nullptr, Method method = Method::DORMAND_PRINCE);
+
+    virtual Type GetType() const override { return Type::RUNGEKUTTA_ADAPTIVE; }
+
+    /// Set the embedded Runge-Kutta pair.
+    /// Default: DORMAND_PRINCE.
+    void SetMethod(Method method);
+
+    /// Return the embedded Runge-Kutta pair.
+    Method GetMethod() const { return m_method; }
+
+    /// Set the relative and absolute tolerances on the local error.
+    /// An internal step is accepted if the RMS norm of the local error, with the i-th state component weighted by
+    /// 1/(abs_tol + rel_tol * |y_i|), does not exceed 1.
+    /// Default: rel_tol = 1e-4, abs_tol = 1e-6.
+    void SetTolerances(double rel_tol, double abs_tol);
+
+    /// Set the minimum internal step size.
+    /// Internal steps of this size are accepted regardless of their error.
+    /// Default: 1e-10.
+    void SetMinStepSize(double step) { m_h_min = step; }
+
+    /// Set the maximum internal step size (0 for no limit other than the step passed to Advance).
+    /// Default: 0.
+    void SetMaxStepSize(double step) { m_h_max = step; }
+
+    /// Set the size of the next internal step (0 to start from the step passed to Advance).
+    /// Default: 0.
+    void SetInitialStepSize(double step) { m_h = step; }
+
+    /// Return the size of the next internal step, as estimated from the error of the last one.
+    double GetStepSize() const { return m_h; }
+
+    /// Return the cumulative number of accepted internal steps.
+    unsigned int GetNumStepsAccepted() const { return m_num_accepted; }
+
+    /// Return the cumulative number of rejected internal steps.
+    unsigned int GetNumStepsRejected() const { return m_num_rejected; }
+
+    /// Performs an integration timestep, as a sequence of internal steps.
+    virtual void Advance(const double dt  ///< timestep to advance
+                         ) override;
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOut(ChArchiveOut& archive) override;
+
+    /// Method to allow de-serialization of transient data from archives.
+    virtual void ArchiveIn(ChArchiveIn& archive) override;
+
+  private:
+    struct Tableau;
+
+    Method m_method;              ///< embedded pair
+    const Tableau* m_tableau;     ///< coefficients of the embedded pair
+    double m_rel_tol;             ///< relative tolerance
+    double m_abs_tol;             ///< absolute tolerance
+    double m_h_min;               ///< minimum internal step size
+    double m_h_max;               ///< maximum internal step size (0 if unlimited)
+    double m_h;                   ///< size of the next internal step
+    unsigned int m_num_accepted;  ///< number of accepted internal steps
+    unsigned int m_num_rejected;  ///< number of rejected internal steps
+
+    std::vector<ChStateDelta> m_K;  ///< stage derivatives
+    ChState m_y_stage;              ///< stage state
+    ChState m_y_new;                ///< state from the higher order method
+    ChState m_y_low;                ///< state from the embedded lower order method
+    ChStateDelta m_Dy;              ///< state increment
+    ChVectorDynamic<> m_sum;        ///< accumulator of the stage derivatives
+};
+
+/// Adaptive linearly implicit Euler integrator for II order systems.
+/// Each internal step is a step of ChTimestepperEulerImplicitLinearized, which is implicit in the forces that provide
+/// their stiffness and damping Jacobians (FEA elements, springs, dampers, bushings, ...) and explicit in all other
+/// forces, so that stiff force elements do not limit the step size. The local error of each internal step is estimated
+/// from the velocity difference with the trapezoidal rule, using the accelerations at both ends of the step:
+/// e = h/2 (a_new - a_old). The step size is reduced where the accelerations change quickly (impacts, switching
+/// forces, ...) and increased again where the motion is smooth. A call to Advance(dt) covers the interval [T, T+dt]
+/// with as many internal steps as needed to satisfy the tolerances.
+/// Since the accelerations at the beginning of the very first step are not known, that step is not error-controlled.
+/// Note that impulsive (NSC) contacts produce velocity jumps which do not vanish with the step size; such steps are
+/// accepted once the minimum step size is reached.
+class ChApi ChTimestepperEulerIMEXAdaptive : public ChTimestepperEulerImplicitLinearized {
+  public:
+    ChTimestepperEulerIMEXAdaptive(ChIntegrableIIorder* intgr = nullptr);
+
+    virtual Type GetType() const override { return Type::EULER_IMEX_ADAPTIVE; }
+
+    /// Set the relative and absolute tolerances on the local velocity error.
+    /// An internal step is accepted if the RMS norm of the local error, with the i-th velocity component weighted by
+    /// 1/(abs_tol + rel_tol * |v_i|), does not exceed 1.
+    /// Default: rel_tol = 1e-3, abs_tol = 1e-4.
+    void SetTolerances(double rel_tol, double abs_tol);
+
+    /// Set the minimum internal step size.
+    /// Internal steps of this size are accepted regardless of their error.
+    /// Default: 1e-6.
+    void SetMinStepSize(double step) { m_h_min = step; }
+
+    /// Set the maximum internal step size (0 for no limit other than the step passed to Advance).
+    /// Default: 0.
+    void SetMaxStepSize(double step) { m_h_max = step; }
+
+    /// Set the size of the next internal step (0 to start from the step passed to Advance).
+    /// Default: 0.
+    void SetInitialStepSize(double step) { m_h = step; }
+
+    /// Return the size of the next internal step, as estimated from the error of the last one.
+    double GetStepSize() const { return m_h; }
+
+    /// Return the cumulative number of accepted internal steps.
+    unsigned int GetNumStepsAccepted() const { return m_num_accepted; }
+
+    /// Return the cumulative number of rejected internal steps.
+    unsigned int GetNumStepsRejected() const { return m_num_rejected; }
+
+    /// Performs an integration timestep, as a sequence of internal steps.
+    virtual void Advance(const double dt  ///< timestep to advance
+                         ) override;
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOut(ChArchiveOut& archive) override;
+
+    /// Method to allow de-serialization of transient data from archives.
+    virtual void ArchiveIn(ChArchiveIn& archive) override;
+
+  private:
+    double m_rel_tol;             ///< relative tolerance
+    double m_abs_tol;             ///< absolute tolerance
+    double m_h_min;               ///< minimum internal step size
+    double m_h_max;               ///< maximum internal step size (0 if unlimited)
+    double m_h;                   ///< size of the next internal step
+    unsigned int m_num_accepted;  ///< number of accepted internal steps
+    unsigned int m_num_rejected;  ///< number of rejected internal steps
+    bool m_acc_valid;             ///< true if the accelerations at the beginning of the step are known
+
+    ChState m_X0;       ///< positions at the beginning of the internal step
+    ChStateDelta m_V0;  ///< velocities at the beginning of the internal step
+    ChStateDelta m_A0;  ///< accelerations at the beginning of the internal step
+};
+
+/// @} chrono_timestepper
+
+}  // end namespace chrono
+
+#endif
@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/utils/ChProfiler.h"
 
 namespace chrono {
 
@@ -33,9 +34,9 @@ ChTimestepperHHT::ChTimestepperHHT(ChIntegrableIIorder* intgr)
       step_decrease_factor(0.5),
       h_min(1e-10),
       h(1e6),
-      num_successful_steps(0),
-      modified_Newton(true) {
+      num_successful_steps(0) {
     SetAlpha(-0.2);  // default: some dissipation
+    jacobian_update = JacobianUpdate::EVERY_STEP;
 }
 
 void ChTimestepperHHT::SetAlpha(double val) {
@@ -50,6 +51,8 @@ void ChTimestepperHHT::SetAlpha(double val) {
 
 // Performs a step of HHT (generalized alpha) implicit for II order systems
 void ChTimestepperHHT::Advance(const double dt) {
+    CH_PROFILE("HHT");
+
     // Downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -101,13 +104,22 @@ void ChTimestepperHHT::Advance(const double dt) {
     // If using modified Newton, a matrix update occurs:
     //   - at the beginning of a step
     //   - on a stepsize decrease
-    //   - if the Newton iteration does not converge with an out-of-date matrix
+    // If using automatic updates, a matrix update occurs:
+    //   - at the beginning of a step attempt, if the stepsize or problem size changed since the last update
+    //   - on a stepsize decrease
+    //   - if the Newton iteration converges too slowly with an out-of-date matrix
+    //   - if the Newton iteration does not converge with an out-of-date matrix (and the step is re-attempted)
     // Otherwise, the matrix is updated at each iteration.
-    matrix_is_current = false;
-    call_setup = true;
+    unsigned int n_v = mintegrable->GetNumCoordsVelLevel();
+    unsigned int n_c = mintegrable->GetNumConstraints();
+    call_setup = (jacobian_update != JacobianUpdate::AUTOMATIC);
 
     // Loop until reaching final time
     while (true) {
+        if (jacobian_update == JacobianUpdate::AUTOMATIC && JacobianUpdateRequired(h, n_v, n_c))
+            call_setup = true;
+        matrix_is_current = false;
+
         Prepare(mintegrable);
 
         // Newton for state at T+h
@@ -117,7 +129,9 @@ void ChTimestepperHHT::Advance(const double dt) {
         unsigned int it;
 
         for (it = 0; it < maxiters; it++) {
-            if (verbose && modified_Newton && call_setup)
+            CH_PROFILE("NewtonIteration");
+
+            if (verbose && jacobian_update != JacobianUpdate::EVERY_ITERATION && call_setup)
                 std::cout << " HHT call Setup." << std::endl;
 
             // Solve linear system and increment state
@@ -128,17 +142,36 @@ void ChTimestepperHHT::Advance(const double dt) {
             numsolves++;
             if (call_setup) {
                 numsetups++;
+                matrix_is_current = true;
+                SetJacobianUpdated(h, n_v, n_c);
             }
 
-            // If using modified Newton, do not call Setup again
-            call_setup = !modified_Newton;
-
             // Check convergence
             converged = CheckConvergence(it);
             if (converged)
                 break;
+
+            // Decide whether the Newton matrix must be updated at the next iteration.
+            // With automatic updates, do so if the last increment was obtained with an out-of-date matrix and the
+            // iteration contracts too slowly.
+            switch (jacobian_update) {
+                case JacobianUpdate::EVERY_ITERATION:
+                    call_setup = true;
+                    break;
+                case JacobianUpdate::EVERY_STEP:
+                    call_setup = false;
+                    break;
+                case JacobianUpdate::AUTOMATIC:
+                    call_setup = !call_setup && it > 0 &&
+                                 JacobianReuseFailed(Da_nrm_hist[it % 3], Da_nrm_hist[(it - 1) % 3]);
+                    break;
+            }
         }
 
+        // Do not call Setup when continuing with the next step, unless required
+        if (converged && jacobian_update != JacobianUpdate::EVERY_ITERATION)
+            call_setup = false;
+
         if (converged) {
             // ------ NR converged
 
@@ -166,20 +199,18 @@ void ChTimestepperHHT::Advance(const double dt) {
             A = Anew;
             L = Lnew;
 
-            /*
-            } else if (!matrix_is_current) {
-                // ------ NR did not converge but the matrix was out-of-date
+        } else if (!matrix_is_current) {
+            // ------ NR did not converge but the matrix was out-of-date
 
-                // reset the count of successive successful steps
-                num_successful_steps = 0;
+            // reset the count of successive successful steps
+            num_successful_steps = 0;
 
-                // re-attempt step with updated matrix
-                if (verbose) {
-                    std::cout << " HHT re-attempt step with updated matrix." << std::endl;
-                }
+            // re-attempt step with updated matrix
+            if (verbose) {
+                std::cout << " HHT re-attempt step with updated matrix." << std::endl;
+            }
 
-                call_setup = true;
-            */
+            call_setup = true;
 
         } else if (!step_control) {
             // ------ NR did not converge and we do not control stepsize
@@ -239,6 +270,8 @@ void ChTimestepperHHT::Advance(const double dt) {
     // Scatter auxiliary data (A and L) -> system
     mintegrable->StateScatterAcceleration(A);
     mintegrable->StateScatterReactions(L);
+
+    AccumulateCounters();
 }
 
 // Prepare attempting a step of size h (assuming a converged state at the current time t):
@@ -275,20 +308,17 @@ void ChTimestepperHHT::Prepare(ChIntegrableIIorder* integrable) {
 //                [  1/(beta*h^2)*C                                                                ]
 //
 void ChTimestepperHHT::Increment(ChIntegrableIIorder* integrable) {
-    // Scatter the current estimate of state at time T+h
-    integrable->StateScatter(Xnew, Vnew, T + h, false);
-
     // Initialize the two segments of the RHS
     R = Rold;      // terms related to state at time T
     Qc.setZero();  // zero
 
-    // Set up linear system
-    integrable->LoadResidual_F(R, 1.0);                      //  f_new
-    integrable->LoadResidual_CqL(R, Lnew, 1.0);              //  Cq'*l_new
-    integrable->LoadResidual_Mv(R, Anew, -1 / (1 + alpha));  // -1/(1+alpha)*M*a_new
-    integrable->LoadConstraint_C(
-        Qc, 1 / (beta * h * h), Qc_do_clamp,
-        Qc_clamping);  //  Qc= 1/(beta*h^2)*C  (sign will be flipped later in StateSolveCorrection)
+    // Scatter the current estimate of state at time T+h and set up linear system
+    //   R += f_new + Cq'*l_new - 1/(1+alpha)*M*a_new
+    //   Qc = 1/(beta*h^2)*C  (sign will be flipped later in StateSolveCorrection)
+    integrable->StateScatterLoadResiduals(Xnew, Vnew, T + h, false,                        //
+                                          R, Qc, Anew, Lnew,                               //
+                                          1.0, -1 / (1 + alpha), 1.0, 1 / (beta * h * h),  //
+                                          Qc_do_clamp, Qc_clamping);
 
     // Solve linear system
     integrable->StateSolveCorrection(Da, Dl, R, Qc,
@@ -307,8 +337,6 @@ void ChTimestepperHHT::Increment(ChIntegrableIIorder* integrable) {
     Xnew = X + V * h + A * (h * h * (0.5 - beta)) + Anew * (h * h * beta);
     Vnew = V + A * (h * (1.0 - gamma)) + Anew * (h * gamma);
 
-    // If Setup was called at this iteration, mark the Newton matrix as up-to-date
-    matrix_is_current = call_setup;
 }
 
 // Convergence test
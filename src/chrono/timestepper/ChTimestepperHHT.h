@@ -25,6 +25,9 @@ namespace chrono {
 /// Implementation of the HHT implicit integrator for II order systems.
 /// This timestepper allows use of an adaptive time-step, as well as optional use of a modified
 /// Newton scheme for the solution of the resulting nonlinear problem.
+/// All Newton matrix update policies are supported (default: JacobianUpdate::EVERY_STEP). With the AUTOMATIC policy, a
+/// Newton iteration which fails to converge with an out-of-date matrix is re-attempted with an updated matrix before
+/// the step size is decreased.
 class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIterativeTimestepper {
   public:
     ChTimestepperHHT(ChIntegrableIIorder* intgr = nullptr);
@@ -72,8 +75,11 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     /// If enabled, the Newton matrix is evaluated, assembled, and factorized only once
     /// per step or if the Newton iteration does not converge with an out-of-date matrix.
     /// If disabled, the Newton matrix is evaluated at every iteration of the nonlinear solver.
+    /// Equivalent to SetJacobianUpdateMethod with EVERY_STEP or EVERY_ITERATION, respectively.
     /// Default: true.
-    void SetModifiedNewton(bool enable) { modified_Newton = enable; }
+    void SetModifiedNewton(bool enable) {
+        jacobian_update = enable ? JacobianUpdate::EVERY_STEP : JacobianUpdate::EVERY_ITERATION;
+    }
 
     /// Perform an integration timestep, by advancing the state by the specified time step.
     virtual void Advance(const double dt) override;
@@ -123,8 +129,7 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     double h;                           ///< internal stepsize
     unsigned int num_successful_steps;  ///< number of successful steps
 
-    bool modified_Newton;    ///< use modified Newton?
-    bool matrix_is_current;  ///< is the Newton matrix up-to-date?
+    bool matrix_is_current;  ///< was the Newton matrix updated during the current step attempt?
     bool call_setup;         ///< should the solver's Setup function be called?
 
     ChVectorDynamic<> ewtS;  ///< vector of error weights (states)
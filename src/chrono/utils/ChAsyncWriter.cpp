@@ -0,0 +1,87 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Background writer for simulation output.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/utils/ChAsyncWriter.h"
+
+namespace chrono {
+namespace utils {
+
+ChAsyncWriter::ChAsyncWriter(size_t max_pending) : m_max_pending(std::max<size_t>(max_pending, 1)), m_done(false) {
+    m_worker = std::thread(&ChAsyncWriter::Process, this);
+}
+
+ChAsyncWriter::~ChAsyncWriter() {
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done = true;
+    }
+    m_cv.notify_all();
+    m_worker.join();
+}
+
+void ChAsyncWriter::Submit(std::function<void()> task) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [this] { return m_queue.size() < m_max_pending; });
+    m_queue.push_back(std::move(task));
+    lock.unlock();
+    m_cv.notify_all();
+}
+
+void ChAsyncWriter::Flush() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [this] { return m_queue.empty(); });
+    if (m_error) {
+        auto error = m_error;
+        m_error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+size_t ChAsyncWriter::GetNumPending() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_queue.size();
+}
+
+void ChAsyncWriter::Process() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv.wait(lock, [this] { return m_done || !m_queue.empty(); });
+        if (m_queue.empty())
+            return;
+
+        // Execute the first task outside the lock; it is removed from the queue only once completed
+        auto& task = m_queue.front();
+        lock.unlock();
+        try {
+            task();
+        } catch (...) {
+            lock.lock();
+            if (!m_error)
+                m_error = std::current_exception();
+            lock.unlock();
+        }
+        lock.lock();
+        m_queue.pop_front();
+        m_cv.notify_all();
+    }
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,80 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Background writer for simulation output.
+//
+// =============================================================================
+
+#ifndef CH_ASYNC_WRITER_H
+#define CH_ASYNC_WRITER_H
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Background writer for simulation output.
+/// Output tasks (typically formatting and writing a snapshot of the simulation state, owned by the task) are executed
+/// in submission order on a worker thread. The queue of pending tasks is bounded: Submit blocks while the maximum
+/// number of tasks are pending, so that a slow output device throttles the simulation instead of growing memory
+/// without bound. An exception thrown by a task is rethrown by the next call to Flush (later tasks are still executed).
+class ChApi ChAsyncWriter {
+  public:
+    /// Create a writer with the specified maximum number of pending tasks and start its worker thread.
+    ChAsyncWriter(size_t max_pending = 8);
+
+    /// Execute all pending tasks and stop the worker thread.
+    ~ChAsyncWriter();
+
+    ChAsyncWriter(const ChAsyncWriter&) = delete;
+    ChAsyncWriter& operator=(const ChAsyncWriter&) = delete;
+
+    /// Add a task to the queue, waiting if the maximum number of tasks are pending.
+    void Submit(std::function<void()> task);
+
+    /// Wait until all submitted tasks are completed.
+    /// If a task failed since the last call, its exception is rethrown.
+    void Flush();
+
+    /// Get the number of pending tasks (including the one in execution).
+    size_t GetNumPending();
+
+  private:
+    void Process();
+
+    size_t m_max_pending;                        ///< maximum number of pending tasks
+    std::deque<std::function<void()>> m_queue;   ///< pending tasks (the first one may be in execution)
+    std::exception_ptr m_error;                  ///< first exception thrown by a task since the last flush
+    bool m_done;                                 ///< no more tasks will be submitted
+    std::mutex m_mutex;                          ///< guard for the queue
+    std::condition_variable m_cv;                ///< notification of queue changes
+    std::thread m_worker;                        ///< worker thread
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
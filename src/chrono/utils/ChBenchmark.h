@@ -45,6 +45,9 @@ class ChBenchmarkTest {
     void Simulate(int num_steps);
     void ResetTimers();
 
+    /// Report the accumulated timers (in ms) as counters of the given benchmark state.
+    void ReportTimers(benchmark::State& st) const;
+
     double m_timer_step;              ///< time for performing simulation
     double m_timer_advance;           ///< time for integration
     double m_timer_jacobian;          ///< time for evaluating/loading Jacobian data
@@ -100,6 +103,19 @@ inline void ChBenchmarkTest::ResetTimers() {
     m_timer_update = 0;
 }
 
+inline void ChBenchmarkTest::ReportTimers(benchmark::State& st) const {
+    st.counters["Step_Total"] = m_timer_step * 1e3;
+    st.counters["Step_Advance"] = m_timer_advance * 1e3;
+    st.counters["Step Setup"] = m_timer_setup * 1e3;
+    st.counters["Step_Update"] = m_timer_update * 1e3;
+    st.counters["LS_Jacobian"] = m_timer_jacobian * 1e3;
+    st.counters["LS_Setup"] = m_timer_ls_setup * 1e3;
+    st.counters["LS_Solve"] = m_timer_ls_solve * 1e3;
+    st.counters["CD_Total"] = m_timer_collision * 1e3;
+    st.counters["CD_Broad"] = m_timer_collision_broad * 1e3;
+    st.counters["CD_Narrow"] = m_timer_collision_narrow * 1e3;
+}
+
 // =============================================================================
 
 /// Define and register a test named TEST_NAME using the specified ChBenchmark TEST.
@@ -160,18 +176,7 @@ class ChBenchmarkFixture : public ::benchmark::Fixture {
 
     ~ChBenchmarkFixture() { delete m_test; }
 
-    void Report(benchmark::State& st) {
-        st.counters["Step_Total"] = m_test->m_timer_step * 1e3;
-        st.counters["Step_Advance"] = m_test->m_timer_advance * 1e3;
-        st.counters["Step Setup"] = m_test->m_timer_setup * 1e3;
-        st.counters["Step_Update"] = m_test->m_timer_update * 1e3;
-        st.counters["LS_Jacobian"] = m_test->m_timer_jacobian * 1e3;
-        st.counters["LS_Setup"] = m_test->m_timer_ls_setup * 1e3;
-        st.counters["LS_Solve"] = m_test->m_timer_ls_solve * 1e3;
-        st.counters["CD_Total"] = m_test->m_timer_collision * 1e3;
-        st.counters["CD_Broad"] = m_test->m_timer_collision_broad * 1e3;
-        st.counters["CD_Narrow"] = m_test->m_timer_collision_narrow * 1e3;
-    }
+    void Report(benchmark::State& st) { m_test->ReportTimers(st); }
 
     void Reset(int num_init_steps) {
         ////std::cout << "RESET" << std::endl;
@@ -0,0 +1,271 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Utilities for detecting performance regressions from the results of Chrono
+// benchmark tests, compared against stored baselines.
+//
+// =============================================================================
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <set>
+
+#include "chrono/utils/ChBenchmarkRegression.h"
+
+#include "chrono_thirdparty/rapidjson/document.h"
+#include "chrono_thirdparty/rapidjson/istreamwrapper.h"
+#include "chrono_thirdparty/rapidjson/prettywriter.h"
+#include "chrono_thirdparty/rapidjson/stringbuffer.h"
+
+namespace chrono {
+namespace utils {
+
+static bool ParseJSON(const std::string& filename, rapidjson::Document& d) {
+    std::ifstream ifs(filename);
+    if (!ifs.good()) {
+        std::cerr << "ChBenchmarkResults ERROR: cannot open " << filename << std::endl;
+        return false;
+    }
+    rapidjson::IStreamWrapper isw(ifs);
+    d.ParseStream(isw);
+    if (d.HasParseError() || !d.IsObject()) {
+        std::cerr << "ChBenchmarkResults ERROR: invalid JSON file " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool ChBenchmarkResults::AddBenchmarkOutput(const std::string& filename) {
+    rapidjson::Document d;
+    if (!ParseJSON(filename, d))
+        return false;
+    if (!d.HasMember("benchmarks") || !d["benchmarks"].IsArray()) {
+        std::cerr << "ChBenchmarkResults ERROR: no benchmark results in " << filename << std::endl;
+        return false;
+    }
+
+    // Numeric fields of a benchmark run which are not timing metrics
+    static const std::set<std::string> skipped = {"family_index", "per_family_instance_index", "repetitions",
+                                                  "repetition_index", "threads", "iterations"};
+
+    for (const auto& run : d["benchmarks"].GetArray()) {
+        if (!run.IsObject())
+            continue;
+        if (run.HasMember("run_type") && std::string(run["run_type"].GetString()) == "aggregate")
+            continue;
+        if (run.HasMember("aggregate_name"))
+            continue;
+        if (run.HasMember("error_occurred") && run["error_occurred"].IsBool() && run["error_occurred"].GetBool())
+            continue;
+
+        std::string name = run.HasMember("run_name") ? run["run_name"].GetString() : run["name"].GetString();
+        for (const auto& field : run.GetObject()) {
+            std::string metric = field.name.GetString();
+            if (field.value.IsNumber() && skipped.find(metric) == skipped.end())
+                AddSample(name, metric, field.value.GetDouble());
+        }
+    }
+
+    return true;
+}
+
+void ChBenchmarkResults::AddSample(const std::string& benchmark, const std::string& metric, double value) {
+    m_samples[benchmark][metric].push_back(value);
+}
+
+bool ChBenchmarkResults::WriteBaseline(const std::string& filename) const {
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+
+    writer.StartObject();
+    writer.Key("benchmarks");
+    writer.StartObject();
+    for (const auto& benchmark : m_samples) {
+        writer.Key(benchmark.first.c_str());
+        writer.StartObject();
+        for (const auto& metric : benchmark.second) {
+            writer.Key(metric.first.c_str());
+            writer.StartArray();
+            for (auto value : metric.second)
+                writer.Double(value);
+            writer.EndArray();
+        }
+        writer.EndObject();
+    }
+    writer.EndObject();
+    writer.EndObject();
+
+    std::ofstream ofs(filename);
+    ofs << buffer.GetString() << std::endl;
+    return ofs.good();
+}
+
+bool ChBenchmarkResults::ReadBaseline(const std::string& filename) {
+    rapidjson::Document d;
+    if (!ParseJSON(filename, d))
+        return false;
+    if (!d.HasMember("benchmarks") || !d["benchmarks"].IsObject()) {
+        std::cerr << "ChBenchmarkResults ERROR: " << filename << " is not a benchmark baseline file" << std::endl;
+        return false;
+    }
+
+    for (const auto& benchmark : d["benchmarks"].GetObject()) {
+        if (!benchmark.value.IsObject())
+            continue;
+        for (const auto& metric : benchmark.value.GetObject()) {
+            if (!metric.value.IsArray())
+                continue;
+            for (const auto& value : metric.value.GetArray()) {
+                if (value.IsNumber())
+                    AddSample(benchmark.name.GetString(), metric.name.GetString(), value.GetDouble());
+            }
+        }
+    }
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+// Continued fraction for the incomplete beta function (modified Lentz's method).
+static double BetaContinuedFraction(double a, double b, double x) {
+    const int max_iter = 200;
+    const double eps = 1e-14;
+    const double tiny = 1e-300;
+
+    double qab = a + b;
+    double qap = a + 1;
+    double qam = a - 1;
+    double c = 1;
+    double d = 1 - qab * x / qap;
+    if (std::abs(d) < tiny)
+        d = tiny;
+    d = 1 / d;
+    double h = d;
+    for (int m = 1; m <= max_iter; m++) {
+        int m2 = 2 * m;
+        double aa = m * (b - m) * x / ((qam + m2) * (a + m2));
+        d = 1 + aa * d;
+        if (std::abs(d) < tiny)
+            d = tiny;
+        c = 1 + aa / c;
+        if (std::abs(c) < tiny)
+            c = tiny;
+        d = 1 / d;
+        h *= d * c;
+        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
+        d = 1 + aa * d;
+        if (std::abs(d) < tiny)
+            d = tiny;
+        c = 1 + aa / c;
+        if (std::abs(c) < tiny)
+            c = tiny;
+        d = 1 / d;
+        double del = d * c;
+        h *= del;
+        if (std::abs(del - 1) < eps)
+            break;
+    }
+    return h;
+}
+
+// Regularized incomplete beta function I_x(a,b).
+static double IncompleteBeta(double a, double b, double x) {
+    if (x <= 0)
+        return 0;
+    if (x >= 1)
+        return 1;
+    double front =
+        std::exp(std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b) + a * std::log(x) + b * std::log(1 - x));
+    if (x < (a + 1) / (a + b + 2))
+        return front * BetaContinuedFraction(a, b, x) / a;
+    return 1 - front * BetaContinuedFraction(b, a, 1 - x) / b;
+}
+
+static void MeanVariance(const std::vector<double>& x, double& mean, double& var) {
+    mean = 0;
+    for (auto v : x)
+        mean += v;
+    mean /= x.size();
+    var = 0;
+    for (auto v : x)
+        var += (v - mean) * (v - mean);
+    var /= (x.size() - 1);
+}
+
+double WelchTestGreater(const std::vector<double>& x1, const std::vector<double>& x2) {
+    if (x1.size() < 2 || x2.size() < 2)
+        return 1;
+
+    double m1, v1, m2, v2;
+    MeanVariance(x1, m1, v1);
+    MeanVariance(x2, m2, v2);
+    double s1 = v1 / x1.size();
+    double s2 = v2 / x2.size();
+    double se2 = s1 + s2;
+    if (se2 == 0)
+        return m2 > m1 ? 0 : 1;
+
+    // Student t statistic and Welch-Satterthwaite degrees of freedom
+    double t = (m2 - m1) / std::sqrt(se2);
+    double df = se2 * se2 / (s1 * s1 / (x1.size() - 1) + s2 * s2 / (x2.size() - 1));
+
+    // P(T > |t|) for a Student t distribution with df degrees of freedom
+    double tail = 0.5 * IncompleteBeta(0.5 * df, 0.5, df / (df + t * t));
+
+    return t > 0 ? tail : 1 - tail;
+}
+
+std::vector<ChBenchmarkRegression> CompareBenchmarkResults(const ChBenchmarkResults& baseline,
+                                                           const ChBenchmarkResults& current,
+                                                           double alpha,
+                                                           double threshold,
+                                                           double floor) {
+    std::vector<ChBenchmarkRegression> regressions;
+
+    for (const auto& benchmark : current.GetSamples()) {
+        auto base_benchmark = baseline.GetSamples().find(benchmark.first);
+        if (base_benchmark == baseline.GetSamples().end())
+            continue;
+        for (const auto& metric : benchmark.second) {
+            auto base_metric = base_benchmark->second.find(metric.first);
+            if (base_metric == base_benchmark->second.end())
+                continue;
+            const auto& x1 = base_metric->second;
+            const auto& x2 = metric.second;
+            if (x1.size() < 2 || x2.size() < 2)
+                continue;
+
+            double m1, v1, m2, v2;
+            MeanVariance(x1, m1, v1);
+            MeanVariance(x2, m2, v2);
+            if (m1 < floor)
+                continue;
+            double change = (m2 - m1) / m1;
+            if (change <= threshold)
+                continue;
+            double p_value = WelchTestGreater(x1, x2);
+            if (p_value >= alpha)
+                continue;
+
+            regressions.push_back({benchmark.first, metric.first, m1, m2, change, p_value});
+        }
+    }
+
+    return regressions;
+}
+
+}  // end namespace utils
+}  // end namespace chrono
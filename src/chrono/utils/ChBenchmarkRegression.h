@@ -0,0 +1,100 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Utilities for detecting performance regressions from the results of Chrono
+// benchmark tests, compared against stored baselines.
+//
+// =============================================================================
+
+#ifndef CH_BENCHMARK_REGRESSION_H
+#define CH_BENCHMARK_REGRESSION_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Timing samples of a set of benchmarks.
+/// For each benchmark, the samples of each metric are collected over the benchmark repetitions. Metrics are the
+/// benchmark real and CPU times and all user counters, in particular the timer breakdown reported by a
+/// ChBenchmarkTest (step, LS setup/solve, collision broad/narrow phase, update, etc.).
+class ChApi ChBenchmarkResults {
+  public:
+    /// Samples of each metric (values), for each benchmark (keys).
+    typedef std::map<std::string, std::map<std::string, std::vector<double>>> Samples;
+
+    ChBenchmarkResults() {}
+
+    /// Add the results from a JSON output file of the Google benchmark library (--benchmark_out).
+    /// Only the individual repetitions are collected; aggregates (mean, median, etc.) and failed runs are skipped.
+    /// Return false if the file cannot be read or parsed.
+    bool AddBenchmarkOutput(const std::string& filename);
+
+    /// Add one sample of the given metric.
+    void AddSample(const std::string& benchmark, const std::string& metric, double value);
+
+    /// Write all samples to a JSON baseline file.
+    bool WriteBaseline(const std::string& filename) const;
+
+    /// Add all samples from a JSON baseline file written by WriteBaseline.
+    bool ReadBaseline(const std::string& filename);
+
+    /// Return true if there are no samples.
+    bool IsEmpty() const { return m_samples.empty(); }
+
+    /// Get all samples.
+    const Samples& GetSamples() const { return m_samples; }
+
+  private:
+    Samples m_samples;
+};
+
+/// Description of a performance regression in one metric of one benchmark.
+struct ChBenchmarkRegression {
+    std::string benchmark;  ///< benchmark name
+    std::string metric;     ///< metric name
+    double baseline_mean;   ///< mean of the baseline samples
+    double current_mean;    ///< mean of the current samples
+    double change;          ///< relative change of the mean
+    double p_value;         ///< significance of the slowdown (one-sided Welch t-test)
+};
+
+/// Compare benchmark results against a baseline and return the statistically significant slowdowns.
+/// A metric of a benchmark present in both sets of results is reported if the one-sided Welch t-test rejects, at
+/// the given significance level, the hypothesis that it did not increase, and if its mean increased by more than
+/// the given relative threshold. Metrics with a baseline mean below the given floor are ignored (timing noise).
+/// Each set must include at least 2 samples of a metric for it to be compared.
+ChApi std::vector<ChBenchmarkRegression> CompareBenchmarkResults(const ChBenchmarkResults& baseline,
+                                                                 const ChBenchmarkResults& current,
+                                                                 double alpha = 0.05,
+                                                                 double threshold = 0.05,
+                                                                 double floor = 1e-3);
+
+/// Return the p-value of the one-sided Welch t-test for the hypothesis that the mean of the second set of samples
+/// is not larger than the mean of the first set.
+ChApi double WelchTestGreater(const std::vector<double>& x1, const std::vector<double>& x2);
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
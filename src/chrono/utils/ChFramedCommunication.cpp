@@ -0,0 +1,525 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Co-simulation interface exchanging framed binary messages with typed,
+// variable-length channels, over TCP sockets or shared memory.
+//
+// =============================================================================
+
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <winsock2.h>
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+    #include <sys/mman.h>
+    #include <sys/socket.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "chrono/utils/ChFramedCommunication.h"
+
+namespace chrono {
+namespace utils {
+
+// Frame constants. All multi-byte quantities are written in the byte order of the host (assumed little endian, as in
+// ChSocketCommunication).
+static const uint32_t frame_magic = 0x52464843;  // 'CHFR'
+static const uint16_t frame_version = 1;
+static const size_t frame_header_size = 32;
+static const size_t channel_header_size = 8;
+
+template <typename T>
+static void Write(std::vector<char>& buf, size_t& offset, T val) {
+    std::memcpy(buf.data() + offset, &val, sizeof(T));
+    offset += sizeof(T);
+}
+
+template <typename T>
+static T Read(const std::vector<char>& buf, size_t& offset) {
+    T val;
+    std::memcpy(&val, buf.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return val;
+}
+
+// -----------------------------------------------------------------------------
+// Frame encoding and decoding
+// -----------------------------------------------------------------------------
+
+size_t ChFramedCommunication::GetTypeSize(DataType type) {
+    switch (type) {
+        case DataType::FLOAT64:
+            return 8;
+        case DataType::FLOAT32:
+        case DataType::INT32:
+            return 4;
+        case DataType::UINT8:
+            return 1;
+    }
+    throw std::runtime_error("ChFramedCommunication - invalid data type.");
+}
+
+void ChFramedCommunication::EncodeFrame(uint64_t step,
+                                        double time,
+                                        const std::vector<ChannelData>& channels,
+                                        std::vector<char>& frame) {
+    size_t size = frame_header_size;
+    for (const auto& c : channels)
+        size += channel_header_size + c.count * GetTypeSize(c.type);
+
+    // Resizing to the current size does not reallocate the frame buffer
+    frame.resize(size);
+
+    size_t offset = 0;
+    Write<uint32_t>(frame, offset, frame_magic);
+    Write<uint16_t>(frame, offset, frame_version);
+    Write<uint16_t>(frame, offset, (uint16_t)channels.size());
+    Write<uint32_t>(frame, offset, (uint32_t)size);
+    Write<uint32_t>(frame, offset, 0);
+    Write<uint64_t>(frame, offset, step);
+    Write<double>(frame, offset, time);
+
+    for (size_t i = 0; i < channels.size(); i++) {
+        const auto& c = channels[i];
+        Write<uint16_t>(frame, offset, (uint16_t)i);
+        Write<uint8_t>(frame, offset, (uint8_t)c.type);
+        Write<uint8_t>(frame, offset, 0);
+        Write<uint32_t>(frame, offset, c.count);
+        size_t nbytes = c.count * GetTypeSize(c.type);
+        if (nbytes > 0)
+            std::memcpy(frame.data() + offset, c.data, nbytes);
+        offset += nbytes;
+    }
+}
+
+void ChFramedCommunication::DecodeFrame(const std::vector<char>& frame,
+                                        const std::vector<DataType>& types,
+                                        uint64_t& step,
+                                        double& time,
+                                        std::vector<ChannelData>& channels) {
+    if (frame.size() < frame_header_size)
+        throw std::runtime_error("ChFramedCommunication::DecodeFrame - incomplete frame header.");
+
+    size_t offset = 0;
+    auto magic = Read<uint32_t>(frame, offset);
+    auto version = Read<uint16_t>(frame, offset);
+    auto num_channels = Read<uint16_t>(frame, offset);
+    auto size = Read<uint32_t>(frame, offset);
+    Read<uint32_t>(frame, offset);
+    step = Read<uint64_t>(frame, offset);
+    time = Read<double>(frame, offset);
+
+    if (magic != frame_magic || version != frame_version)
+        throw std::runtime_error("ChFramedCommunication::DecodeFrame - invalid frame header.");
+    if (size != frame.size())
+        throw std::runtime_error("ChFramedCommunication::DecodeFrame - frame size mismatch.");
+    if (num_channels != types.size())
+        throw std::runtime_error("ChFramedCommunication::DecodeFrame - unexpected number of channels.");
+
+    channels.resize(num_channels);
+    for (size_t i = 0; i < num_channels; i++) {
+        if (offset + channel_header_size > frame.size())
+            throw std::runtime_error("ChFramedCommunication::DecodeFrame - incomplete channel header.");
+        auto index = Read<uint16_t>(frame, offset);
+        auto type = (DataType)Read<uint8_t>(frame, offset);
+        Read<uint8_t>(frame, offset);
+        auto count = Read<uint32_t>(frame, offset);
+
+        if (index != i || type != types[i])
+            throw std::runtime_error("ChFramedCommunication::DecodeFrame - channel " + std::to_string(i) +
+                                     " does not match the expected channel.");
+        size_t nbytes = count * GetTypeSize(type);
+        if (offset + nbytes > frame.size())
+            throw std::runtime_error("ChFramedCommunication::DecodeFrame - incomplete channel data.");
+
+        channels[i].type = type;
+        channels[i].count = count;
+        channels[i].data = frame.data() + offset;
+        offset += nbytes;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Socket transport
+// -----------------------------------------------------------------------------
+
+ChFramedCommunication::SocketTransport::SocketTransport(ChSocketTCP* socket) : m_socket(socket) {
+    int flag = 1;
+    setsockopt(m_socket->getSocketId(), IPPROTO_TCP, TCP_NODELAY, (const char*)&flag, sizeof(flag));
+}
+
+ChFramedCommunication::SocketTransport::~SocketTransport() {
+    delete m_socket;
+}
+
+void ChFramedCommunication::SocketTransport::Send(const char* data, size_t size) {
+    while (size > 0) {
+        auto sent = send(m_socket->getSocketId(), data, (int)size, 0);
+        if (sent <= 0)
+            throw std::runtime_error("ChFramedCommunication::SocketTransport - error calling send().");
+        data += sent;
+        size -= sent;
+    }
+}
+
+void ChFramedCommunication::SocketTransport::Receive(char* data, size_t size) {
+    while (size > 0) {
+        auto received = recv(m_socket->getSocketId(), data, (int)size, 0);
+        if (received <= 0)
+            throw std::runtime_error("ChFramedCommunication::SocketTransport - error calling recv().");
+        data += received;
+        size -= received;
+    }
+}
+
+void ChFramedCommunication::SocketTransport::SendFrame(const std::vector<char>& frame) {
+    Send(frame.data(), frame.size());
+}
+
+void ChFramedCommunication::SocketTransport::ReceiveFrame(std::vector<char>& frame) {
+    // Read the header first, to get the frame size
+    frame.resize(frame_header_size);
+    Receive(frame.data(), frame_header_size);
+
+    uint32_t size;
+    std::memcpy(&size, frame.data() + 8, sizeof(uint32_t));
+    if (size < frame_header_size)
+        throw std::runtime_error("ChFramedCommunication::SocketTransport - invalid frame size.");
+
+    frame.resize(size);
+    Receive(frame.data() + frame_header_size, size - frame_header_size);
+}
+
+// -----------------------------------------------------------------------------
+// Shared-memory transport
+// -----------------------------------------------------------------------------
+
+// Region layout: region header, followed by the server-to-client and the client-to-server mailboxes, each made of a
+// mailbox header (padded to a cache line) and the frame storage.
+static const uint32_t region_magic = 0x4d534843;  // 'CHSM'
+static const size_t region_header_size = 64;
+static const size_t mailbox_header_size = 64;
+
+struct RegionHeader {
+    uint32_t magic;
+    uint32_t reserved;
+    uint64_t capacity;
+};
+
+struct ChFramedCommunication::SharedMemoryTransport::Mailbox {
+    std::atomic<uint32_t> full;  ///< set by the sender once a frame was written, cleared by the receiver
+    uint32_t size;               ///< size of the stored frame
+
+    char* data() { return reinterpret_cast<char*>(this) + mailbox_header_size; }
+};
+
+static_assert(sizeof(RegionHeader) <= region_header_size, "invalid shared-memory region header size");
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "std::atomic<uint32_t> cannot be shared");
+
+ChFramedCommunication::SharedMemoryTransport::SharedMemoryTransport(const std::string& name,
+                                                                    bool server,
+                                                                    size_t capacity)
+    : m_name(name), m_server(server), m_capacity(capacity), m_size(0), m_handle(nullptr), m_region(nullptr) {
+#if defined(_WIN32)
+    if (server) {
+        m_size = region_header_size + 2 * (mailbox_header_size + capacity);
+        m_handle = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, (DWORD)((uint64_t)m_size >> 32),
+                                      (DWORD)(m_size & 0xFFFFFFFF), name.c_str());
+    } else {
+        m_handle = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name.c_str());
+    }
+    if (!m_handle)
+        throw std::runtime_error("ChFramedCommunication::SharedMemoryTransport - cannot open region " + name + ".");
+    m_region = (char*)MapViewOfFile((HANDLE)m_handle, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    if (!m_region) {
+        CloseHandle((HANDLE)m_handle);
+        throw std::runtime_error("ChFramedCommunication::SharedMemoryTransport - cannot map region " + name + ".");
+    }
+#else
+    // POSIX shared-memory object names start with a slash
+    if (m_name.empty() || m_name[0] != '/')
+        m_name = "/" + m_name;
+
+    int fd;
+    if (server) {
+        m_size = region_header_size + 2 * (mailbox_header_size + capacity);
+        fd = shm_open(m_name.c_str(), O_CREAT | O_RDWR, 0600);
+        if (fd >= 0 && ftruncate(fd, (off_t)m_size) != 0) {
+            close(fd);
+            fd = -1;
+        }
+    } else {
+        fd = shm_open(m_name.c_str(), O_RDWR, 0600);
+        struct stat st;
+        if (fd >= 0 && fstat(fd, &st) == 0)
+            m_size = (size_t)st.st_size;
+    }
+    if (fd < 0 || m_size < region_header_size)
+        throw std::runtime_error("ChFramedCommunication::SharedMemoryTransport - cannot open region " + m_name + ".");
+
+    void* ptr = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED)
+        throw std::runtime_error("ChFramedCommunication::SharedMemoryTransport - cannot map region " + m_name + ".");
+    m_region = (char*)ptr;
+#endif
+
+    auto header = reinterpret_cast<RegionHeader*>(m_region);
+    if (server) {
+        header->capacity = capacity;
+        for (int i = 0; i < 2; i++) {
+            auto mailbox = new (m_region + region_header_size + i * (mailbox_header_size + capacity)) Mailbox;
+            mailbox->full.store(0);
+            mailbox->size = 0;
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        header->magic = region_magic;
+    } else {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (header->magic != region_magic)
+            throw std::runtime_error("ChFramedCommunication::SharedMemoryTransport - region " + m_name +
+                                     " was not initialized by a server.");
+        m_capacity = (size_t)header->capacity;
+    }
+
+    auto mailbox0 = reinterpret_cast<Mailbox*>(m_region + region_header_size);
+    auto mailbox1 = reinterpret_cast<Mailbox*>(m_region + region_header_size + mailbox_header_size + m_capacity);
+    m_send = server ? mailbox0 : mailbox1;
+    m_recv = server ? mailbox1 : mailbox0;
+}
+
+ChFramedCommunication::SharedMemoryTransport::~SharedMemoryTransport() {
+#if defined(_WIN32)
+    UnmapViewOfFile(m_region);
+    CloseHandle((HANDLE)m_handle);
+#else
+    munmap(m_region, m_size);
+    if (m_server)
+        shm_unlink(m_name.c_str());
+#endif
+}
+
+void ChFramedCommunication::SharedMemoryTransport::SendFrame(const std::vector<char>& frame) {
+    if (frame.size() > m_capacity)
+        throw std::runtime_error("ChFramedCommunication::SharedMemoryTransport - frame exceeds mailbox capacity.");
+
+    // Wait until the peer consumed the previous frame
+    while (m_send->full.load(std::memory_order_acquire))
+        std::this_thread::yield();
+
+    std::memcpy(m_send->data(), frame.data(), frame.size());
+    m_send->size = (uint32_t)frame.size();
+    m_send->full.store(1, std::memory_order_release);
+}
+
+void ChFramedCommunication::SharedMemoryTransport::ReceiveFrame(std::vector<char>& frame) {
+    while (!m_recv->full.load(std::memory_order_acquire))
+        std::this_thread::yield();
+
+    frame.resize(m_recv->size);
+    std::memcpy(frame.data(), m_recv->data(), m_recv->size);
+    m_recv->full.store(0, std::memory_order_release);
+}
+
+// -----------------------------------------------------------------------------
+// Co-simulation interface
+// -----------------------------------------------------------------------------
+
+ChFramedCommunication::ChFramedCommunication()
+    : m_pipelined(false), m_step(0), m_num_received(0), m_recv_step(0), m_recv_time(0) {}
+
+ChFramedCommunication::~ChFramedCommunication() {}
+
+int ChFramedCommunication::AddOutputChannel(const std::string& name, DataType type) {
+    m_outputs.push_back({name, type, 0, {}});
+    return (int)m_outputs.size() - 1;
+}
+
+int ChFramedCommunication::AddInputChannel(const std::string& name, DataType type) {
+    m_inputs.push_back({name, type, 0, {}});
+    return (int)m_inputs.size() - 1;
+}
+
+int ChFramedCommunication::GetOutputChannel(const std::string& name) const {
+    for (size_t i = 0; i < m_outputs.size(); i++) {
+        if (m_outputs[i].name == name)
+            return (int)i;
+    }
+    return -1;
+}
+
+int ChFramedCommunication::GetInputChannel(const std::string& name) const {
+    for (size_t i = 0; i < m_inputs.size(); i++) {
+        if (m_inputs[i].name == name)
+            return (int)i;
+    }
+    return -1;
+}
+
+void ChFramedCommunication::WaitConnection(int port) {
+    ChSocketTCP server(port);
+    server.bindSocket();
+    server.listenToClient(1);
+
+    std::string client_name;
+    auto client = server.acceptClient(client_name);
+    if (!client)
+        throw std::runtime_error("ChFramedCommunication::WaitConnection - server failed in getting the client socket.");
+
+    m_transport = chrono_types::make_shared<SocketTransport>(client);
+}
+
+void ChFramedCommunication::OpenSharedMemory(const std::string& name, bool server, size_t capacity) {
+    m_transport = chrono_types::make_shared<SharedMemoryTransport>(name, server, capacity);
+}
+
+void ChFramedCommunication::SetPipelined(bool val) {
+    if (m_step > 0)
+        throw std::runtime_error("ChFramedCommunication::SetPipelined - cannot change mode after the first exchange.");
+    m_pipelined = val;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+static void ConvertTo(ChVectorConstRef values, std::vector<char>& data) {
+    data.resize(values.size() * sizeof(T));
+    for (Eigen::Index i = 0; i < values.size(); i++) {
+        T val = (T)values(i);
+        std::memcpy(data.data() + i * sizeof(T), &val, sizeof(T));
+    }
+}
+
+template <typename T>
+static void ConvertFrom(const std::vector<char>& data, uint32_t count, ChVectorDynamic<>& values) {
+    values.resize(count);
+    for (uint32_t i = 0; i < count; i++) {
+        T val;
+        std::memcpy(&val, data.data() + i * sizeof(T), sizeof(T));
+        values(i) = (double)val;
+    }
+}
+
+void ChFramedCommunication::SetOutput(int channel, ChVectorConstRef values) {
+    auto& c = m_outputs.at(channel);
+    c.count = (uint32_t)values.size();
+    switch (c.type) {
+        case DataType::FLOAT64:
+            ConvertTo<double>(values, c.data);
+            break;
+        case DataType::FLOAT32:
+            ConvertTo<float>(values, c.data);
+            break;
+        case DataType::INT32:
+            ConvertTo<int32_t>(values, c.data);
+            break;
+        case DataType::UINT8:
+            ConvertTo<uint8_t>(values, c.data);
+            break;
+    }
+}
+
+void ChFramedCommunication::SetOutput(int channel, const void* data, size_t count) {
+    auto& c = m_outputs.at(channel);
+    c.count = (uint32_t)count;
+    c.data.resize(count * GetTypeSize(c.type));
+    if (count > 0)
+        std::memcpy(c.data.data(), data, c.data.size());
+}
+
+void ChFramedCommunication::GetInput(int channel, ChVectorDynamic<>& values) const {
+    const auto& c = m_inputs.at(channel);
+    switch (c.type) {
+        case DataType::FLOAT64:
+            ConvertFrom<double>(c.data, c.count, values);
+            break;
+        case DataType::FLOAT32:
+            ConvertFrom<float>(c.data, c.count, values);
+            break;
+        case DataType::INT32:
+            ConvertFrom<int32_t>(c.data, c.count, values);
+            break;
+        case DataType::UINT8:
+            ConvertFrom<uint8_t>(c.data, c.count, values);
+            break;
+    }
+}
+
+size_t ChFramedCommunication::GetInputSize(int channel) const {
+    return m_inputs.at(channel).count;
+}
+
+const char* ChFramedCommunication::GetInputData(int channel) const {
+    return m_inputs.at(channel).data.data();
+}
+
+// -----------------------------------------------------------------------------
+
+bool ChFramedCommunication::Exchange(double time) {
+    if (!m_transport)
+        throw std::runtime_error("ChFramedCommunication::Exchange - no transport specified.");
+
+    std::vector<ChannelData> channels(m_outputs.size());
+    for (size_t i = 0; i < m_outputs.size(); i++)
+        channels[i] = {m_outputs[i].type, m_outputs[i].count, m_outputs[i].data.data()};
+    EncodeFrame(m_step, time, channels, m_send_frame);
+    m_transport->SendFrame(m_send_frame);
+    m_step++;
+
+    // In pipelined mode, the reply to the first frame is only received at the next exchange
+    if (m_pipelined && m_step == 1)
+        return false;
+
+    Receive();
+    return true;
+}
+
+void ChFramedCommunication::Flush() {
+    if (m_pipelined && m_num_received < m_step)
+        Receive();
+}
+
+void ChFramedCommunication::Receive() {
+    m_transport->ReceiveFrame(m_recv_frame);
+
+    std::vector<DataType> types(m_inputs.size());
+    for (size_t i = 0; i < m_inputs.size(); i++)
+        types[i] = m_inputs[i].type;
+
+    std::vector<ChannelData> channels;
+    DecodeFrame(m_recv_frame, types, m_recv_step, m_recv_time, channels);
+
+    for (size_t i = 0; i < m_inputs.size(); i++) {
+        auto& c = m_inputs[i];
+        c.count = channels[i].count;
+        c.data.assign(channels[i].data, channels[i].data + c.count * GetTypeSize(c.type));
+    }
+
+    m_num_received++;
+}
+
+}  // end namespace utils
+}  // end namespace chrono
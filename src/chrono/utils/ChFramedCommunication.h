@@ -0,0 +1,239 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Co-simulation interface exchanging framed binary messages with typed,
+// variable-length channels, over TCP sockets or shared memory.
+//
+// =============================================================================
+
+#ifndef CH_FRAMED_COMMUNICATION_H
+#define CH_FRAMED_COMMUNICATION_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChMatrix.h"
+#include "chrono/utils/ChSocket.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Co-simulation interface based on framed binary messages.
+/// At each exchange, a frame with the values of all output channels is sent to the peer and a frame with the values of
+/// all input channels is received from it. Each channel has a fixed data type, but its length may change from one
+/// exchange to the next. Frames are sent over a transport, which can be a TCP socket (see WaitConnection) or, for peers
+/// running on the same host, a shared-memory region (see OpenSharedMemory).
+///
+/// Frame layout (little endian):
+/// <pre>
+///   header:   uint32 magic ('CHFR'), uint16 version, uint16 number of channels,
+///             uint32 frame size in bytes (including header), uint32 reserved,
+///             uint64 step index, float64 time
+///   channels: uint16 channel index, uint8 data type, uint8 reserved, uint32 number of values,
+///             followed by the channel values
+/// </pre>
+///
+/// Both peers send their frame first and then receive the frame of the other peer. In synchronous mode (default),
+/// Exchange blocks until the peer's frame for the same exchange was received. In pipelined mode (see SetPipelined),
+/// Exchange sends the outputs of the current exchange and returns the inputs of the previous one, so that the peer
+/// computation and the transport latency overlap with the Chrono step. Inputs are then lagging by one exchange.
+class ChApi ChFramedCommunication {
+  public:
+    /// Data type of a channel.
+    enum class DataType : uint8_t { FLOAT64 = 0, FLOAT32 = 1, INT32 = 2, UINT8 = 3 };
+
+    /// Transport of frames between the two peers.
+    class ChApi Transport {
+      public:
+        virtual ~Transport() {}
+
+        /// Send a complete frame.
+        virtual void SendFrame(const std::vector<char>& frame) = 0;
+
+        /// Receive a complete frame (blocking). The frame buffer is resized as needed.
+        virtual void ReceiveFrame(std::vector<char>& frame) = 0;
+    };
+
+    /// Transport over a connected TCP socket.
+    /// Nagle's algorithm is disabled on the socket, so that small frames are sent immediately.
+    class ChApi SocketTransport : public Transport {
+      public:
+        /// Create a transport on the given connected socket (ownership is taken).
+        SocketTransport(ChSocketTCP* socket);
+        ~SocketTransport();
+
+        virtual void SendFrame(const std::vector<char>& frame) override;
+        virtual void ReceiveFrame(std::vector<char>& frame) override;
+
+      private:
+        void Send(const char* data, size_t size);
+        void Receive(char* data, size_t size);
+
+        ChSocketTCP* m_socket;
+    };
+
+    /// Transport over a named shared-memory region, for peers running on the same host.
+    /// The region holds one mailbox per direction, each able to store a single frame of up to the specified capacity.
+    /// Peers poll the mailboxes, which minimizes latency at the cost of keeping one core busy while waiting.
+    class ChApi SharedMemoryTransport : public Transport {
+      public:
+        /// Open the shared-memory region with the given name.
+        /// The server creates the region (with mailboxes of the specified capacity, in bytes); the client attaches to
+        /// an existing region (the capacity argument is then ignored).
+        SharedMemoryTransport(const std::string& name, bool server, size_t capacity = 1 << 20);
+        ~SharedMemoryTransport();
+
+        virtual void SendFrame(const std::vector<char>& frame) override;
+        virtual void ReceiveFrame(std::vector<char>& frame) override;
+
+        /// Get the mailbox capacity (maximum frame size, in bytes).
+        size_t GetCapacity() const { return m_capacity; }
+
+      private:
+        struct Mailbox;
+
+        std::string m_name;
+        bool m_server;
+        size_t m_capacity;
+        size_t m_size;
+        void* m_handle;
+        char* m_region;
+        Mailbox* m_send;
+        Mailbox* m_recv;
+    };
+
+    ChFramedCommunication();
+    ~ChFramedCommunication();
+
+    /// Add an output channel (sent to the peer) of the given type and return its index.
+    int AddOutputChannel(const std::string& name, DataType type = DataType::FLOAT64);
+
+    /// Add an input channel (received from the peer) of the given type and return its index.
+    int AddInputChannel(const std::string& name, DataType type = DataType::FLOAT64);
+
+    /// Get the number of output channels.
+    int GetNumOutputChannels() const { return (int)m_outputs.size(); }
+
+    /// Get the number of input channels.
+    int GetNumInputChannels() const { return (int)m_inputs.size(); }
+
+    /// Get the index of the output channel with given name (-1 if not found).
+    int GetOutputChannel(const std::string& name) const;
+
+    /// Get the index of the input channel with given name (-1 if not found).
+    int GetInputChannel(const std::string& name) const;
+
+    /// Wait for a client to connect on the given port and use the resulting TCP socket as transport.
+    void WaitConnection(int port);
+
+    /// Use a shared-memory region as transport. See SharedMemoryTransport.
+    void OpenSharedMemory(const std::string& name, bool server, size_t capacity = 1 << 20);
+
+    /// Set a user-provided transport.
+    void SetTransport(std::shared_ptr<Transport> transport) { m_transport = transport; }
+
+    /// Enable/disable pipelined exchange, with inputs lagging by one exchange (default: false).
+    /// This setting can only be changed before the first exchange.
+    void SetPipelined(bool val);
+
+    /// Set the values of an output channel, converted to the channel data type.
+    void SetOutput(int channel, ChVectorConstRef values);
+
+    /// Set the values of an output channel from raw data, already of the channel data type.
+    void SetOutput(int channel, const void* data, size_t count);
+
+    /// Get the values of an input channel, converted to double.
+    void GetInput(int channel, ChVectorDynamic<>& values) const;
+
+    /// Get the number of values last received on an input channel.
+    size_t GetInputSize(int channel) const;
+
+    /// Get the raw data last received on an input channel (GetInputSize values of the channel data type).
+    const char* GetInputData(int channel) const;
+
+    /// Send the current outputs, stamped with the given time, and receive inputs.
+    /// In pipelined mode, the received inputs are those sent by the peer for the previous exchange; on the first
+    /// exchange, no inputs are received and this function returns false. Otherwise, this function returns true.
+    bool Exchange(double time);
+
+    /// In pipelined mode, receive the peer's frame for the last exchange. No-op in synchronous mode.
+    void Flush();
+
+    /// Get the time stamp of the last received frame.
+    double GetReceivedTime() const { return m_recv_time; }
+
+    /// Get the step index of the last received frame.
+    uint64_t GetReceivedStep() const { return m_recv_step; }
+
+    /// Get the number of exchanges performed so far.
+    uint64_t GetNumExchanges() const { return m_step; }
+
+    /// Return the size in bytes of a value of the given type.
+    static size_t GetTypeSize(DataType type);
+
+    /// Encode a frame with the given channels.
+    /// Each channel is specified by its data type, number of values, and data.
+    struct ChannelData {
+        DataType type;
+        uint32_t count;
+        const char* data;
+    };
+    static void EncodeFrame(uint64_t step, double time, const std::vector<ChannelData>& channels,
+                            std::vector<char>& frame);
+
+    /// Decode a frame, checking it against the expected channel types.
+    /// On output, each channel refers to data inside the frame buffer. An exception is thrown if the frame is
+    /// malformed or does not match the expected channels.
+    static void DecodeFrame(const std::vector<char>& frame,
+                            const std::vector<DataType>& types,
+                            uint64_t& step,
+                            double& time,
+                            std::vector<ChannelData>& channels);
+
+  private:
+    struct Channel {
+        std::string name;
+        DataType type;
+        uint32_t count;
+        std::vector<char> data;
+    };
+
+    void Receive();
+
+    std::vector<Channel> m_outputs;
+    std::vector<Channel> m_inputs;
+    std::shared_ptr<Transport> m_transport;
+
+    bool m_pipelined;
+    uint64_t m_step;
+    uint64_t m_num_received;
+    uint64_t m_recv_step;
+    double m_recv_time;
+
+    std::vector<char> m_send_frame;
+    std::vector<char> m_recv_frame;
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,100 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Mesh simplification utilities, used to generate level-of-detail meshes
+//
+// =============================================================================
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <set>
+
+#include "chrono/utils/ChMeshSimplification.h"
+
+namespace chrono {
+namespace utils {
+
+std::shared_ptr<ChTriangleMeshConnected> SimplifyMesh(const ChTriangleMeshConnected& mesh, double cell_size) {
+    const std::vector<ChVector3d>& vertices = mesh.GetCoordsVertices();
+    const std::vector<ChVector3i>& faces = mesh.GetIndicesVertexes();
+    const std::vector<int>& face_materials = mesh.GetIndicesMaterials();
+
+    auto simplified = chrono_types::make_shared<ChTriangleMeshConnected>();
+    if (vertices.empty() || cell_size <= 0)
+        return simplified;
+
+    ChVector3d origin = ChTriangleMeshConnected::GetBoundingBox(vertices).min;
+
+    // assign each vertex to a cell, and accumulate the vertices of each cell
+    std::map<std::array<long long, 3>, int> cells;
+    std::vector<int> vertex_cells(vertices.size());
+    std::vector<ChVector3d>& new_vertices = simplified->GetCoordsVertices();
+    std::vector<int> cell_counts;
+    for (size_t i = 0; i < vertices.size(); i++) {
+        ChVector3d p = (vertices[i] - origin) / cell_size;
+        std::array<long long, 3> key = {(long long)std::floor(p.x()), (long long)std::floor(p.y()),
+                                        (long long)std::floor(p.z())};
+        auto cell = cells.find(key);
+        if (cell == cells.end()) {
+            cell = cells.emplace(key, (int)new_vertices.size()).first;
+            new_vertices.push_back(ChVector3d(0, 0, 0));
+            cell_counts.push_back(0);
+        }
+        vertex_cells[i] = cell->second;
+        new_vertices[cell->second] += vertices[i];
+        cell_counts[cell->second]++;
+    }
+    for (size_t c = 0; c < new_vertices.size(); c++)
+        new_vertices[c] /= cell_counts[c];
+
+    // remap the faces, dropping the ones that collapse or are duplicates
+    std::set<std::array<int, 3>> known_faces;
+    std::vector<ChVector3i>& new_faces = simplified->GetIndicesVertexes();
+    std::vector<int>& new_materials = simplified->GetIndicesMaterials();
+    for (size_t f = 0; f < faces.size(); f++) {
+        ChVector3i face(vertex_cells[faces[f].x()], vertex_cells[faces[f].y()], vertex_cells[faces[f].z()]);
+        if (face.x() == face.y() || face.y() == face.z() || face.z() == face.x())
+            continue;
+
+        std::array<int, 3> key = {face.x(), face.y(), face.z()};
+        std::sort(key.begin(), key.end());
+        if (!known_faces.insert(key).second)
+            continue;
+
+        new_faces.push_back(face);
+        if (f < face_materials.size())
+            new_materials.push_back(face_materials[f]);
+    }
+
+    // remove the vertices that are not referenced by any face
+    std::vector<int> used(new_vertices.size(), -1);
+    std::vector<ChVector3d> compact_vertices;
+    for (auto& face : new_faces) {
+        for (int k = 0; k < 3; k++) {
+            if (used[face[k]] < 0) {
+                used[face[k]] = (int)compact_vertices.size();
+                compact_vertices.push_back(new_vertices[face[k]]);
+            }
+            face[k] = used[face[k]];
+        }
+    }
+    new_vertices = compact_vertices;
+
+    return simplified;
+}
+
+}  // namespace utils
+}  // namespace chrono
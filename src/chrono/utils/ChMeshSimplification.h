@@ -0,0 +1,41 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Mesh simplification utilities, used to generate level-of-detail meshes
+//
+// =============================================================================
+
+#ifndef CHMESHSIMPLIFICATION_H
+#define CHMESHSIMPLIFICATION_H
+
+#include <memory>
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+namespace utils {
+
+/// Utility function for simplifying a triangle mesh by vertex clustering. The vertices are merged on a regular grid of
+/// the given cell size (each cell is replaced by the average of its vertices), and the triangles that collapse or
+/// duplicate another triangle are removed. The material indices of the faces are kept, the normals and texture
+/// coordinates are not.
+/// @param mesh The mesh to simplify
+/// @param cell_size The size of the clustering cells, in the mesh coordinates
+/// @return The simplified mesh
+ChApi std::shared_ptr<ChTriangleMeshConnected> SimplifyMesh(const ChTriangleMeshConnected& mesh, double cell_size);
+
+}  // namespace utils
+}  // namespace chrono
+#endif
@@ -0,0 +1,39 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include "chrono/utils/ChOpenMP.h"
+#include "chrono/core/ChTaskScheduler.h"
+
+namespace chrono {
+
+#ifdef _OPENMP
+
+bool ChOMP::BindThreads(int nthreads) {
+    if (omp_get_proc_bind() != omp_proc_bind_false)
+        return false;
+
+    int num_procs = omp_get_num_procs();
+    int num_pinned = 0;
+#pragma omp parallel num_threads(nthreads) reduction(+ : num_pinned)
+    {
+        if (ChTaskScheduler::PinThread(omp_get_thread_num() % num_procs))
+            num_pinned++;
+    }
+
+    return num_pinned == nthreads;
+}
+
+#endif
+
+}  // end namespace chrono
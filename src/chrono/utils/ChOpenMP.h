@@ -41,6 +41,14 @@ class ChApi ChOMP {
     /// Return the max. number of threads that would be used by default if num_threads not specified.
     /// This is the same number as GetNumProcs() on most OMP implementations.
     static int GetMaxThreads() { return omp_get_max_threads(); }
+
+    /// Bind the threads of OpenMP teams with the specified number of threads to cores.
+    /// Thread k of the team is pinned to core k (modulo the number of processors), so that threads with consecutive
+    /// indices (which process consecutive blocks of loops with static schedule) share a memory domain. This binding
+    /// persists for subsequent parallel regions with the same number of threads. It should be used together with
+    /// arrays with first-touch placement (see first_touch_allocator) on NUMA systems.
+    /// No-op (returning false) if a binding policy was already specified through OMP_PROC_BIND.
+    static bool BindThreads(int nthreads);
 };
 
 /// Class that wraps a 'omp_lock_t' for doing a mutex in OpenMP parallel sections.
@@ -68,6 +76,7 @@ class ChApi ChOMP {
     static int GetThreadNum() { return 0; }
     static int GetNumProcs() { return 1; }
     static int GetMaxThreads() { return 1; }
+    static bool BindThreads(int nthreads) { return false; }
 };
 
 /// Dummy no-op mutex in case that no parallel multithreading via OpenMP is available.
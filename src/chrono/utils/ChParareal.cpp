@@ -0,0 +1,155 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/utils/ChParareal.h"
+#include "chrono/utils/ChOpenMP.h"
+
+namespace chrono {
+namespace utils {
+
+ChParareal::ChParareal(SystemFactory factory)
+    : m_factory(factory),
+      m_coarse_config(nullptr),
+      m_fine_config(nullptr),
+      m_coarse_step(1e-2),
+      m_fine_step(1e-3),
+      m_num_slices(8),
+      m_num_threads(0),
+      m_max_iterations(5),
+      m_tolerance(1e-6),
+      m_num_iterations(0),
+      m_defect(0) {}
+
+void ChParareal::SetCoarsePropagator(double step, SystemConfig config) {
+    m_coarse_step = step;
+    m_coarse_config = config;
+}
+
+void ChParareal::SetFinePropagator(double step, SystemConfig config) {
+    m_fine_step = step;
+    m_fine_config = config;
+}
+
+std::shared_ptr<ChSystem> ChParareal::CreateSystem(const SystemConfig& config) const {
+    auto sys = m_factory();
+    if (config)
+        config(*sys);
+
+    // Set up state counts and offsets, needed to gather and scatter states
+    sys->Setup();
+
+    return sys;
+}
+
+void ChParareal::Gather(ChSystem& sys, State& u) {
+    ChStateDelta A;
+    sys.StateSetup(u.X, u.V, A);
+    sys.StateGather(u.X, u.V, u.T);
+}
+
+void ChParareal::Propagate(ChSystem& sys, double step, const State& u, double t_end, State& out) {
+    sys.StateScatter(u.X, u.V, u.T, true);
+    while (sys.GetChTime() < t_end - 1e-6 * step)
+        sys.DoStepDynamics(std::min(step, t_end - sys.GetChTime()));
+    Gather(sys, out);
+    out.T = t_end;
+}
+
+void ChParareal::LoadSliceState(int slice, ChSystem& sys) const {
+    sys.Setup();
+    sys.StateScatter(m_U[slice].X, m_U[slice].V, m_U[slice].T, true);
+}
+
+bool ChParareal::Run(double t_end) {
+    const int N = m_num_slices;
+    const int num_threads = (m_num_threads > 0) ? std::min(m_num_threads, N) : N;
+
+    // Create the system instances (serially, as the factory need not be thread-safe)
+    m_coarse_sys = CreateSystem(m_coarse_config);
+    m_fine_sys.clear();
+    for (int i = 0; i < num_threads; i++)
+        m_fine_sys.push_back(CreateSystem(m_fine_config));
+
+    // Slice boundaries
+    m_U.resize(N + 1);
+    m_G.resize(N + 1);
+    m_F.resize(N + 1);
+    Gather(*m_coarse_sys, m_U[0]);
+    std::vector<double> times(N + 1);
+    for (int n = 0; n <= N; n++)
+        times[n] = m_U[0].T + (t_end - m_U[0].T) * n / N;
+
+    // Initial estimates of the states, from a coarse sweep
+    for (int n = 0; n < N; n++) {
+        Propagate(*m_coarse_sys, m_coarse_step, m_U[n], times[n + 1], m_G[n + 1]);
+        m_U[n + 1] = m_G[n + 1];
+    }
+
+    // Parareal iterations.
+    // At the beginning of iteration k, the states at the first k+1 slice boundaries are converged (they coincide with
+    // those of a serial fine simulation), so that only the remaining slices must be propagated.
+    State u_coarse;
+    State u_new;
+    ChStateDelta Dx;
+    m_num_iterations = 0;
+    m_defect = 0;
+    bool converged = false;
+    for (int k = 0; k < m_max_iterations && k < N; k++) {
+        // Fine propagation, concurrently over the slices
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+        for (int n = k; n < N; n++) {
+            auto& sys = *m_fine_sys[ChOMP::GetThreadNum()];
+            Propagate(sys, m_fine_step, m_U[n], times[n + 1], m_F[n + 1]);
+        }
+
+        // Serial coarse sweep with correction:  U(n+1) = G(U_new(n)) + F(U_old(n)) - G(U_old(n))
+        m_defect = 0;
+        for (int n = k; n < N; n++) {
+            if (n == k) {
+                // The state at the beginning of the slice did not change, so the correction yields the fine solution
+                u_new = m_F[n + 1];
+            } else {
+                Propagate(*m_coarse_sys, m_coarse_step, m_U[n], times[n + 1], u_coarse);
+                Dx.setZero(u_coarse.V.size(), m_coarse_sys.get());
+                m_coarse_sys->StateGetIncrementX(m_F[n + 1].X, m_G[n + 1].X, Dx);
+                u_new.X.setZero(u_coarse.X.size(), m_coarse_sys.get());
+                m_coarse_sys->StateIncrementX(u_new.X, u_coarse.X, Dx);
+                u_new.V = u_coarse.V + (m_F[n + 1].V - m_G[n + 1].V);
+                u_new.T = times[n + 1];
+                m_G[n + 1] = u_coarse;
+            }
+
+            double change = std::max((u_new.X - m_U[n + 1].X).lpNorm<Eigen::Infinity>(),
+                                     (u_new.V - m_U[n + 1].V).lpNorm<Eigen::Infinity>());
+            m_defect = std::max(m_defect, change);
+            m_U[n + 1] = u_new;
+        }
+
+        m_num_iterations = k + 1;
+        if (m_defect <= m_tolerance || m_num_iterations == N) {
+            converged = true;
+            break;
+        }
+    }
+
+    // Leave the coarse system instance at the final state
+    LoadSliceState(N, *m_coarse_sys);
+
+    return converged;
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,143 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Parallel-in-time (Parareal) driver for long simulations.
+//
+// =============================================================================
+
+#ifndef CH_PARAREAL_H
+#define CH_PARAREAL_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Parallel-in-time (Parareal) driver for long simulations.
+/// The simulation interval is split in time slices. A cheap coarse propagator (large step, few solver iterations) is
+/// run serially across all slices, while an accurate fine propagator is run concurrently on all slices, each starting
+/// from the current estimate of the state at the beginning of its slice. The estimates are then corrected with the
+/// Parareal update
+/// <pre>
+///   U(n+1) = G(U_new(n)) + F(U_old(n)) - G(U_old(n))
+/// </pre>
+/// where G and F denote the coarse and fine propagation over one slice. After k iterations, the states at the first k
+/// slice boundaries coincide with those of a serial fine simulation, so the iteration converges in at most as many
+/// iterations as slices; in practice, much fewer iterations are needed when the coarse propagator is accurate enough.
+///
+/// Each propagator works on its own system instance, created by a user-provided factory. All instances must have the
+/// same topology (same bodies, links, etc., added in the same order); they exchange only their states (positions,
+/// velocities, and time) through StateGather and StateScatter. Per-propagator settings (time stepper, solver, number
+/// of iterations, ...) are applied to the instances through optional configuration functions.
+class ChApi ChParareal {
+  public:
+    /// Function creating a new instance of the simulated system, in its initial configuration.
+    using SystemFactory = std::function<std::shared_ptr<ChSystem>()>;
+
+    /// Function applying the settings of a propagator to a system instance.
+    using SystemConfig = std::function<void(ChSystem&)>;
+
+    /// Create a Parareal driver using the given system factory.
+    ChParareal(SystemFactory factory);
+
+    /// Set the step size and the settings of the coarse propagator.
+    void SetCoarsePropagator(double step, SystemConfig config = nullptr);
+
+    /// Set the step size and the settings of the fine propagator.
+    void SetFinePropagator(double step, SystemConfig config = nullptr);
+
+    /// Set the number of time slices (default: 8).
+    void SetNumSlices(int num_slices) { m_num_slices = num_slices; }
+
+    /// Set the number of threads running fine propagators concurrently (default: number of slices).
+    /// Each thread uses its own system instance.
+    void SetNumThreads(int num_threads) { m_num_threads = num_threads; }
+
+    /// Set the maximum number of Parareal iterations (default: 5).
+    void SetMaxIterations(int max_iterations) { m_max_iterations = max_iterations; }
+
+    /// Set the convergence tolerance on the change of the slice boundary states between iterations (default: 1e-6).
+    /// The change is measured as the maximum absolute difference of the position and velocity components.
+    void SetTolerance(double tolerance) { m_tolerance = tolerance; }
+
+    /// Simulate from the initial configuration of the system instances up to the specified time.
+    /// Return true if the Parareal iteration converged within the maximum number of iterations.
+    bool Run(double t_end);
+
+    /// Return the number of Parareal iterations performed in the last run.
+    int GetNumIterations() const { return m_num_iterations; }
+
+    /// Return the change of the slice boundary states in the last Parareal iteration.
+    double GetDefect() const { return m_defect; }
+
+    /// Return the time at the beginning of the specified slice (the final time for slice = number of slices).
+    double GetSliceTime(int slice) const { return m_U[slice].T; }
+
+    /// Load the state at the beginning of the specified slice (the final state for slice = number of slices) into
+    /// the given system, which must have the same topology as the instances created by the factory.
+    void LoadSliceState(int slice, ChSystem& sys) const;
+
+    /// Return the system instance used by the coarse propagator, set at the final state of the last run.
+    std::shared_ptr<ChSystem> GetSystem() const { return m_coarse_sys; }
+
+  private:
+    /// State of a system instance.
+    struct State {
+        ChState X;
+        ChStateDelta V;
+        double T;
+    };
+
+    /// Create a system instance and apply the given settings.
+    std::shared_ptr<ChSystem> CreateSystem(const SystemConfig& config) const;
+
+    /// Gather the current state of the given system.
+    static void Gather(ChSystem& sys, State& u);
+
+    /// Propagate the given state up to the specified time with steps of the given size.
+    static void Propagate(ChSystem& sys, double step, const State& u, double t_end, State& out);
+
+    SystemFactory m_factory;       ///< creation of system instances
+    SystemConfig m_coarse_config;  ///< settings of the coarse propagator
+    SystemConfig m_fine_config;    ///< settings of the fine propagator
+    double m_coarse_step;          ///< step size of the coarse propagator
+    double m_fine_step;            ///< step size of the fine propagator
+    int m_num_slices;              ///< number of time slices
+    int m_num_threads;             ///< number of concurrent fine propagators (0: one per slice)
+    int m_max_iterations;          ///< maximum number of Parareal iterations
+    double m_tolerance;            ///< convergence tolerance
+    int m_num_iterations;          ///< number of iterations in the last run
+    double m_defect;               ///< change of the slice boundary states in the last iteration
+
+    std::shared_ptr<ChSystem> m_coarse_sys;             ///< system instance of the coarse propagator
+    std::vector<std::shared_ptr<ChSystem>> m_fine_sys;  ///< system instances of the fine propagators
+    std::vector<State> m_U;                             ///< states at the slice boundaries
+    std::vector<State> m_G;                             ///< coarse propagation of the current states
+    std::vector<State> m_F;                             ///< fine propagation of the current states
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
@@ -188,10 +188,24 @@ void ChProfileIterator::Enter_Parent(void) {
 **
 ***************************************************************************************************/
 
-ChProfileNode ChProfileManager::Root("Root", NULL);
-ChProfileNode* ChProfileManager::CurrentNode = &ChProfileManager::Root;
-int ChProfileManager::FrameCounter = 0;
-unsigned long int ChProfileManager::ResetTime = 0;
+// Per-thread profile state.
+// These are not static members of ChProfileManager, since thread-local data cannot be exported from a DLL.
+static thread_local ChProfileNode Root("Root", NULL);
+static thread_local ChProfileNode* CurrentNode = &Root;
+static thread_local int FrameCounter = 0;
+static thread_local unsigned long int ResetTime = 0;
+
+void ChProfileManager::CleanupMemory(void) {
+    Root.CleanupMemory();
+}
+
+int ChProfileManager::Get_Frame_Count_Since_Reset(void) {
+    return FrameCounter;
+}
+
+ChProfileIterator* ChProfileManager::Get_Iterator(void) {
+    return new ChProfileIterator(&Root);
+}
 
 /***********************************************************************************************
  * ChProfileManager::Start_Profile -- Begin a named profile                                    *
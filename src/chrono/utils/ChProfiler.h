@@ -35,6 +35,7 @@
     #include <ratio>
     #include <chrono>
     #include "chrono/core/ChApiCE.h"
+    #include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 namespace utils {
@@ -104,38 +105,41 @@ class ChApi ChProfileIterator {
 };
 
 /// The Manager for the Profile system.
+/// Each thread records into its own profile tree (with its own frame counter and reset time), so that profiled code
+/// can run concurrently on several threads (e.g., when stepping independent systems in parallel). All functions act
+/// on the profile tree of the calling thread.
 class ChApi ChProfileManager {
   public:
     static void Start_Profile(const char* name);
     static void Stop_Profile(void);
 
-    static void CleanupMemory(void) { Root.CleanupMemory(); }
+    static void CleanupMemory(void);
 
     static void Reset(void);
     static void Increment_Frame_Counter(void);
-    static int Get_Frame_Count_Since_Reset(void) { return FrameCounter; }
+    static int Get_Frame_Count_Since_Reset(void);
     static float Get_Time_Since_Reset(void);
 
-    static ChProfileIterator* Get_Iterator(void) { return new ChProfileIterator(&Root); }
+    static ChProfileIterator* Get_Iterator(void);
     static void Release_Iterator(ChProfileIterator* iterator) { delete (iterator); }
 
     static void dumpRecursive(ChProfileIterator* profileIterator, int spacing);
 
     static void dumpAll();
-
-  private:
-    static ChProfileNode Root;
-    static ChProfileNode* CurrentNode;
-    static int FrameCounter;
-    static unsigned long int ResetTime;
 };
 
 /// Simple way to profile a function's scope.
+/// The scope is also recorded as a trace event if ChTraceProfiler is enabled.
+/// Scopes executed concurrently are recorded in the profile tree of their thread; use CH_TRACE to obtain a timeline
+/// of all threads.
 class ChApi ChProfileSample {
   public:
-    ChProfileSample(const char* name) { ChProfileManager::Start_Profile(name); }
+    ChProfileSample(const char* name) : m_trace(name) { ChProfileManager::Start_Profile(name); }
 
     ~ChProfileSample(void) { ChProfileManager::Stop_Profile(); }
+
+  private:
+    ChTraceScope m_trace;
 };
 
 }  // end namespace utils
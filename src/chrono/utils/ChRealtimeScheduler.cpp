@@ -0,0 +1,191 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Deadline-aware real-time scheduler for hardware-in-the-loop simulation.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <thread>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#elif defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+#include "chrono/utils/ChRealtimeScheduler.h"
+#include "chrono/solver/ChIterativeSolver.h"
+
+namespace chrono {
+namespace utils {
+
+// Narrowphase callback discarding contacts detected beyond a fraction of the collision envelopes.
+class ChRealtimeScheduler::EnvelopeFilter : public ChCollisionSystem::NarrowphaseCallback {
+  public:
+    EnvelopeFilter(std::shared_ptr<ChCollisionSystem::NarrowphaseCallback> chained)
+        : m_chained(chained), m_factor(1) {}
+
+    virtual bool OnNarrowphase(ChCollisionInfo& info) override {
+        if (m_factor < 1 && info.distance > m_factor * (info.modelA->GetEnvelope() + info.modelB->GetEnvelope()))
+            return false;
+        return m_chained ? m_chained->OnNarrowphase(info) : true;
+    }
+
+    std::shared_ptr<ChCollisionSystem::NarrowphaseCallback> m_chained;  ///< previously registered callback
+    double m_factor;                                                    ///< current envelope factor
+};
+
+// -----------------------------------------------------------------------------
+
+ChRealtimeScheduler::ChRealtimeScheduler(ChSystem& sys, double step)
+    : m_sys(sys),
+      m_step(step),
+      m_budget(0.8),
+      m_min_iterations(0),
+      m_max_iterations(0),
+      m_iterations(0),
+      m_min_envelope(1),
+      m_envelope(1),
+      m_num_steps(0),
+      m_num_misses(0),
+      m_max_overrun(0),
+      m_last_cost(0),
+      m_max_cost(0) {
+    auto solver = sys.GetSolver() ? sys.GetSolver()->AsIterative() : nullptr;
+    if (solver) {
+        m_max_iterations = solver->GetMaxIterations();
+        m_min_iterations = std::max(1, m_max_iterations / 4);
+        m_iterations = m_max_iterations;
+    }
+    Reset();
+}
+
+ChRealtimeScheduler::~ChRealtimeScheduler() {
+    if (m_filter && m_sys.GetCollisionSystem())
+        m_sys.GetCollisionSystem()->RegisterNarrowphaseCallback(m_filter->m_chained);
+}
+
+void ChRealtimeScheduler::SetIterationRange(int min_iterations, int max_iterations) {
+    if (m_iterations == 0)
+        return;
+    m_min_iterations = std::max(1, min_iterations);
+    m_max_iterations = std::max(m_min_iterations, max_iterations);
+    m_iterations = m_max_iterations;
+}
+
+void ChRealtimeScheduler::SetEnvelopeRange(double min_factor) {
+    m_min_envelope = std::min(1.0, std::max(0.0, min_factor));
+    m_envelope = 1;
+    if (m_filter || m_min_envelope == 1)
+        return;
+
+    auto coll_sys = m_sys.GetCollisionSystem();
+    if (!coll_sys)
+        return;
+    m_filter = chrono_types::make_shared<EnvelopeFilter>(coll_sys->GetNarrowphaseCallback());
+    coll_sys->RegisterNarrowphaseCallback(m_filter);
+}
+
+bool ChRealtimeScheduler::PinThread(int cpu) {
+#if defined(_WIN32)
+    return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu) != 0;
+#elif defined(__linux__)
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu, &cpu_set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+#else
+    return false;
+#endif
+}
+
+void ChRealtimeScheduler::Reset() {
+    m_deadline = Clock::now();
+}
+
+// -----------------------------------------------------------------------------
+
+double ChRealtimeScheduler::Advance() {
+    auto frame = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(m_step));
+    m_deadline += frame;
+
+    auto start = Clock::now();
+    m_sys.DoStepDynamics(m_step);
+    auto end = Clock::now();
+
+    double cost = std::chrono::duration<double>(end - start).count();
+    m_num_steps++;
+    m_last_cost = cost;
+    m_max_cost = std::max(m_max_cost, cost);
+
+    Adapt(cost);
+
+    // Deadline miss: report and restart the frame schedule
+    if (end > m_deadline) {
+        MissInfo info;
+        info.step = m_num_steps - 1;
+        info.cost = cost;
+        info.overrun = std::chrono::duration<double>(end - m_deadline).count();
+        m_num_misses++;
+        m_max_overrun = std::max(m_max_overrun, info.overrun);
+        m_deadline = end;
+        if (m_miss_callback)
+            m_miss_callback(info);
+        return cost;
+    }
+
+    // Sleep for most of the remaining time, then spin until the end of the frame
+    auto spin = std::chrono::duration_cast<Clock::duration>(std::chrono::microseconds(500));
+    if (m_deadline - end > spin)
+        std::this_thread::sleep_until(m_deadline - spin);
+    while (Clock::now() < m_deadline) {
+    }
+
+    return cost;
+}
+
+// Adjust the solver iteration cap and the collision envelope factor, based on the cost of the last step.
+// Accuracy is reduced proportionally to the overrun of the step budget (first the iteration cap, then the
+// envelope) and restored gradually (first the envelope, then the iteration cap) when a step uses less than half of
+// the budget.
+void ChRealtimeScheduler::Adapt(double cost) {
+    double budget = m_budget * m_step;
+
+    if (cost > budget) {
+        double ratio = budget / cost;
+        if (m_iterations > m_min_iterations)
+            m_iterations = std::max(m_min_iterations, static_cast<int>(m_iterations * ratio));
+        else if (m_filter)
+            m_envelope = std::max(m_min_envelope, m_envelope * ratio);
+    } else if (cost < 0.5 * budget) {
+        if (m_filter && m_envelope < 1)
+            m_envelope = std::min(1.0, m_envelope + 0.1 * (1 - m_min_envelope));
+        else if (m_iterations < m_max_iterations)
+            m_iterations = std::min(m_max_iterations, m_iterations + std::max(1, m_iterations / 10));
+    }
+
+    auto solver = m_sys.GetSolver() ? m_sys.GetSolver()->AsIterative() : nullptr;
+    if (solver && m_iterations > 0)
+        solver->SetMaxIterations(m_iterations);
+    if (m_filter)
+        m_filter->m_factor = m_envelope;
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,147 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Deadline-aware real-time scheduler for hardware-in-the-loop simulation.
+//
+// =============================================================================
+
+#ifndef CH_REALTIME_SCHEDULER_H
+#define CH_REALTIME_SCHEDULER_H
+
+#include <chrono>
+#include <functional>
+#include <memory>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Deadline-aware real-time scheduler for hardware-in-the-loop simulation.
+/// Each call to Advance performs one integration step of the associated system and then waits until the end of the
+/// current real-time frame (of length equal to the step size). The wall-clock cost of each step is measured and, to
+/// keep it within a prescribed fraction of the frame (the step budget), the scheduler trades accuracy for speed:
+/// - the maximum number of iterations of an iterative solver is reduced (proportionally to the overrun) when a step
+///   exceeds its budget, and gradually restored when steps are well within budget;
+/// - optionally, once the iteration cap reached its lower bound, the effective collision envelope is shrunk (contacts
+///   detected at a separation larger than a fraction of the collision model envelopes are discarded), reducing the
+///   number of contacts passed to the solver when contact counts spike.
+///
+/// A deadline miss occurs when a step ends after the end of its frame. In that case the frame schedule is restarted
+/// from the current time (the lost time is not recovered), the miss is counted and reported through an optional
+/// callback.
+class ChApi ChRealtimeScheduler {
+  public:
+    /// Information on a deadline miss.
+    struct MissInfo {
+        unsigned int step;  ///< index of the step that missed its deadline
+        double cost;        ///< wall-clock cost of the step (s)
+        double overrun;     ///< time past the deadline (s)
+    };
+
+    /// Create a scheduler for the given system, with frames of the specified length (integration step size).
+    ChRealtimeScheduler(ChSystem& sys, double step);
+
+    /// Restore the system collision narrowphase callback (if envelope scaling was enabled).
+    ~ChRealtimeScheduler();
+
+    /// Set the step budget, as a fraction of the frame length (default: 0.8).
+    /// The rest of the frame is a safety margin for the work done outside Advance (e.g., driver inputs, rendering).
+    void SetBudget(double fraction) { m_budget = fraction; }
+
+    /// Set the range of the iterative solver iteration cap.
+    /// By default, the cap varies between 1/4 of the solver maximum number of iterations at construction and that
+    /// maximum number. Ignored if the system solver is not iterative.
+    void SetIterationRange(int min_iterations, int max_iterations);
+
+    /// Enable scaling of the collision envelope, down to the specified fraction of the collision model envelopes.
+    /// Envelope scaling is disabled by default (min_factor = 1). The scheduler registers a narrowphase callback with
+    /// the system collision system, which chains to any previously registered callback.
+    void SetEnvelopeRange(double min_factor);
+
+    /// Set a function to be called on each deadline miss.
+    void SetMissCallback(std::function<void(const MissInfo&)> callback) { m_miss_callback = callback; }
+
+    /// Pin the calling thread to the specified CPU.
+    /// Return false if thread affinity is not supported on this platform or the call failed.
+    static bool PinThread(int cpu);
+
+    /// Advance the system by one step, adapt the solver settings, and wait until the end of the frame.
+    /// Return the wall-clock cost of the step (s).
+    double Advance();
+
+    /// Restart the frame schedule from the current time (e.g., after a pause).
+    void Reset();
+
+    /// Get the number of steps performed.
+    unsigned int GetNumSteps() const { return m_num_steps; }
+
+    /// Get the number of deadline misses.
+    unsigned int GetNumMisses() const { return m_num_misses; }
+
+    /// Get the largest overrun of a missed deadline (s).
+    double GetMaxOverrun() const { return m_max_overrun; }
+
+    /// Get the wall-clock cost of the last step (s).
+    double GetLastStepCost() const { return m_last_cost; }
+
+    /// Get the largest wall-clock cost of a step (s).
+    double GetMaxStepCost() const { return m_max_cost; }
+
+    /// Get the current iteration cap (0 if the system solver is not iterative).
+    int GetMaxIterations() const { return m_iterations; }
+
+    /// Get the current collision envelope scaling factor.
+    double GetEnvelopeFactor() const { return m_envelope; }
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    class EnvelopeFilter;
+
+    void Adapt(double cost);
+
+    ChSystem& m_sys;
+    double m_step;
+    double m_budget;
+
+    int m_min_iterations;
+    int m_max_iterations;
+    int m_iterations;
+
+    double m_min_envelope;
+    double m_envelope;
+    std::shared_ptr<EnvelopeFilter> m_filter;
+
+    Clock::time_point m_deadline;
+
+    unsigned int m_num_steps;
+    unsigned int m_num_misses;
+    double m_max_overrun;
+    double m_last_cost;
+    double m_max_cost;
+
+    std::function<void(const MissInfo&)> m_miss_callback;
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
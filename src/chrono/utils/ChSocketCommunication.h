@@ -31,6 +31,8 @@ namespace utils {
 /// Typically, a Chrono program can instance an object from this class and use it to communicate with a 3rd party
 /// simulation tool at each time step. The communication is based on TCP sockets, where vectors of scalar values are
 /// exchanged back and forth. In this case, Chrono will work as a server, waiting for a client to talk with.
+/// See ChFramedCommunication for an interface with typed, variable-length channels, shared-memory transport, and
+/// pipelined exchange.
 class ChApi ChSocketCommunication {
   public:
     /// Create a co-simulation interface.
@@ -0,0 +1,122 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Bulk access to the state of a system through contiguous arrays.
+//
+// =============================================================================
+
+#include <stdexcept>
+
+#include "chrono/physics/ChContactContainer.h"
+#include "chrono/utils/ChStateArrays.h"
+
+namespace chrono {
+namespace utils {
+
+ChStateArrays::ChStateArrays(ChSystem& sys) : m_system(sys), m_x(&sys), m_v(&sys), m_time(0) {
+    SetBodies(sys.GetBodies());
+}
+
+void ChStateArrays::SetBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    m_bodies = bodies;
+
+    auto n = (Eigen::Index)m_bodies.size();
+    m_body_pos.setZero(n, 3);
+    m_body_rot.setZero(n, 4);
+    m_body_linvel.setZero(n, 3);
+    m_body_angvel.setZero(n, 3);
+    m_body_cforce.setZero(n, 3);
+    m_body_ctorque.setZero(n, 3);
+}
+
+void ChStateArrays::SetNodes(const std::vector<std::shared_ptr<fea::ChNodeFEAxyz>>& nodes) {
+    m_nodes = nodes;
+
+    auto n = (Eigen::Index)m_nodes.size();
+    m_node_pos.setZero(n, 3);
+    m_node_vel.setZero(n, 3);
+}
+
+void ChStateArrays::AddNodes(const fea::ChMesh& mesh) {
+    auto nodes = m_nodes;
+    for (const auto& node : mesh.GetNodes()) {
+        if (auto node_xyz = std::dynamic_pointer_cast<fea::ChNodeFEAxyz>(node))
+            nodes.push_back(node_xyz);
+    }
+    SetNodes(nodes);
+}
+
+// -----------------------------------------------------------------------------
+
+void ChStateArrays::GatherState() {
+    // Resizing to the current size does not reallocate the state vectors
+    m_system.Setup();
+    m_x.setZero(m_system.GetNumCoordsPosLevel(), &m_system);
+    m_v.setZero(m_system.GetNumCoordsVelLevel(), &m_system);
+    m_system.StateGather(m_x, m_v, m_time);
+}
+
+void ChStateArrays::ScatterState(bool full_update) {
+    if (m_x.size() != m_system.GetNumCoordsPosLevel() || m_v.size() != m_system.GetNumCoordsVelLevel())
+        throw std::runtime_error("ChStateArrays::ScatterState - state size does not match the system.");
+    m_system.StateScatter(m_x, m_v, m_time, full_update);
+}
+
+// -----------------------------------------------------------------------------
+
+void ChStateArrays::Update() {
+    auto contacts = m_system.GetContactContainer();
+
+    for (size_t i = 0; i < m_bodies.size(); i++) {
+        const auto& body = m_bodies[i];
+        m_body_pos.row(i) = body->GetPos().eigen();
+        m_body_rot.row(i) = body->GetRot().eigen();
+        m_body_linvel.row(i) = body->GetLinVel().eigen();
+        m_body_angvel.row(i) = body->GetAngVelParent().eigen();
+        m_body_cforce.row(i) = contacts->GetContactableForce(body.get()).eigen();
+        m_body_ctorque.row(i) = contacts->GetContactableTorque(body.get()).eigen();
+    }
+
+    for (size_t i = 0; i < m_nodes.size(); i++) {
+        const auto& node = m_nodes[i];
+        m_node_pos.row(i) = node->GetPos().eigen();
+        m_node_vel.row(i) = node->GetPosDt().eigen();
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void ChStateArrays::SetBodyForces(ChMatrixConstRef forces, ChMatrixConstRef torques) {
+    auto n = (Eigen::Index)m_bodies.size();
+    if (forces.rows() != n || forces.cols() != 3 || torques.rows() != n || torques.cols() != 3)
+        throw std::runtime_error("ChStateArrays::SetBodyForces - arrays must have 3 columns and one row per body.");
+
+    for (size_t i = 0; i < m_bodies.size(); i++) {
+        const auto& body = m_bodies[i];
+        body->EmptyAccumulators();
+        body->AccumulateForce(ChVector3d(forces(i, 0), forces(i, 1), forces(i, 2)), body->GetPos(), false);
+        body->AccumulateTorque(ChVector3d(torques(i, 0), torques(i, 1), torques(i, 2)), false);
+    }
+}
+
+void ChStateArrays::SetNodeForces(ChMatrixConstRef forces) {
+    if (forces.rows() != (Eigen::Index)m_nodes.size() || forces.cols() != 3)
+        throw std::runtime_error("ChStateArrays::SetNodeForces - array must have 3 columns and one row per node.");
+
+    for (size_t i = 0; i < m_nodes.size(); i++)
+        m_nodes[i]->SetForce(ChVector3d(forces(i, 0), forces(i, 1), forces(i, 2)));
+}
+
+}  // end namespace utils
+}  // end namespace chrono
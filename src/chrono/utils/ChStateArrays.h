@@ -0,0 +1,143 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Bulk access to the state of a system through contiguous arrays.
+//
+// =============================================================================
+
+#ifndef CH_STATE_ARRAYS_H
+#define CH_STATE_ARRAYS_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChMatrix.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/fea/ChNodeFEAxyz.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Bulk access to the state of a system through contiguous arrays.
+/// This class gathers the system state vectors (see ChSystem::StateGather) and per-item arrays for a selection of
+/// bodies and FEA nodes in a single call, and applies forces to all selected items from arrays. It is meant for
+/// clients (e.g., reinforcement learning loops driven from Python) for which per-object queries dominate the cost.
+///
+/// All arrays are stored as row-major dense matrices (one row per item) and are only reallocated if the number of rows
+/// changes (when the body or node selection changes, or when the size of the system state changes). Their data can
+/// therefore be wrapped without copies (e.g., as NumPy arrays through the Python buffer protocol) and refreshed in
+/// place with GatherState and Update.
+class ChApi ChStateArrays {
+  public:
+    /// Create a state array view of the given system, with all its bodies selected.
+    ChStateArrays(ChSystem& sys);
+
+    /// Select the bodies included in the per-body arrays.
+    void SetBodies(const std::vector<std::shared_ptr<ChBody>>& bodies);
+
+    /// Select the FEA nodes included in the per-node arrays.
+    void SetNodes(const std::vector<std::shared_ptr<fea::ChNodeFEAxyz>>& nodes);
+
+    /// Add all xyz nodes (ChNodeFEAxyz and derived) of the given mesh to the selected FEA nodes.
+    void AddNodes(const fea::ChMesh& mesh);
+
+    /// Return the number of selected bodies.
+    unsigned int GetNumBodies() const { return (unsigned int)m_bodies.size(); }
+
+    /// Return the number of selected FEA nodes.
+    unsigned int GetNumNodes() const { return (unsigned int)m_nodes.size(); }
+
+    /// Load the system state vectors (positions, velocities, and time).
+    void GatherState();
+
+    /// Set the system state from the state vectors (possibly modified since the last call to GatherState).
+    /// If full_update = true, the system is also updated (including visualization assets, if any).
+    void ScatterState(bool full_update = true);
+
+    /// Get the system state, position level.
+    ChState& GetState() { return m_x; }
+
+    /// Get the system state, velocity level.
+    ChStateDelta& GetStateDelta() { return m_v; }
+
+    /// Get the time of the system state.
+    double GetTime() const { return m_time; }
+
+    /// Load the per-body and per-node arrays from the current state of the selected items.
+    void Update();
+
+    /// Get the positions of the selected bodies (one row per body).
+    const ChMatrixDynamic<>& GetBodyPositions() const { return m_body_pos; }
+
+    /// Get the orientations (quaternions, e0 first) of the selected bodies (one row per body).
+    const ChMatrixDynamic<>& GetBodyRotations() const { return m_body_rot; }
+
+    /// Get the linear velocities of the selected bodies (one row per body).
+    const ChMatrixDynamic<>& GetBodyLinVelocities() const { return m_body_linvel; }
+
+    /// Get the angular velocities (in the absolute frame) of the selected bodies (one row per body).
+    const ChMatrixDynamic<>& GetBodyAngVelocities() const { return m_body_angvel; }
+
+    /// Get the resultant contact forces on the selected bodies (one row per body).
+    /// Forces are expressed in the absolute frame and applied at the body COM.
+    const ChMatrixDynamic<>& GetBodyContactForces() const { return m_body_cforce; }
+
+    /// Get the resultant contact torques on the selected bodies (one row per body).
+    const ChMatrixDynamic<>& GetBodyContactTorques() const { return m_body_ctorque; }
+
+    /// Get the positions of the selected FEA nodes (one row per node).
+    const ChMatrixDynamic<>& GetNodePositions() const { return m_node_pos; }
+
+    /// Get the velocities of the selected FEA nodes (one row per node).
+    const ChMatrixDynamic<>& GetNodeVelocities() const { return m_node_vel; }
+
+    /// Set the forces and torques applied to the selected bodies (one row per body, 3 columns each).
+    /// The force and torque accumulators of the selected bodies are reset. Forces (applied at the body COM) and
+    /// torques are expressed in the absolute frame.
+    void SetBodyForces(ChMatrixConstRef forces, ChMatrixConstRef torques);
+
+    /// Set the forces applied to the selected FEA nodes (one row per node, 3 columns).
+    void SetNodeForces(ChMatrixConstRef forces);
+
+  private:
+    ChSystem& m_system;
+
+    std::vector<std::shared_ptr<ChBody>> m_bodies;
+    std::vector<std::shared_ptr<fea::ChNodeFEAxyz>> m_nodes;
+
+    ChState m_x;       ///< system state, position level
+    ChStateDelta m_v;  ///< system state, velocity level
+    double m_time;     ///< time of the system state
+
+    ChMatrixDynamic<> m_body_pos;      ///< body positions
+    ChMatrixDynamic<> m_body_rot;      ///< body orientations
+    ChMatrixDynamic<> m_body_linvel;   ///< body linear velocities
+    ChMatrixDynamic<> m_body_angvel;   ///< body angular velocities
+    ChMatrixDynamic<> m_body_cforce;   ///< body contact forces
+    ChMatrixDynamic<> m_body_ctorque;  ///< body contact torques
+    ChMatrixDynamic<> m_node_pos;      ///< node positions
+    ChMatrixDynamic<> m_node_vel;      ///< node velocities
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,122 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Ensemble of independent systems advanced in parallel (e.g., vectorized
+// environments for reinforcement learning).
+//
+// =============================================================================
+
+#include <stdexcept>
+
+#include "chrono/core/ChTaskScheduler.h"
+#include "chrono/utils/ChSystemEnsemble.h"
+
+namespace chrono {
+namespace utils {
+
+ChSystemEnsemble::ChSystemEnsemble(int num_envs, SystemFactory factory)
+    : m_factory(factory), m_num_actions(0), m_auto_reset(false), m_num_substeps(1), m_num_tasks(0) {
+    if (num_envs < 1)
+        throw std::runtime_error("ChSystemEnsemble - the number of environments must be positive.");
+    if (!m_factory)
+        throw std::runtime_error("ChSystemEnsemble - no system factory specified.");
+
+    m_systems.resize(num_envs);
+    m_obs.setZero(num_envs, 0);
+    m_rewards.setZero(num_envs);
+    m_done.setZero(num_envs);
+
+    ChTaskScheduler::GetGlobal().ParallelFor(
+        0, num_envs, [this](int env) { m_systems[env] = m_factory(env); }, m_num_tasks);
+
+    for (const auto& sys : m_systems) {
+        if (!sys)
+            throw std::runtime_error("ChSystemEnsemble - the system factory returned an empty system.");
+    }
+}
+
+void ChSystemEnsemble::SetActionFunction(int num_actions, ActionFunction func) {
+    m_num_actions = num_actions;
+    m_action_func = func;
+}
+
+void ChSystemEnsemble::SetObservationFunction(int num_observations, ObservationFunction func) {
+    m_obs_func = func;
+    m_obs.setZero(GetNumEnvironments(), num_observations);
+}
+
+// -----------------------------------------------------------------------------
+
+void ChSystemEnsemble::Reset() {
+    ChTaskScheduler::GetGlobal().ParallelFor(0, GetNumEnvironments(), [this](int env) { Reset(env); }, m_num_tasks);
+}
+
+void ChSystemEnsemble::Reset(int env) {
+    auto sys = m_factory(env);
+    if (!sys)
+        throw std::runtime_error("ChSystemEnsemble::Reset - the system factory returned an empty system.");
+    m_systems[env] = sys;
+    m_rewards(env) = 0;
+    m_done(env) = 0;
+    Observe(env);
+}
+
+// -----------------------------------------------------------------------------
+
+void ChSystemEnsemble::Step(double step, ChMatrixConstRef actions) {
+    if (actions.rows() != GetNumEnvironments() || actions.cols() != m_num_actions)
+        throw std::runtime_error("ChSystemEnsemble::Step - actions array must have one row per environment.");
+
+    // Rows of the row-major action array are contiguous
+    ChTaskScheduler::GetGlobal().ParallelFor(
+        0, GetNumEnvironments(),
+        [this, step, &actions](int env) { Advance(env, step, actions.data() + env * actions.outerStride()); },
+        m_num_tasks);
+}
+
+void ChSystemEnsemble::Step(double step) {
+    ChTaskScheduler::GetGlobal().ParallelFor(
+        0, GetNumEnvironments(), [this, step](int env) { Advance(env, step, nullptr); }, m_num_tasks);
+}
+
+void ChSystemEnsemble::Advance(int env, double step, const double* action) {
+    auto& sys = *m_systems[env];
+
+    if (m_action_func && action && m_num_actions > 0)
+        m_action_func(env, sys, Eigen::Map<const ChVectorDynamic<>>(action, m_num_actions));
+
+    for (int i = 0; i < m_num_substeps; i++)
+        sys.DoStepDynamics(step);
+
+    m_rewards(env) = m_reward_func ? m_reward_func(env, sys) : 0.0;
+    m_done(env) = (m_done_func && m_done_func(env, sys)) ? 1 : 0;
+
+    if (m_done(env) && m_auto_reset) {
+        m_systems[env] = m_factory(env);
+        if (!m_systems[env])
+            throw std::runtime_error("ChSystemEnsemble::Step - the system factory returned an empty system.");
+    }
+
+    Observe(env);
+}
+
+void ChSystemEnsemble::Observe(int env) {
+    if (!m_obs_func || m_obs.cols() == 0)
+        return;
+    auto obs = m_obs.row(env).transpose();
+    m_obs_func(env, *m_systems[env], obs);
+}
+
+}  // end namespace utils
+}  // end namespace chrono
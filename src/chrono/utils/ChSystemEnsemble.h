@@ -0,0 +1,155 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Ensemble of independent systems advanced in parallel (e.g., vectorized
+// environments for reinforcement learning).
+//
+// =============================================================================
+
+#ifndef CH_SYSTEM_ENSEMBLE_H
+#define CH_SYSTEM_ENSEMBLE_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChMatrix.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Ensemble of independent systems advanced in parallel.
+/// This class owns a set of independent systems (environments), all created by the same user-provided factory
+/// function, and advances all of them with a single call to Step. Environments are distributed over the threads of the
+/// global task scheduler (see ChTaskScheduler::GetGlobal). At each step, the actions for all environments are passed in
+/// a single array and the observations, rewards, and termination flags of all environments are collected in batched
+/// arrays (one row or entry per environment).
+///
+/// All batched arrays are stored as row-major dense matrices and are only reallocated if the number of environments
+/// or the observation size changes. Their data can therefore be wrapped without copies (e.g., as NumPy arrays through
+/// the Python buffer protocol).
+///
+/// Notes:
+/// - systems are created through a factory function rather than copied from a template system, because copying a
+///   system (ChSystem::Clone) does not duplicate its physics items.
+/// - the user callbacks are invoked concurrently for different environments and must therefore only access the system
+///   (and any data) of the environment they are called for.
+/// - each system runs with its own thread settings (see ChSystem::SetNumThreads); for best throughput, these should be
+///   left at their default value of 1 so that parallelism is only exploited across environments.
+class ChApi ChSystemEnsemble {
+  public:
+    /// Function creating the system of the specified environment.
+    using SystemFactory = std::function<std::shared_ptr<ChSystem>(int env)>;
+
+    /// Function applying the given action to the system of the specified environment, before a step.
+    using ActionFunction = std::function<void(int env, ChSystem& sys, ChVectorConstRef action)>;
+
+    /// Function loading the observation of the specified environment (size given by SetObservationFunction).
+    using ObservationFunction = std::function<void(int env, ChSystem& sys, ChVectorRef obs)>;
+
+    /// Function returning the reward of the specified environment, after a step.
+    using RewardFunction = std::function<double(int env, ChSystem& sys)>;
+
+    /// Function returning true if the specified environment reached a terminal state, after a step.
+    using DoneFunction = std::function<bool(int env, ChSystem& sys)>;
+
+    /// Create an ensemble of num_envs environments, with systems created by the given factory.
+    ChSystemEnsemble(int num_envs, SystemFactory factory);
+
+    /// Get the number of environments.
+    int GetNumEnvironments() const { return (int)m_systems.size(); }
+
+    /// Get the system of the specified environment.
+    ChSystem& GetSystem(int env) const { return *m_systems[env]; }
+
+    /// Set the function applying actions, with the specified action size (default: none).
+    void SetActionFunction(int num_actions, ActionFunction func);
+
+    /// Set the function loading observations, with the specified observation size (default: none).
+    void SetObservationFunction(int num_observations, ObservationFunction func);
+
+    /// Set the function evaluating rewards (default: none, all rewards are 0).
+    void SetRewardFunction(RewardFunction func) { m_reward_func = func; }
+
+    /// Set the function evaluating the termination of an environment (default: none, environments never terminate).
+    void SetDoneFunction(DoneFunction func) { m_done_func = func; }
+
+    /// Enable/disable automatic reset of terminated environments (default: false).
+    /// If enabled, an environment flagged as done at the end of a step is re-created and its observation (as returned
+    /// by GetObservations) is that of its new initial state. The done flag is still reported for that step.
+    void SetAutoReset(bool val) { m_auto_reset = val; }
+
+    /// Set the number of integration steps performed for each ensemble step (default: 1).
+    void SetNumSubsteps(int num_substeps) { m_num_substeps = num_substeps; }
+
+    /// Set the number of tasks over which environments are distributed (default: 0, automatic).
+    /// See ChTaskScheduler::ParallelFor. With num_tasks = 1, environments are advanced sequentially.
+    void SetNumTasks(int num_tasks) { m_num_tasks = num_tasks; }
+
+    /// Re-create all environments and load their observations.
+    void Reset();
+
+    /// Re-create the specified environment and load its observation.
+    void Reset(int env);
+
+    /// Advance all environments by the given step size, with the specified actions (one row per environment).
+    /// In each environment, the action is applied, the system is advanced by the specified number of substeps, and the
+    /// observation, reward, and termination flag are evaluated.
+    void Step(double step, ChMatrixConstRef actions);
+
+    /// Advance all environments by the given step size, without actions.
+    void Step(double step);
+
+    /// Get the observations of all environments (one row per environment).
+    const ChMatrixDynamic<>& GetObservations() const { return m_obs; }
+
+    /// Get the rewards of all environments after the last step.
+    const ChVectorDynamic<>& GetRewards() const { return m_rewards; }
+
+    /// Get the termination flags (1 for done, 0 otherwise) of all environments after the last step.
+    const ChVectorDynamic<int>& GetDone() const { return m_done; }
+
+  private:
+    void Observe(int env);
+    void Advance(int env, double step, const double* action);
+
+    SystemFactory m_factory;
+    std::vector<std::shared_ptr<ChSystem>> m_systems;
+
+    int m_num_actions;
+    ActionFunction m_action_func;
+    ObservationFunction m_obs_func;
+    RewardFunction m_reward_func;
+    DoneFunction m_done_func;
+
+    bool m_auto_reset;
+    int m_num_substeps;
+    int m_num_tasks;
+
+    ChMatrixDynamic<> m_obs;      ///< observations (one row per environment)
+    ChVectorDynamic<> m_rewards;  ///< rewards
+    ChVectorDynamic<int> m_done;  ///< termination flags
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
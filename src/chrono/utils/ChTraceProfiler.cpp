@@ -0,0 +1,140 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "chrono/utils/ChTraceProfiler.h"
+
+namespace chrono {
+namespace utils {
+
+namespace {
+
+struct TraceEvent {
+    const char* name;
+    int64_t start;
+    int64_t end;
+};
+
+// Event buffer for one thread. Buffers are owned by the global list and outlive their threads.
+struct ThreadBuffer {
+    int tid;
+    std::vector<TraceEvent> events;
+};
+
+std::atomic<bool> trace_enabled(false);
+std::mutex trace_mutex;
+std::vector<std::unique_ptr<ThreadBuffer>> trace_buffers;
+thread_local ThreadBuffer* trace_buffer = nullptr;
+
+const auto trace_origin = std::chrono::steady_clock::now();
+
+ThreadBuffer* GetThreadBuffer() {
+    if (!trace_buffer) {
+        std::lock_guard<std::mutex> lock(trace_mutex);
+        trace_buffers.push_back(std::unique_ptr<ThreadBuffer>(new ThreadBuffer));
+        trace_buffer = trace_buffers.back().get();
+        trace_buffer->tid = (int)trace_buffers.size() - 1;
+    }
+    return trace_buffer;
+}
+
+void WriteEscaped(std::ofstream& file, const char* str) {
+    for (const char* c = str; *c; c++) {
+        if (*c == '"' || *c == '\\')
+            file << '\\';
+        file << *c;
+    }
+}
+
+}  // end anonymous namespace
+
+void ChTraceProfiler::Enable(bool val) {
+    trace_enabled = val;
+}
+
+bool ChTraceProfiler::IsEnabled() {
+    return trace_enabled.load(std::memory_order_relaxed);
+}
+
+void ChTraceProfiler::Clear() {
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    for (auto& buffer : trace_buffers)
+        buffer->events.clear();
+}
+
+size_t ChTraceProfiler::GetNumEvents() {
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    size_t num_events = 0;
+    for (const auto& buffer : trace_buffers)
+        num_events += buffer->events.size();
+    return num_events;
+}
+
+bool ChTraceProfiler::WriteChromeTrace(const std::string& filename, bool clear) {
+    std::ofstream file(filename);
+    if (!file.is_open())
+        return false;
+
+    std::lock_guard<std::mutex> lock(trace_mutex);
+
+    // Times are reported in microseconds
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    bool first = true;
+    for (auto& buffer : trace_buffers) {
+        if (buffer->events.empty())
+            continue;
+
+        // Thread name metadata
+        file << (first ? "\n" : ",\n");
+        file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->tid
+             << ",\"args\":{\"name\":\"thread " << buffer->tid << "\"}}";
+        first = false;
+
+        // Complete events
+        for (const auto& e : buffer->events) {
+            file << ",\n{\"name\":\"";
+            WriteEscaped(file, e.name);
+            file << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->tid << ",\"ts\":" << e.start * 1e-3
+                 << ",\"dur\":" << (e.end - e.start) * 1e-3 << "}";
+        }
+
+        if (clear)
+            buffer->events.clear();
+    }
+
+    file << "\n]}\n";
+
+    return file.good();
+}
+
+void ChTraceProfiler::RecordEvent(const char* name, int64_t start, int64_t end) {
+    GetThreadBuffer()->events.push_back({name, start, end});
+}
+
+int64_t ChTraceProfiler::GetTime() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - trace_origin)
+        .count();
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,86 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_TRACE_PROFILER_H
+#define CH_TRACE_PROFILER_H
+
+#include <cstdint>
+#include <string>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+namespace utils {
+
+/// Thread-aware recorder of timed scopes, with export to the Chrome trace event format.\n
+/// Each thread records the (start, end) times of its scopes in a separate buffer, with no synchronization, so that
+/// scopes can be recorded from within OpenMP parallel regions. Nested scopes on the same thread appear as a call
+/// hierarchy when the trace is loaded in chrome://tracing or https://ui.perfetto.dev, and gaps between scopes on worker
+/// threads show where these threads are idle.\n
+/// Recording is disabled by default; when disabled, a scope costs only a check of the enabled flag.\n
+/// Scopes are usually recorded using the CH_TRACE macro (or CH_PROFILE, which also records trace events). Scope names
+/// are stored by pointer and must therefore remain valid until the trace is written (e.g., string literals).
+class ChApi ChTraceProfiler {
+  public:
+    /// Enable/disable recording of trace events (default: false).
+    static void Enable(bool val);
+
+    /// Return true if recording of trace events is enabled.
+    static bool IsEnabled();
+
+    /// Delete all recorded events.
+    /// Must not be called while other threads record events.
+    static void Clear();
+
+    /// Return the total number of events recorded (over all threads) since the last call to Clear.
+    static size_t GetNumEvents();
+
+    /// Write all recorded events to the specified file, in Chrome trace (JSON) format.
+    /// If 'clear' is true, the recorded events are deleted after writing; calling this function after each simulation
+    /// step or frame produces one trace file per frame. Must not be called while other threads record events.
+    /// Return false if the file cannot be written.
+    static bool WriteChromeTrace(const std::string& filename, bool clear = true);
+
+    /// Record an event with given name and start and end times (see GetTime), on the calling thread.
+    static void RecordEvent(const char* name, int64_t start, int64_t end);
+
+    /// Return the current time (in nanoseconds) relative to an arbitrary, fixed origin.
+    static int64_t GetTime();
+};
+
+/// Simple way to record a trace event for a scope.
+class ChApi ChTraceScope {
+  public:
+    ChTraceScope(const char* name)
+        : m_name(name), m_start(ChTraceProfiler::IsEnabled() ? ChTraceProfiler::GetTime() : -1) {}
+
+    ~ChTraceScope() {
+        if (m_start >= 0)
+            ChTraceProfiler::RecordEvent(m_name, m_start, ChTraceProfiler::GetTime());
+    }
+
+  private:
+    const char* m_name;
+    int64_t m_start;
+};
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#define CH_TRACE_CAT_IMPL(a, b) a##b
+#define CH_TRACE_CAT(a, b) CH_TRACE_CAT_IMPL(a, b)
+
+#define CH_TRACE(name) chrono::utils::ChTraceScope CH_TRACE_CAT(ch_trace_, __LINE__)(name)
+
+#endif
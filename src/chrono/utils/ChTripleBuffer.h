@@ -0,0 +1,85 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Lock-free triple buffer for passing state snapshots between two threads.
+//
+// =============================================================================
+
+#ifndef CH_TRIPLE_BUFFER_H
+#define CH_TRIPLE_BUFFER_H
+
+#include <atomic>
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Lock-free triple buffer for passing state snapshots from a producer thread to a consumer thread.
+/// The producer fills the write buffer and publishes it; the consumer acquires the most recently published buffer and
+/// reads it. Neither side ever waits for the other: the producer can publish at any rate (intermediate snapshots which
+/// are not acquired in time are dropped) and the consumer keeps reading its current buffer until a new one is
+/// published. Buffers are reused, so that snapshots with a constant size do not allocate after the first few uses.
+/// Only one producer thread and one consumer thread may use a given triple buffer.
+template <typename T>
+class ChTripleBuffer {
+  public:
+    ChTripleBuffer() : m_middle(1), m_write(0), m_read(2) {}
+
+    ChTripleBuffer(const ChTripleBuffer&) = delete;
+    ChTripleBuffer& operator=(const ChTripleBuffer&) = delete;
+
+    /// Access the buffer owned by the producer (producer thread only).
+    T& GetWriteBuffer() { return m_buffers[m_write]; }
+
+    /// Publish the write buffer and take ownership of a new one (producer thread only).
+    /// Note that the new write buffer contains an older snapshot.
+    void Publish() {
+        unsigned int prev = m_middle.exchange(m_write | NEW_DATA, std::memory_order_acq_rel);
+        m_write = prev & INDEX_MASK;
+    }
+
+    /// Return true if a snapshot was published since the last call to Acquire.
+    bool HasNewData() const { return (m_middle.load(std::memory_order_acquire) & NEW_DATA) != 0; }
+
+    /// Take ownership of the most recently published snapshot, if any (consumer thread only).
+    /// Return false (and keep the current read buffer) if no snapshot was published since the last call.
+    bool Acquire() {
+        if (!HasNewData())
+            return false;
+        unsigned int prev = m_middle.exchange(m_read, std::memory_order_acq_rel);
+        m_read = prev & INDEX_MASK;
+        return true;
+    }
+
+    /// Access the buffer owned by the consumer (consumer thread only).
+    const T& GetReadBuffer() const { return m_buffers[m_read]; }
+
+  private:
+    static constexpr unsigned int INDEX_MASK = 3;
+    static constexpr unsigned int NEW_DATA = 4;
+
+    T m_buffers[3];                      ///< snapshot buffers
+    std::atomic<unsigned int> m_middle;  ///< index of the shared buffer, with flag for unread data
+    unsigned int m_write;                ///< index of the buffer owned by the producer
+    unsigned int m_read;                 ///< index of the buffer owned by the consumer
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
@@ -26,8 +26,12 @@
 #include "chrono/assets/ChVisualShapeSphere.h"
 #include "chrono/assets/ChVisualShapeTriangleMesh.h"
 #include "chrono/geometry/ChLineBezier.h"
+#include "chrono/physics/ChContactContainerNSC.h"
 #include "chrono/utils/ChUtilsInputOutput.h"
 
+#include <cstring>
+#include <unordered_map>
+
 namespace chrono {
 namespace utils {
 
@@ -56,6 +60,40 @@ void WriteBodies(ChSystem* system,
     csv.WriteToFile(filename);
 }
 
+void WriteBodies(ChAsyncWriter& writer,
+                 ChSystem* system,
+                 const std::string& filename,
+                 bool active_only,
+                 bool dump_vel,
+                 const std::string& delim) {
+    // Snapshot of the body states (one row per body)
+    size_t num_cols = dump_vel ? 13 : 7;
+    auto values = std::make_shared<std::vector<double>>();
+    values->reserve(num_cols * system->GetBodies().size());
+    for (auto body : system->GetBodies()) {
+        if (active_only && !body->IsActive())
+            continue;
+        const auto& pos = body->GetPos();
+        const auto& rot = body->GetRot();
+        values->insert(values->end(), {pos.x(), pos.y(), pos.z(), rot.e0(), rot.e1(), rot.e2(), rot.e3()});
+        if (dump_vel) {
+            const auto& vel = body->GetPosDt();
+            auto omg = body->GetAngVelLocal();
+            values->insert(values->end(), {vel.x(), vel.y(), vel.z(), omg.x(), omg.y(), omg.z()});
+        }
+    }
+
+    writer.Submit([filename, delim, num_cols, values]() {
+        ChWriterCSV csv(delim);
+        for (size_t i = 0; i < values->size(); i += num_cols) {
+            for (size_t j = 0; j < num_cols; j++)
+                csv << (*values)[i + j];
+            csv << std::endl;
+        }
+        csv.WriteToFile(filename);
+    });
+}
+
 // -----------------------------------------------------------------------------
 // WriteCheckpoint
 //
@@ -350,6 +388,176 @@ void ReadCheckpoint(ChSystem* system, const std::string& filename) {
     }
 }
 
+// -----------------------------------------------------------------------------
+// WriteStateCheckpoint
+// ReadStateCheckpoint
+//
+// Binary state checkpoint. The fixed-size header is followed by the position,
+// velocity, acceleration, and reaction vectors, and by the persistent contact
+// points of the NSC warm start cache (each as 13 doubles: body and shape indices
+// of the two shapes, contact point, and 6 reactions), all 8-byte aligned so that
+// the file can also be memory-mapped.
+// -----------------------------------------------------------------------------
+struct StateCheckpointHeader {
+    char magic[8];            // "CHSTATE2"
+    uint64_t num_coords_pos;  // size of the position state vector
+    uint64_t num_coords_vel;  // size of the velocity and acceleration state vectors
+    uint64_t num_constr;      // size of the reaction vector (excluding contacts)
+    uint64_t num_contacts;    // number of persistent contact points
+    double time;              // system time
+};
+
+static const char state_checkpoint_magic[8] = {'C', 'H', 'S', 'T', 'A', 'T', 'E', '2'};
+
+static const int state_checkpoint_contact_size = 13;
+
+// Identify the collision models and shapes of the system bodies by the body index and the shape index in the collision
+// model (-1 for the collision model itself), as used by the NSC warm start cache.
+static std::unordered_map<const void*, std::pair<int, int>> GetCollisionShapeIds(ChSystem* system) {
+    std::unordered_map<const void*, std::pair<int, int>> ids;
+    const auto& bodies = system->GetBodies();
+    for (int ib = 0; ib < (int)bodies.size(); ib++) {
+        const auto& model = bodies[ib]->GetCollisionModel();
+        if (!model)
+            continue;
+        ids[model.get()] = std::make_pair(ib, -1);
+        for (int is = 0; is < (int)model->GetNumShapes(); is++)
+            ids[model->GetShapeInstance(is).first.get()] = std::make_pair(ib, is);
+    }
+    return ids;
+}
+
+static const void* GetCollisionShape(ChSystem* system, int ib, int is) {
+    const auto& bodies = system->GetBodies();
+    if (ib < 0 || ib >= (int)bodies.size())
+        return nullptr;
+    const auto& model = bodies[ib]->GetCollisionModel();
+    if (!model || is >= (int)model->GetNumShapes())
+        return nullptr;
+    return is < 0 ? (const void*)model.get() : (const void*)model->GetShapeInstance(is).first.get();
+}
+
+bool WriteStateCheckpoint(ChSystem* system, const std::string& filename) {
+    system->Setup();
+
+    // Contact reactions are saved through the persistent contacts of the warm start cache (contacts themselves are
+    // re-detected at the next step), so only the reactions of the other constraints are saved
+    unsigned int num_constr = system->GetNumConstraints() - system->GetContactContainer()->GetNumConstraints();
+
+    ChState x(system->GetNumCoordsPosLevel(), system);
+    ChStateDelta v(system->GetNumCoordsVelLevel(), system);
+    ChStateDelta a(system->GetNumCoordsVelLevel(), system);
+    ChVectorDynamic<> L(system->GetNumConstraints());
+    double time;
+    system->StateGather(x, v, time);
+    system->StateGatherAcceleration(a);
+    system->StateGatherReactions(L);
+
+    // Persistent contacts between shapes of the system bodies
+    std::vector<double> contacts;
+    if (auto container = std::dynamic_pointer_cast<ChContactContainerNSC>(system->GetContactContainer())) {
+        auto ids = GetCollisionShapeIds(system);
+        for (const auto& entry : container->ExportWarmStartCache()) {
+            auto idA = ids.find(entry.shapeA);
+            auto idB = ids.find(entry.shapeB);
+            if (idA == ids.end() || idB == ids.end())
+                continue;
+            contacts.push_back(idA->second.first);
+            contacts.push_back(idA->second.second);
+            contacts.push_back(idB->second.first);
+            contacts.push_back(idB->second.second);
+            contacts.push_back(entry.pos.x());
+            contacts.push_back(entry.pos.y());
+            contacts.push_back(entry.pos.z());
+            for (int i = 0; i < 6; i++)
+                contacts.push_back(entry.reactions[i]);
+        }
+    }
+
+    StateCheckpointHeader header;
+    std::memcpy(header.magic, state_checkpoint_magic, sizeof(header.magic));
+    header.num_coords_pos = x.size();
+    header.num_coords_vel = v.size();
+    header.num_constr = num_constr;
+    header.num_contacts = contacts.size() / state_checkpoint_contact_size;
+    header.time = time;
+
+    std::ofstream ofile(filename, std::ios::binary);
+    ofile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    ofile.write(reinterpret_cast<const char*>(x.data()), x.size() * sizeof(double));
+    ofile.write(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(double));
+    ofile.write(reinterpret_cast<const char*>(a.data()), a.size() * sizeof(double));
+    ofile.write(reinterpret_cast<const char*>(L.data()), num_constr * sizeof(double));
+    ofile.write(reinterpret_cast<const char*>(contacts.data()), contacts.size() * sizeof(double));
+
+    return ofile.good();
+}
+
+bool ReadStateCheckpoint(ChSystem* system, const std::string& filename) {
+    std::ifstream ifile(filename, std::ios::binary);
+    StateCheckpointHeader header;
+    if (!ifile.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, state_checkpoint_magic, sizeof(header.magic)) != 0) {
+        std::cerr << "utils::ReadStateCheckpoint ERROR: " << filename << " is not a state checkpoint file" << std::endl;
+        return false;
+    }
+
+    system->Setup();
+    unsigned int num_constr = system->GetNumConstraints() - system->GetContactContainer()->GetNumConstraints();
+
+    if (header.num_coords_pos != system->GetNumCoordsPosLevel() ||
+        header.num_coords_vel != system->GetNumCoordsVelLevel() || header.num_constr != num_constr) {
+        std::cerr << "utils::ReadStateCheckpoint ERROR: state sizes in " << filename
+                  << " do not match the system topology" << std::endl;
+        return false;
+    }
+
+    ChState x(system->GetNumCoordsPosLevel(), system);
+    ChStateDelta v(system->GetNumCoordsVelLevel(), system);
+    ChStateDelta a(system->GetNumCoordsVelLevel(), system);
+    ChVectorDynamic<> L(num_constr);
+    std::vector<double> contacts(header.num_contacts * state_checkpoint_contact_size);
+    ifile.read(reinterpret_cast<char*>(x.data()), x.size() * sizeof(double));
+    ifile.read(reinterpret_cast<char*>(v.data()), v.size() * sizeof(double));
+    ifile.read(reinterpret_cast<char*>(a.data()), a.size() * sizeof(double));
+    ifile.read(reinterpret_cast<char*>(L.data()), L.size() * sizeof(double));
+    ifile.read(reinterpret_cast<char*>(contacts.data()), contacts.size() * sizeof(double));
+    if (!ifile) {
+        std::cerr << "utils::ReadStateCheckpoint ERROR: " << filename << " is truncated" << std::endl;
+        return false;
+    }
+
+    // Restore the persistent contacts (this removes the current contacts, which are re-detected at the next step)
+    auto container = std::dynamic_pointer_cast<ChContactContainerNSC>(system->GetContactContainer());
+    if (container && container->IsWarmStartEnabled()) {
+        std::vector<ChContactContainerNSC::WarmStartEntry> entries;
+        for (size_t k = 0; k < contacts.size(); k += state_checkpoint_contact_size) {
+            const double* data = &contacts[k];
+            ChContactContainerNSC::WarmStartEntry entry;
+            entry.shapeA = GetCollisionShape(system, (int)data[0], (int)data[1]);
+            entry.shapeB = GetCollisionShape(system, (int)data[2], (int)data[3]);
+            if (!entry.shapeA || !entry.shapeB)
+                continue;
+            entry.pos = ChVector3d(data[4], data[5], data[6]);
+            for (int i = 0; i < 6; i++)
+                entry.reactions[i] = (float)data[7 + i];
+            entries.push_back(entry);
+        }
+        container->ImportWarmStartCache(entries);
+        system->Setup();
+    }
+
+    // Reactions of the current contacts (if any) are reset
+    ChVectorDynamic<> L_all = ChVectorDynamic<>::Zero(system->GetNumConstraints());
+    L_all.head(num_constr) = L;
+
+    system->StateScatter(x, v, header.time, true);
+    system->StateScatterAcceleration(a);
+    system->StateScatterReactions(L_all);
+
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // Write CSV output file with current camera information
 // -----------------------------------------------------------------------------
@@ -25,6 +25,10 @@
 //      contact geometry.
 //    - only a subset of contact shapes are currently supported
 //
+// WriteStateCheckpoint and ReadStateCheckpoint
+//  these functions write and read, respectively, a binary file with the state
+//  of a system (no topology), for fast restarts of an already constructed system.
+//
 // WriteVisualizationAssets
 //  this function writes a CSV file appropriate for processing with a POV-Ray
 //  script.
@@ -40,12 +44,15 @@
 #include <sstream>
 #include <fstream>
 #include <functional>
+#include <memory>
+#include <stdexcept>
 
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChBezierCurve.h"
 #include "chrono/assets/ChColor.h"
 #include "chrono/geometry/ChTriangleMeshConnected.h"
 #include "chrono/physics/ChSystem.h"
+#include "chrono/utils/ChAsyncWriter.h"
 #include "chrono/utils/ChUtilsCreators.h"
 
 namespace chrono {
@@ -73,6 +80,20 @@ class ChApi ChWriterCSV {
         ofile.close();
     }
 
+    /// Write the current contents to the specified file on the worker thread of the given asynchronous writer.
+    /// The contents are copied, so this object can be reused immediately.
+    void WriteToFile(ChAsyncWriter& writer, const std::string& filename, const std::string& header = "") const {
+        auto contents = std::make_shared<std::string>(m_ss.str());
+        writer.Submit([filename, header, contents]() {
+            std::ofstream ofile(filename);
+            if (!header.empty())
+                ofile << header << "\n";
+            ofile << *contents;
+            if (!ofile.good())
+                throw std::runtime_error("ChWriterCSV: cannot write file " + filename);
+        });
+    }
+
     void SetDelimiter(const std::string& delim) { m_delim = delim; }
     const std::string& GetDelimiter() const { return m_delim; }
     std::ostringstream& Stream() { return m_ss; }
@@ -137,12 +158,37 @@ ChApi void WriteBodies(ChSystem* system,
                        bool dump_vel = false,
                        const std::string& delim = ",");
 
+/// Asynchronous version of WriteBodies.
+/// The body states are copied on the calling thread; formatting and writing the CSV file are performed on the worker
+/// thread of the given asynchronous writer.
+ChApi void WriteBodies(ChAsyncWriter& writer,
+                       ChSystem* system,
+                       const std::string& filename,
+                       bool active_only = false,
+                       bool dump_vel = false,
+                       const std::string& delim = ",");
+
 /// Create a CSV file with a checkpoint.
 ChApi bool WriteCheckpoint(ChSystem* system, const std::string& filename);
 
 /// Read a CSV file with a checkpoint.
 ChApi void ReadCheckpoint(ChSystem* system, const std::string& filename);
 
+/// Write a binary file with the current state of the given system.
+/// Unlike WriteCheckpoint or the serialization archives, only the system time and the state vectors are saved:
+/// positions, velocities, accelerations, and constraint reactions (used to warm start iterative solvers), each as a
+/// raw contiguous block of doubles following a fixed-size header. The system topology is not saved; restarting
+/// requires re-creating the same system first (e.g., with the same construction code or from a one-time archive).
+/// Contacts are not saved, as they are re-detected at the next step; however, if the system uses an NSC contact
+/// container with warm start enabled, the persistent contact points of its warm start cache are saved (and restored
+/// by ReadStateCheckpoint), so that contact reactions are warm started as in an uninterrupted simulation.
+ChApi bool WriteStateCheckpoint(ChSystem* system, const std::string& filename);
+
+/// Load the state of the given system from a binary file created with WriteStateCheckpoint.
+/// The system must have the same topology as the one that was saved. Return false if the file cannot be read or if its
+/// state sizes do not match those of the system.
+ChApi bool ReadStateCheckpoint(ChSystem* system, const std::string& filename);
+
 /// Write CSV output file with camera information for off-line visualization.
 /// The output file includes three vectors, one per line, for camera position, camera target (look-at point), and camera
 /// up vector, respectively.
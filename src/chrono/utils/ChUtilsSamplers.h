@@ -23,6 +23,10 @@
 //  - implements Poisson Disk sampler - uniform random distribution with
 //    guaranteed minimum distance between any two sample points.
 //
+// ChPDTiledSampler
+//  - multithreaded Poisson Disk sampler - the domain is split in tiles which
+//    are sampled in parallel, in two passes.
+//
 // ChGridSampler
 //  - uniform grid
 //
@@ -33,8 +37,10 @@
 #ifndef CH_UTILS_SAMPLERS_H
 #define CH_UTILS_SAMPLERS_H
 
+#include <algorithm>
 #include <cmath>
 #include <list>
+#include <numeric>
 #include <random>
 #include <utility>
 #include <vector>
@@ -111,42 +117,78 @@ class ChSampler {
 
     /// Return points sampled from the specified box volume.
     PointVector SampleBox(const ChVector3<T>& center, const ChVector3<T>& halfDim) {
+        PointVector points;
+        SampleBox(center, halfDim, points);
+        return points;
+    }
+
+    /// Return points sampled from the specified spherical volume.
+    PointVector SampleSphere(const ChVector3<T>& center, T radius) {
+        PointVector points;
+        SampleSphere(center, radius, points);
+        return points;
+    }
+
+    /// Return points sampled from the specified X-aligned cylindrical volume.
+    PointVector SampleCylinderX(const ChVector3<T>& center, T radius, T halfHeight) {
+        PointVector points;
+        SampleCylinderX(center, radius, halfHeight, points);
+        return points;
+    }
+
+    /// Return points sampled from the specified Y-aligned cylindrical volume.
+    PointVector SampleCylinderY(const ChVector3<T>& center, T radius, T halfHeight) {
+        PointVector points;
+        SampleCylinderY(center, radius, halfHeight, points);
+        return points;
+    }
+
+    /// Return points sampled from the specified Z-aligned cylindrical volume.
+    PointVector SampleCylinderZ(const ChVector3<T>& center, T radius, T halfHeight) {
+        PointVector points;
+        SampleCylinderZ(center, radius, halfHeight, points);
+        return points;
+    }
+
+    /// Sample the specified box volume, replacing the contents of the given vector.
+    /// Passing the same vector over successive calls reuses its storage.
+    void SampleBox(const ChVector3<T>& center, const ChVector3<T>& halfDim, PointVector& points) {
         m_center = center;
         m_size = halfDim;
         SetFuzz();
-        return Sample(BOX);
+        Sample(BOX, points);
     }
 
-    /// Return points sampled from the specified spherical volume.
-    PointVector SampleSphere(const ChVector3<T>& center, T radius) {
+    /// Sample the specified spherical volume, replacing the contents of the given vector.
+    void SampleSphere(const ChVector3<T>& center, T radius, PointVector& points) {
         m_center = center;
         m_size = ChVector3<T>(radius, radius, radius);
         SetFuzz();
-        return Sample(SPHERE);
+        Sample(SPHERE, points);
     }
 
-    /// Return points sampled from the specified X-aligned cylindrical volume.
-    PointVector SampleCylinderX(const ChVector3<T>& center, T radius, T halfHeight) {
+    /// Sample the specified X-aligned cylindrical volume, replacing the contents of the given vector.
+    void SampleCylinderX(const ChVector3<T>& center, T radius, T halfHeight, PointVector& points) {
         m_center = center;
         m_size = ChVector3<T>(halfHeight, radius, radius);
         SetFuzz();
-        return Sample(CYLINDER_X);
+        Sample(CYLINDER_X, points);
     }
 
-    /// Return points sampled from the specified Y-aligned cylindrical volume.
-    PointVector SampleCylinderY(const ChVector3<T>& center, T radius, T halfHeight) {
+    /// Sample the specified Y-aligned cylindrical volume, replacing the contents of the given vector.
+    void SampleCylinderY(const ChVector3<T>& center, T radius, T halfHeight, PointVector& points) {
         m_center = center;
         m_size = ChVector3<T>(radius, halfHeight, radius);
         SetFuzz();
-        return Sample(CYLINDER_Y);
+        Sample(CYLINDER_Y, points);
     }
 
-    /// Return points sampled from the specified Z-aligned cylindrical volume.
-    PointVector SampleCylinderZ(const ChVector3<T>& center, T radius, T halfHeight) {
+    /// Sample the specified Z-aligned cylindrical volume, replacing the contents of the given vector.
+    void SampleCylinderZ(const ChVector3<T>& center, T radius, T halfHeight, PointVector& points) {
         m_center = center;
         m_size = ChVector3<T>(radius, radius, halfHeight);
         SetFuzz();
-        return Sample(CYLINDER_Z);
+        Sample(CYLINDER_Z, points);
     }
 
     /// Get the current value of the suggested minimum separation.
@@ -155,14 +197,22 @@ class ChSampler {
     /// Change the suggested minimum separation for subsequent calls to Sample.
     virtual void SetSeparation(T separation) { m_separation = separation; }
 
+    /// Set the number of OpenMP threads used for sampling (default: 1).
+    /// The grid and HCP samplers produce the same points for any number of threads. The serial Poisson Disk sampler
+    /// (ChPDSampler) ignores this setting.
+    void SetNumThreads(int num_threads) { m_num_threads = std::max(1, num_threads); }
+
+    /// Get the number of threads used for sampling.
+    int GetNumThreads() const { return m_num_threads; }
+
   protected:
     enum VolumeType { BOX, SPHERE, CYLINDER_X, CYLINDER_Y, CYLINDER_Z };
 
-    ChSampler(T separation) : m_separation(separation) {}
+    ChSampler(T separation) : m_separation(separation), m_num_threads(1) {}
 
-    /// Worker function for sampling the given domain.
+    /// Worker function for sampling the given domain, replacing the contents of the output vector.
     /// Implemented by concrete samplers.
-    virtual PointVector Sample(VolumeType t) = 0;
+    virtual void Sample(VolumeType t, PointVector& out_points) = 0;
 
     /// Utility function to check if a point is inside the sampling volume.
     bool accept(VolumeType t, const ChVector3<T>& p) const {
@@ -192,6 +242,7 @@ class ChSampler {
     T m_fuzz;               ///< fuzz value to account for roundoff error
     ChVector3<T> m_center;  ///< center of the sampling volume
     ChVector3<T> m_size;    ///< half dimensions of the bounding box of the sampling volume
+    int m_num_threads;      ///< number of threads used for sampling
 
   private:
     void SetFuzz() { m_fuzz = (m_size.x() < 1) ? (T)1e-6 * m_size.x() : (T)1e-6; }
@@ -203,7 +254,7 @@ class ChPDGrid {
   public:
     typedef std::pair<Point, bool> Content;
 
-    ChPDGrid() {}
+    ChPDGrid() : m_dimX(0), m_dimY(0), m_dimZ(0) {}
 
     int GetDimX() const { return m_dimX; }
     int GetDimY() const { return m_dimY; }
@@ -275,8 +326,8 @@ class ChPDSampler : public ChSampler<T> {
     enum Direction2D { NONE, X_DIR, Y_DIR, Z_DIR };
 
     /// Worker function for sampling the given domain.
-    virtual PointVector Sample(VolumeType t) override {
-        PointVector out_points;
+    virtual void Sample(VolumeType t, PointVector& out_points) override {
+        out_points.clear();
 
         // Check 2D/3D. If the size in one direction (e.g. z) is less than the
         // minimum distance, we switch to a 2D sampling. All sample points will
@@ -325,8 +376,6 @@ class ChPDSampler : public ChSampler<T> {
             if (!found)
                 m_active.erase(point);
         }
-
-        return out_points;
     }
 
     /// Add the first point in the volume (selected randomly).
@@ -449,6 +498,180 @@ class ChPDSampler : public ChSampler<T> {
     static const int m_ppi_default = 30;
 };
 
+/// Multithreaded Poisson Disk sampler for 3D domains (box, sphere, or cylinder) or 2D domains (rectangle or circle).
+/// Like ChPDSampler, the sampler produces points uniformly distributed in the specified domain such that no two points
+/// are closer than the specified separation.
+///
+/// The background grid is split in slabs (tiles) along its longest direction, each at least 3 grid cells wide. Even
+/// tiles are sampled in parallel first, each with its own random-number engine; odd tiles are then sampled in
+/// parallel, checking candidates against the points already placed in the neighboring even tiles. Since tiles processed
+/// in the same pass never access the same grid cells, the minimum separation is also enforced across tile boundaries.
+///
+/// The output depends on the number of threads (which sets the number of tiles) and on the seed, but is reproducible
+/// for given values of both.
+template <typename T = double>
+class ChPDTiledSampler : public ChSampler<T> {
+  public:
+    typedef typename Types<T>::PointVector PointVector;
+    typedef typename ChSampler<T>::VolumeType VolumeType;
+
+    /// Construct a tiled Poisson Disk sampler with specified minimum distance and number of threads.
+    ChPDTiledSampler(T separation, int num_threads = 1, int pointsPerIteration = m_ppi_default)
+        : ChSampler<T>(separation), m_ppi(pointsPerIteration), m_seed(0) {
+        this->SetNumThreads(num_threads);
+    }
+
+    /// Set the seed of the random-number engines (default: 0).
+    void SetRandomEngineSeed(unsigned int seed) { m_seed = seed; }
+
+  private:
+    /// Worker function for sampling the given domain.
+    virtual void Sample(VolumeType t, PointVector& out_points) override {
+        // Switch to 2D sampling if the domain is thinner than the separation in one direction (see ChPDSampler)
+        m_flat = -1;
+        for (int i = 2; i >= 0 && m_flat < 0; i--) {
+            if (this->m_size[i] < this->m_separation) {
+                m_flat = i;
+                this->m_size[i] = 0;
+            }
+        }
+        m_cellSize = this->m_separation / std::sqrt((T)(m_flat < 0 ? 3 : 2));
+        m_bl = this->m_center - this->m_size;
+
+        m_grid = ChPDGrid<ChVector3<T>>();
+        m_grid.Resize((int)(2 * this->m_size.x() / m_cellSize) + 1, (int)(2 * this->m_size.y() / m_cellSize) + 1,
+                      (int)(2 * this->m_size.z() / m_cellSize) + 1);
+
+        // Split the grid along its longest direction
+        int dims[3] = {m_grid.GetDimX(), m_grid.GetDimY(), m_grid.GetDimZ()};
+        m_axis = (int)(std::max_element(dims, dims + 3) - dims);
+        int num_tiles = std::max(1, std::min(2 * this->m_num_threads, dims[m_axis] / 3));
+
+        std::vector<PointVector> tile_points(num_tiles);
+        for (int pass = 0; pass < 2; pass++) {
+#pragma omp parallel for schedule(dynamic) num_threads(this->m_num_threads)
+            for (int tile = pass; tile < num_tiles; tile += 2) {
+                int lo = (int)((long long)tile * dims[m_axis] / num_tiles);
+                int hi = (int)((long long)(tile + 1) * dims[m_axis] / num_tiles);
+                SampleTile(t, tile, lo, hi, tile_points[tile]);
+            }
+        }
+
+        // Gather the tile points, in tile order
+        std::vector<size_t> offsets(num_tiles + 1, 0);
+        for (int tile = 0; tile < num_tiles; tile++)
+            offsets[tile + 1] = offsets[tile] + tile_points[tile].size();
+        out_points.resize(offsets[num_tiles]);
+
+#pragma omp parallel for num_threads(this->m_num_threads)
+        for (int tile = 0; tile < num_tiles; tile++)
+            std::copy(tile_points[tile].begin(), tile_points[tile].end(), out_points.begin() + offsets[tile]);
+    }
+
+    /// Sample the tile spanning grid cells [lo, hi) along the split direction.
+    void SampleTile(VolumeType t, int tile, int lo, int hi, PointVector& points) {
+        std::seed_seq seq{m_seed, (unsigned int)tile};
+        std::default_random_engine engine(seq);
+        std::uniform_real_distribution<T> realDist(0.0, 1.0);
+
+        // Seed the tile with a random point in its part of the domain
+        PointVector active;
+        for (int attempt = 0; attempt < m_seed_attempts && active.empty(); attempt++) {
+            ChVector3<T> p;
+            for (int i = 0; i < 3; i++)
+                p[i] = m_bl[i] + realDist(engine) * 2 * this->m_size[i];
+            p[m_axis] = m_bl[m_axis] + (lo + realDist(engine) * (hi - lo)) * m_cellSize;
+            AddPoint(t, p, lo, hi, points, active);
+        }
+
+        // As long as there are active points, attempt to add points near a randomly selected one
+        while (!active.empty()) {
+            std::uniform_int_distribution<size_t> intDist(0, active.size() - 1);
+            size_t ia = intDist(engine);
+            ChVector3<T> point = active[ia];
+
+            bool found = false;
+            for (int k = 0; k < m_ppi; k++)
+                found |= AddPoint(t, GenerateRandomNeighbor(point, engine, realDist), lo, hi, points, active);
+
+            // If not possible, remove the selected active point
+            if (!found) {
+                active[ia] = active.back();
+                active.pop_back();
+            }
+        }
+    }
+
+    /// Add the candidate point if it is in the domain, in the current tile, and far enough from all existing points.
+    bool AddPoint(VolumeType t, const ChVector3<T>& q, int lo, int hi, PointVector& points, PointVector& active) {
+        if (!this->accept(t, q))
+            return false;
+
+        int loc[3];
+        int dims[3] = {m_grid.GetDimX(), m_grid.GetDimY(), m_grid.GetDimZ()};
+        for (int i = 0; i < 3; i++) {
+            loc[i] = (int)((q[i] - m_bl[i]) / m_cellSize);
+            if (loc[i] < 0 || loc[i] >= dims[i])
+                return false;
+        }
+        if (loc[m_axis] < lo || loc[m_axis] >= hi)
+            return false;
+
+        // Only the 5x5x5 surrounding grid cells must be checked. These belong to this tile or to its neighbors, which
+        // are not modified during the current pass.
+        for (int i = loc[0] - 2; i < loc[0] + 3; i++) {
+            for (int j = loc[1] - 2; j < loc[1] + 3; j++) {
+                for (int k = loc[2] - 2; k < loc[2] + 3; k++) {
+                    if (m_grid.IsCellEmpty(i, j, k))
+                        continue;
+                    ChVector3<T> dist = q - m_grid.GetCellPoint(i, j, k);
+                    if (dist.Length2() < this->m_separation * this->m_separation)
+                        return false;
+                }
+            }
+        }
+
+        m_grid.SetCellPoint(loc[0], loc[1], loc[2], q);
+        active.push_back(q);
+        points.push_back(q);
+
+        return true;
+    }
+
+    /// Return a random point in spherical anulus between sep and 2*sep centered at given point.
+    ChVector3<T> GenerateRandomNeighbor(const ChVector3<T>& point,
+                                        std::default_random_engine& engine,
+                                        std::uniform_real_distribution<T>& realDist) const {
+        T radius = this->m_separation * (1 + realDist(engine));
+        T angle1 = 2 * Pi<T> * realDist(engine);
+
+        if (m_flat < 0) {
+            T angle2 = 2 * Pi<T> * realDist(engine);
+            return point + ChVector3<T>(std::cos(angle1) * std::sin(angle2), std::sin(angle1) * std::sin(angle2),
+                                        std::cos(angle2)) * radius;
+        }
+
+        ChVector3<T> q = point;
+        q[(m_flat + 1) % 3] += radius * std::cos(angle1);
+        q[(m_flat + 2) % 3] += radius * std::sin(angle1);
+        q[m_flat] = this->m_center[m_flat];
+        return q;
+    }
+
+    ChPDGrid<ChVector3<T>> m_grid;  ///< background grid, shared by all tiles
+
+    int m_flat;         ///< direction of 2D sampling (-1 for 3D sampling)
+    int m_axis;         ///< direction in which the grid is split in tiles
+    ChVector3<T> m_bl;  ///< bottom-left corner of sampling domain
+    T m_cellSize;       ///< grid cell size
+
+    int m_ppi;            ///< maximum points per iteration
+    unsigned int m_seed;  ///< seed of the random-number engines
+
+    static const int m_ppi_default = 30;
+    static const int m_seed_attempts = 1000;
+};
+
 /// Poisson Disk sampler for sampling a 3D box in layers.
 /// The computational efficiency of PD sampling degrades as points are added, especially for large volumes.
 /// This class provides an alternative sampling method where PD sampling is done in 2D layers, separated by a specified
@@ -498,29 +721,45 @@ class ChGridSampler : public ChSampler<T> {
 
   private:
     /// Worker function for sampling the given domain.
-    virtual PointVector Sample(VolumeType t) override {
-        PointVector out_points;
-
+    /// Points are counted and then generated in parallel over X slices, each written at its offset in the output.
+    virtual void Sample(VolumeType t, PointVector& out_points) override {
         ChVector3<int> n;    // number of divisions in each direction
         ChVector3<T> sep3D;  // adjusted separation in each direction
         for (int i = 0; i < 3; i++) {
             auto d = 2 * this->m_size[i];
-            n[i] = std::round(d / this->m_sep3D[i]);
-            sep3D[i] = d / n[i];
+            n[i] = (int)std::round(d / this->m_sep3D[i]);
+            sep3D[i] = (n[i] > 0) ? d / n[i] : 0;
         }
 
         ChVector3<T> bl = this->m_center - this->m_size;
+
+        std::vector<size_t> offsets(n[0] + 2, 0);
+#pragma omp parallel for num_threads(this->m_num_threads)
         for (int ix = 0; ix <= n[0]; ix++) {
+            size_t count = 0;
             for (int iy = 0; iy <= n[1]; iy++) {
                 for (int iz = 0; iz <= n[2]; iz++) {
                     auto p = bl + ChVector3<T>(ix * sep3D.x(), iy * sep3D.y(), iz * sep3D.z());
                     if (this->accept(t, p))
-                        out_points.push_back(p);
+                        count++;
                 }
             }
-        }        
+            offsets[ix + 1] = count;
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        out_points.resize(offsets.back());
 
-        return out_points;
+#pragma omp parallel for num_threads(this->m_num_threads)
+        for (int ix = 0; ix <= n[0]; ix++) {
+            size_t ip = offsets[ix];
+            for (int iy = 0; iy <= n[1]; iy++) {
+                for (int iz = 0; iz <= n[2]; iz++) {
+                    auto p = bl + ChVector3<T>(ix * sep3D.x(), iy * sep3D.y(), iz * sep3D.z());
+                    if (this->accept(t, p))
+                        out_points[ip++] = p;
+                }
+            }
+        }
     }
 
     ChVector3<T> m_sep3D;
@@ -537,9 +776,8 @@ class ChHCPSampler : public ChSampler<T> {
 
   private:
     /// Worker function for sampling the given domain.
-    virtual PointVector Sample(VolumeType t) override {
-        PointVector out_points;
-
+    /// Points are counted and then generated in parallel over Z layers, each written at its offset in the output.
+    virtual void Sample(VolumeType t, PointVector& out_points) override {
         ChVector3<T> bl = this->m_center - this->m_size;  // start corner of sampling domain
 
         T dx = this->m_separation;                              // distance between two points in X direction
@@ -550,21 +788,41 @@ class ChHCPSampler : public ChSampler<T> {
         int ny = (int)(2 * this->m_size.y() / dy) + 1;
         int nz = (int)(2 * this->m_size.z() / dz) + 1;
 
+        std::vector<size_t> offsets(nz + 1, 0);
+#pragma omp parallel for num_threads(this->m_num_threads)
         for (int k = 0; k < nz; k++) {
-            // Y offsets for alternate layers
-            T offset_y = (k % 2 == 0) ? 0 : dy / 3;
+            size_t count = 0;
             for (int j = 0; j < ny; j++) {
-                // X offset for current row and layer
-                T offset_x = ((j + k) % 2 == 0) ? 0 : dx / 2;
                 for (int i = 0; i < nx; i++) {
-                    ChVector3<T> p = bl + ChVector3<T>(offset_x + i * dx, offset_y + j * dy, k * dz);
+                    if (this->accept(t, LatticePoint(bl, dx, dy, dz, i, j, k)))
+                        count++;
+                }
+            }
+            offsets[k + 1] = count;
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        out_points.resize(offsets.back());
+
+#pragma omp parallel for num_threads(this->m_num_threads)
+        for (int k = 0; k < nz; k++) {
+            size_t ip = offsets[k];
+            for (int j = 0; j < ny; j++) {
+                for (int i = 0; i < nx; i++) {
+                    ChVector3<T> p = LatticePoint(bl, dx, dy, dz, i, j, k);
                     if (this->accept(t, p))
-                        out_points.push_back(p);
+                        out_points[ip++] = p;
                 }
             }
         }
+    }
 
-        return out_points;
+    /// Return the location of the specified HCP lattice point.
+    static ChVector3<T> LatticePoint(const ChVector3<T>& bl, T dx, T dy, T dz, int i, int j, int k) {
+        // Y offsets for alternate layers
+        T offset_y = (k % 2 == 0) ? 0 : dy / 3;
+        // X offset for current row and layer
+        T offset_x = ((j + k) % 2 == 0) ? 0 : dx / 2;
+        return bl + ChVector3<T>(offset_x + i * dx, offset_y + j * dy, k * dz);
     }
 };
 
@@ -0,0 +1,40 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHAPI_CUDSS_H
+#define CHAPI_CUDSS_H
+
+#include "chrono/ChVersion.h"
+#include "chrono/core/ChPlatform.h"
+
+// When compiling this library, remember to define CH_API_COMPILE_CUDSS
+// (so that the symbols with 'ChApiCuDSS' in front of them will be
+// marked as exported). Otherwise, just do not define it if you
+// link the library to your code, and the symbols will be imported.
+
+#if defined(CH_API_COMPILE_CUDSS)
+    #define ChApiCuDSS ChApiEXPORT
+#else
+    #define ChApiCuDSS ChApiIMPORT
+#endif
+
+/**
+    @defgroup cudss_module cuDSS module
+    @brief Module for GPU linear solvers based on the NVIDIA cuDSS, cuSPARSE, and cuBLAS libraries
+
+    This module provides a GPU sparse direct solver, through an interface to the NVIDIA cuDSS library, and a GPU
+    BiCGSTAB iterative solver, based on the cuSPARSE and cuBLAS libraries.
+*/
+
+#endif
@@ -0,0 +1,193 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <iostream>
+
+#include "chrono_cudss/ChSolverCuDSS.h"
+
+namespace chrono {
+
+ChSolverCuDSS::ChSolverCuDSS()
+    : m_handle(nullptr),
+      m_config(nullptr),
+      m_data(nullptr),
+      m_A(nullptr),
+      m_x(nullptr),
+      m_b(nullptr),
+      m_d_row_ptr(nullptr),
+      m_d_col_ind(nullptr),
+      m_d_values(nullptr),
+      m_d_x(nullptr),
+      m_d_b(nullptr),
+      m_d_dim(0),
+      m_d_nnz(0),
+      m_d_single(false),
+      m_factorized(false) {
+    Check(cudssCreate(&m_handle), "cudssCreate");
+    Check(cudssConfigCreate(&m_config), "cudssConfigCreate");
+}
+
+ChSolverCuDSS::~ChSolverCuDSS() {
+    FreeDeviceData();
+    if (m_config)
+        cudssConfigDestroy(m_config);
+    if (m_handle)
+        cudssDestroy(m_handle);
+}
+
+void ChSolverCuDSS::FreeDeviceData() {
+    if (m_A)
+        cudssMatrixDestroy(m_A);
+    if (m_x)
+        cudssMatrixDestroy(m_x);
+    if (m_b)
+        cudssMatrixDestroy(m_b);
+    if (m_data)
+        cudssDataDestroy(m_handle, m_data);
+    m_A = nullptr;
+    m_x = nullptr;
+    m_b = nullptr;
+    m_data = nullptr;
+
+    cudaFree(m_d_row_ptr);
+    cudaFree(m_d_col_ind);
+    cudaFree(m_d_values);
+    cudaFree(m_d_x);
+    cudaFree(m_d_b);
+    m_d_row_ptr = nullptr;
+    m_d_col_ind = nullptr;
+    m_d_values = nullptr;
+    m_d_x = nullptr;
+    m_d_b = nullptr;
+
+    m_d_dim = 0;
+    m_d_nnz = 0;
+    m_factorized = false;
+}
+
+bool ChSolverCuDSS::Check(cudssStatus_t status, const char* call) {
+    if (status == CUDSS_STATUS_SUCCESS)
+        return true;
+    m_error = std::string(call) + " failed with cuDSS status " + std::to_string((int)status);
+    return false;
+}
+
+bool ChSolverCuDSS::Check(cudaError_t status, const char* call) {
+    if (status == cudaSuccess)
+        return true;
+    m_error = std::string(call) + " failed: " + cudaGetErrorString(status);
+    return false;
+}
+
+bool ChSolverCuDSS::SupportsMixedPrecision() const {
+#ifdef CHRONO_CUDSS_MIXED_PRECISION
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool ChSolverCuDSS::FactorizeMatrix() {
+    if (!m_handle || !m_config)
+        return false;
+
+    // The matrix is in compressed row-major (CSR) format (see ChDirectSolverLS::Setup)
+    int n = (int)m_mat.rows();
+    int nnz = (int)m_mat.nonZeros();
+
+    bool analyze = m_analyze || !m_factorized || n != m_d_dim || nnz != m_d_nnz || m_single_factor != m_d_single;
+
+    // Values and vectors are stored on the device in the precision of the factorization
+    cudaDataType value_type = m_single_factor ? CUDA_R_32F : CUDA_R_64F;
+    size_t value_size = m_single_factor ? sizeof(float) : sizeof(double);
+
+    if (analyze) {
+        // Reallocate the device data and upload the sparsity pattern
+        FreeDeviceData();
+
+        bool ok = Check(cudaMalloc((void**)&m_d_row_ptr, (n + 1) * sizeof(int)), "cudaMalloc") &&
+                  Check(cudaMalloc((void**)&m_d_col_ind, nnz * sizeof(int)), "cudaMalloc") &&
+                  Check(cudaMalloc(&m_d_values, nnz * value_size), "cudaMalloc") &&
+                  Check(cudaMalloc(&m_d_x, n * value_size), "cudaMalloc") &&
+                  Check(cudaMalloc(&m_d_b, n * value_size), "cudaMalloc");
+        ok = ok &&
+             Check(cudaMemcpy(m_d_row_ptr, m_mat.outerIndexPtr(), (n + 1) * sizeof(int), cudaMemcpyHostToDevice),
+                   "cudaMemcpy") &&
+             Check(cudaMemcpy(m_d_col_ind, m_mat.innerIndexPtr(), nnz * sizeof(int), cudaMemcpyHostToDevice),
+                   "cudaMemcpy");
+        ok = ok &&
+             Check(cudssMatrixCreateCsr(&m_A, n, n, nnz, m_d_row_ptr, nullptr, m_d_col_ind, m_d_values, CUDA_R_32I,
+                                        value_type, CUDSS_MTYPE_GENERAL, CUDSS_MVIEW_FULL, CUDSS_BASE_ZERO),
+                   "cudssMatrixCreateCsr") &&
+             Check(cudssMatrixCreateDn(&m_x, n, 1, n, m_d_x, value_type, CUDSS_LAYOUT_COL_MAJOR),
+                   "cudssMatrixCreateDn") &&
+             Check(cudssMatrixCreateDn(&m_b, n, 1, n, m_d_b, value_type, CUDSS_LAYOUT_COL_MAJOR),
+                   "cudssMatrixCreateDn") &&
+             Check(cudssDataCreate(m_handle, &m_data), "cudssDataCreate");
+        if (!ok)
+            return false;
+
+        m_d_dim = n;
+        m_d_nnz = nnz;
+        m_d_single = m_single_factor;
+    }
+
+    // Upload the matrix values
+    const void* values = m_single_factor ? (const void*)m_mat_single.valuePtr() : (const void*)m_mat.valuePtr();
+    if (!Check(cudaMemcpy(m_d_values, values, nnz * value_size, cudaMemcpyHostToDevice), "cudaMemcpy"))
+        return false;
+
+    // Symbolic analysis only if the sparsity pattern changed; otherwise, numeric refactorization
+    if (analyze) {
+        if (!Check(cudssExecute(m_handle, CUDSS_PHASE_ANALYSIS, m_config, m_data, m_A, m_x, m_b), "analysis") ||
+            !Check(cudssExecute(m_handle, CUDSS_PHASE_FACTORIZATION, m_config, m_data, m_A, m_x, m_b),
+                   "factorization"))
+            return false;
+    } else {
+        if (!Check(cudssExecute(m_handle, CUDSS_PHASE_REFACTORIZATION, m_config, m_data, m_A, m_x, m_b),
+                   "refactorization"))
+            return false;
+    }
+
+    m_factorized = Check(cudaDeviceSynchronize(), "factorization");
+    return m_factorized;
+}
+
+bool ChSolverCuDSS::SolveSystem() {
+    int n = m_d_dim;
+    if (!m_factorized || m_rhs.size() != n)
+        return false;
+
+    if (m_d_single) {
+        m_h_single = m_rhs.cast<float>();
+        size_t size = n * sizeof(float);
+        bool ok = Check(cudaMemcpy(m_d_b, m_h_single.data(), size, cudaMemcpyHostToDevice), "cudaMemcpy") &&
+                  Check(cudssExecute(m_handle, CUDSS_PHASE_SOLVE, m_config, m_data, m_A, m_x, m_b), "solve") &&
+                  Check(cudaMemcpy(m_h_single.data(), m_d_x, size, cudaMemcpyDeviceToHost), "cudaMemcpy");
+        m_sol = m_h_single.cast<double>();
+        return ok;
+    }
+
+    bool ok = Check(cudaMemcpy(m_d_b, m_rhs.data(), n * sizeof(double), cudaMemcpyHostToDevice), "cudaMemcpy") &&
+              Check(cudssExecute(m_handle, CUDSS_PHASE_SOLVE, m_config, m_data, m_A, m_x, m_b), "solve") &&
+              Check(cudaMemcpy(m_sol.data(), m_d_x, n * sizeof(double), cudaMemcpyDeviceToHost), "cudaMemcpy");
+
+    return ok;
+}
+
+void ChSolverCuDSS::PrintErrorMessage() {
+    std::cout << m_error << std::endl;
+}
+
+}  // end namespace chrono
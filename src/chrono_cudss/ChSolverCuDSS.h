@@ -0,0 +1,117 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHSOLVER_CUDSS_H
+#define CHSOLVER_CUDSS_H
+
+#include <string>
+
+#include <cuda_runtime.h>
+#include <cudss.h>
+
+#include "chrono_cudss/ChApiCuDSS.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+
+namespace chrono {
+
+/// @addtogroup cudss_module
+/// @{
+
+/** \class ChSolverCuDSS
+\brief Interface to the NVIDIA cuDSS GPU sparse direct solver.
+
+Sparse linear direct solver.
+Cannot handle VI and complementarity problems, so it cannot be used with NSC formulations.
+
+The system matrix is assembled on the host (see ChDirectSolverLS) and its CSR arrays are copied to the device. The
+symbolic analysis (reordering and symbolic factorization) is performed only when the sparsity pattern changes; in
+between, only the matrix values are transferred and the matrix is refactorized on the GPU. It is therefore \e highly
+recommended to enable the sparsity pattern \e lock whenever the problem setup allows it.
+
+Mixed precision factorization (see ChDirectSolverLS::UseMixedPrecision) is supported only if the module is configured
+with CUDSS_MIXED_PRECISION (experimental, default OFF): the device matrix is then stored and factorized in single
+precision, and only the refinement residuals are computed in double precision on the host. Otherwise, the factorization
+is always performed in double precision.
+
+\note This module is experimental: it has not yet been validated on a CUDA system.
+
+Minimal usage example, to be put anywhere in the code, before starting the main simulation loop:
+\code{.cpp}
+auto cudss_solver = chrono_types::make_shared<ChSolverCuDSS>();
+cudss_solver->LockSparsityPattern(true);
+system.SetSolver(cudss_solver);
+\endcode
+
+See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the solver.
+*/
+class ChApiCuDSS ChSolverCuDSS : public ChDirectSolverLS {
+  public:
+    /// Construct a cuDSS sparse direct solver object.
+    ChSolverCuDSS();
+
+    ~ChSolverCuDSS();
+
+    virtual Type GetType() const override { return Type::CUDSS; }
+
+  private:
+    /// Factorize the current sparse matrix and return true if successful.
+    virtual bool FactorizeMatrix() override;
+
+    /// Solve the linear system using the current factorization and right-hand side vector.
+    /// Load the solution vector (already of appropriate size) and return true if succesful.
+    virtual bool SolveSystem() override;
+
+    /// Display an error message corresponding to the last failure.
+    /// This function is only called if Factorize or Solve returned false.
+    virtual void PrintErrorMessage() override;
+
+    /// The cuDSS solver supports mixed precision factorization if configured with CUDSS_MIXED_PRECISION.
+    virtual bool SupportsMixedPrecision() const override;
+
+    /// Release the device matrix and vectors.
+    void FreeDeviceData();
+
+    /// Record the status of a cuDSS call and return true if successful.
+    bool Check(cudssStatus_t status, const char* call);
+
+    /// Record the status of a CUDA runtime call and return true if successful.
+    bool Check(cudaError_t status, const char* call);
+
+    cudssHandle_t m_handle;  ///< cuDSS library handle
+    cudssConfig_t m_config;  ///< solver settings
+    cudssData_t m_data;      ///< factorization data (reused across refactorizations)
+    cudssMatrix_t m_A;       ///< device system matrix
+    cudssMatrix_t m_x;       ///< device solution vector
+    cudssMatrix_t m_b;       ///< device right-hand side vector
+
+    int* m_d_row_ptr;   ///< device CSR row pointers
+    int* m_d_col_ind;   ///< device CSR column indices
+    void* m_d_values;   ///< device CSR values (single or double precision)
+    void* m_d_x;        ///< device solution array (single or double precision)
+    void* m_d_b;        ///< device right-hand side array (single or double precision)
+    int m_d_dim;        ///< size of the device matrix
+    int m_d_nnz;        ///< number of non-zeros of the device matrix
+    bool m_d_single;    ///< are the device arrays in single precision?
+    bool m_factorized;  ///< is a factorization available for refactorization?
+
+    ChVectorDynamic<float> m_h_single;  ///< host single precision vector (right-hand side and solution)
+
+    std::string m_error;  ///< description of the last failed call
+};
+
+/// @} cudss_module
+
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,318 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <cmath>
+#include <iostream>
+
+#include "chrono_cudss/ChSolverCudaBiCGSTAB.h"
+
+namespace chrono {
+
+// Indices of the device work vectors
+enum WorkVector { VX, VB, VR, VR0, VP, VV, VS, VT, VY, VZ, VINVDIAG, NUM_WORK_VECTORS };
+
+ChSolverCudaBiCGSTAB::ChSolverCudaBiCGSTAB()
+    : m_sp_handle(nullptr),
+      m_bl_handle(nullptr),
+      m_A(nullptr),
+      m_vec_x(nullptr),
+      m_vec_y(nullptr),
+      m_d_row_ptr(nullptr),
+      m_d_col_ind(nullptr),
+      m_d_values(nullptr),
+      m_d_work(nullptr),
+      m_d_buffer(nullptr),
+      m_d_dim(0),
+      m_d_nnz(0),
+      m_iterations(0),
+      m_error(0) {
+    Check(cusparseCreate(&m_sp_handle), "cusparseCreate");
+    Check(cublasCreate(&m_bl_handle), "cublasCreate");
+}
+
+ChSolverCudaBiCGSTAB::~ChSolverCudaBiCGSTAB() {
+    FreeDeviceData();
+    if (m_bl_handle)
+        cublasDestroy(m_bl_handle);
+    if (m_sp_handle)
+        cusparseDestroy(m_sp_handle);
+}
+
+void ChSolverCudaBiCGSTAB::FreeDeviceData() {
+    if (m_A)
+        cusparseDestroySpMat(m_A);
+    if (m_vec_x)
+        cusparseDestroyDnVec(m_vec_x);
+    if (m_vec_y)
+        cusparseDestroyDnVec(m_vec_y);
+    m_A = nullptr;
+    m_vec_x = nullptr;
+    m_vec_y = nullptr;
+
+    cudaFree(m_d_row_ptr);
+    cudaFree(m_d_col_ind);
+    cudaFree(m_d_values);
+    cudaFree(m_d_work);
+    cudaFree(m_d_buffer);
+    m_d_row_ptr = nullptr;
+    m_d_col_ind = nullptr;
+    m_d_values = nullptr;
+    m_d_work = nullptr;
+    m_d_buffer = nullptr;
+
+    m_d_dim = 0;
+    m_d_nnz = 0;
+}
+
+bool ChSolverCudaBiCGSTAB::Check(cudaError_t status, const char* call) {
+    if (status == cudaSuccess)
+        return true;
+    m_error_msg = std::string(call) + " failed: " + cudaGetErrorString(status);
+    return false;
+}
+
+bool ChSolverCudaBiCGSTAB::Check(cusparseStatus_t status, const char* call) {
+    if (status == CUSPARSE_STATUS_SUCCESS)
+        return true;
+    m_error_msg = std::string(call) + " failed: " + cusparseGetErrorString(status);
+    return false;
+}
+
+bool ChSolverCudaBiCGSTAB::Check(cublasStatus_t status, const char* call) {
+    if (status == CUBLAS_STATUS_SUCCESS)
+        return true;
+    m_error_msg = std::string(call) + " failed with cuBLAS status " + std::to_string((int)status);
+    return false;
+}
+
+bool ChSolverCudaBiCGSTAB::Setup(ChSystemDescriptor& sysd) {
+    // The base class assembles the system matrix only for the block-sparse format or for the preconditioners built
+    // from the assembled matrix
+    if (!m_use_block && (!m_use_precond || m_precond_type == Preconditioner::DIAGONAL))
+        sysd.BuildSystemMatrix(&m_mat, nullptr);
+
+    return ChIterativeSolverLS::Setup(sysd);
+}
+
+bool ChSolverCudaBiCGSTAB::SetupProblem() {
+    if (!m_sp_handle || !m_bl_handle) {
+        std::cerr << "ChSolverCudaBiCGSTAB: " << m_error_msg << std::endl;
+        return false;
+    }
+
+    m_mat.makeCompressed();
+    int n = (int)m_mat.rows();
+    int nnz = (int)m_mat.nonZeros();
+
+    bool ok = true;
+
+    if (n != m_d_dim || nnz != m_d_nnz) {
+        // Reallocate the device data
+        FreeDeviceData();
+        double one = 1;
+        double zero = 0;
+        size_t buffer_size = 0;
+        ok = Check(cudaMalloc((void**)&m_d_row_ptr, (n + 1) * sizeof(int)), "cudaMalloc") &&
+             Check(cudaMalloc((void**)&m_d_col_ind, nnz * sizeof(int)), "cudaMalloc") &&
+             Check(cudaMalloc((void**)&m_d_values, nnz * sizeof(double)), "cudaMalloc") &&
+             Check(cudaMalloc((void**)&m_d_work, NUM_WORK_VECTORS * n * sizeof(double)), "cudaMalloc") &&
+             Check(cusparseCreateCsr(&m_A, n, n, nnz, m_d_row_ptr, m_d_col_ind, m_d_values, CUSPARSE_INDEX_32I,
+                                     CUSPARSE_INDEX_32I, CUSPARSE_INDEX_BASE_ZERO, CUDA_R_64F),
+                   "cusparseCreateCsr") &&
+             Check(cusparseCreateDnVec(&m_vec_x, n, m_d_work + VX * n, CUDA_R_64F), "cusparseCreateDnVec") &&
+             Check(cusparseCreateDnVec(&m_vec_y, n, m_d_work + VY * n, CUDA_R_64F), "cusparseCreateDnVec") &&
+             Check(cusparseSpMV_bufferSize(m_sp_handle, CUSPARSE_OPERATION_NON_TRANSPOSE, &one, m_A, m_vec_x, &zero,
+                                           m_vec_y, CUDA_R_64F, CUSPARSE_SPMV_ALG_DEFAULT, &buffer_size),
+                   "cusparseSpMV_bufferSize") &&
+             Check(cudaMalloc(&m_d_buffer, buffer_size), "cudaMalloc");
+        if (!ok) {
+            std::cerr << "ChSolverCudaBiCGSTAB: " << m_error_msg << std::endl;
+            return false;
+        }
+        m_d_dim = n;
+        m_d_nnz = nnz;
+    }
+
+    // Upload the matrix (the sparsity pattern may change even if the number of non-zeros does not)
+    ok = Check(cudaMemcpy(m_d_row_ptr, m_mat.outerIndexPtr(), (n + 1) * sizeof(int), cudaMemcpyHostToDevice),
+               "cudaMemcpy") &&
+         Check(cudaMemcpy(m_d_col_ind, m_mat.innerIndexPtr(), nnz * sizeof(int), cudaMemcpyHostToDevice),
+               "cudaMemcpy") &&
+         Check(cudaMemcpy(m_d_values, m_mat.valuePtr(), nnz * sizeof(double), cudaMemcpyHostToDevice), "cudaMemcpy");
+
+    // Upload the inverse diagonal for the diagonal preconditioner
+    if (ok && m_invdiag.size() == n) {
+        ok = Check(cudaMemcpy(m_d_work + VINVDIAG * n, m_invdiag.data(), n * sizeof(double), cudaMemcpyHostToDevice),
+                   "cudaMemcpy");
+    }
+
+    if (!ok)
+        std::cerr << "ChSolverCudaBiCGSTAB: " << m_error_msg << std::endl;
+
+    return ok;
+}
+
+bool ChSolverCudaBiCGSTAB::Multiply(double* d_x, double* d_y) {
+    double one = 1;
+    double zero = 0;
+    return Check(cusparseDnVecSetValues(m_vec_x, d_x), "cusparseDnVecSetValues") &&
+           Check(cusparseDnVecSetValues(m_vec_y, d_y), "cusparseDnVecSetValues") &&
+           Check(cusparseSpMV(m_sp_handle, CUSPARSE_OPERATION_NON_TRANSPOSE, &one, m_A, m_vec_x, &zero, m_vec_y,
+                              CUDA_R_64F, CUSPARSE_SPMV_ALG_DEFAULT, m_d_buffer),
+                 "cusparseSpMV");
+}
+
+bool ChSolverCudaBiCGSTAB::Precondition(const double* d_x, double* d_y) {
+    int n = m_d_dim;
+
+    // No preconditioning
+    if (!m_use_precond)
+        return Check(cudaMemcpy(d_y, d_x, n * sizeof(double), cudaMemcpyDeviceToDevice), "cudaMemcpy");
+
+    // Diagonal preconditioner, applied on the device
+    if (m_invdiag.size() == n) {
+        return Check(cublasDdgmm(m_bl_handle, CUBLAS_SIDE_LEFT, n, 1, d_x, n, m_d_work + VINVDIAG * n, 1, d_y, n),
+                     "cublasDdgmm");
+    }
+
+    // Other preconditioners, applied on the host
+    m_h_x.resize(n);
+    m_h_y.resize(n);
+    if (!Check(cudaMemcpy(m_h_x.data(), d_x, n * sizeof(double), cudaMemcpyDeviceToHost), "cudaMemcpy"))
+        return false;
+    ApplyPreconditioner(m_h_x, m_h_y);
+    return Check(cudaMemcpy(d_y, m_h_y.data(), n * sizeof(double), cudaMemcpyHostToDevice), "cudaMemcpy");
+}
+
+bool ChSolverCudaBiCGSTAB::SolveProblem() {
+    int n = m_d_dim;
+    m_iterations = 0;
+    m_error = 0;
+
+    if (n == 0 || m_rhs.size() != n)
+        return n == 0;
+
+    double* x = m_d_work + VX * n;
+    double* b = m_d_work + VB * n;
+    double* r = m_d_work + VR * n;
+    double* r0 = m_d_work + VR0 * n;
+    double* p = m_d_work + VP * n;
+    double* v = m_d_work + VV * n;
+    double* s = m_d_work + VS * n;
+    double* t = m_d_work + VT * n;
+    double* y = m_d_work + VY * n;
+    double* z = m_d_work + VZ * n;
+
+    int max_iterations = (m_max_iterations > 0) ? m_max_iterations : 2 * n;
+    double tolerance = (m_tolerance > 0) ? m_tolerance : Eigen::NumTraits<double>::epsilon();
+
+    // Initial guess and right-hand side
+    bool ok = Check(cudaMemcpy(b, m_rhs.data(), n * sizeof(double), cudaMemcpyHostToDevice), "cudaMemcpy");
+    if (m_warm_start && m_initguess.size() == n)
+        ok = ok && Check(cudaMemcpy(x, m_initguess.data(), n * sizeof(double), cudaMemcpyHostToDevice), "cudaMemcpy");
+    else
+        ok = ok && Check(cudaMemset(x, 0, n * sizeof(double)), "cudaMemset");
+
+    double b_norm = 0;
+    double r_norm = 0;
+    double one = 1;
+    double minus_one = -1;
+
+    // r = b - A*x,  r0 = r,  p = v = 0
+    ok = ok && Multiply(x, r) && Check(cublasDscal(m_bl_handle, n, &minus_one, r, 1), "cublasDscal") &&
+         Check(cublasDaxpy(m_bl_handle, n, &one, b, 1, r, 1), "cublasDaxpy");
+    ok = ok && Check(cudaMemcpy(r0, r, n * sizeof(double), cudaMemcpyDeviceToDevice), "cudaMemcpy") &&
+         Check(cudaMemset(p, 0, n * sizeof(double)), "cudaMemset") &&
+         Check(cudaMemset(v, 0, n * sizeof(double)), "cudaMemset") &&
+         Check(cublasDnrm2(m_bl_handle, n, b, 1, &b_norm), "cublasDnrm2") &&
+         Check(cublasDnrm2(m_bl_handle, n, r, 1, &r_norm), "cublasDnrm2");
+
+    if (ok && b_norm == 0) {
+        // Trivial solution
+        m_sol.setZero(n);
+        return true;
+    }
+
+    double rho = 1;
+    double alpha = 1;
+    double omega = 1;
+    m_error = ok ? r_norm / b_norm : 0;
+
+    while (ok && m_error > tolerance && m_iterations < max_iterations) {
+        double rho_new;
+        ok = Check(cublasDdot(m_bl_handle, n, r0, 1, r, 1, &rho_new), "cublasDdot");
+        if (!ok || rho_new == 0)
+            break;
+
+        // p = r + beta * (p - omega * v)
+        double beta = (rho_new / rho) * (alpha / omega);
+        double minus_omega = -omega;
+        ok = Check(cublasDaxpy(m_bl_handle, n, &minus_omega, v, 1, p, 1), "cublasDaxpy") &&
+             Check(cublasDscal(m_bl_handle, n, &beta, p, 1), "cublasDscal") &&
+             Check(cublasDaxpy(m_bl_handle, n, &one, r, 1, p, 1), "cublasDaxpy");
+
+        // y = M^(-1) * p,  v = A * y,  alpha = rho / (r0' * v)
+        double r0v = 0;
+        ok = ok && Precondition(p, y) && Multiply(y, v) &&
+             Check(cublasDdot(m_bl_handle, n, r0, 1, v, 1, &r0v), "cublasDdot");
+        if (!ok || r0v == 0)
+            break;
+        alpha = rho_new / r0v;
+
+        // s = r - alpha * v
+        double minus_alpha = -alpha;
+        ok = Check(cudaMemcpy(s, r, n * sizeof(double), cudaMemcpyDeviceToDevice), "cudaMemcpy") &&
+             Check(cublasDaxpy(m_bl_handle, n, &minus_alpha, v, 1, s, 1), "cublasDaxpy");
+
+        // z = M^(-1) * s,  t = A * z,  omega = (t' * s) / (t' * t)
+        double ts = 0;
+        double tt = 0;
+        ok = ok && Precondition(s, z) && Multiply(z, t) &&
+             Check(cublasDdot(m_bl_handle, n, t, 1, s, 1, &ts), "cublasDdot") &&
+             Check(cublasDdot(m_bl_handle, n, t, 1, t, 1, &tt), "cublasDdot");
+        if (!ok)
+            break;
+        omega = (tt > 0) ? ts / tt : 0;
+
+        // x += alpha * y + omega * z,  r = s - omega * t
+        minus_omega = -omega;
+        ok = Check(cublasDaxpy(m_bl_handle, n, &alpha, y, 1, x, 1), "cublasDaxpy") &&
+             Check(cublasDaxpy(m_bl_handle, n, &omega, z, 1, x, 1), "cublasDaxpy") &&
+             Check(cudaMemcpy(r, s, n * sizeof(double), cudaMemcpyDeviceToDevice), "cudaMemcpy") &&
+             Check(cublasDaxpy(m_bl_handle, n, &minus_omega, t, 1, r, 1), "cublasDaxpy") &&
+             Check(cublasDnrm2(m_bl_handle, n, r, 1, &r_norm), "cublasDnrm2");
+
+        rho = rho_new;
+        m_iterations++;
+        m_error = r_norm / b_norm;
+
+        if (omega == 0)
+            break;
+    }
+
+    // Download the solution
+    m_sol.resize(n);
+    ok = ok && Check(cudaMemcpy(m_sol.data(), x, n * sizeof(double), cudaMemcpyDeviceToHost), "cudaMemcpy");
+
+    if (!ok)
+        std::cerr << "ChSolverCudaBiCGSTAB: " << m_error_msg << std::endl;
+
+    if (verbose) {
+        std::cout << "  CUDA BiCGSTAB iterations: " << m_iterations << " error: " << m_error << std::endl;
+    }
+
+    return ok && m_error <= tolerance;
+}
+
+}  // end namespace chrono
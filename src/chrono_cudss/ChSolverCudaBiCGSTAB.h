@@ -0,0 +1,108 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHSOLVER_CUDA_BICGSTAB_H
+#define CHSOLVER_CUDA_BICGSTAB_H
+
+#include <string>
+
+#include <cuda_runtime.h>
+#include <cublas_v2.h>
+#include <cusparse.h>
+
+#include "chrono_cudss/ChApiCuDSS.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
+
+namespace chrono {
+
+/// @addtogroup cudss_module
+/// @{
+
+/** \class ChSolverCudaBiCGSTAB
+\brief GPU BiCGSTAB iterative solver, based on cuSPARSE and cuBLAS.
+
+Iterative linear solver.
+Cannot handle VI and complementarity problems, so it cannot be used with NSC formulations.
+
+Unlike the matrix-free CPU solvers (see ChIterativeSolverLS), the system matrix is assembled at each setup and copied
+to the device in CSR format; the sparse matrix-vector products and all vector operations of the preconditioned
+BiCGSTAB iterations are then performed on the GPU. Device storage is reallocated only when the problem size or the
+number of non-zeros changes.
+
+The diagonal preconditioner is applied on the GPU. The other preconditioners (see
+ChIterativeSolverLS::SetPreconditioner) are applied on the host, which requires a transfer of two vectors per
+application.
+
+See ChIterativeSolverLS for supported solver settings and parameters.
+
+\note This module is experimental: it has not yet been validated on a CUDA system.
+*/
+class ChApiCuDSS ChSolverCudaBiCGSTAB : public ChIterativeSolverLS {
+  public:
+    ChSolverCudaBiCGSTAB();
+    ~ChSolverCudaBiCGSTAB();
+
+    virtual Type GetType() const override { return Type::BICGSTAB; }
+    virtual int GetIterations() const override { return m_iterations; }
+    virtual double GetError() const override { return m_error; }
+
+    /// Perform the solver setup operations.
+    /// The system matrix is assembled before the base class setup.
+    virtual bool Setup(ChSystemDescriptor& sysd) override;
+
+  private:
+    virtual bool SetupProblem() override;
+    virtual bool SolveProblem() override;
+
+    /// Release the device matrix and vectors.
+    void FreeDeviceData();
+
+    /// Calculate y = A*x on the device.
+    bool Multiply(double* d_x, double* d_y);
+
+    /// Apply the preconditioner, y = M^(-1)*x, on the device.
+    bool Precondition(const double* d_x, double* d_y);
+
+    /// Record the status of a CUDA runtime, cuSPARSE, or cuBLAS call and return true if successful.
+    bool Check(cudaError_t status, const char* call);
+    bool Check(cusparseStatus_t status, const char* call);
+    bool Check(cublasStatus_t status, const char* call);
+
+    cusparseHandle_t m_sp_handle;  ///< cuSPARSE library handle
+    cublasHandle_t m_bl_handle;    ///< cuBLAS library handle
+    cusparseSpMatDescr_t m_A;      ///< device system matrix descriptor
+    cusparseDnVecDescr_t m_vec_x;  ///< descriptor of the SPMV input vector
+    cusparseDnVecDescr_t m_vec_y;  ///< descriptor of the SPMV output vector
+
+    int* m_d_row_ptr;    ///< device CSR row pointers
+    int* m_d_col_ind;    ///< device CSR column indices
+    double* m_d_values;  ///< device CSR values
+    double* m_d_work;    ///< device work vectors (x, b, r, r0, p, v, s, t, y, z, inverse diagonal)
+    void* m_d_buffer;    ///< cuSPARSE SPMV work buffer
+    int m_d_dim;         ///< size of the device matrix
+    int m_d_nnz;         ///< number of non-zeros of the device matrix
+
+    ChVectorDynamic<> m_h_x;  ///< host work vector (preconditioner input)
+    ChVectorDynamic<> m_h_y;  ///< host work vector (preconditioner output)
+
+    int m_iterations;         ///< number of iterations performed in the last solve
+    double m_error;           ///< relative residual at the end of the last solve
+    std::string m_error_msg;  ///< description of the last failed call
+};
+
+/// @} cudss_module
+
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,40 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHAPI_FEA_CUDA_H
+#define CHAPI_FEA_CUDA_H
+
+#include "chrono/ChVersion.h"
+#include "chrono/core/ChPlatform.h"
+
+// When compiling this library, remember to define CH_API_COMPILE_FEA_CUDA
+// (so that the symbols with 'ChApiFeaCuda' in front of them will be
+// marked as exported). Otherwise, just do not define it if you
+// link the library to your code, and the symbols will be imported.
+
+#if defined(CH_API_COMPILE_FEA_CUDA)
+    #define ChApiFeaCuda ChApiEXPORT
+#else
+    #define ChApiFeaCuda ChApiIMPORT
+#endif
+
+/**
+    @defgroup fea_cuda_module FEA CUDA module
+    @brief Module for the evaluation of FEA element internal forces on a GPU device
+
+    This module provides element batches (see ChElementBatch) which evaluate the internal forces of groups of elements
+    with CUDA kernels, for use with ChMesh::SetElementBatchFactory.
+*/
+
+#endif
@@ -0,0 +1,149 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include "chrono_fea_cuda/ChElementBatchCuda.h"
+#include "chrono_fea_cuda/ChKernelsShellANCF_3833.cuh"
+
+#include "chrono/fea/ChNodeFEAxyzDD.h"
+
+namespace chrono {
+namespace fea {
+
+static_assert(ShellANCF3833_NIP == ChElementShellANCF_3833::NIP, "Mismatched number of Gauss quadrature points");
+static_assert(ShellANCF3833_NSF == ChElementShellANCF_3833::NSF, "Mismatched number of shape functions");
+
+static const int NIP = ChElementShellANCF_3833::NIP;
+static const int NSF = ChElementShellANCF_3833::NSF;
+
+ChElementBatchShellANCF_3833Cuda::ChElementBatchShellANCF_3833Cuda(ChElementShellANCF_3833* element)
+    : m_num_layers(element->GetNumLayers()), m_data(nullptr) {
+    m_elements.push_back(element);
+}
+
+ChElementBatchShellANCF_3833Cuda::~ChElementBatchShellANCF_3833Cuda() {
+    ShellANCF3833_Destroy(m_data);
+}
+
+bool ChElementBatchShellANCF_3833Cuda::AddElement(ChElementBase* element) {
+    auto shell = dynamic_cast<ChElementShellANCF_3833*>(element);
+    if (!shell || shell->GetNumLayers() != m_num_layers)
+        return false;
+    m_elements.push_back(shell);
+    ShellANCF3833_Destroy(m_data);
+    m_data = nullptr;
+    return true;
+}
+
+void ChElementBatchShellANCF_3833Cuda::Pack() {
+    size_t n = m_elements.size();
+    std::vector<double> SD(m_num_layers * NSF * 3 * NIP * n);
+    std::vector<double> kGQ(m_num_layers * NIP * n);
+
+    for (size_t l = 0; l < n; l++) {
+        const auto& SD_l = m_elements[l]->GetContIntShapeFunctionDerivatives();
+        const auto& kGQ_l = m_elements[l]->GetContIntScaleFactors();
+        for (size_t kl = 0; kl < m_num_layers; kl++) {
+            for (int ip = 0; ip < NIP; ip++) {
+                kGQ[(kl * NIP + ip) * n + l] = kGQ_l(kl * NIP + ip);
+                for (int k = 0; k < NSF; k++)
+                    for (int d = 0; d < 3; d++)
+                        SD[(((kl * NSF + k) * 3 + d) * NIP + ip) * n + l] = SD_l(k, (3 * kl + d) * NIP + ip);
+            }
+        }
+    }
+
+    m_data = ShellANCF3833_Create((int)n, (int)m_num_layers);
+    ShellANCF3833_SetShapeData(m_data, SD.data(), kGQ.data());
+
+    m_e.resize(3 * NSF * n);
+    m_edot.resize(3 * NSF * n);
+    m_alpha.resize(n);
+    m_D.resize(m_num_layers * 36 * n);
+    m_Q.resize(3 * NSF * n);
+}
+
+void ChElementBatchShellANCF_3833Cuda::LoadResidual_F(ChVectorDynamic<>& R, const double c) {
+    // Fall back on the per-element calculation if any of the elements is currently set to use a different method
+    bool damping_enabled = false;
+    for (auto element : m_elements) {
+        if (element->GetIntFrcCalcMethod() != ChElementShellANCF_3833::IntFrcMethod::ContInt ||
+            element->GetNumLayers() != m_num_layers) {
+            for (auto e : m_elements)
+                e->EleIntLoadResidual_F(R, c);
+            return;
+        }
+        damping_enabled |= element->IsDampingEnabled();
+    }
+
+    if (!m_data)
+        Pack();
+
+    // Gather the nodal coordinates (and their time derivatives) and the layer stiffness matrices of all elements
+    size_t n = m_elements.size();
+    for (size_t l = 0; l < n; l++) {
+        auto element = m_elements[l];
+        for (unsigned int in = 0; in < element->GetNumNodes(); in++) {
+            auto node = std::static_pointer_cast<ChNodeFEAxyzDD>(element->GetNode(in));
+            const ChVector3d* coords[3] = {&node->GetPos(), &node->GetSlope1(), &node->GetSlope2()};
+            for (int m = 0; m < 3; m++)
+                for (int j = 0; j < 3; j++)
+                    m_e[(9 * in + 3 * m + j) * n + l] = (*coords[m])[j];
+            if (damping_enabled) {
+                const ChVector3d* coords_dt[3] = {&node->GetPosDt(), &node->GetSlope1Dt(), &node->GetSlope2Dt()};
+                for (int m = 0; m < 3; m++)
+                    for (int j = 0; j < 3; j++)
+                        m_edot[(9 * in + 3 * m + j) * n + l] = element->IsDampingEnabled() ? (*coords_dt[m])[j] : 0;
+            }
+        }
+        m_alpha[l] = element->IsDampingEnabled() ? element->GetAlphaDamp() : 0;
+
+        for (size_t kl = 0; kl < m_num_layers; kl++) {
+            ChMatrix66d D_l = element->GetLayerStiffnessMatrix(kl);
+            for (int i = 0; i < 6; i++)
+                for (int j = 0; j < 6; j++)
+                    m_D[(kl * 36 + 6 * i + j) * n + l] = D_l(i, j);
+        }
+    }
+
+    ShellANCF3833_InternalForces(m_data, m_e.data(), m_edot.data(), m_alpha.data(), m_D.data(), damping_enabled,
+                                 m_Q.data());
+
+    // Add the generalized internal forces of each element to the global vector. Batches are evaluated concurrently only
+    // for elements of the same color, which share no nodes (see ChMesh), so there is no need for atomic increments.
+    for (size_t l = 0; l < n; l++) {
+        auto element = m_elements[l];
+        unsigned int stride = 0;
+        for (unsigned int in = 0; in < element->GetNumNodes(); in++) {
+            auto node = element->GetNode(in);
+            unsigned int node_dofs = element->GetNodeNumCoordsPosLevelActive(in);
+            if (!node->IsFixed()) {
+                unsigned int offset = node->NodeGetOffsetVelLevel();
+                for (unsigned int i = 0; i < node_dofs; i++)
+                    R(offset + i) += c * m_Q[(stride + i) * n + l];
+            }
+            stride += element->GetNodeNumCoordsPosLevel(in);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+std::shared_ptr<ChElementBatch> ChElementBatchFactoryCuda::CreateBatch(ChElementBase* element) {
+    if (auto shell = dynamic_cast<ChElementShellANCF_3833*>(element))
+        return chrono_types::make_shared<ChElementBatchShellANCF_3833Cuda>(shell);
+    return nullptr;
+}
+
+}  // end namespace fea
+}  // end namespace chrono
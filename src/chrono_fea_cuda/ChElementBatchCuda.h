@@ -0,0 +1,77 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_ELEMENT_BATCH_CUDA_H
+#define CH_ELEMENT_BATCH_CUDA_H
+
+#include <vector>
+
+#include "chrono_fea_cuda/ChApiFeaCuda.h"
+
+#include "chrono/fea/ChElementBatch.h"
+#include "chrono/fea/ChElementShellANCF_3833.h"
+
+namespace chrono {
+namespace fea {
+
+struct ShellANCF3833_DeviceData;
+
+/// @addtogroup fea_cuda_module
+/// @{
+
+/// Batch evaluating the internal forces of ChElementShellANCF_3833 elements on the current CUDA device.
+/// Unlike the host batch, there is no limit on the number of elements in a batch: all elements with the same number of
+/// layers in a given mesh color are processed by a single kernel launch, one thread per element. The precomputed
+/// element data is uploaded once; the nodal coordinates and layer stiffness matrices are uploaded, and the
+/// generalized forces downloaded, at each evaluation. Only the internal forces are evaluated on the device; the
+/// Jacobians are still computed by the elements.
+class ChApiFeaCuda ChElementBatchShellANCF_3833Cuda : public ChElementBatch {
+  public:
+    ChElementBatchShellANCF_3833Cuda(ChElementShellANCF_3833* element);
+    ~ChElementBatchShellANCF_3833Cuda();
+
+    virtual bool AddElement(ChElementBase* element) override;
+
+    virtual unsigned int GetNumElements() const override { return (unsigned int)m_elements.size(); }
+
+    virtual void LoadResidual_F(ChVectorDynamic<>& R, const double c) override;
+
+  private:
+    /// Allocate device storage and upload the precomputed element data.
+    void Pack();
+
+    std::vector<ChElementShellANCF_3833*> m_elements;  ///< elements in this batch
+    size_t m_num_layers;                                ///< number of layers (same for all elements)
+    ShellANCF3833_DeviceData* m_data;                   ///< device data (nullptr until packed)
+
+    std::vector<double> m_e;      ///< nodal coordinates (lane-major)
+    std::vector<double> m_edot;   ///< nodal coordinate time derivatives (lane-major)
+    std::vector<double> m_alpha;  ///< damping coefficients
+    std::vector<double> m_D;      ///< layer stiffness matrices (lane-major)
+    std::vector<double> m_Q;      ///< generalized internal forces (lane-major)
+};
+
+/// Element batch factory creating CUDA batches for the supported element types (currently ChElementShellANCF_3833).
+/// Use with ChMesh::SetElementBatchFactory; other elements fall back on their default batches, if any.
+class ChApiFeaCuda ChElementBatchFactoryCuda : public ChElementBatchFactory {
+  public:
+    virtual std::shared_ptr<ChElementBatch> CreateBatch(ChElementBase* element) override;
+};
+
+/// @} fea_cuda_module
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,222 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Description: CUDA kernel evaluating the generalized internal forces of a group
+// of ChElementShellANCF_3833 elements. One thread processes one element, looping
+// over its layers and Gauss quadrature points with the same arithmetic as the
+// host batch (see ChElementShellANCF_3833::Batch). With the lane-major layout,
+// consecutive threads access consecutive entries of all arrays.
+// =============================================================================
+
+#include <stdexcept>
+#include <string>
+
+#include <cuda_runtime.h>
+
+#include "chrono_fea_cuda/ChKernelsShellANCF_3833.cuh"
+
+namespace chrono {
+namespace fea {
+
+static const int NIP = ShellANCF3833_NIP;
+static const int NSF = ShellANCF3833_NSF;
+
+static void CheckCuda(cudaError_t err, const char* what) {
+    if (err != cudaSuccess)
+        throw std::runtime_error(std::string("ChKernelsShellANCF_3833 - ") + what + ": " + cudaGetErrorString(err));
+}
+
+struct ShellANCF3833_DeviceData {
+    int num_elements;
+    int num_layers;
+    double* SD;     // shape function derivatives
+    double* kGQ;    // Gauss quadrature scale factors
+    double* D;      // layer stiffness matrices
+    double* e;      // nodal coordinates
+    double* edot;   // nodal coordinate time derivatives
+    double* alpha;  // damping coefficients
+    double* Q;      // generalized internal forces
+};
+
+static size_t SizeSD(const ShellANCF3833_DeviceData* data) {
+    return (size_t)data->num_layers * NSF * 3 * NIP * data->num_elements;
+}
+static size_t SizekGQ(const ShellANCF3833_DeviceData* data) {
+    return (size_t)data->num_layers * NIP * data->num_elements;
+}
+static size_t SizeD(const ShellANCF3833_DeviceData* data) {
+    return (size_t)data->num_layers * 36 * data->num_elements;
+}
+static size_t SizeQ(const ShellANCF3833_DeviceData* data) {
+    return (size_t)3 * NSF * data->num_elements;
+}
+
+ShellANCF3833_DeviceData* ShellANCF3833_Create(int num_elements, int num_layers) {
+    auto data = new ShellANCF3833_DeviceData;
+    data->num_elements = num_elements;
+    data->num_layers = num_layers;
+    CheckCuda(cudaMalloc(&data->SD, SizeSD(data) * sizeof(double)), "cudaMalloc");
+    CheckCuda(cudaMalloc(&data->kGQ, SizekGQ(data) * sizeof(double)), "cudaMalloc");
+    CheckCuda(cudaMalloc(&data->D, SizeD(data) * sizeof(double)), "cudaMalloc");
+    CheckCuda(cudaMalloc(&data->e, SizeQ(data) * sizeof(double)), "cudaMalloc");
+    CheckCuda(cudaMalloc(&data->edot, SizeQ(data) * sizeof(double)), "cudaMalloc");
+    CheckCuda(cudaMalloc(&data->alpha, num_elements * sizeof(double)), "cudaMalloc");
+    CheckCuda(cudaMalloc(&data->Q, SizeQ(data) * sizeof(double)), "cudaMalloc");
+    return data;
+}
+
+void ShellANCF3833_Destroy(ShellANCF3833_DeviceData* data) {
+    if (!data)
+        return;
+    cudaFree(data->SD);
+    cudaFree(data->kGQ);
+    cudaFree(data->D);
+    cudaFree(data->e);
+    cudaFree(data->edot);
+    cudaFree(data->alpha);
+    cudaFree(data->Q);
+    delete data;
+}
+
+void ShellANCF3833_SetShapeData(ShellANCF3833_DeviceData* data, const double* SD, const double* kGQ) {
+    CheckCuda(cudaMemcpy(data->SD, SD, SizeSD(data) * sizeof(double), cudaMemcpyHostToDevice), "cudaMemcpy");
+    CheckCuda(cudaMemcpy(data->kGQ, kGQ, SizekGQ(data) * sizeof(double), cudaMemcpyHostToDevice), "cudaMemcpy");
+}
+
+// Generalized internal forces of element l (one thread per element)
+template <bool DAMPING>
+__global__ void kInternalForces(int n,
+                                int num_layers,
+                                const double* __restrict__ SD,
+                                const double* __restrict__ kGQ,
+                                const double* __restrict__ D,
+                                const double* __restrict__ e,
+                                const double* __restrict__ edot,
+                                const double* __restrict__ alpha,
+                                double* __restrict__ Q) {
+    int l = blockIdx.x * blockDim.x + threadIdx.x;
+    if (l >= n)
+        return;
+
+    // Indices of the stress components in the symmetric 3x3 stress tensor
+    const int S_idx[3][3] = {{0, 5, 4}, {5, 1, 3}, {4, 3, 2}};
+
+    for (int i = 0; i < 3 * NSF; i++)
+        Q[i * n + l] = 0;
+
+    double a = DAMPING ? alpha[l] : 0;
+
+    for (int kl = 0; kl < num_layers; kl++) {
+        // Rotated and reordered stiffness matrix of the current layer
+        double Dl[36];
+        for (int i = 0; i < 36; i++)
+            Dl[i] = D[(kl * 36 + i) * n + l];
+
+        for (int ip = 0; ip < NIP; ip++) {
+            // Deformation gradient (and its time derivative), F[3 * d + j] = block component (d, j) of FC
+            double F[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+            double Fdot[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+            for (int k = 0; k < NSF; k++) {
+                for (int d = 0; d < 3; d++) {
+                    double sd = SD[((((kl * NSF + k) * 3 + d) * NIP) + ip) * n + l];
+                    for (int j = 0; j < 3; j++) {
+                        F[3 * d + j] += sd * e[(3 * k + j) * n + l];
+                        if (DAMPING)
+                            Fdot[3 * d + j] += sd * edot[(3 * k + j) * n + l];
+                    }
+                }
+            }
+
+            // Green-Lagrange strains (combined with their scaled time derivatives), in Voigt notation
+            // epsilon = [E11,E22,E33,2*E23,2*E13,2*E12], scaled by the Gauss quadrature factor
+#define FF(a, b) (F[3 * (a)] * F[3 * (b)] + F[3 * (a) + 1] * F[3 * (b) + 1] + F[3 * (a) + 2] * F[3 * (b) + 2])
+#define FFdot(a, b) \
+    (F[3 * (a)] * Fdot[3 * (b)] + F[3 * (a) + 1] * Fdot[3 * (b) + 1] + F[3 * (a) + 2] * Fdot[3 * (b) + 2])
+            double E[6];
+            E[0] = 0.5 * (FF(0, 0) - 1);
+            E[1] = 0.5 * (FF(1, 1) - 1);
+            E[2] = 0.5 * (FF(2, 2) - 1);
+            E[3] = FF(1, 2);
+            E[4] = FF(0, 2);
+            E[5] = FF(0, 1);
+            if (DAMPING) {
+                E[0] += a * FFdot(0, 0);
+                E[1] += a * FFdot(1, 1);
+                E[2] += a * FFdot(2, 2);
+                E[3] += a * (FFdot(1, 2) + FFdot(2, 1));
+                E[4] += a * (FFdot(0, 2) + FFdot(2, 0));
+                E[5] += a * (FFdot(0, 1) + FFdot(1, 0));
+            }
+#undef FF
+#undef FFdot
+            double kGQ_ip = kGQ[(kl * NIP + ip) * n + l];
+            for (int i = 0; i < 6; i++)
+                E[i] *= kGQ_ip;
+
+            // Scaled 2nd Piola-Kirchoff stresses, kGQ*SPK2 = D * E_Combined
+            double S[6];
+            for (int i = 0; i < 6; i++) {
+                S[i] = 0;
+                for (int j = 0; j < 6; j++)
+                    S[i] += Dl[6 * i + j] * E[j];
+            }
+
+            // Transpose of the scaled 1st Piola-Kirchoff stresses, with the same block ordering as F
+            double P[9];
+            for (int d = 0; d < 3; d++)
+                for (int j = 0; j < 3; j++)
+                    P[3 * d + j] = F[j] * S[S_idx[d][0]] + F[3 + j] * S[S_idx[d][1]] + F[6 + j] * S[S_idx[d][2]];
+
+            // Accumulate the generalized forces (each thread owns its lane, so no atomics are needed)
+            for (int k = 0; k < NSF; k++) {
+                double sd0 = SD[((((kl * NSF + k) * 3 + 0) * NIP) + ip) * n + l];
+                double sd1 = SD[((((kl * NSF + k) * 3 + 1) * NIP) + ip) * n + l];
+                double sd2 = SD[((((kl * NSF + k) * 3 + 2) * NIP) + ip) * n + l];
+                for (int j = 0; j < 3; j++)
+                    Q[(3 * k + j) * n + l] += sd0 * P[j] + sd1 * P[3 + j] + sd2 * P[6 + j];
+            }
+        }
+    }
+}
+
+void ShellANCF3833_InternalForces(ShellANCF3833_DeviceData* data,
+                                  const double* e,
+                                  const double* edot,
+                                  const double* alpha,
+                                  const double* D,
+                                  bool damping,
+                                  double* Q) {
+    int n = data->num_elements;
+    CheckCuda(cudaMemcpy(data->e, e, SizeQ(data) * sizeof(double), cudaMemcpyHostToDevice), "cudaMemcpy");
+    CheckCuda(cudaMemcpy(data->D, D, SizeD(data) * sizeof(double), cudaMemcpyHostToDevice), "cudaMemcpy");
+    if (damping) {
+        CheckCuda(cudaMemcpy(data->edot, edot, SizeQ(data) * sizeof(double), cudaMemcpyHostToDevice), "cudaMemcpy");
+        CheckCuda(cudaMemcpy(data->alpha, alpha, n * sizeof(double), cudaMemcpyHostToDevice), "cudaMemcpy");
+    }
+
+    const int num_threads = 128;
+    int num_blocks = (n + num_threads - 1) / num_threads;
+    if (damping)
+        kInternalForces<true><<<num_blocks, num_threads>>>(n, data->num_layers, data->SD, data->kGQ, data->D, data->e,
+                                                           data->edot, data->alpha, data->Q);
+    else
+        kInternalForces<false><<<num_blocks, num_threads>>>(n, data->num_layers, data->SD, data->kGQ, data->D, data->e,
+                                                            data->edot, data->alpha, data->Q);
+    CheckCuda(cudaPeekAtLastError(), "kInternalForces");
+
+    CheckCuda(cudaMemcpy(Q, data->Q, SizeQ(data) * sizeof(double), cudaMemcpyDeviceToHost), "cudaMemcpy");
+}
+
+}  // end namespace fea
+}  // end namespace chrono
@@ -0,0 +1,62 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Description: host interface to the CUDA kernel evaluating the generalized
+// internal forces of a group of ChElementShellANCF_3833 elements with the
+// "Continuous Integration" style method. All arrays are stored lane-major, with
+// the element index varying fastest (n = number of elements):
+//   SD    [((kl * NSF + k) * 3 + d) * NIP + ip] * n + l
+//   kGQ   [kl * NIP + ip] * n + l
+//   D     [kl * 36 + 6 * i + j] * n + l
+//   e, Q  [i] * n + l  (i < 3 * NSF)
+// =============================================================================
+
+#ifndef CH_KERNELS_SHELL_ANCF_3833_CUH
+#define CH_KERNELS_SHELL_ANCF_3833_CUH
+
+namespace chrono {
+namespace fea {
+
+/// Number of Gauss quadrature points per layer (see ChElementShellANCF_3833::NIP).
+static const int ShellANCF3833_NIP = 18;
+/// Number of shape functions (see ChElementShellANCF_3833::NSF).
+static const int ShellANCF3833_NSF = 24;
+
+/// Device data of a group of elements (opaque to host code).
+struct ShellANCF3833_DeviceData;
+
+/// Allocate device storage for the specified number of elements and layers.
+ShellANCF3833_DeviceData* ShellANCF3833_Create(int num_elements, int num_layers);
+
+/// Release the device storage.
+void ShellANCF3833_Destroy(ShellANCF3833_DeviceData* data);
+
+/// Upload the precomputed shape function derivatives and Gauss quadrature scale factors.
+void ShellANCF3833_SetShapeData(ShellANCF3833_DeviceData* data, const double* SD, const double* kGQ);
+
+/// Upload the current nodal coordinates, their time derivatives, the damping coefficients (one per element), and the
+/// layer stiffness matrices; evaluate the generalized internal forces and download them into Q.
+/// If damping is false, edot and alpha are ignored.
+void ShellANCF3833_InternalForces(ShellANCF3833_DeviceData* data,
+                                  const double* e,
+                                  const double* edot,
+                                  const double* alpha,
+                                  const double* D,
+                                  bool damping,
+                                  double* Q);
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
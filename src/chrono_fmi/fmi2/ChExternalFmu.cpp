@@ -273,6 +273,18 @@ void ChExternalFmu::Initialize() {
 
     m_fmu->ExitInitializationMode();
 
+    // Cache the value references of the real inputs, so that all inputs can be set with a single call
+    m_inputs_vr.clear();
+    m_inputs_functions.clear();
+    for (const auto& v : m_inputs_real) {
+        m_inputs_vr.push_back(m_fmu->GetVariablesList().at(v.first).GetValueReference());
+        m_inputs_functions.push_back(v.second);
+    }
+    m_inputs_values.resize(m_inputs_vr.size());
+
+    m_states.resize(m_num_states);
+    m_derivs.resize(m_num_states);
+
     // Initialize the base class
     ChExternalDynamics::Initialize();
 
@@ -281,35 +293,33 @@ void ChExternalFmu::Initialize() {
 
 void ChExternalFmu::SetInitialConditions(ChVectorDynamic<>& y0) {
     // Get initial conditions from the FMU
-    std::vector<fmi2Real> states(m_num_states);
-    m_fmu->GetContinuousStates(states.data(), m_num_states);
+    m_fmu->GetContinuousStates(m_states.data(), m_num_states);
 
     // Load initial conditions for the ChExternalDynamics component
     for (unsigned int i = 0; i < m_num_states; i++)
-        y0(i) = states[i];
+        y0(i) = m_states[i];
 }
 
 void ChExternalFmu::CalculateRHS(double time, const ChVectorDynamic<>& y, ChVectorDynamic<>& rhs) {
     // Set the states in the FMU
-    std::vector<fmi2Real> states(m_num_states);
     for (unsigned int i = 0; i < m_num_states; i++)
-        states[i] = y(i);
-    m_fmu->SetContinuousStates(states.data(), m_num_states);
+        m_states[i] = y(i);
+    m_fmu->SetContinuousStates(m_states.data(), m_num_states);
 
     // Get the RHS from the FMU
-    std::vector<fmi2Real> derivs(m_num_states);
-    m_fmu->GetDerivatives(derivs.data(), m_num_states);
+    m_fmu->GetDerivatives(m_derivs.data(), m_num_states);
 
     // Load RHS for the ChExternalDynamics component
     for (unsigned int i = 0; i < m_num_states; i++)
-        rhs(i) = derivs[i];
+        rhs(i) = m_derivs[i];
 }
 
 void ChExternalFmu::Update(double time, bool update_assets) {
     // Set FMU inputs at current time
-    for (const auto& v : m_inputs_real) {
-        double value = v.second(time);
-        m_fmu->SetVariable(v.first, value, FmuVariable::Type::Real);
+    if (!m_inputs_vr.empty()) {
+        for (size_t i = 0; i < m_inputs_vr.size(); i++)
+            m_inputs_values[i] = m_inputs_functions[i](time);
+        m_fmu->_fmi2SetReal(m_fmu->component, m_inputs_vr.data(), m_inputs_vr.size(), m_inputs_values.data());
     }
 
     // Invoke base class Update
@@ -22,6 +22,7 @@
 #include <functional>
 #include <unordered_set>
 #include <unordered_map>
+#include <vector>
 
 #include "chrono_fmi/ChApiFMI.h"
 #include "chrono/physics/ChExternalDynamics.h"
@@ -128,6 +129,13 @@ class ChApiFMI ChExternalFmu : public ChExternalDynamics {
     std::unordered_map<std::string, double> m_parameters_real;
     std::unordered_map<std::string, int> m_parameters_int;
     std::unordered_map<std::string, std::function<double(double)>> m_inputs_real;
+
+    // Cached at initialization to avoid name lookups and allocations during the simulation loop
+    std::vector<fmi2ValueReference> m_inputs_vr;                    ///< value references of the real inputs
+    std::vector<std::function<double(double)>> m_inputs_functions;  ///< functions of the real inputs
+    std::vector<fmi2Real> m_inputs_values;                          ///< buffer for the real input values
+    std::vector<fmi2Real> m_states;                                 ///< buffer for the FMU states
+    std::vector<fmi2Real> m_derivs;                                 ///< buffer for the FMU state derivatives
 };
 
 }  // end namespace chrono
@@ -19,6 +19,9 @@
 #ifndef CH_FMU_TOOLS_EXPORT_H
 #define CH_FMU_TOOLS_EXPORT_H
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
 #include <stack>
 #include <fstream>
 #include <iostream>
@@ -344,6 +347,37 @@ class FmuChronoComponentBase : public FmuComponentBase {
     void AddFmuVisualShapes(const ChAssembly& ass);
 
   protected:
+    /// Advance the FMU over a communication interval, in equal sub-steps no larger than the specified step size.
+    /// The interval is covered with the smallest whole number of equal sub-steps, so that accumulated round-off does not
+    /// produce a tiny extra step at each communication point. The provided function is called for each sub-step, with
+    /// the sub-step size; the FMU time is advanced after each sub-step and is set to the end of the interval on return.
+    /// If the function does not return fmi2OK, sub-stepping stops and that status is returned.
+    /// A non-positive step size is rejected with fmi2Error.
+    fmi2Status AdvanceSubSteps(fmi2Real currentCommunicationPoint,
+                               fmi2Real communicationStepSize,
+                               fmi2Real step_size,
+                               const std::function<fmi2Status(fmi2Real)>& advance) {
+        if (!(step_size > 0)) {
+            sendToLog("Invalid integration step size: " + std::to_string(step_size) + "\n", fmi2Status::fmi2Error,
+                      "logStatusError");
+            return fmi2Status::fmi2Error;
+        }
+
+        int num_steps = std::max(1, static_cast<int>(std::ceil(communicationStepSize / step_size - 1e-6)));
+        fmi2Real h = communicationStepSize / num_steps;
+
+        for (int i = 0; i < num_steps; i++) {
+            auto status = advance(h);
+            if (status != fmi2Status::fmi2OK)
+                return status;
+            m_time += h;
+        }
+
+        m_time = currentCommunicationPoint + communicationStepSize;
+
+        return fmi2Status::fmi2OK;
+    }
+
     std::unordered_set<std::string> variables_vec;     ///< list of ChVector3 "variables"
     std::unordered_set<std::string> variables_quat;    ///< list of ChQuaternion "variables"
     std::unordered_set<std::string> variables_csys;    ///< list of ChCoordsys "variables"
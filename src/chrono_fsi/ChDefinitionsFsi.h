@@ -48,6 +48,25 @@ enum class TimeIntegrator { EXPLICITSPH, IISPH, I2SPH };
 /// Linear solver type
 enum class SolverType { JACOBI, BICGSTAB, GMRES, CR, CG, SAP };
 
+/// Preconditioner for the iterative linear solvers of the implicit SPH methods
+enum class PreconditionerType {
+    NONE,      ///< no preconditioning
+    JACOBI,    ///< diagonal scaling
+    CHEBYSHEV  ///< Chebyshev polynomial in the Jacobi-scaled matrix
+};
+
+/// Convergence statistics of the linear solver of the implicit SPH methods
+struct LinearSolverStats {
+    int num_solves = 0;              ///< number of linear solves performed
+    int num_converged = 0;           ///< number of linear solves that converged
+    long long total_iterations = 0;  ///< total number of iterations, over all solves
+    int max_iterations = 0;          ///< maximum number of iterations in a single solve
+    int iterations = 0;              ///< number of iterations in the last solve
+    double initial_residual = 0;     ///< norm of the initial residual in the last solve
+    double residual = 0;             ///< norm of the final residual in the last solve
+    bool converged = false;          ///< whether the last solve converged
+};
+
 /// @} fsi_physics
 
 }  // namespace fsi
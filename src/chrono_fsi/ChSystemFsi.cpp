@@ -109,6 +109,7 @@ void ChSystemFsi::InitParams() {
     m_paramsH->EPS_XSPH = Real(0.5);
     m_paramsH->beta_shifting = Real(1.0);
     m_paramsH->densityReinit = 2147483647;
+    m_paramsH->neighborSkin = 0;
     m_paramsH->Conservative_Form = true;
     m_paramsH->gradient_type = 0;
     m_paramsH->laplacian_type = 0;
@@ -136,6 +137,9 @@ void ChSystemFsi::InitParams() {
     m_paramsH->LinearSolver_Abs_Tol = Real(0.0);
     m_paramsH->LinearSolver_Rel_Tol = Real(0.0);
     m_paramsH->LinearSolver_Max_Iter = 1000;
+    m_paramsH->LinearSolver_Precond = PreconditionerType::JACOBI;
+    m_paramsH->LinearSolver_Precond_Degree = 4;
+    m_paramsH->LinearSolver_WarmStart = true;
     m_paramsH->Verbose_monitoring = false;
     m_paramsH->Pressure_Constraint = false;
     m_paramsH->BASEPRES = Real(0.0);
@@ -272,6 +276,9 @@ void ChSystemFsi::ReadParametersFromFile(const std::string& json_file) {
         if (doc["SPH Parameters"].HasMember("Density Reinitialization"))
             m_paramsH->densityReinit = doc["SPH Parameters"]["Density Reinitialization"].GetInt();
 
+        if (doc["SPH Parameters"].HasMember("Neighbor Search Skin"))
+            m_paramsH->neighborSkin = doc["SPH Parameters"]["Neighbor Search Skin"].GetDouble();
+
         if (doc["SPH Parameters"].HasMember("Conservative Discretization"))
             m_paramsH->Conservative_Form = doc["SPH Parameters"]["Conservative Discretization"].GetBool();
 
@@ -356,6 +363,22 @@ void ChSystemFsi::ReadParametersFromFile(const std::string& json_file) {
         if (doc["Pressure Equation"].HasMember("Maximum Iterations"))
             m_paramsH->LinearSolver_Max_Iter = doc["Pressure Equation"]["Maximum Iterations"].GetInt();
 
+        if (doc["Pressure Equation"].HasMember("Preconditioner")) {
+            std::string precond = doc["Pressure Equation"]["Preconditioner"].GetString();
+            if (precond == "None")
+                m_paramsH->LinearSolver_Precond = PreconditionerType::NONE;
+            if (precond == "Jacobi")
+                m_paramsH->LinearSolver_Precond = PreconditionerType::JACOBI;
+            if (precond == "Chebyshev")
+                m_paramsH->LinearSolver_Precond = PreconditionerType::CHEBYSHEV;
+        }
+
+        if (doc["Pressure Equation"].HasMember("Preconditioner degree"))
+            m_paramsH->LinearSolver_Precond_Degree = doc["Pressure Equation"]["Preconditioner degree"].GetInt();
+
+        if (doc["Pressure Equation"].HasMember("Warm start"))
+            m_paramsH->LinearSolver_WarmStart = doc["Pressure Equation"]["Warm start"].GetBool();
+
         if (doc["Pressure Equation"].HasMember("Verbose monitoring"))
             m_paramsH->Verbose_monitoring = doc["Pressure Equation"]["Verbose monitoring"].GetBool();
 
@@ -510,6 +533,21 @@ void ChSystemFsi::SetSPHLinearSolver(SolverType lin_solver) {
     m_paramsH->LinearSolver = lin_solver;
 }
 
+void ChSystemFsi::SetSPHLinearSolverPreconditioner(PreconditionerType precond, int degree) {
+    m_paramsH->LinearSolver_Precond = precond;
+    m_paramsH->LinearSolver_Precond_Degree = degree;
+}
+
+void ChSystemFsi::SetSPHLinearSolverWarmStart(bool val) {
+    m_paramsH->LinearSolver_WarmStart = val;
+}
+
+LinearSolverStats ChSystemFsi::GetSPHLinearSolverStats() const {
+    if (!m_fluid_dynamics || !m_fluid_dynamics->GetForceSystem()->GetLinearSolver())
+        return LinearSolverStats();
+    return m_fluid_dynamics->GetForceSystem()->GetLinearSolver()->GetStats();
+}
+
 void ChSystemFsi::SetSPHMethod(FluidDynamics SPH_method, SolverType lin_solver) {
     m_paramsH->fluid_dynamic_type = SPH_method;
     m_paramsH->LinearSolver = lin_solver;
@@ -531,6 +569,12 @@ void ChSystemFsi::SetActiveDomain(const ChVector3d& boxHalfDim) {
     m_paramsH->bodyActiveDomain = utils::ToReal3(boxHalfDim);
 }
 
+void ChSystemFsi::AddActiveDomain(std::shared_ptr<ChBody> body,
+                                  const ChVector3d& offset,
+                                  const ChVector3d& boxHalfDim) {
+    m_active_boxes.push_back({body, offset, boxHalfDim});
+}
+
 void ChSystemFsi::SetActiveDomainDelay(double duration) {
     m_paramsH->settlingTime = duration;
 }
@@ -570,6 +614,10 @@ void ChSystemFsi::SetKernelLength(double length) {
     m_paramsH->INVHSML = 1 / m_paramsH->HSML;
 }
 
+void ChSystemFsi::SetNeighborSkin(double skin) {
+    m_paramsH->neighborSkin = (Real)skin;
+}
+
 void ChSystemFsi::SetStepSize(double dT, double dT_Flex) {
     m_paramsH->dT = dT;
     m_paramsH->INV_dT = 1 / m_paramsH->dT;
@@ -603,6 +651,10 @@ void ChSystemFsi::SetOutputLength(int OutputLength) {
     m_paramsH->output_length = OutputLength;
 }
 
+void ChSystemFsi::SetDevices(const std::vector<int>& devices) {
+    m_devices = devices;
+}
+
 void ChSystemFsi::SetWallBC(BceVersion wallBC) {
     m_paramsH->bceTypeWall = wallBC;
 }
@@ -706,9 +758,12 @@ void ChSystemFsi::Initialize() {
     // Set up subdomains for faster neighbor particle search
     m_paramsH->NUM_BOUNDARY_LAYERS = 3;
     m_paramsH->Apply_BC_U = false;  // You should go to custom_math.h all the way to end of file and set your function
-    int3 side0 = mI3((int)floor((m_paramsH->cMax.x - m_paramsH->cMin.x) / (RESOLUTION_LENGTH_MULT * m_paramsH->HSML)),
-                     (int)floor((m_paramsH->cMax.y - m_paramsH->cMin.y) / (RESOLUTION_LENGTH_MULT * m_paramsH->HSML)),
-                     (int)floor((m_paramsH->cMax.z - m_paramsH->cMin.z) / (RESOLUTION_LENGTH_MULT * m_paramsH->HSML)));
+    // With a neighbor search skin, the cells are enlarged by half the skin so that the cell lists of the last neighbor
+    // search remain valid for as long as no marker moved by more than half the skin.
+    Real search_radius = RESOLUTION_LENGTH_MULT * m_paramsH->HSML + m_paramsH->neighborSkin / 2;
+    int3 side0 = mI3((int)floor((m_paramsH->cMax.x - m_paramsH->cMin.x) / search_radius),
+                     (int)floor((m_paramsH->cMax.y - m_paramsH->cMin.y) / search_radius),
+                     (int)floor((m_paramsH->cMax.z - m_paramsH->cMin.z) / search_radius));
     Real3 binSize3 =
         mR3((m_paramsH->cMax.x - m_paramsH->cMin.x) / side0.x, (m_paramsH->cMax.y - m_paramsH->cMin.y) / side0.y,
             (m_paramsH->cMax.z - m_paramsH->cMin.z) / side0.z);
@@ -754,6 +809,7 @@ void ChSystemFsi::Initialize() {
         cout << "  EPS_XSPH: " << m_paramsH->EPS_XSPH << endl;
         cout << "  beta_shifting: " << m_paramsH->beta_shifting << endl;
         cout << "  densityReinit: " << m_paramsH->densityReinit << endl;
+        cout << "  neighborSkin: " << m_paramsH->neighborSkin << endl;
 
         cout << "  Adaptive_time_stepping: " << m_paramsH->Adaptive_time_stepping << endl;
         cout << "  Co_number: " << m_paramsH->Co_number << endl;
@@ -863,27 +919,22 @@ void ChSystemFsi::Initialize() {
                               m_fsi_shells_bce_num, m_fsi_cables_bce_num);
     m_fluid_dynamics->Initialize();
 
+    // Distribute the force calculation over multiple devices, if requested
+    if (m_devices.size() > 1) {
+        auto force = std::dynamic_pointer_cast<ChFsiForceExplicitSPH>(m_fluid_dynamics->GetForceSystem());
+        if (!force || !m_paramsH->elastic_SPH)
+            throw std::runtime_error(
+                "ChSystemFsi::Initialize - multiple devices are only supported with the explicit SPH method for "
+                "granular material");
+        force->SetDevices(m_devices);
+    }
+
     // Mark system as initialized
     m_is_initialized = true;
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
 
-void ChSystemFsi::CopyDeviceDataToHalfStep() {
-    thrust::copy(m_sysFSI->sphMarkersD2->posRadD.begin(), m_sysFSI->sphMarkersD2->posRadD.end(),
-                 m_sysFSI->sphMarkersD1->posRadD.begin());
-    thrust::copy(m_sysFSI->sphMarkersD2->velMasD.begin(), m_sysFSI->sphMarkersD2->velMasD.end(),
-                 m_sysFSI->sphMarkersD1->velMasD.begin());
-    thrust::copy(m_sysFSI->sphMarkersD2->rhoPresMuD.begin(), m_sysFSI->sphMarkersD2->rhoPresMuD.end(),
-                 m_sysFSI->sphMarkersD1->rhoPresMuD.begin());
-    if (m_paramsH->elastic_SPH) {
-        thrust::copy(m_sysFSI->sphMarkersD2->tauXxYyZzD.begin(), m_sysFSI->sphMarkersD2->tauXxYyZzD.end(),
-                     m_sysFSI->sphMarkersD1->tauXxYyZzD.begin());
-        thrust::copy(m_sysFSI->sphMarkersD2->tauXyXzYzD.begin(), m_sysFSI->sphMarkersD2->tauXyXzYzD.end(),
-                     m_sysFSI->sphMarkersD1->tauXyXzYzD.begin());
-    }
-}
-
 void ChSystemFsi::DoStepDynamics_FSI() {
     if (!m_is_initialized) {
         cout << "ERROR: FSI system not initialized!\n" << endl;
@@ -893,16 +944,28 @@ void ChSystemFsi::DoStepDynamics_FSI() {
     m_timer_step.reset();
     m_timer_step.start();
 
+    // Update the body-attached active domain boxes
+    if (!m_active_boxes.empty()) {
+        thrust::host_vector<Real3> centers(m_active_boxes.size());
+        thrust::host_vector<Real3> half_dims(m_active_boxes.size());
+        for (size_t i = 0; i < m_active_boxes.size(); i++) {
+            const auto& box = m_active_boxes[i];
+            centers[i] = utils::ToReal3(box.body->TransformPointLocalToParent(box.offset));
+            half_dims[i] = utils::ToReal3(box.half_dim);
+        }
+        m_fluid_dynamics->SetActiveBoxes(centers, half_dims);
+    }
+
     if (m_fluid_dynamics->GetIntegratorType() == TimeIntegrator::EXPLICITSPH) {
-        // The following is used to execute the Explicit WCSPH
-        CopyDeviceDataToHalfStep();
-        thrust::copy(m_sysFSI->fsiGeneralData->derivVelRhoD.begin(), m_sysFSI->fsiGeneralData->derivVelRhoD.end(),
-                     m_sysFSI->fsiGeneralData->derivVelRhoD_old.begin());
+        // The following is used to execute the Explicit WCSPH.
+        // The half-step state (sphMarkersD1) is written by the first integration stage, so no copy of the marker
+        // arrays is needed; the derivatives of the previous step are kept by swapping buffers.
+        m_sysFSI->fsiGeneralData->derivVelRhoD.swap(m_sysFSI->fsiGeneralData->derivVelRhoD_old);
         ChUtilsDevice::FillVector(m_sysFSI->fsiGeneralData->derivVelRhoD, mR4(0));
 
         if (m_integrate_SPH) {
             m_fluid_dynamics->IntegrateSPH(m_sysFSI->sphMarkersD2, m_sysFSI->sphMarkersD1, m_sysFSI->fsiBodiesD2,
-                                           m_sysFSI->fsiMeshD, 0.5 * m_paramsH->dT, m_time);
+                                           m_sysFSI->fsiMeshD, 0.5 * m_paramsH->dT, m_time, true);
             m_fluid_dynamics->IntegrateSPH(m_sysFSI->sphMarkersD1, m_sysFSI->sphMarkersD2, m_sysFSI->fsiBodiesD2,
                                            m_sysFSI->fsiMeshD, 1.0 * m_paramsH->dT, m_time);
         }
@@ -983,6 +1046,21 @@ void ChSystemFsi::WriteParticleFile(const std::string& outfilename) const {
     }
 }
 
+void ChSystemFsi::WriteParticleFileAsync(const std::string& outfilename) {
+    if (m_write_mode == OutpuMode::NONE)
+        return;
+    if (!m_async_writer)
+        m_async_writer = chrono_types::make_unique<utils::ParticleFileWriterAsync>();
+    m_async_writer->Write(m_sysFSI->sphMarkersD2->posRadD, m_sysFSI->sphMarkersD2->velMasD,
+                          m_sysFSI->sphMarkersD2->rhoPresMuD, m_sysFSI->fsiGeneralData->referenceArray, outfilename,
+                          m_write_mode == OutpuMode::CHPF);
+}
+
+void ChSystemFsi::WaitParticleOutput() {
+    if (m_async_writer)
+        m_async_writer->Wait();
+}
+
 void ChSystemFsi::PrintParticleToFile(const std::string& dir) const {
     utils::PrintParticleToFile(m_sysFSI->sphMarkersD2->posRadD, m_sysFSI->sphMarkersD2->velMasD,
                                m_sysFSI->sphMarkersD2->rhoPresMuD, m_sysFSI->fsiGeneralData->sr_tau_I_mu_i,
@@ -2164,6 +2242,36 @@ std::vector<ChVector3d> ChSystemFsi::GetParticleFluidProperties() const {
     return props;
 }
 
+void ChSystemFsi::SetParticlePositions(const std::vector<int>& indices, const std::vector<ChVector3d>& positions) {
+    assert(indices.size() == positions.size());
+    auto& markers = m_sysFSI->sphMarkersD2;
+    thrust::host_vector<Real4> posRadH = markers->posRadD;
+    thrust::host_vector<Real3> velMasH = markers->velMasD;
+    thrust::host_vector<Real4> rhoPresMuH = markers->rhoPresMuD;
+    thrust::host_vector<Real3> tauXxYyZzH = markers->tauXxYyZzD;
+    thrust::host_vector<Real3> tauXyXzYzH = markers->tauXyXzYzD;
+
+    for (size_t k = 0; k < indices.size(); k++) {
+        int i = indices[k];
+        Real4 rhoPresMu = rhoPresMuH[i];
+        if (rhoPresMu.w > 0)
+            continue;
+        posRadH[i] = mR4(utils::ToReal3(positions[k]), posRadH[i].w);
+        if (rhoPresMu.w < 0) {
+            velMasH[i] = mR3(0);
+            rhoPresMuH[i] = mR4(m_paramsH->rho0, 0, rhoPresMu.z, rhoPresMu.w);
+            tauXxYyZzH[i] = mR3(0);
+            tauXyXzYzH[i] = mR3(0);
+        }
+    }
+
+    markers->posRadD = posRadH;
+    markers->velMasD = velMasH;
+    markers->rhoPresMuD = rhoPresMuH;
+    markers->tauXxYyZzD = tauXxYyZzH;
+    markers->tauXyXzYzD = tauXyXzYzH;
+}
+
 std::vector<ChVector3d> ChSystemFsi::GetParticleVelocities() const {
     thrust::host_vector<Real3> velH = m_sysFSI->sphMarkersD2->velMasD;
     std::vector<ChVector3d> vel;
@@ -49,6 +49,10 @@ class ChBce;
 struct SimParams;
 struct ChCounters;
 
+namespace utils {
+class ParticleFileWriterAsync;
+}
+
 /// @addtogroup fsi_physics
 /// @{
 
@@ -115,6 +119,13 @@ class CH_FSI_API ChSystemFsi {
     /// Set SPH kernel length.
     void SetKernelLength(double length);
 
+    /// Set the skin for neighbor search (default: 0).
+    /// With a non-zero skin, the neighbor search cells are enlarged by half the skin and the neighbor search data is
+    /// rebuilt only when some marker moved more than half the skin since the last search (otherwise, the marker order
+    /// and cell lists from the last search are reused). A skin of a fraction of the kernel length is typically enough
+    /// for granular (CRM) problems, where markers move little at each step.
+    void SetNeighborSkin(double skin);
+
     /// Set the fluid container dimension
     void SetContainerDim(const ChVector3d& boxDim);
 
@@ -127,6 +138,14 @@ class CH_FSI_API ChSystemFsi {
     /// but rather oinly when Chrono::FSI is used for continuum representation of granular dynamics (in terramechanics).
     void SetActiveDomain(const ChVector3d& boxHalfDim);
 
+    /// Add an active domain box attached to the specified body.
+    /// The box is axis-aligned, with given half-dimensions, and centered at the specified point (expressed in the body
+    /// frame). It moves with the body (e.g., a vehicle chassis). Once at least one such box is defined, the active
+    /// domain consists only of these boxes (instead of boxes around all FSI objects, see SetActiveDomain): SPH
+    /// particles outside all boxes are frozen (no force computation nor integration) but still act on the active
+    /// particles in their neighborhood. As for SetActiveDomain, this should only be used for granular dynamics.
+    void AddActiveDomain(std::shared_ptr<ChBody> body, const ChVector3d& offset, const ChVector3d& boxHalfDim);
+
     /// Disable use of the active domain for the given duration at the beginning of the simulation (default: 0).
     /// This parameter is used for settling operations where all particles must be active through the settling process.
     void SetActiveDomainDelay(double duration);
@@ -174,6 +193,17 @@ class CH_FSI_API ChSystemFsi {
     /// Set the linear system solver for implicit methods.
     void SetSPHLinearSolver(SolverType lin_solver);
 
+    /// Set the preconditioner of the linear system solver for implicit methods (default: JACOBI).
+    /// For a Chebyshev preconditioner, 'degree' is the degree of the polynomial (number of matrix-vector products).
+    void SetSPHLinearSolverPreconditioner(PreconditionerType precond, int degree = 4);
+
+    /// Enable or disable starting the linear system solver from the pressure at the previous step (default: true).
+    /// Only used with a non-incremental projection.
+    void SetSPHLinearSolverWarmStart(bool val);
+
+    /// Return convergence statistics of the linear system solver for implicit methods, accumulated over all steps.
+    LinearSolverStats GetSPHLinearSolverStats() const;
+
     /// Set the SPH method and, optionally, the linear solver type.
     void SetSPHMethod(FluidDynamics SPH_method, SolverType lin_solver = SolverType::BICGSTAB);
 
@@ -184,6 +214,20 @@ class CH_FSI_API ChSystemFsi {
     /// Set simulation data output length
     void SetOutputLength(int OutputLength);
 
+    /// Distribute the force calculation for granular material over the specified CUDA devices.
+    /// The first device must be the current device, on which all system data resides. The SPH markers are split in
+    /// slabs of grid cells along Z, one per device, with roughly the same number of markers. At each step, the markers
+    /// of each slab and of its halo (the neighboring cells, including BCE markers of boundaries and of rigid and
+    /// flexible bodies crossing the slab boundaries) are copied to the corresponding device (through peer copies where
+    /// available), and the resulting force derivatives are copied back. All other calculations, including the
+    /// neighbor search, the time integration, and the FSI force reductions, remain on the first device, so the
+    /// problem size is still limited by the memory of the first device.
+    /// Only supported with the explicit SPH method for granular material (see SetElasticSPH); must be called before
+    /// Initialize.
+    /// Note: this is an experimental feature, not yet validated on multi-GPU hardware (see the fsiMultiDevice unit test,
+    /// which compares granular settling on one and two devices).
+    void SetDevices(const std::vector<int>& devices);
+
     /// Set the FSI system output mode (default: NONE).
     void SetParticleOutputMode(OutpuMode mode) { m_write_mode = mode; }
 
@@ -263,6 +307,12 @@ class CH_FSI_API ChSystemFsi {
     /// For each SPH particle, the 3-dimensional array contains density, pressure, and viscosity.
     std::vector<ChVector3d> GetParticleFluidProperties() const;
 
+    /// Relocate SPH particles and boundary BCE markers.
+    /// The markers are identified by their indices in the arrays returned by GetParticlePositions. Relocated SPH
+    /// particles are reset to rest (zero velocity and stress, reference density, zero pressure). Indices of rigid or
+    /// flexible body BCE markers are ignored (these follow their associated solid).
+    void SetParticlePositions(const std::vector<int>& indices, const std::vector<ChVector3d>& positions);
+
     /// Get a reference to the FSI bodies.
     /// FSI bodies are the ones seen by the fluid dynamics system.
     std::vector<std::shared_ptr<ChBody>>& GetFsiBodies() const;
@@ -289,6 +339,14 @@ class CH_FSI_API ChSystemFsi {
     /// Write FSI system particle output.
     void WriteParticleFile(const std::string& outfilename) const;
 
+    /// Write FSI system particle output from a background thread.
+    /// The fluid marker data is copied to pinned host memory on a separate CUDA stream, and the file is formatted and
+    /// written while the simulation advances. A call waits for the completion of the previous asynchronous output.
+    void WriteParticleFileAsync(const std::string& outfilename);
+
+    /// Wait for the completion of any pending asynchronous particle output.
+    void WaitParticleOutput();
+
     /// Save the SPH particle information into files.
     /// This function creates three CSV files for SPH particles, boundary BCE markers, and solid BCE markers data.
     void PrintParticleToFile(const std::string& dir) const;
@@ -525,9 +583,6 @@ class CH_FSI_API ChSystemFsi {
 
     void AddBCE_shell(const thrust::host_vector<Real4>& posRadBCE, std::shared_ptr<fea::ChElementShellANCF_3423> shell);
 
-    /// Function to initialize the midpoint device data of the fluid system by copying from the full step.
-    void CopyDeviceDataToHalfStep();
-
     ChSystem* m_sysMBS;  ///< multibody system
 
     std::shared_ptr<SimParams> m_paramsH;  ///< pointer to the simulation parameters
@@ -542,6 +597,18 @@ class CH_FSI_API ChSystemFsi {
     std::unique_ptr<ChFsiInterface> m_fsi_interface;    ///< FSI interface system
     std::shared_ptr<ChBce> m_bce_manager;               ///< BCE manager
 
+    std::unique_ptr<utils::ParticleFileWriterAsync> m_async_writer;  ///< asynchronous particle output
+
+    /// Active domain box attached to a body.
+    struct ActiveBox {
+        std::shared_ptr<ChBody> body;  ///< body carrying the box
+        ChVector3d offset;             ///< box center, in the body frame
+        ChVector3d half_dim;           ///< box half-dimensions
+    };
+    std::vector<ActiveBox> m_active_boxes;  ///< body-attached active domain boxes
+
+    std::vector<int> m_devices;  ///< CUDA devices for the force calculation (empty for the current device only)
+
     std::shared_ptr<ChCounters> m_num_objectsH;       ///< number of objects, fluid, bce, and boundary markers
     std::vector<std::vector<int>> m_fea_shell_nodes;  ///< indices of nodes of each shell element
     std::vector<std::vector<int>> m_fea_cable_nodes;  ///< indices of nodes of each cable element
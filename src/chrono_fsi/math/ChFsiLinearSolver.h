@@ -23,11 +23,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
 #include <typeinfo>
 #include "cublas_v2.h"
 #include "cusparse_v2.h"
 
 #include "chrono_fsi/math/custom_math.h"
+#include "chrono_fsi/math/ChFsiPreconditioner.cuh"
 #include "chrono_fsi/ChDefinitionsFsi.h"
 
 namespace chrono {
@@ -94,10 +96,38 @@ class ChFsiLinearSolver {
     /// - 1: successfully converged
     int GetSolverStatus() { return solver_status; }
 
+    /// Set the preconditioner and, for a Chebyshev preconditioner, the degree of the polynomial (default: JACOBI).
+    void SetPreconditioner(PreconditionerType type, int degree = 4) { precond.SetType(type, degree); }
+
+    /// Return the preconditioner type.
+    PreconditionerType GetPreconditioner() const { return precond.GetType(); }
+
+    /// Return statistics of the solves performed since construction or the last call to ResetStats.
+    /// The statistics of the last solve are also included.
+    const LinearSolverStats& GetStats() const { return stats; }
+
+    /// Reset the accumulated solver statistics.
+    void ResetStats() { stats = LinearSolverStats(); }
+
     /// Solve linear system for x.
     virtual void Solve(int SIZE, int NNZ, Real* A, unsigned int* ArowIdx, unsigned int* AcolIdx, Real* x, Real* b) = 0;
 
   protected:
+    /// Record the outcome of the last solve in the solver statistics.
+    void UpdateStats(Real initial_residual) {
+        stats.num_solves++;
+        stats.num_converged += (solver_status == 1);
+        stats.total_iterations += Iterations;
+        stats.max_iterations = std::max(stats.max_iterations, Iterations);
+        stats.iterations = Iterations;
+        stats.initial_residual = initial_residual;
+        stats.residual = residual;
+        stats.converged = (solver_status == 1);
+    }
+
+    ChFsiPreconditioner precond;
+    LinearSolverStats stats;
+
     Real rel_res = Real(1e-3);
     Real abs_res = Real(1e-6);
     Real residual = Real(1e5);
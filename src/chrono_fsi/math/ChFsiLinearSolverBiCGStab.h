@@ -42,13 +42,25 @@ class ChFsiLinearSolverBiCGStab : public ChFsiLinearSolver {
         : ChFsiLinearSolver(SolverType::BICGSTAB, mrel_res, mabs_res, mmax_iter, mverbose) {}
 
     /// Destructor of the ChFsiLinearSolverBiCGStab class.
-    ~ChFsiLinearSolverBiCGStab() {}
+    ~ChFsiLinearSolverBiCGStab();
 
     /// Solves the linear system on the device.
     virtual void Solve(int SIZE, int NNZ, Real* A, unsigned int* ArowIdx, unsigned int* AcolIdx, Real* x, Real* b)
         override;
 
   private:
+    /// Allocate the work vectors (reused across solves) for a system of given size.
+    void Allocate(int SIZE);
+
+    cublasHandle_t cublasHandle = 0;
+    int capacity = 0;
+    Real* r = nullptr;
+    Real* rh = nullptr;
+    Real* p = nullptr;
+    Real* ph = nullptr;
+    Real* v = nullptr;
+    Real* s = nullptr;
+    Real* t = nullptr;
 };
 
 /// @} fsi_solver
@@ -20,7 +20,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-
+#include <algorithm>
+#include <cmath>
 #include <typeinfo>
 #include "cublas_v2.h"
 #include "cusparse_v2.h"
@@ -67,6 +68,38 @@ void PlaneRotation(Real* H, Real* cs, Real* sn, Real* s, const int i, const int
     ApplyPlaneRotation(s[i], s[i + 1], cs[i], sn[i]);
 }
 
+ChFsiLinearSolverGMRES::~ChFsiLinearSolverGMRES() {
+    cudaFree(V);
+    cudaFree(w);
+    cudaFree(z);
+    cudaFree(sDev);
+    if (cublasHandle)
+        cublasDestroy(cublasHandle);
+}
+
+void ChFsiLinearSolverGMRES::Allocate(int SIZE) {
+    if (!cublasHandle)
+        cublasCreate(&cublasHandle);
+    if (SIZE > capacity || restart != capacity_restart) {
+        cudaFree(V);
+        cudaFree(w);
+        cudaFree(z);
+        cudaFree(sDev);
+        cudaMalloc((void**)&V, sizeof(Real) * (restart + 1) * SIZE);
+        cudaMalloc((void**)&w, sizeof(Real) * SIZE);
+        cudaMalloc((void**)&z, sizeof(Real) * SIZE);
+        cudaMalloc((void**)&sDev, sizeof(Real) * (restart + 1));
+        capacity = SIZE;
+        capacity_restart = restart;
+    }
+    H.assign((restart + 1) * restart, 0);
+    s.assign(restart + 1, 0);
+    cs.assign(restart, 0);
+    sn.assign(restart, 0);
+}
+
+// Right-preconditioned restarted GMRES: the Krylov space is built for A M^{-1}, so that the least-squares residual is
+// the residual of the original system. Each Arnoldi step counts as one iteration.
 void ChFsiLinearSolverGMRES::Solve(int SIZE,
                                    int NNZ,
                                    Real* A,
@@ -74,189 +107,97 @@ void ChFsiLinearSolverGMRES::Solve(int SIZE,
                                    unsigned int* AcolIdx,
                                    Real* x,
                                    Real* b) {
-#ifndef CUDART_VERSION
-    #error CUDART_VERSION Undefined!
-#elif (CUDART_VERSION == 11000)
-
-    restart = 10;
-    cublasHandle_t cublasHandle = 0;
-    cusparseHandle_t cusparseHandle = 0;
-    cusparseDnVecDescr_t vecX, vecW, vecV0;
-    cusparseSpMatDescr_t descrA;
-    size_t bufferSize = 0;
-    void* bufferX = NULL;
-    void* bufferW = NULL;
-    const cusparseOperation_t trans_A = CUSPARSE_OPERATION_NON_TRANSPOSE;
-    cusparseCreateCsr(&descrA, SIZE, SIZE, NNZ, (int*)ArowIdx, (int*)AcolIdx, A, CUSPARSE_INDEX_32I, CUSPARSE_INDEX_32I,
-                      CUSPARSE_INDEX_BASE_ZERO, CUDA_R_64F);
-
-    Real *w, *v0, *V, *sDev, *H, *s, *cs, *sn;
-
-    cudaMalloc((void**)&w, sizeof(Real) * SIZE);
-    cudaMalloc((void**)&v0, sizeof(Real) * SIZE);
-    cudaMalloc((void**)&V, sizeof(Real) * (restart + 1) * SIZE);  // Arnoldi Matrix
-    // Note that this is in fact the transpose of the matrix because of performance reasons
-    cudaMalloc((void**)&sDev, sizeof(Real) * (restart + 1));
-
-    H = (Real*)malloc(sizeof(Real) * (restart + 1) * restart);
-    s = (Real*)malloc(sizeof(Real) * (restart + 1));
-    cs = (Real*)malloc(sizeof(Real) * restart);
-    sn = (Real*)malloc(sizeof(Real) * restart);
-
-    cudaDeviceSynchronize();
-
-    //    cudaMemset((void*)x, 0.0, sizeof(Real) * SIZE);
-
-    cudaMemset((void*)w, 0, sizeof(Real) * SIZE);
-    cudaMemset((void*)v0, 0, sizeof(Real) * SIZE);
-    cudaMemset((void*)V, 0, sizeof(Real) * (restart + 1) * SIZE);
-    cudaMemset((void*)sDev, 0, sizeof(Real) * (restart + 1));
-
-    memset(H, 0, sizeof(Real) * (restart + 1) * restart);
-    memset(s, 0, sizeof(Real) * (restart + 1));
-    memset(cs, 0, sizeof(Real) * restart);
-    memset(sn, 0, sizeof(Real) * restart);
-
-    cudaDeviceSynchronize();
-
-    //====== Get handle to the CUBLAS context ========
-    cublasStatus_t cublasStatus;
-    cublasCreate(&cublasHandle);
-    cudaDeviceSynchronize();
-
-    //====== Get handle to the CUSPARSE context ======
-    cusparseStatus_t cusparseStatus;
-    cusparseCreate(&cusparseHandle);
-    cudaDeviceSynchronize();
-
-    //===========================Solution=====================================================
-    Real beta = 1.0, mOneOverBeta = 1, temp = 1, mtemp = -1, Hnew = 1, oneOverHnew = 1;
-    Real nrmr0 = 1e5, nrmr = 1e5, res = 1e5;
-    Real zero = 0.0;
-    Real one = 1.0;
-    Real mone = -1.0;
-    cudaCheckError();
-
-    for (Iterations = 0; Iterations < max_iter; Iterations++) {
-        //        printf("-----1\n");
-        // compute initial residual w=Ax0 (using initial guess in x)
-        // w = A * x
-        cusparseCreateDnVec(&vecX, SIZE, x, CUDA_R_64F);
-        cusparseCreateDnVec(&vecW, SIZE, w, CUDA_R_64F);
-        cusparseStatus = cusparseSpMV_bufferSize(cusparseHandle, trans_A, &one, descrA, vecX, &zero, vecW, CUDA_R_64F,
-                                                 CUSPARSE_MV_ALG_DEFAULT, &bufferSize);
-        cudaMalloc((void**)&bufferX, bufferSize);
-        cusparseStatus = cusparseSpMV(cusparseHandle, trans_A, &one, descrA, vecX, &zero, vecW, CUDA_R_64F,
-                                      CUSPARSE_MV_ALG_DEFAULT, bufferX);
-
-        cublasDaxpy(cublasHandle, SIZE, &mone, b, 1, w, 1);  // w=w-b
-        cublasDnrm2(cublasHandle, SIZE, w, 1, &beta);        // beta=norm(w,2)
-        nrmr = beta;
+    if (restart < 1)
+        restart = 1;
+    Allocate(SIZE);
+    precond.Setup(SIZE, A, ArowIdx, AcolIdx);
+
+    const Real zero = 0;
+    const Real one = 1;
+    const Real none = -1;
+    Real beta = 0, nrmr0 = 0, temp;
+
+    Iterations = 0;
+    solver_status = 0;
+
+    while (true) {
+        // w = b - A*x, using the current approximation in x
+        CsrMultiply(SIZE, A, ArowIdx, AcolIdx, x, w);
+        cublasDscal(cublasHandle, SIZE, &none, w, 1);
+        cublasDaxpy(cublasHandle, SIZE, &one, b, 1, w, 1);
+        cublasDnrm2(cublasHandle, SIZE, w, 1, &beta);
         if (Iterations == 0)
             nrmr0 = beta;
+        residual = beta;
+        if (beta < rel_res * nrmr0 || beta < abs_res) {
+            solver_status = 1;
+            break;
+        }
+        if (Iterations >= max_iter)
+            break;
 
-        mOneOverBeta = -1.0 / beta;
-        cublasDscal(cublasHandle, SIZE, &mOneOverBeta, w, 1);  // w=-w/beta
-        cudaMemcpy(V, w, SIZE * sizeof(Real), cudaMemcpyDeviceToDevice);
-        memset(s, 0, sizeof(Real) * (restart + 1));
-
+        // V_0 = w / beta
+        temp = 1 / beta;
+        cublasDcopy(cublasHandle, SIZE, w, 1, V, 1);
+        cublasDscal(cublasHandle, SIZE, &temp, V, 1);
+        std::fill(s.begin(), s.end(), Real(0));
         s[0] = beta;
-        //        printf("-----2\n");
-
-        for (size_t m = 0; m < restart; m++) {
-            // v0=A*w
-            cusparseCreateDnVec(&vecV0, SIZE, v0, CUDA_R_64F);
-            cusparseStatus = cusparseSpMV_bufferSize(cusparseHandle, trans_A, &one, descrA, vecW, &zero, vecV0,
-                                                     CUDA_R_64F, CUSPARSE_MV_ALG_DEFAULT, &bufferSize);
-            cudaMalloc((void**)&bufferW, bufferSize);
-            cusparseStatus = cusparseSpMV(cusparseHandle, trans_A, &one, descrA, vecW, &zero, vecV0, CUDA_R_64F,
-                                          CUSPARSE_MV_ALG_DEFAULT, bufferW);
 
-            cudaMemcpy(w, v0, SIZE * sizeof(Real), cudaMemcpyDeviceToDevice);
-            cublasDnrm2(cublasHandle, SIZE, w, 1, &temp);
-            cudaDeviceSynchronize();
-            //            printf("m=%d, temp=%f\n", m, temp);
-
-            for (int k = 0; k < m; k++) {
-                //  H(k,i) = <V(i+1),V(k)>
-                cublasDdot(cublasHandle, SIZE, V + SIZE * k, 1, w, 1, &temp);
-                cudaDeviceSynchronize();
+        // Arnoldi process with modified Gram-Schmidt
+        int m = 0;
+        while (m < restart && Iterations < max_iter) {
+            Real* Vm = V + (size_t)m * SIZE;
+            Real* Vn = V + (size_t)(m + 1) * SIZE;
+
+            // V_{m+1} = A * M^{-1} V_m
+            precond.Apply(Vm, z);
+            CsrMultiply(SIZE, A, ArowIdx, AcolIdx, z, Vn);
+            for (int k = 0; k <= m; k++) {
+                cublasDdot(cublasHandle, SIZE, V + (size_t)k * SIZE, 1, Vn, 1, &temp);
                 H[k * restart + m] = temp;
-                mtemp = -temp;
-                //                printf("%f ", temp);
-                // V(i+1) -= H(k, i) * V(k)
-                cublasDaxpy(cublasHandle, SIZE, &mtemp, V + SIZE * k, 1, w, 1);
-                cudaDeviceSynchronize();
+                temp = -temp;
+                cublasDaxpy(cublasHandle, SIZE, &temp, V + (size_t)k * SIZE, 1, Vn, 1);
+            }
+            Real Hnew;
+            cublasDnrm2(cublasHandle, SIZE, Vn, 1, &Hnew);
+            H[(m + 1) * restart + m] = Hnew;
+            if (Hnew > 0) {
+                temp = 1 / Hnew;
+                cublasDscal(cublasHandle, SIZE, &temp, Vn, 1);
             }
 
-            cublasDnrm2(cublasHandle, SIZE, w, 1, &Hnew);
-            cudaDeviceSynchronize();
-            H[(m + 1) * restart + m] = Hnew;  // H(i + 1, i)=norm(w,2)
+            PlaneRotation(H.data(), cs.data(), sn.data(), s.data(), m, restart);
+            m++;
+            Iterations++;
 
-            oneOverHnew = 1.0 / Hnew;
-            // V(i+1) = V(i+1) / H(i+1, i)
-            cublasDscal(cublasHandle, SIZE, &oneOverHnew, w, 1);
-            cudaDeviceSynchronize();
-            cudaMemcpy(V + (m + 1) * SIZE, w, sizeof(Real) * SIZE, cudaMemcpyDeviceToDevice);
-            PlaneRotation(H, cs, sn, s, (int)m, restart);
-            res = abs(s[m + 1]);
+            // the rotated right-hand side provides the residual norm without forming it
+            residual = std::abs(s[m]);
+            if (verbose)
+                printf("Iterations=%d\t ||b-A*x||=%.4e\n", Iterations, residual);
+            if (residual < rel_res * nrmr0 || residual < abs_res || Hnew == 0)
+                break;
         }
 
-        //        printMatrix(H, restart + 1, restart);
-
-        //        printf("-----3\n");
-
-        // solve upper triangular system in place
-        for (int j = restart - 1; j >= 0; j--) {
+        // solve the upper triangular system H y = s, in place in s
+        for (int j = m - 1; j >= 0; j--) {
             s[j] /= H[j * restart + j];
-            // S(0:j) = s(0:j) - s[j] H(0:j,j)
-            for (int k = j - 1; k >= 0; k--) {
+            for (int k = j - 1; k >= 0; k--)
                 s[k] -= H[k * restart + j] * s[j];
-            }
         }
 
-        // update the solution
-        // copy s to gpu
-        cudaMemcpy(sDev, s, (restart + 1), cudaMemcpyHostToDevice);
-        cudaCheckError();
-
-        // x= V(1:N,0:i)*s(0:i)+x
-        for (size_t j = 0; j < restart; j++) {
-            // x = x + s[j] * V(j)
-            cublasDaxpy(cublasHandle, SIZE, s + j, V + j * SIZE, 1, x, 1);
-            cudaDeviceSynchronize();
-        }
-
-        if (verbose)
-            printf("Iterations=%d\t ||b-A*x||=%.4e\n", Iterations, nrmr);
-        //        && Iterations > 3
-
-        if (res < abs_res * 1e-14) {
-            // There is not much that can be extract from the system
-            if ((nrmr < rel_res * nrmr0 || nrmr < abs_res)) {
-                solver_status = 1;
-            } else {
-                solver_status = 0;
-            }
-            residual = nrmr;
-            break;
-        }
-        residual = nrmr;
+        // x += M^{-1} V y
+        cudaMemcpy(sDev, s.data(), sizeof(Real) * m, cudaMemcpyHostToDevice);
+        cublasDgemv(cublasHandle, CUBLAS_OP_N, SIZE, m, &one, V, SIZE, sDev, 1, &zero, w, 1);
+        precond.Apply(w, z);
+        cublasDaxpy(cublasHandle, SIZE, &one, z, 1, x, 1);
     }
 
-    // cusparseDestroySolveAnalysisInfo(info_l);
-    // cusparseDestroySolveAnalysisInfo(info_u);
-    cudaFree(w);
-    cudaFree(v0);
-    cudaFree(V);
-    cudaFree(sDev);
+    if (verbose)
+        printf("GMRES(%d): %s after %d iterations, ||b-A*x||=%.4e (initial %.4e)\n", restart,
+               solver_status ? "converged" : "not converged", Iterations, residual, nrmr0);
 
-    free(H);
-    free(s);
-    free(cs);
-    free(sn);
-#endif
+    UpdateStats(nrmr0);
 }
 
 }  // end namespace fsi
-}  // namespace chrono
+}  // end namespace chrono
@@ -24,6 +24,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <typeinfo>
+#include <vector>
 #include "cublas_v2.h"
 #include "cusparse_v2.h"
 #include "chrono_fsi/utils/ChUtilsDevice.cuh"
@@ -43,7 +44,7 @@ class ChFsiLinearSolverGMRES : public ChFsiLinearSolver {
         : ChFsiLinearSolver(SolverType::GMRES, mrel_res, mabs_res, mmax_iter, mverbose) {}
 
     /// Destructor of the ChFsiLinearSolverGMRES class.
-    ~ChFsiLinearSolverGMRES() {}
+    ~ChFsiLinearSolverGMRES();
 
     /// Solve the linear system on the device.
     virtual void Solve(int SIZE, int NNZ, Real* A, unsigned int* ArowIdx, unsigned int* AcolIdx, Real* x, Real* b)
@@ -53,7 +54,21 @@ class ChFsiLinearSolverGMRES : public ChFsiLinearSolver {
     void SetRestart(int R) { restart = R; }
 
   private:
-    int restart = 100;
+    /// Allocate the Krylov basis and work vectors (reused across solves) for a system of given size.
+    void Allocate(int SIZE);
+
+    int restart = 10;
+
+    cublasHandle_t cublasHandle = 0;
+    int capacity = 0;           ///< system size for which the device arrays were allocated
+    int capacity_restart = 0;   ///< restart value for which the arrays were allocated
+    Real* V = nullptr;          ///< Krylov basis, (restart + 1) vectors of length SIZE
+    Real* w = nullptr;          ///< work vector
+    Real* z = nullptr;          ///< work vector
+    Real* sDev = nullptr;       ///< coefficients of the solution update in the Krylov basis
+    std::vector<Real> H;        ///< Hessenberg matrix, (restart + 1) x restart, row-major
+    std::vector<Real> s;        ///< rotated right-hand side of the least-squares problem
+    std::vector<Real> cs, sn;   ///< Givens rotations
 };
 
 /// @} fsi_solver
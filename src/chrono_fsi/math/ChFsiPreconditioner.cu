@@ -0,0 +1,224 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Preconditioners and sparse matrix-vector product for the GPU linear solvers.
+// =============================================================================
+
+#include <thrust/device_ptr.h>
+#include <thrust/extrema.h>
+
+#include "chrono_fsi/math/ChFsiPreconditioner.cuh"
+
+namespace chrono {
+namespace fsi {
+
+// Ratio between the upper and lower bounds of the spectrum targeted by the Chebyshev polynomial
+static const Real CHEBYSHEV_EIG_RATIO = 30;
+
+static const unsigned int BLOCK_SIZE = 256;
+
+static inline unsigned int NumBlocks(int size) {
+    return (size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+}
+
+// -----------------------------------------------------------------------------
+
+// y = A * x, one thread per row
+__global__ void CsrMultiply_kernel(int size,
+                                   const Real* A,
+                                   const unsigned int* rowIdx,
+                                   const unsigned int* colIdx,
+                                   const Real* x,
+                                   Real* y) {
+    int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= size)
+        return;
+    Real sum = 0;
+    for (unsigned int k = rowIdx[i]; k < rowIdx[i + 1]; k++)
+        sum += A[k] * x[colIdx[k]];
+    y[i] = sum;
+}
+
+// Inverse diagonal and Gershgorin bound of each row of D^{-1}A
+__global__ void Diagonal_kernel(int size,
+                                const Real* A,
+                                const unsigned int* rowIdx,
+                                const unsigned int* colIdx,
+                                Real* invD,
+                                Real* rowBound) {
+    int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= size)
+        return;
+    Real diag = 0;
+    Real sum = 0;
+    for (unsigned int k = rowIdx[i]; k < rowIdx[i + 1]; k++) {
+        if (colIdx[k] == i)
+            diag += A[k];
+        sum += abs(A[k]);
+    }
+    // rows with a vanishing diagonal are left unscaled
+    Real inv = (abs(diag) > 1e-20) ? 1 / diag : Real(1);
+    invD[i] = inv;
+    rowBound[i] = sum * abs(inv);
+}
+
+// z = invD .* r / theta; res = invD .* r; dir = z
+__global__ void ChebyshevInit_kernel(int size,
+                                     const Real* invD,
+                                     const Real* r,
+                                     Real theta,
+                                     Real* res,
+                                     Real* dir,
+                                     Real* z) {
+    int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= size)
+        return;
+    Real ri = invD[i] * r[i];
+    res[i] = ri;
+    dir[i] = ri / theta;
+    z[i] = ri / theta;
+}
+
+// res -= invD .* Adir; dir = c1 * dir + c2 * res; z += dir
+__global__ void ChebyshevUpdate_kernel(int size,
+                                       const Real* invD,
+                                       const Real* Adir,
+                                       Real c1,
+                                       Real c2,
+                                       Real* res,
+                                       Real* dir,
+                                       Real* z) {
+    int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= size)
+        return;
+    Real ri = res[i] - invD[i] * Adir[i];
+    Real di = c1 * dir[i] + c2 * ri;
+    res[i] = ri;
+    dir[i] = di;
+    z[i] += di;
+}
+
+// z = invD .* r
+__global__ void Jacobi_kernel(int size, const Real* invD, const Real* r, Real* z) {
+    int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= size)
+        return;
+    z[i] = invD[i] * r[i];
+}
+
+// -----------------------------------------------------------------------------
+
+void CsrMultiply(int size,
+                 const Real* A,
+                 const unsigned int* rowIdx,
+                 const unsigned int* colIdx,
+                 const Real* x,
+                 Real* y) {
+    if (size == 0)
+        return;
+    CsrMultiply_kernel<<<NumBlocks(size), BLOCK_SIZE>>>(size, A, rowIdx, colIdx, x, y);
+}
+
+ChFsiPreconditioner::ChFsiPreconditioner(PreconditionerType type, int degree)
+    : m_size(0),
+      m_A(nullptr),
+      m_rowIdx(nullptr),
+      m_colIdx(nullptr),
+      m_lambda_max(1),
+      m_lambda_min(1 / CHEBYSHEV_EIG_RATIO),
+      m_capacity(0),
+      m_invD(nullptr),
+      m_res(nullptr),
+      m_dir(nullptr),
+      m_tmp(nullptr) {
+    SetType(type, degree);
+}
+
+ChFsiPreconditioner::~ChFsiPreconditioner() {
+    cudaFree(m_invD);
+    cudaFree(m_res);
+    cudaFree(m_dir);
+    cudaFree(m_tmp);
+}
+
+void ChFsiPreconditioner::SetType(PreconditionerType type, int degree) {
+    m_type = type;
+    m_degree = degree < 1 ? 1 : degree;
+}
+
+void ChFsiPreconditioner::Setup(int size, const Real* A, const unsigned int* rowIdx, const unsigned int* colIdx) {
+    m_size = size;
+    m_A = A;
+    m_rowIdx = rowIdx;
+    m_colIdx = colIdx;
+
+    if (m_type == PreconditionerType::NONE || size == 0)
+        return;
+
+    // the work arrays only grow, so that they are reused across steps
+    if (size > m_capacity) {
+        cudaFree(m_invD);
+        cudaFree(m_res);
+        cudaFree(m_dir);
+        cudaFree(m_tmp);
+        cudaMalloc((void**)&m_invD, sizeof(Real) * size);
+        cudaMalloc((void**)&m_res, sizeof(Real) * size);
+        cudaMalloc((void**)&m_dir, sizeof(Real) * size);
+        cudaMalloc((void**)&m_tmp, sizeof(Real) * size);
+        m_capacity = size;
+    }
+
+    Diagonal_kernel<<<NumBlocks(size), BLOCK_SIZE>>>(size, A, rowIdx, colIdx, m_invD, m_tmp);
+
+    if (m_type == PreconditionerType::CHEBYSHEV) {
+        thrust::device_ptr<Real> bounds(m_tmp);
+        m_lambda_max = *thrust::max_element(bounds, bounds + size);
+        m_lambda_min = m_lambda_max / CHEBYSHEV_EIG_RATIO;
+    }
+}
+
+void ChFsiPreconditioner::Apply(const Real* r, Real* z) {
+    if (m_size == 0)
+        return;
+
+    switch (m_type) {
+        case PreconditionerType::NONE:
+            cudaMemcpy(z, r, sizeof(Real) * m_size, cudaMemcpyDeviceToDevice);
+            break;
+        case PreconditionerType::JACOBI:
+            Jacobi_kernel<<<NumBlocks(m_size), BLOCK_SIZE>>>(m_size, m_invD, r, z);
+            break;
+        case PreconditionerType::CHEBYSHEV: {
+            // Chebyshev iteration for D^{-1}A z = D^{-1}r, starting from z = 0
+            // (Saad, Iterative Methods for Sparse Linear Systems, Algorithm 12.1)
+            Real theta = (m_lambda_max + m_lambda_min) / 2;
+            Real delta = (m_lambda_max - m_lambda_min) / 2;
+            Real sigma = theta / delta;
+            Real rho = 1 / sigma;
+
+            ChebyshevInit_kernel<<<NumBlocks(m_size), BLOCK_SIZE>>>(m_size, m_invD, r, theta, m_res, m_dir, z);
+            for (int k = 1; k < m_degree; k++) {
+                Real rho_new = 1 / (2 * sigma - rho);
+                CsrMultiply(m_size, m_A, m_rowIdx, m_colIdx, m_dir, m_tmp);
+                ChebyshevUpdate_kernel<<<NumBlocks(m_size), BLOCK_SIZE>>>(m_size, m_invD, m_tmp, rho_new * rho,
+                                                                          2 * rho_new / delta, m_res, m_dir, z);
+                rho = rho_new;
+            }
+            break;
+        }
+    }
+}
+
+}  // end namespace fsi
+}  // end namespace chrono
@@ -0,0 +1,85 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Preconditioners and sparse matrix-vector product for the GPU linear solvers.
+// =============================================================================
+
+#ifndef CHFSIPRECONDITIONER_H_
+#define CHFSIPRECONDITIONER_H_
+
+#include "chrono_fsi/math/custom_math.h"
+#include "chrono_fsi/ChDefinitionsFsi.h"
+
+namespace chrono {
+namespace fsi {
+
+/// @addtogroup fsi_solver
+/// @{
+
+/// Compute y = A * x on the device, for a square matrix A in CSR format (zero-based, with size+1 row offsets).
+void CsrMultiply(int size,
+                 const Real* A,
+                 const unsigned int* rowIdx,
+                 const unsigned int* colIdx,
+                 const Real* x,
+                 Real* y);
+
+/// Preconditioner for the GPU linear solvers.
+/// The Chebyshev preconditioner applies a fixed polynomial in D^{-1}A (D being the diagonal of A), which only requires
+/// matrix-vector products and therefore parallelizes as well as the Krylov iterations themselves. The spectrum of
+/// D^{-1}A is bounded above with Gershgorin circles; the lower bound is taken as a fixed fraction of the upper one.
+class ChFsiPreconditioner {
+  public:
+    ChFsiPreconditioner(PreconditionerType type = PreconditionerType::JACOBI, int degree = 4);
+    ~ChFsiPreconditioner();
+
+    /// Set the preconditioner type and the degree of the Chebyshev polynomial.
+    void SetType(PreconditionerType type, int degree = 4);
+
+    /// Return the preconditioner type.
+    PreconditionerType GetType() const { return m_type; }
+
+    /// Return the degree of the Chebyshev polynomial.
+    int GetDegree() const { return m_degree; }
+
+    /// Set up the preconditioner for the given matrix (device arrays, kept by reference until the next setup).
+    void Setup(int size, const Real* A, const unsigned int* rowIdx, const unsigned int* colIdx);
+
+    /// Compute z = M^{-1} r on the device. The two arrays must be distinct.
+    void Apply(const Real* r, Real* z);
+
+  private:
+    PreconditionerType m_type;
+    int m_degree;
+
+    int m_size;
+    const Real* m_A;
+    const unsigned int* m_rowIdx;
+    const unsigned int* m_colIdx;
+
+    Real m_lambda_max;                   ///< upper bound of the spectrum of D^{-1}A
+    Real m_lambda_min;                   ///< assumed lower bound of the spectrum of D^{-1}A
+    int m_capacity;                      ///< allocated length of the device arrays
+    Real* m_invD;                        ///< inverse of the matrix diagonal
+    Real* m_res;                         ///< work vector (Chebyshev)
+    Real* m_dir;                         ///< work vector (Chebyshev)
+    Real* m_tmp;                         ///< work vector (Chebyshev) and row bounds
+};
+
+/// @} fsi_solver
+
+}  // end namespace fsi
+}  // end namespace chrono
+
+#endif
@@ -39,6 +39,16 @@ typedef double Real;
 typedef float Real;
 #endif
 
+/// Define the real type used in the evaluation of SPH kernel functions and their gradients.
+/// In mixed-precision builds, kernels are evaluated in single precision. Their arguments (inter-marker distance
+/// vectors) are formed in double precision before conversion, and all marker states and sums remain in double
+/// precision.
+#ifdef CHRONO_FSI_MIXED_PRECISION
+typedef float KernelReal;
+#else
+typedef Real KernelReal;
+#endif
+
 /// Define the unsigned int type used in FSI.
 typedef unsigned int uint;
 
@@ -16,6 +16,8 @@
 // =============================================================================
 
 #include <thrust/sort.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/functional.h>
 #include "chrono_fsi/physics/ChCollisionSystemFsi.cuh"
 #include "chrono_fsi/physics/ChSphGeneral.cuh"
 #include "chrono_fsi/utils/ChUtilsDevice.cuh"
@@ -307,7 +309,8 @@ ChCollisionSystemFsi::ChCollisionSystemFsi(std::shared_ptr<SphMarkerDataD> other
       markersProximityD(otherMarkersProximityD),
       fsiGeneralData(otherFsiGeneralData),
       paramsH(otherParamsH),
-      numObjectsH(otherNumObjects) {
+      numObjectsH(otherNumObjects),
+      numSearches(0) {
     sphMarkersD = NULL;
 }
 ChCollisionSystemFsi::~ChCollisionSystemFsi() {}
@@ -388,6 +391,11 @@ void ChCollisionSystemFsi::reorderDataAndFindCellStart() {
     OriginalToSortedD<<<numBlocks, numThreads>>>(
         U1CAST(markersProximityD->mapOriginalToSorted),
         U1CAST(markersProximityD->gridMarkerIndexD));
+}
+// ------------------------------------------------------------------------------
+void ChCollisionSystemFsi::reorderData() {
+    uint numThreads, numBlocks;
+    computeGridSize((uint)numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
 
     // Reorder the arrays according to the sorted index of all particles
     reorderDataD<<<numBlocks, numThreads>>>(
@@ -403,16 +411,48 @@ void ChCollisionSystemFsi::reorderDataAndFindCellStart() {
     cudaCheckError();
 }
 // ------------------------------------------------------------------------------
+// Squared displacement of a marker since the last neighbor search
+struct MarkerDisplacement2 {
+    __host__ __device__ Real operator()(const thrust::tuple<Real4, Real4>& pos) const {
+        Real3 d = mR3(thrust::get<0>(pos)) - mR3(thrust::get<1>(pos));
+        return dot(d, d);
+    }
+};
+
+bool ChCollisionSystemFsi::NeedsNeighborSearch() {
+    if (paramsH->neighborSkin <= 0 || numSearches == 0)
+        return true;
+    if (posRadRefD.size() != numObjectsH->numAllMarkers ||
+        markersProximityD->gridMarkerIndexD.size() != numObjectsH->numAllMarkers)
+        return true;
+
+    Real max_d2 = thrust::transform_reduce(
+        thrust::make_zip_iterator(thrust::make_tuple(sphMarkersD->posRadD.begin(), posRadRefD.begin())),
+        thrust::make_zip_iterator(thrust::make_tuple(sphMarkersD->posRadD.end(), posRadRefD.end())),
+        MarkerDisplacement2(), Real(0), thrust::maximum<Real>());
+
+    Real half_skin = paramsH->neighborSkin / 2;
+    return max_d2 > half_skin * half_skin;
+}
+// ------------------------------------------------------------------------------
 void ChCollisionSystemFsi::ArrangeData(std::shared_ptr<SphMarkerDataD> otherSphMarkersD) {
     sphMarkersD = otherSphMarkersD;
-    int3 cellsDim = paramsH->gridSize;
-    int numCells = cellsDim.x * cellsDim.y * cellsDim.z;
-    ResetCellSize(numCells);
-    calcHash();
-    thrust::sort_by_key(markersProximityD->gridMarkerHashD.begin(), 
-        markersProximityD->gridMarkerHashD.end(),
-        markersProximityD->gridMarkerIndexD.begin());
-    reorderDataAndFindCellStart();
+
+    if (NeedsNeighborSearch()) {
+        int3 cellsDim = paramsH->gridSize;
+        int numCells = cellsDim.x * cellsDim.y * cellsDim.z;
+        ResetCellSize(numCells);
+        calcHash();
+        thrust::sort_by_key(markersProximityD->gridMarkerHashD.begin(), 
+            markersProximityD->gridMarkerHashD.end(),
+            markersProximityD->gridMarkerIndexD.begin());
+        reorderDataAndFindCellStart();
+        if (paramsH->neighborSkin > 0)
+            posRadRefD = sphMarkersD->posRadD;
+        numSearches++;
+    }
+
+    reorderData();
 }
 
 }  // end namespace fsi
@@ -43,9 +43,15 @@ class ChCollisionSystemFsi : public ChFsiGeneral {
     /// Destructor of the ChCollisionSystemFsi class
     ~ChCollisionSystemFsi();
 
-    /// Encapsulate calcHash and reaorderDataAndFindCellStart
+    /// Encapsulate calcHash and reaorderDataAndFindCellStart.
+    /// If a neighbor search skin is specified, the markers are sorted and the cell lists rebuilt only if some marker
+    /// moved by more than half the skin since the last neighbor search; otherwise, the sorted marker arrays are
+    /// refreshed using the marker order of the last neighbor search.
     void ArrangeData(std::shared_ptr<SphMarkerDataD> otherSphMarkersD);
 
+    /// Return the number of neighbor searches (marker sorting and cell list updates) performed so far.
+    unsigned int GetNumNeighborSearches() const { return numSearches; }
+
     /// Complete construction.
     void Initialize();
 
@@ -57,6 +63,9 @@ class ChCollisionSystemFsi : public ChFsiGeneral {
     std::shared_ptr<SimParams> paramsH;                 ///< Parameters of the simulation
     std::shared_ptr<ChCounters> numObjectsH;            ///< Size of different objects in the system
 
+    thrust::device_vector<Real4> posRadRefD;  ///< marker positions at the last neighbor search (original order)
+    unsigned int numSearches;                 ///< number of neighbor searches performed
+
     void ResetCellSize(int s);
 
     /// calcHash is the wrapper function for calcHashD. calcHashD is a kernel
@@ -65,6 +74,14 @@ class ChCollisionSystemFsi : public ChFsiGeneral {
 
     /// Wrapper function for reorderDataAndFindCellStartD
     void reorderDataAndFindCellStart();
+
+    /// Wrapper function for reorderDataD (copy marker data to the sorted arrays, using the current marker order)
+    void reorderData();
+
+    /// Check whether the neighbor search data must be rebuilt.
+    /// This is the case if no skin is specified, if the number of markers changed, or if some marker moved by more
+    /// than half the skin since the last neighbor search.
+    bool NeedsNeighborSearch();
 };
 
 /// @} fsi_collision
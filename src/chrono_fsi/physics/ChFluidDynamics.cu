@@ -251,11 +251,20 @@ __global__ void ApplyOutOfBoundaryKernel(Real4* posRadD,
 // Kernel to update the fluid properities. It updates the stress tensor,
 // density, velocity and position relying on explicit Euler scheme.
 // Pressure is obtained from the density and an Equation of State.
+// The updated state is calculated from the input state (arrays with suffix _in)
+// and written to the output arrays, which can be the same as the input arrays.
+// If they are not, the threads beyond the updated portion (and the threads for
+// markers that are not updated) copy the input state to the output arrays.
 __global__ void UpdateFluidD(Real4* posRadD,
                              Real3* velMasD,
                              Real4* rhoPresMuD,
                              Real3* tauXxYyZzD,
                              Real3* tauXyXzYzD,
+                             const Real4* posRadD_in,
+                             const Real3* velMasD_in,
+                             const Real4* rhoPresMuD_in,
+                             const Real3* tauXxYyZzD_in,
+                             const Real3* tauXyXzYzD_in,
                              Real3* vel_XSPH_D,
                              Real4* derivVelRhoD,
                              Real3* derivTauXxYyZzD,
@@ -264,20 +273,35 @@ __global__ void UpdateFluidD(Real4* posRadD,
                              uint* activityIdentifierD,
                              uint* freeSurfaceIdD,
                              int2 updatePortion,
+                             uint numMarkers,
                              Real dT,
                              volatile bool* isErrorD) {
     uint index = blockIdx.x * blockDim.x + threadIdx.x;
-    index += updatePortion.x;
-    if (index >= updatePortion.y)
+    bool copy = (posRadD != posRadD_in);
+    if (!copy)
+        index += updatePortion.x;
+    if (index >= (copy ? numMarkers : updatePortion.y))
         return;
 
     uint activity = activityIdentifierD[index];
-    if (activity == 0)
+    Real4 rhoPresMu = rhoPresMuD_in[index];
+
+    if (index < updatePortion.x || index >= updatePortion.y || activity == 0) {
+        // Marker not updated. Carry over its state (inactive markers are at rest)
+        if (copy) {
+            posRadD[index] = posRadD_in[index];
+            velMasD[index] = (activity == 0) ? mR3(0.0) : velMasD_in[index];
+            rhoPresMuD[index] = rhoPresMu;
+            if (paramsD.elastic_SPH) {
+                tauXxYyZzD[index] = tauXxYyZzD_in[index];
+                tauXyXzYzD[index] = tauXyXzYzD_in[index];
+            }
+        }
         return;
+    }
 
     Real4 derivVelRho = derivVelRhoD[index];
-    Real4 rhoPresMu = rhoPresMuD[index];
-    Real h = posRadD[index].w;
+    Real h = posRadD_in[index].w;
     Real p_tr, p_n;
 
     if (rhoPresMu.w < 0) {
@@ -286,8 +310,8 @@ __global__ void UpdateFluidD(Real4* posRadD,
             //--------------------------------
             // ** total stress tau
             //--------------------------------
-            Real3 tauXxYyZz = tauXxYyZzD[index];
-            Real3 tauXyXzYz = tauXyXzYzD[index];
+            Real3 tauXxYyZz = tauXxYyZzD_in[index];
+            Real3 tauXyXzYz = tauXyXzYzD_in[index];
             Real3 derivTauXxYyZz = derivTauXxYyZzD[index];
             Real3 derivTauXyXzYz = derivTauXyXzYzD[index];
             Real3 updatedTauXxYyZz = tauXxYyZz + mR3(derivTauXxYyZz) * dT;
@@ -390,8 +414,8 @@ __global__ void UpdateFluidD(Real4* posRadD,
         //-------------
         // ** position
         //-------------
-        Real3 vel_XSPH = velMasD[index] + vel_XSPH_D[index];  // paramsD.EPS_XSPH *
-        Real3 posRad = mR3(posRadD[index]);
+        Real3 vel_XSPH = velMasD_in[index] + vel_XSPH_D[index];  // paramsD.EPS_XSPH *
+        Real3 posRad = mR3(posRadD_in[index]);
         Real3 updatedPositon = posRad + vel_XSPH * dT;
         if (!(isfinite(updatedPositon.x) && isfinite(updatedPositon.y) && isfinite(updatedPositon.z))) {
             printf("Error! particle position is NAN: thrown from ChFluidDynamics.cu, UpdateFluidDKernel !\n");
@@ -405,7 +429,7 @@ __global__ void UpdateFluidD(Real4* posRadD,
         //-------------
         // Note that the velocity update should not use the XSPH contribution
         // It adds dissipation to the solution, and provides numerical damping
-        Real3 velMas = velMasD[index] + 0.0 * vel_XSPH_D[index];  // paramsD.EPS_XSPH * vel_XSPH_D[index]
+        Real3 velMas = velMasD_in[index] + 0.0 * vel_XSPH_D[index];  // paramsD.EPS_XSPH * vel_XSPH_D[index]
         Real3 updatedVelocity = velMas + mR3(derivVelRho) * dT;
         velMasD[index] = updatedVelocity;
 
@@ -516,6 +540,9 @@ __global__ void UpdateActivityD(Real4* posRadD,
                                 Real3* velMasD,
                                 Real3* posRigidBodiesD,
                                 Real3* pos_fsi_fea_D,
+                                const Real3* boxCenterD,
+                                const Real3* boxHalfDimD,
+                                uint numBoxes,
                                 uint* activityIdentifierD,
                                 uint* extendedActivityIdD,
                                 int2 updatePortion,
@@ -547,6 +574,27 @@ __global__ void UpdateActivityD(Real4* posRadD,
         mR3(2 * RESOLUTION_LENGTH_MULT * paramsD.HSML);
 
     Real3 posRadA = mR3(posRadD[index]);
+
+    // Explicit active domain boxes (attached to bodies) replace the boxes around the FSI bodies and nodes
+    if (numBoxes > 0) {
+        Real3 ext = mR3(2 * RESOLUTION_LENGTH_MULT * paramsD.HSML);
+        for (uint num = 0; num < numBoxes; num++) {
+            Real3 detPos = posRadA - boxCenterD[num];
+            Real3 hdim = boxHalfDimD[num];
+            if (abs(detPos.x) > hdim.x || abs(detPos.y) > hdim.y || abs(detPos.z) > hdim.z)
+                isNotActive = isNotActive + 1;
+            if (abs(detPos.x) > hdim.x + ext.x || abs(detPos.y) > hdim.y + ext.y || abs(detPos.z) > hdim.z + ext.z)
+                isNotExtended = isNotExtended + 1;
+        }
+        if (isNotActive == numBoxes) {
+            activityIdentifierD[index] = 0;
+            velMasD[index] = mR3(0.0);
+        }
+        if (isNotExtended == numBoxes)
+            extendedActivityIdD[index] = 0;
+        return;
+    }
+
     for (uint num = 0; num < numRigidBodies; num++) {
         Real3 detPos = posRadA - posRigidBodiesD[num];
         if (abs(detPos.x) > Acdomain.x || abs(detPos.y) > Acdomain.y || 
@@ -646,7 +694,8 @@ void ChFluidDynamics::IntegrateSPH(std::shared_ptr<SphMarkerDataD> sphMarkersD2,
                                    std::shared_ptr<FsiBodiesDataD> fsiBodiesD,
                                    std::shared_ptr<FsiMeshDataD> fsiMeshD,
                                    Real dT,
-                                   Real Time) {
+                                   Real Time,
+                                   bool firstHalfStep) {
     if (GetIntegratorType() == TimeIntegrator::EXPLICITSPH) {
         this->UpdateActivity(sphMarkersD1, sphMarkersD2, fsiBodiesD, fsiMeshD, Time);
         forceSystem->ForceSPH(sphMarkersD2, fsiBodiesD, fsiMeshD);
@@ -656,7 +705,7 @@ void ChFluidDynamics::IntegrateSPH(std::shared_ptr<SphMarkerDataD> sphMarkersD2,
     if (integrator_type == TimeIntegrator::IISPH)
         this->UpdateFluid_Implicit(sphMarkersD2);
     else if (GetIntegratorType() == TimeIntegrator::EXPLICITSPH)
-        this->UpdateFluid(sphMarkersD1, dT);
+        this->UpdateFluid(firstHalfStep ? sphMarkersD2 : sphMarkersD1, sphMarkersD1, dT);
 
     this->ApplyBoundarySPH_Markers(sphMarkersD2);
 }
@@ -683,6 +732,7 @@ void ChFluidDynamics::UpdateActivity(std::shared_ptr<SphMarkerDataD> sphMarkersD
         mR4CAST(sphMarkersD2->posRadD), mR3CAST(sphMarkersD1->velMasD), 
         mR3CAST(fsiBodiesD->posRigid_fsiBodies_D),
         mR3CAST(fsiMeshD->pos_fsi_fea_D),
+        mR3CAST(activeBoxCenterD), mR3CAST(activeBoxHalfDimD), (uint)activeBoxCenterD.size(),
         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD), 
         U1CAST(fsiSystem.fsiGeneralData->extendedActivityIdD),
         updatePortion, Time, isErrorD);
@@ -697,11 +747,27 @@ void ChFluidDynamics::UpdateActivity(std::shared_ptr<SphMarkerDataD> sphMarkersD
     free(isErrorH);
 }
 
+void ChFluidDynamics::SetActiveBoxes(const thrust::host_vector<Real3>& centers,
+                                     const thrust::host_vector<Real3>& halfDims) {
+    activeBoxCenterD = centers;
+    activeBoxHalfDimD = halfDims;
+}
+
 // -----------------------------------------------------------------------------
 void ChFluidDynamics::UpdateFluid(std::shared_ptr<SphMarkerDataD> sphMarkersD, Real dT) {
+    UpdateFluid(sphMarkersD, sphMarkersD, dT);
+}
+
+void ChFluidDynamics::UpdateFluid(std::shared_ptr<SphMarkerDataD> sphMarkersD_in,
+                                  std::shared_ptr<SphMarkerDataD> sphMarkersD,
+                                  Real dT) {
     // Update portion of the SPH particles (should be fluid particles only here)
     int2 updatePortion = mI2(0, fsiSystem.fsiGeneralData->referenceArray[0].y);
 
+    // For an update into different arrays, all markers are processed (markers not updated are copied)
+    uint numMarkers = (uint)numObjectsH->numAllMarkers;
+    bool copy = (sphMarkersD != sphMarkersD_in);
+
     bool *isErrorH, *isErrorD;
     isErrorH = (bool*)malloc(sizeof(bool));
     cudaMalloc((void**)&isErrorD, sizeof(bool));
@@ -710,13 +776,18 @@ void ChFluidDynamics::UpdateFluid(std::shared_ptr<SphMarkerDataD> sphMarkersD, R
 
     //------------------------
     uint numBlocks, numThreads;
-    computeGridSize(updatePortion.y - updatePortion.x, 256, numBlocks, numThreads);
+    computeGridSize(copy ? numMarkers : updatePortion.y - updatePortion.x, 256, numBlocks, numThreads);
     UpdateFluidD<<<numBlocks, numThreads>>>(
         mR4CAST(sphMarkersD->posRadD), 
         mR3CAST(sphMarkersD->velMasD), 
         mR4CAST(sphMarkersD->rhoPresMuD), 
         mR3CAST(sphMarkersD->tauXxYyZzD), 
         mR3CAST(sphMarkersD->tauXyXzYzD), 
+        mR4CAST(sphMarkersD_in->posRadD), 
+        mR3CAST(sphMarkersD_in->velMasD), 
+        mR4CAST(sphMarkersD_in->rhoPresMuD), 
+        mR3CAST(sphMarkersD_in->tauXxYyZzD), 
+        mR3CAST(sphMarkersD_in->tauXyXzYzD), 
         mR3CAST(fsiSystem.fsiGeneralData->vel_XSPH_D), 
         mR4CAST(fsiSystem.fsiGeneralData->derivVelRhoD),
         mR3CAST(fsiSystem.fsiGeneralData->derivTauXxYyZzD), 
@@ -724,7 +795,7 @@ void ChFluidDynamics::UpdateFluid(std::shared_ptr<SphMarkerDataD> sphMarkersD, R
         mR4CAST(fsiSystem.fsiGeneralData->sr_tau_I_mu_i), 
         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD),
         U1CAST(fsiSystem.fsiGeneralData->freeSurfaceIdD), 
-        updatePortion, dT, isErrorD);
+        updatePortion, numMarkers, dT, isErrorD);
     cudaDeviceSynchronize();
     cudaCheckError();
     //------------------------
@@ -66,13 +66,17 @@ class ChFluidDynamics : public ChFsiGeneral {
     /// used to to update the particles position, velocity, and density in
     /// time, the latter is used to update the pressure from an equation of
     /// state. In the implicit scheme, the pressures are updated instead of density.
+    /// In the explicit scheme, the state in sphMarkersD1 is advanced in time with the forces evaluated at the state in
+    /// sphMarkersD2. For the first half step, the state in sphMarkersD1 is instead overwritten with the state in
+    /// sphMarkersD2 advanced in time (this avoids copying the marker arrays at the beginning of each step).
     void IntegrateSPH(
         std::shared_ptr<SphMarkerDataD> sphMarkersD2,  ///< Pointer SPH particle information at the second half step
         std::shared_ptr<SphMarkerDataD> sphMarkersD1,  ///< Pointer SPH particle information at the first half step
         std::shared_ptr<FsiBodiesDataD> fsiBodiesD,    ///< Pointer information of rigid bodies
         std::shared_ptr<FsiMeshDataD> fsiMeshD,        ///< Pointer information of flexible mesh
         Real dT,                                       ///< Simulation stepsize
-        Real Time                                      ///< Simulation time
+        Real Time,                                     ///< Simulation time
+        bool firstHalfStep = false                     ///< Update sphMarkersD1 from sphMarkersD2 (explicit only)
     );
 
     /// Function to Shepard Filtering.
@@ -91,6 +95,11 @@ class ChFluidDynamics : public ChFsiGeneral {
     /// Return the ChFsiForce type used in the simulation.
     std::shared_ptr<ChFsiForce> GetForceSystem() { return forceSystem; }
 
+    /// Set the current active domain boxes (axis-aligned, given by their centers and half-dimensions).
+    /// If at least one box is specified, only SPH particles within these boxes are active. Otherwise, the active domain
+    /// is defined by boxes of size paramsH->bodyActiveDomain around the FSI bodies and flexible nodes.
+    void SetActiveBoxes(const thrust::host_vector<Real3>& centers, const thrust::host_vector<Real3>& halfDims);
+
   protected:
     ChSystemFsi_impl& fsiSystem;              ///< FSI data; values are maintained externally
     std::shared_ptr<SimParams> paramsH;       ///< FSI parameters; values are mainained externally
@@ -100,6 +109,9 @@ class ChFluidDynamics : public ChFsiGeneral {
 
     bool verbose;
 
+    thrust::device_vector<Real3> activeBoxCenterD;   ///< centers of the active domain boxes
+    thrust::device_vector<Real3> activeBoxHalfDimD;  ///< half-dimensions of the active domain boxes
+
     /// Update activity of SPH particles.
     /// SPH particles which are in an active domain are set as active particles.
     /// For example, particles close to a rigid body.
@@ -113,6 +125,13 @@ class ChFluidDynamics : public ChFsiGeneral {
     /// In an explicit formulation, the function relies on the explicit integration scheme.
     void UpdateFluid(std::shared_ptr<SphMarkerDataD> sphMarkersD, Real dT);
 
+    /// Update SPH particles data, writing the updated state into different arrays.
+    /// The updated state is calculated from the state in sphMarkersD_in and written into sphMarkersD, in a single pass
+    /// over the marker arrays (markers that are not updated are copied).
+    void UpdateFluid(std::shared_ptr<SphMarkerDataD> sphMarkersD_in,
+                     std::shared_ptr<SphMarkerDataD> sphMarkersD,
+                     Real dT);
+
     /// Update SPH particles data.
     /// In an implicit formulation, the function relies on the implicit integration scheme.
     void UpdateFluid_Implicit(std::shared_ptr<SphMarkerDataD> sphMarkersD);
@@ -160,6 +160,9 @@ class ChFsiForce : public ChFsiGeneral {
     /// using the ISPH method (ChFsiForceI2SPH and ChFsiForceIISPH)
     void SetLinearSolver(SolverType type);
 
+    /// Return the linear solver used by the ISPH methods (null until set).
+    std::shared_ptr<ChFsiLinearSolver> GetLinearSolver() const { return myLinearSolver; }
+
   protected:
     std::shared_ptr<ChFsiLinearSolver> myLinearSolver;  ///< pointer to the linear solver type
 
@@ -12,6 +12,10 @@
 // Author: Arman Pazouki, Wei Hu
 // =============================================================================
 
+#include <algorithm>
+#include <utility>
+
+#include <thrust/binary_search.h>
 #include <thrust/extrema.h>
 #include <thrust/remove.h>
 #include <thrust/sort.h>
@@ -1191,6 +1195,8 @@ __global__ void NS_SSR(uint* activityIdentifierD,
                        uint* cellEnd,
                        uint* mapOriginalToSorted,
                        uint* sortedFreeSurfaceIdD,
+                       uint indexStart,
+                       uint indexEnd,
                        volatile bool* isErrorD) {
     uint id = blockIdx.x * blockDim.x + threadIdx.x;
     if (id >= numObjectsD.numAllMarkers)
@@ -1204,6 +1210,10 @@ __global__ void NS_SSR(uint* activityIdentifierD,
     // map original to sorted
     uint index = mapOriginalToSorted[id];
 
+    // only process the particles in the sorted range of this device (see ChFsiForceExplicitSPH::SetDevices)
+    if (index < indexStart || index >= indexEnd)
+        return;
+
     if (sortedRhoPreMu[index].w > -0.5 && sortedRhoPreMu[index].w < 0.5)
         return;
 
@@ -1584,6 +1594,55 @@ __global__ void CopySortedToOriginal_XSPH_D(Real3* sortedXSPH,
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
+// Data on a device other than the current one, for the multi-device evaluation of the forces on granular material.
+// The arrays indexed by sorted marker or by cell have full size, but only the ranges of the device slab and its halo
+// are copied at each step.
+struct ChFsiForceExplicitSPH::PeerData {
+    int device;
+    bool* isErrorD;
+
+    // Inputs
+    thrust::device_vector<uint> activityIdentifierD;
+    thrust::device_vector<uint> mapOriginalToSorted;
+    thrust::device_vector<uint> gridMarkerIndexD;
+    thrust::device_vector<uint> cellStartD;
+    thrust::device_vector<uint> cellEndD;
+    thrust::device_vector<Real4> posRadD;
+    thrust::device_vector<Real3> velMasD;
+    thrust::device_vector<Real4> rhoPresMuD;
+    thrust::device_vector<Real3> tauXxYyZzD;
+    thrust::device_vector<Real3> tauXyXzYzD;
+    thrust::device_vector<Real3> kernelSupport;
+    thrust::device_vector<Real3> velMas_ModifiedBCE;
+    thrust::device_vector<Real4> rhoPreMu_ModifiedBCE;
+    thrust::device_vector<Real3> tauXxYyZz_ModifiedBCE;
+    thrust::device_vector<Real3> tauXyXzYz_ModifiedBCE;
+
+    // Outputs
+    thrust::device_vector<Real4> derivVelRho;
+    thrust::device_vector<Real3> derivTauXxYyZz;
+    thrust::device_vector<Real3> derivTauXyXzYz;
+    thrust::device_vector<Real3> XSPHandShift;
+    thrust::device_vector<uint> freeSurfaceId;
+};
+
+// Copy the entries [start, end) of a device vector into a vector of the same size on another device.
+// Staged through the host if peer access is not available between the two devices.
+template <typename T>
+static void CopyRange(thrust::device_vector<T>& dst, const thrust::device_vector<T>& src, size_t start, size_t end) {
+    if (end <= start)
+        return;
+    cudaMemcpy(thrust::raw_pointer_cast(dst.data()) + start, thrust::raw_pointer_cast(src.data()) + start,
+               (end - start) * sizeof(T), cudaMemcpyDefault);
+}
+
+// Resize a device vector on the current device to the size of a vector on another device and copy all its entries.
+template <typename T>
+static void CopyAll(thrust::device_vector<T>& dst, const thrust::device_vector<T>& src) {
+    dst.resize(src.size());
+    CopyRange(dst, src, 0, src.size());
+}
+
 ChFsiForceExplicitSPH::ChFsiForceExplicitSPH(std::shared_ptr<ChBce> otherBceWorker,
                                              std::shared_ptr<SphMarkerDataD> otherSortedSphMarkersD,
                                              std::shared_ptr<ProximityDataD> otherMarkersProximityD,
@@ -1602,7 +1661,18 @@ ChFsiForceExplicitSPH::ChFsiForceExplicitSPH(std::shared_ptr<ChBce> otherBceWork
     density_initialization = 0;
 }
 
-ChFsiForceExplicitSPH::~ChFsiForceExplicitSPH() {}
+ChFsiForceExplicitSPH::~ChFsiForceExplicitSPH() {
+    if (m_peers.empty())
+        return;
+    int current;
+    cudaGetDevice(&current);
+    for (auto& peer : m_peers) {
+        cudaSetDevice(peer->device);
+        cudaFree(peer->isErrorD);
+        peer.reset();
+    }
+    cudaSetDevice(current);
+}
 
 //--------------------------------------------------------------------------------------------------------------------------------
 void ChFsiForceExplicitSPH::Initialize() {
@@ -1672,7 +1742,13 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
     density_initialization++;
 
     // Execute the kernel
-    if (paramsH->elastic_SPH) {  // For granular material
+    if (paramsH->elastic_SPH && !m_peers.empty()) {  // For granular material, on multiple devices
+        *isErrorH = false;
+        cudaMemcpy(isErrorD, isErrorH, sizeof(bool), cudaMemcpyHostToDevice);
+
+        MultiDevice_NS_SSR(sortedDerivVelRho, sortedDerivTauXxYyZz, sortedDerivTauXyXzYz, sortedKernelSupport,
+                           sortedFreeSurfaceId, isErrorH, isErrorD);
+    } else if (paramsH->elastic_SPH) {  // For granular material
         *isErrorH = false;
         cudaMemcpy(isErrorD, isErrorH, sizeof(bool), cudaMemcpyHostToDevice);
 
@@ -1687,7 +1763,7 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
             mR3CAST(sortedSphMarkersD->tauXxYyZzD), mR3CAST(sortedSphMarkersD->tauXyXzYzD),
             U1CAST(markersProximityD->gridMarkerIndexD), U1CAST(markersProximityD->cellStartD),
             U1CAST(markersProximityD->cellEndD), U1CAST(markersProximityD->mapOriginalToSorted),
-            U1CAST(sortedFreeSurfaceId), isErrorD);
+            U1CAST(sortedFreeSurfaceId), 0, (uint)numObjectsH->numAllMarkers, isErrorD);
         ChUtilsDevice::Sync_CheckError(isErrorH, isErrorD, "Navier_Stokes and Shear_Stress_Rate");
     } else {  // For fluid
         *isErrorH = false;
@@ -1729,6 +1805,221 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
     free(isErrorH);
 }
 
+//--------------------------------------------------------------------------------------------------------------------------------
+void ChFsiForceExplicitSPH::SetDevices(const std::vector<int>& devices) {
+    int current;
+    cudaGetDevice(&current);
+    if (devices.empty() || devices[0] != current)
+        throw std::runtime_error("ChFsiForceExplicitSPH::SetDevices - the first device must be the current device");
+
+    for (auto& peer : m_peers) {
+        cudaSetDevice(peer->device);
+        cudaFree(peer->isErrorD);
+        peer.reset();
+    }
+    m_peers.clear();
+
+    for (size_t k = 1; k < devices.size(); k++) {
+        // Enable direct copies between the current device and this device, where supported
+        int can_access = 0;
+        cudaDeviceCanAccessPeer(&can_access, devices[k], current);
+        if (can_access) {
+            cudaSetDevice(devices[k]);
+            cudaDeviceEnablePeerAccess(current, 0);
+            cudaSetDevice(current);
+            cudaDeviceEnablePeerAccess(devices[k], 0);
+            cudaGetLastError();  // clear cudaErrorPeerAccessAlreadyEnabled, if set
+        }
+
+        cudaSetDevice(devices[k]);
+        auto peer = std::unique_ptr<PeerData>(new PeerData);
+        peer->device = devices[k];
+        cudaMalloc((void**)&peer->isErrorD, sizeof(bool));
+        m_peers.push_back(std::move(peer));
+    }
+
+    cudaSetDevice(current);
+    cudaCheckError();
+}
+
+void ChFsiForceExplicitSPH::MultiDevice_NS_SSR(thrust::device_vector<Real4>& sortedDerivVelRho,
+                                               thrust::device_vector<Real3>& sortedDerivTauXxYyZz,
+                                               thrust::device_vector<Real3>& sortedDerivTauXyXzYz,
+                                               thrust::device_vector<Real3>& sortedKernelSupport,
+                                               thrust::device_vector<uint>& sortedFreeSurfaceId,
+                                               bool* isErrorH,
+                                               bool* isErrorD) {
+    int current;
+    cudaGetDevice(&current);
+
+    const uint numAllMarkers = (uint)numObjectsH->numAllMarkers;
+    const int3 gridSize = paramsH->gridSize;
+    const long numCells = (long)gridSize.x * gridSize.y * gridSize.z;
+    const size_t numDevices = m_peers.size() + 1;
+    const auto& gridMarkerHashD = markersProximityD->gridMarkerHashD;
+
+    // First sorted marker in a cell with index larger than or equal to the specified cell
+    auto markerStart = [&](long cell) -> uint {
+        if (cell >= numCells)
+            return numAllMarkers;
+        return (uint)(thrust::lower_bound(gridMarkerHashD.begin(), gridMarkerHashD.begin() + numAllMarkers,
+                                          (uint)cell) -
+                      gridMarkerHashD.begin());
+    };
+
+    // Split the sorted markers in slabs of cells (the cell index varies slowest along Z), with roughly the same number
+    // of markers, one per device. The markers are sorted by cell index, so each slab is a contiguous range of markers.
+    std::vector<long> slabCell(numDevices + 1);
+    std::vector<uint> slabMarker(numDevices + 1);
+    slabCell[0] = 0;
+    slabMarker[0] = 0;
+    for (size_t k = 1; k < numDevices; k++) {
+        uint m = (uint)((size_t)numAllMarkers * k / numDevices);
+        long cell = (m < numAllMarkers) ? (long)(uint)gridMarkerHashD[m] : numCells;
+        slabCell[k] = std::max(cell, slabCell[k - 1]);
+        slabMarker[k] = markerStart(slabCell[k]);
+    }
+    slabCell[numDevices] = numCells;
+    slabMarker[numDevices] = numAllMarkers;
+
+    // The neighbor search examines the cells with a 3x3x3 stencil, wrapping around the grid
+    const long band = (long)gridSize.x * gridSize.y + gridSize.x + 1;
+
+    // Parameters of the current device, for the kernels on the other devices
+    SimParams params;
+    ChCounters counters;
+    cudaMemcpyFromSymbol(&params, paramsD, sizeof(SimParams));
+    cudaMemcpyFromSymbol(&counters, numObjectsD, sizeof(ChCounters));
+
+    uint numBlocks, numThreads;
+    computeGridSize((int)numAllMarkers, 256, numBlocks, numThreads);
+
+    // Copy the slab and halo data to each of the other devices and launch the kernel on the markers of its slab
+    for (size_t k = 1; k < numDevices; k++) {
+        auto& peer = *m_peers[k - 1];
+        if (slabMarker[k] == slabMarker[k + 1])
+            continue;
+
+        cudaSetDevice(peer.device);
+        cudaMemcpyToSymbol(paramsD, &params, sizeof(SimParams));
+        cudaMemcpyToSymbol(numObjectsD, &counters, sizeof(ChCounters));
+
+        peer.gridMarkerIndexD.resize(numAllMarkers);
+        peer.cellStartD.resize(numCells);
+        peer.cellEndD.resize(numCells);
+        peer.posRadD.resize(numAllMarkers);
+        peer.velMasD.resize(numAllMarkers);
+        peer.rhoPresMuD.resize(numAllMarkers);
+        peer.tauXxYyZzD.resize(numAllMarkers);
+        peer.tauXyXzYzD.resize(numAllMarkers);
+        peer.kernelSupport.resize(numAllMarkers);
+        peer.derivVelRho.resize(numAllMarkers);
+        peer.derivTauXxYyZz.resize(numAllMarkers);
+        peer.derivTauXyXzYz.resize(numAllMarkers);
+        peer.XSPHandShift.resize(numAllMarkers);
+        peer.freeSurfaceId.resize(numAllMarkers);
+
+        // Data indexed by original marker (or BCE marker) is copied in full
+        CopyAll(peer.activityIdentifierD, fsiGeneralData->activityIdentifierD);
+        CopyAll(peer.mapOriginalToSorted, markersProximityD->mapOriginalToSorted);
+        CopyAll(peer.velMas_ModifiedBCE, bceWorker->velMas_ModifiedBCE);
+        CopyAll(peer.rhoPreMu_ModifiedBCE, bceWorker->rhoPreMu_ModifiedBCE);
+        CopyAll(peer.tauXxYyZz_ModifiedBCE, bceWorker->tauXxYyZz_ModifiedBCE);
+        CopyAll(peer.tauXyXzYz_ModifiedBCE, bceWorker->tauXyXzYz_ModifiedBCE);
+
+        // Cells of the slab and of its halo, as at most three ranges within the grid
+        std::vector<std::pair<long, long>> cells;
+        long lo = slabCell[k] - band;
+        long hi = slabCell[k + 1] + band;
+        if (hi - lo >= numCells) {
+            cells.push_back({0, numCells});
+        } else {
+            if (lo < 0) {
+                cells.push_back({lo + numCells, numCells});
+                lo = 0;
+            }
+            if (hi > numCells) {
+                cells.push_back({0, hi - numCells});
+                hi = numCells;
+            }
+            cells.push_back({lo, hi});
+        }
+
+        cudaSetDevice(current);
+        std::vector<std::pair<uint, uint>> markers;
+        for (const auto& c : cells)
+            markers.push_back({markerStart(c.first), markerStart(c.second)});
+        cudaSetDevice(peer.device);
+
+        for (size_t i = 0; i < cells.size(); i++) {
+            CopyRange(peer.cellStartD, markersProximityD->cellStartD, cells[i].first, cells[i].second);
+            CopyRange(peer.cellEndD, markersProximityD->cellEndD, cells[i].first, cells[i].second);
+
+            uint start = markers[i].first;
+            uint end = markers[i].second;
+            CopyRange(peer.gridMarkerIndexD, markersProximityD->gridMarkerIndexD, start, end);
+            CopyRange(peer.posRadD, sortedSphMarkersD->posRadD, start, end);
+            CopyRange(peer.velMasD, sortedSphMarkersD->velMasD, start, end);
+            CopyRange(peer.rhoPresMuD, sortedSphMarkersD->rhoPresMuD, start, end);
+            CopyRange(peer.tauXxYyZzD, sortedSphMarkersD->tauXxYyZzD, start, end);
+            CopyRange(peer.tauXyXzYzD, sortedSphMarkersD->tauXyXzYzD, start, end);
+            CopyRange(peer.kernelSupport, sortedKernelSupport, start, end);
+        }
+
+        // Outputs of the slab markers start from the same values as on the current device
+        CopyRange(peer.derivVelRho, sortedDerivVelRho, slabMarker[k], slabMarker[k + 1]);
+        CopyRange(peer.derivTauXxYyZz, sortedDerivTauXxYyZz, slabMarker[k], slabMarker[k + 1]);
+        CopyRange(peer.derivTauXyXzYz, sortedDerivTauXyXzYz, slabMarker[k], slabMarker[k + 1]);
+        CopyRange(peer.XSPHandShift, sortedXSPHandShift, slabMarker[k], slabMarker[k + 1]);
+        CopyRange(peer.freeSurfaceId, sortedFreeSurfaceId, slabMarker[k], slabMarker[k + 1]);
+
+        cudaMemcpy(peer.isErrorD, isErrorH, sizeof(bool), cudaMemcpyHostToDevice);
+
+        NS_SSR<<<numBlocks, numThreads>>>(
+            U1CAST(peer.activityIdentifierD), mR4CAST(peer.derivVelRho), mR3CAST(peer.derivTauXxYyZz),
+            mR3CAST(peer.derivTauXyXzYz), mR3CAST(peer.XSPHandShift), mR3CAST(peer.kernelSupport),
+            mR4CAST(peer.posRadD), mR3CAST(peer.velMasD), mR4CAST(peer.rhoPresMuD), mR3CAST(peer.velMas_ModifiedBCE),
+            mR4CAST(peer.rhoPreMu_ModifiedBCE), mR3CAST(peer.tauXxYyZz_ModifiedBCE),
+            mR3CAST(peer.tauXyXzYz_ModifiedBCE), mR3CAST(peer.tauXxYyZzD), mR3CAST(peer.tauXyXzYzD),
+            U1CAST(peer.gridMarkerIndexD), U1CAST(peer.cellStartD), U1CAST(peer.cellEndD),
+            U1CAST(peer.mapOriginalToSorted), U1CAST(peer.freeSurfaceId), slabMarker[k], slabMarker[k + 1],
+            peer.isErrorD);
+    }
+
+    // Launch the kernel on the markers of the first slab on the current device, concurrently with the other devices
+    cudaSetDevice(current);
+    NS_SSR<<<numBlocks, numThreads>>>(
+        U1CAST(fsiGeneralData->activityIdentifierD), mR4CAST(sortedDerivVelRho), mR3CAST(sortedDerivTauXxYyZz),
+        mR3CAST(sortedDerivTauXyXzYz), mR3CAST(sortedXSPHandShift), mR3CAST(sortedKernelSupport),
+        mR4CAST(sortedSphMarkersD->posRadD), mR3CAST(sortedSphMarkersD->velMasD),
+        mR4CAST(sortedSphMarkersD->rhoPresMuD), mR3CAST(bceWorker->velMas_ModifiedBCE),
+        mR4CAST(bceWorker->rhoPreMu_ModifiedBCE), mR3CAST(bceWorker->tauXxYyZz_ModifiedBCE),
+        mR3CAST(bceWorker->tauXyXzYz_ModifiedBCE), mR3CAST(sortedSphMarkersD->tauXxYyZzD),
+        mR3CAST(sortedSphMarkersD->tauXyXzYzD), U1CAST(markersProximityD->gridMarkerIndexD),
+        U1CAST(markersProximityD->cellStartD), U1CAST(markersProximityD->cellEndD),
+        U1CAST(markersProximityD->mapOriginalToSorted), U1CAST(sortedFreeSurfaceId), slabMarker[0], slabMarker[1],
+        isErrorD);
+
+    // Collect the results of the other devices
+    for (size_t k = 1; k < numDevices; k++) {
+        auto& peer = *m_peers[k - 1];
+        if (slabMarker[k] == slabMarker[k + 1])
+            continue;
+
+        cudaSetDevice(peer.device);
+        ChUtilsDevice::Sync_CheckError(isErrorH, peer.isErrorD, "Navier_Stokes and Shear_Stress_Rate");
+
+        CopyRange(sortedDerivVelRho, peer.derivVelRho, slabMarker[k], slabMarker[k + 1]);
+        CopyRange(sortedDerivTauXxYyZz, peer.derivTauXxYyZz, slabMarker[k], slabMarker[k + 1]);
+        CopyRange(sortedDerivTauXyXzYz, peer.derivTauXyXzYz, slabMarker[k], slabMarker[k + 1]);
+        CopyRange(sortedXSPHandShift, peer.XSPHandShift, slabMarker[k], slabMarker[k + 1]);
+        CopyRange(sortedFreeSurfaceId, peer.freeSurfaceId, slabMarker[k], slabMarker[k + 1]);
+    }
+
+    cudaSetDevice(current);
+    ChUtilsDevice::Sync_CheckError(isErrorH, isErrorD, "Navier_Stokes and Shear_Stress_Rate");
+}
+
 //--------------------------------------------------------------------------------------------------------------------------------
 void ChFsiForceExplicitSPH::CalculateXSPH_velocity() {
     // Calculate vel_XSPH
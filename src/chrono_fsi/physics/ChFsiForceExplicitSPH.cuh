@@ -15,6 +15,9 @@
 #ifndef CH_FSI_FORCE_EXPLICITSPH_H_
 #define CH_FSI_FORCE_EXPLICITSPH_H_
 
+#include <memory>
+#include <vector>
+
 #include "chrono_fsi/ChApiFsi.h"
 #include "chrono_fsi/physics/ChFsiForce.cuh"
 
@@ -45,10 +48,22 @@ class ChFsiForceExplicitSPH : public ChFsiForce {
 
     void Initialize() override;
 
+    /// Distribute the force calculation for granular material (elastic SPH) over the specified CUDA devices.
+    /// The first device must be the current device, on which all system data resides. The sorted markers are split in
+    /// slabs of grid cells (along Z, the slowest-varying cell index), one per device, with roughly the same number of
+    /// markers. At each step, the markers in the cells of each slab and of its halo (the neighboring cells, including
+    /// BCE markers of boundaries and of rigid and flexible bodies) are copied to the corresponding device, and the
+    /// force derivatives of the slab markers are copied back to the first device.
+    void SetDevices(const std::vector<int>& devices);
+
   private:
+    struct PeerData;
+
     int density_initialization;
     thrust::device_vector<Real3> sortedXSPHandShift;
 
+    std::vector<std::unique_ptr<PeerData>> m_peers;  ///< data on the devices other than the current one
+
     /// Function to find neighbor particles and calculate the interactions between SPH particles
     void ForceSPH(std::shared_ptr<SphMarkerDataD> otherSphMarkersD,
                   std::shared_ptr<FsiBodiesDataD> otherFsiBodiesD,
@@ -64,6 +79,15 @@ class ChFsiForceExplicitSPH : public ChFsiForce {
     /// The latter is needed later for position update.
     void CollideWrapper();
 
+    /// Evaluate the forces for granular material on all devices (see SetDevices).
+    void MultiDevice_NS_SSR(thrust::device_vector<Real4>& sortedDerivVelRho,
+                            thrust::device_vector<Real3>& sortedDerivTauXxYyZz,
+                            thrust::device_vector<Real3>& sortedDerivTauXyXzYz,
+                            thrust::device_vector<Real3>& sortedKernelSupport,
+                            thrust::device_vector<uint>& sortedFreeSurfaceId,
+                            bool* isErrorH,
+                            bool* isErrorD);
+
     /// Function to add gravity force (acceleration) to other forces on SPH  particles.
     void AddGravityToFluid();
 };
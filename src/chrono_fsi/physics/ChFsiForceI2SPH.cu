@@ -39,6 +39,11 @@ struct my_Functor_real4y {
     my_Functor_real4y(Real s) { ave = s; }
     __host__ __device__ void operator()(Real4& i) { i.y -= ave; }
 };
+struct my_Functor_scaled_real4y {
+    Real scale;
+    my_Functor_scaled_real4y(Real s) { scale = s; }
+    __host__ __device__ Real operator()(const Real4& i) const { return i.y * scale; }
+};
 
 __global__ void Viscosity_correction(Real4* sortedPosRad,  // input: sorted positions
                                      Real3* sortedVelMas,
@@ -1079,7 +1084,14 @@ void ChFsiForceI2SPH::ForceSPH(std::shared_ptr<SphMarkerDataD> otherSphMarkersD,
     thrust::fill(AMatrix.begin(), AMatrix.end(), 0.0);
     thrust::fill(b1Vector.begin(), b1Vector.end(), 0.0);
     thrust::fill(q_old.begin(), q_old.end(), paramsH->Pressure_Constraint * paramsH->BASEPRES);
-    thrust::fill(q_new.begin(), q_new.end(), paramsH->Pressure_Constraint * paramsH->BASEPRES);
+    if (paramsH->USE_LinearSolver && paramsH->LinearSolver_WarmStart && paramsH->USE_NonIncrementalProjection) {
+        // start the Krylov solver from the pressure at the previous step, which is close to the solution for
+        // slowly-varying flows; in incremental mode q is a pressure increment and the zero guess is kept
+        thrust::transform(sortedSphMarkersD->rhoPresMuD.begin(), sortedSphMarkersD->rhoPresMuD.end(), q_new.begin(),
+                          my_Functor_scaled_real4y(TIME_SCALE));
+    } else {
+        thrust::fill(q_new.begin(), q_new.end(), paramsH->Pressure_Constraint * paramsH->BASEPRES);
+    }
 
     Pressure_Equation<<<numBlocks, numThreads>>>(
         mR4CAST(sortedSphMarkersD->posRadD), mR3CAST(sortedSphMarkersD->velMasD),
@@ -1134,6 +1146,7 @@ void ChFsiForceI2SPH::ForceSPH(std::shared_ptr<SphMarkerDataD> otherSphMarkersD,
         myLinearSolver->SetAbsRes(paramsH->LinearSolver_Abs_Tol);
         myLinearSolver->SetRelRes(paramsH->LinearSolver_Rel_Tol);
         myLinearSolver->SetIterationLimit(paramsH->LinearSolver_Max_Iter);
+        myLinearSolver->SetPreconditioner(paramsH->LinearSolver_Precond, paramsH->LinearSolver_Precond_Degree);
 
         if (paramsH->PPE_Solution_type != PPESolutionType::FORM_SPARSE_MATRIX) {
             printf(
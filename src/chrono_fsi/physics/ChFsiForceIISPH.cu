@@ -1528,6 +1528,7 @@ void ChFsiForceIISPH::calcPressureIISPH(std::shared_ptr<FsiBodiesDataD> otherFsi
     myLinearSolver->SetAbsRes(paramsH->LinearSolver_Abs_Tol);
     myLinearSolver->SetRelRes(paramsH->LinearSolver_Rel_Tol);
     myLinearSolver->SetIterationLimit(paramsH->LinearSolver_Max_Iter);
+    myLinearSolver->SetPreconditioner(paramsH->LinearSolver_Precond, paramsH->LinearSolver_Precond_Degree);
 
     if (paramsH->USE_LinearSolver) {
         if (paramsH->PPE_Solution_type != PPESolutionType::FORM_SPARSE_MATRIX) {
@@ -15,6 +15,8 @@
 // Base class for processing the interface between Chrono and fsi modules
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono_fsi/physics/ChFsiInterface.h"
 #include "chrono_fsi/utils/ChUtilsDevice.cuh"
 #include "chrono_fsi/utils/ChUtilsTypeConvert.h"
@@ -70,28 +72,35 @@ void ChFsiInterface::Copy_FsiBodies_ChSystem_to_FsiSystem(std::shared_ptr<FsiBod
 //-----------------------Chrono FEA Specifics-----------------------------------------
 
 void ChFsiInterface::Add_Flex_Forces_To_ChSystem() {
-    size_t num_nodes = m_fsi_nodes.size();
+    auto& fsiMeshH = *m_sysFSI.fsiMeshH;
+    size_t num_nodes = std::min(m_fsi_nodes.size(), fsiMeshH.size());
 
-    thrust::host_vector<Real3> forcesH = m_sysFSI.fsiGeneralData->Flex_FSI_ForcesD;
+    // Copy the nodal forces into the pinned host buffer and wait for the transfer
+    fsiMeshH.CopyForcesFromD(m_sysFSI.fsiGeneralData->Flex_FSI_ForcesD);
+    fsiMeshH.Synchronize();
 
-    for (size_t i = 0; i < num_nodes; i++) {
-        ChVector3d force = utils::ToChVector(forcesH[i]);
-        auto node = std::dynamic_pointer_cast<fea::ChNodeFEAxyzD>(m_fsi_mesh->GetNode((unsigned int)i));
-        node->SetForce(force);
-    }
+    // The FSI nodes are the mesh nodes, in the same order
+    for (size_t i = 0; i < num_nodes; i++)
+        m_fsi_nodes[i]->SetForce(utils::ToChVector(fsiMeshH.force_fsi_fea_H[i]));
 }
 
 void ChFsiInterface::Copy_FsiNodes_ChSystem_to_FsiSystem(std::shared_ptr<FsiMeshDataD> FsiMeshD) {
-    size_t num_nodes = m_fsi_nodes.size();
+    auto& fsiMeshH = *m_sysFSI.fsiMeshH;
+    size_t num_nodes = std::min(m_fsi_nodes.size(), fsiMeshH.size());
+
+    // Do not overwrite the pinned buffer while a previous transfer is pending
+    fsiMeshH.Synchronize();
 
+    // Pack the node states in the pinned host buffer, then transfer and unpack them in one go
     for (size_t i = 0; i < num_nodes; i++) {
         const auto& node = m_fsi_nodes[i];
-        m_sysFSI.fsiMeshH->pos_fsi_fea_H[i] = utils::ToReal3(node->GetPos());
-        m_sysFSI.fsiMeshH->vel_fsi_fea_H[i] = utils::ToReal3(node->GetPosDt());
-        m_sysFSI.fsiMeshH->acc_fsi_fea_H[i] = utils::ToReal3(node->GetPosDt2());
-        m_sysFSI.fsiMeshH->dir_fsi_fea_H[i] = utils::ToReal3(node->GetSlope1());
+        Real3* state = fsiMeshH.state(i);
+        state[0] = utils::ToReal3(node->GetPos());
+        state[1] = utils::ToReal3(node->GetPosDt());
+        state[2] = utils::ToReal3(node->GetPosDt2());
+        state[3] = utils::ToReal3(node->GetSlope1());
     }
-    FsiMeshD->CopyFromH(*m_sysFSI.fsiMeshH);
+    FsiMeshD->CopyFromH(fsiMeshH);
 }
 
 void ChFsiInterface::ResizeChronoCablesData(const std::vector<std::vector<int>>& CableElementsNodesSTDVector) {
@@ -135,6 +135,10 @@ struct SimParams {
                         /// in getting more accurate incompressible fluid, but more stable solution is obtained for
                         /// larger densityReinit
 
+    Real neighborSkin;  ///< Skin added to the neighbor search radius. Neighbor search data (marker sorting and cell
+                        ///< lists) is rebuilt only when a marker moved more than half the skin since the last search.
+                        ///< A value of 0 (default) performs a neighbor search at every step.
+
     int contactBoundary;  ///< 0: straight channel, 1: serpentine
 
     BceVersion bceType;      ///< Type of boundary conditions, ADAMI or ORIGINAL
@@ -163,6 +167,10 @@ struct SimParams {
     int LinearSolver_Max_Iter;  ///< Linear Solver maximum number of iteration
     bool Verbose_monitoring;    ///< Poisson Pressure Equation Absolute residual
 
+    PreconditionerType LinearSolver_Precond;  ///< Preconditioner of the linear solver
+    int LinearSolver_Precond_Degree;          ///< Degree of the Chebyshev preconditioner polynomial
+    bool LinearSolver_WarmStart;              ///< Start the linear solver from the pressure at the previous step
+
     Real Max_Pressure;                  ///< Max Pressure in the pressure solver
     PPESolutionType PPE_Solution_type;  ///< MATRIX_FREE, FORM_SPARSE_MATRIX see Rakhsha et al. 2018 paper for details
                                         ///< omega relaxation in the pressure equation, something less than 0.5 is
@@ -47,16 +47,19 @@ void CopyParams_NumberOfObjects(std::shared_ptr<SimParams> paramsH, std::shared_
 
 // 3D kernel function
 //--------------------------------------------------------------------------------------------------------------------------------
-// Cubic Spline SPH kernel function
+// Cubic Spline SPH kernel function (evaluated with KernelReal precision)
 __device__ inline Real W3h_Spline(Real d, Real h) {  // d is positive. h is the sph kernel length (i.e. h in
                                                      // the document) d is the distance of 2 particles
-    Real invh = paramsD.INVHSML;
-    Real q = fabs(d) * invh;
+    KernelReal invh = (KernelReal)paramsD.INVHSML;
+    KernelReal q = fabs((KernelReal)d) * invh;
+    KernelReal coeff = 0.25f * INVPI * invh * invh * invh;
+    KernelReal a = 2 - q;
+    KernelReal b = 1 - q;
     if (q < 1) {
-        return (0.25f * (INVPI * cube(invh)) * (cube(2 - q) - 4 * cube(1 - q)));
+        return (Real)(coeff * (a * a * a - 4 * b * b * b));
     }
     if (q < 2) {
-        return (0.25f * (INVPI * cube(invh)) * cube(2 - q));
+        return (Real)(coeff * a * a * a);
     }
     return 0;
 }
@@ -92,16 +95,21 @@ __device__ inline Real W3h_Quintic(Real d, Real h) {  // d is positive. h is the
 
 // Gradient of the kernel function
 //--------------------------------------------------------------------------------------------------------------------------------
-// Gradient of Cubic Spline SPH kernel function
+// Gradient of Cubic Spline SPH kernel function (evaluated with KernelReal precision)
 __device__ inline Real3 GradWh_Spline(Real3 d, Real h) {  // d is positive. r is the sph kernel length (i.e. h
                                                           // in the document) d is the distance of 2 particles
-    Real invh = paramsD.INVHSML;
-    Real q = length(d) * invh;
-    if (abs(q) < EPSILON)
+    KernelReal invh = (KernelReal)paramsD.INVHSML;
+    KernelReal dx = (KernelReal)d.x;
+    KernelReal dy = (KernelReal)d.y;
+    KernelReal dz = (KernelReal)d.z;
+    KernelReal q = sqrt(dx * dx + dy * dy + dz * dz) * invh;
+    if (abs(q) < (KernelReal)EPSILON)
         return mR3(0.0);
     bool less1 = (q < 1);
     bool less2 = (q < 2);
-    return (less1 * (3 * q - 4.0f) + less2 * (!less1) * (-q + 4.0f - 4.0f / q)) * .75f * INVPI * quintic(invh) * d;
+    KernelReal invh5 = invh * invh * invh * invh * invh;
+    KernelReal f = (less1 * (3 * q - 4.0f) + less2 * (!less1) * (-q + 4.0f - 4.0f / q)) * .75f * INVPI * invh5;
+    return (Real)f * d;
 }
 //--------------------------------------------------------------------------------------------------------------------------------
 // Gradient of Johnson kernel 1996b
@@ -17,6 +17,8 @@
 //
 // =============================================================================
 
+#include <cstring>
+
 #include <thrust/copy.h>
 #include <thrust/gather.h>
 #include <thrust/for_each.h>
@@ -112,17 +114,49 @@ void FsiShellsDataD::resize(size_t s) {
     accFlex_fsiBodies_nC_D.resize(s);
     accFlex_fsiBodies_nD_D.resize(s);
 }
+FsiMeshDataH::FsiMeshDataH() : state_fsi_fea_H(nullptr), force_fsi_fea_H(nullptr), num_nodes(0) {
+    cudaEventCreateWithFlags(&copy_event, cudaEventDisableTiming);
+}
+FsiMeshDataH::~FsiMeshDataH() {
+    Synchronize();
+    cudaFreeHost(state_fsi_fea_H);
+    cudaFreeHost(force_fsi_fea_H);
+    cudaEventDestroy(copy_event);
+}
 void FsiMeshDataH::resize(size_t s) {
-    pos_fsi_fea_H.resize(s);
-    vel_fsi_fea_H.resize(s);
-    acc_fsi_fea_H.resize(s);
-    dir_fsi_fea_H.resize(s);
+    if (s == num_nodes)
+        return;
+    Synchronize();
+    cudaFreeHost(state_fsi_fea_H);
+    cudaFreeHost(force_fsi_fea_H);
+    state_fsi_fea_H = nullptr;
+    force_fsi_fea_H = nullptr;
+    if (s > 0) {
+        cudaMallocHost(&state_fsi_fea_H, 4 * s * sizeof(Real3));
+        cudaMallocHost(&force_fsi_fea_H, s * sizeof(Real3));
+        cudaCheckError();
+        memset(state_fsi_fea_H, 0, 4 * s * sizeof(Real3));
+        memset(force_fsi_fea_H, 0, s * sizeof(Real3));
+    }
+    num_nodes = s;
+}
+void FsiMeshDataH::Synchronize() {
+    cudaEventSynchronize(copy_event);
+}
+void FsiMeshDataH::CopyForcesFromD(const thrust::device_vector<Real3>& forcesD) {
+    if (num_nodes == 0)
+        return;
+    cudaMemcpyAsync(force_fsi_fea_H, thrust::raw_pointer_cast(forcesD.data()), num_nodes * sizeof(Real3),
+                    cudaMemcpyDeviceToHost);
+    cudaEventRecord(copy_event);
+    cudaCheckError();
 }
 void FsiMeshDataD::resize(size_t s) {
     pos_fsi_fea_D.resize(s);
     vel_fsi_fea_D.resize(s);
     acc_fsi_fea_D.resize(s);
     dir_fsi_fea_D.resize(s);
+    state_fsi_fea_D.resize(4 * s);
 }
 
 void FsiBodiesDataD::CopyFromH(const FsiBodiesDataH& other) {
@@ -166,11 +200,33 @@ void FsiShellsDataD::CopyFromH(const FsiShellsDataH& other) {
                  accFlex_fsiBodies_nD_D.begin());
 }
 
+// Unpack the node states (pos, vel, acc, dir) transferred from the host
+__global__ void UnpackFsiMeshStateD(const Real3* state, Real3* pos, Real3* vel, Real3* acc, Real3* dir, uint numNodes) {
+    uint i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= numNodes)
+        return;
+    pos[i] = state[4 * i + 0];
+    vel[i] = state[4 * i + 1];
+    acc[i] = state[4 * i + 2];
+    dir[i] = state[4 * i + 3];
+}
+
 void FsiMeshDataD::CopyFromH(const FsiMeshDataH& other) {
-    thrust::copy(other.pos_fsi_fea_H.begin(), other.pos_fsi_fea_H.end(), pos_fsi_fea_D.begin());
-    thrust::copy(other.vel_fsi_fea_H.begin(), other.vel_fsi_fea_H.end(), vel_fsi_fea_D.begin());
-    thrust::copy(other.acc_fsi_fea_H.begin(), other.acc_fsi_fea_H.end(), acc_fsi_fea_D.begin());
-    thrust::copy(other.dir_fsi_fea_H.begin(), other.dir_fsi_fea_H.end(), dir_fsi_fea_D.begin());
+    uint numNodes = (uint)other.num_nodes;
+    if (numNodes == 0)
+        return;
+
+    // Single transfer from the pinned buffer; the unpacking kernel is ordered after it on the same stream
+    cudaMemcpyAsync(thrust::raw_pointer_cast(state_fsi_fea_D.data()), other.state_fsi_fea_H,
+                    4 * numNodes * sizeof(Real3), cudaMemcpyHostToDevice);
+    cudaEventRecord(other.copy_event);
+
+    uint nThreads = 256;
+    uint nBlocks = (numNodes + nThreads - 1) / nThreads;
+    UnpackFsiMeshStateD<<<nBlocks, nThreads>>>(mR3CAST(state_fsi_fea_D), mR3CAST(pos_fsi_fea_D),
+                                               mR3CAST(vel_fsi_fea_D), mR3CAST(acc_fsi_fea_D),
+                                               mR3CAST(dir_fsi_fea_D), numNodes);
+    cudaCheckError();
 }
 
 FsiBodiesDataD& FsiBodiesDataD::operator=(const FsiBodiesDataD& other) {
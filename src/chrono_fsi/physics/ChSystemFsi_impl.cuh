@@ -123,16 +123,32 @@ struct FsiBodiesDataD {
     void resize(size_t s);
 };
 
-/// Struct to store the information of mesh on the host
+/// Struct to store the information of mesh on the host.
+/// Node states are packed in a single pinned buffer, so that they can be transferred to the device in one asynchronous
+/// copy (see FsiMeshDataD::CopyFromH).
 struct FsiMeshDataH {
-    thrust::host_vector<Real3> pos_fsi_fea_H;  ///< Vector of the mesh position
-    thrust::host_vector<Real3> vel_fsi_fea_H;  ///< Vector of the mesh velocity
-    thrust::host_vector<Real3> acc_fsi_fea_H;  ///< Vector of the mesh acceleration
-    thrust::host_vector<Real3> dir_fsi_fea_H;  ///< Vector of the mesh direction
+    Real3* state_fsi_fea_H;  ///< Pinned buffer of node states, packed as (pos, vel, acc, dir) for each node
+    Real3* force_fsi_fea_H;  ///< Pinned buffer of the FSI forces on nodes
+    size_t num_nodes;        ///< Number of nodes
+    cudaEvent_t copy_event;  ///< Recorded after the last transfer using the pinned buffers
+
+    FsiMeshDataH();
+    ~FsiMeshDataH();
+    FsiMeshDataH(const FsiMeshDataH&) = delete;
+    FsiMeshDataH& operator=(const FsiMeshDataH&) = delete;
+
+    /// Access the packed state of the specified node.
+    Real3* state(size_t i) { return state_fsi_fea_H + 4 * i; }
+
+    /// Wait for completion of the last transfer using the pinned buffers.
+    /// Must be called before overwriting the node states or reading the FSI forces.
+    void Synchronize();
+
+    /// Start an asynchronous copy of the FSI forces on nodes from the device into the pinned buffer.
+    void CopyForcesFromD(const thrust::device_vector<Real3>& forcesD);
 
-    // zipIterFlexH iterator();
     void resize(size_t s);
-    size_t size() { return pos_fsi_fea_H.size(); };
+    size_t size() { return num_nodes; };
 };
 
 /// Struct to store the information of mesh on the device
@@ -142,7 +158,11 @@ struct FsiMeshDataD {
     thrust::device_vector<Real3> acc_fsi_fea_D;  ///< Vector of the mesh acceleration
     thrust::device_vector<Real3> dir_fsi_fea_D;  ///< Vector of the mesh direction
 
+    thrust::device_vector<Real3> state_fsi_fea_D;  ///< Staging buffer for the packed node states
+
     // zipIterFlexD iterator();
+
+    /// Transfer the packed node states from the host in one asynchronous copy and unpack them on the device.
     void CopyFromH(const FsiMeshDataH& other);
     FsiMeshDataD& operator=(const FsiMeshDataD& other);
     void resize(size_t s);
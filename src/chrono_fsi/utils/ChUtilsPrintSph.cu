@@ -361,29 +361,27 @@ void PrintFsiInfoToFile(const thrust::device_vector<Real3>& posRigidD,
 
 }
 
-void WriteCsvParticlesToFile(thrust::device_vector<Real4>& posRadD,
-                             thrust::device_vector<Real3>& velMasD,
-                             thrust::device_vector<Real4>& rhoPresMuD,
-                             thrust::host_vector<int4>& referenceArray,
-                             const std::string& outfilename) {
-    thrust::host_vector<Real4> posRadH = posRadD;
-    thrust::host_vector<Real3> velMasH = velMasD;
-    thrust::host_vector<Real4> rhoPresMuH = rhoPresMuD;
-    double eps = 1e-20;
-
-    // ======================================================
-
+// Range of fluid markers in the marker arrays
+static int2 FluidMarkerRange(const thrust::host_vector<int4>& referenceArray) {
     bool haveHelper = (referenceArray[0].z == -3) ? true : false;
     bool haveGhost = (referenceArray[0].z == -2 || referenceArray[1].z == -2) ? true : false;
+    return make_int2(referenceArray[haveHelper + haveGhost].x, referenceArray[haveHelper + haveGhost].y);
+}
 
-    // ======================================================
+// Write the given fluid markers (host arrays) to a CSV file
+static void WriteCsvFluidMarkers(const Real4* posRadH,
+                                 const Real3* velMasH,
+                                 const Real4* rhoPresMuH,
+                                 size_t numMarkers,
+                                 const std::string& outfilename) {
+    double eps = 1e-20;
 
     std::ofstream fileNameFluidParticles;
     fileNameFluidParticles.open(outfilename);
     std::stringstream ssFluidParticles;
     ssFluidParticles << "x,y,z,v_x,v_y,v_z,|U|,rho,pressure\n";
 
-    for (size_t i = referenceArray[haveHelper + haveGhost].x; i < referenceArray[haveHelper + haveGhost].y; i++) {
+    for (size_t i = 0; i < numMarkers; i++) {
         Real4 rP = rhoPresMuH[i];
         if (rP.w != -1)
             continue;
@@ -399,30 +397,117 @@ void WriteCsvParticlesToFile(thrust::device_vector<Real4>& posRadD,
     fileNameFluidParticles.close();
 }
 
-void WriteChPFParticlesToFile(thrust::device_vector<Real4>& posRadD,
-                              thrust::host_vector<int4>& referenceArray,
-                              const std::string& outfilename) {
+// Write the positions of the given fluid markers (host array), in the range [start, start + numMarkers) of a marker
+// array of size totalMarkers, to a ChPF file. The positions of all other markers are written as zero.
+static void WriteChPFFluidMarkers(const Real4* posRadH,
+                                  size_t start,
+                                  size_t numMarkers,
+                                  size_t totalMarkers,
+                                  const std::string& outfilename) {
     std::ofstream ptFile(outfilename, std::ios::out | std::ios::binary);
 
     ParticleFormatWriter pw;
 
+    std::vector<float> pos_x(totalMarkers);
+    std::vector<float> pos_y(totalMarkers);
+    std::vector<float> pos_z(totalMarkers);
+
+    for (size_t i = 0; i < numMarkers; i++) {
+        pos_x[start + i] = (float)posRadH[i].x;
+        pos_y[start + i] = (float)posRadH[i].y;
+        pos_z[start + i] = (float)posRadH[i].z;
+    }
+
+    pw.write(ptFile, ParticleFormatWriter::CompressionType::NONE, pos_x, pos_y, pos_z);
+}
+
+void WriteCsvParticlesToFile(thrust::device_vector<Real4>& posRadD,
+                             thrust::device_vector<Real3>& velMasD,
+                             thrust::device_vector<Real4>& rhoPresMuD,
+                             thrust::host_vector<int4>& referenceArray,
+                             const std::string& outfilename) {
+    thrust::host_vector<Real4> posRadH = posRadD;
+    thrust::host_vector<Real3> velMasH = velMasD;
+    thrust::host_vector<Real4> rhoPresMuH = rhoPresMuD;
+
+    int2 range = FluidMarkerRange(referenceArray);
+    WriteCsvFluidMarkers(posRadH.data() + range.x, velMasH.data() + range.x, rhoPresMuH.data() + range.x,
+                         range.y - range.x, outfilename);
+}
+
+void WriteChPFParticlesToFile(thrust::device_vector<Real4>& posRadD,
+                              thrust::host_vector<int4>& referenceArray,
+                              const std::string& outfilename) {
     thrust::host_vector<Real4> posRadH = posRadD;
-    std::vector<float> pos_x(posRadH.size());
-    std::vector<float> pos_y(posRadH.size());
-    std::vector<float> pos_z(posRadH.size());
 
-    // ======================================================
-    bool haveHelper = (referenceArray[0].z == -3) ? true : false;
-    bool haveGhost = (referenceArray[0].z == -2 || referenceArray[1].z == -2) ? true : false;
-    // ======================================================
+    int2 range = FluidMarkerRange(referenceArray);
+    WriteChPFFluidMarkers(posRadH.data() + range.x, range.x, range.y - range.x, posRadH.size(), outfilename);
+}
 
-    for (size_t i = referenceArray[haveHelper + haveGhost].x; i < referenceArray[haveHelper + haveGhost].y; i++) {
-        pos_x[i] = (float)posRadH[i].x;
-        pos_y[i] = (float)posRadH[i].y;
-        pos_z[i] = (float)posRadH[i].z;
+// -----------------------------------------------------------------------------
+
+ParticleFileWriterAsync::ParticleFileWriterAsync()
+    : m_capacity(0), m_posRadH(nullptr), m_velMasH(nullptr), m_rhoPresMuH(nullptr) {
+    cudaStreamCreate(&m_stream);
+    cudaCheckError();
+}
+
+ParticleFileWriterAsync::~ParticleFileWriterAsync() {
+    Wait();
+    cudaFreeHost(m_posRadH);
+    cudaFreeHost(m_velMasH);
+    cudaFreeHost(m_rhoPresMuH);
+    cudaStreamDestroy(m_stream);
+}
+
+void ParticleFileWriterAsync::Write(const thrust::device_vector<Real4>& posRadD,
+                                    const thrust::device_vector<Real3>& velMasD,
+                                    const thrust::device_vector<Real4>& rhoPresMuD,
+                                    const thrust::host_vector<int4>& referenceArray,
+                                    const std::string& outfilename,
+                                    bool chpf) {
+    Wait();
+
+    int2 range = FluidMarkerRange(referenceArray);
+    size_t start = range.x;
+    size_t numMarkers = range.y - range.x;
+    size_t totalMarkers = posRadD.size();
+
+    if (numMarkers > m_capacity) {
+        cudaFreeHost(m_posRadH);
+        cudaFreeHost(m_velMasH);
+        cudaFreeHost(m_rhoPresMuH);
+        cudaMallocHost(&m_posRadH, numMarkers * sizeof(Real4));
+        cudaMallocHost(&m_velMasH, numMarkers * sizeof(Real3));
+        cudaMallocHost(&m_rhoPresMuH, numMarkers * sizeof(Real4));
+        cudaCheckError();
+        m_capacity = numMarkers;
     }
 
-    pw.write(ptFile, ParticleFormatWriter::CompressionType::NONE, pos_x, pos_y, pos_z);
+    // The copies are issued on a blocking stream, so that work subsequently launched on the default stream (which may
+    // overwrite the marker arrays) waits for their completion
+    cudaMemcpyAsync(m_posRadH, thrust::raw_pointer_cast(posRadD.data()) + start, numMarkers * sizeof(Real4),
+                    cudaMemcpyDeviceToHost, m_stream);
+    if (!chpf) {
+        cudaMemcpyAsync(m_velMasH, thrust::raw_pointer_cast(velMasD.data()) + start, numMarkers * sizeof(Real3),
+                        cudaMemcpyDeviceToHost, m_stream);
+        cudaMemcpyAsync(m_rhoPresMuH, thrust::raw_pointer_cast(rhoPresMuD.data()) + start,
+                        numMarkers * sizeof(Real4), cudaMemcpyDeviceToHost, m_stream);
+    }
+    cudaCheckError();
+
+    m_thread = std::thread([this, start, numMarkers, totalMarkers, outfilename, chpf]() {
+        cudaStreamSynchronize(m_stream);
+        if (chpf)
+            WriteChPFFluidMarkers(m_posRadH, start, numMarkers, totalMarkers, outfilename);
+        else
+            WriteCsvFluidMarkers(m_posRadH, m_velMasH, m_rhoPresMuH, numMarkers, outfilename);
+    });
+}
+
+void ParticleFileWriterAsync::Wait() {
+    if (m_thread.joinable())
+        m_thread.join();
 }
 
 }  // end namespace utils
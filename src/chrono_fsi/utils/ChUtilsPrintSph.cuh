@@ -16,6 +16,8 @@
 // =============================================================================
 #ifndef CHUTILSPRINTSPH_H
 #define CHUTILSPRINTSPH_H
+#include <string>
+#include <thread>
 #include <thrust/device_vector.h>
 #include <thrust/host_vector.h>
 #include "chrono_fsi/ChApiFsi.h"
@@ -76,6 +78,36 @@ CH_FSI_API void WriteChPFParticlesToFile(thrust::device_vector<Real4>& posRadD,
                                          thrust::host_vector<int4>& referenceArray,
                                          const std::string& outfilename);
 
+/// Asynchronous writer of FSI particle files.
+/// The fluid marker data is copied to pinned host buffers on a separate CUDA stream and the file is then formatted
+/// and written from a background thread, while the simulation advances. Subsequent work on the default stream (i.e.,
+/// the next simulation step) is implicitly ordered after the copies. Only one file is in flight at a time.
+class CH_FSI_API ParticleFileWriterAsync {
+  public:
+    ParticleFileWriterAsync();
+    ~ParticleFileWriterAsync();
+
+    /// Start writing the fluid markers to a CSV file (same format as WriteCsvParticlesToFile) or, if chpf = true, to a
+    /// ChPF file (same format as WriteChPFParticlesToFile). Waits for the completion of the previous file first.
+    void Write(const thrust::device_vector<Real4>& posRadD,
+               const thrust::device_vector<Real3>& velMasD,
+               const thrust::device_vector<Real4>& rhoPresMuD,
+               const thrust::host_vector<int4>& referenceArray,
+               const std::string& outfilename,
+               bool chpf);
+
+    /// Wait for the completion of the pending file, if any.
+    void Wait();
+
+  private:
+    cudaStream_t m_stream;  ///< stream for the device-to-host copies
+    std::thread m_thread;   ///< background formatting and writing thread
+    size_t m_capacity;      ///< capacity of the pinned buffers (number of markers)
+    Real4* m_posRadH;       ///< pinned copy of the fluid marker positions
+    Real3* m_velMasH;       ///< pinned copy of the fluid marker velocities
+    Real4* m_rhoPresMuH;    ///< pinned copy of the fluid marker densities and pressures
+};
+
 /// @} fsi_utils
 
 }  // end namespace utils
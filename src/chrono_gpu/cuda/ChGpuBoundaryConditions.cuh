@@ -134,14 +134,14 @@ inline __device__ bool addBCForces_Sphere_matBased(unsigned int sphID,
 
         if (track_forces) {
             // accumulate force
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            atomicAddShared(&(bc_params.reaction_forces.x), -force_accum.x, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.y), -force_accum.y, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.z), -force_accum.z, gran_params);
 
             // accumulate torque
-            atomicAdd(&(bc_params.sphere_params.reaction_torques.x), torque_accum.x);
-            atomicAdd(&(bc_params.sphere_params.reaction_torques.y), torque_accum.y);
-            atomicAdd(&(bc_params.sphere_params.reaction_torques.z), torque_accum.z);
+            atomicAddShared(&(bc_params.sphere_params.reaction_torques.x), torque_accum.x, gran_params);
+            atomicAddShared(&(bc_params.sphere_params.reaction_torques.y), torque_accum.y, gran_params);
+            atomicAddShared(&(bc_params.sphere_params.reaction_torques.z), torque_accum.z, gran_params);
         }
 
         return true;
@@ -203,9 +203,9 @@ inline __device__ bool addBCForces_Sphere_frictionless(const int64_t3& sphPos,
 
         force_from_BCs = force_from_BCs + force_accum;
         if (track_forces) {
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            atomicAddShared(&(bc_params.reaction_forces.x), -force_accum.x, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.y), -force_accum.y, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.z), -force_accum.z, gran_params);
         }
     }
 
@@ -283,9 +283,9 @@ inline __device__ bool addBCForces_ZCone_frictionless(const int64_t3& sphPos,
             force_accum + -gran_params->Gamma_n_s2w_SU * projection * contact_normal * m_eff * force_model_multiplier;
         force_from_BCs = force_from_BCs + force_accum;
         if (track_forces) {
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            atomicAddShared(&(bc_params.reaction_forces.x), -force_accum.x, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.y), -force_accum.y, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.z), -force_accum.z, gran_params);
         }
     }
 
@@ -358,9 +358,9 @@ inline __device__ bool addBCForces_ZCone(unsigned int sphID,
 
         force_from_BCs = force_from_BCs + force_accum;
         if (track_forces) {
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            atomicAddShared(&(bc_params.reaction_forces.x), -force_accum.x, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.y), -force_accum.y, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.z), -force_accum.z, gran_params);
         }
     }
 
@@ -417,9 +417,9 @@ inline __device__ bool addBCForces_Plane_frictionless(const int64_t3& sphPos,
 
         force_from_BCs = force_from_BCs + force_accum;
         if (track_forces) {
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            atomicAddShared(&(bc_params.reaction_forces.x), -force_accum.x, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.y), -force_accum.y, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.z), -force_accum.z, gran_params);
         }
     }
 
@@ -483,9 +483,9 @@ inline __device__ bool addBCForces_Plane_frictionless_mbased(const int64_t3& sph
 
         force_from_BCs = force_from_BCs + force_accum;
         if (track_forces) {
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            atomicAddShared(&(bc_params.reaction_forces.x), -force_accum.x, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.y), -force_accum.y, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.z), -force_accum.z, gran_params);
         }
     }
 
@@ -636,9 +636,9 @@ inline __device__ bool addBCForces_Plane(unsigned int sphID,
 
         force_from_BCs = force_from_BCs + force_accum;
         if (track_forces) {
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            atomicAddShared(&(bc_params.reaction_forces.x), -force_accum.x, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.y), -force_accum.y, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.z), -force_accum.z, gran_params);
         }
     }
 
@@ -693,9 +693,9 @@ inline __device__ bool addBCForces_Zcyl_frictionless(const int64_t3& sphPos,
 
         force_from_BCs = force_from_BCs + force_accum;
         if (track_forces) {
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            atomicAddShared(&(bc_params.reaction_forces.x), -force_accum.x, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.y), -force_accum.y, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.z), -force_accum.z, gran_params);
         }
     }
     return contact;
@@ -752,9 +752,9 @@ inline __device__ bool addBCForces_Zcyl_frictionless_mbased(const int64_t3& sphP
         force_from_BCs = force_from_BCs + force_accum;
 
         if (track_forces) {
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            atomicAddShared(&(bc_params.reaction_forces.x), -force_accum.x, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.y), -force_accum.y, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.z), -force_accum.z, gran_params);
         }
     }
     return contact;
@@ -866,9 +866,9 @@ inline __device__ bool addBCForces_Zcyl(unsigned int sphID,
         force_from_BCs = force_from_BCs + force_accum;
 
         if (track_forces) {
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            atomicAddShared(&(bc_params.reaction_forces.x), -force_accum.x, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.y), -force_accum.y, gran_params);
+            atomicAddShared(&(bc_params.reaction_forces.z), -force_accum.z, gran_params);
         }
     }
     return contact;
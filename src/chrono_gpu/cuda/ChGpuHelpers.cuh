@@ -130,33 +130,73 @@ inline __device__ unsigned int SDTripletID(const int trip[3], ChSystemGpu_impl::
     return SDTripletID(trip[0], trip[1], trip[2], gran_params);
 }
 
+// Atomic add to data that may be updated concurrently from several devices (contributions to spheres in the SDs shared
+// by two device partitions, boundary reaction forces). System-scope atomics are used only for multi-device runs.
+template <typename T>
+inline __device__ T atomicAddShared(T* address, T val, ChSystemGpu_impl::GranParamsPtr gran_params) {
+#if __CUDA_ARCH__ >= 600
+    if (gran_params->multi_device)
+        return atomicAdd_system(address, val);
+#endif
+    return atomicAdd(address, val);
+}
+
+// Atomic compare-and-swap on data that may be updated concurrently from several devices (see atomicAddShared).
+inline __device__ unsigned int atomicCASShared(unsigned int* address,
+                                               unsigned int compare,
+                                               unsigned int val,
+                                               ChSystemGpu_impl::GranParamsPtr gran_params) {
+#if __CUDA_ARCH__ >= 600
+    if (gran_params->multi_device)
+        return atomicCAS_system(address, compare, val);
+#endif
+    return atomicCAS(address, compare, val);
+}
+
+// Number of slots claimed in the overflow pool of the contact maps since the last compaction
+inline __device__ unsigned int contactPoolCount(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                                ChSystemGpu_impl::GranParamsPtr gran_params) {
+    if (gran_params->contact_pool_size == 0)
+        return 0;
+    return min(*sphere_data->contact_pool_count, gran_params->contact_pool_size);
+}
+
 // get an index for the current contact pair
+// The pair is searched in the slots of body A, then in the slots owned by body A in the overflow pool
 inline __device__ size_t findContactPairInfo(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                              ChSystemGpu_impl::GranParamsPtr gran_params,
                                              unsigned int body_A,
                                              unsigned int body_B) {
+    size_t body_A_begin = sphere_data->contact_offsets[body_A];
+    size_t body_A_end = sphere_data->contact_offsets[body_A + 1];
+    size_t pool_begin = sphere_data->contact_offsets[gran_params->nSpheres];
+    unsigned int pool_count = contactPoolCount(sphere_data, gran_params);
 
-    // TODO this should be size_t everywhere
-    size_t body_A_offset = (size_t)MAX_SPHERES_TOUCHED_BY_SPHERE * body_A;
     // first skim through and see if this contact pair is in the map
-    for (unsigned int contact_id = 0; contact_id < MAX_SPHERES_TOUCHED_BY_SPHERE; contact_id++) {
-        size_t contact_index = body_A_offset + contact_id;
+    for (size_t contact_index = body_A_begin; contact_index < body_A_end; contact_index++) {
         if (sphere_data->contact_partners_map[contact_index] == body_B) {
             // make sure this contact is marked active
             sphere_data->contact_active_map[contact_index] = true;
             return contact_index;
         }
     }
+    for (unsigned int pool_id = 0; pool_id < pool_count; pool_id++) {
+        size_t contact_index = pool_begin + pool_id;
+        if (sphere_data->contact_pool_owner[pool_id] == body_A &&
+            sphere_data->contact_partners_map[contact_index] == body_B) {
+            sphere_data->contact_active_map[contact_index] = true;
+            return contact_index;
+        }
+    }
 
     // if we get this far, the contact pair isn't in the map now and we need to find an empty spot
-    for (unsigned int contact_id = 0; contact_id < MAX_SPHERES_TOUCHED_BY_SPHERE; contact_id++) {
-        size_t contact_index = body_A_offset + contact_id;
+    for (size_t contact_index = body_A_begin; contact_index < body_A_end; contact_index++) {
         // check whether the slot is free right now
         if (sphere_data->contact_partners_map[contact_index] == NULL_CHGPU_ID || sphere_data->contact_partners_map[contact_index] == body_B) {
             // claim this slot for ourselves, atomically
             // if the CAS returns NULL_CHGPU_ID, it means that the spot was free and we claimed it
             unsigned int body_B_returned =
-                atomicCAS(sphere_data->contact_partners_map + contact_index, NULL_CHGPU_ID, body_B);
+                atomicCASShared(sphere_data->contact_partners_map + contact_index, NULL_CHGPU_ID, body_B, gran_params);
             // did we get the spot? if so, claim it
             if (NULL_CHGPU_ID == body_B_returned || body_B == body_B_returned) {
                 // make sure this contact is marked active
@@ -166,6 +206,33 @@ inline __device__ size_t findContactPairInfo(ChSystemGpu_impl::GranSphereDataPtr
         }
     }
 
+    // reuse a released slot owned by body A in the overflow pool
+    for (unsigned int pool_id = 0; pool_id < pool_count; pool_id++) {
+        size_t contact_index = pool_begin + pool_id;
+        if (sphere_data->contact_pool_owner[pool_id] == body_A &&
+            sphere_data->contact_partners_map[contact_index] == NULL_CHGPU_ID) {
+            unsigned int body_B_returned =
+                atomicCASShared(sphere_data->contact_partners_map + contact_index, NULL_CHGPU_ID, body_B, gran_params);
+            if (NULL_CHGPU_ID == body_B_returned || body_B == body_B_returned) {
+                sphere_data->contact_active_map[contact_index] = true;
+                return contact_index;
+            }
+        }
+    }
+
+    // all slots of body A are taken (possible only after compaction), claim a slot in the overflow pool
+    if (gran_params->contact_pool_size > 0) {
+        unsigned int pool_id = atomicAddShared(sphere_data->contact_pool_count, 1u, gran_params);
+        if (pool_id < gran_params->contact_pool_size) {
+            size_t contact_index = pool_begin + pool_id;
+            sphere_data->contact_pool_owner[pool_id] = body_A;
+            sphere_data->contact_partners_map[contact_index] = body_B;
+            sphere_data->contact_active_map[contact_index] = true;
+            return contact_index;
+        }
+        ABORTABORTABORT("Contact map overflow pool full for body %u and body %u\n", body_A, body_B);
+    }
+
     // if we got this far, we couldn't find a free contact pair. That is a violation of the 12-contacts theorem, so
     // we should probably give up now
     ABORTABORTABORT("No available contact pair slots for body %u and body %u\n", body_A, body_B);
@@ -12,6 +12,7 @@
 // Authors: Conlain Kelly, Nic Olsen, Ruochun Zhang, Dan Negrut
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
 #include <fstream>
@@ -204,6 +205,10 @@ __host__ float ChSystemGpu_impl::get_max_vel() const {
 __host__ int3 ChSystemGpu_impl::getSDTripletFromID(unsigned int SD_ID) const {
     return SDIDTriplet(SD_ID, gran_params);
 }
+
+__host__ int3 ChSystemGpu_impl::getSDTripletFromID(unsigned int SD_ID, const GranParams& params) const {
+    return SDIDTriplet(SD_ID, &params);
+}
 /// Sort sphere positions by subdomain id
 /// Occurs entirely on host, not intended to be efficient
 /// ONLY DO AT BEGINNING OF SIMULATION
@@ -461,6 +466,15 @@ __host__ void ChSystemGpu_impl::setupSphereDataStructures() {
                             NULL_CHGPU_ID);
         TRACK_VECTOR_RESIZE(contact_active_map, MAX_SPHERES_TOUCHED_BY_SPHERE * nSpheres, "contact_active_map", false);
 
+        // Initially, MAX_SPHERES_TOUCHED_BY_SPHERE slots per sphere and no overflow pool
+        TRACK_VECTOR_RESIZE(contact_offsets, nSpheres + 1, "contact_offsets", 0);
+        for (unsigned int i = 0; i <= nSpheres; i++)
+            contact_offsets[i] = MAX_SPHERES_TOUCHED_BY_SPHERE * i;
+        contact_pool_owner.clear();
+        contact_pool_count.assign(1, 0);
+        gran_params->contact_pool_size = 0;
+        steps_since_compaction = 0;
+
         // If the user provides a checkpointed history array, we load it here
         bool user_provided_partner_map = user_partner_map.size() != 0;
         if (user_provided_partner_map && user_partner_map.size() != MAX_SPHERES_TOUCHED_BY_SPHERE * nSpheres)
@@ -645,6 +659,398 @@ __host__ void ChSystemGpu_impl::updateBCPositions() {
     }
 }
 
+// Enqueue the per-step force and integration work on the given stream. Unlike the synchronous path in
+// AdvanceSimulation, this does not synchronize with the host, so that it can be captured in a CUDA graph.
+__host__ void ChSystemGpu_impl::launchSphereStepKernels(cudaStream_t stream) {
+    unsigned int nBlocks = (nSpheres + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
+    bool frictionless = gran_params->friction_mode == CHGPU_FRICTION_MODE::FRICTIONLESS;
+    size_t nbytes = nSpheres * sizeof(float);
+
+    // cache past acceleration data and reset current accelerations (see resetSphereAccelerations)
+    if (time_integrator == CHGPU_TIME_INTEGRATOR::CHUNG) {
+        cudaMemcpyAsync(sphere_acc_X_old.data(), sphere_acc_X.data(), nbytes, cudaMemcpyDeviceToDevice, stream);
+        cudaMemcpyAsync(sphere_acc_Y_old.data(), sphere_acc_Y.data(), nbytes, cudaMemcpyDeviceToDevice, stream);
+        cudaMemcpyAsync(sphere_acc_Z_old.data(), sphere_acc_Z.data(), nbytes, cudaMemcpyDeviceToDevice, stream);
+        if (!frictionless) {
+            cudaMemcpyAsync(sphere_ang_acc_X_old.data(), sphere_ang_acc_X.data(), nbytes, cudaMemcpyDeviceToDevice,
+                            stream);
+            cudaMemcpyAsync(sphere_ang_acc_Y_old.data(), sphere_ang_acc_Y.data(), nbytes, cudaMemcpyDeviceToDevice,
+                            stream);
+            cudaMemcpyAsync(sphere_ang_acc_Z_old.data(), sphere_ang_acc_Z.data(), nbytes, cudaMemcpyDeviceToDevice,
+                            stream);
+        }
+    }
+    cudaMemsetAsync(sphere_acc_X.data(), 0, nbytes, stream);
+    cudaMemsetAsync(sphere_acc_Y.data(), 0, nbytes, stream);
+    cudaMemsetAsync(sphere_acc_Z.data(), 0, nbytes, stream);
+    if (!frictionless) {
+        cudaMemsetAsync(sphere_ang_acc_X.data(), 0, nbytes, stream);
+        cudaMemsetAsync(sphere_ang_acc_Y.data(), 0, nbytes, stream);
+        cudaMemsetAsync(sphere_ang_acc_Z.data(), 0, nbytes, stream);
+    }
+
+    if (frictionless) {
+        computeSphereForces_frictionless_matBased<<<nSDs, MAX_COUNT_OF_SPHERES_PER_SD, 0, stream>>>(
+            sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(),
+            (unsigned int)BC_params_list_SU.size());
+    } else {
+        determineContactPairs<<<nSDs, MAX_COUNT_OF_SPHERES_PER_SD, 0, stream>>>(sphere_data, gran_params);
+        if (gran_params->use_mat_based == true) {
+            computeSphereContactForces_matBased<<<nBlocks, CUDA_THREADS_PER_BLOCK, 0, stream>>>(
+                sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(),
+                (unsigned int)BC_params_list_SU.size(), nSpheres);
+        } else {
+            computeSphereContactForces<<<nBlocks, CUDA_THREADS_PER_BLOCK, 0, stream>>>(
+                sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(),
+                (unsigned int)BC_params_list_SU.size(), nSpheres);
+        }
+    }
+
+    integrateSpheres<<<nBlocks, CUDA_THREADS_PER_BLOCK, 0, stream>>>(stepSize_SU, sphere_data, nSpheres, gran_params);
+
+    if (!frictionless) {
+        const unsigned int nThreadsUpdateHist = 2 * CUDA_THREADS_PER_BLOCK;
+        unsigned int fricMapSize = (unsigned int)contact_partners_map.size();
+        unsigned int nBlocksFricHistoryPostProcess = (fricMapSize + nThreadsUpdateHist - 1) / nThreadsUpdateHist;
+        updateFrictionData<<<nBlocksFricHistoryPostProcess, nThreadsUpdateHist, 0, stream>>>(fricMapSize, sphere_data,
+                                                                                             gran_params);
+        updateAngVels<<<nBlocks, CUDA_THREADS_PER_BLOCK, 0, stream>>>(stepSize_SU, sphere_data, nSpheres, gran_params);
+    }
+}
+
+// Replay the step graph, capturing it first if there is none or if the launch configuration changed since the last
+// capture. The kernels read all per-step data (sphere state, BC parameters, broadphase results) through the managed
+// sphere_data, gran_params, and BC arrays, so the graph stays valid as long as these pointers and the launch
+// dimensions are unchanged.
+__host__ void ChSystemGpu_impl::runSphereStepGraph() {
+    StepGraphConfig config;
+    config.nSpheres = nSpheres;
+    config.nSDs = nSDs;
+    config.stepSize_SU = stepSize_SU;
+    config.bc_types = BC_type_list.data();
+    config.bc_params = BC_params_list_SU.data();
+    config.nBCs = BC_params_list_SU.size();
+    config.friction_mode = gran_params->friction_mode;
+    config.time_integrator = time_integrator;
+    config.use_mat_based = gran_params->use_mat_based;
+    config.fricMapSize = contact_partners_map.size();
+
+    bool valid = step_graph_exec != nullptr && config.nSpheres == step_graph_config.nSpheres &&
+                 config.nSDs == step_graph_config.nSDs && config.stepSize_SU == step_graph_config.stepSize_SU &&
+                 config.bc_types == step_graph_config.bc_types && config.bc_params == step_graph_config.bc_params &&
+                 config.nBCs == step_graph_config.nBCs && config.friction_mode == step_graph_config.friction_mode &&
+                 config.time_integrator == step_graph_config.time_integrator &&
+                 config.use_mat_based == step_graph_config.use_mat_based &&
+                 config.fricMapSize == step_graph_config.fricMapSize;
+
+    if (!valid) {
+        if (step_graph_exec) {
+            gpuErrchk(cudaGraphExecDestroy(step_graph_exec));
+            step_graph_exec = nullptr;
+        }
+        if (!step_graph_stream)
+            gpuErrchk(cudaStreamCreateWithFlags(&step_graph_stream, cudaStreamNonBlocking));
+
+        cudaGraph_t graph;
+        gpuErrchk(cudaStreamBeginCapture(step_graph_stream, cudaStreamCaptureModeThreadLocal));
+        launchSphereStepKernels(step_graph_stream);
+        gpuErrchk(cudaStreamEndCapture(step_graph_stream, &graph));
+        gpuErrchk(cudaGraphInstantiateWithFlags(&step_graph_exec, graph, 0));
+        gpuErrchk(cudaGraphDestroy(graph));
+        step_graph_config = config;
+    }
+
+    gpuErrchk(cudaGraphLaunch(step_graph_exec, step_graph_stream));
+    gpuErrchk(cudaStreamSynchronize(step_graph_stream));
+    gpuErrchk(cudaPeekAtLastError());
+}
+
+__host__ void ChSystemGpu_impl::destroyStepGraph() {
+    if (step_graph_exec) {
+        gpuErrchk(cudaGraphExecDestroy(step_graph_exec));
+        step_graph_exec = nullptr;
+    }
+    if (step_graph_stream) {
+        gpuErrchk(cudaStreamDestroy(step_graph_stream));
+        step_graph_stream = nullptr;
+    }
+}
+
+// Launch work on each device (through a function of the partition index), then wait for all devices.
+template <typename LAUNCH>
+static void launchOnDevices(const std::vector<int>& devices, LAUNCH&& launch) {
+    for (size_t k = 0; k < devices.size(); k++) {
+        gpuErrchk(cudaSetDevice(devices[k]));
+        launch(k);
+        gpuErrchk(cudaPeekAtLastError());
+    }
+    for (int dev : devices) {
+        gpuErrchk(cudaSetDevice(dev));
+        gpuErrchk(cudaDeviceSynchronize());
+    }
+    gpuErrchk(cudaSetDevice(devices[0]));
+}
+
+// Advise the driver to keep the slice of a per-sphere array owned by each device on that device, while mapping the
+// whole array for access from all devices (so that spheres of neighboring partitions are read in place).
+template <typename T>
+static void adviseDeviceSlices(std::vector<T, cudallocator<T>>& arr,
+                               size_t entries_per_sphere,
+                               const std::vector<int>& devices,
+                               const std::vector<unsigned int>& sphere_begin) {
+    if (arr.empty())
+        return;
+    for (int dev : devices)
+        gpuErrchk(cudaMemAdvise(arr.data(), arr.size() * sizeof(T), cudaMemAdviseSetAccessedBy, dev));
+    for (size_t k = 0; k < devices.size(); k++) {
+        size_t first = entries_per_sphere * sphere_begin[k];
+        size_t count = entries_per_sphere * (sphere_begin[k + 1] - sphere_begin[k]);
+        if (count > 0)
+            gpuErrchk(cudaMemAdvise(arr.data() + first, count * sizeof(T), cudaMemAdviseSetPreferredLocation,
+                                    devices[k]));
+    }
+}
+
+__host__ void ChSystemGpu_impl::setDevices(const std::vector<int>& devs) {
+    devices = devs;
+    device_SD_begin.clear();
+    device_sphere_begin.clear();
+    gran_params->multi_device = devices.size() > 1;
+    if (devices.size() < 2)
+        return;
+
+    // Enable peer access between all device pairs that support it (otherwise, pages migrate on access)
+    for (int dev : devices) {
+        gpuErrchk(cudaSetDevice(dev));
+        for (int peer : devices) {
+            int can_access = 0;
+            if (peer != dev)
+                gpuErrchk(cudaDeviceCanAccessPeer(&can_access, dev, peer));
+            if (!can_access)
+                continue;
+            cudaError_t err = cudaDeviceEnablePeerAccess(peer, 0);
+            if (err == cudaErrorPeerAccessAlreadyEnabled)
+                cudaGetLastError();  // clear the error state
+            else
+                gpuErrchk(err);
+        }
+    }
+    gpuErrchk(cudaSetDevice(devices[0]));
+}
+
+// Split the SDs and the spheres in contiguous ranges, one per device, with an equal number of spheres per device.
+// The X index is the slowest varying in an SD ID, so that each SD range is a slab of the big domain along X. If the
+// spheres were sorted by owner SD at initialization (the default), the SD range of a device starts at the owner SD of
+// its first sphere, such that each device mostly processes the spheres it owns. Spheres that moved to another slab
+// since are still handled correctly, only with more accesses to remote memory.
+__host__ void ChSystemGpu_impl::partitionDevices() {
+    size_t n = devices.size();
+    device_sphere_begin.resize(n + 1);
+    device_SD_begin.resize(n + 1);
+    for (size_t k = 0; k < n; k++) {
+        device_sphere_begin[k] = (unsigned int)((uint64_t)nSpheres * k / n);
+        unsigned int first_SD = (unsigned int)((uint64_t)nSDs * k / n);
+        if (defragment_on_start && device_sphere_begin[k] < nSpheres)
+            first_SD = sphere_owner_SDs[device_sphere_begin[k]];
+        device_SD_begin[k] = (k == 0) ? 0 : std::max(device_SD_begin[k - 1], first_SD);
+    }
+    device_sphere_begin[n] = nSpheres;
+    device_SD_begin[n] = nSDs;
+
+    adviseDeviceSlices(sphere_local_pos_X, 1, devices, device_sphere_begin);
+    adviseDeviceSlices(sphere_local_pos_Y, 1, devices, device_sphere_begin);
+    adviseDeviceSlices(sphere_local_pos_Z, 1, devices, device_sphere_begin);
+    adviseDeviceSlices(pos_X_dt, 1, devices, device_sphere_begin);
+    adviseDeviceSlices(pos_Y_dt, 1, devices, device_sphere_begin);
+    adviseDeviceSlices(pos_Z_dt, 1, devices, device_sphere_begin);
+    adviseDeviceSlices(sphere_acc_X, 1, devices, device_sphere_begin);
+    adviseDeviceSlices(sphere_acc_Y, 1, devices, device_sphere_begin);
+    adviseDeviceSlices(sphere_acc_Z, 1, devices, device_sphere_begin);
+    adviseDeviceSlices(sphere_fixed, 1, devices, device_sphere_begin);
+    adviseDeviceSlices(sphere_owner_SDs, 1, devices, device_sphere_begin);
+    if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
+        adviseDeviceSlices(sphere_Omega_X, 1, devices, device_sphere_begin);
+        adviseDeviceSlices(sphere_Omega_Y, 1, devices, device_sphere_begin);
+        adviseDeviceSlices(sphere_Omega_Z, 1, devices, device_sphere_begin);
+        adviseDeviceSlices(sphere_ang_acc_X, 1, devices, device_sphere_begin);
+        adviseDeviceSlices(sphere_ang_acc_Y, 1, devices, device_sphere_begin);
+        adviseDeviceSlices(sphere_ang_acc_Z, 1, devices, device_sphere_begin);
+    }
+}
+
+// Rebuild the contact maps with, for each sphere, its current contacts plus a few spare slots (at most
+// MAX_SPHERES_TOUCHED_BY_SPHERE), followed by a fresh overflow pool. Contacts keep their relative order, so that the
+// friction history of each contact is carried over. The recorded contact forces are reset (they are recomputed at
+// the next force evaluation).
+__host__ void ChSystemGpu_impl::compactContactMaps() {
+    unsigned int nBlocks = (nSpheres + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
+    unsigned int pool_count = std::min(contact_pool_count[0], gran_params->contact_pool_size);
+    bool multi_step = gran_params->friction_mode == CHGPU_FRICTION_MODE::MULTI_STEP;
+
+    // number of slots of each sphere in the compacted maps (last entry stays 0, for the total from the scan)
+    std::vector<unsigned int, cudallocator<unsigned int>> num_slots(nSpheres + 1, 0);
+    if (pool_count > 0)
+        countContactPoolSlots<<<1, 1>>>(sphere_data, gran_params, pool_count, num_slots.data());
+    countContactSlots<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(sphere_data, gran_params, contact_spare_slots,
+                                                           num_slots.data());
+    gpuErrchk(cudaDeviceSynchronize());
+    gpuErrchk(cudaPeekAtLastError());
+
+    std::vector<unsigned int, cudallocator<unsigned int>> new_offsets(nSpheres + 1, 0);
+    size_t temp_storage_bytes = 0;
+    cub::DeviceScan::ExclusiveSum(NULL, temp_storage_bytes, num_slots.data(), new_offsets.data(), nSpheres + 1);
+    gpuErrchk(cudaDeviceSynchronize());
+    void* d_scratch_space = (void*)stateOfSolver_resources.pDeviceMemoryScratchSpace(temp_storage_bytes);
+    cub::DeviceScan::ExclusiveSum(d_scratch_space, temp_storage_bytes, num_slots.data(), new_offsets.data(),
+                                  nSpheres + 1);
+    gpuErrchk(cudaDeviceSynchronize());
+    gpuErrchk(cudaPeekAtLastError());
+
+    unsigned int pool_size = contact_pool_capacity > 0 ? contact_pool_capacity : std::max(1024u, nSpheres / 8);
+    size_t old_map_size = contact_partners_map.size();
+    size_t old_pool_size = contact_pool_owner.size();
+    size_t map_size = (size_t)new_offsets[nSpheres] + pool_size;
+
+    // copy the contacts to the compacted maps (num_slots is reused for the number of filled slots)
+    std::vector<unsigned int, cudallocator<unsigned int>> new_partners(map_size, NULL_CHGPU_ID);
+    std::vector<not_stupid_bool, cudallocator<not_stupid_bool>> new_active(map_size, false);
+    std::vector<float3, cudallocator<float3>> new_history;
+    std::vector<float, cudallocator<float>> new_duration;
+    if (multi_step) {
+        new_history.resize(map_size, make_float3(0, 0, 0));
+        new_duration.resize(map_size, 0);
+    }
+    float3* history_ptr = multi_step ? new_history.data() : nullptr;
+    float* duration_ptr = multi_step ? new_duration.data() : nullptr;
+
+    compactContactSlots<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(sphere_data, gran_params, new_offsets.data(),
+                                                             num_slots.data(), new_partners.data(), new_active.data(),
+                                                             history_ptr, duration_ptr);
+    gpuErrchk(cudaDeviceSynchronize());
+    gpuErrchk(cudaPeekAtLastError());
+    if (pool_count > 0) {
+        compactContactPoolSlots<<<1, 1>>>(sphere_data, gran_params, pool_count, new_offsets.data(), num_slots.data(),
+                                          new_partners.data(), new_active.data(), history_ptr, duration_ptr);
+        gpuErrchk(cudaDeviceSynchronize());
+        gpuErrchk(cudaPeekAtLastError());
+    }
+
+    contact_partners_map.swap(new_partners);
+    contact_active_map.swap(new_active);
+    if (multi_step) {
+        contact_history_map.swap(new_history);
+        contact_duration.swap(new_duration);
+    }
+    contact_offsets.swap(new_offsets);
+    contact_pool_owner.assign(pool_size, NULL_CHGPU_ID);
+    contact_pool_count.assign(1, 0);
+    gran_params->contact_pool_size = pool_size;
+
+    // recorded contact forces are indexed by contact map slot
+    float3 null_force = {0.0f, 0.0f, 0.0f};
+    size_t num_float3 = 0;
+    size_t num_float = 0;
+    for (auto vec : {&normal_contact_force, &tangential_friction_force, &rolling_friction_torque, &v_rot_array}) {
+        if (!vec->empty()) {
+            vec->assign(map_size, null_force);
+            num_float3++;
+        }
+    }
+    if (!char_collision_time.empty()) {
+        char_collision_time.assign(map_size, 0);
+        num_float++;
+    }
+
+    // memory accounting
+    size_t slot_bytes = sizeof(unsigned int) + sizeof(not_stupid_bool) + num_float3 * sizeof(float3) +
+                        num_float * sizeof(float) + (multi_step ? sizeof(float3) + sizeof(float) : 0);
+    gran_approx_bytes_used += slot_bytes * map_size - slot_bytes * old_map_size;
+    gran_approx_bytes_used += sizeof(unsigned int) * pool_size - sizeof(unsigned int) * old_pool_size;
+
+    INFO_PRINTF("Compacted contact maps: %zu slots (overflow pool: %u slots), previously %zu slots\n", map_size,
+                pool_size, old_map_size);
+
+    packSphereDataPointers();
+}
+
+__host__ void ChSystemGpu_impl::updateContactMaps() {
+    if (contact_compaction_interval == 0 || gran_params->friction_mode == CHGPU_FRICTION_MODE::FRICTIONLESS)
+        return;
+    if (++steps_since_compaction < contact_compaction_interval)
+        return;
+    steps_since_compaction = 0;
+    compactContactMaps();
+}
+
+// Each device runs the SD-based kernels over its SD range and the sphere-based kernels over its sphere range. Spheres
+// touching SDs at the boundary of two ranges (the halo) are read in place by both devices through unified memory and
+// the contributions to these spheres are accumulated with system-scope atomics. All devices are synchronized after
+// each kernel, as the next one uses results from all partitions.
+__host__ void ChSystemGpu_impl::runSphereStepMultiDevice() {
+    if (device_sphere_begin.size() != devices.size() + 1 || device_sphere_begin.back() != nSpheres ||
+        device_SD_begin.back() != nSDs)
+        partitionDevices();
+
+    auto nSDs_k = [&](size_t k) { return device_SD_begin[k + 1] - device_SD_begin[k]; };
+    auto nSpheres_k = [&](size_t k) { return device_sphere_begin[k + 1] - device_sphere_begin[k]; };
+    auto nBlocks_k = [&](size_t k) { return (nSpheres_k(k) + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK; };
+    unsigned int nBCs = (unsigned int)BC_params_list_SU.size();
+
+    if (gran_params->friction_mode == CHGPU_FRICTION_MODE::FRICTIONLESS) {
+        launchOnDevices(devices, [&](size_t k) {
+            if (nSDs_k(k) > 0)
+                computeSphereForces_frictionless_matBased<<<nSDs_k(k), MAX_COUNT_OF_SPHERES_PER_SD>>>(
+                    sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(), nBCs, device_SD_begin[k]);
+        });
+    } else {
+        launchOnDevices(devices, [&](size_t k) {
+            if (nSDs_k(k) > 0)
+                determineContactPairs<<<nSDs_k(k), MAX_COUNT_OF_SPHERES_PER_SD>>>(sphere_data, gran_params,
+                                                                                   device_SD_begin[k]);
+        });
+        launchOnDevices(devices, [&](size_t k) {
+            if (nSpheres_k(k) == 0)
+                return;
+            if (gran_params->use_mat_based == true) {
+                computeSphereContactForces_matBased<<<nBlocks_k(k), CUDA_THREADS_PER_BLOCK>>>(
+                    sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(), nBCs, nSpheres,
+                    device_sphere_begin[k], device_sphere_begin[k + 1]);
+            } else {
+                computeSphereContactForces<<<nBlocks_k(k), CUDA_THREADS_PER_BLOCK>>>(
+                    sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(), nBCs, nSpheres,
+                    device_sphere_begin[k], device_sphere_begin[k + 1]);
+            }
+        });
+    }
+
+    launchOnDevices(devices, [&](size_t k) {
+        if (nSpheres_k(k) > 0)
+            integrateSpheres<<<nBlocks_k(k), CUDA_THREADS_PER_BLOCK>>>(stepSize_SU, sphere_data,
+                                                                       device_sphere_begin[k + 1], gran_params,
+                                                                       device_sphere_begin[k]);
+    });
+
+    if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
+        const unsigned int nThreadsUpdateHist = 2 * CUDA_THREADS_PER_BLOCK;
+        launchOnDevices(devices, [&](size_t k) {
+            // contact map slots of the device spheres (the last device also processes the overflow pool)
+            unsigned int fricMapBegin = contact_offsets[device_sphere_begin[k]];
+            unsigned int fricMapEnd = (k + 1 == devices.size()) ? (unsigned int)contact_partners_map.size()
+                                                                 : contact_offsets[device_sphere_begin[k + 1]];
+            if (fricMapEnd > fricMapBegin) {
+                unsigned int nBlocksFricHistoryPostProcess =
+                    (fricMapEnd - fricMapBegin + nThreadsUpdateHist - 1) / nThreadsUpdateHist;
+                updateFrictionData<<<nBlocksFricHistoryPostProcess, nThreadsUpdateHist>>>(fricMapEnd, sphere_data,
+                                                                                          gran_params, fricMapBegin);
+            }
+            if (nSpheres_k(k) > 0)
+                updateAngVels<<<nBlocks_k(k), CUDA_THREADS_PER_BLOCK>>>(stepSize_SU, sphere_data,
+                                                                    device_sphere_begin[k + 1], gran_params,
+                                                                    device_sphere_begin[k]);
+        });
+    }
+}
+
 __host__ double ChSystemGpu_impl::AdvanceSimulation(float duration) {
     // Figure our the number of blocks that need to be launched to cover the box
     unsigned int nBlocks = (nSpheres + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
@@ -661,6 +1067,27 @@ __host__ double ChSystemGpu_impl::AdvanceSimulation(float duration) {
     for (unsigned int n = 0; n < nsteps; n++) {
         updateBCPositions();
         runSphereBroadphase();
+        updateContactMaps();
+
+        // Distribute the force and integration kernels over the device partitions
+        if (devices.size() > 1) {
+            resetSphereAccelerations();
+            resetBCForces();
+            runSphereStepMultiDevice();
+            elapsedSimTime += (float)(stepSize_SU * TIME_SU2UU);
+            time_elapsed_SU += stepSize_SU;
+            continue;
+        }
+
+        // Replay the captured force and integration kernels, with a single synchronization per step
+        if (use_step_graph) {
+            resetBCForces();
+            runSphereStepGraph();
+            elapsedSimTime += (float)(stepSize_SU * TIME_SU2UU);
+            time_elapsed_SU += stepSize_SU;
+            continue;
+        }
+
         resetSphereAccelerations();
         resetBCForces();
 
@@ -702,7 +1129,7 @@ __host__ double ChSystemGpu_impl::AdvanceSimulation(float duration) {
 
         if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
             const unsigned int nThreadsUpdateHist = 2 * CUDA_THREADS_PER_BLOCK;
-            unsigned int fricMapSize = nSpheres * MAX_SPHERES_TOUCHED_BY_SPHERE;
+            unsigned int fricMapSize = (unsigned int)contact_partners_map.size();
             unsigned int nBlocksFricHistoryPostProcess = (fricMapSize + nThreadsUpdateHist - 1) / nThreadsUpdateHist;
 
             METRICS_PRINTF("Update Friction Data!\n");
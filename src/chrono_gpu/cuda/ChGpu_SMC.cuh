@@ -537,14 +537,16 @@ inline __device__ void applyExternalForces(unsigned int currSphereID,
     applyGravity(sphere_force, gran_params);
 }
 
+/// Each block is an SD (starting at SD firstSD), each thread a sphere touching that SD
 static __global__ void determineContactPairs(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
-                                             ChSystemGpu_impl::GranParamsPtr gran_params) {
+                                             ChSystemGpu_impl::GranParamsPtr gran_params,
+                                             unsigned int firstSD = 0) {
     // Cache positions of spheres local to this SD
     __shared__ int3 sphere_pos_local[MAX_COUNT_OF_SPHERES_PER_SD];
     __shared__ unsigned int sphIDs[MAX_COUNT_OF_SPHERES_PER_SD];
     __shared__ not_stupid_bool sphFixed[MAX_COUNT_OF_SPHERES_PER_SD];
 
-    unsigned int thisSD = blockIdx.x;
+    unsigned int thisSD = firstSD + blockIdx.x;
     unsigned int spheresTouchingThisSD = sphere_data->SD_NumSpheresTouching[thisSD];
 
     unsigned char bodyB_list[MAX_SPHERES_TOUCHED_BY_SPHERE];
@@ -739,18 +741,20 @@ static __global__ void computeSphereContactForces(ChSystemGpu_impl::GranSphereDa
                                                   BC_type* bc_type_list,
                                                   BC_params_t<int64_t, int64_t3>* bc_params_list,
                                                   unsigned int nBCs,
-                                                  unsigned int nSpheres) {
+                                                  unsigned int nSpheres,
+                                                  unsigned int firstSphere = 0,
+                                                  unsigned int endSphere = UINT_MAX) {
     // grab the sphere radius
     unsigned int sphereRadius_SU = gran_params->sphereRadius_SU;
 
     // my sphere ID, we're using a 1D thread->sphere map
-    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+    unsigned int mySphereID = firstSphere + threadIdx.x + blockIdx.x * blockDim.x;
 
     //    float force_unit = gran_params->MASS_UNIT * gran_params->LENGTH_UNIT / (gran_params->TIME_UNIT *
     //    gran_params->TIME_UNIT);
 
     // don't overrun the array
-    if (mySphereID < nSpheres) {
+    if (mySphereID < nSpheres && mySphereID < endSphere) {
         // my offset in the contact map
         unsigned int myOwnerSD = sphere_data->sphere_owner_SDs[mySphereID];
 
@@ -768,20 +772,27 @@ static __global__ void computeSphereContactForces(ChSystemGpu_impl::GranSphereDa
 
         float3 my_sphere_vel = make_float3(sphere_data->pos_X_dt[mySphereID], sphere_data->pos_Y_dt[mySphereID],
                                            sphere_data->pos_Z_dt[mySphereID]);
-        size_t body_A_offset = MAX_SPHERES_TOUCHED_BY_SPHERE * mySphereID;
+        // slots of this sphere in the contact maps, followed by the overflow pool
+        size_t body_A_begin = sphere_data->contact_offsets[mySphereID];
+        size_t body_A_end = sphere_data->contact_offsets[mySphereID + 1];
+        size_t pool_begin = sphere_data->contact_offsets[nSpheres];
+        unsigned int pool_count = contactPoolCount(sphere_data, gran_params);
 
         // Put spheres contacting this sphere into a vector, then sort based on their sphere IDs
         // This is because if we don't sort, we have no control over the order the contact forces are added together
         // And if that's the case, due to the non-associative property of float addition, our result is not
         // deterministic
         unsigned int theirIDList[MAX_SPHERES_TOUCHED_BY_SPHERE];
-        unsigned char contactIDList[MAX_SPHERES_TOUCHED_BY_SPHERE];
+        size_t contactIDList[MAX_SPHERES_TOUCHED_BY_SPHERE];
         unsigned char numActiveContacts = 0;
-        for (unsigned char body_B_offset = 0; body_B_offset < MAX_SPHERES_TOUCHED_BY_SPHERE; body_B_offset++) {
-            bool active_contact = sphere_data->contact_active_map[body_A_offset + body_B_offset];
-            if (active_contact) {
-                theirIDList[numActiveContacts] = sphere_data->contact_partners_map[body_A_offset + body_B_offset];
-                contactIDList[numActiveContacts] = body_B_offset;
+        for (size_t slot = body_A_begin; slot < body_A_end + pool_count; slot++) {
+            size_t contact_index = slot < body_A_end ? slot : pool_begin + (slot - body_A_end);
+            bool active_contact = sphere_data->contact_active_map[contact_index] &&
+                                  (slot < body_A_end ||
+                                   sphere_data->contact_pool_owner[slot - body_A_end] == mySphereID);
+            if (active_contact && numActiveContacts < MAX_SPHERES_TOUCHED_BY_SPHERE) {
+                theirIDList[numActiveContacts] = sphere_data->contact_partners_map[contact_index];
+                contactIDList[numActiveContacts] = contact_index;
                 numActiveContacts++;
             }
         }
@@ -793,9 +804,9 @@ static __global__ void computeSphereContactForces(ChSystemGpu_impl::GranSphereDa
                     unsigned int tmp_int = theirIDList[ii];
                     theirIDList[ii] = theirIDList[jj];
                     theirIDList[jj] = tmp_int;
-                    unsigned char tmp_char = contactIDList[ii];
+                    size_t tmp_index = contactIDList[ii];
                     contactIDList[ii] = contactIDList[jj];
-                    contactIDList[jj] = tmp_char;
+                    contactIDList[jj] = tmp_index;
                 }
             }
         }
@@ -809,11 +820,11 @@ static __global__ void computeSphereContactForces(ChSystemGpu_impl::GranSphereDa
         for (unsigned char ii = 0; ii < numActiveContacts; ii++) {
             // All contacts here are active
             const unsigned int theirSphereID = theirIDList[ii];
-            const unsigned char contact_id = contactIDList[ii];
+            const size_t contact_id = contactIDList[ii];
 
             if (theirSphereID >= nSpheres) {
                 ABORTABORTABORT("Invalid other sphere id found for sphere %u at slot %u, other is %u\n", mySphereID,
-                                contact_id, theirSphereID);
+                                (unsigned int)contact_id, theirSphereID);
             }
 
             unsigned int theirOwnerSD = sphere_data->sphere_owner_SDs[theirSphereID];
@@ -836,7 +847,7 @@ static __global__ void computeSphereContactForces(ChSystemGpu_impl::GranSphereDa
                 gran_params);
 
             if (gran_params->recording_contactInfo == true) {
-                sphere_data->normal_contact_force[body_A_offset + contact_id] = force_accum;
+                sphere_data->normal_contact_force[contact_id] = force_accum;
             }
 
             float hertz_force_factor = sqrtf(2. * (1 - (1. / reciplength)));  // sqrt(delta_n / (2 R_eff)
@@ -861,18 +872,18 @@ static __global__ void computeSphereContactForces(ChSystemGpu_impl::GranSphereDa
                 const float m_eff = gran_params->sphere_mass_SU / 2.f;
 
                 float3 tangent_force = computeFrictionForces(
-                    gran_params, sphere_data, body_A_offset + contact_id, gran_params->static_friction_coeff_s2s,
+                    gran_params, sphere_data, contact_id, gran_params->static_friction_coeff_s2s,
                     gran_params->K_t_s2s_SU, gran_params->Gamma_t_s2s_SU, hertz_force_factor, m_eff, force_accum,
                     vrel_t, delta_r * reciplength);
 
                 if (gran_params->recording_contactInfo == true) {
                     // record friction force
-                    sphere_data->tangential_friction_force[body_A_offset + contact_id] = tangent_force;
+                    sphere_data->tangential_friction_force[contact_id] = tangent_force;
                     // record rolling resistance torque
                     float3 rolling_resistance_torque =
                         rolling_resist_ang_acc * gran_params->sphereInertia_by_r * gran_params->sphereRadius_SU;
                     if (gran_params->rolling_mode != CHGPU_ROLLING_MODE::NO_RESISTANCE) {
-                        sphere_data->rolling_friction_torque[body_A_offset + contact_id] = rolling_resistance_torque;
+                        sphere_data->rolling_friction_torque[contact_id] = rolling_resistance_torque;
                     }
                 }
 
@@ -939,15 +950,17 @@ static __global__ void computeSphereContactForces_matBased(ChSystemGpu_impl::Gra
                                                            BC_type* bc_type_list,
                                                            BC_params_t<int64_t, int64_t3>* bc_params_list,
                                                            unsigned int nBCs,
-                                                           unsigned int nSpheres) {
+                                                           unsigned int nSpheres,
+                                                           unsigned int firstSphere = 0,
+                                                           unsigned int endSphere = UINT_MAX) {
     // grab the sphere radius
     unsigned int sphereRadius_SU = gran_params->sphereRadius_SU;
 
     // my sphere ID, we're using a 1D thread->sphere map
-    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+    unsigned int mySphereID = firstSphere + threadIdx.x + blockIdx.x * blockDim.x;
 
     // don't overrun the array
-    if (mySphereID < nSpheres) {
+    if (mySphereID < nSpheres && mySphereID < endSphere) {
         // my offset in the contact map
         unsigned int myOwnerSD = sphere_data->sphere_owner_SDs[mySphereID];
 
@@ -968,21 +981,29 @@ static __global__ void computeSphereContactForces_matBased(ChSystemGpu_impl::Gra
         float3 bodyA_force = {0.f, 0.f, 0.f};
         float3 bodyA_AngAcc = {0.f, 0.f, 0.f};
 
-        size_t body_A_offset = MAX_SPHERES_TOUCHED_BY_SPHERE * mySphereID;
+        // slots of this sphere in the contact maps, followed by the overflow pool
+        size_t body_A_begin = sphere_data->contact_offsets[mySphereID];
+        size_t body_A_end = sphere_data->contact_offsets[mySphereID + 1];
+        size_t pool_begin = sphere_data->contact_offsets[nSpheres];
+        unsigned int pool_count = contactPoolCount(sphere_data, gran_params);
+
         // for each sphere contacting me, compute the forces
-        for (unsigned char contact_id = 0; contact_id < MAX_SPHERES_TOUCHED_BY_SPHERE; contact_id++) {
+        for (size_t slot = body_A_begin; slot < body_A_end + pool_count; slot++) {
+            size_t contact_id = slot < body_A_end ? slot : pool_begin + (slot - body_A_end);
             // who am I colliding with?
-            bool active_contact = sphere_data->contact_active_map[body_A_offset + contact_id];
+            bool active_contact = sphere_data->contact_active_map[contact_id] &&
+                                  (slot < body_A_end ||
+                                   sphere_data->contact_pool_owner[slot - body_A_end] == mySphereID);
 
             if (active_contact) {
-                unsigned int theirSphereID = sphere_data->contact_partners_map[body_A_offset + contact_id];
+                unsigned int theirSphereID = sphere_data->contact_partners_map[contact_id];
 
                 // increment contact duration
-                sphere_data->contact_duration[body_A_offset + contact_id] += gran_params->stepSize_SU;
+                sphere_data->contact_duration[contact_id] += gran_params->stepSize_SU;
 
                 if (theirSphereID >= nSpheres) {
                     ABORTABORTABORT("Invalid other sphere id found for sphere %u at slot %u, other is %u\n", mySphereID,
-                                    contact_id, theirSphereID);
+                                    (unsigned int)contact_id, theirSphereID);
                 }
 
                 unsigned int theirOwnerSD = sphere_data->sphere_owner_SDs[theirSphereID];
@@ -1025,12 +1046,12 @@ static __global__ void computeSphereContactForces_matBased(ChSystemGpu_impl::Gra
                 bool calc_rolling_fr =
                     evaluateRollingFriction(gran_params, gran_params->E_eff_s2s_SU, sphereRadius_SU / 2.0f, beta,
                                             gran_params->sphere_mass_SU / 2.f,
-                                            sphere_data->contact_duration[body_A_offset + contact_id], t_collision);
+                                            sphere_data->contact_duration[contact_id], t_collision);
 
                 ////float torque_unit = gran_params->MASS_UNIT * gran_params->LENGTH_UNIT * gran_params->LENGTH_UNIT /
                 ////                    (gran_params->TIME_UNIT * gran_params->TIME_UNIT);
 
-                ////float contact_time = sphere_data->contact_duration[body_A_offset + contact_id] * gran_params->TIME_UNIT;
+                ////float contact_time = sphere_data->contact_duration[contact_id] * gran_params->TIME_UNIT;
                 float3 omega_rel = make_float3(0.0, 0.0, 0.0);
                 float3 v_rot = make_float3(0.0, 0.0, 0.0);
                 if (calc_rolling_fr == true) {
@@ -1045,22 +1066,22 @@ static __global__ void computeSphereContactForces_matBased(ChSystemGpu_impl::Gra
                 }
 
                 float3 tangent_force = computeFrictionForces_matBased(
-                    gran_params, sphere_data, body_A_offset + contact_id, gran_params->static_friction_coeff_s2s,
+                    gran_params, sphere_data, contact_id, gran_params->static_friction_coeff_s2s,
                     gran_params->E_eff_s2s_SU, gran_params->G_eff_s2s_SU, sqrt_Rd, beta, force_accum, vrel_t,
                     contact_normal, m_eff);
 
                 if (gran_params->recording_contactInfo == true) {
                     // record normal froce
-                    sphere_data->normal_contact_force[body_A_offset + contact_id] = force_accum;
+                    sphere_data->normal_contact_force[contact_id] = force_accum;
                     // record friction force
-                    sphere_data->tangential_friction_force[body_A_offset + contact_id] = tangent_force;
+                    sphere_data->tangential_friction_force[contact_id] = tangent_force;
                     // record rolling resistance torque
                     float3 rolling_resistance_torque =
                         rolling_resist_ang_acc * gran_params->sphereInertia_by_r * gran_params->sphereRadius_SU;
                     if (gran_params->rolling_mode != CHGPU_ROLLING_MODE::NO_RESISTANCE) {
-                        sphere_data->rolling_friction_torque[body_A_offset + contact_id] = rolling_resistance_torque;
-                        sphere_data->char_collision_time[body_A_offset + contact_id] = t_collision;
-                        sphere_data->v_rot_array[body_A_offset + contact_id] = v_rot;
+                        sphere_data->rolling_friction_torque[contact_id] = rolling_resistance_torque;
+                        sphere_data->char_collision_time[contact_id] = t_collision;
+                        sphere_data->v_rot_array[contact_id] = v_rot;
                     }
                 }
 
@@ -1208,9 +1229,12 @@ static __global__ void computeSphereForces_frictionless(ChSystemGpu_impl::GranSp
         }
 
         // Write the force back to global memory so that we can apply them AFTER this kernel finishes
-        atomicAdd(sphere_data->sphere_acc_X + mySphereID, bodyA_force.x / gran_params->sphere_mass_SU);
-        atomicAdd(sphere_data->sphere_acc_Y + mySphereID, bodyA_force.y / gran_params->sphere_mass_SU);
-        atomicAdd(sphere_data->sphere_acc_Z + mySphereID, bodyA_force.z / gran_params->sphere_mass_SU);
+        atomicAddShared(sphere_data->sphere_acc_X + mySphereID, bodyA_force.x / gran_params->sphere_mass_SU,
+                        gran_params);
+        atomicAddShared(sphere_data->sphere_acc_Y + mySphereID, bodyA_force.y / gran_params->sphere_mass_SU,
+                        gran_params);
+        atomicAddShared(sphere_data->sphere_acc_Z + mySphereID, bodyA_force.z / gran_params->sphere_mass_SU,
+                        gran_params);
     }
 }
 
@@ -1218,13 +1242,14 @@ static __global__ void computeSphereForces_frictionless_matBased(ChSystemGpu_imp
                                                                  ChSystemGpu_impl::GranParamsPtr gran_params,
                                                                  BC_type* bc_type_list,
                                                                  BC_params_t<int64_t, int64_t3>* bc_params_list,
-                                                                 unsigned int nBCs) {
+                                                                 unsigned int nBCs,
+                                                                 unsigned int firstSD = 0) {
     // store positions relative to *THIS* SD
     __shared__ int3 sphere_pos[MAX_COUNT_OF_SPHERES_PER_SD];
     __shared__ float3 sphere_vel[MAX_COUNT_OF_SPHERES_PER_SD];
     __shared__ not_stupid_bool sphere_fixed[MAX_COUNT_OF_SPHERES_PER_SD];
 
-    unsigned int thisSD = blockIdx.x;
+    unsigned int thisSD = firstSD + blockIdx.x;
     unsigned int spheresTouchingThisSD = sphere_data->SD_NumSpheresTouching[thisSD];
     unsigned int mySphereID;
     unsigned char bodyB_list[MAX_SPHERES_TOUCHED_BY_SPHERE];
@@ -1323,9 +1348,12 @@ static __global__ void computeSphereForces_frictionless_matBased(ChSystemGpu_imp
         }
 
         // Write the force back to global memory so that we can apply them AFTER this kernel finishes
-        atomicAdd(sphere_data->sphere_acc_X + mySphereID, bodyA_force.x / gran_params->sphere_mass_SU);
-        atomicAdd(sphere_data->sphere_acc_Y + mySphereID, bodyA_force.y / gran_params->sphere_mass_SU);
-        atomicAdd(sphere_data->sphere_acc_Z + mySphereID, bodyA_force.z / gran_params->sphere_mass_SU);
+        atomicAddShared(sphere_data->sphere_acc_X + mySphereID, bodyA_force.x / gran_params->sphere_mass_SU,
+                        gran_params);
+        atomicAddShared(sphere_data->sphere_acc_Y + mySphereID, bodyA_force.y / gran_params->sphere_mass_SU,
+                        gran_params);
+        atomicAddShared(sphere_data->sphere_acc_Z + mySphereID, bodyA_force.z / gran_params->sphere_mass_SU,
+                        gran_params);
     }
 }
 
@@ -1352,10 +1380,11 @@ inline __device__ float integrateChung_pos(float stepsize_SU, float vel_old, flo
 static __global__ void integrateSpheres(const float stepsize_SU,
                                         ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                         unsigned int nSpheres,
-                                        ChSystemGpu_impl::GranParamsPtr gran_params) {
+                                        ChSystemGpu_impl::GranParamsPtr gran_params,
+                                        unsigned int firstSphere = 0) {
     // Figure out what sphereID this thread will handle. We work with a 1D block structure and a 1D grid
     // structure
-    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+    unsigned int mySphereID = firstSphere + threadIdx.x + blockIdx.x * blockDim.x;
     // Write back velocity updates
     if (mySphereID < nSpheres && !sphere_data->sphere_fixed[mySphereID]) {
         float curr_acc_X = sphere_data->sphere_acc_X[mySphereID];
@@ -1462,8 +1491,9 @@ static __global__ void integrateSpheres(const float stepsize_SU,
  */
 static __global__ void updateFrictionData(unsigned int frictionHistoryMapSize,
                                           ChSystemGpu_impl::GranSphereDataPtr sphere_data,
-                                          ChSystemGpu_impl::GranParamsPtr gran_params) {
-    unsigned int offsetInFrictionMap = threadIdx.x + blockIdx.x * blockDim.x;
+                                          ChSystemGpu_impl::GranParamsPtr gran_params,
+                                          unsigned int firstOffset = 0) {
+    unsigned int offsetInFrictionMap = firstOffset + threadIdx.x + blockIdx.x * blockDim.x;
 
     if (offsetInFrictionMap < frictionHistoryMapSize) {
         // look at this map contact slot and reset it if that slot wasn't active last timestep
@@ -1491,9 +1521,10 @@ static __global__ void updateFrictionData(unsigned int frictionHistoryMapSize,
 static __global__ void updateAngVels(const float stepsize_SU,
                                      ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                      unsigned int nSpheres,
-                                     ChSystemGpu_impl::GranParamsPtr gran_params) {
+                                     ChSystemGpu_impl::GranParamsPtr gran_params,
+                                     unsigned int firstSphere = 0) {
     // Figure which sphereID this thread handles. We work with a 1D block structure and a 1D grid structure
-    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+    unsigned int mySphereID = firstSphere + threadIdx.x + blockIdx.x * blockDim.x;
 
     if (mySphereID >= nSpheres || sphere_data->sphere_fixed[mySphereID])
         return;
@@ -1526,4 +1557,102 @@ static __global__ void updateAngVels(const float stepsize_SU,
     sphere_data->sphere_Omega_Z[mySphereID] += omega_update_Z;
 }
 
+/// Count the contacts in the overflow pool of the contact maps for each owner sphere.
+/// Run with a single thread, so that the pool (small) is processed in order.
+static __global__ void countContactPoolSlots(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                             ChSystemGpu_impl::GranParamsPtr gran_params,
+                                             unsigned int pool_count,
+                                             unsigned int* num_slots) {
+    size_t pool_begin = sphere_data->contact_offsets[gran_params->nSpheres];
+    for (unsigned int pool_id = 0; pool_id < pool_count; pool_id++) {
+        if (sphere_data->contact_partners_map[pool_begin + pool_id] != NULL_CHGPU_ID)
+            num_slots[sphere_data->contact_pool_owner[pool_id]]++;
+    }
+}
+
+/// Set the number of slots of each sphere in the compacted contact maps: its current contacts (in its slots and in
+/// the overflow pool, see countContactPoolSlots) plus the specified number of spare slots.
+static __global__ void countContactSlots(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                         ChSystemGpu_impl::GranParamsPtr gran_params,
+                                         unsigned int spare_slots,
+                                         unsigned int* num_slots) {
+    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+    if (mySphereID >= gran_params->nSpheres)
+        return;
+
+    unsigned int count = num_slots[mySphereID] + spare_slots;
+    for (size_t slot = sphere_data->contact_offsets[mySphereID]; slot < sphere_data->contact_offsets[mySphereID + 1];
+         slot++) {
+        if (sphere_data->contact_partners_map[slot] != NULL_CHGPU_ID)
+            count++;
+    }
+    num_slots[mySphereID] = min(count, (unsigned int)MAX_SPHERES_TOUCHED_BY_SPHERE);
+}
+
+/// Copy a contact map slot to the compacted contact maps (history and duration only in multi-step friction mode)
+inline __device__ void copyContactSlot(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                       size_t src,
+                                       size_t dst,
+                                       unsigned int* new_partners,
+                                       not_stupid_bool* new_active,
+                                       float3* new_history,
+                                       float* new_duration) {
+    new_partners[dst] = sphere_data->contact_partners_map[src];
+    new_active[dst] = sphere_data->contact_active_map[src];
+    if (new_history) {
+        new_history[dst] = sphere_data->contact_history_map[src];
+        new_duration[dst] = sphere_data->contact_duration[src];
+    }
+}
+
+/// Copy the contacts in the slots of each sphere to the first slots of that sphere in the compacted contact maps.
+/// On return, num_filled holds the number of slots filled for each sphere.
+static __global__ void compactContactSlots(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                           ChSystemGpu_impl::GranParamsPtr gran_params,
+                                           const unsigned int* new_offsets,
+                                           unsigned int* num_filled,
+                                           unsigned int* new_partners,
+                                           not_stupid_bool* new_active,
+                                           float3* new_history,
+                                           float* new_duration) {
+    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+    if (mySphereID >= gran_params->nSpheres)
+        return;
+
+    size_t dst = new_offsets[mySphereID];
+    for (size_t slot = sphere_data->contact_offsets[mySphereID]; slot < sphere_data->contact_offsets[mySphereID + 1];
+         slot++) {
+        if (sphere_data->contact_partners_map[slot] != NULL_CHGPU_ID && dst < new_offsets[mySphereID + 1]) {
+            copyContactSlot(sphere_data, slot, dst, new_partners, new_active, new_history, new_duration);
+            dst++;
+        }
+    }
+    num_filled[mySphereID] = (unsigned int)(dst - new_offsets[mySphereID]);
+}
+
+/// Copy the contacts in the overflow pool to the slots of their owner spheres in the compacted contact maps, after
+/// those copied by compactContactSlots. Run with a single thread, so that the pool (small) is processed in order.
+static __global__ void compactContactPoolSlots(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                               ChSystemGpu_impl::GranParamsPtr gran_params,
+                                               unsigned int pool_count,
+                                               const unsigned int* new_offsets,
+                                               unsigned int* num_filled,
+                                               unsigned int* new_partners,
+                                               not_stupid_bool* new_active,
+                                               float3* new_history,
+                                               float* new_duration) {
+    size_t pool_begin = sphere_data->contact_offsets[gran_params->nSpheres];
+    for (unsigned int pool_id = 0; pool_id < pool_count; pool_id++) {
+        size_t slot = pool_begin + pool_id;
+        unsigned int owner = sphere_data->contact_pool_owner[pool_id];
+        if (sphere_data->contact_partners_map[slot] == NULL_CHGPU_ID)
+            continue;
+        size_t dst = new_offsets[owner] + num_filled[owner];
+        if (dst < new_offsets[owner + 1]) {
+            copyContactSlot(sphere_data, slot, dst, new_partners, new_active, new_history, new_duration);
+            num_filled[owner]++;
+        }
+    }
+}
+
 /// @} gpu_cuda
@@ -153,6 +153,11 @@ __host__ void ChSystemGpuMesh_impl::runTriangleBroadphase() {
     // Run CUB exclusive prefix sum
     cub::DeviceScan::ExclusiveSum(d_scratch_space, temp_storage_bytes, in_ptr, out_ptr, nSDs);
     gpuErrchk(cudaDeviceSynchronize());
+
+    // Record the mesh frames used for binning
+    for (unsigned int fam = 0; fam < meshSoup->numTriangleFamilies; fam++)
+        fam_frame_binned[fam] = tri_params->fam_frame_broad[fam];
+    triangle_bins_valid = true;
 }
 
 __global__ void interactionGranMat_TriangleSoup_matBased(ChSystemGpuMesh_impl::TriangleSoupPtr d_triangleSoup,
@@ -712,6 +717,7 @@ __host__ double ChSystemGpuMesh_impl::AdvanceSimulation(float duration) {
     for (; time_elapsed_SU < stepSize_SU * nsteps; time_elapsed_SU += stepSize_SU) {
         updateBCPositions();
         runSphereBroadphase();
+        updateContactMaps();
 
         resetSphereAccelerations();
         resetBCForces();
@@ -722,7 +728,8 @@ __host__ double ChSystemGpuMesh_impl::AdvanceSimulation(float duration) {
         gpuErrchk(cudaPeekAtLastError());
         gpuErrchk(cudaDeviceSynchronize());
 
-        if (meshSoup->nTrianglesInSoup != 0 && mesh_collision_enabled) {
+        // Re-bin the triangles only if the bins may have been invalidated by the mesh motion
+        if (meshSoup->nTrianglesInSoup != 0 && mesh_collision_enabled && triangleBroadphaseNeeded()) {
             runTriangleBroadphase();
         }
 
@@ -797,7 +804,7 @@ __host__ double ChSystemGpuMesh_impl::AdvanceSimulation(float duration) {
 
         if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
             const unsigned int nThreadsUpdateHist = 2 * CUDA_THREADS_PER_BLOCK;
-            unsigned int fricMapSize = nSpheres * MAX_SPHERES_TOUCHED_BY_SPHERE;
+            unsigned int fricMapSize = (unsigned int)contact_partners_map.size();
             unsigned int nBlocksFricHistoryPostProcess = (fricMapSize + nThreadsUpdateHist - 1) / nThreadsUpdateHist;
             updateFrictionData<<<nBlocksFricHistoryPostProcess, nThreadsUpdateHist>>>(fricMapSize, sphere_data,
                                                                                       gran_params);
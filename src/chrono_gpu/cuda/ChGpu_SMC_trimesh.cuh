@@ -69,23 +69,25 @@ __inline__ __device__ void triangle_figureOutSDBox(const float3& vA,
                                                    const float3& vC,
                                                    int* L,
                                                    int* U,
+                                                   float margin,
                                                    ChSystemGpu_impl::GranParamsPtr gran_params) {
     int64_t min_pt_x = MIN(vA.x, MIN(vB.x, vC.x));
     int64_t min_pt_y = MIN(vA.y, MIN(vB.y, vC.y));
     int64_t min_pt_z = MIN(vA.z, MIN(vB.z, vC.z));
 
-    // Enlarge bounding box
-    min_pt_x -= gran_params->SD_size_X_SU / SAFETY_PARAM;
-    min_pt_y -= gran_params->SD_size_Y_SU / SAFETY_PARAM;
-    min_pt_z -= gran_params->SD_size_Z_SU / SAFETY_PARAM;
+    // Enlarge bounding box (including the margin of persistent bins)
+    int64_t margin_SU = (int64_t)ceilf(margin);
+    min_pt_x -= gran_params->SD_size_X_SU / SAFETY_PARAM + margin_SU;
+    min_pt_y -= gran_params->SD_size_Y_SU / SAFETY_PARAM + margin_SU;
+    min_pt_z -= gran_params->SD_size_Z_SU / SAFETY_PARAM + margin_SU;
 
     int64_t max_pt_x = MAX(vA.x, MAX(vB.x, vC.x));
     int64_t max_pt_y = MAX(vA.y, MAX(vB.y, vC.y));
     int64_t max_pt_z = MAX(vA.z, MAX(vB.z, vC.z));
 
-    max_pt_x += gran_params->SD_size_X_SU / SAFETY_PARAM;
-    max_pt_y += gran_params->SD_size_Y_SU / SAFETY_PARAM;
-    max_pt_z += gran_params->SD_size_Z_SU / SAFETY_PARAM;
+    max_pt_x += gran_params->SD_size_X_SU / SAFETY_PARAM + margin_SU;
+    max_pt_y += gran_params->SD_size_Y_SU / SAFETY_PARAM + margin_SU;
+    max_pt_z += gran_params->SD_size_Z_SU / SAFETY_PARAM + margin_SU;
 
     int3 tmp = pointSDTriplet(min_pt_x, min_pt_y, min_pt_z, gran_params);
     L[0] = tmp.x;
@@ -124,7 +126,7 @@ inline __device__ unsigned int triangle_countTouchedSDs(unsigned int triangleID,
     // bottom-left and top-right corners
     int L[3];
     int U[3];
-    triangle_figureOutSDBox(vA, vB, vC, L, U, gran_params);
+    triangle_figureOutSDBox(vA, vB, vC, L, U, tri_params->broadphase_margin_SU, gran_params);
     // Case 1: All vetices are in the same SD
     if (L[0] == U[0] && L[1] == U[1] && L[2] == U[2]) {
         unsigned int currSD = SDTripletID(L, gran_params);
@@ -169,9 +171,12 @@ inline __device__ unsigned int triangle_countTouchedSDs(unsigned int triangleID,
     for (int i = L[0]; i <= U[0]; i++) {
         for (int j = L[1]; j <= U[1]; j++) {
             for (int k = L[2]; k <= U[2]; k++) {
-                SDhalfSizes[0] = (gran_params->SD_size_X_SU + gran_params->SD_size_X_SU / SAFETY_PARAM) / 2;
-                SDhalfSizes[1] = (gran_params->SD_size_Y_SU + gran_params->SD_size_Y_SU / SAFETY_PARAM) / 2;
-                SDhalfSizes[2] = (gran_params->SD_size_Z_SU + gran_params->SD_size_Z_SU / SAFETY_PARAM) / 2;
+                SDhalfSizes[0] = (gran_params->SD_size_X_SU + gran_params->SD_size_X_SU / SAFETY_PARAM) / 2 +
+                                   tri_params->broadphase_margin_SU;
+                SDhalfSizes[1] = (gran_params->SD_size_Y_SU + gran_params->SD_size_Y_SU / SAFETY_PARAM) / 2 +
+                                   tri_params->broadphase_margin_SU;
+                SDhalfSizes[2] = (gran_params->SD_size_Z_SU + gran_params->SD_size_Z_SU / SAFETY_PARAM) / 2 +
+                                   tri_params->broadphase_margin_SU;
 
                 SDcenter[0] = gran_params->BD_frame_X + (int64_t)(i * 2 + 1) * (int64_t)gran_params->SD_size_X_SU / 2;
                 SDcenter[1] = gran_params->BD_frame_Y + (int64_t)(j * 2 + 1) * (int64_t)gran_params->SD_size_Y_SU / 2;
@@ -216,7 +221,7 @@ inline __device__ void triangle_figureOutTouchedSDs(unsigned int triangleID,
     // bottom-left and top-right corners
     int L[3];
     int U[3];
-    triangle_figureOutSDBox(vA, vB, vC, L, U, gran_params);
+    triangle_figureOutSDBox(vA, vB, vC, L, U, tri_params->broadphase_margin_SU, gran_params);
 
     // TODO modularize more code
     // Case 1: All vetices are in the same SD
@@ -261,9 +266,12 @@ inline __device__ void triangle_figureOutTouchedSDs(unsigned int triangleID,
     for (int i = L[0]; i <= U[0]; i++) {
         for (int j = L[1]; j <= U[1]; j++) {
             for (int k = L[2]; k <= U[2]; k++) {
-                SDhalfSizes[0] = (gran_params->SD_size_X_SU + gran_params->SD_size_X_SU / SAFETY_PARAM) / 2;
-                SDhalfSizes[1] = (gran_params->SD_size_Y_SU + gran_params->SD_size_Y_SU / SAFETY_PARAM) / 2;
-                SDhalfSizes[2] = (gran_params->SD_size_Z_SU + gran_params->SD_size_Z_SU / SAFETY_PARAM) / 2;
+                SDhalfSizes[0] = (gran_params->SD_size_X_SU + gran_params->SD_size_X_SU / SAFETY_PARAM) / 2 +
+                                   tri_params->broadphase_margin_SU;
+                SDhalfSizes[1] = (gran_params->SD_size_Y_SU + gran_params->SD_size_Y_SU / SAFETY_PARAM) / 2 +
+                                   tri_params->broadphase_margin_SU;
+                SDhalfSizes[2] = (gran_params->SD_size_Z_SU + gran_params->SD_size_Z_SU / SAFETY_PARAM) / 2 +
+                                   tri_params->broadphase_margin_SU;
 
                 SDcenter[0] = gran_params->BD_frame_X + (int64_t)(i * 2 + 1) * (int64_t)gran_params->SD_size_X_SU / 2;
                 SDcenter[1] = gran_params->BD_frame_Y + (int64_t)(j * 2 + 1) * (int64_t)gran_params->SD_size_Y_SU / 2;
@@ -12,6 +12,10 @@
 // Authors: Nic Olsen, Ruochun Zhang, Dan Negrut, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <string>
 #include <cmath>
 
@@ -112,6 +116,21 @@ void ChSystemGpu::SetTimeIntegrator(CHGPU_TIME_INTEGRATOR new_integrator) {
     m_sys->time_integrator = new_integrator;
 }
 
+void ChSystemGpu::EnableCudaGraph(bool val) {
+    m_sys->use_step_graph = val;
+}
+
+void ChSystemGpu::SetDevices(const std::vector<int>& devices) {
+    m_sys->setDevices(devices);
+}
+
+void ChSystemGpu::SetContactMapCompaction(unsigned int interval, unsigned int spare_slots, unsigned int pool_size) {
+    m_sys->contact_compaction_interval = interval;
+    m_sys->contact_spare_slots = spare_slots;
+    m_sys->contact_pool_capacity = pool_size;
+    m_sys->steps_since_compaction = 0;
+}
+
 void ChSystemGpu::SetFrictionMode(CHGPU_FRICTION_MODE new_mode) {
     m_sys->gran_params->friction_mode = new_mode;
 }
@@ -323,6 +342,11 @@ void ChSystemGpuMesh::SetMeshVerbosity(CHGPU_MESH_VERBOSITY level) {
     mesh_verbosity = level;
 }
 
+void ChSystemGpuMesh::SetMeshBroadphaseMargin(double margin) {
+    ChSystemGpuMesh_impl* sys_trimesh = static_cast<ChSystemGpuMesh_impl*>(m_sys);
+    sys_trimesh->broadphase_margin_UU = margin;
+}
+
 // -----------------------------------------------------------------------------
 
 size_t ChSystemGpu::CreateBCSphere(const ChVector3f& center,
@@ -1148,7 +1172,8 @@ unsigned int ChSystemGpu::ReadDatParams(std::ifstream& ifile, bool overwrite) {
 // ReadCsvParticles and ReadDatParams to parse in the entire checkpoint file.
 void ChSystemGpu::ReadCheckpointFile(const std::string& infilename, bool overwrite) {
     // Open the file
-    std::ifstream ifile(infilename.c_str());
+    bool binary = IsBinaryCheckpointFile(infilename);
+    std::ifstream ifile(infilename.c_str(), binary ? std::ios::in | std::ios::binary : std::ios::in);
     if (!ifile.is_open()) {
         CHGPU_ERROR("ERROR! Checkpoint file did not open successfully!\n");
     }
@@ -1156,6 +1181,11 @@ void ChSystemGpu::ReadCheckpointFile(const std::string& infilename, bool overwri
     // Let the user know we are loading...
     printf("Reading checkpoint data from file \"%s\"...\n", infilename.c_str());
 
+    if (binary) {
+        ReadBinaryCheckpoint(ifile, "ChSystemGpu", overwrite);
+        return;
+    }
+
     // Process the header
     std::string line;
     std::getline(ifile, line);
@@ -1249,7 +1279,8 @@ bool ChSystemGpuMesh::SetParamsFromIdentifier(const std::string& identifier, std
 // GpuMesh version of checkpointing loading subroutine.
 void ChSystemGpuMesh::ReadCheckpointFile(const std::string& infilename, bool overwrite) {
     // Open the file
-    std::ifstream ifile(infilename.c_str());
+    bool binary = IsBinaryCheckpointFile(infilename);
+    std::ifstream ifile(infilename.c_str(), binary ? std::ios::in | std::ios::binary : std::ios::in);
     if (!ifile.is_open()) {
         CHGPU_ERROR("ERROR! Checkpoint file did not open successfully!\n");
     }
@@ -1257,6 +1288,11 @@ void ChSystemGpuMesh::ReadCheckpointFile(const std::string& infilename, bool ove
     // Let the user know we are loading...
     printf("Reading checkpoint data from file \"%s\"...\n", infilename.c_str());
 
+    if (binary) {
+        ReadBinaryCheckpoint(ifile, "ChSystemGpuMesh", overwrite);
+        return;
+    }
+
     // Process the header
     std::string line;
     std::getline(ifile, line);
@@ -1433,6 +1469,356 @@ void ChSystemGpu::WriteCheckpointFile(const std::string& outfilename) {
     }
 }
 
+// -----------------------------------------------------------------------------
+// Binary checkpoint files
+//
+// Layout: header, simulation params (same text as in a text checkpoint file, padded to 8 bytes), block table, and
+// the block data (each block padded to 8 bytes). All particle data is stored in columns (one block per component),
+// in user units, with MAX_SPHERES_TOUCHED_BY_SPHERE contact slots per sphere.
+// -----------------------------------------------------------------------------
+
+struct BinaryCheckpointHeader {
+    char magic[8];
+    uint64_t params_size;   // length of the system name and params text
+    uint64_t num_spheres;   // number of spheres
+    uint64_t num_blocks;    // number of entries in the block table
+    uint64_t max_partners;  // contact slots per sphere
+};
+
+struct BinaryCheckpointBlock {
+    char name[8];
+    uint64_t elem_size;    // size of one array element (stride of the byte shuffle)
+    uint64_t codec;        // 0: raw, 1: byte-shuffled RLE
+    uint64_t size;         // size of the decoded data
+    uint64_t stored_size;  // size of the data in the file
+};
+
+static const char BINARY_CHECKPOINT_MAGIC[8] = {'C', 'H', 'G', 'P', 'U', 'C', 'P', '1'};
+
+static uint64_t PaddedSize(uint64_t size) {
+    return (size + 7) & ~uint64_t(7);
+}
+
+static void WritePadding(std::ofstream& cpFile, uint64_t size) {
+    static const char zeros[8] = {0};
+    cpFile.write(zeros, PaddedSize(size) - size);
+}
+
+// Group the i-th bytes of all elements together, so that the slowly varying high-order bytes form long runs
+static void ShuffleBytes(const char* in, uint64_t size, uint64_t elem_size, char* out) {
+    uint64_t n = size / elem_size;
+    for (uint64_t i = 0; i < n; i++)
+        for (uint64_t b = 0; b < elem_size; b++)
+            out[b * n + i] = in[i * elem_size + b];
+}
+
+static void UnshuffleBytes(const char* in, uint64_t size, uint64_t elem_size, char* out) {
+    uint64_t n = size / elem_size;
+    for (uint64_t i = 0; i < n; i++)
+        for (uint64_t b = 0; b < elem_size; b++)
+            out[i * elem_size + b] = in[b * n + i];
+}
+
+// Run-length encoding: a control byte c < 128 is followed by c+1 literal bytes; a control byte c >= 128 is followed
+// by one byte repeated c-126 times.
+static void CompressRLE(const std::vector<char>& in, std::vector<char>& out) {
+    size_t n = in.size();
+    size_t i = 0;
+    out.clear();
+    while (i < n) {
+        size_t run = 1;
+        while (i + run < n && run < 129 && in[i + run] == in[i])
+            run++;
+        if (run >= 3) {
+            out.push_back((char)(run + 126));
+            out.push_back(in[i]);
+            i += run;
+            continue;
+        }
+        size_t start = i;
+        size_t len = 0;
+        while (i < n && len < 128) {
+            if (i + 2 < n && in[i] == in[i + 1] && in[i] == in[i + 2])
+                break;
+            i++;
+            len++;
+        }
+        out.push_back((char)(len - 1));
+        out.insert(out.end(), in.begin() + start, in.begin() + start + len);
+    }
+}
+
+static bool DecompressRLE(const char* in, uint64_t in_size, char* out, uint64_t out_size) {
+    uint64_t i = 0;
+    uint64_t k = 0;
+    while (i < in_size) {
+        unsigned char c = (unsigned char)in[i++];
+        if (c < 128) {
+            uint64_t len = c + 1;
+            if (i + len > in_size || k + len > out_size)
+                return false;
+            memcpy(out + k, in + i, len);
+            i += len;
+            k += len;
+        } else {
+            uint64_t run = c - 126;
+            if (i >= in_size || k + run > out_size)
+                return false;
+            memset(out + k, in[i++], run);
+            k += run;
+        }
+    }
+    return k == out_size;
+}
+
+bool ChSystemGpu::IsBinaryCheckpointFile(const std::string& infilename) {
+    std::ifstream ifile(infilename.c_str(), std::ios::in | std::ios::binary);
+    char magic[8];
+    if (!ifile.read(magic, 8))
+        return false;
+    return memcmp(magic, BINARY_CHECKPOINT_MAGIC, 8) == 0;
+}
+
+void ChSystemGpu::WriteBinaryCheckpointFile(const std::string& outfilename, bool compress) {
+    printf("Writing binary checkpoint data to file \"%s\"\n", outfilename.c_str());
+    std::ofstream cpFile(outfilename, std::ios::out | std::ios::binary);
+
+    // Room for the header, completed once the data is written
+    BinaryCheckpointHeader header = {};
+    cpFile.write((const char*)&header, sizeof(header));
+
+    // System name and simulation params, as in a text checkpoint file
+    cpFile << std::string("ChSystemGpu\n");
+    WriteCheckpointParams(cpFile);
+    cpFile << std::string("ParamsEnd\n");
+
+    WriteBinaryCheckpointData(cpFile, compress);
+}
+
+void ChSystemGpu::WriteBinaryCheckpointData(std::ofstream& cpFile, bool compress) const {
+    uint64_t params_size = (uint64_t)cpFile.tellp() - sizeof(BinaryCheckpointHeader);
+    WritePadding(cpFile, params_size);
+
+    // Copy the sphere state to pinned host memory and convert it to user units
+    std::unique_ptr<ChSystemGpu_impl::ParticleSnapshot> snapshot = m_sys->CopyParticleState();
+    const ChSystemGpu_impl::ParticleSnapshot& s = *snapshot;
+    unsigned int nSpheres = s.params.nSpheres;
+    bool friction = s.params.friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS;
+    double VEL_SU2UU = m_sys->LENGTH_SU2UU / m_sys->TIME_SU2UU;
+
+    std::vector<float> x(nSpheres), y(nSpheres), z(nSpheres);
+    std::vector<float> vx(nSpheres), vy(nSpheres), vz(nSpheres);
+    std::vector<float> wx, wy, wz;
+    std::vector<uint8_t> fixed(nSpheres);
+    if (friction) {
+        wx.resize(nSpheres);
+        wy.resize(nSpheres);
+        wz.resize(nSpheres);
+    }
+    for (unsigned int n = 0; n < nSpheres; n++) {
+        int3 trip = m_sys->getSDTripletFromID(s.owner_SDs[n], s.params);
+        x[n] = (float)((s.pos_X[n] + s.params.BD_frame_X + (int64_t)trip.x * s.params.SD_size_X_SU) *
+                       m_sys->LENGTH_SU2UU);
+        y[n] = (float)((s.pos_Y[n] + s.params.BD_frame_Y + (int64_t)trip.y * s.params.SD_size_Y_SU) *
+                       m_sys->LENGTH_SU2UU);
+        z[n] = (float)((s.pos_Z[n] + s.params.BD_frame_Z + (int64_t)trip.z * s.params.SD_size_Z_SU) *
+                       m_sys->LENGTH_SU2UU);
+        vx[n] = (float)(s.vel_X[n] * VEL_SU2UU);
+        vy[n] = (float)(s.vel_Y[n] * VEL_SU2UU);
+        vz[n] = (float)(s.vel_Z[n] * VEL_SU2UU);
+        fixed[n] = s.fixed[n] ? 1 : 0;
+        if (friction) {
+            wx[n] = (float)(s.omega_X[n] / m_sys->TIME_SU2UU);
+            wy[n] = (float)(s.omega_Y[n] / m_sys->TIME_SU2UU);
+            wz[n] = (float)(s.omega_Z[n] / m_sys->TIME_SU2UU);
+        }
+    }
+
+    std::vector<unsigned int> partners;
+    std::vector<float3> history;
+    if (friction)
+        GatherContactHistory(partners, history);
+
+    // Collect the blocks, encoding them if requested (and only if that makes them smaller)
+    std::vector<BinaryCheckpointBlock> table;
+    std::vector<std::vector<char>> encoded;
+    std::vector<const char*> stored;
+    auto add_block = [&](const char* name, const void* data, uint64_t size, uint64_t elem_size) {
+        BinaryCheckpointBlock block = {};
+        strncpy(block.name, name, sizeof(block.name));
+        block.elem_size = elem_size;
+        block.codec = 0;
+        block.size = size;
+        block.stored_size = size;
+        const char* bytes = (const char*)data;
+        if (compress && size > 0) {
+            std::vector<char> shuffled(size);
+            ShuffleBytes(bytes, size, elem_size, shuffled.data());
+            std::vector<char> rle;
+            CompressRLE(shuffled, rle);
+            if (rle.size() < size) {
+                block.codec = 1;
+                block.stored_size = rle.size();
+                encoded.push_back(std::move(rle));
+                bytes = encoded.back().data();
+            }
+        }
+        table.push_back(block);
+        stored.push_back(bytes);
+    };
+
+    add_block("x", x.data(), nSpheres * sizeof(float), sizeof(float));
+    add_block("y", y.data(), nSpheres * sizeof(float), sizeof(float));
+    add_block("z", z.data(), nSpheres * sizeof(float), sizeof(float));
+    add_block("vx", vx.data(), nSpheres * sizeof(float), sizeof(float));
+    add_block("vy", vy.data(), nSpheres * sizeof(float), sizeof(float));
+    add_block("vz", vz.data(), nSpheres * sizeof(float), sizeof(float));
+    add_block("fixed", fixed.data(), nSpheres * sizeof(uint8_t), sizeof(uint8_t));
+    if (friction) {
+        add_block("wx", wx.data(), nSpheres * sizeof(float), sizeof(float));
+        add_block("wy", wy.data(), nSpheres * sizeof(float), sizeof(float));
+        add_block("wz", wz.data(), nSpheres * sizeof(float), sizeof(float));
+        add_block("partner", partners.data(), partners.size() * sizeof(unsigned int), sizeof(unsigned int));
+        if (!history.empty())
+            add_block("history", history.data(), history.size() * sizeof(float3), sizeof(float));
+    }
+
+    // Block table, followed by the block data
+    cpFile.write((const char*)table.data(), table.size() * sizeof(BinaryCheckpointBlock));
+    for (size_t i = 0; i < table.size(); i++) {
+        cpFile.write(stored[i], table[i].stored_size);
+        WritePadding(cpFile, table[i].stored_size);
+    }
+
+    // Complete the header
+    BinaryCheckpointHeader header;
+    memcpy(header.magic, BINARY_CHECKPOINT_MAGIC, sizeof(header.magic));
+    header.params_size = params_size;
+    header.num_spheres = nSpheres;
+    header.num_blocks = table.size();
+    header.max_partners = MAX_SPHERES_TOUCHED_BY_SPHERE;
+    cpFile.seekp(0);
+    cpFile.write((const char*)&header, sizeof(header));
+}
+
+void ChSystemGpu::ReadBinaryCheckpoint(std::ifstream& ifile, const std::string& system_name, bool overwrite) {
+    BinaryCheckpointHeader header;
+    ifile.read((char*)&header, sizeof(header));
+
+    // Process the system name and load all simulation parameters
+    std::string line;
+    std::getline(ifile, line);
+    if (line != system_name)
+        printf(
+            "WARNING! Header of checkpoint file indicates this is not for %s (and it seems to be for %s)! "
+            "There may still be parameters defaulted after loading this checkpoint file, and you may want to set "
+            "them manually.\n",
+            system_name.c_str(), line.c_str());
+    unsigned int nSpheres = ReadDatParams(ifile, overwrite);
+    if (nSpheres != header.num_spheres)
+        CHGPU_ERROR("ERROR! Inconsistent number of particles in binary checkpoint file!\n");
+
+    // Block table, then all block data with a single read
+    ifile.seekg(sizeof(header) + PaddedSize(header.params_size));
+    std::vector<BinaryCheckpointBlock> table(header.num_blocks);
+    ifile.read((char*)table.data(), table.size() * sizeof(BinaryCheckpointBlock));
+    uint64_t data_size = 0;
+    for (const auto& block : table)
+        data_size += PaddedSize(block.stored_size);
+    std::vector<char> data(data_size);
+    ifile.read(data.data(), data_size);
+    if (!ifile)
+        CHGPU_ERROR("ERROR! Binary checkpoint file is truncated!\n");
+
+    std::vector<float> x, y, z, vx, vy, vz, wx, wy, wz;
+    std::vector<uint8_t> fixed;
+    std::vector<unsigned int> partner;
+    std::vector<float3> history;
+
+    // Decode a block into the given array, which must have the size of the decoded data
+    auto decode = [&](const BinaryCheckpointBlock& block, const char* src, void* dst, uint64_t size) {
+        if (block.size != size)
+            CHGPU_ERROR("ERROR! Unexpected size of block %.8s in binary checkpoint file!\n", block.name);
+        if (block.codec == 0) {
+            memcpy(dst, src, size);
+        } else {
+            std::vector<char> shuffled(size);
+            if (!DecompressRLE(src, block.stored_size, shuffled.data(), size))
+                CHGPU_ERROR("ERROR! Corrupted block %.8s in binary checkpoint file!\n", block.name);
+            UnshuffleBytes(shuffled.data(), size, block.elem_size, (char*)dst);
+        }
+    };
+    auto decode_column = [&](const BinaryCheckpointBlock& block, const char* src, std::vector<float>& column) {
+        column.resize(nSpheres);
+        decode(block, src, column.data(), nSpheres * sizeof(float));
+    };
+
+    uint64_t num_slots = (uint64_t)nSpheres * header.max_partners;
+    const char* src = data.data();
+    for (const auto& block : table) {
+        std::string name(block.name, strnlen(block.name, sizeof(block.name)));
+        if (name == "x")
+            decode_column(block, src, x);
+        else if (name == "y")
+            decode_column(block, src, y);
+        else if (name == "z")
+            decode_column(block, src, z);
+        else if (name == "vx")
+            decode_column(block, src, vx);
+        else if (name == "vy")
+            decode_column(block, src, vy);
+        else if (name == "vz")
+            decode_column(block, src, vz);
+        else if (name == "wx")
+            decode_column(block, src, wx);
+        else if (name == "wy")
+            decode_column(block, src, wy);
+        else if (name == "wz")
+            decode_column(block, src, wz);
+        else if (name == "fixed") {
+            fixed.resize(nSpheres);
+            decode(block, src, fixed.data(), nSpheres * sizeof(uint8_t));
+        } else if (name == "partner") {
+            partner.resize(num_slots);
+            decode(block, src, partner.data(), num_slots * sizeof(unsigned int));
+        } else if (name == "history") {
+            history.resize(num_slots);
+            decode(block, src, history.data(), num_slots * sizeof(float3));
+        } else
+            printf("WARNING! %s is an unknown block in binary checkpoint file, skipped.\n", name.c_str());
+        src += PaddedSize(block.stored_size);
+    }
+    if (x.size() != nSpheres || y.size() != nSpheres || z.size() != nSpheres)
+        CHGPU_ERROR("ERROR! Binary checkpoint file has no particle positions!\n");
+
+    // Feed data to the system, as in ReadCsvParticles and ReadHstHistory
+    std::vector<float3> pointsFloat3(nSpheres);
+    std::vector<float3> velsFloat3(nSpheres, make_float3(0, 0, 0));
+    std::vector<float3> angVelsFloat3(nSpheres, make_float3(0, 0, 0));
+    std::vector<bool> fixity(nSpheres, false);
+    for (unsigned int n = 0; n < nSpheres; n++) {
+        pointsFloat3[n] = make_float3(x[n], y[n], z[n]);
+        if (vx.size() == nSpheres && vy.size() == nSpheres && vz.size() == nSpheres)
+            velsFloat3[n] = make_float3(vx[n], vy[n], vz[n]);
+        if (wx.size() == nSpheres && wy.size() == nSpheres && wz.size() == nSpheres)
+            angVelsFloat3[n] = make_float3(wx[n], wy[n], wz[n]);
+        if (fixed.size() == nSpheres)
+            fixity[n] = fixed[n] != 0;
+    }
+    m_sys->SetParticles(pointsFloat3, velsFloat3, angVelsFloat3);
+    m_sys->user_sphere_fixed = fixity;
+
+    if (m_sys->gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS && !partner.empty()) {
+        history.resize(num_slots, make_float3(0, 0, 0));
+        m_sys->user_partner_map = partner;
+        m_sys->user_friction_history = history;
+    }
+
+    // Keep the particle order of the checkpointed simulation
+    if (nSpheres > 0)
+        m_sys->defragment_on_start = false;
+}
+
 void ChSystemGpu::WriteRawParticles(std::ofstream& ptFile) const {
     m_sys->WriteRawParticles(ptFile);
 }
@@ -1452,24 +1838,17 @@ void ChSystemGpu::WriteH5Particles(H5::H5File ptFile) const {
 #endif
 
 void ChSystemGpu::WriteParticleFile(const std::string& outfilename) const {
-    // The file writes are a pretty big slowdown in CSV mode
-    if (m_sys->file_write_mode == CHGPU_OUTPUT_MODE::BINARY) {
-        std::ofstream ptFile(outfilename, std::ios::out | std::ios::binary);
-        WriteRawParticles(ptFile);
-    } else if (m_sys->file_write_mode == CHGPU_OUTPUT_MODE::CSV) {
-        std::ofstream ptFile(outfilename, std::ios::out);
-        WriteCsvParticles(ptFile);
-    } else if (m_sys->file_write_mode == CHGPU_OUTPUT_MODE::CHPF) {
-        std::ofstream ptFile(outfilename, std::ios::out | std::ios::binary);
-        WriteChPFParticles(ptFile);
-    } else if (m_sys->file_write_mode == CHGPU_OUTPUT_MODE::HDF5) {
-#ifdef USE_HDF5
-        H5::H5File ptFile(outfilename.c_str(), H5F_ACC_TRUNC);
-        WriteH5Particles(ptFile);
-#else
-        CHGPU_ERROR("ERROR! HDF5 Installation not found. Recompile with HDF5.\n");
-#endif
-    }
+    ChSystemGpu_impl::ParticleSnapshot s;
+    m_sys->GetParticleState(s);
+    m_sys->WriteParticleFile(outfilename, s);
+}
+
+void ChSystemGpu::WriteParticleFileAsync(const std::string& outfilename) {
+    m_sys->WriteParticleFileAsync(outfilename);
+}
+
+void ChSystemGpu::WaitParticleOutput() {
+    m_sys->WaitParticleOutput();
 }
 
 void ChSystemGpu::WriteContactInfoFile(const std::string& outfilename) const {
@@ -1506,22 +1885,19 @@ void ChSystemGpu::WriteHstHistory(std::ofstream& histFile) const {
 
     // We'll use space-separated formatting, as I found it more convenient to parse in and looks better.
     // Forget about CSV conventions, history info is not meant to be used by third-party tools anyway.
-    float3 history_UU;
+    std::vector<unsigned int> partners;
+    std::vector<float3> history;
+    GatherContactHistory(partners, history);
     for (unsigned int n = 0; n < m_sys->nSpheres; n++) {
         // Write contact_partners_map
         if (formatMode & 1) {
             for (unsigned int i = 0; i < MAX_SPHERES_TOUCHED_BY_SPHERE; i++)
-                outstrstream << m_sys->contact_partners_map[MAX_SPHERES_TOUCHED_BY_SPHERE * n + i] << " ";
+                outstrstream << partners[n * MAX_SPHERES_TOUCHED_BY_SPHERE + i] << " ";
         }
         // Write write contact_history_map
         if (formatMode & 2) {
             for (unsigned int i = 0; i < MAX_SPHERES_TOUCHED_BY_SPHERE; i++) {
-                history_UU.x =
-                    m_sys->contact_history_map[MAX_SPHERES_TOUCHED_BY_SPHERE * n + i].x * m_sys->LENGTH_SU2UU;
-                history_UU.y =
-                    m_sys->contact_history_map[MAX_SPHERES_TOUCHED_BY_SPHERE * n + i].y * m_sys->LENGTH_SU2UU;
-                history_UU.z =
-                    m_sys->contact_history_map[MAX_SPHERES_TOUCHED_BY_SPHERE * n + i].z * m_sys->LENGTH_SU2UU;
+                const float3& history_UU = history[n * MAX_SPHERES_TOUCHED_BY_SPHERE + i];
                 outstrstream << history_UU.x << " " << history_UU.y << " " << history_UU.z << " ";
             }
         }
@@ -1531,6 +1907,33 @@ void ChSystemGpu::WriteHstHistory(std::ofstream& histFile) const {
     histFile << outstrstream.str();
 }
 
+// The contact partners and history always have MAX_SPHERES_TOUCHED_BY_SPHERE entries per sphere, independently of the
+// layout of the (possibly compacted) contact maps; unused entries are empty slots.
+void ChSystemGpu::GatherContactHistory(std::vector<unsigned int>& partners, std::vector<float3>& history) const {
+    bool multi_step = m_sys->gran_params->friction_mode == CHGPU_FRICTION_MODE::MULTI_STEP;
+    size_t num_slots = (size_t)m_sys->nSpheres * MAX_SPHERES_TOUCHED_BY_SPHERE;
+    partners.assign(num_slots, NULL_CHGPU_ID);
+    history.assign(multi_step ? num_slots : 0, make_float3(0, 0, 0));
+
+    for (unsigned int n = 0; n < m_sys->nSpheres; n++) {
+        std::vector<size_t> slots = m_sys->getContactSlots(n);
+        if (slots.size() > MAX_SPHERES_TOUCHED_BY_SPHERE) {
+            auto empty = [&](size_t slot) { return m_sys->contact_partners_map[slot] == NULL_CHGPU_ID; };
+            slots.erase(std::remove_if(slots.begin(), slots.end(), empty), slots.end());
+            slots.resize(std::min(slots.size(), (size_t)MAX_SPHERES_TOUCHED_BY_SPHERE));
+        }
+        size_t offset = (size_t)n * MAX_SPHERES_TOUCHED_BY_SPHERE;
+        for (size_t i = 0; i < slots.size(); i++) {
+            partners[offset + i] = m_sys->contact_partners_map[slots[i]];
+            if (multi_step) {
+                history[offset + i].x = (float)(m_sys->contact_history_map[slots[i]].x * m_sys->LENGTH_SU2UU);
+                history[offset + i].y = (float)(m_sys->contact_history_map[slots[i]].y * m_sys->LENGTH_SU2UU);
+                history[offset + i].z = (float)(m_sys->contact_history_map[slots[i]].z * m_sys->LENGTH_SU2UU);
+            }
+        }
+    }
+}
+
 void ChSystemGpu::WriteContactHistoryFile(const std::string& outfilename) const {
     printf("Writing contact pair/history data to file \"%s\"\n", outfilename.c_str());
     std::ofstream histFile(outfilename, std::ios::out);
@@ -1558,6 +1961,24 @@ void ChSystemGpuMesh::WriteCheckpointMeshParams(std::ofstream& cpFile) const {
 
     cpFile << paramStream.str();
 }
+// GpuMesh version of binary checkpoint writing
+void ChSystemGpuMesh::WriteBinaryCheckpointFile(const std::string& outfilename, bool compress) {
+    printf("Writing binary checkpoint data to file \"%s\"\n", outfilename.c_str());
+    std::ofstream cpFile(outfilename, std::ios::out | std::ios::binary);
+
+    // Room for the header, completed once the data is written
+    BinaryCheckpointHeader header = {};
+    cpFile.write((const char*)&header, sizeof(header));
+
+    // System name and simulation params, as in a text checkpoint file
+    cpFile << std::string("ChSystemGpuMesh\n");
+    WriteCheckpointParams(cpFile);
+    WriteCheckpointMeshParams(cpFile);  // Meshed system has extra params
+    cpFile << std::string("ParamsEnd\n");
+
+    WriteBinaryCheckpointData(cpFile, compress);
+}
+
 // GpuMesh version of checkpoint writing
 void ChSystemGpuMesh::WriteCheckpointFile(const std::string& outfilename) {
     printf("Writing checkpoint data to file \"%s\"\n", outfilename.c_str());
@@ -61,7 +61,8 @@ class CH_GPU_API ChSystemGpu {
     /// Set particle contact friction history from a file.
     void ReadContactHistoryFile(const std::string& infilename);
 
-    // Read in a (Chrono::Gpu generated) checkpoint file to restart a simulation.
+    /// Read in a (Chrono::Gpu generated) checkpoint file to restart a simulation.
+    /// Both the text and the binary checkpoint formats are accepted; the format is detected from the file header.
     void ReadCheckpointFile(const std::string& infilename, bool overwrite = false);
 
     /// Set the big domain to be fixed or not.
@@ -98,6 +99,32 @@ class CH_GPU_API ChSystemGpu {
     /// Set the time integration scheme for the system.
     void SetTimeIntegrator(CHGPU_TIME_INTEGRATOR new_integrator);
 
+    /// Enable/disable replay of the per-step kernels through a CUDA graph (default: false).
+    /// If enabled, the sphere force and integration kernels of a step are captured once and replayed with a single
+    /// synchronization per step, reducing launch overhead for small to mid-size systems. The broadphase is not part of
+    /// the graph. Ignored for systems with meshes.
+    void EnableCudaGraph(bool val);
+
+    /// Distribute the per-step sphere force and integration kernels over the specified CUDA devices.
+    /// The subdomains (SDs) are split in slabs along X, one per device, with roughly the same number of spheres. The
+    /// sphere data remains in unified memory, with the data of each partition preferably located on its device;
+    /// spheres in the SDs at the boundary between two slabs are accessed in place by both devices (through peer access
+    /// where available) and contributions to them are accumulated with system-scope atomics. The broadphase runs on
+    /// the first device. If more than one device is specified, this takes precedence over EnableCudaGraph. Ignored for
+    /// systems with meshes.
+    /// Note: this is an experimental feature, not yet validated on multi-GPU hardware (see the gpuMultiDevice unit test,
+    /// which compares a settling problem on one and two devices).
+    void SetDevices(const std::vector<int>& devices);
+
+    /// Enable compaction of the contact maps (ignored for the frictionless model).
+    /// By default, each sphere has MAX_SPHERES_TOUCHED_BY_SPHERE contact slots. If compaction is enabled, every
+    /// 'interval' steps (after the broadphase) the contact maps are rebuilt with as many slots per sphere as its
+    /// current contacts plus 'spare_slots' (at most MAX_SPHERES_TOUCHED_BY_SPHERE), followed by an overflow pool of
+    /// 'pool_size' slots (0: max(1024, number of spheres / 8)) used by spheres acquiring new contacts once their own
+    /// slots are taken. The simulation is aborted if the pool runs out. This reduces the memory footprint and traffic
+    /// of the contact maps for loosely packed systems; the layout of the contact history file is not affected.
+    void SetContactMapCompaction(unsigned int interval, unsigned int spare_slots = 2, unsigned int pool_size = 0);
+
     /// Set friction formulation.
     /// The frictionless setting uses a streamlined solver and avoids storing any physics information associated with
     /// friction.
@@ -310,9 +337,26 @@ class CH_GPU_API ChSystemGpu {
     /// All information defining a simulation is in this file.
     void WriteCheckpointFile(const std::string& outfilename);
 
+    /// Write a one-stop checkpoint file for Chrono::Gpu, in binary format.
+    /// The simulation parameters are followed by columnar blocks of raw arrays (positions, velocities, angular
+    /// velocities, fixity, contact partners and friction history), copied from the device through pinned host memory.
+    /// The file is read back with ReadCheckpointFile, with a single read of the particle data. If requested, each
+    /// block is compressed with a byte-shuffled run-length encoding, effective on the empty slots of the contact
+    /// history and on the slowly varying high-order bytes of the kinematics of a settled bed.
+    void WriteBinaryCheckpointFile(const std::string& outfilename, bool compress = false);
+
     /// Write particle positions according to the system output mode.
     void WriteParticleFile(const std::string& outfilename) const;
 
+    /// Write particle positions according to the system output mode, from a background thread.
+    /// The particle state is copied to pinned host memory before returning, so the simulation can be advanced while
+    /// the output is formatted and written. Only one output is in flight at a time: a call waits for the completion
+    /// of the previous one.
+    void WriteParticleFileAsync(const std::string& outfilename);
+
+    /// Wait for the completion of any pending asynchronous particle output.
+    void WaitParticleOutput();
+
     /// Write contact pair history to a file.
     void WriteContactHistoryFile(const std::string& outfilename) const;
 
@@ -385,6 +429,21 @@ class CH_GPU_API ChSystemGpu {
     /// WriteCheckpointFile() and WriteContactHistoryFile() are its wrappers.
     void WriteHstHistory(std::ofstream& histFile) const;
 
+    /// Gather the contact partners and friction history (in user units), with MAX_SPHERES_TOUCHED_BY_SPHERE slots per
+    /// sphere independently of the layout of the contact maps. The history is only gathered for the multi-step model.
+    void GatherContactHistory(std::vector<unsigned int>& partners, std::vector<float3>& history) const;
+
+    /// Write the particle data of a binary checkpoint file, after the system name and simulation params.
+    /// WriteBinaryCheckpointFile() is its wrapper.
+    void WriteBinaryCheckpointData(std::ofstream& cpFile, bool compress) const;
+
+    /// Read a binary checkpoint file stream, positioned after the file identifier, checking the system name.
+    /// ReadCheckpointFile() is its wrapper.
+    void ReadBinaryCheckpoint(std::ifstream& ifile, const std::string& system_name, bool overwrite);
+
+    /// Return true if the given file is a binary checkpoint file.
+    static bool IsBinaryCheckpointFile(const std::string& infilename);
+
     /// Set gravitational acceleration as a float3 vector.
     void SetGravitationalAcceleration(const float3 g);
 
@@ -482,6 +541,13 @@ class CH_GPU_API ChSystemGpuMesh : public ChSystemGpu {
     /// Set verbosity level of mesh operations.
     void SetMeshVerbosity(CHGPU_MESH_VERBOSITY level);
 
+    /// Set the margin of the persistent triangle broadphase bins (default: 0).
+    /// Triangles are binned in all SDs within this distance, so that the bins remain valid (and the triangle broadphase
+    /// is skipped) as long as no mesh moved by more than this margin since the last binning. A larger margin results in
+    /// more triangles per SD. With a zero margin, the triangle broadphase is skipped only while the meshes are at rest.
+    /// This function must be called before Initialize().
+    void SetMeshBroadphaseMargin(double margin);
+
     /// Initialize simulation so that it can be advanced.
     /// Must be called before AdvanceSimulation and after simulation parameters are set.
     /// This function initializes both the granular material and any existing trimeshes.
@@ -507,6 +573,9 @@ class CH_GPU_API ChSystemGpuMesh : public ChSystemGpu {
     /// GpuMesh version of checkpoint generating subroutine. Has a bit more content than parent.
     void WriteCheckpointFile(const std::string& outfilename);
 
+    /// GpuMesh version of binary checkpoint generating subroutine. Has a bit more content than parent.
+    void WriteBinaryCheckpointFile(const std::string& outfilename, bool compress = false);
+
     /// Write the i-th mesh cached in m_meshes, with the current position.
     void WriteMesh(const std::string& outfilename, unsigned int i) const;
 
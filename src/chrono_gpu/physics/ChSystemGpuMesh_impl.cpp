@@ -136,6 +136,19 @@ void ChSystemGpuMesh_impl::initializeTriangles() {
         tri_params->fam_frame_narrow[fam].pos[2] = (double)0.0;
     }
 
+    // Bounding radius of each family, used to bound the vertex displacements for the persistent triangle bins
+    tri_params->broadphase_margin_SU = (float)(broadphase_margin_UU / LENGTH_SU2UU);
+    fam_radius_UU.assign(meshSoup->numTriangleFamilies, 0.0);
+    for (unsigned int tri = 0; tri < meshSoup->nTrianglesInSoup; tri++) {
+        unsigned int fam = meshSoup->triangleFamily_ID[tri];
+        for (const float3& v : {meshSoup->node1[tri], meshSoup->node2[tri], meshSoup->node3[tri]}) {
+            double r = std::sqrt((double)v.x * v.x + (double)v.y * v.y + (double)v.z * v.z);
+            fam_radius_UU[fam] = std::max(fam_radius_UU[fam], r);
+        }
+    }
+    fam_frame_binned.resize(meshSoup->numTriangleFamilies);
+    triangle_bins_valid = false;
+
     TRACK_VECTOR_RESIZE(SD_numTrianglesTouching, nSDs, "SD_numTrianglesTouching", 0);
     TRACK_VECTOR_RESIZE(SD_TrianglesCompositeOffsets, nSDs, "SD_TrianglesCompositeOffsets", 0);
 
@@ -147,6 +160,28 @@ void ChSystemGpuMesh_impl::initializeTriangles() {
     TRACK_VECTOR_RESIZE(SD_trianglesInEachSD_composite, 0, "SD_trianglesInEachSD_composite", 0);
 }
 
+// For a rigid mesh, the displacement of any vertex p since the last binning is bounded by
+//    |(pos + R * p) - (pos0 + R0 * p)| <= |pos - pos0| + ||R - R0||_F * |p|
+bool ChSystemGpuMesh_impl::triangleBroadphaseNeeded() const {
+    if (!triangle_bins_valid)
+        return true;
+
+    for (unsigned int fam = 0; fam < meshSoup->numTriangleFamilies; fam++) {
+        const MeshFrame<float>& frame = tri_params->fam_frame_broad[fam];
+        const MeshFrame<float>& frame0 = fam_frame_binned[fam];
+        double dpos = 0;
+        double drot = 0;
+        for (int i = 0; i < 3; i++)
+            dpos += (double)(frame.pos[i] - frame0.pos[i]) * (frame.pos[i] - frame0.pos[i]);
+        for (int i = 0; i < 9; i++)
+            drot += (double)(frame.rot_mat[i] - frame0.rot_mat[i]) * (frame.rot_mat[i] - frame0.rot_mat[i]);
+        if (std::sqrt(dpos) + std::sqrt(drot) * fam_radius_UU[fam] > broadphase_margin_UU)
+            return true;
+    }
+
+    return false;
+}
+
 // p = pos + rot_mat * p
 void ChSystemGpuMesh_impl::ApplyFrameTransform(float3& p, float* pos, float* rot_mat) {
     float3 result;
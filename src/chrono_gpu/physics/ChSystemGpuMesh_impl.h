@@ -82,6 +82,9 @@ class ChSystemGpuMesh_impl : public ChSystemGpu_impl {
 
         /// Reference frames of the triangle families in double precision
         MeshFrame<double>* fam_frame_narrow;
+
+        /// Enlargement of the triangle bounding boxes in the triangle broadphase, expressed in SU
+        float broadphase_margin_SU;
     };
 
     /// Structure used to hold pointers for mesh arrays.
@@ -142,6 +145,10 @@ class ChSystemGpuMesh_impl : public ChSystemGpu_impl {
     /// Broadphase CD for triangles
     void runTriangleBroadphase();
 
+    /// Check whether the triangle broadphase must be performed, i.e., whether the motion of any mesh since the last
+    /// triangle broadphase may exceed the bin margin.
+    bool triangleBroadphaseNeeded() const;
+
     virtual double get_max_K() const override;
 
     template <typename T>
@@ -193,6 +200,18 @@ class ChSystemGpuMesh_impl : public ChSystemGpu_impl {
     /// Enable or disable collision between spheres and meshes
     bool mesh_collision_enabled = true;
 
+    /// Margin of the persistent triangle bins, in user units
+    double broadphase_margin_UU = 0;
+
+    /// Are the triangle bins valid? (false until the first triangle broadphase)
+    bool triangle_bins_valid = false;
+
+    /// Reference frames of the triangle families at the last triangle broadphase
+    std::vector<MeshFrame<float>> fam_frame_binned;
+
+    /// Radius of each triangle family (max. distance of a vertex from the family origin), in user units
+    std::vector<double> fam_radius_UU;
+
     /// stores list of triangles touching each SD; goes SD by SD; size can change during simulation
     std::vector<unsigned int, cudallocator<unsigned int>> SD_trianglesInEachSD_composite;
 
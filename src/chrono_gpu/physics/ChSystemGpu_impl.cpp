@@ -92,6 +92,8 @@ ChSystemGpu_impl::ChSystemGpu_impl(float sphere_rad, float density, float3 boxDi
 
     gran_params->max_safe_vel = (float)UINT_MAX;
     gran_params->recording_contactInfo = false;
+    gran_params->multi_device = false;
+    gran_params->contact_pool_size = 0;
 
     gran_params->static_friction_coeff_s2s = 0;
     gran_params->static_friction_coeff_s2w = 0;
@@ -135,6 +137,8 @@ void ChSystemGpu_impl::CreateWallBCs() {
 }
 
 ChSystemGpu_impl::~ChSystemGpu_impl() {
+    WaitParticleOutput();
+    destroyStepGraph();
     gpuErrchk(cudaFree(gran_params));
 }
 
@@ -191,6 +195,9 @@ void ChSystemGpu_impl::packSphereDataPointers() {
         gran_params->friction_mode == CHGPU_FRICTION_MODE::SINGLE_STEP) {
         sphere_data->contact_partners_map = contact_partners_map.data();
         sphere_data->contact_active_map = contact_active_map.data();
+        sphere_data->contact_offsets = contact_offsets.data();
+        sphere_data->contact_pool_owner = contact_pool_owner.data();
+        sphere_data->contact_pool_count = contact_pool_count.data();
     }
 
     if (gran_params->friction_mode == CHGPU_FRICTION_MODE::MULTI_STEP) {
@@ -213,48 +220,172 @@ void ChSystemGpu_impl::packSphereDataPointers() {
     }
 }
 
+ChSystemGpu_impl::ParticleSnapshot::~ParticleSnapshot() {
+    if (buffer)
+        cudaFreeHost(buffer);
+}
+
+void ChSystemGpu_impl::GetParticleState(ParticleSnapshot& snapshot) const {
+    bool friction = gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS;
+    snapshot.params = *gran_params;
+    snapshot.output_flags = output_flags;
+    snapshot.owner_SDs = sphere_owner_SDs.data();
+    snapshot.pos_X = sphere_local_pos_X.data();
+    snapshot.pos_Y = sphere_local_pos_Y.data();
+    snapshot.pos_Z = sphere_local_pos_Z.data();
+    snapshot.vel_X = pos_X_dt.data();
+    snapshot.vel_Y = pos_Y_dt.data();
+    snapshot.vel_Z = pos_Z_dt.data();
+    snapshot.omega_X = friction ? sphere_Omega_X.data() : nullptr;
+    snapshot.omega_Y = friction ? sphere_Omega_Y.data() : nullptr;
+    snapshot.omega_Z = friction ? sphere_Omega_Z.data() : nullptr;
+    snapshot.acc_X = sphere_acc_X.data();
+    snapshot.acc_Y = sphere_acc_Y.data();
+    snapshot.acc_Z = sphere_acc_Z.data();
+    snapshot.fixed = sphere_fixed.data();
+}
+
+// Copy all per-sphere arrays of the current state in a single pinned host buffer. The copies from unified memory are
+// DMA transfers, much cheaper than formatting the output.
+std::unique_ptr<ChSystemGpu_impl::ParticleSnapshot> ChSystemGpu_impl::CopyParticleState() const {
+    std::unique_ptr<ParticleSnapshot> snapshot(new ParticleSnapshot);
+    GetParticleState(*snapshot);
+
+    bool friction = snapshot->omega_X != nullptr;
+    size_t n_int = nSpheres * sizeof(int);
+    size_t n_float = nSpheres * sizeof(float);
+    size_t n_bytes = 4 * n_int + (friction ? 9 : 6) * n_float + nSpheres * sizeof(not_stupid_bool);
+    gpuErrchk(cudaMallocHost(&snapshot->buffer, n_bytes));
+
+    char* dst = (char*)snapshot->buffer;
+    auto copy = [&dst](const void* src, size_t size) {
+        gpuErrchk(cudaMemcpy(dst, src, size, cudaMemcpyDefault));
+        const void* copied = dst;
+        dst += size;
+        return copied;
+    };
+
+    snapshot->owner_SDs = (const unsigned int*)copy(snapshot->owner_SDs, n_int);
+    snapshot->pos_X = (const int*)copy(snapshot->pos_X, n_int);
+    snapshot->pos_Y = (const int*)copy(snapshot->pos_Y, n_int);
+    snapshot->pos_Z = (const int*)copy(snapshot->pos_Z, n_int);
+    snapshot->vel_X = (const float*)copy(snapshot->vel_X, n_float);
+    snapshot->vel_Y = (const float*)copy(snapshot->vel_Y, n_float);
+    snapshot->vel_Z = (const float*)copy(snapshot->vel_Z, n_float);
+    if (friction) {
+        snapshot->omega_X = (const float*)copy(snapshot->omega_X, n_float);
+        snapshot->omega_Y = (const float*)copy(snapshot->omega_Y, n_float);
+        snapshot->omega_Z = (const float*)copy(snapshot->omega_Z, n_float);
+    }
+    snapshot->acc_X = (const float*)copy(snapshot->acc_X, n_float);
+    snapshot->acc_Y = (const float*)copy(snapshot->acc_Y, n_float);
+    snapshot->acc_Z = (const float*)copy(snapshot->acc_Z, n_float);
+    snapshot->fixed = (const not_stupid_bool*)copy(snapshot->fixed, nSpheres * sizeof(not_stupid_bool));
+
+    return snapshot;
+}
+
 void ChSystemGpu_impl::WriteRawParticles(std::ofstream& ptFile) const {
-    for (unsigned int n = 0; n < nSpheres; n++) {
-        unsigned int ownerSD = sphere_owner_SDs.at(n);
-        int3 ownerSD_trip = getSDTripletFromID(ownerSD);
-        float x_UU = (float)(sphere_local_pos_X[n] * LENGTH_SU2UU);
-        float y_UU = (float)(sphere_local_pos_Y[n] * LENGTH_SU2UU);
-        float z_UU = (float)(sphere_local_pos_Z[n] * LENGTH_SU2UU);
+    ParticleSnapshot s;
+    GetParticleState(s);
+    WriteRawParticles(ptFile, s);
+}
 
-        x_UU += (float)(gran_params->BD_frame_X * LENGTH_SU2UU);
-        y_UU += (float)(gran_params->BD_frame_Y * LENGTH_SU2UU);
-        z_UU += (float)(gran_params->BD_frame_Z * LENGTH_SU2UU);
+void ChSystemGpu_impl::WriteCsvParticles(std::ofstream& ptFile) const {
+    ParticleSnapshot s;
+    GetParticleState(s);
+    WriteCsvParticles(ptFile, s);
+}
 
-        x_UU += (float)(((int64_t)ownerSD_trip.x * gran_params->SD_size_X_SU) * LENGTH_SU2UU);
-        y_UU += (float)(((int64_t)ownerSD_trip.y * gran_params->SD_size_Y_SU) * LENGTH_SU2UU);
-        z_UU += (float)(((int64_t)ownerSD_trip.z * gran_params->SD_size_Z_SU) * LENGTH_SU2UU);
+void ChSystemGpu_impl::WriteChPFParticles(std::ofstream& ptFile) const {
+    ParticleSnapshot s;
+    GetParticleState(s);
+    WriteChPFParticles(ptFile, s);
+}
+
+#ifdef USE_HDF5
+void ChSystemGpu_impl::WriteH5Particles(H5::H5File& ptFile) const {
+    ParticleSnapshot s;
+    GetParticleState(s);
+    WriteH5Particles(ptFile, s);
+}
+#endif
+
+void ChSystemGpu_impl::WriteParticleFile(const std::string& outfilename, const ParticleSnapshot& s) const {
+    // The file writes are a pretty big slowdown in CSV mode
+    if (file_write_mode == CHGPU_OUTPUT_MODE::BINARY) {
+        std::ofstream ptFile(outfilename, std::ios::out | std::ios::binary);
+        WriteRawParticles(ptFile, s);
+    } else if (file_write_mode == CHGPU_OUTPUT_MODE::CSV) {
+        std::ofstream ptFile(outfilename, std::ios::out);
+        WriteCsvParticles(ptFile, s);
+    } else if (file_write_mode == CHGPU_OUTPUT_MODE::CHPF) {
+        std::ofstream ptFile(outfilename, std::ios::out | std::ios::binary);
+        WriteChPFParticles(ptFile, s);
+    } else if (file_write_mode == CHGPU_OUTPUT_MODE::HDF5) {
+#ifdef USE_HDF5
+        H5::H5File ptFile(outfilename.c_str(), H5F_ACC_TRUNC);
+        WriteH5Particles(ptFile, s);
+#else
+        CHGPU_ERROR("ERROR! HDF5 Installation not found. Recompile with HDF5.\n");
+#endif
+    }
+}
+
+void ChSystemGpu_impl::WriteParticleFileAsync(const std::string& outfilename) {
+    WaitParticleOutput();
+    output_snapshot = CopyParticleState();
+    output_thread = std::thread([this, outfilename]() { WriteParticleFile(outfilename, *output_snapshot); });
+}
+
+void ChSystemGpu_impl::WaitParticleOutput() {
+    if (output_thread.joinable())
+        output_thread.join();
+    output_snapshot.reset();
+}
+
+void ChSystemGpu_impl::WriteRawParticles(std::ofstream& ptFile, const ParticleSnapshot& s) const {
+    for (unsigned int n = 0; n < s.params.nSpheres; n++) {
+        unsigned int ownerSD = s.owner_SDs[n];
+        int3 ownerSD_trip = getSDTripletFromID(ownerSD, s.params);
+        float x_UU = (float)(s.pos_X[n] * LENGTH_SU2UU);
+        float y_UU = (float)(s.pos_Y[n] * LENGTH_SU2UU);
+        float z_UU = (float)(s.pos_Z[n] * LENGTH_SU2UU);
+
+        x_UU += (float)(s.params.BD_frame_X * LENGTH_SU2UU);
+        y_UU += (float)(s.params.BD_frame_Y * LENGTH_SU2UU);
+        z_UU += (float)(s.params.BD_frame_Z * LENGTH_SU2UU);
+
+        x_UU += (float)(((int64_t)ownerSD_trip.x * s.params.SD_size_X_SU) * LENGTH_SU2UU);
+        y_UU += (float)(((int64_t)ownerSD_trip.y * s.params.SD_size_Y_SU) * LENGTH_SU2UU);
+        z_UU += (float)(((int64_t)ownerSD_trip.z * s.params.SD_size_Z_SU) * LENGTH_SU2UU);
 
         ptFile.write((const char*)&x_UU, sizeof(float));
         ptFile.write((const char*)&y_UU, sizeof(float));
         ptFile.write((const char*)&z_UU, sizeof(float));
 
-        if (GET_OUTPUT_SETTING(VEL_COMPONENTS)) {
-            float vx_UU = (float)(pos_X_dt[n] * LENGTH_SU2UU / TIME_SU2UU);
-            float vy_UU = (float)(pos_Y_dt[n] * LENGTH_SU2UU / TIME_SU2UU);
-            float vz_UU = (float)(pos_Z_dt[n] * LENGTH_SU2UU / TIME_SU2UU);
+        if ((s.output_flags & VEL_COMPONENTS)) {
+            float vx_UU = (float)(s.vel_X[n] * LENGTH_SU2UU / TIME_SU2UU);
+            float vy_UU = (float)(s.vel_Y[n] * LENGTH_SU2UU / TIME_SU2UU);
+            float vz_UU = (float)(s.vel_Z[n] * LENGTH_SU2UU / TIME_SU2UU);
 
             ptFile.write((const char*)&vx_UU, sizeof(float));
             ptFile.write((const char*)&vy_UU, sizeof(float));
             ptFile.write((const char*)&vz_UU, sizeof(float));
         }
 
-        if (GET_OUTPUT_SETTING(ABSV)) {
-            float absv = (float)(std::sqrt(pos_X_dt.at(n) * pos_X_dt.at(n) + pos_Y_dt.at(n) * pos_Y_dt.at(n) +
-                                           pos_Z_dt.at(n) * pos_Z_dt.at(n)) *
+        if ((s.output_flags & ABSV)) {
+            float absv = (float)(std::sqrt(s.vel_X[n] * s.vel_X[n] + s.vel_Y[n] * s.vel_Y[n] +
+                                           s.vel_Z[n] * s.vel_Z[n]) *
                                  VEL_SU2UU);
 
             ptFile.write((const char*)&absv, sizeof(float));
         }
 
-        if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS && GET_OUTPUT_SETTING(ANG_VEL_COMPONENTS)) {
-            float omega_x_UU = (float)(sphere_Omega_X.at(n) / TIME_SU2UU);
-            float omega_y_UU = (float)(sphere_Omega_Y.at(n) / TIME_SU2UU);
-            float omega_z_UU = (float)(sphere_Omega_Z.at(n) / TIME_SU2UU);
+        if (s.params.friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS && (s.output_flags & ANG_VEL_COMPONENTS)) {
+            float omega_x_UU = (float)(s.omega_X[n] / TIME_SU2UU);
+            float omega_y_UU = (float)(s.omega_Y[n] / TIME_SU2UU);
+            float omega_z_UU = (float)(s.omega_Z[n] / TIME_SU2UU);
             ptFile.write((const char*)&omega_x_UU, sizeof(float));
             ptFile.write((const char*)&omega_y_UU, sizeof(float));
             ptFile.write((const char*)&omega_z_UU, sizeof(float));
@@ -262,76 +393,76 @@ void ChSystemGpu_impl::WriteRawParticles(std::ofstream& ptFile) const {
     }
 }
 
-void ChSystemGpu_impl::WriteCsvParticles(std::ofstream& ptFile) const {
+void ChSystemGpu_impl::WriteCsvParticles(std::ofstream& ptFile, const ParticleSnapshot& s) const {
     // Dump to a stream, write to file only at end
     std::ostringstream outstrstream;
     outstrstream << "x,y,z";
-    if (GET_OUTPUT_SETTING(VEL_COMPONENTS)) {
+    if ((s.output_flags & VEL_COMPONENTS)) {
         outstrstream << ",vx,vy,vz";
     }
-    if (GET_OUTPUT_SETTING(ABSV)) {
+    if ((s.output_flags & ABSV)) {
         outstrstream << ",absv";
     }
-    if (GET_OUTPUT_SETTING(FIXITY)) {
+    if ((s.output_flags & FIXITY)) {
         outstrstream << ",fixed";
     }
 
-    if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS && GET_OUTPUT_SETTING(ANG_VEL_COMPONENTS)) {
+    if (s.params.friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS && (s.output_flags & ANG_VEL_COMPONENTS)) {
         outstrstream << ",wx,wy,wz";
     }
 
-    if (GET_OUTPUT_SETTING(FORCE_COMPONENTS)) {
+    if ((s.output_flags & FORCE_COMPONENTS)) {
         outstrstream << ",fx,fy,fz";
     }
 
     outstrstream << "\n";
-    for (unsigned int n = 0; n < nSpheres; n++) {
-        unsigned int ownerSD = sphere_owner_SDs.at(n);
-        int3 ownerSD_trip = getSDTripletFromID(ownerSD);
+    for (unsigned int n = 0; n < s.params.nSpheres; n++) {
+        unsigned int ownerSD = s.owner_SDs[n];
+        int3 ownerSD_trip = getSDTripletFromID(ownerSD, s.params);
 
-        float x_UU = (float)(sphere_local_pos_X[n] * LENGTH_SU2UU);
-        float y_UU = (float)(sphere_local_pos_Y[n] * LENGTH_SU2UU);
-        float z_UU = (float)(sphere_local_pos_Z[n] * LENGTH_SU2UU);
+        float x_UU = (float)(s.pos_X[n] * LENGTH_SU2UU);
+        float y_UU = (float)(s.pos_Y[n] * LENGTH_SU2UU);
+        float z_UU = (float)(s.pos_Z[n] * LENGTH_SU2UU);
 
-        x_UU += (float)(gran_params->BD_frame_X * LENGTH_SU2UU);
-        y_UU += (float)(gran_params->BD_frame_Y * LENGTH_SU2UU);
-        z_UU += (float)(gran_params->BD_frame_Z * LENGTH_SU2UU);
+        x_UU += (float)(s.params.BD_frame_X * LENGTH_SU2UU);
+        y_UU += (float)(s.params.BD_frame_Y * LENGTH_SU2UU);
+        z_UU += (float)(s.params.BD_frame_Z * LENGTH_SU2UU);
 
-        x_UU += (float)(((int64_t)ownerSD_trip.x * gran_params->SD_size_X_SU) * LENGTH_SU2UU);
-        y_UU += (float)(((int64_t)ownerSD_trip.y * gran_params->SD_size_Y_SU) * LENGTH_SU2UU);
-        z_UU += (float)(((int64_t)ownerSD_trip.z * gran_params->SD_size_Z_SU) * LENGTH_SU2UU);
+        x_UU += (float)(((int64_t)ownerSD_trip.x * s.params.SD_size_X_SU) * LENGTH_SU2UU);
+        y_UU += (float)(((int64_t)ownerSD_trip.y * s.params.SD_size_Y_SU) * LENGTH_SU2UU);
+        z_UU += (float)(((int64_t)ownerSD_trip.z * s.params.SD_size_Z_SU) * LENGTH_SU2UU);
 
         outstrstream << x_UU << "," << y_UU << "," << z_UU;
 
-        if (GET_OUTPUT_SETTING(VEL_COMPONENTS)) {
-            float vx_UU = (float)(pos_X_dt[n] * LENGTH_SU2UU / TIME_SU2UU);
-            float vy_UU = (float)(pos_Y_dt[n] * LENGTH_SU2UU / TIME_SU2UU);
-            float vz_UU = (float)(pos_Z_dt[n] * LENGTH_SU2UU / TIME_SU2UU);
+        if ((s.output_flags & VEL_COMPONENTS)) {
+            float vx_UU = (float)(s.vel_X[n] * LENGTH_SU2UU / TIME_SU2UU);
+            float vy_UU = (float)(s.vel_Y[n] * LENGTH_SU2UU / TIME_SU2UU);
+            float vz_UU = (float)(s.vel_Z[n] * LENGTH_SU2UU / TIME_SU2UU);
 
             outstrstream << "," << vx_UU << "," << vy_UU << "," << vz_UU;
         }
 
-        if (GET_OUTPUT_SETTING(ABSV)) {
-            float absv = (float)(std::sqrt(pos_X_dt.at(n) * pos_X_dt.at(n) + pos_Y_dt.at(n) * pos_Y_dt.at(n) +
-                                           pos_Z_dt.at(n) * pos_Z_dt.at(n)) *
+        if ((s.output_flags & ABSV)) {
+            float absv = (float)(std::sqrt(s.vel_X[n] * s.vel_X[n] + s.vel_Y[n] * s.vel_Y[n] +
+                                           s.vel_Z[n] * s.vel_Z[n]) *
                                  VEL_SU2UU);
             outstrstream << "," << absv;
         }
 
-        if (GET_OUTPUT_SETTING(FIXITY)) {
-            int fixed = (int)sphere_fixed[n];
+        if ((s.output_flags & FIXITY)) {
+            int fixed = (int)s.fixed[n];
             outstrstream << "," << fixed;
         }
 
-        if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS && GET_OUTPUT_SETTING(ANG_VEL_COMPONENTS)) {
-            outstrstream << "," << sphere_Omega_X.at(n) / TIME_SU2UU << "," << sphere_Omega_Y.at(n) / TIME_SU2UU << ","
-                         << sphere_Omega_Z.at(n) / TIME_SU2UU;
+        if (s.params.friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS && (s.output_flags & ANG_VEL_COMPONENTS)) {
+            outstrstream << "," << s.omega_X[n] / TIME_SU2UU << "," << s.omega_Y[n] / TIME_SU2UU << ","
+                         << s.omega_Z[n] / TIME_SU2UU;
         }
 
-        if (GET_OUTPUT_SETTING(FORCE_COMPONENTS)) {
-            double fx = (sphere_acc_X.at(n) - gran_params->gravAcc_X_SU) * gran_params->sphere_mass_SU * FORCE_SU2UU;
-            double fy = (sphere_acc_Y.at(n) - gran_params->gravAcc_Y_SU) * gran_params->sphere_mass_SU * FORCE_SU2UU;
-            double fz = (sphere_acc_Z.at(n) - gran_params->gravAcc_Z_SU) * gran_params->sphere_mass_SU * FORCE_SU2UU;
+        if ((s.output_flags & FORCE_COMPONENTS)) {
+            double fx = (s.acc_X[n] - s.params.gravAcc_X_SU) * s.params.sphere_mass_SU * FORCE_SU2UU;
+            double fy = (s.acc_Y[n] - s.params.gravAcc_Y_SU) * s.params.sphere_mass_SU * FORCE_SU2UU;
+            double fz = (s.acc_Z[n] - s.params.gravAcc_Z_SU) * s.params.sphere_mass_SU * FORCE_SU2UU;
             outstrstream << "," << fx << "," << fy << "," << fz;
         }
 
@@ -341,65 +472,65 @@ void ChSystemGpu_impl::WriteCsvParticles(std::ofstream& ptFile) const {
     ptFile << outstrstream.str();
 }
 
-void ChSystemGpu_impl::WriteChPFParticles(std::ofstream& ptFile) const {
+void ChSystemGpu_impl::WriteChPFParticles(std::ofstream& ptFile, const ParticleSnapshot& s) const {
     ParticleFormatWriter pw;
 
-    std::vector<float> v_x_UU(sphere_local_pos_X.size());
-    std::vector<float> v_y_UU(sphere_local_pos_Y.size());
-    std::vector<float> v_z_UU(sphere_local_pos_Z.size());
-    std::vector<float> sphere_radius(gran_params->nSpheres);
+    std::vector<float> v_x_UU(s.params.nSpheres);
+    std::vector<float> v_y_UU(s.params.nSpheres);
+    std::vector<float> v_z_UU(s.params.nSpheres);
+    std::vector<float> sphere_radius(s.params.nSpheres);
 
-    for (unsigned int n = 0; n < nSpheres; n++) {
-        unsigned int ownerSD = sphere_owner_SDs.at(n);
-        int3 ownerSD_trip = getSDTripletFromID(ownerSD);
-        float x_UU = (float)(sphere_local_pos_X[n] * LENGTH_SU2UU);
-        float y_UU = (float)(sphere_local_pos_Y[n] * LENGTH_SU2UU);
-        float z_UU = (float)(sphere_local_pos_Z[n] * LENGTH_SU2UU);
+    for (unsigned int n = 0; n < s.params.nSpheres; n++) {
+        unsigned int ownerSD = s.owner_SDs[n];
+        int3 ownerSD_trip = getSDTripletFromID(ownerSD, s.params);
+        float x_UU = (float)(s.pos_X[n] * LENGTH_SU2UU);
+        float y_UU = (float)(s.pos_Y[n] * LENGTH_SU2UU);
+        float z_UU = (float)(s.pos_Z[n] * LENGTH_SU2UU);
 
-        x_UU += (float)(gran_params->BD_frame_X * LENGTH_SU2UU);
-        y_UU += (float)(gran_params->BD_frame_Y * LENGTH_SU2UU);
-        z_UU += (float)(gran_params->BD_frame_Z * LENGTH_SU2UU);
+        x_UU += (float)(s.params.BD_frame_X * LENGTH_SU2UU);
+        y_UU += (float)(s.params.BD_frame_Y * LENGTH_SU2UU);
+        z_UU += (float)(s.params.BD_frame_Z * LENGTH_SU2UU);
 
-        x_UU += (float)(((int64_t)ownerSD_trip.x * gran_params->SD_size_X_SU) * LENGTH_SU2UU);
-        y_UU += (float)(((int64_t)ownerSD_trip.y * gran_params->SD_size_Y_SU) * LENGTH_SU2UU);
-        z_UU += (float)(((int64_t)ownerSD_trip.z * gran_params->SD_size_Z_SU) * LENGTH_SU2UU);
+        x_UU += (float)(((int64_t)ownerSD_trip.x * s.params.SD_size_X_SU) * LENGTH_SU2UU);
+        y_UU += (float)(((int64_t)ownerSD_trip.y * s.params.SD_size_Y_SU) * LENGTH_SU2UU);
+        z_UU += (float)(((int64_t)ownerSD_trip.z * s.params.SD_size_Z_SU) * LENGTH_SU2UU);
 
         v_x_UU[n] = x_UU;
         v_y_UU[n] = y_UU;
         v_z_UU[n] = z_UU;
-        sphere_radius[n] = gran_params->sphereRadius_SU * LENGTH_SU2UU;
+        sphere_radius[n] = s.params.sphereRadius_SU * LENGTH_SU2UU;
     }
 
     pw.write(ptFile, ParticleFormatWriter::CompressionType::NONE, v_x_UU, v_y_UU, v_z_UU, sphere_radius);
 }
 
 #ifdef USE_HDF5
-void ChSystemGpu_impl::WriteH5Particles(H5::H5File& ptFile) const {
-    float* x = new float[nSpheres];
-    float* y = new float[nSpheres];
-    float* z = new float[nSpheres];
-
-    for (size_t n = 0; n < nSpheres; n++) {
-        unsigned int ownerSD = sphere_owner_SDs.at(n);
-        int3 ownerSD_trip = getSDTripletFromID(ownerSD);
-        float x_UU = sphere_local_pos_X[n] * LENGTH_SU2UU;
-        float y_UU = sphere_local_pos_Y[n] * LENGTH_SU2UU;
-        float z_UU = sphere_local_pos_Z[n] * LENGTH_SU2UU;
-
-        x_UU += gran_params->BD_frame_X * LENGTH_SU2UU;
-        y_UU += gran_params->BD_frame_Y * LENGTH_SU2UU;
-        z_UU += gran_params->BD_frame_Z * LENGTH_SU2UU;
-
-        x_UU += ((int64_t)ownerSD_trip.x * gran_params->SD_size_X_SU) * LENGTH_SU2UU;
-        y_UU += ((int64_t)ownerSD_trip.y * gran_params->SD_size_Y_SU) * LENGTH_SU2UU;
-        z_UU += ((int64_t)ownerSD_trip.z * gran_params->SD_size_Z_SU) * LENGTH_SU2UU;
+void ChSystemGpu_impl::WriteH5Particles(H5::H5File& ptFile, const ParticleSnapshot& s) const {
+    float* x = new float[s.params.nSpheres];
+    float* y = new float[s.params.nSpheres];
+    float* z = new float[s.params.nSpheres];
+
+    for (size_t n = 0; n < s.params.nSpheres; n++) {
+        unsigned int ownerSD = s.owner_SDs[n];
+        int3 ownerSD_trip = getSDTripletFromID(ownerSD, s.params);
+        float x_UU = s.pos_X[n] * LENGTH_SU2UU;
+        float y_UU = s.pos_Y[n] * LENGTH_SU2UU;
+        float z_UU = s.pos_Z[n] * LENGTH_SU2UU;
+
+        x_UU += s.params.BD_frame_X * LENGTH_SU2UU;
+        y_UU += s.params.BD_frame_Y * LENGTH_SU2UU;
+        z_UU += s.params.BD_frame_Z * LENGTH_SU2UU;
+
+        x_UU += ((int64_t)ownerSD_trip.x * s.params.SD_size_X_SU) * LENGTH_SU2UU;
+        y_UU += ((int64_t)ownerSD_trip.y * s.params.SD_size_Y_SU) * LENGTH_SU2UU;
+        z_UU += ((int64_t)ownerSD_trip.z * s.params.SD_size_Z_SU) * LENGTH_SU2UU;
 
         x[n] = x_UU;
         y[n] = y_UU;
         z[n] = z_UU;
     }
 
-    hsize_t dims[1] = {nSpheres};
+    hsize_t dims[1] = {s.params.nSpheres};
     H5::DataSpace dataspace(1, dims);
 
     H5::DataSet ds_x = ptFile.createDataSet("x", H5::PredType::NATIVE_FLOAT, dataspace);
@@ -412,14 +543,14 @@ void ChSystemGpu_impl::WriteH5Particles(H5::H5File& ptFile) const {
     ds_z.write(z, H5::PredType::NATIVE_FLOAT);
     delete[] x, y, z;
 
-    if (GET_OUTPUT_SETTING(VEL_COMPONENTS)) {
-        float* vx = new float[nSpheres];
-        float* vy = new float[nSpheres];
-        float* vz = new float[nSpheres];
-        for (size_t n = 0; n < nSpheres; n++) {
-            vx[n] = pos_X_dt[n] * LENGTH_SU2UU / TIME_SU2UU;
-            vy[n] = pos_Y_dt[n] * LENGTH_SU2UU / TIME_SU2UU;
-            vz[n] = pos_Z_dt[n] * LENGTH_SU2UU / TIME_SU2UU;
+    if ((s.output_flags & VEL_COMPONENTS)) {
+        float* vx = new float[s.params.nSpheres];
+        float* vy = new float[s.params.nSpheres];
+        float* vz = new float[s.params.nSpheres];
+        for (size_t n = 0; n < s.params.nSpheres; n++) {
+            vx[n] = s.vel_X[n] * LENGTH_SU2UU / TIME_SU2UU;
+            vy[n] = s.vel_Y[n] * LENGTH_SU2UU / TIME_SU2UU;
+            vz[n] = s.vel_Z[n] * LENGTH_SU2UU / TIME_SU2UU;
         }
 
         H5::DataSet ds_vx = ptFile.createDataSet("vx", H5::PredType::NATIVE_FLOAT, dataspace);
@@ -434,11 +565,11 @@ void ChSystemGpu_impl::WriteH5Particles(H5::H5File& ptFile) const {
         delete[] vx, vy, vz;
     }
 
-    if (GET_OUTPUT_SETTING(ABSV)) {
-        float* absv = new float[nSpheres];
-        for (size_t n = 0; n < nSpheres; n++) {
-            absv[n] = sqrt(pos_X_dt.at(n) * pos_X_dt.at(n) + pos_Y_dt.at(n) * pos_Y_dt.at(n) +
-                           pos_Z_dt.at(n) * pos_Z_dt.at(n)) *
+    if ((s.output_flags & ABSV)) {
+        float* absv = new float[s.params.nSpheres];
+        for (size_t n = 0; n < s.params.nSpheres; n++) {
+            absv[n] = sqrt(s.vel_X[n] * s.vel_X[n] + s.vel_Y[n] * s.vel_Y[n] +
+                           s.vel_Z[n] * s.vel_Z[n]) *
                       VEL_SU2UU;
         }
         H5::DataSet ds_absv = ptFile.createDataSet("absv", H5::PredType::NATIVE_FLOAT, dataspace);
@@ -447,10 +578,10 @@ void ChSystemGpu_impl::WriteH5Particles(H5::H5File& ptFile) const {
         delete[] absv;
     }
 
-    if (GET_OUTPUT_SETTING(FIXITY)) {
-        unsigned char* fixed = new unsigned char[nSpheres];
-        for (size_t n = 0; n < nSpheres; n++) {
-            fixed[n] = (unsigned char)sphere_fixed[n];
+    if ((s.output_flags & FIXITY)) {
+        unsigned char* fixed = new unsigned char[s.params.nSpheres];
+        for (size_t n = 0; n < s.params.nSpheres; n++) {
+            fixed[n] = (unsigned char)s.fixed[n];
         }
         H5::DataSet ds_fixed = ptFile.createDataSet("fixed", H5::PredType::NATIVE_UCHAR, dataspace);
         ds_fixed.write(fixed, H5::PredType::NATIVE_UCHAR);
@@ -458,14 +589,14 @@ void ChSystemGpu_impl::WriteH5Particles(H5::H5File& ptFile) const {
         delete[] fixed;
     }
 
-    if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS && GET_OUTPUT_SETTING(ANG_VEL_COMPONENTS)) {
-        float* wx = new float[nSpheres];
-        float* wy = new float[nSpheres];
-        float* wz = new float[nSpheres];
-        for (size_t n = 0; n < nSpheres; n++) {
-            wx[n] = sphere_Omega_X[n] / TIME_SU2UU;
-            wy[n] = sphere_Omega_Y[n] / TIME_SU2UU;
-            wz[n] = sphere_Omega_Z[n] / TIME_SU2UU;
+    if (s.params.friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS && (s.output_flags & ANG_VEL_COMPONENTS)) {
+        float* wx = new float[s.params.nSpheres];
+        float* wy = new float[s.params.nSpheres];
+        float* wz = new float[s.params.nSpheres];
+        for (size_t n = 0; n < s.params.nSpheres; n++) {
+            wx[n] = s.omega_X[n] / TIME_SU2UU;
+            wy[n] = s.omega_Y[n] / TIME_SU2UU;
+            wz[n] = s.omega_Z[n] / TIME_SU2UU;
         }
 
         H5::DataSet ds_wx = ptFile.createDataSet("wx", H5::PredType::NATIVE_FLOAT, dataspace);
@@ -482,6 +613,26 @@ void ChSystemGpu_impl::WriteH5Particles(H5::H5File& ptFile) const {
 }
 #endif
 
+std::vector<size_t> ChSystemGpu_impl::getContactSlots(unsigned int sphere) const {
+    std::vector<size_t> slots;
+    if (contact_offsets.size() <= sphere + 1)
+        return slots;
+
+    // slots in the segment of the sphere
+    for (size_t slot = contact_offsets[sphere]; slot < contact_offsets[sphere + 1]; slot++)
+        slots.push_back(slot);
+
+    // slots of the overflow pool claimed by the sphere
+    unsigned int pool_count = std::min(contact_pool_count[0], gran_params->contact_pool_size);
+    size_t pool_begin = contact_offsets[nSpheres];
+    for (unsigned int k = 0; k < pool_count; k++) {
+        if (contact_pool_owner[k] == sphere)
+            slots.push_back(pool_begin + k);
+    }
+
+    return slots;
+}
+
 /// Get rolling friction torque between body i and j, return 0 if not in contact
 float3 ChSystemGpu_impl::getRollingFrictionTorque(unsigned int i, unsigned int j) {
     if (gran_params->recording_contactInfo == false) {
@@ -493,10 +644,8 @@ float3 ChSystemGpu_impl::getRollingFrictionTorque(unsigned int i, unsigned int j
         return make_float3(0.0f, 0.0f, 0.0f);
     }
 
-    unsigned int bodyAoffset = i * MAX_SPHERES_TOUCHED_BY_SPHERE;
-    // go through all possible neighbors
-    for (unsigned int neighborID = 0; neighborID < MAX_SPHERES_TOUCHED_BY_SPHERE; neighborID++) {
-        unsigned int theirSphereMappingID = bodyAoffset + neighborID;
+    // go through all contact slots of the sphere
+    for (size_t theirSphereMappingID : getContactSlots(i)) {
         unsigned int theirSphereID = contact_partners_map[theirSphereMappingID];
 
         if (theirSphereID == j) {
@@ -509,10 +658,8 @@ float3 ChSystemGpu_impl::getRollingFrictionTorque(unsigned int i, unsigned int j
 }
 
 void ChSystemGpu_impl::getNeighbors(unsigned int ID, std::vector<unsigned int>& neighborList) {
-    unsigned int bodyAoffset = ID * MAX_SPHERES_TOUCHED_BY_SPHERE;
-    // go through all possible neighbors
-    for (unsigned int neighborID = 0; neighborID < MAX_SPHERES_TOUCHED_BY_SPHERE; neighborID++) {
-        unsigned int theirSphereMappingID = bodyAoffset + neighborID;
+    // go through all contact slots of the sphere
+    for (size_t theirSphereMappingID : getContactSlots(ID)) {
         unsigned int theirSphereID = contact_partners_map[theirSphereMappingID];
 
         if (theirSphereID != -1) {
@@ -532,10 +679,8 @@ float3 ChSystemGpu_impl::getRollingVrot(unsigned int i, unsigned int j) {
         return make_float3(0.0f, 0.0f, 0.0f);
     }
 
-    unsigned int bodyAoffset = i * MAX_SPHERES_TOUCHED_BY_SPHERE;
-    // go through all possible neighbors
-    for (unsigned int neighborID = 0; neighborID < MAX_SPHERES_TOUCHED_BY_SPHERE; neighborID++) {
-        unsigned int theirSphereMappingID = bodyAoffset + neighborID;
+    // go through all contact slots of the sphere
+    for (size_t theirSphereMappingID : getContactSlots(i)) {
         unsigned int theirSphereID = contact_partners_map[theirSphereMappingID];
 
         if (theirSphereID == j) {
@@ -558,10 +703,8 @@ float ChSystemGpu_impl::getRollingCharContactTime(unsigned int i, unsigned int j
         return 0.0f;
     }
 
-    unsigned int bodyAoffset = i * MAX_SPHERES_TOUCHED_BY_SPHERE;
-    // go through all possible neighbors
-    for (unsigned int neighborID = 0; neighborID < MAX_SPHERES_TOUCHED_BY_SPHERE; neighborID++) {
-        unsigned int theirSphereMappingID = bodyAoffset + neighborID;
+    // go through all contact slots of the sphere
+    for (size_t theirSphereMappingID : getContactSlots(i)) {
         unsigned int theirSphereID = contact_partners_map[theirSphereMappingID];
 
         if (theirSphereID == j) {
@@ -584,10 +727,8 @@ float3 ChSystemGpu_impl::getSlidingFrictionForce(unsigned int i, unsigned int j)
         j = tmp;
     }
 
-    unsigned int bodyAoffset = i * MAX_SPHERES_TOUCHED_BY_SPHERE;
-    // go through all possible neighbors
-    for (unsigned int neighborID = 0; neighborID < MAX_SPHERES_TOUCHED_BY_SPHERE; neighborID++) {
-        unsigned int theirSphereMappingID = bodyAoffset + neighborID;
+    // go through all contact slots of the sphere
+    for (size_t theirSphereMappingID : getContactSlots(i)) {
         unsigned int theirSphereID = contact_partners_map[theirSphereMappingID];
 
         if (theirSphereID == j) {
@@ -615,10 +756,8 @@ float3 ChSystemGpu_impl::getNormalForce(unsigned int i, unsigned int j) {
         j = tmp;
     }
 
-    unsigned int bodyAoffset = i * MAX_SPHERES_TOUCHED_BY_SPHERE;
-    // go through all possible neighbors
-    for (unsigned int neighborID = 0; neighborID < MAX_SPHERES_TOUCHED_BY_SPHERE; neighborID++) {
-        unsigned int theirSphereMappingID = bodyAoffset + neighborID;
+    // go through all contact slots of the sphere
+    for (size_t theirSphereMappingID : getContactSlots(i)) {
         unsigned int theirSphereID = contact_partners_map[theirSphereMappingID];
 
         if (theirSphereID == j) {
@@ -652,10 +791,8 @@ void ChSystemGpu_impl::WriteContactInfoFile(const std::string& outfilename) cons
         }
         outstrstream << "\n";
         for (unsigned int n = 0; n < nSpheres; n++) {
-            unsigned int bodyAoffset = n * MAX_SPHERES_TOUCHED_BY_SPHERE;
-            // go through all possible neighbors
-            for (unsigned int neighborID = 0; neighborID < MAX_SPHERES_TOUCHED_BY_SPHERE; neighborID++) {
-                unsigned int theirSphereMappingID = bodyAoffset + neighborID;
+            // go through all contact slots of the sphere
+            for (size_t theirSphereMappingID : getContactSlots(n)) {
                 unsigned int theirSphereID = contact_partners_map[theirSphereMappingID];
                 // only write when bi < bj
                 if (theirSphereID >= n && theirSphereID < nSpheres) {
@@ -16,7 +16,9 @@
 
 #include <cstddef>
 #include <functional>
+#include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 #include <algorithm>
 #include <cmath>
@@ -183,6 +185,10 @@ class ChSystemGpu_impl {
         float max_safe_vel = (float)UINT_MAX;
 
         bool recording_contactInfo = false;  ///< recording contact info
+
+        bool multi_device = false;  ///< step kernels distributed over several devices (see ChSystemGpu::SetDevices)
+
+        unsigned int contact_pool_size;  ///< capacity of the overflow pool of the contact maps (0: no pool)
     };
 
     /// Structure of pointers to kinematic quantities of the ChSystemGpu_impl.
@@ -224,6 +230,9 @@ class ChSystemGpu_impl {
 
         unsigned int* contact_partners_map;   ///< Contact partners for each sphere. Only in frictional simulations
         not_stupid_bool* contact_active_map;  ///< Whether the frictional contact at an index is active
+        unsigned int* contact_offsets;        ///< First contact map slot of each sphere (plus start of overflow pool)
+        unsigned int* contact_pool_owner;     ///< Sphere owning each slot of the contact map overflow pool
+        unsigned int* contact_pool_count;     ///< Number of overflow pool slots claimed since the last compaction
         float3* contact_history_map;  ///< Tangential history for a given contact pair. Only for multistep friction
         float* contact_duration;      ///< Duration of persistent contact between pairs
 
@@ -425,6 +434,35 @@ class ChSystemGpu_impl {
     /// Reset sphere accelerations
     void resetSphereAccelerations();
 
+    /// Enqueue the per-step sphere force and integration work (from the reset of sphere accelerations to the update
+    /// of angular velocities) on the given stream, without any host synchronization.
+    void launchSphereStepKernels(cudaStream_t stream);
+
+    /// Run the per-step sphere force and integration work through the step graph, (re)capturing it if needed.
+    void runSphereStepGraph();
+
+    /// Release the step graph and its stream.
+    void destroyStepGraph();
+
+    /// Set the devices over which the per-step kernels are distributed and enable peer access between them.
+    void setDevices(const std::vector<int>& devs);
+
+    /// Partition the SDs and spheres over the devices and set the preferred location of the sphere data accordingly.
+    void partitionDevices();
+
+    /// Run the per-step sphere force and integration work, with each device processing its own partition.
+    void runSphereStepMultiDevice();
+
+    /// Compact the contact maps: give each sphere as many slots as its current contacts plus spare slots, and merge
+    /// the overflow pool back into the per-sphere slots.
+    void compactContactMaps();
+
+    /// Compact the contact maps if compaction is enabled and due at the current step.
+    void updateContactMaps();
+
+    /// Get the contact map slots of the specified sphere (its own slots and those it owns in the overflow pool).
+    std::vector<size_t> getContactSlots(unsigned int sphere) const;
+
     /// Reset sphere-wall forces
     void resetBCForces();
 
@@ -436,6 +474,7 @@ class ChSystemGpu_impl {
 
     /// Wrap the device helper function
     int3 getSDTripletFromID(unsigned int SD_ID) const;
+    int3 getSDTripletFromID(unsigned int SD_ID, const GranParams& params) const;
 
     /// Create a helper to do sphere initialization
     void initializeSpheres();
@@ -481,6 +520,40 @@ class ChSystemGpu_impl {
     /// Update positions of each boundary condition using prescribed functions
     void updateBCPositions();
 
+    /// Sphere state written out by the particle output functions.
+    /// A snapshot either refers to the system arrays (see GetParticleState) or holds a host copy of them (see
+    /// CopyParticleState), in which case it can be written out while the simulation advances.
+    struct ParticleSnapshot {
+        ParticleSnapshot() : buffer(nullptr) {}
+        ~ParticleSnapshot();
+
+        GranParams params;          ///< copy of the simulation parameters (includes the current BD frame)
+        unsigned int output_flags;  ///< output settings at the time of the snapshot
+
+        const unsigned int* owner_SDs;
+        const int* pos_X;
+        const int* pos_Y;
+        const int* pos_Z;
+        const float* vel_X;
+        const float* vel_Y;
+        const float* vel_Z;
+        const float* omega_X;  ///< only set if friction is present
+        const float* omega_Y;  ///< only set if friction is present
+        const float* omega_Z;  ///< only set if friction is present
+        const float* acc_X;
+        const float* acc_Y;
+        const float* acc_Z;
+        const not_stupid_bool* fixed;
+
+        void* buffer;  ///< pinned host storage of a snapshot copy (nullptr if referring to the system arrays)
+    };
+
+    /// Get a snapshot referring to the current sphere state (no copy).
+    void GetParticleState(ParticleSnapshot& snapshot) const;
+
+    /// Get a snapshot holding a host copy of the current sphere state.
+    std::unique_ptr<ParticleSnapshot> CopyParticleState() const;
+
     /// Write particle positions, vels and ang vels to a file stream (based on a format)
     void WriteRawParticles(std::ofstream& ptFile) const;
     void WriteCsvParticles(std::ofstream& ptFile) const;
@@ -489,6 +562,24 @@ class ChSystemGpu_impl {
     void WriteH5Particles(H5::H5File& ptFile) const;
 #endif
 
+    /// Write the particles of the given snapshot to a file stream (based on a format)
+    void WriteRawParticles(std::ofstream& ptFile, const ParticleSnapshot& s) const;
+    void WriteCsvParticles(std::ofstream& ptFile, const ParticleSnapshot& s) const;
+    void WriteChPFParticles(std::ofstream& ptFile, const ParticleSnapshot& s) const;
+#ifdef USE_HDF5
+    void WriteH5Particles(H5::H5File& ptFile, const ParticleSnapshot& s) const;
+#endif
+
+    /// Write the particles of the given snapshot to a file, according to the system output mode.
+    void WriteParticleFile(const std::string& outfilename, const ParticleSnapshot& s) const;
+
+    /// Copy the current sphere state and write it to a file from a background thread.
+    /// Waits for the completion of any pending asynchronous output first.
+    void WriteParticleFileAsync(const std::string& outfilename);
+
+    /// Wait for the completion of any pending asynchronous particle output.
+    void WaitParticleOutput();
+
     /// Write contact info file
     void WriteContactInfoFile(const std::string& outfilename) const;
 
@@ -557,6 +648,41 @@ class ChSystemGpu_impl {
     /// each other
     bool defragment_on_start = true;
 
+    /// If true, the per-step force and integration kernels are captured once in a CUDA graph and replayed at each step
+    bool use_step_graph = false;
+
+    /// Launch configuration the step graph was captured for; the graph is re-captured when any of these change
+    struct StepGraphConfig {
+        unsigned int nSpheres;
+        unsigned int nSDs;
+        float stepSize_SU;
+        const BC_type* bc_types;
+        const BC_params_t<int64_t, int64_t3>* bc_params;
+        size_t nBCs;
+        CHGPU_FRICTION_MODE friction_mode;
+        CHGPU_TIME_INTEGRATOR time_integrator;
+        bool use_mat_based;
+        size_t fricMapSize;
+    };
+
+    StepGraphConfig step_graph_config;          ///< configuration of the captured step graph
+    cudaStream_t step_graph_stream = nullptr;   ///< stream used for capturing and replaying the step graph
+    cudaGraphExec_t step_graph_exec = nullptr;  ///< executable step graph (nullptr if not captured)
+
+    /// Number of steps between compactions of the contact maps (0: no compaction)
+    unsigned int contact_compaction_interval = 0;
+    unsigned int contact_spare_slots = 2;     ///< spare contact slots per sphere after compaction
+    unsigned int contact_pool_capacity = 0;   ///< capacity of the overflow pool (0: automatic)
+    unsigned int steps_since_compaction = 0;  ///< number of steps since the last compaction of the contact maps
+
+    /// Devices over which the per-step kernels are distributed (empty or a single device: current device only)
+    std::vector<int> devices;
+    std::vector<unsigned int> device_SD_begin;      ///< first SD of each device partition (plus end marker)
+    std::vector<unsigned int> device_sphere_begin;  ///< first sphere of each device partition (plus end marker)
+
+    std::thread output_thread;                          ///< background thread for asynchronous particle output
+    std::unique_ptr<ParticleSnapshot> output_snapshot;  ///< sphere state being written by the output thread
+
     /// Bit flags indicating what fields to write out during WriteParticleFile
     /// Set with the CHGPU_OUTPUT_FLAGS enum
     unsigned int output_flags;
@@ -629,7 +755,11 @@ class ChSystemGpu_impl {
     std::vector<float, cudallocator<float>> sphere_stats_buffer;
     std::vector<unsigned int, cudallocator<unsigned int>> sphere_stats_buffer_int;
 
-    /// Set of contact partners for each sphere. Only used in frictional simulations
+    /// Set of contact partners for each sphere. Only used in frictional simulations.
+    /// The contact maps (partners, active flags, history, duration, and recorded contact forces) store the slots of
+    /// sphere i in the range [contact_offsets[i], contact_offsets[i+1]), followed by an overflow pool of slots (each
+    /// owned by the sphere in contact_pool_owner) used once all slots of a sphere are taken. Initially, each sphere has
+    /// MAX_SPHERES_TOUCHED_BY_SPHERE slots and there is no pool; the maps are compacted by compactContactMaps.
     std::vector<unsigned int, cudallocator<unsigned int>> contact_partners_map;
     /// Whether the frictional contact at an index is active
     std::vector<not_stupid_bool, cudallocator<not_stupid_bool>> contact_active_map;
@@ -637,6 +767,12 @@ class ChSystemGpu_impl {
     std::vector<float3, cudallocator<float3>> contact_history_map;
     /// Tracks the duration of contact between contact pairs. Only used in multistep friction
     std::vector<float, cudallocator<float>> contact_duration;
+    /// First contact map slot of each sphere, with the start of the overflow pool as last entry
+    std::vector<unsigned int, cudallocator<unsigned int>> contact_offsets;
+    /// Sphere owning each slot of the overflow pool of the contact maps
+    std::vector<unsigned int, cudallocator<unsigned int>> contact_pool_owner;
+    /// Number of overflow pool slots claimed since the last compaction (single entry)
+    std::vector<unsigned int, cudallocator<unsigned int>> contact_pool_count;
     /// Tracks the normal contact force for a given contact pair
     std::vector<float3, cudallocator<float3>> normal_contact_force;
     /// Tracks the tangential contact force for a given contact pair
@@ -0,0 +1,55 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include "chrono_gpu/utils/ChGpuRigidBodyCoupling.h"
+
+namespace chrono {
+namespace gpu {
+
+ChGpuRigidBodyCoupling::ChGpuRigidBodyCoupling(ChSystemGpuMesh* sysGPU, ChSystem* sys) : m_sysGPU(sysGPU), m_sys(sys) {}
+
+size_t ChGpuRigidBodyCoupling::AddBody(std::shared_ptr<ChBody> body, unsigned int mesh_id) {
+    CoupledBody cbody;
+    cbody.body = body;
+    cbody.mesh_id = mesh_id;
+    cbody.force = VNULL;
+    cbody.torque = VNULL;
+    m_bodies.push_back(cbody);
+    return m_bodies.size() - 1;
+}
+
+void ChGpuRigidBodyCoupling::Synchronize() {
+    // Read back the resultant contact wrenches on all meshes in a single pass
+    m_sysGPU->CollectMeshContactForces(m_forces, m_torques);
+
+    for (auto& cbody : m_bodies) {
+        const auto& X = cbody.body->GetFrameRefToAbs();
+        m_sysGPU->ApplyMeshMotion(cbody.mesh_id, X.GetPos(), X.GetRot(), X.GetPosDt(), X.GetAngVelParent());
+
+        cbody.force = m_forces[cbody.mesh_id];
+        cbody.torque = m_torques[cbody.mesh_id];
+        cbody.body->EmptyAccumulators();
+        cbody.body->AccumulateForce(cbody.force, X.GetPos(), false);
+        cbody.body->AccumulateTorque(cbody.torque, false);
+    }
+}
+
+void ChGpuRigidBodyCoupling::Advance(double step) {
+    Synchronize();
+    m_sysGPU->AdvanceSimulation((float)step);
+    m_sys->DoStepDynamics(step);
+}
+
+}  // namespace gpu
+}  // namespace chrono
@@ -0,0 +1,83 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#pragma once
+
+#include <vector>
+
+#include "chrono/physics/ChSystem.h"
+#include "chrono/physics/ChBody.h"
+
+#include "chrono_gpu/ChApiGpu.h"
+#include "chrono_gpu/physics/ChSystemGpu.h"
+
+namespace chrono {
+namespace gpu {
+
+/// @addtogroup gpu_utils
+/// @{
+
+/// In-process coupling of Chrono rigid bodies with meshes in a Chrono::Gpu system.
+/// Each rigid body (e.g., a wheel with a rigid tire) is associated with a mesh in the ChSystemGpuMesh, with the mesh
+/// vertices expressed in the body reference frame. Mesh geometry stays on the device for the entire simulation: at
+/// each step, only the 6-DOF state of the body reference frames is applied to the GPU meshes, and only the resultant
+/// mesh contact wrenches are read back and applied to the bodies. The coupling is explicit: the wrenches applied over
+/// a step are those calculated by the GPU system at the end of the previous step.
+class CH_GPU_API ChGpuRigidBodyCoupling {
+  public:
+    /// Create a coupling between the given Chrono::Gpu system and the Chrono system containing the rigid bodies.
+    ChGpuRigidBodyCoupling(ChSystemGpuMesh* sysGPU, ChSystem* sys);
+
+    /// Associate the specified body with the GPU mesh with given index.
+    /// The mesh must have been added to the GPU system with vertices expressed in the body reference frame.
+    /// Return the index of the coupled body.
+    size_t AddBody(std::shared_ptr<ChBody> body, unsigned int mesh_id);
+
+    /// Get the number of coupled bodies.
+    size_t GetNumBodies() const { return m_bodies.size(); }
+
+    /// Apply the states of the coupled bodies to the GPU meshes and the current mesh contact wrenches to the bodies.
+    /// Forces previously accumulated on the coupled bodies are discarded.
+    void Synchronize();
+
+    /// Synchronize, then advance the state of both systems by the specified step.
+    void Advance(double step);
+
+    /// Get the contact force on the specified coupled body (applied at the body reference frame origin, expressed in
+    /// the absolute frame), as applied at the last synchronization.
+    const ChVector3d& GetForce(size_t i) const { return m_bodies[i].force; }
+
+    /// Get the contact torque on the specified coupled body (about the body reference frame origin, expressed in the
+    /// absolute frame), as applied at the last synchronization.
+    const ChVector3d& GetTorque(size_t i) const { return m_bodies[i].torque; }
+
+  private:
+    struct CoupledBody {
+        std::shared_ptr<ChBody> body;  ///< rigid body
+        unsigned int mesh_id;          ///< index of associated GPU mesh
+        ChVector3d force;              ///< current contact force (absolute frame)
+        ChVector3d torque;             ///< current contact torque (absolute frame)
+    };
+
+    ChSystemGpuMesh* m_sysGPU;          ///< associated Chrono::Gpu system
+    ChSystem* m_sys;                    ///< Chrono system containing the coupled bodies
+    std::vector<CoupledBody> m_bodies;  ///< coupled bodies
+    std::vector<ChVector3d> m_forces;   ///< contact forces on all GPU meshes
+    std::vector<ChVector3d> m_torques;  ///< contact torques on all GPU meshes
+};
+
+/// @} gpu_utils
+
+}  // namespace gpu
+}  // namespace chrono
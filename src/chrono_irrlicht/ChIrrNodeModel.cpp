@@ -23,7 +23,7 @@ ChIrrNodeModel::ChIrrNodeModel(std::weak_ptr<ChPhysicsItem> physicsitem,
                                scene::ISceneNode* parent,
                                scene::ISceneManager* mgr,
                                s32 id)
-    : ISceneNode(parent, mgr, id), m_physicsitem(physicsitem) {
+    : ISceneNode(parent, mgr, id), m_physicsitem(physicsitem), m_culling(false), m_culled(false) {
 #ifdef _DEBUG
     setDebugName("ChIrrNodeModel");
 #endif
@@ -32,8 +32,42 @@ ChIrrNodeModel::ChIrrNodeModel(std::weak_ptr<ChPhysicsItem> physicsitem,
 }
 
 void ChIrrNodeModel::OnRegisterSceneNode() {
-    if (IsVisible)
-        SceneManager->registerNodeForRendering(this);
+    if (!IsVisible)
+        return;
+
+    // Note: called after OnAnimate, so the absolute transforms of all children nodes are current
+    auto camera = SceneManager->getActiveCamera();
+    if (camera) {
+        core::aabbox3d<f32> box;
+        bool empty = true;
+        GetWorldBox_recursive(this, box, empty);
+
+        if (!empty) {
+            if (m_culling && !m_clones) {
+                // Cull if the box is entirely on the outer side of any of the frustum planes
+                const scene::SViewFrustum* frustum = camera->getViewFrustum();
+                bool outside = false;
+                for (int i = 0; i < scene::SViewFrustum::VF_PLANE_COUNT && !outside; i++)
+                    outside = (box.classifyPlaneRelation(frustum->planes[i]) == core::ISREL3D_FRONT);
+
+                if (outside) {
+                    // Skip registration of the entire subtree
+                    m_culled = true;
+                    return;
+                }
+
+                if (m_culled) {
+                    // Back in view: process deferred updates
+                    m_culled = false;
+                    UpdateChildren_recursive(this, false);
+                }
+            }
+
+            SelectLevelOfDetail_recursive(this, box.getCenter().getDistanceFrom(camera->getAbsolutePosition()));
+        }
+    }
+
+    SceneManager->registerNodeForRendering(this);
 
     ISceneNode::OnRegisterSceneNode();
 }
@@ -117,21 +151,61 @@ void ChIrrNodeModel::OnAnimate(u32 timeMs) {
 }
 
 void ChIrrNodeModel::UpdateChildren() {
-    UpdateChildren_recursive(this);
+    UpdateChildren_recursive(this, m_culled);
 }
 
-void ChIrrNodeModel::UpdateChildren_recursive(ISceneNode* node) {
+void ChIrrNodeModel::UpdateChildren_recursive(ISceneNode* node, bool defer) {
     scene::ISceneNodeList::ConstIterator it = node->getChildren().begin();
 
     for (; it != node->getChildren().end(); ++it) {
         // if (ChIrrNodeShape* mproxy = dynamic_cast<ChIrrNodeShape*>(*it))
         if ((*it)->getType() == (scene::ESCENE_NODE_TYPE)ESNT_CHIRRNODE_SHAPE) {
             ChIrrNodeShape* mproxy = (ChIrrNodeShape*)(*it);
-            mproxy->Update();
+            if (defer)
+                mproxy->DeferUpdate();
+            else
+                mproxy->Update();
+        }
+
+        if (!(*it)->getChildren().empty())
+            UpdateChildren_recursive((*it), defer);
+    }
+}
+
+void ChIrrNodeModel::GetWorldBox_recursive(ISceneNode* node, core::aabbox3d<f32>& box, bool& empty) {
+    scene::ISceneNodeList::ConstIterator it = node->getChildren().begin();
+
+    for (; it != node->getChildren().end(); ++it) {
+        if (!(*it)->isVisible())
+            continue;
+
+        auto type = (*it)->getType();
+        if (type == scene::ESNT_MESH || type == scene::ESNT_ANIMATED_MESH) {
+            auto child_box = (*it)->getTransformedBoundingBox();
+            if (empty)
+                box.reset(child_box);
+            else
+                box.addInternalBox(child_box);
+            empty = false;
+        }
+
+        if (!(*it)->getChildren().empty())
+            GetWorldBox_recursive((*it), box, empty);
+    }
+}
+
+void ChIrrNodeModel::SelectLevelOfDetail_recursive(ISceneNode* node, double distance) {
+    scene::ISceneNodeList::ConstIterator it = node->getChildren().begin();
+
+    for (; it != node->getChildren().end(); ++it) {
+        if ((*it)->getType() == (scene::ESCENE_NODE_TYPE)ESNT_CHIRRNODE_SHAPE) {
+            ChIrrNodeShape* mproxy = (ChIrrNodeShape*)(*it);
+            if (mproxy->HasLevelsOfDetail())
+                mproxy->SelectLevelOfDetail(distance);
         }
 
         if (!(*it)->getChildren().empty())
-            UpdateChildren_recursive((*it));
+            SelectLevelOfDetail_recursive((*it), distance);
     }
 }
 
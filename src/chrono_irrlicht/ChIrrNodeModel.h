@@ -51,13 +51,28 @@ class ChApiIrr ChIrrNodeModel : public irr::scene::ISceneNode {
     std::weak_ptr<ChPhysicsItem> GetPhysicsItem() { return m_physicsitem; }
 
     /// Update the chidlren Irrlicht nodes associated with individual visual shapes.
+    /// If this node is currently culled, the updates are deferred until it comes back into view.
     void UpdateChildren();
 
     /// Setup use of clones for visual models that use multiple instances of the same visual shape.
     bool SetupClones();
 
+    /// Enable/disable culling of this node against the view frustum of the active camera (default: false).
+    /// A culled node is not rendered and the updates of its visual shapes are deferred.
+    /// Nodes with visual model clones (e.g., particle clouds) are never culled.
+    void SetFrustumCulling(bool val) { m_culling = val; }
+
+    /// Return true if this node was outside the camera view frustum when the scene was last rendered.
+    bool IsCulled() const { return m_culled; }
+
   private:
-    void UpdateChildren_recursive(irr::scene::ISceneNode* node);
+    void UpdateChildren_recursive(irr::scene::ISceneNode* node, bool defer);
+
+    /// Extend the given box with the world bounding boxes of all visible mesh nodes in the specified subtree.
+    void GetWorldBox_recursive(irr::scene::ISceneNode* node, irr::core::aabbox3d<irr::f32>& box, bool& empty);
+
+    /// Select the levels of detail of all visual shapes in the specified subtree.
+    void SelectLevelOfDetail_recursive(irr::scene::ISceneNode* node, double distance);
 
     virtual irr::scene::ESCENE_NODE_TYPE getType() const override;
     virtual void OnRegisterSceneNode() override;
@@ -69,6 +84,8 @@ class ChApiIrr ChIrrNodeModel : public irr::scene::ISceneNode {
     irr::core::aabbox3d<irr::f32> m_box;
     std::weak_ptr<ChPhysicsItem> m_physicsitem;
     bool m_clones;
+    bool m_culling;  ///< cull against the camera view frustum?
+    bool m_culled;   ///< outside the view frustum at last rendering?
 };
 
 /// @} irrlicht_module
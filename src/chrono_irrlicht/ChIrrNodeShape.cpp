@@ -10,6 +10,8 @@
 //
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/core/ChVector3.h"
 
 #include "chrono_irrlicht/ChIrrNodeShape.h"
@@ -21,7 +23,16 @@ namespace irrlicht {
 using namespace irr;
 
 ChIrrNodeShape::ChIrrNodeShape(std::shared_ptr<ChVisualShape> shape, ISceneNode* parent)
-    : ISceneNode(parent, parent->getSceneManager(), 0), m_shape(shape), m_initial_update(true) {}
+    : ISceneNode(parent, parent->getSceneManager(), 0),
+      m_shape(shape),
+      m_initial_update(true),
+      m_pending_all(false),
+      m_lod(0) {}
+
+ChIrrNodeShape::~ChIrrNodeShape() {
+    for (auto& lod : m_lods)
+        lod.second->drop();
+}
 
 scene::ISceneNode* ChIrrNodeShape::clone(ISceneNode* newParent, scene::ISceneManager* newManager) {
     if (!newParent)
@@ -72,6 +83,60 @@ void ChIrrNodeShape::Update() {
     m_initial_update = false;
 }
 
+void ChIrrNodeShape::DeferUpdate() {
+    if (!m_shape || m_initial_update || !m_shape->IsMutable() || m_pending_all)
+        return;
+
+    auto trianglemesh = std::dynamic_pointer_cast<ChVisualShapeTriangleMesh>(m_shape);
+    if (!trianglemesh || !trianglemesh->FixedConnectivity())
+        return;
+
+    const auto& modified = trianglemesh->GetModifiedVertices();
+    m_pending_vertices.insert(m_pending_vertices.end(), modified.begin(), modified.end());
+
+    // Remove duplicates once in a while; fall back to a full vertex update if most vertices were modified
+    auto nvertices = trianglemesh->GetMesh()->GetCoordsVertices().size();
+    if (m_pending_vertices.size() > nvertices) {
+        std::sort(m_pending_vertices.begin(), m_pending_vertices.end());
+        m_pending_vertices.erase(std::unique(m_pending_vertices.begin(), m_pending_vertices.end()),
+                                 m_pending_vertices.end());
+        if (m_pending_vertices.size() > nvertices / 2) {
+            m_pending_vertices.clear();
+            m_pending_all = true;
+        }
+    }
+}
+
+void ChIrrNodeShape::AddLevelOfDetail(double distance, ISceneNode* node) {
+    assert(m_lods.empty() || distance > m_lods.back().first);
+    node->grab();
+    node->setVisible(false);
+    m_lods.push_back({distance, node});
+}
+
+// Refresh the absolute transforms of a node that was just made visible (not animated while hidden).
+static void UpdateAbsolutePosition_recursive(scene::ISceneNode* node) {
+    node->updateAbsolutePosition();
+    for (auto it = node->getChildren().begin(); it != node->getChildren().end(); ++it)
+        UpdateAbsolutePosition_recursive(*it);
+}
+
+void ChIrrNodeShape::SelectLevelOfDetail(double distance) {
+    int lod = 0;
+    while (lod < (int)m_lods.size() && distance > m_lods[lod].first)
+        lod++;
+
+    if (lod == m_lod)
+        return;
+
+    ISceneNode* current = (m_lod == 0) ? this : m_lods[m_lod - 1].second;
+    ISceneNode* selected = (lod == 0) ? this : m_lods[lod - 1].second;
+    current->setVisible(false);
+    selected->setVisible(true);
+    UpdateAbsolutePosition_recursive(selected);
+    m_lod = lod;
+}
+
 static video::S3DVertex ToIrrlichtVertex(const ChVector3d& pos,
                                          const ChVector3d& nrm,
                                          const ChVector2d& uv,
@@ -425,14 +490,26 @@ void ChIrrNodeShape::UpdateTriangleMeshFixedConnectivity(std::shared_ptr<ChVisua
         meshnode->setMaterialFlag(video::EMF_BACK_FACE_CULLING, trianglemesh->IsBackfaceCull());
 
     } else {
-        // Incremental update of the Irrlicht mesh
-        for (auto i : trianglemesh->GetModifiedVertices()) {
+        // Incremental update of the Irrlicht mesh (including vertices modified while the update was deferred)
+        auto update_vertex = [&](unsigned int i) {
             vertexbuffer[i].Pos = core::vector3df((f32)vertices[i].x(), (f32)vertices[i].y(), (f32)vertices[i].z());
             vertexbuffer[i].Normal = core::vector3df((f32)normals[i].x(), (f32)normals[i].y(), (f32)normals[i].z());
             if (has_colors) {
                 vertexbuffer[i].Color = tools::ToIrrlichtSColor(colors[i]);
             }
+        };
+
+        if (m_pending_all) {
+            for (unsigned int i = 0; i < nvertices; i++)
+                update_vertex(i);
+        } else {
+            for (auto i : m_pending_vertices)
+                update_vertex(i);
+            for (auto i : trianglemesh->GetModifiedVertices())
+                update_vertex(i);
         }
+        m_pending_vertices.clear();
+        m_pending_all = false;
     }
 
     irrmesh->setDirty();                                         // to force update of hardware buffers
@@ -13,6 +13,9 @@
 #ifndef CH_IRR_NODE_SHAPE_H
 #define CH_IRR_NODE_SHAPE_H
 
+#include <vector>
+#include <utility>
+
 #include <irrlicht.h>
 
 #include "chrono/assets/ChVisualShape.h"
@@ -40,7 +43,7 @@ class ChApiIrr ChIrrNodeShape : public irr::scene::ISceneNode {
                    irr::scene::ISceneNode* parent         ///< parent node in Irrlicht hierarchy
     );
 
-    ~ChIrrNodeShape() {}
+    ~ChIrrNodeShape();
 
     /// Get the associated visualization shape.
     std::shared_ptr<ChVisualShape>& GetVisualShape() { return m_shape; }
@@ -48,6 +51,21 @@ class ChApiIrr ChIrrNodeShape : public irr::scene::ISceneNode {
     /// Update to reflect possible changes in the associated visual shape.
     void Update();
 
+    /// Defer the update of the associated visual shape (e.g., if the shape is not currently in view).
+    /// For a triangle mesh with fixed connectivity, the currently modified vertices are recorded so that they can be
+    /// processed at the next call to Update().
+    void DeferUpdate();
+
+    /// Add a simplified version of this shape, to be rendered if farther than the given distance from the camera.
+    /// Levels of detail must be added in order of increasing distance. The given node is hidden until selected.
+    void AddLevelOfDetail(double distance, irr::scene::ISceneNode* node);
+
+    /// Return true if levels of detail were defined for this shape.
+    bool HasLevelsOfDetail() const { return !m_lods.empty(); }
+
+    /// Show only the level of detail appropriate for the specified distance from the camera.
+    void SelectLevelOfDetail(double distance);
+
   private:
     void UpdateTriangleMesh(std::shared_ptr<ChVisualShapeTriangleMesh> trianglemesh);
     void UpdateTriangleMesh_mat(std::shared_ptr<ChVisualShapeTriangleMesh> trianglemesh);
@@ -67,6 +85,12 @@ class ChApiIrr ChIrrNodeShape : public irr::scene::ISceneNode {
     irr::core::aabbox3d<irr::f32> m_box;     ///< bounding box
     std::shared_ptr<ChVisualShape> m_shape;  ///< associated visualization shape
     bool m_initial_update;                   ///< flag forcing a first update
+
+    std::vector<unsigned int> m_pending_vertices;  ///< modified mesh vertices with deferred update
+    bool m_pending_all;                            ///< update all mesh vertices at next update
+
+    std::vector<std::pair<double, irr::scene::ISceneNode*>> m_lods;  ///< levels of detail (min. distance, node)
+    int m_lod;                                                        ///< current level of detail (0: this node)
 };
 
 /// @} irrlicht_module
@@ -20,6 +20,7 @@
 
 #include "chrono/utils/ChProfiler.h"
 #include "chrono/utils/ChUtils.h"
+#include "chrono/utils/ChMeshSimplification.h"
 
 #include "chrono/assets/ChVisualShapeTriangleMesh.h"
 #include "chrono/assets/ChVisualShapeSurface.h"
@@ -56,7 +57,11 @@ ChVisualSystemIrrlicht::ChVisualSystemIrrlicht()
       m_yup(true),
       m_use_effects(false),
       m_modal(false),
-      m_quality(0) {
+      m_quality(0),
+      m_frustum_culling(false),
+      m_lod_levels(1),
+      m_lod_distance(0),
+      m_lod_min_triangles(1000) {
     // Set default device parameter values
     m_device_params.AntiAlias = true;
     m_device_params.Bits = 32;
@@ -166,6 +171,16 @@ void ChVisualSystemIrrlicht::SetSymbolScale(double scale) {
 
 // -----------------------------------------------------------------------------
 
+void ChVisualSystemIrrlicht::EnableFrustumCulling(bool val) {
+    m_frustum_culling = val;
+}
+
+void ChVisualSystemIrrlicht::SetLevelOfDetail(unsigned int num_levels, double distance, unsigned int min_triangles) {
+    m_lod_levels = std::max(num_levels, 1u);
+    m_lod_distance = distance;
+    m_lod_min_triangles = min_triangles;
+}
+
 void ChVisualSystemIrrlicht::AttachSystem(ChSystem* sys) {
     ChVisualSystem::AttachSystem(sys);
 
@@ -788,6 +803,8 @@ void ChVisualSystemIrrlicht::CreateIrrNode(std::shared_ptr<ChPhysicsItem> item)
     bool ok = m_nodes.insert({item.get(), node}).second;
     assert(ok);
 
+    node->SetFrustumCulling(m_frustum_culling);
+
     // Remove all Irrlicht scene nodes from the ChIrrNodeModel
     node->removeAll();
 
@@ -800,7 +817,7 @@ void ChVisualSystemIrrlicht::CreateIrrNode(std::shared_ptr<ChPhysicsItem> item)
     // Recursively populate the ChIrrNodeModel with Irrlicht scene nodes for each visual shape.
     // Begin with identity transform relative to the physics item.
     ChFrame<> frame;
-    PopulateIrrNode(fillnode, item->GetVisualModel(), frame);
+    PopulateIrrNode(fillnode, item->GetVisualModel(), frame, item->GetNumVisualModelClones() == 0);
 }
 
 static void mflipSurfacesOnX(IMesh* mesh) {
@@ -845,9 +862,78 @@ static void SetVisualMaterial(ISceneNode* node, std::shared_ptr<ChVisualShape> s
         node->getMaterial(i).ColorMaterial = video::ECM_NONE;
 }
 
+// Create an Irrlicht scene node for a triangle mesh shape.
+static ChIrrNodeShape* CreateTriangleMeshNode(ISceneNode* node,
+                                              std::shared_ptr<ChVisualShapeTriangleMesh> trimesh,
+                                              const core::matrix4& shape_m4) {
+    // Create a number of Irrlicht mesh buffers equal to the number of materials.
+    // If no materials defined, create a single mesh buffer.
+    SMesh* smesh = new SMesh;
+    int nbuffers = (int)trimesh->GetNumMaterials();
+    nbuffers = std::max(nbuffers, 1);
+    for (int ibuffer = 0; ibuffer < nbuffers; ibuffer++) {
+        CDynamicMeshBuffer* buffer = new CDynamicMeshBuffer(video::EVT_STANDARD, video::EIT_32BIT);
+        smesh->addMeshBuffer(buffer);
+        buffer->drop();
+    }
+
+    ChIrrNodeShape* mproxynode = new ChIrrNodeShape(trimesh, node);
+    ISceneNode* mchildnode = node->getSceneManager()->addMeshSceneNode(smesh, mproxynode);
+    smesh->drop();
+
+    mchildnode->setPosition(shape_m4.getTranslation());
+    mchildnode->setRotation(shape_m4.getRotationDegrees());
+
+    mproxynode->Update();  // force syncing of triangle positions & face indexes
+
+    SetVisualMaterial(mchildnode, trimesh);
+    mchildnode->setMaterialFlag(video::EMF_WIREFRAME, trimesh->IsWireframe());
+    mchildnode->setMaterialFlag(video::EMF_BACK_FACE_CULLING, trimesh->IsBackfaceCull());
+
+    return mproxynode;
+}
+
+void ChVisualSystemIrrlicht::CreateLevelsOfDetail(ISceneNode* node,
+                                                  ChIrrNodeShape* trimesh_node,
+                                                  const core::matrix4& shape_m4) {
+    auto trimesh = std::static_pointer_cast<ChVisualShapeTriangleMesh>(trimesh_node->GetVisualShape());
+    const auto& mesh = trimesh->GetMesh();
+    if (trimesh->IsMutable() || mesh->GetNumTriangles() < m_lod_min_triangles)
+        return;
+
+    // The clustering cell size is doubled at each level, starting at 1/64 of the mesh bounding box diagonal
+    auto aabb = mesh->GetBoundingBox();
+    double cell_size = (aabb.max - aabb.min).Length() / 64;
+    double distance = m_lod_distance;
+    unsigned int num_triangles = mesh->GetNumTriangles();
+
+    for (unsigned int k = 1; k < m_lod_levels; k++) {
+        auto lod_mesh = utils::SimplifyMesh(*mesh, cell_size);
+        if (lod_mesh->GetNumTriangles() == 0 || lod_mesh->GetNumTriangles() >= num_triangles)
+            break;
+
+        auto lod_shape = chrono_types::make_shared<ChVisualShapeTriangleMesh>();
+        lod_shape->SetMesh(lod_mesh, false);
+        for (const auto& mat : trimesh->GetMaterials())
+            lod_shape->AddMaterial(mat);
+        lod_shape->SetWireframe(trimesh->IsWireframe());
+        lod_shape->SetBackfaceCull(trimesh->IsBackfaceCull());
+        lod_shape->SetMutable(false);
+
+        auto lod_node = CreateTriangleMeshNode(node, lod_shape, shape_m4);
+        trimesh_node->AddLevelOfDetail(distance, lod_node);
+        lod_node->drop();
+
+        num_triangles = lod_mesh->GetNumTriangles();
+        cell_size *= 2;
+        distance *= 2;
+    }
+}
+
 void ChVisualSystemIrrlicht::PopulateIrrNode(ISceneNode* node,
                                              std::shared_ptr<ChVisualModel> model,
-                                             const ChFrame<>& parent_frame) {
+                                             const ChFrame<>& parent_frame,
+                                             bool use_lod) {
     for (const auto& shape_instance : model->GetShapeInstances()) {
         auto& shape = shape_instance.first;
         auto& shape_frame = shape_instance.second;
@@ -881,30 +967,10 @@ void ChVisualSystemIrrlicht::PopulateIrrNode(ISceneNode* node,
                 mchildnode->setMaterialFlag(video::EMF_BACK_FACE_CULLING, true);
             }
         } else if (auto trimesh = std::dynamic_pointer_cast<ChVisualShapeTriangleMesh>(shape)) {
-            // Create a number of Irrlicht mesh buffers equal to the number of materials.
-            // If no materials defined, create a single mesh buffer.
-            SMesh* smesh = new SMesh;
-            int nbuffers = (int)trimesh->GetNumMaterials();
-            nbuffers = std::max(nbuffers, 1);
-            for (int ibuffer = 0; ibuffer < nbuffers; ibuffer++) {
-                CDynamicMeshBuffer* buffer = new CDynamicMeshBuffer(video::EVT_STANDARD, video::EIT_32BIT);
-                smesh->addMeshBuffer(buffer);
-                buffer->drop();
-            }
-
-            ChIrrNodeShape* mproxynode = new ChIrrNodeShape(trimesh, node);
-            ISceneNode* mchildnode = GetSceneManager()->addMeshSceneNode(smesh, mproxynode);
-            smesh->drop();
-
-            mchildnode->setPosition(shape_m4.getTranslation());
-            mchildnode->setRotation(shape_m4.getRotationDegrees());
-
-            mproxynode->Update();  // force syncing of triangle positions & face indexes
+            ChIrrNodeShape* mproxynode = CreateTriangleMeshNode(node, trimesh, shape_m4);
+            if (use_lod && m_lod_levels > 1)
+                CreateLevelsOfDetail(node, mproxynode, shape_m4);
             mproxynode->drop();
-
-            SetVisualMaterial(mchildnode, shape);
-            mchildnode->setMaterialFlag(video::EMF_WIREFRAME, trimesh->IsWireframe());
-            mchildnode->setMaterialFlag(video::EMF_BACK_FACE_CULLING, trimesh->IsBackfaceCull());
         } else if (auto surf = std::dynamic_pointer_cast<ChVisualShapeSurface>(shape)) {
             CDynamicMeshBuffer* buffer = new CDynamicMeshBuffer(video::EVT_STANDARD, video::EIT_32BIT);
             SMesh* newmesh = new SMesh;
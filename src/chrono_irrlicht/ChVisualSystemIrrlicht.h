@@ -106,6 +106,20 @@ class ChApiIrr ChVisualSystemIrrlicht : virtual public ChVisualSystem {
     /// Set the scale for symbol drawing (default: 1).
     void SetSymbolScale(double scale);
 
+    /// Enable/disable frustum culling of physics items (default: false).
+    /// If enabled, physics items entirely outside the view frustum of the active camera are not rendered and the
+    /// updates of their mutable visual shapes (e.g., deformable terrain meshes) are deferred until they come back into
+    /// view. Only the modified vertices of meshes with fixed connectivity are processed when updates resume.
+    /// Must be called before BindAll() or BindItem().
+    void EnableFrustumCulling(bool val);
+
+    /// Set the levels of detail for the non-mutable triangle mesh shapes of physics items (default: 1, i.e., no LOD).
+    /// For each mesh with at least the specified number of triangles, up to num_levels-1 simplified meshes are
+    /// generated by vertex clustering (see utils::SimplifyMesh) and level k > 0 is rendered if the item is farther than
+    /// 2^(k-1) * distance from the camera. Simplified meshes do not use texture coordinates.
+    /// Must be called before BindAll() or BindItem().
+    void SetLevelOfDetail(unsigned int num_levels, double distance, unsigned int min_triangles = 1000);
+
     /// Initialize the visualization system.
     /// This creates the Irrlicht device using the current values for the optional device parameters.
     virtual void Initialize() override;
@@ -361,9 +375,16 @@ class ChApiIrr ChVisualSystemIrrlicht : virtual public ChVisualSystem {
     void CreateIrrNode(std::shared_ptr<ChPhysicsItem> item);
 
     /// Populate the ChIrrNodeModel for the visual model instance of the specified physics item.
+    /// If use_lod is true, levels of detail are generated for the triangle mesh shapes (see SetLevelOfDetail).
     void PopulateIrrNode(irr::scene::ISceneNode* node,
                          std::shared_ptr<ChVisualModel> model,
-                         const ChFrame<>& parent_frame);
+                         const ChFrame<>& parent_frame,
+                         bool use_lod = false);
+
+    /// Create the levels of detail for the specified triangle mesh node.
+    void CreateLevelsOfDetail(irr::scene::ISceneNode* node,
+                              ChIrrNodeShape* trimesh_node,
+                              const irr::core::matrix4& shape_m4);
 
     /// Purge Irrlicht nodes associated with a deleted physics item or with a deleted visual model.
     void PurgeIrrNodes();
@@ -408,6 +429,11 @@ class ChApiIrr ChVisualSystemIrrlicht : virtual public ChVisualSystem {
     bool m_utility_flag = false;                       ///< utility flag that may be accessed from outside
     irr::u32 m_quality;                                ///< JPEG quality level (for saved snapshots)
 
+    bool m_frustum_culling;            ///< cull physics items outside the camera view frustum
+    unsigned int m_lod_levels;         ///< number of levels of detail for triangle meshes
+    double m_lod_distance;             ///< camera distance for the first simplified level of detail
+    unsigned int m_lod_min_triangles;  ///< minimum number of triangles of meshes with levels of detail
+
     // shared meshes
     irr::scene::IAnimatedMesh* sphereMesh;
     irr::scene::IMesh* cubeMesh;
@@ -12,6 +12,9 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
 #include <iomanip>
 
 #include "chrono_modal/ChModalAssembly.h"
@@ -45,6 +48,7 @@ ChModalAssembly::ChModalAssembly(const ChModalAssembly& other) : ChAssembly(othe
     m_is_model_reduced = other.m_is_model_reduced;
     m_internal_nodes_update = other.m_internal_nodes_update;
     m_modal_automatic_gravity = other.m_modal_automatic_gravity;
+    m_modes_cache_file = other.m_modes_cache_file;
 
     modal_q = other.modal_q;
     modal_q_dt = other.modal_q_dt;
@@ -202,26 +206,41 @@ void ChModalAssembly::DoModalReduction(ChSparseMatrix& full_M,
     this->PartitionLocalSystemMatrices();
 
     //// start of modal reduction transformation
-    // 1) compute eigenvalue and eigenvectors
-    if (m_modal_reduction_type == ReductionType::HERTING) {
-        unsigned int expected_eigs = 0;
-        for (auto freq_span : n_modes_settings.freq_spans)
-            expected_eigs += freq_span.nmodes;
-
-        if (expected_eigs < 6) {
-            std::cout << "*** At least six rigid-body modes are required for the HERTING modal reduction. "
-                      << "The default settings are used." << std::endl;
-            this->ComputeModesExternalData(this->full_M_loc, this->full_K_loc, this->full_Cq_loc,
-                                           ChModalSolveUndamped(6));
-        } else
-            this->ComputeModesExternalData(this->full_M_loc, this->full_K_loc, this->full_Cq_loc, n_modes_settings);
-
-    } else if (m_modal_reduction_type == ReductionType::CRAIG_BAMPTON) {
-        this->ComputeModesExternalData(this->M_II_loc, this->K_II_loc, this->Cq_II_loc, n_modes_settings);
+    // 1) compute eigenvalue and eigenvectors (or load them from the cache file)
+    std::vector<double> fingerprint;
+    bool modes_cached = false;
+    if (!m_modes_cache_file.empty()) {
+        fingerprint = ComputeModesFingerprint(n_modes_settings);
+        modes_cached = ReadModesCache(fingerprint);
+        if (this->m_verbose && modes_cached)
+            std::cout << "*** Modes loaded from " << m_modes_cache_file << std::endl;
+    }
+
+    if (!modes_cached) {
+        if (m_modal_reduction_type == ReductionType::HERTING) {
+            unsigned int expected_eigs = 0;
+            for (auto freq_span : n_modes_settings.freq_spans)
+                expected_eigs += freq_span.nmodes;
+
+            if (expected_eigs < 6) {
+                std::cout << "*** At least six rigid-body modes are required for the HERTING modal reduction. "
+                          << "The default settings are used." << std::endl;
+                this->ComputeModesExternalData(this->full_M_loc, this->full_K_loc, this->full_Cq_loc,
+                                               ChModalSolveUndamped(6));
+            } else
+                this->ComputeModesExternalData(this->full_M_loc, this->full_K_loc, this->full_Cq_loc,
+                                               n_modes_settings);
+
+        } else if (m_modal_reduction_type == ReductionType::CRAIG_BAMPTON) {
+            this->ComputeModesExternalData(this->M_II_loc, this->K_II_loc, this->Cq_II_loc, n_modes_settings);
 
-    } else {
-        std::cout << "*** The modal reduction type is specified incorrectly..." << std::endl;
-        assert(0);
+        } else {
+            std::cout << "*** The modal reduction type is specified incorrectly..." << std::endl;
+            assert(0);
+        }
+
+        if (!m_modes_cache_file.empty())
+            WriteModesCache(fingerprint);
     }
 
     if (this->m_verbose) {
@@ -673,6 +692,115 @@ void ChModalAssembly::PartitionLocalSystemMatrices() {
     full_M_loc_ext.makeCompressed();
 }
 
+void ChModalAssembly::SolveInternalStiffness(const ChMatrixDynamic<>& rhs, ChMatrixDynamic<>& x) const {
+    x.resize(rhs.rows(), rhs.cols());
+
+    // Solve blocks of right-hand sides concurrently (the factorization is only read by the solve calls)
+    int nthreads = system ? system->GetNumThreadsChrono() : 1;
+    int nblocks = std::max(1, std::min(nthreads, (int)rhs.cols()));
+    int block_size = ((int)rhs.cols() + nblocks - 1) / nblocks;
+
+#pragma omp parallel for schedule(static) num_threads(nblocks) if (nblocks > 1)
+    for (int ib = 0; ib < nblocks; ib++) {
+        int first = ib * block_size;
+        int ncols = std::min(block_size, (int)rhs.cols() - first);
+        if (ncols > 0)
+            x.middleCols(first, ncols) = m_solver_invKIIc.solve(rhs.middleCols(first, ncols));
+    }
+}
+
+// Position-weighted checksum of the nonzeros of a sparse matrix
+static void AppendMatrixFingerprint(const ChSparseMatrix& A, std::vector<double>& fingerprint) {
+    double sum = 0;
+    double weighted_sum = 0;
+    for (int k = 0; k < A.outerSize(); ++k)
+        for (ChSparseMatrix::InnerIterator it(A, k); it; ++it) {
+            sum += it.value();
+            weighted_sum += it.value() * (1 + (31 * (size_t)it.row() + 17 * (size_t)it.col()) % 101);
+        }
+    fingerprint.push_back((double)A.rows());
+    fingerprint.push_back((double)A.cols());
+    fingerprint.push_back((double)A.nonZeros());
+    fingerprint.push_back(sum);
+    fingerprint.push_back(weighted_sum);
+}
+
+std::vector<double> ChModalAssembly::ComputeModesFingerprint(const ChModalSolveUndamped& n_modes_settings) const {
+    std::vector<double> fingerprint;
+    fingerprint.push_back((double)m_modal_reduction_type);
+    fingerprint.push_back((double)m_num_coords_vel_boundary);
+    fingerprint.push_back((double)m_num_coords_vel_internal);
+    for (const auto& span : n_modes_settings.freq_spans) {
+        fingerprint.push_back((double)span.nmodes);
+        fingerprint.push_back(span.freq);
+    }
+    AppendMatrixFingerprint(full_M_loc, fingerprint);
+    AppendMatrixFingerprint(full_K_loc, fingerprint);
+    AppendMatrixFingerprint(full_Cq_loc, fingerprint);
+    return fingerprint;
+}
+
+static const char modes_cache_tag[8] = {'C', 'H', 'M', 'O', 'D', 'E', 'S', '1'};
+
+bool ChModalAssembly::ReadModesCache(const std::vector<double>& fingerprint) {
+    std::ifstream file(m_modes_cache_file, std::ios::binary);
+    if (!file.good())
+        return false;
+
+    char tag[8];
+    uint64_t size;
+    file.read(tag, sizeof(tag));
+    file.read(reinterpret_cast<char*>(&size), sizeof(size));
+    if (!file || !std::equal(tag, tag + 8, modes_cache_tag) || size != fingerprint.size())
+        return false;
+    std::vector<double> cached(size);
+    file.read(reinterpret_cast<char*>(cached.data()), size * sizeof(double));
+    if (!file || cached != fingerprint)
+        return false;
+
+    uint64_t rows, cols;
+    file.read(reinterpret_cast<char*>(&rows), sizeof(rows));
+    file.read(reinterpret_cast<char*>(&cols), sizeof(cols));
+    if (!file || rows > (uint64_t)(full_M_loc.rows() + full_Cq_loc.rows()))
+        return false;
+
+    ChMatrixDynamic<std::complex<double>> eigvect(rows, cols);
+    ChVectorDynamic<std::complex<double>> eigvals(cols);
+    ChVectorDynamic<double> freq(cols);
+    file.read(reinterpret_cast<char*>(eigvect.data()), rows * cols * sizeof(std::complex<double>));
+    file.read(reinterpret_cast<char*>(eigvals.data()), cols * sizeof(std::complex<double>));
+    file.read(reinterpret_cast<char*>(freq.data()), cols * sizeof(double));
+    if (!file)
+        return false;
+
+    m_modal_eigvect = eigvect;
+    m_modal_eigvals = eigvals;
+    m_modal_freq = freq;
+    m_modal_damping_ratios.setZero(cols);
+
+    return true;
+}
+
+void ChModalAssembly::WriteModesCache(const std::vector<double>& fingerprint) const {
+    std::ofstream file(m_modes_cache_file, std::ios::binary);
+    if (!file.good()) {
+        std::cerr << "WARNING: cannot write the modes cache file " << m_modes_cache_file << std::endl;
+        return;
+    }
+
+    uint64_t size = fingerprint.size();
+    uint64_t rows = m_modal_eigvect.rows();
+    uint64_t cols = m_modal_eigvect.cols();
+    file.write(modes_cache_tag, sizeof(modes_cache_tag));
+    file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    file.write(reinterpret_cast<const char*>(fingerprint.data()), size * sizeof(double));
+    file.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+    file.write(reinterpret_cast<const char*>(&cols), sizeof(cols));
+    file.write(reinterpret_cast<const char*>(m_modal_eigvect.data()), rows * cols * sizeof(std::complex<double>));
+    file.write(reinterpret_cast<const char*>(m_modal_eigvals.data()), cols * sizeof(std::complex<double>));
+    file.write(reinterpret_cast<const char*>(m_modal_freq.data()), cols * sizeof(double));
+}
+
 void ChModalAssembly::ApplyModeAccelerationTransformation(const ChModalDamping& damping_model) {
     assert(m_modal_eigvect.cols() >= 6);  // at least six rigid-body modes are required.
 
@@ -710,19 +838,19 @@ void ChModalAssembly::ApplyModeAccelerationTransformation(const ChModalDamping&
         Psi_S_LambdaI.setZero(m_num_constr_internal, m_num_coords_vel_boundary);
     // ChMatrixDynamic<> Psi_S_C(m_num_coords_vel_internal + m_num_constr_internal, m_num_coords_vel_boundary);
 
-    for (unsigned int i = 0; i < m_num_coords_vel_boundary; ++i) {
-        ChVectorDynamic<> rhs(m_num_coords_vel_internal + m_num_constr_internal);
+    {
+        ChMatrixDynamic<> rhs(m_num_coords_vel_internal + m_num_constr_internal, m_num_coords_vel_boundary);
+        rhs.topRows(m_num_coords_vel_internal) = K_IB_loc.toDense();
         if (m_num_constr_internal)
-            rhs << K_IB_loc.col(i).toDense(), Cq_IB_loc.col(i).toDense() * m_scaling_factor_CqI;
-        else
-            rhs << K_IB_loc.col(i).toDense();
+            rhs.bottomRows(m_num_constr_internal) = Cq_IB_loc.toDense() * m_scaling_factor_CqI;
 
-        ChVectorDynamic<> x = m_solver_invKIIc.solve(rhs.sparseView());
+        ChMatrixDynamic<> x;
+        SolveInternalStiffness(rhs, x);
 
-        Psi_S.col(i) = -x.head(m_num_coords_vel_internal);
-        // Psi_S_C.col(i) = -x;
+        Psi_S = -x.topRows(m_num_coords_vel_internal);
+        // Psi_S_C = -x;
         if (m_num_constr_internal)
-            Psi_S_LambdaI.col(i) = -x.tail(m_num_constr_internal);
+            Psi_S_LambdaI = -x.bottomRows(m_num_constr_internal);
     }
 
     // 2) Matrix of dynamic modes (V_B and V_I already computed, reuse K_IIc already factored before.
@@ -754,19 +882,20 @@ void ChModalAssembly::ApplyModeAccelerationTransformation(const ChModalDamping&
         rhs_dyn = M_II_loc * V_I;
     }
 
-    for (unsigned int i = 0; i < m_num_coords_modal - m_num_coords_static_correction; ++i) {
-        ChVectorDynamic<> rhs(m_num_coords_vel_internal + m_num_constr_internal);
+    {
+        unsigned int num_dynamic_modes = m_num_coords_modal - m_num_coords_static_correction;
+        ChMatrixDynamic<> rhs(m_num_coords_vel_internal + m_num_constr_internal, num_dynamic_modes);
+        rhs.topRows(m_num_coords_vel_internal) = rhs_dyn.leftCols(num_dynamic_modes);
         if (m_num_constr_internal)
-            rhs << rhs_dyn.col(i), Eigen::VectorXd::Zero(m_num_constr_internal);
-        else
-            rhs << rhs_dyn.col(i);
+            rhs.bottomRows(m_num_constr_internal).setZero();
 
-        ChVectorDynamic<> x = m_solver_invKIIc.solve(rhs.sparseView());
+        ChMatrixDynamic<> x;
+        SolveInternalStiffness(rhs, x);
 
-        Psi_D.col(i) = -x.head(m_num_coords_vel_internal);
-        // Psi_D_C.col(i) = -x;
+        Psi_D = -x.topRows(m_num_coords_vel_internal);
+        // Psi_D_C = -x;
         if (m_num_constr_internal)
-            Psi_D_LambdaI.col(i) = -x.tail(m_num_constr_internal);
+            Psi_D_LambdaI = -x.bottomRows(m_num_constr_internal);
     }
 
     ChMatrixDynamic<> M_SS =
@@ -117,6 +117,12 @@ class ChApiModal ChModalAssembly : public ChAssembly {
     /// Set verbose output.
     void SetVerbose(bool verbose) { this->m_verbose = verbose; }
 
+    /// Set the name of a file used to cache the modes computed in DoModalReduction() (default: none).
+    /// If the file exists and was written for the same reduction type, modal settings, and local M, K, Cq matrices,
+    /// the modes are loaded from the file and the eigenvalue solution is skipped; otherwise, the modes are computed
+    /// and written to the file. The static and dynamic mode transformations are always recomputed.
+    void SetModesCacheFile(const std::string& filename) { m_modes_cache_file = filename; }
+
     /// Set whether the static correction is used. By default, it is false.
     /// When some external forces are imposed on the internal bodies and nodes, the static correction is important to
     /// obtain a reasonable accurary of the elastic deformation and internal forces of finite elements, and
@@ -558,6 +564,19 @@ class ChApiModal ChModalAssembly : public ChAssembly {
     /// Compute the modal M,R,K,Cq matrices which are the tangent matrices used in the time stepper.
     void ComputeModalKRMmatricesGlobal(double Kfactor = 1.0, double Rfactor = 1.0, double Mfactor = 1.0);
 
+    /// Solve K_IIc * x = rhs for multiple right-hand sides, using the factorization of K_IIc.
+    /// The columns of rhs are split in blocks solved in parallel, using the number of Chrono threads.
+    void SolveInternalStiffness(const ChMatrixDynamic<>& rhs, ChMatrixDynamic<>& x) const;
+
+    /// Compute a fingerprint of the local M, K, Cq matrices and modal settings, used to validate the modes cache.
+    std::vector<double> ComputeModesFingerprint(const ChModalSolveUndamped& n_modes_settings) const;
+
+    /// Load the modes from the cache file, if it matches the given fingerprint. Return true if successful.
+    bool ReadModesCache(const std::vector<double>& fingerprint);
+
+    /// Write the current modes and the given fingerprint to the cache file.
+    void WriteModesCache(const std::vector<double>& fingerprint) const;
+
     /// [INTERNAL USE ONLY]
     /// Both Herting and Craig-Bampton reductions are implemented in this function.
     void ApplyModeAccelerationTransformation(const ChModalDamping& damping_model = ChModalDampingNone());
@@ -610,6 +629,8 @@ class ChApiModal ChModalAssembly : public ChAssembly {
     Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>>
         m_solver_invKIIc;  // linear solver for K_IIc^{-1}
 
+    std::string m_modes_cache_file;  ///< file used to cache the modes computed for the modal reduction
+
     // Results of eigenvalue analysis like ComputeModes() or ComputeModesDamped():
     ChMatrixDynamic<std::complex<double>> m_modal_eigvect;  // eigenvectors
     ChVectorDynamic<std::complex<double>> m_modal_eigvals;  // eigenvalues
@@ -0,0 +1,262 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Utilities for reduced-fidelity robot models:
+// - cache of triangle meshes shared by all robot instances
+// - mass properties of a rigid body lumping several robot parts
+// - force-element wheel model
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <unordered_map>
+
+#include "chrono/physics/ChInertiaUtils.h"
+#include "chrono/physics/ChSystem.h"
+
+#include "chrono_models/robot/RobotReducedModel.h"
+
+namespace chrono {
+
+// =============================================================================
+
+std::shared_ptr<ChTriangleMeshConnected> RobotMeshCache::GetMesh(const std::string& filename,
+                                                                 bool load_normals,
+                                                                 bool load_uv) {
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::shared_ptr<ChTriangleMeshConnected>> meshes;
+
+    std::string key = filename + (load_normals ? "1" : "0") + (load_uv ? "1" : "0");
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto found = meshes.find(key);
+    if (found != meshes.end())
+        return found->second;
+
+    auto trimesh = ChTriangleMeshConnected::CreateFromWavefrontFile(filename, load_normals, load_uv);
+    if (!trimesh)
+        return trimesh;
+    trimesh->RepairDuplicateVertexes(1e-9);  // if meshes are not watertight
+    meshes[key] = trimesh;
+
+    return trimesh;
+}
+
+void RobotMeshCache::CalcMassProperties(const std::string& filename,
+                                        double density,
+                                        const ChFrame<>& xform,
+                                        double& mass,
+                                        ChFrame<>& com,
+                                        ChVector3d& inertia) {
+    auto trimesh = GetMesh(filename, false, false);
+
+    double vol;
+    ChVector3d cog_pos;
+    ChMatrix33<> cog_inertia;
+    trimesh->ComputeMassProperties(true, vol, cog_pos, cog_inertia);
+
+    // Express mass properties in the transformed frame (the shared mesh itself is not transformed)
+    const ChMatrix33<>& R = xform.GetRotMat();
+    ChMatrix33<> inertia_xform = R * cog_inertia * R.transpose();
+
+    ChMatrix33<> principal_rot;
+    ChInertiaUtils::PrincipalInertia(inertia_xform, inertia, principal_rot);
+    mass = density * vol;
+    inertia *= density;
+    com = ChFrame<>(xform.TransformPointLocalToParent(cog_pos), principal_rot);
+}
+
+// =============================================================================
+
+RobotMassProperties::RobotMassProperties() : m_mass(0), m_moment(VNULL) {
+    m_second.setZero();
+}
+
+void RobotMassProperties::AddPart(double mass, const ChFrame<>& com, const ChVector3d& inertia) {
+    const ChVector3d& c = com.GetPos();
+    const ChMatrix33<>& R = com.GetRotMat();
+
+    // Inertia about the part centroid, then about the body reference frame origin (parallel axis theorem)
+    ChMatrix33<> J = R * ChMatrix33<>(inertia) * R.transpose();
+    J += mass * (ChMatrix33<>(c.Length2()) - TensorProduct(c, c));
+
+    m_mass += mass;
+    m_moment += mass * c;
+    m_second += J;
+}
+
+ChVector3d RobotMassProperties::GetCOM() const {
+    return m_mass > 0 ? m_moment / m_mass : VNULL;
+}
+
+ChMatrix33<> RobotMassProperties::GetInertia() const {
+    ChVector3d c = GetCOM();
+    return m_second - m_mass * (ChMatrix33<>(c.Length2()) - TensorProduct(c, c));
+}
+
+void RobotMassProperties::Apply(ChBodyAuxRef& body) const {
+    body.SetMass(m_mass);
+    body.SetFrameCOMToRef(ChFrame<>(GetCOM(), QUNIT));
+    body.SetInertia(GetInertia());
+}
+
+// =============================================================================
+
+RobotWheelForce::RobotWheelForce() : m_kn(1e5), m_cn(1e3), m_mu(0.8), m_slip_sat(0.1), m_vel_ref(0.1) {}
+
+size_t RobotWheelForce::AddWheel(std::shared_ptr<ChBody> body, double radius, const ChVector3d& axis) {
+    Wheel wheel;
+    wheel.body = body;
+    wheel.radius = radius;
+    wheel.axis = axis.GetNormalized();
+    wheel.dir = VNULL;
+    wheel.force = VNULL;
+    wheel.torque = VNULL;
+    m_wheels.push_back(wheel);
+    return m_wheels.size() - 1;
+}
+
+void RobotWheelForce::ExcludeBody(std::shared_ptr<ChBody> body) {
+    m_excluded.push_back(body.get());
+}
+
+bool RobotWheelForce::IsExcluded(const ChCollisionSystem::ChRayhitResult& hit) const {
+    if (!hit.hitModel)
+        return false;
+    auto contactable = hit.hitModel->GetContactable();
+    return std::find(m_excluded.begin(), m_excluded.end(), contactable) != m_excluded.end();
+}
+
+void RobotWheelForce::Update() {
+    if (m_wheels.empty())
+        return;
+
+    ChSystem* system = m_wheels[0].body->GetSystem();
+    const ChVector3d& g = system->GetGravitationalAcceleration();
+
+    // Cast one ray per wheel, through the wheel center along gravity projected on the wheel plane.
+    // Rays start above the wheel, since ray casts do not report shapes whose envelope contains the ray origin.
+    m_rays.resize(m_wheels.size());
+    for (size_t i = 0; i < m_wheels.size(); i++) {
+        auto& wheel = m_wheels[i];
+        wheel.body->EmptyAccumulators();
+        wheel.data = ContactData();
+        wheel.force = VNULL;
+        wheel.torque = VNULL;
+
+        const auto& X = wheel.body->GetFrameRefToAbs();
+        ChVector3d axis = X.TransformDirectionLocalToParent(wheel.axis);
+        ChVector3d dir = g - Vdot(g, axis) * axis;
+        wheel.dir = dir.Length2() > 1e-12 ? dir.GetNormalized() : VNULL;
+
+        m_rays[i].from = X.GetPos() - (2 * wheel.radius) * wheel.dir;
+        m_rays[i].to = X.GetPos() + (2 * wheel.radius) * wheel.dir;
+    }
+
+    auto collision_system = system->GetCollisionSystem();
+    if (!collision_system)
+        return;
+    collision_system->RayHitBatch(m_rays, m_hits);
+
+    for (size_t i = 0; i < m_wheels.size(); i++) {
+        auto& wheel = m_wheels[i];
+        if (wheel.dir == VNULL)
+            continue;
+
+        // Skip hits on excluded bodies and above the wheel center by continuing the ray past them
+        auto& hit = m_hits[i];
+        const ChVector3d& center = wheel.body->GetFrameRefToAbs().GetPos();
+        auto skip = [&]() { return IsExcluded(hit) || Vdot(hit.abs_hitPoint - center, wheel.dir) < 0; };
+        double eps = 1e-4 * wheel.radius;
+        for (int k = 0; k < 4 && hit.hit && skip(); k++)
+            collision_system->RayHit(hit.abs_hitPoint + eps * wheel.dir, m_rays[i].to, hit);
+        if (!hit.hit || skip())
+            continue;
+
+        // Terrain normal, pointing towards the wheel center
+        ChVector3d normal = hit.abs_hitNormal;
+        if (Vdot(normal, wheel.dir) > 0)
+            normal = -normal;
+
+        CalcForce(wheel, hit.abs_hitPoint, normal, system->GetStep());
+    }
+}
+
+void RobotWheelForce::CalcForce(Wheel& wheel, const ChVector3d& point, const ChVector3d& normal, double step) {
+    const auto& X = wheel.body->GetFrameRefToAbs();
+    const ChVector3d& center = X.GetPos();
+
+    // Penetration of the wheel disc in the terrain plane
+    double height = Vdot(center - point, normal);
+    double depth = wheel.radius - height;
+    if (depth <= 0)
+        return;
+
+    // Contact frame (x: longitudinal, y: lateral, z: normal)
+    ChVector3d axis = X.TransformDirectionLocalToParent(wheel.axis);
+    ChVector3d long_dir = Vcross(axis, normal);
+    if (long_dir.Length2() < 1e-12)
+        return;
+    long_dir.Normalize();
+    ChVector3d lat_dir = Vcross(normal, long_dir);
+
+    // Velocity of the wheel material point in contact with the (fixed) terrain
+    ChVector3d contact = center - height * normal;
+    const ChVector3d& vel = X.GetPosDt();
+    ChVector3d vel_contact = vel + Vcross(X.GetAngVelParent(), contact - center);
+    double vx = Vdot(vel_contact, long_dir);
+    double vy = Vdot(vel_contact, lat_dir);
+    double vn = Vdot(vel, normal);
+
+    // Normal force (no adhesion)
+    double fn = m_kn * depth - m_cn * vn;
+    if (fn < 0)
+        fn = 0;
+
+    // Tangential force, opposing the slip velocity and saturating at the friction limit
+    double vel_wheel = std::abs(Vdot(vel, long_dir));
+    double vel_roll = std::abs(Vdot(X.GetAngVelParent(), axis)) * height;
+    double vel_norm = std::max(std::max(vel_wheel, vel_roll), m_vel_ref);
+
+    // Since forces are applied explicitly, limit the slope of the force-slip curve so that the wheel spin and sliding
+    // modes remain stable at the current step size
+    const ChVector3d& J = wheel.body->GetInertiaXX();
+    double mass_eff = std::min(wheel.body->GetMass(), std::min(J.x(), std::min(J.y(), J.z())) / (height * height));
+    double slope_max = mass_eff / step;
+    vel_norm = std::max(vel_norm, m_mu * fn / (m_slip_sat * slope_max));
+    double slip = std::sqrt(vx * vx + vy * vy) / vel_norm;
+    double fx = 0;
+    double fy = 0;
+    if (slip > 1e-12) {
+        double ft = m_mu * fn * std::tanh(slip / m_slip_sat);
+        fx = -ft * (vx / vel_norm) / slip;
+        fy = -ft * (vy / vel_norm) / slip;
+    }
+
+    wheel.force = fn * normal + fx * long_dir + fy * lat_dir;
+    wheel.torque = Vcross(contact - center, wheel.force);
+    wheel.body->AccumulateForce(wheel.force, contact, false);
+
+    ChMatrix33<> A;
+    A.SetFromDirectionAxes(long_dir, lat_dir, normal);
+    wheel.data.in_contact = true;
+    wheel.data.frame = ChCoordsys<>(contact, A.GetQuaternion());
+    wheel.data.vel = ChVector3d(vx, vy, vn);
+    wheel.data.normal_force = fn;
+    wheel.data.depth = depth;
+}
+
+}  // namespace chrono
@@ -0,0 +1,183 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Utilities for reduced-fidelity robot models:
+// - cache of triangle meshes shared by all robot instances
+// - mass properties of a rigid body lumping several robot parts
+// - force-element wheel model
+//
+// =============================================================================
+
+#ifndef ROBOT_REDUCED_MODEL_H
+#define ROBOT_REDUCED_MODEL_H
+
+#include <string>
+#include <vector>
+
+#include "chrono/collision/ChCollisionSystem.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/physics/ChBodyAuxRef.h"
+
+#include "chrono_models/ChApiModels.h"
+
+namespace chrono {
+
+/// @addtogroup robot_models
+/// @{
+
+/// Cache of triangle meshes shared by all robot model instances.
+/// A Wavefront OBJ file is loaded (and its duplicate vertices repaired) only at the first request; subsequent requests
+/// return the same mesh. Shared meshes must not be modified; part transforms should be applied to the visual shape
+/// frames instead. Safe to use from multiple threads.
+class CH_MODELS_API RobotMeshCache {
+  public:
+    /// Return the mesh loaded from the specified file.
+    static std::shared_ptr<ChTriangleMeshConnected> GetMesh(const std::string& filename,
+                                                            bool load_normals = true,
+                                                            bool load_uv = true);
+
+    /// Calculate the mass properties of the mesh loaded from the specified file, for the given density and transform.
+    /// On return, 'com' is the centroidal frame (aligned with the principal axes) and 'inertia' contains the principal
+    /// moments of inertia.
+    static void CalcMassProperties(const std::string& filename,
+                                   double density,
+                                   const ChFrame<>& xform,
+                                   double& mass,
+                                   ChFrame<>& com,
+                                   ChVector3d& inertia);
+};
+
+/// Mass properties of a rigid body lumping several robot parts.
+class CH_MODELS_API RobotMassProperties {
+  public:
+    RobotMassProperties();
+
+    /// Add a part with given mass, centroidal frame and principal moments of inertia.
+    /// The centroidal frame is expressed relative to the reference frame of the lumped body.
+    void AddPart(double mass, const ChFrame<>& com, const ChVector3d& inertia);
+
+    /// Get the total mass.
+    double GetMass() const { return m_mass; }
+
+    /// Get the location of the center of mass, relative to the body reference frame.
+    ChVector3d GetCOM() const;
+
+    /// Get the inertia tensor about the center of mass (with axes parallel to the body reference frame).
+    ChMatrix33<> GetInertia() const;
+
+    /// Set the lumped mass properties for the specified body.
+    void Apply(ChBodyAuxRef& body) const;
+
+  private:
+    double m_mass;          ///< total mass
+    ChVector3d m_moment;    ///< first mass moment, about body reference frame
+    ChMatrix33<> m_second;  ///< second mass moment (inertia), about body reference frame
+};
+
+/// Force-element wheel model for reduced robot models.
+/// Replaces the contact between wheel collision meshes and the terrain with a single contact point per wheel, in the
+/// spirit of the force-element tire models in Chrono::Vehicle. The contact point is found with a ray cast against the
+/// collision models in the system, through the wheel center along the direction of gravity projected on the wheel
+/// plane. The normal force is
+/// provided by a spring-damper on the wheel penetration; the tangential force is a saturated function of the combined
+/// longitudinal and lateral slip, bounded by the friction coefficient. The terrain is assumed fixed (no reaction
+/// force is applied to the body hit by the ray).
+/// Wheel forces are calculated from the current state and applied to the wheel bodies (as accumulated forces) when
+/// Update() is called, which must happen before each integration step. Wheel bodies need no collision shapes.
+/// Since the forces are explicit, the slope of the force-slip curve is limited based on the wheel mass and inertia and
+/// on the current step size.
+class CH_MODELS_API RobotWheelForce {
+  public:
+    /// Wheel-terrain contact information.
+    struct ContactData {
+        ContactData() : in_contact(false), normal_force(0), depth(0) {}
+        bool in_contact;      ///< true if wheel in contact with terrain
+        ChCoordsys<> frame;   ///< contact frame (x: long, y: lat, z: normal)
+        ChVector3d vel;       ///< slip velocity expressed in contact frame
+        double normal_force;  ///< magnitude of normal contact force
+        double depth;         ///< penetration depth
+    };
+
+    RobotWheelForce();
+
+    /// Add a wheel with specified radius and spin axis (expressed in the wheel body reference frame).
+    /// Return the wheel index.
+    size_t AddWheel(std::shared_ptr<ChBody> body, double radius, const ChVector3d& axis);
+
+    /// Exclude hits on the collision model of the specified body (e.g., the robot chassis) from the wheel ray casts.
+    void ExcludeBody(std::shared_ptr<ChBody> body);
+
+    /// Set the normal contact stiffness (default: 1e5).
+    void SetNormalStiffness(double stiffness) { m_kn = stiffness; }
+
+    /// Set the normal contact damping (default: 1e3).
+    void SetNormalDamping(double damping) { m_cn = damping; }
+
+    /// Set the friction coefficient (default: 0.8).
+    void SetFriction(double friction) { m_mu = friction; }
+
+    /// Set the slip at which the tangential force reaches about 76% of its maximum value (default: 0.1).
+    void SetSlipSaturation(double slip) { m_slip_sat = slip; }
+
+    /// Set the reference speed used to normalize slip velocities at low wheel speeds (default: 0.1).
+    void SetReferenceSpeed(double speed) { m_vel_ref = speed; }
+
+    /// Get the number of wheels.
+    size_t GetNumWheels() const { return m_wheels.size(); }
+
+    /// Get current contact information for the specified wheel.
+    const ContactData& GetContactData(size_t i) const { return m_wheels[i].data; }
+
+    /// Get the current force on the specified wheel (applied at the contact point, expressed in absolute frame).
+    const ChVector3d& GetForce(size_t i) const { return m_wheels[i].force; }
+
+    /// Get the current torque on the specified wheel (about the wheel center, expressed in absolute frame).
+    const ChVector3d& GetTorque(size_t i) const { return m_wheels[i].torque; }
+
+    /// Calculate the wheel forces at the current state and apply them to the wheel bodies.
+    /// Forces previously accumulated on the wheel bodies are discarded.
+    void Update();
+
+  private:
+    struct Wheel {
+        std::shared_ptr<ChBody> body;  ///< wheel body
+        double radius;                 ///< wheel radius
+        ChVector3d axis;               ///< spin axis (in wheel body reference frame)
+        ChVector3d dir;                ///< ray cast direction (absolute frame)
+        ContactData data;              ///< current contact information
+        ChVector3d force;              ///< current wheel force (absolute frame)
+        ChVector3d torque;             ///< current wheel torque about wheel center (absolute frame)
+    };
+
+    bool IsExcluded(const ChCollisionSystem::ChRayhitResult& hit) const;
+    void CalcForce(Wheel& wheel, const ChVector3d& point, const ChVector3d& normal, double step);
+
+    std::vector<Wheel> m_wheels;
+    std::vector<ChContactable*> m_excluded;
+
+    std::vector<ChCollisionSystem::ChRay> m_rays;
+    std::vector<ChCollisionSystem::ChRayhitResult> m_hits;
+
+    double m_kn;        ///< normal stiffness
+    double m_cn;        ///< normal damping
+    double m_mu;        ///< friction coefficient
+    double m_slip_sat;  ///< saturation slip
+    double m_vel_ref;   ///< reference speed for slip normalization
+};
+
+/// @} robot_models
+
+}  // namespace chrono
+
+#endif
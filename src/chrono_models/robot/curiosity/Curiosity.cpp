@@ -31,7 +31,6 @@
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChSystemSMC.h"
 #include "chrono/physics/ChShaftBodyConstraint.h"
-#include "chrono/physics/ChInertiaUtils.h"
 
 #include "chrono_models/robot/curiosity/Curiosity.h"
 
@@ -200,30 +199,17 @@ void CuriosityPart::Construct(ChSystem* system) {
     m_body->SetInertiaXX(m_inertia);
     m_body->SetFrameCOMToRef(m_cog);
 
-    // Add visualization shape
-    if (m_visualize) {
-        auto vis_mesh_file = GetChronoDataFile("robot/curiosity/obj/" + m_mesh_name + ".obj");
-        auto trimesh_vis = ChTriangleMeshConnected::CreateFromWavefrontFile(vis_mesh_file, true, true);
-        trimesh_vis->Transform(m_mesh_xform.GetPos(), m_mesh_xform.GetRotMat());  // translate/rotate/scale mesh
-        trimesh_vis->RepairDuplicateVertexes(1e-9);                               // if meshes are not watertight
-
-        auto trimesh_shape = chrono_types::make_shared<ChVisualShapeTriangleMesh>();
-        trimesh_shape->SetMesh(trimesh_vis);
-        trimesh_shape->SetName(m_mesh_name);
-        trimesh_shape->SetMutable(false);
-
-        m_body->AddVisualShape(trimesh_shape);
-    }
+    // Add visualization shape (shared mesh, translated/rotated through the shape frame)
+    if (m_visualize)
+        m_body->AddVisualShape(CreateVisualShape(), m_mesh_xform);
 
     // Add collision shape
     if (m_collide) {
         auto col_mesh_file = GetChronoDataFile("robot/curiosity/col/" + m_mesh_name + ".obj");
-        auto trimesh_col = ChTriangleMeshConnected::CreateFromWavefrontFile(col_mesh_file, false, false);
-        trimesh_col->Transform(m_mesh_xform.GetPos(), m_mesh_xform.GetRotMat());  // translate/rotate/scale mesh
-        trimesh_col->RepairDuplicateVertexes(1e-9);                               // if meshes are not watertight
+        auto trimesh_col = RobotMeshCache::GetMesh(col_mesh_file, false, false);
 
         auto shape = chrono_types::make_shared<ChCollisionShapeTriangleMesh>(m_mat, trimesh_col, false, false, 0.005);
-        m_body->AddCollisionShape(shape);
+        m_body->AddCollisionShape(shape, m_mesh_xform);
 
         m_body->EnableCollision(m_collide);
     }
@@ -231,21 +217,20 @@ void CuriosityPart::Construct(ChSystem* system) {
     system->AddBody(m_body);
 }
 
+std::shared_ptr<ChVisualShape> CuriosityPart::CreateVisualShape() const {
+    auto vis_mesh_file = GetChronoDataFile("robot/curiosity/obj/" + m_mesh_name + ".obj");
+    auto trimesh_vis = RobotMeshCache::GetMesh(vis_mesh_file, true, true);
+
+    auto trimesh_shape = chrono_types::make_shared<ChVisualShapeTriangleMesh>();
+    trimesh_shape->SetMesh(trimesh_vis);
+    trimesh_shape->SetName(m_mesh_name);
+    trimesh_shape->SetMutable(false);
+    return trimesh_shape;
+}
+
 void CuriosityPart::CalcMassProperties(double density) {
     auto mesh_filename = GetChronoDataFile("robot/curiosity/col/" + m_mesh_name + ".obj");
-    auto trimesh_col = ChTriangleMeshConnected::CreateFromWavefrontFile(mesh_filename, false, false);
-    trimesh_col->Transform(m_mesh_xform.GetPos(), m_mesh_xform.GetRotMat());  // translate/rotate/scale mesh
-    trimesh_col->RepairDuplicateVertexes(1e-9);                               // if meshes are not watertight
-
-    double vol;
-    ChVector3d cog_pos;
-    ChMatrix33<> cog_rot;
-    ChMatrix33<> inertia;
-    trimesh_col->ComputeMassProperties(true, vol, cog_pos, inertia);
-    ChInertiaUtils::PrincipalInertia(inertia, m_inertia, cog_rot);
-    m_mass = density * vol;
-    m_inertia *= density;
-    m_cog = ChFrame<>(cog_pos, cog_rot);
+    RobotMeshCache::CalcMassProperties(mesh_filename, density, m_mesh_xform, m_mass, m_cog, m_inertia);
 }
 
 void CuriosityPart::Initialize(std::shared_ptr<ChBodyAuxRef> chassis) {
@@ -256,6 +241,14 @@ void CuriosityPart::Initialize(std::shared_ptr<ChBodyAuxRef> chassis) {
     m_body->SetFrameRefToAbs(X_GC);
 }
 
+void CuriosityPart::InitializeLumped(std::shared_ptr<ChBodyAuxRef> chassis, RobotMassProperties& mprops) {
+    m_body = chassis;
+    mprops.AddPart(m_mass, m_pos * m_cog, m_inertia);
+
+    if (m_visualize)
+        chassis->AddVisualShape(CreateVisualShape(), m_pos * m_mesh_xform);
+}
+
 // =============================================================================
 //
 // Rover Chassis
@@ -318,6 +311,7 @@ CuriosityWheel::CuriosityWheel(const std::string& name,
     m_mass = density * vol;
     m_inertia = ChVector3d(gyration1, gyration2, gyration1) * m_mass;
     m_cog = ChFrame<>();
+    m_radius = radius;
 }
 
 // Curiosity suspension rocker
@@ -384,8 +378,11 @@ CuriosityDifferentialLink::CuriosityDifferentialLink(const std::string& name,
 
 // ==========================================================
 
-Curiosity::Curiosity(ChSystem* system, CuriosityChassisType chassis_type, CuriosityWheelType wheel_type)
-    : m_system(system), m_initialized(false) {
+Curiosity::Curiosity(ChSystem* system,
+                     CuriosityChassisType chassis_type,
+                     CuriosityWheelType wheel_type,
+                     CuriosityModelType model_type)
+    : m_system(system), m_model_type(model_type), m_initialized(false) {
     // Set default collision model envelope commensurate with model dimensions.
     // Note that an SMC system automatically sets envelope to 0.
     auto contact_method = m_system->GetContactMethod();
@@ -456,24 +453,42 @@ void Curiosity::Create(CuriosityChassisType chassis_type, CuriosityWheelType whe
 void Curiosity::Initialize(const ChFrame<>& pos) {
     assert(m_driver);
 
+    bool reduced = (m_model_type == CuriosityModelType::Reduced);
+
     // Initialize rover parts, fixing bodies to ground as requested
     m_chassis->Initialize(m_system, pos);
-    m_diff_bar->Initialize(m_chassis->GetBody());
 
-    for (int i = 0; i < 2; i++) {
-        m_rockers[i]->Initialize(m_chassis->GetBody());
-        m_bogies[i]->Initialize(m_chassis->GetBody());
-
-        m_diff_links[i]->Initialize(m_chassis->GetBody());
+    if (reduced) {
+        // Lump the suspension and differential parts into the chassis
+        RobotMassProperties mprops;
+        mprops.AddPart(m_chassis->m_mass, m_chassis->m_cog, m_chassis->m_inertia);
+        m_diff_bar->InitializeLumped(m_chassis->GetBody(), mprops);
+        for (int i = 0; i < 2; i++) {
+            m_rockers[i]->InitializeLumped(m_chassis->GetBody(), mprops);
+            m_bogies[i]->InitializeLumped(m_chassis->GetBody(), mprops);
+            m_diff_links[i]->InitializeLumped(m_chassis->GetBody(), mprops);
+        }
+        mprops.Apply(*m_chassis->GetBody());
+    } else {
+        m_diff_bar->Initialize(m_chassis->GetBody());
+        for (int i = 0; i < 2; i++) {
+            m_rockers[i]->Initialize(m_chassis->GetBody());
+            m_bogies[i]->Initialize(m_chassis->GetBody());
+            m_diff_links[i]->Initialize(m_chassis->GetBody());
+        }
+    }
 
+    for (int i = 0; i < 2; i++) {
         m_rocker_uprights[i]->Initialize(m_chassis->GetBody());
         m_bogie_uprights[i]->Initialize(m_chassis->GetBody());
     }
     for (int i = 0; i < 6; i++) {
+        m_wheels[i]->EnableCollision(!reduced);
         m_wheels[i]->Initialize(m_chassis->GetBody());
     }
 
-    // Add drive motors on all six wheels
+    // Add drive motors on all six wheels.
+    // In a reduced model, the rocker and bogie bodies are the chassis body.
     ChQuaternion<> z2y = QuatFromAngleX(CH_PI_2);  // align Z with (negative) Y
 
     // Front (wheels attached to rocker uprights)
@@ -551,6 +566,24 @@ void Curiosity::Initialize(const ChFrame<>& pos) {
         m_bogie_motors[i]->SetMotorFunction(m_bogie_motor_funcs[i]);
     }
 
+    if (reduced) {
+        // Wheel force element, with a static wheel penetration of about 1 cm and half critical damping
+        double g = m_system->GetGravitationalAcceleration().Length();
+        double wheel_mass = GetRoverMass() / 6;
+        double kn = wheel_mass * g / 0.01;
+        m_wheel_force = chrono_types::make_shared<RobotWheelForce>();
+        m_wheel_force->SetNormalStiffness(kn);
+        m_wheel_force->SetNormalDamping(std::sqrt(kn * wheel_mass));
+        if (m_wheel_material)
+            m_wheel_force->SetFriction(m_wheel_material->GetSlidingFriction());
+        m_wheel_force->ExcludeBody(m_chassis->GetBody());
+        for (int i = 0; i < 6; i++)
+            m_wheel_force->AddWheel(m_wheels[i]->GetBody(), m_wheels[i]->m_radius, ChVector3d(0, 1, 0));
+
+        m_initialized = true;
+        return;
+    }
+
     // Connect the differential bar to chassis
     m_diff_joint = AddRevoluteJoint(m_diff_bar->GetBody(), m_chassis->GetBody(), m_chassis, tr_rel_pos_t, QUNIT);
 
@@ -575,6 +608,7 @@ void Curiosity::Initialize(const ChFrame<>& pos) {
 }
 
 void Curiosity::SetWheelContactMaterial(std::shared_ptr<ChContactMaterial> mat) {
+    m_wheel_material = mat;
     for (auto& wheel : m_wheels)
         wheel->m_mat = mat;
 }
@@ -611,7 +645,7 @@ void Curiosity::FixChassis(bool fixed) {
 }
 
 void Curiosity::FixSuspension(bool fixed) {
-    if (!m_initialized)
+    if (!m_initialized || m_model_type == CuriosityModelType::Reduced)
         return;
 
     m_rocker_joints[0]->Lock(fixed);
@@ -622,10 +656,14 @@ void Curiosity::FixSuspension(bool fixed) {
 }
 
 ChVector3d Curiosity::GetWheelContactForce(CuriosityWheelID id) const {
+    if (m_wheel_force)
+        return m_wheel_force->GetForce(id);
     return m_wheels[id]->GetBody()->GetContactForce();
 }
 
 ChVector3d Curiosity::GetWheelContactTorque(CuriosityWheelID id) const {
+    if (m_wheel_force)
+        return m_wheel_force->GetTorque(id);
     return m_wheels[id]->GetBody()->GetContactTorque();
 }
 
@@ -645,11 +683,16 @@ double Curiosity::GetWheelTracTorque(CuriosityWheelID id) const {
 }
 
 double Curiosity::GetRoverMass() const {
-    double tot_mass = m_chassis->GetBody()->GetMass() + m_diff_bar->GetBody()->GetMass();
+    bool reduced = (m_model_type == CuriosityModelType::Reduced);
+    double tot_mass = m_chassis->GetBody()->GetMass();
+    if (!reduced)
+        tot_mass = tot_mass + m_diff_bar->GetBody()->GetMass();
     for (int i = 0; i < 2; i++) {
-        tot_mass = tot_mass + m_rockers[i]->GetBody()->GetMass();
-        tot_mass = tot_mass + m_bogies[i]->GetBody()->GetMass();
-        tot_mass = tot_mass + m_diff_links[i]->GetBody()->GetMass();
+        if (!reduced) {
+            tot_mass = tot_mass + m_rockers[i]->GetBody()->GetMass();
+            tot_mass = tot_mass + m_bogies[i]->GetBody()->GetMass();
+            tot_mass = tot_mass + m_diff_links[i]->GetBody()->GetMass();
+        }
         tot_mass = tot_mass + m_rocker_uprights[i]->GetBody()->GetMass();
         tot_mass = tot_mass + m_bogie_uprights[i]->GetBody()->GetMass();
     }
@@ -687,6 +730,10 @@ void Curiosity::Update() {
         ChClampValue(steering, -max_steer_angle, +max_steer_angle);
         m_bogie_motor_funcs[i]->SetConstant(steering);
     }
+
+    // Apply wheel-terrain forces (reduced model)
+    if (m_wheel_force)
+        m_wheel_force->Update();
 }
 
 // =============================================================================
@@ -31,6 +31,7 @@
 #include "chrono/physics/ChLinkMotorRotation.h"
 
 #include "chrono_models/ChApiModels.h"
+#include "chrono_models/robot/RobotReducedModel.h"
 
 namespace chrono {
 
@@ -58,6 +59,11 @@ enum class CuriosityChassisType { FullRover, Scarecrow };
 /// Curiostiy wheel type.
 enum class CuriosityWheelType { RealWheel, SimpleWheel, CylWheel };
 
+/// Curiosity model fidelity.
+/// A reduced model lumps the rocker-bogie suspension and differential into the chassis and uses a force-element
+/// wheel-terrain interaction model.
+enum class CuriosityModelType { Full, Reduced };
+
 // -----------------------------------------------------------------------------
 
 /// Base class definition for all Curiosity Rover parts.
@@ -119,6 +125,14 @@ class CH_MODELS_API CuriosityPart {
     /// Construct the part body.
     void Construct(ChSystem* system);
 
+    /// Create the visualization shape using the shared part mesh.
+    std::shared_ptr<ChVisualShape> CreateVisualShape() const;
+
+    /// Rigidly attach the part to the specified chassis body (reduced model).
+    /// No body is created for the part: its mass properties are accumulated in the provided lumped mass properties
+    /// and its visualization shape is attached to the chassis body.
+    void InitializeLumped(std::shared_ptr<ChBodyAuxRef> chassis, RobotMassProperties& mprops);
+
     std::string m_name;                        ///< subsystem name
     std::shared_ptr<ChBodyAuxRef> m_body;      ///< rigid body
     std::shared_ptr<ChContactMaterial> m_mat;  ///< contact material
@@ -134,6 +148,8 @@ class CH_MODELS_API CuriosityPart {
 
     bool m_visualize;  ///< part visualization flag
     bool m_collide;    ///< Curiosity part's collision indicator
+
+    friend class Curiosity;
 };
 
 // -----------------------------------------------------------------------------
@@ -164,6 +180,9 @@ class CH_MODELS_API CuriosityWheel : public CuriosityPart {
     );
     ~CuriosityWheel() {}
 
+  private:
+    double m_radius;  ///< wheel radius
+
     friend class Curiosity;
 };
 
@@ -229,18 +248,31 @@ class CuriosityDriver;
 /// This class should be the entry point to create a complete rover.
 class CH_MODELS_API Curiosity {
   public:
+    /// Construct a Curiosity rover of the specified chassis type, wheel type and fidelity.
+    /// A reduced model consists of the chassis (with the rocker-bogie suspension and differential lumped in), the 4
+    /// steering uprights, and 6 driven wheels which do not collide; wheel-terrain interaction is modeled with a
+    /// RobotWheelForce element.
     Curiosity(ChSystem* system,
               CuriosityChassisType chassis_type = CuriosityChassisType::FullRover,
-              CuriosityWheelType wheel_type = CuriosityWheelType::RealWheel);
+              CuriosityWheelType wheel_type = CuriosityWheelType::RealWheel,
+              CuriosityModelType model_type = CuriosityModelType::Full);
     ~Curiosity() {}
 
     /// Get the containing system.
     ChSystem* GetSystem() { return m_system; }
 
+    /// Get the model fidelity.
+    CuriosityModelType GetModelType() const { return m_model_type; }
+
+    /// Get the wheel force element (reduced model only).
+    /// This will return an empty pointer for a full model.
+    std::shared_ptr<RobotWheelForce> GetWheelForce() const { return m_wheel_force; }
+
     /// Set the curiosity driver
     void SetDriver(std::shared_ptr<CuriosityDriver> driver);
 
     /// Set wheel contact material.
+    /// For a reduced model, the wheel force element uses the sliding friction coefficient of this material.
     void SetWheelContactMaterial(std::shared_ptr<ChContactMaterial> mat);
 
     /// Fix the chassis to ground.
@@ -248,7 +280,7 @@ class CH_MODELS_API Curiosity {
     void FixChassis(bool fixed);
 
     /// Fix the suspension joints.
-    /// This function can only be invoked after the call to Initialize().
+    /// This function can only be invoked after the call to Initialize(). It has no effect for a reduced model.
     void FixSuspension(bool fixed);
 
     /// Enable/disable visualization of the rover chassis (default: true).
@@ -336,7 +368,8 @@ class CH_MODELS_API Curiosity {
     /// Create the rover parts.
     void Create(CuriosityChassisType chassis_type, CuriosityWheelType wheel_type);
 
-    ChSystem* m_system;  ///< pointer to the Chrono system
+    ChSystem* m_system;               ///< pointer to the Chrono system
+    CuriosityModelType m_model_type;  ///< model fidelity
 
     bool m_initialized;  ///< flag indicating whether or not the rover was initialized
 
@@ -363,6 +396,8 @@ class CH_MODELS_API Curiosity {
 
     std::array<std::shared_ptr<ChShaft>, 6> m_drive_shafts;  ///< power shafts for torque-controlled drive mode
 
+    std::shared_ptr<RobotWheelForce> m_wheel_force;  ///< wheel force element (reduced model)
+
     std::shared_ptr<CuriosityDriver> m_driver;  ///< rover driver system
 
     std::shared_ptr<ChContactMaterial> m_default_material;  ///< common contact material for all non-wheel parts
@@ -158,29 +158,51 @@ Turtlebot_Part::Turtlebot_Part(const std::string& name,
 
 // Create Visulization assets
 void Turtlebot_Part::AddVisualizationAssets() {
+    m_body->AddVisualShape(CreateVisualShape(), ChFrame<>(m_offset, QUNIT));
+}
+
+std::shared_ptr<ChVisualShape> Turtlebot_Part::CreateVisualShape() const {
     auto vis_mesh_file = GetChronoDataFile("robot/turtlebot/" + m_mesh_name + ".obj");
-    auto trimesh = ChTriangleMeshConnected::CreateFromWavefrontFile(vis_mesh_file, true, true);
-    trimesh->Transform(m_offset, ChMatrix33<>(1));
+    auto trimesh = RobotMeshCache::GetMesh(vis_mesh_file, true, true);
     auto trimesh_shape = chrono_types::make_shared<ChVisualShapeTriangleMesh>();
     trimesh_shape->SetMesh(trimesh);
     trimesh_shape->SetName(m_mesh_name);
     trimesh_shape->SetMutable(false);
-    m_body->AddVisualShape(trimesh_shape);
-    return;
+    return trimesh_shape;
+}
+
+void Turtlebot_Part::InitializeLumped(RobotMassProperties& mprops) {
+    auto mesh_file = GetChronoDataFile("robot/turtlebot/" + m_mesh_name + ".obj");
+    double mass;
+    ChFrame<> com;
+    ChVector3d inertia;
+    RobotMeshCache::CalcMassProperties(mesh_file, m_density, ChFrame<>(), mass, com, inertia);
+
+    ChFrame<> X_PC(m_pos, m_rot);  // chassis -> part
+    mprops.AddPart(mass, X_PC * com, inertia);
+    m_chassis->AddVisualShape(CreateVisualShape(), X_PC * ChFrame<>(m_offset, QUNIT));
+
+    // The part body is the chassis body
+    m_body = m_chassis;
 }
 
 void Turtlebot_Part::EnableCollision(bool state) {
     m_collide = state;
 }
 
+double Turtlebot_Part::GetRadius() const {
+    auto mesh_file = GetChronoDataFile("robot/turtlebot/" + m_mesh_name + ".obj");
+    auto aabb = RobotMeshCache::GetMesh(mesh_file, false, false)->GetBoundingBox();
+    return (aabb.max.z() - aabb.min.z()) / 2;
+}
+
 // Add collision assets
 void Turtlebot_Part::AddCollisionShapes() {
     auto vis_mesh_file = GetChronoDataFile("robot/turtlebot/" + m_mesh_name + ".obj");
-    auto trimesh = ChTriangleMeshConnected::CreateFromWavefrontFile(vis_mesh_file, false, false);
-    trimesh->Transform(m_offset, ChMatrix33<>(1));
+    auto trimesh = RobotMeshCache::GetMesh(vis_mesh_file, false, false);
 
     auto shape = chrono_types::make_shared<ChCollisionShapeTriangleMesh>(m_mat, trimesh, false, false, 0.005);
-    m_body->AddCollisionShape(shape);
+    m_body->AddCollisionShape(shape, ChFrame<>(m_offset, QUNIT));
     m_body->EnableCollision(m_collide);
 }
 
@@ -202,9 +224,7 @@ Turtlebot_Chassis::Turtlebot_Chassis(const std::string& name,
 
 void Turtlebot_Chassis::Initialize() {
     auto vis_mesh_file = GetChronoDataFile("robot/turtlebot/" + m_mesh_name + ".obj");
-    auto trimesh = ChTriangleMeshConnected::CreateFromWavefrontFile(vis_mesh_file, false, false);
-    trimesh->Transform(ChVector3d(0, 0, 0), ChMatrix33<>(1));  // scale to a different size
-    trimesh->RepairDuplicateVertexes(1e-9);                    // if meshes are not watertight
+    auto trimesh = RobotMeshCache::GetMesh(vis_mesh_file, false, false);
 
     double mmass;
     ChVector3d mcog;
@@ -259,9 +279,7 @@ Turtlebot_ActiveWheel::Turtlebot_ActiveWheel(const std::string& name,
 
 void Turtlebot_ActiveWheel::Initialize() {
     auto vis_mesh_file = GetChronoDataFile("robot/turtlebot/" + m_mesh_name + ".obj");
-    auto trimesh = ChTriangleMeshConnected::CreateFromWavefrontFile(vis_mesh_file, false, false);
-    trimesh->Transform(ChVector3d(0, 0, 0), ChMatrix33<>(1));  // scale to a different size
-    trimesh->RepairDuplicateVertexes(1e-9);                    // if meshes are not watertight
+    auto trimesh = RobotMeshCache::GetMesh(vis_mesh_file, false, false);
 
     double mmass;
     ChVector3d mcog;
@@ -321,9 +339,7 @@ Turtlebot_PassiveWheel::Turtlebot_PassiveWheel(const std::string& name,
 
 void Turtlebot_PassiveWheel::Initialize() {
     auto vis_mesh_file = GetChronoDataFile("robot/turtlebot/" + m_mesh_name + ".obj");
-    auto trimesh = ChTriangleMeshConnected::CreateFromWavefrontFile(vis_mesh_file, false, false);
-    trimesh->Transform(ChVector3d(0, 0, 0), ChMatrix33<>(1));  // scale to a different size
-    trimesh->RepairDuplicateVertexes(1e-9);                    // if meshes are not watertight
+    auto trimesh = RobotMeshCache::GetMesh(vis_mesh_file, false, false);
 
     double mmass;
     ChVector3d mcog;
@@ -383,9 +399,7 @@ Turtlebot_Rod_Short::Turtlebot_Rod_Short(const std::string& name,
 
 void Turtlebot_Rod_Short::Initialize() {
     auto vis_mesh_file = GetChronoDataFile("robot/turtlebot/" + m_mesh_name + ".obj");
-    auto trimesh = ChTriangleMeshConnected::CreateFromWavefrontFile(vis_mesh_file, false, false);
-    trimesh->Transform(ChVector3d(0, 0, 0), ChMatrix33<>(1));  // scale to a different size
-    trimesh->RepairDuplicateVertexes(1e-9);                    // if meshes are not watertight
+    auto trimesh = RobotMeshCache::GetMesh(vis_mesh_file, false, false);
 
     double mmass;
     ChVector3d mcog;
@@ -447,9 +461,7 @@ Turtlebot_BottomPlate::Turtlebot_BottomPlate(const std::string& name,
 
 void Turtlebot_BottomPlate::Initialize() {
     auto vis_mesh_file = GetChronoDataFile("robot/turtlebot/" + m_mesh_name + ".obj");
-    auto trimesh = ChTriangleMeshConnected::CreateFromWavefrontFile(vis_mesh_file, false, false);
-    trimesh->Transform(ChVector3d(0, 0, 0), ChMatrix33<>(1));  // scale to a different size
-    trimesh->RepairDuplicateVertexes(1e-9);                    // if meshes are not watertight
+    auto trimesh = RobotMeshCache::GetMesh(vis_mesh_file, false, false);
 
     double mmass;
     ChVector3d mcog;
@@ -510,9 +522,7 @@ Turtlebot_MiddlePlate::Turtlebot_MiddlePlate(const std::string& name,
 
 void Turtlebot_MiddlePlate::Initialize() {
     auto vis_mesh_file = GetChronoDataFile("robot/turtlebot/" + m_mesh_name + ".obj");
-    auto trimesh = ChTriangleMeshConnected::CreateFromWavefrontFile(vis_mesh_file, false, false);
-    trimesh->Transform(ChVector3d(0, 0, 0), ChMatrix33<>(1));  // scale to a different size
-    trimesh->RepairDuplicateVertexes(1e-9);                    // if meshes are not watertight
+    auto trimesh = RobotMeshCache::GetMesh(vis_mesh_file, false, false);
 
     double mmass;
     ChVector3d mcog;
@@ -573,9 +583,7 @@ Turtlebot_TopPlate::Turtlebot_TopPlate(const std::string& name,
 
 void Turtlebot_TopPlate::Initialize() {
     auto vis_mesh_file = GetChronoDataFile("robot/turtlebot/" + m_mesh_name + ".obj");
-    auto trimesh = ChTriangleMeshConnected::CreateFromWavefrontFile(vis_mesh_file, false, false);
-    trimesh->Transform(ChVector3d(0, 0, 0), ChMatrix33<>(1));  // scale to a different size
-    trimesh->RepairDuplicateVertexes(1e-9);                    // if meshes are not watertight
+    auto trimesh = RobotMeshCache::GetMesh(vis_mesh_file, false, false);
 
     double mmass;
     ChVector3d mcog;
@@ -638,9 +646,7 @@ Turtlebot_Rod_Long::Turtlebot_Rod_Long(const std::string& name,
 
 void Turtlebot_Rod_Long::Initialize() {
     auto vis_mesh_file = GetChronoDataFile("robot/turtlebot/" + m_mesh_name + ".obj");
-    auto trimesh = ChTriangleMeshConnected::CreateFromWavefrontFile(vis_mesh_file, false, false);
-    trimesh->Transform(ChVector3d(0, 0, 0), ChMatrix33<>(1));  // scale to a different size
-    trimesh->RepairDuplicateVertexes(1e-9);                    // if meshes are not watertight
+    auto trimesh = RobotMeshCache::GetMesh(vis_mesh_file, false, false);
 
     double mmass;
     ChVector3d mcog;
@@ -690,8 +696,13 @@ void Turtlebot_Rod_Long::Translate(const ChVector3d& shift) {
 TurtleBot::TurtleBot(ChSystem* system,
                      const ChVector3d& robot_pos,
                      const ChQuaternion<>& robot_rot,
-                     std::shared_ptr<ChContactMaterial> wheel_mat)
-    : m_system(system), m_robot_pos(robot_pos), m_robot_rot(robot_rot), m_wheel_material(wheel_mat) {
+                     std::shared_ptr<ChContactMaterial> wheel_mat,
+                     TurtleBotModelType model_type)
+    : m_system(system),
+      m_model_type(model_type),
+      m_robot_pos(robot_pos),
+      m_robot_rot(robot_rot),
+      m_wheel_material(wheel_mat) {
     // Set default collision model envelope commensurate with model dimensions.
     // Note that an SMC system automatically sets envelope to 0.
     auto contact_method = m_system->GetContactMethod();
@@ -898,19 +909,41 @@ void TurtleBot::Create() {
 
 /// Initialize the complete rover and add all constraints
 void TurtleBot::Initialize() {
+    bool reduced = (m_model_type == TurtleBotModelType::Reduced);
+
     m_chassis->Initialize();
-    m_bottom_plate->Initialize();
-    m_middle_plate->Initialize();
-    m_top_plate->Initialize();
     for (int i = 0; i < 2; i++) {
+        if (reduced) {
+            m_drive_wheels[i]->EnableCollision(false);
+            m_passive_wheels[i]->EnableCollision(false);
+        }
         m_drive_wheels[i]->Initialize();
         m_passive_wheels[i]->Initialize();
     }
 
-    for (int i = 0; i < 6; i++) {
-        m_1st_level_rods[i]->Initialize();
-        m_2nd_level_rods[i]->Initialize();
-        m_3rd_level_rods[i]->Initialize();
+    if (reduced) {
+        // Lump the rods and plates into the chassis
+        auto chassis = m_chassis->GetBody();
+        RobotMassProperties mprops;
+        mprops.AddPart(chassis->GetMass(), chassis->GetFrameCOMToRef(), chassis->GetInertiaXX());
+        m_bottom_plate->InitializeLumped(mprops);
+        m_middle_plate->InitializeLumped(mprops);
+        m_top_plate->InitializeLumped(mprops);
+        for (int i = 0; i < 6; i++) {
+            m_1st_level_rods[i]->InitializeLumped(mprops);
+            m_2nd_level_rods[i]->InitializeLumped(mprops);
+            m_3rd_level_rods[i]->InitializeLumped(mprops);
+        }
+        mprops.Apply(*chassis);
+    } else {
+        m_bottom_plate->Initialize();
+        m_middle_plate->Initialize();
+        m_top_plate->Initialize();
+        for (int i = 0; i < 6; i++) {
+            m_1st_level_rods[i]->Initialize();
+            m_2nd_level_rods[i]->Initialize();
+            m_3rd_level_rods[i]->Initialize();
+        }
     }
 
     // redeclare necessary location variables
@@ -1013,6 +1046,30 @@ void TurtleBot::Initialize() {
     AddRevoluteJoint(m_passive_wheels[1]->GetBody(), m_chassis->GetBody(), m_chassis->GetBody(), m_system,
                      ChVector3d(-pwx, pwy, pwz), z2x);
 
+    if (reduced) {
+        // Wheel force element, with a static wheel penetration of about 2 mm and half critical damping.
+        // Drive wheels spin about their Y axis, passive wheels about their X axis.
+        double mass = m_chassis->GetBody()->GetMass();
+        for (int i = 0; i < 2; i++)
+            mass += m_drive_wheels[i]->GetBody()->GetMass() + m_passive_wheels[i]->GetBody()->GetMass();
+        double g = m_system->GetGravitationalAcceleration().Length();
+        double wheel_mass = mass / 4;
+        double kn = wheel_mass * g / 0.002;
+        m_wheel_force = chrono_types::make_shared<RobotWheelForce>();
+        m_wheel_force->SetNormalStiffness(kn);
+        m_wheel_force->SetNormalDamping(std::sqrt(kn * wheel_mass));
+        if (m_wheel_material)
+            m_wheel_force->SetFriction(m_wheel_material->GetSlidingFriction());
+        m_wheel_force->SetReferenceSpeed(0.02);
+        m_wheel_force->ExcludeBody(m_chassis->GetBody());
+        for (int i = 0; i < 2; i++)
+            m_wheel_force->AddWheel(m_drive_wheels[i]->GetBody(), m_drive_wheels[i]->GetRadius(), ChVector3d(0, 1, 0));
+        for (int i = 0; i < 2; i++)
+            m_wheel_force->AddWheel(m_passive_wheels[i]->GetBody(), m_passive_wheels[i]->GetRadius(),
+                                    ChVector3d(1, 0, 0));
+        return;
+    }
+
     // add fixity on all rods and plates
     // There are six constraints needed:
     // chassis -> bottom rods
@@ -1061,6 +1118,11 @@ void TurtleBot::Initialize() {
     }
 }
 
+void TurtleBot::Update() {
+    if (m_wheel_force)
+        m_wheel_force->Update();
+}
+
 void TurtleBot::SetMotorSpeed(double rad_speed, WheelID id) {
     m_motors_func[id]->SetConstant(rad_speed);
 }
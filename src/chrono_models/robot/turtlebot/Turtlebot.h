@@ -35,6 +35,7 @@
 #include "chrono/physics/ChLinkMotorRotationSpeed.h"
 
 #include "chrono_models/ChApiModels.h"
+#include "chrono_models/robot/RobotReducedModel.h"
 
 namespace chrono {
 
@@ -63,6 +64,12 @@ enum WheelID {
     RD,  ///< right driven
 };
 
+/// TurtleBot model fidelity.
+enum class TurtleBotModelType {
+    Full,    ///< all rods and plates as separate bodies, collision meshes on all parts
+    Reduced  ///< rods and plates lumped into the chassis, force-element wheel-terrain contact
+};
+
 /// Base class definition of the Turtlebot Robot Part.
 /// This class encapsulates base fields and functions.
 class CH_MODELS_API Turtlebot_Part {
@@ -102,6 +109,17 @@ class CH_MODELS_API Turtlebot_Part {
     /// Initialize the collision mesh of the Turtlebot part.
     void AddCollisionShapes();
 
+    /// Create the visualization shape using the shared part mesh.
+    std::shared_ptr<ChVisualShape> CreateVisualShape() const;
+
+    /// Rigidly attach the part to the chassis body (reduced model).
+    /// The part body is not added to the system: its mass properties are accumulated in the provided lumped mass
+    /// properties and its visualization shape is attached to the chassis body.
+    void InitializeLumped(RobotMassProperties& mprops);
+
+    /// Return the radius of a wheel part (half the vertical extent of its mesh).
+    double GetRadius() const;
+
     /// Enable/disable collision.
     void EnableCollision(bool state);
 
@@ -330,12 +348,26 @@ class CH_MODELS_API TurtleBot {
     TurtleBot(ChSystem* system,
               const ChVector3d& robot_pos,
               const ChQuaternion<>& robot_rot,
-              std::shared_ptr<ChContactMaterial> wheel_mat = nullptr);
+              std::shared_ptr<ChContactMaterial> wheel_mat = nullptr,
+              TurtleBotModelType model_type = TurtleBotModelType::Full);
     ~TurtleBot();
 
     /// Initialize the turtlebot robot using current parameters.
+    /// A reduced model consists of the chassis (with all rods and plates lumped in) and the 4 wheels, which do not
+    /// collide; wheel-terrain interaction is modeled with a RobotWheelForce element.
     void Initialize();
 
+    /// Update the wheel-terrain forces of a reduced model.
+    /// For a reduced model, this function must be called before each integration step. No-op for a full model.
+    void Update();
+
+    /// Get the model fidelity.
+    TurtleBotModelType GetModelType() const { return m_model_type; }
+
+    /// Get the wheel force element (reduced model only, after initialization).
+    /// Wheels are ordered as: left drive, right drive, front passive, rear passive.
+    std::shared_ptr<RobotWheelForce> GetWheelForce() const { return m_wheel_force; }
+
     /// Set active drive wheel speed
     void SetMotorSpeed(double rad_speed, WheelID id);
 
@@ -350,7 +382,8 @@ class CH_MODELS_API TurtleBot {
     /// Note: The robot will not be constructed in the ChSystem until Initialize() is called.
     void Create();
 
-    ChSystem* m_system;  ///< pointer to the Chrono system
+    ChSystem* m_system;               ///< pointer to the Chrono system
+    TurtleBotModelType m_model_type;  ///< model fidelity
 
     bool m_dc_motor_control = false;
 
@@ -372,6 +405,8 @@ class CH_MODELS_API TurtleBot {
 
     std::vector<std::shared_ptr<ChFunctionConst>> m_motors_func;  ///< constant motor angular speed func
 
+    std::shared_ptr<RobotWheelForce> m_wheel_force;  ///< wheel force element (reduced model)
+
     // model parts material
     std::shared_ptr<ChContactMaterial> m_chassis_material;  ///< chassis contact material
     std::shared_ptr<ChContactMaterial> m_wheel_material;    ///< wheel contact material (shared across limbs)
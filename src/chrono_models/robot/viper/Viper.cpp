@@ -42,7 +42,6 @@
 #include "chrono/physics/ChLinkMotorRotationSpeed.h"
 #include "chrono/physics/ChLinkMotorRotationTorque.h"
 #include "chrono/physics/ChShaftBodyConstraint.h"
-#include "chrono/physics/ChInertiaUtils.h"
 
 #include "chrono/utils/ChUtils.h"
 
@@ -214,50 +213,37 @@ void ViperPart::Construct(ChSystem* system) {
     m_body->SetInertiaXX(m_inertia);
     m_body->SetFrameCOMToRef(m_cog);
 
-    // Add visualization shape
-    if (m_visualize) {
-        auto vis_mesh_file = GetChronoDataFile("robot/viper/obj/" + m_mesh_name + ".obj");
-        auto trimesh_vis = ChTriangleMeshConnected::CreateFromWavefrontFile(vis_mesh_file, true, true);
-        trimesh_vis->Transform(m_mesh_xform.GetPos(), m_mesh_xform.GetRotMat());  // translate/rotate/scale mesh
-        trimesh_vis->RepairDuplicateVertexes(1e-9);                               // if meshes are not watertight
-
-        auto trimesh_shape = chrono_types::make_shared<ChVisualShapeTriangleMesh>();
-        trimesh_shape->SetMesh(trimesh_vis);
-        trimesh_shape->SetName(m_mesh_name);
-        trimesh_shape->SetMutable(false);
-        m_body->AddVisualShape(trimesh_shape);
-    }
+    // Add visualization shape (shared mesh, translated/rotated through the shape frame)
+    if (m_visualize)
+        m_body->AddVisualShape(CreateVisualShape(), m_mesh_xform);
 
     // Add collision shape
     if (m_collide) {
         auto col_mesh_file = GetChronoDataFile("robot/viper/col/" + m_mesh_name + ".obj");
-        auto trimesh_col = ChTriangleMeshConnected::CreateFromWavefrontFile(col_mesh_file, false, false);
-        trimesh_col->Transform(m_mesh_xform.GetPos(), m_mesh_xform.GetRotMat());  // translate/rotate/scale mesh
-        trimesh_col->RepairDuplicateVertexes(1e-9);                               // if meshes are not watertight
+        auto trimesh_col = RobotMeshCache::GetMesh(col_mesh_file, false, false);
 
         auto shape = chrono_types::make_shared<ChCollisionShapeTriangleMesh>(m_mat, trimesh_col, false, false, 0.005);
-        m_body->AddCollisionShape(shape);
+        m_body->AddCollisionShape(shape, m_mesh_xform);
         m_body->EnableCollision(m_collide);
     }
 
     system->AddBody(m_body);
 }
 
+std::shared_ptr<ChVisualShape> ViperPart::CreateVisualShape() const {
+    auto vis_mesh_file = GetChronoDataFile("robot/viper/obj/" + m_mesh_name + ".obj");
+    auto trimesh_vis = RobotMeshCache::GetMesh(vis_mesh_file, true, true);
+
+    auto trimesh_shape = chrono_types::make_shared<ChVisualShapeTriangleMesh>();
+    trimesh_shape->SetMesh(trimesh_vis);
+    trimesh_shape->SetName(m_mesh_name);
+    trimesh_shape->SetMutable(false);
+    return trimesh_shape;
+}
+
 void ViperPart::CalcMassProperties(double density) {
     auto mesh_filename = GetChronoDataFile("robot/viper/col/" + m_mesh_name + ".obj");
-    auto trimesh_col = ChTriangleMeshConnected::CreateFromWavefrontFile(mesh_filename, false, false);
-    trimesh_col->Transform(m_mesh_xform.GetPos(), m_mesh_xform.GetRotMat());  // translate/rotate/scale mesh
-    trimesh_col->RepairDuplicateVertexes(1e-9);                               // if meshes are not watertight
-
-    double vol;
-    ChVector3d cog_pos;
-    ChMatrix33<> cog_rot;
-    ChMatrix33<> inertia;
-    trimesh_col->ComputeMassProperties(true, vol, cog_pos, inertia);
-    ChInertiaUtils::PrincipalInertia(inertia, m_inertia, cog_rot);
-    m_mass = density * vol;
-    m_inertia *= density;
-    m_cog = ChFrame<>(cog_pos, cog_rot);
+    RobotMeshCache::CalcMassProperties(mesh_filename, density, m_mesh_xform, m_mass, m_cog, m_inertia);
 }
 
 void ViperPart::Initialize(std::shared_ptr<ChBodyAuxRef> chassis) {
@@ -268,6 +254,14 @@ void ViperPart::Initialize(std::shared_ptr<ChBodyAuxRef> chassis) {
     m_body->SetFrameRefToAbs(X_GC);
 }
 
+void ViperPart::InitializeLumped(std::shared_ptr<ChBodyAuxRef> chassis, RobotMassProperties& mprops) {
+    m_body = chassis;
+    mprops.AddPart(m_mass, m_pos * m_cog, m_inertia);
+
+    if (m_visualize)
+        chassis->AddVisualShape(CreateVisualShape(), m_pos * m_mesh_xform);
+}
+
 // =============================================================================
 
 // Rover Chassis
@@ -306,6 +300,11 @@ ViperWheel::ViperWheel(const std::string& name,
 
     m_color = ChColor(0.4f, 0.7f, 0.4f);
     CalcMassProperties(800);
+
+    // Wheel radius from the extent of the collision mesh (wheel spins about the Y axis)
+    auto col_mesh_file = GetChronoDataFile("robot/viper/col/" + m_mesh_name + ".obj");
+    auto aabb = RobotMeshCache::GetMesh(col_mesh_file, false, false)->GetBoundingBox();
+    m_radius = (aabb.max.z() - aabb.min.z()) / 2;
 }
 
 // =============================================================================
@@ -365,7 +364,8 @@ ViperUpright::ViperUpright(const std::string& name,
 // =============================================================================
 
 // Rover model
-Viper::Viper(ChSystem* system, ViperWheelType wheel_type) : m_system(system), m_chassis_fixed(false) {
+Viper::Viper(ChSystem* system, ViperWheelType wheel_type, ViperModelType model_type)
+    : m_system(system), m_model_type(model_type), m_chassis_fixed(false) {
     // Set default collision model envelope commensurate with model dimensions.
     // Note that an SMC system automatically sets envelope to 0.
     auto contact_method = m_system->GetContactMethod();
@@ -456,11 +456,28 @@ void Viper::Initialize(const ChFrame<>& pos) {
     m_chassis->Initialize(m_system, pos);
     m_chassis->GetBody()->SetFixed(m_chassis_fixed);
 
+    bool reduced = (m_model_type == ViperModelType::Reduced);
+
+    if (reduced) {
+        // Lump the suspension parts into the chassis
+        RobotMassProperties mprops;
+        mprops.AddPart(m_chassis->m_mass, m_chassis->m_cog, m_chassis->m_inertia);
+        for (int i = 0; i < 4; i++) {
+            m_upper_arms[i]->InitializeLumped(m_chassis->GetBody(), mprops);
+            m_lower_arms[i]->InitializeLumped(m_chassis->GetBody(), mprops);
+            m_uprights[i]->InitializeLumped(m_chassis->GetBody(), mprops);
+        }
+        mprops.Apply(*m_chassis->GetBody());
+    }
+
     for (int i = 0; i < 4; i++) {
+        m_wheels[i]->EnableCollision(!reduced);
         m_wheels[i]->Initialize(m_chassis->GetBody());
-        m_upper_arms[i]->Initialize(m_chassis->GetBody());
-        m_lower_arms[i]->Initialize(m_chassis->GetBody());
-        m_uprights[i]->Initialize(m_chassis->GetBody());
+        if (!reduced) {
+            m_upper_arms[i]->Initialize(m_chassis->GetBody());
+            m_lower_arms[i]->Initialize(m_chassis->GetBody());
+            m_uprights[i]->Initialize(m_chassis->GetBody());
+        }
     }
 
     // add all constraints to the system
@@ -535,15 +552,19 @@ void Viper::Initialize(const ChFrame<>& pos) {
     ChQuaternion<> z2x = QuatFromAngleY(CH_PI_2);
 
     for (int i = 0; i < 4; i++) {
-        AddUniversalJoint(m_lower_arms[i]->GetBody(), m_uprights[i]->GetBody(), m_chassis, sr_rel_pos_lower[i], QUNIT);
-        AddUniversalJoint(m_upper_arms[i]->GetBody(), m_uprights[i]->GetBody(), m_chassis, sr_rel_pos_upper[i], QUNIT);
-
-        // Add lifting motors at the connecting points between upper_arm & chassis and lower_arm & chassis
-        m_lift_motor_funcs[i] = chrono_types::make_shared<ChFunctionConst>(0.0);
-        m_lift_motors[i] = AddMotorAngle(m_chassis->GetBody(), m_lower_arms[i]->GetBody(), m_chassis,
-                                         cr_rel_pos_lower[i], z2x * lm_rot[i]);
-        m_lift_motors[i]->SetMotorFunction(m_lift_motor_funcs[i]);
-        AddRevoluteJoint(m_chassis->GetBody(), m_upper_arms[i]->GetBody(), m_chassis, cr_rel_pos_upper[i], z2x);
+        if (!reduced) {
+            AddUniversalJoint(m_lower_arms[i]->GetBody(), m_uprights[i]->GetBody(), m_chassis, sr_rel_pos_lower[i],
+                              QUNIT);
+            AddUniversalJoint(m_upper_arms[i]->GetBody(), m_uprights[i]->GetBody(), m_chassis, sr_rel_pos_upper[i],
+                              QUNIT);
+
+            // Add lifting motors at the connecting points between upper_arm & chassis and lower_arm & chassis
+            m_lift_motor_funcs[i] = chrono_types::make_shared<ChFunctionConst>(0.0);
+            m_lift_motors[i] = AddMotorAngle(m_chassis->GetBody(), m_lower_arms[i]->GetBody(), m_chassis,
+                                             cr_rel_pos_lower[i], z2x * lm_rot[i]);
+            m_lift_motors[i]->SetMotorFunction(m_lift_motor_funcs[i]);
+            AddRevoluteJoint(m_chassis->GetBody(), m_upper_arms[i]->GetBody(), m_chassis, cr_rel_pos_upper[i], z2x);
+        }
 
         auto steer_rod = chrono_types::make_shared<ChBodyEasyBox>(0.1, 0.1, 0.1, 1000, true, false);
         steer_rod->SetPos(m_wheels[i]->GetPos());
@@ -564,12 +585,15 @@ void Viper::Initialize(const ChFrame<>& pos) {
                 break;
         }
 
+        // In a reduced model, the upright body is the chassis body
         m_steer_motor_funcs[i] = chrono_types::make_shared<ChFunctionConst>(0.0);
         m_steer_motors[i] = AddMotorAngle(steer_rod, m_uprights[i]->GetBody(), m_chassis, wheel_rel_pos[i], sm_rot[i]);
         m_steer_motors[i]->SetMotorFunction(m_steer_motor_funcs[i]);
 
-        m_springs[i] = AddSuspensionSpring(m_chassis->GetBody(), m_uprights[i]->GetBody(), m_chassis,
-                                           cr_rel_pos_upper[i], sr_rel_pos_lower[i]);
+        if (!reduced) {
+            m_springs[i] = AddSuspensionSpring(m_chassis->GetBody(), m_uprights[i]->GetBody(), m_chassis,
+                                               cr_rel_pos_upper[i], sr_rel_pos_lower[i]);
+        }
     }
 
     double J = 0.1;  // shaft rotational inertia
@@ -583,6 +607,21 @@ void Viper::Initialize(const ChFrame<>& pos) {
         shaftbody_connection->Initialize(m_drive_shafts[i], m_wheels[i]->GetBody(), ChVector3d(0, 0, -1));
         m_system->Add(shaftbody_connection);
     }
+
+    if (reduced) {
+        // Wheel force element, with a static wheel penetration of about 1 cm and half critical damping
+        double g = m_system->GetGravitationalAcceleration().Length();
+        double wheel_mass = GetRoverMass() / 4;
+        double kn = wheel_mass * g / 0.01;
+        m_wheel_force = chrono_types::make_shared<RobotWheelForce>();
+        m_wheel_force->SetNormalStiffness(kn);
+        m_wheel_force->SetNormalDamping(std::sqrt(kn * wheel_mass));
+        if (m_wheel_material)
+            m_wheel_force->SetFriction(m_wheel_material->GetSlidingFriction());
+        m_wheel_force->ExcludeBody(m_chassis->GetBody());
+        for (int i = 0; i < 4; i++)
+            m_wheel_force->AddWheel(m_wheels[i]->GetBody(), m_wheels[i]->m_radius, ChVector3d(0, 1, 0));
+    }
 }
 
 void Viper::SetDriver(std::shared_ptr<ViperDriver> driver) {
@@ -591,6 +630,7 @@ void Viper::SetDriver(std::shared_ptr<ViperDriver> driver) {
 }
 
 void Viper::SetWheelContactMaterial(std::shared_ptr<ChContactMaterial> mat) {
+    m_wheel_material = mat;
     for (auto& wheel : m_wheels)
         wheel->m_mat = mat;
 }
@@ -618,10 +658,14 @@ void Viper::SetSuspensionVisualization(bool state) {
 }
 
 ChVector3d Viper::GetWheelContactForce(ViperWheelID id) const {
+    if (m_wheel_force)
+        return m_wheel_force->GetForce(id);
     return m_wheels[id]->GetBody()->GetContactForce();
 }
 
 ChVector3d Viper::GetWheelContactTorque(ViperWheelID id) const {
+    if (m_wheel_force)
+        return m_wheel_force->GetTorque(id);
     return m_wheels[id]->GetBody()->GetContactTorque();
 }
 
@@ -644,6 +688,8 @@ double Viper::GetRoverMass() const {
     double tot_mass = m_chassis->GetBody()->GetMass();
     for (int i = 0; i < 4; i++) {
         tot_mass += m_wheels[i]->GetBody()->GetMass();
+        if (m_model_type == ViperModelType::Reduced)
+            continue;  // suspension parts lumped into chassis
         tot_mass += m_upper_arms[i]->GetBody()->GetMass();
         tot_mass += m_lower_arms[i]->GetBody()->GetMass();
         tot_mass += m_uprights[i]->GetBody()->GetMass();
@@ -670,10 +716,15 @@ void Viper::Update() {
 
         // Set motor functions
         m_steer_motor_funcs[i]->SetConstant(steering);
-        m_lift_motor_funcs[i]->SetConstant(lifting);
+        if (m_lift_motor_funcs[i])
+            m_lift_motor_funcs[i]->SetConstant(lifting);
         if (m_driver->GetDriveMotorType() == ViperDriver::DriveMotorType::SPEED)
             m_drive_motor_funcs[i]->SetSetpoint(driving, time);
     }
+
+    // Apply wheel-terrain forces (reduced model)
+    if (m_wheel_force)
+        m_wheel_force->Update();
 }
 
 // =============================================================================
@@ -30,6 +30,7 @@
 #include "chrono/physics/ChShaft.h"
 
 #include "chrono_models/ChApiModels.h"
+#include "chrono_models/robot/RobotReducedModel.h"
 
 namespace chrono {
 
@@ -54,6 +55,12 @@ enum class ViperWheelType {
     CylWheel      ///< cylindrical wheel geometry
 };
 
+/// Viper model fidelity.
+enum class ViperModelType {
+    Full,    ///< multibody model with suspension mechanisms and wheel collision meshes
+    Reduced  ///< rigid chassis (suspension lumped in) with steered wheels and force-element wheel-terrain contact
+};
+
 // -----------------------------------------------------------------------------
 
 /// Base class definition for all Viper parts.
@@ -116,6 +123,14 @@ class CH_MODELS_API ViperPart {
     /// Construct the part body.
     void Construct(ChSystem* system);
 
+    /// Create the visualization shape using the shared part mesh.
+    std::shared_ptr<ChVisualShape> CreateVisualShape() const;
+
+    /// Rigidly attach the part to the specified chassis body (reduced model).
+    /// No body is created for the part: its mass properties are accumulated in the provided lumped mass properties
+    /// and its visualization shape is attached to the chassis body.
+    void InitializeLumped(std::shared_ptr<ChBodyAuxRef> chassis, RobotMassProperties& mprops);
+
     std::string m_name;                        ///< part name
     std::shared_ptr<ChBodyAuxRef> m_body;      ///< part rigid body
     std::shared_ptr<ChContactMaterial> m_mat;  ///< contact material
@@ -131,6 +146,8 @@ class CH_MODELS_API ViperPart {
 
     bool m_visualize;  ///< part visualization flag
     bool m_collide;    ///< part collision flag
+
+    friend class Viper;
 };
 
 /// Viper rover Chassis.
@@ -155,6 +172,9 @@ class CH_MODELS_API ViperWheel : public ViperPart {
     );
     ~ViperWheel() {}
 
+  private:
+    double m_radius;  ///< wheel radius (from collision mesh)
+
     friend class Viper;
 };
 
@@ -202,17 +222,31 @@ class ViperDriver;
 /// This class should be the entry point to create a complete rover.
 class CH_MODELS_API Viper {
   public:
-    Viper(ChSystem* system, ViperWheelType wheel_type = ViperWheelType::RealWheel);
+    /// Construct a Viper rover of the specified wheel type and fidelity.
+    /// A reduced model consists of the chassis (with the suspension arms and uprights lumped in), and 4 steered and
+    /// driven wheels which do not collide; wheel-terrain interaction is modeled with a RobotWheelForce element. A
+    /// reduced model does not support lifting and its suspension part accessors return parts attached to the chassis.
+    Viper(ChSystem* system,
+          ViperWheelType wheel_type = ViperWheelType::RealWheel,
+          ViperModelType model_type = ViperModelType::Full);
 
     ~Viper() {}
 
     /// Get the containing system.
     ChSystem* GetSystem() const { return m_system; }
 
+    /// Get the model fidelity.
+    ViperModelType GetModelType() const { return m_model_type; }
+
+    /// Get the wheel force element (reduced model only).
+    /// This will return an empty pointer for a full model.
+    std::shared_ptr<RobotWheelForce> GetWheelForce() const { return m_wheel_force; }
+
     /// Attach a driver system.
     void SetDriver(std::shared_ptr<ViperDriver> driver);
 
     /// Set wheel contact material.
+    /// For a reduced model, the wheel force element uses the sliding friction coefficient of this material.
     void SetWheelContactMaterial(std::shared_ptr<ChContactMaterial> mat);
 
     /// Fix the chassis to ground.
@@ -312,7 +346,8 @@ class CH_MODELS_API Viper {
     /// Create the rover parts.
     void Create(ViperWheelType wheel_type);
 
-    ChSystem* m_system;  ///< pointer to the Chrono system
+    ChSystem* m_system;           ///< pointer to the Chrono system
+    ViperModelType m_model_type;  ///< model fidelity
 
     bool m_chassis_fixed;  ///< fix chassis to ground
 
@@ -334,6 +369,8 @@ class CH_MODELS_API Viper {
     std::array<std::shared_ptr<ChLinkTSDA>, 4> m_springs;    ///< suspension springs
     std::array<std::shared_ptr<ChShaft>, 4> m_drive_shafts;  ///< wheel drive-shafts
 
+    std::shared_ptr<RobotWheelForce> m_wheel_force;  ///< wheel force element (reduced model)
+
     std::shared_ptr<ViperDriver> m_driver;  ///< rover driver system
 
     std::shared_ptr<ChContactMaterial> m_default_material;  ///< common contact material for all non-wheel parts
@@ -19,6 +19,11 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <numeric>
+
 #include "chrono_multicore/ChDataManager.h"
 #include "chrono_multicore/physics/Ch3DOFContainer.h"
 
@@ -131,3 +136,139 @@ void ChMulticoreDataManager::PrintMatrix(CompressedMatrix<real> src) {
         std::cout << std::endl;
     }
 }
+
+// -----------------------------------------------------------------------------
+
+// Spread the lower 21 bits of v so that there are two zero bits between consecutive bits.
+static inline uint64_t SpreadBits(uint64_t v) {
+    v &= 0x1fffff;
+    v = (v | v << 32) & 0x1f00000000ffff;
+    v = (v | v << 16) & 0x1f0000ff0000ff;
+    v = (v | v << 8) & 0x100f00f00f00f00f;
+    v = (v | v << 4) & 0x10c30c30c30c30c3;
+    v = (v | v << 2) & 0x1249249249249249;
+    return v;
+}
+
+// Permute the elements of the given array so that data[order[i]] moves to position i.
+template <typename T>
+static void PermuteArray(custom_vector<T>& data, const std::vector<uint>& order) {
+    if (data.size() != order.size())
+        return;
+    custom_vector<T> tmp(order.size());
+    for (size_t i = 0; i < order.size(); i++)
+        tmp[i] = data[order[i]];
+    data.swap(tmp);
+}
+
+void ChMulticoreDataManager::ComputeSpatialOrder(std::vector<uint>& order) const {
+    const custom_vector<real3>& pos = host_data.pos_rigid;
+    const uint n = num_rigid_bodies;
+
+    order.resize(n);
+    std::iota(order.begin(), order.end(), 0);
+    if (n < 2 || pos.size() != n)
+        return;
+
+    // Bounding box of the body positions
+    real3 pmin = pos[0];
+    real3 pmax = pos[0];
+    for (uint i = 1; i < n; i++) {
+        pmin = real3(std::min(pmin.x, pos[i].x), std::min(pmin.y, pos[i].y), std::min(pmin.z, pos[i].z));
+        pmax = real3(std::max(pmax.x, pos[i].x), std::max(pmax.y, pos[i].y), std::max(pmax.z, pos[i].z));
+    }
+
+    // Quantize positions on a 2^21 grid along each axis and interleave the bits
+    const real res = real((1 << 21) - 1);
+    real3 ext = pmax - pmin;
+    real3 scale(ext.x > 0 ? res / ext.x : 0, ext.y > 0 ? res / ext.y : 0, ext.z > 0 ? res / ext.z : 0);
+
+    std::vector<uint64_t> codes(n);
+#pragma omp parallel for
+    for (int i = 0; i < (signed)n; i++) {
+        real3 q = (pos[i] - pmin) * scale;
+        codes[i] = SpreadBits((uint64_t)q.x) | (SpreadBits((uint64_t)q.y) << 1) | (SpreadBits((uint64_t)q.z) << 2);
+    }
+
+    std::stable_sort(order.begin(), order.end(), [&codes](uint a, uint b) { return codes[a] < codes[b]; });
+}
+
+void ChMulticoreDataManager::ReorderRigidBodies(const std::vector<uint>& order) {
+    const uint n = num_rigid_bodies;
+    if (order.size() != n)
+        return;
+
+    std::vector<uint> new_index(n);
+    for (uint i = 0; i < n; i++)
+        new_index[order[i]] = i;
+
+    // Per-body state and material data
+    PermuteArray(host_data.pos_rigid, order);
+    PermuteArray(host_data.rot_rigid, order);
+    PermuteArray(host_data.active_rigid, order);
+    PermuteArray(host_data.collide_rigid, order);
+    PermuteArray(host_data.mass_rigid, order);
+    PermuteArray(host_data.sliding_friction, order);
+    PermuteArray(host_data.cohesion, order);
+
+    // Mapping between current indices and external IDs
+    PermuteArray(body_ext_id, order);
+    if (body_ext_id.size() == n && body_int_index.size() == n) {
+        for (uint i = 0; i < n; i++)
+            body_int_index[body_ext_id[i]] = i;
+    }
+
+    // Body IDs of the collision shapes (shape indices are not changed)
+    if (cd_data) {
+        std::vector<uint>& id_rigid = cd_data->shape_data.id_rigid;
+        for (uint s = 0; s < cd_data->num_rigid_shapes; s++) {
+            if (id_rigid[s] < n)
+                id_rigid[s] = new_index[id_rigid[s]];
+        }
+    }
+
+    // Contact history (SMC, multi-step tangential displacement model).
+    // Each entry is stored in the block of the body with the larger index, with a shear displacement expressed
+    // relative to that body. If the reordering swaps the roles of the two bodies, the entry is moved to the block of
+    // the other body and its displacement is flipped.
+    if (host_data.shear_neigh.size() == (size_t)max_shear * n) {
+        custom_vector<vec3> neigh(max_shear * n, vec3(-1, -1, -1));
+        custom_vector<real3> disp(max_shear * n, real3(0, 0, 0));
+        custom_vector<real> relvel_init(max_shear * n, 0);
+        custom_vector<real> duration(max_shear * n, 0);
+
+        for (uint b = 0; b < n; b++) {
+            for (int k = 0; k < max_shear; k++) {
+                const vec3& entry = host_data.shear_neigh[max_shear * b + k];
+                if (entry.x == -1)
+                    continue;
+                int b1 = new_index[b];
+                int b2 = new_index[entry.x];
+                real3 d = host_data.shear_disp[max_shear * b + k];
+                if (b1 < b2) {
+                    std::swap(b1, b2);
+                    d = -d;
+                }
+                for (int j = 0; j < max_shear; j++) {
+                    int idx = max_shear * b1 + j;
+                    if (neigh[idx].x == -1) {
+                        neigh[idx] = vec3(b2, entry.y, entry.z);
+                        disp[idx] = d;
+                        relvel_init[idx] = host_data.contact_relvel_init[max_shear * b + k];
+                        duration[idx] = host_data.contact_duration[max_shear * b + k];
+                        break;
+                    }
+                }
+            }
+        }
+
+        host_data.shear_neigh.swap(neigh);
+        host_data.shear_disp.swap(disp);
+        host_data.contact_relvel_init.swap(relvel_init);
+        host_data.contact_duration.swap(duration);
+    }
+
+    // Force a rebuild of the Jacobian sparsity pattern and invalidate cached contact forces
+    clear(host_data.D_T);
+    Fc_current = false;
+}
@@ -259,6 +259,12 @@ struct host_container {
     custom_vector<real3> vel_3dof;
     custom_vector<real3> sorted_vel_3dof;
 
+    // Kernel data for pairs of neighbor 3dof nodes, in the layout of the neighbor lists
+    // ([num_fluid_bodies * max_neighbors], indexed by the sorted node index), evaluated once per step
+    custom_vector<real> dist_3dof_3dof;    ///< distance between the two nodes
+    custom_vector<real> kernel_3dof_3dof;  ///< smoothing kernel value
+    custom_vector<real> grad_3dof_3dof;    ///< kernel gradient factor (the gradient is this factor times xij)
+
     /// Bilateral constraint type (all supported constraints)
     custom_vector<int> bilateral_type;
 
@@ -291,6 +297,7 @@ struct host_container {
     /// performed in two steps, first R = Minv_D*x, and then D_T*R where R is just
     /// a temporary variable used here for illustrative purposes. In reality the
     /// entire operation happens inline without a temp variable.
+    /// M_invD is not assembled (and left empty) if the matrix_free_schur solver setting is enabled.
     CompressedMatrix<real> M_invD;
 
     DynamicVector<real> R_full;  ///< The right hand side of the system
@@ -356,6 +363,10 @@ class CH_MULTICORE_API ChMulticoreDataManager {
     uint num_constraints;   ///< Total number of constraints
     uint nnz_bilaterals;    ///< The number of non-zero entries in the bilateral Jacobian
 
+    // Rigid body ordering (bodies may be reordered in space, see ReorderRigidBodies)
+    std::vector<uint> body_ext_id;     ///< external ID (insertion order) of the rigid body at each index
+    std::vector<uint> body_int_index;  ///< current index of the rigid body with a given external ID
+
     /// Flag indicating whether or not the contact forces are current (NSC only).
     bool Fc_current;
     /// Container for all timers for the system.
@@ -380,6 +391,15 @@ class CH_MULTICORE_API ChMulticoreDataManager {
 
     /// Print a sparse blaze matrix.
     void PrintMatrix(CompressedMatrix<real> src);
+
+    /// Compute an ordering of the rigid bodies along a Morton (Z-order) curve through their current positions.
+    /// On return, order[i] is the current index of the body that should be placed at index i.
+    void ComputeSpatialOrder(std::vector<uint>& order) const;
+
+    /// Permute all per-body data (state arrays, material data, contact history) so that the body currently at
+    /// index order[i] moves to index i. Collision shapes are reassigned to the new body indices. The caller is
+    /// responsible for reordering the system body list accordingly.
+    void ReorderRigidBodies(const std::vector<uint>& order);
 };
 
 /// @} multicore_module
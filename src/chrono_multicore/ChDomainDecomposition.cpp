@@ -0,0 +1,167 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "chrono_multicore/ChDomainDecomposition.h"
+#include "chrono_multicore/ChDataManager.h"
+
+namespace chrono {
+
+static const real large_real = std::numeric_limits<real>::max();
+
+// Index of the axis with the largest extent of the given points
+static int LongestAxis(std::vector<uint>::iterator begin,
+                       std::vector<uint>::iterator end,
+                       const std::vector<real3>& pos) {
+    real3 pmin(large_real);
+    real3 pmax(-large_real);
+    for (auto it = begin; it != end; ++it) {
+        const real3& p = pos[*it];
+        pmin = real3(std::min(pmin.x, p.x), std::min(pmin.y, p.y), std::min(pmin.z, p.z));
+        pmax = real3(std::max(pmax.x, p.x), std::max(pmax.y, p.y), std::max(pmax.z, p.z));
+    }
+    real3 ext = pmax - pmin;
+    if (ext.x >= ext.y && ext.x >= ext.z)
+        return 0;
+    return ext.y >= ext.z ? 1 : 2;
+}
+
+ChDomainDecomposition::ChDomainDecomposition(Type type, int num_subdomains)
+    : type(type), num_subdomains(std::max(num_subdomains, 1)), ghost_width(0) {}
+
+void ChDomainDecomposition::Partition(const ChMulticoreDataManager& data_manager) {
+    const custom_vector<real3>& pos_rigid = data_manager.host_data.pos_rigid;
+    Partition(std::vector<real3>(pos_rigid.begin(), pos_rigid.end()));
+}
+
+void ChDomainDecomposition::Partition(const std::vector<real3>& pos) {
+    const uint n = (uint)pos.size();
+
+    sub_min.assign(num_subdomains, real3(large_real));
+    sub_max.assign(num_subdomains, real3(-large_real));
+    owner.assign(n, 0);
+    owned.assign(num_subdomains, std::vector<uint>());
+    ghosts.assign(num_subdomains, std::vector<uint>());
+
+    std::vector<uint> ids(n);
+    std::iota(ids.begin(), ids.end(), 0);
+
+    if (type == Type::SLAB) {
+        int axis = LongestAxis(ids.begin(), ids.end(), pos);
+        std::sort(ids.begin(), ids.end(), [&pos, axis](uint a, uint b) { return pos[a][axis] < pos[b][axis]; });
+
+        // Contiguous chunks of (almost) equal size, separated by planes halfway between neighboring bodies
+        real lower = -large_real;
+        for (int s = 0; s < num_subdomains; s++) {
+            size_t first = (size_t)n * s / num_subdomains;
+            size_t last = (size_t)n * (s + 1) / num_subdomains;
+            real upper = large_real;
+            if (last == 0)
+                upper = -large_real;
+            else if (last < n)
+                upper = (pos[ids[last - 1]][axis] + pos[ids[last]][axis]) / 2;
+
+            sub_min[s] = real3(-large_real);
+            sub_max[s] = real3(large_real);
+            sub_min[s][axis] = lower;
+            sub_max[s][axis] = upper;
+            lower = upper;
+
+            owned[s].assign(ids.begin() + first, ids.begin() + last);
+        }
+    } else {
+        Bisect(ids.begin(), ids.end(), pos, 0, num_subdomains, real3(-large_real), real3(large_real));
+    }
+
+    for (int s = 0; s < num_subdomains; s++) {
+        for (auto b : owned[s])
+            owner[b] = s;
+    }
+
+    // Ghost bodies: bodies of other subdomains within the ghost width of each subdomain box
+    const real width2 = ghost_width * ghost_width;
+#pragma omp parallel for
+    for (int s = 0; s < num_subdomains; s++) {
+        for (uint b = 0; b < n; b++) {
+            if (owner[b] == s)
+                continue;
+            const real3& p = pos[b];
+            real3 d(std::max(std::max(sub_min[s].x - p.x, p.x - sub_max[s].x), real(0)),
+                    std::max(std::max(sub_min[s].y - p.y, p.y - sub_max[s].y), real(0)),
+                    std::max(std::max(sub_min[s].z - p.z, p.z - sub_max[s].z), real(0)));
+            if (Dot(d, d) <= width2)
+                ghosts[s].push_back(b);
+        }
+    }
+}
+
+void ChDomainDecomposition::Bisect(std::vector<uint>::iterator begin,
+                                   std::vector<uint>::iterator end,
+                                   const std::vector<real3>& pos,
+                                   int first_sub,
+                                   int num_subs,
+                                   const real3& min_point,
+                                   const real3& max_point) {
+    if (num_subs == 1) {
+        sub_min[first_sub] = min_point;
+        sub_max[first_sub] = max_point;
+        owned[first_sub].assign(begin, end);
+        return;
+    }
+
+    // Subdomains without bodies are left with an empty box
+    const size_t count = end - begin;
+    if (count == 0)
+        return;
+
+    // Split the bodies in proportion to the number of subdomains on each side, along the longest axis
+    const int left_subs = num_subs / 2;
+    const int axis = LongestAxis(begin, end, pos);
+    auto mid = begin + count * left_subs / num_subs;
+    auto cmp = [&pos, axis](uint a, uint b) { return pos[a][axis] < pos[b][axis]; };
+
+    real plane;
+    if (mid == end) {
+        plane = pos[*std::max_element(begin, end, cmp)][axis];
+    } else {
+        std::nth_element(begin, mid, end, cmp);
+        plane = pos[*mid][axis];
+        if (mid != begin)
+            plane = (plane + pos[*std::max_element(begin, mid, cmp)][axis]) / 2;
+    }
+
+    real3 left_max = max_point;
+    real3 right_min = min_point;
+    left_max[axis] = plane;
+    right_min[axis] = plane;
+
+    Bisect(begin, mid, pos, first_sub, left_subs, min_point, left_max);
+    Bisect(mid, end, pos, first_sub + left_subs, num_subs - left_subs, right_min, max_point);
+}
+
+void ChDomainDecomposition::GetSubdomainBounds(int sub, real3& min_point, real3& max_point) const {
+    min_point = sub_min[sub];
+    max_point = sub_max[sub];
+}
+
+bool ChDomainDecomposition::Contains(int sub, const real3& p) const {
+    return p.x >= sub_min[sub].x && p.x < sub_max[sub].x &&  //
+           p.y >= sub_min[sub].y && p.y < sub_max[sub].y &&  //
+           p.z >= sub_min[sub].z && p.z < sub_max[sub].z;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,99 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Spatial decomposition of the rigid bodies of a Chrono::Multicore system into
+// subdomains, with identification of the ghost bodies near subdomain boundaries.
+//
+// =============================================================================
+
+#pragma once
+
+#include <vector>
+
+#include "chrono_multicore/ChApiMulticore.h"
+#include "chrono/multicore_math/other_types.h"
+
+namespace chrono {
+
+class ChMulticoreDataManager;
+
+/// @addtogroup multicore_module
+/// @{
+
+/// Spatial decomposition of a set of bodies into subdomains.
+/// Subdomains are axis-aligned boxes (the outer ones extend to infinity) and are balanced by body count. Each body is
+/// owned by the subdomain containing its position; a body is a ghost of every other subdomain within the ghost width
+/// of its position. This is the partitioning layer for running a Chrono::Multicore system over several subdomains
+/// (e.g. one per process), where each subdomain solves its owned bodies and exchanges the data of its ghosts.
+class CH_MULTICORE_API ChDomainDecomposition {
+  public:
+    /// Decomposition type.
+    enum class Type {
+        SLAB,  ///< parallel slabs along the longest axis of the body bounding box
+        RCB    ///< recursive coordinate bisection (octree-like, for an arbitrary number of subdomains)
+    };
+
+    ChDomainDecomposition(Type type, int num_subdomains);
+
+    /// Set the width of the ghost layer around each subdomain (default: 0).
+    /// This should be at least the largest body extent plus the collision envelope.
+    void SetGhostWidth(real width) { ghost_width = width; }
+
+    /// Partition the bodies with the given positions.
+    void Partition(const std::vector<real3>& pos);
+
+    /// Partition the rigid bodies of a Chrono::Multicore system, using their current positions.
+    void Partition(const ChMulticoreDataManager& data_manager);
+
+    /// Get the number of subdomains.
+    int GetNumSubdomains() const { return num_subdomains; }
+
+    /// Get the subdomain owning the specified body.
+    int GetOwner(uint body) const { return owner[body]; }
+
+    /// Get the list of bodies owned by the specified subdomain.
+    const std::vector<uint>& GetOwnedBodies(int sub) const { return owned[sub]; }
+
+    /// Get the list of ghost bodies of the specified subdomain (owned by other subdomains).
+    const std::vector<uint>& GetGhostBodies(int sub) const { return ghosts[sub]; }
+
+    /// Get the bounds of the specified subdomain.
+    void GetSubdomainBounds(int sub, real3& min_point, real3& max_point) const;
+
+    /// Return true if the given point is inside the specified subdomain.
+    bool Contains(int sub, const real3& p) const;
+
+  private:
+    void Bisect(std::vector<uint>::iterator begin,
+                std::vector<uint>::iterator end,
+                const std::vector<real3>& pos,
+                int first_sub,
+                int num_subs,
+                const real3& min_point,
+                const real3& max_point);
+
+    Type type;
+    int num_subdomains;
+    real ghost_width;
+
+    std::vector<real3> sub_min;             ///< lower corner of each subdomain
+    std::vector<real3> sub_max;             ///< upper corner of each subdomain
+    std::vector<int> owner;                 ///< owning subdomain of each body
+    std::vector<std::vector<uint>> owned;   ///< owned bodies of each subdomain
+    std::vector<std::vector<uint>> ghosts;  ///< ghost bodies of each subdomain
+};
+
+/// @} multicore_module
+
+}  // end namespace chrono
@@ -91,6 +91,14 @@ class solver_measures {
         spinning_apgd_step_length = 1;
         old_objective_value = 0;
         lambda_max = 0;
+
+        step_num_contacts = 0;
+        step_iteration_budget = 0;
+        step_iterations = 0;
+        step_initial_residual = 0;
+        step_final_residual = 0;
+        step_reduction_rate = 0;
+        step_early_termination = false;
     }
     int total_iteration;       ///< The total number of iterations performed, this variable accumulates
     real residual;             ///< Current residual for the solver
@@ -103,6 +111,15 @@ class solver_measures {
     real spinning_apgd_step_length;
     real lambda_max;  ///< Largest eigenvalue
 
+    // Per-step statistics (iteration control, see solver_settings::adaptive_iterations)
+    uint step_num_contacts;       ///< Number of rigid contacts at the last step
+    uint step_iteration_budget;   ///< Total iteration budget of the solves of the last step
+    uint step_iterations;         ///< Total number of iterations performed at the last step
+    real step_initial_residual;   ///< Residual after the first iteration of the last step
+    real step_final_residual;     ///< Residual at the end of the last step
+    real step_reduction_rate;     ///< Mean per-iteration residual reduction factor at the last step
+    bool step_early_termination;  ///< Did a solve of the last step stop on residual stagnation?
+
     // These three variables are used to store the convergence history of the solver
     std::vector<real> maxd_hist, maxdeltalambda_hist, time;
 
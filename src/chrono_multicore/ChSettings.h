@@ -43,6 +43,7 @@ class collision_settings {
           bin_size(real3(1, 1, 1)),
           grid_density(5),
           broadphase_grid(ChBroadphase::GridType::FIXED_RESOLUTION),
+          broadphase_incremental(false),
           narrowphase_algorithm(ChNarrowphase::Algorithm::HYBRID) {}
 
     /// For stability of NSC contact, the envelope should be set to 5-10% of the smallest collision shape size (too
@@ -79,6 +80,11 @@ class collision_settings {
     /// `broadphase_grid` type is set to FIXED_DENSITY.
     real grid_density;
 
+    /// Flag controlling the use of the incremental broadphase (default: false).
+    /// If enabled, the broadphase grid is reused across steps and only shapes whose AABB moved to different bins are
+    /// re-binned (see ChCollisionSystemMulticore::EnableIncrementalBroadphase).
+    bool broadphase_incremental;
+
     /// Algorithm for narrowphase collision detection phase.
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
@@ -125,7 +131,14 @@ class solver_settings {
         use_power_iteration = false;
         max_power_iteration = 15;
         power_iter_tolerance = 0.1;
+        use_gpu = false;
+        matrix_free_schur = false;
         skip_residual = 1;
+        adaptive_iterations = false;
+        adaptive_min_iteration = 10;
+        adaptive_contact_change = 0.1;
+        adaptive_min_reduction = 0.01;
+        adaptive_window = 10;
     }
 
     /// The solver type variable defines name of the solver that will be used to
@@ -168,6 +181,16 @@ class solver_settings {
     bool use_power_iteration;
     int max_power_iteration;
     real power_iter_tolerance;
+    /// Run the APGD and BB solvers on the GPU (requires Chrono::Multicore built with CUDA support).
+    /// The GPU solvers keep the constraint Jacobian and the solver vectors in device memory for the duration of a
+    /// solve. The CPU solvers are used instead when a 3DOF container contributes constraints or when update_rhs or
+    /// compute_N are enabled.
+    bool use_gpu;
+    /// Compute the Schur complement product as D_T * (M_inv * (D * x)), without assembling M_invD (default: false).
+    /// This removes one copy of the constraint Jacobian (M_invD has as many non-zeros as D), at the cost of an
+    /// additional product with the block-diagonal inverse mass matrix at each solver iteration.
+    /// Only used by the NSC solvers.
+    bool matrix_free_schur;
 
     /// Contact force model for SMC.
     ChSystemSMC::ContactForceModel contact_force_model;
@@ -213,6 +236,20 @@ class solver_settings {
     real tolerance_objective;
     /// Compute residual every x iterations.
     int skip_residual;
+
+    /// Adapt the number of solver iterations of each step (default: false).
+    /// The iteration budget of a step is predicted from the residual reduction rate and the initial residual of the
+    /// previous step, as the number of iterations needed to reach tol_speed, bounded by adaptive_min_iteration and
+    /// the max_iteration_* value of each solve. The full max_iteration_* budget is used at the first step and whenever
+    /// the number of contacts changed by more than adaptive_contact_change (relative) since the previous step.
+    /// In addition, an APGD or BB solve stops early when its residual decreased by less than the fraction
+    /// adaptive_min_reduction over the last adaptive_window iterations. Per-step statistics are reported in
+    /// solver_measures.
+    bool adaptive_iterations;
+    uint adaptive_min_iteration;   ///< lower bound on the adaptive iteration budget of a solve
+    real adaptive_contact_change;  ///< relative change in the number of contacts that triggers the full budget
+    real adaptive_min_reduction;   ///< minimum relative residual reduction over a window of iterations
+    int adaptive_window;           ///< number of iterations over which the residual reduction is checked
 };
 
 /// Aggregate of all settings for Chrono::Multicore.
@@ -228,6 +265,7 @@ class settings_container {
         perform_thread_tuning = false;
         system_type = SystemType::SYSTEM_NSC;
         step_size = 0.01;
+        body_reorder_interval = 0;
     }
 
     collision_settings collision;  ///< settings for collision detection
@@ -236,6 +274,11 @@ class settings_container {
     real step_size;  ///< current integration step size
     real3 gravity;   ///< gravitational acceleration vector
 
+    /// Number of steps between spatial reorderings of the rigid bodies (default: 0, no reordering).
+    /// Bodies are periodically renumbered along a space-filling curve through their positions, so that bodies close
+    /// in space have close indices. Body handles are unaffected; see ChSystemMulticore::ReorderBodies.
+    int body_reorder_interval;
+
   private:
     bool perform_thread_tuning;  ///< dynamically tune number of threads
     int min_threads;             ///< lower bound for number of threads (if dynamic tuning)
@@ -0,0 +1,67 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <stdexcept>
+
+#include "chrono_multicore/ChConfigMulticore.h"
+#include "chrono_multicore/collision/ChBroadphaseGPU.h"
+
+#ifdef CHRONO_MULTICORE_USE_CUDA
+    #include "chrono_multicore/cuda/ChBroadphaseGPU.cuh"
+#endif
+
+namespace chrono {
+
+ChBroadphaseGPU::ChBroadphaseGPU() {
+#ifndef CHRONO_MULTICORE_USE_CUDA
+    throw std::runtime_error("ChBroadphaseGPU::ChBroadphaseGPU - Chrono::Multicore was built without CUDA support");
+#endif
+}
+
+void ChBroadphaseGPU::OneLevelBroadphase(ChCollisionData& cd_data) {
+#ifdef CHRONO_MULTICORE_USE_CUDA
+    GPU_Broadphase_Input input;
+    input.num_shapes = cd_data.num_rigid_shapes;
+    input.aabb_min = &cd_data.aabb_min[0][0];
+    input.aabb_max = &cd_data.aabb_max[0][0];
+    input.aabb_stride = sizeof(real3) / sizeof(real);
+    input.body_id = cd_data.shape_data.id_rigid.data();
+    input.family = &cd_data.shape_data.fam_rigid[0].x;
+    input.num_bodies = (unsigned int)cd_data.state_data.collide_rigid->size();
+    input.body_active = cd_data.state_data.active_rigid->data();
+    input.body_collide = cd_data.state_data.collide_rigid->data();
+    input.bins_per_axis[0] = cd_data.bins_per_axis.x;
+    input.bins_per_axis[1] = cd_data.bins_per_axis.y;
+    input.bins_per_axis[2] = cd_data.bins_per_axis.z;
+    input.inv_bin_size[0] = cd_data.inv_bin_size.x;
+    input.inv_bin_size[1] = cd_data.inv_bin_size.y;
+    input.inv_bin_size[2] = cd_data.inv_bin_size.z;
+
+    GPU_Broadphase_Output output;
+    output.bin_number = &cd_data.bin_number;
+    output.bin_aabb_number = &cd_data.bin_aabb_number;
+    output.bin_active = &cd_data.bin_active;
+    output.bin_start_index = &cd_data.bin_start_index;
+    output.bin_num_contact = &cd_data.bin_num_contact;
+    output.pair_shapeIDs = &cd_data.pair_shapeIDs;
+
+    GPU_OneLevelBroadphase(input, output);
+
+    cd_data.num_bin_aabb_intersections = (uint)cd_data.bin_number.size();
+    cd_data.num_active_bins = (uint)cd_data.bin_active.size();
+    cd_data.num_possible_collisions = (uint)cd_data.pair_shapeIDs.size();
+#endif
+}
+
+}  // end namespace chrono
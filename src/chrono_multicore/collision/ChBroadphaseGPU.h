@@ -0,0 +1,54 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// GPU backend for the one-level grid broadphase of the Chrono multicore
+// collision system.
+//
+// =============================================================================
+
+#ifndef CH_BROADPHASE_GPU_H
+#define CH_BROADPHASE_GPU_H
+
+#include "chrono_multicore/ChApiMulticore.h"
+
+#include "chrono/collision/multicore/ChBroadphase.h"
+
+namespace chrono {
+
+/// @addtogroup multicore_collision
+/// @{
+
+/// GPU backend for the one-level grid broadphase.
+/// Binning of the shape AABBs, sorting of the bin-shape intersections, and the search for candidate pairs in each
+/// active bin run on the current CUDA device; the resulting bin and pair arrays are copied back to the collision data,
+/// so that the narrowphase (and the incremental broadphase, if enabled) run unchanged on the host. The candidate pairs
+/// are the same, and in the same order, as those found by the host implementation.
+/// Can be used with any system using the Chrono multicore collision system (see
+/// ChCollisionSystemMulticore::SetBroadphaseBackend), including ChSystemNSC and ChSystemSMC.
+/// Experimental. Requires Chrono::Multicore to be built with CUDA support (USE_MULTICORE_CUDA); otherwise, the
+/// constructor throws an exception.
+class CH_MULTICORE_API ChBroadphaseGPU : public ChBroadphase::Backend {
+  public:
+    ChBroadphaseGPU();
+    ~ChBroadphaseGPU() {}
+
+    /// Find the pairs of shapes with intersecting AABBs and load them in the collision data.
+    virtual void OneLevelBroadphase(ChCollisionData& cd_data) override;
+};
+
+/// @} multicore_collision
+
+}  // end namespace chrono
+
+#endif
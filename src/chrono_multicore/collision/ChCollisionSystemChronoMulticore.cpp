@@ -61,6 +61,7 @@ void ChCollisionSystemChronoMulticore::PreProcess() {
     if (data_manager->node_container) {
         cd_data->p_kernel_radius = data_manager->node_container->kernel_radius;
         cd_data->p_collision_envelope = data_manager->node_container->collision_envelope;
+        cd_data->p_verlet_skin = data_manager->node_container->verlet_skin;
         cd_data->p_collision_family = data_manager->node_container->family;
     }
 
@@ -74,6 +75,7 @@ void ChCollisionSystemChronoMulticore::PreProcess() {
     broadphase.grid_resolution = settings.bins_per_axis;
     broadphase.bin_size = settings.bin_size;
     broadphase.grid_density = settings.grid_density;
+    broadphase.incremental = settings.broadphase_incremental;
     narrowphase.algorithm = settings.narrowphase_algorithm;
 }
 
@@ -175,6 +175,12 @@ void ChConstraintBilateral::GenerateSparsity() {
     // before shaft states.
 
     CompressedMatrix<real>& D_b_T = data_manager->host_data.D_T;
+
+    sparsity_mapping.assign(data_manager->host_data.bilateral_mapping.begin(),
+                            data_manager->host_data.bilateral_mapping.begin() + data_manager->num_bilaterals);
+    sparsity_num_constraints = mconstraints.size();
+    sparsity_num_bodies = data_manager->num_rigid_bodies;
+
     int off = data_manager->num_unilaterals;
     for (int index = 0; index < (signed)data_manager->num_bilaterals; index++) {
         int cntr = data_manager->host_data.bilateral_mapping[index];
@@ -299,3 +305,13 @@ void ChConstraintBilateral::GenerateSparsity() {
         D_b_T.finalize(row);
     }
 }
+
+bool ChConstraintBilateral::IsSparsityValid() const {
+    if (sparsity_mapping.size() != data_manager->num_bilaterals ||
+        sparsity_num_constraints != data_manager->system_descriptor->GetConstraints().size() ||
+        sparsity_num_bodies != data_manager->num_rigid_bodies)
+        return false;
+
+    return std::equal(sparsity_mapping.begin(), sparsity_mapping.end(),
+                      data_manager->host_data.bilateral_mapping.begin());
+}
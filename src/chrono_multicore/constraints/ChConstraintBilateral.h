@@ -45,7 +45,16 @@ class CH_MULTICORE_API ChConstraintBilateral {
     // This operation is sequential.
     void GenerateSparsity();
 
+    /// Return true if the sparsity pattern generated by the last call to GenerateSparsity still applies
+    /// (same active constraints, same number of constraints in the system descriptor, and same number of bodies).
+    bool IsSparsityValid() const;
+
     ChMulticoreDataManager* data_manager;  ///< Pointer to the system's data manager.
+
+  private:
+    std::vector<int> sparsity_mapping;     ///< active constraints at the last sparsity generation
+    size_t sparsity_num_constraints = 0;   ///< number of descriptor constraints at the last sparsity generation
+    uint sparsity_num_bodies = 0;          ///< number of rigid bodies at the last sparsity generation
 };
 
 /// @} multicore_constraint
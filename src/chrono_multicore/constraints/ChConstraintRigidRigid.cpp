@@ -30,7 +30,7 @@ using namespace chrono;
 // -----------------------------------------------------------------------------
 
 ChConstraintRigidRigid::ChConstraintRigidRigid()
-    : data_manager(nullptr), offset(3), inv_h(0), inv_hpa(0), inv_hhpa(0) {}
+    : data_manager(nullptr), offset(3), inv_h(0), inv_hpa(0), inv_hhpa(0), sparsity_mode(SolverMode::NORMAL) {}
 
 void ChConstraintRigidRigid::func_Project_normal(int index, const vec2* ids, const real* cohesion, real* gamma) {
     const auto num_rigid_contacts = data_manager->cd_data ? data_manager->cd_data->num_rigid_contacts : 0;
@@ -327,9 +327,12 @@ void ChConstraintRigidRigid::Build_s() {
     const DynamicVector<real>& M_invk = data_manager->host_data.M_invk;
     const DynamicVector<real>& gamma = data_manager->host_data.gamma;
 
-    const CompressedMatrix<real, blaze::columnMajor>& M_invD = data_manager->host_data.M_invD;
-
-    v_new = M_invk + M_invD * gamma;
+    if (data_manager->settings.solver.matrix_free_schur) {
+        v_new = M_invk + data_manager->host_data.M_inv * (data_manager->host_data.D * gamma);
+    } else {
+        const CompressedMatrix<real, blaze::columnMajor>& M_invD = data_manager->host_data.M_invD;
+        v_new = M_invk + M_invD * gamma;
+    }
 
 #pragma omp parallel for
     for (int index = 0; index < (signed)num_rigid_contacts; index++) {
@@ -480,14 +483,17 @@ void ChConstraintRigidRigid::Build_D() {
 void ChConstraintRigidRigid::GenerateSparsity() {
     const auto num_rigid_contacts = data_manager->cd_data ? data_manager->cd_data->num_rigid_contacts : 0;
 
+    SolverMode solver_mode = data_manager->settings.solver.solver_mode;
+    sparsity_mode = solver_mode;
+    sparsity_ids.clear();
+
     if (num_rigid_contacts <= 0)
         return;
 
-    SolverMode solver_mode = data_manager->settings.solver.solver_mode;
-
     CompressedMatrix<real>& D_T = data_manager->host_data.D_T;
 
     const vec2* ids = data_manager->cd_data->bids_rigid_rigid.data();
+    sparsity_ids.assign(ids, ids + num_rigid_contacts);
 
     for (int index = 0; index < (signed)num_rigid_contacts; index++) {
         const vec2& body_id = ids[index];
@@ -556,6 +562,53 @@ void ChConstraintRigidRigid::GenerateSparsity() {
     }
 }
 
+bool ChConstraintRigidRigid::UpdateSparsity() {
+    const auto num_rigid_contacts = data_manager->cd_data ? data_manager->cd_data->num_rigid_contacts : 0;
+
+    SolverMode solver_mode = data_manager->settings.solver.solver_mode;
+    if (solver_mode != sparsity_mode || num_rigid_contacts != sparsity_ids.size())
+        return false;
+
+    CompressedMatrix<real>& D_T = data_manager->host_data.D_T;
+
+    const vec2* ids = data_manager->cd_data->bids_rigid_rigid.data();
+
+    // Refill the rows of a contact in the same order as GenerateSparsity (a reset row keeps its storage)
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_rigid_contacts; index++) {
+        const vec2& body_id = ids[index];
+        if (body_id.x == sparsity_ids[index].x && body_id.y == sparsity_ids[index].y)
+            continue;
+        sparsity_ids[index] = body_id;
+
+        int row = index;
+        int off = 0;
+        D_T.reset(off + row * 1);
+        AppendRow6(D_T, off + row * 1, body_id.x * 6, 0);
+        AppendRow6(D_T, off + row * 1, body_id.y * 6, 0);
+
+        if (solver_mode == SolverMode::SLIDING || solver_mode == SolverMode::SPINNING) {
+            off = num_rigid_contacts;
+            for (int i = 0; i < 2; i++) {
+                D_T.reset(off + row * 2 + i);
+                AppendRow6(D_T, off + row * 2 + i, body_id.x * 6, 0);
+                AppendRow6(D_T, off + row * 2 + i, body_id.y * 6, 0);
+            }
+        }
+
+        if (solver_mode == SolverMode::SPINNING) {
+            off = 3 * num_rigid_contacts;
+            for (int i = 0; i < 3; i++) {
+                D_T.reset(off + row * 3 + i);
+                AppendRow3(D_T, off + row * 3 + i, body_id.x * 6 + 3, 0);
+                AppendRow3(D_T, off + row * 3 + i, body_id.y * 6 + 3, 0);
+            }
+        }
+    }
+
+    return true;
+}
+
 void ChConstraintRigidRigid::Dx(const DynamicVector<real>& gam, DynamicVector<real>& XYZUVW) {
     const auto num_rigid_contacts = data_manager->cd_data->num_rigid_contacts;
     real3* norm = data_manager->cd_data->norm_rigid_rigid.data();
@@ -54,6 +54,12 @@ class CH_MULTICORE_API ChConstraintRigidRigid {
     /// Fill-in the non zero entries in the bilateral jacobian with ones.
     /// This operation is sequential.
     void GenerateSparsity();
+    /// Update in place the sparsity pattern generated by the last call to GenerateSparsity.
+    /// This is possible only for the same number of contacts and the same solver mode. Since all rows of a contact
+    /// have a fixed number of non zeros, the rows of contacts with the same body pair are kept and the rows of the
+    /// other contacts are refilled within their existing storage (in parallel, without any reallocation).
+    /// Return false, with the matrix unchanged, if the pattern cannot be updated in place.
+    bool UpdateSparsity();
 
     int offset;
 
@@ -67,6 +73,9 @@ class CH_MULTICORE_API ChConstraintRigidRigid {
     custom_vector<real3_int> rotated_point_a, rotated_point_b;
     custom_vector<quaternion> quat_a, quat_b;
 
+    custom_vector<vec2> sparsity_ids;  ///< contact body pairs at the last sparsity generation
+    SolverMode sparsity_mode;          ///< solver mode at the last sparsity generation
+
     ChMulticoreDataManager* data_manager;  ///< Pointer to the system's data manager
 };
 
@@ -0,0 +1,375 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Description: GPU implementation of the one-level grid broadphase. The kernels
+// mirror the host functions in ChCollisionUtilsBroadphase.cpp (one thread per
+// shape to bin the AABBs, one thread per active bin to find the pairs).
+// =============================================================================
+
+#include <climits>
+
+#include "chrono_multicore/cuda/ChBroadphaseGPU.cuh"
+#include "chrono_multicore/cuda/ChCudaHelper.cuh"
+#include "chrono_multicore/cuda/ChGPUVector.cuh"
+#include <cub/cub.cuh>
+
+namespace chrono {
+
+// Shape and bin data, kept on the device between calls (the device storage is only grown)
+struct GPU_Broadphase_Data {
+    gpu_vector<real> aabb_min, aabb_max;
+    gpu_vector<unsigned int> body_id;
+    gpu_vector<short> family;
+    gpu_vector<char> body_active, body_collide;
+
+    gpu_vector<unsigned int> bin_intersections;  // bin-shape intersections per shape
+    gpu_vector<unsigned int> bin_offsets;        // start of each shape in the (unsorted) bin-shape intersections
+    gpu_vector<unsigned int> bin_number_unsorted, bin_aabb_number_unsorted;
+    gpu_vector<unsigned int> bin_number, bin_aabb_number;
+    gpu_vector<unsigned int> bin_active, bin_count, bin_start_index;
+    gpu_vector<unsigned int> num_active_bins;
+    gpu_vector<unsigned int> pair_count, bin_num_contact;
+    gpu_vector<long long> pair_shapeIDs;
+
+    gpu_vector<unsigned char> temp_storage;  // cub temporary storage
+};
+
+static GPU_Broadphase_Data bp_data;
+
+template <typename T>
+static void Reserve(gpu_vector<T>& vec, size_t size) {
+    if (vec.size() < size)
+        vec.resize(size);
+}
+
+template <typename T>
+static void Upload(gpu_vector<T>& vec, const T* host, size_t size) {
+    if (size == 0)
+        return;
+    Reserve(vec, size);
+    cudaCheck(cudaMemcpy(vec(), host, size * sizeof(T), cudaMemcpyHostToDevice));
+}
+
+template <typename T>
+static void Download(std::vector<T>& host, gpu_vector<T>& vec, size_t size) {
+    host.resize(size);
+    if (size == 0)
+        return;
+    cudaCheck(cudaMemcpy(host.data(), vec(), size * sizeof(T), cudaMemcpyDeviceToHost));
+}
+
+// Exclusive prefix sum of the first num entries of in (out[num] is the total if in[num] = 0)
+static void ExclusiveSum(gpu_vector<unsigned int>& in, gpu_vector<unsigned int>& out, unsigned int num) {
+    Reserve(out, num);
+    size_t temp_bytes = 0;
+    cub::DeviceScan::ExclusiveSum(nullptr, temp_bytes, in(), out(), (int)num);
+    Reserve(bp_data.temp_storage, temp_bytes);
+    cub::DeviceScan::ExclusiveSum(bp_data.temp_storage(), temp_bytes, in(), out(), (int)num);
+}
+
+// -----------------------------------------------------------------------------
+
+// Grid parameters, passed by value to the kernels
+struct GridInfo {
+    int bins_per_axis[3];
+    real inv_bin_size[3];
+};
+
+// Convert a position into bin coordinates ("lower" corner), see HashMin
+CUDA_DEVICE inline void HashMin(const real* A, const GridInfo& grid, int* bin) {
+    for (int k = 0; k < 3; k++)
+        bin[k] = (int)floor(A[k] * grid.inv_bin_size[k]);
+}
+
+// Convert a position into bin coordinates ("upper" corner), see HashMax
+CUDA_DEVICE inline void HashMax(const real* A, const GridInfo& grid, int* bin) {
+    for (int k = 0; k < 3; k++)
+        bin[k] = (int)ceil(A[k] * grid.inv_bin_size[k]) - 1;
+}
+
+// Convert bin coordinates into a unique bin index value, see Hash_Index
+CUDA_DEVICE inline unsigned int HashIndex(int i, int j, int k, const GridInfo& grid) {
+    return ((k * grid.bins_per_axis[1]) * grid.bins_per_axis[0]) + (j * grid.bins_per_axis[0]) + i;
+}
+
+// Count the bins intersected by each shape AABB (zero for inactive shapes and for the extra entry at the end)
+CUDA_GLOBAL void kCountBinIntersections(unsigned int num_shapes,
+                                        const real* aabb_min,
+                                        const real* aabb_max,
+                                        unsigned int stride,
+                                        const unsigned int* body_id,
+                                        GridInfo grid,
+                                        unsigned int* bin_intersections) {
+    unsigned int index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index > num_shapes)
+        return;
+    if (index == num_shapes || body_id[index] == UINT_MAX) {
+        bin_intersections[index] = 0;
+        return;
+    }
+    int gmin[3], gmax[3];
+    HashMin(aabb_min + index * stride, grid, gmin);
+    HashMax(aabb_max + index * stride, grid, gmax);
+    bin_intersections[index] = (gmax[0] - gmin[0] + 1) * (gmax[1] - gmin[1] + 1) * (gmax[2] - gmin[2] + 1);
+}
+
+// Store the bin index and the shape index of all bin-shape intersections
+CUDA_GLOBAL void kStoreBinIntersections(unsigned int num_shapes,
+                                        const real* aabb_min,
+                                        const real* aabb_max,
+                                        unsigned int stride,
+                                        const unsigned int* body_id,
+                                        GridInfo grid,
+                                        const unsigned int* bin_offsets,
+                                        unsigned int* bin_number,
+                                        unsigned int* bin_aabb_number) {
+    unsigned int index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index >= num_shapes || body_id[index] == UINT_MAX)
+        return;
+    int gmin[3], gmax[3];
+    HashMin(aabb_min + index * stride, grid, gmin);
+    HashMax(aabb_max + index * stride, grid, gmax);
+    unsigned int offset = bin_offsets[index];
+    for (int i = gmin[0]; i <= gmax[0]; i++) {
+        for (int j = gmin[1]; j <= gmax[1]; j++) {
+            for (int k = gmin[2]; k <= gmax[2]; k++) {
+                bin_number[offset] = HashIndex(i, j, k, grid);
+                bin_aabb_number[offset] = index;
+                offset++;
+            }
+        }
+    }
+}
+
+// Check whether two shapes in the given bin are a candidate pair. A pair is only reported in the bin containing the
+// lower corner of the intersection of the two AABBs (see f_Count_AABB_AABB_Intersection).
+CUDA_DEVICE inline bool IsPairInBin(unsigned int shapeA,
+                                    unsigned int shapeB,
+                                    unsigned int bin,
+                                    const real* aabb_min,
+                                    const real* aabb_max,
+                                    unsigned int stride,
+                                    const unsigned int* body_id,
+                                    const short* family,
+                                    const char* body_active,
+                                    const char* body_collide,
+                                    const GridInfo& grid) {
+    unsigned int bodyA = body_id[shapeA];
+    unsigned int bodyB = body_id[shapeB];
+    if (bodyB == UINT_MAX || shapeA == shapeB || bodyA == bodyB || body_collide[bodyB] == 0)
+        return false;
+    if (!body_active[bodyA] && !body_active[bodyB])
+        return false;
+
+    // Collision families: the group of each shape must be in the mask of the other one
+    if (!((family[2 * shapeA + 1] & family[2 * shapeB]) && (family[2 * shapeB + 1] & family[2 * shapeA])))
+        return false;
+
+    const real* Amin = aabb_min + shapeA * stride;
+    const real* Amax = aabb_max + shapeA * stride;
+    const real* Bmin = aabb_min + shapeB * stride;
+    const real* Bmax = aabb_max + shapeB * stride;
+    real min_p[3];
+    for (int k = 0; k < 3; k++) {
+        if (!(Amin[k] <= Bmax[k] && Bmin[k] <= Amax[k]))
+            return false;
+        min_p[k] = Amin[k] > Bmin[k] ? Amin[k] : Bmin[k];
+    }
+
+    int g[3];
+    HashMin(min_p, grid, g);
+    return HashIndex(g[0], g[1], g[2], grid) == bin;
+}
+
+// Count the candidate pairs in each active bin (zero for the extra entry at the end)
+CUDA_GLOBAL void kCountPairs(unsigned int num_active_bins,
+                             const real* aabb_min,
+                             const real* aabb_max,
+                             unsigned int stride,
+                             const unsigned int* body_id,
+                             const short* family,
+                             const char* body_active,
+                             const char* body_collide,
+                             GridInfo grid,
+                             const unsigned int* bin_active,
+                             const unsigned int* bin_aabb_number,
+                             const unsigned int* bin_start_index,
+                             unsigned int* pair_count) {
+    unsigned int index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index > num_active_bins)
+        return;
+    if (index == num_active_bins) {
+        pair_count[index] = 0;
+        return;
+    }
+    unsigned int start = bin_start_index[index];
+    unsigned int end = bin_start_index[index + 1];
+    unsigned int count = 0;
+    for (unsigned int i = start; i < end; i++) {
+        unsigned int shapeA = bin_aabb_number[i];
+        unsigned int bodyA = body_id[shapeA];
+        if (bodyA == UINT_MAX || body_collide[bodyA] == 0)
+            continue;
+        for (unsigned int k = i + 1; k < end; k++) {
+            if (IsPairInBin(shapeA, bin_aabb_number[k], bin_active[index], aabb_min, aabb_max, stride, body_id, family,
+                            body_active, body_collide, grid))
+                count++;
+        }
+    }
+    pair_count[index] = count;
+}
+
+// Store the candidate pairs in each active bin (smaller shape index in the upper 32 bits)
+CUDA_GLOBAL void kStorePairs(unsigned int num_active_bins,
+                             const real* aabb_min,
+                             const real* aabb_max,
+                             unsigned int stride,
+                             const unsigned int* body_id,
+                             const short* family,
+                             const char* body_active,
+                             const char* body_collide,
+                             GridInfo grid,
+                             const unsigned int* bin_active,
+                             const unsigned int* bin_aabb_number,
+                             const unsigned int* bin_start_index,
+                             const unsigned int* bin_num_contact,
+                             long long* pair_shapeIDs) {
+    unsigned int index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index >= num_active_bins)
+        return;
+    unsigned int start = bin_start_index[index];
+    unsigned int end = bin_start_index[index + 1];
+    unsigned int offset = bin_num_contact[index];
+    for (unsigned int i = start; i < end; i++) {
+        unsigned int shapeA = bin_aabb_number[i];
+        unsigned int bodyA = body_id[shapeA];
+        if (bodyA == UINT_MAX || body_collide[bodyA] == 0)
+            continue;
+        for (unsigned int k = i + 1; k < end; k++) {
+            unsigned int shapeB = bin_aabb_number[k];
+            if (!IsPairInBin(shapeA, shapeB, bin_active[index], aabb_min, aabb_max, stride, body_id, family,
+                             body_active, body_collide, grid))
+                continue;
+            unsigned int s1 = shapeA < shapeB ? shapeA : shapeB;
+            unsigned int s2 = shapeA < shapeB ? shapeB : shapeA;
+            pair_shapeIDs[offset++] = ((long long)s1 << 32 | (long long)s2);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void GPU_OneLevelBroadphase(const GPU_Broadphase_Input& input, GPU_Broadphase_Output& output) {
+    const unsigned int num_shapes = input.num_shapes;
+    const unsigned int stride = input.aabb_stride;
+
+    GridInfo grid;
+    for (int k = 0; k < 3; k++) {
+        grid.bins_per_axis[k] = input.bins_per_axis[k];
+        grid.inv_bin_size[k] = input.inv_bin_size[k];
+    }
+
+    // Upload the shape and body data
+    Upload(bp_data.aabb_min, input.aabb_min, (size_t)num_shapes * stride);
+    Upload(bp_data.aabb_max, input.aabb_max, (size_t)num_shapes * stride);
+    Upload(bp_data.body_id, input.body_id, num_shapes);
+    Upload(bp_data.family, input.family, 2 * (size_t)num_shapes);
+    Upload(bp_data.body_active, input.body_active, input.num_bodies);
+    Upload(bp_data.body_collide, input.body_collide, input.num_bodies);
+
+    // Count and store the bin-shape intersections
+    Reserve(bp_data.bin_intersections, num_shapes + 1);
+    kCountBinIntersections<<<CONFIG(num_shapes + 1)>>>(num_shapes, bp_data.aabb_min(), bp_data.aabb_max(), stride,
+                                                        bp_data.body_id(), grid, bp_data.bin_intersections());
+    ExclusiveSum(bp_data.bin_intersections, bp_data.bin_offsets, num_shapes + 1);
+    unsigned int num_intersections = bp_data.bin_offsets[num_shapes];
+
+    Reserve(bp_data.bin_number_unsorted, num_intersections);
+    Reserve(bp_data.bin_aabb_number_unsorted, num_intersections);
+    Reserve(bp_data.bin_number, num_intersections);
+    Reserve(bp_data.bin_aabb_number, num_intersections);
+    if (num_intersections > 0) {
+        kStoreBinIntersections<<<CONFIG(num_shapes)>>>(num_shapes, bp_data.aabb_min(), bp_data.aabb_max(), stride,
+                                                       bp_data.body_id(), grid, bp_data.bin_offsets(),
+                                                       bp_data.bin_number_unsorted(),
+                                                       bp_data.bin_aabb_number_unsorted());
+
+        // Sort by bin index (the radix sort is stable, so shapes in a bin remain ordered by index)
+        size_t temp_bytes = 0;
+        cub::DeviceRadixSort::SortPairs(nullptr, temp_bytes, bp_data.bin_number_unsorted(), bp_data.bin_number(),
+                                        bp_data.bin_aabb_number_unsorted(), bp_data.bin_aabb_number(),
+                                        (int)num_intersections);
+        Reserve(bp_data.temp_storage, temp_bytes);
+        cub::DeviceRadixSort::SortPairs(bp_data.temp_storage(), temp_bytes, bp_data.bin_number_unsorted(),
+                                        bp_data.bin_number(), bp_data.bin_aabb_number_unsorted(),
+                                        bp_data.bin_aabb_number(), (int)num_intersections);
+    }
+
+    // Find the active bins and their start in the list of bin-shape intersections
+    unsigned int num_active_bins = 0;
+    if (num_intersections > 0) {
+        Reserve(bp_data.bin_active, num_intersections);
+        Reserve(bp_data.bin_count, num_intersections + 1);
+        Reserve(bp_data.num_active_bins, 1);
+        size_t temp_bytes = 0;
+        cub::DeviceRunLengthEncode::Encode(nullptr, temp_bytes, bp_data.bin_number(), bp_data.bin_active(),
+                                           bp_data.bin_count(), bp_data.num_active_bins(), (int)num_intersections);
+        Reserve(bp_data.temp_storage, temp_bytes);
+        cub::DeviceRunLengthEncode::Encode(bp_data.temp_storage(), temp_bytes, bp_data.bin_number(),
+                                           bp_data.bin_active(), bp_data.bin_count(), bp_data.num_active_bins(),
+                                           (int)num_intersections);
+        num_active_bins = bp_data.num_active_bins[0];
+    }
+
+    Download(*output.bin_number, bp_data.bin_number, num_intersections);
+    Download(*output.bin_aabb_number, bp_data.bin_aabb_number, num_intersections);
+
+    if (num_active_bins == 0) {
+        output.bin_active->clear();
+        output.bin_start_index->clear();
+        output.bin_num_contact->clear();
+        output.pair_shapeIDs->clear();
+        return;
+    }
+
+    cudaCheck(cudaMemset(bp_data.bin_count() + num_active_bins, 0, sizeof(unsigned int)));
+    ExclusiveSum(bp_data.bin_count, bp_data.bin_start_index, num_active_bins + 1);
+
+    // Count and store the candidate pairs in each active bin
+    Reserve(bp_data.pair_count, num_active_bins + 1);
+    kCountPairs<<<CONFIG(num_active_bins + 1)>>>(num_active_bins, bp_data.aabb_min(), bp_data.aabb_max(), stride,
+                                                 bp_data.body_id(), bp_data.family(), bp_data.body_active(),
+                                                 bp_data.body_collide(), grid, bp_data.bin_active(),
+                                                 bp_data.bin_aabb_number(), bp_data.bin_start_index(),
+                                                 bp_data.pair_count());
+    ExclusiveSum(bp_data.pair_count, bp_data.bin_num_contact, num_active_bins + 1);
+    unsigned int num_pairs = bp_data.bin_num_contact[num_active_bins];
+
+    if (num_pairs > 0) {
+        Reserve(bp_data.pair_shapeIDs, num_pairs);
+        kStorePairs<<<CONFIG(num_active_bins)>>>(num_active_bins, bp_data.aabb_min(), bp_data.aabb_max(), stride,
+                                                 bp_data.body_id(), bp_data.family(), bp_data.body_active(),
+                                                 bp_data.body_collide(), grid, bp_data.bin_active(),
+                                                 bp_data.bin_aabb_number(), bp_data.bin_start_index(),
+                                                 bp_data.bin_num_contact(), bp_data.pair_shapeIDs());
+        cudaCheck(cudaPeekAtLastError());
+    }
+
+    Download(*output.bin_active, bp_data.bin_active, num_active_bins);
+    Download(*output.bin_start_index, bp_data.bin_start_index, num_active_bins + 1);
+    Download(*output.bin_num_contact, bp_data.bin_num_contact, num_active_bins + 1);
+    Download(*output.pair_shapeIDs, bp_data.pair_shapeIDs, num_pairs);
+}
+
+}  // end namespace chrono
@@ -0,0 +1,59 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Description: GPU implementation of the one-level grid broadphase. Shape data
+// is uploaded at each call; the bin and pair arrays are computed on the device
+// and copied back to the host vectors of the collision data.
+// =============================================================================
+
+#pragma once
+
+#include <vector>
+
+#include "chrono/multicore_math/real.h"
+
+namespace chrono {
+
+/// Shape data and grid for the GPU broadphase.
+/// AABB points are read from arrays of real3 (x, y, z, followed by padding), with the specified stride.
+struct GPU_Broadphase_Input {
+    unsigned int num_shapes;      ///< number of rigid shapes
+    const real* aabb_min;         ///< shape AABB minimum points (relative to the grid origin)
+    const real* aabb_max;         ///< shape AABB maximum points (relative to the grid origin)
+    unsigned int aabb_stride;     ///< number of reals between consecutive AABB points
+    const unsigned int* body_id;  ///< body of each shape (UINT_MAX for inactive shapes)
+    const short* family;          ///< collision family group and mask of each shape (pairs of shorts)
+    unsigned int num_bodies;      ///< number of rigid bodies
+    const char* body_active;      ///< active flag of each body
+    const char* body_collide;     ///< collide flag of each body
+    int bins_per_axis[3];         ///< grid resolution
+    real inv_bin_size[3];         ///< reciprocal bin dimensions
+};
+
+/// Results of the GPU broadphase (same layout as the corresponding arrays in ChCollisionData).
+struct GPU_Broadphase_Output {
+    std::vector<unsigned int>* bin_number;       ///< sorted bin indices of all bin-shape intersections
+    std::vector<unsigned int>* bin_aabb_number;  ///< shape indices of all bin-shape intersections
+    std::vector<unsigned int>* bin_active;       ///< indices of active bins
+    std::vector<unsigned int>* bin_start_index;  ///< start of each active bin in bin_aabb_number (num_active + 1)
+    std::vector<unsigned int>* bin_num_contact;  ///< start of each active bin in pair_shapeIDs (num_active + 1)
+    std::vector<long long>* pair_shapeIDs;       ///< candidate shape pairs, grouped by active bin
+};
+
+/// Run the one-level grid broadphase on the current CUDA device.
+/// The output vectors are resized to the number of bin-shape intersections, active bins, and candidate pairs,
+/// respectively. Device storage is kept between calls and only grown.
+void GPU_OneLevelBroadphase(const GPU_Broadphase_Input& input, GPU_Broadphase_Output& output);
+
+}  // end namespace chrono
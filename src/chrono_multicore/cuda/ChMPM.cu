@@ -1118,4 +1118,258 @@ void MPM_Initialize(MPM_Settings& settings, std::vector<float>& positions) {
     cudaEventDestroy(start);
     cudaEventDestroy(stop);
 }
+
+//////========================================================================================================================================================================
+////
+// GPU-resident MPM, coupled with rigid bodies through collider shapes
+
+gpu_vector<MPM_Collider> colliders;
+gpu_vector<MPM_BodyState> body_states;
+gpu_vector<float> body_wrench;
+
+// Rotate vector v by the unit quaternion q = (e0, e1, e2, e3)
+CUDA_HOST_DEVICE static inline float3 QuatRotate(const float* q, const float3& v) {
+    const float3 u = make_float3(q[1], q[2], q[3]);
+    const float3 t = 2.0f * Cross(u, v);
+    return v + q[0] * t + Cross(u, t);
+}
+
+// Rotate vector v by the inverse of the unit quaternion q = (e0, e1, e2, e3)
+CUDA_HOST_DEVICE static inline float3 QuatRotateBack(const float* q, const float3& v) {
+    const float qc[4] = {q[0], -q[1], -q[2], -q[3]};
+    return QuatRotate(qc, v);
+}
+
+// Signed distance from point x (in the shape frame) to the collider surface, with the outward normal
+CUDA_HOST_DEVICE static float ColliderDistance(const MPM_Collider& c, const float3& x, float3& normal) {
+    switch (c.type) {
+        case MPM_SPHERE: {
+            float len = Length(x);
+            normal = len > FLT_EPSILON ? x / len : make_float3(0, 0, 1);
+            return len - c.dims[0];
+        }
+        case MPM_BOX: {
+            float3 d = make_float3(fabsf(x.x) - c.dims[0], fabsf(x.y) - c.dims[1], fabsf(x.z) - c.dims[2]);
+            if (d.x > 0 || d.y > 0 || d.z > 0) {
+                float3 o = make_float3(fmaxf(d.x, 0) * Sign(x.x), fmaxf(d.y, 0) * Sign(x.y), fmaxf(d.z, 0) * Sign(x.z));
+                float len = Length(o);
+                normal = o / len;
+                return len;
+            }
+            // Inside: push out through the closest face
+            if (d.x >= d.y && d.x >= d.z) {
+                normal = make_float3(Sign(x.x), 0, 0);
+                return d.x;
+            }
+            if (d.y >= d.z) {
+                normal = make_float3(0, Sign(x.y), 0);
+                return d.y;
+            }
+            normal = make_float3(0, 0, Sign(x.z));
+            return d.z;
+        }
+        case MPM_CYLINDER: {
+            float r = sqrtf(x.x * x.x + x.y * x.y);
+            float dr = r - c.dims[0];
+            float dz = fabsf(x.z) - c.dims[1];
+            float3 radial = r > FLT_EPSILON ? make_float3(x.x / r, x.y / r, 0) : make_float3(1, 0, 0);
+            if (dr > 0 && dz > 0) {
+                float len = sqrtf(dr * dr + dz * dz);
+                normal = (dr * radial + make_float3(0, 0, dz * Sign(x.z))) / len;
+                return len;
+            }
+            if (dr >= dz) {
+                normal = radial;
+                return dr;
+            }
+            normal = make_float3(0, 0, Sign(x.z));
+            return dz;
+        }
+    }
+    normal = make_float3(0, 0, 1);
+    return FLT_MAX;
+}
+
+CUDA_GLOBAL void kApplyGravity(const float* node_mass, float* grid_vel, float3 gravity) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < device_settings.num_mpm_nodes && node_mass[i] > 0) {
+        grid_vel[i * 3 + 0] += device_settings.dt * gravity.x;
+        grid_vel[i * 3 + 1] += device_settings.dt * gravity.y;
+        grid_vel[i * 3 + 2] += device_settings.dt * gravity.z;
+    }
+}
+
+// Enforce the non-penetration (and Coulomb friction) condition at grid nodes inside a collider and accumulate the
+// momentum exchanged with the corresponding rigid body (as a force and a torque about its center of mass).
+CUDA_GLOBAL void kGridCollide(const float* node_mass,
+                              const MPM_Collider* colliders,
+                              const MPM_BodyState* bodies,
+                              const int num_colliders,
+                              float* grid_vel,
+                              float* body_wrench) {
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= device_settings.num_mpm_nodes)
+        return;
+    const float mass = node_mass[i];
+    if (mass <= 0)
+        return;
+
+    const int3 bins = make_int3(device_settings.bins_per_axis_x, device_settings.bins_per_axis_y,
+                                device_settings.bins_per_axis_z);
+    const int3 cell = GridDecode(i, bins);
+    const float3 xn =
+        NodeLocation(cell.x, cell.y, cell.z, device_settings.bin_edge,
+                     make_float3(system_bounds.minimum[0], system_bounds.minimum[1], system_bounds.minimum[2]));
+
+    for (int k = 0; k < num_colliders; k++) {
+        const MPM_Collider& c = colliders[k];
+        const MPM_BodyState& b = bodies[c.body];
+
+        // Collider frame in the absolute frame
+        const float3 body_pos = make_float3(b.pos[0], b.pos[1], b.pos[2]);
+        const float3 shape_pos = body_pos + QuatRotate(b.rot, make_float3(c.pos[0], c.pos[1], c.pos[2]));
+        float3 n_local;
+        const float dist = ColliderDistance(c, QuatRotateBack(c.rot, QuatRotateBack(b.rot, xn - shape_pos)), n_local);
+        if (dist > 0)
+            continue;
+        const float3 n = QuatRotate(b.rot, QuatRotate(c.rot, n_local));
+
+        // Velocity of the grid node relative to the rigid body
+        const float3 r = xn - body_pos;
+        const float3 v_body = make_float3(b.lin_vel[0], b.lin_vel[1], b.lin_vel[2]) +
+                              Cross(make_float3(b.ang_vel[0], b.ang_vel[1], b.ang_vel[2]), r);
+        const float3 v = make_float3(grid_vel[i * 3 + 0], grid_vel[i * 3 + 1], grid_vel[i * 3 + 2]);
+        const float3 v_rel = v - v_body;
+        const float vn = Dot(v_rel, n);
+        if (vn >= 0)
+            break;
+
+        // Remove the approaching normal velocity and apply Coulomb friction to the tangential part
+        float3 vt = v_rel - vn * n;
+        const float vt_len = Length(vt);
+        if (vt_len <= -c.mu * vn)
+            vt = make_float3(0, 0, 0);
+        else
+            vt = vt * (1 + c.mu * vn / vt_len);
+        const float3 v_new = v_body + vt;
+
+        grid_vel[i * 3 + 0] = v_new.x;
+        grid_vel[i * 3 + 1] = v_new.y;
+        grid_vel[i * 3 + 2] = v_new.z;
+
+        const float3 force = (mass / device_settings.dt) * (v - v_new);
+        const float3 torque = Cross(r, force);
+        atomicAdd(&body_wrench[c.body * 6 + 0], force.x);
+        atomicAdd(&body_wrench[c.body * 6 + 1], force.y);
+        atomicAdd(&body_wrench[c.body * 6 + 2], force.z);
+        atomicAdd(&body_wrench[c.body * 6 + 3], torque.x);
+        atomicAdd(&body_wrench[c.body * 6 + 4], torque.y);
+        atomicAdd(&body_wrench[c.body * 6 + 5], torque.z);
+        break;
+    }
+}
+
+CUDA_GLOBAL void kAdvectMarkers(const float* vel_marker, float* pos_marker) {
+    const int p = blockIdx.x * blockDim.x + threadIdx.x;
+    if (p < device_settings.num_mpm_markers) {
+        pos_marker[p * 3 + 0] += device_settings.dt * vel_marker[p * 3 + 0];
+        pos_marker[p * 3 + 1] += device_settings.dt * vel_marker[p * 3 + 1];
+        pos_marker[p * 3 + 2] += device_settings.dt * vel_marker[p * 3 + 2];
+    }
+}
+
+void MPM_InitializeResident(MPM_Settings& settings,
+                            const std::vector<float>& positions,
+                            const std::vector<float>& velocities) {
+    std::vector<float> init_pos = positions;
+    MPM_Initialize(settings, init_pos);
+
+    vel.data_h = velocities;
+    vel.copyHostToDevice();
+
+    settings = host_settings;
+}
+
+void MPM_SetColliders(const std::vector<MPM_Collider>& shapes) {
+    colliders.data_h = shapes;
+    colliders.copyHostToDevice();
+}
+
+void MPM_StepResident(MPM_Settings& settings,
+                      const float* gravity,
+                      const std::vector<MPM_BodyState>& bodies,
+                      std::vector<float>& wrenches) {
+    cudaEventCreate(&start);
+    cudaEventCreate(&stop);
+
+    host_settings = settings;
+    cudaCheck(cudaMemcpyToSymbolAsync(device_settings, &host_settings, sizeof(MPM_Settings)));
+
+    // Grid for the current marker positions (the grid resolution is also uploaded to the device)
+    MPM_ComputeBounds();
+
+    node_mass.resize(host_settings.num_mpm_nodes);
+    node_mass = 0;
+    grid_vel.resize(host_settings.num_mpm_nodes * 3);
+    grid_vel = 0;
+
+    // Transfer marker momentum to the grid and update the deformation gradients
+    kRasterize<<<CONFIG(host_settings.num_mpm_markers)>>>(pos.data_d, vel.data_d, node_mass.data_d, grid_vel.data_d);
+    kNormalizeWeights<<<CONFIG(host_settings.num_mpm_nodes)>>>(node_mass.data_d, grid_vel.data_d);
+    kUpdateDeformationGradient<<<CONFIG(host_settings.num_mpm_markers)>>>(
+        grid_vel.data_d, pos.data_d, marker_Fe.data_d, marker_Fp.data_d, marker_plasticity.data_d, JE_JP.data_d);
+
+    // Grid velocity update (elastic forces, gravity, implicit solve)
+    old_vel_node_mpm.resize(host_settings.num_mpm_nodes * 3);
+    rhs.resize(host_settings.num_mpm_nodes * 3);
+    old_vel_node_mpm = grid_vel;
+
+    kFeHat<<<CONFIG(host_settings.num_mpm_markers)>>>(pos.data_d, marker_Fe.data_d, grid_vel.data_d,
+                                                      marker_Fe_hat.data_d);
+    kApplyForces<<<CONFIG(host_settings.num_mpm_markers)>>>(pos.data_d, marker_Fe_hat.data_d, marker_Fe.data_d,
+                                                            marker_volume.data_d, node_mass.data_d,
+                                                            marker_plasticity.data_d, PolarR.data_d, PolarS.data_d,
+                                                            grid_vel.data_d);
+    kApplyGravity<<<CONFIG(host_settings.num_mpm_nodes)>>>(node_mass.data_d, grid_vel.data_d,
+                                                           make_float3(gravity[0], gravity[1], gravity[2]));
+    kRhs<<<CONFIG(host_settings.num_mpm_nodes)>>>(node_mass.data_d, grid_vel.data_d, rhs.data_d);
+
+    delta_v.resize(host_settings.num_mpm_nodes * 3);
+    delta_v = old_vel_node_mpm;
+    MPM_BBSolver(rhs, delta_v);
+    kIncrementVelocity<<<CONFIG(host_settings.num_mpm_nodes)>>>(delta_v.data_d, old_vel_node_mpm.data_d,
+                                                                grid_vel.data_d);
+
+    // Rigid body coupling: grid boundary conditions and momentum exchange
+    wrenches.assign(bodies.size() * 6, 0.0f);
+    if (bodies.size() > 0 && colliders.size() > 0) {
+        body_states.data_h = bodies;
+        body_states.copyHostToDevice();
+        body_wrench.resize(bodies.size() * 6);
+        body_wrench = 0;
+        kGridCollide<<<CONFIG(host_settings.num_mpm_nodes)>>>(node_mass.data_d, colliders.data_d, body_states.data_d,
+                                                              (int)colliders.data_h.size(), grid_vel.data_d,
+                                                              body_wrench.data_d);
+        cudaMemcpy(wrenches.data(), body_wrench.data_d, bodies.size() * 6 * sizeof(float), cudaMemcpyDeviceToHost);
+    }
+
+    // Transfer grid velocities back to the markers and advect them
+    kUpdateParticleVelocity<<<CONFIG(host_settings.num_mpm_markers)>>>(grid_vel.data_d, old_vel_node_mpm.data_d,
+                                                                       pos.data_d, vel.data_d);
+    kAdvectMarkers<<<CONFIG(host_settings.num_mpm_markers)>>>(vel.data_d, pos.data_d);
+    cudaCheck(cudaPeekAtLastError());
+    cudaCheck(cudaDeviceSynchronize());
+
+    settings = host_settings;
+
+    cudaEventDestroy(start);
+    cudaEventDestroy(stop);
+}
+
+void MPM_GetMarkers(std::vector<float>& positions, std::vector<float>& velocities) {
+    pos.copyDeviceToHost();
+    vel.copyDeviceToHost();
+    positions.assign(pos.data_h.begin(), pos.data_h.begin() + host_settings.num_mpm_markers * 3);
+    velocities.assign(vel.data_h.begin(), vel.data_h.begin() + host_settings.num_mpm_markers * 3);
+}
 }
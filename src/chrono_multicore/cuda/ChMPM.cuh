@@ -28,4 +28,17 @@ void MPM_UpdateDeformationGradient(MPM_Settings& settings,
                                    std::vector<float>& positions,
                                    std::vector<float>& velocities,
                                    std::vector<float>& jejp);
+
+// GPU-resident MPM: the markers stay on the device between steps; only the states of the coupled rigid bodies and
+// the wrenches applied on them are exchanged with the host.
+
+void MPM_InitializeResident(MPM_Settings& settings,
+                            const std::vector<float>& positions,
+                            const std::vector<float>& velocities);
+void MPM_SetColliders(const std::vector<MPM_Collider>& shapes);
+void MPM_StepResident(MPM_Settings& settings,
+                      const float* gravity,
+                      const std::vector<MPM_BodyState>& bodies,
+                      std::vector<float>& wrenches);
+void MPM_GetMarkers(std::vector<float>& positions, std::vector<float>& velocities);
 }
@@ -0,0 +1,715 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Description: GPU implementation of the APGD and BB solvers for the NSC
+// problem. The constraint Jacobian and the multiplier vectors are kept on the
+// device for the whole solve; only scalars are read back at each iteration.
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include "chrono_multicore/cuda/ChSolverGPU.cuh"
+#include "chrono_multicore/cuda/ChCudaHelper.cuh"
+#include "chrono_multicore/cuda/ChGPUVector.cuh"
+#include <cub/cub.cuh>
+
+namespace chrono {
+
+// Number of blocks used for the first stage of the dot products
+#define NUM_DOT_BLOCKS 256
+
+// Maximum number of work vectors used by a solver
+#define NUM_WORK_VECTORS 9
+
+// Maximum number of dot products fetched at once
+#define NUM_SCALARS 8
+
+// Problem data and work vectors, kept on the device between solves (the device storage is only grown)
+struct GPU_NSC_Data {
+    unsigned int num_constraints;
+    unsigned int num_dof;
+    unsigned int num_contacts;
+    unsigned int num_unilaterals;
+    SolverMode solver_mode;
+    SolverMode local_solver_mode;
+
+    gpu_vector<unsigned int> D_T_offsets, D_T_columns;
+    gpu_vector<unsigned int> M_invD_offsets, M_invD_columns;
+    gpu_vector<real> D_T_values, M_invD_values;
+    gpu_vector<real> E, friction, cohesion;
+    gpu_vector<real> r;
+
+    gpu_vector<real> x_masked, dof_tmp;  // Schur product temporaries
+    gpu_vector<real> partial_sums;       // block sums of the dot products
+    gpu_vector<real> scalars;            // results of the dot products
+    real host_scalars[NUM_SCALARS];
+
+    gpu_vector<real> work[NUM_WORK_VECTORS];
+};
+
+static GPU_NSC_Data nsc_data;
+
+template <typename T>
+static void Reserve(gpu_vector<T>& vec, size_t size) {
+    if (vec.size() < size)
+        vec.resize(size);
+}
+
+template <typename T>
+static void Upload(gpu_vector<T>& vec, const std::vector<T>& host) {
+    if (host.empty())
+        return;
+    Reserve(vec, host.size());
+    cudaCheck(cudaMemcpy(vec(), host.data(), host.size() * sizeof(T), cudaMemcpyHostToDevice));
+}
+
+// -----------------------------------------------------------------------------
+
+// Check whether a constraint takes part in the current solve (bilateral constraints always do)
+CUDA_DEVICE inline bool IsActive(unsigned int index,
+                                 unsigned int num_contacts,
+                                 unsigned int num_unilaterals,
+                                 SolverMode local_solver_mode) {
+    if (index >= num_unilaterals)
+        return true;
+    switch (local_solver_mode) {
+        case SolverMode::NORMAL:
+            return index < num_contacts;
+        case SolverMode::SLIDING:
+            return index < 3 * num_contacts;
+        case SolverMode::SPINNING:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// y = A * x, for a matrix A in compressed row format (one thread per row)
+CUDA_GLOBAL void kSpMV(unsigned int num_rows,
+                       const unsigned int* offsets,
+                       const unsigned int* columns,
+                       const real* values,
+                       const real* x,
+                       real* y) {
+    unsigned int row = blockIdx.x * blockDim.x + threadIdx.x;
+    if (row >= num_rows)
+        return;
+    real sum = 0;
+    for (unsigned int k = offsets[row]; k < offsets[row + 1]; k++)
+        sum += values[k] * x[columns[k]];
+    y[row] = sum;
+}
+
+// Zero the entries of x corresponding to constraints not solved for
+CUDA_GLOBAL void kMask(unsigned int num_constraints,
+                       unsigned int num_contacts,
+                       unsigned int num_unilaterals,
+                       SolverMode local_solver_mode,
+                       const real* x,
+                       real* x_masked) {
+    unsigned int index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index >= num_constraints)
+        return;
+    x_masked[index] = IsActive(index, num_contacts, num_unilaterals, local_solver_mode) ? x[index] : 0;
+}
+
+// Add the compliance term to the Schur product and zero the entries of constraints not solved for
+CUDA_GLOBAL void kSchurCompliance(unsigned int num_constraints,
+                                  unsigned int num_contacts,
+                                  unsigned int num_unilaterals,
+                                  SolverMode local_solver_mode,
+                                  const real* E,
+                                  const real* x_masked,
+                                  real* output) {
+    unsigned int index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index >= num_constraints)
+        return;
+    if (IsActive(index, num_contacts, num_unilaterals, local_solver_mode))
+        output[index] += E[index] * x_masked[index];
+    else
+        output[index] = 0;
+}
+
+// output = a * x + b * y
+CUDA_GLOBAL void kLinear(unsigned int size, real a, const real* x, real b, const real* y, real* output) {
+    unsigned int index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index >= size)
+        return;
+    output[index] = a * x[index] + b * y[index];
+}
+
+// First stage of a dot product: one partial sum per block
+CUDA_GLOBAL void kDotPartial(unsigned int size, const real* x, const real* y, real* partial_sums) {
+    typedef cub::BlockReduce<real, num_threads_per_block> BlockReduce;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+
+    real sum = 0;
+    for (unsigned int index = blockIdx.x * blockDim.x + threadIdx.x; index < size; index += blockDim.x * gridDim.x)
+        sum += x[index] * y[index];
+    real block_sum = BlockReduce(temp_storage).Sum(sum);
+    if (threadIdx.x == 0)
+        partial_sums[blockIdx.x] = block_sum;
+}
+
+// Second stage of a dot product: sum of the partial sums (single block)
+CUDA_GLOBAL void kDotFinal(unsigned int num_partials, const real* partial_sums, real* result) {
+    typedef cub::BlockReduce<real, num_threads_per_block> BlockReduce;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+
+    real sum = 0;
+    for (unsigned int index = threadIdx.x; index < num_partials; index += blockDim.x)
+        sum += partial_sums[index];
+    real block_sum = BlockReduce(temp_storage).Sum(sum);
+    if (threadIdx.x == 0)
+        *result = block_sum;
+}
+
+// -----------------------------------------------------------------------------
+
+// Projection onto the friction cone (same as Cone_generalized_rigid)
+CUDA_DEVICE inline void ConeGeneralized(real& gamma_n, real& gamma_u, real& gamma_v, real mu) {
+    real f_tang = sqrt(gamma_u * gamma_u + gamma_v * gamma_v);
+
+    // inside upper cone? keep untouched!
+    if (f_tang < (mu * gamma_n))
+        return;
+
+    // inside lower cone? reset  normal,u,v to zero!
+    if ((f_tang) < -(1 / mu) * gamma_n || (fabs(gamma_n) < 10e-15)) {
+        gamma_n = 0;
+        gamma_u = 0;
+        gamma_v = 0;
+        return;
+    }
+
+    // remaining case: project orthogonally to generator segment of upper cone
+    gamma_n = (f_tang * mu + gamma_n) / (mu * mu + 1);
+    real tproj_div_t = (gamma_n * mu) / f_tang;
+    gamma_u *= tproj_div_t;
+    gamma_v *= tproj_div_t;
+}
+
+// Projection of the normal impulse (same as ChConstraintRigidRigid::func_Project_normal)
+CUDA_DEVICE inline void ProjectNormal(unsigned int index,
+                                      unsigned int nc,
+                                      SolverMode solver_mode,
+                                      const real* cohesion,
+                                      real* gamma) {
+    real gamma_x = gamma[index];
+    real coh = cohesion[index];
+
+    gamma[index] = (gamma_x < -coh) ? -coh : gamma_x;
+    switch (solver_mode) {
+        case SolverMode::SLIDING:
+            gamma[nc + index * 2 + 0] = 0;
+            gamma[nc + index * 2 + 1] = 0;
+            break;
+        case SolverMode::SPINNING:
+            gamma[nc + index * 2 + 0] = 0;
+            gamma[nc + index * 2 + 1] = 0;
+            gamma[3 * nc + index * 3 + 0] = 0;
+            gamma[3 * nc + index * 3 + 1] = 0;
+            gamma[3 * nc + index * 3 + 2] = 0;
+            break;
+        default:
+            break;
+    }
+}
+
+// Projection of the sliding friction impulses (same as ChConstraintRigidRigid::func_Project_sliding)
+CUDA_DEVICE inline void ProjectSliding(unsigned int index,
+                                       unsigned int nc,
+                                       const real* friction,
+                                       const real* cohesion,
+                                       real* gam) {
+    real gamma_x = gam[index];
+    real gamma_y = gam[nc + index * 2 + 0];
+    real gamma_z = gam[nc + index * 2 + 1];
+
+    real coh = cohesion[index];
+    real mu = friction[3 * index + 0];
+
+    if (mu == 0) {
+        gam[index] = (gamma_x < -coh) ? -coh : gamma_x;
+        gam[nc + index * 2 + 0] = 0;
+        gam[nc + index * 2 + 1] = 0;
+        return;
+    }
+
+    gamma_x += coh;
+    ConeGeneralized(gamma_x, gamma_y, gamma_z, mu);
+    gam[index] = gamma_x - coh;
+    gam[nc + index * 2 + 0] = gamma_y;
+    gam[nc + index * 2 + 1] = gamma_z;
+}
+
+// Projection of the rolling and spinning friction impulses (same as ChConstraintRigidRigid::func_Project_spinning)
+CUDA_DEVICE inline void ProjectSpinning(unsigned int index, unsigned int nc, const real* friction, real* gam) {
+    real rollingfriction = friction[3 * index + 1];
+    real spinningfriction = friction[3 * index + 2];
+
+    real f_n = gam[index];
+    real t_n = gam[3 * nc + index * 3 + 0];
+    real t_u = gam[3 * nc + index * 3 + 1];
+    real t_v = gam[3 * nc + index * 3 + 2];
+
+    real t_tang = sqrt(t_v * t_v + t_u * t_u);
+    real t_sptang = fabs(t_n);
+
+    if (spinningfriction) {
+        if (t_sptang < spinningfriction * f_n) {
+            // inside upper cone? keep untouched!
+        } else {
+            // inside lower cone? reset  normal,u,v to zero!
+            if ((t_sptang < -(1 / spinningfriction) * f_n) || (fabs(f_n) < 10e-15)) {
+                gam[index] = 0;
+                gam[3 * nc + index * 3 + 0] = 0;
+            } else {
+                // remaining case: project orthogonally to generator segment of upper cone
+                real f_n_proj = (t_sptang * spinningfriction + f_n) / (spinningfriction * spinningfriction + 1);
+                real t_tang_proj = f_n_proj * spinningfriction;
+                real tproj_div_t = t_tang_proj / t_sptang;
+                real t_n_proj = tproj_div_t * t_n;
+
+                gam[index] = f_n_proj;
+                gam[3 * nc + index * 3 + 0] = t_n_proj;
+            }
+        }
+    }
+
+    if (!rollingfriction) {
+        gam[3 * nc + index * 3 + 1] = 0;
+        gam[3 * nc + index * 3 + 2] = 0;
+
+        if (f_n < 0)
+            gam[index] = 0;
+        return;
+    }
+    if (t_tang < rollingfriction * f_n)
+        return;
+
+    if ((t_tang < -(1 / rollingfriction) * f_n) || (fabs(f_n) < 10e-15)) {
+        gam[index] = 0;
+        gam[3 * nc + index * 3 + 1] = 0;
+        gam[3 * nc + index * 3 + 2] = 0;
+        return;
+    }
+    real f_n_proj = (t_tang * rollingfriction + f_n) / (rollingfriction * rollingfriction + 1);
+    real t_tang_proj = f_n_proj * rollingfriction;
+    real tproj_div_t = t_tang_proj / t_tang;
+
+    gam[index] = f_n_proj;
+    gam[3 * nc + index * 3 + 1] = tproj_div_t * t_u;
+    gam[3 * nc + index * 3 + 2] = tproj_div_t * t_v;
+}
+
+// Project the rigid contact impulses (one thread per contact)
+CUDA_GLOBAL void kProject(unsigned int num_contacts,
+                          SolverMode solver_mode,
+                          SolverMode local_solver_mode,
+                          const real* friction,
+                          const real* cohesion,
+                          real* gamma) {
+    unsigned int index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index >= num_contacts)
+        return;
+    switch (local_solver_mode) {
+        case SolverMode::NORMAL:
+            ProjectNormal(index, num_contacts, solver_mode, cohesion, gamma);
+            break;
+        case SolverMode::SLIDING:
+            ProjectSliding(index, num_contacts, friction, cohesion, gamma);
+            break;
+        case SolverMode::SPINNING:
+            ProjectSliding(index, num_contacts, friction, cohesion, gamma);
+            ProjectSpinning(index, num_contacts, friction, gamma);
+            break;
+        default:
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Upload the problem data, the right-hand side, and the initial guess (in the first work vector)
+static void Setup(const GPU_NSC_Problem& problem, const std::vector<real>& r, const std::vector<real>& gamma) {
+    GPU_NSC_Data& d = nsc_data;
+    d.num_constraints = problem.num_constraints;
+    d.num_dof = problem.num_dof;
+    d.num_contacts = problem.num_contacts;
+    d.num_unilaterals = problem.num_unilaterals;
+    d.solver_mode = problem.solver_mode;
+    d.local_solver_mode = problem.local_solver_mode;
+
+    Upload(d.D_T_offsets, problem.D_T_offsets);
+    Upload(d.D_T_columns, problem.D_T_columns);
+    Upload(d.D_T_values, problem.D_T_values);
+    Upload(d.M_invD_offsets, problem.M_invD_offsets);
+    Upload(d.M_invD_columns, problem.M_invD_columns);
+    Upload(d.M_invD_values, problem.M_invD_values);
+    Upload(d.E, problem.E);
+    Upload(d.friction, problem.friction);
+    Upload(d.cohesion, problem.cohesion);
+    Upload(d.r, r);
+
+    Reserve(d.x_masked, d.num_constraints);
+    Reserve(d.dof_tmp, std::max(d.num_dof, 1u));
+    Reserve(d.partial_sums, NUM_DOT_BLOCKS);
+    Reserve(d.scalars, NUM_SCALARS);
+    for (int k = 0; k < NUM_WORK_VECTORS; k++)
+        Reserve(d.work[k], d.num_constraints);
+
+    Upload(d.work[0], gamma);
+}
+
+static void Download(const real* x, std::vector<real>& host) {
+    host.resize(nsc_data.num_constraints);
+    cudaCheck(cudaMemcpy(host.data(), x, host.size() * sizeof(real), cudaMemcpyDeviceToHost));
+}
+
+// output = N * x + E * x, restricted to the constraints solved for
+static void SchurProduct(const real* x, real* output) {
+    GPU_NSC_Data& d = nsc_data;
+    kMask<<<CONFIG(d.num_constraints)>>>(d.num_constraints, d.num_contacts, d.num_unilaterals, d.local_solver_mode, x,
+                                         d.x_masked());
+    if (d.num_dof > 0) {
+        kSpMV<<<CONFIG(d.num_dof)>>>(d.num_dof, d.M_invD_offsets(), d.M_invD_columns(), d.M_invD_values(),
+                                     d.x_masked(), d.dof_tmp());
+    }
+    kSpMV<<<CONFIG(d.num_constraints)>>>(d.num_constraints, d.D_T_offsets(), d.D_T_columns(), d.D_T_values(),
+                                         d.dof_tmp(), output);
+    kSchurCompliance<<<CONFIG(d.num_constraints)>>>(d.num_constraints, d.num_contacts, d.num_unilaterals,
+                                                    d.local_solver_mode, d.E(), d.x_masked(), output);
+}
+
+static void Project(real* x) {
+    GPU_NSC_Data& d = nsc_data;
+    if (d.num_contacts == 0)
+        return;
+    kProject<<<CONFIG(d.num_contacts)>>>(d.num_contacts, d.solver_mode, d.local_solver_mode, d.friction(),
+                                         d.cohesion(), x);
+}
+
+// output = a * x + b * y
+static void Linear(real a, const real* x, real b, const real* y, real* output) {
+    kLinear<<<CONFIG(nsc_data.num_constraints)>>>(nsc_data.num_constraints, a, x, b, y, output);
+}
+
+static void Copy(const real* x, real* output) {
+    cudaCheck(cudaMemcpy(output, x, nsc_data.num_constraints * sizeof(real), cudaMemcpyDeviceToDevice));
+}
+
+// Compute (x, y) into the specified scalar slot (read back with FetchScalars)
+static void Dot(const real* x, const real* y, int slot) {
+    GPU_NSC_Data& d = nsc_data;
+    unsigned int num_blocks = std::min((unsigned int)NUM_DOT_BLOCKS, (unsigned int)BLOCKS(d.num_constraints));
+    kDotPartial<<<num_blocks, num_threads_per_block>>>(d.num_constraints, x, y, d.partial_sums());
+    kDotFinal<<<1, num_threads_per_block>>>(num_blocks, d.partial_sums(), d.scalars() + slot);
+}
+
+// Read back the first 'count' scalar slots
+static const real* FetchScalars(int count) {
+    cudaCheck(cudaMemcpy(nsc_data.host_scalars, nsc_data.scalars(), count * sizeof(real), cudaMemcpyDeviceToHost));
+    return nsc_data.host_scalars;
+}
+
+// -----------------------------------------------------------------------------
+
+unsigned int GPU_SolveAPGD(const GPU_NSC_Problem& problem,
+                           GPU_Solve_Info& info,
+                           const std::vector<real>& r_host,
+                           std::vector<real>& gamma_host) {
+    info.residual_hist.clear();
+    info.objective_hist.clear();
+
+    unsigned int size = problem.num_constraints;
+    if (size == 0)
+        return 0;
+
+    Setup(problem, r_host, gamma_host);
+
+    const real* r = nsc_data.r();
+    real* gamma = nsc_data.work[0]();
+    real* gamma_hat = nsc_data.work[1]();
+    real* gamma_new = nsc_data.work[2]();
+    real* y = nsc_data.work[3]();
+    real* g = nsc_data.work[4]();
+    real* temp = nsc_data.work[5]();
+    real* N_gamma_new = nsc_data.work[6]();
+
+    real residual = 10e30;
+    real objective_value = 0;
+    real g_diff = 1.0 / pow(size, 2.0);
+    real L = info.step_length;
+    real t = 1.0 / L;
+    real theta = 1;
+    real theta_new = theta;
+    real beta_new = 0.0;
+
+    Copy(gamma, y);
+    Copy(gamma, gamma_hat);
+
+    unsigned int it;
+    for (it = 0; it < info.max_iterations; it++) {
+        SchurProduct(y, temp);
+        Linear(1, temp, -1, r, g);
+        Linear(1, y, -t, g, gamma_new);
+        Project(gamma_new);
+        SchurProduct(gamma_new, N_gamma_new);
+        Dot(y, temp, 0);
+        Dot(y, r, 1);
+        Linear(1, gamma_new, -1, y, temp);
+        Dot(gamma_new, N_gamma_new, 2);
+        Dot(gamma_new, r, 3);
+        Dot(g, temp, 4);
+        Dot(temp, temp, 5);
+        const real* s = FetchScalars(6);
+        real obj2 = 0.5 * s[0] - s[1];
+        real obj1 = 0.5 * s[2] - s[3];
+        real g_temp = s[4];
+        real temp_temp = s[5];
+
+        while (obj1 > obj2 + g_temp + 0.5 * L * temp_temp) {
+            L = 2.0 * L;
+            t = 1.0 / L;
+            Linear(1, y, -t, g, gamma_new);
+            Project(gamma_new);
+            SchurProduct(gamma_new, N_gamma_new);
+            Linear(1, gamma_new, -1, y, temp);
+            Dot(gamma_new, N_gamma_new, 0);
+            Dot(gamma_new, r, 1);
+            Dot(g, temp, 2);
+            Dot(temp, temp, 3);
+            s = FetchScalars(4);
+            obj1 = 0.5 * s[0] - s[1];
+            g_temp = s[2];
+            temp_temp = s[3];
+        }
+        theta_new = (-pow(theta, 2.0) + theta * sqrt(pow(theta, 2.0) + 4.0)) / 2.0;
+        beta_new = theta * (1.0 - theta) / (pow(theta, 2.0) + theta_new);
+
+        Linear(1, gamma_new, -1, gamma, temp);
+        Linear(beta_new, temp, 1, gamma_new, y);
+        Dot(g, temp, 0);
+
+        // Compute the residual (projected gradient)
+        Linear(1, N_gamma_new, -1, r, temp);
+        Linear(1, gamma_new, -g_diff, temp, temp);
+        Project(temp);
+        Linear(1 / g_diff, gamma_new, -1 / g_diff, temp, temp);
+        Dot(temp, temp, 1);
+        s = FetchScalars(2);
+        real dot_g_temp = s[0];
+        real res = sqrt(s[1]);
+
+        if (res < residual) {
+            residual = res;
+            Copy(gamma_new, gamma_hat);
+            objective_value = obj1;
+        }
+
+        info.residual_hist.push_back(residual);
+        info.objective_hist.push_back(objective_value);
+
+        if (info.test_objective) {
+            if (objective_value <= info.tolerance_objective)
+                break;
+        } else {
+            if (residual < info.tol_speed)
+                break;
+        }
+
+        if (dot_g_temp > 0) {
+            Copy(gamma_new, y);
+            theta_new = 1.0;
+        }
+
+        L = 0.9 * L;
+        t = 1.0 / L;
+
+        theta = theta_new;
+        Copy(gamma_new, gamma);
+    }
+
+    cudaCheck(cudaPeekAtLastError());
+
+    info.step_length = L;
+    info.residual = residual;
+    info.objective_value = objective_value;
+    Download(gamma_hat, gamma_host);
+
+    return it;
+}
+
+unsigned int GPU_SolveBB(const GPU_NSC_Problem& problem,
+                         GPU_Solve_Info& info,
+                         const std::vector<real>& r_host,
+                         std::vector<real>& gamma_host) {
+    info.residual_hist.clear();
+    info.objective_hist.clear();
+
+    unsigned int size = problem.num_constraints;
+    if (size == 0)
+        return 0;
+
+    Setup(problem, r_host, gamma_host);
+
+    const real* r = nsc_data.r();
+    real* ml = nsc_data.work[0]();
+    real* mg = nsc_data.work[1]();
+    real* mg_p = nsc_data.work[2]();
+    real* ml_candidate = nsc_data.work[3]();
+    real* ms = nsc_data.work[4]();
+    real* my = nsc_data.work[5]();
+    real* mdir = nsc_data.work[6]();
+    real* ml_p = nsc_data.work[7]();
+    real* temp = nsc_data.work[8]();
+
+    // Tuning of the spectral gradient search
+    real a_min = 1e-13;
+    real a_max = 1e13;
+    real sigma_min = 0.1;
+    real sigma_max = 0.9;
+
+    real alpha = info.step_length;
+    real gmma = 1e-4;
+    real gdiff = 1.0 / pow(size, 2.0);
+    real neg_BB1_fallback = 0.11;
+    real neg_BB2_fallback = 0.12;
+    real lastgoodres = 10e30;
+    real objective_value = 0;
+
+    Copy(ml, ml_candidate);
+    SchurProduct(ml, temp);
+    Linear(1, temp, -1, r, mg);
+    Copy(mg, mg_p);
+
+    real mf_p = 0;
+    real mf = 1e29;
+    int n_armijo = 10;
+    int max_armijo_backtrace = 3;
+    std::vector<real> f_hist;
+
+    unsigned int it;
+    for (it = 0; it < info.max_iterations; it++) {
+        Linear(1, ml, -alpha, mg, temp);
+        Project(temp);
+        Linear(1, temp, -1, ml, mdir);
+
+        Dot(mdir, mg, 0);
+        real dTg = FetchScalars(1)[0];
+        real lambda = 1.0;
+        int n_backtracks = 0;
+        bool armijo_repeat = true;
+
+        while (armijo_repeat) {
+            Linear(1, ml, lambda, mdir, ml_p);
+
+            SchurProduct(ml_p, temp);
+            Linear(1, temp, -1, r, mg_p);
+            Dot(ml_p, temp, 0);
+            Dot(ml_p, r, 1);
+            const real* s = FetchScalars(2);
+            mf_p = 0.5 * s[0] - s[1];
+
+            f_hist.push_back(mf_p);
+
+            real max_compare = 10e29;
+            for (int h = 1; h <= std::min((int)it, n_armijo); h++) {
+                real compare = f_hist[it - h] + gmma * lambda * dTg;
+                if (compare > max_compare)
+                    max_compare = compare;
+            }
+            if (mf_p > max_compare) {
+                armijo_repeat = true;
+                if (it > 0)
+                    mf = f_hist[it - 1];
+                real lambdanew = -lambda * lambda * dTg / (2 * (mf_p - mf - lambda * dTg));
+                lambda = std::max(sigma_min * lambda, std::min(sigma_max * lambda, lambdanew));
+            } else {
+                armijo_repeat = false;
+            }
+            n_backtracks = n_backtracks + 1;
+            if (n_backtracks > max_armijo_backtrace)
+                armijo_repeat = false;
+        }
+
+        Linear(1, ml_p, -1, ml, ms);
+        Linear(1, mg_p, -1, mg, my);
+        Copy(ml_p, ml);
+        Copy(mg_p, mg);
+
+        // Dot products for the BB step length and for the residual (projected gradient), read back together
+        if (it % 2 == 0) {
+            Dot(ms, ms, 0);
+            Dot(ms, my, 1);
+        } else {
+            Dot(ms, my, 0);
+            Dot(my, my, 1);
+        }
+        Linear(1, ml, -gdiff, mg, temp);
+        Project(temp);
+        Linear(-1 / gdiff, ml, 1 / gdiff, temp, temp);
+        Dot(temp, temp, 2);
+        const real* s = FetchScalars(3);
+
+        if (it % 2 == 0) {
+            real sDs = s[0];
+            real sy = s[1];
+            if (sy <= 0) {
+                alpha = neg_BB1_fallback;
+            } else {
+                alpha = std::min(a_max, std::max(a_min, sDs / sy));
+            }
+        } else {
+            real sy = s[0];
+            real yDy = s[1];
+            if (sy <= 0) {
+                alpha = neg_BB2_fallback;
+            } else {
+                alpha = std::min(a_max, std::max(a_min, sy / yDy));
+            }
+        }
+
+        real g_proj_norm = sqrt(s[2]);
+        if (g_proj_norm < lastgoodres) {
+            lastgoodres = g_proj_norm;
+            objective_value = mf_p;
+            Copy(ml, ml_candidate);
+        }
+
+        info.residual_hist.push_back(lastgoodres);
+        info.objective_hist.push_back(objective_value);
+
+        if (info.test_objective) {
+            if (objective_value <= info.tolerance_objective)
+                break;
+        } else {
+            if (lastgoodres < info.tol_speed)
+                break;
+        }
+    }
+
+    cudaCheck(cudaPeekAtLastError());
+
+    info.step_length = alpha;
+    info.residual = lastgoodres;
+    info.objective_value = objective_value;
+    Download(ml_candidate, gamma_host);
+
+    return it;
+}
+
+}  // end namespace chrono
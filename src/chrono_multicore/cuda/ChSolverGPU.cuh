@@ -0,0 +1,77 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Description: GPU implementation of the APGD and BB solvers for the NSC
+// problem. The constraint Jacobian and the multiplier vectors are kept on the
+// device for the whole solve; only scalars are read back at each iteration.
+// =============================================================================
+
+#pragma once
+
+#include <vector>
+
+#include "chrono/multicore_math/real.h"
+#include "chrono_multicore/ChMulticoreDefines.h"
+
+namespace chrono {
+
+/// NSC problem data for the GPU solvers (sparse matrices in compressed row format).
+struct GPU_NSC_Problem {
+    unsigned int num_constraints;  ///< number of constraints (size of the multiplier vector)
+    unsigned int num_dof;          ///< number of degrees of freedom
+    unsigned int num_contacts;     ///< number of rigid contacts
+    unsigned int num_unilaterals;  ///< number of unilateral constraints (the bilateral constraints follow)
+    SolverMode solver_mode;        ///< solver mode (layout of the unilateral constraints)
+    SolverMode local_solver_mode;  ///< constraints solved for in the current solve
+
+    std::vector<unsigned int> D_T_offsets;     ///< D_T (num_constraints x num_dof) row offsets
+    std::vector<unsigned int> D_T_columns;     ///< D_T column indices
+    std::vector<real> D_T_values;              ///< D_T values
+    std::vector<unsigned int> M_invD_offsets;  ///< M_invD (num_dof x num_constraints) row offsets
+    std::vector<unsigned int> M_invD_columns;  ///< M_invD column indices
+    std::vector<real> M_invD_values;           ///< M_invD values
+
+    std::vector<real> E;         ///< diagonal compliance
+    std::vector<real> friction;  ///< sliding, rolling, and spinning friction coefficients of each contact
+    std::vector<real> cohesion;  ///< cohesion of each contact
+};
+
+/// Settings and results of a GPU solve.
+struct GPU_Solve_Info {
+    unsigned int max_iterations;       ///< maximum number of iterations
+    real tol_speed;                    ///< tolerance on the residual
+    bool test_objective;               ///< stop on the objective value instead of the residual
+    real tolerance_objective;          ///< tolerance on the objective value
+    real step_length;                  ///< [in/out] step length (APGD: Lipschitz estimate L, BB: alpha)
+    real residual;                     ///< [out] residual of the solution
+    real objective_value;              ///< [out] objective value of the solution
+    std::vector<real> residual_hist;   ///< [out] residual at each iteration
+    std::vector<real> objective_hist;  ///< [out] objective value at each iteration
+};
+
+/// Solve the NSC problem with the APGD method, with right-hand side r and initial guess gamma.
+/// Return the number of iterations performed; gamma is overwritten with the solution.
+unsigned int GPU_SolveAPGD(const GPU_NSC_Problem& problem,
+                           GPU_Solve_Info& info,
+                           const std::vector<real>& r,
+                           std::vector<real>& gamma);
+
+/// Solve the NSC problem with the Barzilai-Borwein method, with right-hand side r and initial guess gamma.
+/// Return the number of iterations performed; gamma is overwritten with the solution.
+unsigned int GPU_SolveBB(const GPU_NSC_Problem& problem,
+                         GPU_Solve_Info& info,
+                         const std::vector<real>& r,
+                         std::vector<real>& gamma);
+
+}  // end namespace chrono
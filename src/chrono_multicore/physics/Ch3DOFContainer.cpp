@@ -30,6 +30,7 @@ Ch3DOFContainer::Ch3DOFContainer()
     : data_manager(nullptr),
       kernel_radius(.04),
       collision_envelope(0),
+      verlet_skin(0),
       contact_recovery_speed(10),
       contact_cohesion(0),
       contact_compliance(0),
@@ -99,6 +99,7 @@ class CH_MULTICORE_API Ch3DOFContainer : public ChPhysicsItem {
 
     real kernel_radius;
     real collision_envelope;
+    real verlet_skin;  // skin distance for reusing the neighbor lists across steps (0: rebuild at each step)
     real contact_recovery_speed;  // The speed at which 'rigid' fluid  bodies resolve contact
     real contact_cohesion;
     real contact_compliance;
@@ -143,6 +144,7 @@ class CH_MULTICORE_API ChFluidContainer : public Ch3DOFContainer {
     virtual void Setup3DOF(int start_constraint) override;
     virtual void Initialize() override;
     virtual void PreSolve() override;
+    void ComputeKernels();
     void Density_Fluid();
     void Density_FluidMPM();
     void DensityConstraint_FluidMPM();
@@ -256,6 +258,73 @@ class CH_MULTICORE_API ChParticleContainer : public Ch3DOFContainer {
     uint body_offset;
 };
 
+/// Container of MPM markers resident on the GPU, two-way coupled with the rigid bodies of the system.
+/// The markers are uploaded once, at initialization, and stay on the device; they do not add degrees of freedom to
+/// the (CPU) rigid body solver. The coupling is done through collider shapes attached to rigid bodies: at each step,
+/// only the states of the coupled bodies are sent to the device and only the resulting wrenches are read back.
+/// The MPM step runs concurrently with the host-side collision detection and rigid solve, and its wrenches are
+/// applied to the bodies at the next step (explicit, one-step lagged coupling).
+/// Requires Chrono::Multicore built with CUDA support; otherwise the markers do not move.
+class CH_MULTICORE_API ChMPMContainer : public Ch3DOFContainer {
+  public:
+    ChMPMContainer();
+    ~ChMPMContainer();
+
+    /// Add MPM markers. Markers can only be added before the system is initialized.
+    void AddMarkers(const std::vector<real3>& positions, const std::vector<real3>& velocities);
+
+    /// Attach a collider shape to the specified rigid body. The shape is given in the body frame, with dimensions
+    /// (sphere: radius; box: half-lengths; cylinder: radius and half-length along its Z axis).
+    void AddCollider(std::shared_ptr<ChBody> body,
+                     MPM_ColliderType type,
+                     const real3& dims,
+                     const real3& pos = real3(0),
+                     const quaternion& rot = quaternion(1, 0, 0, 0),
+                     real friction = 0.5);
+
+    /// Get the number of MPM markers.
+    uint GetNumMarkers() const { return (uint)(init_pos.size() / 3); }
+
+    /// Download the current marker positions and velocities from the device (synchronizes with the MPM step).
+    void GetMarkers(std::vector<real3>& positions, std::vector<real3>& velocities);
+
+    virtual void Initialize() override;
+    virtual void Update3DOF(double ChTime) override;
+    virtual void UpdatePosition(double ChTime) override;
+    virtual real3 GetBodyContactForce(std::shared_ptr<ChBody> body) override;
+    virtual real3 GetBodyContactTorque(std::shared_ptr<ChBody> body) override;
+
+    real mass;
+    real yield_stress;
+    real nu;
+    real youngs_modulus;
+    real hardening_coefficient;
+    real lame_lambda;
+    real lame_mu;
+    real theta_s;
+    real theta_c;
+    real alpha_flip;
+    int mpm_iterations;
+
+  private:
+    void LoadSettings();
+    void WaitStep();
+    int FindBody(std::shared_ptr<ChBody> body) const;
+
+    std::vector<float> init_pos, init_vel;         ///< initial marker states (uploaded at initialization)
+    std::vector<std::shared_ptr<ChBody>> bodies;   ///< bodies with at least one collider
+    std::vector<MPM_Collider> colliders;           ///< collider shapes (referencing the coupled bodies)
+    std::vector<MPM_BodyState> body_states;        ///< coupled body states sent to the device
+    std::vector<float> step_wrenches;              ///< wrenches computed by the running MPM step
+    std::vector<real3> body_forces, body_torques;  ///< wrenches of the last completed MPM step
+    float gravity[3];
+
+    std::thread mpm_thread;
+    bool mpm_init;
+    bool colliders_changed;
+    MPM_Settings temp_settings;
+};
+
 /// @} multicore_physics
 
 }  // end namespace chrono
@@ -343,9 +343,43 @@ void ChFluidContainer::DensityConstraint_FluidMPM() {
     }
 }
 
-void ChFluidContainer::Density_Fluid() {
+// Evaluate the distance and kernels once for all neighbor pairs; the density, constraint, viscosity, and artificial
+// pressure passes of the current step all read them from the data manager.
+void ChFluidContainer::ComputeKernels() {
     custom_vector<real3>& sorted_pos = data_manager->host_data.sorted_pos_3dof;
+    custom_vector<real>& dist_ab = data_manager->host_data.dist_3dof_3dof;
+    custom_vector<real>& kernel_ab = data_manager->host_data.kernel_3dof_3dof;
+    custom_vector<real>& grad_ab = data_manager->host_data.grad_3dof_3dof;
     real h = kernel_radius;
+
+    dist_ab.resize(num_fluid_bodies * ChNarrowphase::max_neighbors);
+    kernel_ab.resize(num_fluid_bodies * ChNarrowphase::max_neighbors);
+    grad_ab.resize(num_fluid_bodies * ChNarrowphase::max_neighbors);
+
+#pragma omp parallel for
+    for (int body_a = 0; body_a < (signed)num_fluid_bodies; body_a++) {
+        real3 pos_p = sorted_pos[body_a];
+        for (int i = 0; i < data_manager->cd_data->c_counts_3dof_3dof[body_a]; i++) {
+            int index = body_a * ChNarrowphase::max_neighbors + i;
+            int body_b = data_manager->cd_data->neighbor_3dof_3dof[index];
+            if (body_a == body_b) {
+                dist_ab[index] = 0;
+                kernel_ab[index] = CPOLY6 * H6;
+                grad_ab[index] = 0;
+                continue;
+            }
+            real dist = Length(pos_p - sorted_pos[body_b]);
+            dist_ab[index] = dist;
+            kernel_ab[index] = KPOLY6;
+            grad_ab[index] = KGSPIKY;
+        }
+    }
+}
+
+void ChFluidContainer::Density_Fluid() {
+    custom_vector<real3>& sorted_pos = data_manager->host_data.sorted_pos_3dof;
+    const custom_vector<real>& kernel_ab = data_manager->host_data.kernel_3dof_3dof;
+    const custom_vector<real>& grad_ab = data_manager->host_data.grad_3dof_3dof;
     real inv_density = 1.0 / rho;
     real mass_over_density = mass * inv_density;
     CompressedMatrix<real>& D_T = data_manager->host_data.D_T;
@@ -357,18 +391,16 @@ void ChFluidContainer::Density_Fluid() {
         real3 pos_p = sorted_pos[body_a];
         ////int d_ind = 0;
         for (int i = 0; i < data_manager->cd_data->c_counts_3dof_3dof[body_a]; i++) {
-            int body_b = data_manager->cd_data->neighbor_3dof_3dof[body_a * ChNarrowphase::max_neighbors + i];
+            int index = body_a * ChNarrowphase::max_neighbors + i;
+            int body_b = data_manager->cd_data->neighbor_3dof_3dof[index];
+            dens += mass * kernel_ab[index];
             if (body_a == body_b) {
-                dens += mass * CPOLY6 * H6;
                 ////d_ind = i;
                 continue;
             }
             real3 xij = pos_p - sorted_pos[body_b];
-            real dist = Length(xij);
 
-            dens += mass * KPOLY6;
-
-            real3 kernel_xij = KGSPIKY * xij;
+            real3 kernel_xij = grad_ab[index] * xij;
             real3 dcon_od = mass_over_density * kernel_xij;  // off diagonal
             dcon_diag -= dcon_od;                            // diagonal is sum
             // den_con_jac[body_a * ChNarrowphase::max_neighbors + i] = dcon_od;
@@ -380,22 +412,15 @@ void ChFluidContainer::Density_Fluid() {
     }
 }
 void ChFluidContainer::Normalize_Density_Fluid() {
-    real h = kernel_radius;
-    custom_vector<real3>& sorted_pos = data_manager->host_data.sorted_pos_3dof;
+    const custom_vector<real>& kernel_ab = data_manager->host_data.kernel_3dof_3dof;
 
 #pragma omp parallel for
     for (int body_a = 0; body_a < (signed)num_fluid_bodies; body_a++) {
         real dens = 0;
-        real3 pos_p = sorted_pos[body_a];
         for (int i = 0; i < data_manager->cd_data->c_counts_3dof_3dof[body_a]; i++) {
-            int body_b = data_manager->cd_data->neighbor_3dof_3dof[body_a * ChNarrowphase::max_neighbors + i];
-            if (body_a == body_b) {
-                dens += mass / density[body_b] * CPOLY6 * H6;
-                continue;
-            }
-            real3 xij = pos_p - sorted_pos[body_b];
-            real dist = Length(xij);
-            dens += (mass / density[body_b]) * KPOLY6;
+            int index = body_a * ChNarrowphase::max_neighbors + i;
+            int body_b = data_manager->cd_data->neighbor_3dof_3dof[index];
+            dens += (mass / density[body_b]) * kernel_ab[index];
         }
         density[body_a] = density[body_a] / dens;
     }
@@ -412,8 +437,11 @@ void ChFluidContainer::Build_D() {
 
         // custom_vector<real3>& vel = data_manager->host_data.vel_3dof;
         custom_vector<real3>& sorted_pos = data_manager->host_data.sorted_pos_3dof;
+        const custom_vector<real>& dist_ab = data_manager->host_data.dist_3dof_3dof;
+        const custom_vector<real>& grad_ab = data_manager->host_data.grad_3dof_3dof;
 
         //=======COMPUTE DENSITY OF FLUID
+        ComputeKernels();
         density.resize(num_fluid_bodies);
         //        if (mpm_iterations > 0) {
         //            Density_FluidMPM();
@@ -435,13 +463,14 @@ void ChFluidContainer::Build_D() {
                 real3 vmat_row2(0);
                 real3 vmat_row3(0);
                 for (int i = 0; i < data_manager->cd_data->c_counts_3dof_3dof[body_a]; i++) {
-                    int body_b = data_manager->cd_data->neighbor_3dof_3dof[body_a * ChNarrowphase::max_neighbors + i];
+                    int index = body_a * ChNarrowphase::max_neighbors + i;
+                    int body_b = data_manager->cd_data->neighbor_3dof_3dof[index];
                     if (body_a == body_b) {
                         continue;
                     }
                     real3 xij = pos_p - sorted_pos[body_b];
-                    real dist = Length(xij);
-                    real3 kernel_xij = KGSPIKY * xij;
+                    real dist = dist_ab[index];
+                    real3 kernel_xij = grad_ab[index] * xij;
                     //
                     real density_a = density[body_a];
                     real density_b = density[body_b];
@@ -599,25 +628,22 @@ void ChFluidContainer::PostSolve() {
     if (artificial_pressure == false) {
         return;
     }
-    custom_vector<real3>& sorted_pos = data_manager->host_data.sorted_pos_3dof;
+    const custom_vector<real>& kernel_ab = data_manager->host_data.kernel_3dof_3dof;
     real h = kernel_radius;
     real k = artificial_pressure_k;
     real dq = artificial_pressure_dq;
     real n = artificial_pressure_n;
+    real kernel_dq = KERNEL(dq, h);
 #pragma omp parallel for
     for (int body_a = 0; body_a < (signed)num_fluid_bodies; body_a++) {
         real corr = 0;
-        real3 vorticity_grad(0);
-        real3 pos_a = sorted_pos[body_a];
         for (int i = 0; i < data_manager->cd_data->c_counts_3dof_3dof[body_a]; i++) {
-            int body_b = data_manager->cd_data->neighbor_3dof_3dof[body_a * ChNarrowphase::max_neighbors + i];
+            int index = body_a * ChNarrowphase::max_neighbors + i;
+            int body_b = data_manager->cd_data->neighbor_3dof_3dof[index];
             if (body_a == body_b) {
                 continue;
             }
-            real3 xij = (pos_a - sorted_pos[body_b]);
-
-            real dist = Length(xij);
-            corr += k * Pow(KERNEL(dist, h) / KERNEL(dq, h), n);
+            corr += k * Pow(kernel_ab[index] / kernel_dq, n);
         }
 
         data_manager->host_data.gamma[start_density + body_a] += corr;
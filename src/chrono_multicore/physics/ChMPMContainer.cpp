@@ -0,0 +1,243 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Container of GPU-resident MPM markers, coupled with the rigid bodies through
+// collider shapes. The MPM step for step n runs on a separate host thread,
+// concurrently with the rigid body collision detection and solve; its wrenches
+// are applied to the rigid bodies at step n+1.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono_multicore/physics/ChSystemMulticore.h"
+#include "chrono_multicore/physics/Ch3DOFContainer.h"
+#include "chrono_multicore/ChDataManager.h"
+
+#ifdef CHRONO_MULTICORE_USE_CUDA
+    #include "chrono_multicore/cuda/ChMPM.cuh"
+#endif
+
+namespace chrono {
+
+ChMPMContainer::ChMPMContainer() {
+    mass = 0.037037;
+    yield_stress = 0;
+    mpm_iterations = 10;
+
+    nu = .2;
+    youngs_modulus = 1.4e5;
+    hardening_coefficient = 10;
+    lame_lambda = youngs_modulus * nu / ((1. + nu) * (1. - 2. * nu));
+    lame_mu = youngs_modulus / (2. * (1. + nu));
+    theta_s = 7.5e-3;
+    theta_c = 2.5e-2;
+    alpha_flip = .95;
+
+    gravity[0] = gravity[1] = gravity[2] = 0;
+    mpm_init = false;
+    colliders_changed = false;
+}
+
+ChMPMContainer::~ChMPMContainer() {
+    WaitStep();
+}
+
+void ChMPMContainer::AddMarkers(const std::vector<real3>& positions, const std::vector<real3>& velocities) {
+    for (size_t i = 0; i < positions.size(); i++) {
+        real3 vel = i < velocities.size() ? velocities[i] : real3(0);
+        init_pos.insert(init_pos.end(), {(float)positions[i].x, (float)positions[i].y, (float)positions[i].z});
+        init_vel.insert(init_vel.end(), {(float)vel.x, (float)vel.y, (float)vel.z});
+    }
+}
+
+void ChMPMContainer::AddCollider(std::shared_ptr<ChBody> body,
+                                 MPM_ColliderType type,
+                                 const real3& dims,
+                                 const real3& pos,
+                                 const quaternion& rot,
+                                 real friction) {
+    int k = FindBody(body);
+    if (k < 0) {
+        k = (int)bodies.size();
+        bodies.push_back(body);
+        body_forces.push_back(real3(0));
+        body_torques.push_back(real3(0));
+    }
+
+    MPM_Collider c;
+    c.body = k;
+    c.type = type;
+    c.pos[0] = (float)pos.x;
+    c.pos[1] = (float)pos.y;
+    c.pos[2] = (float)pos.z;
+    c.rot[0] = (float)rot.w;
+    c.rot[1] = (float)rot.x;
+    c.rot[2] = (float)rot.y;
+    c.rot[3] = (float)rot.z;
+    c.dims[0] = (float)dims.x;
+    c.dims[1] = (float)dims.y;
+    c.dims[2] = (float)dims.z;
+    c.mu = (float)friction;
+    colliders.push_back(c);
+    colliders_changed = true;
+}
+
+int ChMPMContainer::FindBody(std::shared_ptr<ChBody> body) const {
+    auto it = std::find(bodies.begin(), bodies.end(), body);
+    return it == bodies.end() ? -1 : (int)(it - bodies.begin());
+}
+
+void ChMPMContainer::LoadSettings() {
+    temp_settings.dt = (float)data_manager->settings.step_size;
+    temp_settings.kernel_radius = (float)kernel_radius;
+    temp_settings.inv_radius = float(1.0 / kernel_radius);
+    temp_settings.bin_edge = float(kernel_radius * 2);
+    temp_settings.inv_bin_edge = float(1.0 / (kernel_radius * 2.0));
+    temp_settings.max_velocity = (float)max_velocity;
+    temp_settings.mu = (float)lame_mu;
+    temp_settings.lambda = (float)lame_lambda;
+    temp_settings.hardening_coefficient = (float)hardening_coefficient;
+    temp_settings.theta_c = (float)theta_c;
+    temp_settings.theta_s = (float)theta_s;
+    temp_settings.alpha_flip = (float)alpha_flip;
+    temp_settings.youngs_modulus = (float)youngs_modulus;
+    temp_settings.poissons_ratio = (float)nu;
+    temp_settings.num_mpm_markers = (int)GetNumMarkers();
+    temp_settings.mass = (float)mass;
+    temp_settings.yield_stress = (float)yield_stress;
+    temp_settings.num_iterations = mpm_iterations;
+}
+
+void ChMPMContainer::Initialize() {
+#ifdef CHRONO_MULTICORE_USE_CUDA
+    if (GetNumMarkers() == 0)
+        return;
+    LoadSettings();
+    MPM_InitializeResident(temp_settings, init_pos, init_vel);
+    MPM_SetColliders(colliders);
+    colliders_changed = false;
+    mpm_init = true;
+#endif
+}
+
+void ChMPMContainer::Update3DOF(double ChTime) {
+    const real h = data_manager->settings.step_size;
+    const custom_vector<char>& active = data_manager->host_data.active_rigid;
+    DynamicVector<real>& hf = data_manager->host_data.hf;
+
+    // Apply the wrenches from the last completed MPM step (torques are expressed in the body frame)
+    for (size_t k = 0; k < bodies.size(); k++) {
+        uint index = bodies[k]->GetIndex();
+        if (active[index] == 0)
+            continue;
+        hf[index * 6 + 0] += h * body_forces[k].x;
+        hf[index * 6 + 1] += h * body_forces[k].y;
+        hf[index * 6 + 2] += h * body_forces[k].z;
+        hf[index * 6 + 3] += h * body_torques[k].x;
+        hf[index * 6 + 4] += h * body_torques[k].y;
+        hf[index * 6 + 5] += h * body_torques[k].z;
+    }
+
+#ifdef CHRONO_MULTICORE_USE_CUDA
+    if (!mpm_init)
+        return;
+
+    if (colliders_changed) {
+        MPM_SetColliders(colliders);
+        colliders_changed = false;
+    }
+
+    // Send the states of the coupled bodies at the beginning of the step
+    const DynamicVector<real>& v = data_manager->host_data.v;
+    body_states.resize(bodies.size());
+    for (size_t k = 0; k < bodies.size(); k++) {
+        uint index = bodies[k]->GetIndex();
+        const real3& pos = data_manager->host_data.pos_rigid[index];
+        const quaternion& rot = data_manager->host_data.rot_rigid[index];
+        real3 ang_vel = Rotate(real3(v[index * 6 + 3], v[index * 6 + 4], v[index * 6 + 5]), rot);
+
+        MPM_BodyState& state = body_states[k];
+        state.pos[0] = (float)pos.x;
+        state.pos[1] = (float)pos.y;
+        state.pos[2] = (float)pos.z;
+        state.rot[0] = (float)rot.w;
+        state.rot[1] = (float)rot.x;
+        state.rot[2] = (float)rot.y;
+        state.rot[3] = (float)rot.z;
+        state.lin_vel[0] = (float)v[index * 6 + 0];
+        state.lin_vel[1] = (float)v[index * 6 + 1];
+        state.lin_vel[2] = (float)v[index * 6 + 2];
+        state.ang_vel[0] = (float)ang_vel.x;
+        state.ang_vel[1] = (float)ang_vel.y;
+        state.ang_vel[2] = (float)ang_vel.z;
+    }
+
+    gravity[0] = (float)data_manager->settings.gravity.x;
+    gravity[1] = (float)data_manager->settings.gravity.y;
+    gravity[2] = (float)data_manager->settings.gravity.z;
+
+    LoadSettings();
+    mpm_thread = std::thread(MPM_StepResident, std::ref(temp_settings), gravity, std::cref(body_states),
+                             std::ref(step_wrenches));
+#endif
+}
+
+void ChMPMContainer::UpdatePosition(double ChTime) {
+    WaitStep();
+}
+
+void ChMPMContainer::WaitStep() {
+    if (!mpm_thread.joinable())
+        return;
+    mpm_thread.join();
+
+    // Convert the torques to the body frames (at the body orientations used for the step)
+    for (size_t k = 0; k < body_states.size() && 6 * k + 5 < step_wrenches.size(); k++) {
+        const float* w = &step_wrenches[6 * k];
+        const MPM_BodyState& state = body_states[k];
+        quaternion rot(state.rot[0], state.rot[1], state.rot[2], state.rot[3]);
+        body_forces[k] = real3(w[0], w[1], w[2]);
+        body_torques[k] = RotateT(real3(w[3], w[4], w[5]), rot);
+    }
+}
+
+void ChMPMContainer::GetMarkers(std::vector<real3>& positions, std::vector<real3>& velocities) {
+    WaitStep();
+    std::vector<float> pos = init_pos;
+    std::vector<float> vel = init_vel;
+#ifdef CHRONO_MULTICORE_USE_CUDA
+    if (mpm_init)
+        MPM_GetMarkers(pos, vel);
+#endif
+    uint num_markers = GetNumMarkers();
+    positions.resize(num_markers);
+    velocities.resize(num_markers);
+    for (uint i = 0; i < num_markers; i++) {
+        positions[i] = real3(pos[i * 3 + 0], pos[i * 3 + 1], pos[i * 3 + 2]);
+        velocities[i] = real3(vel[i * 3 + 0], vel[i * 3 + 1], vel[i * 3 + 2]);
+    }
+}
+
+real3 ChMPMContainer::GetBodyContactForce(std::shared_ptr<ChBody> body) {
+    int k = FindBody(body);
+    return k < 0 ? real3(0) : body_forces[k];
+}
+
+real3 ChMPMContainer::GetBodyContactTorque(std::shared_ptr<ChBody> body) {
+    int k = FindBody(body);
+    return k < 0 ? real3(0) : body_torques[k];
+}
+
+}  // end namespace chrono
@@ -40,6 +40,27 @@ struct MPM_Settings {
     int bins_per_axis_z;
 };
 
+/// Collider shape types for the GPU-resident MPM solver.
+enum MPM_ColliderType { MPM_SPHERE = 0, MPM_BOX = 1, MPM_CYLINDER = 2 };
+
+/// Collision shape of a rigid body coupled with the GPU-resident MPM solver.
+struct MPM_Collider {
+    int body;       ///< index of the body in the list of coupled bodies
+    int type;       ///< shape type (MPM_ColliderType)
+    float pos[3];   ///< shape position in the body frame
+    float rot[4];   ///< shape orientation in the body frame (e0, e1, e2, e3)
+    float dims[3];  ///< sphere: radius; box: half-lengths; cylinder: radius and half-length along Z
+    float mu;       ///< friction coefficient between the MPM material and the shape
+};
+
+/// Kinematic state of a rigid body coupled with the GPU-resident MPM solver (absolute frame).
+struct MPM_BodyState {
+    float pos[3];      ///< center of mass position
+    float rot[4];      ///< orientation (e0, e1, e2, e3)
+    float lin_vel[3];  ///< linear velocity
+    float ang_vel[3];  ///< angular velocity
+};
+
 /// @} multicore_physics
 
 }  // end namespace chrono
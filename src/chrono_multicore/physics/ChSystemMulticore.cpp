@@ -87,6 +87,10 @@ bool ChSystemMulticore::AdvanceDynamics() {
     data_manager->system_timer.Reset();
     data_manager->system_timer.start("step");
 
+    int reorder_interval = data_manager->settings.body_reorder_interval;
+    if (reorder_interval > 0 && stepcount > 0 && stepcount % reorder_interval == 0)
+        ReorderBodies();
+
     Setup();
 
     data_manager->system_timer.start("update");
@@ -191,6 +195,10 @@ bool ChSystemMulticore::AdvanceDynamics() {
     }
 
     data_manager->node_container->UpdatePosition(ch_time);
+
+    if (IsSleepingAllowed())
+        ManageSleepingClusters();
+
     data_manager->system_timer.stop("update");
 
     //=============================================================================================
@@ -214,6 +222,8 @@ void ChSystemMulticore::AddBody(std::shared_ptr<ChBody> body) {
     body->index = data_manager->num_rigid_bodies;
 
     assembly.bodylist.push_back(body);
+    data_manager->body_ext_id.push_back(body->index);
+    data_manager->body_int_index.push_back(body->index);
     data_manager->num_rigid_bodies++;
 
     // Set the system for the body.  Note that this will also add the body's
@@ -231,6 +241,116 @@ void ChSystemMulticore::AddBody(std::shared_ptr<ChBody> body) {
     AddMaterialSurfaceData(body);
 }
 
+// Add the specified bodies to the system.
+// Each body also requires its own entries in the system-wide vectors, so bodies are added one at a time.
+void ChSystemMulticore::AddBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    assembly.bodylist.reserve(assembly.bodylist.size() + bodies.size());
+    for (const auto& body : bodies)
+        AddBody(body);
+}
+
+// Renumber the rigid bodies in spatial order.
+// The system body list and the body indices are permuted together with the per-body data in the data manager.
+void ChSystemMulticore::ReorderBodies() {
+    std::vector<uint> order;
+    data_manager->ComputeSpatialOrder(order);
+
+    std::vector<std::shared_ptr<ChBody>> bodies(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        bodies[i] = assembly.bodylist[order[i]];
+        bodies[i]->index = (unsigned int)i;
+    }
+    assembly.bodylist.swap(bodies);
+
+    data_manager->ReorderRigidBodies(order);
+}
+
+std::shared_ptr<ChBody> ChSystemMulticore::GetBodyByInsertionIndex(unsigned int id) const {
+    return assembly.bodylist[data_manager->body_int_index[id]];
+}
+
+// Find the root of the cluster of the specified body (with path halving).
+static uint ClusterRoot(std::vector<uint>& parent, uint i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+static void ClusterJoin(std::vector<uint>& parent, uint i, uint j) {
+    uint ri = ClusterRoot(parent, i);
+    uint rj = ClusterRoot(parent, j);
+    if (ri != rj)
+        parent[std::max(ri, rj)] = std::min(ri, rj);
+}
+
+// Put quiet clusters of bodies to sleep and wake up clusters with moving bodies.
+bool ChSystemMulticore::ManageSleepingClusters() {
+    auto& blist = assembly.bodylist;
+    uint num_bodies = (uint)blist.size();
+    if (num_bodies == 0)
+        return false;
+
+    // Bodies which are sleeping or candidates for sleeping (TrySleeping tracks the time spent below the thresholds)
+    std::vector<char> quiet(num_bodies);
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_bodies; i++) {
+        quiet[i] = blist[i]->IsSleeping() || blist[i]->TrySleeping();
+    }
+
+    // Clusters of non-fixed bodies connected through rigid contacts or links
+    std::vector<uint> parent(num_bodies);
+    std::iota(parent.begin(), parent.end(), 0);
+
+    if (data_manager->cd_data) {
+        const std::vector<vec2>& bids = data_manager->cd_data->bids_rigid_rigid;
+        for (uint k = 0; k < data_manager->cd_data->num_rigid_contacts; k++) {
+            uint a = bids[k].x;
+            uint b = bids[k].y;
+            if (!blist[a]->IsFixed() && !blist[b]->IsFixed())
+                ClusterJoin(parent, a, b);
+        }
+    }
+    for (auto& item : assembly.linklist) {
+        auto link = std::dynamic_pointer_cast<ChLink>(item);
+        if (!link)
+            continue;
+        ChBody* b1 = dynamic_cast<ChBody*>(link->GetBody1());
+        ChBody* b2 = dynamic_cast<ChBody*>(link->GetBody2());
+        if (b1 && b2 && !b1->IsFixed() && !b2->IsFixed())
+            ClusterJoin(parent, b1->GetIndex(), b2->GetIndex());
+    }
+
+    // A cluster is quiet if all its bodies are quiet
+    std::vector<char> cluster_quiet(num_bodies, 1);
+    for (uint i = 0; i < num_bodies; i++) {
+        parent[i] = ClusterRoot(parent, i);
+        if (!blist[i]->IsFixed() && !quiet[i])
+            cluster_quiet[parent[i]] = 0;
+    }
+
+    // Put quiet clusters to sleep and wake up the others
+    int num_changed = 0;
+#pragma omp parallel for reduction(+ : num_changed)
+    for (int i = 0; i < (signed)num_bodies; i++) {
+        auto& body = blist[i];
+        if (body->IsFixed())
+            continue;
+        bool sleep = cluster_quiet[parent[i]] != 0;
+        if (sleep == body->IsSleeping())
+            continue;
+        if (sleep) {
+            body->SetPosDt(VNULL);
+            body->SetAngVelLocal(VNULL);
+        }
+        body->SetSleeping(sleep);
+        num_changed++;
+    }
+
+    return num_changed > 0;
+}
+
 // Add the specified shaft to the system.
 // A unique identifier is assigned to each shaft for indexing purposes.
 // Space is allocated in system-wide vectors for data corresponding to the shaft.
@@ -265,6 +385,11 @@ void ChSystemMulticore::AddLink(std::shared_ptr<ChLinkBase> link) {
     ChSystem::AddLink(link);
 }
 
+void ChSystemMulticore::AddLinks(const std::vector<std::shared_ptr<ChLinkBase>>& links) {
+    for (const auto& link : links)
+        AddLink(link);
+}
+
 // Add physics items, other than bodies, shafts, or links, to the system.
 // Note that no test is performed to check if the item was already added.
 void ChSystemMulticore::AddOtherPhysicsItem(std::shared_ptr<ChPhysicsItem> newitem) {
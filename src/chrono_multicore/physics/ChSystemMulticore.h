@@ -49,6 +49,8 @@ class settings_container;
 /// @{
 
 /// Base class for Chrono::Multicore systems.
+/// The parallel reductions of Chrono::Multicore use a fixed order; the deterministic mode of ChSystem
+/// (see ChSystem::EnableDeterministic) does not apply.
 class CH_MULTICORE_API ChSystemMulticore : public ChSystem {
   public:
     ChSystemMulticore();
@@ -57,8 +59,10 @@ class CH_MULTICORE_API ChSystemMulticore : public ChSystem {
 
     virtual bool AdvanceDynamics() override;
     virtual void AddBody(std::shared_ptr<ChBody> body) override;
+    virtual void AddBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) override;
     virtual void AddShaft(std::shared_ptr<ChShaft> shaft) override;
     virtual void AddLink(std::shared_ptr<ChLinkBase> link) override;
+    virtual void AddLinks(const std::vector<std::shared_ptr<ChLinkBase>>& links) override;
     virtual void AddOtherPhysicsItem(std::shared_ptr<ChPhysicsItem> newitem) override;
 
     void ClearForceVariables();
@@ -72,6 +76,26 @@ class CH_MULTICORE_API ChSystemMulticore : public ChSystem {
     virtual void Update3DOFBodies();
     void RecomputeThreads();
 
+    /// Renumber the rigid bodies along a space-filling (Morton) curve through their current positions.
+    /// Bodies close in space get close indices, which improves memory locality in collision detection and in the
+    /// solver. Body handles stay valid, but body indices and the order of the system body list change; use
+    /// GetBodyByInsertionIndex to retrieve a body by its insertion order. This function is called automatically
+    /// every settings_container::body_reorder_interval steps.
+    void ReorderBodies();
+
+    /// Get the rigid body with the given insertion index (the index the body had when added to the system).
+    std::shared_ptr<ChBody> GetBodyByInsertionIndex(unsigned int id) const;
+
+    /// Put clusters of quiet bodies to sleep and wake up disturbed clusters.
+    /// A cluster is a set of non-fixed bodies connected through contacts or links. A cluster goes to sleep when all
+    /// its bodies allow sleeping and stayed below their sleep velocity thresholds for their sleep time (see
+    /// ChBody::SetSleepTime). A sleeping body is excluded from the solver and its contacts with other sleeping or fixed
+    /// bodies are not generated; a contact or link with an awake moving body wakes up its whole cluster.
+    /// This function is called automatically at the end of each step if sleeping is allowed for the system (see
+    /// ChSystem::SetSleepingAllowed). Note that it has no effect if the collision system uses an active box, as the
+    /// active box then controls the sleeping state of all bodies. Return true if the state of some body changed.
+    bool ManageSleepingClusters();
+
     virtual void AddMaterialSurfaceData(std::shared_ptr<ChBody> newbody) = 0;
     virtual void UpdateMaterialSurfaceData(int index, ChBody* body) = 0;
     virtual void Setup() override;
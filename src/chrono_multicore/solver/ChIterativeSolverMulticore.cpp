@@ -17,13 +17,18 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+#include <climits>
+
 #include "chrono_multicore/solver/ChIterativeSolverMulticore.h"
 
 #include "chrono/physics/ChBody.h"
 
 using namespace chrono;
 
-ChIterativeSolverMulticore::ChIterativeSolverMulticore(ChMulticoreDataManager* dc) : data_manager(dc) {
+ChIterativeSolverMulticore::ChIterativeSolverMulticore(ChMulticoreDataManager* dc)
+    : data_manager(dc), predicted_iterations(UINT_MAX) {
     m_tolerance = 1e-7;
     m_warm_start = false;
     solver = new ChSolverMulticoreAPGD();
@@ -232,4 +237,52 @@ void ChIterativeSolverMulticore::PerformStabilization() {
 
 real ChIterativeSolverMulticore::GetResidual() const {
     return data_manager->measures.solver.maxd_hist.size() > 0 ? data_manager->measures.solver.maxd_hist.back() : 0.0;
-}
\ No newline at end of file
+}
+void ChIterativeSolverMulticore::BeginAdaptiveStep() {
+    const solver_settings& settings = data_manager->settings.solver;
+    solver_measures& measures = data_manager->measures.solver;
+
+    uint num_contacts = data_manager->cd_data ? data_manager->cd_data->num_rigid_contacts : 0;
+    real contact_change = std::abs((real)num_contacts - (real)measures.step_num_contacts) /
+                          std::max((real)measures.step_num_contacts, real(1));
+
+    // Iterations needed to reduce the initial residual of the previous step below the tolerance, at the residual
+    // reduction rate of the previous step (with a safety margin)
+    predicted_iterations = UINT_MAX;
+    real rate = measures.step_reduction_rate;
+    if (settings.adaptive_iterations && measures.step_iterations > 0 && rate > 0 && rate < 1 &&
+        contact_change <= settings.adaptive_contact_change) {
+        real reduction = settings.tol_speed / measures.step_initial_residual;
+        real needed = reduction < 1 ? std::log(reduction) / std::log(rate) : 0;
+        predicted_iterations = (uint)std::min(std::ceil(1.25 * needed), (real)UINT_MAX / 2);
+    }
+
+    measures.step_num_contacts = num_contacts;
+    measures.step_iteration_budget = 0;
+    measures.step_iterations = 0;
+    measures.step_initial_residual = 0;
+    measures.step_final_residual = 0;
+    measures.step_early_termination = false;
+}
+
+uint ChIterativeSolverMulticore::IterationBudget(uint max_iter) {
+    uint budget = max_iter;
+    if (data_manager->settings.solver.adaptive_iterations) {
+        budget = std::max(predicted_iterations, data_manager->settings.solver.adaptive_min_iteration);
+        budget = std::min(budget, max_iter);
+    }
+    data_manager->measures.solver.step_iteration_budget += budget;
+    return budget;
+}
+
+void ChIterativeSolverMulticore::EndAdaptiveStep(uint num_iterations) {
+    solver_measures& measures = data_manager->measures.solver;
+
+    measures.step_iterations = num_iterations;
+    measures.step_final_residual = measures.residual;
+    measures.step_reduction_rate = 0;
+    if (num_iterations > 0 && measures.step_initial_residual > 0 && measures.step_final_residual > 0) {
+        measures.step_reduction_rate =
+            std::pow(measures.step_final_residual / measures.step_initial_residual, real(1) / num_iterations);
+    }
+}
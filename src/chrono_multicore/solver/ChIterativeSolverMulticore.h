@@ -63,8 +63,18 @@ class CH_MULTICORE_API ChIterativeSolverMulticore : public ChIterativeSolverVI {
   protected:
     ChIterativeSolverMulticore(ChMulticoreDataManager* dc);
 
+    /// Start the iteration control of a new step: predict the iteration budget from the statistics of the previous
+    /// step (see solver_settings::adaptive_iterations) and reset the per-step statistics.
+    void BeginAdaptiveStep();
+    /// Return the iteration budget of a solve with the given maximum number of iterations.
+    uint IterationBudget(uint max_iter);
+    /// Record the statistics of the current step, given the total number of iterations performed.
+    void EndAdaptiveStep(uint num_iterations);
+
     ChSchurProductBilateral SchurProductBilateral;
     ChProjectNone ProjectNone;
+
+    uint predicted_iterations;  ///< predicted iteration budget of the current step
 };
 
 /// Wrapper class for all complementarity solvers.
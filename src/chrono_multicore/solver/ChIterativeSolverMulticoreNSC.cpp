@@ -102,19 +102,24 @@ void ChIterativeSolverMulticoreNSC::RunTimeStep() {
 
     PerformStabilization();
 
+    BeginAdaptiveStep();
+    uint step_iterations = 0;
+
     if (data_manager->settings.solver.solver_mode == SolverMode::NORMAL ||
         data_manager->settings.solver.solver_mode == SolverMode::SLIDING ||
         data_manager->settings.solver.solver_mode == SolverMode::SPINNING) {
         if (data_manager->settings.solver.max_iteration_normal > 0) {
             data_manager->settings.solver.local_solver_mode = SolverMode::NORMAL;
             SetR();
-            data_manager->measures.solver.total_iteration +=
-                solver->Solve(SchurProductFull,                                    //
-                              ProjectFull,                                         //
-                              data_manager->settings.solver.max_iteration_normal,  //
-                              data_manager->num_constraints,                       //
-                              data_manager->host_data.R,                           //
-                              data_manager->host_data.gamma);                      //
+            uint max_iter = IterationBudget(data_manager->settings.solver.max_iteration_normal);
+            uint iterations = solver->Solve(SchurProductFull,                //
+                                            ProjectFull,                     //
+                                            max_iter,                        //
+                                            data_manager->num_constraints,   //
+                                            data_manager->host_data.R,       //
+                                            data_manager->host_data.gamma);  //
+            data_manager->measures.solver.total_iteration += iterations;
+            step_iterations += iterations;
         }
     }
     if (data_manager->settings.solver.solver_mode == SolverMode::SLIDING ||
@@ -122,26 +127,30 @@ void ChIterativeSolverMulticoreNSC::RunTimeStep() {
         if (data_manager->settings.solver.max_iteration_sliding > 0) {
             data_manager->settings.solver.local_solver_mode = SolverMode::SLIDING;
             SetR();
-            data_manager->measures.solver.total_iteration +=
-                solver->Solve(SchurProductFull,                                     //
-                              ProjectFull,                                          //
-                              data_manager->settings.solver.max_iteration_sliding,  //
-                              data_manager->num_constraints,                        //
-                              data_manager->host_data.R,                            //
-                              data_manager->host_data.gamma);                       //
+            uint max_iter = IterationBudget(data_manager->settings.solver.max_iteration_sliding);
+            uint iterations = solver->Solve(SchurProductFull,                //
+                                            ProjectFull,                     //
+                                            max_iter,                        //
+                                            data_manager->num_constraints,   //
+                                            data_manager->host_data.R,       //
+                                            data_manager->host_data.gamma);  //
+            data_manager->measures.solver.total_iteration += iterations;
+            step_iterations += iterations;
         }
     }
     if (data_manager->settings.solver.solver_mode == SolverMode::SPINNING) {
         if (data_manager->settings.solver.max_iteration_spinning > 0) {
             data_manager->settings.solver.local_solver_mode = SolverMode::SPINNING;
             SetR();
-            data_manager->measures.solver.total_iteration +=
-                solver->Solve(SchurProductFull,                                      //
-                              ProjectFull,                                           //
-                              data_manager->settings.solver.max_iteration_spinning,  //
-                              data_manager->num_constraints,                         //
-                              data_manager->host_data.R,                             //
-                              data_manager->host_data.gamma);                        //
+            uint max_iter = IterationBudget(data_manager->settings.solver.max_iteration_spinning);
+            uint iterations = solver->Solve(SchurProductFull,                //
+                                            ProjectFull,                     //
+                                            max_iter,                        //
+                                            data_manager->num_constraints,   //
+                                            data_manager->host_data.R,       //
+                                            data_manager->host_data.gamma);  //
+            data_manager->measures.solver.total_iteration += iterations;
+            step_iterations += iterations;
         }
     }
 
@@ -171,6 +180,8 @@ void ChIterativeSolverMulticoreNSC::RunTimeStep() {
     //    std::cout << "time1: " << t1 << " time2: " << timer() << std::endl;
     //    /////
 
+    EndAdaptiveStep(step_iterations);
+
     data_manager->Fc_current = false;
     data_manager->node_container->PostSolve();
 
@@ -232,12 +243,21 @@ void ChIterativeSolverMulticoreNSC::ComputeD() {
             break;
     }
 
-    CLEAR_RESERVE_RESIZE(D_T, nnz_total, num_rows, num_dof)
-    CLEAR_RESERVE_RESIZE(M_invD, nnz_total, num_dof, num_rows)
+    // Reuse the sparsity pattern of the previous step if the constraint layout is unchanged (the contact rows are
+    // updated in place); otherwise, regenerate it. The pattern of 3DOF node constraints is always regenerated.
+    bool reuse_sparsity = D_T.rows() == num_rows && D_T.columns() == num_dof && D_T.nonZeros() == (size_t)nnz_total &&
+                          num_fluid_fluid == 0 && data_manager->bilateral->IsSparsityValid() &&
+                          data_manager->rigid_rigid->UpdateSparsity();
+
+    if (!reuse_sparsity) {
+        CLEAR_RESERVE_RESIZE(D_T, nnz_total, num_rows, num_dof)
+        if (!data_manager->settings.solver.matrix_free_schur)
+            CLEAR_RESERVE_RESIZE(M_invD, nnz_total, num_dof, num_rows)
 
-    data_manager->rigid_rigid->GenerateSparsity();
-    data_manager->bilateral->GenerateSparsity();
-    data_manager->node_container->GenerateSparsity();
+        data_manager->rigid_rigid->GenerateSparsity();
+        data_manager->bilateral->GenerateSparsity();
+        data_manager->node_container->GenerateSparsity();
+    }
 
     // Move b code here so that it can be computed along side D
     DynamicVector<real>& b = data_manager->host_data.b;
@@ -251,7 +271,13 @@ void ChIterativeSolverMulticoreNSC::ComputeD() {
     // using the .transpose(); function will do in place transpose and copy
     data_manager->host_data.D = trans(D_T);
 
-    data_manager->host_data.M_invD = M_inv * data_manager->host_data.D;
+    if (data_manager->settings.solver.matrix_free_schur) {
+        // M_invD is not used; release its storage
+        CompressedMatrix<real> empty;
+        swap(M_invD, empty);
+    } else {
+        M_invD = M_inv * data_manager->host_data.D;
+    }
 
     data_manager->system_timer.stop("ChIterativeSolverMulticore_D");
 }
@@ -306,7 +332,10 @@ void ChIterativeSolverMulticoreNSC::ComputeN() {
     data_manager->system_timer.start("ChIterativeSolverMulticore_N");
     const CompressedMatrix<real>& D_T = data_manager->host_data.D_T;
     CompressedMatrix<real>& Nschur = data_manager->host_data.Nschur;
-    Nschur = D_T * data_manager->host_data.M_invD;
+    if (data_manager->settings.solver.matrix_free_schur)
+        Nschur = D_T * (data_manager->host_data.M_inv * data_manager->host_data.D);
+    else
+        Nschur = D_T * data_manager->host_data.M_invD;
     data_manager->system_timer.stop("ChIterativeSolverMulticore_N");
 }
 
@@ -375,7 +404,10 @@ void ChIterativeSolverMulticoreNSC::ComputeImpulses() {
 
     if (data_manager->num_constraints > 0) {
         // Compute new velocity based on the lagrange multipliers
-        v = v + M_inv * hf + data_manager->host_data.M_invD * gamma;
+        if (data_manager->settings.solver.matrix_free_schur)
+            v = v + M_inv * (hf + data_manager->host_data.D * gamma);
+        else
+            v = v + M_inv * hf + data_manager->host_data.M_invD * gamma;
     } else {
         // When there are no constraints we need to still apply gravity and other
         // body forces!
@@ -29,17 +29,14 @@
 //// case. Is there a solution?
 
 #include <algorithm>
+#include <numeric>
 #include <stdexcept>
 
 #include "chrono/physics/ChSystemSMC.h"
 #include "chrono/physics/ChContactMaterialSMC.h"
 #include "chrono_multicore/solver/ChIterativeSolverMulticore.h"
 
-#include <thrust/sort.h>
-
-#if defined _WIN32
-    #include <cstdint>
-#endif
+#include <thrust/copy.h>
 
 using namespace chrono;
 
@@ -633,15 +630,6 @@ void ChIterativeSolverMulticoreSMC::host_SetContactForcesMap(uint ct_body_count,
     }
 }
 
-// Binary operation for adding two-object tuples
-struct sum_tuples {
-    thrust::tuple<real3, real3> operator()(const thrust::tuple<real3, real3>& a,
-                                           const thrust::tuple<real3, real3>& b) const {
-        return thrust::tuple<real3, real3>(thrust::get<0>(a) + thrust::get<0>(b),
-                                           thrust::get<1>(a) + thrust::get<1>(b));
-    }
-};
-
 // -----------------------------------------------------------------------------
 // Process contact information reported by the narrowphase collision detection,
 // generate contact forces, and update the (linear and rotational) impulses for
@@ -696,35 +684,57 @@ void ChIterativeSolverMulticoreSMC::ProcessContacts() {
     //    involved in at least one contact, by reducing the contact forces and
     //    torques from all contacts these bodies are involved in. The number of
     //    bodies that experience at least one contact is 'ct_body_count'.
-    thrust::sort_by_key(THRUST_PAR ct_bid.begin(), ct_bid.end(),
-                        thrust::make_zip_iterator(thrust::make_tuple(ct_force.begin(), ct_torque.begin())));
+    //    Rather than sorting the (force, torque) pairs by body ID, the entries of
+    //    each body are bucketed with a stable counting pass over the body IDs
+    //    (only integer indices are moved) and each body then reduces its own
+    //    segment. The summation order is the contact order, independent of the
+    //    number of threads.
+    const uint num_bodies = data_manager->num_rigid_bodies;
+    const uint num_entries = 2 * num_rigid_contacts;
+
+    custom_vector<uint> ct_body_start(num_bodies + 1, 0);
+    for (uint k = 0; k < num_entries; k++) {
+        ct_body_start[ct_bid[k] + 1]++;
+    }
+    std::partial_sum(ct_body_start.begin(), ct_body_start.end(), ct_body_start.begin());
+
+    custom_vector<uint> ct_entry(num_entries);
+    {
+        custom_vector<uint> cursor(ct_body_start.begin(), ct_body_start.end() - 1);
+        for (uint k = 0; k < num_entries; k++) {
+            ct_entry[cursor[ct_bid[k]]++] = k;
+        }
+    }
+
+    // Compact list of the bodies involved in at least one contact (in increasing order of body ID)
+    custom_vector<int> ct_body_id;
+    ct_body_id.reserve(num_bodies);
+    for (uint b = 0; b < num_bodies; b++) {
+        if (ct_body_start[b + 1] > ct_body_start[b])
+            ct_body_id.push_back((int)b);
+    }
+    uint ct_body_count = (uint)ct_body_id.size();
 
-    custom_vector<int> ct_body_id(data_manager->num_rigid_bodies);
     custom_vector<real3>& ct_body_force = data_manager->host_data.ct_body_force;
     custom_vector<real3>& ct_body_torque = data_manager->host_data.ct_body_torque;
 
-    ct_body_force.resize(data_manager->num_rigid_bodies);
-    ct_body_torque.resize(data_manager->num_rigid_bodies);
-
-    // Reduce contact forces from all contacts and count bodies currently involved
-    // in contact. We do this simultaneously for contact forces and torques, using
-    // zip iterators.
-    auto end_range = thrust::reduce_by_key(
-        THRUST_PAR ct_bid.begin(), ct_bid.end(),
-        thrust::make_zip_iterator(thrust::make_tuple(ct_force.begin(), ct_torque.begin())), ct_body_id.begin(),
-        thrust::make_zip_iterator(thrust::make_tuple(ct_body_force.begin(), ct_body_torque.begin())),
-#if defined _WIN32
-        thrust::equal_to<int64_t>(), sum_tuples()  // Windows compilers require an explicit-width type
-#else
-        thrust::equal_to<int>(), sum_tuples()
-#endif
-    );
-
-    uint ct_body_count = (uint)(end_range.first - ct_body_id.begin());
-
     ct_body_force.resize(ct_body_count);
     ct_body_torque.resize(ct_body_count);
 
+    // Segmented reduction of the contact forces and torques of each body
+#pragma omp parallel for
+    for (int index = 0; index < (signed)ct_body_count; index++) {
+        uint b = ct_body_id[index];
+        real3 force(0);
+        real3 torque(0);
+        for (uint j = ct_body_start[b]; j < ct_body_start[b + 1]; j++) {
+            force += ct_force[ct_entry[j]];
+            torque += ct_torque[ct_entry[j]];
+        }
+        ct_body_force[index] = force;
+        ct_body_torque[index] = torque;
+    }
+
     // 3. Add contact forces and torques to existing forces (impulses):
     //    For all bodies involved in a contact, update the body forces and torques
     //    (scaled by the integration time step).
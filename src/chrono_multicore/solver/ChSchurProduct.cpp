@@ -35,10 +35,44 @@ void ChSchurProduct::operator()(const DynamicVector<real>& x, DynamicVector<real
     if (data_manager->settings.solver.local_solver_mode == data_manager->settings.solver.solver_mode) {
         if (data_manager->settings.solver.compute_N) {
             output = Nschur * x + E * x;
+        } else if (data_manager->settings.solver.matrix_free_schur) {
+            DynamicVector<real> tmp = data_manager->host_data.M_inv * (data_manager->host_data.D * x);
+            output = D_T * tmp + E * x;
         } else {
             output = D_T * data_manager->host_data.M_invD * x + E * x;
         }
 
+    } else if (data_manager->settings.solver.matrix_free_schur) {
+        // Only the first num_active unilateral constraints and the bilateral constraints are solved for: zero the
+        // other multipliers in the product with D and compute only the corresponding rows of the output.
+        uint num_active = 0;
+        switch (data_manager->settings.solver.local_solver_mode) {
+            case SolverMode::NORMAL:
+                num_active = num_rigid_contacts;
+                break;
+            case SolverMode::SLIDING:
+                num_active = 3 * num_rigid_contacts;
+                break;
+            case SolverMode::SPINNING:
+                num_active = 6 * num_rigid_contacts;
+                break;
+            default:
+                break;
+        }
+        num_active = Min(num_active, num_unilaterals);
+        uint num_dof = data_manager->num_dof;
+
+        DynamicVector<real> x_a(x.size(), real(0));
+        subvector(x_a, 0, num_active) = subvector(x, 0, num_active);
+        subvector(x_a, num_unilaterals, num_bilaterals) = subvector(x, num_unilaterals, num_bilaterals);
+        DynamicVector<real> tmp = data_manager->host_data.M_inv * (data_manager->host_data.D * x_a);
+
+        subvector(output, 0, num_active) =
+            submatrix(D_T, 0, 0, num_active, num_dof) * tmp + subvector(E, 0, num_active) * subvector(x, 0, num_active);
+        subvector(output, num_unilaterals, num_bilaterals) =
+            submatrix(D_T, num_unilaterals, 0, num_bilaterals, num_dof) * tmp +
+            subvector(E, num_unilaterals, num_bilaterals) * subvector(x, num_unilaterals, num_bilaterals);
+
     } else {
         const SubMatrixType& D_n_T = _DNT_;
         const SubMatrixType& D_b_T = _DBT_;
@@ -108,7 +142,12 @@ void ChSchurProductBilateral::Setup(ChMulticoreDataManager* data_container_) {
     if (data_manager->num_bilaterals == 0) {
         return;
     }
-    NschurB = _DBT_ * _MINVDB_;
+    if (data_manager->settings.solver.matrix_free_schur) {
+        uint num_b_dof = _num_rigid_dof_ + _num_shaft_dof_ + _num_motor_dof_;
+        NschurB = _DBT_ * (submatrix(data_manager->host_data.M_inv, 0, 0, num_b_dof, num_b_dof) * _DB_);
+    } else {
+        NschurB = _DBT_ * _MINVDB_;
+    }
 }
 
 void ChSchurProductBilateral::operator()(const DynamicVector<real>& x, DynamicVector<real>& output) {
@@ -18,6 +18,8 @@
 //
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono_multicore/solver/ChSolverMulticore.h"
 
 using namespace chrono;
@@ -31,6 +33,7 @@ void ChProjectConstraints::operator()(real* data) {
 
 ChSolverMulticore::ChSolverMulticore() {
     current_iteration = 0;
+    adaptive_ref = 0;
     rigid_rigid = NULL;
     three_dof = NULL;
     fem = NULL;
@@ -79,3 +82,25 @@ real ChSolverMulticore::LargestEigenValue(ChSchurProduct& SchurProduct, DynamicV
     }
     return lambda;
 }
+
+bool ChSolverMulticore::AdaptiveStop(real residual) {
+    const solver_settings& settings = data_manager->settings.solver;
+    solver_measures& measures = data_manager->measures.solver;
+
+    if (current_iteration == 0) {
+        adaptive_ref = residual;
+        if (measures.step_initial_residual == 0)
+            measures.step_initial_residual = residual;
+        return false;
+    }
+
+    int window = std::max(settings.adaptive_window, 1);
+    if (!settings.adaptive_iterations || current_iteration % window != 0)
+        return false;
+
+    bool stop = residual > (1 - settings.adaptive_min_reduction) * adaptive_ref;
+    adaptive_ref = residual;
+    if (stop)
+        measures.step_early_termination = true;
+    return stop;
+}
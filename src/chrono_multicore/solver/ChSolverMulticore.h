@@ -115,7 +115,27 @@ class CH_MULTICORE_API ChSolverMulticore {
 
     real LargestEigenValue(ChSchurProduct& SchurProduct, DynamicVector<real>& temp, real lambda = 0);
 
+    /// Record the residual at the end of the current iteration and return true if the solve should stop because the
+    /// residual stagnates (see solver_settings::adaptive_iterations).
+    bool AdaptiveStop(real residual);
+
+    /// Store the final step length of a solve, for use with the cache_step_length option.
+    void CacheStepLength(real step_length);
+
+    /// Check whether a solve of the given size can be performed on the GPU (see solver_settings::use_gpu).
+    bool CanSolveGPU(uint size) const;
+
+    /// Solve the full NSC problem on the GPU with the APGD or BB method, starting from the given step length.
+    /// On return, step_length is set to the final step length and gamma to the solution.
+    uint SolveGPU(SolverType type,                ///< APGD or BB
+                  const uint max_iter,            ///< Maximum number of iterations
+                  const DynamicVector<real>& r,   ///< Rhs vector
+                  DynamicVector<real>& gamma,     ///< The vector of unknowns
+                  real& step_length               ///< Step length (in/out)
+    );
+
     int current_iteration;  ///< The current iteration number of the solver
+    real adaptive_ref;      ///< Residual at the start of the current adaptive termination window
 
     ChConstraintRigidRigid* rigid_rigid;
     ChConstraintBilateral* bilateral;
@@ -134,6 +134,14 @@ uint ChSolverMulticoreAPGD::Solve(ChSchurProduct& SchurProduct,
     }
 
     t = 1.0 / L;
+
+    if (CanSolveGPU(size)) {
+        SolveGPU(SolverType::APGD, max_iter, r, gamma, L);
+        CacheStepLength(L);
+        data_manager->system_timer.stop("ChSolverMulticore_Solve");
+        return current_iteration;
+    }
+
     y = gamma;
     // If no iterations are performed or the residual is NAN (which is shouldnt be)
     // make sure that gamma_hat has something inside of it. Otherwise gamma will be
@@ -190,6 +198,10 @@ uint ChSolverMulticoreAPGD::Solve(ChSchurProduct& SchurProduct,
 
         AtIterationEnd(residual, objective_value);
 
+        if (AdaptiveStop(residual)) {
+            break;
+        }
+
         if (data_manager->settings.solver.test_objective) {
             if (objective_value <= data_manager->settings.solver.tolerance_objective) {
                 break;
@@ -215,15 +227,7 @@ uint ChSolverMulticoreAPGD::Solve(ChSchurProduct& SchurProduct,
             UpdateR();
         }
     }
-    if (data_manager->settings.solver.solver_mode == SolverMode::NORMAL) {
-        data_manager->measures.solver.normal_apgd_step_length = L;
-    } else if (data_manager->settings.solver.solver_mode == SolverMode::SLIDING) {
-        data_manager->measures.solver.sliding_apgd_step_length = L;
-    } else if (data_manager->settings.solver.solver_mode == SolverMode::SPINNING) {
-        data_manager->measures.solver.spinning_apgd_step_length = L;
-    } else if (data_manager->settings.solver.solver_mode == SolverMode::BILATERAL) {
-        data_manager->measures.solver.bilateral_apgd_step_length = L;
-    }
+    CacheStepLength(L);
     gamma = gamma_hat;
 
     data_manager->system_timer.stop("ChSolverMulticore_Solve");
@@ -99,6 +99,14 @@ uint ChSolverMulticoreBB::Solve(ChSchurProduct& SchurProduct,
             LargestEigenValue(SchurProduct, temp, data_manager->measures.solver.lambda_max);
         alpha = 1.95 / data_manager->measures.solver.lambda_max;
     }
+
+    if (CanSolveGPU(size)) {
+        SolveGPU(SolverType::BB, max_iter, r, gamma, alpha);
+        CacheStepLength(alpha);
+        data_manager->system_timer.stop("ChSolverMulticore_Solve");
+        return current_iteration;
+    }
+
     real gmma = 1e-4;
     real gdiff = 1.0 / pow(size, 2.0);
     real neg_BB1_fallback = 0.11;
@@ -195,6 +203,10 @@ uint ChSolverMulticoreBB::Solve(ChSchurProduct& SchurProduct,
 
         AtIterationEnd(lastgoodres, objective_value);
 
+        if (AdaptiveStop(lastgoodres)) {
+            break;
+        }
+
         if (data_manager->settings.solver.test_objective) {
             if (objective_value <= data_manager->settings.solver.tolerance_objective) {
                 break;
@@ -208,15 +220,7 @@ uint ChSolverMulticoreBB::Solve(ChSchurProduct& SchurProduct,
         // t4.stop();
     }
     // printf("TIME: [%f %f %f %f]\n", t1(), t2(), t3(), t4());
-    if (data_manager->settings.solver.solver_mode == SolverMode::NORMAL) {
-        data_manager->measures.solver.normal_apgd_step_length = alpha;
-    } else if (data_manager->settings.solver.solver_mode == SolverMode::SLIDING) {
-        data_manager->measures.solver.sliding_apgd_step_length = alpha;
-    } else if (data_manager->settings.solver.solver_mode == SolverMode::SPINNING) {
-        data_manager->measures.solver.spinning_apgd_step_length = alpha;
-    } else if (data_manager->settings.solver.solver_mode == SolverMode::BILATERAL) {
-        data_manager->measures.solver.bilateral_apgd_step_length = alpha;
-    }
+    CacheStepLength(alpha);
     gamma = ml_candidate;
     data_manager->system_timer.stop("ChSolverMulticore_Solve");
     return current_iteration;
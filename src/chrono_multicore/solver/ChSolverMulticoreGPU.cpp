@@ -0,0 +1,156 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Interface between the multicore solvers and their GPU implementations.
+// The problem data (D_T, M_invD, E, friction and cohesion coefficients) is
+// converted to compressed row format and uploaded once per solve.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono_multicore/ChConfigMulticore.h"
+#include "chrono_multicore/solver/ChSolverMulticore.h"
+
+#ifdef CHRONO_MULTICORE_USE_CUDA
+    #include "chrono_multicore/cuda/ChSolverGPU.cuh"
+#endif
+
+using namespace chrono;
+
+void ChSolverMulticore::CacheStepLength(real step_length) {
+    switch (data_manager->settings.solver.solver_mode) {
+        case SolverMode::NORMAL:
+            data_manager->measures.solver.normal_apgd_step_length = step_length;
+            break;
+        case SolverMode::SLIDING:
+            data_manager->measures.solver.sliding_apgd_step_length = step_length;
+            break;
+        case SolverMode::SPINNING:
+            data_manager->measures.solver.spinning_apgd_step_length = step_length;
+            break;
+        case SolverMode::BILATERAL:
+            data_manager->measures.solver.bilateral_apgd_step_length = step_length;
+            break;
+        default:
+            break;
+    }
+}
+
+#ifdef CHRONO_MULTICORE_USE_CUDA
+
+// Copy a row-major blaze sparse matrix in compressed row format
+static void CopyCSR(const CompressedMatrix<real>& M,
+                    std::vector<unsigned int>& offsets,
+                    std::vector<unsigned int>& columns,
+                    std::vector<real>& values) {
+    offsets.resize(M.rows() + 1);
+    columns.resize(M.nonZeros());
+    values.resize(M.nonZeros());
+
+    size_t k = 0;
+    for (size_t i = 0; i < M.rows(); i++) {
+        offsets[i] = (unsigned int)k;
+        for (auto it = M.begin(i); it != M.end(i); ++it) {
+            columns[k] = (unsigned int)it->index();
+            values[k] = it->value();
+            k++;
+        }
+    }
+    offsets[M.rows()] = (unsigned int)k;
+}
+
+bool ChSolverMulticore::CanSolveGPU(uint size) const {
+    const solver_settings& settings = data_manager->settings.solver;
+    if (!settings.use_gpu || settings.update_rhs || settings.compute_N)
+        return false;
+    return size == data_manager->num_constraints && data_manager->node_container->GetNumConstraints() == 0;
+}
+
+uint ChSolverMulticore::SolveGPU(SolverType type,
+                                 const uint max_iter,
+                                 const DynamicVector<real>& r,
+                                 DynamicVector<real>& gamma,
+                                 real& step_length) {
+    const solver_settings& settings = data_manager->settings.solver;
+    const host_container& host_data = data_manager->host_data;
+    uint num_contacts = data_manager->cd_data ? data_manager->cd_data->num_rigid_contacts : 0;
+
+    GPU_NSC_Problem problem;
+    problem.num_constraints = data_manager->num_constraints;
+    problem.num_dof = data_manager->num_dof;
+    problem.num_contacts = num_contacts;
+    problem.num_unilaterals = data_manager->num_unilaterals;
+    problem.solver_mode = settings.solver_mode;
+    problem.local_solver_mode = settings.local_solver_mode;
+
+    CopyCSR(host_data.D_T, problem.D_T_offsets, problem.D_T_columns, problem.D_T_values);
+    if (settings.matrix_free_schur) {
+        CompressedMatrix<real> M_invD = host_data.M_inv * host_data.D;
+        CopyCSR(M_invD, problem.M_invD_offsets, problem.M_invD_columns, problem.M_invD_values);
+    } else {
+        CopyCSR(host_data.M_invD, problem.M_invD_offsets, problem.M_invD_columns, problem.M_invD_values);
+    }
+    problem.E.assign(host_data.E.begin(), host_data.E.end());
+
+    problem.friction.resize(3 * num_contacts);
+    problem.cohesion.resize(num_contacts);
+    for (uint i = 0; i < num_contacts; i++) {
+        problem.friction[3 * i + 0] = host_data.fric_rigid_rigid[i].x;
+        problem.friction[3 * i + 1] = host_data.fric_rigid_rigid[i].y;
+        problem.friction[3 * i + 2] = host_data.fric_rigid_rigid[i].z;
+        problem.cohesion[i] = host_data.coh_rigid_rigid[i];
+    }
+
+    GPU_Solve_Info info;
+    info.max_iterations = max_iter;
+    info.tol_speed = settings.tol_speed;
+    info.test_objective = settings.test_objective;
+    info.tolerance_objective = settings.tolerance_objective;
+    info.step_length = step_length;
+
+    std::vector<real> r_host(r.begin(), r.end());
+    std::vector<real> gamma_host(gamma.begin(), gamma.end());
+
+    if (type == SolverType::BB)
+        current_iteration = GPU_SolveBB(problem, info, r_host, gamma_host);
+    else
+        current_iteration = GPU_SolveAPGD(problem, info, r_host, gamma_host);
+
+    std::copy(gamma_host.begin(), gamma_host.end(), gamma.begin());
+    for (size_t i = 0; i < info.residual_hist.size(); i++)
+        AtIterationEnd(info.residual_hist[i], info.objective_hist[i]);
+
+    data_manager->measures.solver.residual = info.residual;
+    data_manager->measures.solver.objective_value = info.objective_value;
+    step_length = info.step_length;
+
+    return current_iteration;
+}
+
+#else
+
+bool ChSolverMulticore::CanSolveGPU(uint size) const {
+    return false;
+}
+
+uint ChSolverMulticore::SolveGPU(SolverType type,
+                                 const uint max_iter,
+                                 const DynamicVector<real>& r,
+                                 DynamicVector<real>& gamma,
+                                 real& step_length) {
+    return 0;
+}
+
+#endif
@@ -40,7 +40,11 @@ uint ChSolverMulticoreGS::Solve(ChSchurProduct& SchurProduct,
     uint num_rigid_fluid_contacts = data_manager->cd_data->num_rigid_fluid_contacts;
     uint num_bilaterals = data_manager->num_bilaterals;
 
-    CompressedMatrix<real> Nschur = data_manager->host_data.D_T * data_manager->host_data.M_invD;
+    CompressedMatrix<real> Nschur;
+    if (data_manager->settings.solver.matrix_free_schur)
+        Nschur = data_manager->host_data.D_T * (data_manager->host_data.M_inv * data_manager->host_data.D);
+    else
+        Nschur = data_manager->host_data.D_T * data_manager->host_data.M_invD;
     DynamicVector<real> D;
     D.resize(num_constraints, false);
 
@@ -44,7 +44,11 @@ uint ChSolverMulticoreJacobi::Solve(ChSchurProduct& SchurProduct,
     temp.resize(size);
     DynamicVector<real> deltal;
     deltal.resize(size);
-    CompressedMatrix<real> Nschur = data_manager->host_data.D_T * data_manager->host_data.M_invD;
+    CompressedMatrix<real> Nschur;
+    if (data_manager->settings.solver.matrix_free_schur)
+        Nschur = data_manager->host_data.D_T * (data_manager->host_data.M_inv * data_manager->host_data.D);
+    else
+        Nschur = data_manager->host_data.D_T * data_manager->host_data.M_invD;
     DynamicVector<real> D;
     D.resize(num_constraints, false);
     // real eignenval = LargestEigenValue(SchurProduct, temp);
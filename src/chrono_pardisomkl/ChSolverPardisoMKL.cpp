@@ -22,18 +22,32 @@ ChSolverPardisoMKL::ChSolverPardisoMKL(unsigned int num_threads) {
 }
 
 bool ChSolverPardisoMKL::FactorizeMatrix() {
-    m_engine.compute(m_mat);
+    if (m_single_factor) {
+        if (m_analyze)
+            m_engine_single.analyzePattern(m_mat_single);
+        m_engine_single.factorize(m_mat_single);
+        return (m_engine_single.info() == Eigen::Success);
+    }
+
+    if (m_analyze)
+        m_engine.analyzePattern(m_mat);
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
 bool ChSolverPardisoMKL::SolveSystem() {
+    if (m_single_factor) {
+        m_sol = m_engine_single.solve(m_rhs.cast<float>()).cast<double>();
+        return (m_engine_single.info() == Eigen::Success);
+    }
+
     m_sol = m_engine.solve(m_rhs);
     return (m_engine.info() == Eigen::Success);
 }
 
 void ChSolverPardisoMKL::PrintErrorMessage() {
     // There are only three possible return codes (see manageErrorCode in Eigen's PardisoSupport.h)
-    switch (m_engine.info()) {
+    switch (m_single_factor ? m_engine_single.info() : m_engine.info()) {
         case Eigen::Success:
             std::cout << "computation was successful" << std::endl;
             break;
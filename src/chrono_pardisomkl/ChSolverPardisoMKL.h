@@ -76,7 +76,13 @@ class ChApiPardisoMKL ChSolverPardisoMKL : public ChDirectSolverLS {
     /// This function is only called if Factorize or Solve returned false.
     virtual void PrintErrorMessage() override;
 
+    /// The Pardiso solver supports mixed precision factorization.
+    virtual bool SupportsMixedPrecision() const override { return true; }
+
     Eigen::PardisoLU<ChSparseMatrix> m_engine;  ///< underlying Eigen Pardiso interface
+
+    /// Eigen Pardiso interface for single precision factorization
+    Eigen::PardisoLU<Eigen::SparseMatrix<float, Eigen::RowMajor, int>> m_engine_single;
 };
 
 /// Sparse complex Pardiso direct solver.
@@ -122,6 +122,12 @@ void ChParserOpenSim::Parse(ChSystem& system, const std::string& filename) {
     // Strip the parent and stem to use as directory for data files
     m_datapath = filepath.parent_path().str() + "/" + filepath.stem() + "/";
 
+    // Bodies are looked up in the report (rather than in the system) when creating joints and forces, so that the
+    // same model can be parsed into a system several times
+    m_report.bodies.clear();
+    m_report.joints.clear();
+    m_report.forces.clear();
+
     rapidxml::file<char> file(filename.c_str());
 
     xml_document<> doc;
@@ -261,7 +267,7 @@ bool ChParserOpenSim::parseForce(rapidxml::xml_node<>* forceNode,
         std::string name = stringStripCStr(forceNode->first_attribute("name")->value());
         std::cout << "Actuator " << name << std::endl;
         // Chrono should be using std::string
-        auto body = system.SearchBody(stringStripCStr(forceNode->first_node("body")->value()));
+        auto body = m_report.GetBody(stringStripCStr(forceNode->first_node("body")->value()));
         ChVector3d point = strToChVector3<double>(forceNode->first_node("point")->value());
         auto point_global = CStrToBool(forceNode->first_node("point_is_global")->value());
         ChVector3d direction = strToChVector3<double>(forceNode->first_node("direction")->value());
@@ -279,8 +285,8 @@ bool ChParserOpenSim::parseForce(rapidxml::xml_node<>* forceNode,
         return true;
     } else if (stringStripCStr(forceNode->name()) == std::string("TorqueActuator")) {
         std::string name = stringStripCStr(forceNode->first_attribute("name")->value());
-        auto bodyA = system.SearchBody(stringStripCStr(forceNode->first_node("bodyA")->value()));
-        auto bodyB = system.SearchBody(stringStripCStr(forceNode->first_node("bodyB")->value()));
+        auto bodyA = m_report.GetBody(stringStripCStr(forceNode->first_node("bodyA")->value()));
+        auto bodyB = m_report.GetBody(stringStripCStr(forceNode->first_node("bodyB")->value()));
         auto torque_is_global = CStrToBool(forceNode->first_node("torque_is_global")->value());
         ChVector3d axis = strToChVector3<double>(forceNode->first_node("axis")->value());
         auto max_force = std::stod(forceNode->first_node("optimal_force")->value());
@@ -420,7 +426,7 @@ void ChParserOpenSim::initFunctionTable() {
             std::cout << "Making a " << type << " with " << jointNode->first_node("parent_body")->value() << std::endl;
 
         // Get other body for joint
-        auto parent = system->SearchBody(stringStripCStr(jointNode->first_node("parent_body")->value()));
+        auto parent = m_report.GetBody(stringStripCStr(jointNode->first_node("parent_body")->value()));
 
         if (parent != nullptr) {
             if (m_verbose)
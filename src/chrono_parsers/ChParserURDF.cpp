@@ -30,6 +30,9 @@
 #include "chrono/assets/ChVisualShapeCylinder.h"
 #include "chrono/assets/ChVisualShapeModelFile.h"
 
+#include "chrono/core/ChTaskScheduler.h"
+#include "chrono/geometry/ChTriangleMeshCache.h"
+
 #include "chrono/physics/ChLinkMate.h"
 #include "chrono/physics/ChLinkMotorLinearPosition.h"
 #include "chrono/physics/ChLinkMotorLinearSpeed.h"
@@ -55,7 +58,8 @@ using std::endl;
 // Threshold for identifying bodies with zero inertia properties.
 const double inertia_threshold = 1e-6;
 
-ChParserURDF::ChParserURDF(const std::string& filename) : m_filename(filename), m_vis_collision(false), m_sys(nullptr) {
+ChParserURDF::ChParserURDF(const std::string& filename)
+    : m_filename(filename), m_vis_collision(false), m_sys(nullptr), m_meshes_loaded(false) {
     // Read input file into XML string
     std::fstream xml_file(filename, std::fstream::in);
     while (xml_file.good()) {
@@ -245,22 +249,86 @@ std::string ChParserURDF::resolveFilename(const std::string& filename) {
 // -----------------------------------------------------------------------------
 
 void ChParserURDF::PopulateSystem(ChSystem& sys) {
+    m_root_body = AddInstance(sys, m_init_pose, "");
+}
+
+std::shared_ptr<ChBodyAuxRef> ChParserURDF::AddInstance(ChSystem& sys,
+                                                        const ChFrame<>& init_pose,
+                                                        const std::string& prefix) {
     // Cache the containing Chrono system
     m_sys = &sys;
+    m_prefix = prefix;
+    m_bodies.clear();
+    m_new_bodies.clear();
+    m_new_links.clear();
+
+    // Load the collision meshes (once for all instances)
+    loadCollisionMeshes();
 
     // Start at the root body, create the root (if necessary),
-    // then traverse all links recursively to populate the Chrono system
+    // then traverse all links recursively to create the model
+    std::shared_ptr<ChBodyAuxRef> root_body;
     auto root_link = m_model->getRoot();
-    ChFrame<> frame = m_init_pose;
     if (root_link->inertial) {
-        m_root_body = toChBody(root_link);
-        m_root_body->SetFrameRefToAbs(frame);
-        m_sys->AddBody(m_root_body);
+        root_body = toChBody(root_link);
+        root_body->SetFrameRefToAbs(init_pose);
+        m_bodies[root_link->name] = root_body;
+        m_new_bodies.push_back(root_body);
+    }
+    createChildren(root_link, init_pose, root_body);
+
+    // Insert all bodies and joints of this instance in the system at once
+    m_sys->AddBodies(m_new_bodies);
+    m_sys->AddLinks(m_new_links);
+    m_new_bodies.clear();
+    m_new_links.clear();
+    m_bodies.clear();
+
+    return root_body;
+}
+
+std::shared_ptr<ChBody> ChParserURDF::findBody(const std::string& link_name) const {
+    auto body = m_bodies.find(link_name);
+    return body != m_bodies.end() ? body->second : nullptr;
+}
+
+void ChParserURDF::loadCollisionMeshes() {
+    if (m_meshes_loaded)
+        return;
+    m_meshes_loaded = true;
+
+    // Collect the (unique) collision mesh files referenced by the model
+    std::vector<urdf::LinkSharedPtr> links;
+    m_model->getLinks(links);
+    std::vector<std::string> filenames;
+    for (const auto& link : links) {
+        for (const auto& collision : link->collision_array) {
+            if (collision && collision->geometry->type == urdf::Geometry::MESH) {
+                auto mesh = std::static_pointer_cast<urdf::Mesh>(collision->geometry);
+                auto mesh_filename = resolveFilename(mesh->filename);
+                if (m_coll_meshes.insert(std::make_pair(mesh_filename, nullptr)).second)
+                    filenames.push_back(mesh_filename);
+            }
+        }
     }
-    createChildren(root_link, frame);
+
+    // Load the mesh files in parallel
+    std::vector<std::shared_ptr<ChTriangleMeshConnected>> meshes(filenames.size());
+    ChTaskScheduler::GetGlobal().ParallelFor(0, (int)filenames.size(), [&filenames, &meshes](int i) {
+        auto ext = filesystem::path(filenames[i]).extension();
+        if (ext == "obj" || ext == "OBJ")
+            meshes[i] = ChTriangleMeshCache::LoadWavefrontMesh(filenames[i], false);
+        else if (ext == "stl" || ext == "STL")
+            meshes[i] = ChTriangleMeshCache::LoadSTLMesh(filenames[i], true);
+    });
+
+    for (size_t i = 0; i < filenames.size(); i++)
+        m_coll_meshes[filenames[i]] = meshes[i];
 }
 
-void ChParserURDF::createChildren(urdf::LinkConstSharedPtr parent, const ChFrame<>& parent_frame) {
+void ChParserURDF::createChildren(urdf::LinkConstSharedPtr parent,
+                                  const ChFrame<>& parent_frame,
+                                  std::shared_ptr<ChBodyAuxRef>& root_body) {
     for (auto child = parent->child_links.begin(); child != parent->child_links.end(); ++child) {
         // Get the parent joint of the child link and that joint's transform from the parent.
         // This provides the position of the child w.r.t. its parent.
@@ -273,21 +341,22 @@ void ChParserURDF::createChildren(urdf::LinkConstSharedPtr parent, const ChFrame
         auto body = toChBody(*child);
         if (body) {
             body->SetFrameRefToAbs(child_frame);
-            m_sys->AddBody(body);
+            m_bodies[(*child)->name] = body;
+            m_new_bodies.push_back(body);
         }
 
         // Set this as the root body of the model if not already set
-        if (!m_root_body)
-            m_root_body = body;
+        if (!root_body)
+            root_body = body;
 
         // Create the Chrono link between parent and child
         auto link = toChLink((*child)->parent_joint);
         if (link) {
-            m_sys->AddLink(link);
+            m_new_links.push_back(link);
         }
 
         // Process grandchildren
-        createChildren(*child, child_frame);
+        createChildren(*child, child_frame, root_body);
     }
 }
 
@@ -373,7 +442,8 @@ void ChParserURDF::attachCollision(std::shared_ptr<ChBody> body,
     const auto& collision_array = link->collision_array;
 
     // Create the contact material for all collision shapes associated with this body
-    auto link_name = body->GetName();
+    // (strip the instance prefix to obtain the link name)
+    auto link_name = body->GetName().substr(m_prefix.size());
     std::shared_ptr<ChContactMaterial> contact_material;
     if (m_mat_data.find(link_name) != m_mat_data.end())
         contact_material = m_mat_data.find(link_name)->second.CreateMaterial(m_sys->GetContactMethod());
@@ -410,13 +480,12 @@ void ChParserURDF::attachCollision(std::shared_ptr<ChBody> body,
                 case urdf::Geometry::MESH: {
                     auto mesh = std::static_pointer_cast<urdf::Mesh>(collision->geometry);
                     auto mesh_filename = resolveFilename(mesh->filename);
-                    auto ext = filesystem::path(mesh->filename).extension();
 
+                    // Meshes were loaded in loadCollisionMeshes and are shared by all model instances
                     std::shared_ptr<ChTriangleMeshConnected> trimesh;
-                    if (ext == "obj" || ext == "OBJ")
-                        trimesh = ChTriangleMeshConnected::CreateFromWavefrontFile(mesh_filename, false);
-                    else if (ext == "stl" || ext == "STL")
-                        trimesh = ChTriangleMeshConnected::CreateFromSTLFile(mesh_filename, true);
+                    auto cached = m_coll_meshes.find(mesh_filename);
+                    if (cached != m_coll_meshes.end())
+                        trimesh = cached->second;
 
                     if (!trimesh) {
                         cout << "Warning: Unsupported format for collision mesh file <" << mesh_filename << ">."
@@ -484,7 +553,7 @@ std::shared_ptr<ChBodyAuxRef> ChParserURDF::toChBody(urdf::LinkConstSharedPtr li
 
         // Get the parent link and the Chrono parent body
         const auto& parent_link_name = link->parent_joint->parent_link_name;
-        const auto& parent_body = m_sys->SearchBody(parent_link_name);
+        const auto& parent_body = findBody(parent_link_name);
 
         // Add to the list of discarded bodies and cache the body's parent
         // (this will be used to attach children joints of this body)
@@ -506,7 +575,7 @@ std::shared_ptr<ChBodyAuxRef> ChParserURDF::toChBody(urdf::LinkConstSharedPtr li
 
     // Create the Chrono body
     auto body = chrono_types::make_shared<ChBodyAuxRef>();
-    body->SetName(link->name);
+    body->SetName(m_prefix + link->name);
     body->SetFrameCOMToRef(toChFrame(inertial->origin));
     body->SetMass(mass);
     body->SetInertiaXX(inertia_moments);
@@ -539,8 +608,8 @@ std::shared_ptr<ChLink> ChParserURDF::toChLink(urdf::JointSharedPtr& joint) {
     }
 
     // Find the parent and child Chrono bodies
-    const auto& parent = m_sys->SearchBody(parent_link_name);
-    const auto& child = m_sys->SearchBody(child_link_name);
+    const auto& parent = findBody(parent_link_name);
+    const auto& child = findBody(child_link_name);
 
     // The parent body may not have been created (e.g., when using a dummy root), but the child must always exist.
     if (!parent)
@@ -581,7 +650,7 @@ std::shared_ptr<ChLink> ChParserURDF::toChLink(urdf::JointSharedPtr& joint) {
             joint_frame.SetRot(joint_frame.GetRotMat() * ChMatrix33<>(d2, d3, d1));  // Chrono rot. motor axis along Z
             revolute->Initialize(parent, child, joint_frame);
             revolute->SetMotorFunction(actuation_fun);
-            revolute->SetName(joint_name);
+            revolute->SetName(m_prefix + joint_name);
             return revolute;
         }
 
@@ -601,7 +670,7 @@ std::shared_ptr<ChLink> ChParserURDF::toChLink(urdf::JointSharedPtr& joint) {
             joint_frame.SetRot(joint_frame.GetRotMat() * ChMatrix33<>(d1, d2, d3));  // Chrono lin. motor axis along X
             prismatic->Initialize(parent, child, joint_frame);
             prismatic->SetMotorFunction(actuation_fun);
-            prismatic->SetName(joint_name);
+            prismatic->SetName(m_prefix + joint_name);
             return prismatic;
         }
     } else {
@@ -615,7 +684,7 @@ std::shared_ptr<ChLink> ChParserURDF::toChLink(urdf::JointSharedPtr& joint) {
             }
             joint_frame.SetRot(joint_frame.GetRotMat() * ChMatrix33<>(d2, d3, d1));  // Chrono revolute axis along Z
             revolute->Initialize(parent, child, joint_frame);
-            revolute->SetName(joint_name);
+            revolute->SetName(m_prefix + joint_name);
             return revolute;
         }
 
@@ -628,14 +697,14 @@ std::shared_ptr<ChLink> ChParserURDF::toChLink(urdf::JointSharedPtr& joint) {
             }
             joint_frame.SetRot(joint_frame.GetRotMat() * ChMatrix33<>(d2, d3, d1));  // Chrono prismatic axis along Z
             prismatic->Initialize(parent, child, joint_frame);
-            prismatic->SetName(joint_name);
+            prismatic->SetName(m_prefix + joint_name);
             return prismatic;
         }
 
         if (joint_type == urdf::Joint::FLOATING) {
             auto free = chrono_types::make_shared<ChLinkLockFree>();
             free->Initialize(parent, child, joint_frame);
-            free->SetName(joint_name);
+            free->SetName(m_prefix + joint_name);
             return free;
         }
 
@@ -643,14 +712,14 @@ std::shared_ptr<ChLink> ChParserURDF::toChLink(urdf::JointSharedPtr& joint) {
             auto planar = chrono_types::make_shared<ChLinkLockPointPlane>();
             joint_frame.SetRot(joint_frame.GetRotMat() * ChMatrix33<>(d2, d3, d1));  // Chrono plane normal along Z
             planar->Initialize(parent, child, joint_frame);
-            planar->SetName(joint_name);
+            planar->SetName(m_prefix + joint_name);
             return planar;
         }
 
         if (joint_type == urdf::Joint::FIXED) {
             auto fixed = chrono_types::make_shared<ChLinkLockLock>();
             fixed->Initialize(parent, child, joint_frame);
-            fixed->SetName(joint_name);
+            fixed->SetName(m_prefix + joint_name);
             return fixed;
         }
     }
@@ -26,6 +26,7 @@
 #include "chrono/physics/ChLinkBase.h"
 #include "chrono/physics/ChLinkMotor.h"
 #include "chrono/physics/ChContactMaterial.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
 
 #include <urdf_parser/urdf_parser.h>
 
@@ -113,6 +114,13 @@ class ChApiParsers ChParserURDF {
     /// Create the Chrono model in the given system from the parsed URDF model.
     void PopulateSystem(ChSystem& sys);
 
+    /// Create an additional instance of the Chrono model in the given system, with the specified root pose.
+    /// This function can be called repeatedly to create many copies of the model from a single parsed URDF file. The
+    /// collision mesh files are loaded (in parallel) only once and shared by all instances. The names of all bodies and
+    /// joints of the new instance are prefixed with the given string; use these names with GetChBody and GetChLink.
+    /// Return the root body of the new instance.
+    std::shared_ptr<ChBodyAuxRef> AddInstance(ChSystem& sys, const ChFrame<>& init_pose, const std::string& prefix);
+
     /// Get the root body of the Chrono model.
     /// This function must be called after PopulateSystem.
     std::shared_ptr<ChBodyAuxRef> GetRootChBody() const;
@@ -161,7 +169,15 @@ class ChApiParsers ChParserURDF {
     std::shared_ptr<ChLink> toChLink(urdf::JointSharedPtr& joint);
 
     /// Recursively create bodies and joints in the Chrono model.
-    void createChildren(urdf::LinkConstSharedPtr parent, const ChFrame<>& parent_frame);
+    void createChildren(urdf::LinkConstSharedPtr parent,
+                        const ChFrame<>& parent_frame,
+                        std::shared_ptr<ChBodyAuxRef>& root_body);
+
+    /// Find the body created for the specified link in the current model instance.
+    std::shared_ptr<ChBody> findBody(const std::string& link_name) const;
+
+    /// Load all collision meshes referenced by the URDF model (in parallel, through the mesh cache).
+    void loadCollisionMeshes();
 
     /// Attach visualization assets to a Chrono body.
     void attachVisualization(std::shared_ptr<ChBody> body, urdf::LinkConstSharedPtr link, const ChFrame<>& ref_frame);
@@ -187,6 +203,13 @@ class ChApiParsers ChParserURDF {
     std::map<std::string, MeshCollisionType> m_coll_type;     ///< mesh collision type
     std::map<std::string, ActuationType> m_actuated_joints;   ///< actuated joints
     ChContactMaterialData m_default_mat_data;                 ///< default contact material data
+
+    std::string m_prefix;                                      ///< name prefix of the instance being created
+    std::map<std::string, std::shared_ptr<ChBody>> m_bodies;   ///< bodies of the instance being created (by link)
+    std::vector<std::shared_ptr<ChBody>> m_new_bodies;         ///< bodies to be added to the system
+    std::vector<std::shared_ptr<ChLinkBase>> m_new_links;      ///< joints to be added to the system
+    bool m_meshes_loaded;                                      ///< collision meshes already loaded?
+    std::map<std::string, std::shared_ptr<ChTriangleMeshConnected>> m_coll_meshes;  ///< collision meshes (by file)
 };
 
 /// @} parsers_module
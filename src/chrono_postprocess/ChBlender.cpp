@@ -12,6 +12,7 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <cstdint>
 #include <iomanip>
 #include <sstream>
 
@@ -86,6 +87,10 @@ ChBlender::ChBlender(ChSystem* system) : ChPostProcessBase(system) {
     contacts_vector_tip = true;
     wireframe_thickness = 0.001;
     single_asset_file = true;
+    binary_states = false;
+    binary_tolerance = 0;
+    binary_keyframe_interval = 100;
+    binary_keyframe_count = 0;
     rank = -1;
 
     SetBlenderUp_is_ChronoY();
@@ -175,6 +180,12 @@ void ChBlender::SetLight(ChVector3d location, ChColor color, bool cast_shadow) {
     def_light_cast_shadows = cast_shadow;
 }
 
+void ChBlender::SetUseBinaryStates(bool use, double tolerance, unsigned int keyframe_interval) {
+    binary_states = use;
+    binary_tolerance = tolerance;
+    binary_keyframe_interval = std::max(keyframe_interval, 1u);
+}
+
 void ChBlender::SetShowCOGs(bool show, double msize) {
     COGs_show = show;
     if (show)
@@ -270,6 +281,8 @@ void ChBlender::ExportScript(const std::string& filename) {
     m_blender_frame_shapes.clear();
     m_blender_frame_materials.clear();
     m_blender_cameras.clear();
+    m_binary_frames.clear();
+    binary_prev_file.clear();
 
     // Create directories
     if (base_path != "") {
@@ -353,11 +366,67 @@ void ChBlender::ExportScript(const std::string& filename) {
             assets_file << ")" << std::endl;
             assets_file << "bpy.context.scene.camera = new_object\n" << std::endl;
         }
+
+        // write the functions for loading body states from binary files (see ExportBinaryStates)
+        if (binary_states) {
+            assets_file
+                << "import os\n"
+                << "import struct\n"
+                << "\n"
+                << "def chrono_binary_register(body_id, name):\n"
+                << "    objects = bpy.app.driver_namespace.setdefault('chrono_binary_objects', {})\n"
+                << "    ob = bpy.data.objects.get(name)\n"
+                << "    if ob is None:\n"
+                << "        return\n"
+                << "    coll = bpy.data.collections.get('chrono_binary_objects')\n"
+                << "    if coll is None:\n"
+                << "        coll = bpy.data.collections.new('chrono_binary_objects')\n"
+                << "        bpy.context.scene.collection.children.link(coll)\n"
+                << "    for o in [ob] + list(ob.children_recursive):\n"
+                << "        for c in list(o.users_collection):\n"
+                << "            c.objects.unlink(o)\n"
+                << "        coll.objects.link(o)\n"
+                << "    objects[body_id] = name\n"
+                << "\n"
+                << "def chrono_load_binary_states(filename):\n"
+                << "    ns = bpy.app.driver_namespace\n"
+                << "    objects = ns.get('chrono_binary_objects', {})\n"
+                << "    head = struct.Struct('<4sIIIdII')\n"
+                << "    rec = struct.Struct('<Q7d')\n"
+                << "    # collect the files to load: back to the last key frame, or to the last loaded file\n"
+                << "    chain = []\n"
+                << "    last = filename\n"
+                << "    while filename:\n"
+                << "        with open(filename, 'rb') as f:\n"
+                << "            data = f.read()\n"
+                << "        magic, version, frame, key, time, count, prev_len = head.unpack_from(data, 0)\n"
+                << "        chain.append((data, count, head.size + prev_len))\n"
+                << "        prev = data[head.size:head.size + prev_len].decode()\n"
+                << "        prev = os.path.join(os.path.dirname(filename), prev) if prev else ''\n"
+                << "        if key or prev == ns.get('chrono_binary_last'):\n"
+                << "            break\n"
+                << "        filename = prev\n"
+                << "    for data, count, offset in reversed(chain):\n"
+                << "        for i in range(count):\n"
+                << "            body_id, px, py, pz, e0, e1, e2, e3 = rec.unpack_from(data, offset + i * rec.size)\n"
+                << "            ob = bpy.data.objects.get(objects.get(body_id, ''))\n"
+                << "            if ob is not None:\n"
+                << "                ob.location = (px, py, pz)\n"
+                << "                ob.rotation_mode = 'QUATERNION'\n"
+                << "                ob.rotation_quaternion = (e0, e1, e2, e3)\n"
+                << "    ns['chrono_binary_last'] = last\n"
+                << "\n"
+                << "bpy.app.driver_namespace['chrono_load_binary_states'] = chrono_load_binary_states\n"
+                << std::endl;
+        }
     }
 
     // This forces saving the non-mutable assets in the assets_file, at initial state.
     ExportData();
 
+    // The binary state files of the simulation loop start again with a key frame
+    binary_prev_file.clear();
+
     this->framenumber--;  // so that it starts again from 0 when calling ExportData() in the simulation while() loop:
 }
 
@@ -994,7 +1063,9 @@ void ChBlender::ExportMaterials(std::ofstream& mfile,
 
 void ChBlender::ExportItemState(std::ofstream& state_file,
                                 std::shared_ptr<ChPhysicsItem> item,
-                                const ChFrame<>& parentframe) {
+                                const ChFrame<>& parentframe,
+                                const std::string& name) {
+    const std::string& objname = name.empty() ? item->GetName() : name;
     auto vis_model = item->GetVisualModel();
 
     bool has_stored_assets = false;
@@ -1019,13 +1090,13 @@ void ChBlender::ExportItemState(std::ofstream& state_file,
 
     if (has_stored_assets) {
         if (auto particleclones = std::dynamic_pointer_cast<ChParticleCloud>(item)) {
-            state_file << "make_chrono_object_clones('" << item->GetName() << "',"
+            state_file << "make_chrono_object_clones('" << objname << "',"
                        << "(" << parentframe.GetPos().x() << "," << parentframe.GetPos().y() << ","
                        << parentframe.GetPos().z() << "),"
                        << "(" << parentframe.GetRot().e0() << "," << parentframe.GetRot().e1() << ","
                        << parentframe.GetRot().e2() << "," << parentframe.GetRot().e3() << "), " << std::endl;
         } else {
-            state_file << "make_chrono_object_assetlist('" << item->GetName() << "',"
+            state_file << "make_chrono_object_assetlist('" << objname << "',"
                        << "(" << parentframe.GetPos().x() << "," << parentframe.GetPos().y() << ","
                        << parentframe.GetPos().z() << "),"
                        << "(" << parentframe.GetRot().e0() << "," << parentframe.GetRot().e1() << ","
@@ -1133,6 +1204,91 @@ void ChBlender::ExportItemState(std::ofstream& state_file,
     }
 }
 
+// A body can be saved in binary files if all its visual shapes are saved (once) in the assets file
+bool ChBlender::IsBinaryBody(std::shared_ptr<ChBody> body) const {
+    if (!single_asset_file || !body->GetCameras().empty() ||
+        m_custom_commands.find((size_t)body.get()) != m_custom_commands.end())
+        return false;
+
+    const auto& shape_instances = body->GetVisualModel()->GetShapeInstances();
+    if (shape_instances.empty())
+        return false;
+    for (const auto& shape_instance : shape_instances) {
+        const auto& shape = shape_instance.first;
+        if (shape->IsMutable() || m_blender_shapes.find((size_t)shape.get()) == m_blender_shapes.end())
+            return false;
+    }
+
+    return true;
+}
+
+// Save the positions and rotations of bodies in a binary file, with the layout
+//    header:  char[4] "CHBT", uint32 version, uint32 frame number, uint32 key frame flag, double time,
+//             uint32 number of bodies, uint32 length of previous file name, previous file name
+//    bodies:  uint64 identifier, double[3] position, double[4] rotation quaternion (in Blender frame)
+// A key frame contains all bodies. Other frames only contain the bodies that moved since the previous frame, and the
+// name of the previous file, so that the Blender loader can go back to the last loaded file, or to the key frame.
+// Bodies are created once in the assets file, at their first appearance.
+void ChBlender::ExportBinaryStates(std::ofstream& assets_file, std::ofstream& state_file, const std::string& filename) {
+    bool key = binary_prev_file.empty() || binary_keyframe_count >= binary_keyframe_interval;
+    if (key)
+        binary_keyframe_count = 0;
+    binary_keyframe_count++;
+
+    std::vector<std::pair<uint64_t, ChFrame<>>> states;
+    for (const auto& item : m_items) {
+        auto body = std::dynamic_pointer_cast<ChBody>(item);
+        if (!body || !body->GetVisualModel() || !IsBinaryBody(body))
+            continue;
+
+        size_t id = (size_t)body.get();
+        ChFrame<> frame = body->GetFrameRefToAbs() >> blender_frame;
+
+        auto last = m_binary_frames.find(id);
+        if (last == m_binary_frames.end()) {
+            std::string objname("body_" + unique_bl_id(id));
+            ExportItemState(assets_file, body, frame, objname);
+            assets_file << "chrono_binary_register(" << id << ", '" << objname << "')\n" << std::endl;
+        } else if (!key && (frame.GetPos() - last->second.GetPos()).Length() <= binary_tolerance &&
+                   (frame.GetRot() - last->second.GetRot()).Length() <= binary_tolerance) {
+            continue;
+        }
+
+        m_binary_frames[id] = frame;
+        states.push_back({(uint64_t)id, frame});
+    }
+
+    std::string bin_filename = filename + ".bin";
+    std::ofstream bin_file(base_path + bin_filename, std::ios::binary);
+    if (!bin_file.good())
+        throw std::runtime_error("Can't save data into file " + bin_filename);
+
+    auto write = [&bin_file](const auto& val) { bin_file.write(reinterpret_cast<const char*>(&val), sizeof(val)); };
+
+    std::string prev = key ? "" : binary_prev_file;
+    bin_file.write("CHBT", 4);
+    write((uint32_t)1);
+    write((uint32_t)framenumber);
+    write((uint32_t)(key ? 1 : 0));
+    write(mSystem->GetChTime());
+    write((uint32_t)states.size());
+    write((uint32_t)prev.size());
+    bin_file.write(prev.data(), prev.size());
+    for (const auto& state : states) {
+        const auto& pos = state.second.GetPos();
+        const auto& rot = state.second.GetRot();
+        write(state.first);
+        for (double val : {pos.x(), pos.y(), pos.z(), rot.e0(), rot.e1(), rot.e2(), rot.e3()})
+            write(val);
+    }
+
+    binary_prev_file = filesystem::path(bin_filename).filename();
+
+    std::string abspath_bin = filesystem::path(base_path + bin_filename).make_absolute().str();
+    std::replace(abspath_bin.begin(), abspath_bin.end(), '\\', '/');
+    state_file << "bpy.app.driver_namespace['chrono_load_binary_states']('" << abspath_bin << "')\n" << std::endl;
+}
+
 // This function is used at each timestep to export data formatted in a way that it can be load with the python scripts
 // generated by ExportScript(). The generated filename must be set at the beginning of the animation via
 // SetOutputDataFilebase(), and then a number is automatically appended and incremented at each ExportData(), e.g.,
@@ -1180,8 +1336,9 @@ void ChBlender::ExportData(const std::string& filename) {
             if (!item->GetVisualModel())
                 continue;
 
-            // saving a body?
-            if (const auto& body = std::dynamic_pointer_cast<ChBody>(item)) {
+            // saving a body? (bodies saved in binary files are processed in ExportBinaryStates)
+            const auto& body = std::dynamic_pointer_cast<ChBody>(item);
+            if (body && !(binary_states && IsBinaryBody(body))) {
                 // Get the current coordinate frame of the i-th object
                 const ChFrame<>& bodyframe = body->GetFrameRefToAbs();
 
@@ -1228,6 +1385,10 @@ void ChBlender::ExportData(const std::string& filename) {
 
         }  // end loop on objects
 
+        // Save positions and rotations of bodies in binary file
+        if (binary_states)
+            ExportBinaryStates(assets_file, state_file, filename);
+
         // #) saving contacts ?
         if (this->mSystem->GetNumContacts() &&
             (this->contacts_show == ContactSymbolType::VECTOR || this->contacts_show == ContactSymbolType::SPHERE)) {
@@ -235,6 +235,16 @@ class ChApiPostProcess ChBlender : public ChPostProcessBase {
     /// would allow assets whose settings change during time (ex time-changing colors)
     void SetUseSingleAssetFile(bool use) { single_asset_file = use; }
 
+    /// Enable/disable binary export of body positions and rotations (default: false).
+    /// If enabled, bodies whose visual shapes are all saved once in the single assets file (see SetUseSingleAssetFile)
+    /// are created only once, in the assets file, and their positions and rotations are then saved at each
+    /// ExportData() in a binary file (state00001.bin, state00002.bin, etc.) instead of the .py state file. Only bodies
+    /// that moved by more than the given tolerance since the last exported frame are saved, except at key frames
+    /// (every 'keyframe_interval' frames) which contain all bodies, so that frames can also be loaded out of order.
+    /// The Python function reading the binary files is defined in the assets file. Other items (particle clouds, FEA
+    /// meshes, bodies with mutable shapes, cameras, or custom commands) are exported as usual.
+    void SetUseBinaryStates(bool use, double tolerance = 0, unsigned int keyframe_interval = 100);
+
     /// Se the rank of this process. This is useful when doing parallel simulations on multiple computing
     /// nodes, each with its own ChBlender exporter, each generating .py files in different directories, and later
     /// you want to load all them in a single Blender project: this is possible tanks to the "Merge" mode
@@ -253,7 +263,12 @@ class ChApiPostProcess ChBlender : public ChPostProcessBase {
                          const std::vector<std::shared_ptr<ChVisualMaterial>>& materials,
                          bool per_frame,
                          std::shared_ptr<ChVisualShape> mshape);
-    void ExportItemState(std::ofstream& state_file, std::shared_ptr<ChPhysicsItem> item, const ChFrame<>& parentframe);
+    void ExportItemState(std::ofstream& state_file,
+                         std::shared_ptr<ChPhysicsItem> item,
+                         const ChFrame<>& parentframe,
+                         const std::string& name = "");
+    void ExportBinaryStates(std::ofstream& assets_file, std::ofstream& state_file, const std::string& filename);
+    bool IsBinaryBody(std::shared_ptr<ChBody> body) const;
 
     const std::string unique_bl_id(size_t mpointer) const;
 
@@ -334,6 +349,13 @@ class ChApiPostProcess ChBlender : public ChPostProcessBase {
 
     bool single_asset_file;
 
+    bool binary_states;                                     ///< save body states in binary files
+    double binary_tolerance;                                ///< minimum body motion saved in binary files
+    unsigned int binary_keyframe_interval;                  ///< number of frames between binary key frames
+    unsigned int binary_keyframe_count;                     ///< number of binary frames since the last key frame
+    std::string binary_prev_file;                           ///< last binary file (empty: next is a key frame)
+    std::unordered_map<size_t, ChFrame<>> m_binary_frames;  ///< last saved frames of bodies in binary files
+
     int rank;
 };
 
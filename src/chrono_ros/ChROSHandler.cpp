@@ -39,5 +39,16 @@ void ChROSHandler::Update(double time, double step) {
     m_tick_count++;
 }
 
+void ChROSHandler::Publish(std::function<void()> task) {
+    // Keep the publications of this handler in order; also rethrows the exception of the previous task, if any
+    if (m_pending_publish.valid())
+        m_pending_publish.get();
+
+    if (m_publisher_pool)
+        m_pending_publish = m_publisher_pool->Submit(std::move(task));
+    else
+        task();
+}
+
 }  // namespace ros
 }  // namespace chrono
\ No newline at end of file
@@ -21,10 +21,13 @@
 
 #include "chrono_ros/ChApiROS.h"
 #include "chrono_ros/ChROSInterface.h"
+#include "chrono_ros/ChROSPublisherPool.h"
 
 #include <string>
 #include <memory>
 #include <chrono>
+#include <functional>
+#include <future>
 
 namespace chrono {
 namespace ros {
@@ -67,10 +70,25 @@ class CH_ROS_API ChROSHandler {
     /// @param time the current simulation time
     virtual void Tick(double time) = 0;
 
+    /// Publish from the publisher threads of the manager, if enabled, or immediately otherwise.
+    /// Handlers with costly messages should take a snapshot of their data in Tick() and pass the serialization and
+    /// publication to this function. The task must only use data it owns or shares (the snapshot, the publisher),
+    /// never members of the handler. The tasks of a handler run in order: a new task waits for the previous one.
+    /// @param task the publishing task
+    void Publish(std::function<void()> task);
+
   private:
+    /// Set the publisher threads used by Publish() (null to publish on the simulation thread)
+    void SetPublisherPool(std::shared_ptr<ChROSPublisherPool> pool) { m_publisher_pool = pool; }
+
     const double m_update_rate;  ///< Update rate of the handler
     uint64_t m_tick_count;  ///< Number of times Tick() has been called
     double m_time_elapsed_since_last_tick;  ///< Time elapsed since last tick
+
+    std::shared_ptr<ChROSPublisherPool> m_publisher_pool;  ///< publisher threads (null if publishing inline)
+    std::future<void> m_pending_publish;                   ///< last task submitted to the publisher threads
+
+    friend class ChROSManager;
 };
 
 /// @} ros_handlers
@@ -20,6 +20,7 @@
 
 #include "chrono_ros/ChROSInterface.h"
 #include "chrono_ros/ChROSHandler.h"
+#include "chrono_ros/ChROSPublisherPool.h"
 
 #include "chrono/core/ChTypes.h"
 
@@ -54,8 +55,15 @@ bool ChROSManager::Update(double time, double step) {
 }
 
 void ChROSManager::RegisterHandler(std::shared_ptr<ChROSHandler> handler) {
+    handler->SetPublisherPool(m_publisher_pool);
     m_handlers.push_back(handler);
 }
 
+void ChROSManager::SetNumPublisherThreads(int num_threads) {
+    m_publisher_pool = num_threads > 0 ? chrono_types::make_shared<ChROSPublisherPool>(num_threads) : nullptr;
+    for (auto handler : m_handlers)
+        handler->SetPublisherPool(m_publisher_pool);
+}
+
 }  // namespace ros
 }  // namespace chrono
\ No newline at end of file
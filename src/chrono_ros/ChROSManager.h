@@ -33,6 +33,7 @@ namespace ros {
 
 class ChROSInterface;
 class ChROSHandler;
+class ChROSPublisherPool;
 
 /// Managers the ROS handlers and their registration/updates
 class CH_ROS_API ChROSManager {
@@ -51,6 +52,11 @@ class CH_ROS_API ChROSManager {
     /// Register a new handler
     void RegisterHandler(std::shared_ptr<ChROSHandler> handler);
 
+    /// Set the number of threads used by the handlers to publish their messages. With 0 threads (default), messages
+    /// are published on the simulation thread, in Update(). Otherwise handlers only snapshot their data in Update()
+    /// and large messages (images, point clouds, transforms) are serialized and published by these threads.
+    void SetNumPublisherThreads(int num_threads);
+
     /// Get the ChROSInterface
     std::shared_ptr<ChROSInterface> GetInterface() { return m_interface; }
 
@@ -58,6 +64,8 @@ class CH_ROS_API ChROSManager {
     std::shared_ptr<ChROSInterface> m_interface;
 
     std::vector<std::shared_ptr<ChROSHandler>> m_handlers;
+
+    std::shared_ptr<ChROSPublisherPool> m_publisher_pool;  ///< publisher threads (null if publishing inline)
 };
 
 /// @}
@@ -0,0 +1,75 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Pool of threads used by the ROS handlers to publish off the simulation thread
+//
+// =============================================================================
+
+#include "chrono_ros/ChROSPublisherPool.h"
+
+#include <algorithm>
+
+namespace chrono {
+namespace ros {
+
+ChROSPublisherPool::ChROSPublisherPool(int num_threads) : m_stop(false) {
+    for (int i = 0; i < std::max(num_threads, 1); i++)
+        m_threads.emplace_back(&ChROSPublisherPool::Run, this);
+}
+
+ChROSPublisherPool::~ChROSPublisherPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_condition.notify_all();
+
+    for (auto& thread : m_threads)
+        thread.join();
+}
+
+std::future<void> ChROSPublisherPool::Submit(std::function<void()> task) {
+    std::packaged_task<void()> packaged_task(std::move(task));
+    auto future = packaged_task.get_future();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(std::move(packaged_task));
+    }
+    m_condition.notify_one();
+
+    return future;
+}
+
+void ChROSPublisherPool::Run() {
+    while (true) {
+        std::packaged_task<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+
+            // Only stop once all queued tasks were executed
+            if (m_tasks.empty())
+                return;
+
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+
+        // Exceptions are stored in the future of the task
+        task();
+    }
+}
+
+}  // namespace ros
+}  // namespace chrono
@@ -0,0 +1,70 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Pool of threads used by the ROS handlers to publish off the simulation thread
+//
+// =============================================================================
+
+#ifndef CH_ROS_PUBLISHER_POOL_H
+#define CH_ROS_PUBLISHER_POOL_H
+
+#include "chrono_ros/ChApiROS.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace chrono {
+namespace ros {
+
+/// @addtogroup ros_core
+/// @{
+
+/// Pool of threads executing publishing tasks submitted by the handlers (see ChROSManager::SetNumPublisherThreads).
+/// Tasks are executed in submission order, possibly concurrently if the pool has several threads.
+class CH_ROS_API ChROSPublisherPool {
+  public:
+    /// Create the pool and start the specified number of threads (at least one).
+    explicit ChROSPublisherPool(int num_threads);
+
+    /// Execute the tasks that are still queued, then stop the threads.
+    ~ChROSPublisherPool();
+
+    /// Queue a task. The returned future becomes ready once the task was executed, and holds the exception the task
+    /// may have thrown.
+    std::future<void> Submit(std::function<void()> task);
+
+    /// Get the number of threads of the pool
+    int GetNumThreads() const { return static_cast<int>(m_threads.size()); }
+
+  private:
+    void Run();
+
+    std::vector<std::thread> m_threads;              ///< worker threads
+    std::deque<std::packaged_task<void()>> m_tasks;  ///< queued tasks
+    std::mutex m_mutex;                              ///< protects the task queue
+    std::condition_variable m_condition;             ///< signals new tasks or stop
+    bool m_stop;                                     ///< set when the pool is destroyed
+};
+
+/// @} ros_core
+
+}  // namespace ros
+}  // namespace chrono
+
+#endif
@@ -31,7 +31,7 @@ ChROSTFHandler::ChROSTFHandler(double update_rate) : ChROSHandler(update_rate) {
 bool ChROSTFHandler::Initialize(std::shared_ptr<ChROSInterface> interface) {
     auto node = interface->GetNode();
 
-    m_tf_broadcaster = std::make_unique<tf2_ros::TransformBroadcaster>(node);
+    m_tf_broadcaster = std::make_shared<tf2_ros::TransformBroadcaster>(node);
 
     return true;
 }
@@ -144,7 +144,10 @@ void ChROSTFHandler::Tick(double time) {
         transforms.push_back(tf_msg);
     }
 
-    m_tf_broadcaster->sendTransform(transforms);
+    // The transforms are a snapshot of the current frames, they can be sent from the publisher threads
+    Publish([broadcaster = m_tf_broadcaster, transforms = std::move(transforms)]() {
+        broadcaster->sendTransform(transforms);
+    });
 }
 
 }  // namespace ros
@@ -102,7 +102,7 @@ class ChROSTFHandler : public ChROSHandler {
   private:
     std::vector<std::pair<ChROSTransform, ChROSTransform>> m_transforms;  ///< The transforms to publish
 
-    std::unique_ptr<tf2_ros::TransformBroadcaster> m_tf_broadcaster;  ///< The tf broadcaster
+    std::shared_ptr<tf2_ros::TransformBroadcaster> m_tf_broadcaster;  ///< The tf broadcaster
 };
 
 /// @} ros_handlers
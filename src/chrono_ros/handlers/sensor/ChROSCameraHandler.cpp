@@ -50,12 +50,13 @@ bool ChROSCameraHandler::Initialize(std::shared_ptr<ChROSInterface> interface) {
 
     m_publisher = interface->GetNode()->create_publisher<sensor_msgs::msg::Image>(m_topic_name, 1);
 
-    m_image.header.frame_id = m_camera->GetName();
-    m_image.width = m_camera->GetWidth() / m_camera->GetSampleFactor();
-    m_image.height = m_camera->GetHeight() / m_camera->GetSampleFactor();
-    m_image.encoding = "rgba8";
-    m_image.step = sizeof(PixelRGBA8) * m_image.width;
-    m_image.data.resize(m_image.step * m_image.height);
+    m_image = std::make_shared<sensor_msgs::msg::Image>();
+    m_image->header.frame_id = m_camera->GetName();
+    m_image->width = m_camera->GetWidth() / m_camera->GetSampleFactor();
+    m_image->height = m_camera->GetHeight() / m_camera->GetSampleFactor();
+    m_image->encoding = "rgba8";
+    m_image->step = sizeof(PixelRGBA8) * m_image->width;
+    m_image->data.resize(m_image->step * m_image->height);
 
     return true;
 }
@@ -68,12 +69,15 @@ void ChROSCameraHandler::Tick(double time) {
         return;
     }
 
-    m_image.header.stamp = ChROSHandlerUtilities::GetROSTimestamp(time);
+    // Snapshot the image. The message is reused unless it is still held by the previous publishing task.
+    if (m_image.use_count() > 1)
+        m_image = std::make_shared<sensor_msgs::msg::Image>(*m_image);
+
+    m_image->header.stamp = ChROSHandlerUtilities::GetROSTimestamp(time);
     const uint8_t* ptr = reinterpret_cast<const uint8_t*>(rgba8_ptr->Buffer.get());
-    m_image.data.assign(ptr, ptr + m_image.step * m_image.height);
+    m_image->data.assign(ptr, ptr + m_image->step * m_image->height);
 
-    // TODO: The buffer above may be released (?) after this call. Is this a problem? Guess is no.
-    m_publisher->publish(m_image);
+    Publish([publisher = m_publisher, image = m_image]() { publisher->publish(*image); });
 }
 
 }  // namespace ros
@@ -54,7 +54,7 @@ class ChROSCameraHandler : public ChROSHandler {
     std::shared_ptr<chrono::sensor::ChCameraSensor> m_camera;  ///< handle to the camera sensor
 
     const std::string m_topic_name;                                     ///< name of the topic to publish to
-    sensor_msgs::msg::Image m_image;                                    ///< the image message to publish
+    std::shared_ptr<sensor_msgs::msg::Image> m_image;                   ///< the image message to publish
     rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr m_publisher;  ///< the publisher for the image message
 };
 
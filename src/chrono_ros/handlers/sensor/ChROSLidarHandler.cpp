@@ -41,7 +41,8 @@ class ChROSLidarHandlerImpl {
     virtual bool Initialize(std::shared_ptr<ChROSInterface> interface) = 0;
 
   protected:
-    virtual void Tick(double time) = 0;
+    /// Snapshot the lidar data and return the task publishing it (empty if there is nothing to publish)
+    virtual std::function<void()> Tick(double time) = 0;
 
     const std::string topic_name;
     std::shared_ptr<ChLidarSensor> lidar;
@@ -57,44 +58,49 @@ class PointCloud2Impl : public ChROSLidarHandlerImpl {
     virtual bool Initialize(std::shared_ptr<ChROSInterface> interface) override {
         m_publisher = interface->GetNode()->create_publisher<sensor_msgs::msg::PointCloud2>(topic_name, 1);
 
-        m_msg.header.frame_id = lidar->GetName();
-        m_msg.width = lidar->GetWidth();
-        m_msg.height = lidar->GetHeight();
-        m_msg.is_bigendian = false;
-        m_msg.is_dense = true;
-        m_msg.row_step = sizeof(PixelXYZI) * m_msg.width;
-        m_msg.point_step = sizeof(PixelXYZI);
-        m_msg.data.resize(m_msg.row_step * m_msg.height);
-
-        m_msg.fields.resize(4);
+        m_msg = std::make_shared<sensor_msgs::msg::PointCloud2>();
+        m_msg->header.frame_id = lidar->GetName();
+        m_msg->width = lidar->GetWidth();
+        m_msg->height = lidar->GetHeight();
+        m_msg->is_bigendian = false;
+        m_msg->is_dense = true;
+        m_msg->row_step = sizeof(PixelXYZI) * m_msg->width;
+        m_msg->point_step = sizeof(PixelXYZI);
+        m_msg->data.resize(m_msg->row_step * m_msg->height);
+
+        m_msg->fields.resize(4);
         const std::string field_names[4] = {"x", "y", "z", "intensity"};
         for (int i = 0; i < 4; i++) {
-            m_msg.fields[i].name = field_names[i];
-            m_msg.fields[i].offset = sizeof(float) * i;
-            m_msg.fields[i].datatype = sensor_msgs::msg::PointField::FLOAT32;
-            m_msg.fields[i].count = 1;
+            m_msg->fields[i].name = field_names[i];
+            m_msg->fields[i].offset = sizeof(float) * i;
+            m_msg->fields[i].datatype = sensor_msgs::msg::PointField::FLOAT32;
+            m_msg->fields[i].count = 1;
         }
 
         return true;
     }
 
   private:
-    virtual void Tick(double time) override {
+    virtual std::function<void()> Tick(double time) override {
         auto pc_ptr = lidar->GetMostRecentBuffer<UserXYZIBufferPtr>();
         if (!pc_ptr->Buffer) {
             // TODO: Is this supposed to happen?
             std::cout << "Lidar buffer is not ready. Not ticking." << std::endl;
-            return;
+            return nullptr;
         }
 
-        m_msg.header.stamp = ChROSHandlerUtilities::GetROSTimestamp(time);
+        // Snapshot the point cloud. The message is reused unless it is still held by the previous publishing task.
+        if (m_msg.use_count() > 1)
+            m_msg = std::make_shared<sensor_msgs::msg::PointCloud2>(*m_msg);
+
+        m_msg->header.stamp = ChROSHandlerUtilities::GetROSTimestamp(time);
         const uint8_t* ptr = reinterpret_cast<const uint8_t*>(pc_ptr->Buffer.get());
-        m_msg.data.assign(ptr, ptr + m_msg.row_step * m_msg.height);
+        m_msg->data.assign(ptr, ptr + m_msg->row_step * m_msg->height);
 
-        m_publisher->publish(m_msg);
+        return [publisher = m_publisher, msg = m_msg]() { publisher->publish(*msg); };
     }
 
-    sensor_msgs::msg::PointCloud2 m_msg;
+    std::shared_ptr<sensor_msgs::msg::PointCloud2> m_msg;
     rclcpp::Publisher<sensor_msgs::msg::PointCloud2>::SharedPtr m_publisher;
 };
 
@@ -110,42 +116,47 @@ class LaserScanImpl : public ChROSLidarHandlerImpl {
 
         m_publisher = interface->GetNode()->create_publisher<sensor_msgs::msg::LaserScan>(topic_name, 1);
 
-        m_msg.header.frame_id = lidar->GetName();
-        m_msg.angle_min = lidar->GetHFOV() / 2.0;
-        m_msg.angle_max = lidar->GetHFOV() / 2.0;
-        m_msg.angle_increment = lidar->GetHFOV() / lidar->GetWidth();
-        m_msg.time_increment = 0.0;  // TODO
-        m_msg.scan_time = 1.0 / lidar->GetUpdateRate();
-        m_msg.range_min = 0.0;
-        m_msg.range_max = lidar->GetMaxDistance();
+        m_msg = std::make_shared<sensor_msgs::msg::LaserScan>();
+        m_msg->header.frame_id = lidar->GetName();
+        m_msg->angle_min = lidar->GetHFOV() / 2.0;
+        m_msg->angle_max = lidar->GetHFOV() / 2.0;
+        m_msg->angle_increment = lidar->GetHFOV() / lidar->GetWidth();
+        m_msg->time_increment = 0.0;  // TODO
+        m_msg->scan_time = 1.0 / lidar->GetUpdateRate();
+        m_msg->range_min = 0.0;
+        m_msg->range_max = lidar->GetMaxDistance();
 
-        m_msg.ranges.resize(lidar->GetWidth());
-        m_msg.intensities.resize(lidar->GetWidth());
+        m_msg->ranges.resize(lidar->GetWidth());
+        m_msg->intensities.resize(lidar->GetWidth());
 
         return true;
     }
 
   private:
-    virtual void Tick(double time) override {
+    virtual std::function<void()> Tick(double time) override {
         auto pc_ptr = lidar->GetMostRecentBuffer<UserDIBufferPtr>();
         if (!pc_ptr->Buffer) {
             // TODO: Is this supposed to happen?
             std::cout << "Lidar buffer is not ready. Not ticking." << std::endl;
-            return;
+            return nullptr;
         }
 
-        m_msg.header.stamp = ChROSHandlerUtilities::GetROSTimestamp(time);
+        // Snapshot the scan. The message is reused unless it is still held by the previous publishing task.
+        if (m_msg.use_count() > 1)
+            m_msg = std::make_shared<sensor_msgs::msg::LaserScan>(*m_msg);
+
+        m_msg->header.stamp = ChROSHandlerUtilities::GetROSTimestamp(time);
 
         auto begin = pc_ptr->Buffer.get();
-        std::transform(begin, begin + lidar->GetWidth(), m_msg.intensities.begin(),
+        std::transform(begin, begin + lidar->GetWidth(), m_msg->intensities.begin(),
                        [](const PixelDI& p) { return p.intensity; });
-        std::transform(begin, begin + lidar->GetWidth(), m_msg.ranges.begin(),
+        std::transform(begin, begin + lidar->GetWidth(), m_msg->ranges.begin(),
                        [](const PixelDI& p) { return p.range; });
 
-        m_publisher->publish(m_msg);
+        return [publisher = m_publisher, msg = m_msg]() { publisher->publish(*msg); };
     }
 
-    sensor_msgs::msg::LaserScan m_msg;
+    std::shared_ptr<sensor_msgs::msg::LaserScan> m_msg;
     rclcpp::Publisher<sensor_msgs::msg::LaserScan>::SharedPtr m_publisher;
 };
 
@@ -180,7 +191,8 @@ bool ChROSLidarHandler::Initialize(std::shared_ptr<ChROSInterface> interface) {
 }
 
 void ChROSLidarHandler::Tick(double time) {
-    m_impl->Tick(time);
+    if (auto task = m_impl->Tick(time))
+        Publish(task);
 }
 
 }  // namespace ros
@@ -18,8 +18,10 @@
 
 #include "chrono_sensor/ChDynamicsManager.h"
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
+#include <typeindex>
 
 namespace chrono {
 namespace sensor {
@@ -29,26 +31,89 @@ CH_SENSOR_API ChDynamicsManager::ChDynamicsManager(ChSystem* chrono_system) {
     m_system = chrono_system;
 }
 
-CH_SENSOR_API ChDynamicsManager::~ChDynamicsManager() {}
+CH_SENSOR_API ChDynamicsManager::~ChDynamicsManager() {
+    // wait for the pending batch, if any, without propagating exceptions
+    m_pending.reset();
+}
+
+CH_SENSOR_API void ChDynamicsManager::SetAsynchronousUpdates(bool val) {
+    if (!val)
+        Synchronize();
+    m_async_updates = val;
+}
+
+CH_SENSOR_API void ChDynamicsManager::Synchronize() {
+    if (m_pending) {
+        auto pending = std::move(m_pending);
+        pending->Wait();
+    }
+}
 
 CH_SENSOR_API void ChDynamicsManager::UpdateSensors() {
+    // the sensors of the previous batch must not be touched before their filters completed
+    Synchronize();
+
+    m_batch.clear();
+    double t = m_system->GetChTime();
     for (int i = 0; i < m_sensor_list.size(); i++) {
         auto pSen = m_sensor_list[i];
+        double t_start = pSen->GetUpdatePhase() + pSen->GetNumLaunches() / pSen->GetUpdateRate();
 
-        if (m_system->GetChTime() > pSen->GetNumLaunches() / pSen->GetUpdateRate() - 1e-7) {
+        if (t > t_start - 1e-7) {
             pSen->PushKeyFrame();
-            if (m_system->GetChTime() >
-                pSen->GetNumLaunches() / pSen->GetUpdateRate() + pSen->GetCollectionWindow() - 1e-7) {
+            if (t > t_start + pSen->GetCollectionWindow() - 1e-7) {
+                double t_sample = t;
+                if (m_state_interpolation && m_last_time >= 0 && t > m_last_time) {
+                    // sample the sensor at its exact update time, between the previous step and this one
+                    t_sample = std::max(t_start + pSen->GetCollectionWindow(), m_last_time);
+                    pSen->InterpolateKeyFrames((t_sample - m_last_time) / (t - m_last_time));
+                }
+                pSen->SetSampleTime((float)t_sample);
+
                 // pGPS->gps_key_frames = m_gps_collection_data[i];
                 pSen->IncrementNumLaunches();
-                // step through the filter list, applying each filter
-                for (auto filter : pSen->GetFilterList()) {
-                    filter->Apply();
-                }
-                pSen->ClearKeyFrames();
+                // the filters are applied (and the key frames cleared) with the rest of the batch
+                m_batch.push_back(pSen);
+            } else if (m_state_interpolation && m_last_time >= 0 && m_last_time < t_start - 1e-7) {
+                // first step of the collection window, replace the samples around its start
+                pSen->InterpolateKeyFrames((t_start - m_last_time) / (t - m_last_time));
             }
+        } else if (m_state_interpolation) {
+            // keep the sample of the last step before the update, for interpolating at the update time
+            pSen->ClearKeyFrames();
+            pSen->PushKeyFrame();
         }
     }
+    m_last_time = t;
+
+    if (m_batch.empty())
+        return;
+
+    if (m_async_updates) {
+        m_pending = std::unique_ptr<ChTaskScheduler::TaskGroup>(
+            new ChTaskScheduler::TaskGroup(ChTaskScheduler::GetGlobal()));
+        m_pending->Run([this]() { ProcessBatch(); });
+    } else {
+        ProcessBatch();
+    }
+}
+
+CH_SENSOR_API void ChDynamicsManager::ProcessBatch() {
+    auto process = [this](int i) {
+        auto& pSen = m_batch[i];
+        // step through the filter list, applying each filter
+        for (auto filter : pSen->GetFilterList()) {
+            filter->Apply();
+        }
+        pSen->ClearKeyFrames();
+    };
+
+    if (m_parallel_updates && m_batch.size() > 1) {
+        ChTaskScheduler::GetGlobal().ParallelFor(0, (int)m_batch.size(), process);
+    } else {
+        for (int i = 0; i < (int)m_batch.size(); i++)
+            process(i);
+    }
 }
 
 CH_SENSOR_API void ChDynamicsManager::AssignSensor(std::shared_ptr<ChSensor> sensor) {
@@ -58,8 +123,13 @@ CH_SENSOR_API void ChDynamicsManager::AssignSensor(std::shared_ptr<ChSensor> sen
             std::cerr << "WARNING: This sensor already exists in manager. Ignoring this addition\n";
             return;
         }
-        // add a GPS sensor
+        // add the sensor, keeping sensors of the same type together so that they are processed in sequence
+        Synchronize();
         m_sensor_list.push_back(sen);
+        std::stable_sort(m_sensor_list.begin(), m_sensor_list.end(),
+                         [](const std::shared_ptr<ChDynamicSensor>& a, const std::shared_ptr<ChDynamicSensor>& b) {
+                             return std::type_index(typeid(*a)) < std::type_index(typeid(*b));
+                         });
         std::shared_ptr<SensorBuffer> buffer;
         for (auto f : sen->GetFilterList()) {
             f->Initialize(sen, buffer);
@@ -22,12 +22,14 @@
 // API include
 #include "chrono_sensor/ChApiSensor.h"
 
+#include "chrono/core/ChTaskScheduler.h"
 #include "chrono/physics/ChSystem.h"
 
 #include "chrono_sensor/sensors/ChGPSSensor.h"
 #include "chrono_sensor/sensors/ChIMUSensor.h"
 
 #include <fstream>
+#include <memory>
 #include <sstream>
 
 namespace chrono {
@@ -36,9 +38,10 @@ namespace sensor {
 /// @addtogroup sensor_sensors
 /// @{
 
-/// class for managing dynamic sensors. This class is not built for mutlithreading as it is lockstep with the
-/// Chrono system. Will hold and update all sensors that don't need access to rendering or the environmnet. That
-/// currently includes GPS and IMU
+/// class for managing dynamic sensors. Will hold and update all sensors that don't need access to rendering or the
+/// environmnet. That currently includes GPS, IMU, and tachometer. The sensor data is collected in lockstep with the
+/// Chrono system. The filter graphs of the sensors updated at the same step are then processed as one batch, in which
+/// the sensors are grouped by type; this batch can optionally be processed in parallel and/or in the background.
 class CH_SENSOR_API ChDynamicsManager {
   public:
     /// Constructor for the dynamic sensor manager.
@@ -56,10 +59,42 @@ class CH_SENSOR_API ChDynamicsManager {
     /// @param sensor A shared pointer to a sensor that should be assigned to this manager.
     void AssignSensor(std::shared_ptr<ChSensor> sensor);
 
-  private:
-    ChSystem* m_system;  ///< system in which the manager lives
+    /// Enable or disable the interpolation of the sensor data at the exact update times (default: false). When enabled,
+    /// the sample of the last step before an update is kept, and the sensor data is interpolated between that sample
+    /// and the sample of the step at which the update is detected.
+    /// @param val Whether the sensor data should be interpolated at the update times
+    void SetStateInterpolation(bool val) { m_state_interpolation = val; }
+
+    /// Enable or disable parallel processing of the filter graphs of the sensors updated at the same step (default:
+    /// false). When enabled, the filter graphs of different sensors are processed concurrently by the tasks of the
+    /// global ChTaskScheduler; the filters of each sensor are still applied in order.
+    /// @param val Whether the filter graphs should be processed in parallel
+    void SetParallelUpdates(bool val) { m_parallel_updates = val; }
+
+    /// Enable or disable background processing of the filter graphs (default: false). When enabled, the sensor data is
+    /// collected on the simulation thread but the filter graphs are processed as a task of the global ChTaskScheduler,
+    /// overlapping with the next simulation step. The next call to UpdateSensors (or Synchronize) waits for their
+    /// completion, so the output of the sensors is available with a latency of at most one step. If the scheduler has
+    /// no worker threads, the filter graphs are processed when waited for.
+    /// @param val Whether the filter graphs should be processed in the background
+    void SetAsynchronousUpdates(bool val);
+
+    /// Wait for completion of the filter graphs processed in the background, if any.
+    void Synchronize();
 
-    std::vector<std::shared_ptr<ChDynamicSensor>> m_sensor_list;  ///< list of dynamic sensors
+  private:
+    /// Apply the filter graph of each sensor in the current batch
+    void ProcessBatch();
+
+    ChSystem* m_system;                  ///< system in which the manager lives
+    bool m_state_interpolation = false;  ///< interpolate the sensor data at the update times
+    bool m_parallel_updates = false;     ///< process the filter graphs of a batch in parallel
+    bool m_async_updates = false;        ///< process the filter graphs of a batch in the background
+    double m_last_time = -1;             ///< simulation time of the previous update
+
+    std::vector<std::shared_ptr<ChDynamicSensor>> m_sensor_list;  ///< list of dynamic sensors, grouped by type
+    std::vector<std::shared_ptr<ChDynamicSensor>> m_batch;        ///< sensors updated at the current step
+    std::unique_ptr<ChTaskScheduler::TaskGroup> m_pending;        ///< batch processed in the background
 };
 
 /// @} sensor_sensors
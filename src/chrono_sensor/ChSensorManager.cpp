@@ -19,6 +19,7 @@
 #include "chrono_sensor/ChSensorManager.h"
 
 #include "chrono_sensor/sensors/ChOptixSensor.h"
+#include <cmath>
 #include <iomanip>
 #include <iostream>
 
@@ -50,6 +51,13 @@ CH_SENSOR_API void ChSensorManager::Update() {
         pEngine->UpdateSensors(scene);
     }
 
+    // periodically move sensors between the engines if their measured loads are unbalanced
+    if (m_load_balancing && m_engines.size() > 1 &&
+        m_system->GetChTime() > m_last_balance_time + m_balance_interval - 1e-7) {
+        m_last_balance_time = m_system->GetChTime();
+        Rebalance();
+    }
+
     // have the sensormanager update all of the non-optix sensor (IMU and GPS).
     // TODO: perhaps create a thread that takes care of this? Tradeoff since IMU should require some data from EVERY
     // step
@@ -83,6 +91,74 @@ CH_SENSOR_API void ChSensorManager::SetRayRecursions(int rec) {
         m_optix_reflections = rec;
 }
 
+CH_SENSOR_API void ChSensorManager::SetStateInterpolation(bool val) {
+    m_state_interpolation = val;
+    for (auto engine : m_engines)
+        engine->SetStateInterpolation(val);
+    if (m_dynamics_manager)
+        m_dynamics_manager->SetStateInterpolation(val);
+}
+
+CH_SENSOR_API void ChSensorManager::SetParallelDynamicUpdates(bool val) {
+    m_parallel_dynamic = val;
+    if (m_dynamics_manager)
+        m_dynamics_manager->SetParallelUpdates(val);
+}
+
+CH_SENSOR_API void ChSensorManager::SetAsynchronousDynamicUpdates(bool val) {
+    m_async_dynamic = val;
+    if (m_dynamics_manager)
+        m_dynamics_manager->SetAsynchronousUpdates(val);
+}
+
+CH_SENSOR_API void ChSensorManager::SetBatchedLaunches(bool val) {
+    m_batched_launches = val;
+    for (auto engine : m_engines)
+        engine->SetBatchedLaunches(val);
+}
+
+void ChSensorManager::Rebalance() {
+    // find the most and least loaded engines
+    std::shared_ptr<ChOptixEngine> src = m_engines[0];
+    std::shared_ptr<ChOptixEngine> dst = m_engines[0];
+    double max_load = m_engines[0]->GetLoad();
+    double min_load = max_load;
+    for (auto engine : m_engines) {
+        double load = engine->GetLoad();
+        if (load > max_load) {
+            max_load = load;
+            src = engine;
+        }
+        if (load < min_load) {
+            min_load = load;
+            dst = engine;
+        }
+    }
+    if (src == dst || src->GetNumSensor() < 2 || max_load < 1.2 * min_load)
+        return;
+
+    // move the sensor whose cost is closest to half of the imbalance, only if the move reduces the imbalance
+    double imbalance = max_load - min_load;
+    std::shared_ptr<ChOptixSensor> moved;
+    double best = imbalance / 2;
+    for (auto s : src->GetSensor()) {
+        double cost = src->GetRenderTime(s) * s->GetUpdateRate();
+        if (cost > 0 && cost < imbalance && std::abs(cost - imbalance / 2) < best) {
+            best = std::abs(cost - imbalance / 2);
+            moved = s;
+        }
+    }
+    if (!moved)
+        return;
+
+    src->RemoveSensor(moved);
+    dst->AssignSensor(moved);
+    if (m_verbose)
+        std::cout << "Moved sensor " << moved->GetName() << " from the engine on device " << src->GetDevice()
+                  << " to the engine on device " << dst->GetDevice() << " (loads: " << max_load << ", " << min_load
+                  << ")\n";
+}
+
 CH_SENSOR_API void ChSensorManager::AddSensor(std::shared_ptr<ChSensor> sensor) {
     // check if sensor is already in sensor list
     if (std::find(m_sensor_list.begin(), m_sensor_list.end(), sensor) != m_sensor_list.end()) {
@@ -92,6 +168,19 @@ CH_SENSOR_API void ChSensorManager::AddSensor(std::shared_ptr<ChSensor> sensor)
     m_sensor_list.push_back(sensor);
 
     if (auto pOptixSensor = std::dynamic_pointer_cast<ChOptixSensor>(sensor)) {
+        if (m_staggered_updates) {
+            // the k-th sensor with this update rate is delayed by the van der Corput number of k (0, 1/2, 1/4, 3/4,
+            // ...) times the update period, which keeps the phases spread out whatever the number of sensors
+            unsigned int k = 0;
+            for (auto s : m_render_sensor) {
+                if (std::abs(s->GetUpdateRate() - sensor->GetUpdateRate()) < 0.001)
+                    k++;
+            }
+            float phase = 0;
+            for (float base = 0.5f; k > 0; k >>= 1, base *= 0.5f)
+                phase += (k & 1) * base;
+            sensor->SetUpdatePhase(phase / sensor->GetUpdateRate());
+        }
         m_render_sensor.push_back(sensor);
         /******** give each render group all sensor with same update rate *************/
         bool found_group = false;
@@ -117,6 +206,8 @@ CH_SENSOR_API void ChSensorManager::AddSensor(std::shared_ptr<ChSensor> sensor)
                         m_verbose);  // limits to 2 gpus, TODO: check if device supports cuda
 
                     // engine->ConstructScene();
+                    engine->SetBatchedLaunches(m_batched_launches);
+                    engine->SetStateInterpolation(m_state_interpolation);
 
                     engine->AssignSensor(pOptixSensor);
                     m_engines.push_back(engine);
@@ -138,6 +229,9 @@ CH_SENSOR_API void ChSensorManager::AddSensor(std::shared_ptr<ChSensor> sensor)
     } else {
         if (!m_dynamics_manager) {
             m_dynamics_manager = chrono_types::make_shared<ChDynamicsManager>(m_system);
+            m_dynamics_manager->SetStateInterpolation(m_state_interpolation);
+            m_dynamics_manager->SetParallelUpdates(m_parallel_dynamic);
+            m_dynamics_manager->SetAsynchronousUpdates(m_async_dynamic);
         }
 
         // add pure dynamic sensor to dynamic manager
@@ -102,6 +102,62 @@ class CH_SENSOR_API ChSensorManager {
     /// @return The max number of recursions used in ray tracing
     int GetRayRecursions() { return m_optix_reflections; }
 
+    /// Enable or disable batched launches in the OptiX engines (see ChOptixEngine::SetBatchedLaunches).
+    /// @param val Whether sensors updated at the same time should be rendered with batched launches
+    void SetBatchedLaunches(bool val);
+
+    /// Get the batched launches setting
+    /// @return Whether sensors are rendered with batched launches
+    bool GetBatchedLaunches() { return m_batched_launches; }
+
+    /// Enable or disable the interpolation of the state at the sensor update times (default: false). When enabled, the
+    /// render sensors are rendered from the body and sensor frames interpolated at their exact update times, and the
+    /// dynamic sensors (IMU, GPS, ...) interpolate their data between the two steps around their update times. This
+    /// allows a simulation step that is not a divisor of the sensor update periods without timing jitter.
+    /// @param val Whether the state should be interpolated at the sensor update times
+    void SetStateInterpolation(bool val);
+
+    /// Get the state interpolation setting
+    /// @return Whether the state is interpolated at the sensor update times
+    bool GetStateInterpolation() { return m_state_interpolation; }
+
+    /// Enable or disable parallel processing of the filter graphs of the dynamic sensors (IMU, GPS, tachometer) updated
+    /// at the same step (default: false). See ChDynamicsManager::SetParallelUpdates.
+    /// @param val Whether the filter graphs of the dynamic sensors should be processed in parallel
+    void SetParallelDynamicUpdates(bool val);
+
+    /// Enable or disable background processing of the filter graphs of the dynamic sensors (default: false). When
+    /// enabled, the output of the dynamic sensors is available with a latency of at most one step. See
+    /// ChDynamicsManager::SetAsynchronousUpdates.
+    /// @param val Whether the filter graphs of the dynamic sensors should be processed in the background
+    void SetAsynchronousDynamicUpdates(bool val);
+
+    /// Enable or disable staggered updates of the render sensors (default: false). Must be set before the sensors are
+    /// added. When enabled, the render sensors that share an update rate are given different update phases (a fraction
+    /// 0, 1/2, 1/4, 3/4, 1/8, ... of the update period, in the order in which they are added) so that their renders
+    /// are spread over the update period rather than all launched at the same simulation step.
+    /// @param val Whether the update phases of sensors with the same update rate should be staggered
+    void SetStaggeredUpdates(bool val) { m_staggered_updates = val; }
+
+    /// Get the staggered updates setting
+    /// @return Whether the update phases of sensors with the same update rate are staggered
+    bool GetStaggeredUpdates() { return m_staggered_updates; }
+
+    /// Enable or disable balancing of the render sensors across the OptiX engines (default: false). When enabled, the
+    /// manager periodically compares the measured load of the engines (the render time per second of simulation of
+    /// their sensors) and moves a sensor from the most loaded engine to the least loaded one when this reduces the
+    /// imbalance. A moved sensor has its filter graph initialized again on the new engine.
+    /// @param val Whether the sensors should be balanced across the engines
+    /// @param interval Simulation time between two balancing checks [s]
+    void SetLoadBalancing(bool val, float interval = 1.f) {
+        m_load_balancing = val;
+        m_balance_interval = interval;
+    }
+
+    /// Get the load balancing setting
+    /// @return Whether the sensors are balanced across the engines
+    bool GetLoadBalancing() { return m_load_balancing; }
+
     /// Set if the sensor framework should print all info
     /// @param verbose Whether the framework should print info
     void SetVerbose(bool verbose) { m_verbose = verbose; }
@@ -115,9 +171,20 @@ class CH_SENSOR_API ChSensorManager {
     std::shared_ptr<ChScene> scene;
 
   private:
-    bool m_verbose;           ///< Whether we should print messages and warnings
-    int m_optix_reflections;  ///< Maximum number of ray tracing recursions
-    int m_num_keyframes;      ///< number of keyframes to use
+    /// Move a sensor from the most loaded engine to the least loaded one if this reduces the load imbalance
+    void Rebalance();
+
+    bool m_verbose;                      ///< Whether we should print messages and warnings
+    int m_optix_reflections;             ///< Maximum number of ray tracing recursions
+    int m_num_keyframes;                 ///< number of keyframes to use
+    bool m_batched_launches = false;     ///< whether the engines should render sensors with batched launches
+    bool m_staggered_updates = false;    ///< whether sensors with the same update rate get different update phases
+    bool m_state_interpolation = false;  ///< whether the state is interpolated at the sensor update times
+    bool m_parallel_dynamic = false;     ///< whether the dynamic sensors are processed in parallel
+    bool m_async_dynamic = false;        ///< whether the dynamic sensors are processed in the background
+    bool m_load_balancing = false;       ///< whether sensors are moved between engines to balance their load
+    float m_balance_interval = 1.f;      ///< simulation time between two balancing checks
+    double m_last_balance_time = 0;      ///< simulation time of the last balancing check
 
     // class variables
     ChSystem* m_system;                                     ///< Chrono system the manager is attached to
@@ -0,0 +1,284 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Device implementation of the DBSCAN clustering of point clouds
+//
+// =============================================================================
+
+#include <cuda.h>
+#include <climits>
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+
+#include "dbscan.cuh"
+
+namespace chrono {
+namespace sensor {
+
+// uniform grid over the points, hashed on a table of cells
+struct DbscanGrid {
+    const float* points;          // point data
+    int stride;                   // number of floats of each point
+    float eps2;                   // squared neighborhood radius
+    float inv_eps;                // inverse of the cell size
+    unsigned int table_size;      // number of hash table entries
+    const int* sorted_indices;    // point indices sorted by cell hash
+    const int* cell_start;        // first sorted index of each hash entry (-1 for empty entries)
+    const int* cell_end;          // one past the last sorted index of each hash entry
+};
+
+__device__ unsigned int dbscan_cell_hash(int cx, int cy, int cz, unsigned int table_size) {
+    return (((unsigned int)cx * 73856093u) ^ ((unsigned int)cy * 19349663u) ^ ((unsigned int)cz * 83492791u)) %
+           table_size;
+}
+
+// call op(j) for each point j != i within eps of point i
+template <class Op>
+__device__ void dbscan_for_each_neighbor(const DbscanGrid& grid, int i, Op& op) {
+    const float* p = grid.points + grid.stride * i;
+    int cx = (int)floorf(p[0] * grid.inv_eps);
+    int cy = (int)floorf(p[1] * grid.inv_eps);
+    int cz = (int)floorf(p[2] * grid.inv_eps);
+
+    // different cells can share a hash entry, each entry must be visited once
+    unsigned int visited[27];
+    int num_visited = 0;
+    for (int dz = -1; dz <= 1; dz++) {
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                unsigned int h = dbscan_cell_hash(cx + dx, cy + dy, cz + dz, grid.table_size);
+                bool seen = false;
+                for (int k = 0; k < num_visited; k++)
+                    seen = seen || visited[k] == h;
+                if (seen || grid.cell_start[h] < 0)
+                    continue;
+                visited[num_visited++] = h;
+
+                for (int k = grid.cell_start[h]; k < grid.cell_end[h]; k++) {
+                    int j = grid.sorted_indices[k];
+                    const float* q = grid.points + grid.stride * j;
+                    float d0 = q[0] - p[0];
+                    float d1 = q[1] - p[1];
+                    float d2 = q[2] - p[2];
+                    if (j != i && d0 * d0 + d1 * d1 + d2 * d2 <= grid.eps2)
+                        op(j);
+                }
+            }
+        }
+    }
+}
+
+struct DbscanCountOp {
+    int count = 0;
+    __device__ void operator()(int j) { count++; }
+};
+
+struct DbscanMinCoreLabelOp {
+    const bool* core;
+    const int* labels;
+    int label;
+    __device__ void operator()(int j) {
+        if (core[j])
+            label = min(label, labels[j]);
+    }
+};
+
+__global__ void dbscan_hash_kernel(const float* points,
+                                   int n,
+                                   int stride,
+                                   int weight_offset,
+                                   float inv_eps,
+                                   unsigned int table_size,
+                                   unsigned int* hashes,
+                                   int* indices) {
+    int i = blockDim.x * blockIdx.x + threadIdx.x;
+    if (i < n) {
+        const float* p = points + stride * i;
+        // invalid points are sorted after all the valid ones and are never visited
+        if (p[weight_offset] > 0) {
+            hashes[i] = dbscan_cell_hash((int)floorf(p[0] * inv_eps), (int)floorf(p[1] * inv_eps),
+                                         (int)floorf(p[2] * inv_eps), table_size);
+        } else {
+            hashes[i] = table_size;
+        }
+        indices[i] = i;
+    }
+}
+
+__global__ void dbscan_cell_bounds_kernel(const unsigned int* hashes,
+                                          int n,
+                                          unsigned int table_size,
+                                          int* cell_start,
+                                          int* cell_end) {
+    int i = blockDim.x * blockIdx.x + threadIdx.x;
+    if (i < n && hashes[i] < table_size) {
+        if (i == 0 || hashes[i - 1] != hashes[i])
+            cell_start[hashes[i]] = i;
+        if (i == n - 1 || hashes[i + 1] != hashes[i])
+            cell_end[hashes[i]] = i + 1;
+    }
+}
+
+__global__ void dbscan_core_kernel(DbscanGrid grid,
+                                   int n,
+                                   int weight_offset,
+                                   int min_pts,
+                                   bool* core,
+                                   int* labels) {
+    int i = blockDim.x * blockIdx.x + threadIdx.x;
+    if (i < n) {
+        bool is_core = false;
+        if (grid.points[grid.stride * i + weight_offset] > 0) {
+            DbscanCountOp op;
+            dbscan_for_each_neighbor(grid, i, op);
+            is_core = op.count >= min_pts;
+        }
+        core[i] = is_core;
+        labels[i] = is_core ? i : INT_MAX;
+    }
+}
+
+// lower the label of each core point to the lowest label of its core neighbors
+__global__ void dbscan_propagate_kernel(DbscanGrid grid, int n, const bool* core, int* labels, int* changed) {
+    int i = blockDim.x * blockIdx.x + threadIdx.x;
+    if (i < n && core[i]) {
+        DbscanMinCoreLabelOp op{core, labels, labels[i]};
+        dbscan_for_each_neighbor(grid, i, op);
+        if (op.label < labels[i]) {
+            atomicMin(&labels[i], op.label);
+            // also hook the current root, which speeds up the convergence
+            atomicMin(&labels[labels[i]], op.label);
+            *changed = 1;
+        }
+    }
+}
+
+// pointer jumping, each label is replaced by the label of its label
+__global__ void dbscan_jump_kernel(int n, const bool* core, int* labels) {
+    int i = blockDim.x * blockIdx.x + threadIdx.x;
+    if (i < n && core[i]) {
+        int l = labels[i];
+        while (labels[l] < l)
+            l = labels[l];
+        labels[i] = l;
+    }
+}
+
+// border points join the cluster of one of their core neighbors, the other non-core points are noise
+__global__ void dbscan_border_kernel(DbscanGrid grid, int n, int weight_offset, const bool* core, int* labels) {
+    int i = blockDim.x * blockIdx.x + threadIdx.x;
+    if (i < n && !core[i]) {
+        int label = -1;
+        if (grid.points[grid.stride * i + weight_offset] > 0) {
+            DbscanMinCoreLabelOp op{core, labels, INT_MAX};
+            dbscan_for_each_neighbor(grid, i, op);
+            if (op.label < INT_MAX)
+                label = op.label;
+        }
+        labels[i] = label;
+    }
+}
+
+__global__ void dbscan_root_kernel(int n, const bool* core, const int* labels, int* roots) {
+    int i = blockDim.x * blockIdx.x + threadIdx.x;
+    if (i < n)
+        roots[i] = core[i] && labels[i] == i;
+}
+
+__global__ void dbscan_relabel_kernel(int n, const int* cluster_ids, int* labels) {
+    int i = blockDim.x * blockIdx.x + threadIdx.x;
+    if (i < n && labels[i] >= 0)
+        labels[i] = cluster_ids[labels[i]];
+}
+
+int cuda_dbscan(void* bufIn,
+                int num_points,
+                int stride,
+                int weight_offset,
+                float eps,
+                int min_pts,
+                int* labels,
+                CUstream& stream) {
+    if (num_points <= 0)
+        return 0;
+
+    const int nThreads = 512;
+    int nBlocks = (num_points + nThreads - 1) / nThreads;
+    auto policy = thrust::cuda::par.on(stream);
+    const float* points = (const float*)bufIn;
+
+    unsigned int table_size = 2 * (unsigned int)num_points;
+    thrust::device_vector<unsigned int> hashes(num_points);
+    thrust::device_vector<int> sorted_indices(num_points);
+    thrust::device_vector<int> cell_start(table_size);
+    thrust::device_vector<int> cell_end(table_size);
+    thrust::device_vector<bool> core(num_points);
+    thrust::device_vector<int> cluster_ids(num_points);
+    thrust::device_vector<int> changed(1);
+
+    // build the grid
+    dbscan_hash_kernel<<<nBlocks, nThreads, 0, stream>>>(points, num_points, stride, weight_offset, 1.f / eps,
+                                                         table_size, thrust::raw_pointer_cast(hashes.data()),
+                                                         thrust::raw_pointer_cast(sorted_indices.data()));
+    thrust::sort_by_key(policy, hashes.begin(), hashes.end(), sorted_indices.begin());
+    thrust::fill(policy, cell_start.begin(), cell_start.end(), -1);
+    dbscan_cell_bounds_kernel<<<nBlocks, nThreads, 0, stream>>>(thrust::raw_pointer_cast(hashes.data()), num_points,
+                                                                table_size,
+                                                                thrust::raw_pointer_cast(cell_start.data()),
+                                                                thrust::raw_pointer_cast(cell_end.data()));
+
+    DbscanGrid grid;
+    grid.points = points;
+    grid.stride = stride;
+    grid.eps2 = eps * eps;
+    grid.inv_eps = 1.f / eps;
+    grid.table_size = table_size;
+    grid.sorted_indices = thrust::raw_pointer_cast(sorted_indices.data());
+    grid.cell_start = thrust::raw_pointer_cast(cell_start.data());
+    grid.cell_end = thrust::raw_pointer_cast(cell_end.data());
+    bool* d_core = thrust::raw_pointer_cast(core.data());
+    int* d_changed = thrust::raw_pointer_cast(changed.data());
+
+    // connect the core points
+    dbscan_core_kernel<<<nBlocks, nThreads, 0, stream>>>(grid, num_points, weight_offset, min_pts, d_core, labels);
+    int h_changed = 1;
+    while (h_changed) {
+        cudaMemsetAsync(d_changed, 0, sizeof(int), stream);
+        dbscan_propagate_kernel<<<nBlocks, nThreads, 0, stream>>>(grid, num_points, d_core, labels, d_changed);
+        dbscan_jump_kernel<<<nBlocks, nThreads, 0, stream>>>(num_points, d_core, labels);
+        cudaMemcpyAsync(&h_changed, d_changed, sizeof(int), cudaMemcpyDeviceToHost, stream);
+        cudaStreamSynchronize(stream);
+    }
+
+    // attach the border points and number the clusters by their root
+    dbscan_border_kernel<<<nBlocks, nThreads, 0, stream>>>(grid, num_points, weight_offset, d_core, labels);
+    int* d_cluster_ids = thrust::raw_pointer_cast(cluster_ids.data());
+    dbscan_root_kernel<<<nBlocks, nThreads, 0, stream>>>(num_points, d_core, labels, d_cluster_ids);
+    int last_root = 0;
+    cudaMemcpyAsync(&last_root, d_cluster_ids + num_points - 1, sizeof(int), cudaMemcpyDeviceToHost, stream);
+    thrust::exclusive_scan(policy, cluster_ids.begin(), cluster_ids.end(), cluster_ids.begin());
+    dbscan_relabel_kernel<<<nBlocks, nThreads, 0, stream>>>(num_points, d_cluster_ids, labels);
+
+    int last_id = 0;
+    cudaMemcpyAsync(&last_id, d_cluster_ids + num_points - 1, sizeof(int), cudaMemcpyDeviceToHost, stream);
+    cudaStreamSynchronize(stream);
+    return last_id + last_root;
+}
+
+}  // namespace sensor
+}  // namespace chrono
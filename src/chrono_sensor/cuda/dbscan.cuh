@@ -0,0 +1,59 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Device implementation of the DBSCAN clustering of point clouds
+//
+// =============================================================================
+
+#ifndef DBSCAN_CUH
+#define DBSCAN_CUH
+
+#include <cuda.h>
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_cuda
+/// @{
+
+/// Clusters a point cloud on the device with DBSCAN. The neighbors of each point are found with a uniform grid of cell
+/// size eps (hashed on a table of twice the number of points), the core points are connected by iterative label
+/// propagation, and each border point joins the cluster of one of its core neighbors. The clusters are numbered in the
+/// order of their lowest core point index, as with the host implementation in utils/Dbscan.h.
+/// @param bufIn A device pointer to the points, each made of stride floats starting with x, y, z.
+/// @param num_points The number of points.
+/// @param stride The number of floats of each point.
+/// @param weight_offset The offset of the float that is positive for valid points (e.g. the intensity). Invalid points
+/// are not clustered.
+/// @param eps The neighborhood radius.
+/// @param min_pts The minimum number of neighbors (the point itself excluded) of a core point.
+/// @param labels A device pointer to num_points ints, receiving the cluster of each point (-1 for noise and invalid
+/// points).
+/// @param stream The cuda stream for the kernels.
+/// @return The number of clusters. The stream is synchronized.
+int cuda_dbscan(void* bufIn,
+                int num_points,
+                int stride,
+                int weight_offset,
+                float eps,
+                int min_pts,
+                int* labels,
+                CUstream& stream);
+
+/// @}
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -212,6 +212,16 @@ __global__ void depth_to_uchar4_kernel(float* bufIn, unsigned char* bufOut, floa
        
 }
 
+// copy the image with the rows in reverse order
+__global__ void image_flip_rows_kernel(unsigned char* bufIn, unsigned char* bufOut, int row_size, int h) {
+    int idx = (blockDim.x * blockIdx.x + threadIdx.x);  // index into output buffer
+    if (idx < row_size * h) {
+        int row = idx / row_size;
+        int col = idx % row_size;
+        bufOut[idx] = bufIn[(h - 1 - row) * row_size + col];
+    }
+}
+
 
 
 void cuda_image_gauss_blur_char(void* buf, int w, int h, int c, int factor, CUstream& stream) {
@@ -299,5 +309,12 @@ void cuda_depth_to_uchar4(void* bufIn, void* bufOut, int w, int h, CUstream& str
                                                              *(result.second), w * h);
 }
 
+void cuda_image_flip_rows(void* bufIn, void* bufOut, int w, int h, int pix_size, CUstream& stream) {
+    const int nThreads = 512;
+    int nBlocks = (w * h * pix_size + nThreads - 1) / nThreads;
+    image_flip_rows_kernel<<<nBlocks, nThreads, 0, stream>>>((unsigned char*)bufIn, (unsigned char*)bufOut,
+                                                             w * pix_size, h);
+}
+
 }  // namespace sensor
 }  // namespace chrono
@@ -73,6 +73,15 @@ void cuda_image_half4_to_uchar4(void* bufIn, void* bufOut, int w, int h, CUstrea
 /// @param stream cuda stream for computation
 void cuda_depth_to_uchar4(void* bufIn, void* bufOut, int w, int h, CUstream& stream);
 
+/// Copy of an image with the order of the rows reversed
+/// @param bufIn  A device pointer to the image image.
+/// @param bufOut A device pointer to the ouput image.
+/// @param w The image width.
+/// @param h The image height.
+/// @param pix_size Size of a pixel in bytes.
+/// @param stream cuda stream for computation
+void cuda_image_flip_rows(void* bufIn, void* bufOut, int w, int h, int pix_size, CUstream& stream);
+
 
 
 /// @}
@@ -18,6 +18,13 @@
 #include "pointcloud.cuh"
 #include <iostream>
 
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/sort.h>
+
 namespace chrono {
 namespace sensor {
 
@@ -122,5 +129,75 @@ void cuda_pointcloud_from_depth(void* bufDI,
 }
 
 
+struct pointcloud_no_intensity {
+    __host__ __device__ bool operator()(const float4& p) const { return !(p.w > 0); }
+};
+
+struct pointcloud_point_sum {
+    __host__ __device__ float4 operator()(const float4& a, const float4& b) const {
+        return make_float4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+    }
+};
+
+// packs the voxel coordinates in 21 bits each
+__global__ void pointcloud_voxel_key_kernel(const float4* points, int n, float inv_voxel, unsigned long long* keys) {
+    int i = blockDim.x * blockIdx.x + threadIdx.x;
+    if (i < n) {
+        unsigned long long vx = (unsigned long long)((int)floorf(points[i].x * inv_voxel) + (1 << 20)) & 0x1FFFFF;
+        unsigned long long vy = (unsigned long long)((int)floorf(points[i].y * inv_voxel) + (1 << 20)) & 0x1FFFFF;
+        unsigned long long vz = (unsigned long long)((int)floorf(points[i].z * inv_voxel) + (1 << 20)) & 0x1FFFFF;
+        keys[i] = (vx << 42) | (vy << 21) | vz;
+    }
+}
+
+__global__ void pointcloud_voxel_average_kernel(const float4* sums, const int* counts, int n, float4* points) {
+    int i = blockDim.x * blockIdx.x + threadIdx.x;
+    if (i < n) {
+        float inv = 1.f / counts[i];
+        points[i] = make_float4(sums[i].x * inv, sums[i].y * inv, sums[i].z * inv, sums[i].w * inv);
+    }
+}
+
+int cuda_pointcloud_compact(void* buf, int num_points, CUstream& stream) {
+    thrust::device_ptr<float4> points = thrust::device_pointer_cast((float4*)buf);
+    auto end =
+        thrust::remove_if(thrust::cuda::par.on(stream), points, points + num_points, pointcloud_no_intensity());
+    cudaStreamSynchronize(stream);
+    return (int)(end - points);
+}
+
+int cuda_pointcloud_voxel_downsample(void* buf, int num_points, float voxel_size, CUstream& stream) {
+    int n = cuda_pointcloud_compact(buf, num_points, stream);
+    if (n == 0)
+        return 0;
+
+    const int nThreads = 512;
+    int nBlocks = (n + nThreads - 1) / nThreads;
+    auto policy = thrust::cuda::par.on(stream);
+    thrust::device_ptr<float4> points = thrust::device_pointer_cast((float4*)buf);
+
+    thrust::device_vector<unsigned long long> keys(n);
+    pointcloud_voxel_key_kernel<<<nBlocks, nThreads, 0, stream>>>((float4*)buf, n, 1.f / voxel_size,
+                                                                  thrust::raw_pointer_cast(keys.data()));
+    thrust::sort_by_key(policy, keys.begin(), keys.end(), points);
+
+    // sum the points and count them in each voxel
+    thrust::device_vector<unsigned long long> voxel_keys(n);
+    thrust::device_vector<float4> sums(n);
+    thrust::device_vector<int> counts(n);
+    auto sum_end = thrust::reduce_by_key(policy, keys.begin(), keys.end(), points, voxel_keys.begin(), sums.begin(),
+                                         thrust::equal_to<unsigned long long>(), pointcloud_point_sum());
+    thrust::reduce_by_key(policy, keys.begin(), keys.end(), thrust::constant_iterator<int>(1), voxel_keys.begin(),
+                          counts.begin());
+    int num_voxels = (int)(sum_end.first - voxel_keys.begin());
+
+    nBlocks = (num_voxels + nThreads - 1) / nThreads;
+    pointcloud_voxel_average_kernel<<<nBlocks, nThreads, 0, stream>>>(thrust::raw_pointer_cast(sums.data()),
+                                                                      thrust::raw_pointer_cast(counts.data()),
+                                                                      num_voxels, (float4*)buf);
+    cudaStreamSynchronize(stream);
+    return num_voxels;
+}
+
 }  // namespace sensor
 }  // namespace chrono
@@ -56,6 +56,22 @@ void cuda_pointcloud_from_depth_dual_return(void* bufDI,
                                             float min_v_angle,
                                             CUstream& stream);
 
+/// Removes the points without intensity from a point cloud, keeping the order of the remaining points.
+/// @param buf A device pointer to the point cloud (x, y, z, intensity for each point).
+/// @param num_points The number of points.
+/// @param stream The cuda stream for the kernels.
+/// @return The number of remaining points. The stream is synchronized.
+int cuda_pointcloud_compact(void* buf, int num_points, CUstream& stream);
+
+/// Downsamples a point cloud on a voxel grid. The points without intensity are removed and the points of each voxel
+/// are replaced by their average position and intensity.
+/// @param buf A device pointer to the point cloud (x, y, z, intensity for each point).
+/// @param num_points The number of points.
+/// @param voxel_size The edge length of the voxels.
+/// @param stream The cuda stream for the kernels.
+/// @return The number of remaining points, one per occupied voxel. The stream is synchronized.
+int cuda_pointcloud_voxel_downsample(void* buf, int num_points, float voxel_size, CUstream& stream);
+
 /// @}
 }  // namespace sensor
 }  // namespace chrono
@@ -2,6 +2,13 @@
 #include <iostream>
 #include "radarprocess.cuh"
 
+#include <thrust/copy.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
+
 namespace chrono{
 namespace sensor{
 
@@ -79,6 +86,78 @@ void cuda_radar_pointcloud_from_angles(void* bufIn,
                                        hfov, vfov);
 }
 
+struct radar_is_clustered {
+    __host__ __device__ bool operator()(int label) const { return label >= 0; }
+};
+
+// writes the clustered returns in cluster order and accumulates the sums of each cluster
+__global__ void radar_cluster_gather_kernel(const float* bufIn,
+                                            const int* indices,
+                                            const int* clusters,
+                                            int num_clustered,
+                                            float* bufOut,
+                                            float* sums) {
+    int k = blockDim.x * blockIdx.x + threadIdx.x;
+    if (k < num_clustered) {
+        int i = indices[k];
+        int c = clusters[k];
+        for (int f = 0; f < 7; f++) {
+            bufOut[8 * k + f] = bufIn[8 * i + f];
+            atomicAdd(&sums[7 * c + f], bufIn[8 * i + f]);
+        }
+        bufOut[8 * k + 7] = (float)(c + 1);
+    }
+}
+
+__global__ void radar_count_valid_kernel(const float* bufIn, int num_points, int* count) {
+    int i = blockDim.x * blockIdx.x + threadIdx.x;
+    if (i < num_points && bufIn[8 * i + 6] > 0)
+        atomicAdd(count, 1);
+}
+
+int cuda_radar_cluster_returns(void* bufIn,
+                               int* labels,
+                               int num_points,
+                               int num_clusters,
+                               void* bufOut,
+                               std::vector<float>& cluster_sums,
+                               int& num_valid,
+                               CUstream& stream) {
+    const int nThreads = 512;
+    auto policy = thrust::cuda::par.on(stream);
+
+    // indices of the clustered returns, sorted by cluster while keeping the return order within each cluster
+    thrust::device_vector<int> indices(num_points);
+    auto end = thrust::copy_if(policy, thrust::counting_iterator<int>(0), thrust::counting_iterator<int>(num_points),
+                               thrust::device_pointer_cast(labels), indices.begin(), radar_is_clustered());
+    int num_clustered = (int)(end - indices.begin());
+    thrust::device_vector<int> clusters(num_clustered);
+    thrust::gather(policy, indices.begin(), indices.begin() + num_clustered, thrust::device_pointer_cast(labels),
+                   clusters.begin());
+    thrust::stable_sort_by_key(policy, clusters.begin(), clusters.end(), indices.begin());
+
+    thrust::device_vector<float> sums(7 * num_clusters, 0.f);
+    thrust::device_vector<int> valid(1, 0);
+    if (num_clustered > 0) {
+        int nBlocks = (num_clustered + nThreads - 1) / nThreads;
+        radar_cluster_gather_kernel<<<nBlocks, nThreads, 0, stream>>>(
+            (float*)bufIn, thrust::raw_pointer_cast(indices.data()), thrust::raw_pointer_cast(clusters.data()),
+            num_clustered, (float*)bufOut, thrust::raw_pointer_cast(sums.data()));
+    }
+    if (num_points > 0) {
+        int nBlocks = (num_points + nThreads - 1) / nThreads;
+        radar_count_valid_kernel<<<nBlocks, nThreads, 0, stream>>>((float*)bufIn, num_points,
+                                                                   thrust::raw_pointer_cast(valid.data()));
+    }
+
+    cluster_sums.resize(7 * num_clusters);
+    cudaMemcpyAsync(cluster_sums.data(), thrust::raw_pointer_cast(sums.data()), cluster_sums.size() * sizeof(float),
+                    cudaMemcpyDeviceToHost, stream);
+    cudaMemcpyAsync(&num_valid, thrust::raw_pointer_cast(valid.data()), sizeof(int), cudaMemcpyDeviceToHost, stream);
+    cudaStreamSynchronize(stream);
+    return num_clustered;
+}
+
 //void cuda_radar_pointcloud(void* bufIn,
 //                           void* bufOut,
 //                           )
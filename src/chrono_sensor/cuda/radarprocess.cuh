@@ -1,3 +1,5 @@
+#include <vector>
+
 namespace chrono {
 namespace sensor {
 
@@ -19,6 +21,26 @@ void cuda_radar_pointcloud_from_angles(void* bufIn,
                                       CUstream& stream);
 
 
+/// Gathers the clustered radar returns, ordered by cluster, and sums the positions, velocities and amplitudes of each
+/// cluster.
+/// @param bufIn A device pointer to the radar returns in xyz coordinates (RadarXYZReturn).
+/// @param labels A device pointer to the cluster of each return (-1 for the returns that are not clustered).
+/// @param num_points The number of returns.
+/// @param num_clusters The number of clusters.
+/// @param bufOut A pointer accessible from the device, receiving the clustered returns with objectId = cluster + 1.
+/// @param cluster_sums Receives the sums of x, y, z, vel_x, vel_y, vel_z and amplitude of each cluster (7 per cluster).
+/// @param num_valid Receives the number of returns with a positive amplitude.
+/// @param stream The cuda stream for the kernels.
+/// @return The number of clustered returns. The stream is synchronized.
+int cuda_radar_cluster_returns(void* bufIn,
+                               int* labels,
+                               int num_points,
+                               int num_clusters,
+                               void* bufOut,
+                               std::vector<float>& cluster_sums,
+                               int& num_valid,
+                               CUstream& stream);
+
 void cuda_radar_pointcloud_from_depth(void* bufDI,
     void* bufOut,
     int width,
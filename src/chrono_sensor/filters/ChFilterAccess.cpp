@@ -176,6 +176,45 @@ CH_SENSOR_API void ChFilterAccess<SensorHostDepthBuffer, UserDepthBufferPtr>::Ap
     }
 }
 
+template <>
+CH_SENSOR_API void ChFilterAccess<SensorHostFloat4Buffer, UserFloat4BufferPtr>::Apply() {
+    // create a new buffer to push to the lag buffer list
+    std::shared_ptr<SensorHostFloat4Buffer> tmp_buffer;
+    if (m_empty_lag_buffers.size() > 0) {
+        tmp_buffer = m_empty_lag_buffers.top();
+        m_empty_lag_buffers.pop();
+    } else {
+        tmp_buffer = chrono_types::make_shared<SensorHostFloat4Buffer>();
+        std::shared_ptr<PixelFloat4[]> b(cudaHostMallocHelper<PixelFloat4>(m_bufferIn->Width * m_bufferIn->Height),
+                                        cudaHostFreeHelper<PixelFloat4>);
+        tmp_buffer->Buffer = std::move(b);
+    }
+
+    tmp_buffer->Width = m_bufferIn->Width;
+    tmp_buffer->Height = m_bufferIn->Height;
+    tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
+    tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
+
+    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelFloat4), cudaMemcpyDeviceToHost,
+                    m_cuda_stream);
+
+    {  // lock in this scope before pushing to lag buffer queue
+        std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
+        // push our buffer into the lag queue
+        m_lag_buffers.push(tmp_buffer);
+        // prevent lag buffer overflow - remove any old buffers that have expired. We don't want the lag_buffer to
+        // grow unbounded
+        while (m_lag_buffers.size() > m_max_lag_buffers) {
+            m_empty_lag_buffers.push(
+                m_lag_buffers.front());  // push the buffer back for efficiency if it wasn't given to the user
+            m_lag_buffers.pop();
+        }
+        // synchronize the cuda stream since we moved data to the host
+        cudaStreamSynchronize(m_cuda_stream);
+    }
+}
+
 template <>
 CH_SENSOR_API void ChFilterAccess<SensorHostXYZIBuffer, UserXYZIBufferPtr>::Apply() {
     // create a new buffer to push to the lag buffer list
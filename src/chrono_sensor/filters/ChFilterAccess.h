@@ -160,6 +160,8 @@ using ChFilterTachometerAccess = ChFilterAccess<SensorHostTachometerBuffer, User
 // using ChFilterEncoderAccess = ChFilterAccess<SensorHostEncoderBuffer, UserEncoderBufferPtr>;
 /// Access to depth camera data
 using ChFilterDepthAccess = ChFilterAccess<SensorHostDepthBuffer, UserDepthBufferPtr>;
+/// Access to RGBA float data (e.g., screen-space normals)
+using ChFilterFloat4Access = ChFilterAccess<SensorHostFloat4Buffer, UserFloat4BufferPtr>;
 
 /// @}
 
@@ -0,0 +1,203 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Filter for sharing sensor data on the device (GPU), without copies to the
+// host, with consumers outside of the filter graph (inference engines,
+// middleware publishers, or other processes through CUDA IPC).
+//
+// =============================================================================
+
+#ifndef CHFILTERDEVICEACCESS_H
+#define CHFILTERDEVICEACCESS_H
+
+#include <cmath>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <cuda_runtime_api.h>
+
+#include "chrono_sensor/sensors/ChSensorBuffer.h"
+#include "chrono_sensor/filters/ChFilter.h"
+#include "chrono_sensor/sensors/ChOptixSensor.h"
+#include "chrono_sensor/optix/ChOptixUtils.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_filters
+/// @{
+
+/// Handle to sensor data held in device memory.
+/// The data remains valid, and is not overwritten by the filter graph, as long as the handle is held.
+struct SensorDeviceHandle {
+    void* Buffer = nullptr;          ///< device pointer to the data
+    size_t Size = 0;                 ///< size of the data in bytes
+    float TimeStamp = 0;             ///< time stamp of the data (simulation time when data collection stopped)
+    unsigned int Width = 0;          ///< the width of the data (image width when data is an image)
+    unsigned int Height = 0;         ///< the height of the data (image height when data is an image)
+    unsigned int LaunchedCount = 0;  ///< number of times updates had been launched when the data was generated
+
+    /// Event recorded once the data is available on the device. Consumers on other CUDA streams should wait on it
+    /// (cudaStreamWaitEvent) before reading the data.
+    cudaEvent_t Ready = nullptr;
+
+    cudaIpcMemHandle_t IpcMemHandle;      ///< handle for opening the data in another process (cudaIpcOpenMemHandle)
+    cudaIpcEventHandle_t IpcEventHandle;  ///< handle for opening the ready event in another process
+};
+
+/// Filter for accessing the data of a sensor on the device.
+/// Each frame is copied (device to device) into a pool of device buffers that are handed out to consumers, so that
+/// the data can be used without a round trip through host memory. A buffer returns to the pool once all the handles
+/// to it have been released. As for ChFilterAccess, the data is made available after the lag of the sensor.
+template <class BufferType>
+class ChFilterDeviceAccess : public ChFilter {
+  public:
+    /// Class constructor
+    /// @param name String name of the filter. Defaults to empty.
+    ChFilterDeviceAccess(std::string name = {}) : ChFilter(name.length() > 0 ? name : "DeviceAccessFilter") {}
+
+    /// Class destructor. The pool buffers still referenced by consumers are released with their last handle.
+    virtual ~ChFilterDeviceAccess() {}
+
+    /// Apply function. Copies the data into a free device buffer of the pool.
+    virtual void Apply() {
+        std::shared_ptr<Slot> slot;
+        {
+            std::lock_guard<std::mutex> lck(m_mutex);
+            for (auto& s : m_slots) {
+                // a buffer is free if only the pool references it (not the queue, nor a consumer handle)
+                if (s.use_count() == 1) {
+                    slot = s;
+                    break;
+                }
+            }
+        }
+        if (!slot) {
+            slot = CreateSlot();
+            std::lock_guard<std::mutex> lck(m_mutex);
+            m_slots.push_back(slot);
+        }
+
+        SensorDeviceHandle& handle = slot->handle;
+        handle.TimeStamp = m_bufferIn->TimeStamp;
+        handle.Width = m_bufferIn->Width;
+        handle.Height = m_bufferIn->Height;
+        handle.LaunchedCount = m_bufferIn->LaunchedCount;
+        CUDA_ERROR_CHECK(cudaMemcpyAsync(handle.Buffer, m_bufferIn->Buffer.get(), handle.Size, cudaMemcpyDeviceToDevice,
+                                         m_cuda_stream));
+        CUDA_ERROR_CHECK(cudaEventRecord(handle.Ready, m_cuda_stream));
+
+        std::lock_guard<std::mutex> lck(m_mutex);
+        m_queue.push_back(slot);
+        // only keep the frames that could still be requested given the lag
+        while (m_queue.size() > m_max_queued)
+            m_queue.pop_front();
+    }
+
+    /// Initializes all data needed by the filter access apply function.
+    /// @param pSensor A pointer to the sensor.
+    /// @param bufferInOut the incoming process buffer
+    virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut) {
+        if (!bufferInOut)
+            InvalidFilterGraphNullBuffer(pSensor);
+
+        m_bufferIn = std::dynamic_pointer_cast<BufferType>(bufferInOut);
+        if (!m_bufferIn)
+            InvalidFilterGraphBufferTypeMismatch(pSensor);
+
+        if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
+            m_cuda_stream = pOpx->GetCudaStream();
+        } else {
+            InvalidFilterGraphSensorTypeMismatch(pSensor);
+        }
+
+        m_sensor = pSensor;
+        m_max_queued = 1 + (unsigned int)std::ceil((pSensor->GetLag() + pSensor->GetCollectionWindow()) *
+                                                   pSensor->GetUpdateRate());
+    }
+
+    /// Get a handle to the most recent data that is available based on the lag of the sensor.
+    /// Returns an empty pointer if no data is available yet.
+    std::shared_ptr<SensorDeviceHandle> GetBuffer() {
+        auto pSensor = m_sensor.lock();
+        float ch_time = (float)pSensor->GetParent()->GetSystem()->GetChTime();
+
+        std::lock_guard<std::mutex> lck(m_mutex);
+        while (m_queue.size() > 0 && ch_time > m_queue.front()->handle.TimeStamp + pSensor->GetLag() - 1e-7) {
+            m_available = m_queue.front();
+            m_queue.pop_front();
+        }
+        if (!m_available)
+            return nullptr;
+
+        // aliasing constructor: the handle keeps the pool buffer alive and marks it as in use
+        return std::shared_ptr<SensorDeviceHandle>(m_available, &m_available->handle);
+    }
+
+  private:
+    /// A device buffer of the pool.
+    struct Slot {
+        SensorDeviceHandle handle;
+        ~Slot() {
+            cudaEventDestroy(handle.Ready);
+            cudaFree(handle.Buffer);
+        }
+    };
+
+    /// Allocate a new device buffer (with cudaMalloc, as required by CUDA IPC)
+    std::shared_ptr<Slot> CreateSlot() {
+        auto slot = std::make_shared<Slot>();
+        SensorDeviceHandle& handle = slot->handle;
+        using Element = typename decltype(BufferType::Buffer)::element_type;
+        handle.Size = m_bufferIn->Width * m_bufferIn->Height * sizeof(Element);
+        CUDA_ERROR_CHECK(cudaMalloc(&handle.Buffer, handle.Size));
+        CUDA_ERROR_CHECK(cudaEventCreateWithFlags(&handle.Ready, cudaEventDisableTiming | cudaEventInterprocess));
+        CUDA_ERROR_CHECK(cudaIpcGetMemHandle(&handle.IpcMemHandle, handle.Buffer));
+        CUDA_ERROR_CHECK(cudaIpcGetEventHandle(&handle.IpcEventHandle, handle.Ready));
+        return slot;
+    }
+
+    std::shared_ptr<BufferType> m_bufferIn;      ///< shared pointer to the buffer coming in
+    std::weak_ptr<ChSensor> m_sensor;            ///< pointer to the sensor to which this filter is attached
+    CUstream m_cuda_stream;                      ///< reference to the cuda stream of the sensor
+    std::vector<std::shared_ptr<Slot>> m_slots;  ///< pool of device buffers
+    std::deque<std::shared_ptr<Slot>> m_queue;   ///< buffers holding data not yet past the lag of the sensor
+    std::shared_ptr<Slot> m_available;           ///< most recent buffer past the lag of the sensor
+    unsigned int m_max_queued = 1;               ///< maximum number of buffers waiting for the lag
+    std::mutex m_mutex;                          ///< protects the pool and the queue
+};
+
+// Typedefs for explicit filters
+/// Device access to greyscale data
+using ChFilterR8DeviceAccess = ChFilterDeviceAccess<SensorDeviceR8Buffer>;
+/// Device access to RGBA8 data
+using ChFilterRGBA8DeviceAccess = ChFilterDeviceAccess<SensorDeviceRGBA8Buffer>;
+/// Device access to semantic image
+using ChFilterSemanticDeviceAccess = ChFilterDeviceAccess<SensorDeviceSemanticBuffer>;
+/// Device access to point cloud data
+using ChFilterXYZIDeviceAccess = ChFilterDeviceAccess<SensorDeviceXYZIBuffer>;
+/// Device access to depth/intensity data
+using ChFilterDIDeviceAccess = ChFilterDeviceAccess<SensorDeviceDIBuffer>;
+/// Device access to depth camera data
+using ChFilterDepthDeviceAccess = ChFilterDeviceAccess<SensorDeviceDepthBuffer>;
+
+/// @}
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
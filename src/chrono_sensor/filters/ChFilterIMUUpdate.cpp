@@ -49,7 +49,7 @@ CH_SENSOR_API void ChFilterAccelerometerUpdate::Apply() {
     m_bufferOut->Buffer[0].Z = acc.z();
 
     m_bufferOut->LaunchedCount = m_accSensor->GetNumLaunches();
-    m_bufferOut->TimeStamp = (float)m_accSensor->GetParent()->GetSystem()->GetChTime();
+    m_bufferOut->TimeStamp = m_accSensor->GetSampleTime();
 }
 
 CH_SENSOR_API void ChFilterAccelerometerUpdate::Initialize(std::shared_ptr<ChSensor> pSensor,
@@ -94,7 +94,7 @@ CH_SENSOR_API void ChFilterGyroscopeUpdate::Apply() {
     m_bufferOut->Buffer[0].Pitch = ang_vel.y();
     m_bufferOut->Buffer[0].Yaw = ang_vel.z();
     m_bufferOut->LaunchedCount = m_gyroSensor->GetNumLaunches();
-    m_bufferOut->TimeStamp = (float)m_gyroSensor->GetParent()->GetSystem()->GetChTime();
+    m_bufferOut->TimeStamp = m_gyroSensor->GetSampleTime();
 }
 
 CH_SENSOR_API void ChFilterGyroscopeUpdate::Initialize(std::shared_ptr<ChSensor> pSensor,
@@ -167,7 +167,7 @@ CH_SENSOR_API void ChFilterMagnetometerUpdate::Apply() {
     m_bufferOut->Buffer[0].Y = mag_field_sensor.y();  // units of Gauss
     m_bufferOut->Buffer[0].Z = mag_field_sensor.z();  // units of Gauss
     m_bufferOut->LaunchedCount = m_magSensor->GetNumLaunches();
-    m_bufferOut->TimeStamp = (float)m_magSensor->GetParent()->GetSystem()->GetChTime();
+    m_bufferOut->TimeStamp = m_magSensor->GetSampleTime();
 }
 
 CH_SENSOR_API void ChFilterMagnetometerUpdate::Initialize(std::shared_ptr<ChSensor> pSensor,
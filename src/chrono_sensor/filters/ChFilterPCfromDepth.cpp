@@ -26,6 +26,9 @@ namespace sensor {
 
 ChFilterPCfromDepth::ChFilterPCfromDepth(std::string name) : ChFilter(name) {}
 
+ChFilterPCfromDepth::ChFilterPCfromDepth(float voxel_size, std::string name)
+    : ChFilter(name), m_voxel_size(voxel_size) {}
+
 CH_SENSOR_API void ChFilterPCfromDepth::Initialize(std::shared_ptr<ChSensor> pSensor,
                                                    std::shared_ptr<SensorBuffer>& bufferInOut) {
     if (!bufferInOut)
@@ -65,22 +68,15 @@ CH_SENSOR_API void ChFilterPCfromDepth::Apply() {
                                    (int)m_buffer_in->Height, m_hFOV, m_max_vert_angle, m_min_vert_angle, m_cuda_stream);
     }
 
-    // counter for beam returns
-    m_buffer_out->Beam_return_count = 0;
-    auto buf = std::vector<PixelXYZI>(m_buffer_out->Width * m_buffer_out->Height * (m_buffer_out->Dual_return + 1));
-    auto processed_buffer =
-        std::vector<PixelXYZI>(m_buffer_out->Width * m_buffer_out->Height * (m_buffer_out->Dual_return + 1));
-    cudaMemcpyAsync(buf.data(), m_buffer_out->Buffer.get(), buf.size() * sizeof(PixelXYZI), cudaMemcpyDeviceToHost,
-                    m_cuda_stream);
-    cudaStreamSynchronize(m_cuda_stream);
-    for (unsigned int i = 0; i < buf.size(); i++) {
-        if (buf[i].intensity > 0) {
-            processed_buffer[m_buffer_out->Beam_return_count] = buf[i];
-            m_buffer_out->Beam_return_count++;
-        }
+    // remove the beams without returns (and downsample if requested), keeping the point cloud on the device
+    int num_points = (int)(m_buffer_out->Width * m_buffer_out->Height * (m_buffer_out->Dual_return + 1));
+    if (m_voxel_size > 0) {
+        m_buffer_out->Beam_return_count =
+            cuda_pointcloud_voxel_downsample(m_buffer_out->Buffer.get(), num_points, m_voxel_size, m_cuda_stream);
+    } else {
+        m_buffer_out->Beam_return_count =
+            cuda_pointcloud_compact(m_buffer_out->Buffer.get(), num_points, m_cuda_stream);
     }
-    cudaMemcpyAsync(m_buffer_out->Buffer.get(), processed_buffer.data(),
-                    m_buffer_out->Beam_return_count * sizeof(PixelXYZI), cudaMemcpyHostToDevice, m_cuda_stream);
 
     m_buffer_out->LaunchedCount = m_buffer_in->LaunchedCount;
     m_buffer_out->TimeStamp = m_buffer_in->TimeStamp;
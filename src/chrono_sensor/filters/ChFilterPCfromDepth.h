@@ -29,13 +29,19 @@ class ChSensor;
 /// @addtogroup sensor_filters
 /// @{
 
-/// A filter that, when applied to a sensor, generates point cloud data from depth values
+/// A filter that, when applied to a sensor, generates point cloud data from depth values. The points without
+/// intensity are removed on the device, and the cloud can optionally be downsampled on a voxel grid.
 class CH_SENSOR_API ChFilterPCfromDepth : public ChFilter {
   public:
     /// Class constructor
     /// @param name String name of the filter
     ChFilterPCfromDepth(std::string name = {});
 
+    /// Class constructor for a filter that also downsamples the point cloud on a voxel grid
+    /// @param voxel_size Edge length of the voxels, the points of each voxel are replaced by their average
+    /// @param name String name of the filter
+    ChFilterPCfromDepth(float voxel_size, std::string name = {});
+
     /// Apply function. Converts data from depth/intensity to point cloud data
     virtual void Apply();
 
@@ -45,6 +51,7 @@ class CH_SENSOR_API ChFilterPCfromDepth : public ChFilter {
     virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
 
   private:
+    float m_voxel_size = 0.f;                              ///< voxel size of the downsampling, 0 for no downsampling
     float m_hFOV;                                          ///< field of view of the parent lidar
     float m_min_vert_angle;                                ///< mimimum vertical angle of parent lidar
     float m_max_vert_angle;                                ///< maximum vetical angle of parent lidar
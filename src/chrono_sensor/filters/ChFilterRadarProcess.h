@@ -33,7 +33,8 @@ class ChSensor;
 /// @{
 
 /// A filter that, when applied to a sensor, converts the depth values to pointcloud,
-/// clusters, and calculates velocity and centroid
+/// clusters, and calculates velocity and centroid. The clustering (DBSCAN) runs on the device, only the clustered
+/// returns and the sums over each cluster are copied to the host.
 class CH_SENSOR_API ChFilterRadarProcess : public ChFilter {
   public:
     /// Class constructor
@@ -55,6 +56,8 @@ class CH_SENSOR_API ChFilterRadarProcess : public ChFilter {
     CUstream m_cuda_stream;                                  /// reference to the cuda stream
     float m_hFOV;                                            /// horizontal field of view of the radar
     float m_vFOV;                                            /// mimimum vertical angle of the radar
+    std::shared_ptr<RadarXYZReturn> m_points;                /// device point cloud used for clustering
+    std::shared_ptr<int> m_labels;                           /// device cluster label of each point
     #if PROFILE
     unsigned int m_scan_number = 0;
     #endif
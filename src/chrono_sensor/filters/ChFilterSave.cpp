@@ -22,6 +22,8 @@
 #include "chrono_thirdparty/stb/stb_image_write.h"
 #include "chrono_thirdparty/filesystem/path.h"
 
+#include <algorithm>
+#include <fstream>
 #include <vector>
 #include <sstream>
 
@@ -30,43 +32,133 @@
 namespace chrono {
 namespace sensor {
 
-CH_SENSOR_API ChFilterSave::ChFilterSave(std::string data_path, std::string name) : ChFilter(name) {
+CH_SENSOR_API ChFilterSave::ChFilterSave(std::string data_path,
+                                         std::string name,
+                                         SaveFormat format,
+                                         unsigned int num_workers,
+                                         unsigned int max_queued)
+    : ChFilter(name), m_format(format), m_num_workers(num_workers), m_max_queued(std::max(1u, max_queued)) {
     m_path = data_path;
 }
 
+CH_SENSOR_API ChFilterSave::~ChFilterSave() {
+    // let the workers finish the queued frames
+    {
+        std::lock_guard<std::mutex> lck(m_mutex);
+        m_terminate = true;
+    }
+    m_cv.notify_all();
+    for (auto& worker : m_workers) {
+        if (worker.joinable())
+            worker.join();
+    }
+}
+
 CH_SENSOR_API void ChFilterSave::Apply() {
-    std::string filename = m_path + "frame_" + std::to_string(m_frame_number) + ".png";
+    std::string filename = m_path + "frame_" + std::to_string(m_frame_number);
+    switch (m_format) {
+        case SaveFormat::TGA:
+            filename += ".tga";
+            break;
+        case SaveFormat::BMP:
+            filename += ".bmp";
+            break;
+        case SaveFormat::RAW:
+            filename += ".pam";
+            break;
+        default:
+            filename += ".png";
+            break;
+    }
     m_frame_number++;
 
-    if (m_r8_in) {
-        cudaMemcpyAsync(m_host_r8->Buffer.get(), m_r8_in->Buffer.get(), m_r8_in->Width * m_r8_in->Height * sizeof(char),
-                        cudaMemcpyDeviceToHost, m_cuda_stream);
-        cudaStreamSynchronize(m_cuda_stream);
-        // write a grayscale png
-        if (!stbi_write_png(filename.c_str(), m_host_r8->Width, m_host_r8->Height, 1, m_host_r8->Buffer.get(),
-                            m_host_r8->Width)) {
-            std::cerr << "Failed to write R8 image: " << filename << "\n";
+    const void* device_data = nullptr;
+    if (m_r8_in)
+        device_data = m_r8_in->Buffer.get();
+    else if (m_rgba8_in)
+        device_data = m_rgba8_in->Buffer.get();
+    else if (m_semantic_in)
+        device_data = m_semantic_in->Buffer.get();
+
+    // get a free host buffer, waiting for the workers if all buffers are queued
+    unsigned int buffer;
+    {
+        std::unique_lock<std::mutex> lck(m_mutex);
+        while (m_free_buffers.empty())
+            m_cv.wait(lck);
+        buffer = m_free_buffers.back();
+        m_free_buffers.pop_back();
+    }
+
+    cudaMemcpyAsync(m_host_buffers[buffer].get(), device_data, m_width * m_height * m_channels,
+                    cudaMemcpyDeviceToHost, m_cuda_stream);
+    cudaStreamSynchronize(m_cuda_stream);
+
+    if (m_workers.empty()) {
+        if (!WriteImage(filename, m_format, m_width, m_height, m_channels, m_host_buffers[buffer].get()))
+            std::cerr << "Failed to write image: " << filename << "\n";
+        m_free_buffers.push_back(buffer);
+        return;
+    }
+
+    // hand the frame to the workers
+    {
+        std::lock_guard<std::mutex> lck(m_mutex);
+        m_jobs.push_back({filename, buffer});
+    }
+    m_cv.notify_all();
+}
+
+void ChFilterSave::WorkerProcess() {
+    while (true) {
+        SaveJob job;
+        {
+            std::unique_lock<std::mutex> lck(m_mutex);
+            while (m_jobs.empty() && !m_terminate)
+                m_cv.wait(lck);
+            if (m_jobs.empty())
+                return;
+            job = m_jobs.front();
+            m_jobs.pop_front();
         }
-    } else if (m_rgba8_in) {
-        cudaMemcpyAsync(m_host_rgba8->Buffer.get(), m_rgba8_in->Buffer.get(),
-                        m_rgba8_in->Width * m_rgba8_in->Height * sizeof(PixelRGBA8), cudaMemcpyDeviceToHost,
-                        m_cuda_stream);
-        cudaStreamSynchronize(m_cuda_stream);
-        // write an rgba png
-        if (!stbi_write_png(filename.c_str(), m_host_rgba8->Width, m_host_rgba8->Height, sizeof(PixelRGBA8),
-                            m_host_rgba8->Buffer.get(), sizeof(PixelRGBA8) * m_host_rgba8->Width)) {
-            std::cerr << "Failed to write RGBA8 image: " << filename << "\n";
+
+        if (!WriteImage(job.filename, m_format, m_width, m_height, m_channels, m_host_buffers[job.buffer].get()))
+            std::cerr << "Failed to write image: " << job.filename << "\n";
+
+        // recycle the host buffer
+        {
+            std::lock_guard<std::mutex> lck(m_mutex);
+            m_free_buffers.push_back(job.buffer);
         }
-    } else if (m_semantic_in) {
-        cudaMemcpyAsync(m_host_semantic->Buffer.get(), m_semantic_in->Buffer.get(),
-                        m_semantic_in->Width * m_semantic_in->Height * sizeof(PixelSemantic), cudaMemcpyDeviceToHost,
-                        m_cuda_stream);
-        cudaStreamSynchronize(m_cuda_stream);
-        // write an rgba png
-        if (!stbi_write_png(filename.c_str(), m_host_semantic->Width, m_host_semantic->Height, 4,
-                            m_host_semantic->Buffer.get(), 4 * m_host_semantic->Width)) {
-            std::cerr << "Failed to write semantic image: " << filename << "\n";
+        m_cv.notify_all();
+    }
+}
+
+bool ChFilterSave::WriteImage(const std::string& filename,
+                              SaveFormat format,
+                              int width,
+                              int height,
+                              int channels,
+                              const unsigned char* data) {
+    switch (format) {
+        case SaveFormat::TGA:
+            return stbi_write_tga(filename.c_str(), width, height, channels, data) != 0;
+        case SaveFormat::BMP:
+            return stbi_write_bmp(filename.c_str(), width, height, channels, data) != 0;
+        case SaveFormat::RAW: {
+            std::ofstream file(filename, std::ios::binary);
+            if (!file)
+                return false;
+            file << "P7\nWIDTH " << width << "\nHEIGHT " << height << "\nDEPTH " << channels
+                 << "\nMAXVAL 255\nTUPLTYPE " << (channels == 1 ? "GRAYSCALE" : "RGB_ALPHA") << "\nENDHDR\n";
+            // rows top to bottom, as for the other formats
+            size_t row_size = (size_t)width * channels;
+            for (int j = height - 1; j >= 0; j--)
+                file.write(reinterpret_cast<const char*>(data + j * row_size), row_size);
+            return file.good();
         }
+        default:
+            return stbi_write_png(filename.c_str(), width, height, channels, data, width * channels) != 0;
     }
 }
 
@@ -77,33 +169,32 @@ CH_SENSOR_API void ChFilterSave::Initialize(std::shared_ptr<ChSensor> pSensor,
 
     if (auto pR8 = std::dynamic_pointer_cast<SensorDeviceR8Buffer>(bufferInOut)) {
         m_r8_in = pR8;
-        m_host_r8 = chrono_types::make_shared<SensorHostR8Buffer>();
-        std::shared_ptr<char[]> b(cudaHostMallocHelper<char>(m_r8_in->Width * m_r8_in->Height),
-                                  cudaHostFreeHelper<char>);
-        m_host_r8->Buffer = std::move(b);
-        m_host_r8->Width = m_r8_in->Width;
-        m_host_r8->Height = m_r8_in->Height;
+        m_width = m_r8_in->Width;
+        m_height = m_r8_in->Height;
+        m_channels = 1;
     } else if (auto pRGBA8 = std::dynamic_pointer_cast<SensorDeviceRGBA8Buffer>(bufferInOut)) {
         m_rgba8_in = pRGBA8;
-        m_host_rgba8 = chrono_types::make_shared<SensorHostRGBA8Buffer>();
-        std::shared_ptr<PixelRGBA8[]> b(cudaHostMallocHelper<PixelRGBA8>(m_rgba8_in->Width * m_rgba8_in->Height),
-                                        cudaHostFreeHelper<PixelRGBA8>);
-        m_host_rgba8->Buffer = std::move(b);
-        m_host_rgba8->Width = m_rgba8_in->Width;
-        m_host_rgba8->Height = m_rgba8_in->Height;
+        m_width = m_rgba8_in->Width;
+        m_height = m_rgba8_in->Height;
+        m_channels = sizeof(PixelRGBA8);
     } else if (auto pSemantic = std::dynamic_pointer_cast<SensorDeviceSemanticBuffer>(bufferInOut)) {
         m_semantic_in = pSemantic;
-        m_host_semantic = chrono_types::make_shared<SensorHostSemanticBuffer>();
-        std::shared_ptr<PixelSemantic[]> b(
-            cudaHostMallocHelper<PixelSemantic>(m_semantic_in->Width * m_semantic_in->Height),
-            cudaHostFreeHelper<PixelSemantic>);
-        m_host_semantic->Buffer = std::move(b);
-        m_host_semantic->Width = m_semantic_in->Width;
-        m_host_semantic->Height = m_semantic_in->Height;
+        m_width = m_semantic_in->Width;
+        m_height = m_semantic_in->Height;
+        m_channels = sizeof(PixelSemantic);
     } else {
         InvalidFilterGraphBufferTypeMismatch(pSensor);
     }
 
+    // one host buffer per frame that can be queued or encoded at the same time
+    unsigned int num_buffers = m_num_workers > 0 ? m_max_queued + m_num_workers : 1;
+    for (unsigned int i = 0; i < num_buffers; i++) {
+        std::shared_ptr<unsigned char[]> b(cudaHostMallocHelper<unsigned char>(m_width * m_height * m_channels),
+                                           cudaHostFreeHelper<unsigned char>);
+        m_host_buffers.push_back(std::move(b));
+        m_free_buffers.push_back(i);
+    }
+
     if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
         m_cuda_stream = pOpx->GetCudaStream();
     }
@@ -136,6 +227,9 @@ CH_SENSOR_API void ChFilterSave::Initialize(std::shared_ptr<ChSensor> pSensor,
 
     // openGL buffers are bottom to top...so flip when writing png.
     stbi_flip_vertically_on_write(1);
+
+    for (unsigned int i = 0; i < m_num_workers; i++)
+        m_workers.emplace_back(&ChFilterSave::WorkerProcess, this);
 }
 
 }  // namespace sensor
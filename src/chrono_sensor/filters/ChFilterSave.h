@@ -20,6 +20,12 @@
 
 #include "chrono_sensor/filters/ChFilter.h"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include <cuda.h>
 
 namespace chrono {
@@ -31,16 +37,35 @@ class ChSensor;
 /// @addtogroup sensor_filters
 /// @{
 
+/// Image file formats supported by ChFilterSave.
+enum class SaveFormat {
+    PNG,  ///< compressed PNG (slowest to encode, smallest files)
+    TGA,  ///< run-length encoded TGA (lossless, fast to encode)
+    BMP,  ///< uncompressed BMP
+    RAW   ///< uncompressed PAM (binary netpbm: short text header followed by the raw pixels)
+};
+
 /// A filter that, when applied to a sensor, saves the data as an image.
+/// By default, images are encoded and written on the sensor's render thread. If worker threads are requested, each
+/// frame is copied to a recycled pinned host buffer and handed to the workers for encoding, so that the sensor pipeline
+/// is not blocked by the compression. If all buffers are in use (the workers fall behind), the filter waits for one to
+/// become available.
 class CH_SENSOR_API ChFilterSave : public ChFilter {
   public:
     /// Class constructor
     /// @param data_path The path to save the data
     /// @param name the name of the filter
-    ChFilterSave(std::string data_path = "", std::string name = "ChFilterSave");
-
-    /// Class destructor
-    virtual ~ChFilterSave() {}
+    /// @param format the file format of the saved images
+    /// @param num_workers number of threads encoding the images (0: encode on the sensor's render thread)
+    /// @param max_queued maximum number of frames waiting for a worker before the filter blocks
+    ChFilterSave(std::string data_path = "",
+                 std::string name = "ChFilterSave",
+                 SaveFormat format = SaveFormat::PNG,
+                 unsigned int num_workers = 0,
+                 unsigned int max_queued = 4);
+
+    /// Class destructor. Waits for all queued frames to be written.
+    virtual ~ChFilterSave();
 
     /// Apply function. Saves image data.
     virtual void Apply();
@@ -51,17 +76,44 @@ class CH_SENSOR_API ChFilterSave : public ChFilter {
     virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
 
   private:
+    /// A frame waiting to be encoded.
+    struct SaveJob {
+        std::string filename;  ///< name of the file to write
+        unsigned int buffer;   ///< index of the host buffer holding the pixels
+    };
+
+    /// Write an image with the given format (pixel rows are stored bottom to top).
+    static bool WriteImage(const std::string& filename,
+                           SaveFormat format,
+                           int width,
+                           int height,
+                           int channels,
+                           const unsigned char* data);
+
+    /// Encode the frames in the queue until the filter is destroyed.
+    void WorkerProcess();
+
     std::string m_path;               ///< path to where data should be saved
     unsigned int m_frame_number = 0;  ///< frame counter to prevent overwriting data
-
-    std::shared_ptr<SensorDeviceRGBA8Buffer> m_rgba8_in;  ///< input buffer for rgba8 image
-    std::shared_ptr<SensorHostRGBA8Buffer> m_host_rgba8;  ///< host buffer for rgba8 image
-
-    std::shared_ptr<SensorDeviceR8Buffer> m_r8_in;  ///< input buffer for r8 image
-    std::shared_ptr<SensorHostR8Buffer> m_host_r8;  ///< host buffer for r8 image
-
-    std::shared_ptr<SensorHostSemanticBuffer> m_semantic_in;    ///< input buffer for semantic image
-    std::shared_ptr<SensorHostSemanticBuffer> m_host_semantic;  ///< host buffer for semantic image
+    SaveFormat m_format;              ///< file format of the saved images
+    unsigned int m_num_workers;       ///< number of encoding threads
+    unsigned int m_max_queued;        ///< maximum number of frames waiting for a worker
+
+    std::shared_ptr<SensorDeviceRGBA8Buffer> m_rgba8_in;        ///< input buffer for rgba8 image
+    std::shared_ptr<SensorDeviceR8Buffer> m_r8_in;              ///< input buffer for r8 image
+    std::shared_ptr<SensorDeviceSemanticBuffer> m_semantic_in;  ///< input buffer for semantic image
+
+    unsigned int m_width = 0;     ///< width of the images
+    unsigned int m_height = 0;    ///< height of the images
+    unsigned int m_channels = 0;  ///< number of 8-bit channels of the images
+
+    std::vector<std::shared_ptr<unsigned char[]>> m_host_buffers;  ///< pinned host buffers for the frames
+    std::vector<unsigned int> m_free_buffers;                      ///< host buffers available for new frames
+    std::deque<SaveJob> m_jobs;                                    ///< frames waiting to be encoded
+    std::vector<std::thread> m_workers;                            ///< encoding threads
+    std::mutex m_mutex;                                            ///< protects the job queue and free buffers
+    std::condition_variable m_cv;                                  ///< signals new jobs and freed buffers
+    bool m_terminate = false;                                      ///< tells the workers to stop
 
     CUstream m_cuda_stream;  ///< reference to the cuda stream
 };
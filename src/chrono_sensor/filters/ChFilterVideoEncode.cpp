@@ -0,0 +1,225 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// =============================================================================
+
+#include "chrono_sensor/filters/ChFilterVideoEncode.h"
+#include "chrono_sensor/sensors/ChOptixSensor.h"
+#include "chrono_sensor/cuda/image_ops.cuh"
+#include "chrono_sensor/utils/CudaMallocHelper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+#include <cuda_runtime_api.h>
+
+namespace chrono {
+namespace sensor {
+
+// throw an exception with the name of the failed NVENC call
+static void NvencCheck(NVENCSTATUS status, const char* call) {
+    if (status != NV_ENC_SUCCESS) {
+        std::stringstream ss;
+        ss << "NVENC call '" << call << "' failed with error " << status;
+        throw std::runtime_error(ss.str());
+    }
+}
+
+CH_SENSOR_API ChFilterVideoEncode::ChFilterVideoEncode(std::string filename,
+                                                       VideoCodec codec,
+                                                       unsigned int bitrate,
+                                                       std::string name)
+    : ChFilter(name), m_filename(filename), m_codec(codec), m_bitrate(bitrate), m_frame_number(0) {}
+
+CH_SENSOR_API ChFilterVideoEncode::~ChFilterVideoEncode() {
+    ReleaseEncoder();
+}
+
+void ChFilterVideoEncode::ReleaseEncoder() {
+    if (m_encoder) {
+        // flush the frames still in the encoder
+        try {
+            EncodeFrame(nullptr, NV_ENC_BUFFER_FORMAT_UNDEFINED);
+        } catch (std::exception& e) {
+            std::cerr << "Failed to flush video encoder: " << e.what() << "\n";
+        }
+        if (m_bitstream)
+            m_nvenc.nvEncDestroyBitstreamBuffer(m_encoder, m_bitstream);
+        if (m_registered_frame)
+            m_nvenc.nvEncUnregisterResource(m_encoder, m_registered_frame);
+        m_nvenc.nvEncDestroyEncoder(m_encoder);
+    }
+    if (md_frame)
+        cudaFree(reinterpret_cast<void*>(md_frame));
+    m_encoder = nullptr;
+    m_bitstream = nullptr;
+    m_registered_frame = nullptr;
+    md_frame = {};
+}
+
+CH_SENSOR_API void ChFilterVideoEncode::Apply() {
+    // NVENC expects the rows top to bottom, the render buffers are bottom to top
+    cuda_image_flip_rows(m_buffer_in->Buffer.get(), reinterpret_cast<void*>(md_frame), m_buffer_in->Width,
+                         m_buffer_in->Height, sizeof(PixelRGBA8), m_cuda_stream);
+    cudaStreamSynchronize(m_cuda_stream);
+
+    NV_ENC_MAP_INPUT_RESOURCE map = {NV_ENC_MAP_INPUT_RESOURCE_VER};
+    map.registeredResource = m_registered_frame;
+    NvencCheck(m_nvenc.nvEncMapInputResource(m_encoder, &map), "nvEncMapInputResource");
+
+    EncodeFrame(map.mappedResource, map.mappedBufferFmt);
+
+    NvencCheck(m_nvenc.nvEncUnmapInputResource(m_encoder, map.mappedResource), "nvEncUnmapInputResource");
+}
+
+void ChFilterVideoEncode::EncodeFrame(NV_ENC_INPUT_PTR input, NV_ENC_BUFFER_FORMAT format) {
+    NV_ENC_PIC_PARAMS pic = {NV_ENC_PIC_PARAMS_VER};
+    if (input) {
+        pic.inputBuffer = input;
+        pic.bufferFmt = format;
+        pic.inputWidth = m_buffer_in->Width;
+        pic.inputHeight = m_buffer_in->Height;
+        pic.inputPitch = m_buffer_in->Width;
+        pic.inputTimeStamp = m_frame_number++;
+        pic.outputBitstream = m_bitstream;
+        pic.pictureStruct = NV_ENC_PIC_STRUCT_FRAME;
+    } else {
+        pic.encodePicFlags = NV_ENC_PIC_FLAG_EOS;
+    }
+
+    NVENCSTATUS status = m_nvenc.nvEncEncodePicture(m_encoder, &pic);
+    if (!input || status == NV_ENC_ERR_NEED_MORE_INPUT)
+        return;
+    NvencCheck(status, "nvEncEncodePicture");
+
+    // no B-frames: the bitstream of the frame is available immediately
+    NV_ENC_LOCK_BITSTREAM lock = {NV_ENC_LOCK_BITSTREAM_VER};
+    lock.outputBitstream = m_bitstream;
+    NvencCheck(m_nvenc.nvEncLockBitstream(m_encoder, &lock), "nvEncLockBitstream");
+    m_file.write(reinterpret_cast<const char*>(lock.bitstreamBufferPtr), lock.bitstreamSizeInBytes);
+    NvencCheck(m_nvenc.nvEncUnlockBitstream(m_encoder, m_bitstream), "nvEncUnlockBitstream");
+}
+
+CH_SENSOR_API void ChFilterVideoEncode::Initialize(std::shared_ptr<ChSensor> pSensor,
+                                                   std::shared_ptr<SensorBuffer>& bufferInOut) {
+    if (!bufferInOut)
+        InvalidFilterGraphNullBuffer(pSensor);
+
+    m_buffer_in = std::dynamic_pointer_cast<SensorDeviceRGBA8Buffer>(bufferInOut);
+    if (!m_buffer_in)
+        InvalidFilterGraphBufferTypeMismatch(pSensor);
+
+    if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
+        m_cuda_stream = pOpx->GetCudaStream();
+    } else {
+        InvalidFilterGraphSensorTypeMismatch(pSensor);
+    }
+
+    // the filter is initialized again when its sensor is moved to another engine: the new encoding session starts
+    // with a key frame and its stream is appended to the same file
+    ReleaseEncoder();
+
+    unsigned int width = m_buffer_in->Width;
+    unsigned int height = m_buffer_in->Height;
+    CUDA_ERROR_CHECK(cudaMalloc(reinterpret_cast<void**>(&md_frame), width * height * sizeof(PixelRGBA8)));
+
+    // open an encoding session on the current CUDA context
+    m_nvenc.version = NV_ENCODE_API_FUNCTION_LIST_VER;
+    NvencCheck(NvEncodeAPICreateInstance(&m_nvenc), "NvEncodeAPICreateInstance");
+
+    CUcontext context;
+    cudaFree(0);  // make sure the primary context of the device is initialized
+    if (cuCtxGetCurrent(&context) != CUDA_SUCCESS || !context)
+        throw std::runtime_error("ChFilterVideoEncode requires a current CUDA context");
+
+    NV_ENC_OPEN_ENCODE_SESSION_EX_PARAMS session = {NV_ENC_OPEN_ENCODE_SESSION_EX_PARAMS_VER};
+    session.deviceType = NV_ENC_DEVICE_TYPE_CUDA;
+    session.device = context;
+    session.apiVersion = NVENCAPI_VERSION;
+    NvencCheck(m_nvenc.nvEncOpenEncodeSessionEx(&session, &m_encoder), "nvEncOpenEncodeSessionEx");
+
+    GUID codec_guid;
+    switch (m_codec) {
+        case VideoCodec::HEVC:
+            codec_guid = NV_ENC_CODEC_HEVC_GUID;
+            break;
+        case VideoCodec::AV1:
+#if NVENCAPI_MAJOR_VERSION >= 12
+            codec_guid = NV_ENC_CODEC_AV1_GUID;
+            break;
+#else
+            throw std::runtime_error("AV1 encoding requires Video Codec SDK 12 or newer");
+#endif
+        default:
+            codec_guid = NV_ENC_CODEC_H264_GUID;
+            break;
+    }
+
+    // start from the default preset, with a constant bitrate and no B-frames (low latency)
+    NV_ENC_PRESET_CONFIG preset = {NV_ENC_PRESET_CONFIG_VER, {NV_ENC_CONFIG_VER}};
+    NvencCheck(m_nvenc.nvEncGetEncodePresetConfigEx(m_encoder, codec_guid, NV_ENC_PRESET_P4_GUID,
+                                                    NV_ENC_TUNING_INFO_HIGH_QUALITY, &preset),
+               "nvEncGetEncodePresetConfigEx");
+    NV_ENC_CONFIG config = preset.presetCfg;
+    config.frameIntervalP = 1;
+    config.rcParams.rateControlMode = NV_ENC_PARAMS_RC_CBR;
+    config.rcParams.averageBitRate = m_bitrate;
+    config.rcParams.maxBitRate = m_bitrate;
+
+    unsigned int frame_rate = std::max(1u, (unsigned int)std::round(pSensor->GetUpdateRate()));
+    config.gopLength = 2 * frame_rate;
+    if (m_codec == VideoCodec::H264)
+        config.encodeCodecConfig.h264Config.idrPeriod = config.gopLength;
+    else if (m_codec == VideoCodec::HEVC)
+        config.encodeCodecConfig.hevcConfig.idrPeriod = config.gopLength;
+
+    NV_ENC_INITIALIZE_PARAMS init = {NV_ENC_INITIALIZE_PARAMS_VER};
+    init.encodeGUID = codec_guid;
+    init.presetGUID = NV_ENC_PRESET_P4_GUID;
+    init.tuningInfo = NV_ENC_TUNING_INFO_HIGH_QUALITY;
+    init.encodeWidth = width;
+    init.encodeHeight = height;
+    init.darWidth = width;
+    init.darHeight = height;
+    init.frameRateNum = frame_rate;
+    init.frameRateDen = 1;
+    init.enablePTD = 1;
+    init.encodeConfig = &config;
+    NvencCheck(m_nvenc.nvEncInitializeEncoder(m_encoder, &init), "nvEncInitializeEncoder");
+
+    // register the device image (RGBA8 bytes correspond to NVENC's ABGR word-ordered format)
+    NV_ENC_REGISTER_RESOURCE resource = {NV_ENC_REGISTER_RESOURCE_VER};
+    resource.resourceType = NV_ENC_INPUT_RESOURCE_TYPE_CUDADEVICEPTR;
+    resource.resourceToRegister = reinterpret_cast<void*>(md_frame);
+    resource.width = width;
+    resource.height = height;
+    resource.pitch = width * sizeof(PixelRGBA8);
+    resource.bufferFormat = NV_ENC_BUFFER_FORMAT_ABGR;
+    resource.bufferUsage = NV_ENC_INPUT_IMAGE;
+    NvencCheck(m_nvenc.nvEncRegisterResource(m_encoder, &resource), "nvEncRegisterResource");
+    m_registered_frame = resource.registeredResource;
+
+    NV_ENC_CREATE_BITSTREAM_BUFFER bitstream = {NV_ENC_CREATE_BITSTREAM_BUFFER_VER};
+    NvencCheck(m_nvenc.nvEncCreateBitstreamBuffer(m_encoder, &bitstream), "nvEncCreateBitstreamBuffer");
+    m_bitstream = bitstream.bitstreamBuffer;
+
+    if (!m_file.is_open())
+        m_file.open(m_filename, std::ios::binary);
+    if (!m_file)
+        throw std::runtime_error("Could not open video file: " + m_filename);
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,102 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Filter for encoding the images of a camera into a video stream on the GPU
+// (available when Chrono::Sensor is built with NVENC support).
+//
+// =============================================================================
+
+#ifndef CHFILTERVIDEOENCODE_H
+#define CHFILTERVIDEOENCODE_H
+
+#include "chrono_sensor/filters/ChFilter.h"
+
+#include <fstream>
+
+#include <cuda.h>
+#include <nvEncodeAPI.h>
+
+namespace chrono {
+namespace sensor {
+
+// forward declaration
+class ChSensor;
+
+/// @addtogroup sensor_filters
+/// @{
+
+/// Video codecs supported by ChFilterVideoEncode.
+enum class VideoCodec {
+    H264,  ///< H.264 / AVC
+    HEVC,  ///< H.265 / HEVC
+    AV1    ///< AV1 (requires a GPU and driver with AV1 encoding support)
+};
+
+/// A filter that, when applied to a sensor, encodes its RGBA8 images into a video stream with the GPU video encoder
+/// (NVENC). The images are encoded directly from the device buffer, without copying them to the host; only the
+/// compressed stream is copied back and appended to the output file. The file is a raw elementary stream (Annex B for
+/// H.264 and HEVC, OBU for AV1), which can be placed in a container without re-encoding (e.g. "ffmpeg -i video.h264
+/// -c copy video.mp4").
+class CH_SENSOR_API ChFilterVideoEncode : public ChFilter {
+  public:
+    /// Class constructor
+    /// @param filename The name of the output video file
+    /// @param codec The video codec to use
+    /// @param bitrate The average bitrate of the stream, in bits per second
+    /// @param name The name of the filter
+    ChFilterVideoEncode(std::string filename,
+                        VideoCodec codec = VideoCodec::H264,
+                        unsigned int bitrate = 10000000,
+                        std::string name = "ChFilterVideoEncode");
+
+    /// Class destructor. Flushes the encoder and closes the video file.
+    virtual ~ChFilterVideoEncode();
+
+    /// Apply function. Encodes the image into the video stream.
+    virtual void Apply();
+
+    /// Initializes all data needed by the filter access apply function.
+    /// @param pSensor A pointer to the sensor on which the filter is attached.
+    /// @param bufferInOut A buffer that is passed into the filter.
+    virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
+
+  private:
+    /// Encode a frame (or flush the encoder if there is no input) and write the resulting bitstream
+    void EncodeFrame(NV_ENC_INPUT_PTR input, NV_ENC_BUFFER_FORMAT format);
+
+    /// Flush the encoder and release the encoding session and the device image
+    void ReleaseEncoder();
+
+    std::string m_filename;   ///< name of the output file
+    VideoCodec m_codec;       ///< video codec
+    unsigned int m_bitrate;   ///< average bitrate of the stream
+    std::ofstream m_file;     ///< output file
+    uint64_t m_frame_number;  ///< number of encoded frames
+
+    std::shared_ptr<SensorDeviceRGBA8Buffer> m_buffer_in;  ///< input buffer for rgba8 image
+    CUdeviceptr md_frame = {};                              ///< device image in top to bottom row order
+    CUstream m_cuda_stream;                                 ///< reference to the cuda stream
+
+    NV_ENCODE_API_FUNCTION_LIST m_nvenc = {};            ///< NVENC entry points
+    void* m_encoder = nullptr;                           ///< NVENC encoding session
+    NV_ENC_REGISTERED_PTR m_registered_frame = nullptr;  ///< device image registered with the encoder
+    NV_ENC_OUTPUT_PTR m_bitstream = nullptr;             ///< output bitstream buffer
+};
+
+/// @}
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
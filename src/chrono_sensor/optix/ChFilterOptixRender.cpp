@@ -18,6 +18,7 @@
 #include <assert.h>
 #include <algorithm>
 #include "chrono_sensor/sensors/ChCameraSensor.h"
+#include "chrono_sensor/sensors/ChMultiCameraSensor.h"
 #include "chrono_sensor/sensors/ChSegmentationCamera.h"
 #include "chrono_sensor/sensors/ChDepthCamera.h"
 #include "chrono_sensor/sensors/ChLidarSensor.h"
@@ -43,15 +44,20 @@ CH_SENSOR_API void ChFilterOptixRender::Apply() {
     m_bufferOut->LaunchedCount = pOptixSensor->GetNumLaunches();
     m_bufferOut->TimeStamp = m_time_stamp;
 
-    cudaMemcpyAsync(reinterpret_cast<void*>(m_optix_sbt->raygenRecord), m_raygen_record.get(),
-                    sizeof(Record<RaygenParameters>), cudaMemcpyHostToDevice, m_cuda_stream);
-
-    OPTIX_ERROR_CHECK(optixLaunch(m_optix_pipeline, m_cuda_stream, reinterpret_cast<CUdeviceptr>(m_optix_params),
-                                  sizeof(ContextParameters), m_optix_sbt.get(),
-                                  m_bufferOut->Width,   // launch width
-                                  m_bufferOut->Height,  // launch height
-                                  1                     // launch depth
-                                  ));
+    if (m_batched) {
+        // the data was already rendered by the engine, possibly on another stream
+        CUDA_ERROR_CHECK(cudaStreamWaitEvent(m_cuda_stream, m_batch_event, 0));
+    } else {
+        cudaMemcpyAsync(reinterpret_cast<void*>(m_optix_sbt->raygenRecord), m_raygen_record.get(),
+                        sizeof(Record<RaygenParameters>), cudaMemcpyHostToDevice, m_cuda_stream);
+
+        OPTIX_ERROR_CHECK(optixLaunch(m_optix_pipeline, m_cuda_stream, reinterpret_cast<CUdeviceptr>(m_optix_params),
+                                      sizeof(ContextParameters), m_optix_sbt.get(),
+                                      m_bufferOut->Width,   // launch width
+                                      m_bufferOut->Height,  // launch height
+                                      1                     // launch depth
+                                      ));
+    }
 
     // run the denoiser if it has been created
     if (m_denoiser) {
@@ -122,6 +128,46 @@ CH_SENSOR_API void ChFilterOptixRender::Initialize(std::shared_ptr<ChSensor> pSe
                                    normal_buffer, reinterpret_cast<half4*>(bufferOut->Buffer.get()));
         }
 
+        if (auto multi = std::dynamic_pointer_cast<ChMultiCameraSensor>(pSensor)) {
+            // additional outputs written from the same primary rays
+            unsigned int w = pOptixSensor->GetWidth();
+            unsigned int h = pOptixSensor->GetHeight();
+            m_raygen_record->data.specific.multiCamera.max_depth = multi->GetMaxDepth();
+            m_raygen_record->data.specific.multiCamera.depth_buffer = {};
+            m_raygen_record->data.specific.multiCamera.semantic_buffer = {};
+            m_raygen_record->data.specific.multiCamera.normal_buffer = {};
+
+            if (multi->IsOutputEnabled(ChMultiCameraSensor::Output::DEPTH)) {
+                auto depth = chrono_types::make_shared<SensorDeviceDepthBuffer>();
+                DeviceDepthBufferPtr db(cudaMallocHelper<PixelDepth>(w * h), cudaFreeHelper<PixelDepth>);
+                depth->Buffer = std::move(db);
+                m_raygen_record->data.specific.multiCamera.depth_buffer = reinterpret_cast<float*>(depth->Buffer.get());
+                multi->m_outputs[(int)ChMultiCameraSensor::Output::DEPTH].buffer = depth;
+            }
+            if (multi->IsOutputEnabled(ChMultiCameraSensor::Output::SEGMENTATION)) {
+                auto semantic = chrono_types::make_shared<SensorDeviceSemanticBuffer>();
+                DeviceSemanticBufferPtr sb(cudaMallocHelper<PixelSemantic>(w * h), cudaFreeHelper<PixelSemantic>);
+                semantic->Buffer = std::move(sb);
+                m_raygen_record->data.specific.multiCamera.semantic_buffer =
+                    reinterpret_cast<ushort2*>(semantic->Buffer.get());
+                multi->m_outputs[(int)ChMultiCameraSensor::Output::SEGMENTATION].buffer = semantic;
+            }
+            if (multi->IsOutputEnabled(ChMultiCameraSensor::Output::NORMALS)) {
+                auto normals = chrono_types::make_shared<SensorDeviceFloat4Buffer>();
+                DeviceFloat4BufferPtr nb(cudaMallocHelper<PixelFloat4>(w * h), cudaFreeHelper<PixelFloat4>);
+                normals->Buffer = std::move(nb);
+                m_raygen_record->data.specific.multiCamera.normal_buffer =
+                    reinterpret_cast<float4*>(normals->Buffer.get());
+                multi->m_outputs[(int)ChMultiCameraSensor::Output::NORMALS].buffer = normals;
+            }
+            for (auto& output : multi->m_outputs) {
+                if (output.buffer) {
+                    output.buffer->Width = w;
+                    output.buffer->Height = h;
+                }
+            }
+        }
+
     } else if (auto segmenter = std::dynamic_pointer_cast<ChSegmentationCamera>(pSensor)) {
         auto bufferOut = chrono_types::make_shared<SensorDeviceSemanticBuffer>();
         DeviceSemanticBufferPtr b(cudaMallocHelper<PixelSemantic>(pOptixSensor->GetWidth() * pOptixSensor->GetHeight()),
@@ -173,9 +219,13 @@ CH_SENSOR_API void ChFilterOptixRender::Initialize(std::shared_ptr<ChSensor> pSe
     
     } else if (auto lidar = std::dynamic_pointer_cast<ChLidarSensor>(pSensor)) {
         auto bufferOut = chrono_types::make_shared<SensorDeviceDIBuffer>();
-        DeviceDIBufferPtr b(cudaMallocHelper<PixelDI>(pOptixSensor->GetWidth() * pOptixSensor->GetHeight()),
-                            cudaFreeHelper<PixelDI>);
+        // with adaptive sampling, the beams are reduced in the launch and dual returns are stored next to each other
+        unsigned int returns_per_beam = lidar->GetAdaptiveSampling() && lidar->DualReturnFlag() ? 2 : 1;
+        DeviceDIBufferPtr b(
+            cudaMallocHelper<PixelDI>(pOptixSensor->GetWidth() * pOptixSensor->GetHeight() * returns_per_beam),
+            cudaFreeHelper<PixelDI>);
         bufferOut->Buffer = std::move(b);
+        bufferOut->Dual_return = returns_per_beam == 2;
         m_raygen_record->data.specific.lidar.max_vert_angle = lidar->GetMaxVertAngle();
         m_raygen_record->data.specific.lidar.min_vert_angle = lidar->GetMinVertAngle();
         m_raygen_record->data.specific.lidar.hFOV = lidar->GetHFOV();
@@ -186,6 +236,23 @@ CH_SENSOR_API void ChFilterOptixRender::Initialize(std::shared_ptr<ChSensor> pSe
         m_raygen_record->data.specific.lidar.sample_radius = lidar->GetSampleRadius();
         m_raygen_record->data.specific.lidar.horiz_div_angle = lidar->GetHorizDivAngle();
         m_raygen_record->data.specific.lidar.vert_div_angle = lidar->GetVertDivAngle();
+        m_raygen_record->data.specific.lidar.return_mode = lidar->GetReturnMode();
+        m_raygen_record->data.specific.lidar.discontinuity_threshold = lidar->GetDiscontinuityThreshold();
+        m_raygen_record->data.specific.lidar.clip_intensity = lidar->GetClipIntensity();
+        m_raygen_record->data.specific.lidar.clip_default_dist = lidar->GetClipDefaultDist();
+        m_raygen_record->data.specific.lidar.stdev_range = lidar->GetStdevRange();
+        m_raygen_record->data.specific.lidar.stdev_intensity = lidar->GetStdevIntensity();
+
+        if (lidar->GetAdaptiveSampling() && (lidar->GetStdevRange() > 0.f || lidar->GetStdevIntensity() > 0.f)) {
+            // initialize rng buffer for the noise added to each beam
+            m_rng = std::shared_ptr<curandState_t>(
+                cudaMallocHelper<curandState_t>(pOptixSensor->GetWidth() * pOptixSensor->GetHeight()),
+                cudaFreeHelper<curandState_t>);
+
+            init_cuda_rng((unsigned int)std::chrono::high_resolution_clock::now().time_since_epoch().count(),
+                          m_rng.get(), pOptixSensor->GetWidth() * pOptixSensor->GetHeight());
+            m_raygen_record->data.specific.lidar.rng_buffer = m_rng.get();
+        }
         m_bufferOut = bufferOut;
     } else if (auto radar = std::dynamic_pointer_cast<ChRadarSensor>(pSensor)) {
         auto bufferOut = chrono_types::make_shared<SensorDeviceRadarBuffer>();
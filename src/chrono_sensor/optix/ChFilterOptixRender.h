@@ -93,6 +93,8 @@ class CH_SENSOR_API ChFilterOptixRender : public ChFilter {
     std::shared_ptr<OptixShaderBindingTable> m_optix_sbt;
     std::shared_ptr<Record<RaygenParameters>> m_raygen_record;  ///< ray generation record
     float m_time_stamp;                                         ///< time stamp for when the data (render) was launched
+    bool m_batched = false;                                     ///< the data was rendered by a batched engine launch
+    cudaEvent_t m_batch_event{};                                ///< event recorded after that batched launch
 
     friend class ChOptixEngine;  ///< ChOptixEngine is allowed to set and use the private members
 };
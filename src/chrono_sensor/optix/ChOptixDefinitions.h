@@ -49,6 +49,12 @@ enum RayType {
     DEPTH_RAY_TYPE = 5,        /// depth camera rays
 };
 
+/// visibility masks of the scene instances, rays only intersect the instances that share a bit with the ray mask
+enum VisibilityMask {
+    CAMERA_VISIBILITY_MASK = 1,  /// instances seen by camera rays (and their secondary rays)
+    RANGE_VISIBILITY_MASK = 2,   /// instances seen by lidar and radar rays
+};
+
 /// The type of lens model that camera can use for rendering
 enum CameraLensModelType {
     PINHOLE,   ///< traditional computer graphics ideal camera model.
@@ -139,6 +145,15 @@ struct DepthCameraParameters {
     float max_depth;                 ///< maximum depth value for the depth camera
 };
 
+/// Parameters for specifying a camera that writes several outputs from the same primary rays
+struct MultiCameraParameters {
+    CameraParameters camera;       ///< parameters of the color output (aliases the camera parameters)
+    float max_depth;               ///< maximum value for the depth output
+    float* depth_buffer;           ///< buffer of primary hit distances (null if the output is disabled)
+    ushort2* semantic_buffer;      ///< buffer of class and instance ids (null if the output is disabled)
+    float4* normal_buffer;         ///< buffer of screen-space normals, w=1 on hit (null if the output is disabled)
+};
+
 /// Parameters need to define a camera that generates semantic segmentation data
 struct SemanticCameraParameters {
     float hFOV;                      ///< horizontal field of view
@@ -154,6 +169,18 @@ enum class LidarBeamShape {
     ELLIPTICAL    ///< elliptical beam (inclusive of circular beam)
 };
 
+/// Lidar return mode when multiple objects are seen
+enum class LidarReturnMode {
+    STRONGEST_RETURN,  ///< range at peak intensity
+    MEAN_RETURN,       ///< average beam range
+    FIRST_RETURN,      ///< shortest beam range
+    LAST_RETURN,       ///< longest beam range
+    DUAL_RETURN        ///< first and strongest returns
+};
+
+/// largest sample radius supported by the adaptive lidar sampling (samples of a beam are kept in registers)
+#define LIDAR_MAX_ADAPTIVE_SAMPLE_RADIUS 8
+
 /// Parameters used to define a lidar
 struct LidarParameters {
     float max_vert_angle;          ///< angle of the top-most lidar channel
@@ -166,6 +193,14 @@ struct LidarParameters {
     float horiz_div_angle;         ///< divergence angle of the beam horizontally (in radians)
     float vert_div_angle;          ///< divergence angle of the beam vertically (in radians)
     float2* frame_buffer;          ///< buffer where the lidar data will be placed when generated
+    // parameters of the adaptive sampling, where each beam is reduced in the ray generation program
+    LidarReturnMode return_mode;    ///< return mode used to reduce the samples of a beam
+    float discontinuity_threshold;  ///< range difference between the probe samples above which all samples are traced
+    float clip_intensity;           ///< returns weaker than this intensity are cleared
+    float clip_default_dist;        ///< range given to the cleared returns
+    float stdev_range;              ///< standard deviation of the noise added to the range
+    float stdev_intensity;          ///< standard deviation of the noise added to the intensity
+    curandState_t* rng_buffer;      ///< random states of each beam, only initialized if noise is added
 };
 
 /// The mode used when determining what data the radar should return
@@ -200,6 +235,7 @@ struct RaygenParameters {
         LidarParameters lidar;                  ///< the specific data when modeling a lidar
         RadarParameters radar;                  ///< the specific data when modeling a radar
         DepthCameraParameters depthCamera;      /// < the specific data when modeling a depth camera
+        MultiCameraParameters multiCamera;      ///< the specific data when modeling a multi-output camera
     } specific;                                 ///< the data for the specific sensor
 };
 
@@ -303,6 +339,10 @@ struct PerRayData_camera {
     float3 albedo;            ///< the albed of the first hit
     float3 normal;            ///< the global normal of the first hit
     bool use_fog;             ///< whether to use fog on this prd
+    float hit_dist;           ///< the distance to the first hit
+    float3 hit_normal;        ///< the global normal at the first hit (without global illumination)
+    unsigned short int class_id;     ///< the class id of the material at the first hit
+    unsigned short int instance_id;  ///< the instance id of the material at the first hit
 };
 
 struct PerRayData_depthCamera {
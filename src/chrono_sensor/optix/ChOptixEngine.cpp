@@ -30,6 +30,7 @@
 #include "chrono_sensor/sensors/ChLidarSensor.h"
 #include "chrono_sensor/sensors/ChRadarSensor.h"
 #include "chrono_sensor/optix/ChOptixUtils.h"
+#include "chrono/utils/ChMeshSimplification.h"
 
 #include "chrono/assets/ChVisualShapeBox.h"
 #include "chrono/assets/ChVisualShapeCapsule.h"
@@ -44,6 +45,7 @@
 #include "chrono/assets/ChTexture.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono_sensor/optix/ChNVDBVolume.h"
+#include <algorithm>
 #include <random>
 
 #include "chrono_sensor/cuda/cuda_utils.cuh"
@@ -67,6 +69,10 @@ ChOptixEngine::~ChOptixEngine() {
     cudaDeviceSynchronize();
     m_geometry->Cleanup();
     m_pipeline->Cleanup();
+    // cleanup batched launch data
+    cudaFree(reinterpret_cast<void*>(md_batch_records));
+    for (auto event : m_batch_events)
+        cudaEventDestroy(event);
     // cleanup lights
     cudaFree(reinterpret_cast<void*>(md_params));
     // cleanup device context parameters
@@ -136,12 +142,14 @@ void ChOptixEngine::AssignSensor(std::shared_ptr<ChOptixSensor> sensor) {
         }
 
         m_assignedSensor.push_back(sensor);
+        m_parent_history.Clear();  // the recorded frames are aligned with the sensor list
         m_cameraStartFrames.push_back(sensor->GetParent()->GetVisualModelFrame());
         m_cameraStartFrames_set.push_back(false);
         m_pipeline->SpawnPipeline(sensor->GetPipelineType());
         // create a ChFilterOptixRender and push to front of filter list
         auto opx_filter = chrono_types::make_shared<ChFilterOptixRender>();
-        unsigned int id = static_cast<unsigned int>(m_assignedSensor.size() - 1);
+        // pipelines of removed sensors are kept, so the new pipeline is the last one spawned
+        unsigned int id = m_pipeline->GetNumPipelines() - 1;
         opx_filter->m_optix_pipeline = m_pipeline->GetPipeline(id);
         opx_filter->m_optix_params = md_params;
         opx_filter->m_optix_sbt = m_pipeline->GetSBT(id);
@@ -157,7 +165,13 @@ void ChOptixEngine::AssignSensor(std::shared_ptr<ChOptixSensor> sensor) {
         }
 
         m_assignedRenderers.push_back(opx_filter);
-        sensor->PushFilterFront(opx_filter);
+        // a sensor moved from another engine already has the render filter of that engine
+        if (!sensor->GetFilterList().empty() &&
+            std::dynamic_pointer_cast<ChFilterOptixRender>(sensor->GetFilterList().front())) {
+            sensor->ReplaceFrontFilter(opx_filter);
+        } else {
+            sensor->PushFilterFront(opx_filter);
+        }
         sensor->LockFilterList();
 
         std::shared_ptr<SensorBuffer> buffer;
@@ -165,19 +179,78 @@ void ChOptixEngine::AssignSensor(std::shared_ptr<ChOptixSensor> sensor) {
             f->Initialize(sensor, buffer);  // master thread should always be the one to initialize
         }
         // create the thread that will be in charge of this sensor (must be consistent thread for visualization reasons)
-        m_renderThreads.emplace_back();
+        m_renderThreads.emplace_back(new RenderThread());
         id = static_cast<unsigned int>(m_renderThreads.size() - 1);
-        m_renderThreads[id].done = true;
-        m_renderThreads[id].start = false;
-        m_renderThreads[id].terminate = false;
-        m_renderThreads[id].thread =
-            std::move(std::thread(&ChOptixEngine::RenderProcess, this, std::ref(m_renderThreads[id]), sensor));
+        m_renderThreads[id]->done = true;
+        m_renderThreads[id]->start = false;
+        m_renderThreads[id]->terminate = false;
+        m_renderThreads[id]->thread =
+            std::move(std::thread(&ChOptixEngine::RenderProcess, this, std::ref(*m_renderThreads[id]), sensor));
     }
     if (!m_started) {
         Start();
     }
 }
 
+void ChOptixEngine::RemoveSensor(std::shared_ptr<ChOptixSensor> sensor) {
+    // wait for the scene thread so that the render queue is empty
+    std::unique_lock<std::mutex> scene_lck(m_sceneThread.mutex);
+    while (!m_sceneThread.done) {
+        m_sceneThread.cv.wait(scene_lck);
+    }
+
+    auto it = std::find(m_assignedSensor.begin(), m_assignedSensor.end(), sensor);
+    if (it == m_assignedSensor.end()) {
+        std::cerr << "WARNING: This sensor is not managed by this engine. Ignoring this removal\n";
+        return;
+    }
+    size_t id = it - m_assignedSensor.begin();
+
+    // stop the render thread of the sensor
+    auto& rt = m_renderThreads[id];
+    {
+        std::unique_lock<std::mutex> lck(rt->mutex);
+        while (!rt->done) {
+            rt->cv.wait(lck);
+        }
+        rt->terminate = true;
+        rt->start = true;
+        rt->done = false;
+    }
+    rt->cv.notify_all();
+    {
+        std::unique_lock<std::mutex> lck(rt->mutex);
+        while (!rt->done) {
+            rt->cv.wait(lck);
+        }
+    }
+    if (rt->thread.joinable()) {
+        rt->thread.join();
+    }
+
+    // the pipeline of the sensor stays allocated until the engine is cleaned up
+    m_renderThreads.erase(m_renderThreads.begin() + id);
+    m_assignedSensor.erase(m_assignedSensor.begin() + id);
+    m_assignedRenderers.erase(m_assignedRenderers.begin() + id);
+    m_cameraStartFrames.erase(m_cameraStartFrames.begin() + id);
+    m_cameraStartFrames_set.erase(m_cameraStartFrames_set.begin() + id);
+    m_parent_history.Clear();
+}
+
+double ChOptixEngine::GetRenderTime(std::shared_ptr<ChOptixSensor> sensor) {
+    auto it = std::find(m_assignedSensor.begin(), m_assignedSensor.end(), sensor);
+    if (it == m_assignedSensor.end())
+        return 0;
+    return m_renderThreads[it - m_assignedSensor.begin()]->render_time;
+}
+
+double ChOptixEngine::GetLoad() {
+    double load = 0;
+    for (int i = 0; i < m_assignedSensor.size(); i++)
+        load += m_renderThreads[i]->render_time * m_assignedSensor[i]->GetUpdateRate();
+    return load;
+}
+
 void ChOptixEngine::UpdateSensors(std::shared_ptr<ChScene> scene) {
     if (!m_params.root) {
         ConstructScene();
@@ -185,15 +258,28 @@ void ChOptixEngine::UpdateSensors(std::shared_ptr<ChScene> scene) {
     std::vector<int> to_be_updated;
     std::vector<int> to_be_waited_on;
 
+    // record the state of this step for interpolating the state at the update times that precede it
+    if (m_state_interpolation) {
+        m_geometry->RecordBodyFrames(m_system->GetChTime());
+        std::vector<ChFrame<double>> parent_frames(m_assignedSensor.size());
+        for (int i = 0; i < m_assignedSensor.size(); i++)
+            parent_frames[i] = m_assignedSensor[i]->GetParent()->GetVisualModelFrame();
+        m_parent_history.Record(m_system->GetChTime(), std::move(parent_frames));
+    }
+
     // check if any of the sensors would be collecting data right now, if so, pack a tmp start keyframe
     for (int i = 0; i < m_assignedSensor.size(); i++) {
         auto sensor = m_assignedSensor[i];
-        if (m_system->GetChTime() > sensor->GetNumLaunches() / sensor->GetUpdateRate() - 1e-7 &&
+        if (m_system->GetChTime() >
+                sensor->GetUpdatePhase() + sensor->GetNumLaunches() / sensor->GetUpdateRate() - 1e-7 &&
             !m_cameraStartFrames_set[i]) {
             // do this once per sensor because we don't know if they will be updated at the same time
-            m_geometry->UpdateBodyTransformsStart((float)m_system->GetChTime(),
-                                                  (float)m_system->GetChTime() + sensor->GetCollectionWindow());
-            m_cameraStartFrames[i] = sensor->GetParent()->GetVisualModelFrame();
+            double t_start = m_system->GetChTime();
+            if (m_state_interpolation)
+                t_start = sensor->GetUpdatePhase() + sensor->GetNumLaunches() / sensor->GetUpdateRate();
+            m_geometry->UpdateBodyTransformsStart((float)t_start, (float)t_start + sensor->GetCollectionWindow(),
+                                                  m_state_interpolation);
+            m_cameraStartFrames[i] = GetParentFrame(i, t_start);
             m_cameraStartFrames_set[i] = true;
         }
     }
@@ -201,8 +287,8 @@ void ChOptixEngine::UpdateSensors(std::shared_ptr<ChScene> scene) {
     // check which sensors need to be updated this step
     for (int i = 0; i < m_assignedSensor.size(); i++) {
         auto sensor = m_assignedSensor[i];
-        if (m_system->GetChTime() >
-            sensor->GetNumLaunches() / sensor->GetUpdateRate() + sensor->GetCollectionWindow() - 1e-7) {
+        if (m_system->GetChTime() > sensor->GetUpdatePhase() + sensor->GetNumLaunches() / sensor->GetUpdateRate() +
+                                        sensor->GetCollectionWindow() - 1e-7) {
             to_be_updated.push_back(i);
         }
     }
@@ -220,19 +306,23 @@ void ChOptixEngine::UpdateSensors(std::shared_ptr<ChScene> scene) {
             // update the scene for the optix context
             UpdateCameraTransforms(to_be_updated, scene);
 
-            m_geometry->UpdateBodyTransformsEnd((float)m_system->GetChTime());
+            // the scene state is shared by the sensors launched at this step, use the latest of their update times
+            double t_end = 0;
+            for (auto i : to_be_updated)
+                t_end = std::max(t_end, GetUpdateTime(i));
+            m_geometry->UpdateBodyTransformsEnd((float)t_end, m_state_interpolation);
 
             // m_renderThreads
             UpdateSceneDescription(scene);
             UpdateDeformableMeshes();
+            UpdateMeshLOD();
 
-            float t = (float)m_system->GetChTime();
             // push the sensors that need updating to the render queue
             for (auto i : to_be_updated) {
                 m_renderQueue.push_back(i);
+                m_assignedRenderers[i]->m_time_stamp = (float)GetUpdateTime(i);
                 m_assignedSensor[i]->IncrementNumLaunches();
-                m_assignedRenderers[i]->m_time_stamp = t;
-                m_renderThreads[i].done =
+                m_renderThreads[i]->done =
                     false;  // this render thread must not be done now given we have prepped some data for it
             }
         }
@@ -247,7 +337,8 @@ void ChOptixEngine::UpdateSensors(std::shared_ptr<ChScene> scene) {
 
     for (int i = 0; i < m_assignedSensor.size(); i++) {
         auto sensor = m_assignedSensor[i];
-        if (m_system->GetChTime() > (sensor->GetNumLaunches() - 1) / sensor->GetUpdateRate() +
+        if (m_system->GetChTime() > sensor->GetUpdatePhase() +
+                                        (sensor->GetNumLaunches() - 1) / sensor->GetUpdateRate() +
                                         sensor->GetCollectionWindow() + sensor->GetLag() - 1e-7) {
             // wait for the sensor thread i which will notify everyone when done
 
@@ -265,9 +356,9 @@ void ChOptixEngine::UpdateSensors(std::shared_ptr<ChScene> scene) {
             // }
 
             // see if this specific thread is done
-            std::unique_lock<std::mutex> lck(m_renderThreads[i].mutex);
-            while (!m_renderThreads[i].done) {
-                m_renderThreads[i].cv.wait(lck);
+            std::unique_lock<std::mutex> lck(m_renderThreads[i]->mutex);
+            while (!m_renderThreads[i]->done) {
+                m_renderThreads[i]->cv.wait(lck);
             }
         }
     }
@@ -305,23 +396,23 @@ void ChOptixEngine::StopAllThreads() {
     for (int i = 0; i < m_renderThreads.size(); i++) {
         {
             // wait for previous processing to be done
-            std::unique_lock<std::mutex> lck(m_renderThreads[i].mutex);
-            while (!m_renderThreads[i].done) {
-                m_renderThreads[i].cv.wait(lck);
+            std::unique_lock<std::mutex> lck(m_renderThreads[i]->mutex);
+            while (!m_renderThreads[i]->done) {
+                m_renderThreads[i]->cv.wait(lck);
             }
-            m_renderThreads[i].terminate = true;
-            m_renderThreads[i].start = true;
-            m_renderThreads[i].done = false;
+            m_renderThreads[i]->terminate = true;
+            m_renderThreads[i]->start = true;
+            m_renderThreads[i]->done = false;
         }
-        m_renderThreads[i].cv.notify_all();
+        m_renderThreads[i]->cv.notify_all();
 
         // wait for it to finish the terminate proces
-        std::unique_lock<std::mutex> lck(m_renderThreads[i].mutex);
-        while (!m_renderThreads[i].done) {
-            m_renderThreads[i].cv.wait(lck);
+        std::unique_lock<std::mutex> lck(m_renderThreads[i]->mutex);
+        while (!m_renderThreads[i]->done) {
+            m_renderThreads[i]->cv.wait(lck);
         }
-        if (m_renderThreads[i].thread.joinable()) {
-            m_renderThreads[i].thread.join();
+        if (m_renderThreads[i]->thread.joinable()) {
+            m_renderThreads[i]->thread.join();
         }
     }
 
@@ -353,9 +444,7 @@ void ChOptixEngine::RenderProcess(RenderThread& tself, std::shared_ptr<ChOptixSe
         tself.start = false;
         terminate = tself.terminate;
 
-#if PROFILE
         auto start = std::chrono::high_resolution_clock::now();
-#endif
         if (!terminate) {
             // run through the filter graph of our sensor
             for (auto f : sensor->GetFilterList()) {
@@ -365,8 +454,13 @@ void ChOptixEngine::RenderProcess(RenderThread& tself, std::shared_ptr<ChOptixSe
 
         // wait for stream to synchronize
         cudaStreamSynchronize(sensor->GetCudaStream());
-#if PROFILE
         auto elapsed = std::chrono::high_resolution_clock::now() - start;
+        if (!terminate) {
+            // smoothed render cost, used by the sensor manager for balancing the engines
+            double t = std::chrono::duration_cast<std::chrono::duration<double>>(elapsed).count();
+            tself.render_time = tself.render_time > 0 ? 0.9 * tself.render_time + 0.1 * t : t;
+        }
+#if PROFILE
         auto milli = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
         std::cout << "Sensor = " << sensor->GetName() << ", Process time = " << milli << "ms" << std::endl;
 #endif
@@ -399,11 +493,18 @@ void ChOptixEngine::SceneProcess(RenderThread& tself) {
             std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
             std::chrono::duration<double> wall_time =
                 std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+
+            // render sensors in batches if requested; the render threads then only process the remaining filters
+            for (auto i : m_renderQueue)
+                m_assignedRenderers[i]->m_batched = false;
+            if (m_batched_launches)
+                LaunchBatches();
+
             // launch the render threads
             for (auto i : m_renderQueue) {
-                m_renderThreads[i].done = false;
-                m_renderThreads[i].start = true;
-                m_renderThreads[i].cv.notify_all();  // notify render thread it should proceed
+                m_renderThreads[i]->done = false;
+                m_renderThreads[i]->start = true;
+                m_renderThreads[i]->cv.notify_all();  // notify render thread it should proceed
 
                 // for (auto f : m_assignedSensor[i]->GetFilterList()) {
                 //     f->Apply();
@@ -413,9 +514,9 @@ void ChOptixEngine::SceneProcess(RenderThread& tself) {
 
             // wait for each of the thread to be done before we say we are done
             for (auto i : m_renderQueue) {
-                std::unique_lock<std::mutex> lck(m_renderThreads[i].mutex);
-                while (!m_renderThreads[i].done) {
-                    m_renderThreads[i].cv.wait(lck);
+                std::unique_lock<std::mutex> lck(m_renderThreads[i]->mutex);
+                while (!m_renderThreads[i]->done) {
+                    m_renderThreads[i]->cv.wait(lck);
                 }
             }
         }
@@ -426,6 +527,78 @@ void ChOptixEngine::SceneProcess(RenderThread& tself) {
     }
 }
 
+void ChOptixEngine::LaunchBatches() {
+    // group the sensors to render by pipeline type and launch dimensions
+    std::vector<std::vector<unsigned int>> batches;
+    for (auto i : m_renderQueue) {
+        auto buffer = m_assignedRenderers[i]->m_bufferOut;
+        bool found = false;
+        for (auto& batch : batches) {
+            auto first_buffer = m_assignedRenderers[batch[0]]->m_bufferOut;
+            if (m_assignedSensor[batch[0]]->GetPipelineType() == m_assignedSensor[i]->GetPipelineType() &&
+                first_buffer->Width == buffer->Width && first_buffer->Height == buffer->Height) {
+                batch.push_back(i);
+                found = true;
+                break;
+            }
+        }
+        if (!found)
+            batches.push_back({i});
+    }
+
+    // pack the raygen records of each batch contiguously (single sensors are rendered by their own render thread)
+    m_batch_records.clear();
+    for (auto& batch : batches) {
+        if (batch.size() < 2)
+            continue;
+        for (auto i : batch)
+            m_batch_records.push_back(*m_assignedRenderers[i]->m_raygen_record);
+    }
+    if (m_batch_records.empty())
+        return;
+
+    if (m_batch_records.size() > m_batch_records_capacity) {
+        CUDA_ERROR_CHECK(cudaFree(reinterpret_cast<void*>(md_batch_records)));
+        CUDA_ERROR_CHECK(cudaMalloc(reinterpret_cast<void**>(&md_batch_records),
+                                    sizeof(Record<RaygenParameters>) * m_batch_records.size()));
+        m_batch_records_capacity = m_batch_records.size();
+    }
+    CUDA_ERROR_CHECK(cudaMemcpy(reinterpret_cast<void*>(md_batch_records), m_batch_records.data(),
+                                sizeof(Record<RaygenParameters>) * m_batch_records.size(), cudaMemcpyHostToDevice));
+
+    // one launch per batch, on the stream of the first sensor of the batch; the launch index z selects the sensor
+    size_t offset = 0;
+    size_t num_launches = 0;
+    for (auto& batch : batches) {
+        if (batch.size() < 2)
+            continue;
+
+        if (num_launches == m_batch_events.size()) {
+            m_batch_events.emplace_back();
+            CUDA_ERROR_CHECK(cudaEventCreateWithFlags(&m_batch_events.back(), cudaEventDisableTiming));
+        }
+        cudaEvent_t event = m_batch_events[num_launches++];
+
+        auto first = m_assignedRenderers[batch[0]];
+        OptixShaderBindingTable sbt = *first->m_optix_sbt;
+        sbt.raygenRecord = md_batch_records + offset * sizeof(Record<RaygenParameters>);
+
+        OPTIX_ERROR_CHECK(optixLaunch(first->m_optix_pipeline, first->m_cuda_stream,
+                                      reinterpret_cast<CUdeviceptr>(md_params), sizeof(ContextParameters), &sbt,
+                                      first->m_bufferOut->Width,                // launch width
+                                      first->m_bufferOut->Height,               // launch height
+                                      static_cast<unsigned int>(batch.size())  // launch depth
+                                      ));
+        CUDA_ERROR_CHECK(cudaEventRecord(event, first->m_cuda_stream));
+
+        for (auto i : batch) {
+            m_assignedRenderers[i]->m_batched = true;
+            m_assignedRenderers[i]->m_batch_event = event;
+        }
+        offset += batch.size();
+    }
+}
+
 void ChOptixEngine::boxVisualization(std::shared_ptr<ChBody> body,
                                      std::shared_ptr<ChVisualShapeBox> box_shape,
                                      ChFrame<> asset_frame) {
@@ -490,6 +663,36 @@ void ChOptixEngine::rigidMeshVisualization(std::shared_ptr<ChBody> body,
     mat_id = m_pipeline->GetRigidMeshMaterial(d_vertex_buffer, d_index_buffer, mesh_shape, mesh_shape->GetMaterials());
     m_geometry->AddRigidMesh(d_vertex_buffer, d_index_buffer, mesh_shape, body, asset_frame, size, mat_id);
     m_pipeline->AddBody(body);
+
+    auto mesh = mesh_shape->GetMesh();
+    if (m_lod_num_levels == 0 || mesh->GetNumTriangles() < min_lod_triangles)
+        return;
+
+    // generate the simplified levels once per mesh, with cells of 1/64, 1/32, ... of the mesh diagonal
+    auto& levels = m_lod_meshes[mesh.get()];
+    if (levels.empty()) {
+        ChAABB bbox = mesh->GetBoundingBox();
+        double cell_size = (bbox.max - bbox.min).Length() / 64;
+        for (unsigned int l = 0; l < m_lod_num_levels; l++, cell_size *= 2) {
+            auto level = utils::SimplifyMesh(*mesh, cell_size);
+            if (level->GetNumTriangles() == 0)
+                break;
+            levels.push_back(level);
+        }
+    }
+
+    std::vector<unsigned int> chain = {m_geometry->GetNumObjects() - 1};
+    for (auto& level : levels) {
+        auto level_shape = chrono_types::make_shared<ChVisualShapeTriangleMesh>();
+        level_shape->SetMesh(level, false);
+        level_shape->SetScale(size);
+        mat_id = m_pipeline->GetRigidMeshMaterial(d_vertex_buffer, d_index_buffer, level_shape,
+                                                  mesh_shape->GetMaterials());
+        m_geometry->AddRigidMesh(d_vertex_buffer, d_index_buffer, level_shape, body, asset_frame, size, mat_id);
+        chain.push_back(m_geometry->GetNumObjects() - 1);
+    }
+    if (chain.size() > 1)
+        m_geometry->AddLODChain(chain);
 }
 
 void ChOptixEngine::deformableMeshVisualization(std::shared_ptr<ChBody> body,
@@ -671,19 +874,19 @@ void ChOptixEngine::UpdateCameraTransforms(std::vector<int>& to_be_updated, std:
             m_pipeline->UpdateObjectVelocity();
         }
 
+        double t1 = GetUpdateTime(id);
         ChFrame<double> f_offset = sensor->GetOffsetPose();
-        ChFrame<double> f_body_0 = m_cameraStartFrames[i];
-        m_cameraStartFrames_set[i] = false;  // reset this camera frame so that we know it should be packed again
-        ChFrame<double> f_body_1 = sensor->GetParent()->GetVisualModelFrame();
+        ChFrame<double> f_body_0 = m_cameraStartFrames[id];
+        m_cameraStartFrames_set[id] = false;  // reset this camera frame so that we know it should be packed again
+        ChFrame<double> f_body_1 = GetParentFrame(id, t1);
         ChFrame<double> global_loc_0 = f_body_0 * f_offset;
         ChFrame<double> global_loc_1 = f_body_1 * f_offset;
 
         ChVector3f pos_0 = global_loc_0.GetPos() - scene->GetOriginOffset();
         ChVector3f pos_1 = global_loc_1.GetPos() - scene->GetOriginOffset();
 
-        m_assignedRenderers[id]->m_raygen_record->data.t0 =
-            (float)(m_system->GetChTime() - sensor->GetCollectionWindow());
-        m_assignedRenderers[id]->m_raygen_record->data.t1 = (float)(m_system->GetChTime());
+        m_assignedRenderers[id]->m_raygen_record->data.t0 = (float)(t1 - sensor->GetCollectionWindow());
+        m_assignedRenderers[id]->m_raygen_record->data.t1 = (float)t1;
         m_assignedRenderers[id]->m_raygen_record->data.pos0 = make_float3(pos_0.x(), pos_0.y(), pos_0.z());
         m_assignedRenderers[id]->m_raygen_record->data.rot0 =
             make_float4((float)global_loc_0.GetRot().e0(), (float)global_loc_0.GetRot().e1(),
@@ -692,15 +895,44 @@ void ChOptixEngine::UpdateCameraTransforms(std::vector<int>& to_be_updated, std:
         m_assignedRenderers[id]->m_raygen_record->data.rot1 =
             make_float4((float)global_loc_1.GetRot().e0(), (float)global_loc_1.GetRot().e1(),
                         (float)global_loc_1.GetRot().e2(), (float)global_loc_1.GetRot().e3());
-        m_assignedRenderers[id]->m_time_stamp = (float)m_system->GetChTime();
+        m_assignedRenderers[id]->m_time_stamp = (float)t1;
     }
 }
 
+double ChOptixEngine::GetUpdateTime(int id) {
+    auto sensor = m_assignedSensor[id];
+    if (!m_state_interpolation)
+        return m_system->GetChTime();
+    double t = sensor->GetUpdatePhase() + sensor->GetNumLaunches() / sensor->GetUpdateRate() +
+               sensor->GetCollectionWindow();
+    return std::min(t, m_system->GetChTime());
+}
+
+ChFrame<double> ChOptixEngine::GetParentFrame(int id, double t) {
+    ChFrame<double> frame;
+    if (m_state_interpolation && m_parent_history.Interpolate(t, id, frame))
+        return frame;
+    return m_assignedSensor[id]->GetParent()->GetVisualModelFrame();
+}
+
 void ChOptixEngine::UpdateDeformableMeshes() {
     // update the mesh in the pipeline
     m_pipeline->UpdateDeformableMeshes();
     // update the meshes in the geometric scene
-    m_geometry->UpdateDeformableMeshes();
+    m_geometry->UpdateDeformableMeshes(m_pipeline->GetDeformableMeshesModified());
+}
+
+void ChOptixEngine::UpdateMeshLOD() {
+    if (m_lod_num_levels == 0)
+        return;
+
+    // the levels are selected from the closest range sensor of this engine
+    std::vector<ChVector3d> sensor_positions;
+    for (auto& sensor : m_assignedSensor) {
+        if (std::dynamic_pointer_cast<ChLidarSensor>(sensor) || std::dynamic_pointer_cast<ChRadarSensor>(sensor))
+            sensor_positions.push_back((sensor->GetParent()->GetVisualModelFrame() * sensor->GetOffsetPose()).GetPos());
+    }
+    m_geometry->UpdateLOD(sensor_positions, m_lod_distance);
 }
 
 void ChOptixEngine::UpdateSceneDescription(std::shared_ptr<ChScene> scene) {
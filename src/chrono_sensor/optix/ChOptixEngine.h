@@ -24,6 +24,7 @@
 #include "chrono_sensor/ChApiSensor.h"
 
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <thread>
@@ -60,6 +61,8 @@ struct RenderThread {
     bool terminate;
     bool start;  ///< for signalling to the worker to start
     bool done;   ///< for signalling to any parents we are complete
+
+    double render_time = 0;  ///< smoothed wall time of the render operation [s]
 };
 
 /// Optix Engine that is responsible for managing all render-based sensors.
@@ -81,6 +84,11 @@ class CH_SENSOR_API ChOptixEngine {
     /// @param sensor A shared pointer to an Optix-based sensor
     void AssignSensor(std::shared_ptr<ChOptixSensor> sensor);
 
+    /// Remove a sensor from this engine. Waits for the sensor to finish its current render and stops its render
+    /// thread. The sensor keeps its filter graph and can be assigned to another engine.
+    /// @param sensor A shared pointer to a sensor managed by this engine
+    void RemoveSensor(std::shared_ptr<ChOptixSensor> sensor);
+
     /// Updates the sensors if they need to be updated based on simulation time and last update time.
     /// @param scene The scene that should be rendered with.
     void UpdateSensors(std::shared_ptr<ChScene> scene);
@@ -107,6 +115,46 @@ class CH_SENSOR_API ChOptixEngine {
     /// @return the vector of Chrono sensors
     std::vector<std::shared_ptr<ChOptixSensor>> GetSensor() { return m_assignedSensor; }
 
+    /// Query the measured render cost of a sensor, i.e. the smoothed wall time of its filter graph.
+    /// @param sensor A shared pointer to a sensor managed by this engine
+    /// @return The render time of one update of the sensor [s], or 0 if the sensor is not managed by this engine
+    double GetRenderTime(std::shared_ptr<ChOptixSensor> sensor);
+
+    /// Query the measured load of this engine, i.e. the render time of its sensors per second of simulation.
+    /// @return The sum over the sensors of the render time multiplied by the update rate
+    double GetLoad();
+
+    /// Enable or disable batched launches (default: false).
+    /// When enabled, the sensors updated at the same time that use the same type of ray tracing pipeline and have the
+    /// same output dimensions are rendered with a single OptiX launch, with one launch layer per sensor, rather than
+    /// with one launch per sensor. The remaining filters of each sensor are still processed by its own render thread.
+    void SetBatchedLaunches(bool val) { m_batched_launches = val; }
+
+    /// Return true if batched launches are enabled.
+    bool GetBatchedLaunches() const { return m_batched_launches; }
+
+    /// Enable or disable the interpolation of the state at the sensor update times (default: false).
+    /// When enabled, the frames of the bodies and of the sensors are recorded at each step, and each sensor is
+    /// rendered from the state interpolated at its exact update time rather than from the state of the step at which
+    /// the update is detected. This removes the timing jitter of the sensors when the step is not a divisor of their
+    /// update period. Sensors updated at the same step share the scene state at the latest of their update times.
+    void SetStateInterpolation(bool val) { m_state_interpolation = val; }
+
+    /// Return true if the state is interpolated at the sensor update times.
+    bool GetStateInterpolation() const { return m_state_interpolation; }
+
+    /// Enable level-of-detail meshes for lidar and radar sensors (default: 0 levels, disabled). Must be set before the
+    /// scene is constructed. Simplified versions of the rigid visual meshes are generated when the scene is
+    /// constructed, and lidar and radar rays only see, for each mesh, the level selected from the distance between
+    /// the mesh and the closest lidar or radar of this engine. Cameras always see the full resolution meshes.
+    /// @param num_levels number of simplified levels generated for each mesh
+    /// @param lod_distance distance up to which the full resolution mesh is used, each further level is used from
+    /// twice the distance of the previous one
+    void SetMeshLOD(unsigned int num_levels, float lod_distance) {
+        m_lod_num_levels = num_levels;
+        m_lod_distance = lod_distance;
+    }
+
   private:
     void Start();           ///< start the render thread
     void StopAllThreads();  ///< stop the scene and render threads, remove all asigned sensors
@@ -119,14 +167,23 @@ class CH_SENSOR_API ChOptixEngine {
         RenderThread& tself,
         std::shared_ptr<ChOptixSensor> sensor);  ///< render processing function for rendering in separate threads
     void SceneProcess(RenderThread& tself);  ///< scene processing function for building the scene in separate thread
+    void LaunchBatches();                    ///< render the sensors in the render queue with batched launches
 
     void UpdateCameraTransforms(
         std::vector<int>& to_be_updated,
         std::shared_ptr<ChScene> scene);  ///< updates all of the camera position and orientations
     void UpdateDeformableMeshes();        ///< updates the dynamic meshes in the scene
+    void UpdateMeshLOD();                 ///< updates the level of detail seen by lidar and radar
     void UpdateSceneDescription(
         std::shared_ptr<ChScene> scene);  ///< updates the scene characteristics such as lights, background, etc
 
+    /// Time of the update of a sensor that is about to be launched: its exact update time if the state is interpolated,
+    /// the current simulation time otherwise
+    double GetUpdateTime(int id);
+
+    /// Frame of the parent of a sensor at a time, interpolated from the recorded frames if the state is interpolated
+    ChFrame<double> GetParentFrame(int id, double t);
+
     /// Creates an optix box visualization object from a Chrono box shape
     void boxVisualization(std::shared_ptr<ChBody> body,
                           std::shared_ptr<ChVisualShapeBox> box_shape,
@@ -158,12 +215,28 @@ class CH_SENSOR_API ChOptixEngine {
     // mutex and condition variables
     // std::mutex m_sceneBuildMutex;               ///< mutex for protecting the scene building operation
     // std::condition_variable m_sceneBuildCV;     ///< condition variable for notifying the scene building thread
-    std::deque<RenderThread> m_renderThreads;  ///< threads for rendering
-    RenderThread m_sceneThread;                ///< thread for performing scene builds
+    std::vector<std::unique_ptr<RenderThread>> m_renderThreads;  ///< threads for rendering
+    RenderThread m_sceneThread;                                  ///< thread for performing scene builds
 
     bool m_terminate = false;  ///< worker thread stop variable
     bool m_started = false;    ///< worker thread start variable
 
+    bool m_batched_launches = false;                        ///< render sensors with batched launches
+    std::vector<Record<RaygenParameters>> m_batch_records;  ///< raygen records of the batched sensors
+    CUdeviceptr md_batch_records = {};                      ///< raygen records of the batched sensors on the device
+    size_t m_batch_records_capacity = 0;                    ///< number of records allocated on the device
+    std::vector<cudaEvent_t> m_batch_events;                ///< events recorded after each batched launch
+
+    bool m_state_interpolation = false;  ///< render sensors from the state interpolated at their update times
+    ChPoseHistory m_parent_history;      ///< frames of the sensor parents at the last steps
+
+    unsigned int m_lod_num_levels = 0;                   ///< number of simplified levels generated for each rigid mesh
+    float m_lod_distance = 0.f;                          ///< distance up to which the full resolution meshes are used
+    static const unsigned int min_lod_triangles = 1000;  ///< minimum number of triangles of a mesh with levels
+
+    /// simplified levels of the meshes, shared between the bodies that use the same mesh
+    std::unordered_map<ChTriangleMeshConnected*, std::vector<std::shared_ptr<ChTriangleMeshConnected>>> m_lod_meshes;
+
     CUdeviceptr md_lights;  ///< lights on the gpu
 
     // information that belongs to the rendering concept of this engine
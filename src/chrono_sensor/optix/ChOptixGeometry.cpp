@@ -25,7 +25,11 @@
 
 #include "chrono_sensor/optix/ChOptixUtils.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstring>
+#include <limits>
 
 namespace chrono {
 namespace sensor {
@@ -85,6 +89,7 @@ void ChOptixGeometry::Cleanup() {
     m_obj_body_frames_start.clear();
     m_obj_body_frames_end.clear();
     m_bodies.clear();
+    m_body_history.Clear();
 
     // clear out our list of known meshes
     m_known_meshes.clear();
@@ -94,6 +99,9 @@ void ChOptixGeometry::Cleanup() {
 
     // clear out index buffers
     m_obj_mat_ids.clear();
+    m_obj_masks.clear();
+    m_lod_chains.clear();
+    m_lod_levels.clear();
 }
 
 void ChOptixGeometry::AddGenericObject(unsigned int mat_id,
@@ -103,6 +111,7 @@ void ChOptixGeometry::AddGenericObject(unsigned int mat_id,
                                        OptixTraversableHandle gas_handle) {
     // add to list of box instances
     m_obj_mat_ids.push_back(mat_id);
+    m_obj_masks.push_back(CAMERA_VISIBILITY_MASK | RANGE_VISIBILITY_MASK);
     m_bodies.push_back(body);
     m_obj_body_frames_start.push_back(body->GetFrameRefToAbs());
     m_obj_body_frames_end.push_back(body->GetFrameRefToAbs());
@@ -500,18 +509,101 @@ void ChOptixGeometry::AddDeformableMesh(CUdeviceptr d_vertices,
     m_deformable_meshes.push_back(std::make_tuple(mesh_shape, d_vertices, d_indices, mesh_gas_id));
 }
 
-void ChOptixGeometry::UpdateDeformableMeshes() {
+void ChOptixGeometry::UpdateDeformableMeshes(const std::vector<bool>& modified) {
     for (int i = 0; i < m_deformable_meshes.size(); i++) {
+        if (i < modified.size() && !modified[i])
+            continue;
+
         std::shared_ptr<ChVisualShapeTriangleMesh> mesh_shape = std::get<0>(m_deformable_meshes[i]);
         CUdeviceptr d_vertices = std::get<1>(m_deformable_meshes[i]);
         CUdeviceptr d_indices = std::get<2>(m_deformable_meshes[i]);
         unsigned int gas_id = std::get<3>(m_deformable_meshes[i]);
 
-        // perform a rebuild of the triange acceleration structure
-        BuildTrianglesGAS(mesh_shape, d_vertices, d_indices, false, true, gas_id);
+        // refit the triangle acceleration structure to the new vertex locations
+        RefitTrianglesGAS(mesh_shape, d_vertices, d_indices, gas_id);
+        m_gas_refit = true;
+    }
+}
+
+void ChOptixGeometry::AddLODChain(const std::vector<unsigned int>& object_ids) {
+    // the full resolution mesh is seen by all sensors until the first level selection
+    for (int k = 0; k < object_ids.size(); k++)
+        m_obj_masks[object_ids[k]] = k == 0 ? CAMERA_VISIBILITY_MASK | RANGE_VISIBILITY_MASK : 0;
+    m_lod_chains.push_back(object_ids);
+    m_lod_levels.push_back(0);
+}
+
+void ChOptixGeometry::UpdateLOD(const std::vector<ChVector3d>& sensor_positions, float lod_distance) {
+    if (sensor_positions.empty() || lod_distance <= 0)
+        return;
+
+    for (int c = 0; c < m_lod_chains.size(); c++) {
+        const std::vector<unsigned int>& chain = m_lod_chains[c];
+        const ChVector3d pos = (m_obj_body_frames_end[chain[0]] * m_obj_asset_frames[chain[0]]).GetPos();
+        double dist = std::numeric_limits<double>::max();
+        for (const auto& sensor_pos : sensor_positions)
+            dist = std::min(dist, (pos - sensor_pos).Length());
+
+        unsigned int level = 0;
+        if (dist >= lod_distance)
+            level = std::min(static_cast<unsigned int>(chain.size() - 1),
+                             1 + static_cast<unsigned int>(std::log2(dist / lod_distance)));
+        if (level == m_lod_levels[c])
+            continue;
+        m_lod_levels[c] = level;
+
+        for (unsigned int k = 0; k < chain.size(); k++) {
+            unsigned int obj = chain[k];
+            m_obj_masks[obj] = (k == 0 ? CAMERA_VISIBILITY_MASK : 0) | (k == level ? RANGE_VISIBILITY_MASK : 0);
+            if (obj < m_instances.size() && m_instances[obj].visibilityMask != m_obj_masks[obj]) {
+                m_instances[obj].visibilityMask = m_obj_masks[obj];
+                CUDA_ERROR_CHECK(cudaMemcpy(reinterpret_cast<void*>(md_instances + obj * sizeof(OptixInstance)),
+                                            &m_instances[obj], sizeof(OptixInstance), cudaMemcpyHostToDevice));
+                m_instances_modified = true;
+            }
+        }
     }
 }
 
+void ChOptixGeometry::RefitTrianglesGAS(std::shared_ptr<ChVisualShapeTriangleMesh> mesh_shape,
+                                        CUdeviceptr d_vertices,
+                                        CUdeviceptr d_indices,
+                                        unsigned int gas_id) {
+    auto mesh = mesh_shape->GetMesh();
+
+    // same build flags as the original build (see BuildTrianglesGAS)
+    OptixAccelBuildOptions accel_options = {OPTIX_BUILD_FLAG_ALLOW_UPDATE, OPTIX_BUILD_OPERATION_UPDATE};
+
+    uint32_t triangle_flags[] = {OPTIX_GEOMETRY_FLAG_DISABLE_ANYHIT};
+    OptixBuildInput mesh_input = {};
+    mesh_input.type = OPTIX_BUILD_INPUT_TYPE_TRIANGLES;
+    mesh_input.triangleArray.vertexBuffers = &d_vertices;
+    mesh_input.triangleArray.numVertices = static_cast<unsigned int>(mesh->GetCoordsVertices().size());
+    mesh_input.triangleArray.vertexFormat = OPTIX_VERTEX_FORMAT_FLOAT3;
+    mesh_input.triangleArray.vertexStrideInBytes = sizeof(float4);
+    mesh_input.triangleArray.indexBuffer = d_indices;
+    mesh_input.triangleArray.numIndexTriplets = static_cast<unsigned int>(mesh->GetIndicesVertexes().size());
+    mesh_input.triangleArray.indexFormat = OPTIX_INDICES_FORMAT_UNSIGNED_INT3;
+    mesh_input.triangleArray.indexStrideInBytes = sizeof(uint4);
+    mesh_input.triangleArray.flags = triangle_flags;
+    mesh_input.triangleArray.numSbtRecords = 1;
+    mesh_input.triangleArray.sbtIndexOffsetBuffer = 0;
+
+    OptixAccelBufferSizes gas_buffer_sizes;
+    OPTIX_ERROR_CHECK(optixAccelComputeMemoryUsage(m_context, &accel_options, &mesh_input,
+                                                   1,  // num_build_inputs
+                                                   &gas_buffer_sizes));
+    CUdeviceptr d_temp_buffer_gas;
+    CUDA_ERROR_CHECK(
+        cudaMalloc(reinterpret_cast<void**>(&d_temp_buffer_gas), gas_buffer_sizes.tempUpdateSizeInBytes));
+
+    // the update is performed in place
+    OPTIX_ERROR_CHECK(optixAccelBuild(m_context, 0, &accel_options, &mesh_input, 1, d_temp_buffer_gas,
+                                      gas_buffer_sizes.tempUpdateSizeInBytes, m_gas_buffers[gas_id],
+                                      gas_buffer_sizes.outputSizeInBytes, &m_gas_handles[gas_id], nullptr, 0));
+    CUDA_ERROR_CHECK(cudaFree(reinterpret_cast<void*>(d_temp_buffer_gas)));
+}
+
 unsigned int ChOptixGeometry::BuildTrianglesGAS(std::shared_ptr<ChVisualShapeTriangleMesh> mesh_shape,
                                                 CUdeviceptr d_vertices,
                                                 CUdeviceptr d_indices,
@@ -642,25 +734,23 @@ OptixTraversableHandle ChOptixGeometry::CreateRootStructure() {
     // instance_input.type = OPTIX_BUILD_INPUT_TYPE_INSTANCE_POINTERS;
     instance_input.instanceArray.instances = md_instances;
     instance_input.instanceArray.numInstances = static_cast<unsigned int>(m_instances.size());
+    // The motion of the instances is carried by their motion transforms, so the root itself has no motion keys (its
+    // instance bounds enclose the full motion). This keeps the build options independent of the motion time range,
+    // which allows refitting the root when instances move (see RebuildRootStructure).
     OptixAccelBuildOptions accel_options = {};
-    // accel_options.buildFlags = OPTIX_BUILD_FLAG_NONE;
-    // accel_options.buildFlags = OPTIX_BUILD_FLAG_ALLOW_UPDATE;
-    // accel_options.buildFlags = OPTIX_BUILD_FLAG_PREFER_FAST_TRACE | OPTIX_BUILD_FLAG_ALLOW_UPDATE;
-    accel_options.buildFlags = OPTIX_BUILD_FLAG_PREFER_FAST_TRACE;  // | OPTIX_BUILD_FLAG_ALLOW_UPDATE;
+    accel_options.buildFlags = OPTIX_BUILD_FLAG_PREFER_FAST_TRACE | OPTIX_BUILD_FLAG_ALLOW_UPDATE;
     accel_options.operation = OPTIX_BUILD_OPERATION_BUILD;
-    accel_options.motionOptions.numKeys = 2;               // m_start_time default at start
-    accel_options.motionOptions.timeBegin = m_start_time;  // default at start
-    accel_options.motionOptions.timeEnd = m_end_time;      // default at start
+    accel_options.motionOptions.numKeys = 1;
     accel_options.motionOptions.flags = OPTIX_MOTION_FLAG_NONE;
 
     OptixAccelBufferSizes ias_buffer_sizes;
     OPTIX_ERROR_CHECK(optixAccelComputeMemoryUsage(m_context, &accel_options, &instance_input,
                                                    1,  // num build inputs
                                                    &ias_buffer_sizes));
-    md_root_temp_buffer_size = ias_buffer_sizes.tempSizeInBytes;
+    md_root_temp_buffer_size = std::max(ias_buffer_sizes.tempSizeInBytes, ias_buffer_sizes.tempUpdateSizeInBytes);
     md_root_output_buffer_size = ias_buffer_sizes.outputSizeInBytes;
 
-    CUDA_ERROR_CHECK(cudaMalloc(reinterpret_cast<void**>(&md_root_temp_buffer), ias_buffer_sizes.tempSizeInBytes));
+    CUDA_ERROR_CHECK(cudaMalloc(reinterpret_cast<void**>(&md_root_temp_buffer), md_root_temp_buffer_size));
     CUDA_ERROR_CHECK(cudaMalloc(reinterpret_cast<void**>(&md_root_output_buffer), ias_buffer_sizes.outputSizeInBytes));
 
     // pack the data for each instance
@@ -674,7 +764,7 @@ OptixTraversableHandle ChOptixGeometry::CreateRootStructure() {
         // m_instances[i].flags = OPTIX_INSTANCE_FLAG_NONE;
         m_instances[i].instanceId = i;
         m_instances[i].sbtOffset = m_obj_mat_ids[i];
-        m_instances[i].visibilityMask = 1;
+        m_instances[i].visibilityMask = m_obj_masks[i];
         memcpy(m_instances[i].transform, t, sizeof(float) * 12);
     }
 
@@ -689,84 +779,135 @@ OptixTraversableHandle ChOptixGeometry::CreateRootStructure() {
                                       nullptr,  // emitted property list
                                       0         // num emitted properties
                                       ));
+    m_root_num_refits = 0;
 
     return m_root;
 }
 
-// rebuilding the structure without creating anything new
+// updating the structure without creating anything new
 void ChOptixGeometry::RebuildRootStructure() {
     m_end_time = m_end_time > (m_start_time + 1e-2)
                      ? m_end_time
                      : m_end_time + 1e-2;  // need to ensure start time is at least slightly after end time
 
-    for (int i = 0; i < m_motion_transforms.size(); i++) {
-        // update the motion transforms
-        const ChFrame<double> f_start = m_obj_body_frames_start[i] * m_obj_asset_frames[i];
-        const ChVector3d pos_start = f_start.GetPos() - m_origin_offset;
-        const ChMatrix33<double> rot_mat_start = f_start.GetRotMat();
-
-        const ChFrame<double> f_end = m_obj_body_frames_end[i] * m_obj_asset_frames[i];
-        const ChVector3d pos_end = f_end.GetPos() - m_origin_offset;
-        const ChMatrix33<double> rot_mat_end = f_end.GetRotMat();
-
-        m_motion_transforms[i].motionOptions.timeBegin = m_start_time;  // default at start, will be updated
-        m_motion_transforms[i].motionOptions.timeEnd = m_end_time;      // default at start, will be updated
-        GetT3x4FromSRT(m_obj_scales[i], rot_mat_start, pos_start, m_motion_transforms[i].transform[0]);
-        GetT3x4FromSRT(m_obj_scales[i], rot_mat_end, pos_end, m_motion_transforms[i].transform[1]);
+    // update the motion transforms of the instances that moved, and upload the modified ranges
+    bool root_modified = m_gas_refit || m_instances_modified;
+    size_t num_transforms = m_motion_transforms.size();
+    size_t dirty_start = num_transforms;
+    for (size_t i = 0; i <= num_transforms; i++) {
+        bool dirty = false;
+        if (i < num_transforms) {
+            const ChFrame<double> f_start = m_obj_body_frames_start[i] * m_obj_asset_frames[i];
+            const ChVector3d pos_start = f_start.GetPos() - m_origin_offset;
+            const ChMatrix33<double> rot_mat_start = f_start.GetRotMat();
+
+            const ChFrame<double> f_end = m_obj_body_frames_end[i] * m_obj_asset_frames[i];
+            const ChVector3d pos_end = f_end.GetPos() - m_origin_offset;
+            const ChMatrix33<double> rot_mat_end = f_end.GetRotMat();
+
+            float t_start[12];
+            float t_end[12];
+            GetT3x4FromSRT(m_obj_scales[i], rot_mat_start, pos_start, t_start);
+            GetT3x4FromSRT(m_obj_scales[i], rot_mat_end, pos_end, t_end);
+
+            OptixMatrixMotionTransform& transform = m_motion_transforms[i];
+            bool same_keys = memcmp(t_start, transform.transform[0], sizeof(t_start)) == 0 &&
+                             memcmp(t_end, transform.transform[1], sizeof(t_end)) == 0;
+            bool same_times =
+                transform.motionOptions.timeBegin == m_start_time && transform.motionOptions.timeEnd == m_end_time;
+            // a transform with two identical keys does not depend on the motion time range
+            bool is_static = memcmp(t_start, t_end, sizeof(t_start)) == 0;
+
+            dirty = !same_keys || (!same_times && !is_static);
+            if (dirty) {
+                transform.motionOptions.timeBegin = m_start_time;
+                transform.motionOptions.timeEnd = m_end_time;
+                memcpy(transform.transform[0], t_start, sizeof(t_start));
+                memcpy(transform.transform[1], t_end, sizeof(t_end));
+            }
+        }
+
+        if (dirty && dirty_start == num_transforms) {
+            dirty_start = i;
+        } else if (!dirty && dirty_start < num_transforms) {
+            CUDA_ERROR_CHECK(cudaMemcpy(
+                reinterpret_cast<void*>(md_motion_transforms + dirty_start * sizeof(OptixMatrixMotionTransform)),
+                m_motion_transforms.data() + dirty_start, (i - dirty_start) * sizeof(OptixMatrixMotionTransform),
+                cudaMemcpyHostToDevice));
+            dirty_start = num_transforms;
+            root_modified = true;
+        }
     }
 
-    CUDA_ERROR_CHECK(cudaMemcpy(reinterpret_cast<void*>(md_motion_transforms), m_motion_transforms.data(),
-                                m_motion_transforms.size() * sizeof(OptixMatrixMotionTransform),
-                                cudaMemcpyHostToDevice));
+    if (!root_modified)
+        return;
 
     OptixBuildInput instance_input = {};
     instance_input.type = OPTIX_BUILD_INPUT_TYPE_INSTANCES;
     instance_input.instanceArray.instances = md_instances;
     instance_input.instanceArray.numInstances = static_cast<unsigned int>(m_instances.size());
-    OptixAccelBuildOptions accel_options = {};
-    accel_options.buildFlags = OPTIX_BUILD_FLAG_PREFER_FAST_TRACE;  // | OPTIX_BUILD_FLAG_ALLOW_UPDATE;
-    accel_options.operation = OPTIX_BUILD_OPERATION_BUILD;
 
-    accel_options.motionOptions.numKeys = 2;
-    accel_options.motionOptions.timeBegin = m_start_time;
-    accel_options.motionOptions.timeEnd = m_end_time;
+    // same build options as in CreateRootStructure; refit unless the root was refit too many times
+    OptixAccelBuildOptions accel_options = {};
+    accel_options.buildFlags = OPTIX_BUILD_FLAG_PREFER_FAST_TRACE | OPTIX_BUILD_FLAG_ALLOW_UPDATE;
+    accel_options.operation = OPTIX_BUILD_OPERATION_UPDATE;
+    accel_options.motionOptions.numKeys = 1;
     accel_options.motionOptions.flags = OPTIX_MOTION_FLAG_NONE;
-    // accel_options.operation = OPTIX_BUILD_OPERATION_UPDATE;
+    if (m_root_num_refits >= max_root_refits) {
+        accel_options.operation = OPTIX_BUILD_OPERATION_BUILD;
+        m_root_num_refits = 0;
+    } else {
+        m_root_num_refits++;
+    }
 
-    OptixAccelBufferSizes ias_buffer_sizes;
-    OPTIX_ERROR_CHECK(optixAccelComputeMemoryUsage(m_context, &accel_options, &instance_input,
-                                                   1,  // num build inputs
-                                                   &ias_buffer_sizes));
     OPTIX_ERROR_CHECK(optixAccelBuild(m_context,
                                       0,  // CUDA stream
                                       &accel_options, &instance_input,
                                       1,  // num build inputs
-                                      md_root_temp_buffer, ias_buffer_sizes.tempSizeInBytes, md_root_output_buffer,
-                                      ias_buffer_sizes.outputSizeInBytes, &m_root,
+                                      md_root_temp_buffer, md_root_temp_buffer_size, md_root_output_buffer,
+                                      md_root_output_buffer_size, &m_root,
                                       nullptr,  // emitted property list
                                       0         // num emitted properties
                                       ));
+    m_gas_refit = false;
+    m_instances_modified = false;
 
     cudaDeviceSynchronize();
 }
 
-void ChOptixGeometry::UpdateBodyTransformsStart(float t_start, float t_target_end) {
-    // std::cout << "Updating body transforms for start keyframe\n";
-    std::vector<ChFrame<double>> frames = std::vector<ChFrame<double>>(m_bodies.size());
+void ChOptixGeometry::RecordBodyFrames(double t) {
+    std::vector<ChFrame<double>> frames(m_bodies.size());
     for (int i = 0; i < frames.size(); i++) {
         frames[i] = m_bodies[i]->GetFrameRefToAbs();
     }
+    m_body_history.Record(t, std::move(frames));
+}
+
+void ChOptixGeometry::UpdateBodyTransformsStart(float t_start, float t_target_end, bool interpolate) {
+    // std::cout << "Updating body transforms for start keyframe\n";
+    std::vector<ChFrame<double>> frames;
+    if (!interpolate || !m_body_history.Interpolate(t_start, frames) || frames.size() != m_bodies.size()) {
+        frames.resize(m_bodies.size());
+        for (int i = 0; i < frames.size(); i++) {
+            frames[i] = m_bodies[i]->GetFrameRefToAbs();
+        }
+    }
     auto keyframe = std::make_tuple(t_start, t_target_end, std::move(frames));
     m_obj_body_frames_start_tmps.push_back(keyframe);
 }
 
-void ChOptixGeometry::UpdateBodyTransformsEnd(float t_end) {
+void ChOptixGeometry::UpdateBodyTransformsEnd(float t_end, bool interpolate) {
     // std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
 
     // pack the end frame
     m_end_time = t_end;
-    for (int i = 0; i < m_bodies.size(); i++) {
-        m_obj_body_frames_end[i] = m_bodies[i]->GetFrameRefToAbs();
+    std::vector<ChFrame<double>> frames;
+    if (interpolate && m_body_history.Interpolate(t_end, frames) && frames.size() == m_bodies.size()) {
+        m_obj_body_frames_end = std::move(frames);
+    } else {
+        for (int i = 0; i < m_bodies.size(); i++) {
+            m_obj_body_frames_end[i] = m_bodies[i]->GetFrameRefToAbs();
+        }
     }
 
     // need a default start time that will trigger first transform to always be valid
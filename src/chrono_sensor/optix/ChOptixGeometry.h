@@ -23,6 +23,7 @@
 #include "chrono/core/ChFrame.h"
 #include "chrono/physics/ChBody.h"
 #include "chrono/assets/ChVisualShapeTriangleMesh.h"
+#include "chrono_sensor/utils/ChStateInterpolation.h"
 
 #include <deque>
 
@@ -116,17 +117,44 @@ class CH_SENSOR_API ChOptixGeometry {
     ///@return A traversable handle to the root node
     OptixTraversableHandle CreateRootStructure();
 
-    /// Rebuild the root acceleration structure for when the root changes
+    /// Update the root acceleration structure for when the root changes.
+    /// Only the motion transforms of instances that moved are uploaded, and the root acceleration structure is refit
+    /// (rather than rebuilt) if some instance moved or a deformable mesh changed. A full rebuild is performed every
+    /// max_root_refits updates, to limit the degradation of the acceleration structure.
     void RebuildRootStructure();
 
+    /// Record the frames of the bodies at the current step, used for interpolating the transforms between steps
+    /// @param t The current simulation time
+    void RecordBodyFrames(double t);
+
     /// Update the list of transforms associated with the bodies and assets at the start time
-    void UpdateBodyTransformsStart(float t_start, float t_target_end);
+    /// @param interpolate Whether the transforms are interpolated at t_start from the recorded frames of the last two
+    /// steps rather than taken from the current state of the bodies
+    void UpdateBodyTransformsStart(float t_start, float t_target_end, bool interpolate = false);
 
     /// Update the list of transforms associated with the bodies and assets at the end time
-    void UpdateBodyTransformsEnd(float t_end);
+    /// @param interpolate Whether the transforms are interpolated at t_end from the recorded frames of the last two
+    /// steps rather than taken from the current state of the bodies
+    void UpdateBodyTransformsEnd(float t_end, bool interpolate = false);
+
+    /// Update the deformable meshes based on how the meshes changed in Chrono.
+    /// The acceleration structures of the modified meshes are refit.
+    /// @param modified flags indicating which deformable meshes were modified (see ChOptixPipeline)
+    void UpdateDeformableMeshes(const std::vector<bool>& modified);
+
+    /// Number of objects added to the scene so far
+    unsigned int GetNumObjects() const { return static_cast<unsigned int>(m_motion_transforms.size()); }
 
-    /// Update the deformable meshes based on how the meshes changed in Chrono
-    void UpdateDeformableMeshes();
+    /// Declare a set of objects as the levels of detail of the same mesh. Only the first (full resolution) object is
+    /// seen by cameras, and a single level at a time is seen by lidar and radar (see UpdateLOD).
+    /// @param object_ids the ids of the objects, from the full resolution mesh to the coarsest level
+    void AddLODChain(const std::vector<unsigned int>& object_ids);
+
+    /// Select the level of detail seen by lidar and radar for each chain, based on the distance between the object
+    /// and the closest range sensor. Level l > 0 is selected from a distance of lod_distance * 2^(l-1).
+    /// @param sensor_positions the positions of the lidar and radar sensors
+    /// @param lod_distance the distance up to which the full resolution mesh is used
+    void UpdateLOD(const std::vector<ChVector3d>& sensor_positions, float lod_distance);
 
     /// Cleanup the entire optix geometry manager, cleans and frees device pointers and root structure
     void Cleanup();
@@ -161,6 +189,16 @@ class CH_SENSOR_API ChOptixGeometry {
                                    bool rebuild = false,
                                    unsigned int gas_id = 0);
 
+    /// Function to refit the geometry acceleration structure of a triangle mesh whose vertices moved
+    /// @param mesh_shape the chrono mesh representing this asset
+    /// @param d_vertices the device pointer to the vertices of the mesh
+    /// @param d_indices the device pointer to the indices of the mesh
+    /// @param gas_id the id of the GAS (built with updates allowed)
+    void RefitTrianglesGAS(std::shared_ptr<ChVisualShapeTriangleMesh> mesh_shape,
+                           CUdeviceptr d_vertices,
+                           CUdeviceptr d_indices,
+                           unsigned int gas_id);
+
     /// Function ot convert scale, rotation, translation to top 3 rows of transform matrix
     /// @param[in] s the scale vector
     /// @param[in] a the rotation matrix
@@ -196,6 +234,11 @@ class CH_SENSOR_API ChOptixGeometry {
     size_t md_root_temp_buffer_size;         ///< size of the root temporary buffer on the device
     size_t md_root_output_buffer_size;       ///< size of the root output buffer on the device
     OptixTraversableHandle m_root;           ///< handle to the root acceleration structure
+    unsigned int m_root_num_refits = 0;      ///< number of refits of the root since its last full build
+    bool m_gas_refit = false;                ///< a geometry acceleration structure was refit since the last root update
+    bool m_instances_modified = false;       ///< instance visibility masks changed since the last root update
+
+    static const unsigned int max_root_refits = 100;  ///< number of root refits before a full rebuild
 
     // GAS buffers, handles, and transforms
     std::vector<CUdeviceptr> m_gas_buffers;                       ///< all the gas buffers
@@ -205,7 +248,10 @@ class CH_SENSOR_API ChOptixGeometry {
     std::vector<OptixTraversableHandle> m_motion_handles;         ///< vector of all the motion transforms
 
     // index buffers for objects pointing to their materials and GAS
-    std::vector<unsigned int> m_obj_mat_ids;  ///< id of the material of the box
+    std::vector<unsigned int> m_obj_mat_ids;              ///< id of the material of the box
+    std::vector<unsigned int> m_obj_masks;                ///< visibility mask of each object
+    std::vector<std::vector<unsigned int>> m_lod_chains;  ///< object ids of the levels of detail of each mesh
+    std::vector<unsigned int> m_lod_levels;               ///< level seen by range sensors in each chain
 
     // vectors referencing data from Chrono
     std::vector<std::shared_ptr<ChBody>> m_bodies;         ///< chrono bodies in the scene
@@ -219,6 +265,8 @@ class CH_SENSOR_API ChOptixGeometry {
     /// start under lock when the corresponding end has been packed
     std::vector<std::tuple<float, float, std::vector<ChFrame<double>>>> m_obj_body_frames_start_tmps;
 
+    ChPoseHistory m_body_history;  ///< frames of the bodies at the last steps, for interpolating between steps
+
     /// keep track of chrono meshes and their corresponding mesh pool id for automatic instancing
     std::vector<std::tuple<CUdeviceptr, unsigned int>> m_known_meshes;
 
@@ -24,6 +24,8 @@
 #include <optix_stack_size.h>
 #include <optix_stubs.h>
 
+#include <algorithm>
+
 namespace chrono {
 namespace sensor {
 
@@ -118,6 +120,10 @@ void ChOptixPipeline::Cleanup() {
         OPTIX_ERROR_CHECK(optixProgramGroupDestroy(m_depthCamera_raygen_group));
         m_depthCamera_raygen_group = 0;
     }
+    if (m_multiCamera_raygen_group) {
+        OPTIX_ERROR_CHECK(optixProgramGroupDestroy(m_multiCamera_raygen_group));
+        m_multiCamera_raygen_group = 0;
+    }
     // if (m_segmentation_fov_lens_raygen_group) {
     //     OPTIX_ERROR_CHECK(optixProgramGroupDestroy(m_segmentation_fov_lens_raygen_group));
     //     m_segmentation_fov_lens_raygen_group = 0;
@@ -130,6 +136,10 @@ void ChOptixPipeline::Cleanup() {
         OPTIX_ERROR_CHECK(optixProgramGroupDestroy(m_lidar_multi_raygen_group));
         m_lidar_multi_raygen_group = 0;
     }
+    if (m_lidar_adaptive_raygen_group) {
+        OPTIX_ERROR_CHECK(optixProgramGroupDestroy(m_lidar_adaptive_raygen_group));
+        m_lidar_adaptive_raygen_group = 0;
+    }
     if (m_radar_raygen_group) {
         OPTIX_ERROR_CHECK(optixProgramGroupDestroy(m_radar_raygen_group));
         m_radar_raygen_group = 0;
@@ -370,6 +380,10 @@ void ChOptixPipeline::AssembleBaseProgramGroups() {
     CreateOptixProgramGroup(m_depthCamera_raygen_group, OPTIX_PROGRAM_GROUP_KIND_RAYGEN, nullptr, nullptr,
                             m_camera_raygen_module, "__raygen__depthcamera");
 
+    // multi-output camera raygen
+    CreateOptixProgramGroup(m_multiCamera_raygen_group, OPTIX_PROGRAM_GROUP_KIND_RAYGEN, nullptr, nullptr,
+                            m_camera_raygen_module, "__raygen__multicamera");
+
     // segmentation pinhole raygen
     CreateOptixProgramGroup(m_segmentation_raygen_group, OPTIX_PROGRAM_GROUP_KIND_RAYGEN, nullptr, nullptr,
                             m_camera_raygen_module, "__raygen__segmentation");
@@ -383,6 +397,9 @@ void ChOptixPipeline::AssembleBaseProgramGroups() {
     // lidar multi raygen
     CreateOptixProgramGroup(m_lidar_multi_raygen_group, OPTIX_PROGRAM_GROUP_KIND_RAYGEN, nullptr, nullptr,
                             m_lidar_raygen_module, "__raygen__lidar_multi");
+    // lidar adaptive raygen
+    CreateOptixProgramGroup(m_lidar_adaptive_raygen_group, OPTIX_PROGRAM_GROUP_KIND_RAYGEN, nullptr, nullptr,
+                            m_lidar_raygen_module, "__raygen__lidar_adaptive");
     
 }
 
@@ -498,6 +515,23 @@ void ChOptixPipeline::SpawnPipeline(PipelineType type) {
             break;
         }
 
+        case PipelineType::MULTI_CAMERA: {
+            program_groups.push_back(m_multiCamera_raygen_group);
+            OPTIX_ERROR_CHECK(optixSbtRecordPackHeader(m_multiCamera_raygen_group, raygen_record.get()));
+            raygen_record->data.specific.multiCamera.camera.hFOV = 3.14f / 4;          // default value
+            raygen_record->data.specific.multiCamera.camera.frame_buffer = {};         // default value
+            raygen_record->data.specific.multiCamera.camera.use_gi = false;            // default value
+            raygen_record->data.specific.multiCamera.camera.use_fog = true;            // default value
+            raygen_record->data.specific.multiCamera.camera.gamma = 2.2f;              // default value
+            raygen_record->data.specific.multiCamera.camera.lens_model = PINHOLE;      // default value
+            raygen_record->data.specific.multiCamera.camera.lens_parameters = {};
+            raygen_record->data.specific.multiCamera.max_depth = 1000.f;               // default value
+            raygen_record->data.specific.multiCamera.depth_buffer = {};                // default value
+            raygen_record->data.specific.multiCamera.semantic_buffer = {};             // default value
+            raygen_record->data.specific.multiCamera.normal_buffer = {};               // default value
+            break;
+        }
+
             // case PipelineType::SEGMENTATION_FOV_LENS: {
             //     program_groups.push_back(m_segmentation_fov_lens_raygen_group);
             //     OPTIX_ERROR_CHECK(optixSbtRecordPackHeader(m_segmentation_fov_lens_raygen_group,
@@ -538,6 +572,29 @@ void ChOptixPipeline::SpawnPipeline(PipelineType type) {
             break;
         }
 
+        case PipelineType::LIDAR_ADAPTIVE: {
+            program_groups.push_back(m_lidar_adaptive_raygen_group);
+            OPTIX_ERROR_CHECK(optixSbtRecordPackHeader(m_lidar_adaptive_raygen_group, raygen_record.get()));
+            raygen_record->data.specific.lidar.frame_buffer = {};                           // default value
+            raygen_record->data.specific.lidar.max_vert_angle = 1.f;                        // default value
+            raygen_record->data.specific.lidar.min_vert_angle = -1.f;                       // default value
+            raygen_record->data.specific.lidar.hFOV = (float)CH_2PI;                        // default value
+            raygen_record->data.specific.lidar.beam_shape = LidarBeamShape::RECTANGULAR;    // default value
+            raygen_record->data.specific.lidar.sample_radius = 1;                           // default value
+            raygen_record->data.specific.lidar.horiz_div_angle = 0.f;                       // default value
+            raygen_record->data.specific.lidar.vert_div_angle = 0.f;                        // default value
+            raygen_record->data.specific.lidar.max_distance = 200.f;                        // default value
+            raygen_record->data.specific.lidar.clip_near = 0.f;                             // default value
+            raygen_record->data.specific.lidar.return_mode = LidarReturnMode::MEAN_RETURN;  // default value
+            raygen_record->data.specific.lidar.discontinuity_threshold = 0.05f;             // default value
+            raygen_record->data.specific.lidar.clip_intensity = 0.f;                        // default value
+            raygen_record->data.specific.lidar.clip_default_dist = 0.f;                     // default value
+            raygen_record->data.specific.lidar.stdev_range = 0.f;                           // default value
+            raygen_record->data.specific.lidar.stdev_intensity = 0.f;                       // default value
+            raygen_record->data.specific.lidar.rng_buffer = {};                             // default value
+            break;
+        }
+
         case PipelineType::RADAR: {
             program_groups.push_back(m_radar_raygen_group);
             OPTIX_ERROR_CHECK(optixSbtRecordPackHeader(m_radar_raygen_group, raygen_record.get()));
@@ -1107,7 +1164,52 @@ unsigned int ChOptixPipeline::GetDeformableMeshMaterial(CUdeviceptr& d_vertices,
     return mat_id;
 }
 
+// Copy to the device the ranges of 'data' that differ from 'cache' (the data previously copied) and update the cache.
+// Ranges separated by fewer than 'min_gap' unchanged entries are merged into a single copy.
+// Returns true if any entry was modified.
+static bool UploadModifiedRanges(CUdeviceptr d_data, const std::vector<float4>& data, std::vector<float4>& cache) {
+    const size_t min_gap = 64;
+
+    if (cache.size() != data.size()) {
+        CUDA_ERROR_CHECK(cudaMemcpy(reinterpret_cast<void*>(d_data), data.data(), sizeof(float4) * data.size(),
+                                    cudaMemcpyHostToDevice));
+        cache = data;
+        return true;
+    }
+
+    bool modified = false;
+    size_t n = data.size();
+    size_t j = 0;
+    while (j < n) {
+        // find the start of the next modified range
+        while (j < n && data[j].x == cache[j].x && data[j].y == cache[j].y && data[j].z == cache[j].z)
+            j++;
+        if (j == n)
+            break;
+
+        // extend the range until a gap of at least min_gap unchanged entries
+        size_t start = j;
+        size_t end = j + 1;
+        for (size_t k = j + 1; k < n && k < end + min_gap; k++) {
+            if (data[k].x != cache[k].x || data[k].y != cache[k].y || data[k].z != cache[k].z)
+                end = k + 1;
+        }
+
+        CUDA_ERROR_CHECK(cudaMemcpy(reinterpret_cast<void*>(d_data + start * sizeof(float4)), data.data() + start,
+                                    sizeof(float4) * (end - start), cudaMemcpyHostToDevice));
+        std::copy(data.begin() + start, data.begin() + end, cache.begin() + start);
+        modified = true;
+        j = end;
+    }
+
+    return modified;
+}
+
 void ChOptixPipeline::UpdateDeformableMeshes() {
+    m_deformable_vertices.resize(m_deformable_meshes.size());
+    m_deformable_normals.resize(m_deformable_meshes.size());
+    m_deformable_modified.assign(m_deformable_meshes.size(), false);
+
     for (int i = 0; i < m_deformable_meshes.size(); i++) {
         std::shared_ptr<ChVisualShapeTriangleMesh> mesh_shape = std::get<0>(m_deformable_meshes[i]);
         CUdeviceptr d_vertices = std::get<1>(m_deformable_meshes[i]);
@@ -1121,8 +1223,7 @@ void ChOptixPipeline::UpdateDeformableMeshes() {
             throw std::runtime_error("Error: changing mesh size not supported by Chrono::Sensor");
         }
 
-        // update all the vertex locations
-
+        // update the modified vertex locations
         std::vector<float4> vertex_buffer = std::vector<float4>(mesh->GetCoordsVertices().size());
         for (int j = 0; j < mesh->GetCoordsVertices().size(); j++) {
             vertex_buffer[j] = make_float4((float)mesh->GetCoordsVertices()[j].x(),  //
@@ -1130,10 +1231,9 @@ void ChOptixPipeline::UpdateDeformableMeshes() {
                                            (float)mesh->GetCoordsVertices()[j].z(),  //
                                            0.f);                                     // padding for alignment
         }
-        CUDA_ERROR_CHECK(cudaMemcpy(reinterpret_cast<void*>(d_vertices), vertex_buffer.data(),
-                                    sizeof(float4) * vertex_buffer.size(), cudaMemcpyHostToDevice));
+        m_deformable_modified[i] = UploadModifiedRanges(d_vertices, vertex_buffer, m_deformable_vertices[i]);
 
-        // update all the normals if normal exist
+        // update the modified normals if normal exist
         if (mesh_shape->GetMesh()->GetCoordsNormals().size() > 0) {
             std::vector<float4> normal_buffer = std::vector<float4>(mesh->GetCoordsNormals().size());
             for (int j = 0; j < mesh->GetCoordsNormals().size(); j++) {
@@ -1142,11 +1242,8 @@ void ChOptixPipeline::UpdateDeformableMeshes() {
                                                (float)mesh->GetCoordsNormals()[j].z(),  //
                                                0.f);                                    // padding for alignment
             }
-            CUDA_ERROR_CHECK(cudaMemcpy(reinterpret_cast<void*>(d_normals), normal_buffer.data(),
-                                        sizeof(float4) * normal_buffer.size(), cudaMemcpyHostToDevice));
+            UploadModifiedRanges(d_normals, normal_buffer, m_deformable_normals[i]);
         }
-
-        // TODO: for SCM terrain, make use of the list of modified vertices
     }
 }
 
@@ -51,10 +51,12 @@ enum class PipelineType {
     // CAMERA_FOV_LENS,        ///< FOV lens model
     SEGMENTATION,  ///< segmentation camera pipeline
     DEPTH_CAMERA, /// < depth camera pipeline>   
+    MULTI_CAMERA,  ///< camera pipeline with depth, segmentation, and normal outputs from the same rays
     // SEGMENTATION_FOV_LENS,  ///< FOV lens segmentation camera
-    LIDAR_SINGLE,  ///< single sample lidar
-    LIDAR_MULTI,   ///< multi sample lidar
-    RADAR          ///< radar model
+    LIDAR_SINGLE,    ///< single sample lidar
+    LIDAR_MULTI,     ///< multi sample lidar
+    LIDAR_ADAPTIVE,  ///< adaptively sampled lidar, with the beams reduced in the launch
+    RADAR            ///< radar model
 
 };
 // TODO: how do we allow custom ray gen programs? (Is that ever going to be a thing?)
@@ -118,9 +120,14 @@ class CH_SENSOR_API ChOptixPipeline {
     unsigned int GetNVDBMaterial(std::vector<std::shared_ptr<ChVisualMaterial>> mat_list = {});
 
 
-    /// Function to update all the deformable meshes in the optix scene based on their chrono meshes
+    /// Function to update all the deformable meshes in the optix scene based on their chrono meshes.
+    /// The vertices and normals last uploaded to the device are cached, and only ranges that changed are copied.
     void UpdateDeformableMeshes();
 
+    /// Flags indicating which deformable meshes were modified by the last call to UpdateDeformableMeshes
+    /// (same order as the deformable meshes added to the scene)
+    const std::vector<bool>& GetDeformableMeshesModified() const { return m_deformable_modified; }
+
     /// Function to update all the shader binding tables associated with this optix scene
     void UpdateAllSBTs();
 
@@ -158,6 +165,10 @@ class CH_SENSOR_API ChOptixPipeline {
     /// @returns a shared pointer to the specified raygen record
     std::shared_ptr<Record<RaygenParameters>> GetRayGenRecord(unsigned int id);
 
+    /// Query the number of pipelines spawned
+    /// @returns the number of pipelines, the id of the last spawned pipeline being one less
+    unsigned int GetNumPipelines() { return static_cast<unsigned int>(m_pipelines.size()); }
+
     /// Explicit cleanup function for freeing memory associated with this pipeline
     /// which should be freed before reconstructing the pipeline. Any reusable varaibles
     /// will not be cleaned up here
@@ -216,10 +227,12 @@ class CH_SENSOR_API ChOptixPipeline {
     OptixProgramGroup m_segmentation_raygen_group = 0;
 
     OptixProgramGroup m_depthCamera_raygen_group = 0;
+    OptixProgramGroup m_multiCamera_raygen_group = 0;
     
     // OptixProgramGroup m_segmentation_fov_lens_raygen_group = 0;
     OptixProgramGroup m_lidar_single_raygen_group = 0;
     OptixProgramGroup m_lidar_multi_raygen_group = 0;
+    OptixProgramGroup m_lidar_adaptive_raygen_group = 0;
     OptixProgramGroup m_radar_raygen_group = 0;
 
     OptixProgramGroup m_hit_box_group = 0;
@@ -268,6 +281,9 @@ class CH_SENSOR_API ChOptixPipeline {
     /// list of deformable meshes <mesh shape, dvertices, dnormals, num prev triangles>
     std::vector<std::tuple<std::shared_ptr<ChVisualShapeTriangleMesh>, CUdeviceptr, CUdeviceptr, unsigned int>>
         m_deformable_meshes;
+    std::vector<std::vector<float4>> m_deformable_vertices;  ///< vertices last uploaded for each deformable mesh
+    std::vector<std::vector<float4>> m_deformable_normals;   ///< normals last uploaded for each deformable mesh
+    std::vector<bool> m_deformable_modified;                 ///< deformable meshes modified by the last update
 
     // default material in the material pool
     bool m_default_material_inst = false;
@@ -46,7 +46,7 @@ __device__ __inline__ float radial_function(const float& rd2, const LensParams&
 
 /// Camera ray generation program using an FOV lens model
 extern "C" __global__ void __raygen__camera() {
-    const RaygenParameters* raygen = (RaygenParameters*)optixGetSbtDataPointer();
+    const RaygenParameters* raygen = getRaygenParameters();
     const CameraParameters& camera = raygen->specific.camera;
 
     const uint3 idx = optixGetLaunchIndex();
@@ -133,9 +133,96 @@ extern "C" __global__ void __raygen__camera() {
     }
 }
 
+/// Multi-output camera ray generation program. The color output is rendered as for the camera, and the depth,
+/// segmentation, and normal outputs are filled from the first hit of the same primary rays.
+extern "C" __global__ void __raygen__multicamera() {
+    const RaygenParameters* raygen = getRaygenParameters();
+    const MultiCameraParameters& multi = raygen->specific.multiCamera;
+    const CameraParameters& camera = multi.camera;
+
+    const uint3 idx = optixGetLaunchIndex();
+    const uint3 screen = optixGetLaunchDimensions();
+    const unsigned int image_index = screen.x * idx.y + idx.x;
+
+    float2 d =
+        (make_float2(idx.x, idx.y) + make_float2(0.5, 0.5)) / make_float2(screen.x, screen.y) * 2.f - make_float2(1.f);
+    d.y *= (float)(screen.y) / (float)(screen.x);  // correct for the aspect ratio
+
+    if (camera.lens_model == FOV_LENS && ((d.x) > 1e-5 || abs(d.y) > 1e-5)) {
+        float focal = 1.f / tanf(camera.hFOV / 2.0);
+        float2 d_normalized = d / focal;
+        float rd = sqrtf(d_normalized.x * d_normalized.x + d_normalized.y * d_normalized.y);
+        float ru = tanf(rd * camera.hFOV) / (2 * tanf(camera.hFOV / 2.0));
+        d = d_normalized * (ru / rd) * focal;
+
+    } else if (camera.lens_model == RADIAL) {
+        float focal = 1.f / tanf(camera.hFOV / 2.0);
+        float recip_focal = tanf(camera.hFOV / 2.0);
+        float2 d_normalized = d * recip_focal;
+        float rd2 = d_normalized.x * d_normalized.x + d_normalized.y * d_normalized.y;
+        float distortion_ratio = radial_function(rd2, camera.lens_parameters);
+        d = d_normalized * distortion_ratio * focal;
+    }
+
+    float t_frac = 0.f;
+    if (camera.rng_buffer)
+        t_frac = curand_uniform(
+            &camera.rng_buffer[image_index]);  // 0-1 between start and end time of the camera (chosen here)
+    const float t_traverse = raygen->t0 + t_frac * (raygen->t1 - raygen->t0);  // simulation time when ray is sent
+
+    float3 ray_origin = lerp(raygen->pos0, raygen->pos1, t_frac);
+    float4 ray_quat = nlerp(raygen->rot0, raygen->rot1, t_frac);
+    const float h_factor = camera.hFOV / CUDART_PI_F * 2.0;
+    float3 forward;
+    float3 left;
+    float3 up;
+
+    basis_from_quaternion(ray_quat, forward, left, up);
+    float3 ray_direction = normalize(forward - d.x * left * h_factor + d.y * up * h_factor);
+
+    PerRayData_camera prd = default_camera_prd();
+    prd.use_gi = camera.use_gi;
+    if (camera.use_gi) {
+        prd.rng = camera.rng_buffer[image_index];
+    }
+    unsigned int opt1;
+    unsigned int opt2;
+    pointer_as_ints(&prd, opt1, opt2);
+    unsigned int raytype = (unsigned int)CAMERA_RAY_TYPE;
+    optixTrace(params.root, ray_origin, ray_direction, params.scene_epsilon, 1e16f, t_traverse, OptixVisibilityMask(1),
+               OPTIX_RAY_FLAG_NONE, 0, 1, 0, opt1, opt2, raytype);
+
+    // Gamma correct the output color into sRGB color space
+    float gamma = camera.gamma;
+    camera.frame_buffer[image_index] =
+        make_half4(pow(prd.color.x, 1.0f / gamma), pow(prd.color.y, 1.0f / gamma), pow(prd.color.z, 1.0f / gamma), 1.f);
+    if (camera.use_gi) {
+        camera.albedo_buffer[image_index] = make_half4(prd.albedo.x, prd.albedo.y, prd.albedo.z, 0.f);
+        float screen_n_x = -Dot(left, prd.normal);     // screen space (x right)
+        float screen_n_y = Dot(up, prd.normal);        // screen space (y up)
+        float screen_n_z = -Dot(forward, prd.normal);  // screen space (-z forward)
+        camera.normal_buffer[image_index] = make_half4(screen_n_x, screen_n_y, screen_n_z, 0.f);
+    }
+
+    // Additional outputs from the first hit
+    if (multi.depth_buffer) {
+        multi.depth_buffer[image_index] = fminf(multi.max_depth, prd.hit_dist);
+    }
+    if (multi.semantic_buffer) {
+        multi.semantic_buffer[image_index].x = prd.class_id;
+        multi.semantic_buffer[image_index].y = prd.instance_id;
+    }
+    if (multi.normal_buffer) {
+        bool hit = prd.hit_dist < 1e16f;
+        multi.normal_buffer[image_index] = make_float4(-Dot(left, prd.hit_normal),     // screen space (x right)
+                                                       Dot(up, prd.hit_normal),        // screen space (y up)
+                                                       -Dot(forward, prd.hit_normal),  // screen space (-z forward)
+                                                       hit ? 1.f : 0.f);
+    }
+}
 
 extern "C" __global__ void __raygen__depthcamera() {
-    const RaygenParameters* raygen = (RaygenParameters*) optixGetSbtDataPointer();
+    const RaygenParameters* raygen = getRaygenParameters();
     const DepthCameraParameters& camera = raygen->specific.depthCamera;
 
     const uint3 idx = optixGetLaunchIndex();
@@ -194,7 +281,7 @@ extern "C" __global__ void __raygen__depthcamera() {
 
 /// Camera ray generation program using an FOV lens model
 extern "C" __global__ void __raygen__segmentation() {
-    const RaygenParameters* raygen = (RaygenParameters*)optixGetSbtDataPointer();
+    const RaygenParameters* raygen = getRaygenParameters();
     const SemanticCameraParameters& camera = raygen->specific.segmentation;
 
     const uint3 idx = optixGetLaunchIndex();
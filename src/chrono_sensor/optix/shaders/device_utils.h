@@ -70,6 +70,16 @@ static __device__ __inline__ float sensor_next_rand(float& rand) {
     return rand;
 }
 
+/// Get the ray generation parameters of the sensor being rendered. In a batched launch (launch depth > 1) the raygen
+/// records of the sensors in the batch are contiguous in device memory and the launch index z selects the sensor.
+__device__ __inline__ const RaygenParameters* getRaygenParameters() {
+    // stride of Record<RaygenParameters> (see ChOptixPipeline.h)
+    const size_t stride = (OPTIX_SBT_RECORD_HEADER_SIZE + sizeof(RaygenParameters) + OPTIX_SBT_RECORD_ALIGNMENT - 1) /
+                          OPTIX_SBT_RECORD_ALIGNMENT * OPTIX_SBT_RECORD_ALIGNMENT;
+    const char* record_data = (const char*)optixGetSbtDataPointer();
+    return (const RaygenParameters*)(record_data + optixGetLaunchIndex().z * stride);
+}
+
 __device__ __inline__ PerRayData_camera* getCameraPRD() {
     unsigned int opt0 = optixGetPayload_0();
     unsigned int opt1 = optixGetPayload_1();
@@ -117,6 +127,10 @@ __device__ __inline__ PerRayData_camera default_camera_prd() {
     prd.albedo = make_float3(0.f, 0.f, 0.f);
     prd.normal = make_float3(0.f, 0.f, 0.f);
     prd.use_fog = true;
+    prd.hit_dist = 1e16f;
+    prd.hit_normal = make_float3(0.f, 0.f, 0.f);
+    prd.class_id = 0;
+    prd.instance_id = 0;
     return prd;
 };
 
@@ -18,8 +18,36 @@
 
 #include "chrono_sensor/optix/shaders/device_utils.h"
 
+// relative theta and phi of a sample in a beam, from the position of the sample in the beam in [-1,1]x[-1,1]
+static __device__ __inline__ float2 beam_sample_angles(const LidarParameters& lidar,
+                                                       const float2& local_ray_id_fraction) {
+    float local_ray_theta;
+    float local_ray_phi;
+
+    // beam shape is rectangular
+    if (lidar.beam_shape == LidarBeamShape::ELLIPTICAL) {
+        local_ray_theta = local_ray_id_fraction.x * lidar.horiz_div_angle / 2.0;
+        local_ray_phi = local_ray_id_fraction.y * lidar.vert_div_angle / 2.0;
+        // beam shape is elliptical
+    } else {  // defaulting to rectangular
+        float angle = atan2(local_ray_id_fraction.y, local_ray_id_fraction.x);
+        float ring = max(abs(local_ray_id_fraction.x), abs(local_ray_id_fraction.y));
+        float2 axis = make_float2(lidar.vert_div_angle / 2.0 * ring, lidar.horiz_div_angle / 2.0 * ring);
+        float radius;
+        if (axis.y == 0 && axis.x == 0) {
+            radius = 0;
+        } else {
+            radius = (axis.x * axis.y) /
+                     sqrtf(axis.x * axis.x * sinf(angle) * sinf(angle) + axis.y * axis.y * cosf(angle) * cosf(angle));
+        }
+        local_ray_theta = radius * sinf(angle);
+        local_ray_phi = radius * cosf(angle);
+    }
+    return make_float2(local_ray_theta, local_ray_phi);
+}
+
 extern "C" __global__ void __raygen__lidar_single() {
-    const RaygenParameters* raygen = (RaygenParameters*)optixGetSbtDataPointer();
+    const RaygenParameters* raygen = getRaygenParameters();
     const LidarParameters& lidar = raygen->specific.lidar;
 
     const uint3 idx = optixGetLaunchIndex();
@@ -50,13 +78,13 @@ extern "C" __global__ void __raygen__lidar_single() {
     pointer_as_ints(&prd_lidar, opt1, opt2);
     unsigned int raytype = (unsigned int)LIDAR_RAY_TYPE;
     optixTrace(params.root, ray_origin, ray_direction, lidar.clip_near, 1.5 * lidar.max_distance, t_traverse,
-               OptixVisibilityMask(1), OPTIX_RAY_FLAG_NONE, 0, 1, 0, opt1, opt2, raytype);
+               OptixVisibilityMask(RANGE_VISIBILITY_MASK), OPTIX_RAY_FLAG_NONE, 0, 1, 0, opt1, opt2, raytype);
 
     lidar.frame_buffer[image_index] = make_float2(prd_lidar.range, prd_lidar.intensity);
 }
 
 extern "C" __global__ void __raygen__lidar_multi() {
-    const RaygenParameters* raygen = (RaygenParameters*)optixGetSbtDataPointer();
+    const RaygenParameters* raygen = getRaygenParameters();
     const LidarParameters& lidar = raygen->specific.lidar;
 
     const uint3 idx = optixGetLaunchIndex();
@@ -84,32 +112,11 @@ extern "C" __global__ void __raygen__lidar_multi() {
                                          make_float2(1.f);  //[-1,1]
 
     // relative theta and phi for local ray in beam
-    float local_ray_theta;
-    float local_ray_phi;
-
-    // beam shape is rectangular
-    if (lidar.beam_shape == LidarBeamShape::ELLIPTICAL) {
-        local_ray_theta = local_ray_id_fraction.x * lidar.horiz_div_angle / 2.0;
-        local_ray_phi = local_ray_id_fraction.y * lidar.vert_div_angle / 2.0;
-        // beam shape is elliptical
-    } else {  // defaulting to rectangular
-        float angle = atan2(local_ray_id_fraction.y, local_ray_id_fraction.x);
-        float ring = max(abs(local_ray_id_fraction.x), abs(local_ray_id_fraction.y));
-        float2 axis = make_float2(lidar.vert_div_angle / 2.0 * ring, lidar.horiz_div_angle / 2.0 * ring);
-        float radius;
-        if (axis.y == 0 && axis.x == 0) {
-            radius = 0;
-        } else {
-            radius = (axis.x * axis.y) /
-                     sqrtf(axis.x * axis.x * sinf(angle) * sinf(angle) + axis.y * axis.y * cosf(angle) * cosf(angle));
-        }
-        local_ray_theta = radius * sinf(angle);
-        local_ray_phi = radius * cosf(angle);
-    }
+    const float2 local_ray_angles = beam_sample_angles(lidar, local_ray_id_fraction);
 
     // carry on ray-tracing per ray
-    const float theta = beam_theta + local_ray_theta;
-    const float phi = beam_phi + local_ray_phi;
+    const float theta = beam_theta + local_ray_angles.x;
+    const float phi = beam_phi + local_ray_angles.y;
 
     const float xy_proj = cosf(phi);
     const float z = sinf(phi);
@@ -132,7 +139,175 @@ extern "C" __global__ void __raygen__lidar_multi() {
     pointer_as_ints(&prd_lidar, opt1, opt2);
     unsigned int raytype = (unsigned int)LIDAR_RAY_TYPE;
     optixTrace(params.root, ray_origin, ray_direction, lidar.clip_near, 1.5 * lidar.max_distance, t_traverse,
-               OptixVisibilityMask(1), OPTIX_RAY_FLAG_NONE, 0, 1, 0, opt1, opt2, raytype);
+               OptixVisibilityMask(RANGE_VISIBILITY_MASK), OPTIX_RAY_FLAG_NONE, 0, 1, 0, opt1, opt2, raytype);
 
     lidar.frame_buffer[image_index] = make_float2(prd_lidar.range, prd_lidar.intensity);
-}
\ No newline at end of file
+}
+
+// trace sample (i,j) of a beam with d x d samples, returning its range and intensity
+static __device__ __inline__ float2 trace_beam_sample(const LidarParameters& lidar,
+                                                      float beam_theta,
+                                                      float beam_phi,
+                                                      int i,
+                                                      int j,
+                                                      int d,
+                                                      float3 ray_origin,
+                                                      float3 forward,
+                                                      float3 left,
+                                                      float3 up,
+                                                      float t_traverse) {
+    const float2 local_ray_id_fraction =
+        (make_float2(i, j) + make_float2(0.5, 0.5)) / (float)d * 2.f - make_float2(1.f);  //[-1,1]
+    const float2 local_ray_angles = beam_sample_angles(lidar, local_ray_id_fraction);
+    const float theta = beam_theta + local_ray_angles.x;
+    const float phi = beam_phi + local_ray_angles.y;
+
+    const float xy_proj = cosf(phi);
+    const float z = sinf(phi);
+    const float y = xy_proj * sinf(theta);
+    const float x = xy_proj * cosf(theta);
+    float3 ray_direction = normalize(forward * x + left * y + up * z);
+
+    PerRayData_lidar prd_lidar = default_lidar_prd();
+    unsigned int opt1;
+    unsigned int opt2;
+    pointer_as_ints(&prd_lidar, opt1, opt2);
+    unsigned int raytype = (unsigned int)LIDAR_RAY_TYPE;
+    optixTrace(params.root, ray_origin, ray_direction, lidar.clip_near, 1.5 * lidar.max_distance, t_traverse,
+               OptixVisibilityMask(RANGE_VISIBILITY_MASK), OPTIX_RAY_FLAG_NONE, 0, 1, 0, opt1, opt2, raytype);
+    return make_float2(prd_lidar.range, prd_lidar.intensity);
+}
+
+// clip and add noise to a reduced return, as done by the intensity clip and noise filters
+static __device__ __inline__ float2 process_return(const LidarParameters& lidar, float2 ret, curandState_t* rng) {
+    if (ret.y < lidar.clip_intensity) {
+        ret.x = lidar.clip_default_dist;
+        ret.y = 0.f;
+    } else if (rng && ret.y > 1e-6) {
+        ret.x += curand_normal(rng) * lidar.stdev_range;
+        ret.y = fmaxf(0.f, ret.y + curand_normal(rng) * lidar.stdev_intensity);
+    }
+    return ret;
+}
+
+// Lidar with one thread per beam. Each beam first traces its center and corner samples, and traces all its samples
+// only if these probes straddle a depth discontinuity. The samples are then reduced to the lidar return(s) as in
+// ChFilterLidarReduce (with the beam fraction of a sample estimated from the traced samples), and the returns are
+// clipped and noised in the same pass, as in ChFilterLidarIntensityClip and ChFilterLidarNoiseXYZI.
+extern "C" __global__ void __raygen__lidar_adaptive() {
+    const RaygenParameters* raygen = getRaygenParameters();
+    const LidarParameters& lidar = raygen->specific.lidar;
+
+    const uint3 idx = optixGetLaunchIndex();
+    const uint3 screen = optixGetLaunchDimensions();
+    const unsigned int image_index = screen.x * idx.y + idx.x;
+
+    const int d = lidar.sample_radius * 2 - 1;
+    const int c = lidar.sample_radius - 1;  // index of the center sample
+
+    float beam_phi = (idx.y / (float)(max(1, screen.y - 1))) * (lidar.max_vert_angle - lidar.min_vert_angle) +
+                     lidar.min_vert_angle;
+    float beam_theta = (idx.x / (float)(max(1, screen.x - 1))) * lidar.hFOV - lidar.hFOV / 2.;
+
+    const float t_frac = idx.x / (float)screen.x;
+    const float t_traverse = raygen->t0 + t_frac * (raygen->t1 - raygen->t0);  // simulation time when ray is sent
+    const float3 ray_origin = lerp(raygen->pos0, raygen->pos1, t_frac);
+    const float4 ray_quat = nlerp(raygen->rot0, raygen->rot1, t_frac);
+    float3 forward;
+    float3 left;
+    float3 up;
+    basis_from_quaternion(ray_quat, forward, left, up);
+
+    const int max_d = LIDAR_MAX_ADAPTIVE_SAMPLE_RADIUS * 2 - 1;
+    float range[max_d * max_d];
+    float intensity[max_d * max_d];
+    int n = 0;
+
+    // probe samples: center and corners of the beam
+    const int probes[5][2] = {{c, c}, {0, 0}, {d - 1, 0}, {0, d - 1}, {d - 1, d - 1}};
+    const int num_probes = d > 1 ? 5 : 1;
+    float min_range = 1e10f;
+    float max_range = 0.f;
+    int num_hits = 0;
+    for (int p = 0; p < num_probes; p++) {
+        float2 sample = trace_beam_sample(lidar, beam_theta, beam_phi, probes[p][0], probes[p][1], d, ray_origin,
+                                          forward, left, up, t_traverse);
+        range[n] = sample.x;
+        intensity[n] = sample.y;
+        n++;
+        if (sample.y > 0) {
+            num_hits++;
+            min_range = fminf(min_range, sample.x);
+            max_range = fmaxf(max_range, sample.x);
+        }
+    }
+
+    // the beam straddles a discontinuity if only some probes hit, or if their ranges differ too much
+    bool discontinuity =
+        num_hits > 0 && (num_hits < num_probes || max_range - min_range > lidar.discontinuity_threshold);
+    if (discontinuity) {
+        for (int j = 0; j < d; j++) {
+            for (int i = 0; i < d; i++) {
+                bool is_probe = (i == c && j == c) || ((i == 0 || i == d - 1) && (j == 0 || j == d - 1));
+                if (is_probe)
+                    continue;
+                float2 sample =
+                    trace_beam_sample(lidar, beam_theta, beam_phi, i, j, d, ray_origin, forward, left, up, t_traverse);
+                range[n] = sample.x;
+                intensity[n] = sample.y;
+                n++;
+            }
+        }
+    }
+
+    // reduce the samples, following the kernels of ChFilterLidarReduce
+    const float kernel_radius = .05f;  // 10 cm total kernel width
+    float2 strongest = make_float2(0.f, 0.f);
+    float2 shortest = make_float2(1e10f, 0.f);
+    float sum_range = 0.f;
+    float sum_intensity = 0.f;
+    int n_contributing = 0;
+    for (int k = 0; k < n; k++) {
+        sum_intensity += intensity[k];
+        if (intensity[k] > 1e-6) {
+            sum_range += range[k];
+            n_contributing++;
+        }
+
+        if (lidar.return_mode == LidarReturnMode::MEAN_RETURN || lidar.return_mode == LidarReturnMode::LAST_RETURN)
+            continue;
+
+        float local_intensity = intensity[k];
+        for (int l = 0; l < n; l++) {
+            if (l != k && abs(range[l] - range[k]) < kernel_radius)
+                local_intensity += (kernel_radius - abs(range[l] - range[k])) / kernel_radius * intensity[l];
+        }
+        local_intensity = local_intensity / n;  // calculating portion of beam here
+
+        if (shortest.x > range[k] && intensity[k] > 0)
+            shortest = make_float2(range[k], local_intensity);
+        if (local_intensity > strongest.y)
+            strongest = make_float2(range[k], local_intensity);
+    }
+
+    curandState_t* rng = lidar.rng_buffer ? &lidar.rng_buffer[image_index] : nullptr;
+    switch (lidar.return_mode) {
+        case LidarReturnMode::DUAL_RETURN:
+            lidar.frame_buffer[2 * image_index] = process_return(lidar, strongest, rng);
+            lidar.frame_buffer[2 * image_index + 1] = process_return(lidar, shortest, rng);
+            break;
+        case LidarReturnMode::STRONGEST_RETURN:
+            lidar.frame_buffer[image_index] = process_return(lidar, strongest, rng);
+            break;
+        case LidarReturnMode::FIRST_RETURN:
+            lidar.frame_buffer[image_index] = process_return(lidar, shortest, rng);
+            break;
+        default: {  // LidarReturnMode::MEAN_RETURN
+            float2 mean = make_float2(0.f, 0.f);
+            if (n_contributing > 0)
+                mean = make_float2(sum_range / n_contributing, sum_intensity / n);
+            lidar.frame_buffer[image_index] = process_return(lidar, mean, rng);
+            break;
+        }
+    }
+}
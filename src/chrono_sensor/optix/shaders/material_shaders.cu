@@ -1095,7 +1095,15 @@ extern "C" __global__ void __closesthit__material_shader() {
     RayType raytype = (RayType)optixGetPayload_2();
 
     switch (raytype) {
-        case CAMERA_RAY_TYPE:
+        case CAMERA_RAY_TYPE: {
+            // record the primary hit for the additional outputs of a multi-output camera
+            PerRayData_camera* prd = getCameraPRD();
+            if (prd->depth == 2) {
+                prd->hit_dist = ray_dist;
+                prd->hit_normal = world_normal;
+                prd->class_id = mat.class_id;
+                prd->instance_id = mat.instance_id;
+            }
             // CameraShader(getCameraPRD(), mat, world_normal, uv, tangent, ray_dist, ray_orig, ray_dir,
             // mat_params->num_blended_materials);
             //printf("Use Hapke: %d | Emissive Power: %.2f | Material ID: %d\n", mat.use_hapke, mat.emissive_power, material_id);
@@ -1107,6 +1115,7 @@ extern "C" __global__ void __closesthit__material_shader() {
                             tangent, ray_dist, ray_orig, ray_dir);
             }
             break;
+        }
         case LIDAR_RAY_TYPE:
             LidarShader(getLidarPRD(), mat, world_normal, uv, tangent, ray_dist, ray_orig, ray_dir);
             break;
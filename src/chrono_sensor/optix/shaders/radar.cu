@@ -20,7 +20,7 @@
 #include "chrono_sensor/optix/ChOptixDefinitions.h"
 
 extern "C" __global__ void __raygen__radar() {
-    const RaygenParameters* raygen = (RaygenParameters*)optixGetSbtDataPointer();
+    const RaygenParameters* raygen = getRaygenParameters();
     const RadarParameters& radar = raygen->specific.radar;
 
     const uint3 idx = optixGetLaunchIndex();
@@ -52,7 +52,7 @@ extern "C" __global__ void __raygen__radar() {
     pointer_as_ints(&prd_radar, opt1, opt2);
     unsigned int raytype = (unsigned int)RADAR_RAY_TYPE;
     optixTrace(params.root, ray_origin, ray_direction, radar.clip_near, 1.5f * radar.max_distance, t_traverse,
-               OptixVisibilityMask(1), OPTIX_RAY_FLAG_NONE, 0u, 1u, 0u, opt1, opt2,raytype);
+               OptixVisibilityMask(RANGE_VISIBILITY_MASK), OPTIX_RAY_FLAG_NONE, 0u, 1u, 0u, opt1, opt2, raytype);
     
     float3 vel_global;
     // removing stationary object ray hits
@@ -40,5 +40,16 @@ CH_SENSOR_API void ChGPSSensor::ClearKeyFrames() {
     m_keyframes.clear();
 }
 
+CH_SENSOR_API void ChGPSSensor::InterpolateKeyFrames(double alpha) {
+    // the previous keyframe is kept, its time is used by the GPS update filter as the start of the noise interval
+    if (m_keyframes.size() < 2)
+        return;
+    auto& prev = m_keyframes[m_keyframes.size() - 2];
+    auto& last = m_keyframes.back();
+    float t = std::get<0>(prev) + (float)alpha * (std::get<0>(last) - std::get<0>(prev));
+    ChVector3d pos = std::get<1>(prev) + (std::get<1>(last) - std::get<1>(prev)) * alpha;
+    last = std::make_tuple(t, pos);
+}
+
 }  // namespace sensor
 }  // namespace chrono
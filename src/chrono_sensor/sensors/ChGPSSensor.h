@@ -56,6 +56,7 @@ class CH_SENSOR_API ChGPSSensor : public ChDynamicSensor {
     ~ChGPSSensor();
     virtual void PushKeyFrame();
     virtual void ClearKeyFrames();
+    virtual void InterpolateKeyFrames(double alpha);
 
     /// Get the GPS reference location
     const ChVector3d GetGPSReference() const { return m_gps_reference; }
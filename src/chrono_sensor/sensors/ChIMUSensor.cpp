@@ -19,6 +19,7 @@
 
 #include "chrono_sensor/sensors/ChIMUSensor.h"
 #include "chrono/physics/ChSystem.h"
+#include "chrono_sensor/utils/ChStateInterpolation.h"
 
 namespace chrono {
 namespace sensor {
@@ -40,6 +41,9 @@ CH_SENSOR_API void ChAccelerometerSensor::PushKeyFrame() {
 CH_SENSOR_API void ChAccelerometerSensor::ClearKeyFrames() {
     m_keyframes.clear();
 }
+CH_SENSOR_API void ChAccelerometerSensor::InterpolateKeyFrames(double alpha) {
+    MergeLastKeyFrames(m_keyframes, alpha);
+}
 
 CH_SENSOR_API ChGyroscopeSensor::ChGyroscopeSensor(std::shared_ptr<chrono::ChBody> parent,
                                                    float updateRate,
@@ -55,6 +59,9 @@ CH_SENSOR_API void ChGyroscopeSensor::PushKeyFrame() {
 CH_SENSOR_API void ChGyroscopeSensor::ClearKeyFrames() {
     m_keyframes.clear();
 }
+CH_SENSOR_API void ChGyroscopeSensor::InterpolateKeyFrames(double alpha) {
+    MergeLastKeyFrames(m_keyframes, alpha);
+}
 
 CH_SENSOR_API ChMagnetometerSensor::ChMagnetometerSensor(std::shared_ptr<chrono::ChBody> parent,
                                                          float updateRate,
@@ -72,6 +79,13 @@ CH_SENSOR_API void ChMagnetometerSensor::PushKeyFrame() {
 CH_SENSOR_API void ChMagnetometerSensor::ClearKeyFrames() {
     m_keyframes.clear();
 }
+CH_SENSOR_API void ChMagnetometerSensor::InterpolateKeyFrames(double alpha) {
+    if (m_keyframes.size() < 2)
+        return;
+    ChFrame<double> last = m_keyframes.back();
+    m_keyframes.pop_back();
+    m_keyframes.back() = InterpolateFrame(m_keyframes.back(), last, alpha);
+}
 
 }  // namespace sensor
 }  // namespace chrono
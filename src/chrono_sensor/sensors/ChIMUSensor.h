@@ -49,6 +49,7 @@ class CH_SENSOR_API ChAccelerometerSensor : public ChDynamicSensor {
     ~ChAccelerometerSensor() {}
     virtual void PushKeyFrame();
     virtual void ClearKeyFrames();
+    virtual void InterpolateKeyFrames(double alpha);
 
   private:
     std::vector<ChVector3d> m_keyframes;  ///< stores keyframes for sensor
@@ -75,6 +76,7 @@ class CH_SENSOR_API ChGyroscopeSensor : public ChDynamicSensor {
 
     virtual void PushKeyFrame();
     virtual void ClearKeyFrames();
+    virtual void InterpolateKeyFrames(double alpha);
 
   private:
     std::vector<ChVector3d> m_keyframes;  ///< stores keyframes for sensor
@@ -103,6 +105,7 @@ class CH_SENSOR_API ChMagnetometerSensor : public ChDynamicSensor {
     ~ChMagnetometerSensor() {}
     virtual void PushKeyFrame();
     virtual void ClearKeyFrames();
+    virtual void InterpolateKeyFrames(double alpha);
 
     /// Get the GPS reference location
     const ChVector3d GetGPSReference() const { return m_gps_reference; }
@@ -16,6 +16,8 @@
 //
 // =============================================================================
 
+#include <stdexcept>
+
 #include "chrono_sensor/sensors/ChLidarSensor.h"
 #include "chrono_sensor/filters/ChFilterLidarReduce.h"
 #include "chrono_sensor/optix/ChFilterOptixRender.h"
@@ -41,7 +43,8 @@ CH_SENSOR_API ChLidarSensor::ChLidarSensor(
     float vert_divergence_angle,  // vertical divergence angle of the beam
     float hori_divergence_angle,  // horizontal divergence angle of the beam
     LidarReturnMode return_mode,  // return mode of the lidar
-    float clip_near  // minimum return distance, for making nearby objects transparent when placed inside housing
+    float clip_near,  // minimum return distance, for making nearby objects transparent when placed inside housing
+    bool adaptive_sampling  // sample the beams adaptively and reduce them in the launch
     )
     : m_sample_radius(sample_radius),
       m_vert_divergence_angle(vert_divergence_angle),
@@ -53,8 +56,18 @@ CH_SENSOR_API ChLidarSensor::ChLidarSensor(
       m_max_distance(max_distance),
       m_clip_near(clip_near),
       m_beam_shape(beam_shape),
-      ChOptixSensor(parent, updateRate, offsetPose, w * (2 * sample_radius - 1), h * (2 * sample_radius - 1)) {
-    if (sample_radius > 1) {
+      m_adaptive_sampling(adaptive_sampling),
+      ChOptixSensor(parent,
+                    updateRate,
+                    offsetPose,
+                    adaptive_sampling ? w : w * (2 * sample_radius - 1),
+                    adaptive_sampling ? h : h * (2 * sample_radius - 1)) {
+    if (adaptive_sampling) {
+        // the beams are reduced in the ray generation program, so the sensor dimensions are the beam dimensions
+        if (sample_radius > LIDAR_MAX_ADAPTIVE_SAMPLE_RADIUS)
+            throw std::invalid_argument("Lidar sample radius too large for adaptive sampling");
+        m_pipeline_type = PipelineType::LIDAR_ADAPTIVE;
+    } else if (sample_radius > 1) {
         m_pipeline_type = PipelineType::LIDAR_MULTI;
         PushFilter(chrono_types::make_shared<ChFilterLidarReduce>(return_mode, sample_radius, "lidar reduction"));
     } else {  // default to single ray sampled lidar
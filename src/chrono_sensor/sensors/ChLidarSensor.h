@@ -27,16 +27,6 @@ namespace sensor {
 /// @addtogroup sensor_sensors
 /// @{
 
-/// Lidar return mode when multiple objects are seen. Currently supported: strongest return (default), and mean return
-/// which averages all returned intensity and distance measurement data
-enum class LidarReturnMode {
-    STRONGEST_RETURN,  ///< range at peak intensity
-    MEAN_RETURN,       ///< average beam range
-    FIRST_RETURN,      ///< shortest beam range
-    LAST_RETURN,       ///< longest beam range
-    DUAL_RETURN        ///< first and strongest returns
-};
-
 /// Lidar class. This corresponds to a scanning lidar.
 class CH_SENSOR_API ChLidarSensor : public ChOptixSensor {
   public:
@@ -57,6 +47,8 @@ class CH_SENSOR_API ChLidarSensor : public ChOptixSensor {
     /// @param return_mode The return mode for lidar data when multiple objects are visible
     /// @param clip_near Near clipping distance so that lidar sensor can be easily placed inside a visualization object
     /// (sensor housing)
+    /// @param adaptive_sampling Whether the beams are sampled adaptively and reduced during the ray tracing launch (see
+    /// SetDiscontinuityThreshold). The full beams are then never stored and no ChFilterLidarReduce is needed.
 
     ChLidarSensor(std::shared_ptr<chrono::ChBody> parent,
                   float updateRate,
@@ -72,7 +64,8 @@ class CH_SENSOR_API ChLidarSensor : public ChOptixSensor {
                   float vert_divergence_angle = .003f,
                   float hori_divergence_angle = .003f,
                   LidarReturnMode return_mode = LidarReturnMode::MEAN_RETURN,
-                  float clip_near = 1e-3f);
+                  float clip_near = 1e-3f,
+                  bool adaptive_sampling = false);
 
     /// Class destructor
     ~ChLidarSensor();
@@ -114,6 +107,54 @@ class CH_SENSOR_API ChLidarSensor : public ChOptixSensor {
     /// @return the vertical beam divergence angle
     float GetVertDivAngle() const { return m_vert_divergence_angle; }
 
+    /// Returns the lidar return mode
+    /// @return the return mode
+    LidarReturnMode GetReturnMode() const { return m_return_mode; }
+
+    /// Returns true if the beams are sampled adaptively
+    /// @return whether adaptive sampling is used
+    bool GetAdaptiveSampling() const { return m_adaptive_sampling; }
+
+    /// Set the range difference above which a beam is considered to cover a depth discontinuity (adaptive sampling
+    /// only, default 0.05 m). Each beam first traces its center and corner samples, and traces all its samples only if
+    /// the ranges of these probes differ by more than this threshold, or if only some of them hit an object.
+    /// @param threshold the range difference threshold
+    void SetDiscontinuityThreshold(float threshold) { m_discontinuity_threshold = threshold; }
+
+    /// Returns the discontinuity threshold of the adaptive sampling
+    /// @return the discontinuity threshold
+    float GetDiscontinuityThreshold() const { return m_discontinuity_threshold; }
+
+    /// Clear the returns below an intensity threshold in the ray tracing launch (adaptive sampling only), as done by
+    /// ChFilterLidarIntensityClip. Disabled by default.
+    /// @param intensity_thresh the intensity below which returns are cleared
+    /// @param default_value the range given to the cleared returns
+    void SetIntensityClip(float intensity_thresh, float default_value) {
+        m_clip_intensity = intensity_thresh;
+        m_clip_default_dist = default_value;
+    }
+
+    /// Returns the intensity threshold of the returns cleared in the ray tracing launch
+    float GetClipIntensity() const { return m_clip_intensity; }
+
+    /// Returns the range given to the returns cleared in the ray tracing launch
+    float GetClipDefaultDist() const { return m_clip_default_dist; }
+
+    /// Add normal noise to the range and intensity of the returns in the ray tracing launch (adaptive sampling only).
+    /// The noise on the beam angles is still applied by ChFilterLidarNoiseXYZI. Disabled by default.
+    /// @param stdev_range standard deviation of the noise applied to the range
+    /// @param stdev_intensity standard deviation of the noise applied to the intensity
+    void SetReturnNoise(float stdev_range, float stdev_intensity) {
+        m_stdev_range = stdev_range;
+        m_stdev_intensity = stdev_intensity;
+    }
+
+    /// Returns the standard deviation of the range noise applied in the ray tracing launch
+    float GetStdevRange() const { return m_stdev_range; }
+
+    /// Returns the standard deviation of the intensity noise applied in the ray tracing launch
+    float GetStdevIntensity() const { return m_stdev_intensity; }
+
     bool DualReturnFlag() const {
         switch (m_return_mode) {
             case LidarReturnMode::DUAL_RETURN:
@@ -134,6 +175,14 @@ class CH_SENSOR_API ChLidarSensor : public ChOptixSensor {
     float m_hori_divergence_angle;  ///< horizontal divergence angle of the beam
     LidarReturnMode m_return_mode;  ///< return mode of the lidar
     float m_clip_near;              ///< near clipping distance so that lidar sensor housings can be transparent to self
+
+    // adaptive sampling and processing of the beams in the ray tracing launch
+    bool m_adaptive_sampling;                 ///< whether the beams are sampled adaptively and reduced in the launch
+    float m_discontinuity_threshold = 0.05f;  ///< range difference that triggers tracing all samples of a beam
+    float m_clip_intensity = 0.f;             ///< returns weaker than this are cleared in the launch
+    float m_clip_default_dist = 0.f;          ///< range of the returns cleared in the launch
+    float m_stdev_range = 0.f;                ///< standard deviation of the range noise added in the launch
+    float m_stdev_intensity = 0.f;            ///< standard deviation of the intensity noise added in the launch
 };
 
 /// @} sensor_sensors
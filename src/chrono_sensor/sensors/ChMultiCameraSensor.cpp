@@ -0,0 +1,107 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Camera sensor generating color, depth, segmentation, and normal images from
+// the same primary rays, in a single launch.
+//
+// =============================================================================
+
+#include <iostream>
+
+#include "chrono_sensor/sensors/ChMultiCameraSensor.h"
+
+namespace chrono {
+namespace sensor {
+
+// -----------------------------------------------------------------------------
+// Constructor
+// -----------------------------------------------------------------------------
+CH_SENSOR_API ChMultiCameraSensor::ChMultiCameraSensor(std::shared_ptr<chrono::ChBody> parent,
+                                                       float updateRate,
+                                                       chrono::ChFrame<double> offsetPose,
+                                                       unsigned int w,                  // image width
+                                                       unsigned int h,                  // image height
+                                                       float hFOV,                      // horizontal field of view
+                                                       CameraLensModelType lens_model,  // lens model to use
+                                                       bool use_gi,     // 1 to use Global Illumination
+                                                       float gamma,     // 1 for linear color space, 2.2 for sRGB
+                                                       bool use_fog)    // whether to use fog on this camera
+    : ChCameraSensor(parent, updateRate, offsetPose, w, h, hFOV, 1, lens_model, use_gi, gamma, use_fog),
+      m_maxDepth(1000.f) {
+    m_pipeline_type = PipelineType::MULTI_CAMERA;
+
+    // the render filter is placed in front of this filter when the sensor is added to the manager
+    m_filters.push_front(chrono_types::make_shared<OutputFilter>(this));
+}
+
+// -----------------------------------------------------------------------------
+// Destructor
+// -----------------------------------------------------------------------------
+CH_SENSOR_API ChMultiCameraSensor::~ChMultiCameraSensor() {}
+
+CH_SENSOR_API void ChMultiCameraSensor::EnableOutput(Output output, bool val) {
+    if (m_filter_list_locked) {
+        std::cerr << "WARNING: Filter list has been locked for safety. All outputs should be enabled before sensor is "
+                     "added to ChSensorManager\n";
+        return;
+    }
+    m_outputs[(int)output].enabled = val;
+}
+
+CH_SENSOR_API void ChMultiCameraSensor::PushOutputFilter(Output output, std::shared_ptr<ChFilter> filter) {
+    if (m_filter_list_locked) {
+        std::cerr << "WARNING: Filter list has been locked for safety. All filters should be added to "
+                     "sensor before sensor is added to ChSensorManager\n";
+        return;
+    }
+    m_outputs[(int)output].enabled = true;
+    m_outputs[(int)output].filters.push_back(filter);
+}
+
+// -----------------------------------------------------------------------------
+// Filter applying the filter lists of the additional outputs
+// -----------------------------------------------------------------------------
+void ChMultiCameraSensor::OutputFilter::Initialize(std::shared_ptr<ChSensor> pSensor,
+                                                   std::shared_ptr<SensorBuffer>& bufferInOut) {
+    if (!bufferInOut)
+        InvalidFilterGraphNullBuffer(pSensor);
+
+    // the color buffer is passed through unchanged
+    m_buffer_in = bufferInOut;
+
+    // the device buffers of the enabled outputs were created by the render filter
+    for (auto& output : m_sensor->m_outputs) {
+        if (!output.enabled)
+            continue;
+        std::shared_ptr<SensorBuffer> buffer = output.buffer;
+        if (!buffer)
+            InvalidFilterGraphNullBuffer(pSensor);
+        for (auto& filter : output.filters)
+            filter->Initialize(pSensor, buffer);
+    }
+}
+
+void ChMultiCameraSensor::OutputFilter::Apply() {
+    for (auto& output : m_sensor->m_outputs) {
+        if (!output.enabled)
+            continue;
+        output.buffer->LaunchedCount = m_buffer_in->LaunchedCount;
+        output.buffer->TimeStamp = m_buffer_in->TimeStamp;
+        for (auto& filter : output.filters)
+            filter->Apply();
+    }
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,146 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Camera sensor generating color, depth, segmentation, and normal images from
+// the same primary rays, in a single launch.
+//
+// =============================================================================
+
+#ifndef CHMULTICAMERASENSOR_H
+#define CHMULTICAMERASENSOR_H
+
+#include <array>
+#include <list>
+#include <stdexcept>
+
+#include "chrono_sensor/sensors/ChCameraSensor.h"
+#include "chrono_sensor/filters/ChFilter.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_sensors
+/// @{
+
+/// Camera sensor with multiple outputs rendered from the same primary rays.
+/// The color image is processed by the usual sensor filter list. Each additional output (depth, class and instance
+/// ids, screen-space normals) is written to its own device buffer during the same launch and is processed by its own
+/// filter list. This replaces a ChCameraSensor, a ChDepthCamera, and a ChSegmentationCamera mounted at the same pose,
+/// each requiring its own launch and scene traversal. Supersampling is not supported.
+class CH_SENSOR_API ChMultiCameraSensor : public ChCameraSensor {
+  public:
+    /// Additional outputs of the camera.
+    enum class Output {
+        DEPTH,         ///< distance to the first hit, clamped at the maximum depth (PixelDepth)
+        SEGMENTATION,  ///< class and instance ids of the first hit (PixelSemantic)
+        NORMALS        ///< screen-space normal at the first hit, w=1 on hit and 0 otherwise (PixelFloat4)
+    };
+
+    /// @brief Constructor for a multi-output camera
+    /// @param parent A shared pointer to a body on which the sensor should be attached.
+    /// @param updateRate The desired update rate of the sensor in Hz.
+    /// @param offsetPose The desired relative position and orientation of the sensor on the body.
+    /// @param w The width of the image the camera should generate.
+    /// @param h The height of the image the camera should generate.
+    /// @param hFOV The horizontal field of view of the camera lens.
+    /// @param lens_model A enum specifying the desired lens model.
+    /// @param use_gi Enable the global illumination for the color output
+    /// @param gamma correction of the color output, 1 for linear color space, 2.2 for sRGB
+    /// @param use_fog whether to use fog on the color output
+    ChMultiCameraSensor(std::shared_ptr<chrono::ChBody> parent,  // object to which the sensor is attached
+                        float updateRate,                        // rate at which the sensor updates
+                        chrono::ChFrame<double> offsetPose,      // position of sensor relative to parent object
+                        unsigned int w,                          // image width
+                        unsigned int h,                          // image height
+                        float hFOV,                              // horizontal field of view
+                        CameraLensModelType lens_model = CameraLensModelType::PINHOLE,
+                        bool use_gi = false,   // camera model to use for rendering
+                        float gamma = 2.2,     // gamma correction value
+                        bool use_fog = true);  // whether to use fog
+
+    /// camera class destructor
+    ~ChMultiCameraSensor();
+
+    /// Enable or disable one of the additional outputs. Disabled outputs are not written during the launch.
+    /// Outputs must be enabled before the sensor is added to the sensor manager.
+    void EnableOutput(Output output, bool val = true);
+
+    /// returns whether the given output is enabled
+    bool IsOutputEnabled(Output output) const { return m_outputs[(int)output].enabled; }
+
+    /// set the maximum value of the depth output
+    /// @param maxDepth The maximum depth value (meters)
+    void SetMaxDepth(float maxDepth) { m_maxDepth = maxDepth; }
+
+    /// returns the maximum value of the depth output
+    float GetMaxDepth() const { return m_maxDepth; }
+
+    /// Add a filter to the end of the filter list of an additional output. This enables the output.
+    /// @param output The output processed by the filter.
+    /// @param filter A shared pointer to the filter.
+    void PushOutputFilter(Output output, std::shared_ptr<ChFilter> filter);
+
+    /// returns the filter list of an additional output
+    const std::list<std::shared_ptr<ChFilter>>& GetOutputFilterList(Output output) const {
+        return m_outputs[(int)output].filters;
+    }
+
+    /// Return the most recent buffer of an additional output, as made available by the last filter of type FilterType
+    /// in its filter list (e.g., GetMostRecentOutputBuffer<UserDepthBufferPtr, ChFilterDepthAccess>(Output::DEPTH)).
+    template <class UserBufferType, class FilterType>
+    UserBufferType GetMostRecentOutputBuffer(Output output);
+
+  private:
+    /// Filter applying the filter lists of the additional outputs. This filter is placed right after the render filter
+    /// in the sensor filter list and passes the color buffer through unchanged.
+    class OutputFilter : public ChFilter {
+      public:
+        OutputFilter(ChMultiCameraSensor* sensor) : ChFilter("MultiCameraOutputs"), m_sensor(sensor) {}
+        virtual void Apply() override;
+        virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut) override;
+
+      private:
+        ChMultiCameraSensor* m_sensor;
+        std::shared_ptr<SensorBuffer> m_buffer_in;
+    };
+
+    struct OutputData {
+        bool enabled = false;
+        std::list<std::shared_ptr<ChFilter>> filters;  ///< filter list applied to this output
+        std::shared_ptr<SensorBuffer> buffer;          ///< device buffer written during the launch
+    };
+
+    float m_maxDepth;                     ///< maximum value of the depth output
+    std::array<OutputData, 3> m_outputs;  ///< additional outputs
+
+    friend class ChFilterOptixRender;
+};
+
+template <class UserBufferType, class FilterType>
+UserBufferType ChMultiCameraSensor::GetMostRecentOutputBuffer(Output output) {
+    const auto& filters = m_outputs[(int)output].filters;
+    for (auto it = filters.rbegin(); it != filters.rend(); ++it) {
+        if (auto filter = std::dynamic_pointer_cast<FilterType>(*it))
+            return filter->GetBuffer();
+    }
+    throw std::runtime_error(
+        "Cannot return output buffer: output filter list does not contain an entry of the requested type");
+}
+
+/// @} sensor_sensors
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
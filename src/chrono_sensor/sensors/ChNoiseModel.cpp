@@ -15,20 +15,48 @@
 // =============================================================================
 #include "chrono_sensor/sensors/ChNoiseModel.h"
 #include <chrono>
+#include <cmath>
+
+#include "chrono/utils/ChConstants.h"
 
 namespace chrono {
 namespace sensor {
 
+double ChNoiseModel::StandardNormal(std::minstd_rand& generator) {
+    if (m_normal_next == NORMAL_BLOCK) {
+        // uniform samples in (0,1) (minstd_rand returns values in [1, modulus-1])
+        double u[NORMAL_BLOCK];
+        for (int i = 0; i < NORMAL_BLOCK; i++)
+            u[i] = (double)generator() / (double)std::minstd_rand::modulus;
+
+        // Box-Muller transform of pairs of uniform samples
+        const int half = NORMAL_BLOCK / 2;
+        for (int i = 0; i < half; i++) {
+            double r = std::sqrt(-2 * std::log(u[i]));
+            double theta = 2 * CH_PI * u[half + i];
+            m_normal[i] = r * std::cos(theta);
+            m_normal[half + i] = r * std::sin(theta);
+        }
+        m_normal_next = 0;
+    }
+    return m_normal[m_normal_next++];
+}
+
+ChVector3d ChNoiseModel::Normal(std::minstd_rand& generator, const ChVector3d& mean, const ChVector3d& stdev) {
+    double x = StandardNormal(generator);
+    double y = StandardNormal(generator);
+    double z = StandardNormal(generator);
+    return ChVector3d(mean.x() + stdev.x() * x, mean.y() + stdev.y() * y, mean.z() + stdev.z() * z);
+}
+
 ChNoiseNormal::ChNoiseNormal(ChVector3d mean, ChVector3d stdev) : m_mean(mean), m_stdev(stdev), ChNoiseModel() {
     m_generator =
         std::minstd_rand((unsigned int)(std::chrono::high_resolution_clock::now().time_since_epoch().count()));
 }
 
 void ChNoiseNormal::AddNoise(ChVector3d& data) {
-    std::normal_distribution<double> dist_x(m_mean.x(), m_stdev.x());
-    std::normal_distribution<double> dist_y(m_mean.y(), m_stdev.y());
-    std::normal_distribution<double> dist_z(m_mean.z(), m_stdev.z());
-    data += ChVector3d(dist_x(m_generator), dist_y(m_generator), dist_z(m_generator));
+    std::lock_guard<std::mutex> lock(m_mutex);
+    data += Normal(m_generator, m_mean, m_stdev);
 }
 
 void ChNoiseNormal::AddNoise(ChVector3d& data, float last_ch_time, float ch_time) {
@@ -52,15 +80,13 @@ ChNoiseNormalDrift::ChNoiseNormalDrift(double updateRate,
 }
 
 void ChNoiseNormalDrift::AddNoise(ChVector3d& data) {
-    std::normal_distribution<double> dist_a_x(m_mean.x(), m_stdev.x());
-    std::normal_distribution<double> dist_a_y(m_mean.y(), m_stdev.y());
-    std::normal_distribution<double> dist_a_z(m_mean.z(), m_stdev.z());
-    ChVector3d eta_a = {dist_a_x(m_generator), dist_a_y(m_generator), dist_a_z(m_generator)};
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ChVector3d eta_a = Normal(m_generator, m_mean, m_stdev);
 
     ChVector3d eta_b = {0, 0, 0};
     if (m_tau_drift > std::numeric_limits<double>::epsilon() && m_drift_bias > std::numeric_limits<double>::epsilon()) {
-        std::normal_distribution<double> dist_b(0.0, m_drift_bias * sqrt(1 / (m_updateRate * m_tau_drift)));
-        eta_b = {dist_b(m_generator), dist_b(m_generator), dist_b(m_generator)};
+        double sigma_b = m_drift_bias * sqrt(1 / (m_updateRate * m_tau_drift));
+        eta_b = Normal(m_generator, ChVector3d(0, 0, 0), ChVector3d(sigma_b, sigma_b, sigma_b));
     }
     m_bias_prev += eta_b;
     data += eta_a + m_bias_prev;
@@ -111,6 +137,7 @@ ChNoiseRandomWalks::ChNoiseRandomWalks(float mean,
 }
 
 void ChNoiseRandomWalks::AddNoise(ChVector3d& data, float last_ch_time, float next_ch_time) {
+    std::lock_guard<std::mutex> lock(m_mutex);
 
     double curr_time = m_last_updated_ch_time;
 
@@ -135,11 +162,7 @@ void ChNoiseRandomWalks::AddNoise(ChVector3d& data, float last_ch_time, float ne
         c_z = m_sigma * 0.2 * c_z;
 
         // Generate white noise
-        std::normal_distribution<double> dist_x(c_x, m_sigma);
-        std::normal_distribution<double> dist_y(c_y, m_sigma);
-        std::normal_distribution<double> dist_z(c_z, m_sigma);
-
-        ChVector3d white_noise = {dist_x(m_generator), dist_y(m_generator), dist_z(m_generator)};
+        ChVector3d white_noise = Normal(m_generator, ChVector3d(c_x, c_y, c_z), ChVector3d(m_sigma, m_sigma, m_sigma));
 
         // Limit all axis of white noise to m_max_acceleration
         white_noise.x() = (white_noise.x() > m_max_acceleration) ? m_max_acceleration : white_noise.x();
@@ -18,6 +18,7 @@
 #define CHNOISEMODEL_H
 #include "chrono_sensor/ChApiSensor.h"
 #include "chrono/core/ChVector3.h"
+#include <mutex>
 #include <random>
 
 namespace chrono {
@@ -26,19 +27,39 @@ namespace sensor {
 /// @addtogroup sensor_sensors
 /// @{
 
-/// Noise model base class
+/// Noise model base class. Noise models may be shared by several sensors and are safe to use from concurrent sensor
+/// updates (see ChDynamicsManager::SetParallelUpdates).
 class CH_SENSOR_API ChNoiseModel {
   public:
     /// Class constructor
-    ChNoiseModel() {}
+    ChNoiseModel() : m_normal_next(NORMAL_BLOCK) {}
     /// Class destructor
-    ~ChNoiseModel() {}
+    virtual ~ChNoiseModel() {}
 
     /// Function for adding noise to data
     /// @param data data to augment
     virtual void AddNoise(ChVector3d& data) = 0;
     virtual void AddNoise(ChVector3d& data, float last_ch_time, float ch_time) = 0;
     // virtual void AddNoise(chrono::ChVector3f& gyro, chrono::ChVector3f& acc) = 0;
+
+  protected:
+    /// Return a sample of the standard normal distribution. Samples are generated in blocks, with a Box-Muller
+    /// transform of arrays of uniform samples which the compiler can vectorize, rather than one at a time.
+    /// @param generator random number generator used to refill the block of samples
+    double StandardNormal(std::minstd_rand& generator);
+
+    /// Return a vector of 3 independent samples of the normal distribution with given mean and standard deviation
+    /// @param generator random number generator used to refill the block of samples
+    /// @param mean The mean of the normal distribution
+    /// @param stdev The standard deviation of the normal distribution
+    ChVector3d Normal(std::minstd_rand& generator, const ChVector3d& mean, const ChVector3d& stdev);
+
+    std::mutex m_mutex;  ///< guard for the noise model state, for concurrent sensor updates
+
+  private:
+    static const int NORMAL_BLOCK = 64;  ///< number of normal samples generated at once
+    double m_normal[NORMAL_BLOCK];       ///< block of standard normal samples
+    int m_normal_next;                   ///< index of the next unused sample in the block
 };  // class ChNoiseModel
 
 /// Noise model: no noise
@@ -73,6 +73,13 @@ CH_SENSOR_API void ChSensor::PushFilterFront(std::shared_ptr<ChFilter> filter) {
     }
 }
 
+CH_SENSOR_API void ChSensor::ReplaceFrontFilter(std::shared_ptr<ChFilter> filter) {
+    if (m_filters.empty())
+        m_filters.push_front(filter);
+    else
+        m_filters.front() = filter;
+}
+
 // -----------------------------------------------------------------------------
 // retriever function for image data in greyscale 8-bit format
 // -----------------------------------------------------------------------------
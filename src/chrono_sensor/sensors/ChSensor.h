@@ -23,6 +23,7 @@
 
 #include <list>
 #include <mutex>
+#include <vector>
 
 #include "chrono_sensor/sensors/ChSensorBuffer.h"
 #include "chrono/physics/ChBody.h"
@@ -108,6 +109,16 @@ class CH_SENSOR_API ChSensor {
     ///@param updateRate Desired update rate in Hz
     void SetUpdateRate(float updateRate) { m_updateRate = updateRate; }
 
+    /// Set the sensor update phase (seconds, default 0). The sensor starts its updates at t = phase + n / update rate,
+    /// which allows staggering sensors with the same update rate so that they are not rendered on the same step.
+    /// Should be set before the simulation starts.
+    /// @param phase The delay of the sensor updates, in [0, 1 / update rate)
+    void SetUpdatePhase(float phase) { m_update_phase = phase; }
+
+    /// Get the sensor update phase (seconds)
+    /// @return The delay of the sensor updates
+    float GetUpdatePhase() const { return m_update_phase; }
+
     /// Get the number of times the sensor has been updated
     /// @return The number of times an update for the sensor has been started
     unsigned int GetNumLaunches() {
@@ -140,6 +151,11 @@ class CH_SENSOR_API ChSensor {
     /// processing the filters. WARNING: this operation cannot be undone.
     void LockFilterList() { m_filter_list_locked = true; }
 
+    /// Replace the first filter of the list, even if the list is locked. This is used by the OptiX engines to replace
+    /// the render filter when a sensor is moved to another engine, after which the whole list is initialized again.
+    /// @param filter The filter that replaces the first filter of the list
+    void ReplaceFrontFilter(std::shared_ptr<ChFilter> filter);
+
     /// Get the last filter in the list that matches the template type
     /// @return A shared pointer to a ChSensorBuffer of the templated type.
     template <class UserBufferType>
@@ -151,6 +167,7 @@ class CH_SENSOR_API ChSensor {
     float m_collection_window;  ///< time over which data is collected. (lag+shutter = time from when data collection
                                 ///< is started to when it is available to the user)
     float m_timeLastUpdated;    ///< time since previous update
+    float m_update_phase = 0;   ///< delay of the sensor updates with respect to the update period
     std::shared_ptr<chrono::ChBody> m_parent;        ///< object to which the sensor is attached
     chrono::ChFrame<double> m_offsetPose;            ///< position and orientation of the sensor relative to its parent
     std::string m_name;                              ///< name of the sensor
@@ -172,6 +189,32 @@ class CH_SENSOR_API ChDynamicSensor : public ChSensor {
     ~ChDynamicSensor() {}
     virtual void PushKeyFrame() = 0;
     virtual void ClearKeyFrames() = 0;
+
+    /// Merge the last two keyframes into the keyframe interpolated between them, used for sampling the sensor at its
+    /// exact update time when that time lies between the last two steps.
+    /// @param alpha The interpolation weight of the last keyframe
+    virtual void InterpolateKeyFrames(double alpha) {}
+
+    /// Set the time at which the current data of the sensor was sampled
+    /// @param t The sample time
+    void SetSampleTime(float t) { m_sample_time = t; }
+
+    /// Get the time at which the current data of the sensor was sampled
+    /// @return The sample time
+    float GetSampleTime() const { return m_sample_time; }
+
+  protected:
+    /// Merge the last two elements of a keyframe list into their linear interpolation
+    template <typename T>
+    static void MergeLastKeyFrames(std::vector<T>& keyframes, double alpha) {
+        if (keyframes.size() < 2)
+            return;
+        T last = keyframes.back();
+        keyframes.pop_back();
+        keyframes.back() = keyframes.back() + (last - keyframes.back()) * alpha;
+    }
+
+    float m_sample_time = 0;  ///< time at which the current data was sampled
 };
 
 /// @} sensor_sensors
@@ -41,5 +41,9 @@ CH_SENSOR_API void ChTachometerSensor::ClearKeyFrames() {
     m_keyframes.clear();
 }
 
+CH_SENSOR_API void ChTachometerSensor::InterpolateKeyFrames(double alpha) {
+    MergeLastKeyFrames(m_keyframes, alpha);
+}
+
 }  // namespace sensor
 }  // namespace chrono
\ No newline at end of file
@@ -47,6 +47,7 @@ class CH_SENSOR_API ChTachometerSensor : public ChDynamicSensor {
     ~ChTachometerSensor() {}
     virtual void PushKeyFrame();
     virtual void ClearKeyFrames();
+    virtual void InterpolateKeyFrames(double alpha);
 
   private:
     /// Variable for communicating the sensor's keyframes from the ChSystem into the data generation filter
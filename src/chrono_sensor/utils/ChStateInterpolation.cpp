@@ -0,0 +1,93 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Utilities for interpolating the state of the simulation between two steps,
+// used to sample the sensors at their exact update times
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/utils/ChUtils.h"
+#include "chrono_sensor/utils/ChStateInterpolation.h"
+
+namespace chrono {
+namespace sensor {
+
+ChFrame<double> InterpolateFrame(const ChFrame<double>& f0, const ChFrame<double>& f1, double alpha) {
+    ChVector3d pos = f0.GetPos() + alpha * (f1.GetPos() - f0.GetPos());
+
+    // q and -q are the same rotation, interpolate towards the closest one
+    ChQuaterniond q0 = f0.GetRot();
+    ChQuaterniond q1 = f1.GetRot();
+    if (q0.Dot(q1) < 0)
+        q1 = -q1;
+    ChQuaterniond rot = q0 * (1 - alpha) + q1 * alpha;
+    rot.Normalize();
+
+    return ChFrame<double>(pos, rot);
+}
+
+ChPoseHistory::ChPoseHistory(unsigned int capacity) : m_capacity(std::max(capacity, 2u)) {}
+
+void ChPoseHistory::Record(double time, std::vector<ChFrame<double>> frames) {
+    if (!m_samples.empty() && (m_samples.back().second.size() != frames.size() || time < m_samples.back().first))
+        m_samples.clear();
+    if (!m_samples.empty() && time == m_samples.back().first)
+        m_samples.pop_back();
+
+    m_samples.emplace_back(time, std::move(frames));
+    while (m_samples.size() > m_capacity)
+        m_samples.pop_front();
+}
+
+bool ChPoseHistory::FindInterval(double time, size_t& i, double& alpha) const {
+    for (i = 0; i + 1 < m_samples.size(); i++) {
+        double t0 = m_samples[i].first;
+        double t1 = m_samples[i + 1].first;
+        // tolerance for times given in single precision
+        if (time > t0 - 1e-6 && time < t1 + 1e-6) {
+            alpha = ChClamp((time - t0) / (t1 - t0), 0.0, 1.0);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ChPoseHistory::Interpolate(double time, std::vector<ChFrame<double>>& frames) const {
+    size_t i;
+    double alpha;
+    if (!FindInterval(time, i, alpha))
+        return false;
+
+    const auto& f0 = m_samples[i].second;
+    const auto& f1 = m_samples[i + 1].second;
+    frames.resize(f0.size());
+    for (size_t k = 0; k < f0.size(); k++)
+        frames[k] = InterpolateFrame(f0[k], f1[k], alpha);
+    return true;
+}
+
+bool ChPoseHistory::Interpolate(double time, unsigned int id, ChFrame<double>& frame) const {
+    size_t i;
+    double alpha;
+    if (!FindInterval(time, i, alpha) || id >= m_samples[i].second.size())
+        return false;
+
+    frame = InterpolateFrame(m_samples[i].second[id], m_samples[i + 1].second[id], alpha);
+    return true;
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,86 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Utilities for interpolating the state of the simulation between two steps,
+// used to sample the sensors at their exact update times
+//
+// =============================================================================
+
+#ifndef CHSTATEINTERPOLATION_H
+#define CHSTATEINTERPOLATION_H
+
+#include <deque>
+#include <vector>
+
+#include "chrono/core/ChFrame.h"
+#include "chrono_sensor/ChApiSensor.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_utils
+/// @{
+
+/// Interpolate between two frames. The positions are interpolated linearly and the rotations are interpolated along
+/// the shortest arc (normalized linear interpolation, which is accurate for the small rotations of a time step).
+/// @param f0 The frame at alpha = 0
+/// @param f1 The frame at alpha = 1
+/// @param alpha The interpolation weight
+/// @return The interpolated frame
+CH_SENSOR_API ChFrame<double> InterpolateFrame(const ChFrame<double>& f0, const ChFrame<double>& f1, double alpha);
+
+/// Short ring buffer of the frames of a set of objects at the most recent simulation steps. Used for computing the
+/// frames at a time that lies between two steps.
+class CH_SENSOR_API ChPoseHistory {
+  public:
+    /// Class constructor
+    /// @param capacity Number of steps kept in the buffer (at least 2)
+    ChPoseHistory(unsigned int capacity = 2);
+
+    /// Add the frames of the objects at a step. The oldest step is dropped when the buffer is full. The buffer is
+    /// reset if the number of objects changed.
+    /// @param time The simulation time of the step
+    /// @param frames The frames of the objects at that time
+    void Record(double time, std::vector<ChFrame<double>> frames);
+
+    /// Compute the frames at a time, interpolated between the two recorded steps around that time.
+    /// @param time The time at which the frames are requested
+    /// @param frames The interpolated frames
+    /// @return False if the time is not covered by the recorded steps, in which case the frames are not modified
+    bool Interpolate(double time, std::vector<ChFrame<double>>& frames) const;
+
+    /// Compute the frame of one object at a time, interpolated between the two recorded steps around that time.
+    /// @param time The time at which the frame is requested
+    /// @param id The index of the object
+    /// @param frame The interpolated frame
+    /// @return False if the time is not covered by the recorded steps, in which case the frame is not modified
+    bool Interpolate(double time, unsigned int id, ChFrame<double>& frame) const;
+
+    /// Remove all recorded steps
+    void Clear() { m_samples.clear(); }
+
+  private:
+    /// Find the interval of recorded steps that contains a time
+    bool FindInterval(double time, size_t& i, double& alpha) const;
+
+    unsigned int m_capacity;                                                 ///< maximum number of recorded steps
+    std::deque<std::pair<double, std::vector<ChFrame<double>>>> m_samples;  ///< recorded times and frames
+};
+
+/// @}
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
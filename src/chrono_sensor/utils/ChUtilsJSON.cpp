@@ -391,6 +391,7 @@ std::shared_ptr<ChLidarSensor> ReadLidarSensorJSON(const std::string& filename,
     float hori_divergence_angle = .003f;
     LidarReturnMode return_mode = LidarReturnMode::STRONGEST_RETURN;
     float near_clip = 0.f;
+    bool adaptive_sampling = false;
 
     if (properties.HasMember("Sample Radius")) {
         sample_radius = properties["Sample Radius"].GetInt();
@@ -414,10 +415,17 @@ std::shared_ptr<ChLidarSensor> ReadLidarSensorJSON(const std::string& filename,
     if (properties.HasMember("Near Clip")) {
         near_clip = properties["Near Clip"].GetFloat();
     }
+    if (properties.HasMember("Adaptive Sampling")) {
+        adaptive_sampling = properties["Adaptive Sampling"].GetBool();
+    }
 
     auto lidar = chrono_types::make_shared<ChLidarSensor>(
         parent, updateRate, offsetPose, w, h, hfov, max_v_angle, min_v_angle, max_distance, beam_shape, sample_radius,
-        vert_divergence_angle, hori_divergence_angle, return_mode, near_clip);
+        vert_divergence_angle, hori_divergence_angle, return_mode, near_clip, adaptive_sampling);
+
+    if (properties.HasMember("Discontinuity Threshold")) {
+        lidar->SetDiscontinuityThreshold(properties["Discontinuity Threshold"].GetFloat());
+    }
 
     if (properties.HasMember("Lag")) {
         float lag = properties["Lag"].GetFloat();
@@ -567,7 +575,10 @@ std::shared_ptr<ChFilter> CreateFilterJSON(const Value& value) {
         filter = chrono_types::make_shared<ChFilterGPSAccess>(name);
     } else if (type.compare("ChFilterPCfromDepth") == 0) {
         std::string name = GetStringMemberWithDefault(value, "Name");
-        filter = chrono_types::make_shared<ChFilterPCfromDepth>(name);
+        if (value.HasMember("Voxel Size"))
+            filter = chrono_types::make_shared<ChFilterPCfromDepth>(value["Voxel Size"].GetFloat(), name);
+        else
+            filter = chrono_types::make_shared<ChFilterPCfromDepth>(name);
     } else if (type.compare("ChFilterVisualizePointCloud") == 0) {
         std::string name = GetStringMemberWithDefault(value, "Name");
         int w = value["Width"].GetInt();
@@ -50,6 +50,9 @@ SynChronoManager::SynChronoManager(int node_id, int num_nodes, std::shared_ptr<S
       m_node_key(node_id, 0),
       m_heartbeat(1e-2),
       m_next_sync(0.0),
+      m_interest_radius(0),
+      m_dead_reckoning(false),
+      m_asynchronous(false),
       m_time_update(0),
       m_time_msg_gather(0),
       m_time_communication(0),
@@ -61,7 +64,11 @@ SynChronoManager::SynChronoManager(int node_id, int num_nodes, std::shared_ptr<S
     SetLogNodeID(node_id);
 }
 
-SynChronoManager::~SynChronoManager() {}
+SynChronoManager::~SynChronoManager() {
+    // Do not destroy the communicator during an exchange
+    if (m_exchange.valid())
+        m_exchange.wait();
+}
 
 // Set the agent at the specified node
 bool SynChronoManager::AddAgent(std::shared_ptr<SynAgent> agent) {
@@ -121,10 +128,33 @@ bool SynChronoManager::SetCommunicator(std::shared_ptr<SynCommunicator> communic
     }
 
     m_communicator = communicator;
+    m_communicator->SetInterestRadius(m_interest_radius);
 
     return true;
 }
 
+void SynChronoManager::SetAsynchronous(bool val) {
+    if (m_initialized) {
+        SynLog() << "WARNING: SynChronoManager has been initialized. The asynchronous mode should be set prior to "
+                    "initializing the manager. Ignoring the asynchronous mode.\n";
+        return;
+    }
+
+    m_asynchronous = val;
+}
+
+void SynChronoManager::SetInterestRadius(double radius) {
+    if (m_initialized) {
+        SynLog() << "WARNING: SynChronoManager has been initialized. The interest radius should be set prior to "
+                    "initializing the manager. Ignoring the interest radius.\n";
+        return;
+    }
+
+    m_interest_radius = radius;
+    if (m_communicator)
+        m_communicator->SetInterestRadius(radius);
+}
+
 bool SynChronoManager::Initialize(ChSystem* system) {
     if (!m_communicator) {
         SynLog() << "WARNING: A Communicator has not been attached.\n";
@@ -134,6 +164,12 @@ bool SynChronoManager::Initialize(ChSystem* system) {
     // Initialize the communicator
     m_communicator->Initialize();
 
+    if (m_asynchronous && !m_communicator->IsThreadSafe()) {
+        SynLog() << "WARNING: The communicator cannot be used from another thread. Disabling the asynchronous "
+                    "mode.\n";
+        m_asynchronous = false;
+    }
+
 #ifdef CHRONO_FASTDDS
     // If the communicator uses DDS, we want to create subscribers that will listen to state information
     // coming from the other nodes. This is done by setting the name of each governing participant to
@@ -175,9 +211,13 @@ void SynChronoManager::Synchronize(double time) {
     if (!m_communicator)
         return;
 
-    // If time to next sync is in the future, do nothing
-    if (time < m_next_sync)
+    // If time to next sync is in the future, only extrapolate the zombies
+    if (time < m_next_sync) {
+        if (m_dead_reckoning)
+            for (auto& zombie_pair : m_zombies)
+                zombie_pair.second->AdvanceZombie(time);
         return;
+    }
 
     // Reset timers
     m_timer_update.reset();
@@ -185,9 +225,20 @@ void SynChronoManager::Synchronize(double time) {
     m_timer_communication.reset();
     m_timer_msg_process.reset();
 
+    // In asynchronous mode, first complete the exchange started at the previous heartbeat
+    if (m_exchange.valid()) {
+        m_timer_communication.start();
+        m_exchange.get();
+        m_timer_communication.stop();
+
+        CompleteExchange();
+    }
+
     // Call update for each underlying agent
     m_timer_update.start();
     UpdateAgents();
+    if (m_interest_radius > 0)
+        UpdateInterestRegion();
     m_timer_update.stop();
 
     // Gather messages from each node and add those to the communicator
@@ -198,10 +249,28 @@ void SynChronoManager::Synchronize(double time) {
     m_timer_msg_gather.stop();
 
     // Send the messages out to each node and receive any other messages
-    m_timer_communication.start();
-    m_communicator->Synchronize();
-    m_timer_communication.stop();
+    // In asynchronous mode, the exchange runs on a communication thread while the simulation advances; agents and
+    // interest regions are only modified again once it is complete (messages are already serialized at this point)
+    if (m_asynchronous) {
+        m_exchange = std::async(std::launch::async, [this]() { m_communicator->Synchronize(); });
+    } else {
+        m_timer_communication.start();
+        m_communicator->Synchronize();
+        m_timer_communication.stop();
+
+        CompleteExchange();
+    }
 
+    // Accumulate timers
+    m_time_update += m_timer_update();
+    m_time_msg_gather += m_timer_msg_gather();
+    m_time_communication += m_timer_communication();
+    m_time_msg_process += m_timer_msg_process();
+
+    m_next_sync += m_heartbeat;  // Set next sync to a point in the future
+}
+
+void SynChronoManager::CompleteExchange() {
     // Process any received data
     // Will most likely contain state or general purpose messages
     // Distribute the organized messages
@@ -210,16 +279,9 @@ void SynChronoManager::Synchronize(double time) {
     DistributeMessages();
     m_timer_msg_process.stop();
 
-    // Accumulate timers
-    m_time_update += m_timer_update();
-    m_time_msg_gather += m_timer_msg_gather();
-    m_time_communication += m_timer_communication();
-    m_time_msg_process += m_timer_msg_process();
-
     // Reset
-    m_communicator->Reset();     // Reset the communicator
-    m_messages.clear();          // clean the message map
-    m_next_sync += m_heartbeat;  // Set next sync to a point in the future
+    m_communicator->Reset();  // Reset the communicator
+    m_messages.clear();       // clean the message map
 }
 
 void SynChronoManager::UpdateAgents() {
@@ -229,6 +291,12 @@ void SynChronoManager::UpdateAgents() {
 
 void SynChronoManager::QuitSimulation() {
     if (m_is_ok) {
+        // Complete a pending exchange; its messages are no longer of interest
+        if (m_exchange.valid()) {
+            m_exchange.get();
+            m_communicator->Reset();
+        }
+
         m_communicator->AddQuitMessage();
         m_communicator->Synchronize();
         m_is_ok = false;
@@ -303,6 +371,29 @@ void SynChronoManager::DistributeMessages() {
     }
 }
 
+void SynChronoManager::UpdateInterestRegion() {
+    // A node without agents, or with agents that are not localized, must hear (and be heard by) everyone
+    if (m_agents.empty()) {
+        m_communicator->SetInterestRegion(SynInterestRegion());
+        return;
+    }
+
+    // Start from an empty box and grow it to enclose all agents
+    SynInterestRegion region(ChVector3d(std::numeric_limits<double>::infinity()),
+                             ChVector3d(-std::numeric_limits<double>::infinity()));
+    for (auto& agent_pair : m_agents) {
+        ChVector3d location;
+        if (!agent_pair.second->GetLocation(location)) {
+            region = SynInterestRegion();
+            break;
+        }
+        region.min = Vmin(region.min, location);
+        region.max = Vmax(region.max, location);
+    }
+
+    m_communicator->SetInterestRegion(region);
+}
+
 void SynChronoManager::CreateAgentsFromDescriptions() {
     for (auto& message_agent_pair : m_messages) {
         // For readibility
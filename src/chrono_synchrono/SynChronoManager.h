@@ -8,6 +8,8 @@
 
 #include "chrono/physics/ChSystem.h"
 
+#include <future>
+
 namespace chrono {
 namespace synchrono {
 
@@ -83,6 +85,30 @@ class SYN_API SynChronoManager {
     ///
     void SetHeartbeat(double heartbeat) { m_heartbeat = heartbeat; }
 
+    ///@brief Enable interest management with the specified radius
+    /// Each node then only receives the messages of the nodes whose agents are within this distance of its own
+    /// agents (the regions are the bounding boxes of the agent locations). Nodes with agents that are not localized
+    /// (see SynAgent::GetLocation) or without agents exchange messages with everyone. Zombies of distant agents are
+    /// not updated until they come back within range. Must be called on all nodes, with the same radius, before
+    /// Initialize. A radius that is not positive disables interest management (default).
+    ///
+    ///@param radius the interest radius
+    void SetInterestRadius(double radius);
+
+    ///@brief Enable or disable dead reckoning of the zombies between synchronizations
+    /// If enabled, the zombies are extrapolated at every call to Synchronize from the poses and velocities of their
+    /// last received state, which allows a larger heartbeat for the same visual smoothness (default: false).
+    ///
+    void SetDeadReckoning(bool val) { m_dead_reckoning = val; }
+
+    ///@brief Enable or disable the overlap of the message exchange with the simulation
+    /// In asynchronous mode, Synchronize starts the exchange of the current heartbeat on a communication thread and
+    /// returns immediately; the exchange is completed, and the received messages distributed, at the next heartbeat.
+    /// Zombies are then always one heartbeat behind (see SetDeadReckoning to compensate). Requires a thread safe
+    /// communicator (see SynCommunicator::IsThreadSafe). Must be called before Initialize (default: false).
+    ///
+    void SetAsynchronous(bool val);
+
     /// @brief Should the simulation still be running?
     bool IsOk() { return m_is_ok; }
 
@@ -135,6 +161,14 @@ class SYN_API SynChronoManager {
     ///
     void CreateAgentsFromDescriptions();
 
+    ///@brief Update the interest region of this node in the communicator from the current agent locations
+    ///
+    void UpdateInterestRegion();
+
+    ///@brief Process and distribute the messages received by the last exchange, then reset the communicator
+    ///
+    void CompleteExchange();
+
     // --------------------------------------------------------------------------------------------------------------
 
     bool m_is_ok;
@@ -143,8 +177,13 @@ class SYN_API SynChronoManager {
     int m_num_nodes;     ///< The number of nodes in the SynChrono world (provided by user code)
     AgentKey m_node_key;
 
-    double m_heartbeat;  ///< Rate at which synchronization between nodes occurs
-    double m_next_sync;  ///< Time at which next synchronization between nodes should occur
+    double m_heartbeat;        ///< Rate at which synchronization between nodes occurs
+    double m_next_sync;        ///< Time at which next synchronization between nodes should occur
+    double m_interest_radius;  ///< Interest radius (interest management disabled if not positive)
+    bool m_dead_reckoning;     ///< Extrapolate the zombies between synchronizations?
+    bool m_asynchronous;       ///< Overlap the exchange of messages with the simulation?
+
+    std::future<void> m_exchange;  ///< pending exchange of messages (asynchronous mode)
 
     ChTimer m_timer_update;         ///< timer for agent updates
     ChTimer m_timer_msg_gather;     ///< timer for generating outgoing messages
@@ -34,6 +34,11 @@ void SynAgent::ProcessMessage(std::shared_ptr<SynMessage> msg) {
         m_process_message_callback(msg);
 }
 
+ChFrame<> SynAgent::ExtrapolateFrame(const ChFrameMoving<>& frame, double dt) {
+    ChQuaternion<> rot = QuatFromRotVec(frame.GetAngVelParent() * dt) * frame.GetRot();
+    return ChFrame<>(frame.GetPos() + frame.GetPosDt() * dt, rot.GetNormalized());
+}
+
 // -------------------------------------------------------------------------
 
 void SynAgent::SetProcessMessageCallback(std::function<void(std::shared_ptr<SynMessage>)> callback) {
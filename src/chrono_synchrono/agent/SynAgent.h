@@ -60,6 +60,12 @@ class SYN_API SynAgent {
     ///@param message the message to process and is used to update the position of the zombie
     virtual void SynchronizeZombie(std::shared_ptr<SynMessage> message) = 0;
 
+    ///@brief Extrapolate this agents zombie to the specified time from its last synchronized state (dead reckoning)
+    /// Called between synchronizations if dead reckoning is enabled in the manager. Does nothing by default.
+    ///
+    ///@param time the current simulation time
+    virtual void AdvanceZombie(double time) {}
+
     ///@brief Update this agent
     /// Typically used to update the state representation of the agent to be distributed to other agents
     ///
@@ -87,6 +93,14 @@ class SYN_API SynAgent {
     ///@param zombie the new zombie
     virtual void RegisterZombie(std::shared_ptr<SynAgent> zombie) {}
 
+    ///@brief Get the location of this agent, used for interest management
+    /// Agents that are not localized in the world (e.g. environment or terrain agents) return false, in which case
+    /// the messages of their node are distributed to all other nodes.
+    ///
+    ///@param location the current location of the agent
+    ///@return whether the agent is localized
+    virtual bool GetLocation(ChVector3d& location) const { return false; }
+
     // -------------------------------------------------------------------------
 
     void SetProcessMessageCallback(std::function<void(std::shared_ptr<SynMessage>)> callback);
@@ -99,6 +113,12 @@ class SYN_API SynAgent {
     virtual void SetKey(AgentKey agent_key) { m_agent_key = agent_key; }
 
   protected:
+    ///@brief Extrapolate a frame assuming constant linear and angular velocities
+    ///
+    ///@param frame the frame, with velocities, to extrapolate
+    ///@param dt the extrapolation time
+    static ChFrame<> ExtrapolateFrame(const ChFrameMoving<>& frame, double dt);
+
     AgentKey m_agent_key;
 
     std::function<void(std::shared_ptr<SynMessage>)> m_process_message_callback;
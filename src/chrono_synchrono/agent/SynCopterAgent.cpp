@@ -88,6 +88,14 @@ void SynCopterAgent::Update() {
 
 // ------------------------------------------------------------------------
 
+bool SynCopterAgent::GetLocation(ChVector3d& location) const {
+    if (!m_copter)
+        return false;
+
+    location = m_copter->GetChassis()->GetPos();
+    return true;
+}
+
 void SynCopterAgent::SetKey(AgentKey agent_key) {
     m_description->SetSourceKey(agent_key);
     m_state->SetSourceKey(agent_key);
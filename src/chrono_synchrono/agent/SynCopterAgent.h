@@ -76,6 +76,12 @@ class SYN_API SynCopterAgent : public SynAgent {
     ///@param messages a referenced vector containing messages to be distributed from this rank
     virtual void GatherDescriptionMessages(SynMessageList& messages) override { messages.push_back(m_description); }
 
+    ///@brief Get the location of this agent, used for interest management
+    ///
+    ///@param location the current location of the agent
+    ///@return whether the agent is localized (false for a zombie)
+    virtual bool GetLocation(ChVector3d& location) const override;
+
     // ------------------------------------------------------------------------
 
     ///@brief Set the zombie visualization files
@@ -33,7 +33,8 @@ using namespace chrono::vehicle;
 namespace chrono {
 namespace synchrono {
 
-SynSCMTerrainAgent::SynSCMTerrainAgent(std::shared_ptr<vehicle::SCMTerrain> terrain) : SynAgent(), m_terrain(terrain) {
+SynSCMTerrainAgent::SynSCMTerrainAgent(std::shared_ptr<vehicle::SCMTerrain> terrain)
+    : SynAgent(), m_terrain(terrain), m_compression(true) {
     m_message = chrono_types::make_shared<SynSCMMessage>();
 }
 
@@ -42,9 +43,15 @@ SynSCMTerrainAgent::~SynSCMTerrainAgent() {}
 void SynSCMTerrainAgent::InitializeZombie(ChSystem* system) {}
 
 void SynSCMTerrainAgent::SynchronizeZombie(std::shared_ptr<SynMessage> message) {
-    if (auto state = std::dynamic_pointer_cast<SynSCMMessage>(message))
-        if (m_terrain)
+    if (auto state = std::dynamic_pointer_cast<SynSCMMessage>(message)) {
+        if (!m_terrain)
+            return;
+        // Changes from each source are decoded by the corresponding zombie, which tracks the source tile revisions
+        if (!state->encoded_nodes.empty())
+            m_terrain->SetModifiedNodes(m_stream.Decode(state->encoded_nodes));
+        else
             m_terrain->SetModifiedNodes(state->modified_nodes);
+    }
 }
 
 void SynSCMTerrainAgent::Update() {
@@ -57,6 +64,12 @@ void SynSCMTerrainAgent::Update() {
     m_message->modified_nodes.reserve(m_modified_nodes.size());
     for (const auto& v : m_modified_nodes)
         m_message->modified_nodes.push_back(std::make_pair(v.first, v.second));
+
+    m_message->encoded_nodes.clear();
+    if (m_compression && !m_message->modified_nodes.empty()) {
+        m_message->encoded_nodes = m_stream.Encode(m_message->modified_nodes);
+        m_message->modified_nodes.clear();
+    }
 }
 
 void SynSCMTerrainAgent::GatherMessages(SynMessageList& messages) {
@@ -81,6 +94,11 @@ void SynSCMTerrainAgent::SetSoilParametersFromStruct(SCMParameters* params) {
                                  params->m_elastic_K, params->m_damping_R);
 }
 
+void SynSCMTerrainAgent::EnableCompression(bool val, double resolution) {
+    m_compression = val;
+    m_stream.SetResolution(resolution);
+}
+
 void SynSCMTerrainAgent::SetKey(AgentKey agent_key) {
     m_message->SetSourceKey(agent_key);
     m_agent_key = agent_key;
@@ -31,6 +31,7 @@
 #include "chrono_synchrono/flatbuffer/message/SynSCMMessage.h"
 
 #include "chrono_vehicle/terrain/SCMTerrain.h"
+#include "chrono_vehicle/terrain/SCMTerrainStream.h"
 
 namespace chrono {
 namespace synchrono {
@@ -97,6 +98,14 @@ class SYN_API SynSCMTerrainAgent : public SynAgent {
     ///
     void SetTerrain(std::shared_ptr<vehicle::SCMTerrain> terrain) { m_terrain = terrain; }
 
+    ///@brief Enable/disable compression of the terrain changes sent to other ranks (default: enabled)
+    /// If enabled, node levels are quantized with the given resolution and sent as a delta-encoded stream (see
+    /// vehicle::SCMTerrainStream). Compressed and uncompressed messages can be received regardless of this setting.
+    ///
+    ///@param val whether to compress the terrain changes
+    ///@param resolution resolution of the transmitted node levels
+    void EnableCompression(bool val, double resolution = 1e-6);
+
     ///@brief Set the Agent ID
     ///
     virtual void SetKey(AgentKey agent_key) override;
@@ -117,6 +126,9 @@ class SYN_API SynSCMTerrainAgent : public SynAgent {
 
     std::shared_ptr<SynSCMMessage> m_message;                            ///< The message passed between nodes
     std::unordered_map<ChVector2i, double, CoordHash> m_modified_nodes;  ///< Where we store changes to our terrain
+
+    bool m_compression;                  ///< Send terrain changes as a compressed stream?
+    vehicle::SCMTerrainStream m_stream;  ///< Encoder (or decoder, for zombies) of terrain changes
 };
 
 /// Groups SCM parameters into a struct, defines some useful defaults
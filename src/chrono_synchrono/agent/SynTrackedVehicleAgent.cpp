@@ -32,7 +32,7 @@ namespace chrono {
 namespace synchrono {
 
 SynTrackedVehicleAgent::SynTrackedVehicleAgent(ChTrackedVehicle* vehicle, const std::string& filename)
-    : SynAgent(), m_vehicle(vehicle) {
+    : SynAgent(), m_vehicle(vehicle), m_zombie_time(-1) {
     m_state = chrono_types::make_shared<SynTrackedVehicleStateMessage>();
     m_description = chrono_types::make_shared<SynTrackedVehicleDescriptionMessage>();
 
@@ -66,6 +66,14 @@ void SynTrackedVehicleAgent::InitializeZombie(ChSystem* system) {
 
 void SynTrackedVehicleAgent::SynchronizeZombie(std::shared_ptr<SynMessage> message) {
     if (auto state = std::dynamic_pointer_cast<SynTrackedVehicleStateMessage>(message)) {
+        // Wait for the next keyframe if the compressed poses cannot be decoded
+        if (!state->Decompress(m_decoder, *m_description))
+            return;
+
+        m_zombie_time = state->time;
+        m_zombie_frames.clear();
+        m_zombie_frames.push_back(state->chassis.GetFrame());
+
         m_zombie_body->SetFrameRefToAbs(state->chassis.GetFrame());
         for (int i = 0; i < state->track_shoes.size(); i++)
             m_track_shoe_list[i]->SetFrameRefToAbs(state->track_shoes[i].GetFrame());
@@ -75,6 +83,27 @@ void SynTrackedVehicleAgent::SynchronizeZombie(std::shared_ptr<SynMessage> messa
             m_idler_list[i]->SetFrameRefToAbs(state->idlers[i].GetFrame());
         for (int i = 0; i < state->road_wheels.size(); i++)
             m_road_wheel_list[i]->SetFrameRefToAbs(state->road_wheels[i].GetFrame());
+
+        for (auto parts : {&state->track_shoes, &state->sprockets, &state->idlers, &state->road_wheels})
+            for (auto& part : *parts)
+                m_zombie_frames.push_back(part.GetFrame());
+    }
+}
+
+void SynTrackedVehicleAgent::AdvanceZombie(double time) {
+    if (!m_zombie_body || m_zombie_time < 0 || time <= m_zombie_time)
+        return;
+
+    double dt = time - m_zombie_time;
+    m_zombie_body->SetFrameRefToAbs(ExtrapolateFrame(m_zombie_frames[0], dt));
+
+    size_t index = 1;
+    for (auto parts : {&m_track_shoe_list, &m_sprocket_list, &m_idler_list, &m_road_wheel_list}) {
+        for (auto& part : *parts) {
+            if (index >= m_zombie_frames.size())
+                return;
+            part->SetFrameRefToAbs(ExtrapolateFrame(m_zombie_frames[index++], dt));
+        }
     }
 }
 
@@ -82,17 +111,24 @@ void SynTrackedVehicleAgent::Update() {
     if (!m_vehicle)
         return;
 
-    SynPose chassis(m_vehicle->GetChassisBody()->GetFrameRefToAbs().GetPos(), m_vehicle->GetChassisBody()->GetRot());
+    auto chassis_abs = m_vehicle->GetChassisBody()->GetFrameRefToAbs();
+    SynPose chassis(chassis_abs.GetPos(), m_vehicle->GetChassisBody()->GetRot());
+    chassis.GetFrame().SetPosDt(chassis_abs.GetPosDt());
+    chassis.GetFrame().SetAngVelParent(chassis_abs.GetAngVelParent());
 
     std::vector<SynPose> track_shoes;
     BodyStates left_states(m_vehicle->GetNumTrackShoes(LEFT));
     BodyStates right_states(m_vehicle->GetNumTrackShoes(RIGHT));
     m_vehicle->GetTrackShoeStates(LEFT, left_states);
     m_vehicle->GetTrackShoeStates(RIGHT, right_states);
-    for (auto& state : left_states)
-        track_shoes.emplace_back(state.pos, state.rot);
-    for (auto& state : right_states)
-        track_shoes.emplace_back(state.pos, state.rot);
+    for (auto states : {&left_states, &right_states}) {
+        for (auto& state : *states) {
+            SynPose frame(state.pos, state.rot);
+            frame.GetFrame().SetPosDt(state.lin_vel);
+            frame.GetFrame().SetAngVelParent(state.ang_vel);
+            track_shoes.push_back(frame);
+        }
+    }
 
     auto left_assembly = m_vehicle->GetTrackAssembly(LEFT);
     auto right_assembly = m_vehicle->GetTrackAssembly(RIGHT);
@@ -122,6 +158,14 @@ void SynTrackedVehicleAgent::SetZombieVisualizationFilesFromJSON(const std::stri
     m_description->SetZombieVisualizationFilesFromJSON(filename);
 }
 
+bool SynTrackedVehicleAgent::GetLocation(ChVector3d& location) const {
+    if (!m_vehicle)
+        return false;
+
+    location = m_vehicle->GetPos();
+    return true;
+}
+
 void SynTrackedVehicleAgent::SetKey(AgentKey agent_key) {
     m_description->SetSourceKey(agent_key);
     m_state->SetSourceKey(agent_key);
@@ -62,6 +62,11 @@ class SYN_API SynTrackedVehicleAgent : public SynAgent {
     ///@param message the message to process and is used to update the position of the zombie
     virtual void SynchronizeZombie(std::shared_ptr<SynMessage> message) override;
 
+    ///@brief Extrapolate the zombie chassis and assembly components from their last received poses and velocities
+    ///
+    ///@param time the current simulation time
+    virtual void AdvanceZombie(double time) override;
+
     ///@brief Update this agent
     /// Typically used to update the state representation of the agent to be distributed to other agents
     ///
@@ -79,6 +84,12 @@ class SYN_API SynTrackedVehicleAgent : public SynAgent {
     ///@param messages a referenced vector containing messages to be distributed from this rank
     virtual void GatherDescriptionMessages(SynMessageList& messages) override { messages.push_back(m_description); }
 
+    ///@brief Get the location of this agent, used for interest management
+    ///
+    ///@param location the current location of the agent
+    ///@return whether the agent is localized (false for a zombie)
+    virtual bool GetLocation(ChVector3d& location) const override;
+
     // ------------------------------------------------------------------------
 
     ///@brief Set the zombie visualization files from a JSON specification file
@@ -119,6 +130,12 @@ class SYN_API SynTrackedVehicleAgent : public SynAgent {
         m_description->SetNumAssemblyComponents(num_track_shoes, num_sprockets, num_idlers, num_road_wheels);
     }
 
+    ///@brief Send the state of the vehicle quantized and relative to periodic keyframes (see SynPoseCompressor)
+    ///
+    ///@param val whether the state messages are compressed
+    ///@param keyframe_interval number of messages between full precision keyframes
+    void SetStateCompression(bool val, int keyframe_interval = 50) { m_state->SetCompression(val, keyframe_interval); }
+
     ///@brief Set the Agent ID
     ///
     virtual void SetKey(AgentKey agent_key) override;
@@ -173,6 +190,10 @@ class SYN_API SynTrackedVehicleAgent : public SynAgent {
     std::vector<std::shared_ptr<ChBodyAuxRef>> m_sprocket_list;    ///< vector of this agent's zombie sprockets
     std::vector<std::shared_ptr<ChBodyAuxRef>> m_idler_list;       ///< vector of this agent's zombie idlers
     std::vector<std::shared_ptr<ChBodyAuxRef>> m_road_wheel_list;  ///< vector of this agent's zombie road wheels
+
+    SynPoseCompressor m_decoder;                   ///< decoder of the compressed state messages of this zombie
+    double m_zombie_time;                          ///< time of the last synchronized zombie state (negative if none)
+    std::vector<ChFrameMoving<>> m_zombie_frames;  ///< last synchronized frames, in the order of the state message
 };
 
 /// @} synchrono_agent
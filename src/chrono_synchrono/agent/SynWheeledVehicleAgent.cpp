@@ -33,7 +33,7 @@ namespace chrono {
 namespace synchrono {
 
 SynWheeledVehicleAgent::SynWheeledVehicleAgent(ChWheeledVehicle* vehicle, const std::string& filename)
-    : SynAgent(), m_vehicle(vehicle) {
+    : SynAgent(), m_vehicle(vehicle), m_zombie_time(-1) {
     m_state = chrono_types::make_shared<SynWheeledVehicleStateMessage>(AgentKey(), AgentKey());
     m_description = chrono_types::make_shared<SynWheeledVehicleDescriptionMessage>();
 
@@ -80,12 +80,32 @@ void SynWheeledVehicleAgent::InitializeZombie(ChSystem* system) {
 
 void SynWheeledVehicleAgent::SynchronizeZombie(std::shared_ptr<SynMessage> message) {
     if (auto state = std::dynamic_pointer_cast<SynWheeledVehicleStateMessage>(message)) {
+        // Wait for the next keyframe if the compressed poses cannot be decoded
+        if (!state->Decompress(m_decoder))
+            return;
+
+        m_zombie_time = state->time;
+        m_zombie_frames.clear();
+        m_zombie_frames.push_back(state->chassis.GetFrame());
+
         m_zombie_body->SetFrameRefToAbs(state->chassis.GetFrame());
-        for (int i = 0; i < state->wheels.size(); i++)
+        for (int i = 0; i < state->wheels.size(); i++) {
             m_wheel_list[i]->SetFrameRefToAbs(state->wheels[i].GetFrame());
+            m_zombie_frames.push_back(state->wheels[i].GetFrame());
+        }
     }
 }
 
+void SynWheeledVehicleAgent::AdvanceZombie(double time) {
+    if (!m_zombie_body || m_zombie_time < 0 || time <= m_zombie_time)
+        return;
+
+    double dt = time - m_zombie_time;
+    m_zombie_body->SetFrameRefToAbs(ExtrapolateFrame(m_zombie_frames[0], dt));
+    for (size_t i = 1; i < m_zombie_frames.size() && i <= m_wheel_list.size(); i++)
+        m_wheel_list[i - 1]->SetFrameRefToAbs(ExtrapolateFrame(m_zombie_frames[i], dt));
+}
+
 void SynWheeledVehicleAgent::Update() {
     if (!m_vehicle)
         return;
@@ -121,6 +141,14 @@ void SynWheeledVehicleAgent::SetZombieVisualizationFilesFromJSON(const std::stri
     m_description->SetZombieVisualizationFilesFromJSON(filename);
 }
 
+bool SynWheeledVehicleAgent::GetLocation(ChVector3d& location) const {
+    if (!m_vehicle)
+        return false;
+
+    location = m_vehicle->GetPos();
+    return true;
+}
+
 void SynWheeledVehicleAgent::SetKey(AgentKey agent_key) {
     m_description->SetSourceKey(agent_key);
     m_state->SetSourceKey(agent_key);
@@ -61,6 +61,11 @@ class SYN_API SynWheeledVehicleAgent : public SynAgent {
     ///@param message the message to process and is used to update the position of the zombie
     virtual void SynchronizeZombie(std::shared_ptr<SynMessage> message) override;
 
+    ///@brief Extrapolate the zombie chassis and wheels from their last received poses and velocities
+    ///
+    ///@param time the current simulation time
+    virtual void AdvanceZombie(double time) override;
+
     ///@brief Update this agent
     /// Typically used to update the state representation of the agent to be distributed to other agents
     ///
@@ -78,6 +83,12 @@ class SYN_API SynWheeledVehicleAgent : public SynAgent {
     ///@param messages a referenced vector containing messages to be distributed from this rank
     virtual void GatherDescriptionMessages(SynMessageList& messages) override { messages.push_back(m_description); }
 
+    ///@brief Get the location of this agent, used for interest management
+    ///
+    ///@param location the current location of the agent
+    ///@return whether the agent is localized (false for a zombie)
+    virtual bool GetLocation(ChVector3d& location) const override;
+
     // ------------------------------------------------------------------------
 
     ///@brief Set the zombie visualization files from a JSON specification file
@@ -101,6 +112,12 @@ class SYN_API SynWheeledVehicleAgent : public SynAgent {
     ///@param num_wheels number of wheels of the underlying vehicle
     void SetNumWheels(int num_wheels) { m_description->SetNumWheels(num_wheels); }
 
+    ///@brief Send the state of the vehicle quantized and relative to periodic keyframes (see SynPoseCompressor)
+    ///
+    ///@param val whether the state messages are compressed
+    ///@param keyframe_interval number of messages between full precision keyframes
+    void SetStateCompression(bool val, int keyframe_interval = 50) { m_state->SetCompression(val, keyframe_interval); }
+
     ///@brief Set the Agent ID
     ///
     virtual void SetKey(AgentKey agent_key) override;
@@ -130,6 +147,10 @@ class SYN_API SynWheeledVehicleAgent : public SynAgent {
 
     std::shared_ptr<ChBodyAuxRef> m_zombie_body;              ///< agent's zombie body reference
     std::vector<std::shared_ptr<ChBodyAuxRef>> m_wheel_list;  ///< vector of this agent's zombie wheels
+
+    SynPoseCompressor m_decoder;                   ///< decoder of the compressed state messages of this zombie
+    double m_zombie_time;                          ///< time of the last synchronized zombie state (negative if none)
+    std::vector<ChFrameMoving<>> m_zombie_frames;  ///< last synchronized chassis and wheel frames
 };
 
 /// @} synchrono_agent
@@ -27,7 +27,7 @@
 namespace chrono {
 namespace synchrono {
 
-SynCommunicator::SynCommunicator() : m_initialized(false) {}
+SynCommunicator::SynCommunicator() : m_initialized(false), m_interest_radius(0) {}
 
 SynCommunicator::~SynCommunicator() {}
 
@@ -48,6 +48,9 @@ void SynCommunicator::AddOutgoingMessages(SynMessageList& messages) {
 
 void SynCommunicator::AddQuitMessage() {
     // Source and destination are meaningless in this case
+    // The quit message must reach every node, regardless of the interest regions
+    m_interest_region = SynInterestRegion();
+
     auto message = chrono_types::make_shared<SynSimulationMessage>(AgentKey(), AgentKey(), true);
     m_flatbuffers_manager.AddMessage(message);
 }
@@ -29,7 +29,10 @@
 #include "chrono_synchrono/flatbuffer/SynFlatBuffersManager.h"
 #include "chrono_synchrono/flatbuffer/message/SynMessage.h"
 
+#include "chrono/core/ChVector3.h"
+
 #include <vector>
+#include <limits>
 #include <functional>
 
 namespace chrono {
@@ -38,6 +41,25 @@ namespace synchrono {
 /// @addtogroup synchrono_communication
 /// @{
 
+/// Axis-aligned box enclosing the agents of a node, used for interest management.
+/// A default constructed region is unbounded: the messages of such a node are of interest to every other node.
+struct SYN_API SynInterestRegion {
+    SynInterestRegion()
+        : min(-std::numeric_limits<double>::infinity()), max(std::numeric_limits<double>::infinity()) {}
+    SynInterestRegion(const ChVector3d& min_corner, const ChVector3d& max_corner)
+        : min(min_corner), max(max_corner) {}
+
+    /// Check if this region is within the specified distance of another region (in each direction).
+    bool Overlaps(const SynInterestRegion& other, double radius) const {
+        return min.x() - radius <= other.max.x() && other.min.x() <= max.x() + radius &&  //
+               min.y() - radius <= other.max.y() && other.min.y() <= max.y() + radius &&  //
+               min.z() - radius <= other.max.z() && other.min.z() <= max.z() + radius;
+    }
+
+    ChVector3d min;  ///< lower corner of the region
+    ChVector3d max;  ///< upper corner of the region
+};
+
 /// Base class communicator used to establish and facilitate communication between nodes
 class SYN_API SynCommunicator {
   public:
@@ -69,6 +91,11 @@ class SYN_API SynCommunicator {
     ///
     virtual void Barrier() = 0;
 
+    ///@brief Can Synchronize be called from a thread other than the one that created the communicator?
+    /// Required to overlap the exchange of messages with the simulation (see SynChronoManager::SetAsynchronous).
+    ///
+    virtual bool IsThreadSafe() const { return true; }
+
     // -----------------------------------------------------------------------------------------------
 
     ///@brief Reset the communicator
@@ -101,9 +128,32 @@ class SYN_API SynCommunicator {
 
     // -----------------------------------------------------------------------------------------------
 
+    ///@brief Set the interest radius used to filter the messages exchanged between nodes
+    /// A node only receives the messages of the nodes whose region is within this distance of its own region.
+    /// Interest management is disabled if the radius is not positive (default). Must be set, with the same value,
+    /// on all nodes before the communicator is initialized.
+    ///
+    ///@param radius the interest radius
+    void SetInterestRadius(double radius) { m_interest_radius = radius; }
+
+    ///@brief Set the region occupied by the agents of this node
+    /// Used to filter the messages exchanged between nodes if an interest radius was set.
+    ///
+    ///@param region the region of this node
+    void SetInterestRegion(const SynInterestRegion& region) { m_interest_region = region; }
+
+    ///@brief Get the interest radius (interest management disabled if not positive)
+    ///
+    double GetInterestRadius() const { return m_interest_radius; }
+
+    // -----------------------------------------------------------------------------------------------
+
   protected:
     bool m_initialized;  ///< whether the communicator has been initialized
 
+    double m_interest_radius;             ///< interest radius (interest management disabled if not positive)
+    SynInterestRegion m_interest_region;  ///< region occupied by the agents of this node
+
     SynMessageList m_incoming_messages;           ///< Incoming messages
     SynFlatBuffersManager m_flatbuffers_manager;  ///< flatbuffer manager for this rank
 };
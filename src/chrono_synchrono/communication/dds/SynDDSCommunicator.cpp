@@ -26,6 +26,7 @@
 #include "chrono_synchrono/utils/SynLog.h"
 #include "chrono_synchrono/communication/dds/SynDDSTopic.h"
 #include "chrono_synchrono/communication/dds/SynDDSListener.h"
+#include "chrono_synchrono/communication/dds/SynDDSInterestFilter.h"
 
 #undef ALIVE
 
@@ -44,8 +45,13 @@
 #include <fastdds/dds/subscriber/DataReader.hpp>
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
+
 #include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
 
+#include <cmath>
+
 using namespace eprosima::fastdds::dds;
 using namespace eprosima::fastdds::rtps;
 using namespace eprosima::fastrtps::rtps;
@@ -100,6 +106,11 @@ SynDDSCommunicator::~SynDDSCommunicator() {
         subscriber->GetSubscriber()->delete_datareader(subscriber->GetDataReader());
     }
 
+    for (auto& subscriber : m_subscribers) {
+        if (subscriber->m_filtered_topic)
+            m_participant->delete_contentfilteredtopic(subscriber->m_filtered_topic);
+    }
+
     for (auto& pair : m_topics) {
         auto topic = pair.second;
         m_participant->delete_topic(topic->GetDDSTopic());
@@ -114,6 +125,8 @@ SynDDSCommunicator::~SynDDSCommunicator() {
     }
 
     DomainParticipantFactory::get_instance()->delete_participant(m_participant);
+
+    delete m_interest_filter_factory;
 }
 
 void SynDDSCommunicator::Initialize() {
@@ -129,6 +142,10 @@ void SynDDSCommunicator::Synchronize() {
     // Publish data
     Publish();
 
+    // Let the other nodes know where this node is now
+    if (m_interest_radius > 0)
+        UpdateInterestFilters();
+
     // Blocking wait for a message to be received
     Listen();
 }
@@ -203,11 +220,20 @@ std::shared_ptr<SynDDSSubscriber> SynDDSCommunicator::CreateSubscriber(std::shar
     // Create the listener
     auto listener = new SynDDSDataReaderListener(callback, message);
 
+    // With interest management, read the SynDDSMessage samples through a filter on their region
+    TopicDescription* description = topic->GetDDSTopic();
+    ContentFilteredTopic* filtered_topic = nullptr;
+    if (m_interest_radius > 0 && topic->GetTypeName() == "SynDDSMessage") {
+        filtered_topic = CreateInterestFilter(topic);
+        if (filtered_topic)
+            description = filtered_topic;
+    }
+
     // Create the data reader
     StatusMask mask = StatusMask::all();
     if (is_synchronous)
         mask >> StatusMask::data_available();
-    auto reader = subscriber->create_datareader(topic->GetDDSTopic(), *qos, listener, mask);
+    auto reader = subscriber->create_datareader(description, *qos, listener, mask);
     if (!reader) {
         SynLog() << "CreateSubscriber: Reader instantiation FAILED\n";
         return nullptr;
@@ -215,6 +241,7 @@ std::shared_ptr<SynDDSSubscriber> SynDDSCommunicator::CreateSubscriber(std::shar
 
     auto syn_subscriber =
         std::make_shared<SynDDSSubscriber>(subscriber, reader, listener, topic, callback, message, is_synchronous);
+    syn_subscriber->m_filtered_topic = filtered_topic;
     if (is_managed)
         m_subscribers.push_back(syn_subscriber);
 
@@ -314,7 +341,10 @@ std::shared_ptr<SynDDSPublisher> SynDDSCommunicator::CreatePublisher(const std::
 // -----------------------------------------------------------------------------------------------
 
 void SynDDSCommunicator::Publish() {
+    const SynInterestRegion& region = m_interest_region;
+
     SynDDSMessage msg;
+    msg.region({region.min.x(), region.min.y(), region.min.z(), region.max.x(), region.max.y(), region.max.z()});
     msg.data(m_flatbuffers_manager.ToMessageBuffer());
 
     for (auto publisher : m_publishers)
@@ -324,9 +354,67 @@ void SynDDSCommunicator::Publish() {
 }
 
 void SynDDSCommunicator::Listen() {
-    for (auto subscriber : m_subscribers)
-        if (subscriber->IsSynchronous())
+    for (auto subscriber : m_subscribers) {
+        if (!subscriber->IsSynchronous())
+            continue;
+
+        if (!subscriber->m_filtered_topic) {
             subscriber->Receive();
+            continue;
+        }
+
+        // The messages of a node that left the area of interest are filtered out and will never arrive, so only wait
+        // for the nodes within half the interest radius (the others are polled)
+        if (subscriber->Receive(subscriber->m_is_near ? 20.0 : 0.0)) {
+            const auto& r = static_cast<SynDDSMessage*>(subscriber->m_message)->region();
+            SynInterestRegion region(ChVector3d(r[0], r[1], r[2]), ChVector3d(r[3], r[4], r[5]));
+            subscriber->m_is_near = m_interest_region.Overlaps(region, m_interest_radius / 2);
+        } else {
+            subscriber->m_is_near = false;
+        }
+    }
+}
+
+ContentFilteredTopic* SynDDSCommunicator::CreateInterestFilter(std::shared_ptr<SynDDSTopic> topic) {
+    if (!m_interest_filter_factory) {
+        m_interest_filter_factory = new SynDDSInterestFilterFactory();
+        if (m_participant->register_content_filter_factory(interest_filter_class.c_str(),
+                                                           m_interest_filter_factory) != ReturnCode_t::RETCODE_OK)
+            SynLog() << "WARNING: Failed to register the interest filter factory\n";
+    }
+
+    // The filter region is expanded by the update tolerance (see UpdateInterestFilters)
+    auto parameters = SynDDSInterestFilter::ToParameters(m_filter_region, 1.1 * m_interest_radius);
+    auto filtered_topic = m_participant->create_contentfilteredtopic(
+        topic->GetFullTopicName() + "/interest", topic->GetDDSTopic(), "region", parameters,
+        interest_filter_class.c_str());
+    if (!filtered_topic)
+        SynLog() << "WARNING: Failed to create the interest filter on topic " << topic->GetFullTopicName()
+                 << ". Receiving all messages.\n";
+
+    return filtered_topic;
+}
+
+void SynDDSCommunicator::UpdateInterestFilters() {
+    // New filter parameters are propagated to the writers through discovery, so they are only updated when this
+    // node moved by more than a tenth of the radius. The filters use a correspondingly larger radius.
+    double tolerance = 0.1 * m_interest_radius;
+    auto moved = [tolerance](double a, double b) { return a != b && !(std::abs(a - b) <= tolerance); };
+
+    bool update = false;
+    for (int i = 0; i < 3; i++) {
+        update |= moved(m_interest_region.min[i], m_filter_region.min[i]);
+        update |= moved(m_interest_region.max[i], m_filter_region.max[i]);
+    }
+    if (!update)
+        return;
+
+    m_filter_region = m_interest_region;
+    auto parameters = SynDDSInterestFilter::ToParameters(m_filter_region, m_interest_radius + tolerance);
+    for (auto& subscriber : m_subscribers) {
+        if (subscriber->m_filtered_topic)
+            subscriber->m_filtered_topic->set_expression_parameters(parameters);
+    }
 }
 
 }  // namespace synchrono
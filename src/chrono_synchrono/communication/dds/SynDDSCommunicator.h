@@ -41,6 +41,7 @@ class DomainParticipantQos;
 class TopicDataType;
 class DataReaderQos;
 class DataWriterQos;
+class ContentFilteredTopic;
 
 }  // namespace dds
 }  // namespace fastdds
@@ -50,6 +51,7 @@ namespace chrono {
 namespace synchrono {
 
 class SynDDSParticipantListener;
+class SynDDSInterestFilterFactory;
 
 /// @addtogroup synchrono_communication_dds
 /// @{
@@ -142,6 +144,9 @@ class SYN_API SynDDSCommunicator : public SynCommunicator {
     /// Will call the callback when a subscription is received
     /// Takes a SynDDSTopic object (see CreateTopic)
     ///
+    /// If an interest radius was set, subscriptions to SynDDSMessage topics are filtered so that only the samples
+    /// of the nodes within the interest radius of this node are received.
+    ///
     ///@param topic Topic object describing the DDS topic
     ///@param callback The callback called when data is received
     ///@param message The message that is used to parse the returned message
@@ -212,9 +217,19 @@ class SYN_API SynDDSCommunicator : public SynCommunicator {
 
     ///@brief Listen for incoming messages
     /// Will only block if the underlying subscribers are synchronous
+    /// With interest management, only blocks for the messages of the nodes near this one.
     ///
     void Listen();
 
+    ///@brief Create the interest filter for a subscription to the passed topic
+    ///
+    ///@param topic the SynDDSMessage topic to filter
+    eprosima::fastdds::dds::ContentFilteredTopic* CreateInterestFilter(std::shared_ptr<SynDDSTopic> topic);
+
+    ///@brief Update the parameters of the interest filters if this node moved significantly
+    ///
+    void UpdateInterestFilters();
+
     // -----------------------------------------------------------------------------------------------
 
     eprosima::fastdds::dds::DomainParticipant* m_participant;  ///< Domain Participant which maintains the pubs/subs
@@ -224,6 +239,9 @@ class SYN_API SynDDSCommunicator : public SynCommunicator {
     SubscriberList m_subscribers;
 
     SynDDSParticipantListener* m_listener;
+
+    SynDDSInterestFilterFactory* m_interest_filter_factory = nullptr;  ///< factory of the interest filters
+    SynInterestRegion m_filter_region;  ///< region of this node last passed to the interest filters
 };
 
 /// @} synchrono_communication
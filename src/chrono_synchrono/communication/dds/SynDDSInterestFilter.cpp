@@ -0,0 +1,123 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Content filter used for interest management over DDS.
+//
+// =============================================================================
+
+#include "chrono_synchrono/communication/dds/SynDDSInterestFilter.h"
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/FastBuffer.h>
+#include <fastcdr/exceptions/Exception.h>
+
+#include <array>
+#include <sstream>
+#include <cstring>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastrtps::types;
+
+namespace chrono {
+namespace synchrono {
+
+bool SynDDSInterestFilter::SetParameters(const IContentFilterFactory::ParameterSeq& parameters) {
+    if (parameters.length() != 7)
+        return false;
+
+    double values[7];
+    try {
+        for (int i = 0; i < 7; i++)
+            values[i] = std::stod(parameters[i]);
+    } catch (const std::exception&) {
+        return false;
+    }
+
+    m_region = SynInterestRegion(ChVector3d(values[0], values[1], values[2]),
+                                 ChVector3d(values[3], values[4], values[5]));
+    m_radius = values[6];
+
+    return true;
+}
+
+bool SynDDSInterestFilter::evaluate(const SerializedPayload& payload,
+                                    const FilterSampleInfo& sample_info,
+                                    const GUID_t& reader_guid) const {
+    // Only decode the rank and region, which precede the (large) data sequence
+    eprosima::fastcdr::FastBuffer buffer(reinterpret_cast<char*>(payload.data), payload.length);
+    eprosima::fastcdr::Cdr cdr(buffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+
+    uint32_t rank;
+    std::array<double, 6> r;
+    try {
+        cdr.read_encapsulation();
+        cdr >> rank;
+        cdr >> r;
+    } catch (const eprosima::fastcdr::exception::Exception&) {
+        // Let malformed samples through, the reader will report them
+        return true;
+    }
+
+    SynInterestRegion region(ChVector3d(r[0], r[1], r[2]), ChVector3d(r[3], r[4], r[5]));
+    return m_region.Overlaps(region, m_radius);
+}
+
+std::vector<std::string> SynDDSInterestFilter::ToParameters(const SynInterestRegion& region, double radius) {
+    double values[7] = {region.min.x(), region.min.y(), region.min.z(),  //
+                        region.max.x(), region.max.y(), region.max.z(),  //
+                        radius};
+
+    std::vector<std::string> parameters;
+    for (int i = 0; i < 7; i++) {
+        std::ostringstream os;
+        os.precision(17);
+        os << values[i];
+        parameters.push_back(os.str());
+    }
+
+    return parameters;
+}
+
+// -----------------------------------------------------------------------------------
+
+ReturnCode_t SynDDSInterestFilterFactory::create_content_filter(const char* filter_class_name,
+                                                                const char* type_name,
+                                                                const TopicDataType* data_type,
+                                                                const char* filter_expression,
+                                                                const ParameterSeq& filter_parameters,
+                                                                IContentFilter*& filter_instance) {
+    if (std::strcmp(filter_class_name, interest_filter_class.c_str()) != 0 ||
+        std::strcmp(type_name, "SynDDSMessage") != 0)
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+
+    // A null expression means that only the parameters of an existing filter changed
+    auto filter = filter_expression ? new SynDDSInterestFilter() : static_cast<SynDDSInterestFilter*>(filter_instance);
+    if (!filter || !filter->SetParameters(filter_parameters)) {
+        if (filter_expression)
+            delete filter;
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    filter_instance = filter;
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t SynDDSInterestFilterFactory::delete_content_filter(const char* filter_class_name,
+                                                                IContentFilter* filter_instance) {
+    delete static_cast<SynDDSInterestFilter*>(filter_instance);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+}  // namespace synchrono
+}  // namespace chrono
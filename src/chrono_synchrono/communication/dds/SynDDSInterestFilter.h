@@ -0,0 +1,92 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Content filter used for interest management over DDS. Each SynDDSMessage
+// carries the region occupied by the agents of the sending node; a reader only
+// accepts the samples whose region is within the interest radius of its own
+// region. The filter is evaluated on the writer side, so filtered samples are
+// never sent over the wire.
+//
+// The generated SynDDSMessage type has no type object, so a custom filter
+// (which decodes the serialized region directly) is used instead of the
+// default SQL filter. The filter parameters are, in order, the 6 coordinates
+// of the reader region (min x, y, z, max x, y, z) and the interest radius.
+//
+// =============================================================================
+
+#ifndef SYN_DDS_INTEREST_FILTER_H
+#define SYN_DDS_INTEREST_FILTER_H
+
+#include "chrono_synchrono/SynApi.h"
+#include "chrono_synchrono/communication/SynCommunicator.h"
+
+#undef ALIVE
+
+#include <fastdds/dds/topic/IContentFilter.hpp>
+#include <fastdds/dds/topic/IContentFilterFactory.hpp>
+
+#include <string>
+#include <vector>
+
+namespace chrono {
+namespace synchrono {
+
+/// @addtogroup synchrono_communication_dds
+/// @{
+
+/// Name under which the interest filter factory is registered with a participant
+const std::string interest_filter_class = std::string("SYN_INTEREST");
+
+/// Content filter accepting the SynDDSMessage samples within the interest radius of the reader region
+class SynDDSInterestFilter : public eprosima::fastdds::dds::IContentFilter {
+  public:
+    SynDDSInterestFilter() : m_radius(0) {}
+
+    /// Set the reader region and interest radius from the filter parameters
+    bool SetParameters(const eprosima::fastdds::dds::IContentFilterFactory::ParameterSeq& parameters);
+
+    virtual bool evaluate(const SerializedPayload& payload,
+                          const FilterSampleInfo& sample_info,
+                          const GUID_t& reader_guid) const override;
+
+    /// Convert a reader region and interest radius to filter parameters
+    static std::vector<std::string> ToParameters(const SynInterestRegion& region, double radius);
+
+  private:
+    SynInterestRegion m_region;  ///< region of the reader node
+    double m_radius;             ///< interest radius
+};
+
+/// Factory creating the interest filters of the content filtered topics of a participant
+class SynDDSInterestFilterFactory : public eprosima::fastdds::dds::IContentFilterFactory {
+  public:
+    virtual eprosima::fastrtps::types::ReturnCode_t create_content_filter(
+        const char* filter_class_name,
+        const char* type_name,
+        const eprosima::fastdds::dds::TopicDataType* data_type,
+        const char* filter_expression,
+        const ParameterSeq& filter_parameters,
+        eprosima::fastdds::dds::IContentFilter*& filter_instance) override;
+
+    virtual eprosima::fastrtps::types::ReturnCode_t delete_content_filter(
+        const char* filter_class_name,
+        eprosima::fastdds::dds::IContentFilter* filter_instance) override;
+};
+
+/// @} synchrono_communication
+
+}  // namespace synchrono
+}  // namespace chrono
+
+#endif
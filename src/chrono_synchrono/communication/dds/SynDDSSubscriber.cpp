@@ -36,7 +36,9 @@ SynDDSSubscriber::SynDDSSubscriber(Subscriber* subscriber,
       m_listener(listener),
       m_topic(topic),
       m_message(message),
-      m_callback(callback) {}
+      m_callback(callback),
+      m_filtered_topic(nullptr),
+      m_is_near(true) {}
 
 SynDDSSubscriber::~SynDDSSubscriber() {}
 
@@ -47,31 +49,34 @@ void SynDDSSubscriber::DeleteDDSEntities(DomainParticipant* participant) {
         participant->delete_subscriber(m_subscriber);
 }
 
-void SynDDSSubscriber::Receive(long double wait_time) {
+bool SynDDSSubscriber::Receive(long double wait_time) {
     if (!m_callback) {
         std::cerr << "WARNING: Subscriber callback has not been defined! Synchronous read is ignored." << std::endl;
-        return;
+        return false;
     }
 
     if (!m_message) {
         std::cerr << "WARNING: Subscriber message has not been defined! Synchronous read is ignored." << std::endl;
-        return;
+        return false;
     }
 
     eprosima::fastrtps::Duration_t timeout(wait_time);
-    if (m_reader->wait_for_unread_message(timeout)) {
+    if (wait_time > 0 ? m_reader->wait_for_unread_message(timeout) : m_reader->get_unread_count() > 0) {
         SampleInfo info;
         if (m_reader->take_next_sample(m_message, &info) == ReturnCode_t::RETCODE_OK) {
             if (info.instance_state == ALIVE_INSTANCE_STATE) {
                 m_callback(m_message);
+                return true;
             } else {
                 std::cout << "Remote writer for topic " << m_topic->GetFullTopicName() << " is dead" << std::endl;
             }
         }
-    } else {
+    } else if (wait_time > 0) {
         std::cerr << "WARNING: SynDDSSubscriber timed out while waiting for incoming message on topic "
                   << m_topic->GetFullTopicName() << std::endl;
     }
+
+    return false;
 }
 
 void SynDDSSubscriber::AsyncReceive() {
@@ -43,6 +43,7 @@ class DomainParticipant;
 class TypeSupport;
 class Subscriber;
 class DataReader;
+class ContentFilteredTopic;
 
 }  // namespace dds
 }  // namespace fastdds
@@ -83,10 +84,11 @@ class SYN_API SynDDSSubscriber {
     ///@brief This function is responsible for synchronous receiving
     /// This will block until a message has been received. When a message is received,
     /// the passed function is called and the received data is passed as a parameter
-    /// to the callback.
+    /// to the callback. A wait time of zero polls for a message without warning if none is available.
     ///
     ///@param wait_time timeout of the synchronous waiting
-    void Receive(long double wait_time = 20.0);
+    ///@return whether a message was received
+    bool Receive(long double wait_time = 20.0);
 
     ////@brief This function is responsible for asynchronous receiving
     /// This function will return immediately. Underlying calls are asynchronous/non-blocking.
@@ -140,6 +142,9 @@ class SYN_API SynDDSSubscriber {
 
     std::function<void(void*)> m_callback;  ///< callback for each receive
 
+    eprosima::fastdds::dds::ContentFilteredTopic* m_filtered_topic;  ///< interest filter on the topic (if any)
+    bool m_is_near;                                                  ///< did the last message come from a nearby node?
+
 	friend class SynDDSCommunicator;
 };
 
@@ -64,6 +64,10 @@ class SynDDSTopic {
     ///
     std::string GetFullTopicName();
 
+    ///@brief Get the name of the topic data type
+    ///
+    const std::string& GetTypeName() const { return m_type_name; }
+
     ///@brief Get the DDS topic object
     ///
     eprosima::fastdds::dds::Topic* GetDDSTopic() { return m_dds_topic; }
@@ -33,11 +33,14 @@ char dummy;
 using namespace eprosima::fastcdr::exception;
 
 #include <utility>
+#include <cstring>
 
 SynDDSMessage::SynDDSMessage()
 {
     // m_rank com.eprosima.idl.parser.typecode.PrimitiveTypeCode@614ddd49
     m_rank = 0;
+    // m_region com.eprosima.idl.parser.typecode.ArrayTypeCode@3c0ecd4b
+    memset(&m_region, 0, (6) * 8);
     // m_data com.eprosima.idl.parser.typecode.SequenceTypeCode@694e1548
 
 
@@ -53,6 +56,7 @@ SynDDSMessage::SynDDSMessage(
         const SynDDSMessage& x)
 {
     m_rank = x.m_rank;
+    m_region = x.m_region;
     m_data = x.m_data;
 }
 
@@ -60,6 +64,7 @@ SynDDSMessage::SynDDSMessage(
         SynDDSMessage&& x)
 {
     m_rank = x.m_rank;
+    m_region = std::move(x.m_region);
     m_data = std::move(x.m_data);
 }
 
@@ -68,6 +73,7 @@ SynDDSMessage& SynDDSMessage::operator =(
 {
 
     m_rank = x.m_rank;
+    m_region = x.m_region;
     m_data = x.m_data;
 
     return *this;
@@ -78,6 +84,7 @@ SynDDSMessage& SynDDSMessage::operator =(
 {
 
     m_rank = x.m_rank;
+    m_region = std::move(x.m_region);
     m_data = std::move(x.m_data);
 
     return *this;
@@ -92,6 +99,9 @@ size_t SynDDSMessage::getMaxCdrSerializedSize(
     current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
+    current_alignment += ((6) * 8) + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
     current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
     current_alignment += (100 * 1) + eprosima::fastcdr::Cdr::alignment(current_alignment, 1);
@@ -113,6 +123,9 @@ size_t SynDDSMessage::getCdrSerializedSize(
     current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
+    current_alignment += ((6) * 8) + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
     current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
     if (data.data().size() > 0)
@@ -131,6 +144,7 @@ void SynDDSMessage::serialize(
 {
 
     scdr << m_rank;
+    scdr << m_region;
     scdr << m_data;
 
 }
@@ -140,6 +154,7 @@ void SynDDSMessage::deserialize(
 {
 
     dcdr >> m_rank;
+    dcdr >> m_region;
     dcdr >> m_data;
 }
 
@@ -171,6 +186,43 @@ uint32_t& SynDDSMessage::rank()
     return m_rank;
 }
 
+/*!
+ * @brief This function copies the value in member region
+ * @param _region New value to be copied in member region
+ */
+void SynDDSMessage::region(
+        const std::array<double, 6>& _region)
+{
+    m_region = _region;
+}
+
+/*!
+ * @brief This function moves the value in member region
+ * @param _region New value to be moved in member region
+ */
+void SynDDSMessage::region(
+        std::array<double, 6>&& _region)
+{
+    m_region = std::move(_region);
+}
+
+/*!
+ * @brief This function returns a constant reference to member region
+ * @return Constant reference to member region
+ */
+const std::array<double, 6>& SynDDSMessage::region() const
+{
+    return m_region;
+}
+
+/*!
+ * @brief This function returns a reference to member region
+ * @return Reference to member region
+ */
+std::array<double, 6>& SynDDSMessage::region()
+{
+    return m_region;
+}
 /*!
  * @brief This function copies the value in member data
  * @param _data New value to be copied in member data
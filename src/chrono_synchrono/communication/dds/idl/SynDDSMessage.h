@@ -126,6 +126,31 @@ public:
      */
     eProsima_user_DllExport uint32_t& rank();
 
+    /*!
+     * @brief This function copies the value in member region
+     * @param _region New value to be copied in member region
+     */
+    eProsima_user_DllExport void region(
+            const std::array<double, 6>& _region);
+
+    /*!
+     * @brief This function moves the value in member region
+     * @param _region New value to be moved in member region
+     */
+    eProsima_user_DllExport void region(
+            std::array<double, 6>&& _region);
+
+    /*!
+     * @brief This function returns a constant reference to member region
+     * @return Constant reference to member region
+     */
+    eProsima_user_DllExport const std::array<double, 6>& region() const;
+
+    /*!
+     * @brief This function returns a reference to member region
+     * @return Reference to member region
+     */
+    eProsima_user_DllExport std::array<double, 6>& region();
     /*!
      * @brief This function copies the value in member data
      * @param _data New value to be copied in member data
@@ -212,6 +237,7 @@ public:
 private:
 
     uint32_t m_rank;
+    std::array<double, 6> m_region;
     std::vector<uint8_t> m_data;
 };
 
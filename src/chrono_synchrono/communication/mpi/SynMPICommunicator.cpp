@@ -21,14 +21,17 @@
 //
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono_synchrono/communication/mpi/SynMPICommunicator.h"
 
 namespace chrono {
 namespace synchrono {
 
-SynMPICommunicator::SynMPICommunicator(int argc, char* argv[]) {
+SynMPICommunicator::SynMPICommunicator(int argc, char* argv[]) : m_neighbor_comm(MPI_COMM_NULL) {
     // mpi initialization
-    MPI_Init(&argc, &argv);
+    // Request serialized thread support, so that the exchange can run on a communication thread
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_SERIALIZED, &m_thread_level);
     // set rank
     MPI_Comm_rank(MPI_COMM_WORLD, &m_rank);
     // set number of ranks in this simulation
@@ -44,6 +47,9 @@ SynMPICommunicator::~SynMPICommunicator() {
     delete[] m_msg_lengths;
     delete[] m_msg_displs;
 
+    if (m_neighbor_comm != MPI_COMM_NULL)
+        MPI_Comm_free(&m_neighbor_comm);
+
     MPI_Finalize();
 }
 
@@ -52,17 +58,30 @@ void SynMPICommunicator::Synchronize() {
 
     int msg_length = m_flatbuffers_manager.GetSize();
 
-    // Get the length of message from each agent
-    MPI_Allgather(&msg_length, 1, MPI_INT,    // Sending pointer, length, type
-                  m_msg_lengths, 1, MPI_INT,  // Receiving pointer, length, type
-                  MPI_COMM_WORLD);            // Receiving rank and world
+    // With interest management, only exchange messages with the neighbors of this rank
+    if (m_interest_radius > 0)
+        UpdateNeighbors();
+
+    if (m_neighbor_comm == MPI_COMM_NULL) {
+        // Get the length of message from each agent
+        MPI_Allgather(&msg_length, 1, MPI_INT,    // Sending pointer, length, type
+                      m_msg_lengths, 1, MPI_INT,  // Receiving pointer, length, type
+                      MPI_COMM_WORLD);            // Receiving rank and world
+    } else {
+        // Get the length of message from each neighbor (in the order of m_neighbors)
+        MPI_Neighbor_allgather(&msg_length, 1, MPI_INT,    // Sending pointer, length, type
+                               m_msg_lengths, 1, MPI_INT,  // Receiving pointer, length, type
+                               m_neighbor_comm);           // Neighborhood of this rank
+    }
+
+    int num_sources = m_neighbor_comm == MPI_COMM_NULL ? m_num_ranks : (int)m_neighbors.size();
 
     m_total_length = 0;
 
     // In C++17 this could just be an exclusive scan from std::
     // Didn't use std::partial_sum since we want m_total_length computed
     // m_msg_displs is needed by MPI_Gatherv
-    for (int i = 0; i < m_num_ranks; i++) {
+    for (int i = 0; i < num_sources; i++) {
         m_msg_displs[i] = m_total_length;
         m_total_length += m_msg_lengths[i];
     }
@@ -70,27 +89,83 @@ void SynMPICommunicator::Synchronize() {
     // if (m_rank == 0)
     //     std::cout << m_rank << " message length: " << m_total_length << std::endl;
 
-    m_all_data.reserve(m_total_length);
+    m_all_data.resize(m_total_length);
 
-    MPI_Allgatherv(m_flatbuffers_manager.GetBufferPointer(), msg_length, MPI_BYTE,  // Sending pointer, length, type
-                   m_all_data.data(), m_msg_lengths, m_msg_displs,
-                   MPI_BYTE,  // Receiving pointer, lengths, displacements, type
-                   MPI_COMM_WORLD);
+    if (m_neighbor_comm == MPI_COMM_NULL) {
+        MPI_Allgatherv(m_flatbuffers_manager.GetBufferPointer(), msg_length, MPI_BYTE,  // Sending pointer, length, type
+                       m_all_data.data(), m_msg_lengths, m_msg_displs,
+                       MPI_BYTE,  // Receiving pointer, lengths, displacements, type
+                       MPI_COMM_WORLD);
+    } else {
+        MPI_Neighbor_allgatherv(m_flatbuffers_manager.GetBufferPointer(), msg_length, MPI_BYTE,
+                                m_all_data.data(), m_msg_lengths, m_msg_displs, MPI_BYTE, m_neighbor_comm);
+    }
 
     m_flatbuffers_manager.Reset();
 }
 
 SynMessageList& SynMPICommunicator::GetMessages() {
-    for (int i = 0; i < m_num_ranks; i++) {
-        if (i != m_rank) {
-            std::vector<uint8_t> data = std::vector<uint8_t>(m_all_data.data() + m_msg_displs[i],
-                                                             m_all_data.data() + m_msg_displs[i] + m_msg_lengths[i]);
-            m_flatbuffers_manager.ProcessBuffer(data, m_incoming_messages);
+    if (m_neighbor_comm == MPI_COMM_NULL) {
+        for (int i = 0; i < m_num_ranks; i++) {
+            if (i != m_rank)
+                m_flatbuffers_manager.ProcessBuffer(m_all_data.data() + m_msg_displs[i], m_incoming_messages);
         }
+    } else {
+        // The neighborhood never includes this rank
+        for (size_t k = 0; k < m_neighbors.size(); k++)
+            m_flatbuffers_manager.ProcessBuffer(m_all_data.data() + m_msg_displs[k], m_incoming_messages);
     }
 
     return m_incoming_messages;
 }
 
+std::vector<int> SynMPICommunicator::GetNeighbors() const {
+    if (m_neighbor_comm != MPI_COMM_NULL)
+        return m_neighbors;
+
+    std::vector<int> neighbors;
+    for (int i = 0; i < m_num_ranks; i++)
+        if (i != m_rank)
+            neighbors.push_back(i);
+    return neighbors;
+}
+
+void SynMPICommunicator::UpdateNeighbors() {
+    // Only the (small, fixed size) regions are gathered from all ranks
+    const ChVector3d& min = m_interest_region.min;
+    const ChVector3d& max = m_interest_region.max;
+    double local[7] = {min.x(), min.y(), min.z(), max.x(), max.y(), max.z(), m_interest_radius};
+
+    m_regions.resize(7 * m_num_ranks);
+    MPI_Allgather(local, 7, MPI_DOUBLE, m_regions.data(), 7, MPI_DOUBLE, MPI_COMM_WORLD);
+
+    // Use the larger of the two radii so that the neighborhood relation is symmetric
+    std::vector<int> neighbors;
+    for (int i = 0; i < m_num_ranks; i++) {
+        if (i == m_rank)
+            continue;
+        const double* r = &m_regions[7 * i];
+        SynInterestRegion region(ChVector3d(r[0], r[1], r[2]), ChVector3d(r[3], r[4], r[5]));
+        if (m_interest_region.Overlaps(region, std::max(m_interest_radius, r[6])))
+            neighbors.push_back(i);
+    }
+
+    // The graph communicator is created collectively, so rebuild it only if any neighborhood changed
+    int changed = (m_neighbor_comm == MPI_COMM_NULL || neighbors != m_neighbors) ? 1 : 0;
+    MPI_Allreduce(MPI_IN_PLACE, &changed, 1, MPI_INT, MPI_LOR, MPI_COMM_WORLD);
+    if (!changed)
+        return;
+
+    if (m_neighbor_comm != MPI_COMM_NULL)
+        MPI_Comm_free(&m_neighbor_comm);
+
+    m_neighbors = neighbors;
+    int num_neighbors = (int)m_neighbors.size();
+    MPI_Dist_graph_create_adjacent(MPI_COMM_WORLD,                                     //
+                                   num_neighbors, m_neighbors.data(), MPI_UNWEIGHTED,  // Sources
+                                   num_neighbors, m_neighbors.data(), MPI_UNWEIGHTED,  // Destinations
+                                   MPI_INFO_NULL, 0, &m_neighbor_comm);
+}
+
 }  // namespace synchrono
 }  // namespace chrono
\ No newline at end of file
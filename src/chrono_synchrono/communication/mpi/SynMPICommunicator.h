@@ -68,6 +68,11 @@ class SYN_API SynMPICommunicator : public SynCommunicator {
     ///
     virtual void Barrier() override { MPI_Barrier(MPI_COMM_WORLD); }
 
+    ///@brief Can Synchronize be called from another thread?
+    /// Only if the MPI implementation provides (at least) MPI_THREAD_SERIALIZED.
+    ///
+    virtual bool IsThreadSafe() const override { return m_thread_level >= MPI_THREAD_SERIALIZED; }
+
     // -----------------------------------------------------------------------------------------------
 
     ///@brief Get the messages received by the communicator
@@ -83,17 +88,32 @@ class SYN_API SynMPICommunicator : public SynCommunicator {
     ///
     virtual unsigned int GetNumRanks() const { return m_num_ranks; }
 
+    ///@brief Get the ranks this rank currently exchanges messages with
+    /// All other ranks, unless interest management is enabled.
+    ///
+    std::vector<int> GetNeighbors() const;
+
     // -----------------------------------------------------------------------------------------------
 
   private:
+    ///@brief Exchange the interest regions and update the neighborhood of this rank
+    /// The neighborhood graph communicator is rebuilt (collectively) only if the neighborhood of any rank changed.
+    ///
+    void UpdateNeighbors();
+
     int m_rank;
     int m_num_ranks;
+    int m_thread_level;  ///< level of thread support provided by the MPI implementation
 
     int m_total_length;
 
     int* m_msg_lengths;
     int* m_msg_displs;
 
+    MPI_Comm m_neighbor_comm;       ///< graph communicator over the neighbors (MPI_COMM_NULL if not filtering)
+    std::vector<int> m_neighbors;   ///< ranks within the interest radius of this rank
+    std::vector<double> m_regions;  ///< interest regions and radii of all ranks
+
     std::vector<uint8_t> m_rank_data;
     std::vector<uint8_t> m_all_data;
 };
@@ -31,11 +31,45 @@ SynFlatBuffersManager::SynFlatBuffersManager(int msg_length) : m_builder(msg_len
     Finish();
 }
 
-void SynFlatBuffersManager::ProcessBuffer(std::vector<uint8_t>& data, SynMessageList& messages) {
-    auto buffer = flatbuffers::GetSizePrefixedRoot<SynFlatBuffers::Buffer>(data.data());
+// Type of the state carried by a message, or -1 for the messages that are not recycled. Only the state messages
+// whose conversion from flatbuffers overwrites all of their data are recycled.
+static int GetRecycledStateType(const SynFlatBuffers::Message* message) {
+    if (message->message_type() == SynFlatBuffers::Type_Agent_State) {
+        auto type = message->message_as_Agent_State()->message_type();
+        if (type == SynFlatBuffers::Agent::Type_WheeledVehicle_State ||
+            type == SynFlatBuffers::Agent::Type_TrackedVehicle_State ||
+            type == SynFlatBuffers::Agent::Type_Copter_State)
+            return type;
+    } else if (message->message_type() == SynFlatBuffers::Type_Terrain_State) {
+        auto type = message->message_as_Terrain_State()->message_type();
+        if (type == SynFlatBuffers::Terrain::Type_SCM_State)
+            return type;
+    }
+    return -1;
+}
+
+void SynFlatBuffersManager::ProcessBuffer(const uint8_t* data, SynMessageList& messages) {
+    std::lock_guard<std::mutex> lock(m_pool_mutex);
+
+    auto buffer = flatbuffers::GetSizePrefixedRoot<SynFlatBuffers::Buffer>(data);
     for (auto message : (*buffer->buffer())) {
-        auto msg = SynMessageFactory::GenerateMessage(message);
-        messages.push_back(msg);
+        int state_type = GetRecycledStateType(message);
+        if (state_type < 0) {
+            messages.push_back(SynMessageFactory::GenerateMessage(message));
+            continue;
+        }
+
+        // A pooled message only referenced by the pool is no longer in use and can be overwritten
+        auto source = message->source_key();
+        auto key = std::make_tuple(AgentKey(source->node_id(), source->agent_id()), (int)message->message_type(),
+                                   state_type);
+        auto& pooled = m_message_pool[key];
+        if (pooled && pooled.use_count() == 1)
+            pooled->ConvertFromFlatBuffers(message);
+        else
+            pooled = SynMessageFactory::GenerateMessage(message);
+
+        messages.push_back(pooled);
     }
 }
 
@@ -21,6 +21,9 @@
 #ifndef SYN_FLATBUFFERS_MANAGER_H
 #define SYN_FLATBUFFERS_MANAGER_H
 
+#include <map>
+#include <mutex>
+#include <tuple>
 #include <vector>
 
 #include "chrono_synchrono/SynApi.h"
@@ -51,7 +54,16 @@ class SYN_API SynFlatBuffersManager {
     ///
     ///@param data the data to process
     ///@param messages reference to message list to store the parsed messages
-    void ProcessBuffer(std::vector<uint8_t>& data, SynMessageList& messages);
+    void ProcessBuffer(std::vector<uint8_t>& data, SynMessageList& messages) { ProcessBuffer(data.data(), messages); }
+
+    ///@brief Process a size prefixed SynFlatBuffers::Buffer message in place
+    /// The messages are read directly from the received data (e.g. a slice of the MPI receive buffer), without copy.
+    /// State messages are recycled: the message last created for the same agent and type is updated in place if it
+    /// is no longer referenced outside of this manager.
+    ///
+    ///@param data pointer to the data to process
+    ///@param messages reference to message list to store the parsed messages
+    void ProcessBuffer(const uint8_t* data, SynMessageList& messages);
 
     ///@brief Adds a SynMessage to the flatbuffer message buffer. Will call MessageFromState automatically
     ///
@@ -111,6 +123,10 @@ class SYN_API SynFlatBuffersManager {
 
     SynMessageList m_messages;                       ///< vector of SynMessages
     SynFlatBufferMessageList m_flatbuffer_messages;  ///< vector of SynFlatBuffers messages
+
+    /// Received state messages, per source agent, message type and state type, recycled by ProcessBuffer
+    std::map<std::tuple<AgentKey, int, int>, std::shared_ptr<SynMessage>> m_message_pool;
+    std::mutex m_pool_mutex;  ///< buffers may be processed concurrently (e.g. by DDS listener threads)
 };
 
 /// @} synchrono_flatbuffer
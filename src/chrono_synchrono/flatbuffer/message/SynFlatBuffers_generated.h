@@ -873,17 +873,26 @@ namespace WheeledVehicle {
 
 struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     typedef StateBuilder Builder;
-    enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE { VT_TIME = 4, VT_CHASSIS = 6, VT_WHEELS = 8 };
+    enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+        VT_TIME = 4,
+        VT_CHASSIS = 6,
+        VT_WHEELS = 8,
+        VT_COMPRESSED = 10
+    };
     double time() const { return GetField<double>(VT_TIME, 0.0); }
     const SynFlatBuffers::Pose* chassis() const { return GetPointer<const SynFlatBuffers::Pose*>(VT_CHASSIS); }
     const flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* wheels() const {
         return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>*>(VT_WHEELS);
     }
+    const flatbuffers::Vector<uint8_t>* compressed() const {
+        return GetPointer<const flatbuffers::Vector<uint8_t>*>(VT_COMPRESSED);
+    }
     bool Verify(flatbuffers::Verifier& verifier) const {
         return VerifyTableStart(verifier) && VerifyField<double>(verifier, VT_TIME) &&
                VerifyOffset(verifier, VT_CHASSIS) && verifier.VerifyTable(chassis()) &&
                VerifyOffset(verifier, VT_WHEELS) && verifier.VerifyVector(wheels()) &&
-               verifier.VerifyVectorOfTables(wheels()) && verifier.EndTable();
+               verifier.VerifyVectorOfTables(wheels()) && VerifyOffset(verifier, VT_COMPRESSED) &&
+               verifier.VerifyVector(compressed()) && verifier.EndTable();
     }
 };
 
@@ -896,6 +905,9 @@ struct StateBuilder {
     void add_wheels(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> wheels) {
         fbb_.AddOffset(State::VT_WHEELS, wheels);
     }
+    void add_compressed(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> compressed) {
+        fbb_.AddOffset(State::VT_COMPRESSED, compressed);
+    }
     explicit StateBuilder(flatbuffers::FlatBufferBuilder& _fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
     flatbuffers::Offset<State> Finish() {
         const auto end = fbb_.EndTable(start_);
@@ -908,9 +920,11 @@ inline flatbuffers::Offset<State> CreateState(
     flatbuffers::FlatBufferBuilder& _fbb,
     double time = 0.0,
     flatbuffers::Offset<SynFlatBuffers::Pose> chassis = 0,
-    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> wheels = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> wheels = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> compressed = 0) {
     StateBuilder builder_(_fbb);
     builder_.add_time(time);
+    builder_.add_compressed(compressed);
     builder_.add_wheels(wheels);
     builder_.add_chassis(chassis);
     return builder_.Finish();
@@ -920,9 +934,11 @@ inline flatbuffers::Offset<State> CreateStateDirect(
     flatbuffers::FlatBufferBuilder& _fbb,
     double time = 0.0,
     flatbuffers::Offset<SynFlatBuffers::Pose> chassis = 0,
-    const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* wheels = nullptr) {
+    const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* wheels = nullptr,
+    const std::vector<uint8_t>* compressed = nullptr) {
     auto wheels__ = wheels ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*wheels) : 0;
-    return SynFlatBuffers::Agent::WheeledVehicle::CreateState(_fbb, time, chassis, wheels__);
+    auto compressed__ = compressed ? _fbb.CreateVector<uint8_t>(*compressed) : 0;
+    return SynFlatBuffers::Agent::WheeledVehicle::CreateState(_fbb, time, chassis, wheels__, compressed__);
 }
 
 struct Description FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -1011,7 +1027,8 @@ struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
         VT_TRACK_SHOES = 8,
         VT_SPROCKETS = 10,
         VT_IDLERS = 12,
-        VT_ROAD_WHEELS = 14
+        VT_ROAD_WHEELS = 14,
+        VT_COMPRESSED = 16
     };
     double time() const { return GetField<double>(VT_TIME, 0.0); }
     const SynFlatBuffers::Pose* chassis() const { return GetPointer<const SynFlatBuffers::Pose*>(VT_CHASSIS); }
@@ -1027,6 +1044,9 @@ struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     const flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* road_wheels() const {
         return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>*>(VT_ROAD_WHEELS);
     }
+    const flatbuffers::Vector<uint8_t>* compressed() const {
+        return GetPointer<const flatbuffers::Vector<uint8_t>*>(VT_COMPRESSED);
+    }
     bool Verify(flatbuffers::Verifier& verifier) const {
         return VerifyTableStart(verifier) && VerifyField<double>(verifier, VT_TIME) &&
                VerifyOffset(verifier, VT_CHASSIS) && verifier.VerifyTable(chassis()) &&
@@ -1036,7 +1056,7 @@ struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
                VerifyOffset(verifier, VT_IDLERS) && verifier.VerifyVector(idlers()) &&
                verifier.VerifyVectorOfTables(idlers()) && VerifyOffset(verifier, VT_ROAD_WHEELS) &&
                verifier.VerifyVector(road_wheels()) && verifier.VerifyVectorOfTables(road_wheels()) &&
-               verifier.EndTable();
+               VerifyOffset(verifier, VT_COMPRESSED) && verifier.VerifyVector(compressed()) && verifier.EndTable();
     }
 };
 
@@ -1060,6 +1080,9 @@ struct StateBuilder {
         flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> road_wheels) {
         fbb_.AddOffset(State::VT_ROAD_WHEELS, road_wheels);
     }
+    void add_compressed(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> compressed) {
+        fbb_.AddOffset(State::VT_COMPRESSED, compressed);
+    }
     explicit StateBuilder(flatbuffers::FlatBufferBuilder& _fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
     flatbuffers::Offset<State> Finish() {
         const auto end = fbb_.EndTable(start_);
@@ -1075,9 +1098,11 @@ inline flatbuffers::Offset<State> CreateState(
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> track_shoes = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> sprockets = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> idlers = 0,
-    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> road_wheels = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> road_wheels = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> compressed = 0) {
     StateBuilder builder_(_fbb);
     builder_.add_time(time);
+    builder_.add_compressed(compressed);
     builder_.add_road_wheels(road_wheels);
     builder_.add_idlers(idlers);
     builder_.add_sprockets(sprockets);
@@ -1093,13 +1118,15 @@ inline flatbuffers::Offset<State> CreateStateDirect(
     const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* track_shoes = nullptr,
     const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* sprockets = nullptr,
     const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* idlers = nullptr,
-    const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* road_wheels = nullptr) {
+    const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* road_wheels = nullptr,
+    const std::vector<uint8_t>* compressed = nullptr) {
     auto track_shoes__ = track_shoes ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*track_shoes) : 0;
     auto sprockets__ = sprockets ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*sprockets) : 0;
     auto idlers__ = idlers ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*idlers) : 0;
     auto road_wheels__ = road_wheels ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*road_wheels) : 0;
+    auto compressed__ = compressed ? _fbb.CreateVector<uint8_t>(*compressed) : 0;
     return SynFlatBuffers::Agent::TrackedVehicle::CreateState(_fbb, time, chassis, track_shoes__, sprockets__, idlers__,
-                                                              road_wheels__);
+                                                              road_wheels__, compressed__);
 }
 
 struct Description FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -1734,14 +1761,18 @@ namespace SCM {
 
 struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     typedef StateBuilder Builder;
-    enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE { VT_TIME = 4, VT_NODES = 6 };
+    enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE { VT_TIME = 4, VT_NODES = 6, VT_DATA = 8 };
     double time() const { return GetField<double>(VT_TIME, 0.0); }
     const flatbuffers::Vector<const SynFlatBuffers::Terrain::SCM::NodeLevel*>* nodes() const {
         return GetPointer<const flatbuffers::Vector<const SynFlatBuffers::Terrain::SCM::NodeLevel*>*>(VT_NODES);
     }
+    const flatbuffers::Vector<uint8_t>* data() const {
+        return GetPointer<const flatbuffers::Vector<uint8_t>*>(VT_DATA);
+    }
     bool Verify(flatbuffers::Verifier& verifier) const {
         return VerifyTableStart(verifier) && VerifyField<double>(verifier, VT_TIME) &&
-               VerifyOffset(verifier, VT_NODES) && verifier.VerifyVector(nodes()) && verifier.EndTable();
+               VerifyOffset(verifier, VT_NODES) && verifier.VerifyVector(nodes()) && VerifyOffset(verifier, VT_DATA) &&
+               verifier.VerifyVector(data()) && verifier.EndTable();
     }
 };
 
@@ -1753,6 +1784,7 @@ struct StateBuilder {
     void add_nodes(flatbuffers::Offset<flatbuffers::Vector<const SynFlatBuffers::Terrain::SCM::NodeLevel*>> nodes) {
         fbb_.AddOffset(State::VT_NODES, nodes);
     }
+    void add_data(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data) { fbb_.AddOffset(State::VT_DATA, data); }
     explicit StateBuilder(flatbuffers::FlatBufferBuilder& _fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
     flatbuffers::Offset<State> Finish() {
         const auto end = fbb_.EndTable(start_);
@@ -1764,9 +1796,11 @@ struct StateBuilder {
 inline flatbuffers::Offset<State> CreateState(
     flatbuffers::FlatBufferBuilder& _fbb,
     double time = 0.0,
-    flatbuffers::Offset<flatbuffers::Vector<const SynFlatBuffers::Terrain::SCM::NodeLevel*>> nodes = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<const SynFlatBuffers::Terrain::SCM::NodeLevel*>> nodes = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data = 0) {
     StateBuilder builder_(_fbb);
     builder_.add_time(time);
+    builder_.add_data(data);
     builder_.add_nodes(nodes);
     return builder_.Finish();
 }
@@ -1774,9 +1808,11 @@ inline flatbuffers::Offset<State> CreateState(
 inline flatbuffers::Offset<State> CreateStateDirect(
     flatbuffers::FlatBufferBuilder& _fbb,
     double time = 0.0,
-    const std::vector<SynFlatBuffers::Terrain::SCM::NodeLevel>* nodes = nullptr) {
+    const std::vector<SynFlatBuffers::Terrain::SCM::NodeLevel>* nodes = nullptr,
+    const std::vector<uint8_t>* data = nullptr) {
     auto nodes__ = nodes ? _fbb.CreateVectorOfStructs<SynFlatBuffers::Terrain::SCM::NodeLevel>(*nodes) : 0;
-    return SynFlatBuffers::Terrain::SCM::CreateState(_fbb, time, nodes__);
+    auto data__ = data ? _fbb.CreateVector<uint8_t>(*data) : 0;
+    return SynFlatBuffers::Terrain::SCM::CreateState(_fbb, time, nodes__, data__);
 }
 
 }  // namespace SCM
@@ -42,7 +42,11 @@ void SynSCMMessage::ConvertFromFlatBuffers(const SynFlatBuffers::Message* messag
     auto terrain_state = message->message_as_Terrain_State();
     auto state = terrain_state->message_as_SCM_State();
 
-    auto nodes_size = state->nodes()->size();
+    encoded_nodes.clear();
+    if (state->data())
+        encoded_nodes.assign(state->data()->begin(), state->data()->end());
+
+    auto nodes_size = state->nodes() ? state->nodes()->size() : 0;
     modified_nodes.clear();
     modified_nodes.reserve(nodes_size);
     for (size_t i = 0; i < nodes_size; i++) {
@@ -61,7 +65,8 @@ FlatBufferMessage SynSCMMessage::ConvertToFlatBuffers(flatbuffers::FlatBufferBui
     for (const auto& node : this->modified_nodes)
         modified_nodes.push_back(SCM::NodeLevel(node.first.x(), node.first.y(), node.second));
 
-    auto scm_state = SCM::CreateStateDirect(builder, time, &modified_nodes);
+    auto scm_state = encoded_nodes.empty() ? SCM::CreateStateDirect(builder, time, &modified_nodes)
+                                           : SCM::CreateStateDirect(builder, time, nullptr, &encoded_nodes);
 
     auto flatbuffer_state = Terrain::CreateState(builder, Terrain::Type::Type_SCM_State, scm_state.Union());
     auto flatbuffer_message =
@@ -51,7 +51,10 @@ class SYN_API SynSCMMessage : public SynMessage {
     ///@return FlatBufferMessage the constructed flatbuffer message
     virtual FlatBufferMessage ConvertToFlatBuffers(flatbuffers::FlatBufferBuilder& builder) const override;
 
-    std::vector<vehicle::SCMTerrain::NodeLevel> modified_nodes;
+    std::vector<vehicle::SCMTerrain::NodeLevel> modified_nodes;  ///< modified node levels
+
+    /// Modified node levels, encoded with vehicle::SCMTerrainStream (if not empty, used instead of modified_nodes).
+    std::vector<uint8_t> encoded_nodes;
 };
 
 /// @} synchrono_flatbuffer
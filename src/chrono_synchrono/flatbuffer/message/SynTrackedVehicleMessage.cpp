@@ -43,6 +43,48 @@ void SynTrackedVehicleStateMessage::SetState(double time,
     this->sprockets = sprockets;
     this->idlers = idlers;
     this->road_wheels = road_wheels;
+
+    if (m_compressor) {
+        std::vector<ChFrameMoving<>> frames;
+        frames.reserve(1 + track_shoes.size() + sprockets.size() + idlers.size() + road_wheels.size());
+        frames.push_back(this->chassis.GetFrame());
+        for (auto parts : {&this->track_shoes, &this->sprockets, &this->idlers, &this->road_wheels})
+            for (auto& part : *parts)
+                frames.push_back(part.GetFrame());
+        m_compressor->Encode(frames, compressed);
+    }
+}
+
+void SynTrackedVehicleStateMessage::SetCompression(bool val, int keyframe_interval) {
+    m_compressor = val ? chrono_types::make_shared<SynPoseCompressor>(1e-3, keyframe_interval) : nullptr;
+    compressed.clear();
+}
+
+bool SynTrackedVehicleStateMessage::Decompress(SynPoseCompressor& decoder,
+                                               const SynTrackedVehicleDescriptionMessage& description) {
+    if (compressed.empty())
+        return true;
+
+    std::vector<ChFrameMoving<>> frames;
+    size_t num_frames = 1 + description.num_track_shoes + description.num_sprockets + description.num_idlers +
+                        description.num_road_wheels;
+    if (!decoder.Decode(compressed, frames) || frames.size() != num_frames)
+        return false;
+
+    chassis = SynPose(frames[0]);
+    size_t index = 1;
+    auto extract = [&](std::vector<SynPose>& parts, int num_parts) {
+        parts.clear();
+        for (int i = 0; i < num_parts; i++)
+            parts.emplace_back(frames[index++]);
+    };
+    extract(track_shoes, description.num_track_shoes);
+    extract(sprockets, description.num_sprockets);
+    extract(idlers, description.num_idlers);
+    extract(road_wheels, description.num_road_wheels);
+
+    compressed.clear();
+    return true;
 }
 
 void SynTrackedVehicleStateMessage::ConvertFromFlatBuffers(const SynFlatBuffers::Message* message) {
@@ -56,6 +98,15 @@ void SynTrackedVehicleStateMessage::ConvertFromFlatBuffers(const SynFlatBuffers:
     auto agent_state = message->message_as_Agent_State();
     auto state = agent_state->message_as_TrackedVehicle_State();
 
+    this->time = state->time();
+
+    // Compressed messages only carry the encoded poses
+    if (state->compressed() && state->compressed()->size()) {
+        this->compressed.assign(state->compressed()->begin(), state->compressed()->end());
+        return;
+    }
+
+    this->compressed.clear();
     this->chassis = SynPose(state->chassis());
 
     this->track_shoes.clear();
@@ -77,6 +128,16 @@ void SynTrackedVehicleStateMessage::ConvertFromFlatBuffers(const SynFlatBuffers:
 
 /// Generate FlatBuffers message from this message's state
 FlatBufferMessage SynTrackedVehicleStateMessage::ConvertToFlatBuffers(flatbuffers::FlatBufferBuilder& builder) const {
+    auto vehicle_type = Agent::Type_TrackedVehicle_State;
+    if (!this->compressed.empty()) {
+        auto vehicle_state = TrackedVehicle::CreateStateDirect(builder, this->time, 0, nullptr, nullptr, nullptr,
+                                                               nullptr, &this->compressed);
+
+        auto flatbuffer_state = Agent::CreateState(builder, vehicle_type, vehicle_state.Union());
+        return SynFlatBuffers::CreateMessage(builder, SynFlatBuffers::Type_Agent_State, flatbuffer_state.Union(),
+                                             m_source_key.GetFlatbuffersKey(), m_destination_key.GetFlatbuffersKey());
+    }
+
     auto chassis = this->chassis.ToFlatBuffers(builder);
 
     std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> track_shoes;
@@ -99,7 +160,6 @@ FlatBufferMessage SynTrackedVehicleStateMessage::ConvertToFlatBuffers(flatbuffer
     for (const auto& road_wheel : this->road_wheels)
         road_wheels.push_back(road_wheel.ToFlatBuffers(builder));
 
-    auto vehicle_type = Agent::Type_TrackedVehicle_State;
     auto vehicle_state = TrackedVehicle::CreateStateDirect(builder,        //
                                                            this->time,     //
                                                            chassis,        //
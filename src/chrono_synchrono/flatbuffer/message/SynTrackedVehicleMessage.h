@@ -22,6 +22,7 @@
 #define SYN_TRACKED_VEHICLE_MESSAGE_H
 
 #include "chrono_synchrono/flatbuffer/message/SynMessage.h"
+#include "chrono_synchrono/utils/SynPoseCompressor.h"
 
 namespace chrono {
 namespace synchrono {
@@ -29,6 +30,8 @@ namespace synchrono {
 /// @addtogroup synchrono_flatbuffer
 /// @{
 
+class SynTrackedVehicleDescriptionMessage;
+
 /// State class that holds state information for a SynTrackedVehicleAgent
 class SynTrackedVehicleStateMessage : public SynMessage {
   public:
@@ -66,6 +69,26 @@ class SynTrackedVehicleStateMessage : public SynMessage {
                   std::vector<SynPose> idlers,
                   std::vector<SynPose> road_wheels);
 
+    ///@brief Enable or disable the compressed encoding of the poses (see SynPoseCompressor)
+    /// Compressed messages carry the time and the encoded poses only, and must be decompressed by the receiver.
+    ///
+    ///@param val whether the poses set with SetState are compressed
+    ///@param keyframe_interval number of messages between full precision keyframes
+    void SetCompression(bool val, int keyframe_interval = 50);
+
+    ///@brief Check if the poses of this message still have to be decompressed
+    ///
+    bool IsCompressed() const { return !compressed.empty(); }
+
+    ///@brief Decode the compressed poses into the chassis and assembly components
+    /// The encoded poses are in order chassis, track shoes, sprockets, idlers and road wheels; the number of
+    /// components is taken from the vehicle description.
+    ///
+    ///@param decoder the decoder of the sending agent, holding the last received keyframe
+    ///@param description the description of the sending vehicle
+    ///@return false if the poses cannot be decoded yet (the keyframe they reference was not received)
+    bool Decompress(SynPoseCompressor& decoder, const SynTrackedVehicleDescriptionMessage& description);
+
     // -------------------------------------------------------------------------------
 
     SynPose chassis;                   ///< vehicle's chassis pose
@@ -73,6 +96,10 @@ class SynTrackedVehicleStateMessage : public SynMessage {
     std::vector<SynPose> sprockets;    ///< vector of vehicle's sprockets
     std::vector<SynPose> idlers;       ///< vector of vehicle's idlers
     std::vector<SynPose> road_wheels;  ///< vector of vehicle's road wheels
+    std::vector<uint8_t> compressed;   ///< encoded poses, empty if not compressed
+
+  private:
+    std::shared_ptr<SynPoseCompressor> m_compressor;  ///< encoder of the poses, null if not compressed
 };
 
 /// Description class that holds description information for a SynTrackedVehicle
@@ -35,6 +35,37 @@ void SynWheeledVehicleStateMessage::SetState(double time, SynPose chassis, std::
     this->time = time;
     this->chassis = chassis;
     this->wheels = wheels;
+
+    if (m_compressor) {
+        std::vector<ChFrameMoving<>> frames;
+        frames.reserve(1 + wheels.size());
+        frames.push_back(this->chassis.GetFrame());
+        for (auto& wheel : this->wheels)
+            frames.push_back(wheel.GetFrame());
+        m_compressor->Encode(frames, compressed);
+    }
+}
+
+void SynWheeledVehicleStateMessage::SetCompression(bool val, int keyframe_interval) {
+    m_compressor = val ? chrono_types::make_shared<SynPoseCompressor>(1e-3, keyframe_interval) : nullptr;
+    compressed.clear();
+}
+
+bool SynWheeledVehicleStateMessage::Decompress(SynPoseCompressor& decoder) {
+    if (compressed.empty())
+        return true;
+
+    std::vector<ChFrameMoving<>> frames;
+    if (!decoder.Decode(compressed, frames) || frames.empty())
+        return false;
+
+    chassis = SynPose(frames[0]);
+    wheels.clear();
+    for (size_t i = 1; i < frames.size(); i++)
+        wheels.emplace_back(frames[i]);
+
+    compressed.clear();
+    return true;
 }
 
 void SynWheeledVehicleStateMessage::ConvertFromFlatBuffers(const SynFlatBuffers::Message* message) {
@@ -49,6 +80,14 @@ void SynWheeledVehicleStateMessage::ConvertFromFlatBuffers(const SynFlatBuffers:
     auto state = agent_state->message_as_WheeledVehicle_State();
 
     time = state->time();
+
+    // Compressed messages only carry the encoded poses
+    if (state->compressed() && state->compressed()->size()) {
+        compressed.assign(state->compressed()->begin(), state->compressed()->end());
+        return;
+    }
+
+    compressed.clear();
     chassis = SynPose(state->chassis());
 
     wheels.clear();
@@ -58,6 +97,16 @@ void SynWheeledVehicleStateMessage::ConvertFromFlatBuffers(const SynFlatBuffers:
 
 /// Generate FlatBuffers message from this message's state
 FlatBufferMessage SynWheeledVehicleStateMessage::ConvertToFlatBuffers(flatbuffers::FlatBufferBuilder& builder) const {
+    auto vehicle_type = Agent::Type_WheeledVehicle_State;
+    if (!this->compressed.empty()) {
+        auto vehicle_state =
+            WheeledVehicle::CreateStateDirect(builder, this->time, 0, nullptr, &this->compressed).Union();
+
+        auto flatbuffer_state = Agent::CreateState(builder, vehicle_type, vehicle_state);
+        return SynFlatBuffers::CreateMessage(builder, SynFlatBuffers::Type_Agent_State, flatbuffer_state.Union(),
+                                             m_source_key.GetFlatbuffersKey(), m_destination_key.GetFlatbuffersKey());
+    }
+
     auto flatbuffer_chassis = this->chassis.ToFlatBuffers(builder);
 
     std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> flatbuffer_wheels;
@@ -65,7 +114,6 @@ FlatBufferMessage SynWheeledVehicleStateMessage::ConvertToFlatBuffers(flatbuffer
     for (const auto& wheel : this->wheels)
         flatbuffer_wheels.push_back(wheel.ToFlatBuffers(builder));
 
-    auto vehicle_type = Agent::Type_WheeledVehicle_State;
     auto vehicle_state =
         WheeledVehicle::CreateStateDirect(builder, this->time, flatbuffer_chassis, &flatbuffer_wheels).Union();
 
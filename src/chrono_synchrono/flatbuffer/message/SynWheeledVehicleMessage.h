@@ -22,6 +22,7 @@
 #define SYN_WHEELED_VEHICLE_MESSAGE_H
 
 #include "chrono_synchrono/flatbuffer/message/SynMessage.h"
+#include "chrono_synchrono/utils/SynPoseCompressor.h"
 
 namespace chrono {
 namespace synchrono {
@@ -60,10 +61,31 @@ class SYN_API SynWheeledVehicleStateMessage : public SynMessage {
     ///@param wheels vector of the vehicle's wheel poses
     void SetState(double time, SynPose chassis, std::vector<SynPose> wheels);
 
+    ///@brief Enable or disable the compressed encoding of the poses (see SynPoseCompressor)
+    /// Compressed messages carry the time and the encoded poses only, and must be decompressed by the receiver.
+    ///
+    ///@param val whether the poses set with SetState are compressed
+    ///@param keyframe_interval number of messages between full precision keyframes
+    void SetCompression(bool val, int keyframe_interval = 50);
+
+    ///@brief Check if the poses of this message still have to be decompressed
+    ///
+    bool IsCompressed() const { return !compressed.empty(); }
+
+    ///@brief Decode the compressed poses into the chassis and wheels
+    ///
+    ///@param decoder the decoder of the sending agent, holding the last received keyframe
+    ///@return false if the poses cannot be decoded yet (the keyframe they reference was not received)
+    bool Decompress(SynPoseCompressor& decoder);
+
     // -------------------------------------------------------------------------------
 
-    SynPose chassis;              ///< vehicle's chassis pose
-    std::vector<SynPose> wheels;  ///< vector of vehicle's wheels
+    SynPose chassis;                  ///< vehicle's chassis pose
+    std::vector<SynPose> wheels;      ///< vector of vehicle's wheels
+    std::vector<uint8_t> compressed;  ///< encoded chassis and wheel poses, empty if not compressed
+
+  private:
+    std::shared_ptr<SynPoseCompressor> m_compressor;  ///< encoder of the poses, null if not compressed
 };
 
 // ------------------------------------------------------------------------------------
@@ -0,0 +1,205 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Compact encoding of a set of body frames for agent state messages.
+//
+// Layout of the encoded data (native byte order):
+//   header:    flags (uint8, bit 0: keyframe), keyframe id (uint16), number of frames (uint16), resolution (float)
+//   per frame: position (3 x double in a keyframe, 3 x int16 relative to the keyframe otherwise)
+//              rotation (uint8 index of the dropped component + 3 x int16)
+//              linear velocity (3 x int16), angular velocity in the parent frame (3 x int16)
+//
+// =============================================================================
+
+#include "chrono_synchrono/utils/SynPoseCompressor.h"
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+#include "chrono/utils/ChConstants.h"
+
+namespace chrono {
+namespace synchrono {
+
+static const double lin_vel_resolution = 1e-2;  // [m/s], range +/- 327 m/s
+static const double ang_vel_resolution = 5e-3;  // [rad/s], range +/- 163 rad/s
+static const double rot_scale = 32767 * CH_SQRT_2;  // smallest-three components are within +/- 1/sqrt(2)
+
+template <typename T>
+static void Put(std::vector<uint8_t>& data, T value) {
+    size_t size = data.size();
+    data.resize(size + sizeof(T));
+    std::memcpy(data.data() + size, &value, sizeof(T));
+}
+
+template <typename T>
+static T Get(const std::vector<uint8_t>& data, size_t& offset) {
+    T value;
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return value;
+}
+
+static int16_t Quantize(double value, double resolution) {
+    double q = std::round(value / resolution);
+    return static_cast<int16_t>(std::max(-32767.0, std::min(32767.0, q)));
+}
+
+static void PutVector(std::vector<uint8_t>& data, const ChVector3d& v, double resolution) {
+    for (unsigned i = 0; i < 3; i++)
+        Put<int16_t>(data, Quantize(v[i], resolution));
+}
+
+static ChVector3d GetVector(const std::vector<uint8_t>& data, size_t& offset, double resolution) {
+    ChVector3d v;
+    for (unsigned i = 0; i < 3; i++)
+        v[i] = Get<int16_t>(data, offset) * resolution;
+    return v;
+}
+
+// Smallest-three encoding: drop the largest component (made positive) and recover it from the unit norm
+static void PutRotation(std::vector<uint8_t>& data, const ChQuaternion<>& rot) {
+    ChQuaternion<> q = rot.GetNormalized();
+    uint8_t index = 0;
+    for (uint8_t i = 1; i < 4; i++)
+        if (std::abs(q[i]) > std::abs(q[index]))
+            index = i;
+    double sign = q[index] < 0 ? -1 : 1;
+
+    Put<uint8_t>(data, index);
+    for (unsigned i = 0; i < 4; i++)
+        if (i != index)
+            Put<int16_t>(data, static_cast<int16_t>(std::round(sign * q[i] * rot_scale)));
+}
+
+static ChQuaternion<> GetRotation(const std::vector<uint8_t>& data, size_t& offset) {
+    uint8_t index = Get<uint8_t>(data, offset);
+
+    ChQuaternion<> q;
+    double sum = 0;
+    for (unsigned i = 0; i < 4; i++) {
+        if (i == index)
+            continue;
+        q[i] = Get<int16_t>(data, offset) / rot_scale;
+        sum += q[i] * q[i];
+    }
+    q[index] = std::sqrt(std::max(0.0, 1 - sum));
+
+    return q.GetNormalized();
+}
+
+// -----------------------------------------------------------------------------
+
+SynPoseCompressor::SynPoseCompressor(double resolution, int keyframe_interval)
+    : m_resolution(resolution),
+      m_keyframe_interval(keyframe_interval),
+      m_count(0),
+      m_has_keyframe(false),
+      m_keyframe_id(0) {}
+
+void SynPoseCompressor::Encode(const std::vector<ChFrameMoving<>>& frames, std::vector<uint8_t>& data) {
+    // The resolution is transmitted in single precision, use the same value on both sides
+    double resolution = static_cast<float>(m_resolution);
+    double range = 32767 * resolution;
+
+    // Send a keyframe if one is due, if the number of frames changed, or if a delta is out of range
+    bool keyframe = !m_has_keyframe || m_count <= 0 || m_count >= m_keyframe_interval ||  //
+                    frames.size() != m_keyframe.size();
+    for (size_t i = 0; i < frames.size() && !keyframe; i++) {
+        ChVector3d delta = frames[i].GetPos() - m_keyframe[i];
+        keyframe = std::abs(delta.x()) > range || std::abs(delta.y()) > range || std::abs(delta.z()) > range;
+    }
+
+    if (keyframe) {
+        m_keyframe.resize(frames.size());
+        for (size_t i = 0; i < frames.size(); i++)
+            m_keyframe[i] = frames[i].GetPos();
+        m_keyframe_id++;
+        m_has_keyframe = true;
+        m_count = 0;
+    }
+    m_count++;
+
+    data.clear();
+    data.reserve(9 + frames.size() * (keyframe ? 43 : 25));
+
+    Put<uint8_t>(data, keyframe ? 1 : 0);
+    Put<uint16_t>(data, m_keyframe_id);
+    Put<uint16_t>(data, static_cast<uint16_t>(frames.size()));
+    Put<float>(data, static_cast<float>(resolution));
+
+    for (size_t i = 0; i < frames.size(); i++) {
+        const auto& frame = frames[i];
+        if (keyframe) {
+            for (unsigned j = 0; j < 3; j++)
+                Put<double>(data, frame.GetPos()[j]);
+        } else {
+            PutVector(data, frame.GetPos() - m_keyframe[i], resolution);
+        }
+        PutRotation(data, frame.GetRot());
+        PutVector(data, frame.GetPosDt(), lin_vel_resolution);
+        PutVector(data, frame.GetAngVelParent(), ang_vel_resolution);
+    }
+}
+
+bool SynPoseCompressor::Decode(const std::vector<uint8_t>& data, std::vector<ChFrameMoving<>>& frames) {
+    if (data.size() < 9)
+        return false;
+
+    size_t offset = 0;
+    bool keyframe = (Get<uint8_t>(data, offset) & 1) != 0;
+    uint16_t keyframe_id = Get<uint16_t>(data, offset);
+    size_t num_frames = Get<uint16_t>(data, offset);
+    double resolution = Get<float>(data, offset);
+
+    if (data.size() != 9 + num_frames * (keyframe ? 43 : 25))
+        return false;
+
+    // A delta can only be decoded against the keyframe it references
+    if (!keyframe && (!m_has_keyframe || keyframe_id != m_keyframe_id || num_frames != m_keyframe.size()))
+        return false;
+
+    if (keyframe) {
+        m_keyframe.resize(num_frames);
+        m_keyframe_id = keyframe_id;
+        m_has_keyframe = true;
+    }
+
+    frames.resize(num_frames);
+    for (size_t i = 0; i < num_frames; i++) {
+        ChVector3d pos;
+        if (keyframe) {
+            for (unsigned j = 0; j < 3; j++)
+                pos[j] = Get<double>(data, offset);
+            m_keyframe[i] = pos;
+        } else {
+            pos = m_keyframe[i] + GetVector(data, offset, resolution);
+        }
+
+        ChQuaternion<> rot = GetRotation(data, offset);
+        frames[i] = ChFrameMoving<>(pos, rot);
+        frames[i].SetPosDt(GetVector(data, offset, lin_vel_resolution));
+        frames[i].SetAngVelParent(GetVector(data, offset, ang_vel_resolution));
+    }
+
+    return true;
+}
+
+bool SynPoseCompressor::IsKeyframe(const std::vector<uint8_t>& data) {
+    return !data.empty() && (data[0] & 1) != 0;
+}
+
+}  // namespace synchrono
+}  // namespace chrono
@@ -0,0 +1,88 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Compact encoding of a set of body frames for agent state messages. Every
+// few messages a keyframe carries full precision positions; the messages in
+// between carry positions quantized relative to that keyframe. Rotations are
+// always quantized (smallest-three encoding) and velocities are quantized to
+// fixed steps. Accelerations are not transmitted.
+//
+// Deltas only reference the last keyframe (not the previous message), so a
+// receiver that misses messages can decode again as soon as it has the
+// keyframe, and at the latest from the next keyframe on.
+//
+// =============================================================================
+
+#ifndef SYN_POSE_COMPRESSOR_H
+#define SYN_POSE_COMPRESSOR_H
+
+#include <cstdint>
+#include <vector>
+
+#include "chrono_synchrono/SynApi.h"
+
+#include "chrono/core/ChFrameMoving.h"
+
+namespace chrono {
+namespace synchrono {
+
+/// @addtogroup synchrono_utils
+/// @{
+
+/// Encoder (sender side) or decoder (receiver side) of quantized body frames relative to periodic keyframes
+class SYN_API SynPoseCompressor {
+  public:
+    ///@brief Construct a compressor
+    ///
+    ///@param resolution quantization step of the positions relative to the keyframe
+    ///@param keyframe_interval number of messages between keyframes
+    SynPoseCompressor(double resolution = 1e-3, int keyframe_interval = 50);
+
+    ///@brief Encode the frames, as a keyframe if one is due or if a position moved out of the delta range
+    ///
+    ///@param frames the frames to encode
+    ///@param data the encoded frames
+    void Encode(const std::vector<ChFrameMoving<>>& frames, std::vector<uint8_t>& data);
+
+    ///@brief Decode the frames
+    ///
+    ///@param data the encoded frames
+    ///@param frames the decoded frames
+    ///@return false if the data is relative to a keyframe that was not received by this decoder
+    bool Decode(const std::vector<uint8_t>& data, std::vector<ChFrameMoving<>>& frames);
+
+    ///@brief Force the next encoded frames to be a keyframe
+    ///
+    void RequestKeyframe() { m_count = 0; }
+
+    ///@brief Check if the encoded frames are a keyframe
+    ///
+    static bool IsKeyframe(const std::vector<uint8_t>& data);
+
+  private:
+    double m_resolution;      ///< position quantization step of the deltas
+    int m_keyframe_interval;  ///< number of messages between keyframes
+    int m_count;              ///< number of messages encoded since the last keyframe
+
+    bool m_has_keyframe;                 ///< was a keyframe encoded or decoded?
+    uint16_t m_keyframe_id;              ///< identifier of the last keyframe
+    std::vector<ChVector3d> m_keyframe;  ///< positions of the last keyframe
+};
+
+/// @} synchrono_utils
+
+}  // namespace synchrono
+}  // namespace chrono
+
+#endif
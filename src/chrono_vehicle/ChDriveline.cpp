@@ -22,7 +22,7 @@
 namespace chrono {
 namespace vehicle {
 
-ChDriveline::ChDriveline(const std::string& name) : ChPart(name) {}
+ChDriveline::ChDriveline(const std::string& name) : ChPart(name), m_reduced_network(false) {}
 
 void ChDriveline::Initialize(std::shared_ptr<ChChassis> chassis) {
     // Mark as initialized
@@ -52,11 +52,19 @@ class CH_VEHICLE_API ChDriveline : public ChPart {
     /// This represents the output from the driveline subsystem that is passed to the transmission subsystem.
     virtual double GetOutputDriveshaftSpeed() const = 0;
 
+    /// Enable/disable use of a reduced model for the driveline shaft network (default: false).
+    /// If enabled, the internal driveline shafts and their rigid couplings are condensed into a single ChShaftsNetwork
+    /// with a minimal set of coordinates, reducing the size of the system-level problem. This function must be called
+    /// before Initialize. Driveline templates which do not provide a reduced model ignore this setting.
+    void EnableReducedShaftNetwork(bool val) { m_reduced_network = val; }
+
   protected:
     ChDriveline(const std::string& name);
 
     virtual void InitializeInertiaProperties() override;
     virtual void UpdateInertiaProperties() override;
+
+    bool m_reduced_network;  ///< use a reduced model of the shaft network
 };
 
 /// @} vehicle
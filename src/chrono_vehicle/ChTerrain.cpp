@@ -42,5 +42,16 @@ void ChTerrain::GetProperties(const ChVector3d& loc, double& height, ChVector3d&
     friction = GetCoefficientFriction(loc);
 }
 
+void ChTerrain::GetPropertiesBatch(const std::vector<ChVector3d>& locs,
+                                   std::vector<double>& heights,
+                                   std::vector<ChVector3d>& normals,
+                                   std::vector<float>& frictions) const {
+    heights.resize(locs.size());
+    normals.resize(locs.size());
+    frictions.resize(locs.size());
+    for (size_t i = 0; i < locs.size(); i++)
+        GetProperties(locs[i], heights[i], normals[i], frictions[i]);
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
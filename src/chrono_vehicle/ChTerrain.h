@@ -19,6 +19,9 @@
 #ifndef CH_TERRAIN_H
 #define CH_TERRAIN_H
 
+#include <memory>
+#include <vector>
+
 #include "chrono/core/ChVector3.h"
 
 #include "chrono_vehicle/ChApiVehicle.h"
@@ -57,6 +60,15 @@ class CH_VEHICLE_API ChTerrain {
     /// Get all terrain characteristics at the point below the specified location.
     virtual void GetProperties(const ChVector3d& loc, double& height, ChVector3d& normal, float& friction) const;
 
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// This function allows querying the terrain for all wheels of a vehicle (or of multiple vehicles) at once. The
+    /// output vectors are resized to the number of locations. The default implementation calls GetProperties for each
+    /// location; derived classes may override it to share work across queries.
+    virtual void GetPropertiesBatch(const std::vector<ChVector3d>& locs,
+                                    std::vector<double>& heights,
+                                    std::vector<ChVector3d>& normals,
+                                    std::vector<float>& frictions) const;
+
     /// Class to be used as a functor interface for location-dependent terrain height.
     class CH_VEHICLE_API HeightFunctor {
       public:
@@ -23,6 +23,7 @@
 
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 #include "chrono_vehicle/ChWorldFrame.h"
 #include "chrono_vehicle/ChVehicle.h"
@@ -175,6 +176,8 @@ void ChVehicle::InitializePowertrain(std::shared_ptr<ChPowertrainAssembly> power
 // -----------------------------------------------------------------------------
 
 void ChVehicle::Advance(double step) {
+    CH_TRACE("Vehicle::Advance");
+
     // Ensure the vehicle mass includes the mass of subsystems that may have been initialized after the vehicle
     if (!m_initialized) {
         InitializeInertiaProperties();
@@ -62,6 +62,9 @@ class CH_VEHICLE_API ChVehicle {
     /// Get a pointer to the Chrono ChSystem.
     ChSystem* GetSystem() { return m_system; }
 
+    /// Return true if the underlying Chrono system was created by (and is advanced by) this vehicle.
+    bool OwnsSystem() const { return m_ownsSystem; }
+
     /// Get the current simulation time of the underlying ChSystem.
     double GetChTime() const { return m_system->GetChTime(); }
 
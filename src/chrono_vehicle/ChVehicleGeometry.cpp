@@ -20,6 +20,7 @@
 
 #include "chrono_vehicle/ChVehicleModelData.h"
 #include "chrono_vehicle/ChVehicleGeometry.h"
+#include "chrono_vehicle/utils/ChVehicleModelCache.h"
 
 #include "chrono/assets/ChVisualShapeTriangleMesh.h"
 #include "chrono/assets/ChVisualShapeModelFile.h"
@@ -71,19 +72,30 @@ ChVehicleGeometry::ConvexHullsShape::ConvexHullsShape(const std::string& filenam
     utils::LoadConvexHulls(vehicle::GetDataFile(filename), mesh, m_hulls);
 }
 
+// Hack: explicitly offset vertices (of a copy of the mesh, which may be shared)
+static std::shared_ptr<ChTriangleMeshConnected> OffsetMesh(std::shared_ptr<ChTriangleMeshConnected> trimesh,
+                                                           const ChVector3d& pos) {
+    if (pos.IsNull())
+        return trimesh;
+    auto offset_trimesh = std::shared_ptr<ChTriangleMeshConnected>(trimesh->Clone());
+    for (auto& v : offset_trimesh->m_vertices)
+        v += pos;
+    return offset_trimesh;
+}
+
 ChVehicleGeometry::TrimeshShape::TrimeshShape(const ChVector3d& pos,
                                               const std::string& filename,
                                               double radius,
                                               int matID)
     : m_radius(radius), m_pos(pos), m_matID(matID) {
-    m_trimesh = ChTriangleMeshConnected::CreateFromWavefrontFile(vehicle::GetDataFile(filename), true, false);
+    m_trimesh = OffsetMesh(ChVehicleModelCache::ReadMesh(vehicle::GetDataFile(filename), true, false), pos);
 }
 
 ChVehicleGeometry::TrimeshShape::TrimeshShape(const ChVector3d& pos,
                                               std::shared_ptr<ChTriangleMeshConnected> trimesh,
                                               double radius,
                                               int matID)
-    : m_trimesh(trimesh), m_radius(radius), m_pos(pos), m_matID(matID) {}
+    : m_trimesh(OffsetMesh(trimesh, pos)), m_radius(radius), m_pos(pos), m_matID(matID) {}
 
 std::shared_ptr<ChVisualShape> ChVehicleGeometry::AddVisualizationCylinder(std::shared_ptr<ChBody> body,
                                                                            const ChVector3d& p1,
@@ -143,8 +155,7 @@ void ChVehicleGeometry::CreateVisualizationAssets(std::shared_ptr<ChBody> body,
     }
 
     if (vis == VisualizationType::MESH && m_has_mesh) {
-        auto trimesh =
-            ChTriangleMeshConnected::CreateFromWavefrontFile(vehicle::GetDataFile(m_vis_mesh_file), true, true);
+        auto trimesh = ChVehicleModelCache::ReadMesh(vehicle::GetDataFile(m_vis_mesh_file), true, true);
         auto trimesh_shape = chrono_types::make_shared<ChVisualShapeTriangleMesh>();
         trimesh_shape->SetMesh(trimesh);
         trimesh_shape->SetName(filesystem::path(m_vis_mesh_file).stem());
@@ -233,9 +244,6 @@ void ChVehicleGeometry::CreateCollisionShapes(std::shared_ptr<ChBody> body,
     }
     for (auto& mesh : m_coll_meshes) {
         assert(materials[mesh.m_matID]);
-        // Hack: explicitly offset vertices
-        for (auto& v : mesh.m_trimesh->m_vertices)
-            v += mesh.m_pos;
         auto shape = chrono_types::make_shared<ChCollisionShapeTriangleMesh>(materials[mesh.m_matID], mesh.m_trimesh,
                                                                              false, false, mesh.m_radius);
         body->AddCollisionShape(shape);
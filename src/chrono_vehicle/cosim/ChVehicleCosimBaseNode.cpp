@@ -84,6 +84,11 @@ ChVehicleCosimBaseNode::ChVehicleCosimBaseNode(const std::string& name)
       m_step_size(1e-4),
       m_cum_sim_time(0),
       m_verbose(true),
+      m_async(false),
+      m_lagged(false),
+      m_shm(false),
+      m_shm_comm(MPI_COMM_NULL),
+      m_shm_win(MPI_WIN_NULL),
       m_renderRT(false),
       m_renderRT_step(0.01),
       m_writeRT(false),
@@ -100,6 +105,15 @@ ChVehicleCosimBaseNode::ChVehicleCosimBaseNode(const std::string& name)
     MPI_Comm_rank(MPI_COMM_WORLD, &m_rank);
 }
 
+ChVehicleCosimBaseNode::~ChVehicleCosimBaseNode() {
+    if (m_shm_win != MPI_WIN_NULL) {
+        MPI_Win_unlock_all(m_shm_win);
+        MPI_Win_free(&m_shm_win);
+    }
+    if (m_shm_comm != MPI_COMM_NULL)
+        MPI_Comm_free(&m_shm_comm);
+}
+
 void ChVehicleCosimBaseNode::Initialize() {
     int size;
     MPI_Comm_size(MPI_COMM_WORLD, &size);
@@ -184,9 +198,34 @@ void ChVehicleCosimBaseNode::Initialize() {
         }
     }
 
+    // All nodes must use the same data exchange mode
+    int mode = (m_async ? (m_lagged ? 2 : 1) : 0) + (m_shm ? 4 : 0);
+    int mode_min, mode_max;
+    MPI_Allreduce(&mode, &mode_min, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+    MPI_Allreduce(&mode, &mode_max, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+    if (mode_min != mode_max) {
+        if (m_rank == 0)
+            cerr << "Error: inconsistent asynchronous exchange settings across nodes." << endl;
+        err = true;
+    }
+
     if (err) {
         MPI_Abort(MPI_COMM_WORLD, 1);
     }
+
+    // Identify the ranks running on the same host
+    if (m_shm) {
+        MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &m_shm_comm);
+        int host;
+        MPI_Allreduce(&m_rank, &host, 1, MPI_INT, MPI_MIN, m_shm_comm);
+        m_hosts.resize(size);
+        MPI_Allgather(&host, 1, MPI_INT, m_hosts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+    }
+}
+
+void ChVehicleCosimBaseNode::EnableAsyncExchange(bool lagged_coupling) {
+    m_async = true;
+    m_lagged = lagged_coupling;
 }
 
 void ChVehicleCosimBaseNode::SetOutDir(const std::string& dir_name, const std::string& suffix) {
@@ -317,6 +356,98 @@ void ChVehicleCosimBaseNode::Render(double step_size) {
     }
 }
 
+// -----------------------------------------------------------------------------
+
+ChVehicleCosimBaseNode::AsyncChannel::AsyncChannel(int rank)
+    : m_rank(rank), m_send_index(0), m_recv_request(MPI_REQUEST_NULL) {
+    m_send_request[0] = MPI_REQUEST_NULL;
+    m_send_request[1] = MPI_REQUEST_NULL;
+}
+
+ChVehicleCosimBaseNode::AsyncChannel::~AsyncChannel() {
+    WaitAll();
+}
+
+double* ChVehicleCosimBaseNode::AsyncChannel::GetSendBuffer(int count) {
+    // The current buffer can be overwritten only after the send posted from it has completed
+    MPI_Wait(&m_send_request[m_send_index], MPI_STATUS_IGNORE);
+    m_send_buffer[m_send_index].resize(count);
+    return m_send_buffer[m_send_index].data();
+}
+
+void ChVehicleCosimBaseNode::AsyncChannel::Send(int tag) {
+    auto& buffer = m_send_buffer[m_send_index];
+    MPI_Isend(buffer.data(), (int)buffer.size(), MPI_DOUBLE, m_rank, tag, MPI_COMM_WORLD,
+              &m_send_request[m_send_index]);
+    m_send_index = 1 - m_send_index;
+}
+
+void ChVehicleCosimBaseNode::AsyncChannel::PostRecv(int count, int tag) {
+    if (m_recv_request != MPI_REQUEST_NULL) {
+        cerr << "Error: receive posted while a previous receive from rank " << m_rank << " is pending." << endl;
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+    m_recv_buffer.resize(count);
+    MPI_Irecv(m_recv_buffer.data(), count, MPI_DOUBLE, m_rank, tag, MPI_COMM_WORLD, &m_recv_request);
+}
+
+int ChVehicleCosimBaseNode::AsyncChannel::WaitRecv() {
+    if (m_recv_request == MPI_REQUEST_NULL)
+        return 0;
+    MPI_Status status;
+    MPI_Wait(&m_recv_request, &status);
+    int count = 0;
+    MPI_Get_count(&status, MPI_DOUBLE, &count);
+    return count;
+}
+
+void ChVehicleCosimBaseNode::AsyncChannel::WaitAll() {
+    MPI_Waitall(2, m_send_request, MPI_STATUSES_IGNORE);
+    MPI_Wait(&m_recv_request, MPI_STATUS_IGNORE);
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVehicleCosimBaseNode::InitializeSharedMemory(size_t size) {
+    if (!m_shm)
+        return;
+
+    double* segment;
+    MPI_Win_allocate_shared((MPI_Aint)(size * sizeof(double)), sizeof(double), MPI_INFO_NULL, m_shm_comm, &segment,
+                            &m_shm_win);
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, m_shm_win);
+}
+
+bool ChVehicleCosimBaseNode::IsOnSameHost(int rank) const {
+    return m_shm && m_hosts[rank] == m_hosts[m_rank];
+}
+
+double* ChVehicleCosimBaseNode::GetSharedMemory(int rank) const {
+    if (m_shm_win == MPI_WIN_NULL || !IsOnSameHost(rank))
+        return nullptr;
+
+    // Rank of the specified node in the communicator of the shared memory window
+    MPI_Group world_group, shm_group;
+    MPI_Comm_group(MPI_COMM_WORLD, &world_group);
+    MPI_Comm_group(m_shm_comm, &shm_group);
+    int shm_rank;
+    MPI_Group_translate_ranks(world_group, 1, &rank, shm_group, &shm_rank);
+    MPI_Group_free(&world_group);
+    MPI_Group_free(&shm_group);
+
+    MPI_Aint size;
+    int disp_unit;
+    double* segment;
+    MPI_Win_shared_query(m_shm_win, shm_rank, &size, &disp_unit, &segment);
+    return size > 0 ? segment : nullptr;
+}
+
+void ChVehicleCosimBaseNode::SyncSharedMemory() const {
+    MPI_Win_sync(m_shm_win);
+}
+
+// -----------------------------------------------------------------------------
+
 void ChVehicleCosimBaseNode::SendGeometry(const ChVehicleGeometry& geom, int dest) const {
     // Send information on number of contact materials and collision shapes of each type
     int dims[] = {
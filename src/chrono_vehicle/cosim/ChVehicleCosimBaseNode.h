@@ -122,7 +122,7 @@ class CH_VEHICLE_API ChVehicleCosimBaseNode {
         MESH   ///< exchange state and force for a mesh (flexible tire mesh)
     };
 
-    virtual ~ChVehicleCosimBaseNode() {}
+    virtual ~ChVehicleCosimBaseNode();
 
     /// Return the node type.
     virtual NodeType GetNodeType() const = 0;
@@ -131,7 +131,7 @@ class CH_VEHICLE_API ChVehicleCosimBaseNode {
     std::string GetNodeTypeString() const;
 
     /// Return true if this node is part of the co-simulation infrastructure.
-    bool IsCosimNode() const;
+    virtual bool IsCosimNode() const;
 
     /// Set the integration step size (default: 1e-4).
     void SetStepSize(double step) { m_step_size = step; }
@@ -163,6 +163,30 @@ class CH_VEHICLE_API ChVehicleCosimBaseNode {
     /// If enabled, output will be generated in dir_name/[NodeName]suffix/ (see SetOutDir).
     void EnablePostprocessVisualization(double render_fps = 100);
 
+    /// Enable asynchronous exchange of co-simulation data at synchronization times (default: false).
+    /// In asynchronous mode, data is sent with non-blocking MPI calls from double-buffered messages and receives are
+    /// posted before the data is needed, so that a node never waits for a peer to be ready to receive and a node
+    /// communicating with several peers (MBS or terrain) exchanges data with all of them at once.
+    /// If 'lagged_coupling' is true, the terrain forces are applied (on the tire nodes or on a tracked MBS node) with a
+    /// delay of one co-simulation step. This explicit coupling lets the terrain node computations overlap with those of
+    /// the other nodes, which then wait for the terrain node only if it falls more than one step behind.
+    /// The same setting must be used on all nodes. Note that calling MPI_Barrier at each step of the co-simulation loop
+    /// prevents such an overlap.
+    void EnableAsyncExchange(bool lagged_coupling = false);
+
+    /// Return true if asynchronous exchange of co-simulation data is enabled.
+    bool IsAsyncExchange() const { return m_async; }
+
+    /// Return true if the terrain forces are applied with a delay of one co-simulation step.
+    bool IsLaggedCoupling() const { return m_lagged; }
+
+    /// Enable/disable the shared-memory transport of mesh data between nodes running on the same host (default: false).
+    /// If enabled, the tire mesh states and mesh contact forces exchanged by a TIRE node and the TERRAIN node running
+    /// on the same host are written directly in ring buffers allocated in an MPI shared memory window, and only a short
+    /// notification message is sent at each step. Mesh data for nodes running on different hosts is still exchanged
+    /// through MPI messages. The same setting must be used on all nodes.
+    void EnableSharedMemoryTransport(bool val) { m_shm = val; }
+
     /// Get the output directory name for this node.
     const std::string& GetOutDirName() const { return m_node_out_dir; }
 
@@ -230,9 +254,93 @@ class CH_VEHICLE_API ChVehicleCosimBaseNode {
         std::vector<ChVector3d> vforce;  ///< contact forces on mesh vertices
     };
 
+    /// Double-buffered channel for asynchronous exchange of data with another node.
+    /// A message is packed in one of two send buffers and sent with MPI_Isend; a buffer is reused only after the send
+    /// posted from it (two messages earlier) has completed. Receives are posted with MPI_Irecv and completed on demand.
+    /// All pending operations are completed when the channel is destroyed.
+    class AsyncChannel {
+      public:
+        AsyncChannel(int rank);
+        ~AsyncChannel();
+
+        /// Get a send buffer for a message with the specified number of values.
+        double* GetSendBuffer(int count);
+
+        /// Send the message packed in the current send buffer (non-blocking).
+        void Send(int tag);
+
+        /// Post a receive for a message with at most the specified number of values (non-blocking).
+        /// A previously posted receive must have been completed.
+        void PostRecv(int count, int tag);
+
+        /// Return true if a receive was posted and not yet completed.
+        bool IsRecvPending() const { return m_recv_request != MPI_REQUEST_NULL; }
+
+        /// Wait for completion of the posted receive and return the number of received values.
+        int WaitRecv();
+
+        /// Get the data of the last received message.
+        const double* GetRecvBuffer() const { return m_recv_buffer.data(); }
+
+        /// Wait for completion of all pending sends and receives.
+        void WaitAll();
+
+      private:
+        AsyncChannel(const AsyncChannel&) = delete;
+        AsyncChannel& operator=(const AsyncChannel&) = delete;
+
+        int m_rank;                            ///< rank of the peer node (in MPI_COMM_WORLD)
+        std::vector<double> m_send_buffer[2];  ///< send buffers
+        MPI_Request m_send_request[2];         ///< requests of the sends posted from each buffer
+        int m_send_index;                      ///< index of the current send buffer
+        std::vector<double> m_recv_buffer;     ///< receive buffer
+        MPI_Request m_recv_request;            ///< request of the posted receive
+    };
+
+    /// Views of the ring buffers for the mesh data exchanged through shared memory by a TIRE node and the TERRAIN node.
+    /// The mesh state ring holds 6 values (position and velocity) per vertex and the mesh contact ring holds at most 4
+    /// values (index and force) per vertex. Each ring has two slots, used at alternate co-simulation steps: a slot is
+    /// overwritten only after the data exchanged two steps earlier (which the receiver reads before sending its reply
+    /// for that step) is no longer needed.
+    class MeshRing {
+      public:
+        MeshRing(double* segment, int nv) : m_segment(segment), m_nv(nv) {}
+
+        /// Return the number of values in a shared memory segment for a mesh with the specified number of vertices.
+        static size_t GetSize(int nv) { return 2 * (6 + 4) * (size_t)nv; }
+
+        /// Get the mesh state slot for the specified step.
+        double* GetStateSlot(int step) const { return m_segment + (step % 2) * 6 * m_nv; }
+
+        /// Get the mesh contact slot for the specified step.
+        double* GetContactSlot(int step) const { return m_segment + 2 * 6 * m_nv + (step % 2) * 4 * m_nv; }
+
+      private:
+        double* m_segment;  ///< start of the shared memory segment
+        int m_nv;           ///< number of mesh vertices
+    };
+
   protected:
     ChVehicleCosimBaseNode(const std::string& name);
 
+    /// Allocate the shared memory segment of this node, with the specified number of values (possibly 0).
+    /// This function must be called, as the last step of node initialization, on all nodes. It has no effect unless the
+    /// shared-memory transport is enabled.
+    void InitializeSharedMemory(size_t size);
+
+    /// Return true if the node with the specified rank runs on the same host as this node.
+    /// Always returns false if the shared-memory transport is not enabled.
+    bool IsOnSameHost(int rank) const;
+
+    /// Get the shared memory segment of the node with the specified rank.
+    /// Returns nullptr if that node does not run on the same host or has not allocated a shared memory segment.
+    double* GetSharedMemory(int rank) const;
+
+    /// Synchronize the private and public copies of the shared memory window.
+    /// A node must call this function after writing data and before sending a notification, as well as after
+    /// receiving a notification and before reading data.
+    void SyncSharedMemory() const;
+
     /// Get the Chrono system that holds the visualization shapes (used only for post-processing export).
     virtual ChSystem* GetSystemPostprocess() const = 0;
 
@@ -285,6 +393,14 @@ class CH_VEHICLE_API ChVehicleCosimBaseNode {
 
     bool m_verbose;  ///< verbose messages during simulation?
 
+    bool m_async;   ///< asynchronous exchange of co-simulation data?
+    bool m_lagged;  ///< terrain forces applied with a delay of one co-simulation step?
+
+    bool m_shm;                ///< shared-memory transport of mesh data?
+    MPI_Comm m_shm_comm;       ///< communicator of all nodes running on the same host
+    MPI_Win m_shm_win;         ///< shared memory window
+    std::vector<int> m_hosts;  ///< host identifiers of all ranks (smallest rank on each host)
+
     static const double m_gacc;
 };
 
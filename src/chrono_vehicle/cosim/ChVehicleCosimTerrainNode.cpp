@@ -24,6 +24,8 @@
 #include <fstream>
 #include <algorithm>
 #include <cmath>
+#include <map>
+#include <numeric>
 
 #include "chrono_vehicle/cosim/ChVehicleCosimTerrainNode.h"
 
@@ -46,7 +48,16 @@ ChVehicleCosimTerrainNode::ChVehicleCosimTerrainNode(double length, double width
       m_dimX(length / 2),
       m_dimY(width / 2),
       m_load_mass(50),
-      m_interface_type(InterfaceType::BODY) {}
+      m_interface_type(InterfaceType::BODY),
+      m_lb_enabled(false),
+      m_lb_region_size(0),
+      m_lb_num_steps(50),
+      m_lb_margin(0),
+      m_lb_nx(1),
+      m_lb_ny(1),
+      m_terrain_comm(MPI_COMM_NULL),
+      m_terrain_rank(0),
+      m_terrain_size(1) {}
 
 // -----------------------------------------------------------------------------
 
@@ -60,6 +71,19 @@ void ChVehicleCosimTerrainNode::GetDimensions(double& length, double& width) {
     width = m_dimY;
 }
 
+void ChVehicleCosimTerrainNode::EnableLoadBalancing(double region_size, int num_steps, double margin) {
+    m_lb_enabled = true;
+    m_lb_region_size = region_size;
+    m_lb_num_steps = std::max(num_steps, 1);
+    m_lb_margin = margin;
+}
+
+bool ChVehicleCosimTerrainNode::IsCosimNode() const {
+    if (m_lb_enabled)
+        return true;
+    return ChVehicleCosimBaseNode::IsCosimNode();
+}
+
 // -----------------------------------------------------------------------------
 // Initialization of the terrain node(s):
 // - send terrain height
@@ -131,10 +155,38 @@ void ChVehicleCosimTerrainNode::Initialize() {
             // Get track geometry data from tracked MBS node
             InitializeTrackData();
         }
+
+        // 6. Create the channels for asynchronous exchange (one per TIRE node or one with the tracked MBS node)
+
+        if (m_async) {
+            if (m_wheeled) {
+                for (int i = 0; i < m_num_objects; i++)
+                    m_channels.push_back(chrono_types::make_shared<AsyncChannel>(TIRE_NODE_RANK(i)));
+            } else {
+                m_channels.push_back(chrono_types::make_shared<AsyncChannel>(MBS_NODE_RANK));
+            }
+        }
     }
 
+    // With load balancing, share object information with all TERRAIN nodes
+    if (m_lb_enabled)
+        InitializeLoadBalancing();
+
     // Let derived classes perform their own initialization
     OnInitialize(m_num_objects);
+
+    // Set up views of the mesh data ring buffers of TIRE nodes running on the same host
+    InitializeSharedMemory(0);
+    if (m_rank == TERRAIN_NODE_RANK && m_wheeled && m_interface_type == InterfaceType::MESH) {
+        m_mesh_rings.resize(m_num_objects);
+        for (int i = 0; i < m_num_objects; i++) {
+            double* segment = GetSharedMemory(TIRE_NODE_RANK(i));
+            if (segment) {
+                int nv = (int)m_geometry[i].m_coll_meshes[0].m_trimesh->GetNumVertices();
+                m_mesh_rings[i] = chrono_types::make_shared<MeshRing>(segment, nv);
+            }
+        }
+    }
 }
 
 void ChVehicleCosimTerrainNode::InitializeTireData() {
@@ -214,6 +266,257 @@ void ChVehicleCosimTerrainNode::InitializeTrackData() {
         cout << "[Terrain node] Recv:  load_mass = " << m_load_mass[0] << endl;
 }
 
+// -----------------------------------------------------------------------------
+// Initialization of load balancing over all terrain nodes:
+// - broadcast object information from the main terrain node
+// - split the terrain patch in regions (all inactive, with state on the main terrain node)
+// Note:
+// The main terrain node has rank 0 in the terrain intra-communicator.
+// -----------------------------------------------------------------------------
+void ChVehicleCosimTerrainNode::InitializeLoadBalancing() {
+    if (!cosim::IsFrameworkInitialized()) {
+        cout << "ERROR: load balancing requires initialization of the co-simulation framework!" << endl;
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    m_terrain_comm = cosim::GetTerrainIntracommunicator();
+    MPI_Comm_rank(m_terrain_comm, &m_terrain_rank);
+    MPI_Comm_size(m_terrain_comm, &m_terrain_size);
+
+    // Broadcast number of objects, interface type, and number of object shapes
+    int info[3] = {m_num_objects, m_interface_type == InterfaceType::MESH ? 1 : 0, (int)m_geometry.size()};
+    MPI_Bcast(info, 3, MPI_INT, 0, m_terrain_comm);
+
+    if (info[1] == 1) {
+        if (m_terrain_rank == 0)
+            cout << "ERROR: load balancing does not support the MESH interface type!" << endl;
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    int num_shapes = info[2];
+    if (m_terrain_rank != 0) {
+        m_num_objects = info[0];
+        m_interface_type = InterfaceType::BODY;
+        m_obj_map.resize(m_num_objects);
+        m_rigid_state.resize(m_num_objects);
+        m_rigid_contact.resize(m_num_objects);
+        m_aabb.resize(num_shapes);
+        m_geometry.resize(num_shapes);
+        m_load_mass.resize(num_shapes);
+    }
+
+    // Broadcast object to shape mapping, load masses, and shape bounding boxes
+    std::vector<double> aabb_data(6 * num_shapes);
+    for (int k = 0; k < num_shapes && m_terrain_rank == 0; k++) {
+        const auto& aabb = m_aabb[k];
+        double data[6] = {aabb.min.x(), aabb.min.y(), aabb.min.z(), aabb.max.x(), aabb.max.y(), aabb.max.z()};
+        std::copy(data, data + 6, aabb_data.begin() + 6 * k);
+    }
+    MPI_Bcast(m_obj_map.data(), m_num_objects, MPI_INT, 0, m_terrain_comm);
+    MPI_Bcast(m_load_mass.data(), num_shapes, MPI_DOUBLE, 0, m_terrain_comm);
+    MPI_Bcast(aabb_data.data(), 6 * num_shapes, MPI_DOUBLE, 0, m_terrain_comm);
+    for (int k = 0; k < num_shapes; k++) {
+        m_aabb[k].min = ChVector3d(aabb_data[6 * k + 0], aabb_data[6 * k + 1], aabb_data[6 * k + 2]);
+        m_aabb[k].max = ChVector3d(aabb_data[6 * k + 3], aabb_data[6 * k + 4], aabb_data[6 * k + 5]);
+    }
+
+    // Send shape geometries from the main terrain node to all other terrain nodes
+    MPI_Group world_group;
+    MPI_Group terrain_group;
+    MPI_Comm_group(MPI_COMM_WORLD, &world_group);
+    MPI_Comm_group(m_terrain_comm, &terrain_group);
+    for (int r = 1; r < m_terrain_size; r++) {
+        int world_rank;
+        MPI_Group_translate_ranks(terrain_group, 1, &r, world_group, &world_rank);
+        for (int k = 0; k < num_shapes; k++) {
+            if (m_terrain_rank == 0)
+                SendGeometry(m_geometry[k], world_rank);
+            else if (m_terrain_rank == r)
+                RecvGeometry(m_geometry[k], TERRAIN_NODE_RANK);
+        }
+    }
+    MPI_Group_free(&terrain_group);
+    MPI_Group_free(&world_group);
+
+    // Split the terrain patch in regions
+    m_lb_nx = std::max(1, (int)std::ceil(m_dimX / m_lb_region_size));
+    m_lb_ny = std::max(1, (int)std::ceil(m_dimY / m_lb_region_size));
+    m_region_owner.assign(GetNumRegions(), -1);
+    m_region_holder.assign(GetNumRegions(), 0);
+    m_obj_owner.assign(m_num_objects, 0);
+
+    if (m_verbose && m_terrain_rank == 0) {
+        cout << "[Terrain node] load balancing over " << m_terrain_size << " nodes" << endl;
+        cout << "[Terrain node] terrain regions: " << m_lb_nx << " x " << m_lb_ny << endl;
+    }
+}
+
+int ChVehicleCosimTerrainNode::GetRegionIndex(const ChVector3d& pos) const {
+    if (!m_lb_enabled)
+        return 0;
+    int ix = (int)std::floor((pos.x() + m_dimX / 2) / m_lb_region_size);
+    int iy = (int)std::floor((pos.y() + m_dimY / 2) / m_lb_region_size);
+    ix = std::min(std::max(ix, 0), m_lb_nx - 1);
+    iy = std::min(std::max(iy, 0), m_lb_ny - 1);
+    return iy * m_lb_nx + ix;
+}
+
+bool ChVehicleCosimTerrainNode::IsRegionLocal(int region) const {
+    if (!m_lb_enabled)
+        return m_rank == TERRAIN_NODE_RANK;
+    return m_region_owner[region] == m_terrain_rank;
+}
+
+bool ChVehicleCosimTerrainNode::IsObjectLocal(int i) const {
+    if (!m_lb_enabled)
+        return true;
+    return m_obj_owner[i] == m_terrain_rank;
+}
+
+int ChVehicleCosimTerrainNode::GetNumLocalRegions() const {
+    if (!m_lb_enabled)
+        return m_rank == TERRAIN_NODE_RANK ? 1 : 0;
+    return (int)std::count(m_region_owner.begin(), m_region_owner.end(), m_terrain_rank);
+}
+
+// -----------------------------------------------------------------------------
+// Rebalancing of the terrain simulation over all terrain nodes:
+// - find the regions overlapped by the footprint of each object
+// - group objects with overlapping footprints (a group is handled by a single node)
+// - assign groups, in decreasing order of their number of regions, to the least loaded node
+// - migrate the state of regions that change owner
+// Note:
+// All terrain nodes have the same object states, so the assignment is calculated identically on all nodes.
+// Inactive regions keep their state on the last owner.
+// -----------------------------------------------------------------------------
+void ChVehicleCosimTerrainNode::Rebalance() {
+    int num_regions = GetNumRegions();
+
+    // Group objects with overlapping footprints
+    std::vector<int> parent(m_num_objects);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&parent](int i) {
+        while (parent[i] != i)
+            i = parent[i] = parent[parent[i]];
+        return i;
+    };
+
+    std::vector<int> region_obj(num_regions, -1);
+    for (int i = 0; i < m_num_objects; i++) {
+        const auto& aabb = m_aabb[m_obj_map[i]];
+        ChVector3d center = m_rigid_state[i].pos + m_rigid_state[i].rot.Rotate(aabb.Center());
+        double radius = 0.5 * aabb.Size().Length() + m_lb_margin;
+        int r0 = GetRegionIndex(center - ChVector3d(radius, radius, 0));
+        int r1 = GetRegionIndex(center + ChVector3d(radius, radius, 0));
+        for (int iy = r0 / m_lb_nx; iy <= r1 / m_lb_nx; iy++) {
+            for (int ix = r0 % m_lb_nx; ix <= r1 % m_lb_nx; ix++) {
+                int& j = region_obj[iy * m_lb_nx + ix];
+                if (j < 0) {
+                    j = i;
+                } else {
+                    int a = find(i);
+                    int b = find(j);
+                    parent[std::max(a, b)] = std::min(a, b);
+                }
+            }
+        }
+    }
+
+    std::map<int, std::vector<int>> group_regions;
+    for (int r = 0; r < num_regions; r++) {
+        if (region_obj[r] >= 0)
+            group_regions[find(region_obj[r])].push_back(r);
+    }
+
+    std::vector<int> groups;
+    for (const auto& g : group_regions)
+        groups.push_back(g.first);
+    std::stable_sort(groups.begin(), groups.end(), [&group_regions](int a, int b) {
+        return group_regions[a].size() > group_regions[b].size();
+    });
+
+    // Assign groups to nodes, preferring (at equal load) the node holding the state of most of the group regions
+    std::vector<int> load(m_terrain_size, 0);
+    std::map<int, int> group_owner;
+    for (auto g : groups) {
+        const auto& regions = group_regions[g];
+        std::vector<int> held(m_terrain_size, 0);
+        for (auto r : regions)
+            held[m_region_holder[r]]++;
+        int best = 0;
+        for (int n = 1; n < m_terrain_size; n++) {
+            if (load[n] < load[best] || (load[n] == load[best] && held[n] > held[best]))
+                best = n;
+        }
+        group_owner[g] = best;
+        load[best] += (int)regions.size();
+    }
+
+    std::vector<int> owner(num_regions, -1);
+    for (const auto& g : group_regions) {
+        for (auto r : g.second)
+            owner[r] = group_owner[g.first];
+    }
+    for (int i = 0; i < m_num_objects; i++)
+        m_obj_owner[i] = group_owner[find(i)];
+
+    // Pack the state of local regions that change owner (per destination: region index, data size, data)
+    std::vector<std::vector<double>> send(m_terrain_size);
+    for (int r = 0; r < num_regions; r++) {
+        if (owner[r] < 0 || owner[r] == m_region_holder[r] || m_region_holder[r] != m_terrain_rank)
+            continue;
+        auto& buffer = send[owner[r]];
+        buffer.push_back(r);
+        size_t start = buffer.size();
+        buffer.push_back(0);
+        PackRegionState(r, buffer);
+        buffer[start] = (double)(buffer.size() - start - 1);
+    }
+
+    // Exchange region states between all terrain nodes
+    std::vector<int> send_counts(m_terrain_size);
+    std::vector<int> recv_counts(m_terrain_size);
+    std::vector<int> send_displs(m_terrain_size, 0);
+    std::vector<int> recv_displs(m_terrain_size, 0);
+    std::vector<double> send_data;
+    for (int n = 0; n < m_terrain_size; n++) {
+        send_counts[n] = (int)send[n].size();
+        send_displs[n] = (int)send_data.size();
+        send_data.insert(send_data.end(), send[n].begin(), send[n].end());
+    }
+    MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, m_terrain_comm);
+    for (int n = 1; n < m_terrain_size; n++)
+        recv_displs[n] = recv_displs[n - 1] + recv_counts[n - 1];
+    std::vector<double> recv_data(recv_displs.back() + recv_counts.back());
+    MPI_Alltoallv(send_data.data(), send_counts.data(), send_displs.data(), MPI_DOUBLE, recv_data.data(),
+                  recv_counts.data(), recv_displs.data(), MPI_DOUBLE, m_terrain_comm);
+
+    // Unpack the state of regions migrated to this node
+    size_t k = 0;
+    while (k < recv_data.size()) {
+        int r = (int)recv_data[k];
+        int size = (int)recv_data[k + 1];
+        UnpackRegionState(r, recv_data.data() + k + 2, size);
+        k += 2 + size;
+    }
+
+    for (int r = 0; r < num_regions; r++) {
+        if (owner[r] >= 0)
+            m_region_holder[r] = owner[r];
+    }
+    m_region_owner = owner;
+
+    if (m_verbose && m_terrain_rank == 0) {
+        cout << "[Terrain node] rebalance: active regions per node =";
+        for (auto l : load)
+            cout << " " << l;
+        cout << endl;
+    }
+
+    // Let derived classes perform optional operations
+    OnRebalance();
+}
+
 // -----------------------------------------------------------------------------
 // Synchronization of the terrain node:
 // - receive mesh vertex states and set states of proxy bodies
@@ -223,6 +526,12 @@ void ChVehicleCosimTerrainNode::InitializeTrackData() {
 // Only the main terrain node participates in the co-simulation data exchange.
 // -----------------------------------------------------------------------------
 void ChVehicleCosimTerrainNode::Synchronize(int step_number, double time) {
+    if (m_lb_enabled) {
+        SynchronizeDistributedBody(step_number, time);
+        OnSynchronize(step_number, time);
+        return;
+    }
+
     switch (m_interface_type) {
         case InterfaceType::BODY:
             if (m_wheeled)
@@ -243,12 +552,23 @@ void ChVehicleCosimTerrainNode::Synchronize(int step_number, double time) {
 }
 
 void ChVehicleCosimTerrainNode::SynchronizeWheeledBody(int step_number, double time) {
+    // In asynchronous mode, post receives for the states of all tires
+    if (m_async && m_rank == TERRAIN_NODE_RANK) {
+        for (int i = 0; i < m_num_objects; i++)
+            m_channels[i]->PostRecv(13, step_number);
+    }
+
     for (int i = 0; i < m_num_objects; i++) {
         if (m_rank == TERRAIN_NODE_RANK) {
             // Receive rigid body state data for this tire
-            MPI_Status status;
             double state_data[13];
-            MPI_Recv(state_data, 13, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD, &status);
+            if (m_async) {
+                m_channels[i]->WaitRecv();
+                std::copy(m_channels[i]->GetRecvBuffer(), m_channels[i]->GetRecvBuffer() + 13, state_data);
+            } else {
+                MPI_Status status;
+                MPI_Recv(state_data, 13, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD, &status);
+            }
 
             m_rigid_state[i].pos = ChVector3d(state_data[0], state_data[1], state_data[2]);
             m_rigid_state[i].rot = ChQuaternion<>(state_data[3], state_data[4], state_data[5], state_data[6]);
@@ -274,7 +594,12 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledBody(int step_number, double t
             double force_data[] = {m_rigid_contact[i].force.x(),  m_rigid_contact[i].force.y(),
                                    m_rigid_contact[i].force.z(),  m_rigid_contact[i].moment.x(),
                                    m_rigid_contact[i].moment.y(), m_rigid_contact[i].moment.z()};
-            MPI_Send(force_data, 6, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD);
+            if (m_async) {
+                std::copy(force_data, force_data + 6, m_channels[i]->GetSendBuffer(6));
+                m_channels[i]->Send(step_number);
+            } else {
+                MPI_Send(force_data, 6, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD);
+            }
 
             if (m_verbose)
                 cout << "[Terrain node] Send: spindle force (" << i << ") = " << m_rigid_contact[i].force << endl;
@@ -293,9 +618,16 @@ void ChVehicleCosimTerrainNode::SynchronizeTrackedBody(int step_number, double t
 
     // Receive rigid body data for all track shoes
     if (m_rank == TERRAIN_NODE_RANK) {
-        MPI_Status status;
-        MPI_Recv(all_states.data(), 13 * m_num_objects, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD,
-                 &status);
+        if (m_async) {
+            m_channels[0]->PostRecv(13 * m_num_objects, step_number);
+            m_channels[0]->WaitRecv();
+            std::copy(m_channels[0]->GetRecvBuffer(), m_channels[0]->GetRecvBuffer() + 13 * m_num_objects,
+                      all_states.begin());
+        } else {
+            MPI_Status status;
+            MPI_Recv(all_states.data(), 13 * m_num_objects, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD,
+                     &status);
+        }
 
         // Unpack rigid body data
         start_idx = 0;
@@ -337,22 +669,168 @@ void ChVehicleCosimTerrainNode::SynchronizeTrackedBody(int step_number, double t
             start_idx += 6;
         }
 
-        MPI_Send(all_forces.data(), 6 * m_num_objects, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD);
+        if (m_async) {
+            std::copy(all_forces.begin(), all_forces.end(), m_channels[0]->GetSendBuffer(6 * m_num_objects));
+            m_channels[0]->Send(step_number);
+        } else {
+            MPI_Send(all_forces.data(), 6 * m_num_objects, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD);
+        }
 
         if (m_verbose)
             cout << "[Terrain node] step number: " << step_number << "  num contacts: " << GetNumContacts() << endl;
     }
 }
 
+void ChVehicleCosimTerrainNode::SynchronizeDistributedBody(int step_number, double time) {
+    std::vector<double> all_states(13 * m_num_objects);
+    std::vector<double> all_forces(6 * m_num_objects, 0.0);
+
+    // Receive rigid body data for all objects (from the TIRE nodes or from the tracked MBS node)
+    if (m_rank == TERRAIN_NODE_RANK) {
+        if (m_wheeled) {
+            if (m_async) {
+                for (int i = 0; i < m_num_objects; i++)
+                    m_channels[i]->PostRecv(13, step_number);
+            }
+            for (int i = 0; i < m_num_objects; i++) {
+                if (m_async) {
+                    m_channels[i]->WaitRecv();
+                    std::copy(m_channels[i]->GetRecvBuffer(), m_channels[i]->GetRecvBuffer() + 13,
+                              all_states.begin() + 13 * i);
+                } else {
+                    MPI_Status status;
+                    MPI_Recv(all_states.data() + 13 * i, 13, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number,
+                             MPI_COMM_WORLD, &status);
+                }
+            }
+        } else {
+            if (m_async) {
+                m_channels[0]->PostRecv(13 * m_num_objects, step_number);
+                m_channels[0]->WaitRecv();
+                std::copy(m_channels[0]->GetRecvBuffer(), m_channels[0]->GetRecvBuffer() + 13 * m_num_objects,
+                          all_states.begin());
+            } else {
+                MPI_Status status;
+                MPI_Recv(all_states.data(), 13 * m_num_objects, MPI_DOUBLE, MBS_NODE_RANK, step_number,
+                         MPI_COMM_WORLD, &status);
+            }
+        }
+    }
+
+    // Share rigid body data with all terrain nodes and unpack
+    MPI_Bcast(all_states.data(), 13 * m_num_objects, MPI_DOUBLE, 0, m_terrain_comm);
+    for (int i = 0; i < m_num_objects; i++) {
+        const double* data = all_states.data() + 13 * i;
+        m_rigid_state[i].pos = ChVector3d(data[0], data[1], data[2]);
+        m_rigid_state[i].rot = ChQuaternion<>(data[3], data[4], data[5], data[6]);
+        m_rigid_state[i].lin_vel = ChVector3d(data[7], data[8], data[9]);
+        m_rigid_state[i].ang_vel = ChVector3d(data[10], data[11], data[12]);
+    }
+
+    // Reassign regions and objects to terrain nodes
+    if (step_number % m_lb_num_steps == 0)
+        Rebalance();
+
+    // Set state of proxy rigid bodies and collect contact forces for objects handled by this node.
+    // Proxies of objects handled by other nodes are parked at rest above the terrain.
+    // Note that no force is collected at the first step.
+    for (int i = 0; i < m_num_objects; i++) {
+        if (!IsObjectLocal(i)) {
+            BodyState parked = m_rigid_state[i];
+            parked.pos.z() = GetInitHeight() + 2 * m_aabb[m_obj_map[i]].Size().Length() + m_lb_margin;
+            parked.lin_vel = VNULL;
+            parked.ang_vel = VNULL;
+            UpdateRigidProxy(i, parked);
+            continue;
+        }
+
+        UpdateRigidProxy(i, m_rigid_state[i]);
+        if (step_number > 0) {
+            GetForceRigidProxy(i, m_rigid_contact[i]);
+            double* data = all_forces.data() + 6 * i;
+            data[0] = m_rigid_contact[i].force.x();
+            data[1] = m_rigid_contact[i].force.y();
+            data[2] = m_rigid_contact[i].force.z();
+            data[3] = m_rigid_contact[i].moment.x();
+            data[4] = m_rigid_contact[i].moment.y();
+            data[5] = m_rigid_contact[i].moment.z();
+        }
+    }
+
+    // Collect contact forces from all terrain nodes
+    if (m_terrain_rank == 0)
+        MPI_Reduce(MPI_IN_PLACE, all_forces.data(), 6 * m_num_objects, MPI_DOUBLE, MPI_SUM, 0, m_terrain_comm);
+    else
+        MPI_Reduce(all_forces.data(), nullptr, 6 * m_num_objects, MPI_DOUBLE, MPI_SUM, 0, m_terrain_comm);
+
+    if (m_rank != TERRAIN_NODE_RANK)
+        return;
+
+    for (int i = 0; i < m_num_objects; i++) {
+        const double* data = all_forces.data() + 6 * i;
+        m_rigid_contact[i].point = m_rigid_state[i].pos;
+        m_rigid_contact[i].force = ChVector3d(data[0], data[1], data[2]);
+        m_rigid_contact[i].moment = ChVector3d(data[3], data[4], data[5]);
+    }
+
+    // Send contact forces (to the TIRE nodes or to the tracked MBS node)
+    if (m_wheeled) {
+        for (int i = 0; i < m_num_objects; i++) {
+            if (m_async) {
+                std::copy(all_forces.begin() + 6 * i, all_forces.begin() + 6 * i + 6, m_channels[i]->GetSendBuffer(6));
+                m_channels[i]->Send(step_number);
+            } else {
+                MPI_Send(all_forces.data() + 6 * i, 6, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD);
+            }
+        }
+    } else {
+        if (m_async) {
+            std::copy(all_forces.begin(), all_forces.end(), m_channels[0]->GetSendBuffer(6 * m_num_objects));
+            m_channels[0]->Send(step_number);
+        } else {
+            MPI_Send(all_forces.data(), 6 * m_num_objects, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD);
+        }
+    }
+
+    if (m_verbose)
+        cout << "[Terrain node] step number: " << step_number << "  local regions: " << GetNumLocalRegions() << endl;
+}
+
 void ChVehicleCosimTerrainNode::SynchronizeWheeledMesh(int step_number, double time) {
+    // In asynchronous mode, post receives for the mesh states of all tires (only for a notification if the mesh state
+    // is in shared memory)
+    if (m_async && m_rank == TERRAIN_NODE_RANK) {
+        for (int i = 0; i < m_num_objects; i++) {
+            auto nv = m_geometry[i].m_coll_meshes[0].m_trimesh->GetNumVertices();
+            m_channels[i]->PostRecv(m_mesh_rings[i] ? 0 : 2 * 3 * nv, step_number);
+        }
+    }
+
     for (int i = 0; i < m_num_objects; i++) {
         if (m_rank == TERRAIN_NODE_RANK) {
             auto nv = m_geometry[i].m_coll_meshes[0].m_trimesh->GetNumVertices();
+            const auto& mesh_ring = m_mesh_rings[i];
 
-            // Receive mesh state data
+            // Receive mesh state data, read directly from shared memory (if the TIRE node runs on the same host), from
+            // the receive buffer of the asynchronous channel, or in a temporary buffer
             MPI_Status status;
-            double* vert_data = new double[2 * 3 * nv];
-            MPI_Recv(vert_data, 2 * 3 * nv, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD, &status);
+            std::vector<double> buffer;
+            const double* vert_data;
+            if (m_async)
+                m_channels[i]->WaitRecv();
+            if (mesh_ring) {
+                if (!m_async)
+                    MPI_Recv(nullptr, 0, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD, &status);
+                SyncSharedMemory();
+                vert_data = mesh_ring->GetStateSlot(step_number);
+            } else if (m_async) {
+                vert_data = m_channels[i]->GetRecvBuffer();
+            } else {
+                buffer.resize(2 * 3 * nv);
+                MPI_Recv(buffer.data(), 2 * 3 * nv, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD,
+                         &status);
+                vert_data = buffer.data();
+            }
 
             for (unsigned int iv = 0; iv < nv; iv++) {
                 unsigned int offset = 3 * iv;
@@ -365,8 +843,6 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledMesh(int step_number, double t
 
             ////if (m_verbose)
             ////    PrintMeshUpdateData(i);
-
-            delete[] vert_data;
         }
 
         // Set position, rotation, and velocity of proxy bodies.
@@ -383,18 +859,44 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledMesh(int step_number, double t
             GetForceMeshProxy(i, m_mesh_contact[i]);
 
         if (m_rank == TERRAIN_NODE_RANK) {
-            // Send vertex indices and forces.
-            MPI_Send(m_mesh_contact[i].vidx.data(), m_mesh_contact[i].nv, MPI_INT, TIRE_NODE_RANK(i), step_number,
-                     MPI_COMM_WORLD);
-
-            double* force_data = new double[3 * m_mesh_contact[i].nv];
-            for (int iv = 0; iv < m_mesh_contact[i].nv; iv++) {
-                force_data[3 * iv + 0] = m_mesh_contact[i].vforce[iv].x();
-                force_data[3 * iv + 1] = m_mesh_contact[i].vforce[iv].y();
-                force_data[3 * iv + 2] = m_mesh_contact[i].vforce[iv].z();
+            const auto& mesh_ring = m_mesh_rings[i];
+            int nvc = m_mesh_contact[i].nv;
+            if (m_async || mesh_ring) {
+                // Pack vertex indices and forces in a single message (directly in shared memory if available)
+                double* contact_data =
+                    mesh_ring ? mesh_ring->GetContactSlot(step_number) : m_channels[i]->GetSendBuffer(4 * nvc);
+                for (int iv = 0; iv < nvc; iv++) {
+                    contact_data[iv] = m_mesh_contact[i].vidx[iv];
+                    contact_data[nvc + 3 * iv + 0] = m_mesh_contact[i].vforce[iv].x();
+                    contact_data[nvc + 3 * iv + 1] = m_mesh_contact[i].vforce[iv].y();
+                    contact_data[nvc + 3 * iv + 2] = m_mesh_contact[i].vforce[iv].z();
+                }
+
+                // Send the message (only the number of vertices in contact if the data is in shared memory)
+                if (mesh_ring) {
+                    SyncSharedMemory();
+                    if (m_async) {
+                        m_channels[i]->GetSendBuffer(1)[0] = nvc;
+                        m_channels[i]->Send(step_number);
+                    } else {
+                        MPI_Send(&nvc, 1, MPI_INT, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD);
+                    }
+                } else {
+                    m_channels[i]->Send(step_number);
+                }
+            } else {
+                // Send vertex indices and forces.
+                MPI_Send(m_mesh_contact[i].vidx.data(), nvc, MPI_INT, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD);
+
+                double* force_data = new double[3 * nvc];
+                for (int iv = 0; iv < nvc; iv++) {
+                    force_data[3 * iv + 0] = m_mesh_contact[i].vforce[iv].x();
+                    force_data[3 * iv + 1] = m_mesh_contact[i].vforce[iv].y();
+                    force_data[3 * iv + 2] = m_mesh_contact[i].vforce[iv].z();
+                }
+                MPI_Send(force_data, 3 * nvc, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD);
+                delete[] force_data;
             }
-            MPI_Send(force_data, 3 * m_mesh_contact[i].nv, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD);
-            delete[] force_data;
 
             if (m_verbose)
                 cout << "[Terrain node] step number: " << step_number << "  num contacts: " << GetNumContacts()
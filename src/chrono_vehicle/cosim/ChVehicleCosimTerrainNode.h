@@ -65,6 +65,25 @@ class CH_VEHICLE_API ChVehicleCosimTerrainNode : public ChVehicleCosimBaseNode {
     /// Get the terrain patch dimensions.
     void GetDimensions(double& length, double& width);
 
+    /// Enable dynamic load balancing of the terrain simulation over all TERRAIN nodes.
+    /// The terrain patch is split in square regions of given size. A region is active if it overlaps the footprint of
+    /// an interacting object (enlarged by the specified margin). Every 'num_steps' co-simulation steps, groups of
+    /// objects with overlapping footprints are assigned to TERRAIN nodes so as to balance the number of active regions
+    /// per node, and the terrain state of any region that changes owner is migrated over the terrain intra-communicator
+    /// (see cosim::GetTerrainIntracommunicator). Only the BODY communication interface is supported.
+    /// If invoked, this function must be called on all TERRAIN nodes before Initialize, and the co-simulation framework
+    /// must be initialized (see cosim::InitializeFramework). With load balancing, all TERRAIN nodes must call
+    /// Synchronize and Advance (i.e., they are all co-simulation nodes).
+    void EnableLoadBalancing(double region_size, int num_steps = 50, double margin = 0.25);
+
+    /// Return true if this node is part of the co-simulation infrastructure.
+    /// With load balancing enabled, this is the case for all TERRAIN nodes.
+    virtual bool IsCosimNode() const override;
+
+    /// Return the number of active terrain regions currently assigned to this node.
+    /// Without load balancing, the entire patch is a single region owned by the main terrain node.
+    int GetNumLocalRegions() const;
+
     /// Initialize this node.
     /// This function allows the node to initialize itself and, optionally, perform an
     /// initial data exchange with any other node.
@@ -159,6 +178,38 @@ class CH_VEHICLE_API ChVehicleCosimTerrainNode : public ChVehicleCosimBaseNode {
     /// Load contact forces (expressed in absolute frame) into the provided TerrainForce struct.
     virtual void GetForceRigidProxy(unsigned int i, TerrainForce& rigid_contact) = 0;
 
+    // ------------------------- Virtual methods for load balancing
+    // A derived class should implement these methods to support load balancing over multiple TERRAIN nodes.
+
+    /// Append the current state of the terrain in the specified region to the provided buffer.
+    /// Called on the node holding the latest state of a region that is migrated to a different node.
+    virtual void PackRegionState(int region, std::vector<double>& buffer) {}
+
+    /// Set the terrain state in the specified region from the provided data (as packed by PackRegionState).
+    /// Called on the node that becomes owner of a migrated region.
+    virtual void UnpackRegionState(int region, const double* data, int size) {}
+
+    /// Perform any additional operations after a change in the assignment of regions to TERRAIN nodes.
+    /// Called on all TERRAIN nodes, after state migration.
+    virtual void OnRebalance() {}
+
+    // ------------------------- Utility functions for load balancing
+
+    /// Return true if load balancing over multiple TERRAIN nodes is enabled.
+    bool IsLoadBalancingEnabled() const { return m_lb_enabled; }
+
+    /// Return the number of terrain regions.
+    int GetNumRegions() const { return m_lb_nx * m_lb_ny; }
+
+    /// Return the index of the terrain region containing the specified point (clamped to the patch boundary).
+    int GetRegionIndex(const ChVector3d& pos) const;
+
+    /// Return true if the specified terrain region is active and owned by this node.
+    bool IsRegionLocal(int region) const;
+
+    /// Return true if the specified interacting object is handled by this node.
+    bool IsObjectLocal(int i) const;
+
   protected:
     double m_dimX;  ///< patch length (X direction)
     double m_dimY;  ///< patch width (Y direction)
@@ -188,9 +239,40 @@ class CH_VEHICLE_API ChVehicleCosimTerrainNode : public ChVehicleCosimBaseNode {
     void SynchronizeWheeledMesh(int step_number, double time);
     void SynchronizeTrackedMesh(int step_number, double time);
 
+    /// Share the object information received by the main terrain node with all other TERRAIN nodes.
+    void InitializeLoadBalancing();
+
+    /// Synchronization with the BODY communication interface when load balancing is enabled.
+    /// Object states are broadcast to all TERRAIN nodes and contact forces are reduced on the main terrain node.
+    void SynchronizeDistributedBody(int step_number, double time);
+
+    /// Assign active regions and objects to TERRAIN nodes and migrate the state of regions that change owner.
+    void Rebalance();
+
     /// Print vertex and face connectivity data for the i-th object, as received at synchronization.
     /// Invoked only when using the MESH communication interface.
     void PrintMeshUpdateData(int i);
+
+    /// Channels to the TIRE nodes or to the tracked MBS node (asynchronous mode, main terrain node only).
+    std::vector<std::shared_ptr<AsyncChannel>> m_channels;
+
+    /// Mesh data in shared memory, for TIRE nodes running on the same host (main terrain node only).
+    std::vector<std::shared_ptr<MeshRing>> m_mesh_rings;
+
+    // Load balancing data
+
+    bool m_lb_enabled;                 ///< load balancing over multiple TERRAIN nodes?
+    double m_lb_region_size;           ///< size of a terrain region
+    int m_lb_num_steps;                ///< number of co-simulation steps between rebalancing
+    double m_lb_margin;                ///< margin added to object footprints
+    int m_lb_nx;                       ///< number of regions in X direction
+    int m_lb_ny;                       ///< number of regions in Y direction
+    MPI_Comm m_terrain_comm;           ///< intra-communicator of all TERRAIN nodes
+    int m_terrain_rank;                ///< rank of this node in the terrain intra-communicator
+    int m_terrain_size;                ///< number of TERRAIN nodes
+    std::vector<int> m_region_owner;   ///< terrain rank owning each region (-1 if inactive)
+    std::vector<int> m_region_holder;  ///< terrain rank holding the latest state of each region
+    std::vector<int> m_obj_owner;      ///< terrain rank handling each interacting object
 };
 
 /// @} vehicle_cosim
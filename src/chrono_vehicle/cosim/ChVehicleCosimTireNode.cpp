@@ -21,6 +21,8 @@
 
 //// TODO allow changing the collision system
 
+#include <algorithm>
+
 #include "chrono/ChConfig.h"
 #include "chrono/solver/ChIterativeSolver.h"
 #include "chrono/solver/ChDirectSolverLS.h"
@@ -221,6 +223,23 @@ void ChVehicleCosimTireNode::Initialize() {
     MPI_Send(&load_mass, 1, MPI_DOUBLE, TERRAIN_NODE_RANK, 0, MPI_COMM_WORLD);
     if (m_verbose)
         cout << "[Tire node " << m_index << " ] Send: load mass = " << load_mass << endl;
+
+    // Create the channels for asynchronous exchange with the MBS and TERRAIN nodes
+    if (m_async) {
+        m_mbs_channel = chrono_types::make_shared<AsyncChannel>(MBS_NODE_RANK);
+        m_terrain_channel = chrono_types::make_shared<AsyncChannel>(TERRAIN_NODE_RANK);
+    }
+
+    // Allocate the shared memory ring buffers for the mesh data (only if the TERRAIN node runs on the same host)
+    size_t shm_size = 0;
+    int nv = 0;
+    if (GetInterfaceType() == InterfaceType::MESH && IsOnSameHost(TERRAIN_NODE_RANK)) {
+        nv = (int)m_geometry.m_coll_meshes[0].m_trimesh->GetNumVertices();
+        shm_size = MeshRing::GetSize(nv);
+    }
+    InitializeSharedMemory(shm_size);
+    if (shm_size > 0)
+        m_mesh_ring = chrono_types::make_shared<MeshRing>(GetSharedMemory(m_rank), nv);
 }
 
 void ChVehicleCosimTireNode::InitializeSystem() {
@@ -256,6 +275,7 @@ void ChVehicleCosimTireNode::InitializeSystem() {
         }
         case ChSolver::Type::PSOR:
         case ChSolver::Type::PSSOR:
+        case ChSolver::Type::PSOR_COLORED:
         case ChSolver::Type::PJACOBI:
         case ChSolver::Type::PMINRES:
         case ChSolver::Type::BARZILAIBORWEIN:
@@ -322,14 +342,30 @@ void ChVehicleCosimTireNode::SynchronizeBody(int step_number, double time) {
     // Pass it to derived class
     ApplySpindleState(spindle_state);
 
-    // Send spindle state data to Terrain node
-    MPI_Send(state_data, 13, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD);
+    // Send spindle state data to Terrain node.
+    // In asynchronous mode, first post the receive for the spindle force of the current step (unless lagged).
+    if (m_async) {
+        if (!m_lagged)
+            m_terrain_channel->PostRecv(6, step_number);
+        std::copy(state_data, state_data + 13, m_terrain_channel->GetSendBuffer(13));
+        m_terrain_channel->Send(step_number);
+    } else {
+        MPI_Send(state_data, 13, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD);
+    }
     if (m_verbose)
         cout << "[Tire node " << m_index << " ] Send: spindle position = " << spindle_state.pos << endl;
 
-    // Receive spindle force from TERRAIN NODE and send to MBS node
-    double force_data[6];
-    MPI_Recv(force_data, 6, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+    // Receive spindle force from TERRAIN NODE and send to MBS node.
+    // With lagged coupling, this is the force sent by the terrain node at the previous step (none at the first step).
+    double force_data[6] = {0, 0, 0, 0, 0, 0};
+    if (m_async) {
+        if (m_terrain_channel->WaitRecv() > 0)
+            std::copy(m_terrain_channel->GetRecvBuffer(), m_terrain_channel->GetRecvBuffer() + 6, force_data);
+        if (m_lagged)
+            m_terrain_channel->PostRecv(6, step_number);
+    } else {
+        MPI_Recv(force_data, 6, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+    }
 
     TerrainForce spindle_force;
     spindle_force.force = ChVector3d(force_data[0], force_data[1], force_data[2]);
@@ -342,7 +378,12 @@ void ChVehicleCosimTireNode::SynchronizeBody(int step_number, double time) {
     ApplySpindleForce(spindle_force);
 
     // Send spindle force to MBS node
-    MPI_Send(force_data, 6, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD);
+    if (m_async) {
+        std::copy(force_data, force_data + 6, m_mbs_channel->GetSendBuffer(6));
+        m_mbs_channel->Send(step_number);
+    } else {
+        MPI_Send(force_data, 6, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD);
+    }
 }
 
 void ChVehicleCosimTireNode::SynchronizeMesh(int step_number, double time) {
@@ -365,7 +406,19 @@ void ChVehicleCosimTireNode::SynchronizeMesh(int step_number, double time) {
     MeshState mesh_state;
     LoadMeshState(mesh_state);
     unsigned int nvs = (unsigned int)mesh_state.vpos.size();
-    double* vert_data = new double[2 * 3 * nvs];
+
+    // Pack the mesh state directly in shared memory (if the TERRAIN node runs on the same host), in the send buffer of
+    // the asynchronous channel, or in a temporary buffer
+    std::vector<double> buffer;
+    double* vert_data;
+    if (m_mesh_ring) {
+        vert_data = m_mesh_ring->GetStateSlot(step_number);
+    } else if (m_async) {
+        vert_data = m_terrain_channel->GetSendBuffer(2 * 3 * nvs);
+    } else {
+        buffer.resize(2 * 3 * nvs);
+        vert_data = buffer.data();
+    }
     for (unsigned int iv = 0; iv < nvs; iv++) {
         vert_data[3 * iv + 0] = mesh_state.vpos[iv].x();
         vert_data[3 * iv + 1] = mesh_state.vpos[iv].y();
@@ -376,27 +429,87 @@ void ChVehicleCosimTireNode::SynchronizeMesh(int step_number, double time) {
         vert_data[3 * nvs + 3 * iv + 1] = mesh_state.vvel[iv].y();
         vert_data[3 * nvs + 3 * iv + 2] = mesh_state.vvel[iv].z();
     }
-    MPI_Send(vert_data, 2 * 3 * nvs, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD);
-
-    // Receive mesh forces from TERRAIN node.
-    // Note that we use MPI_Probe to figure out the number of indices and forces received.
-    int nvc = 0;
-    MPI_Probe(TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
-    MPI_Get_count(&status, MPI_INT, &nvc);
-    int* index_data = new int[nvc];
-    double* mesh_contact_data = new double[3 * nvc];
-    MPI_Recv(index_data, nvc, MPI_INT, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
-    MPI_Recv(mesh_contact_data, 3 * nvc, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+
+    // In asynchronous mode, first post the receive for the mesh forces of the current step (unless lagged).
+    // The mesh contact data is then received in a single message, with at most 4 values per mesh vertex, or only the
+    // number of vertices in contact is received if the contact data is in shared memory.
+    int contact_count = m_mesh_ring ? 1 : 4 * nvs;
+    if (m_async && !m_lagged)
+        m_terrain_channel->PostRecv(contact_count, step_number);
+
+    // Send mesh state to TERRAIN node (only a notification if the mesh state is in shared memory)
+    if (m_mesh_ring) {
+        SyncSharedMemory();
+        if (m_async) {
+            m_terrain_channel->GetSendBuffer(0);
+            m_terrain_channel->Send(step_number);
+        } else {
+            MPI_Send(nullptr, 0, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD);
+        }
+    } else if (m_async) {
+        m_terrain_channel->Send(step_number);
+    } else {
+        MPI_Send(vert_data, 2 * 3 * nvs, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD);
+    }
 
     MeshContact mesh_contact;
-    mesh_contact.nv = nvc;
-    mesh_contact.vidx.resize(nvc);
-    mesh_contact.vforce.resize(nvc);
-    for (int iv = 0; iv < nvc; iv++) {
-        int index = index_data[iv];
-        mesh_contact.vidx[iv] = index;
-        mesh_contact.vforce[iv] =
-            ChVector3d(mesh_contact_data[3 * iv + 0], mesh_contact_data[3 * iv + 1], mesh_contact_data[3 * iv + 2]);
+
+    if (m_async || m_mesh_ring) {
+        // Receive mesh forces from TERRAIN node, packed as vertex indices followed by vertex forces.
+        // With lagged coupling, these are the forces sent by the terrain node at the previous step (none at the first
+        // step).
+        const double* contact_data = nullptr;
+        int nvc = 0;
+        if (m_async) {
+            bool pending = m_terrain_channel->IsRecvPending();
+            int count = m_terrain_channel->WaitRecv();
+            if (pending && m_mesh_ring) {
+                nvc = (int)m_terrain_channel->GetRecvBuffer()[0];
+                contact_data = m_mesh_ring->GetContactSlot(m_lagged ? step_number - 1 : step_number);
+            } else if (pending) {
+                nvc = count / 4;
+                contact_data = m_terrain_channel->GetRecvBuffer();
+            }
+            if (m_lagged)
+                m_terrain_channel->PostRecv(contact_count, step_number);
+        } else {
+            MPI_Recv(&nvc, 1, MPI_INT, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+            contact_data = m_mesh_ring->GetContactSlot(step_number);
+        }
+        if (m_mesh_ring)
+            SyncSharedMemory();
+
+        mesh_contact.nv = nvc;
+        mesh_contact.vidx.resize(nvc);
+        mesh_contact.vforce.resize(nvc);
+        for (int iv = 0; iv < nvc; iv++) {
+            mesh_contact.vidx[iv] = (int)contact_data[iv];
+            mesh_contact.vforce[iv] = ChVector3d(contact_data[nvc + 3 * iv + 0], contact_data[nvc + 3 * iv + 1],
+                                                 contact_data[nvc + 3 * iv + 2]);
+        }
+    } else {
+        // Receive mesh forces from TERRAIN node.
+        // Note that we use MPI_Probe to figure out the number of indices and forces received.
+        int nvc = 0;
+        MPI_Probe(TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+        MPI_Get_count(&status, MPI_INT, &nvc);
+        int* index_data = new int[nvc];
+        double* mesh_contact_data = new double[3 * nvc];
+        MPI_Recv(index_data, nvc, MPI_INT, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+        MPI_Recv(mesh_contact_data, 3 * nvc, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+
+        mesh_contact.nv = nvc;
+        mesh_contact.vidx.resize(nvc);
+        mesh_contact.vforce.resize(nvc);
+        for (int iv = 0; iv < nvc; iv++) {
+            int index = index_data[iv];
+            mesh_contact.vidx[iv] = index;
+            mesh_contact.vforce[iv] = ChVector3d(mesh_contact_data[3 * iv + 0], mesh_contact_data[3 * iv + 1],
+                                                 mesh_contact_data[3 * iv + 2]);
+        }
+
+        delete[] index_data;
+        delete[] mesh_contact_data;
     }
 
     if (m_verbose)
@@ -411,11 +524,12 @@ void ChVehicleCosimTireNode::SynchronizeMesh(int step_number, double time) {
     LoadSpindleForce(spindle_force);
     double force_data[] = {spindle_force.force.x(),  spindle_force.force.y(),  spindle_force.force.z(),
                            spindle_force.moment.x(), spindle_force.moment.y(), spindle_force.moment.z()};
-    MPI_Send(force_data, 6, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD);
-
-    delete[] vert_data;
-    delete[] index_data;
-    delete[] mesh_contact_data;
+    if (m_async) {
+        std::copy(force_data, force_data + 6, m_mbs_channel->GetSendBuffer(6));
+        m_mbs_channel->Send(step_number);
+    } else {
+        MPI_Send(force_data, 6, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD);
+    }
 }
 
 void ChVehicleCosimTireNode::OutputData(int frame) {
@@ -181,6 +181,10 @@ class CH_VEHICLE_API ChVehicleCosimTireNode : public ChVehicleCosimBaseNode {
     void InitializeSystem();
     void SynchronizeBody(int step_number, double time);
     void SynchronizeMesh(int step_number, double time);
+
+    std::shared_ptr<AsyncChannel> m_mbs_channel;      ///< channel to the MBS node (asynchronous mode)
+    std::shared_ptr<AsyncChannel> m_terrain_channel;  ///< channel to the TERRAIN node (asynchronous mode)
+    std::shared_ptr<MeshRing> m_mesh_ring;            ///< mesh data in shared memory (TERRAIN node on same host)
 };
 
 /// @} vehicle_cosim
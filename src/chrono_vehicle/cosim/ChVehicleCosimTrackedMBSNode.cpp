@@ -159,6 +159,13 @@ void ChVehicleCosimTrackedMBSNode::Initialize() {
 
         OnInitializeDBPRig(m_DBP_rig->GetMotorFunction());
     }
+
+    // Create the channel for asynchronous exchange with the TERRAIN node
+    if (m_async)
+        m_terrain_channel = chrono_types::make_shared<AsyncChannel>(TERRAIN_NODE_RANK);
+
+    // No mesh data is exchanged through shared memory by the MBS node
+    InitializeSharedMemory(0);
 }
 
 // -----------------------------------------------------------------------------
@@ -197,6 +204,7 @@ void ChVehicleCosimTrackedMBSNode::InitializeSystem() {
         }
         case ChSolver::Type::PSOR:
         case ChSolver::Type::PSSOR:
+        case ChSolver::Type::PSOR_COLORED:
         case ChSolver::Type::PJACOBI:
         case ChSolver::Type::PMINRES:
         case ChSolver::Type::BARZILAIBORWEIN:
@@ -266,13 +274,32 @@ void ChVehicleCosimTrackedMBSNode::Synchronize(int step_number, double time) {
         }
     }
 
-    // Send track shoe states to the terrain node
-    MPI_Send(all_states.data(), 13 * num_shoes, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD);
-
-    // Receive track shoe forces as applied to the center of the track shoe body.
-    // Note that we assume this is the resultant wrench at the track shoe origin (expressed in absolute frame).
-    MPI_Status status;
-    MPI_Recv(all_forces.data(), 6 * num_shoes, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+    if (m_async) {
+        // Post the receive for the track shoe forces of the current step (unless lagged), then send the track shoe
+        // states to the terrain node.
+        if (!m_lagged)
+            m_terrain_channel->PostRecv(6 * num_shoes, step_number);
+        std::copy(all_states.begin(), all_states.end(), m_terrain_channel->GetSendBuffer(13 * num_shoes));
+        m_terrain_channel->Send(step_number);
+
+        // Receive track shoe forces. With lagged coupling, these are the forces sent by the terrain node at the
+        // previous step (no forces at the first step).
+        if (m_terrain_channel->WaitRecv() > 0) {
+            const double* force_data = m_terrain_channel->GetRecvBuffer();
+            std::copy(force_data, force_data + 6 * num_shoes, all_forces.begin());
+        }
+        if (m_lagged)
+            m_terrain_channel->PostRecv(6 * num_shoes, step_number);
+    } else {
+        // Send track shoe states to the terrain node
+        MPI_Send(all_states.data(), 13 * num_shoes, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD);
+
+        // Receive track shoe forces as applied to the center of the track shoe body.
+        // Note that we assume this is the resultant wrench at the track shoe origin (expressed in absolute frame).
+        MPI_Status status;
+        MPI_Recv(all_forces.data(), 6 * num_shoes, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD,
+                 &status);
+    }
 
     // Apply track shoe forces on each individual track shoe body
     start_idx = 0;
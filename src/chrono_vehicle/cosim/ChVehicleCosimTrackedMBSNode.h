@@ -157,6 +157,8 @@ class CH_VEHICLE_API ChVehicleCosimTrackedMBSNode : public ChVehicleCosimBaseNod
     void InitializeSystem();
 
     bool m_fix_chassis;
+
+    std::shared_ptr<AsyncChannel> m_terrain_channel;  ///< channel to the TERRAIN node (asynchronous mode)
 };
 
 /// @} vehicle_cosim
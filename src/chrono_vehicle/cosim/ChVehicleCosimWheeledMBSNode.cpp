@@ -172,6 +172,12 @@ void ChVehicleCosimWheeledMBSNode::Initialize() {
         MPI_Send(&load, 1, MPI_DOUBLE, TIRE_NODE_RANK(i), 0, MPI_COMM_WORLD);
     }
 
+    // Create the channels for asynchronous exchange with the TIRE nodes
+    if (m_async) {
+        for (unsigned int i = 0; i < m_num_tire_nodes; i++)
+            m_tire_channels.push_back(chrono_types::make_shared<AsyncChannel>(TIRE_NODE_RANK(i)));
+    }
+
     // Initialize the DBP rig if one is attached
     if (m_DBP_rig) {
         m_DBP_rig->m_verbose = m_verbose;
@@ -183,6 +189,9 @@ void ChVehicleCosimWheeledMBSNode::Initialize() {
 
         OnInitializeDBPRig(m_DBP_rig->GetMotorFunction());
     }
+
+    // No mesh data is exchanged through shared memory by the MBS node
+    InitializeSharedMemory(0);
 }
 
 // -----------------------------------------------------------------------------
@@ -221,6 +230,7 @@ void ChVehicleCosimWheeledMBSNode::InitializeSystem() {
         }
         case ChSolver::Type::PSOR:
         case ChSolver::Type::PSSOR:
+        case ChSolver::Type::PSOR_COLORED:
         case ChSolver::Type::PJACOBI:
         case ChSolver::Type::PMINRES:
         case ChSolver::Type::BARZILAIBORWEIN:
@@ -263,6 +273,11 @@ void ChVehicleCosimWheeledMBSNode::InitializeSystem() {
 // - receive and apply vertex contact forces
 // -----------------------------------------------------------------------------
 void ChVehicleCosimWheeledMBSNode::Synchronize(int step_number, double time) {
+    if (m_async) {
+        SynchronizeAsync(step_number, time);
+        return;
+    }
+
     MPI_Status status;
 
     for (unsigned int i = 0; i < m_num_tire_nodes; i++) {
@@ -296,6 +311,45 @@ void ChVehicleCosimWheeledMBSNode::Synchronize(int step_number, double time) {
     }
 }
 
+// Asynchronous synchronization of the MBS node:
+// - post receives for the spindle forces from all tire nodes
+// - send the spindle states to all tire nodes
+// - receive and apply the spindle forces
+// Note that the MBS-tire coupling is never lagged (see EnableAsyncExchange).
+void ChVehicleCosimWheeledMBSNode::SynchronizeAsync(int step_number, double time) {
+    for (unsigned int i = 0; i < m_num_tire_nodes; i++)
+        m_tire_channels[i]->PostRecv(6, step_number);
+
+    for (unsigned int i = 0; i < m_num_tire_nodes; i++) {
+        BodyState state = GetSpindleState(i);
+        double state_data[] = {
+            state.pos.x(),     state.pos.y(),     state.pos.z(),                      //
+            state.rot.e0(),    state.rot.e1(),    state.rot.e2(),    state.rot.e3(),  //
+            state.lin_vel.x(), state.lin_vel.y(), state.lin_vel.z(),                  //
+            state.ang_vel.x(), state.ang_vel.y(), state.ang_vel.z()                   //
+        };
+        std::copy(state_data, state_data + 13, m_tire_channels[i]->GetSendBuffer(13));
+        m_tire_channels[i]->Send(step_number);
+
+        if (m_verbose)
+            cout << "[MBS node    ] Send: spindle position (" << i << ") = " << state.pos << endl;
+    }
+
+    for (unsigned int i = 0; i < m_num_tire_nodes; i++) {
+        m_tire_channels[i]->WaitRecv();
+        const double* force_data = m_tire_channels[i]->GetRecvBuffer();
+
+        TerrainForce spindle_force;
+        spindle_force.point = GetSpindleBody(i)->GetPos();
+        spindle_force.force = ChVector3d(force_data[0], force_data[1], force_data[2]);
+        spindle_force.moment = ChVector3d(force_data[3], force_data[4], force_data[5]);
+        ApplySpindleForce(i, spindle_force);
+
+        if (m_verbose)
+            cout << "[MBS node    ] Recv: spindle force (" << i << ") = " << spindle_force.force << endl;
+    }
+}
+
 // -----------------------------------------------------------------------------
 // Advance simulation of the MBS node by the specified duration
 // -----------------------------------------------------------------------------
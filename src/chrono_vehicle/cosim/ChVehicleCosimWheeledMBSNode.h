@@ -168,8 +168,11 @@ class CH_VEHICLE_API ChVehicleCosimWheeledMBSNode : public ChVehicleCosimBaseNod
   private:
     virtual ChSystem* GetSystemPostprocess() const override { return m_system; }
     void InitializeSystem();
+    void SynchronizeAsync(int step_number, double time);
 
     bool m_fix_chassis;
+
+    std::vector<std::shared_ptr<AsyncChannel>> m_tire_channels;  ///< channels to the TIRE nodes (asynchronous mode)
 };
 
 /// @} vehicle_cosim
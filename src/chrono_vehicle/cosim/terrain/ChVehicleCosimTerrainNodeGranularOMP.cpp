@@ -832,6 +832,9 @@ void ChVehicleCosimTerrainNodeGranularOMP::CreateRigidProxy(unsigned int i) {
 void ChVehicleCosimTerrainNodeGranularOMP::OnInitialize(unsigned int num_objects) {
     ChVehicleCosimTerrainNodeChrono::OnInitialize(num_objects);
 
+    if (IsLoadBalancingEnabled())
+        InitializeLoadBalancing();
+
     // Create the visualization window
     if (m_renderRT) {
 #if defined(CHRONO_VSG)
@@ -866,6 +869,58 @@ void ChVehicleCosimTerrainNodeGranularOMP::OnInitialize(unsigned int num_objects
     }
 }
 
+// Make the particle states identical on all terrain nodes (those of the main terrain node).
+// All particles are initially frozen, as there is no active terrain region before the first rebalancing.
+void ChVehicleCosimTerrainNodeGranularOMP::InitializeLoadBalancing() {
+    MPI_Comm terrain_comm = cosim::GetTerrainIntracommunicator();
+    int terrain_rank;
+    MPI_Comm_rank(terrain_comm, &terrain_rank);
+
+    m_particles.clear();
+    for (const auto& body : m_system->GetBodies()) {
+        if (body->GetTag() >= tag_particles)
+            m_particles.push_back(body);
+    }
+
+    // All terrain nodes must have the same number of particles
+    int num_particles = (int)m_particles.size();
+    int num_particles_main = num_particles;
+    MPI_Bcast(&num_particles_main, 1, MPI_INT, 0, terrain_comm);
+    if (num_particles != num_particles_main) {
+        cout << "ERROR: inconsistent number of particles on terrain nodes!" << endl;
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+
+    std::vector<double> states(13 * num_particles + 1);
+    if (terrain_rank == 0) {
+        for (int ip = 0; ip < num_particles; ip++) {
+            const auto& body = m_particles[ip];
+            double* data = states.data() + 13 * ip;
+            const auto& pos = body->GetPos();
+            const auto& rot = body->GetRot();
+            const auto& lin_vel = body->GetPosDt();
+            const auto& ang_vel = body->GetAngVelParent();
+            double particle[13] = {pos.x(),     pos.y(),     pos.z(),     rot.e0(),    rot.e1(),
+                                   rot.e2(),    rot.e3(),    lin_vel.x(), lin_vel.y(), lin_vel.z(),
+                                   ang_vel.x(), ang_vel.y(), ang_vel.z()};
+            std::copy(particle, particle + 13, data);
+        }
+        states[13 * num_particles] = m_init_height;
+    }
+    MPI_Bcast(states.data(), 13 * num_particles + 1, MPI_DOUBLE, 0, terrain_comm);
+
+    for (int ip = 0; ip < num_particles; ip++) {
+        const double* data = states.data() + 13 * ip;
+        auto& body = m_particles[ip];
+        body->SetPos(ChVector3d(data[0], data[1], data[2]));
+        body->SetRot(ChQuaternion<>(data[3], data[4], data[5], data[6]));
+        body->SetPosDt(ChVector3d(data[7], data[8], data[9]));
+        body->SetAngVelParent(ChVector3d(data[10], data[11], data[12]));
+        body->SetFixed(true);
+    }
+    m_init_height = states[13 * num_particles];
+}
+
 // Set position, orientation, and velocity of proxy bodies based on mesh faces.
 // The proxy body is effectively reconstructed at each synchronization time:
 //    - position at the center of mass of the three vertices
@@ -1040,6 +1095,63 @@ void ChVehicleCosimTerrainNodeGranularOMP::OnAdvance(double step_size) {
     m_system->CalculateContactForces();
 }
 
+// -----------------------------------------------------------------------------
+// Load balancing
+// The state of a region consists of the states of the particles currently located in that region.
+// Particles are simulated only on the node owning the region they are in; all other particles are frozen.
+// -----------------------------------------------------------------------------
+
+void ChVehicleCosimTerrainNodeGranularOMP::PackRegionState(int region, std::vector<double>& buffer) {
+    for (size_t ip = 0; ip < m_particles.size(); ip++) {
+        const auto& body = m_particles[ip];
+        const auto& pos = body->GetPos();
+        if (GetRegionIndex(pos) != region)
+            continue;
+        const auto& rot = body->GetRot();
+        const auto& lin_vel = body->GetPosDt();
+        const auto& ang_vel = body->GetAngVelParent();
+        double particle[14] = {(double)ip,  pos.x(),     pos.y(),     pos.z(),     rot.e0(),
+                               rot.e1(),    rot.e2(),    rot.e3(),    lin_vel.x(), lin_vel.y(),
+                               lin_vel.z(), ang_vel.x(), ang_vel.y(), ang_vel.z()};
+        buffer.insert(buffer.end(), particle, particle + 14);
+    }
+}
+
+void ChVehicleCosimTerrainNodeGranularOMP::UnpackRegionState(int region, const double* data, int size) {
+    for (int k = 0; k + 14 <= size; k += 14) {
+        const double* particle = data + k;
+        auto& body = m_particles[(size_t)particle[0]];
+        body->SetPos(ChVector3d(particle[1], particle[2], particle[3]));
+        body->SetRot(ChQuaternion<>(particle[4], particle[5], particle[6], particle[7]));
+        body->SetPosDt(ChVector3d(particle[8], particle[9], particle[10]));
+        body->SetAngVelParent(ChVector3d(particle[11], particle[12], particle[13]));
+    }
+}
+
+void ChVehicleCosimTerrainNodeGranularOMP::OnRebalance() {
+    // Freeze (at rest) all particles outside the regions owned by this node
+    for (auto& body : m_particles) {
+        bool local = IsRegionLocal(GetRegionIndex(body->GetPos()));
+        if (body->IsFixed() != local)
+            continue;
+        body->SetFixed(!local);
+        if (!local) {
+            body->SetPosDt(VNULL);
+            body->SetAngVelParent(VNULL);
+        }
+    }
+
+    // Wake up proxies of objects handled by this node (they may have been put to sleep while parked)
+    for (int i = 0; i < m_num_objects; i++) {
+        if (IsObjectLocal(i)) {
+            auto proxy = std::static_pointer_cast<ProxyBodySet>(m_proxies[i]);
+            proxy->bodies[0]->SetSleeping(false);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
 void ChVehicleCosimTerrainNodeGranularOMP::OnRender() {
     if (!m_vsys)
         return;
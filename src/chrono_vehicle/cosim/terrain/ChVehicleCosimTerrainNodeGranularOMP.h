@@ -163,6 +163,8 @@ class CH_VEHICLE_API ChVehicleCosimTerrainNodeGranularOMP : public ChVehicleCosi
     bool m_settling_output;          ///< output files during settling?
     double m_settling_fps;           ///< frequency of output during settling phase
 
+    std::vector<std::shared_ptr<ChBody>> m_particles;  ///< granular material bodies (used for load balancing)
+
     virtual ChSystem* GetSystemPostprocess() const override { return m_system; }
 
     virtual bool SupportsMeshInterface() const override { return true; }
@@ -185,6 +187,13 @@ class CH_VEHICLE_API ChVehicleCosimTerrainNodeGranularOMP : public ChVehicleCosi
     virtual void OnOutputData(int frame) override;
     virtual void OnRender() override;
 
+    virtual void PackRegionState(int region, std::vector<double>& buffer) override;
+    virtual void UnpackRegionState(int region, const double* data, int size) override;
+    virtual void OnRebalance() override;
+
+    /// Share the granular material state of the main terrain node with all other TERRAIN nodes.
+    void InitializeLoadBalancing();
+
     /// Calculate current height of granular terrain.
     double CalcCurrentHeight();
 
@@ -456,6 +456,30 @@ void ChVehicleCosimTerrainNodeSCM::GetForceRigidProxy(unsigned int i, TerrainFor
     rigid_contact.moment = torque;
 }
 
+// -----------------------------------------------------------------------------
+// Load balancing
+// The state of a region consists of the levels of all modified SCM grid nodes in that region.
+// -----------------------------------------------------------------------------
+
+void ChVehicleCosimTerrainNodeSCM::PackRegionState(int region, std::vector<double>& buffer) {
+    const auto& nodes = m_terrain->GetModifiedNodes(true);
+    for (const auto& node : nodes) {
+        const auto& ij = node.first;
+        if (GetRegionIndex(ChVector3d(ij.x() * m_spacing, ij.y() * m_spacing, 0)) != region)
+            continue;
+        buffer.push_back(ij.x());
+        buffer.push_back(ij.y());
+        buffer.push_back(node.second);
+    }
+}
+
+void ChVehicleCosimTerrainNodeSCM::UnpackRegionState(int region, const double* data, int size) {
+    std::vector<SCMTerrain::NodeLevel> nodes;
+    for (int k = 0; k + 3 <= size; k += 3)
+        nodes.push_back(std::make_pair(ChVector2i((int)data[k], (int)data[k + 1]), data[k + 2]));
+    m_terrain->SetModifiedNodes(nodes);
+}
+
 // -----------------------------------------------------------------------------
 
 void ChVehicleCosimTerrainNodeSCM::OnRender() {
@@ -125,6 +125,9 @@ class CH_VEHICLE_API ChVehicleCosimTerrainNodeSCM : public ChVehicleCosimTerrain
 
     virtual void OnOutputData(int frame) override;
     virtual void OnRender() override;
+
+    virtual void PackRegionState(int region, std::vector<double>& buffer) override;
+    virtual void UnpackRegionState(int region, const double* data, int size) override;
 };
 
 /// @} vehicle_cosim_chrono
@@ -175,16 +175,10 @@ void FmuComponent::_exitInitializationMode() {
 fmi2Status FmuComponent::_doStep(fmi2Real currentCommunicationPoint,
                                  fmi2Real communicationStepSize,
                                  fmi2Boolean noSetFMUStatePriorToCurrentPoint) {
-    while (m_time < currentCommunicationPoint + communicationStepSize) {
-        fmi2Real h = std::min((currentCommunicationPoint + communicationStepSize - m_time),
-                              std::min(communicationStepSize, step_size));
-
+    // Sub-step over the communication interval (see FmuChronoComponentBase::AdvanceSubSteps)
+    return AdvanceSubSteps(currentCommunicationPoint, communicationStepSize, step_size, [this](fmi2Real h) {
         tire->Advance(h);
 
-        ////sendToLog("time: " + std::to_string(m_time) + "\n", fmi2Status::fmi2OK, "logAll");
-
-        m_time += h;
-    }
-
-    return fmi2Status::fmi2OK;
+        return fmi2Status::fmi2OK;
+    });
 }
@@ -19,6 +19,7 @@
 // =============================================================================
 
 #include <cassert>
+#include <cmath>
 #include <algorithm>
 #include <iomanip>
 
@@ -252,10 +253,8 @@ void FmuComponent::_exitInitializationMode() {
 fmi2Status FmuComponent::_doStep(fmi2Real currentCommunicationPoint,
                                  fmi2Real communicationStepSize,
                                  fmi2Boolean noSetFMUStatePriorToCurrentPoint) {
-    while (m_time < currentCommunicationPoint + communicationStepSize) {
-        fmi2Real h = std::min((currentCommunicationPoint + communicationStepSize - m_time),
-                              std::min(communicationStepSize, step_size));
-
+    // Sub-step over the communication interval (see FmuChronoComponentBase::AdvanceSubSteps)
+    return AdvanceSubSteps(currentCommunicationPoint, communicationStepSize, step_size, [this](fmi2Real h) {
         // Set the throttle and braking values based on the output from the speed controller.
         double out_speed = speedPID->Advance(ref_frame, target_speed, m_time, h);
         ChClampValue(out_speed, -1.0, 1.0);
@@ -311,10 +310,7 @@ fmi2Status FmuComponent::_doStep(fmi2Real currentCommunicationPoint,
             }
         }
 #endif
-        ////sendToLog("time: " + std::to_string(m_time) + "\n", fmi2Status::fmi2OK, "logAll");
-
-        m_time += h;
-    }
 
-    return fmi2Status::fmi2OK;
+        return fmi2Status::fmi2OK;
+    });
 }
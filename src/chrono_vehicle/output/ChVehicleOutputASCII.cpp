@@ -12,11 +12,12 @@
 // Authors: Radu Serban
 // =============================================================================
 //
-// Base class for a vehicle output database.
+// ASCII text vehicle output database.
 //
 // =============================================================================
 
 #include <iostream>
+#include <stdexcept>
 
 #include "chrono/physics/ChLinkLock.h"
 #include "chrono/physics/ChLinkUniversal.h"
@@ -28,127 +29,201 @@ namespace chrono {
 namespace vehicle {
 
 ChVehicleOutputASCII::ChVehicleOutputASCII(const std::string& filename)
-    : m_file_stream(filename), m_stream(m_file_stream) {}
+    : m_file_stream(filename), m_stream(m_file_stream), m_frame(new Frame{false, 0.0, {}, {}}) {}
 
-ChVehicleOutputASCII::ChVehicleOutputASCII(std::ostream& stream) : m_file_stream(), m_stream(stream) {}
+ChVehicleOutputASCII::ChVehicleOutputASCII(std::ostream& stream)
+    : m_file_stream(), m_stream(stream), m_frame(new Frame{false, 0.0, {}, {}}) {}
 
 ChVehicleOutputASCII::~ChVehicleOutputASCII() {
+    Submit();
+    try {
+        m_writer.Flush();
+    } catch (const std::exception& e) {
+        std::cerr << "ChVehicleOutputASCII: " << e.what() << std::endl;
+    }
+    m_stream.flush();
     if (m_file_stream.is_open())
         m_file_stream.close();
 }
 
+// -----------------------------------------------------------------------------
+
+void ChVehicleOutputASCII::AddEntry(const char* label, const ChObj& item, const std::string& layout) {
+    m_frame->entries.push_back({label, item.GetIdentifier(), item.GetName(), layout, m_frame->values.size()});
+}
+
+void ChVehicleOutputASCII::AddValue(const ChVector3d& v) {
+    m_frame->values.insert(m_frame->values.end(), {v.x(), v.y(), v.z()});
+}
+
+void ChVehicleOutputASCII::AddValue(const ChQuaternion<>& q) {
+    m_frame->values.insert(m_frame->values.end(), {q.e0(), q.e1(), q.e2(), q.e3()});
+}
+
+void ChVehicleOutputASCII::Submit() {
+    if (!m_frame->has_time && m_frame->entries.empty())
+        return;
+
+    // Reserve storage for the next frame based on the size of the submitted one
+    auto frame = std::make_shared<Frame>(Frame{false, 0.0, {}, {}});
+    frame->entries.reserve(m_frame->entries.size());
+    frame->values.reserve(m_frame->values.size());
+    std::swap(frame, m_frame);
+
+    m_writer.Submit([this, frame]() { WriteFrame(*frame); });
+}
+
+void ChVehicleOutputASCII::WriteFrame(const Frame& frame) {
+    if (frame.has_time) {
+        m_stream << "=====================================\n";
+        m_stream << "Time: " << frame.time << "\n";
+    }
+
+    for (const auto& entry : frame.entries) {
+        if (!entry.label) {
+            m_stream << "  \"" << entry.name << "\"\n";
+            continue;
+        }
+
+        m_stream << "    " << entry.label << ": " << entry.id << " \"" << entry.name << "\" ";
+        const double* v = frame.values.data() + entry.offset;
+        for (char c : entry.layout) {
+            switch (c) {
+                case 'v':
+                    m_stream << ChVector3d(v[0], v[1], v[2]) << " ";
+                    v += 3;
+                    break;
+                case 'q':
+                    m_stream << ChQuaternion<>(v[0], v[1], v[2], v[3]) << " ";
+                    v += 4;
+                    break;
+                default:
+                    m_stream << *v << " ";
+                    v += 1;
+                    break;
+            }
+        }
+        m_stream << "\n";
+    }
+
+    if (!m_stream.good())
+        throw std::runtime_error("ChVehicleOutputASCII: error writing output stream");
+}
+
+// -----------------------------------------------------------------------------
+
 void ChVehicleOutputASCII::WriteTime(int frame, double time) {
-    m_stream << "=====================================\n";
-    m_stream << "Time: " << time << std::endl;
+    Submit();
+    m_frame->has_time = true;
+    m_frame->time = time;
 }
 
 void ChVehicleOutputASCII::WriteSection(const std::string& name) {
-    m_stream << "  \"" << name << "\"" << std::endl;
+    m_frame->entries.push_back({nullptr, 0, name, "", m_frame->values.size()});
 }
 
 void ChVehicleOutputASCII::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
-    for (auto body : bodies) {
-        m_stream << "    body: " << body->GetIdentifier() << " \"" << body->GetName() << "\" ";
-        m_stream << body->GetPos() << " " << body->GetRot() << " ";
-        m_stream << body->GetPosDt() << " " << body->GetAngVelParent() << " ";
-        m_stream << body->GetPosDt2() << " " << body->GetAngAccParent() << " ";
-        m_stream << std::endl;
+    for (const auto& body : bodies) {
+        AddEntry("body", *body, "vqvvvv");
+        AddValue(body->GetPos());
+        AddValue(body->GetRot());
+        AddValue(body->GetPosDt());
+        AddValue(body->GetAngVelParent());
+        AddValue(body->GetPosDt2());
+        AddValue(body->GetAngAccParent());
         //// TODO
     }
 }
 
 void ChVehicleOutputASCII::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
-    for (auto body : bodies) {
-        auto& ref_pos = body->GetFrameRefToAbs().GetPos();
-        auto& ref_vel = body->GetFrameRefToAbs().GetPosDt();
-        auto& ref_acc = body->GetFrameRefToAbs().GetPosDt2();
-
-        m_stream << "    body auxref: " << body->GetIdentifier() << " \"" << body->GetName() << "\" ";
-        m_stream << body->GetPos() << " " << body->GetRot() << " ";
-        m_stream << body->GetPosDt() << " " << body->GetAngVelParent() << " ";
-        m_stream << body->GetPosDt2() << " " << body->GetAngAccParent() << " ";
-        m_stream << ref_pos << " " << ref_vel << " " << ref_acc << " ";
-        m_stream << std::endl;
+    for (const auto& body : bodies) {
+        AddEntry("body auxref", *body, "vqvvvvvvv");
+        AddValue(body->GetPos());
+        AddValue(body->GetRot());
+        AddValue(body->GetPosDt());
+        AddValue(body->GetAngVelParent());
+        AddValue(body->GetPosDt2());
+        AddValue(body->GetAngAccParent());
+        AddValue(body->GetFrameRefToAbs().GetPos());
+        AddValue(body->GetFrameRefToAbs().GetPosDt());
+        AddValue(body->GetFrameRefToAbs().GetPosDt2());
         //// TODO
     }
 }
 
 void ChVehicleOutputASCII::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
-    for (auto marker : markers) {
-        m_stream << "    marker: " << marker->GetIdentifier() << " \"" << marker->GetName() << "\" ";
-        m_stream << marker->GetAbsCoordsys().pos << " ";
-        m_stream << marker->GetAbsCoordsysDt().pos << " ";
-        m_stream << marker->GetAbsCoordsysDt2().pos << " ";
-        m_stream << std::endl;
+    for (const auto& marker : markers) {
+        AddEntry("marker", *marker, "vvv");
+        AddValue(marker->GetAbsCoordsys().pos);
+        AddValue(marker->GetAbsCoordsysDt().pos);
+        AddValue(marker->GetAbsCoordsysDt2().pos);
         //// TODO
     }
 }
 
 void ChVehicleOutputASCII::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
-    for (auto shaft : shafts) {
-        m_stream << "    shaft: " << shaft->GetIdentifier() << " \"" << shaft->GetName() << "\" ";
-        m_stream << shaft->GetPos() << " " << shaft->GetPosDt() << " " << shaft->GetPosDt2() << " ";
-        m_stream << shaft->GetAppliedLoad() << " ";
-        m_stream << std::endl;
+    for (const auto& shaft : shafts) {
+        AddEntry("shaft", *shaft, "ssss");
+        AddValue(shaft->GetPos());
+        AddValue(shaft->GetPosDt());
+        AddValue(shaft->GetPosDt2());
+        AddValue(shaft->GetAppliedLoad());
         //// TODO
     }
 }
 
 void ChVehicleOutputASCII::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
     for (const auto& joint : joints) {
-        std::vector<double> violations;
         auto C = joint->GetConstraintViolation();
-        for (int i = 0; i < C.size(); i++)
-            violations.push_back(C(i));
-
         auto reaction = joint->GetReaction2();
-        m_stream << "    joint: " << joint->GetIdentifier() << " \"" << joint->GetName() << "\" ";
-        m_stream << reaction.force << " " << reaction.torque << " ";
-        for (const auto& val : violations) {
-            m_stream << val << " ";
-        }
-        m_stream << std::endl;
+        AddEntry("joint", *joint, "vv" + std::string(C.size(), 's'));
+        AddValue(reaction.force);
+        AddValue(reaction.torque);
+        for (int i = 0; i < C.size(); i++)
+            AddValue(C(i));
         //// TODO
     }
 }
 
 void ChVehicleOutputASCII::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
-    for (auto couple : couples) {
-        m_stream << "    couple: " << couple->GetIdentifier() << " \"" << couple->GetName() << "\" ";
-        m_stream << couple->GetRelativePos() << " " << couple->GetRelativePosDt() << " " << couple->GetRelativePosDt2()
-                 << " ";
-        m_stream << couple->GetReaction1() << " " << couple->GetReaction2() << " ";
-        m_stream << std::endl;
+    for (const auto& couple : couples) {
+        AddEntry("couple", *couple, "sssss");
+        AddValue(couple->GetRelativePos());
+        AddValue(couple->GetRelativePosDt());
+        AddValue(couple->GetRelativePosDt2());
+        AddValue(couple->GetReaction1());
+        AddValue(couple->GetReaction2());
         //// TODO
     }
 }
 
 void ChVehicleOutputASCII::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) {
-    for (auto spring : springs) {
-        m_stream << "    lin spring: " << spring->GetIdentifier() << " \"" << spring->GetName() << "\" ";
-        m_stream << spring->GetPoint1Abs() << " " << spring->GetPoint2Abs() << " ";
-        m_stream << spring->GetLength() << " " << spring->GetVelocity() << " ";
-        m_stream << spring->GetForce() << " ";
-        m_stream << std::endl;
+    for (const auto& spring : springs) {
+        AddEntry("lin spring", *spring, "vvsss");
+        AddValue(spring->GetPoint1Abs());
+        AddValue(spring->GetPoint2Abs());
+        AddValue(spring->GetLength());
+        AddValue(spring->GetVelocity());
+        AddValue(spring->GetForce());
         //// TODO
     }
 }
 
 void ChVehicleOutputASCII::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) {
-    for (auto spring : springs) {
-        m_stream << "    rot spring: " << spring->GetIdentifier() << " \"" << spring->GetName() << "\" ";
-        m_stream << spring->GetAngle() << " " << spring->GetVelocity() << " ";
-        m_stream << spring->GetTorque() << " ";
-        m_stream << std::endl;
+    for (const auto& spring : springs) {
+        AddEntry("rot spring", *spring, "sss");
+        AddValue(spring->GetAngle());
+        AddValue(spring->GetVelocity());
+        AddValue(spring->GetTorque());
         //// TODO
     }
 }
 
 void ChVehicleOutputASCII::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
-    for (auto load : loads) {
-        m_stream << "    body-body load: " << load->GetIdentifier() << " \"" << load->GetName() << "\" ";
-        m_stream << load->GetForce() << " " << load->GetTorque() << " ";
-        m_stream << std::endl;
+    for (const auto& load : loads) {
+        AddEntry("body-body load", *load, "vv");
+        AddValue(load->GetForce());
+        AddValue(load->GetTorque());
         //// TODO
     }
 }
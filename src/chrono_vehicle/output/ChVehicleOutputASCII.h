@@ -21,6 +21,9 @@
 
 #include <string>
 #include <fstream>
+#include <memory>
+
+#include "chrono/utils/ChAsyncWriter.h"
 
 #include "chrono_vehicle/ChVehicleOutput.h"
 
@@ -31,6 +34,9 @@ namespace vehicle {
 /// @{
 
 /// ASCII text vehicle output database.
+/// The simulation thread only records a snapshot of the output values for each frame; formatting and writing to the
+/// output stream are performed by a background thread. When writing to a user-provided stream, the stream must not be
+/// accessed by the caller before this object is destroyed.
 class CH_VEHICLE_API ChVehicleOutputASCII : public ChVehicleOutput {
   public:
     ChVehicleOutputASCII(const std::string& filename);
@@ -38,6 +44,34 @@ class CH_VEHICLE_API ChVehicleOutputASCII : public ChVehicleOutput {
     ~ChVehicleOutputASCII();
 
   private:
+    /// Output item (or section header, if no label) in a frame.
+    struct Entry {
+        const char* label;   ///< item type
+        int id;              ///< item identifier
+        std::string name;    ///< item (or section) name
+        std::string layout;  ///< value layout ('v': vector, 'q': quaternion, 's': scalar)
+        size_t offset;       ///< index of the first item value
+    };
+
+    /// Snapshot of the output values at one frame.
+    struct Frame {
+        bool has_time;
+        double time;
+        std::vector<Entry> entries;
+        std::vector<double> values;
+    };
+
+    void AddEntry(const char* label, const ChObj& item, const std::string& layout);
+    void AddValue(const ChVector3d& v);
+    void AddValue(const ChQuaternion<>& q);
+    void AddValue(double s) { m_frame->values.push_back(s); }
+
+    /// Pass the current frame to the writer thread.
+    void Submit();
+
+    /// Format the given frame and write it to the output stream (executed on the writer thread).
+    void WriteFrame(const Frame& frame);
+
     virtual void WriteTime(int frame, double time) override;
     virtual void WriteSection(const std::string& name) override;
 
@@ -53,6 +87,8 @@ class CH_VEHICLE_API ChVehicleOutputASCII : public ChVehicleOutput {
 
     std::ostream& m_stream;
     std::ofstream m_file_stream;
+    std::shared_ptr<Frame> m_frame;  ///< current frame
+    utils::ChAsyncWriter m_writer;   ///< background writer (must be destroyed first)
 };
 
 /// @} vehicle
@@ -12,14 +12,14 @@
 // Authors: Radu Serban
 // =============================================================================
 //
-// Base class for a vehicle output database.
+// HDF5 vehicle output database (columnar layout, written in blocks by a
+// background thread).
 //
 // =============================================================================
 
+#include <algorithm>
 #include <iostream>
-#include <iomanip>
-#include <sstream>
-#include <fstream>
+#include <stdexcept>
 
 #include "chrono/physics/ChLinkLock.h"
 #include "chrono/physics/ChLinkUniversal.h"
@@ -31,493 +31,313 @@ namespace vehicle {
 
 // -----------------------------------------------------------------------------
 
-struct body_info {
-    int id;                 // body identifier
-    double x, y, z;         // position
-    double e0, e1, e2, e3;  // orientation
-    /*
-    double xd, yd, zd;      // linear velocity
-    double wx, wy, wz;      // angular velocity
-    double xdd, ydd, zdd;   // linear acceleration
-    double wxd, wyd, wzd;   // angular acceleration
-    */
-};
-
-struct bodyaux_info {
-    int id;                 // body identifier
-    double x, y, z;         // position
-    double e0, e1, e2, e3;  // orientation
-    /*
-    double xd, yd, zd;        // linear velocity
-    double wx, wy, wz;        // angular velocity
-    double xdd, ydd, zdd;     // linear acceleration
-    double wxd, wyd, wzd;     // angular acceleration
-    double rx, ry, rz;        // ref frame position
-    double rxd, ryd, rzd;     // ref frame linear velocity
-    double rxdd, rydd, rzdd;  // ref frame linear acceleration
-    */
-};
-
-struct shaft_info {
-    int id;             // shaft identifier
-    double x, xd, xdd;  // angle, angular velocity, angular acceleration
-    double t;           // applied torque
-};
-
-struct marker_info {
-    int id;                // marker identifier
-    double x, y, z;        // position
-    double xd, yd, zd;     // linear velocity
-    double xdd, ydd, zdd;  // linear acceleration
-};
-
-struct joint_info {
-    int id;             // joint identifier
-    double fx, fy, fz;  // joint reaction force
-    double tx, ty, tz;  // joint reaction torque
-};
-
-struct couple_info {
-    int id;             // couple identifier
-    double x, xd, xdd;  // relative angle, angular velocity, angular acceleration
-    double t1, t2;      // reaction torque on shaft 1 and on shaft 2
-};
-
-struct linspring_info {
-    int id;        // spring identifier
-    double x, xd;  // length and velocity
-    double f;      // reaction force
-};
-
-struct rotspring_info {
-    int id;        // spring identifier
-    double x, xd;  // angle and velocity
-    double t;      // reaction torque
-};
-
-struct bodyload_info {
-    int id;             // joint identifier
-    double fx, fy, fz;  // joint reaction force
-    double tx, ty, tz;  // joint reaction torque
-};
-
-H5::CompType* ChVehicleOutputHDF5::m_body_type = nullptr;
-H5::CompType* ChVehicleOutputHDF5::m_bodyaux_type = nullptr;
-H5::CompType* ChVehicleOutputHDF5::m_shaft_type = nullptr;
-H5::CompType* ChVehicleOutputHDF5::m_marker_type = nullptr;
-H5::CompType* ChVehicleOutputHDF5::m_joint_type = nullptr;
-H5::CompType* ChVehicleOutputHDF5::m_couple_type = nullptr;
-H5::CompType* ChVehicleOutputHDF5::m_linspring_type = nullptr;
-H5::CompType* ChVehicleOutputHDF5::m_rotspring_type = nullptr;
-H5::CompType* ChVehicleOutputHDF5::m_bodyload_type = nullptr;
-
-const H5::CompType& ChVehicleOutputHDF5::getBodyType() {
-    if (!m_body_type) {
-        struct Initializer {
-            Initializer() {
-                m_body_type = new H5::CompType(sizeof(body_info));
-                m_body_type->insertMember("id", HOFFSET(body_info, id), H5::PredType::NATIVE_INT);
-                m_body_type->insertMember("x", HOFFSET(body_info, x), H5::PredType::NATIVE_DOUBLE);
-                m_body_type->insertMember("y", HOFFSET(body_info, y), H5::PredType::NATIVE_DOUBLE);
-                m_body_type->insertMember("z", HOFFSET(body_info, z), H5::PredType::NATIVE_DOUBLE);
-                m_body_type->insertMember("e0", HOFFSET(body_info, e0), H5::PredType::NATIVE_DOUBLE);
-                m_body_type->insertMember("e1", HOFFSET(body_info, e1), H5::PredType::NATIVE_DOUBLE);
-                m_body_type->insertMember("e2", HOFFSET(body_info, e2), H5::PredType::NATIVE_DOUBLE);
-                m_body_type->insertMember("e3", HOFFSET(body_info, e3), H5::PredType::NATIVE_DOUBLE);
-            }
-        };
-        static Initializer ListInitializationGuard;
-    }
-    return *m_body_type;
-}
-
-const H5::CompType& ChVehicleOutputHDF5::getBodyAuxType() {
-    if (!m_bodyaux_type) {
-        struct Initializer {
-            Initializer() {
-                m_bodyaux_type = new H5::CompType(sizeof(bodyaux_info));
-                m_bodyaux_type->insertMember("id", HOFFSET(bodyaux_info, id), H5::PredType::NATIVE_INT);
-                m_bodyaux_type->insertMember("x", HOFFSET(bodyaux_info, x), H5::PredType::NATIVE_DOUBLE);
-                m_bodyaux_type->insertMember("y", HOFFSET(bodyaux_info, y), H5::PredType::NATIVE_DOUBLE);
-                m_bodyaux_type->insertMember("z", HOFFSET(bodyaux_info, z), H5::PredType::NATIVE_DOUBLE);
-                m_bodyaux_type->insertMember("e0", HOFFSET(bodyaux_info, e0), H5::PredType::NATIVE_DOUBLE);
-                m_bodyaux_type->insertMember("e1", HOFFSET(bodyaux_info, e1), H5::PredType::NATIVE_DOUBLE);
-                m_bodyaux_type->insertMember("e2", HOFFSET(bodyaux_info, e2), H5::PredType::NATIVE_DOUBLE);
-                m_bodyaux_type->insertMember("e3", HOFFSET(bodyaux_info, e3), H5::PredType::NATIVE_DOUBLE);
-            }
-        };
-        static Initializer ListInitializationGuard;
-    }
-    return *m_bodyaux_type;
-}
-
-const H5::CompType& ChVehicleOutputHDF5::getShaftType() {
-    if (!m_shaft_type) {
-        struct Initializer {
-            Initializer() {
-                m_shaft_type = new H5::CompType(sizeof(shaft_info));
-                m_shaft_type->insertMember("id", HOFFSET(shaft_info, id), H5::PredType::NATIVE_INT);
-                m_shaft_type->insertMember("x", HOFFSET(shaft_info, x), H5::PredType::NATIVE_DOUBLE);
-                m_shaft_type->insertMember("xd", HOFFSET(shaft_info, xd), H5::PredType::NATIVE_DOUBLE);
-                m_shaft_type->insertMember("xdd", HOFFSET(shaft_info, xdd), H5::PredType::NATIVE_DOUBLE);
-                m_shaft_type->insertMember("torque", HOFFSET(shaft_info, t), H5::PredType::NATIVE_DOUBLE);
-            }
-        };
-        static Initializer ListInitializationGuard;
-    }
-    return *m_shaft_type;
-}
+// Maximum number of values in a dataset chunk
+static const hsize_t max_chunk_size = 1 << 17;
 
-const H5::CompType& ChVehicleOutputHDF5::getMarkerType() {
-    if (!m_marker_type) {
-        struct Initializer {
-            Initializer() {
-                m_marker_type = new H5::CompType(sizeof(marker_info));
-                m_marker_type->insertMember("id", HOFFSET(marker_info, id), H5::PredType::NATIVE_INT);
-                m_marker_type->insertMember("x", HOFFSET(marker_info, x), H5::PredType::NATIVE_DOUBLE);
-                m_marker_type->insertMember("y", HOFFSET(marker_info, y), H5::PredType::NATIVE_DOUBLE);
-                m_marker_type->insertMember("z", HOFFSET(marker_info, z), H5::PredType::NATIVE_DOUBLE);
-                m_marker_type->insertMember("xd", HOFFSET(marker_info, xd), H5::PredType::NATIVE_DOUBLE);
-                m_marker_type->insertMember("yd", HOFFSET(marker_info, yd), H5::PredType::NATIVE_DOUBLE);
-                m_marker_type->insertMember("zd", HOFFSET(marker_info, zd), H5::PredType::NATIVE_DOUBLE);
-                m_marker_type->insertMember("xdd", HOFFSET(marker_info, xdd), H5::PredType::NATIVE_DOUBLE);
-                m_marker_type->insertMember("ydd", HOFFSET(marker_info, ydd), H5::PredType::NATIVE_DOUBLE);
-                m_marker_type->insertMember("zdd", HOFFSET(marker_info, zdd), H5::PredType::NATIVE_DOUBLE);
-            }
-        };
-        static Initializer ListInitializationGuard;
-    }
-    return *m_marker_type;
-}
+static const std::vector<std::string> body_quantities = {"x", "y", "z", "e0", "e1", "e2", "e3"};
+static const std::vector<std::string> marker_quantities = {"x", "y", "z", "xd", "yd", "zd", "xdd", "ydd", "zdd"};
+static const std::vector<std::string> shaft_quantities = {"x", "xd", "xdd", "torque"};
+static const std::vector<std::string> joint_quantities = {"Fx", "Fy", "Fz", "Tx", "Ty", "Tz"};
+static const std::vector<std::string> couple_quantities = {"x", "xd", "xdd", "torque1", "torque2"};
+static const std::vector<std::string> linspring_quantities = {"x", "xd", "force"};
+static const std::vector<std::string> rotspring_quantities = {"x", "xd", "torque"};
+static const std::vector<std::string> bodyload_quantities = {"Fx", "Fy", "Fz", "Tx", "Ty", "Tz"};
 
-const H5::CompType& ChVehicleOutputHDF5::getJointType() {
-    if (!m_joint_type) {
-        struct Initializer {
-            Initializer() {
-                m_joint_type = new H5::CompType(sizeof(joint_info));
-                m_joint_type->insertMember("id", HOFFSET(joint_info, id), H5::PredType::NATIVE_INT);
-                m_joint_type->insertMember("Fx", HOFFSET(joint_info, fx), H5::PredType::NATIVE_DOUBLE);
-                m_joint_type->insertMember("Fy", HOFFSET(joint_info, fy), H5::PredType::NATIVE_DOUBLE);
-                m_joint_type->insertMember("Fz", HOFFSET(joint_info, fz), H5::PredType::NATIVE_DOUBLE);
-                m_joint_type->insertMember("Tx", HOFFSET(joint_info, tx), H5::PredType::NATIVE_DOUBLE);
-                m_joint_type->insertMember("Ty", HOFFSET(joint_info, ty), H5::PredType::NATIVE_DOUBLE);
-                m_joint_type->insertMember("Tz", HOFFSET(joint_info, tz), H5::PredType::NATIVE_DOUBLE);
-            }
-        };
-        static Initializer ListInitializationGuard;
-    }
-    return *m_joint_type;
-}
+// -----------------------------------------------------------------------------
 
-const H5::CompType& ChVehicleOutputHDF5::getCoupleType() {
-    if (!m_couple_type) {
-        struct Initializer {
-            Initializer() {
-                m_couple_type = new H5::CompType(sizeof(couple_info));
-                m_couple_type->insertMember("id", HOFFSET(couple_info, id), H5::PredType::NATIVE_INT);
-                m_couple_type->insertMember("x", HOFFSET(couple_info, x), H5::PredType::NATIVE_DOUBLE);
-                m_couple_type->insertMember("xd", HOFFSET(couple_info, xd), H5::PredType::NATIVE_DOUBLE);
-                m_couple_type->insertMember("xdd", HOFFSET(couple_info, xdd), H5::PredType::NATIVE_DOUBLE);
-                m_couple_type->insertMember("torque1", HOFFSET(couple_info, t1), H5::PredType::NATIVE_DOUBLE);
-                m_couple_type->insertMember("torque2", HOFFSET(couple_info, t1), H5::PredType::NATIVE_DOUBLE);
-            }
-        };
-        static Initializer ListInitializationGuard;
-    }
-    return *m_couple_type;
-}
+ChVehicleOutputHDF5::ChVehicleOutputHDF5(const std::string& filename, int block_size, int compression_level)
+    : m_block_size(std::max(block_size, 1)),
+      m_compression_level(compression_level),
+      m_num_frames(0),
+      m_num_rows(0),
+      m_writer(2) {
+    m_fileHDF5 = new H5::H5File(filename, H5F_ACC_TRUNC);
+    if (m_compression_level > 0 && !H5Zfilter_avail(H5Z_FILTER_DEFLATE))
+        m_compression_level = 0;
 
-const H5::CompType& ChVehicleOutputHDF5::getLinSpringType() {
-    if (!m_linspring_type) {
-        struct Initializer {
-            Initializer() {
-                m_linspring_type = new H5::CompType(sizeof(linspring_info));
-                m_linspring_type->insertMember("id", HOFFSET(linspring_info, id), H5::PredType::NATIVE_INT);
-                m_linspring_type->insertMember("x", HOFFSET(linspring_info, x), H5::PredType::NATIVE_DOUBLE);
-                m_linspring_type->insertMember("xd", HOFFSET(linspring_info, xd), H5::PredType::NATIVE_DOUBLE);
-                m_linspring_type->insertMember("force", HOFFSET(linspring_info, f), H5::PredType::NATIVE_DOUBLE);
-            }
-        };
-        static Initializer ListInitializationGuard;
-    }
-    return *m_linspring_type;
+    H5::Group root = m_fileHDF5->openGroup("/");
+    m_time_dataset = CreateDataSet(root, "Time", 0, H5::PredType::NATIVE_DOUBLE);
+    m_times.reserve(m_block_size);
 }
 
-const H5::CompType& ChVehicleOutputHDF5::getRotSpringType() {
-    if (!m_rotspring_type) {
-        struct Initializer {
-            Initializer() {
-                m_rotspring_type = new H5::CompType(sizeof(rotspring_info));
-                m_rotspring_type->insertMember("id", HOFFSET(rotspring_info, id), H5::PredType::NATIVE_INT);
-                m_rotspring_type->insertMember("x", HOFFSET(rotspring_info, x), H5::PredType::NATIVE_DOUBLE);
-                m_rotspring_type->insertMember("xd", HOFFSET(rotspring_info, xd), H5::PredType::NATIVE_DOUBLE);
-                m_rotspring_type->insertMember("force", HOFFSET(rotspring_info, t), H5::PredType::NATIVE_DOUBLE);
-            }
-        };
-        static Initializer ListInitializationGuard;
+ChVehicleOutputHDF5::~ChVehicleOutputHDF5() {
+    // Write all buffered frames and wait for the writer thread to finish
+    Flush();
+    try {
+        m_writer.Flush();
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
     }
-    return *m_rotspring_type;
-}
 
-const H5::CompType& ChVehicleOutputHDF5::getBodyLoadType() {
-    if (!m_bodyload_type) {
-        struct Initializer {
-            Initializer() {
-                m_bodyload_type = new H5::CompType(sizeof(bodyload_info));
-                m_bodyload_type->insertMember("id", HOFFSET(bodyload_info, id), H5::PredType::NATIVE_INT);
-                m_bodyload_type->insertMember("Fx", HOFFSET(bodyload_info, fx), H5::PredType::NATIVE_DOUBLE);
-                m_bodyload_type->insertMember("Fy", HOFFSET(bodyload_info, fy), H5::PredType::NATIVE_DOUBLE);
-                m_bodyload_type->insertMember("Fz", HOFFSET(bodyload_info, fz), H5::PredType::NATIVE_DOUBLE);
-                m_bodyload_type->insertMember("Tx", HOFFSET(bodyload_info, tx), H5::PredType::NATIVE_DOUBLE);
-                m_bodyload_type->insertMember("Ty", HOFFSET(bodyload_info, ty), H5::PredType::NATIVE_DOUBLE);
-                m_bodyload_type->insertMember("Tz", HOFFSET(bodyload_info, tz), H5::PredType::NATIVE_DOUBLE);
-            }
-        };
-        static Initializer ListInitializationGuard;
+    for (auto& table : m_tables) {
+        for (auto& dataset : table.second->datasets)
+            dataset.close();
     }
-    return *m_bodyload_type;
-}
-
-// -----------------------------------------------------------------------------
-
-ChVehicleOutputHDF5::ChVehicleOutputHDF5(const std::string& filename)
-    : m_frame_group(nullptr), m_section_group(nullptr) {
-    m_fileHDF5 = new H5::H5File(filename, H5F_ACC_TRUNC);
-    H5::Group frames_group(m_fileHDF5->createGroup("/Frames"));
-}
-
-ChVehicleOutputHDF5::~ChVehicleOutputHDF5() {
-    if (m_section_group)
-        m_section_group->close();
-    if (m_frame_group)
-        m_frame_group->close();
+    m_time_dataset.close();
     m_fileHDF5->close();
-
-    delete m_section_group;
-    delete m_frame_group;
     delete m_fileHDF5;
-
-    delete m_body_type;
-    delete m_bodyaux_type;
-    delete m_shaft_type;
-    delete m_marker_type;
-    delete m_joint_type;
-    delete m_couple_type;
-    delete m_linspring_type;
-    delete m_rotspring_type;
-}
-
-// -----------------------------------------------------------------------------
-
-std::string format_number(int num, int precision) {
-    std::ostringstream out;
-    out << std::internal << std::setfill('0') << std::setw(precision) << num;
-    return out.str();
 }
 
 // -----------------------------------------------------------------------------
 
 void ChVehicleOutputHDF5::WriteTime(int frame, double time) {
-    // Close the currently open section group
-    if (m_section_group) {
-        m_section_group->close();
-        delete m_section_group;
-        m_section_group = nullptr;
-    }
-
-    // Close the currently open frame group
-    if (m_frame_group) {
-        m_frame_group->close();
-        delete m_frame_group;
-        m_frame_group = nullptr;
-    }
+    if ((int)m_times.size() == m_block_size)
+        Flush();
 
-    // Open the frames group and create the group for this frame
-    auto frame_name = std::string("Frame_") + format_number(frame, 6);
-    H5::Group frames_group = m_fileHDF5->openGroup("/Frames");
-    m_frame_group = new H5::Group(frames_group.createGroup(frame_name));
-
-    // Create an attribute with timestamp
-    {
-        H5::DataSpace dataspace(H5S_SCALAR);
-        H5::Attribute att = m_frame_group->createAttribute("Timestamp", H5::PredType::NATIVE_DOUBLE, dataspace);
-        att.write(H5::PredType::NATIVE_DOUBLE, &time);
-    }
+    m_times.push_back(time);
+    m_num_frames++;
+    m_section.clear();
 }
 
 void ChVehicleOutputHDF5::WriteSection(const std::string& name) {
-    // Close the currently open section group
-    if (m_section_group) {
-        m_section_group->close();
-        delete m_section_group;
-        m_section_group = nullptr;
+    m_section = name;
+}
+
+template <typename T>
+double* ChVehicleOutputHDF5::AppendRow(const std::string& category,
+                                       const std::vector<std::string>& quantities,
+                                       const std::vector<std::shared_ptr<T>>& items) {
+    auto& table = m_tables[m_section + "/" + category];
+    if (!table) {
+        table = std::unique_ptr<Table>(new Table);
+        table->section = m_section;
+        table->category = category;
+        table->quantities = quantities;
+        for (const auto& item : items)
+            table->ids.push_back(item->GetIdentifier());
+        table->first_frame = m_num_frames - 1;
+        table->values.reserve(m_block_size * items.size() * quantities.size());
+    } else if (table->ids.size() != items.size()) {
+        throw std::runtime_error("ChVehicleOutputHDF5: number of output items changed in " + m_section + "/" +
+                                 category);
     }
 
-    // Create the group for this section in the current frame group
-    m_section_group = new H5::Group(m_frame_group->createGroup(name));
+    size_t row_size = items.size() * quantities.size();
+    table->values.resize(table->values.size() + row_size);
+    return table->values.data() + table->values.size() - row_size;
 }
 
 void ChVehicleOutputHDF5::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
     if (bodies.empty())
         return;
 
-    auto nbodies = bodies.size();
-    hsize_t dim[] = {nbodies};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<body_info> info(nbodies);
-    for (auto i = 0; i < nbodies; i++) {
-        const ChVector3d& p = bodies[i]->GetPos();
-        const ChQuaternion<>& q = bodies[i]->GetRot();
-        info[i] = {bodies[i]->GetIdentifier(), p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3()};
+    double* row = AppendRow("Bodies", body_quantities, bodies);
+    for (const auto& body : bodies) {
+        const ChVector3d& p = body->GetPos();
+        const ChQuaternion<>& q = body->GetRot();
+        double values[] = {p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3()};
+        row = std::copy(values, values + 7, row);
     }
-
-    H5::DataSet set = m_section_group->createDataSet("Bodies", getBodyType(), dataspace);
-    set.write(info.data(), getBodyType());
 }
 
 void ChVehicleOutputHDF5::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
     if (bodies.empty())
         return;
 
-    auto nbodies = bodies.size();
-    hsize_t dim[] = {nbodies};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<bodyaux_info> info(nbodies);
-    for (auto i = 0; i < nbodies; i++) {
-        const ChVector3d& p = bodies[i]->GetPos();
-        const ChQuaternion<>& q = bodies[i]->GetRot();
-        info[i] = {bodies[i]->GetIdentifier(), p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3()};
+    double* row = AppendRow("Bodies AuxRef", body_quantities, bodies);
+    for (const auto& body : bodies) {
+        const ChVector3d& p = body->GetPos();
+        const ChQuaternion<>& q = body->GetRot();
+        double values[] = {p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3()};
+        row = std::copy(values, values + 7, row);
     }
-
-    H5::DataSet set = m_section_group->createDataSet("Bodies AuxRef", getBodyAuxType(), dataspace);
-    set.write(info.data(), getBodyAuxType());
 }
 
 void ChVehicleOutputHDF5::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
     if (markers.empty())
         return;
 
-    auto nmarkers = markers.size();
-    hsize_t dim[] = {nmarkers};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<marker_info> info(nmarkers);
-    for (auto i = 0; i < nmarkers; i++) {
-        const ChVector3d& p = markers[i]->GetAbsCoordsys().pos;
-        const ChVector3d& pd = markers[i]->GetAbsCoordsysDt().pos;
-        const ChVector3d& pdd = markers[i]->GetAbsCoordsysDt2().pos;
-        info[i] = {markers[i]->GetIdentifier(), p.x(), p.y(), p.z(), pd.x(), pd.y(), pd.z(), pdd.x(), pdd.y(), pdd.z()};
+    double* row = AppendRow("Markers", marker_quantities, markers);
+    for (const auto& marker : markers) {
+        const ChVector3d& p = marker->GetAbsCoordsys().pos;
+        const ChVector3d& pd = marker->GetAbsCoordsysDt().pos;
+        const ChVector3d& pdd = marker->GetAbsCoordsysDt2().pos;
+        double values[] = {p.x(), p.y(), p.z(), pd.x(), pd.y(), pd.z(), pdd.x(), pdd.y(), pdd.z()};
+        row = std::copy(values, values + 9, row);
     }
-
-    H5::DataSet set = m_section_group->createDataSet("Markers", getMarkerType(), dataspace);
-    set.write(info.data(), getMarkerType());
 }
 
 void ChVehicleOutputHDF5::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
     if (shafts.empty())
         return;
 
-    auto nshafts = shafts.size();
-    hsize_t dim[] = {nshafts};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<shaft_info> info(nshafts);
-    for (auto i = 0; i < nshafts; i++) {
-        info[i] = {shafts[i]->GetIdentifier(), shafts[i]->GetPos(), shafts[i]->GetPosDt(), shafts[i]->GetPosDt2(),
-                   shafts[i]->GetAppliedLoad()};
+    double* row = AppendRow("Shafts", shaft_quantities, shafts);
+    for (const auto& shaft : shafts) {
+        double values[] = {shaft->GetPos(), shaft->GetPosDt(), shaft->GetPosDt2(), shaft->GetAppliedLoad()};
+        row = std::copy(values, values + 4, row);
     }
-
-    H5::DataSet set = m_section_group->createDataSet("Shafts", getShaftType(), dataspace);
-    set.write(info.data(), getShaftType());
 }
 
 void ChVehicleOutputHDF5::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
     if (joints.empty())
         return;
 
-    auto njoints = joints.size();
-    hsize_t dim[] = {njoints};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<joint_info> info(njoints);
-    for (auto i = 0; i < njoints; i++) {
-        auto reaction = joints[i]->GetReaction2();
+    double* row = AppendRow("Joints", joint_quantities, joints);
+    for (const auto& joint : joints) {
+        auto reaction = joint->GetReaction2();
         const ChVector3d& f = reaction.force;
         const ChVector3d& t = reaction.torque;
-        info[i] = {joints[i]->GetIdentifier(), f.x(), f.y(), f.z(), t.x(), t.y(), t.z()};
+        double values[] = {f.x(), f.y(), f.z(), t.x(), t.y(), t.z()};
+        row = std::copy(values, values + 6, row);
     }
-
-    H5::DataSet set = m_section_group->createDataSet("Joints", getJointType(), dataspace);
-    set.write(info.data(), getJointType());
 }
 
 void ChVehicleOutputHDF5::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
     if (couples.empty())
         return;
 
-    auto ncouples = couples.size();
-    hsize_t dim[] = {ncouples};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<couple_info> info(ncouples);
-    for (auto i = 0; i < ncouples; i++) {
-        info[i] = {
-            couples[i]->GetIdentifier(),    couples[i]->GetRelativePos(),     //
-            couples[i]->GetRelativePosDt(), couples[i]->GetRelativePosDt2(),  //
-            couples[i]->GetReaction1(),     couples[i]->GetReaction2()        //
-        };
+    double* row = AppendRow("Couples", couple_quantities, couples);
+    for (const auto& couple : couples) {
+        double values[] = {couple->GetRelativePos(), couple->GetRelativePosDt(), couple->GetRelativePosDt2(),
+                           couple->GetReaction1(), couple->GetReaction2()};
+        row = std::copy(values, values + 5, row);
     }
-
-    H5::DataSet set = m_section_group->createDataSet("Couples", getCoupleType(), dataspace);
-    set.write(info.data(), getCoupleType());
 }
 
 void ChVehicleOutputHDF5::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) {
     if (springs.empty())
         return;
 
-    auto nsprings = springs.size();
-    hsize_t dim[] = {nsprings};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<linspring_info> info(nsprings);
-    for (auto i = 0; i < nsprings; i++) {
-        info[i] = {springs[i]->GetIdentifier(), springs[i]->GetLength(), springs[i]->GetVelocity(),
-                   springs[i]->GetForce()};
+    double* row = AppendRow("Lin Springs", linspring_quantities, springs);
+    for (const auto& spring : springs) {
+        double values[] = {spring->GetLength(), spring->GetVelocity(), spring->GetForce()};
+        row = std::copy(values, values + 3, row);
     }
-
-    H5::DataSet set = m_section_group->createDataSet("Lin Springs", getLinSpringType(), dataspace);
-    set.write(info.data(), getLinSpringType());
 }
 
 void ChVehicleOutputHDF5::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) {
     if (springs.empty())
         return;
 
-    auto nsprings = springs.size();
-    hsize_t dim[] = {nsprings};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<rotspring_info> info(nsprings);
-    for (auto i = 0; i < nsprings; i++) {
-        info[i] = {springs[i]->GetIdentifier(), springs[i]->GetAngle(), springs[i]->GetVelocity(),
-                   springs[i]->GetTorque()};
+    double* row = AppendRow("Rot Springs", rotspring_quantities, springs);
+    for (const auto& spring : springs) {
+        double values[] = {spring->GetAngle(), spring->GetVelocity(), spring->GetTorque()};
+        row = std::copy(values, values + 3, row);
     }
-
-    H5::DataSet set = m_section_group->createDataSet("Rot Springs", getRotSpringType(), dataspace);
-    set.write(info.data(), getRotSpringType());
 }
 
 void ChVehicleOutputHDF5::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
     if (loads.empty())
         return;
 
-    auto nloads = loads.size();
-    hsize_t dim[] = {nloads};
-    H5::DataSpace dataspace(1, dim);
-    std::vector<bodyload_info> info(nloads);
-    for (auto i = 0; i < nloads; i++) {
-        ChVector3d f = loads[i]->GetForce();
-        ChVector3d t = loads[i]->GetTorque();
-        info[i] = {loads[i]->GetIdentifier(), f.x(), f.y(), f.z(), t.x(), t.y(), t.z()};
+    double* row = AppendRow("Body-body Loads", bodyload_quantities, loads);
+    for (const auto& load : loads) {
+        ChVector3d f = load->GetForce();
+        ChVector3d t = load->GetTorque();
+        double values[] = {f.x(), f.y(), f.z(), t.x(), t.y(), t.z()};
+        row = std::copy(values, values + 6, row);
     }
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVehicleOutputHDF5::Flush() {
+    if (m_times.empty())
+        return;
+
+    auto block = std::make_shared<Block>();
+    block->times.swap(m_times);
+    for (auto& table : m_tables) {
+        if (table.second->values.empty())
+            continue;
+        block->values.push_back(std::make_pair(table.second.get(), std::vector<double>()));
+        block->values.back().second.swap(table.second->values);
+        table.second->values.reserve(block->values.back().second.size());
+    }
+    m_times.reserve(m_block_size);
+
+    // The writer queue holds at most two blocks, so this waits if the writer thread falls behind
+    m_writer.Submit([this, block]() {
+        try {
+            WriteBlock(*block);
+        } catch (const H5::Exception& e) {
+            throw std::runtime_error("ChVehicleOutputHDF5: " + e.getDetailMsg());
+        }
+    });
+}
+
+void ChVehicleOutputHDF5::WriteBlock(const Block& block) {
+    AppendRows(m_time_dataset, block.times.size(), 1, block.times.data(), H5::PredType::NATIVE_DOUBLE);
+    m_num_rows += block.times.size();
+
+    for (const auto& entry : block.values) {
+        Table& table = *entry.first;
+        const auto& values = entry.second;
+        hsize_t num_items = table.ids.size();
+        hsize_t num_quantities = table.quantities.size();
+        hsize_t num_rows = values.size() / (num_items * num_quantities);
+
+        // Create the group and the datasets for this table
+        if (table.datasets.empty()) {
+            if (!H5Lexists(m_fileHDF5->getId(), table.section.c_str(), H5P_DEFAULT))
+                m_fileHDF5->createGroup(table.section);
+            H5::Group section_group = m_fileHDF5->openGroup(table.section);
+            H5::Group group = section_group.createGroup(table.category);
+
+            H5::DataSpace scalar(H5S_SCALAR);
+            H5::Attribute att = group.createAttribute("First frame", H5::PredType::NATIVE_INT, scalar);
+            att.write(H5::PredType::NATIVE_INT, &table.first_frame);
+
+            hsize_t dim[] = {num_items};
+            H5::DataSpace dataspace(1, dim);
+            H5::DataSet ids = group.createDataSet("id", H5::PredType::NATIVE_INT, dataspace);
+            ids.write(table.ids.data(), H5::PredType::NATIVE_INT);
+
+            for (const auto& quantity : table.quantities)
+                table.datasets.push_back(CreateDataSet(group, quantity, num_items, H5::PredType::NATIVE_DOUBLE));
+        }
+
+        // Extract the values of each quantity and append them to the corresponding dataset
+        std::vector<double> column(num_rows * num_items);
+        for (hsize_t iq = 0; iq < num_quantities; iq++) {
+            for (hsize_t k = 0; k < num_rows * num_items; k++)
+                column[k] = values[k * num_quantities + iq];
+            AppendRows(table.datasets[iq], num_rows, num_items, column.data(), H5::PredType::NATIVE_DOUBLE);
+        }
+    }
+}
+
+H5::DataSet ChVehicleOutputHDF5::CreateDataSet(H5::Group& group,
+                                               const std::string& name,
+                                               hsize_t num_cols,
+                                               const H5::DataType& type) {
+    // A dataset with no columns is one-dimensional
+    int rank = num_cols > 0 ? 2 : 1;
+    hsize_t cols = std::max<hsize_t>(num_cols, 1);
+    hsize_t dims[] = {0, num_cols};
+    hsize_t max_dims[] = {H5S_UNLIMITED, num_cols};
+    hsize_t chunk_dims[] = {std::max<hsize_t>(std::min<hsize_t>(m_block_size, max_chunk_size / cols), 1), num_cols};
+
+    H5::DSetCreatPropList plist;
+    plist.setChunk(rank, chunk_dims);
+    if (m_compression_level > 0) {
+        plist.setShuffle();
+        plist.setDeflate(m_compression_level);
+    }
+
+    H5::DataSpace dataspace(rank, dims, max_dims);
+    return group.createDataSet(name, type, dataspace, plist);
+}
 
-    H5::DataSet set = m_section_group->createDataSet("Body-body Loads", getBodyLoadType(), dataspace);
-    set.write(info.data(), getBodyLoadType());
+void ChVehicleOutputHDF5::AppendRows(H5::DataSet& dataset,
+                                     hsize_t num_rows,
+                                     hsize_t num_cols,
+                                     const void* data,
+                                     const H5::DataType& type) {
+    H5::DataSpace filespace = dataset.getSpace();
+    int rank = filespace.getSimpleExtentNdims();
+    hsize_t dims[2];
+    filespace.getSimpleExtentDims(dims);
+
+    hsize_t offset[] = {dims[0], 0};
+    hsize_t count[] = {num_rows, num_cols};
+    dims[0] += num_rows;
+    dataset.extend(dims);
+
+    filespace = dataset.getSpace();
+    filespace.selectHyperslab(H5S_SELECT_SET, count, offset);
+    H5::DataSpace memspace(rank, count);
+    dataset.write(data, type, memspace, filespace);
 }
 
 }  // end namespace vehicle
@@ -12,15 +12,18 @@
 // Authors: Radu Serban
 // =============================================================================
 //
-// ASCII text vehicle output database.
+// HDF5 vehicle output database.
 //
 // =============================================================================
 
 #ifndef CH_VEHICLE_OUTPUT_HDF5_H
 #define CH_VEHICLE_OUTPUT_HDF5_H
 
+#include <map>
+#include <memory>
 #include <string>
-#include <fstream>
+
+#include "chrono/utils/ChAsyncWriter.h"
 
 #include "chrono_vehicle/ChVehicleOutput.h"
 
@@ -33,12 +36,44 @@ namespace vehicle {
 /// @{
 
 /// HDF5 vehicle output database.
+/// Output data is stored in a columnar layout, with one dataset per output quantity:
+/// <pre>
+///   /Time                               output times (one value per frame)
+///   /[section]/[category]/id            identifiers of the output items (bodies, joints, etc.)
+///   /[section]/[category]/[quantity]    values of the quantity for all items (one row per frame)
+/// </pre>
+/// where [category] is one of "Bodies", "Bodies AuxRef", "Markers", "Shafts", "Joints", "Couples", "Lin Springs",
+/// "Rot Springs", or "Body-body Loads". Each category group has a "First frame" attribute with the index of the
+/// output frame corresponding to its first row. All datasets are extendible, chunked, and compressed.
+///
+/// Output data is buffered in memory and written to the file in blocks of frames by a background thread, which
+/// performs all HDF5 operations. The set of output items in a given section and category must not change.
 class CH_VEHICLE_API ChVehicleOutputHDF5 : public ChVehicleOutput {
   public:
-    ChVehicleOutputHDF5(const std::string& filename);
+    /// Create an HDF5 output database.
+    /// Output data is written to the file in blocks with the specified number of frames; datasets are compressed
+    /// with the specified deflate level (0 to disable compression).
+    ChVehicleOutputHDF5(const std::string& filename, int block_size = 1024, int compression_level = 4);
     ~ChVehicleOutputHDF5();
 
   private:
+    /// Buffered output values for a category of output items in a given section.
+    struct Table {
+        std::string section;                  ///< section name
+        std::string category;                 ///< category name
+        std::vector<std::string> quantities;  ///< names of the output quantities
+        std::vector<int> ids;                 ///< identifiers of the output items
+        int first_frame;                      ///< index of the first output frame
+        std::vector<double> values;           ///< buffered values (ordered by frame, item, quantity)
+        std::vector<H5::DataSet> datasets;    ///< datasets of the output quantities (used only by the writer)
+    };
+
+    /// Block of output frames, passed to the writer thread.
+    struct Block {
+        std::vector<double> times;
+        std::vector<std::pair<Table*, std::vector<double>>> values;
+    };
+
     virtual void WriteTime(int frame, double time) override;
     virtual void WriteSection(const std::string& name) override;
 
@@ -52,29 +87,40 @@ class CH_VEHICLE_API ChVehicleOutputHDF5 : public ChVehicleOutput {
     virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) override;
     virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) override;
 
+    /// Append a row for the given items in the specified category of the current section and return a pointer to
+    /// the row values.
+    template <typename T>
+    double* AppendRow(const std::string& category,
+                      const std::vector<std::string>& quantities,
+                      const std::vector<std::shared_ptr<T>>& items);
+
+    /// Pass the buffered output frames to the writer thread.
+    void Flush();
+
+    /// Write a block of output frames to the file (executed on the writer thread).
+    void WriteBlock(const Block& block);
+    H5::DataSet CreateDataSet(H5::Group& group, const std::string& name, hsize_t num_cols, const H5::DataType& type);
+    void AppendRows(H5::DataSet& dataset,
+                    hsize_t num_rows,
+                    hsize_t num_cols,
+                    const void* data,
+                    const H5::DataType& type);
+
     H5::H5File* m_fileHDF5;
-    H5::Group* m_frame_group;
-    H5::Group* m_section_group;
-
-    static H5::CompType* m_body_type;
-    static H5::CompType* m_bodyaux_type;
-    static H5::CompType* m_shaft_type;
-    static H5::CompType* m_marker_type;
-    static H5::CompType* m_joint_type;
-    static H5::CompType* m_couple_type;
-    static H5::CompType* m_linspring_type;
-    static H5::CompType* m_rotspring_type;
-    static H5::CompType* m_bodyload_type;
-
-    static const H5::CompType& getBodyType();
-    static const H5::CompType& getBodyAuxType();
-    static const H5::CompType& getShaftType();
-    static const H5::CompType& getMarkerType();
-    static const H5::CompType& getJointType();
-    static const H5::CompType& getCoupleType();
-    static const H5::CompType& getLinSpringType();
-    static const H5::CompType& getRotSpringType();
-    static const H5::CompType& getBodyLoadType();
+    int m_block_size;         ///< number of frames in a block
+    int m_compression_level;  ///< deflate level (0: no compression)
+
+    // Data used by the simulation thread
+    int m_num_frames;                                        ///< number of output frames
+    std::string m_section;                                   ///< current section
+    std::vector<double> m_times;                             ///< buffered output times
+    std::map<std::string, std::unique_ptr<Table>> m_tables;  ///< tables, by section and category
+
+    // Data used by the writer thread
+    H5::DataSet m_time_dataset;  ///< dataset of output times
+    hsize_t m_num_rows;          ///< number of output times in the file
+
+    utils::ChAsyncWriter m_writer;  ///< background writer (must be destroyed first)
 };
 
 /// @} vehicle
@@ -281,29 +281,70 @@ double CRGTerrain::GetHeight(const ChVector3d& loc) const {
 }
 
 ChVector3d CRGTerrain::GetNormal(const ChVector3d& loc) const {
+    double height;
+    ChVector3d normal;
+    EvaluateSurface(loc, height, normal);
+    return normal;
+}
+
+void CRGTerrain::GetProperties(const ChVector3d& loc, double& height, ChVector3d& normal, float& friction) const {
+    EvaluateSurface(loc, height, normal);
+    friction = GetCoefficientFriction(loc);
+}
+
+bool CRGTerrain::EvaluateSurface(const ChVector3d& loc, double& height, ChVector3d& normal) const {
+    height = 0;
+    normal = ChWorldFrame::Vertical();
+
     ChVector3d loc_ISO = ChWorldFrame::ToISO(loc);
+    double u, v;
+    if (crgEvalxy2uv(m_cpId, loc_ISO.x(), loc_ISO.y(), &u, &v) != 1) {
+        std::cerr << "CRGTerrain::EvaluateSurface(): error during xy -> uv coordinate transformation" << std::endl;
+        return false;
+    }
+
+    // when leaving the road the vehicle should not fall into an abyss
+    // (outside the road limits, the surface is flat in the clamped direction)
+    bool u_clamped = u < m_ubeg || u > m_uend;
+    bool v_clamped = v < m_vbeg || v > m_vend;
+    ChClampValue(u, m_ubeg, m_uend);
+    ChClampValue(v, m_vbeg, m_vend);
+
     // to avoid 'jumping' of the normal vector, we take this smoothing approach
+    // (finite differences along and across the road, stepping backward at the far road limits)
     const double delta = 0.05;
-    double z0, zfront, zleft;
-    z0 = GetHeight(loc);
-    zfront = GetHeight(ChWorldFrame::FromISO(loc_ISO + ChVector3d(delta, 0, 0)));
-    zleft = GetHeight(ChWorldFrame::FromISO(loc_ISO + ChVector3d(0, delta, 0)));
-    ChVector3d p0(loc_ISO.x(), loc_ISO.y(), z0);
-    ChVector3d pfront(loc_ISO.x() + delta, loc_ISO.y(), zfront);
-    ChVector3d pleft(loc_ISO.x(), loc_ISO.y() + delta, zleft);
-    ChVector3d normal_ISO;
-    ChVector3d r1, r2;
-    r1 = pfront - p0;
-    r2 = pleft - p0;
-    normal_ISO = Vcross(r1, r2);
+    double du = (u + delta <= m_uend) ? delta : -delta;
+    double dv = (v + delta <= m_vend) ? delta : -delta;
+
+    double x0, y0, z0, xu, yu, zu, xv, yv, zv;
+    if (crgEvaluv2xy(m_cpId, u, v, &x0, &y0) != 1 || crgEvaluv2xy(m_cpId, u + du, v, &xu, &yu) != 1 ||
+        crgEvaluv2xy(m_cpId, u, v + dv, &xv, &yv) != 1) {
+        std::cerr << "CRGTerrain::EvaluateSurface(): error during uv -> xy coordinate transformation" << std::endl;
+        return false;
+    }
+    if (crgEvaluv2z(m_cpId, u, v, &z0) != 1 || crgEvaluv2z(m_cpId, u + du, v, &zu) != 1 ||
+        crgEvaluv2z(m_cpId, u, v + dv, &zv) != 1) {
+        std::cerr << "CRGTerrain::EvaluateSurface(): error during uv -> z coordinate transformation" << std::endl;
+        return false;
+    }
+    height = z0;
+
+    if (u_clamped)
+        zu = z0;
+    if (v_clamped)
+        zv = z0;
+
+    ChVector3d r1 = (du > 0 ? 1 : -1) * ChVector3d(xu - x0, yu - y0, zu - z0);
+    ChVector3d r2 = (dv > 0 ? 1 : -1) * ChVector3d(xv - x0, yv - y0, zv - z0);
+    ChVector3d normal_ISO = Vcross(r1, r2);
     if (normal_ISO.z() <= 0.0) {
         std::cerr << "Fatal: wrong surface normal!" << std::endl;
         throw std::runtime_error("Fatal: wrong surface normal!");
     }
-    ChVector3d normal = ChWorldFrame::FromISO(normal_ISO);
+    normal = ChWorldFrame::FromISO(normal_ISO);
     normal.Normalize();
 
-    return normal;
+    return true;
 }
 
 float CRGTerrain::GetCoefficientFriction(const ChVector3d& loc) const {
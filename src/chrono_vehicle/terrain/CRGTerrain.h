@@ -93,6 +93,14 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
     /// Otherwise, it returns the constant value specified at construction.
     virtual float GetCoefficientFriction(const ChVector3d& loc) const override;
 
+    /// Get all terrain characteristics at the point below the specified location.
+    /// This is more efficient than calling GetHeight, GetNormal, and GetCoefficientFriction separately, as it performs
+    /// a single transformation from (x,y) to road (u,v) coordinates.
+    virtual void GetProperties(const ChVector3d& loc,
+                               double& height,
+                               ChVector3d& normal,
+                               float& friction) const override;
+
     /// Get the road center line as a Bezier curve.
     std::shared_ptr<ChBezierCurve> GetRoadCenterLine();
 
@@ -143,6 +151,10 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
     void ExportCurvesPovray(const std::string& out_dir);
 
   private:
+    /// Evaluate the road height and normal at the point below the specified location.
+    /// The normal is obtained from finite differences along and across the road, in (u,v) coordinates.
+    bool EvaluateSurface(const ChVector3d& loc, double& height, ChVector3d& normal) const;
+
     /// Build the graphical representation.
     void SetupLineGraphics();
     void SetupMeshGraphics();
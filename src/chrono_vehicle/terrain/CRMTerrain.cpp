@@ -19,8 +19,10 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <queue>
 
@@ -36,7 +38,18 @@ namespace chrono {
 namespace vehicle {
 
 CRMTerrain::CRMTerrain(ChSystem& sys, double spacing)
-    : m_sys(sys), m_spacing(spacing), m_initialized(false), m_offset(VNULL), m_angle(0.0), m_verbose(false) {
+    : m_sys(sys),
+      m_spacing(spacing),
+      m_initialized(false),
+      m_offset(VNULL),
+      m_angle(0.0),
+      m_verbose(false),
+      m_moving_buffer(0),
+      m_moving_shift(0),
+      m_moving_travel(0),
+      m_moving_offset(0),
+      m_grid_min(0),
+      m_grid_max(0) {
     // Create ground body
     m_ground = chrono_types::make_shared<ChBody>();
     m_ground->SetFixed(true);
@@ -430,11 +443,114 @@ void CRMTerrain::CompleteConstruct() {
     }
 }
 
+void CRMTerrain::SetMovingPatch(std::shared_ptr<ChBody> body,
+                                double buffer_distance,
+                                double shift_distance,
+                                double max_distance) {
+    m_moving_body = body;
+    m_moving_buffer = buffer_distance;
+    m_moving_shift = std::max(1, (int)std::round(shift_distance / m_spacing));
+    m_moving_travel = max_distance;
+}
+
+void CRMTerrain::AddActiveDomain(std::shared_ptr<ChBody> body, const ChVector3d& offset, const ChVector3d& half_dim) {
+    m_sysFSI.AddActiveDomain(body, offset, half_dim);
+}
+
 void CRMTerrain::Initialize() {
+    if (m_moving_body) {
+        // Collect the SPH particle grid locations of the initial patch, by grid column
+        m_grid_min = std::numeric_limits<int>::max();
+        m_grid_max = std::numeric_limits<int>::min();
+        for (const auto& p : m_sph) {
+            m_grid_min = std::min(m_grid_min, p.x());
+            m_grid_max = std::max(m_grid_max, p.x());
+        }
+        m_grid_columns.resize(m_grid_max - m_grid_min + 1);
+        for (const auto& p : m_sph)
+            m_grid_columns[p.x() - m_grid_min].push_back(p);
+
+        // Extend the computational domain to cover the travel distance of the patch
+        ChVector3d aabb_dim = m_aabb.Size();
+        aabb_dim.z() *= 50;
+        m_sysFSI.SetBoundaries(m_aabb.min - 0.1 * aabb_dim,
+                               m_aabb.max + 0.1 * aabb_dim + ChVector3d(m_moving_travel, 0, 0));
+    }
+
     m_sysFSI.Initialize();
     m_initialized = true;
 }
 
+void CRMTerrain::Synchronize(double time) {
+    if (!m_moving_body || !m_initialized)
+        return;
+
+    double front = m_offset.x() + m_spacing * (m_grid_max + m_moving_offset);
+    while (m_moving_body->GetPos().x() + m_moving_buffer > front) {
+        MovePatch();
+        front = m_offset.x() + m_spacing * (m_grid_max + m_moving_offset);
+    }
+}
+
+void CRMTerrain::MovePatch() {
+    int num_cols = m_grid_max - m_grid_min + 1;
+    int rear = m_grid_min + m_moving_offset;   // first grid column of the current patch
+    int front = m_grid_max + m_moving_offset;  // last grid column of the current patch
+
+    double x_rear = m_offset.x() + m_spacing * (rear - 0.5);
+    double x_front = m_offset.x() + m_spacing * (front + 0.5);
+    double x_slab = m_offset.x() + m_spacing * (rear + m_moving_shift - 0.5);
+
+    auto pos = m_sysFSI.GetParticlePositions();
+    int num_sph = (int)m_sysFSI.GetNumFluidMarkers();
+    int num_bce = (int)m_sysFSI.GetNumBoundaryMarkers();
+
+    // SPH particles in the rear slab, starting from the rearmost
+    std::vector<int> src;
+    for (int i = 0; i < num_sph; i++) {
+        if (pos[i].x() < x_slab)
+            src.push_back(i);
+    }
+    std::sort(src.begin(), src.end(), [&pos](int a, int b) { return pos[a].x() < pos[b].x(); });
+
+    // Grid locations in the new front columns (with the profile of the corresponding initial patch columns),
+    // starting from the bottom
+    std::vector<ChVector3d> dst;
+    for (int c = front + 1; c <= front + m_moving_shift; c++) {
+        for (const auto& p : m_grid_columns[(c - m_grid_min) % num_cols])
+            dst.push_back(m_offset + m_spacing * ChVector3d(c, p.y(), p.z()));
+    }
+    std::sort(dst.begin(), dst.end(), [](const ChVector3d& a, const ChVector3d& b) { return a.z() < b.z(); });
+
+    // Particles that migrated across the slab boundary may leave a few grid locations empty (at the top of the new
+    // columns) or a few particles in place (the ones closest to the slab boundary)
+    size_t num_moved = std::min(src.size(), dst.size());
+    std::vector<int> indices(src.begin(), src.begin() + num_moved);
+    std::vector<ChVector3d> positions(dst.begin(), dst.begin() + num_moved);
+
+    // Boundary BCE markers beyond the patch ends (end walls) move with the patch, those in the rear slab (bottom
+    // layers and side walls) move to the front
+    for (int i = num_sph; i < num_sph + num_bce; i++) {
+        double x = pos[i].x();
+        if (x < x_rear || x > x_front) {
+            indices.push_back(i);
+            positions.push_back(pos[i] + ChVector3d(m_spacing * m_moving_shift, 0, 0));
+        } else if (x < x_slab) {
+            indices.push_back(i);
+            positions.push_back(pos[i] + ChVector3d(m_spacing * num_cols, 0, 0));
+        }
+    }
+
+    m_sysFSI.SetParticlePositions(indices, positions);
+
+    m_moving_offset += m_moving_shift;
+    m_aabb.min.x() += m_spacing * m_moving_shift;
+    m_aabb.max.x() += m_spacing * m_moving_shift;
+
+    if (m_verbose)
+        cout << "Moved " << num_moved << " SPH particles to front of CRM patch (x = " << x_front << ")" << endl;
+}
+
 ChVector3i Snap2Grid(const ChVector3d point, double spacing) {
     return ChVector3i((int)std::round(point.x() / spacing),  //
                       (int)std::round(point.y() / spacing),  //
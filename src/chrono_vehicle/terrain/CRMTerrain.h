@@ -105,6 +105,26 @@ class CH_VEHICLE_API CRMTerrain : public ChTerrain {
                    bool side_walls = true                  ///< create side boundaries
     );
 
+    /// Enable a moving patch, following the specified body along the X direction.
+    /// Instead of covering the entire path of the body with SPH particles, the terrain patch is relocated as the body
+    /// advances: whenever the body gets within `buffer_distance` of the front edge of the patch, the rearmost particles
+    /// and boundary markers (a slab of length `shift_distance`) are moved ahead of the front edge. Relocated particles
+    /// are placed at rest on the grid locations of the original patch, such that the terrain profile repeats with the
+    /// period of the patch length. The computational domain is extended to cover a travel distance `max_distance`
+    /// from the initial front edge. This way, the number of SPH particles is set by the patch size rather than by the
+    /// length of the path. Rigid obstacles are not relocated. Must be called before Initialize().
+    void SetMovingPatch(std::shared_ptr<ChBody> body,  ///< body followed by the terrain patch
+                        double buffer_distance,        ///< minimum distance from body to front edge of patch
+                        double shift_distance,         ///< length of the slab moved at each relocation
+                        double max_distance            ///< maximum travel distance of the terrain patch
+    );
+
+    /// Add an active domain box attached to the specified body (e.g., around each vehicle wheel).
+    /// Similar to SCMTerrain::AddMovingPatch, only the SPH particles within such boxes are updated; particles outside
+    /// all boxes are frozen. The box is axis-aligned, with given half-dimensions, and centered at the specified point
+    /// (expressed in the body frame). See ChSystemFsi::AddActiveDomain.
+    void AddActiveDomain(std::shared_ptr<ChBody> body, const ChVector3d& offset, const ChVector3d& half_dim);
+
     /// Initialize the terrain.
     /// After this call, no additional solid bodies should be added to the FSI problem.
     void Initialize();
@@ -118,8 +138,10 @@ class CH_VEHICLE_API CRMTerrain : public ChTerrain {
     /// Save the set of SPH and BCE grid locations to the files in the specified output directory.
     void SaveMarkers(const std::string& out_dir) const;
 
+    /// Update the terrain (relocate particles and markers if a moving patch is enabled).
+    virtual void Synchronize(double time) override;
+
     //// TODO - anything needed here?
-    virtual void Synchronize(double time) override {}
     virtual double GetHeight(const ChVector3d& loc) const override { return 0.0; }
     virtual chrono::ChVector3d GetNormal(const ChVector3d& loc) const override { return ChWorldFrame::Vertical(); }
     virtual float GetCoefficientFriction(const ChVector3d& loc) const override { return 0.0f; }
@@ -164,6 +186,9 @@ class CH_VEHICLE_API CRMTerrain : public ChTerrain {
     /// defined by the obstacle BCEs. Note that this assumes the BCE markers form a watertight boundary.
     void ProcessObstacleMesh(RigidObstacle& o);
 
+    /// Move the rearmost slab of SPH particles and boundary BCE markers ahead of the front edge of the patch.
+    void MovePatch();
+
     fsi::ChSystemFsi m_sysFSI;               ///< underlying Chrono FSI system
     double m_spacing;                        ///< (initial) particle and marker spacing
     ChSystem& m_sys;                         ///< associated Chrono MBS system
@@ -176,6 +201,15 @@ class CH_VEHICLE_API CRMTerrain : public ChTerrain {
     ChAABB m_aabb;                           ///< particle AABB
     std::vector<RigidObstacle> m_obstacles;  ///< list of rigid obstacles
     bool m_verbose;                          ///< if true, write information to standard output
+
+    std::shared_ptr<ChBody> m_moving_body;                ///< body followed by a moving patch (empty if fixed patch)
+    double m_moving_buffer;                               ///< minimum distance from body to front edge of patch
+    int m_moving_shift;                                   ///< number of grid columns moved at each relocation
+    double m_moving_travel;                               ///< maximum travel distance of the patch
+    int m_moving_offset;                                  ///< number of grid columns the patch was moved so far
+    int m_grid_min;                                       ///< first grid column (X index) of the initial patch
+    int m_grid_max;                                       ///< last grid column (X index) of the initial patch
+    std::vector<std::vector<ChVector3i>> m_grid_columns;  ///< SPH particle grid locations of the initial patch columns
 };
 
 /// @} vehicle_terrain
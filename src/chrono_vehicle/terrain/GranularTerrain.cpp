@@ -37,6 +37,7 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <cstdio>
 #include <cmath>
 
@@ -154,18 +155,15 @@ class BoundaryContact : public ChSystem::CustomCollisionCallback {
 };
 
 void BoundaryContact::OnCustomCollision(ChSystem* system) {
-    auto bodylist = system->GetBodies();
-    for (auto body : bodylist) {
-        auto center = body->GetPos();
-        if (body->GetTag() >= tag_particles) {
-            CheckBottom(body.get(), center);
-            CheckLeft(body.get(), center);
-            CheckRight(body.get(), center);
-            CheckFront(body.get(), center);
-            CheckRear(body.get(), center);
-            if (m_terrain->m_rough_surface)
-                CheckFixedSpheres(body.get(), center);
-        }
+    for (const auto& body : m_terrain->m_particles) {
+        const auto& center = body->GetPos();
+        CheckBottom(body.get(), center);
+        CheckLeft(body.get(), center);
+        CheckRight(body.get(), center);
+        CheckFront(body.get(), center);
+        CheckRear(body.get(), center);
+        if (m_terrain->m_rough_surface)
+            CheckFixedSpheres(body.get(), center);
     }
 }
 
@@ -415,6 +413,14 @@ void GranularTerrain::Initialize(const ChVector3d& center,
         layer++;
     }
 
+    // Cache the particle bodies
+    m_particles.clear();
+    m_slab.clear();
+    for (const auto& body : m_ground->GetSystem()->GetBodies()) {
+        if (body->GetTag() >= tag_particles)
+            m_particles.push_back(body);
+    }
+
     // If enabled, create visualization assets for the boundaries.
     if (m_vis_enabled) {
         double hthick = 0.05;
@@ -444,33 +450,54 @@ void GranularTerrain::Synchronize(double time) {
     // Shift rear boundary.
     m_rear += m_shift_distance;
 
-    // Count particles that must be relocated.
-    unsigned int num_moved_particles = 0;
-    for (auto body : m_ground->GetSystem()->GetBodies()) {
-        if (body->GetTag() >= tag_particles && body->GetPos().x() - m_radius < m_rear) {
-            num_moved_particles++;
+    // Collect particles that must be relocated.
+    m_relocated.clear();
+    for (const auto& body : m_particles) {
+        if (body->GetPos().x() - m_radius < m_rear)
+            m_relocated.push_back(body.get());
+    }
+    unsigned int num_moved_particles = (unsigned int)m_relocated.size();
+
+    // At the first move, record the configuration of the particles in the front-most slab of the patch (of the same
+    // size as the relocated volume), sorted by height. This configuration is reused for all subsequent moves, so that
+    // relocated particles start from a settled state. Particles are selected with the same criterion as the relocated
+    // ones, so that the translated slab does not overlap the particles at the front of the patch.
+    if (m_slab.empty()) {
+        double slab_rear = m_front - m_shift_distance;
+        for (const auto& body : m_particles) {
+            const auto& pos = body->GetPos();
+            if (pos.x() - m_radius >= slab_rear)
+                m_slab.push_back(pos - ChVector3d(slab_rear, 0, 0));
         }
+        std::sort(m_slab.begin(), m_slab.end(),
+                  [](const ChVector3d& a, const ChVector3d& b) { return a.z() < b.z(); });
     }
 
-    // Create a Poisson Disk sampler and generate points in layers within the
-    // relocation volume.
-    std::vector<ChVector3d> new_points;
-    double r = safety_factor * m_radius;
-    utils::ChPDSampler<> sampler(2 * r);
-    ChVector3d layer_hdims(m_shift_distance / 2 - r, m_width / 2 - r, 0);
-    ChVector3d layer_center(m_front + m_shift_distance / 2, (m_left + m_right) / 2, m_bottom + offset_factor * r);
-    while (new_points.size() < num_moved_particles) {
-        auto points = sampler.SampleBox(layer_center, layer_hdims);
-        new_points.insert(new_points.end(), points.begin(), points.end());
-        layer_center.z() += 2 * r;
+    // Relocate particles at the recorded slab locations, translated in front of the patch (lowest locations first).
+    size_t num_slab = std::min(m_slab.size(), m_relocated.size());
+    ChVector3d offset(m_front, 0, 0);
+    for (size_t ip = 0; ip < num_slab; ip++) {
+        m_relocated[ip]->SetPos(m_slab[ip] + offset);
+        m_relocated[ip]->SetPosDt(m_init_part_vel);
     }
 
-    // Relocate particles at their new locations.
-    size_t ip = 0;
-    for (auto body : m_ground->GetSystem()->GetBodies()) {
-        if (body->GetTag() >= tag_particles && body->GetPos().x() - m_radius < m_rear) {
-            body->SetPos(new_points[ip++]);
-            body->SetPosDt(m_init_part_vel);
+    // Generate points in layers above the slab for any remaining particles, using a Poisson Disk sampler.
+    if (num_slab < m_relocated.size()) {
+        std::vector<ChVector3d> new_points;
+        double r = safety_factor * m_radius;
+        utils::ChPDSampler<> sampler(2 * r);
+        ChVector3d layer_hdims(m_shift_distance / 2 - r, m_width / 2 - r, 0);
+        ChVector3d layer_center(m_front + m_shift_distance / 2, (m_left + m_right) / 2, m_bottom + offset_factor * r);
+        if (!m_slab.empty())
+            layer_center.z() = m_slab.back().z() + 2 * r;
+        while (new_points.size() < m_relocated.size() - num_slab) {
+            auto points = sampler.SampleBox(layer_center, layer_hdims);
+            new_points.insert(new_points.end(), points.begin(), points.end());
+            layer_center.z() += 2 * r;
+        }
+        for (size_t ip = num_slab; ip < m_relocated.size(); ip++) {
+            m_relocated[ip]->SetPos(new_points[ip - num_slab]);
+            m_relocated[ip]->SetPosDt(m_init_part_vel);
         }
     }
 
@@ -488,9 +515,9 @@ void GranularTerrain::Synchronize(double time) {
 
 double GranularTerrain::GetHeight(const ChVector3d& loc) const {
     double highest = m_bottom;
-    for (auto body : m_ground->GetSystem()->GetBodies()) {
+    for (const auto& body : m_particles) {
         ////double height = ChWorldFrame::Height(body->GetPos());
-        if (body->GetTag() >= tag_particles && body->GetPos().z() > highest)
+        if (body->GetPos().z() > highest)
             highest = body->GetPos().z();
     }
     return highest + m_radius;
@@ -80,6 +80,12 @@ class CH_VEHICLE_API GranularTerrain : public ChTerrain {
     );
 
     /// Enable moving patch and set parameters.
+    /// When the monitored body gets within the buffer distance of the front boundary, the patch is shifted forward by
+    /// the specified distance and the particles left behind the rear boundary are relocated in front of the patch. The
+    /// particles are relocated as a block, using the settled configuration of the front-most slab of particles recorded
+    /// at the first relocation, so that they need not settle again; only particles in excess of that configuration are
+    /// generated with Poisson Disk sampling above it. The same particle bodies (and their collision models) are reused
+    /// for the entire simulation.
     void EnableMovingPatch(std::shared_ptr<ChBody> body,              ///< monitored body
                            double buffer_distance,                    ///< look-ahead distance
                            double shift_distance,                     ///< chunk size of relocated particles
@@ -168,6 +174,10 @@ class CH_VEHICLE_API GranularTerrain : public ChTerrain {
     double m_shift_distance;         ///< size (X direction) of relocated volume
     ChVector3d m_init_part_vel;      ///< initial particle velocity
 
+    std::vector<std::shared_ptr<ChBody>> m_particles;  ///< granular particles
+    std::vector<ChVector3d> m_slab;                    ///< settled slab (relative to slab rear, by height)
+    std::vector<ChBody*> m_relocated;                  ///< particles relocated at the current patch move
+
     // Rough surface (ground-fixed spheres)
     bool m_rough_surface;  ///< rough surface feature enabled?
     int m_nx;              ///< number of fixed spheres in X direction
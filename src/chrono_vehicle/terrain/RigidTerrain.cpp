@@ -50,6 +50,7 @@ RigidTerrain::RigidTerrain(ChSystem* system)
     : m_system(system),
       m_num_patches(0),
       m_use_friction_functor(false),
+      m_cache_spacing(0),
       m_contact_callback(nullptr),
       m_collision_family(14),
       m_initialized(false) {}
@@ -61,6 +62,7 @@ RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename)
     : m_system(system),
       m_num_patches(0),
       m_use_friction_functor(false),
+      m_cache_spacing(0),
       m_contact_callback(nullptr),
       m_collision_family(14),
       m_initialized(false) {
@@ -81,6 +83,10 @@ RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename)
 
     int num_patches = d["Patches"].Size();
 
+    // Optional query cache for mesh patches
+    if (d.HasMember("Query Cache Spacing"))
+        m_cache_spacing = d["Query Cache Spacing"].GetDouble();
+
     // Create patches
     for (int i = 0; i < num_patches; i++) {
         LoadPatch(d["Patches"][i]);
@@ -123,12 +129,18 @@ void RigidTerrain::LoadPatch(const rapidjson::Value& d) {
         double sy = d["Geometry"]["Size"][1u].GetDouble();
         double hMin = d["Geometry"]["Height Range"][0u].GetDouble();
         double hMax = d["Geometry"]["Height Range"][1u].GetDouble();
-        bool connected_mesh = true;
-        if (d["Geometry"].HasMember("Connected Mesh")) {
-            connected_mesh = d["Geometry"]["Connected Mesh"].GetBool();
+        if (d["Geometry"].HasMember("Tile Size")) {
+            double tile_size = d["Geometry"]["Tile Size"].GetDouble();
+            patch = AddHeightfieldPatch(material, ChCoordsys<>(loc, rot), vehicle::GetDataFile(bmp_file), sx, sy, hMin,
+                                        hMax, tile_size);
+        } else {
+            bool connected_mesh = true;
+            if (d["Geometry"].HasMember("Connected Mesh")) {
+                connected_mesh = d["Geometry"]["Connected Mesh"].GetBool();
+            }
+            patch = AddPatch(material, ChCoordsys<>(loc, rot), vehicle::GetDataFile(bmp_file), sx, sy, hMin, hMax,
+                             connected_mesh);
         }
-        patch = AddPatch(material, ChCoordsys<>(loc, rot), vehicle::GetDataFile(bmp_file), sx, sy, hMin, hMax,
-                         connected_mesh);
     }
 
     // Set visualization data
@@ -179,9 +191,15 @@ void RigidTerrain::InitializePatch(std::shared_ptr<Patch> patch) {
     // Initialize the patch
     patch->Initialize();
 
+    // Pre-sample the surface of triangular mesh patches
+    if (m_cache_spacing > 0 && (patch->m_type == PatchType::MESH || patch->m_type == PatchType::HEIGHT_MAP))
+        std::static_pointer_cast<MeshPatch>(patch)->BuildQueryCache(m_cache_spacing);
+
     // All patches are added to the same collision family and collision with other models in this family is disabled
-    patch->m_body->GetCollisionModel()->SetFamily(m_collision_family);
-    patch->m_body->GetCollisionModel()->DisallowCollisionsWith(m_collision_family);
+    if (patch->m_body->GetCollisionModel()) {
+        patch->m_body->GetCollisionModel()->SetFamily(m_collision_family);
+        patch->m_body->GetCollisionModel()->DisallowCollisionsWith(m_collision_family);
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -428,6 +446,70 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChCo
     return patch;
 }
 
+// -----------------------------------------------------------------------------
+
+std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddHeightfieldPatch(std::shared_ptr<ChContactMaterial> material,
+                                                                       const ChCoordsys<>& position,
+                                                                       const std::string& heightmap_file,
+                                                                       double length,
+                                                                       double width,
+                                                                       double hMin,
+                                                                       double hMax,
+                                                                       double tile_size,
+                                                                       bool visualization) {
+    auto patch = chrono_types::make_shared<HeightfieldPatch>();
+    AddPatch(patch, position, material);
+    patch->m_visualize = visualization;
+
+    // The patch body only carries the patch frame; contact geometry is attached to the tile bodies
+    patch->m_body->EnableCollision(false);
+
+    // Read the image file (request only 1 channel) and extract number of pixels
+    STB hmap;
+    if (!hmap.ReadFromFile(heightmap_file, 1)) {
+        throw std::invalid_argument("Cannot open height map image file");
+    }
+    int nv_x = hmap.GetWidth();
+    int nv_y = hmap.GetHeight();
+    if (nv_x < 2 || nv_y < 2) {
+        throw std::invalid_argument("Height map image must have at least 2 x 2 pixels");
+    }
+
+    // Grid of node heights, with the gray level of a pixel mapped to the height range (black corresponding to hMin
+    // and white corresponding to hMax). Pixels in a BMP start at the top-left corner; grid nodes are ordered starting
+    // at the bottom-left corner, which corresponds to the point (-length/2, -width/2).
+    double h_scale = (hMax - hMin) / hmap.GetRange();
+    patch->m_heights.resize(nv_x * nv_y);
+    for (int j = 0; j < nv_y; j++) {
+        for (int i = 0; i < nv_x; i++) {
+            patch->m_heights[i + nv_x * j] = (float)(hMin + hmap.Gray(i, nv_y - 1 - j) * h_scale);
+        }
+    }
+
+    // Grid frame, with heights along the ISO vertical
+    patch->m_frame = ChFrame<>(position) * ChFrame<>(VNULL, ChMatrix33<>(ChWorldFrame::Rotation().transpose()));
+
+    // Cache patch parameters
+    patch->m_terrain = this;
+    patch->m_material = material;
+    patch->m_nx = nv_x;
+    patch->m_ny = nv_y;
+    patch->m_dx = length / (nv_x - 1);
+    patch->m_dy = width / (nv_y - 1);
+    patch->m_hlength = length / 2;
+    patch->m_hwidth = width / 2;
+    patch->m_tile_nx = std::max(1, (int)std::round(tile_size / patch->m_dx));
+    patch->m_tile_ny = std::max(1, (int)std::round(tile_size / patch->m_dy));
+    patch->m_num_tiles_x = (nv_x - 2) / patch->m_tile_nx + 1;
+    patch->m_num_tiles_y = (nv_y - 2) / patch->m_tile_ny + 1;
+    patch->m_tiles.resize(patch->m_num_tiles_x * patch->m_num_tiles_y);
+    patch->m_radius = ChVector3d(length, width, (hMax - hMin)).Length() / 2;
+    patch->m_mesh_name = filesystem::path(heightmap_file).stem();
+    patch->m_type = PatchType::HEIGHT_FIELD;
+
+    return patch;
+}
+
 //----------------------------------------------------------------------------------------------
 // Create a 'heightmap' from a group of points by weighted averaging of the nearest the vectors
 // within x,y grid with z height. Grid resolution can be increased or decreased and so can the
@@ -870,14 +952,13 @@ class RTContactCallback : public ChContactContainer::AddContactCallback {
         ChBody* body_other = nullptr;
         ChCollisionShape* shape_other = nullptr;
         for (auto patch : m_terrain->GetPatches()) {
-            auto model = patch->GetGroundBody()->GetCollisionModel().get();
-            if (model == contactinfo.modelA) {
+            if (patch->HasCollisionModel(contactinfo.modelA)) {
                 body_patch = patch->GetGroundBody().get();
                 body_other = dynamic_cast<ChBody*>(contactinfo.modelB->GetContactable());
                 shape_other = contactinfo.shapeB;
                 break;
             }
-            if (model == contactinfo.modelB) {
+            if (patch->HasCollisionModel(contactinfo.modelB)) {
                 body_patch = patch->GetGroundBody().get();
                 body_other = dynamic_cast<ChBody*>(contactinfo.modelA->GetContactable());
                 shape_other = contactinfo.shapeA;
@@ -969,6 +1050,295 @@ void RigidTerrain::MeshPatch::Initialize() {
     }
 }
 
+// Sample the top surface of the mesh on a uniform grid in a frame with z axis along the world vertical, centered at
+// the patch body location. Each triangle is rasterized into the grid and, at each sample, the highest surface point and
+// the corresponding triangle normal are retained.
+void RigidTerrain::MeshPatch::BuildQueryCache(double spacing) {
+    m_cache_frame = ChFrame<>(m_body->GetPos(), ChMatrix33<>(ChWorldFrame::Rotation().transpose()));
+
+    const auto& vertices = m_trimesh->GetCoordsVertices();
+    const auto& faces = m_trimesh->GetIndicesVertexes();
+    if (vertices.empty() || faces.empty())
+        return;
+
+    // Mesh vertices in the cache frame and grid dimensions
+    std::vector<ChVector3d> points(vertices.size());
+    double xmin = std::numeric_limits<double>::max();
+    double xmax = std::numeric_limits<double>::lowest();
+    double ymin = std::numeric_limits<double>::max();
+    double ymax = std::numeric_limits<double>::lowest();
+    for (size_t iv = 0; iv < vertices.size(); iv++) {
+        points[iv] = m_cache_frame.TransformPointParentToLocal(m_body->TransformPointLocalToParent(vertices[iv]));
+        xmin = std::min(xmin, points[iv].x());
+        xmax = std::max(xmax, points[iv].x());
+        ymin = std::min(ymin, points[iv].y());
+        ymax = std::max(ymax, points[iv].y());
+    }
+
+    m_cache_spacing = spacing;
+    m_cache_xmin = xmin;
+    m_cache_ymin = ymin;
+    m_cache_nx = (int)std::ceil((xmax - xmin) / spacing) + 1;
+    m_cache_ny = (int)std::ceil((ymax - ymin) / spacing) + 1;
+    m_cache_heights.assign(m_cache_nx * m_cache_ny, std::numeric_limits<float>::quiet_NaN());
+    m_cache_normals.assign(m_cache_nx * m_cache_ny, ChVector3f(0, 0, 1));
+
+    // Tolerance for samples on triangle edges (relative to the triangle area)
+    const double eps = 1e-9;
+
+    for (const auto& face : faces) {
+        const auto& A = points[face[0]];
+        const auto& B = points[face[1]];
+        const auto& C = points[face[2]];
+
+        // Skip triangles parallel to the vertical
+        double area = (B.x() - A.x()) * (C.y() - A.y()) - (C.x() - A.x()) * (B.y() - A.y());
+        if (std::abs(area) < 1e-12)
+            continue;
+
+        ChVector3d n = Vcross(B - A, C - A).GetNormalized();
+        if (n.z() < 0)
+            n = -n;
+
+        int i0 = std::max(0, (int)std::ceil((std::min({A.x(), B.x(), C.x()}) - xmin) / spacing - eps));
+        int i1 = std::min(m_cache_nx - 1, (int)std::floor((std::max({A.x(), B.x(), C.x()}) - xmin) / spacing + eps));
+        int j0 = std::max(0, (int)std::ceil((std::min({A.y(), B.y(), C.y()}) - ymin) / spacing - eps));
+        int j1 = std::min(m_cache_ny - 1, (int)std::floor((std::max({A.y(), B.y(), C.y()}) - ymin) / spacing + eps));
+
+        for (int j = j0; j <= j1; j++) {
+            double y = ymin + j * spacing;
+            for (int i = i0; i <= i1; i++) {
+                double x = xmin + i * spacing;
+                // Barycentric coordinates of the sample in the projected triangle
+                double wb = ((x - A.x()) * (C.y() - A.y()) - (C.x() - A.x()) * (y - A.y())) / area;
+                double wc = ((B.x() - A.x()) * (y - A.y()) - (x - A.x()) * (B.y() - A.y())) / area;
+                double wa = 1 - wb - wc;
+                if (wa < -eps || wb < -eps || wc < -eps)
+                    continue;
+                double h = wa * A.z() + wb * B.z() + wc * C.z();
+                int k = i + m_cache_nx * j;
+                if (std::isnan(m_cache_heights[k]) || h > m_cache_heights[k]) {
+                    m_cache_heights[k] = (float)h;
+                    m_cache_normals[k] = ChVector3f(n);
+                }
+            }
+        }
+    }
+}
+
+void RigidTerrain::HeightfieldPatch::Initialize() {
+    StreamTiles();
+}
+
+// -----------------------------------------------------------------------------
+// Streaming of heightfield tiles
+// -----------------------------------------------------------------------------
+
+void RigidTerrain::AddActiveDomain(std::shared_ptr<ChBody> body, const ChVector3d& center, double radius) {
+    m_active_domains.push_back({body, center, radius});
+}
+
+void RigidTerrain::Synchronize(double time) {
+    if (!m_initialized)
+        return;
+
+    for (auto& patch : m_patches) {
+        if (patch->m_type == PatchType::HEIGHT_FIELD)
+            std::static_pointer_cast<HeightfieldPatch>(patch)->StreamTiles();
+    }
+}
+
+void RigidTerrain::HeightfieldPatch::StreamTiles() {
+    const auto& domains = m_terrain->m_active_domains;
+
+    // Without active domains, all tiles are kept in the system
+    if (domains.empty()) {
+        if (m_active.empty()) {
+            for (int tile = 0; tile < (int)m_tiles.size(); tile++)
+                AddTile(tile);
+        }
+        return;
+    }
+
+    double tile_x = m_tile_nx * m_dx;
+    double tile_y = m_tile_ny * m_dy;
+    double margin = 0.5 * std::max(tile_x, tile_y);
+
+    // Domain centers in the grid frame
+    std::vector<ChVector3d> centers;
+    for (const auto& domain : domains) {
+        auto center = domain.m_body->TransformPointLocalToParent(domain.m_center);
+        centers.push_back(m_frame.TransformPointParentToLocal(center));
+    }
+
+    // Remove tiles farther than the hysteresis distance from all active domains
+    for (size_t k = 0; k < m_active.size();) {
+        bool keep = false;
+        for (size_t id = 0; id < domains.size() && !keep; id++)
+            keep = GetTileDistance(m_active[k], centers[id].x(), centers[id].y()) <= domains[id].m_radius + margin;
+        if (keep) {
+            k++;
+        } else {
+            RemoveTile(m_active[k]);
+        }
+    }
+
+    // Add tiles intersecting an active domain
+    for (size_t id = 0; id < domains.size(); id++) {
+        double x = centers[id].x();
+        double y = centers[id].y();
+        double r = domains[id].m_radius;
+        int ix_min = std::max(0, (int)std::floor((x - r + m_hlength) / tile_x));
+        int ix_max = std::min(m_num_tiles_x - 1, (int)std::floor((x + r + m_hlength) / tile_x));
+        int iy_min = std::max(0, (int)std::floor((y - r + m_hwidth) / tile_y));
+        int iy_max = std::min(m_num_tiles_y - 1, (int)std::floor((y + r + m_hwidth) / tile_y));
+        for (int iy = iy_min; iy <= iy_max; iy++) {
+            for (int ix = ix_min; ix <= ix_max; ix++) {
+                int tile = ix + m_num_tiles_x * iy;
+                if (!m_tiles[tile] && GetTileDistance(tile, x, y) <= r)
+                    AddTile(tile);
+            }
+        }
+    }
+}
+
+double RigidTerrain::HeightfieldPatch::GetTileDistance(int tile, double x, double y) const {
+    int i0 = (tile % m_num_tiles_x) * m_tile_nx;
+    int j0 = (tile / m_num_tiles_x) * m_tile_ny;
+    int i1 = std::min(i0 + m_tile_nx, m_nx - 1);
+    int j1 = std::min(j0 + m_tile_ny, m_ny - 1);
+    double dx = std::max(0.0, std::max(i0 * m_dx - m_hlength - x, x - (i1 * m_dx - m_hlength)));
+    double dy = std::max(0.0, std::max(j0 * m_dy - m_hwidth - y, y - (j1 * m_dy - m_hwidth)));
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+void RigidTerrain::HeightfieldPatch::AddTile(int tile) {
+    // Range of grid nodes in this tile (adjacent tiles share their boundary nodes)
+    int ix = tile % m_num_tiles_x;
+    int iy = tile / m_num_tiles_x;
+    int i0 = ix * m_tile_nx;
+    int j0 = iy * m_tile_ny;
+    int i1 = std::min(i0 + m_tile_nx, m_nx - 1);
+    int j1 = std::min(j0 + m_tile_ny, m_ny - 1);
+    int nx = i1 - i0 + 1;
+    int ny = j1 - j0 + 1;
+
+    // Tile heights, relative to the middle of the tile height range
+    double h_min = std::numeric_limits<double>::max();
+    double h_max = std::numeric_limits<double>::lowest();
+    for (int j = j0; j <= j1; j++) {
+        for (int i = i0; i <= i1; i++) {
+            h_min = std::min(h_min, (double)m_heights[i + m_nx * j]);
+            h_max = std::max(h_max, (double)m_heights[i + m_nx * j]);
+        }
+    }
+    double h_mid = (h_min + h_max) / 2;
+    std::vector<double> heights(nx * ny);
+    for (int j = 0; j < ny; j++) {
+        for (int i = 0; i < nx; i++) {
+            heights[i + nx * j] = m_heights[(i0 + i) + m_nx * (j0 + j)] - h_mid;
+        }
+    }
+
+    // Create the tile body (fixed), centered at the tile center
+    ChVector3d center(0.5 * (i0 + i1) * m_dx - m_hlength, 0.5 * (j0 + j1) * m_dy - m_hwidth, h_mid);
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetName(m_body->GetName() + "_tile_" + std::to_string(ix) + "_" + std::to_string(iy));
+    body->SetPos(m_frame.TransformPointLocalToParent(center));
+    body->SetRot(m_frame.GetRot());
+    body->SetFixed(true);
+    body->EnableCollision(true);
+
+    auto ct_shape = chrono_types::make_shared<ChCollisionShapeHeightfield>(m_material, nx, ny, m_dx, m_dy, heights);
+    body->AddCollisionShape(ct_shape);
+    body->GetCollisionModel()->SetFamily(m_terrain->m_collision_family);
+    body->GetCollisionModel()->DisallowCollisionsWith(m_terrain->m_collision_family);
+
+    if (m_visualize) {
+        // Triangular mesh with the same triangulation as the heightfield and smoothed vertex normals.
+        // UV coordinates are mapped in [0,1] x [0,1] over the entire patch.
+        auto trimesh = chrono_types::make_shared<ChTriangleMeshConnected>();
+        std::vector<ChVector3d>& vertices = trimesh->GetCoordsVertices();
+        std::vector<ChVector3d>& normals = trimesh->GetCoordsNormals();
+        std::vector<ChVector2d>& uvs = trimesh->GetCoordsUV();
+        std::vector<ChVector3i>& idx_vertices = trimesh->GetIndicesVertexes();
+        std::vector<ChVector3i>& idx_normals = trimesh->GetIndicesNormals();
+        std::vector<ChVector3i>& idx_uvs = trimesh->GetIndicesUV();
+
+        for (int j = j0; j <= j1; j++) {
+            for (int i = i0; i <= i1; i++) {
+                int im = std::max(i - 1, 0);
+                int ip = std::min(i + 1, m_nx - 1);
+                int jm = std::max(j - 1, 0);
+                int jp = std::min(j + 1, m_ny - 1);
+                double dhdx = (m_heights[ip + m_nx * j] - m_heights[im + m_nx * j]) / ((ip - im) * m_dx);
+                double dhdy = (m_heights[i + m_nx * jp] - m_heights[i + m_nx * jm]) / ((jp - jm) * m_dy);
+                vertices.push_back(ChVector3d(i * m_dx - m_hlength, j * m_dy - m_hwidth, m_heights[i + m_nx * j]) -
+                                   center);
+                normals.push_back(ChVector3d(-dhdx, -dhdy, 1).GetNormalized());
+                uvs.push_back(ChVector2d(i / (m_nx - 1.0), 1 - j / (m_ny - 1.0)));
+            }
+        }
+
+        for (int j = 0; j < ny - 1; j++) {
+            for (int i = 0; i < nx - 1; i++) {
+                int v0 = i + nx * j;
+                ChVector3i t1(v0, v0 + 1, v0 + nx);
+                ChVector3i t2(v0 + 1, v0 + nx + 1, v0 + nx);
+                idx_vertices.push_back(t1);
+                idx_vertices.push_back(t2);
+                idx_normals.push_back(t1);
+                idx_normals.push_back(t2);
+                idx_uvs.push_back(t1);
+                idx_uvs.push_back(t2);
+            }
+        }
+
+        body->AddVisualModel(chrono_types::make_shared<ChVisualModel>());
+        auto trimesh_shape = chrono_types::make_shared<ChVisualShapeTriangleMesh>();
+        trimesh_shape->AddMaterial(m_vis_mat);
+        trimesh_shape->SetName(m_mesh_name + "_" + std::to_string(ix) + "_" + std::to_string(iy));
+        trimesh_shape->SetMutable(false);
+        trimesh_shape->SetMesh(trimesh, true);
+        body->AddVisualShape(trimesh_shape);
+    }
+
+    // Add the tile body to the system and bind it to the collision and visualization systems (if they exist).
+    // Visual assets of tiles created at initialization are bound together with all other physics items.
+    auto sys = m_terrain->m_system;
+    sys->AddBody(body);
+    if (sys->GetCollisionSystem())
+        sys->GetCollisionSystem()->BindItem(body);
+    if (m_terrain->m_initialized && sys->GetVisualSystem())
+        sys->GetVisualSystem()->BindItem(body);
+
+    m_tiles[tile] = body;
+    m_active.push_back(tile);
+}
+
+void RigidTerrain::HeightfieldPatch::RemoveTile(int tile) {
+    auto sys = m_terrain->m_system;
+    if (sys->GetVisualSystem())
+        sys->GetVisualSystem()->UnbindItem(m_tiles[tile]);
+    sys->RemoveBody(m_tiles[tile]);
+
+    m_tiles[tile] = nullptr;
+    m_active.erase(std::find(m_active.begin(), m_active.end(), tile));
+}
+
+void RigidTerrain::HeightfieldPatch::RemoveTiles() {
+    while (!m_active.empty())
+        RemoveTile(m_active.back());
+}
+
+bool RigidTerrain::HeightfieldPatch::HasCollisionModel(const ChCollisionModel* model) const {
+    for (auto tile : m_active) {
+        if (model == m_tiles[tile]->GetCollisionModel().get())
+            return true;
+    }
+    return false;
+}
+
 // -----------------------------------------------------------------------------
 
 void RigidTerrain::BindPatch(std::shared_ptr<Patch> patch) {
@@ -1000,6 +1370,10 @@ void RigidTerrain::RemovePatch(std::shared_ptr<Patch> patch) {
         if (m_system->GetCollisionSystem())
             m_system->GetCollisionSystem()->UnbindItem((*pos)->m_body);
 
+        // Remove all tiles of a heightfield patch from the system
+        if ((*pos)->m_type == PatchType::HEIGHT_FIELD)
+            std::static_pointer_cast<HeightfieldPatch>(*pos)->RemoveTiles();
+
         // Erase from the list of patches
         m_patches.erase(pos);
         m_num_patches--;
@@ -1113,6 +1487,9 @@ bool RigidTerrain::BoxPatch::FindPoint(const ChVector3d& loc, double& height, Ch
 }
 
 bool RigidTerrain::MeshPatch::FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const {
+    if (m_cache_spacing > 0 && FindPointCached(loc, height, normal))
+        return true;
+
     ChVector3d from = loc;
     ChVector3d to = loc - (m_radius + 1000) * ChWorldFrame::Vertical();
 
@@ -1124,6 +1501,83 @@ bool RigidTerrain::MeshPatch::FindPoint(const ChVector3d& loc, double& height, C
     return result.hit;
 }
 
+bool RigidTerrain::MeshPatch::FindPointCached(const ChVector3d& loc, double& height, ChVector3d& normal) const {
+    // Location in the cache frame and containing grid cell
+    ChVector3d p = m_cache_frame.TransformPointParentToLocal(loc);
+    double x = (p.x() - m_cache_xmin) / m_cache_spacing;
+    double y = (p.y() - m_cache_ymin) / m_cache_spacing;
+    if (x < 0 || x > m_cache_nx - 1 || y < 0 || y > m_cache_ny - 1)
+        return false;
+    int i = std::min((int)x, m_cache_nx - 2);
+    int j = std::min((int)y, m_cache_ny - 2);
+    double u = x - i;
+    double v = y - j;
+
+    // All 4 samples must be on the mesh surface
+    int k00 = i + m_cache_nx * j;
+    int k10 = k00 + 1;
+    int k01 = k00 + m_cache_nx;
+    int k11 = k01 + 1;
+    if (std::isnan(m_cache_heights[k00]) || std::isnan(m_cache_heights[k10]) || std::isnan(m_cache_heights[k01]) ||
+        std::isnan(m_cache_heights[k11]))
+        return false;
+
+    double w00 = (1 - u) * (1 - v);
+    double w10 = u * (1 - v);
+    double w01 = (1 - u) * v;
+    double w11 = u * v;
+    double h = w00 * m_cache_heights[k00] + w10 * m_cache_heights[k10] + w01 * m_cache_heights[k01] +
+               w11 * m_cache_heights[k11];
+
+    // The terrain point must be below the specified location
+    if (h > p.z())
+        return false;
+
+    ChVector3d n = w00 * ChVector3d(m_cache_normals[k00]) + w10 * ChVector3d(m_cache_normals[k10]) +
+                   w01 * ChVector3d(m_cache_normals[k01]) + w11 * ChVector3d(m_cache_normals[k11]);
+
+    height = ChWorldFrame::Height(m_cache_frame.TransformPointLocalToParent(ChVector3d(p.x(), p.y(), h)));
+    normal = m_cache_frame.TransformDirectionLocalToParent(n.GetNormalized());
+
+    return true;
+}
+
+bool RigidTerrain::HeightfieldPatch::FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const {
+    // Location in the grid frame and containing grid cell
+    ChVector3d p = m_frame.TransformPointParentToLocal(loc);
+    double x = (p.x() + m_hlength) / m_dx;
+    double y = (p.y() + m_hwidth) / m_dy;
+    if (x < 0 || x > m_nx - 1 || y < 0 || y > m_ny - 1)
+        return false;
+    int i = std::min((int)x, m_nx - 2);
+    int j = std::min((int)y, m_ny - 2);
+    double u = x - i;
+    double v = y - j;
+
+    // Interpolate in the cell triangle containing the point (consistent with the heightfield collision shape, cells
+    // are split along the diagonal from node (i+1,j) to node (i,j+1))
+    double h00 = m_heights[i + m_nx * j];
+    double h10 = m_heights[(i + 1) + m_nx * j];
+    double h01 = m_heights[i + m_nx * (j + 1)];
+    double h11 = m_heights[(i + 1) + m_nx * (j + 1)];
+    double h, dhdu, dhdv;
+    if (u + v <= 1) {
+        dhdu = h10 - h00;
+        dhdv = h01 - h00;
+        h = h00 + u * dhdu + v * dhdv;
+    } else {
+        dhdu = h11 - h01;
+        dhdv = h11 - h10;
+        h = h11 - (1 - u) * dhdu - (1 - v) * dhdv;
+    }
+
+    ChVector3d C = m_frame.TransformPointLocalToParent(ChVector3d(p.x(), p.y(), h));
+    height = ChWorldFrame::Height(C);
+    normal = m_frame.TransformDirectionLocalToParent(ChVector3d(-dhdu / m_dx, -dhdv / m_dy, 1).GetNormalized());
+
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // Export all patch meshes
 // -----------------------------------------------------------------------------
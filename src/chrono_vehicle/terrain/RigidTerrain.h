@@ -50,7 +50,8 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     enum class PatchType {
         BOX,        ///< rectangular box
         MESH,       ///< triangular mesh (from a Wavefront OBJ file)
-        HEIGHT_MAP  ///< triangular mesh (generated from a gray-scale heightmap image)
+        HEIGHT_MAP,   ///< triangular mesh (generated from a gray-scale heightmap image)
+        HEIGHT_FIELD  ///< tiled heightfield (generated from a gray-scale heightmap image)
     };
 
     /// Definition of a patch in a rigid terrain model.
@@ -72,6 +73,11 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
 
         virtual void Initialize() = 0;
 
+        /// Return true if the specified collision model belongs to this patch.
+        virtual bool HasCollisionModel(const ChCollisionModel* model) const {
+            return model == m_body->GetCollisionModel().get();
+        }
+
       protected:
         Patch();
 
@@ -143,6 +149,25 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         bool visualization = true                     ///< [in] enable/disable construction of visualization assets
     );
 
+    /// Add a terrain patch represented by a tiled heightfield, generated from a heightmap image.
+    /// The heightmap image is interpreted as for a triangular mesh heightmap patch, but the patch is split in square
+    /// tiles of the specified size, each with a native heightfield collision shape (no triangle mesh and no BVH to
+    /// build). If active domains are defined (see AddActiveDomain), tiles are streamed in and out of the Chrono system
+    /// around these domains; otherwise, all tiles are created at initialization. The terrain height and normal are
+    /// obtained through a direct lookup in the height grid, with heights measured along the patch vertical.
+    /// This patch type is supported only with the Bullet collision system.
+    std::shared_ptr<Patch> AddHeightfieldPatch(
+        std::shared_ptr<ChContactMaterial> material,  ///< [in] contact material
+        const ChCoordsys<>& position,                 ///< [in] patch location and orientation
+        const std::string& heightmap_file,            ///< [in] filename for the height map (BMP)
+        double length,                                ///< [in] patch length
+        double width,                                 ///< [in] patch width
+        double hMin,                                  ///< [in] minimum height (black level)
+        double hMax,                                  ///< [in] maximum height (white level)
+        double tile_size = 50,                        ///< [in] approximate tile size
+        bool visualization = true                     ///< [in] enable/disable construction of visualization assets
+    );
+
     /// Add a terrain patch drawn from a vector of vectors - refined using the LEPP method.
     /// For each Chvector, x and y represent grid elements and the z value is the height.
     /// Usually, 10% to 25% of the heightmap resolution for unrefined_resolution produces good results.
@@ -162,9 +187,22 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         bool visualization = true                     ///< [in] enable/disable construction of visualisation assets
     );
 
+    /// Add an active domain for the streaming of tiled heightfield patches.
+    /// All tiles intersecting the disk with given radius, centered at the specified point (expressed in the body
+    /// frame), are kept in the Chrono system. A tile is removed from the system once it is farther from all active
+    /// domains than their radius plus half the tile size. Active domains must be defined before Initialize.
+    void AddActiveDomain(std::shared_ptr<ChBody> body,  ///< [in] reference body
+                         const ChVector3d& center,      ///< [in] domain center (in body frame)
+                         double radius                  ///< [in] domain radius
+    );
+
     /// Initialize all defined terrain patches.
     void Initialize();
 
+    /// Update the terrain system at the specified time.
+    /// Tiles of heightfield patches are streamed in and out of the Chrono system, based on the active domains.
+    virtual void Synchronize(double time) override;
+
     /// Get the terrain patches currently added to the rigid terrain system.
     const std::vector<std::shared_ptr<Patch>>& GetPatches() const { return m_patches; }
 
@@ -184,6 +222,15 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     /// default, this option is disabled.  This function must be called before Initialize.
     void UseLocationDependentFriction(bool val) { m_use_friction_functor = val; }
 
+    /// Enable the query cache for mesh and heightmap patches, with the specified grid spacing.
+    /// If enabled, the top surface of each triangular mesh patch is pre-sampled at initialization on a uniform grid
+    /// perpendicular to the world vertical, and terrain height and normal queries are answered by bilinear
+    /// interpolation of the sampled values. A query falls back to ray casting into the patch collision model if any of
+    /// the surrounding samples is missing (outside the mesh) or if the specified location is below the sampled surface.
+    /// The cache assumes that patches do not move after initialization. By default, the query cache is disabled.
+    /// This function must be called before Initialize.
+    void EnableQueryCache(double spacing) { m_cache_spacing = spacing; }
+
     /// Get the terrain height below the specified location.
     /// This function should return the height of the closest point *below* the specified location (in the direction of
     /// the current world vertical). If a user-provided functor object of type ChTerrain::HeightFunctor is provided,
@@ -250,17 +297,66 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         std::shared_ptr<ChTriangleMeshConnected> m_trimesh;  ///< associated mesh (contact and visualization)
         std::shared_ptr<ChTriangleMeshSoup> m_trimesh_s;     ///< associated contact mesh soup
         std::string m_mesh_name;                             ///< name of associated mesh
+        double m_cache_spacing;                              ///< grid spacing of query cache (0 if no cache)
+        ChFrame<> m_cache_frame;                             ///< query cache frame (z along world vertical)
+        double m_cache_xmin;                                 ///< x coordinate of first query cache sample
+        double m_cache_ymin;                                 ///< y coordinate of first query cache sample
+        int m_cache_nx;                                      ///< number of query cache samples in x direction
+        int m_cache_ny;                                      ///< number of query cache samples in y direction
+        std::vector<float> m_cache_heights;                  ///< sampled heights (NaN if no surface sample)
+        std::vector<ChVector3f> m_cache_normals;             ///< sampled normals (in query cache frame)
+        MeshPatch() : m_cache_spacing(0) {}
         virtual void Initialize() override;
         virtual bool FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const override;
+        void BuildQueryCache(double spacing);
+        bool FindPointCached(const ChVector3d& loc, double& height, ChVector3d& normal) const;
         virtual void ExportMeshPovray(const std::string& out_dir, bool smoothed = false) override;
         virtual void ExportMeshWavefront(const std::string& out_dir) override;
     };
 
+    /// Patch represented as a tiled heightfield.
+    struct CH_VEHICLE_API HeightfieldPatch : public Patch {
+        RigidTerrain* m_terrain;                        ///< containing terrain
+        std::shared_ptr<ChContactMaterial> m_material;  ///< contact material
+        ChFrame<> m_frame;                              ///< grid frame (ISO, centered at the patch location)
+        int m_nx;                                       ///< number of grid nodes in x direction
+        int m_ny;                                       ///< number of grid nodes in y direction
+        double m_dx;                                    ///< grid spacing in x direction
+        double m_dy;                                    ///< grid spacing in y direction
+        double m_hlength;                               ///< patch half-length
+        double m_hwidth;                                ///< patch half-width
+        std::vector<float> m_heights;                   ///< node heights (x index running fastest)
+        int m_tile_nx;                                  ///< number of grid cells of a tile in x direction
+        int m_tile_ny;                                  ///< number of grid cells of a tile in y direction
+        int m_num_tiles_x;                              ///< number of tiles in x direction
+        int m_num_tiles_y;                              ///< number of tiles in y direction
+        std::vector<std::shared_ptr<ChBody>> m_tiles;   ///< tile bodies (empty for tiles not in the system)
+        std::vector<int> m_active;                      ///< indices of tiles in the system
+        std::string m_mesh_name;                        ///< name of the heightmap
+        virtual void Initialize() override;
+        virtual bool FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const override;
+        virtual bool HasCollisionModel(const ChCollisionModel* model) const override;
+        void StreamTiles();
+        void AddTile(int tile);
+        void RemoveTile(int tile);
+        void RemoveTiles();
+        double GetTileDistance(int tile, double x, double y) const;
+    };
+
+    /// Active domain for streaming of heightfield tiles.
+    struct ActiveDomain {
+        std::shared_ptr<ChBody> m_body;  ///< reference body
+        ChVector3d m_center;             ///< domain center (in body frame)
+        double m_radius;                 ///< domain radius
+    };
+
     ChSystem* m_system;
     int m_num_patches;
     std::vector<std::shared_ptr<Patch>> m_patches;
     bool m_use_friction_functor;
+    double m_cache_spacing;
     std::shared_ptr<ChContactContainer::AddContactCallback> m_contact_callback;
+    std::vector<ActiveDomain> m_active_domains;
 
     void AddPatch(std::shared_ptr<Patch> patch,
                   const ChCoordsys<>& position,
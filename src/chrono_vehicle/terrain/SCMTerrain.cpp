@@ -18,15 +18,18 @@
 // =============================================================================
 
 #include <cstdio>
+#include <fstream>
 #include <cmath>
 #include <queue>
 #include <unordered_set>
 #include <limits>
+#include <stdexcept>
 
 #ifdef _OPENMP
     #include <omp.h>
 #endif
 
+#include "chrono/core/ChTaskScheduler.h"
 #include "chrono/physics/ChContactMaterialNSC.h"
 #include "chrono/physics/ChContactMaterialSMC.h"
 #include "chrono/fea/ChContactSurfaceMesh.h"
@@ -34,11 +37,13 @@
 #include "chrono/assets/ChVisualShapeBox.h"
 #include "chrono/utils/ChConvexHull.h"
 #include "chrono/utils/ChUtils.h"
+#include "chrono/utils/ChOpenMP.h"
 
 #include "chrono_vehicle/ChVehicleModelData.h"
 #include "chrono_vehicle/terrain/SCMTerrain.h"
 
 #include "chrono_thirdparty/stb/stb.h"
+#include "chrono_thirdparty/filesystem/path.h"
 
 namespace chrono {
 namespace vehicle {
@@ -70,11 +75,13 @@ ChVector3d SCMTerrain::GetInitNormal(const ChVector3d& loc) const {
 
 // Get the terrain height below the specified location.
 double SCMTerrain::GetHeight(const ChVector3d& loc) const {
+    auto lock = m_loader->LockQuery();
     return m_loader->GetHeight(loc);
 }
 
 // Get the terrain normal at the point below the specified location.
 ChVector3d SCMTerrain::GetNormal(const ChVector3d& loc) const {
+    auto lock = m_loader->LockQuery();
     return m_loader->GetNormal(loc);
 }
 
@@ -85,6 +92,7 @@ float SCMTerrain::GetCoefficientFriction(const ChVector3d& loc) const {
 
 // Get SCM information at the node closest to the specified location.
 SCMTerrain::NodeInfo SCMTerrain::GetNodeInfo(const ChVector3d& loc) const {
+    auto lock = m_loader->LockQuery();
     return m_loader->GetNodeInfo(loc);
 }
 
@@ -209,6 +217,36 @@ void SCMTerrain::AddMovingPatch(std::shared_ptr<ChBody> body,
     m_loader->m_moving_patch = true;
 }
 
+// Enable paging of the terrain state.
+void SCMTerrain::EnablePaging(double distance, const std::string& directory) {
+    if (!directory.empty() && !filesystem::create_directory(filesystem::path(directory)))
+        std::cerr << "SCMTerrain: cannot create page directory " << directory << std::endl;
+    m_loader->m_paging = true;
+    m_loader->m_paging_distance = distance;
+    m_loader->m_grid_map.SetPageDirectory(directory);
+}
+
+std::pair<int, int> SCMTerrain::GetNumTiles() const {
+    return std::make_pair(m_loader->m_grid_map.GetNumResidentTiles(), m_loader->m_grid_map.GetNumPagedTiles());
+}
+
+// Enable coarsening of the terrain state.
+void SCMTerrain::EnableCoarsening(double distance, int factor) {
+    if (factor < 2 || factor > 64 || (factor & (factor - 1)) != 0)
+        throw std::invalid_argument("SCMTerrain: the coarsening factor must be a power of 2, between 2 and 64");
+    m_loader->m_coarsening = true;
+    m_loader->m_coarsening_distance = distance;
+    m_loader->m_coarsening_factor = factor;
+}
+
+int SCMTerrain::GetNumCoarseTiles() const {
+    return m_loader->m_grid_map.GetNumCoarseTiles();
+}
+
+size_t SCMTerrain::GetMemoryUsage() const {
+    return m_loader->GetMemoryUsage();
+}
+
 // Set user-supplied callback for evaluating location-dependent soil parameters.
 void SCMTerrain::RegisterSoilParametersCallback(std::shared_ptr<SoilParametersCallback> cb) {
     m_loader->m_soil_fun = cb;
@@ -241,6 +279,7 @@ void SCMTerrain::Initialize(const ChTriangleMeshConnected& trimesh, double delta
 
 // Get the heights of modified grid nodes.
 std::vector<SCMTerrain::NodeLevel> SCMTerrain::GetModifiedNodes(bool all_nodes) const {
+    auto lock = m_loader->LockQuery();
     return m_loader->GetModifiedNodes(all_nodes);
 }
 
@@ -399,6 +438,18 @@ SCMLoader::SCMLoader(ChSystem* system, bool visualization_mesh) : m_soil_fun(nul
 
     m_moving_patch = false;
 
+    m_paging = false;
+    m_paging_distance = 0;
+
+    m_coarsening = false;
+    m_coarsening_distance = 0;
+    m_coarsening_factor = 4;
+
+    m_grid_map.SetInitRecord([this](const ChVector2i& ij) {
+        double z = GetInitHeight(ij);
+        return NodeRecord(z, z, GetInitNormal(ij));
+    });
+
     m_cosim_mode = false;
 }
 
@@ -410,6 +461,7 @@ void SCMLoader::Initialize(double sizeX, double sizeY, double delta) {
     m_ny = static_cast<int>(std::ceil((sizeY / 2) / delta));  // number of divisions in Y direction
 
     m_delta = sizeX / (2 * m_nx);   // grid spacing
+    m_grid_map.Reset(m_nx, m_ny);
     m_area = std::pow(m_delta, 2);  // area of a cell
 
     // Return now if no visualization
@@ -446,6 +498,7 @@ void SCMLoader::Initialize(const std::string& heightmap_file,
     int nvx = 2 * m_nx + 1;                                   // number of grid vertices in X direction
     int nvy = 2 * m_ny + 1;                                   // number of grid vertices in Y direction
     m_delta = sizeX / (2.0 * m_nx);                           // grid spacing
+    m_grid_map.Reset(m_nx, m_ny);
     m_area = std::pow(m_delta, 2);                            // area of a cell
 
     double dx_grid = 0.5 / m_nx;
@@ -551,6 +604,7 @@ void SCMLoader::Initialize(const ChTriangleMeshConnected& trimesh, double delta)
     m_nx = static_cast<int>(std::ceil((sizeX / 2) / delta));  // half number of divisions in X direction
     m_ny = static_cast<int>(std::ceil((sizeY / 2) / delta));  // number of divisions in Y direction
     m_delta = sizeX / (2.0 * m_nx);                           // grid spacing
+    m_grid_map.Reset(m_nx, m_ny);
     m_area = std::pow(m_delta, 2);                            // area of a cell
     int nvx = 2 * m_nx + 1;                                   // number of grid vertices in X direction
     int nvy = 2 * m_ny + 1;                                   // number of grid vertices in Y direction
@@ -696,6 +750,35 @@ void SCMLoader::CreateVisualizationMesh(double sizeX, double sizeY) {
     }
 }
 
+size_t SCMLoader::GetMemoryUsage() const {
+    size_t mem = m_grid_map.GetMemoryUsage();
+    mem += m_heights.size() * sizeof(double);
+    mem += m_modified_nodes.capacity() * sizeof(ChVector2i);
+    mem += m_external_modified_vertices.capacity() * sizeof(int);
+
+    // Per-step buffers
+    for (const auto& p : m_patches)
+        mem += p.m_range.capacity() * sizeof(ChVector2i);
+    mem += m_rays.capacity() * sizeof(ChCollisionSystem::ChRay);
+    mem += m_ray_results.capacity() * sizeof(ChCollisionSystem::ChRayhitResult);
+    mem += m_ray_active.capacity() + m_ray_new_nodes.capacity();
+    mem += m_ray_vertices.capacity() * sizeof(int);
+    mem += m_ray_node_records.capacity() * sizeof(NodeRecord);
+
+    // Visualization mesh
+    if (m_trimesh_shape) {
+        const auto& trimesh = *m_trimesh_shape->GetMesh();
+        mem += trimesh.GetCoordsVertices().capacity() * sizeof(ChVector3d);
+        mem += trimesh.GetCoordsNormals().capacity() * sizeof(ChVector3d);
+        mem += trimesh.GetCoordsUV().capacity() * sizeof(ChVector2d);
+        mem += trimesh.GetCoordsColors().capacity() * sizeof(ChColor);
+        mem += trimesh.GetIndicesVertexes().capacity() * sizeof(ChVector3i);
+        mem += trimesh.GetIndicesNormals().capacity() * sizeof(ChVector3i);
+    }
+
+    return mem;
+}
+
 void SCMLoader::SetupInitial() {
     // If no user-specified moving patches, create one that will encompass all collision shapes in the system
     if (!m_moving_patch) {
@@ -705,10 +788,374 @@ void SCMLoader::SetupInitial() {
     }
 }
 
+// -----------------------------------------------------------------------------
+// Tiled storage of grid node records
+
+void SCMLoader::NodeGrid::Reset(int nx, int ny) {
+    Clear();
+    m_tx0 = TileCoord(-nx) - 1;
+    m_ty0 = TileCoord(-ny) - 1;
+    m_ntx = TileCoord(nx) + 1 - m_tx0 + 1;
+    m_nty = TileCoord(ny) + 1 - m_ty0 + 1;
+    m_tiles.resize((size_t)m_ntx * m_nty);
+}
+
+void SCMLoader::NodeGrid::Clear() {
+    for (auto& tile : m_tiles)
+        tile.reset();
+    m_outer_tiles.clear();
+    m_paged.clear();
+    m_coarse.clear();
+    m_num_nodes = 0;
+}
+
+std::unique_ptr<SCMLoader::NodeGrid::Tile>* SCMLoader::NodeGrid::GetSlot(const ChVector2i& t) const {
+    int tx = t.x() - m_tx0;
+    int ty = t.y() - m_ty0;
+    if (tx >= 0 && tx < m_ntx && ty >= 0 && ty < m_nty)
+        return &m_tiles[tx + (size_t)m_ntx * ty];
+    auto tile = m_outer_tiles.find(t);
+    return tile == m_outer_tiles.end() ? nullptr : &tile->second;
+}
+
+SCMLoader::NodeGrid::Tile* SCMLoader::NodeGrid::FindTile(const ChVector2i& ij) const {
+    ChVector2i t(TileCoord(ij.x()), TileCoord(ij.y()));
+    auto slot = GetSlot(t);
+    if (slot && *slot)
+        return slot->get();
+    return (m_paged.empty() && m_coarse.empty()) ? nullptr : LoadTile(t);
+}
+
+SCMLoader::NodeGrid::Tile& SCMLoader::NodeGrid::GetTile(const ChVector2i& ij) {
+    if (auto tile = FindTile(ij))
+        return *tile;
+    ChVector2i t(TileCoord(ij.x()), TileCoord(ij.y()));
+    auto slot = GetSlot(t);
+    auto& tile = slot ? *slot : m_outer_tiles[t];
+    tile = chrono_types::make_unique<Tile>(t);
+    return *tile;
+}
+
+SCMLoader::NodeRecord* SCMLoader::NodeGrid::Find(const ChVector2i& ij) {
+    auto tile = FindTile(ij);
+    if (!tile)
+        return nullptr;
+    int k = LocalIndex(ij);
+    return tile->used[k] ? &tile->nodes[k] : nullptr;
+}
+
+const SCMLoader::NodeRecord* SCMLoader::NodeGrid::Find(const ChVector2i& ij) const {
+    auto tile = FindTile(ij);
+    if (!tile)
+        return nullptr;
+    int k = LocalIndex(ij);
+    return tile->used[k] ? &tile->nodes[k] : nullptr;
+}
+
+SCMLoader::NodeRecord& SCMLoader::NodeGrid::At(const ChVector2i& ij) {
+    auto nr = Find(ij);
+    if (!nr)
+        throw std::out_of_range("SCMLoader: grid node not recorded");
+    return *nr;
+}
+
+const SCMLoader::NodeRecord& SCMLoader::NodeGrid::At(const ChVector2i& ij) const {
+    auto nr = Find(ij);
+    if (!nr)
+        throw std::out_of_range("SCMLoader: grid node not recorded");
+    return *nr;
+}
+
+SCMLoader::NodeRecord& SCMLoader::NodeGrid::Insert(const ChVector2i& ij, const NodeRecord& nr) {
+    auto& tile = GetTile(ij);
+    int k = LocalIndex(ij);
+    if (!tile.used[k]) {
+        tile.used[k] = true;
+        tile.nodes[k] = nr;
+        tile.num_used++;
+        m_num_nodes++;
+    }
+    return tile.nodes[k];
+}
+
+SCMLoader::NodeRecord& SCMLoader::NodeGrid::GetRecord(const ChVector2i& ij) {
+    return Insert(ij, NodeRecord());
+}
+
+bool SCMLoader::NodeGrid::Overlaps(const ChVector2i& t, const std::vector<std::pair<ChVector2i, ChVector2i>>& ranges) {
+    ChVector2i tmin(t.x() * TILE_SIZE, t.y() * TILE_SIZE);
+    ChVector2i tmax = tmin + ChVector2i(TILE_SIZE - 1, TILE_SIZE - 1);
+    for (const auto& r : ranges) {
+        if (tmax.x() >= r.first.x() && tmin.x() <= r.second.x() && tmax.y() >= r.first.y() && tmin.y() <= r.second.y())
+            return true;
+    }
+    return false;
+}
+
+void SCMLoader::NodeGrid::PageTiles(const std::vector<std::pair<ChVector2i, ChVector2i>>& ranges) {
+    auto overlaps = [&ranges](const ChVector2i& t) { return Overlaps(t, ranges); };
+
+    // Evict tiles away from all ranges
+    for (int ty = 0; ty < m_nty; ty++) {
+        for (int tx = 0; tx < m_ntx; tx++) {
+            auto& slot = m_tiles[tx + (size_t)m_ntx * ty];
+            ChVector2i t(m_tx0 + tx, m_ty0 + ty);
+            if (slot && !overlaps(t))
+                EvictTile(t, slot);
+        }
+    }
+    for (auto it = m_outer_tiles.begin(); it != m_outer_tiles.end();) {
+        if (!overlaps(it->first)) {
+            EvictTile(it->first, it->second);
+            it = m_outer_tiles.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // Evict coarse tiles away from all ranges (at full resolution, if written to disk)
+    for (auto it = m_coarse.begin(); it != m_coarse.end();) {
+        if (!overlaps(it->first)) {
+            if (!m_page_dir.empty()) {
+                auto slot = GetSlot(it->first);
+                auto& tile = slot ? *slot : m_outer_tiles[it->first];
+                tile = RefineTile(it->first, *it->second);
+                m_num_nodes += tile->num_used;
+                EvictTile(it->first, tile);
+                if (!slot)
+                    m_outer_tiles.erase(it->first);
+            }
+            it = m_coarse.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // Reload evicted tiles overlapping any range
+    std::vector<ChVector2i> reload;
+    for (const auto& t : m_paged) {
+        if (overlaps(t))
+            reload.push_back(t);
+    }
+    for (const auto& t : reload)
+        LoadTile(t);
+}
+
+void SCMLoader::NodeGrid::CoarsenTiles(const std::vector<std::pair<ChVector2i, ChVector2i>>& ranges, int factor) {
+    // Coarsen tiles away from all ranges
+    for (int ty = 0; ty < m_nty; ty++) {
+        for (int tx = 0; tx < m_ntx; tx++) {
+            auto& slot = m_tiles[tx + (size_t)m_ntx * ty];
+            ChVector2i t(m_tx0 + tx, m_ty0 + ty);
+            if (slot && !Overlaps(t, ranges))
+                CoarsenTile(t, slot, factor);
+        }
+    }
+    for (auto it = m_outer_tiles.begin(); it != m_outer_tiles.end();) {
+        if (!Overlaps(it->first, ranges)) {
+            CoarsenTile(it->first, it->second, factor);
+            it = m_outer_tiles.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // Refine coarse tiles overlapping any range
+    std::vector<ChVector2i> refine;
+    for (const auto& tile : m_coarse) {
+        if (Overlaps(tile.first, ranges))
+            refine.push_back(tile.first);
+    }
+    for (const auto& t : refine)
+        LoadTile(t);
+}
+
+void SCMLoader::NodeGrid::CoarsenTile(const ChVector2i& t, std::unique_ptr<Tile>& slot, int factor) {
+    auto coarse = chrono_types::make_unique<CoarseTile>(factor);
+    int nb = TILE_SIZE / factor;
+    double scale = 1.0 / (factor * factor);
+
+    for (int k = 0; k < TILE_SIZE * TILE_SIZE; k++) {
+        if (!slot->used[k])
+            continue;
+        const auto& nr = slot->nodes[k];
+        int b = (k % TILE_SIZE) / factor + nb * ((k / TILE_SIZE) / factor);
+        auto& block = coarse->blocks[b];
+        block.displacement += scale * (nr.level - nr.level_initial);
+        block.sinkage += scale * nr.sinkage;
+        block.sinkage_plastic += scale * nr.sinkage_plastic;
+        block.sigma_yield += scale * nr.sigma_yield;
+        coarse->used[b] = true;
+    }
+
+    m_num_nodes -= slot->num_used;
+    slot.reset();
+    m_coarse[t] = std::move(coarse);
+}
+
+std::unique_ptr<SCMLoader::NodeGrid::Tile> SCMLoader::NodeGrid::RefineTile(const ChVector2i& t,
+                                                                           const CoarseTile& coarse) const {
+    auto tile = chrono_types::make_unique<Tile>(t);
+    int factor = coarse.factor;
+    int nb = TILE_SIZE / factor;
+
+    // Interpolation stencil along one direction: node local index -> (first block, second block, weight)
+    // Block averages are associated with the block centers and extrapolated as constants beyond the outer centers.
+    struct Stencil {
+        int b0, b1;
+        double w;
+    };
+    std::vector<Stencil> stencil(TILE_SIZE);
+    for (int i = 0; i < TILE_SIZE; i++) {
+        double u = ChClamp((i + 0.5) / factor - 0.5, 0.0, nb - 1.0);
+        int b0 = std::min((int)u, nb - 1);
+        int b1 = std::min(b0 + 1, nb - 1);
+        stencil[i] = {b0, b1, u - b0};
+    }
+
+    for (int j = 0; j < TILE_SIZE; j++) {
+        const auto& sj = stencil[j];
+        for (int i = 0; i < TILE_SIZE; i++) {
+            const auto& si = stencil[i];
+            int b[4] = {si.b0 + nb * sj.b0, si.b1 + nb * sj.b0, si.b0 + nb * sj.b1, si.b1 + nb * sj.b1};
+            double w[4] = {(1 - si.w) * (1 - sj.w), si.w * (1 - sj.w), (1 - si.w) * sj.w, si.w * sj.w};
+
+            // Nodes not influenced by any block with recorded nodes remain undeformed
+            bool used = false;
+            for (int n = 0; n < 4; n++)
+                used |= (w[n] > 0 && coarse.used[b[n]]);
+            if (!used)
+                continue;
+
+            CoarseTile::Block avg = {0, 0, 0, 0};
+            for (int n = 0; n < 4; n++) {
+                const auto& block = coarse.blocks[b[n]];
+                avg.displacement += w[n] * block.displacement;
+                avg.sinkage += w[n] * block.sinkage;
+                avg.sinkage_plastic += w[n] * block.sinkage_plastic;
+                avg.sigma_yield += w[n] * block.sigma_yield;
+            }
+
+            int k = i + TILE_SIZE * j;
+            auto& nr = tile->nodes[k];
+            nr = m_init_record ? m_init_record(tile->origin + ChVector2i(i, j)) : NodeRecord();
+            nr.level = nr.level_initial + avg.displacement;
+            nr.sinkage = avg.sinkage;
+            nr.sinkage_plastic = avg.sinkage_plastic;
+            nr.sinkage_elastic = avg.sinkage - avg.sinkage_plastic;
+            nr.sigma_yield = avg.sigma_yield;
+            tile->used[k] = true;
+            tile->num_used++;
+        }
+    }
+
+    return tile;
+}
+
+int SCMLoader::NodeGrid::GetNumResidentTiles() const {
+    int num_tiles = (int)m_outer_tiles.size();
+    for (const auto& tile : m_tiles) {
+        if (tile)
+            num_tiles++;
+    }
+    return num_tiles;
+}
+
+size_t SCMLoader::NodeGrid::GetMemoryUsage() const {
+    // Flags are stored as bits; hash map nodes include the key, the value, and the chaining pointer
+    const size_t tile_size = sizeof(Tile) + TILE_SIZE * TILE_SIZE / 8;
+    size_t mem = m_tiles.capacity() * sizeof(std::unique_ptr<Tile>);
+    mem += GetNumResidentTiles() * tile_size;
+    mem += m_outer_tiles.bucket_count() * sizeof(void*) +
+           m_outer_tiles.size() * (sizeof(std::pair<ChVector2i, std::unique_ptr<Tile>>) + sizeof(void*));
+    mem += m_paged.bucket_count() * sizeof(void*) + m_paged.size() * (sizeof(ChVector2i) + sizeof(void*));
+    mem += m_coarse.bucket_count() * sizeof(void*);
+    for (const auto& tile : m_coarse) {
+        mem += sizeof(std::pair<ChVector2i, std::unique_ptr<CoarseTile>>) + sizeof(void*) + sizeof(CoarseTile);
+        mem += tile.second->blocks.capacity() * sizeof(CoarseTile::Block) + tile.second->used.capacity() / 8;
+    }
+    return mem;
+}
+
+std::string SCMLoader::NodeGrid::GetTileFilename(const ChVector2i& t) const {
+    return m_page_dir + "/tile_" + std::to_string(t.x()) + "_" + std::to_string(t.y()) + ".dat";
+}
+
+void SCMLoader::NodeGrid::EvictTile(const ChVector2i& t, std::unique_ptr<Tile>& slot) {
+    m_num_nodes -= slot->num_used;
+
+    // Write only the recorded nodes of the tile (local index and node record)
+    if (!m_page_dir.empty()) {
+        std::ofstream file(GetTileFilename(t), std::ios::binary);
+        file.write(reinterpret_cast<const char*>(&slot->num_used), sizeof(int));
+        for (int k = 0; k < TILE_SIZE * TILE_SIZE; k++) {
+            if (slot->used[k]) {
+                file.write(reinterpret_cast<const char*>(&k), sizeof(int));
+                file.write(reinterpret_cast<const char*>(&slot->nodes[k]), sizeof(NodeRecord));
+            }
+        }
+        if (file.good())
+            m_paged.insert(t);
+        else
+            std::cerr << "SCMTerrain: cannot write page file " << GetTileFilename(t) << std::endl;
+    }
+
+    slot.reset();
+}
+
+SCMLoader::NodeGrid::Tile* SCMLoader::NodeGrid::LoadTile(const ChVector2i& t) const {
+    auto slot = GetSlot(t);
+    assert(!slot || !*slot);
+
+    std::unique_ptr<Tile> tile;
+    auto coarse = m_coarse.find(t);
+    if (coarse != m_coarse.end()) {
+        tile = RefineTile(t, *coarse->second);
+        m_coarse.erase(coarse);
+    } else if (m_paged.find(t) != m_paged.end()) {
+        tile = ReadTile(t);
+        m_paged.erase(t);
+    } else {
+        return nullptr;
+    }
+
+    m_num_nodes += tile->num_used;
+    auto& new_slot = slot ? *slot : m_outer_tiles[t];
+    new_slot = std::move(tile);
+    return new_slot.get();
+}
+
+std::unique_ptr<SCMLoader::NodeGrid::Tile> SCMLoader::NodeGrid::ReadTile(const ChVector2i& t) const {
+    auto tile = chrono_types::make_unique<Tile>(t);
+    std::ifstream file(GetTileFilename(t), std::ios::binary);
+    int num_used = 0;
+    file.read(reinterpret_cast<char*>(&num_used), sizeof(int));
+    for (int n = 0; n < num_used && file.good(); n++) {
+        int k = 0;
+        file.read(reinterpret_cast<char*>(&k), sizeof(int));
+        if (k < 0 || k >= TILE_SIZE * TILE_SIZE)
+            break;
+        file.read(reinterpret_cast<char*>(&tile->nodes[k]), sizeof(NodeRecord));
+        tile->used[k] = true;
+        tile->num_used++;
+    }
+    if (!file.good() || tile->num_used != num_used)
+        std::cerr << "SCMTerrain: cannot read page file " << GetTileFilename(t) << std::endl;
+    return tile;
+}
+
+// -----------------------------------------------------------------------------
+
 bool SCMLoader::CheckMeshBounds(const ChVector2i& loc) const {
     return loc.x() >= -m_nx && loc.x() <= m_nx && loc.y() >= -m_ny && loc.y() <= m_ny;
 }
 
+std::unique_lock<std::mutex> SCMLoader::LockQuery() const {
+    if (m_paging || m_coarsening)
+        return std::unique_lock<std::mutex>(m_query_mutex);
+    return std::unique_lock<std::mutex>();
+}
+
 SCMTerrain::NodeInfo SCMLoader::GetNodeInfo(const ChVector3d& loc) const {
     SCMTerrain::NodeInfo ni;
 
@@ -720,16 +1167,15 @@ SCMTerrain::NodeInfo SCMLoader::GetNodeInfo(const ChVector3d& loc) const {
     int j = static_cast<int>(std::round(loc_loc.y() / m_delta));
     ChVector2i ij(i, j);
 
-    // First query the hash-map
-    auto p = m_grid_map.find(ij);
-    if (p != m_grid_map.end()) {
-        ni.sinkage = p->second.sinkage;
-        ni.sinkage_plastic = p->second.sinkage_plastic;
-        ni.sinkage_elastic = p->second.sinkage_elastic;
-        ni.sigma = p->second.sigma;
-        ni.sigma_yield = p->second.sigma_yield;
-        ni.kshear = p->second.kshear;
-        ni.tau = p->second.tau;
+    // First query the grid of modified nodes
+    if (auto nr = m_grid_map.Find(ij)) {
+        ni.sinkage = nr->sinkage;
+        ni.sinkage_plastic = nr->sinkage_plastic;
+        ni.sinkage_elastic = nr->sinkage_elastic;
+        ni.sigma = nr->sigma;
+        ni.sigma_yield = nr->sigma_yield;
+        ni.kshear = nr->kshear;
+        ni.tau = nr->tau;
         return ni;
     }
 
@@ -813,10 +1259,9 @@ ChVector3d SCMLoader::GetInitNormal(const ChVector2i& loc) const {
 
 // Get the terrain height (relative to the SCM plane) at the specified grid vertex.
 double SCMLoader::GetHeight(const ChVector2i& loc) const {
-    // First query the hash-map
-    auto p = m_grid_map.find(loc);
-    if (p != m_grid_map.end())
-        return p->second.level;
+    // First query the grid of modified nodes
+    if (auto nr = m_grid_map.Find(loc))
+        return nr->level;
 
     // Else return undeformed height
     return GetInitHeight(loc);
@@ -1031,9 +1476,9 @@ static const std::vector<ChVector2i> neighbors4{
     ChVector2i(0, 1)    // N
 };
 
-// Default implementation uses Map-Reduce for collecting ray intersection hits.
-// The alternative is to simultaenously load the global map of hits while ray casting (using a critical section).
-////#define RAY_CASTING_WITH_CRITICAL_SECTION
+// Default implementation casts all rays of a moving patch in a single batch into the collision system.
+// The alternative is to cast rays one at a time in a parallel loop, collecting hits in per-thread buffers.
+////#define RAY_CASTING_PER_RAY
 
 // Reset the list of forces, and fills it with forces from a soil contact model.
 void SCMLoader::ComputeInternalForces() {
@@ -1044,7 +1489,7 @@ void SCMLoader::ComputeInternalForces() {
     // Reset quantities at grid nodes modified over previous step
     // (required for bulldozing effects and for proper visualization coloring)
     for (const auto& ij : m_modified_nodes) {
-        auto& nr = m_grid_map.at(ij);
+        auto& nr = m_grid_map.At(ij);
         nr.sigma = 0;
         nr.sinkage_elastic = 0;
         nr.step_plastic_flow = 0;
@@ -1093,6 +1538,34 @@ void SCMLoader::ComputeInternalForces() {
         UpdateFixedPatch(m_patches[0]);
     }
 
+    // Coarsen and evict grid map tiles far from all patches (and restore those near patches, before any parallel
+    // access to the grid map)
+    if (m_coarsening || m_paging) {
+        // Node ranges of all patches, extended by the specified distance
+        auto patch_ranges = [this](double distance) {
+            int margin = static_cast<int>(std::ceil(distance / m_delta));
+            std::vector<std::pair<ChVector2i, ChVector2i>> ranges;
+            for (const auto& p : m_patches) {
+                if (p.m_range.empty())
+                    continue;
+                ChVector2i range_min = p.m_range[0];
+                ChVector2i range_max = p.m_range[0];
+                for (const auto& ij : p.m_range) {
+                    range_min = ChVector2i(std::min(range_min.x(), ij.x()), std::min(range_min.y(), ij.y()));
+                    range_max = ChVector2i(std::max(range_max.x(), ij.x()), std::max(range_max.y(), ij.y()));
+                }
+                ranges.push_back(
+                    std::make_pair(range_min - ChVector2i(margin, margin), range_max + ChVector2i(margin, margin)));
+            }
+            return ranges;
+        };
+
+        if (m_paging)
+            m_grid_map.PageTiles(patch_ranges(m_paging_distance));
+        if (m_coarsening)
+            m_grid_map.CoarsenTiles(patch_ranges(m_coarsening_distance), m_coarsening_factor);
+    }
+
     m_timer_moving_patches.stop();
 
     // -------------------------
@@ -1114,74 +1587,94 @@ void SCMLoader::ComputeInternalForces() {
 
     m_timer_ray_casting.start();
 
-#ifdef RAY_CASTING_WITH_CRITICAL_SECTION
+#ifdef RAY_CASTING_PER_RAY
 
     int nthreads = GetSystem()->GetNumThreadsChrono();
 
+    // Per-thread buffers of ray-cast hits, merged after the parallel loop
+    struct RayHit {
+        ChVector2i ij;        // grid node
+        HitRecord record;     // hit information
+        bool new_node;        // true if first hit from this grid node
+        NodeRecord node_rec;  // initial record for a new node
+    };
+    std::vector<std::vector<RayHit>> thread_hits(nthreads);
+
     // Loop through all moving patches (user-defined or default one)
     for (auto& p : m_patches) {
         // Loop through all vertices in the patch range
         int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
-            ChVector2i ij = p.m_range[k];
-
-            // Move from (i, j) to (x, y, z) representation in the world frame
-            double x = ij.x() * m_delta;
-            double y = ij.y() * m_delta;
-            double z;
-    #pragma omp critical(SCM_ray_casting)
-            z = GetHeight(ij);
-
-            ChVector3d vertex_abs = m_plane.TransformPointLocalToParent(ChVector3d(x, y, z));
-
-            // Create ray at current grid location
-            ChCollisionSystem::ChRayhitResult mrayhit_result;
-            ChVector3d to = vertex_abs + m_Z * m_test_offset_up;
-            ChVector3d from = to - m_Z * m_test_offset_down;
-
-            // Ray-OBB test (quick rejection)
-            if (m_moving_patch && !RayOBBtest(p, from, m_Z))
-                continue;
-
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
-
-            if (mrayhit_result.hit) {
-    #pragma omp critical(SCM_ray_casting)
-                {
-                    // If this is the first hit from this node, initialize the node record
-                    if (m_grid_map.find(ij) == m_grid_map.end()) {
-                        m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, GetInitNormal(ij))));
-                    }
+    #pragma omp parallel num_threads(nthreads) reduction(+ : num_ray_casts)
+        {
+            // Static schedule: the per-thread buffers, merged in thread order, hold the hits in vertex order
+            auto& buffer = thread_hits[ChOMP::GetThreadNum()];
+    #pragma omp for schedule(static)
+            for (int k = 0; k < p.m_range.size(); k++) {
+                ChVector2i ij = p.m_range[k];
+
+                // Move from (i, j) to (x, y, z) representation in the world frame
+                double x = ij.x() * m_delta;
+                double y = ij.y() * m_delta;
+                double z = GetHeight(ij);
+
+                ChVector3d vertex_abs = m_plane.TransformPointLocalToParent(ChVector3d(x, y, z));
+
+                // Create ray at current grid location
+                ChCollisionSystem::ChRayhitResult mrayhit_result;
+                ChVector3d to = vertex_abs + m_Z * m_test_offset_up;
+                ChVector3d from = to - m_Z * m_test_offset_down;
+
+                // Ray-OBB test (quick rejection)
+                if (m_moving_patch && !RayOBBtest(p, from, m_Z))
+                    continue;
 
-                    // Add to our map of hits to process
-                    HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                    hits.insert(std::make_pair(ij, record));
-                    m_num_ray_hits++;
+                // Cast ray into collision system
+                GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
+                num_ray_casts++;
+
+                if (mrayhit_result.hit) {
+                    // Record the hit (and the initial node record, if this is the first hit from this node)
+                    RayHit hit;
+                    hit.ij = ij;
+                    hit.record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
+                    hit.new_node = !m_grid_map.Find(ij);
+                    if (hit.new_node)
+                        hit.node_rec = NodeRecord(z, z, GetInitNormal(ij));
+                    buffer.push_back(hit);
                 }
             }
         }
         m_num_ray_casts += num_ray_casts;
+
+        // Merge the per-thread buffers into the grid map and the map of hits to process
+        for (auto& buffer : thread_hits) {
+            for (const auto& hit : buffer) {
+                if (hit.new_node)
+                    m_grid_map.Insert(hit.ij, hit.node_rec);
+                hits.insert(std::make_pair(hit.ij, hit.record));
+            }
+            buffer.clear();
+        }
+        m_num_ray_hits = (int)hits.size();
     }
 
 #else
 
-    // Map-reduce approach (to eliminate critical section)
+    // Batched approach (to eliminate per-ray dispatch into the collision system).
+    // Parallel loops are executed by the global task scheduler, using at most the number of Chrono threads.
 
     const int nthreads = GetSystem()->GetNumThreadsChrono();
-    std::vector<std::unordered_map<ChVector2i, HitRecord, CoordHash>> t_hits(nthreads);
+    auto& scheduler = ChTaskScheduler::GetGlobal();
 
     // Loop through all moving patches (user-defined or default one)
     for (auto& p : m_patches) {
         m_timer_ray_testing.start();
 
-        // Loop through all vertices in the patch range
-        int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
-            int t_num = ChOMP::GetThreadNum();
+        // Create rays at all vertices in the patch range
+        int num_vertices = (int)p.m_range.size();
+        m_rays.resize(num_vertices);
+        m_ray_active.resize(num_vertices);
+        scheduler.ParallelFor(0, num_vertices, [&](int k) {
             ChVector2i ij = p.m_range[k];
 
             // Move from (i, j) to (x, y, z) representation in the world frame
@@ -1192,42 +1685,58 @@ void SCMLoader::ComputeInternalForces() {
             ChVector3d vertex_abs = m_plane.TransformPointLocalToParent(ChVector3d(x, y, z));
 
             // Create ray at current grid location
-            ChCollisionSystem::ChRayhitResult mrayhit_result;
-            ChVector3d to = vertex_abs + m_Z * m_test_offset_up;
-            ChVector3d from = to - m_Z * m_test_offset_down;
+            m_rays[k].to = vertex_abs + m_Z * m_test_offset_up;
+            m_rays[k].from = m_rays[k].to - m_Z * m_test_offset_down;
 
             // Ray-OBB test (quick rejection)
-            if (m_moving_patch && !RayOBBtest(p, from, m_Z))
-                continue;
+            m_ray_active[k] = !m_moving_patch || RayOBBtest(p, m_rays[k].from, m_Z);
+        }, nthreads);
 
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
-
-            if (mrayhit_result.hit) {
-                // Add to our map of hits to process
-                HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                t_hits[t_num].insert(std::make_pair(ij, record));
+        // Compact the list of rays to cast
+        m_ray_vertices.clear();
+        int num_ray_casts = 0;
+        for (int k = 0; k < num_vertices; k++) {
+            if (m_ray_active[k]) {
+                m_rays[num_ray_casts++] = m_rays[k];
+                m_ray_vertices.push_back(k);
             }
         }
+        m_rays.resize(num_ray_casts);
+
+        // Cast rays into collision system
+        GetSystem()->GetCollisionSystem()->RayHitBatch(m_rays, m_ray_results);
 
         m_timer_ray_testing.stop();
 
         m_num_ray_casts += num_ray_casts;
 
-        // Sequential insertion in global hits
-        for (int t_num = 0; t_num < nthreads; t_num++) {
-            for (auto& h : t_hits[t_num]) {
-                // If this is the first hit from this node, initialize the node record
-                if (m_grid_map.find(h.first) == m_grid_map.end()) {
-                    double z = GetInitHeight(h.first);
-                    m_grid_map.insert(std::make_pair(h.first, NodeRecord(z, z, GetInitNormal(h.first))));
-                }
-                ////hits.insert(h);
+        // Initial records of nodes hit for the first time (evaluated in parallel, as the grid map is not modified)
+        m_ray_new_nodes.resize(num_ray_casts);
+        m_ray_node_records.resize(num_ray_casts);
+        scheduler.ParallelFor(0, num_ray_casts, [&](int r) {
+            ChVector2i ij = p.m_range[m_ray_vertices[r]];
+            m_ray_new_nodes[r] = m_ray_results[r].hit && !m_grid_map.Find(ij);
+            if (m_ray_new_nodes[r]) {
+                double z = GetInitHeight(ij);
+                m_ray_node_records[r] = NodeRecord(z, z, GetInitNormal(ij));
             }
+        }, nthreads);
+
+        // Sequential insertion in grid map and global hits
+        for (int r = 0; r < num_ray_casts; r++) {
+            const auto& result = m_ray_results[r];
+            if (!result.hit)
+                continue;
+
+            ChVector2i ij = p.m_range[m_ray_vertices[r]];
+
+            // If this is the first hit from this node, initialize the node record
+            if (m_ray_new_nodes[r])
+                m_grid_map.Insert(ij, m_ray_node_records[r]);
 
-            hits.insert(t_hits[t_num].begin(), t_hits[t_num].end());
-            t_hits[t_num].clear();
+            // Add to our map of hits to process
+            HitRecord record = {result.hitModel->GetContactable(), result.abs_hitPoint, -1};
+            hits.insert(std::make_pair(ij, record));
         }
         m_num_ray_hits = (int)hits.size();
     }
@@ -1321,41 +1830,69 @@ void SCMLoader::ComputeInternalForces() {
 
     m_timer_contact_forces.start();
 
-    // Initialize local values for the soil parameters
-    double Bekker_Kphi = m_Bekker_Kphi;
-    double Bekker_Kc = m_Bekker_Kc;
-    double Bekker_n = m_Bekker_n;
-    double Mohr_cohesion = m_Mohr_cohesion;
-    double Mohr_mu = m_Mohr_mu;
-    double Janosi_shear = m_Janosi_shear;
-    double elastic_K = m_elastic_K;
-    double damping_R = m_damping_R;
-
-    // Process only hit nodes
-    for (auto& h : hits) {
-        ChVector2d ij = h.first;
+    // Soil parameters at the hit nodes
+    struct SoilParameters {
+        double Bekker_Kphi;
+        double Bekker_Kc;
+        double Bekker_n;
+        double Mohr_cohesion;
+        double Mohr_mu;
+        double Janosi_shear;
+        double elastic_K;
+        double damping_R;
+    };
+    SoilParameters soil = {m_Bekker_Kphi, m_Bekker_Kc,    m_Bekker_n,  m_Mohr_cohesion,
+                           m_Mohr_mu,     m_Janosi_shear, m_elastic_K, m_damping_R};
+
+    // Contact force at a hit node
+    struct HitForce {
+        ChVector2i ij;         // grid node
+        const HitRecord* hit;  // ray-cast hit information
+        SoilParameters soil;   // soil parameters at hit point
+        bool contact;          // true if the node is in contact (positive pressure)
+        ChVector3d point_abs;  // point of application, expressed in global frame
+        ChVector3d force;      // contact force, expressed in global frame
+    };
+    std::vector<HitForce> hit_forces;
+    hit_forces.reserve(hits.size());
+    for (const auto& h : hits)
+        hit_forces.push_back({h.first, &h.second, soil, false, VNULL, VNULL});
+
+    // Evaluate the soil parameters callback sequentially (it is not required to be thread safe)
+    if (m_soil_fun) {
+        for (auto& hf : hit_forces) {
+            auto hit_point_loc = m_plane.TransformPointParentToLocal(hf.hit->abs_point);
+            double Mohr_friction;
+            m_soil_fun->Set(hit_point_loc, hf.soil.Bekker_Kphi, hf.soil.Bekker_Kc, hf.soil.Bekker_n,
+                            hf.soil.Mohr_cohesion, Mohr_friction, hf.soil.Janosi_shear, hf.soil.elastic_K,
+                            hf.soil.damping_R);
+            hf.soil.Mohr_mu = std::tan(Mohr_friction * CH_DEG_TO_RAD);
+        }
+    }
+
+    // Update the hit node records and calculate the contact forces (in parallel, each hit node is independent)
+    double step = GetSystem()->GetStep();
+    int num_hits = (int)hit_forces.size();
+    #pragma omp parallel for num_threads(nthreads)
+    for (int k = 0; k < num_hits; k++) {
+        auto& hf = hit_forces[k];
+        const auto& sp = hf.soil;
+        const auto& ij = hf.ij;
 
-        auto& nr = m_grid_map.at(ij);      // node record
+        auto& nr = m_grid_map.At(ij);      // node record
         const double& ca = nr.normal.z();  // cosine of angle between local normal and SCM plane vertical
 
-        ChContactable* contactable = h.second.contactable;
-        const ChVector3d& hit_point_abs = h.second.abs_point;
-        int patch_id = h.second.patch_id;
+        ChContactable* contactable = hf.hit->contactable;
+        const ChVector3d& hit_point_abs = hf.hit->abs_point;
+        int patch_id = hf.hit->patch_id;
 
         auto hit_point_loc = m_plane.TransformPointParentToLocal(hit_point_abs);
 
-        if (m_soil_fun) {
-            double Mohr_friction;
-            m_soil_fun->Set(hit_point_loc, Bekker_Kphi, Bekker_Kc, Bekker_n, Mohr_cohesion, Mohr_friction, Janosi_shear,
-                            elastic_K, damping_R);
-            Mohr_mu = std::tan(Mohr_friction * CH_DEG_TO_RAD);
-        }
-
         nr.hit_level = hit_point_loc.z();                              // along SCM z axis
         double p_hit_offset = ca * (nr.level_initial - nr.hit_level);  // along local normal direction
 
         // Elastic try (along local normal direction)
-        nr.sigma = elastic_K * (p_hit_offset - nr.sinkage_plastic);
+        nr.sigma = sp.elastic_K * (p_hit_offset - nr.sinkage_plastic);
 
         // Handle unilaterality
         if (nr.sigma < 0) {
@@ -1363,8 +1900,7 @@ void SCMLoader::ComputeInternalForces() {
             continue;
         }
 
-        // Mark current node as modified
-        m_modified_nodes.push_back(ij);
+        hf.contact = true;
 
         // Calculate velocity at touched grid node
         ChVector3d point_local(ij.x() * m_delta, ij.y() * m_delta, nr.level);
@@ -1382,16 +1918,16 @@ void SCMLoader::ComputeInternalForces() {
         nr.level = nr.hit_level;
 
         // Accumulate shear for Janosi-Hanamoto (along local tangent direction)
-        nr.kshear += Vdot(speed_abs, -T) * GetSystem()->GetStep();
+        nr.kshear += Vdot(speed_abs, -T) * step;
 
         // Plastic correction (along local normal direction)
         if (nr.sigma > nr.sigma_yield) {
             // Bekker formula
-            nr.sigma = (contact_patches[patch_id].oob * Bekker_Kc + Bekker_Kphi) * pow(nr.sinkage, Bekker_n);
+            nr.sigma = (contact_patches[patch_id].oob * sp.Bekker_Kc + sp.Bekker_Kphi) * pow(nr.sinkage, sp.Bekker_n);
             nr.sigma_yield = nr.sigma;
             double old_sinkage_plastic = nr.sinkage_plastic;
-            nr.sinkage_plastic = nr.sinkage - nr.sigma / elastic_K;
-            nr.step_plastic_flow = (nr.sinkage_plastic - old_sinkage_plastic) / GetSystem()->GetStep();
+            nr.sinkage_plastic = nr.sinkage - nr.sigma / sp.elastic_K;
+            nr.step_plastic_flow = (nr.sinkage_plastic - old_sinkage_plastic) / step;
         }
 
         // Elastic sinkage (along local normal direction)
@@ -1399,14 +1935,14 @@ void SCMLoader::ComputeInternalForces() {
 
         // Add compressive speed-proportional damping (not clamped by pressure yield)
         ////if (Vn < 0) {
-        nr.sigma += -Vn * damping_R;
+        nr.sigma += -Vn * sp.damping_R;
         ////}
 
         // Mohr-Coulomb
-        double tau_max = Mohr_cohesion + nr.sigma * Mohr_mu;
+        double tau_max = sp.Mohr_cohesion + nr.sigma * sp.Mohr_mu;
 
         // Janosi-Hanamoto (along local tangent direction)
-        nr.tau = tau_max * (1.0 - exp(-(nr.kshear / Janosi_shear)));
+        nr.tau = tau_max * (1.0 - exp(-(nr.kshear / sp.Janosi_shear)));
 
         // Calculate normal and tangential forces (in local node directions).
         // If specified, combine properties for soil-contactable interaction and soil-soil interaction.
@@ -1426,10 +1962,28 @@ void SCMLoader::ComputeInternalForces() {
             Ft = T * m_area * nr.tau;
         }
 
+        hf.point_abs = point_abs;
+        hf.force = Fn + Ft;
+
+        // Update grid node height (in local SCM frame, along SCM z axis)
+        nr.level = nr.level_initial - nr.sinkage / ca;
+    }
+
+    // Accumulate the contact forces on the contactable objects (sequentially, in hit order)
+    for (const auto& hf : hit_forces) {
+        if (!hf.contact)
+            continue;
+
+        // Mark current node as modified
+        m_modified_nodes.push_back(hf.ij);
+
+        ChContactable* contactable = hf.hit->contactable;
+        const ChVector3d& point_abs = hf.point_abs;
+        const ChVector3d& force = hf.force;
+
         if (ChBody* body = dynamic_cast<ChBody*>(contactable)) {
             // Accumulate resultant force and torque (expressed in global frame) for this rigid body.
             // The resultant force is assumed to be applied at the body COM.
-            ChVector3d force = Fn + Ft;
             ChVector3d moment = Vcross(point_abs - body->GetPos(), force);
 
             auto itr = m_body_forces.find(body);
@@ -1444,8 +1998,6 @@ void SCMLoader::ComputeInternalForces() {
             }
         } else if (fea::ChContactTriangleXYZ* tri = dynamic_cast<fea::ChContactTriangleXYZ*>(contactable)) {
             // Accumulate forces (expressed in global frame) for the nodes of this contact triangle.
-            ChVector3d force = Fn + Ft;
-
             double s[3];
             tri->ComputeUVfromP(point_abs, s[1], s[2]);
             s[0] = 1 - s[1] - s[2];
@@ -1467,7 +2019,7 @@ void SCMLoader::ComputeInternalForces() {
                 // [](){} Trick: no deletion for this shared ptr
                 std::shared_ptr<ChLoadableUV> ssurf(surf, [](ChLoadableUV*) {});
                 auto loader = chrono_types::make_shared<ChLoaderForceOnSurface>(ssurf);
-                loader->SetForce(Fn + Ft);
+                loader->SetForce(force);
                 loader->SetApplication(0.5, 0.5);  //// TODO set UV, now just in middle
                 auto load = chrono_types::make_shared<ChLoad>(loader);
                 this->Add(load);
@@ -1476,10 +2028,6 @@ void SCMLoader::ComputeInternalForces() {
             // Accumulate contact forces for this surface.
             //// TODO
         }
-
-        // Update grid node height (in local SCM frame, along SCM z axis)
-        nr.level = nr.level_initial - nr.sinkage / ca;
-
     }  // end loop on ray hits
 
     // Create loads for bodies and nodes to apply the accumulated terrain force/torque for each of them
@@ -1526,7 +2074,7 @@ void SCMLoader::ComputeInternalForces() {
             // Calculate the displaced material from all touched nodes and identify boundary
             double tot_step_flow = 0;
             for (const auto& ij : p.nodes) {                 // for each node in contact patch
-                const auto& nr = m_grid_map.at(ij);          //   get node record
+                const auto& nr = m_grid_map.At(ij);          //   get node record
                 if (nr.sigma <= 0)                           //   if node not touched
                     continue;                                //     skip (not in effective patch)
                 tot_step_flow += nr.step_plastic_flow;       //   accumulate displaced material
@@ -1534,9 +2082,10 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2i nbr_ij = ij + neighbors4[k];  //     neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                     //     if neighbor out of bounds
                     ////    continue;                                     //       skip neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end())  //     if neighbor not yet recorded
+                    auto nbr_nr = m_grid_map.Find(nbr_ij);            //     neighbor record
+                    if (!nbr_nr)                                      //     if neighbor not yet recorded
                         p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
-                    else if (m_grid_map.at(nbr_ij).sigma <= 0)        //     if neighbor not touched
+                    else if (nbr_nr->sigma <= 0)                      //     if neighbor not touched
                         p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
                 }
             }
@@ -1548,13 +2097,13 @@ void SCMLoader::ComputeInternalForces() {
             // Raise boundary (create a sharp spike which will be later smoothed out with erosion)
             for (const auto& ij : p_boundary) {                                  // for each node in bndry
                 m_modified_nodes.push_back(ij);                                  //   mark as modified
-                if (m_grid_map.find(ij) == m_grid_map.end()) {                   //   if not yet recorded
+                if (!m_grid_map.Find(ij)) {                                      //   if not yet recorded
                     double z = GetInitHeight(ij);                                //     undeformed height
                     const ChVector3d& n = GetInitNormal(ij);                     //     terrain normal
-                    m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, n)));  //     add new node record
+                    m_grid_map.Insert(ij, NodeRecord(z, z, n));                  //     add new node record
                     m_modified_nodes.push_back(ij);                              //     mark as modified
                 }                                                                //
-                auto& nr = m_grid_map.at(ij);                                    //   node record
+                auto& nr = m_grid_map.At(ij);                                    //   node record
                 nr.erosion = true;                                               //   add to erosion domain
                 AddMaterialToNode(diff, nr);                                     //   add raise amount
             }
@@ -1578,16 +2127,17 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2i nbr_ij = ij + neighbors4[k];  //   neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                       //   if out of bounds
                     ////    continue;                                       //     ignore neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end()) {  //   if neighbor not yet recorded
+                    auto rec = m_grid_map.Find(nbr_ij);                 //   neighbor record
+                    if (!rec) {                                         //   if neighbor not yet recorded
                         double z = GetInitHeight(nbr_ij);               //     undeformed height at neighbor location
                         const ChVector3d& n = GetInitNormal(nbr_ij);    //     terrain normal at neighbor location
                         NodeRecord nr(z, z, n);                         //     create new record
                         nr.erosion = true;                              //     include in erosion domain
-                        m_grid_map.insert(std::make_pair(nbr_ij, nr));  //     add new node record
+                        m_grid_map.Insert(nbr_ij, nr);                  //     add new node record
                         front.insert(nbr_ij);                           //     add neighbor to new front
                         m_modified_nodes.push_back(nbr_ij);             //     mark as modified
                     } else {                                            //   if neighbor previously recorded
-                        NodeRecord& nr = m_grid_map.at(nbr_ij);         //     get existing record
+                        NodeRecord& nr = *rec;                          //     get existing record
                         if (!nr.erosion && nr.sigma <= 0) {             //     if neighbor not touched
                             nr.erosion = true;                          //       include in erosion domain
                             front.insert(nbr_ij);                       //       add neighbor to new front
@@ -1608,13 +2158,13 @@ void SCMLoader::ComputeInternalForces() {
 
         for (int iter = 0; iter < m_erosion_iterations; iter++) {
             for (const auto& ij : erosion_domain) {
-                auto& nr = m_grid_map.at(ij);
+                auto& nr = m_grid_map.At(ij);
                 for (int k = 0; k < 4; k++) {
                     ChVector2i nbr_ij = ij + neighbors4[k];
-                    auto rec = m_grid_map.find(nbr_ij);
-                    if (rec == m_grid_map.end())
+                    auto rec = m_grid_map.Find(nbr_ij);
+                    if (!rec)
                         continue;
-                    auto& nbr_nr = rec->second;
+                    auto& nbr_nr = *rec;
 
                     // (3.1) Flow remaining material to neighbor
                     double diff = 0.5 * (nr.massremainder - nbr_nr.massremainder) / 4;  //// TODO: rethink this!
@@ -1659,7 +2209,7 @@ void SCMLoader::ComputeInternalForces() {
         for (const auto& ij : m_modified_nodes) {
             if (!CheckMeshBounds(ij))                 // if node outside mesh
                 continue;                             //   do nothing
-            const auto& nr = m_grid_map.at(ij);       // grid node record
+            const auto& nr = m_grid_map.At(ij);       // grid node record
             int iv = GetMeshVertexIndex(ij);          // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);  // update vertex coordinates and color
             modified_vertices.push_back(iv);          // cache in list of modified mesh vertices
@@ -1782,14 +2332,15 @@ void SCMLoader::UpdateMeshVertexNormal(const ChVector2i ij, int iv) {
 std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) const {
     std::vector<SCMTerrain::NodeLevel> nodes;
     if (all_nodes) {
-        for (const auto& nr : m_grid_map) {
-            nodes.push_back(std::make_pair(nr.first, nr.second.level));
-        }
+        nodes.reserve(m_grid_map.GetNumNodes());
+        m_grid_map.ForEach([&nodes](const ChVector2i& ij, const NodeRecord& nr) {
+            nodes.push_back(std::make_pair(ij, nr.level));
+        });
     } else {
         for (const auto& ij : m_modified_nodes) {
-            auto rec = m_grid_map.find(ij);
-            assert(rec != m_grid_map.end());
-            nodes.push_back(std::make_pair(ij, rec->second.level));
+            auto rec = m_grid_map.Find(ij);
+            assert(rec);
+            nodes.push_back(std::make_pair(ij, rec->level));
         }
     }
     return nodes;
@@ -1801,7 +2352,7 @@ std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) c
 void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes) {
     for (const auto& n : nodes) {
         // Modify existing entry in grid map or insert new one
-        m_grid_map[n.first] = SCMLoader::NodeRecord(n.second, n.second, GetInitNormal(n.first));
+        m_grid_map.Set(n.first, SCMLoader::NodeRecord(n.second, n.second, GetInitNormal(n.first)));
     }
 
     // Update visualization
@@ -1810,7 +2361,7 @@ void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes
             auto ij = n.first;                           // grid location
             if (!CheckMeshBounds(ij))                    // if outside mesh
                 continue;                                //   do nothing
-            const auto& nr = m_grid_map.at(ij);          // grid node record
+            const auto& nr = m_grid_map.At(ij);          // grid node record
             int iv = GetMeshVertexIndex(ij);             // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);     // update vertex coordinates and color
             if (!m_trimesh_shape->IsWireframe())         // if not in wireframe mode
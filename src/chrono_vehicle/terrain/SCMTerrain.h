@@ -20,9 +20,14 @@
 #ifndef SCM_TERRAIN_H
 #define SCM_TERRAIN_H
 
+#include <array>
+#include <functional>
+#include <memory>
 #include <string>
 #include <ostream>
+#include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "chrono/assets/ChVisualShapeTriangleMesh.h"
 #include "chrono/physics/ChBody.h"
@@ -217,6 +222,35 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     /// Save the visualization mesh as a Wavefront OBJ file.
     void WriteMesh(const std::string& filename) const;
 
+    /// Enable paging of the terrain state, to bound memory use on long routes (default: disabled).
+    /// The modified grid nodes are stored in square tiles. With paging enabled, tiles farther than the specified
+    /// distance from all moving patches are evicted from memory at each step. If a directory is specified, evicted
+    /// tiles are written in compact form to files in that directory and reloaded when the corresponding terrain region
+    /// is accessed again. Otherwise, evicted tiles are discarded and the terrain reverts to its undeformed state in
+    /// those regions (the visualization mesh is not reset). Tiles written to disk are still reported by
+    /// GetModifiedNodes(true). With paging or coarsening enabled, concurrent terrain queries (height, normal, node
+    /// information) are serialized, as they may reload tiles; they must not run concurrently with the system step.
+    void EnablePaging(double distance, const std::string& directory = "");
+
+    /// Get the number of terrain tiles in memory and evicted to disk, respectively.
+    std::pair<int, int> GetNumTiles() const;
+
+    /// Enable coarsening of the terrain state away from the moving patches (default: disabled).
+    /// Tiles farther than the specified distance from all moving patches are replaced, at each step, by averages of the
+    /// node deformation over blocks of factor x factor grid nodes (factor must be a power of 2, at most 64). When the
+    /// corresponding terrain region is accessed again, the grid node state is reconstructed at full resolution by
+    /// bilinear interpolation of the block averages, so that contact forces are always computed on the fine grid. Only
+    /// the displacement, sinkage, and yield stress are retained (approximately, as block averages); the shear history
+    /// is reset. If paging is also enabled, it should use a larger distance.
+    void EnableCoarsening(double distance, int factor = 4);
+
+    /// Get the number of coarse terrain tiles.
+    int GetNumCoarseTiles() const;
+
+    /// Return an estimate of the memory (in bytes) used by the terrain: grid of modified nodes (resident and coarse
+    /// tiles), base height map, per-step ray-casting buffers, and visualization mesh.
+    size_t GetMemoryUsage() const;
+
     /// Enable/disable co-simulation mode (default: false).
     /// In co-simulation mode, the underlying SCM loader does not apply loads to interacting objects.
     /// Instead, contact forces are accumulated and available for extraction using GetContactForceBody and
@@ -437,6 +471,179 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
         std::size_t operator()(const ChVector2i& p) const { return p.x() * 31 + p.y(); }
     };
 
+    // Sparse tiled storage of node records.
+    // Grid nodes are grouped in square tiles of TILE_SIZE x TILE_SIZE nodes, allocated when a node in the tile is first
+    // recorded, with indexed access to the nodes of a tile. Tiles within the grid range (plus a margin of one tile) are
+    // accessed through a dense tile index; tiles farther away (e.g., reached by bulldozing beyond the grid boundary)
+    // are kept in a hash map.
+    // Tiles can be evicted from memory (see PageTiles). If a page directory is set, evicted tiles are written to disk
+    // and transparently reloaded on access; otherwise, they are discarded.
+    // Tiles can also be coarsened (see CoarsenTiles), keeping only block averages of the node displacements and of the
+    // sinkage history variables. Coarse tiles are refined, by bilinear interpolation of the block averages, on access.
+    // Concurrency: lookups (Find, At) may run concurrently only if none of them restores a tile, as restoring modifies
+    // the tile index. Within an SCM step, PageTiles and CoarsenTiles restore all tiles overlapping the moving patches
+    // before the parallel stages, which only access nodes of the moving patches. Queries from outside the SCM step,
+    // which may restore any tile, are serialized by the SCM loader (see SCMLoader::LockQuery).
+    class NodeGrid {
+      public:
+        NodeGrid() : m_tx0(0), m_ty0(0), m_ntx(0), m_nty(0), m_num_nodes(0) {}
+
+        // Set the grid range to [-nx, +nx] x [-ny, +ny] and remove all node records.
+        void Reset(int nx, int ny);
+
+        // Remove all node records.
+        void Clear();
+
+        // Get the record of the specified node (nullptr if not recorded).
+        NodeRecord* Find(const ChVector2i& ij);
+        const NodeRecord* Find(const ChVector2i& ij) const;
+
+        // Get the record of the specified node, which must exist.
+        NodeRecord& At(const ChVector2i& ij);
+        const NodeRecord& At(const ChVector2i& ij) const;
+
+        // Add a record for the specified node, if not already recorded, and return the node record.
+        NodeRecord& Insert(const ChVector2i& ij, const NodeRecord& nr);
+
+        // Set the record of the specified node, adding it if not already recorded.
+        void Set(const ChVector2i& ij, const NodeRecord& nr) { GetRecord(ij) = nr; }
+
+        // Get the number of recorded nodes (in tiles currently in memory).
+        size_t GetNumNodes() const { return m_num_nodes; }
+
+        // Set the directory for evicted tiles (if empty, evicted tiles are discarded).
+        void SetPageDirectory(const std::string& dir) { m_page_dir = dir; }
+
+        // Evict all tiles which do not overlap any of the given node ranges, and reload evicted tiles which do.
+        // Each range is specified by its minimum and maximum grid node coordinates.
+        void PageTiles(const std::vector<std::pair<ChVector2i, ChVector2i>>& ranges);
+
+        // Get the number of tiles in memory.
+        int GetNumResidentTiles() const;
+
+        // Get the number of tiles evicted to disk.
+        int GetNumPagedTiles() const { return (int)m_paged.size(); }
+
+        // Get an estimate of the memory used by the tiles in memory (resident and coarse) and the tile index.
+        size_t GetMemoryUsage() const;
+
+        // Set the function providing the record of an undeformed node (used when refining coarse tiles).
+        void SetInitRecord(std::function<NodeRecord(const ChVector2i&)> init) { m_init_record = init; }
+
+        // Coarsen all tiles which do not overlap any of the given node ranges, and refine coarse tiles which do.
+        // The coarsening factor (a power of 2, at most TILE_SIZE) is the size of the node blocks which are averaged.
+        void CoarsenTiles(const std::vector<std::pair<ChVector2i, ChVector2i>>& ranges, int factor);
+
+        // Get the number of coarse tiles.
+        int GetNumCoarseTiles() const { return (int)m_coarse.size(); }
+
+        // Invoke the given function f(ij, nr) for all recorded nodes, one tile at a time (evicted tiles are read from
+        // disk and coarse tiles are refined, but they are not made resident).
+        template <typename F>
+        void ForEach(F f) const {
+            for (const auto& tile : m_tiles)
+                if (tile)
+                    tile->ForEach(f);
+            for (const auto& tile : m_outer_tiles)
+                tile.second->ForEach(f);
+            for (const auto& t : m_paged)
+                ReadTile(t)->ForEach(f);
+            for (const auto& tile : m_coarse)
+                RefineTile(tile.first, *tile.second)->ForEach(f);
+        }
+
+      private:
+        static const int TILE_BITS = 6;
+        static const int TILE_SIZE = 1 << TILE_BITS;
+
+        struct Tile {
+            Tile(const ChVector2i& t)
+                : origin(t.x() * TILE_SIZE, t.y() * TILE_SIZE), used(TILE_SIZE * TILE_SIZE), num_used(0) {}
+
+            template <typename F>
+            void ForEach(F f) const {
+                for (int k = 0; k < TILE_SIZE * TILE_SIZE; k++)
+                    if (used[k])
+                        f(origin + ChVector2i(k % TILE_SIZE, k / TILE_SIZE), nodes[k]);
+            }
+
+            ChVector2i origin;                                    // grid coordinates of the first tile node
+            std::array<NodeRecord, TILE_SIZE * TILE_SIZE> nodes;  // node records
+            std::vector<bool> used;                               // flags for recorded nodes
+            int num_used;                                         // number of recorded nodes
+        };
+
+        // Block averages of the node state of a coarsened tile (unrecorded nodes count as undeformed).
+        struct CoarseTile {
+            struct Block {
+                double displacement;     // level change from the initial level
+                double sinkage;          // along local normal direction
+                double sinkage_plastic;  // along local normal direction
+                double sigma_yield;      // along local normal direction
+            };
+
+            CoarseTile(int factor)
+                : factor(factor),
+                  blocks((TILE_SIZE / factor) * (TILE_SIZE / factor)),
+                  used((TILE_SIZE / factor) * (TILE_SIZE / factor)) {}
+
+            int factor;                 // size of the node blocks
+            std::vector<Block> blocks;  // block averages
+            std::vector<bool> used;     // flags for blocks with recorded nodes
+        };
+
+        // Check if the specified tile overlaps any of the given node ranges.
+        static bool Overlaps(const ChVector2i& t, const std::vector<std::pair<ChVector2i, ChVector2i>>& ranges);
+
+        // Get the slot of the specified tile (nullptr if outside the dense index and not in the hash map).
+        std::unique_ptr<Tile>* GetSlot(const ChVector2i& t) const;
+
+        // Get the tile containing the specified node (nullptr if not allocated).
+        Tile* FindTile(const ChVector2i& ij) const;
+
+        // Get the tile containing the specified node, allocating it if necessary.
+        Tile& GetTile(const ChVector2i& ij);
+
+        // Get the record of the specified node, adding a default one if not already recorded.
+        NodeRecord& GetRecord(const ChVector2i& ij);
+
+        // Evict the tile in the given slot.
+        void EvictTile(const ChVector2i& t, std::unique_ptr<Tile>& slot);
+
+        // Reload the specified evicted or coarse tile (nullptr if neither evicted nor coarsened).
+        // Not thread-safe: must not run concurrently with any other access to the grid.
+        Tile* LoadTile(const ChVector2i& t) const;
+
+        // Replace the tile in the given slot with its coarse version.
+        void CoarsenTile(const ChVector2i& t, std::unique_ptr<Tile>& slot, int factor);
+
+        // Reconstruct the specified tile from its coarse version.
+        std::unique_ptr<Tile> RefineTile(const ChVector2i& t, const CoarseTile& coarse) const;
+
+        // Read the specified evicted tile from its file.
+        std::unique_ptr<Tile> ReadTile(const ChVector2i& t) const;
+
+        // Name of the file for the specified evicted tile.
+        std::string GetTileFilename(const ChVector2i& t) const;
+
+        static int TileCoord(int i) { return i >> TILE_BITS; }
+        static int LocalIndex(const ChVector2i& ij) {
+            return (ij.x() & (TILE_SIZE - 1)) + TILE_SIZE * (ij.y() & (TILE_SIZE - 1));
+        }
+
+        int m_tx0, m_ty0;  // first tile in dense index
+        int m_ntx, m_nty;  // dense index dimensions
+
+        // Tile storage (mutable, as evicted and coarse tiles are restored on access)
+        mutable std::vector<std::unique_ptr<Tile>> m_tiles;                                       // tiles in range
+        mutable std::unordered_map<ChVector2i, std::unique_ptr<Tile>, CoordHash> m_outer_tiles;   // tiles outside
+        mutable std::unordered_set<ChVector2i, CoordHash> m_paged;                                // evicted to disk
+        mutable std::unordered_map<ChVector2i, std::unique_ptr<CoarseTile>, CoordHash> m_coarse;  // coarse tiles
+        mutable size_t m_num_nodes;                                                               // number of records
+        std::string m_page_dir;                                                                   // page directory
+        std::function<NodeRecord(const ChVector2i&)> m_init_record;                               // undeformed node
+    };
+
     // Create visualization mesh
     void CreateVisualizationMesh(double sizeX, double sizeY);
 
@@ -476,9 +683,17 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     // Return information at node closest to specified location.
     SCMTerrain::NodeInfo GetNodeInfo(const ChVector3d& loc) const;
 
+    // Lock the grid map for a query from outside the SCM step, if such a query may restore evicted or coarse tiles.
+    // This serializes concurrent queries (e.g., from tires processed in parallel) with paging or coarsening enabled.
+    // Queries must not run concurrently with the SCM step itself.
+    std::unique_lock<std::mutex> LockQuery() const;
+
     // Complete setup before first simulation step.
     virtual void SetupInitial() override;
 
+    // Estimate of the memory used by the terrain data (see SCMTerrain::GetMemoryUsage).
+    virtual size_t GetMemoryUsage() const override;
+
     // Update the forces and the geometry, at the beginning of each timestep.
     virtual void Setup() override {
         ComputeInternalForces();
@@ -546,8 +761,14 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     ChMatrixDynamic<> m_heights;  ///< (base) grid heights (when initializing from height-field map)
     double m_base_height;         ///< default height for vertices outside the projection of input mesh
 
-    std::unordered_map<ChVector2i, NodeRecord, CoordHash> m_grid_map;  ///< modified grid nodes (persistent)
-    std::vector<ChVector2i> m_modified_nodes;                          ///< modified grid nodes (current)
+    NodeGrid m_grid_map;                       ///< modified grid nodes (persistent)
+    std::vector<ChVector2i> m_modified_nodes;  ///< modified grid nodes (current)
+    bool m_paging;                             ///< evict tiles of the grid map far from moving patches?
+    double m_paging_distance;                  ///< minimum distance from moving patches for evicting tiles
+    bool m_coarsening;                         ///< coarsen tiles of the grid map far from moving patches?
+    double m_coarsening_distance;              ///< minimum distance from moving patches for coarsening tiles
+    int m_coarsening_factor;                   ///< size of averaged node blocks in coarse tiles
+    mutable std::mutex m_query_mutex;          ///< guard for queries which may restore grid map tiles
 
     std::vector<MovingPatchInfo> m_patches;  ///< set of active moving patches
     bool m_moving_patch;                     ///< user-specified moving patches?
@@ -555,6 +776,13 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     double m_test_offset_down;  ///< offset for ray start
     double m_test_offset_up;    ///< offset for ray end
 
+    std::vector<ChCollisionSystem::ChRay> m_rays;                  ///< rays cast at current step (per patch)
+    std::vector<ChCollisionSystem::ChRayhitResult> m_ray_results;  ///< results of ray casts (per patch)
+    std::vector<char> m_ray_active;                                ///< patch vertices passing the ray-OBB test
+    std::vector<int> m_ray_vertices;                               ///< patch vertex index for each ray cast
+    std::vector<char> m_ray_new_nodes;                             ///< rays hitting a node for the first time
+    std::vector<NodeRecord> m_ray_node_records;                    ///< initial records of newly hit nodes
+
     std::shared_ptr<ChVisualShapeTriangleMesh> m_trimesh_shape;  ///< mesh visualization asset
 
     bool m_cosim_mode;  ///< co-simulation mode
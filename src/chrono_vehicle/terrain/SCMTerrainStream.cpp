@@ -0,0 +1,233 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Compact encoding of SCM terrain changes, for synchronization and checkpointing.
+//
+// Stream layout (all integers are LEB128 variable-length, signed ones zigzag-encoded):
+//   "SCMT", version byte, resolution (8 bytes, IEEE double, little endian)
+//   number of tiles
+//   for each tile: tile x, tile y (signed), revision, number of nodes
+//     for each node (in increasing order of local index): local index increment, level increment (signed)
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#include "chrono_vehicle/terrain/SCMTerrainStream.h"
+
+namespace chrono {
+namespace vehicle {
+
+static const char stream_tag[4] = {'S', 'C', 'M', 'T'};
+static const uint8_t stream_version = 1;
+
+static void WriteVarint(std::vector<uint8_t>& buf, uint64_t value) {
+    while (value >= 0x80) {
+        buf.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    buf.push_back(static_cast<uint8_t>(value));
+}
+
+static void WriteSigned(std::vector<uint8_t>& buf, int64_t value) {
+    WriteVarint(buf, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+// Sequential reader of a stream, throwing an exception on truncated or malformed data
+class StreamReader {
+  public:
+    StreamReader(const uint8_t* data, size_t size) : m_data(data), m_size(size), m_pos(0) {}
+
+    uint8_t Byte() {
+        if (m_pos >= m_size)
+            throw std::runtime_error("SCMTerrainStream: truncated stream");
+        return m_data[m_pos++];
+    }
+
+    uint64_t Varint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t b = Byte();
+            value |= static_cast<uint64_t>(b & 0x7F) << shift;
+            if (!(b & 0x80))
+                return value;
+        }
+        throw std::runtime_error("SCMTerrainStream: invalid integer in stream");
+    }
+
+    int64_t Signed() {
+        uint64_t value = Varint();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+  private:
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_pos;
+};
+
+// -----------------------------------------------------------------------------
+
+SCMTerrainStream::SCMTerrainStream(double resolution) : m_resolution(resolution) {}
+
+std::vector<uint8_t> SCMTerrainStream::Encode(const std::vector<SCMTerrain::NodeLevel>& nodes) {
+    // Quantized node levels, keyed by tile and local index within the tile
+    struct Node {
+        ChVector2i tile;
+        int k;
+        int64_t q;
+    };
+    std::vector<Node> list;
+    list.reserve(nodes.size());
+    for (const auto& n : nodes) {
+        ChVector2i tile(n.first.x() >> TILE_BITS, n.first.y() >> TILE_BITS);
+        int k = (n.first.x() & (TILE_SIZE - 1)) + TILE_SIZE * (n.first.y() & (TILE_SIZE - 1));
+        list.push_back({tile, k, std::llround(n.second / m_resolution)});
+    }
+
+    // Sort by tile and local index, keeping the last occurrence of each node
+    std::stable_sort(list.begin(), list.end(), [](const Node& a, const Node& b) {
+        if (a.tile.x() != b.tile.x())
+            return a.tile.x() < b.tile.x();
+        if (a.tile.y() != b.tile.y())
+            return a.tile.y() < b.tile.y();
+        return a.k < b.k;
+    });
+    size_t num_nodes = 0;
+    for (size_t i = 0; i < list.size(); i++) {
+        if (i + 1 < list.size() && list[i + 1].tile == list[i].tile && list[i + 1].k == list[i].k)
+            continue;
+        list[num_nodes++] = list[i];
+    }
+    list.resize(num_nodes);
+
+    std::vector<uint8_t> buf;
+    buf.reserve(16 + 3 * num_nodes);
+    buf.insert(buf.end(), stream_tag, stream_tag + 4);
+    buf.push_back(stream_version);
+    uint64_t bits;
+    std::memcpy(&bits, &m_resolution, sizeof(bits));
+    for (int i = 0; i < 8; i++)
+        buf.push_back(static_cast<uint8_t>(bits >> (8 * i)));
+
+    size_t num_tiles = 0;
+    for (size_t i = 0; i < num_nodes; i++) {
+        if (i == 0 || !(list[i].tile == list[i - 1].tile))
+            num_tiles++;
+    }
+    WriteVarint(buf, num_tiles);
+
+    for (size_t start = 0; start < num_nodes;) {
+        size_t end = start;
+        while (end < num_nodes && list[end].tile == list[start].tile)
+            end++;
+
+        const auto& tile = list[start].tile;
+        WriteSigned(buf, tile.x());
+        WriteSigned(buf, tile.y());
+        WriteVarint(buf, ++m_revisions[tile]);
+        WriteVarint(buf, end - start);
+
+        int k_prev = -1;
+        int64_t q_prev = 0;
+        for (size_t i = start; i < end; i++) {
+            WriteVarint(buf, list[i].k - k_prev - 1);
+            WriteSigned(buf, list[i].q - q_prev);
+            k_prev = list[i].k;
+            q_prev = list[i].q;
+        }
+
+        start = end;
+    }
+
+    return buf;
+}
+
+std::vector<SCMTerrain::NodeLevel> SCMTerrainStream::Decode(const uint8_t* data, size_t size) {
+    StreamReader reader(data, size);
+    for (int i = 0; i < 4; i++) {
+        if (reader.Byte() != static_cast<uint8_t>(stream_tag[i]))
+            throw std::runtime_error("SCMTerrainStream: not an SCM terrain stream");
+    }
+    if (reader.Byte() != stream_version)
+        throw std::runtime_error("SCMTerrainStream: unsupported stream version");
+    uint64_t bits = 0;
+    for (int i = 0; i < 8; i++)
+        bits |= static_cast<uint64_t>(reader.Byte()) << (8 * i);
+    double resolution;
+    std::memcpy(&resolution, &bits, sizeof(resolution));
+
+    std::vector<SCMTerrain::NodeLevel> nodes;
+    uint64_t num_tiles = reader.Varint();
+    for (uint64_t it = 0; it < num_tiles; it++) {
+        int tx = (int)reader.Signed();
+        int ty = (int)reader.Signed();
+        ChVector2i tile(tx, ty);
+        uint32_t revision = (uint32_t)reader.Varint();
+        uint64_t num_nodes = reader.Varint();
+
+        // Skip tiles older than the last decoded revision (but still parse them)
+        auto& last_revision = m_revisions[tile];
+        bool skip = revision <= last_revision;
+        if (!skip)
+            last_revision = revision;
+
+        int64_t k = -1;
+        int64_t q = 0;
+        for (uint64_t in = 0; in < num_nodes; in++) {
+            k += (int64_t)reader.Varint() + 1;
+            q += reader.Signed();
+            if (k >= TILE_SIZE * TILE_SIZE)
+                throw std::runtime_error("SCMTerrainStream: invalid node index in stream");
+            if (skip)
+                continue;
+            ChVector2i ij(tile.x() * TILE_SIZE + (int)(k % TILE_SIZE), tile.y() * TILE_SIZE + (int)(k / TILE_SIZE));
+            nodes.push_back(std::make_pair(ij, q * resolution));
+        }
+    }
+
+    return nodes;
+}
+
+uint32_t SCMTerrainStream::GetRevision(const ChVector2i& ij) const {
+    auto revision = m_revisions.find(ChVector2i(ij.x() >> TILE_BITS, ij.y() >> TILE_BITS));
+    return revision == m_revisions.end() ? 0 : revision->second;
+}
+
+void SCMTerrainStream::WriteCheckpoint(const SCMTerrain& terrain, const std::string& filename) {
+    auto buf = Encode(terrain.GetModifiedNodes(true));
+    std::ofstream file(filename, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(buf.data()), buf.size());
+    if (!file.good())
+        throw std::runtime_error("SCMTerrainStream: cannot write checkpoint file " + filename);
+}
+
+void SCMTerrainStream::ReadCheckpoint(SCMTerrain& terrain, const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.good())
+        throw std::runtime_error("SCMTerrainStream: cannot read checkpoint file " + filename);
+    std::vector<uint8_t> buf((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    // A checkpoint restores the complete state, regardless of previously decoded revisions
+    Reset();
+    terrain.SetModifiedNodes(Decode(buf));
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,95 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Compact encoding of SCM terrain changes, for synchronization and checkpointing
+//
+// =============================================================================
+
+#ifndef SCM_TERRAIN_STREAM_H
+#define SCM_TERRAIN_STREAM_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/terrain/SCMTerrain.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_terrain
+/// @{
+
+/// Compact encoding of SCM terrain changes (lists of grid node levels, see SCMTerrain::GetModifiedNodes).
+/// Node levels are quantized with a given resolution and grouped in tiles of 64 x 64 grid nodes. Within a tile, nodes
+/// are sorted and both the node indices and the quantized levels are delta-encoded and written as variable-length
+/// integers, which typically brings the cost of a node from 16 bytes to 2-4 bytes.
+///
+/// Each encoded tile carries a revision number, incremented every time the tile is encoded by this object. When
+/// decoding, tiles with a revision not newer than the last decoded revision of the same tile are skipped, so that
+/// duplicated or out-of-order change lists from one source do not overwrite newer terrain state. A separate object
+/// must therefore be used for each source of terrain changes.
+class CH_VEHICLE_API SCMTerrainStream {
+  public:
+    /// Construct a terrain stream encoder/decoder with the given level resolution.
+    SCMTerrainStream(double resolution = 1e-6);
+
+    /// Set the resolution of encoded node levels (default: 1e-6).
+    void SetResolution(double resolution) { m_resolution = resolution; }
+
+    /// Encode the given list of node levels (if a node appears multiple times, the last level is encoded).
+    std::vector<uint8_t> Encode(const std::vector<SCMTerrain::NodeLevel>& nodes);
+
+    /// Decode the given stream and return the list of node levels in tiles newer than the last decoded ones.
+    /// An exception is thrown if the stream is not valid.
+    std::vector<SCMTerrain::NodeLevel> Decode(const uint8_t* data, size_t size);
+
+    /// Decode the given stream and return the list of node levels in tiles newer than the last decoded ones.
+    std::vector<SCMTerrain::NodeLevel> Decode(const std::vector<uint8_t>& data) {
+        return Decode(data.data(), data.size());
+    }
+
+    /// Get the last encoded or decoded revision of the tile containing the specified grid node (0 if none).
+    uint32_t GetRevision(const ChVector2i& ij) const;
+
+    /// Reset all tile revisions.
+    void Reset() { m_revisions.clear(); }
+
+    /// Write the levels of all modified nodes of the given terrain to the specified file.
+    /// Only node levels are saved; the sinkage history of the terrain nodes is not.
+    void WriteCheckpoint(const SCMTerrain& terrain, const std::string& filename);
+
+    /// Restore the node levels of the given terrain from the specified checkpoint file.
+    void ReadCheckpoint(SCMTerrain& terrain, const std::string& filename);
+
+  private:
+    static const int TILE_BITS = 6;
+    static const int TILE_SIZE = 1 << TILE_BITS;
+
+    struct CoordHash {
+        std::size_t operator()(const ChVector2i& p) const { return p.x() * 31 + p.y(); }
+    };
+
+    double m_resolution;                                              ///< level quantization step
+    std::unordered_map<ChVector2i, uint32_t, CoordHash> m_revisions;  ///< revisions of encoded/decoded tiles
+};
+
+/// @} vehicle_terrain
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
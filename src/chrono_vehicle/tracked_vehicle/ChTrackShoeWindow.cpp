@@ -0,0 +1,96 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Window of track shoes within reach of a track wheel (sprocket, idler, etc.)
+//
+// =============================================================================
+
+#include "chrono_vehicle/tracked_vehicle/ChTrackShoeWindow.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChTrackShoeWindow::ChTrackShoeWindow(int rescan_interval)
+    : m_rescan_interval(rescan_interval), m_num_updates(0), m_num_shoes(0), m_first(0), m_count(0) {}
+
+void ChTrackShoeWindow::Update(size_t num_shoes, const std::function<bool(size_t)>& in_reach) {
+    if (num_shoes != m_num_shoes || m_count == 0 || ++m_num_updates >= m_rescan_interval) {
+        m_num_shoes = num_shoes;
+        Rescan(in_reach);
+        return;
+    }
+
+    size_t n = m_num_shoes;
+
+    // Trim shoes no longer within reach at both ends of the window
+    while (m_count > 0 && !in_reach(m_first)) {
+        m_first = (m_first + 1) % n;
+        m_count--;
+    }
+    while (m_count > 0 && !in_reach((m_first + m_count - 1) % n))
+        m_count--;
+
+    if (m_count == 0) {
+        Rescan(in_reach);
+        return;
+    }
+
+    // Extend the window with adjacent shoes within reach
+    while (m_count < n && in_reach((m_first + n - 1) % n)) {
+        m_first = (m_first + n - 1) % n;
+        m_count++;
+    }
+    while (m_count < n && in_reach((m_first + m_count) % n))
+        m_count++;
+}
+
+void ChTrackShoeWindow::Rescan(const std::function<bool(size_t)>& in_reach) {
+    size_t n = m_num_shoes;
+
+    m_num_updates = 0;
+    m_first = 0;
+    m_count = 0;
+
+    m_in.resize(n);
+    size_t start = n;
+    for (size_t is = 0; is < n; is++) {
+        m_in[is] = in_reach(is);
+        if (m_in[is] && start == n)
+            start = is;
+    }
+
+    // No shoe within reach
+    if (start == n)
+        return;
+
+    // The window is the complement of the longest (cyclic) run of shoes not within reach
+    size_t gap = 0;
+    size_t run = 0;
+    for (size_t k = 1; k <= n; k++) {
+        size_t is = (start + k) % n;
+        if (!m_in[is]) {
+            run++;
+            continue;
+        }
+        if (run > gap) {
+            gap = run;
+            m_first = is;
+        }
+        run = 0;
+    }
+    m_count = n - gap;
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
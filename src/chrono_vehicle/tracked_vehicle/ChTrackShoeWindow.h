@@ -0,0 +1,74 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Window of track shoes within reach of a track wheel (sprocket, idler, etc.)
+//
+// =============================================================================
+
+#ifndef CH_TRACK_SHOE_WINDOW_H
+#define CH_TRACK_SHOE_WINDOW_H
+
+#include <functional>
+#include <vector>
+
+#include "chrono_vehicle/ChApiVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_tracked
+/// @{
+
+/// Window of track shoes within reach of a track wheel.
+/// Track shoes are ordered along the chain, so that the shoes within reach of a wheel wrapped by the track form a
+/// contiguous (cyclic) range of shoe indices, which moves by at most a few shoes from one step to the next. The
+/// window is updated starting from the range found at the previous update, by trimming shoes which are no longer
+/// within reach at either end and adding adjacent shoes which came within reach. All shoes are tested only when the
+/// window is empty, when the number of shoes changes, and periodically (to catch shoes reaching the wheel from a
+/// different part of the chain). The window may include shoes which are not within reach (in its interior).
+class CH_VEHICLE_API ChTrackShoeWindow {
+  public:
+    /// Construct a shoe window, with a full scan of all shoes every 'rescan_interval' updates.
+    ChTrackShoeWindow(int rescan_interval = 100);
+
+    /// Update the window for a track with the given number of shoes.
+    /// The provided function must return true if the shoe with given index is within reach.
+    void Update(size_t num_shoes, const std::function<bool(size_t)>& in_reach);
+
+    /// Force a full scan of all shoes at the next update.
+    void Reset() { m_count = 0; }
+
+    /// Get the number of shoes in the window.
+    size_t GetNumShoes() const { return m_count; }
+
+    /// Get the index (in the track assembly) of the k-th shoe in the window.
+    size_t GetShoeIndex(size_t k) const { return (m_first + k) % m_num_shoes; }
+
+  private:
+    void Rescan(const std::function<bool(size_t)>& in_reach);
+
+    int m_rescan_interval;   ///< number of updates between full scans
+    int m_num_updates;       ///< number of updates since last full scan
+    size_t m_num_shoes;      ///< number of shoes in the track
+    size_t m_first;          ///< index of first shoe in window
+    size_t m_count;          ///< number of shoes in window
+    std::vector<char> m_in;  ///< in-reach flags (used in full scans)
+};
+
+/// @} vehicle_tracked
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
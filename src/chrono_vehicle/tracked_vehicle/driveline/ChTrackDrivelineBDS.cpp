@@ -35,8 +35,11 @@ ChTrackDrivelineBDS::ChTrackDrivelineBDS(const std::string& name)
     : ChDrivelineTV(name), m_dir_motor_block(ChVector3d(1, 0, 0)), m_dir_axle(ChVector3d(0, 1, 0)) {}
 
 ChTrackDrivelineBDS::~ChTrackDrivelineBDS() {
-    auto sys = m_differential->GetSystem();
-    if (sys) {
+    auto sys = m_clutch->GetSystem();
+    if (sys && m_network) {
+        sys->Remove(m_network);
+        sys->Remove(m_clutch);
+    } else if (sys) {
         sys->Remove(m_driveshaft);
         sys->Remove(m_conicalgear);
         sys->Remove(m_differentialbox);
@@ -58,6 +61,31 @@ void ChTrackDrivelineBDS::Initialize(std::shared_ptr<ChChassis> chassis,
     auto chassisBody = chassis->GetBody();
     auto sys = chassisBody->GetSystem();
 
+    auto axle_L = track_left->GetSprocket()->GetAxle();
+    auto axle_R = track_right->GetSprocket()->GetAxle();
+
+    // Create the clutch for differential locking. By default, unlocked.
+    m_clutch = chrono_types::make_shared<ChShaftsClutch>();
+    m_clutch->Initialize(axle_L, axle_R);
+    m_clutch->SetTorqueLimit(GetDifferentialLockingLimit());
+    m_clutch->SetModulation(0);
+
+    if (m_reduced_network) {
+        // Reduced model of the driveshaft, conical gear, differential box, and differential.
+        // The reaction torque of the conical gear on the chassis is not modeled.
+        m_network = chrono_types::make_shared<ChShaftsNetwork>();
+        m_driveshaft_index = m_network->AddShaft(GetDriveshaftInertia());
+        int box = m_network->AddShaft(GetDifferentialBoxInertia());
+        m_axle_index[LEFT] = m_network->AddShaft(axle_L);
+        m_axle_index[RIGHT] = m_network->AddShaft(axle_R);
+        m_network->AddGear(m_driveshaft_index, box, -GetConicalGearRatio());
+        m_network->AddPlanetary(box, m_axle_index[LEFT], m_axle_index[RIGHT], -1.0);
+        m_network->Initialize();
+        sys->Add(m_network);
+        sys->Add(m_clutch);
+        return;
+    }
+
     // Create the driveshaft for the connection of the driveline to the transmission box.
     m_driveshaft = chrono_types::make_shared<ChShaft>();
     m_driveshaft->SetInertia(GetDriveshaftInertia());
@@ -83,22 +111,19 @@ void ChTrackDrivelineBDS::Initialize(std::shared_ptr<ChChassis> chassis,
     // This class of mechanisms can be simulated using ChShaftsPlanetary; a proper 'ordinary'
     // transmission ratio t0 must be assigned according to Willis formula. For a differential, t0=-1.
     m_differential = chrono_types::make_shared<ChShaftsPlanetary>();
-    m_differential->Initialize(m_differentialbox, track_left->GetSprocket()->GetAxle(),
-                               track_right->GetSprocket()->GetAxle());
+    m_differential->Initialize(m_differentialbox, axle_L, axle_R);
     m_differential->SetTransmissionRatioOrdinary(-1.0);
     sys->Add(m_differential);
 
-    // Create the clutch for front differential locking. By default, unlocked.
-    m_clutch = chrono_types::make_shared<ChShaftsClutch>();
-    m_clutch->Initialize(track_left->GetSprocket()->GetAxle(), track_right->GetSprocket()->GetAxle());
-    m_clutch->SetTorqueLimit(GetDifferentialLockingLimit());
-    m_clutch->SetModulation(0);
     sys->Add(m_clutch);
 }
 
 // -----------------------------------------------------------------------------
 void ChTrackDrivelineBDS::Synchronize(double time, const DriverInputs& driver_inputs, double driveshaft_torque) {
-    m_driveshaft->SetAppliedLoad(driveshaft_torque);
+    if (m_network)
+        m_network->SetAppliedLoad(m_driveshaft_index, driveshaft_torque);
+    else
+        m_driveshaft->SetAppliedLoad(driveshaft_torque);
 }
 
 // -----------------------------------------------------------------------------
@@ -120,6 +145,9 @@ void ChTrackDrivelineBDS::CombineDriverInputs(const DriverInputs& driver_inputs,
 
 // -----------------------------------------------------------------------------
 double ChTrackDrivelineBDS::GetSprocketTorque(VehicleSide side) const {
+    if (m_network)
+        return -m_network->GetReactionTorque(m_axle_index[side]);
+
     switch (side) {
         case LEFT:
             return -m_differential->GetReaction2();
@@ -131,6 +159,9 @@ double ChTrackDrivelineBDS::GetSprocketTorque(VehicleSide side) const {
 }
 
 double ChTrackDrivelineBDS::GetSprocketSpeed(VehicleSide side) const {
+    if (m_network)
+        return -m_network->GetShaftSpeed(m_axle_index[side]);
+
     switch (side) {
         case LEFT: {
             return -m_differential->GetSpeedShaft2();
@@ -143,9 +174,19 @@ double ChTrackDrivelineBDS::GetSprocketSpeed(VehicleSide side) const {
     return 0;
 }
 
+// -----------------------------------------------------------------------------
+double ChTrackDrivelineBDS::GetOutputDriveshaftSpeed() const {
+    if (m_network)
+        return m_network->GetShaftSpeed(m_driveshaft_index);
+    return m_driveshaft->GetPosDt();
+}
+
 // -----------------------------------------------------------------------------
 void ChTrackDrivelineBDS::Disconnect() {
-    m_differential->SetDisabled(true);
+    if (m_network)
+        m_network->SetDisabled(true);
+    else
+        m_differential->SetDisabled(true);
 }
 
 }  // end namespace vehicle
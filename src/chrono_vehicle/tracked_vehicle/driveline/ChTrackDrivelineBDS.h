@@ -24,6 +24,7 @@
 
 #include "chrono/physics/ChShaft.h"
 #include "chrono/physics/ChShaftsGearboxAngled.h"
+#include "chrono/physics/ChShaftsNetwork.h"
 #include "chrono/physics/ChShaftsPlanetary.h"
 #include "chrono/physics/ChShaftsClutch.h"
 
@@ -34,6 +35,8 @@ namespace vehicle {
 /// @{
 
 /// Track driveline model template based on ChShaft objects.
+/// If a reduced shaft network is enabled, the driveshaft, conical gear, and differential are modeled with a single
+/// ChShaftsNetwork (see ChDriveline::EnableReducedShaftNetwork).
 class CH_VEHICLE_API ChTrackDrivelineBDS : public ChDrivelineTV {
   public:
     ChTrackDrivelineBDS(const std::string& name  ///< [in] name of the subsystem
@@ -85,7 +88,7 @@ class CH_VEHICLE_API ChTrackDrivelineBDS : public ChDrivelineTV {
 
     /// Return the output driveline speed of the driveshaft.
     /// This represents the output from the driveline subsystem that is passed to the transmission subsystem.
-    virtual double GetOutputDriveshaftSpeed() const override { return m_driveshaft->GetPosDt(); }
+    virtual double GetOutputDriveshaftSpeed() const override;
 
   protected:
     /// Return the inertia of the driveshaft.
@@ -110,6 +113,10 @@ class CH_VEHICLE_API ChTrackDrivelineBDS : public ChDrivelineTV {
     std::shared_ptr<ChShaftsPlanetary> m_differential;     ///< planetary differential
     std::shared_ptr<ChShaftsClutch> m_clutch;              ///< clutch for locking differential
 
+    std::shared_ptr<ChShaftsNetwork> m_network;  ///< reduced shaft network (if enabled)
+    int m_driveshaft_index;                      ///< index of the driveshaft in the reduced network
+    int m_axle_index[2];                         ///< indexes of the sprocket axle shafts in the reduced network
+
     ChVector3d m_dir_motor_block;
     ChVector3d m_dir_axle;
 };
@@ -24,6 +24,7 @@
 #include "chrono/utils/ChUtils.h"
 
 #include "chrono_vehicle/tracked_vehicle/ChTrackAssembly.h"
+#include "chrono_vehicle/tracked_vehicle/ChTrackShoeWindow.h"
 #include "chrono_vehicle/tracked_vehicle/sprocket/ChSprocketBand.h"
 #include "chrono_vehicle/tracked_vehicle/track_shoe/ChTrackShoeBand.h"
 
@@ -227,6 +228,8 @@ class SprocketBandContactCB : public ChSystem::CustomCollisionCallback {
     bool m_update_tread;  // flag to update the remaining cached contact properties on the first contact callback
 
     double m_beta;  // angle between sprocket teeth
+
+    ChTrackShoeWindow m_window;  // shoes within reach of the sprocket
 };
 
 // Add contacts between the sprocket and track shoes.
@@ -271,9 +274,18 @@ void SprocketBandContactCB::OnCustomCollision(ChSystem* system) {
     // Sprocket "normal" (Y axis), expressed in global frame
     ChVector3d dirS_abs = m_sprocket->GetGearBody()->GetRotMat().GetAxisY();
 
-    // Loop over all track shoes in the associated track
-    for (size_t is = 0; is < m_track->GetNumTrackShoes(); ++is) {
-        auto shoe = std::static_pointer_cast<ChTrackShoeBand>(m_track->GetTrackShoe(is));
+    // Update the window of track shoes within reach of the sprocket (test performed in the sprocket's x-z plane;
+    // all contact features of a shoe are within one pitch of the tread body reference frame)
+    double reach = std::sqrt(m_gear_tread_broadphase_dist_squared) + m_track->GetTrackShoe(0)->GetPitch();
+    m_window.Update(m_track->GetNumTrackShoes(), [this, reach](size_t is) {
+        auto loc = m_sprocket->GetGearBody()->TransformPointParentToLocal(
+            m_track->GetTrackShoe(is)->GetShoeBody()->GetPos());
+        return loc.x() * loc.x() + loc.z() * loc.z() < reach * reach;
+    });
+
+    // Loop over the track shoes in the window
+    for (size_t k = 0; k < m_window.GetNumShoes(); ++k) {
+        auto shoe = std::static_pointer_cast<ChTrackShoeBand>(m_track->GetTrackShoe(m_window.GetShoeIndex(k)));
 
         CheckTreadSegmentSprocket(shoe, locS_abs);
 
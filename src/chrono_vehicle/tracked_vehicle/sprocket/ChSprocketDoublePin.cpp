@@ -24,6 +24,7 @@
 #include "chrono_vehicle/tracked_vehicle/sprocket/ChSprocketDoublePin.h"
 #include "chrono_vehicle/tracked_vehicle/track_shoe/ChTrackShoeDoublePin.h"
 #include "chrono_vehicle/tracked_vehicle/ChTrackAssembly.h"
+#include "chrono_vehicle/tracked_vehicle/ChTrackShoeWindow.h"
 
 namespace chrono {
 namespace vehicle {
@@ -154,6 +155,8 @@ class SprocketDoublePinContactCB : public ChSystem::CustomCollisionCallback {
     double m_R_sum;  // test quantity for broadphase check
 
     std::shared_ptr<ChContactMaterial> m_material;  // material for sprocket-pin contact (detracking)
+
+    ChTrackShoeWindow m_window;  // shoes within reach of the sprocket
 };
 
 // Add contacts between the sprocket and track shoes.
@@ -171,9 +174,18 @@ void SprocketDoublePinContactCB::OnCustomCollision(ChSystem* system) {
     // Sprocket "normal" (Y axis), expressed in global frame
     ChVector3d dirS_abs = m_sprocket->GetGearBody()->GetRotMat().GetAxisY();
 
-    // Loop over all track shoes in the associated track
-    for (size_t is = 0; is < m_track->GetNumTrackShoes(); ++is) {
-        auto shoe = std::static_pointer_cast<ChTrackShoeDoublePin>(m_track->GetTrackShoe(is));
+    // Update the window of track shoes within reach of the sprocket (test performed in the sprocket's x-z plane;
+    // all contact features of a shoe are within one pitch of the shoe body reference frame)
+    double reach = m_R_sum + m_track->GetTrackShoe(0)->GetPitch();
+    m_window.Update(m_track->GetNumTrackShoes(), [this, reach](size_t is) {
+        auto loc = m_sprocket->GetGearBody()->TransformPointParentToLocal(
+            m_track->GetTrackShoe(is)->GetShoeBody()->GetPos());
+        return loc.x() * loc.x() + loc.z() * loc.z() < reach * reach;
+    });
+
+    // Loop over the track shoes in the window
+    for (size_t k = 0; k < m_window.GetNumShoes(); ++k) {
+        auto shoe = std::static_pointer_cast<ChTrackShoeDoublePin>(m_track->GetTrackShoe(m_window.GetShoeIndex(k)));
 
         switch (shoe->m_topology) {
             case DoublePinTrackShoeType::TWO_CONNECTORS: {
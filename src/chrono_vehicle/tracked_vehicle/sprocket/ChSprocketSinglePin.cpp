@@ -22,6 +22,7 @@
 #include "chrono_vehicle/tracked_vehicle/sprocket/ChSprocketSinglePin.h"
 #include "chrono_vehicle/tracked_vehicle/track_shoe/ChTrackShoeSinglePin.h"
 #include "chrono_vehicle/tracked_vehicle/ChTrackAssembly.h"
+#include "chrono_vehicle/tracked_vehicle/ChTrackShoeWindow.h"
 
 namespace chrono {
 namespace vehicle {
@@ -129,6 +130,8 @@ class SprocketSinglePinContactCB : public ChSystem::CustomCollisionCallback {
     double m_Rhat_diff;  // test quantity for narrowphase check
 
     std::shared_ptr<ChContactMaterial> m_material;  // material for sprocket-pin contact (detracking)
+
+    ChTrackShoeWindow m_window;  // shoes within reach of the sprocket
 };
 
 void SprocketSinglePinContactCB::OnCustomCollision(ChSystem* system) {
@@ -145,9 +148,16 @@ void SprocketSinglePinContactCB::OnCustomCollision(ChSystem* system) {
     // Sprocket "normal" (Y axis), expressed in global frame
     ChVector3d dirS_abs = m_sprocket->GetGearBody()->GetRotMat().GetAxisY();
 
-    // Loop over all shoes in the associated track
-    for (size_t is = 0; is < m_track->GetNumTrackShoes(); ++is) {
-        auto shoe = std::static_pointer_cast<ChTrackShoeSinglePin>(m_track->GetTrackShoe(is));
+    // Update the window of track shoes within reach of the sprocket (all contact features of a shoe are within one
+    // pitch of the shoe body reference frame)
+    double reach = m_R_sum + m_track->GetTrackShoe(0)->GetPitch();
+    m_window.Update(m_track->GetNumTrackShoes(), [this, &locS_abs, reach](size_t is) {
+        return (m_track->GetTrackShoe(is)->GetShoeBody()->GetPos() - locS_abs).Length2() < reach * reach;
+    });
+
+    // Loop over the track shoes in the window
+    for (size_t k = 0; k < m_window.GetNumShoes(); ++k) {
+        auto shoe = std::static_pointer_cast<ChTrackShoeSinglePin>(m_track->GetTrackShoe(m_window.GetShoeIndex(k)));
 
         // Calculate locations of the centers of the shoe's contact cylinders
         // (expressed in the global frame)
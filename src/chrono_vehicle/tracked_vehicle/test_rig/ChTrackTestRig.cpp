@@ -175,7 +175,8 @@ void ChTrackTestRig::Create(bool create_track, bool detracking_control) {
         if (m_track->GetRoadWheel(i)->GetBody()->GetPos().z() < zmin)
             zmin = m_track->GetRoadWheel(i)->GetBody()->GetPos().z();
     }
-    zmin -= create_track ? (rw_radius + m_track->GetTrackShoe(0)->GetHeight() + 0.2) : rw_radius;
+    bool has_shoes = create_track && m_track->GetNumTrackShoes() > 0;
+    zmin -= has_shoes ? (rw_radius + m_track->GetTrackShoe(0)->GetHeight() + 0.2) : rw_radius;
 
     // Create posts and associated actuators under each road wheel
     for (size_t i = 0; i < num_wheels; ++i) {
@@ -0,0 +1,150 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Base class for a reduced-order track assembly, with the track modeled as a
+// kinematic band (no track shoe bodies).
+//
+// The reference frame for a vehicle follows the ISO standard: Z-axis up, X-axis
+// pointing forward, and Y-axis towards the left of the vehicle.
+//
+// =============================================================================
+
+#include "chrono/collision/ChCollisionShapeCylinder.h"
+
+#include "chrono_vehicle/ChVehicleGeometry.h"
+#include "chrono_vehicle/tracked_vehicle/track_assembly/ChTrackAssemblyReduced.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChTrackAssemblyReduced::ChTrackAssemblyReduced(const std::string& name, VehicleSide side)
+    : ChTrackAssembly(name, side) {}
+
+ChTrackAssemblyReduced::~ChTrackAssemblyReduced() {
+    if (m_pad_shafts.empty())
+        return;
+    auto sys = m_pad_shafts[0]->GetSystem();
+    if (sys) {
+        for (size_t i = 0; i < m_pad_shafts.size(); i++) {
+            sys->Remove(m_pad_gears[i]);
+            sys->Remove(m_pad_axles[i]);
+            sys->Remove(m_pad_shafts[i]);
+        }
+    }
+}
+
+double ChTrackAssemblyReduced::GetBandSpeed() const {
+    return m_sprocket->GetAxleSpeed() * GetDriveRadius();
+}
+
+// -----------------------------------------------------------------------------
+// Create the track pads on all road wheels and on the idler wheel and couple
+// their rotation to the sprocket axle.
+// -----------------------------------------------------------------------------
+bool ChTrackAssemblyReduced::Assemble(std::shared_ptr<ChBodyAuxRef> chassis) {
+    auto material = m_pad_mat_info.CreateMaterial(chassis->GetSystem()->GetContactMethod());
+
+    for (auto& suspension : m_suspensions)
+        AddPad(suspension->GetRoadWheel(), material);
+    AddPad(m_idler->GetIdlerWheel(), material);
+
+    return true;
+}
+
+void ChTrackAssemblyReduced::AddPad(std::shared_ptr<ChTrackWheel> wheel, std::shared_ptr<ChContactMaterial> material) {
+    auto body = wheel->GetBody();
+    auto sys = body->GetSystem();
+    double radius = wheel->GetRadius() + GetPadThickness();
+
+    // Pad contact cylinder (around the wheel Y axis)
+    auto ct_shape = chrono_types::make_shared<ChCollisionShapeCylinder>(material, radius, GetPadWidth());
+    body->AddCollisionShape(ct_shape, ChFrame<>(VNULL, QuatFromAngleX(CH_PI_2)));
+    body->EnableCollision(true);
+
+    // Shaft representing the wheel rotation (same convention as the sprocket axle).
+    // The shaft inertia is negligible, as the wheel inertia is carried by the wheel body.
+    auto shaft = chrono_types::make_shared<ChShaft>();
+    shaft->SetName(wheel->GetName() + "_band_shaft");
+    shaft->SetInertia(0.01);
+    sys->AddShaft(shaft);
+
+    auto axle = chrono_types::make_shared<ChShaftBodyRotation>();
+    axle->SetName(wheel->GetName() + "_band_axle");
+    axle->Initialize(shaft, body, ChVector3d(0, -1, 0));
+    sys->Add(axle);
+
+    // Band coupling: the pad surface moves with the band speed imposed by the sprocket
+    auto gear = chrono_types::make_shared<ChShaftsGear>();
+    gear->SetName(wheel->GetName() + "_band_gear");
+    gear->Initialize(m_sprocket->GetAxle(), shaft);
+    gear->SetTransmissionRatio(GetDriveRadius() / radius);
+    sys->Add(gear);
+
+    m_pad_wheels.push_back(wheel);
+    m_pad_shafts.push_back(shaft);
+    m_pad_axles.push_back(axle);
+    m_pad_gears.push_back(gear);
+}
+
+// -----------------------------------------------------------------------------
+
+void ChTrackAssemblyReduced::AddVisualizationAssets(VisualizationType vis) {
+    if (vis == VisualizationType::NONE)
+        return;
+
+    double hw = GetPadWidth() / 2;
+    for (auto& wheel : m_pad_wheels) {
+        double radius = wheel->GetRadius() + GetPadThickness();
+        auto shape = ChVehicleGeometry::AddVisualizationCylinder(wheel->GetBody(), ChVector3d(0, hw, 0),
+                                                                 ChVector3d(0, -hw, 0), radius);
+        m_pad_shapes.push_back(shape);
+    }
+}
+
+void ChTrackAssemblyReduced::RemoveVisualizationAssets() {
+    for (size_t i = 0; i < m_pad_shapes.size(); i++)
+        ChPart::RemoveVisualizationAsset(m_pad_wheels[i]->GetBody(), m_pad_shapes[i]);
+    m_pad_shapes.clear();
+}
+
+// -----------------------------------------------------------------------------
+
+void ChTrackAssemblyReduced::ExportComponentList(rapidjson::Document& jsonDocument) const {
+    ChTrackAssembly::ExportComponentList(jsonDocument);
+
+    ExportShaftList(jsonDocument, m_pad_shafts);
+
+    std::vector<std::shared_ptr<ChShaftsCouple>> couples;
+    for (const auto& gear : m_pad_gears)
+        couples.push_back(gear);
+    ExportCouplesList(jsonDocument, couples);
+}
+
+void ChTrackAssemblyReduced::Output(ChVehicleOutput& database) const {
+    if (!m_output)
+        return;
+
+    ChTrackAssembly::Output(database);
+
+    database.WriteSection(GetName());
+    database.WriteShafts(m_pad_shafts);
+
+    std::vector<std::shared_ptr<ChShaftsCouple>> couples;
+    for (const auto& gear : m_pad_gears)
+        couples.push_back(gear);
+    database.WriteCouples(couples);
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,125 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Base class for a reduced-order track assembly, with the track modeled as a
+// kinematic band (no track shoe bodies).
+//
+// The reference frame for a vehicle follows the ISO standard: Z-axis up, X-axis
+// pointing forward, and Y-axis towards the left of the vehicle.
+//
+// =============================================================================
+
+#ifndef CH_TRACK_ASSEMBLY_REDUCED_H
+#define CH_TRACK_ASSEMBLY_REDUCED_H
+
+#include <vector>
+
+#include "chrono/physics/ChShaftsGear.h"
+
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/tracked_vehicle/ChTrackAssembly.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_tracked
+/// @{
+
+/// Definition of a reduced-order track assembly.
+/// A track assembly consists of a sprocket, an idler (with tensioner mechanism), a set of suspensions (road-wheel
+/// assemblies), and a track. In this template, the track is not modeled with track shoe bodies; instead, it is
+/// represented by a kinematic band wrapped around the sprocket, road wheels, and idler:
+/// - the track pads are represented by contact cylinders (of the pad width and thickness) around the road wheels and
+///   the idler wheel, which carry all interaction with the terrain;
+/// - the band kinematically couples the rotation of the road wheels and idler to that of the sprocket, such that the
+///   pads move with the band velocity imposed by the sprocket (i.e., no slip between band and wheels).
+///
+/// This formulation uses one shaft and two scalar constraints per road wheel, instead of one or more rigid bodies and
+/// one or more joints per track shoe. It preserves the sprocket, idler, suspension, driveline, and brake subsystems
+/// and is meant for long-duration mobility studies where track dynamics (track tension, shoe-sprocket engagement,
+/// contact of the track spans between road wheels) are not of interest. The track mass is not modeled. Note that the
+/// kinematic coupling uses absolute wheel angular velocities (about the wheel axes) and is therefore exact only in
+/// the absence of chassis pitch rate.
+class CH_VEHICLE_API ChTrackAssemblyReduced : public ChTrackAssembly {
+  public:
+    ChTrackAssemblyReduced(const std::string& name,  ///< [in] name of the subsystem
+                           VehicleSide side          ///< [in] assembly on left/right vehicle side
+    );
+
+    virtual ~ChTrackAssemblyReduced();
+
+    /// Get the name of the vehicle subsystem template.
+    virtual std::string GetTemplateName() const override { return "TrackAssemblyReduced"; }
+
+    /// Get the number of track shoes (always 0 for a reduced-order track assembly).
+    virtual size_t GetNumTrackShoes() const override { return 0; }
+
+    /// Get a handle to the sprocket.
+    virtual std::shared_ptr<ChSprocket> GetSprocket() const override { return m_sprocket; }
+
+    /// Get a handle to the specified track shoe subsystem (always empty for a reduced-order track assembly).
+    virtual std::shared_ptr<ChTrackShoe> GetTrackShoe(size_t id) const override { return nullptr; }
+
+    /// Get the current band speed (imposed by the sprocket).
+    double GetBandSpeed() const;
+
+    /// Add visualization assets for the track pads.
+    virtual void AddVisualizationAssets(VisualizationType vis) override;
+
+    /// Remove visualization assets for the track pads.
+    virtual void RemoveVisualizationAssets() override;
+
+  protected:
+    /// Return the radius of the band on the sprocket (effective drive radius).
+    virtual double GetDriveRadius() const = 0;
+
+    /// Return the thickness of the track pads (distance from the road-wheel surface to the terrain).
+    virtual double GetPadThickness() const = 0;
+
+    /// Return the width of the track pads.
+    virtual double GetPadWidth() const = 0;
+
+    /// Export this subsystem's component list to the specified JSON object.
+    virtual void ExportComponentList(rapidjson::Document& jsonDocument) const override;
+
+    /// Output data for this subsystem's component list to the specified database.
+    virtual void Output(ChVehicleOutput& database) const override;
+
+    std::shared_ptr<ChSprocket> m_sprocket;  ///< sprocket subsystem
+    ChContactMaterialData m_pad_mat_info;    ///< data for track pad contact material
+
+  private:
+    /// Create the track pads and the band coupling of the road wheels and idler.
+    /// Always return true (there are no track shoes to be connected).
+    virtual bool Assemble(std::shared_ptr<ChBodyAuxRef> chassis) override final;
+
+    /// Remove all track shoes from assembly (no-op, as there are no track shoes).
+    virtual void RemoveTrackShoes() override final {}
+
+    /// Add a track pad to the specified wheel and couple its rotation to the sprocket.
+    void AddPad(std::shared_ptr<ChTrackWheel> wheel, std::shared_ptr<ChContactMaterial> material);
+
+    std::vector<std::shared_ptr<ChTrackWheel>> m_pad_wheels;        ///< wheels carrying track pads
+    std::vector<std::shared_ptr<ChShaft>> m_pad_shafts;             ///< wheel rotation shafts
+    std::vector<std::shared_ptr<ChShaftBodyRotation>> m_pad_axles;  ///< shaft-wheel connectors
+    std::vector<std::shared_ptr<ChShaftsGear>> m_pad_gears;         ///< band coupling to sprocket axle
+    std::vector<std::shared_ptr<ChVisualShape>> m_pad_shapes;       ///< pad visualization shapes
+};
+
+/// @} vehicle_tracked
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
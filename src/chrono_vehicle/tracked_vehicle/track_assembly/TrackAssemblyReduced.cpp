@@ -0,0 +1,173 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban, agent
+// =============================================================================
+//
+// Track assembly (reduced-order) model constructed from a JSON specification file
+//
+// =============================================================================
+
+#include "chrono_vehicle/tracked_vehicle/track_assembly/TrackAssemblyReduced.h"
+
+#include "chrono_vehicle/tracked_vehicle/sprocket/SprocketSinglePin.h"
+#include "chrono_vehicle/tracked_vehicle/sprocket/SprocketDoublePin.h"
+#include "chrono_vehicle/tracked_vehicle/sprocket/SprocketBand.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/utils/ChUtilsJSON.h"
+
+using namespace rapidjson;
+
+namespace chrono {
+namespace vehicle {
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+void TrackAssemblyReduced::ReadSprocket(const std::string& filename, int output) {
+    Document d;
+    ReadFileJSON(filename, d);
+    if (d.IsNull())
+        return;
+
+    // Check that the given file is a sprocket specification file.
+    assert(d.HasMember("Type"));
+    std::string type = d["Type"].GetString();
+    assert(type.compare("Sprocket") == 0);
+
+    // Create the sprocket using the appropriate template (any sprocket type can be used with a reduced-order track).
+    assert(d.HasMember("Template"));
+    std::string subtype = d["Template"].GetString();
+    if (subtype.compare("SprocketSinglePin") == 0) {
+        m_sprocket = chrono_types::make_shared<SprocketSinglePin>(d);
+    } else if (subtype.compare("SprocketDoublePin") == 0) {
+        m_sprocket = chrono_types::make_shared<SprocketDoublePin>(d);
+    } else if (subtype.compare("SprocketBand") == 0) {
+        m_sprocket = chrono_types::make_shared<SprocketBand>(d);
+    } else {
+        throw std::invalid_argument("Sprocket type not supported in TrackAssemblyReduced.");
+    }
+
+    // A non-zero value of 'output' indicates overwriting the subsystem's flag
+    if (output != 0) {
+        m_sprocket->SetOutput(output == +1);
+    }
+
+    std::cout << "  Loaded JSON " << filename << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+TrackAssemblyReduced::TrackAssemblyReduced(const std::string& filename) : ChTrackAssemblyReduced("", LEFT) {
+    Document d;
+    ReadFileJSON(filename, d);
+    if (d.IsNull())
+        return;
+
+    Create(d);
+
+    std::cout << "Loaded JSON " << filename << std::endl;
+}
+
+TrackAssemblyReduced::TrackAssemblyReduced(const rapidjson::Document& d) : ChTrackAssemblyReduced("", LEFT) {
+    Create(d);
+}
+
+TrackAssemblyReduced::~TrackAssemblyReduced() {}
+
+void TrackAssemblyReduced::Create(const rapidjson::Document& d) {
+    // Invoke base class method.
+    ChPart::Create(d);
+
+    // Create the sprocket
+    {
+        assert(d.HasMember("Sprocket"));
+        std::string file_name = d["Sprocket"]["Input File"].GetString();
+        int output = 0;
+        if (d["Sprocket"].HasMember("Output")) {
+            output = d["Sprocket"]["Output"].GetBool() ? +1 : -1;
+        }
+        ReadSprocket(vehicle::GetDataFile(file_name), output);
+        m_sprocket_loc = ReadVectorJSON(d["Sprocket"]["Location"]);
+    }
+
+    // Create the brake
+    {
+        assert(d.HasMember("Brake"));
+        std::string file_name = d["Brake"]["Input File"].GetString();
+        m_brake = ReadTrackBrakeJSON(vehicle::GetDataFile(file_name));
+        if (d["Brake"].HasMember("Output")) {
+            m_brake->SetOutput(d["Brake"]["Output"].GetBool());
+        }
+    }
+
+    // Create the idler
+    {
+        assert(d.HasMember("Idler"));
+        std::string file_name = d["Idler"]["Input File"].GetString();
+        m_idler = ReadIdlerJSON(vehicle::GetDataFile(file_name));
+        if (d["Idler"].HasMember("Output")) {
+            m_idler->SetOutput(d["Idler"]["Output"].GetBool());
+        }
+        m_idler_loc = ReadVectorJSON(d["Idler"]["Location"]);
+    }
+
+    // Create the suspensions
+    assert(d.HasMember("Suspension Subsystems"));
+    assert(d["Suspension Subsystems"].IsArray());
+    m_num_susp = d["Suspension Subsystems"].Size();
+    m_suspensions.resize(m_num_susp);
+    m_susp_locs.resize(m_num_susp);
+    for (int i = 0; i < m_num_susp; i++) {
+        std::string file_name = d["Suspension Subsystems"][i]["Input File"].GetString();
+        bool has_shock = d["Suspension Subsystems"][i]["Has Shock"].GetBool();
+        bool lock_arm = false;
+        if (d["Suspension Subsystems"][i].HasMember("Lock Arm")) {
+            lock_arm = d["Suspension Subsystems"][i]["Lock Arm"].GetBool();
+        }
+        m_suspensions[i] = ReadTrackSuspensionJSON(vehicle::GetDataFile(file_name), has_shock, lock_arm);
+        if (d["Suspension Subsystems"][i].HasMember("Output")) {
+            m_suspensions[i]->SetOutput(d["Suspension Subsystems"][i]["Output"].GetBool());
+        }
+        m_susp_locs[i] = ReadVectorJSON(d["Suspension Subsystems"][i]["Location"]);
+    }
+
+    // Create the rollers
+    m_num_rollers = 0;
+    if (d.HasMember("Rollers")) {
+        assert(d["Rollers"].IsArray());
+        m_num_rollers = d["Rollers"].Size();
+        m_rollers.resize(m_num_rollers);
+        m_roller_locs.resize(m_num_rollers);
+        for (int i = 0; i < m_num_rollers; i++) {
+            std::string file_name = d["Rollers"][i]["Input File"].GetString();
+            m_rollers[i] = ReadTrackWheelJSON(vehicle::GetDataFile(file_name));
+            if (d["Rollers"][i].HasMember("Output")) {
+                m_rollers[i]->SetOutput(d["Rollers"][i]["Output"].GetBool());
+            }
+            m_roller_locs[i] = ReadVectorJSON(d["Rollers"][i]["Location"]);
+        }
+    }
+
+    // Read the band (track pads) data
+    {
+        assert(d.HasMember("Band"));
+        m_drive_radius = d["Band"]["Drive Radius"].GetDouble();
+        m_pad_thickness = d["Band"]["Pad Thickness"].GetDouble();
+        m_pad_width = d["Band"]["Pad Width"].GetDouble();
+
+        assert(d["Band"].HasMember("Pad Material"));
+        m_pad_mat_info = ReadMaterialInfoJSON(d["Band"]["Pad Material"]);
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
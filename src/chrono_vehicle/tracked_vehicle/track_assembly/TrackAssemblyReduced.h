@@ -0,0 +1,74 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban, agent
+// =============================================================================
+//
+// Track assembly (reduced-order) model constructed from a JSON specification file
+//
+// =============================================================================
+
+#ifndef TRACK_ASSEMBLY_REDUCED_H
+#define TRACK_ASSEMBLY_REDUCED_H
+
+#include <vector>
+
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/tracked_vehicle/track_assembly/ChTrackAssemblyReduced.h"
+
+#include "chrono_thirdparty/rapidjson/document.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_tracked
+/// @{
+
+/// Reduced-order track assembly model constructed from a JSON specification file
+class CH_VEHICLE_API TrackAssemblyReduced : public ChTrackAssemblyReduced {
+  public:
+    TrackAssemblyReduced(const std::string& filename);
+    TrackAssemblyReduced(const rapidjson::Document& d);
+    ~TrackAssemblyReduced();
+
+    virtual const ChVector3d GetSprocketLocation() const override { return m_sprocket_loc; }
+    virtual const ChVector3d GetIdlerLocation() const override { return m_idler_loc; }
+    virtual const ChVector3d GetRoadWhelAssemblyLocation(int which) const override { return m_susp_locs[which]; }
+    virtual const ChVector3d GetRollerLocation(int which) const override { return m_roller_locs[which]; }
+
+  private:
+    virtual void Create(const rapidjson::Document& d) override;
+
+    virtual double GetDriveRadius() const override { return m_drive_radius; }
+    virtual double GetPadThickness() const override { return m_pad_thickness; }
+    virtual double GetPadWidth() const override { return m_pad_width; }
+
+    void ReadSprocket(const std::string& filename, int output);
+
+    int m_num_susp;
+    int m_num_rollers;
+
+    double m_drive_radius;
+    double m_pad_thickness;
+    double m_pad_width;
+
+    ChVector3d m_sprocket_loc;
+    ChVector3d m_idler_loc;
+    std::vector<ChVector3d> m_susp_locs;
+    std::vector<ChVector3d> m_roller_locs;
+};
+
+/// @} vehicle_tracked
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
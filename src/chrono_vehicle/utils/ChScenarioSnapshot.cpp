@@ -0,0 +1,172 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// In-memory snapshot of a simulation scenario, for forking Monte-Carlo runs.
+//
+// =============================================================================
+
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+
+#include "chrono/serialization/ChArchiveBinary.h"
+
+#include "chrono_vehicle/terrain/SCMTerrainStream.h"
+#include "chrono_vehicle/utils/ChScenarioSnapshot.h"
+
+namespace chrono {
+namespace vehicle {
+
+// -----------------------------------------------------------------------------
+
+std::string ChScenarioSnapshot::SCMStateProvider::GetState() {
+    SCMTerrainStream stream;
+    auto data = stream.Encode(m_terrain.GetModifiedNodes(true));
+    return std::string(data.begin(), data.end());
+}
+
+void ChScenarioSnapshot::SCMStateProvider::SetState(const std::string& state) {
+    SCMTerrainStream stream;
+    m_terrain.SetModifiedNodes(stream.Decode(reinterpret_cast<const uint8_t*>(state.data()), state.size()));
+}
+
+// -----------------------------------------------------------------------------
+
+ChScenarioSnapshot::ChScenarioSnapshot()
+    : m_valid(false), m_time(0), m_num_coords_pos(0), m_num_coords_vel(0), m_num_constr(0) {}
+
+void ChScenarioSnapshot::Capture(ChSystem& sys, const std::vector<std::shared_ptr<StateProvider>>& states) {
+    sys.Setup();
+    m_num_coords_pos = sys.GetNumCoordsPosLevel();
+    m_num_coords_vel = sys.GetNumCoordsVelLevel();
+    m_num_constr = sys.GetNumConstraints();
+
+    ChState x(m_num_coords_pos, &sys);
+    ChStateDelta v(m_num_coords_vel, &sys);
+    ChStateDelta a(m_num_coords_vel, &sys);
+    ChVectorDynamic<> L(m_num_constr);
+    sys.StateGather(x, v, m_time);
+    sys.StateGatherAcceleration(a);
+    sys.StateGatherReactions(L);
+
+    m_x.assign(x.data(), x.data() + x.size());
+    m_v.assign(v.data(), v.data() + v.size());
+    m_a.assign(a.data(), a.data() + a.size());
+    m_L.assign(L.data(), L.data() + L.size());
+
+    m_states.clear();
+    for (const auto& state : states)
+        m_states.push_back(state->GetState());
+
+    m_valid = true;
+}
+
+void ChScenarioSnapshot::Restore(ChSystem& sys, const std::vector<std::shared_ptr<StateProvider>>& states) const {
+    if (!m_valid)
+        throw std::runtime_error("ChScenarioSnapshot: no captured state");
+
+    sys.Setup();
+    if (sys.GetNumCoordsPosLevel() != m_num_coords_pos || sys.GetNumCoordsVelLevel() != m_num_coords_vel ||
+        sys.GetNumConstraints() != m_num_constr)
+        throw std::runtime_error("ChScenarioSnapshot: system not compatible with the snapshot");
+    if (states.size() != m_states.size())
+        throw std::runtime_error("ChScenarioSnapshot: number of state providers not compatible with the snapshot");
+
+    ChState x(m_num_coords_pos, &sys);
+    ChStateDelta v(m_num_coords_vel, &sys);
+    ChStateDelta a(m_num_coords_vel, &sys);
+    ChVectorDynamic<> L(m_num_constr);
+    std::copy(m_x.begin(), m_x.end(), x.data());
+    std::copy(m_v.begin(), m_v.end(), v.data());
+    std::copy(m_a.begin(), m_a.end(), a.data());
+    std::copy(m_L.begin(), m_L.end(), L.data());
+
+    sys.StateScatter(x, v, m_time, true);
+    sys.StateScatterAcceleration(a);
+    sys.StateScatterReactions(L);
+
+    for (size_t i = 0; i < states.size(); i++)
+        states[i]->SetState(m_states[i]);
+}
+
+void ChScenarioSnapshot::Fork(int num_copies, std::function<Target(int)> construct, int num_threads) const {
+    std::exception_ptr exception;
+
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+    for (int i = 0; i < num_copies; i++) {
+        try {
+            auto target = construct(i);
+            Restore(*target.system, target.states);
+        } catch (...) {
+#pragma omp critical(ChScenarioSnapshot)
+            exception = std::current_exception();
+        }
+    }
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+// -----------------------------------------------------------------------------
+
+void ChScenarioSnapshot::Write(const std::string& filename) const {
+    if (!m_valid)
+        throw std::runtime_error("ChScenarioSnapshot: no captured state");
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.good())
+        throw std::runtime_error("ChScenarioSnapshot: cannot write file " + filename);
+
+    ChArchiveOutBinary archive(file);
+    auto time = m_time;
+    auto num_coords_pos = m_num_coords_pos;
+    auto num_coords_vel = m_num_coords_vel;
+    auto num_constr = m_num_constr;
+    auto x = m_x;
+    auto v = m_v;
+    auto a = m_a;
+    auto L = m_L;
+    archive << CHNVP(time) << CHNVP(num_coords_pos) << CHNVP(num_coords_vel) << CHNVP(num_constr);
+    archive << CHNVP(x) << CHNVP(v) << CHNVP(a) << CHNVP(L);
+
+    // Binary archives store strings as null-terminated, so encoded states are written as arrays of bytes
+    std::vector<std::vector<char>> states;
+    for (const auto& state : m_states)
+        states.push_back(std::vector<char>(state.begin(), state.end()));
+    archive << CHNVP(states);
+}
+
+void ChScenarioSnapshot::Read(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.good())
+        throw std::runtime_error("ChScenarioSnapshot: cannot read file " + filename);
+
+    ChArchiveInBinary archive(file);
+    archive >> CHNVP(m_time) >> CHNVP(m_num_coords_pos) >> CHNVP(m_num_coords_vel) >> CHNVP(m_num_constr);
+    archive >> CHNVP(m_x) >> CHNVP(m_v) >> CHNVP(m_a) >> CHNVP(m_L);
+
+    std::vector<std::vector<char>> states;
+    archive >> CHNVP(states);
+    m_states.clear();
+    for (const auto& state : states)
+        m_states.push_back(std::string(state.begin(), state.end()));
+
+    m_valid = file.good() && m_x.size() == m_num_coords_pos && m_v.size() == m_num_coords_vel &&
+              m_a.size() == m_num_coords_vel && m_L.size() == m_num_constr;
+    if (!m_valid)
+        throw std::runtime_error("ChScenarioSnapshot: invalid snapshot file " + filename);
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
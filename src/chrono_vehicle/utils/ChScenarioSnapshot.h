@@ -0,0 +1,129 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// In-memory snapshot of a simulation scenario, for forking Monte-Carlo runs.
+//
+// =============================================================================
+
+#ifndef CH_SCENARIO_SNAPSHOT_H
+#define CH_SCENARIO_SNAPSHOT_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chrono/physics/ChSystem.h"
+
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/terrain/SCMTerrain.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle
+/// @{
+
+/// In-memory snapshot of a simulation scenario (Chrono system, vehicles, and terrain).
+/// A snapshot records the state of a Chrono system (time, positions, velocities, accelerations, and constraint
+/// reactions) and the states provided by a list of state providers, for state not held by the system (e.g.,
+/// deformable terrain). A snapshot captured at the end of a (typically expensive) initialization phase, such as a
+/// vehicle settling on deformable or granular terrain, can be restored into any number of scenarios constructed in the
+/// same way, which then start directly from the settled state.
+///
+/// The target scenarios must be constructed identically to the captured one (same vehicle models, terrain, and
+/// number and order of physics items, in particular the same granular particles), and use the same state providers
+/// in the same order. Only the system state is restored; solver and integrator internal states, contacts (recomputed
+/// at the next step), and subsystem states not exposed through a state provider (e.g., tire model states, driver
+/// inputs) are not part of the snapshot. A snapshot is not modified by restoring it, so it can be restored into
+/// several scenarios concurrently.
+class CH_VEHICLE_API ChScenarioSnapshot {
+  public:
+    /// Interface for scenario state not held in the Chrono system.
+    class CH_VEHICLE_API StateProvider {
+      public:
+        virtual ~StateProvider() {}
+
+        /// Return the current state, encoded as a byte string.
+        virtual std::string GetState() = 0;
+
+        /// Set the state from its encoding.
+        virtual void SetState(const std::string& state) = 0;
+    };
+
+    /// State provider for an SCM deformable terrain (levels of all modified grid nodes).
+    class CH_VEHICLE_API SCMStateProvider : public StateProvider {
+      public:
+        SCMStateProvider(SCMTerrain& terrain) : m_terrain(terrain) {}
+        virtual std::string GetState() override;
+        virtual void SetState(const std::string& state) override;
+
+      private:
+        SCMTerrain& m_terrain;
+    };
+
+    /// Scenario to be restored from a snapshot.
+    struct Target {
+        ChSystem* system;                                    ///< Chrono system
+        std::vector<std::shared_ptr<StateProvider>> states;  ///< providers for additional states
+    };
+
+    ChScenarioSnapshot();
+
+    /// Capture the current state of the given system and the states of the given providers.
+    void Capture(ChSystem& sys, const std::vector<std::shared_ptr<StateProvider>>& states = {});
+
+    /// Restore the captured state into the given system and state providers.
+    /// An exception is thrown if the system is not compatible with the snapshot (different numbers of coordinates or
+    /// constraints) or if the number of state providers differs from the captured one.
+    void Restore(ChSystem& sys, const std::vector<std::shared_ptr<StateProvider>>& states = {}) const;
+
+    /// Fork the captured scenario into the specified number of copies.
+    /// For each copy, the given function is called with the copy index; it must construct a scenario identical to the
+    /// captured one and return its system and state providers, which are then set to the captured state. Copies are
+    /// constructed and restored in parallel, using the specified number of threads (if larger than 1, the function
+    /// must be thread safe). The caller keeps ownership of the constructed scenarios.
+    void Fork(int num_copies, std::function<Target(int)> construct, int num_threads = 1) const;
+
+    /// Return true if a state was captured or loaded.
+    bool IsValid() const { return m_valid; }
+
+    /// Get the time of the captured state.
+    double GetTime() const { return m_time; }
+
+    /// Write the snapshot to the specified file (binary archive).
+    void Write(const std::string& filename) const;
+
+    /// Read a snapshot from the specified file (binary archive).
+    void Read(const std::string& filename);
+
+  private:
+    bool m_valid;
+    double m_time;
+    unsigned int m_num_coords_pos;
+    unsigned int m_num_coords_vel;
+    unsigned int m_num_constr;
+    std::vector<double> m_x;            ///< position-level state
+    std::vector<double> m_v;            ///< velocity-level state
+    std::vector<double> m_a;            ///< accelerations
+    std::vector<double> m_L;            ///< constraint reactions
+    std::vector<std::string> m_states;  ///< additional states
+};
+
+/// @} vehicle
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -21,6 +21,7 @@
 #include <utility>
 
 #include "chrono_vehicle/utils/ChUtilsJSON.h"
+#include "chrono_vehicle/utils/ChVehicleModelCache.h"
 
 #include "chrono_vehicle/chassis/RigidChassis.h"
 #include "chrono_vehicle/chassis/ChassisConnectorHitch.h"
@@ -94,6 +95,7 @@
 #include "chrono_vehicle/tracked_vehicle/track_assembly/TrackAssemblyBandBushing.h"
 #include "chrono_vehicle/tracked_vehicle/track_assembly/TrackAssemblyDoublePin.h"
 #include "chrono_vehicle/tracked_vehicle/track_assembly/TrackAssemblySinglePin.h"
+#include "chrono_vehicle/tracked_vehicle/track_assembly/TrackAssemblyReduced.h"
 
 #include "chrono_thirdparty/rapidjson/filereadstream.h"
 #include "chrono_thirdparty/rapidjson/istreamwrapper.h"
@@ -106,6 +108,9 @@ namespace vehicle {
 // -----------------------------------------------------------------------------
 
 void ReadFileJSON(const std::string& filename, Document& d) {
+    if (ChVehicleModelCache::ReadJSON(filename, d))
+        return;
+
     std::ifstream ifs(filename);
     if (!ifs.good()) {
         std::cerr << "ERROR: Could not open JSON file: " << filename << std::endl;
@@ -1110,6 +1115,8 @@ std::shared_ptr<ChTrackAssembly> ReadTrackAssemblyJSON(const std::string& filena
         track = chrono_types::make_shared<TrackAssemblyBandBushing>(d);
     } else if (subtype.compare("TrackAssemblyBandANCF") == 0) {
         track = chrono_types::make_shared<TrackAssemblyBandANCF>(d);
+    } else if (subtype.compare("TrackAssemblyReduced") == 0) {
+        track = chrono_types::make_shared<TrackAssemblyReduced>(d);
     } else {
         throw std::invalid_argument("TrackAssembly type not supported in ReadTrackAssemblyJSON.");
     }
@@ -0,0 +1,506 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Binary cache of vehicle model specification files (JSON files and meshes).
+//
+// Cache file layout (native byte order, all offsets from the beginning of the
+// file, entry data aligned at 8 bytes):
+//   header:  tag "CHVC" (4 bytes), format version (uint32), number of entries (uint64)
+//   entries: type, name size (uint32), name offset, source file size (uint64),
+//            source modification time (int64), data offset, data size (uint64)
+//   entry names and entry data
+//
+// JSON entries contain the minified document text. Mesh entries contain the
+// array sizes (nv, nn, nuv, nf, face normal indices flag, face uv indices flag,
+// as uint64), followed by vertex, normal, and uv coordinates (double) and by the
+// face vertex, normal, and uv indices (int32).
+//
+// =============================================================================
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include <sys/stat.h>
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+#include "chrono/geometry/ChTriangleMeshCache.h"
+
+#include "chrono_vehicle/utils/ChVehicleModelCache.h"
+
+#include "chrono_thirdparty/rapidjson/istreamwrapper.h"
+#include "chrono_thirdparty/rapidjson/stringbuffer.h"
+#include "chrono_thirdparty/rapidjson/writer.h"
+
+using namespace rapidjson;
+
+namespace chrono {
+namespace vehicle {
+
+static const char cache_tag[4] = {'C', 'H', 'V', 'C'};
+static const uint32_t cache_version = 1;
+
+enum EntryType : uint32_t { JSON_ENTRY = 1, MESH_ENTRY = 2 };
+
+struct FileHeader {
+    char tag[4];
+    uint32_t version;
+    uint64_t num_entries;
+};
+
+struct EntryHeader {
+    uint32_t type;
+    uint32_t name_size;
+    uint64_t name_offset;
+    uint64_t source_size;
+    int64_t source_time;
+    uint64_t data_offset;
+    uint64_t data_size;
+};
+
+// Read-only view of a cache file (memory-mapped where supported)
+class CacheFile {
+  public:
+    ~CacheFile() {
+#if !defined(_WIN32)
+        if (m_data)
+            munmap(const_cast<char*>(m_data), m_size);
+#endif
+    }
+
+    bool Open(const std::string& filename) {
+#if defined(_WIN32)
+        std::ifstream file(filename, std::ios::binary);
+        if (!file.good())
+            return false;
+        m_buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+        return true;
+#else
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+        struct stat sb;
+        if (fstat(fd, &sb) != 0 || sb.st_size == 0) {
+            close(fd);
+            return false;
+        }
+        void* data = mmap(nullptr, (size_t)sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED)
+            return false;
+        m_data = static_cast<const char*>(data);
+        m_size = (size_t)sb.st_size;
+        return true;
+#endif
+    }
+
+    const char* Data() const { return m_data; }
+    size_t Size() const { return m_size; }
+
+  private:
+    const char* m_data = nullptr;
+    size_t m_size = 0;
+#if defined(_WIN32)
+    std::vector<char> m_buffer;
+#endif
+};
+
+// Cache entry (data points into the loaded cache file)
+struct CacheEntry {
+    uint32_t type;
+    uint64_t source_size;
+    int64_t source_time;
+    const char* data;
+    uint64_t size;
+};
+
+static std::mutex cache_mutex;
+static std::unique_ptr<CacheFile> cache_file;
+static std::unordered_map<std::string, CacheEntry> cache_entries[2];  // JSON and mesh entries
+static bool cache_validate = true;
+static bool recording = false;
+static std::set<std::string> recorded_files[2];  // JSON and mesh files
+
+static bool GetFileInfo(const std::string& filename, uint64_t& size, int64_t& time) {
+#if defined(_WIN32)
+    struct _stat64 sb;
+    if (_stat64(filename.c_str(), &sb) != 0)
+        return false;
+#else
+    struct stat sb;
+    if (stat(filename.c_str(), &sb) != 0)
+        return false;
+#endif
+    size = (uint64_t)sb.st_size;
+    time = (int64_t)sb.st_mtime;
+    return true;
+}
+
+// Find a valid cache entry for the specified file (must be called with the cache mutex locked)
+static const CacheEntry* FindEntry(EntryType type, const std::string& filename) {
+    auto& entries = cache_entries[type - 1];
+    auto entry = entries.find(filename);
+    if (entry == entries.end())
+        return nullptr;
+
+    // Ignore the entry if the source file exists and has changed
+    uint64_t size;
+    int64_t time;
+    if (cache_validate && GetFileInfo(filename, size, time) &&
+        (size != entry->second.source_size || time != entry->second.source_time))
+        return nullptr;
+
+    return &entry->second;
+}
+
+// -----------------------------------------------------------------------------
+
+static bool EncodeJSON(const std::string& filename, std::string& data) {
+    std::ifstream ifs(filename);
+    if (!ifs.good())
+        return false;
+    IStreamWrapper isw(ifs);
+    Document d;
+    d.ParseStream<ParseFlag::kParseCommentsFlag>(isw);
+    if (d.HasParseError())
+        return false;
+
+    StringBuffer buffer;
+    Writer<StringBuffer> writer(buffer);
+    d.Accept(writer);
+    data.assign(buffer.GetString(), buffer.GetSize());
+    return true;
+}
+
+template <typename T>
+static void Append(std::string& data, const T* values, size_t count) {
+    data.append(reinterpret_cast<const char*>(values), count * sizeof(T));
+}
+
+static bool EncodeMesh(const std::string& filename, std::string& data) {
+    std::ifstream ifs(filename);
+    if (!ifs.good())
+        return false;
+    auto trimesh = ChTriangleMeshConnected::CreateFromWavefrontFile(filename, true, true);
+    if (!trimesh)
+        return false;
+
+    const auto& vertices = trimesh->GetCoordsVertices();
+    const auto& normals = trimesh->GetCoordsNormals();
+    const auto& uv = trimesh->GetCoordsUV();
+    const auto& face_v = trimesh->GetIndicesVertexes();
+    const auto& face_n = trimesh->GetIndicesNormals();
+    const auto& face_uv = trimesh->GetIndicesUV();
+
+    uint64_t sizes[6] = {vertices.size(), normals.size(), uv.size(), face_v.size(), !face_n.empty(), !face_uv.empty()};
+    Append(data, sizes, 6);
+
+    std::vector<double> coords;
+    coords.reserve(3 * vertices.size() + 3 * normals.size() + 2 * uv.size());
+    for (const auto& v : vertices)
+        coords.insert(coords.end(), {v.x(), v.y(), v.z()});
+    for (const auto& n : normals)
+        coords.insert(coords.end(), {n.x(), n.y(), n.z()});
+    for (const auto& t : uv)
+        coords.insert(coords.end(), {t.x(), t.y()});
+    Append(data, coords.data(), coords.size());
+
+    std::vector<int32_t> indices;
+    indices.reserve(9 * face_v.size());
+    for (const auto& f : face_v)
+        indices.insert(indices.end(), {f.x(), f.y(), f.z()});
+    for (const auto& f : face_n)
+        indices.insert(indices.end(), {f.x(), f.y(), f.z()});
+    for (const auto& f : face_uv)
+        indices.insert(indices.end(), {f.x(), f.y(), f.z()});
+    Append(data, indices.data(), indices.size());
+
+    return true;
+}
+
+static std::shared_ptr<ChTriangleMeshConnected> DecodeMesh(const std::string& filename,
+                                                           const CacheEntry& entry,
+                                                           bool load_normals,
+                                                           bool load_uv) {
+    if (entry.size < 6 * sizeof(uint64_t))
+        return nullptr;
+    const uint64_t* sizes = reinterpret_cast<const uint64_t*>(entry.data);
+    uint64_t nv = sizes[0];
+    uint64_t nn = sizes[1];
+    uint64_t nuv = sizes[2];
+    uint64_t nf = sizes[3];
+    uint64_t nf_n = sizes[4] ? nf : 0;
+    uint64_t nf_uv = sizes[5] ? nf : 0;
+    uint64_t num_coords = 3 * nv + 3 * nn + 2 * nuv;
+    uint64_t num_indices = 3 * (nf + nf_n + nf_uv);
+    if (entry.size != 6 * sizeof(uint64_t) + num_coords * sizeof(double) + num_indices * sizeof(int32_t))
+        return nullptr;
+
+    const double* c = reinterpret_cast<const double*>(entry.data + 6 * sizeof(uint64_t));
+    const int32_t* i = reinterpret_cast<const int32_t*>(c + num_coords);
+
+    auto trimesh = chrono_types::make_shared<ChTriangleMeshConnected>();
+    trimesh->m_filename = filename;
+
+    auto& vertices = trimesh->GetCoordsVertices();
+    vertices.reserve(nv);
+    for (uint64_t k = 0; k < nv; k++, c += 3)
+        vertices.push_back(ChVector3d(c[0], c[1], c[2]));
+    if (load_normals) {
+        auto& normals = trimesh->GetCoordsNormals();
+        normals.reserve(nn);
+        for (uint64_t k = 0; k < nn; k++, c += 3)
+            normals.push_back(ChVector3d(c[0], c[1], c[2]));
+    } else {
+        c += 3 * nn;
+    }
+    if (load_uv) {
+        auto& uv = trimesh->GetCoordsUV();
+        uv.reserve(nuv);
+        for (uint64_t k = 0; k < nuv; k++, c += 2)
+            uv.push_back(ChVector2d(c[0], c[1]));
+    }
+
+    auto& face_v = trimesh->GetIndicesVertexes();
+    face_v.reserve(nf);
+    for (uint64_t k = 0; k < nf; k++, i += 3)
+        face_v.push_back(ChVector3i(i[0], i[1], i[2]));
+    if (load_normals && nn > 0) {
+        auto& face_n = trimesh->GetIndicesNormals();
+        face_n.reserve(nf_n);
+        for (uint64_t k = 0; k < nf_n; k++, i += 3)
+            face_n.push_back(ChVector3i(i[0], i[1], i[2]));
+    } else {
+        i += 3 * nf_n;
+    }
+    if (load_uv && nuv > 0) {
+        auto& face_uv = trimesh->GetIndicesUV();
+        face_uv.reserve(nf_uv);
+        for (uint64_t k = 0; k < nf_uv; k++, i += 3)
+            face_uv.push_back(ChVector3i(i[0], i[1], i[2]));
+    }
+
+    return trimesh;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVehicleModelCache::StartRecording() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    recording = true;
+}
+
+void ChVehicleModelCache::StopRecording() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    recording = false;
+}
+
+bool ChVehicleModelCache::Write(const std::string& filename) {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+
+    struct Item {
+        uint32_t type;
+        std::string name;
+        uint64_t source_size;
+        int64_t source_time;
+        std::string data;
+    };
+    std::vector<Item> items;
+
+    // Entries of the currently loaded cache, unless recorded again
+    for (uint32_t type = JSON_ENTRY; type <= MESH_ENTRY; type++) {
+        for (const auto& entry : cache_entries[type - 1]) {
+            if (recorded_files[type - 1].count(entry.first))
+                continue;
+            const auto& e = entry.second;
+            items.push_back({type, entry.first, e.source_size, e.source_time, std::string(e.data, e.size)});
+        }
+    }
+
+    // Recorded files
+    for (uint32_t type = JSON_ENTRY; type <= MESH_ENTRY; type++) {
+        for (const auto& name : recorded_files[type - 1]) {
+            Item item{type, name, 0, 0, ""};
+            bool ok = GetFileInfo(name, item.source_size, item.source_time) &&
+                      (type == JSON_ENTRY ? EncodeJSON(name, item.data) : EncodeMesh(name, item.data));
+            if (!ok) {
+                std::cerr << "WARNING: ChVehicleModelCache: cannot cache file " << name << std::endl;
+                continue;
+            }
+            items.push_back(std::move(item));
+        }
+    }
+
+    // Layout of the names and data blocks
+    auto align = [](uint64_t offset) { return (offset + 7) & ~uint64_t(7); };
+    std::vector<EntryHeader> headers(items.size());
+    uint64_t offset = sizeof(FileHeader) + items.size() * sizeof(EntryHeader);
+    for (size_t k = 0; k < items.size(); k++) {
+        headers[k].type = items[k].type;
+        headers[k].name_size = (uint32_t)items[k].name.size();
+        headers[k].name_offset = offset;
+        headers[k].source_size = items[k].source_size;
+        headers[k].source_time = items[k].source_time;
+        offset += items[k].name.size();
+    }
+    for (size_t k = 0; k < items.size(); k++) {
+        offset = align(offset);
+        headers[k].data_offset = offset;
+        headers[k].data_size = items[k].data.size();
+        offset += items[k].data.size();
+    }
+
+    // Write to a temporary file, then replace the cache file (which may be currently mapped)
+    std::string tmp_filename = filename + ".tmp";
+    {
+        std::ofstream file(tmp_filename, std::ios::binary);
+        FileHeader header;
+        std::memcpy(header.tag, cache_tag, 4);
+        header.version = cache_version;
+        header.num_entries = items.size();
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(headers.data()), headers.size() * sizeof(EntryHeader));
+        for (const auto& item : items)
+            file.write(item.name.data(), item.name.size());
+        for (size_t k = 0; k < items.size(); k++) {
+            static const char padding[8] = {0};
+            file.write(padding, headers[k].data_offset - (uint64_t)file.tellp());
+            file.write(items[k].data.data(), items[k].data.size());
+        }
+        if (!file.good()) {
+            std::cerr << "ERROR: ChVehicleModelCache: cannot write cache file " << filename << std::endl;
+            return false;
+        }
+    }
+    std::remove(filename.c_str());
+    if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+        std::cerr << "ERROR: ChVehicleModelCache: cannot write cache file " << filename << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool ChVehicleModelCache::Load(const std::string& filename, bool validate) {
+    std::unique_ptr<CacheFile> file(new CacheFile);
+    if (!file->Open(filename)) {
+        std::cerr << "ERROR: ChVehicleModelCache: cannot open cache file " << filename << std::endl;
+        return false;
+    }
+
+    const char* data = file->Data();
+    uint64_t size = file->Size();
+    FileHeader header;
+    if (size < sizeof(FileHeader)) {
+        std::cerr << "ERROR: ChVehicleModelCache: invalid cache file " << filename << std::endl;
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.tag, cache_tag, 4) != 0 || header.version != cache_version ||
+        header.num_entries > (size - sizeof(FileHeader)) / sizeof(EntryHeader)) {
+        std::cerr << "ERROR: ChVehicleModelCache: invalid cache file " << filename << std::endl;
+        return false;
+    }
+
+    std::unordered_map<std::string, CacheEntry> entries[2];
+    for (uint64_t k = 0; k < header.num_entries; k++) {
+        EntryHeader e;
+        std::memcpy(&e, data + sizeof(FileHeader) + k * sizeof(EntryHeader), sizeof(e));
+        bool valid = (e.type == JSON_ENTRY || e.type == MESH_ENTRY) && e.name_offset <= size &&
+                     e.name_size <= size - e.name_offset && e.data_offset <= size &&
+                     e.data_size <= size - e.data_offset && e.data_offset % 8 == 0;
+        if (!valid) {
+            std::cerr << "ERROR: ChVehicleModelCache: invalid cache file " << filename << std::endl;
+            return false;
+        }
+        std::string name(data + e.name_offset, e.name_size);
+        entries[e.type - 1][name] = {e.type, e.source_size, e.source_time, data + e.data_offset, e.data_size};
+    }
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    cache_file = std::move(file);
+    cache_entries[0] = std::move(entries[0]);
+    cache_entries[1] = std::move(entries[1]);
+    cache_validate = validate;
+    return true;
+}
+
+void ChVehicleModelCache::Unload() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    cache_entries[0].clear();
+    cache_entries[1].clear();
+    cache_file.reset();
+}
+
+bool ChVehicleModelCache::IsLoaded() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return cache_file != nullptr;
+}
+
+size_t ChVehicleModelCache::GetNumEntries() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return cache_entries[0].size() + cache_entries[1].size();
+}
+
+bool ChVehicleModelCache::ReadJSON(const std::string& filename, Document& d) {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    const CacheEntry* entry = FindEntry(JSON_ENTRY, filename);
+    if (!entry) {
+        if (recording)
+            recorded_files[JSON_ENTRY - 1].insert(filename);
+        return false;
+    }
+
+    d.Parse(entry->data, entry->size);
+    return !d.HasParseError();
+}
+
+std::shared_ptr<ChTriangleMeshConnected> ChVehicleModelCache::ReadMesh(const std::string& filename,
+                                                                       bool load_normals,
+                                                                       bool load_uv) {
+    // Meshes are shared through the process-wide mesh cache; the loaded cache file (if any) or the OBJ file are only
+    // read the first time a given mesh is requested
+    std::string variant = std::string("obj") + (load_normals ? "n" : "") + (load_uv ? "t" : "");
+    return ChTriangleMeshCache::Load(filename, variant, [load_normals, load_uv](const std::string& file) {
+        {
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            const CacheEntry* entry = FindEntry(MESH_ENTRY, file);
+            if (entry) {
+                auto trimesh = DecodeMesh(file, *entry, load_normals, load_uv);
+                if (trimesh)
+                    return trimesh;
+            }
+            if (recording)
+                recorded_files[MESH_ENTRY - 1].insert(file);
+        }
+
+        return ChTriangleMeshConnected::CreateFromWavefrontFile(file, load_normals, load_uv);
+    });
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,93 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Binary cache of vehicle model specification files (JSON files and meshes).
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_MODEL_CACHE_H
+#define CH_VEHICLE_MODEL_CACHE_H
+
+#include <memory>
+#include <string>
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+#include "chrono_vehicle/ChApiVehicle.h"
+
+#include "chrono_thirdparty/rapidjson/document.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle
+/// @{
+
+/// Binary cache of vehicle model specification files.
+/// A cache file collects, in a single file, all JSON specification files (read with ReadFileJSON) and all Wavefront
+/// OBJ meshes (read with ChVehicleModelCache::ReadMesh) used to construct a set of vehicle models. JSON documents are
+/// stored minified and meshes are stored as binary arrays of vertex data and face indices, so that no OBJ parsing is
+/// needed when loading from the cache.
+///
+/// Typical use, for a batch of runs with the same vehicle models:
+/// - create the models once with recording enabled (StartRecording) and write the cache file (Write);
+/// - in each run, load the cache file (Load) before constructing the models.
+///
+/// A loaded cache file is memory-mapped (where supported) and shared by all vehicles constructed in the process.
+/// Files not found in the cache are read from disk. Cache entries record the size and modification time of their
+/// source files; if validation is enabled, an entry is ignored if its source file exists and has changed.
+class CH_VEHICLE_API ChVehicleModelCache {
+  public:
+    /// Start recording the names of all specification files and meshes read from disk.
+    static void StartRecording();
+
+    /// Stop recording.
+    static void StopRecording();
+
+    /// Write all recorded files (as well as the entries of the currently loaded cache) to the specified cache file.
+    /// Return false if the cache file could not be written.
+    static bool Write(const std::string& filename);
+
+    /// Load the specified cache file (replacing any currently loaded cache).
+    /// Return false if the file could not be opened or is not a valid cache file of the current version.
+    static bool Load(const std::string& filename, bool validate = true);
+
+    /// Unload the current cache file.
+    static void Unload();
+
+    /// Return true if a cache file is loaded.
+    static bool IsLoaded();
+
+    /// Get the number of entries in the loaded cache file.
+    static size_t GetNumEntries();
+
+    /// Parse the specified JSON file from the loaded cache.
+    /// Return false if the file is not in the cache (recording the file name if recording is enabled).
+    static bool ReadJSON(const std::string& filename, rapidjson::Document& d);
+
+    /// Load a mesh from the specified Wavefront OBJ file, using the loaded cache if possible.
+    /// This function can be used in place of ChTriangleMeshConnected::CreateFromWavefrontFile. Meshes are managed by
+    /// the process-wide ChTriangleMeshCache: all callers requesting the same mesh share a single, immutable, instance
+    /// (use Clone() to obtain a modifiable copy).
+    static std::shared_ptr<ChTriangleMeshConnected> ReadMesh(const std::string& filename,
+                                                             bool load_normals = true,
+                                                             bool load_uv = false);
+};
+
+/// @} vehicle
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
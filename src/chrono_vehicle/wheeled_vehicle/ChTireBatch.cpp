@@ -0,0 +1,90 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Batch of tires synchronized and advanced together.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <exception>
+#include <typeindex>
+
+#include "chrono_vehicle/wheeled_vehicle/ChTireBatch.h"
+#include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChTireBatch::ChTireBatch() : m_num_threads(1), m_sorted(true) {}
+
+void ChTireBatch::SetNumThreads(int num_threads) {
+    m_num_threads = std::max(num_threads, 1);
+}
+
+void ChTireBatch::AddTire(std::shared_ptr<ChTire> tire) {
+    m_tires.push_back(tire);
+    m_sorted = false;
+}
+
+void ChTireBatch::AddTires(const ChWheeledVehicle& vehicle) {
+    for (const auto& axle : vehicle.GetAxles()) {
+        for (const auto& wheel : axle->GetWheels()) {
+            if (wheel->GetTire())
+                AddTire(wheel->GetTire());
+        }
+    }
+}
+
+void ChTireBatch::Sort() {
+    std::stable_sort(m_tires.begin(), m_tires.end(),
+                     [](const std::shared_ptr<ChTire>& a, const std::shared_ptr<ChTire>& b) {
+                         return std::type_index(typeid(*a)) < std::type_index(typeid(*b));
+                     });
+    m_sorted = true;
+}
+
+// Process all tires in parallel, in contiguous ranges. An exception thrown while processing a tire is rethrown after
+// the parallel loop (if several tires throw, only one of the exceptions is propagated).
+template <typename Function>
+static void ProcessTires(int num_tires, int num_threads, Function f) {
+    std::exception_ptr exception;
+
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+    for (int i = 0; i < num_tires; i++) {
+        try {
+            f(i);
+        } catch (...) {
+#pragma omp critical(ChTireBatch)
+            exception = std::current_exception();
+        }
+    }
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+void ChTireBatch::Synchronize(double time, const ChTerrain& terrain) {
+    if (!m_sorted)
+        Sort();
+    ProcessTires(GetNumTires(), m_num_threads, [&](int i) { m_tires[i]->Synchronize(time, terrain); });
+}
+
+void ChTireBatch::Advance(double step) {
+    if (!m_sorted)
+        Sort();
+    ProcessTires(GetNumTires(), m_num_threads, [&](int i) { m_tires[i]->Advance(step); });
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,90 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Batch of tires synchronized and advanced together.
+//
+// =============================================================================
+
+#ifndef CH_TIRE_BATCH_H
+#define CH_TIRE_BATCH_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/ChTerrain.h"
+#include "chrono_vehicle/wheeled_vehicle/ChTire.h"
+
+namespace chrono {
+namespace vehicle {
+
+class ChWheeledVehicle;
+
+/// @addtogroup vehicle_wheeled
+/// @{
+
+/// Batch of tires synchronized and advanced together.
+/// Between two consecutive steps of the containing Chrono system(s), each tire is processed independently of all other
+/// tires. This class synchronizes and advances a set of tires (typically all tires of a fleet of vehicles, see
+/// ChWheeledVehicleFleet) in parallel, using a team of OpenMP threads of the size set with SetNumThreads. Tires are
+/// ordered by their concrete type and distributed to threads in contiguous ranges, so that each thread evaluates long
+/// runs of tires with the same model.
+///
+/// Tires of a vehicle added to a batch must not also be advanced by that vehicle (see
+/// ChWheeledVehicle::EnableTireAdvance). As for ChWheeledVehicleFleet, terrain queries are performed concurrently.
+class CH_VEHICLE_API ChTireBatch {
+  public:
+    ChTireBatch();
+
+    ~ChTireBatch() {}
+
+    /// Set the number of OpenMP threads used to process the tires in the batch (default: 1).
+    void SetNumThreads(int num_threads);
+
+    /// Get the number of OpenMP threads used to process the tires in the batch.
+    int GetNumThreads() const { return m_num_threads; }
+
+    /// Add the specified tire to the batch.
+    void AddTire(std::shared_ptr<ChTire> tire);
+
+    /// Add all tires of the specified vehicle to the batch.
+    /// This function should be called after the vehicle tires were initialized.
+    void AddTires(const ChWheeledVehicle& vehicle);
+
+    /// Get the number of tires in the batch.
+    int GetNumTires() const { return (int)m_tires.size(); }
+
+    /// Remove all tires from the batch.
+    void Clear() { m_tires.clear(); }
+
+    /// Synchronize all tires in the batch at the specified time.
+    void Synchronize(double time, const ChTerrain& terrain);
+
+    /// Advance the states of all tires in the batch by the specified duration.
+    void Advance(double step);
+
+  private:
+    void Sort();
+
+    int m_num_threads;                             ///< number of OpenMP threads
+    std::vector<std::shared_ptr<ChTire>> m_tires;  ///< tires in batch
+    bool m_sorted;                                 ///< are the tires ordered by type?
+};
+
+/// @} vehicle_wheeled
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
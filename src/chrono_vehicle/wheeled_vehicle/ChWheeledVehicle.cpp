@@ -16,6 +16,8 @@
 //
 // =============================================================================
 
+#include "chrono/utils/ChTraceProfiler.h"
+
 #include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicle.h"
 
 #include "chrono_thirdparty/rapidjson/document.h"
@@ -28,10 +30,10 @@ namespace vehicle {
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
 ChWheeledVehicle::ChWheeledVehicle(const std::string& name, ChContactMethod contact_method)
-    : ChVehicle(name, contact_method), m_parking_on(false) {}
+    : ChVehicle(name, contact_method), m_parking_on(false), m_advance_tires(true) {}
 
 ChWheeledVehicle::ChWheeledVehicle(const std::string& name, ChSystem* system)
-    : ChVehicle(name, system), m_parking_on(false) {}
+    : ChVehicle(name, system), m_parking_on(false), m_advance_tires(true) {}
 
 // -----------------------------------------------------------------------------
 // Initialize a tire and attach it to one of the vehicle's wheels.
@@ -57,6 +59,8 @@ void ChWheeledVehicle::InitializeTire(std::shared_ptr<ChTire> tire,
 // to the terrain system.
 // -----------------------------------------------------------------------------
 void ChWheeledVehicle::Synchronize(double time, const DriverInputs& driver_inputs) {
+    CH_TRACE("Vehicle::Synchronize");
+
     double powertrain_torque = m_powertrain_assembly ? m_powertrain_assembly->GetOutputTorque() : 0;
     double driveline_speed = m_driveline ? m_driveline->GetOutputDriveshaftSpeed() : 0;
 
@@ -90,6 +94,8 @@ void ChWheeledVehicle::Synchronize(double time, const DriverInputs& driver_input
 }
 
 void ChWheeledVehicle::Synchronize(double time, const DriverInputs& driver_inputs, const ChTerrain& terrain) {
+    CH_TRACE("Vehicle::SynchronizeTires");
+
     // Synchronize any associated tires
     for (auto& axle : m_axles) {
         for (auto& wheel : axle->GetWheels()) {
@@ -114,9 +120,11 @@ void ChWheeledVehicle::Advance(double step) {
     // This is done before advancing the state of the multibody system in order to use wheel states corresponding to
     // current time.
     for (auto& axle : m_axles) {
-        for (auto& wheel : axle->GetWheels()) {
-            if (wheel->m_tire)
-                wheel->m_tire->Advance(step);
+        if (m_advance_tires) {
+            for (auto& wheel : axle->GetWheels()) {
+                if (wheel->m_tire)
+                    wheel->m_tire->Advance(step);
+            }
         }
         axle->Advance(step);
     }
@@ -208,9 +208,14 @@ class CH_VEHICLE_API ChWheeledVehicle : public ChVehicle {
 
     /// Advance the state of this vehicle by the specified time step.
     /// In addition to advancing the state of the multibody system (if the vehicle owns the underlying system), this
-    /// function also advances the state of the associated powertrain and the states of all associated tires.
+    /// function also advances the state of the associated powertrain and the states of all associated tires (unless
+    /// disabled with EnableTireAdvance).
     virtual void Advance(double step) override final;
 
+    /// Enable/disable advancing the states of the associated tires in Advance (default: true).
+    /// Disable this only if the tires are advanced separately (see ChTireBatch).
+    void EnableTireAdvance(bool val) { m_advance_tires = val; }
+
     /// Lock/unlock the differential on the specified axle.
     /// By convention, axles are counted front to back, starting with index 0.
     void LockAxleDifferential(int axle, bool lock);
@@ -273,6 +278,7 @@ class CH_VEHICLE_API ChWheeledVehicle : public ChVehicle {
     ChSteeringList m_steerings;                  ///< list of steering subsystems
     std::shared_ptr<ChDrivelineWV> m_driveline;  ///< driveline subsystem
     bool m_parking_on;                           ///< indicates whether or not parking brake is engaged
+    bool m_advance_tires;                        ///< advance associated tires in Advance?
 };
 
 /// @} vehicle_wheeled
@@ -0,0 +1,92 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Manager for a fleet of wheeled vehicles, with parallel synchronization and
+// advance of the vehicle subsystems.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicleFleet.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChWheeledVehicleFleet::ChWheeledVehicleFleet() : m_scheduler(1), m_batch_tires(false) {}
+
+void ChWheeledVehicleFleet::SetNumThreads(int num_threads) {
+    num_threads = std::max(num_threads, 1);
+    m_scheduler.SetNumThreads(num_threads);
+    m_tires.SetNumThreads(num_threads);
+}
+
+int ChWheeledVehicleFleet::AddVehicle(ChWheeledVehicle* vehicle, ChDriver* driver) {
+    // A vehicle advancing a system shared with other vehicles could not be processed concurrently with them
+    for (const auto& entry : m_vehicles) {
+        if (entry.vehicle->GetSystem() != vehicle->GetSystem())
+            continue;
+        if (entry.vehicle->OwnsSystem() || vehicle->OwnsSystem())
+            throw std::invalid_argument("ChWheeledVehicleFleet: fleet vehicle owns a shared Chrono system");
+    }
+
+    m_vehicles.push_back({vehicle, driver, {0, 0, 0, 0}});
+
+    if (m_batch_tires) {
+        m_tires.AddTires(*vehicle);
+        vehicle->EnableTireAdvance(false);
+    }
+
+    return (int)m_vehicles.size() - 1;
+}
+
+// An exception thrown while processing a vehicle is rethrown by the scheduler once all tasks completed (if several
+// vehicles throw, only one of the exceptions is propagated).
+void ChWheeledVehicleFleet::ProcessVehicles(const std::function<void(int)>& func) {
+    m_scheduler.ParallelFor(0, GetNumVehicles(), func, GetNumVehicles());
+}
+
+void ChWheeledVehicleFleet::Synchronize(double time, const ChTerrain& terrain) {
+    // Synchronize the tires first, as the wheels apply the tire forces when the vehicles are synchronized
+    if (m_batch_tires)
+        m_tires.Synchronize(time, terrain);
+
+    ProcessVehicles([&](int i) {
+        auto& entry = m_vehicles[i];
+        if (entry.driver) {
+            entry.driver->Synchronize(time);
+            entry.inputs = entry.driver->GetInputs();
+        }
+        if (m_batch_tires)
+            entry.vehicle->Synchronize(time, entry.inputs);
+        else
+            entry.vehicle->Synchronize(time, entry.inputs, terrain);
+    });
+}
+
+void ChWheeledVehicleFleet::Advance(double step) {
+    if (m_batch_tires)
+        m_tires.Advance(step);
+
+    ProcessVehicles([&](int i) {
+        auto& entry = m_vehicles[i];
+        if (entry.driver)
+            entry.driver->Advance(step);
+        entry.vehicle->Advance(step);
+    });
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
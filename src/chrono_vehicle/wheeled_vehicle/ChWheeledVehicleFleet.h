@@ -0,0 +1,129 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Manager for a fleet of wheeled vehicles, with parallel synchronization and
+// advance of the vehicle subsystems.
+//
+// =============================================================================
+
+#ifndef CH_WHEELED_VEHICLE_FLEET_H
+#define CH_WHEELED_VEHICLE_FLEET_H
+
+#include <functional>
+#include <vector>
+
+#include "chrono/core/ChTaskScheduler.h"
+
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/ChDriver.h"
+#include "chrono_vehicle/ChTerrain.h"
+#include "chrono_vehicle/wheeled_vehicle/ChTireBatch.h"
+#include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_wheeled
+/// @{
+
+/// Manager for a fleet of wheeled vehicles.
+/// The vehicle subsystems (tires, drivers, powertrain assemblies, driveline, steering, etc.) of different vehicles are
+/// independent between two consecutive steps of the containing Chrono system(s). This class synchronizes and advances
+/// the subsystems of all vehicles in the fleet (with their drivers, if any) in parallel, using a task scheduler owned
+/// by the fleet manager, with the number of threads set with SetNumThreads. Each vehicle is processed as a separate
+/// task, so that vehicles of different complexity are balanced over the threads.
+///
+/// Vehicles may share a Chrono system, in which case it is the caller's responsibility to advance that system after
+/// the call to Advance, or each vehicle may own its system, in which case the systems are advanced in parallel. A
+/// vehicle owning a system shared with other vehicles in the fleet is not allowed.
+///
+/// During Synchronize, tire models query the terrain concurrently from multiple threads. The terrain queries must
+/// therefore be safe for concurrent calls: this is the case for FlatTerrain and RigidTerrain (with the Bullet
+/// collision system) but not for CRGTerrain (which keeps track of the last queried road location). With any other
+/// terrain, or with user-provided terrain functors that are not thread-safe, use a single thread.
+class CH_VEHICLE_API ChWheeledVehicleFleet {
+  public:
+    ChWheeledVehicleFleet();
+
+    ~ChWheeledVehicleFleet() {}
+
+    /// Set the number of threads used to process the fleet vehicles (default: 1).
+    /// This includes the calling thread, which participates in processing the vehicles. The tire batch (see
+    /// EnableTireBatching) uses the same number of threads.
+    void SetNumThreads(int num_threads);
+
+    /// Get the number of threads used to process the fleet vehicles.
+    int GetNumThreads() const { return m_scheduler.GetNumThreads(); }
+
+    /// Enable/disable processing of the tires of all fleet vehicles as a single batch (default: false).
+    /// If enabled, the tires of all fleet vehicles are synchronized and advanced in one parallel loop over all tires
+    /// (see ChTireBatch), rather than as part of each vehicle. This gives a better load balance for large fleets, and
+    /// the tires of different vehicles using the same tire model are processed together. Vehicles (with initialized
+    /// tires) added to a fleet with tire batching enabled are set to not advance their tires themselves.
+    /// This function must be called before adding vehicles to the fleet.
+    void EnableTireBatching(bool val) { m_batch_tires = val; }
+
+    /// Add a vehicle to the fleet, with an optional driver, and return its index in the fleet.
+    /// If no driver is specified, the vehicle uses the driver inputs set through SetDriverInputs.
+    /// An exception is thrown if the vehicle shares a Chrono system with another fleet vehicle and one of them owns
+    /// that system.
+    int AddVehicle(ChWheeledVehicle* vehicle, ChDriver* driver = nullptr);
+
+    /// Get the number of vehicles in the fleet.
+    int GetNumVehicles() const { return (int)m_vehicles.size(); }
+
+    /// Get the specified fleet vehicle.
+    ChWheeledVehicle* GetVehicle(int index) const { return m_vehicles[index].vehicle; }
+
+    /// Get the driver of the specified fleet vehicle (nullptr if none).
+    ChDriver* GetDriver(int index) const { return m_vehicles[index].driver; }
+
+    /// Set the driver inputs for the specified fleet vehicle.
+    /// These inputs are used only for a vehicle without driver; otherwise, they are overwritten at each Synchronize.
+    void SetDriverInputs(int index, const DriverInputs& inputs) { m_vehicles[index].inputs = inputs; }
+
+    /// Get the current driver inputs of the specified fleet vehicle.
+    const DriverInputs& GetDriverInputs(int index) const { return m_vehicles[index].inputs; }
+
+    /// Synchronize all fleet vehicles and their drivers at the specified time.
+    /// For each vehicle, the driver (if any) is synchronized first and its current inputs are then passed to the
+    /// vehicle, together with the given terrain. With tire batching, all tires are synchronized first.
+    void Synchronize(double time, const ChTerrain& terrain);
+
+    /// Advance the state of all fleet vehicles and their drivers by the specified duration.
+    /// Chrono systems shared by fleet vehicles are not advanced.
+    void Advance(double step);
+
+  private:
+    struct Entry {
+        ChWheeledVehicle* vehicle;  ///< fleet vehicle
+        ChDriver* driver;           ///< associated driver (may be null)
+        DriverInputs inputs;        ///< current driver inputs
+    };
+
+    /// Process all fleet vehicles in parallel, one task per vehicle.
+    void ProcessVehicles(const std::function<void(int)>& func);
+
+    ChTaskScheduler m_scheduler;    ///< thread pool for processing the fleet vehicles
+    std::vector<Entry> m_vehicles;  ///< fleet vehicles
+    bool m_batch_tires;             ///< process tires of all vehicles as a batch?
+    ChTireBatch m_tires;            ///< batch of the tires of all fleet vehicles
+};
+
+/// @} vehicle_wheeled
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
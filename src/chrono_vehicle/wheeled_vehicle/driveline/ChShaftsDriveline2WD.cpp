@@ -39,10 +39,16 @@ ChShaftsDriveline2WD::~ChShaftsDriveline2WD() {
     if (!m_initialized)
         return;
 
-    auto sys = m_differential->GetSystem();
+    auto sys = m_clutch->GetSystem();
     if (!sys)
         return;
 
+    if (m_network) {
+        sys->Remove(m_network);
+        sys->Remove(m_clutch);
+        return;
+    }
+
     sys->Remove(m_driveshaft);
     sys->Remove(m_conicalgear);
     sys->Remove(m_differentialbox);
@@ -67,6 +73,38 @@ void ChShaftsDriveline2WD::Initialize(std::shared_ptr<ChChassis> chassis,
     auto chassisBody = chassis->GetBody();
     auto sys = chassisBody->GetSystem();
 
+    auto axle_L = axles[m_driven_axles[0]]->m_suspension->GetAxle(LEFT);
+    auto axle_R = axles[m_driven_axles[0]]->m_suspension->GetAxle(RIGHT);
+
+    if (m_reduced_network) {
+        // Reduced model of the driveshaft, conical gear, differential box, and differential.
+        // The reaction torque of the conical gear on the chassis is not modeled.
+        m_network = chrono_types::make_shared<ChShaftsNetwork>();
+        m_driveshaft_index = m_network->AddShaft(GetDriveshaftInertia());
+        int box = m_network->AddShaft(GetDifferentialBoxInertia());
+        m_axle_index[LEFT] = m_network->AddShaft(axle_L);
+        m_axle_index[RIGHT] = m_network->AddShaft(axle_R);
+        m_network->AddGear(m_driveshaft_index, box, -GetConicalGearRatio());
+        m_network->AddPlanetary(box, m_axle_index[LEFT], m_axle_index[RIGHT], -1.0);
+        m_network->Initialize();
+        sys->Add(m_network);
+    } else {
+        InitializeShafts(chassisBody, axle_L, axle_R);
+    }
+
+    // Create the clutch for differential locking. By default, unlocked.
+    m_clutch = chrono_types::make_shared<ChShaftsClutch>();
+    m_clutch->Initialize(axle_L, axle_R);
+    m_clutch->SetTorqueLimit(GetAxleDifferentialLockingLimit());
+    m_clutch->SetModulation(0);
+    sys->Add(m_clutch);
+}
+
+void ChShaftsDriveline2WD::InitializeShafts(std::shared_ptr<ChBody> chassisBody,
+                                            std::shared_ptr<ChShaft> axle_L,
+                                            std::shared_ptr<ChShaft> axle_R) {
+    auto sys = chassisBody->GetSystem();
+
     // Create the driveshaft for the connection of the driveline to the transmission box.
     m_driveshaft = chrono_types::make_shared<ChShaft>();
     m_driveshaft->SetInertia(GetDriveshaftInertia());
@@ -91,23 +129,17 @@ void ChShaftsDriveline2WD::Initialize(std::shared_ptr<ChChassis> chassis,
     // Create a differential, i.e. an epicycloidal mechanism that connects three rotating members.
     // A proper 'ordinary' transmission ratio t0 must be set according to Willis formula. For a differential, t0=-1.
     m_differential = chrono_types::make_shared<ChShaftsPlanetary>();
-    m_differential->Initialize(m_differentialbox, axles[m_driven_axles[0]]->m_suspension->GetAxle(LEFT),
-                               axles[m_driven_axles[0]]->m_suspension->GetAxle(RIGHT));
+    m_differential->Initialize(m_differentialbox, axle_L, axle_R);
     m_differential->SetTransmissionRatioOrdinary(-1.0);
     sys->Add(m_differential);
-
-    // Create the clutch for differential locking. By default, unlocked.
-    m_clutch = chrono_types::make_shared<ChShaftsClutch>();
-    m_clutch->Initialize(axles[m_driven_axles[0]]->m_suspension->GetAxle(LEFT),
-                         axles[m_driven_axles[0]]->m_suspension->GetAxle(RIGHT));
-    m_clutch->SetTorqueLimit(GetAxleDifferentialLockingLimit());
-    m_clutch->SetModulation(0);
-    sys->Add(m_clutch);
 }
 
 // -----------------------------------------------------------------------------
 void ChShaftsDriveline2WD::Synchronize(double time, const DriverInputs& driver_inputs, double driveshaft_torque) {
-    m_driveshaft->SetAppliedLoad(driveshaft_torque);
+    if (m_network)
+        m_network->SetAppliedLoad(m_driveshaft_index, driveshaft_torque);
+    else
+        m_driveshaft->SetAppliedLoad(driveshaft_torque);
 }
 
 // -----------------------------------------------------------------------------
@@ -122,6 +154,10 @@ void ChShaftsDriveline2WD::LockCentralDifferential(int which, bool lock) {
 // -----------------------------------------------------------------------------
 double ChShaftsDriveline2WD::GetSpindleTorque(int axle, VehicleSide side) const {
     if (axle == m_driven_axles[0]) {
+        if (m_network) {
+            double clutch_torque = (side == LEFT) ? m_clutch->GetReaction1() : m_clutch->GetReaction2();
+            return -m_network->GetReactionTorque(m_axle_index[side]) - clutch_torque;
+        }
         switch (side) {
             case LEFT:
                 return -m_differential->GetReaction2() - m_clutch->GetReaction1();
@@ -133,9 +169,19 @@ double ChShaftsDriveline2WD::GetSpindleTorque(int axle, VehicleSide side) const
     return 0;
 }
 
+// -----------------------------------------------------------------------------
+double ChShaftsDriveline2WD::GetOutputDriveshaftSpeed() const {
+    if (m_network)
+        return m_network->GetShaftSpeed(m_driveshaft_index);
+    return m_driveshaft->GetPosDt();
+}
+
 // -----------------------------------------------------------------------------
 void ChShaftsDriveline2WD::Disconnect() {
-    m_differential->SetDisabled(true);
+    if (m_network)
+        m_network->SetDisabled(true);
+    else
+        m_differential->SetDisabled(true);
     m_clutch->SetDisabled(true);
 }
 
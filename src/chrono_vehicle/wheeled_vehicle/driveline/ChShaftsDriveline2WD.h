@@ -26,6 +26,7 @@
 #include "chrono/physics/ChShaft.h"
 #include "chrono/physics/ChShaftsClutch.h"
 #include "chrono/physics/ChShaftsGearboxAngled.h"
+#include "chrono/physics/ChShaftsNetwork.h"
 #include "chrono/physics/ChShaftsPlanetary.h"
 
 namespace chrono {
@@ -36,6 +37,8 @@ namespace vehicle {
 
 /// 2WD driveline model template based on ChShaft objects. This template can be
 /// used to model either a FWD or a RWD driveline.
+/// If a reduced shaft network is enabled, the driveshaft, conical gear, and differential are modeled with a single
+/// ChShaftsNetwork (see ChDriveline::EnableReducedShaftNetwork).
 class CH_VEHICLE_API ChShaftsDriveline2WD : public ChDrivelineWV {
   public:
     ChShaftsDriveline2WD(const std::string& name);
@@ -92,7 +95,7 @@ class CH_VEHICLE_API ChShaftsDriveline2WD : public ChDrivelineWV {
 
     /// Return the output driveline speed of the driveshaft.
     /// This represents the output from the driveline subsystem that is passed to the transmission subsystem.
-    virtual double GetOutputDriveshaftSpeed() const override { return m_driveshaft->GetPosDt(); }
+    virtual double GetOutputDriveshaftSpeed() const override;
 
   protected:
     /// Return the inertia of the driveshaft.
@@ -107,12 +110,20 @@ class CH_VEHICLE_API ChShaftsDriveline2WD : public ChDrivelineWV {
     virtual double GetAxleDifferentialLockingLimit() const = 0;
 
   private:
+    void InitializeShafts(std::shared_ptr<ChBody> chassisBody,
+                          std::shared_ptr<ChShaft> axle_L,
+                          std::shared_ptr<ChShaft> axle_R);
+
     std::shared_ptr<ChShaft> m_driveshaft;                 ///< shaft connection to the transmission
     std::shared_ptr<ChShaftsGearboxAngled> m_conicalgear;  ///< conical gear
     std::shared_ptr<ChShaft> m_differentialbox;            ///< differential casing
     std::shared_ptr<ChShaftsPlanetary> m_differential;     ///< planetary differential
     std::shared_ptr<ChShaftsClutch> m_clutch;              ///< clutch for locking differential
 
+    std::shared_ptr<ChShaftsNetwork> m_network;  ///< reduced shaft network (if enabled)
+    int m_driveshaft_index;                      ///< index of the driveshaft in the reduced network
+    int m_axle_index[2];                         ///< indexes of the axle shafts in the reduced network
+
     ChVector3d m_dir_motor_block;
     ChVector3d m_dir_axle;
 };
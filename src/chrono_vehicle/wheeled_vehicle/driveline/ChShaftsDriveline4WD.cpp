@@ -38,10 +38,17 @@ ChShaftsDriveline4WD::~ChShaftsDriveline4WD() {
     if (!m_initialized)
         return;
 
-    auto sys = m_central_differential->GetSystem();
+    auto sys = m_front_clutch->GetSystem();
     if (!sys)
         return;
 
+    if (m_network) {
+        sys->Remove(m_network);
+        sys->Remove(m_rear_clutch);
+        sys->Remove(m_front_clutch);
+        return;
+    }
+
     sys->Remove(m_driveshaft);
     sys->Remove(m_central_differential);
     sys->Remove(m_central_clutch);
@@ -71,6 +78,11 @@ void ChShaftsDriveline4WD::Initialize(std::shared_ptr<ChChassis> chassis,
 
     m_driven_axles = driven_axles;
 
+    if (m_reduced_network) {
+        InitializeReduced(chassis, axles);
+        return;
+    }
+
     auto chassisBody = chassis->GetBody();
     auto sys = chassisBody->GetSystem();
 
@@ -203,9 +215,66 @@ void ChShaftsDriveline4WD::Initialize(std::shared_ptr<ChChassis> chassis,
     m_driveshaft->SetPosDt(omega_driveshaft);
 }
 
+// Initialize a reduced model of the driveline, with all internal shafts, the central differential, the conical gears,
+// and the axle differentials condensed in a ChShaftsNetwork. The central differential lock is modeled as a rigid lock
+// and the reaction torques of the conical gears on the chassis are not modeled.
+void ChShaftsDriveline4WD::InitializeReduced(std::shared_ptr<ChChassis> chassis, const ChAxleList& axles) {
+    auto sys = chassis->GetBody()->GetSystem();
+
+    auto axle_FL = axles[m_driven_axles[0]]->m_suspension->GetAxle(LEFT);
+    auto axle_FR = axles[m_driven_axles[0]]->m_suspension->GetAxle(RIGHT);
+    auto axle_RL = axles[m_driven_axles[1]]->m_suspension->GetAxle(LEFT);
+    auto axle_RR = axles[m_driven_axles[1]]->m_suspension->GetAxle(RIGHT);
+
+    // Initial shaft angular velocities, based on the initial wheel angular velocities
+    double omega_front_differentialbox = 0.5 * (axle_FL->GetPosDt() + axle_FR->GetPosDt());
+    double omega_rear_differentialbox = 0.5 * (axle_RL->GetPosDt() + axle_RR->GetPosDt());
+    double omega_front_shaft = omega_front_differentialbox / GetFrontConicalGearRatio();
+    double omega_rear_shaft = omega_rear_differentialbox / GetRearConicalGearRatio();
+    double omega_driveshaft = 0.5 * (omega_front_shaft + omega_rear_shaft);
+
+    m_network = chrono_types::make_shared<ChShaftsNetwork>();
+
+    m_driveshaft_index = m_network->AddShaft(GetDriveshaftInertia(), omega_driveshaft);
+    int front_shaft = m_network->AddShaft(GetToFrontDiffShaftInertia(), omega_front_shaft);
+    int rear_shaft = m_network->AddShaft(GetToRearDiffShaftInertia(), omega_rear_shaft);
+    int front_box = m_network->AddShaft(GetFrontDifferentialBoxInertia(), omega_front_differentialbox);
+    int rear_box = m_network->AddShaft(GetRearDifferentialBoxInertia(), omega_rear_differentialbox);
+    m_axle_index[0][LEFT] = m_network->AddShaft(axle_FL);
+    m_axle_index[0][RIGHT] = m_network->AddShaft(axle_FR);
+    m_axle_index[1][LEFT] = m_network->AddShaft(axle_RL);
+    m_axle_index[1][RIGHT] = m_network->AddShaft(axle_RR);
+
+    m_network->AddPlanetary(m_driveshaft_index, rear_shaft, front_shaft, -1.0);
+    m_central_lock = m_network->AddLock(rear_shaft, front_shaft);
+    m_network->AddGear(rear_shaft, rear_box, -GetRearConicalGearRatio());
+    m_network->AddGear(front_shaft, front_box, -GetFrontConicalGearRatio());
+    m_network->AddPlanetary(rear_box, m_axle_index[1][LEFT], m_axle_index[1][RIGHT], -1.0);
+    m_network->AddPlanetary(front_box, m_axle_index[0][LEFT], m_axle_index[0][RIGHT], -1.0);
+
+    m_network->Initialize();
+    sys->Add(m_network);
+
+    // Create the clutches for the axle differential locking. By default, unlocked.
+    m_rear_clutch = chrono_types::make_shared<ChShaftsClutch>();
+    m_rear_clutch->Initialize(axle_RL, axle_RR);
+    m_rear_clutch->SetTorqueLimit(GetAxleDifferentialLockingLimit());
+    m_rear_clutch->SetModulation(0);
+    sys->Add(m_rear_clutch);
+
+    m_front_clutch = chrono_types::make_shared<ChShaftsClutch>();
+    m_front_clutch->Initialize(axle_FL, axle_FR);
+    m_front_clutch->SetTorqueLimit(GetAxleDifferentialLockingLimit());
+    m_front_clutch->SetModulation(0);
+    sys->Add(m_front_clutch);
+}
+
 // -----------------------------------------------------------------------------
 void ChShaftsDriveline4WD::Synchronize(double time, const DriverInputs& driver_inputs, double driveshaft_torque) {
-    m_driveshaft->SetAppliedLoad(driveshaft_torque);
+    if (m_network)
+        m_network->SetAppliedLoad(m_driveshaft_index, driveshaft_torque);
+    else
+        m_driveshaft->SetAppliedLoad(driveshaft_torque);
 }
 
 // -----------------------------------------------------------------------------
@@ -227,11 +296,25 @@ void ChShaftsDriveline4WD::LockAxleDifferential(int axle, bool lock) {
 }
 
 void ChShaftsDriveline4WD::LockCentralDifferential(int which, bool lock) {
-    m_central_clutch->SetModulation(lock ? 1 : 0);
+    if (m_network)
+        m_network->SetLocked(m_central_lock, lock);
+    else
+        m_central_clutch->SetModulation(lock ? 1 : 0);
 }
 
 // -----------------------------------------------------------------------------
 double ChShaftsDriveline4WD::GetSpindleTorque(int axle, VehicleSide side) const {
+    if (m_network) {
+        for (int i = 0; i < 2; i++) {
+            if (axle != m_driven_axles[i])
+                continue;
+            const auto& clutch = (i == 0) ? m_front_clutch : m_rear_clutch;
+            double clutch_torque = (side == LEFT) ? clutch->GetReaction1() : clutch->GetReaction2();
+            return -m_network->GetReactionTorque(m_axle_index[i][side]) - clutch_torque;
+        }
+        return 0;
+    }
+
     if (axle == m_driven_axles[0]) {
         switch (side) {
             case LEFT:
@@ -253,10 +336,21 @@ double ChShaftsDriveline4WD::GetSpindleTorque(int axle, VehicleSide side) const
     return 0;
 }
 
+// -----------------------------------------------------------------------------
+double ChShaftsDriveline4WD::GetOutputDriveshaftSpeed() const {
+    if (m_network)
+        return m_network->GetShaftSpeed(m_driveshaft_index);
+    return m_driveshaft->GetPosDt();
+}
+
 // -----------------------------------------------------------------------------
 void ChShaftsDriveline4WD::Disconnect() {
-    m_front_differential->SetDisabled(true);
-    m_rear_differential->SetDisabled(true);
+    if (m_network) {
+        m_network->SetDisabled(true);
+    } else {
+        m_front_differential->SetDisabled(true);
+        m_rear_differential->SetDisabled(true);
+    }
     m_front_clutch->SetDisabled(true);
     m_rear_clutch->SetDisabled(true);
 }
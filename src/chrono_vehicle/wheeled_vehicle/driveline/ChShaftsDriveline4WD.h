@@ -25,6 +25,7 @@
 #include "chrono/physics/ChShaft.h"
 #include "chrono/physics/ChShaftsClutch.h"
 #include "chrono/physics/ChShaftsGearboxAngled.h"
+#include "chrono/physics/ChShaftsNetwork.h"
 #include "chrono/physics/ChShaftsPlanetary.h"
 
 namespace chrono {
@@ -34,6 +35,9 @@ namespace vehicle {
 /// @{
 
 /// 4WD driveline model template based on ChShaft objects.
+/// If a reduced shaft network is enabled, the driveshaft, central differential, conical gears, and axle differentials
+/// are modeled with a single ChShaftsNetwork (see ChDriveline::EnableReducedShaftNetwork). In that case, the central
+/// differential lock is rigid (the central differential locking limit is ignored).
 class CH_VEHICLE_API ChShaftsDriveline4WD : public ChDrivelineWV {
   public:
     ChShaftsDriveline4WD(const std::string& name);
@@ -94,7 +98,7 @@ class CH_VEHICLE_API ChShaftsDriveline4WD : public ChDrivelineWV {
 
     /// Return the output driveline speed of the driveshaft.
     /// This represents the output from the driveline subsystem that is passed to the transmission subsystem.
-    virtual double GetOutputDriveshaftSpeed() const override { return m_driveshaft->GetPosDt(); }
+    virtual double GetOutputDriveshaftSpeed() const override;
 
   protected:
     /// Return the inertia of the driveshaft.
@@ -122,6 +126,8 @@ class CH_VEHICLE_API ChShaftsDriveline4WD : public ChDrivelineWV {
     virtual double GetCentralDifferentialLockingLimit() const = 0;
 
   private:
+    void InitializeReduced(std::shared_ptr<ChChassis> chassis, const ChAxleList& axles);
+
     std::shared_ptr<ChShaft> m_driveshaft;  ///< shaft connection to the transmission
 
     std::shared_ptr<ChShaftsPlanetary> m_central_differential;  ///< central differential
@@ -140,6 +146,11 @@ class CH_VEHICLE_API ChShaftsDriveline4WD : public ChDrivelineWV {
     std::shared_ptr<ChShaft> m_front_differentialbox;            ///< front differential casing
     std::shared_ptr<ChShaftsClutch> m_front_clutch;              ///< clutch for locking front differential
 
+    std::shared_ptr<ChShaftsNetwork> m_network;  ///< reduced shaft network (if enabled)
+    int m_driveshaft_index;                      ///< index of the driveshaft in the reduced network
+    int m_axle_index[2][2];                      ///< indexes of the front and rear axle shafts in the reduced network
+    int m_central_lock;                          ///< index of the central differential lock in the reduced network
+
     ChVector3d m_dir_motor_block;
     ChVector3d m_dir_axle;
 };
@@ -173,6 +173,8 @@ class CH_VEHICLE_API ChDeformableTire : public ChTire {
     /// A ChDeformableTire always returns zero forces and moments since tire forces
     /// are implicitly applied to the associated wheel through the tire-wheel connections.
     virtual TerrainForce GetTireForce() const override final;
+
+    friend class ChModalTire;
 };
 
 /// @} vehicle_wheeled_tire
@@ -0,0 +1,238 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Template for a deformable tire reduced with a modal assembly (Craig-Bampton
+// reduction of a Reissner shell tire mesh).
+//
+// =============================================================================
+
+#include <cmath>
+#include <unordered_set>
+
+#include "chrono/physics/ChLoaderUV.h"
+
+#include "chrono_vehicle/wheeled_vehicle/tire/ChModalTire.h"
+
+namespace chrono {
+namespace vehicle {
+
+using namespace chrono::fea;
+using namespace chrono::modal;
+
+// -----------------------------------------------------------------------------
+ChModalTire::ChModalTire(const std::string& name, std::shared_ptr<ChReissnerTire> tire)
+    : ChDeformableTire(name),
+      m_tire(tire),
+      m_num_modes(30),
+      m_use_static_correction(true),
+      m_contact_band(0.2) {}
+
+ChModalTire::~ChModalTire() {
+    if (!m_initialized)
+        return;
+
+    auto sys = m_assembly->GetSystem();
+    if (!sys)
+        return;
+
+    for (size_t i = 0; i < m_connectionsF.size(); i++) {
+        sys->Remove(m_connectionsF[i]);
+    }
+    m_connectionsF.clear();
+
+    // Removing the modal assembly also detaches the tire meshes from the system (nothing left for the base class)
+    sys->Remove(m_assembly);
+}
+
+// -----------------------------------------------------------------------------
+void ChModalTire::Initialize(std::shared_ptr<ChWheel> wheel) {
+    ChTire::Initialize(wheel);
+
+    ChSystemSMC* system = dynamic_cast<ChSystemSMC*>(wheel->GetSpindle()->GetSystem());
+    assert(system);
+
+    // Create the modal assembly, with a mesh for the boundary nodes and a mesh for the internal nodes
+    m_assembly = chrono_types::make_shared<ChModalAssembly>();
+    m_mesh = chrono_types::make_shared<ChMesh>();
+    m_internal_mesh = chrono_types::make_shared<ChMesh>();
+    m_assembly->AddMesh(m_mesh);
+    m_assembly->AddInternalMesh(m_internal_mesh);
+    system->Add(m_assembly);
+
+    // Create the FEA nodes and elements
+    CreateMesh(*(wheel->GetSpindle().get()), wheel->GetSide());
+
+    // Enable tire pressure
+    if (m_pressure_enabled) {
+        // If pressure was not explicitly specified, fall back to the default value.
+        if (m_pressure <= 0)
+            m_pressure = GetDefaultPressure();
+        CreatePressureLoad();
+    }
+
+    // Enable tire contact
+    if (m_contact_enabled) {
+        CreateContactMaterial();
+        assert(m_contact_mat && m_contact_mat->GetContactMethod() == ChContactMethod::SMC);
+        CreateContactSurface();
+    }
+
+    // Enable tire connection to rim
+    if (m_connection_enabled) {
+        CreateRimConnections(wheel->GetSpindle());
+    }
+
+    // Perform the modal reduction (clamped boundary nodes).
+    // The damping of the reduced model is obtained from the damping matrix of the full mesh.
+    m_assembly->SetReductionType(ChModalAssembly::ReductionType::CRAIG_BAMPTON);
+    m_assembly->SetUseStaticCorrection(m_use_static_correction);
+    m_assembly->SetModesCacheFile(m_modes_cache_file);
+
+    ChGeneralizedEigenvalueSolverKrylovSchur eigen_solver;
+    ChModalSolveUndamped modes_settings(m_num_modes, 1e-4, 500, 1e-10, false, eigen_solver);
+    ChModalDampingReductionR damping(*m_assembly);
+    m_assembly->DoModalReduction(modes_settings, damping);
+
+    if (m_pressure_enabled)
+        ApplyPressure();
+}
+
+// -----------------------------------------------------------------------------
+void ChModalTire::CreateMesh(const ChFrameMoving<>& wheel_frame, VehicleSide side) {
+    // Let the full tire create its mesh
+    m_tire->m_mesh = chrono_types::make_shared<ChMesh>();
+    m_tire->CreateMesh(wheel_frame, side);
+    m_connected_nodes = m_tire->GetConnectedNodes();
+
+    std::unordered_set<ChNodeFEAbase*> connected;
+    for (const auto& node : m_connected_nodes)
+        connected.insert(node.get());
+
+    // Boundary nodes are the rim nodes and the nodes in the tread band; all other nodes are internal.
+    // The wheel rotational axis is the Y axis of the wheel frame.
+    double radius = GetRadius();
+    double contact_radius = radius - m_contact_band * (radius - GetRimRadius());
+
+    for (const auto& node : m_tire->m_mesh->GetNodes()) {
+        auto node_rot = std::dynamic_pointer_cast<ChNodeFEAxyzrot>(node);
+        if (!node_rot)
+            throw std::runtime_error("ChModalTire: the tire mesh must consist of ChNodeFEAxyzrot nodes.");
+        m_nodes.push_back(node_rot);
+
+        auto loc = wheel_frame.TransformPointParentToLocal(node_rot->GetPos());
+        if (connected.count(node.get())) {
+            m_mesh->AddNode(node_rot);
+        } else if (std::hypot(loc.x(), loc.z()) >= contact_radius) {
+            m_mesh->AddNode(node_rot);
+            m_contact_nodes.push_back(node_rot);
+        } else {
+            m_internal_mesh->AddNode(node_rot);
+        }
+    }
+
+    for (const auto& element : m_tire->m_mesh->GetElements())
+        m_internal_mesh->AddElement(element);
+
+    m_tire->m_mesh.reset();
+}
+
+void ChModalTire::CreatePressureLoad() {
+    // Create a pressure load for each element in the mesh (internal pressure, acting opposite to the surface normal).
+    // These loads are not added to the load container; they are evaluated in ApplyPressure, since the internal nodes
+    // do not carry state in the reduced model.
+    for (const auto& element : m_internal_mesh->GetElements()) {
+        if (auto loadable = std::dynamic_pointer_cast<ChLoadableUV>(element)) {
+            auto loader = chrono_types::make_shared<ChLoaderPressure>(loadable);
+            loader->SetPressure(-m_pressure);
+            loader->SetStiff(false);
+            loader->SetIntegrationPoints(2);
+            m_pressure_loads.push_back(chrono_types::make_shared<ChLoad>(loader));
+        }
+    }
+}
+
+void ChModalTire::CreateContactSurface() {
+    auto contact_surf = chrono_types::make_shared<ChContactSurfaceNodeCloud>(m_contact_mat);
+    m_mesh->AddContactSurface(contact_surf);
+    for (const auto& node : m_contact_nodes)
+        contact_surf->AddNode(node, m_contact_surface_dim);
+}
+
+void ChModalTire::CreateRimConnections(std::shared_ptr<ChBody> wheel) {
+    m_connectionsF.resize(m_connected_nodes.size());
+
+    for (size_t in = 0; in < m_connected_nodes.size(); ++in) {
+        auto node = std::dynamic_pointer_cast<ChNodeFEAxyzrot>(m_connected_nodes[in]);
+        m_connectionsF[in] = chrono_types::make_shared<ChLinkMateFix>();
+        m_connectionsF[in]->Initialize(node, wheel);
+        wheel->GetSystem()->Add(m_connectionsF[in]);
+    }
+}
+
+void ChModalTire::CreateContactMaterial() {
+    m_tire->CreateContactMaterial();
+    m_contact_mat = m_tire->m_contact_mat;
+}
+
+// -----------------------------------------------------------------------------
+void ChModalTire::Synchronize(double time, const ChTerrain& terrain) {
+    if (m_pressure_enabled)
+        ApplyPressure();
+}
+
+void ChModalTire::ApplyPressure() {
+    for (const auto& node : m_nodes)
+        node->SetForce(VNULL);
+
+    // Accumulate the translational components of the element pressure loads at the element nodes
+    for (const auto& load : m_pressure_loads) {
+        load->ComputeQ(nullptr, nullptr);
+        const auto& Q = load->loader->Q;
+        auto element = std::dynamic_pointer_cast<ChElementBase>(load->loader->GetLoadable());
+        unsigned int offset = 0;
+        for (unsigned int i = 0; i < element->GetNumNodes(); i++) {
+            auto node = std::static_pointer_cast<ChNodeFEAxyzrot>(element->GetNode(i));
+            node->SetForce(node->GetForce() + ChVector3d(Q(offset + 0), Q(offset + 1), Q(offset + 2)));
+            offset += node->GetNumCoordsVelLevel();
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void ChModalTire::InitializeInertiaProperties() {
+    ChVector3d com;
+    m_internal_mesh->ComputeMassProperties(m_mass, com, m_inertia);
+    m_com = ChFrame<>(com, QUNIT);
+}
+
+// -----------------------------------------------------------------------------
+void ChModalTire::AddVisualizationAssets(VisualizationType vis) {
+    if (vis == VisualizationType::NONE)
+        return;
+
+    m_visualization = chrono_types::make_shared<ChVisualShapeFEA>(m_internal_mesh);
+    m_visualization->SetFEMdataType(ChVisualShapeFEA::DataType::NODE_SPEED_NORM);
+    m_visualization->SetShellResolution(3);
+    m_visualization->SetWireframe(false);
+    m_visualization->SetColorscaleMinMax(0.0, 5.0);
+    m_visualization->SetSmoothFaces(true);
+    m_internal_mesh->AddVisualShapeFEA(m_visualization);
+}
+
+void ChModalTire::RemoveVisualizationAssets() {
+    ChPart::RemoveVisualizationAssets(m_internal_mesh);
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,161 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Template for a deformable tire reduced with a modal assembly (Craig-Bampton
+// reduction of a Reissner shell tire mesh).
+//
+// =============================================================================
+
+#ifndef CH_MODAL_TIRE_H
+#define CH_MODAL_TIRE_H
+
+#include "chrono/physics/ChLoad.h"
+
+#include "chrono_modal/ChModalAssembly.h"
+
+#include "chrono_vehicle/wheeled_vehicle/tire/ChReissnerTire.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_wheeled_tire
+/// @{
+
+/// Deformable tire template based on a modal reduction of a Reissner shell tire.
+/// The FEA mesh of the specified Reissner tire is created at initialization and placed in a ChModalAssembly, which is
+/// then reduced with the Craig-Bampton method. The boundary nodes (retaining their physical DOFs) are the nodes
+/// connected to the rim and the tread nodes used for contact; all other nodes are internal and are replaced by a small
+/// number of modal coordinates, optionally augmented with a static correction mode.
+///
+/// Notes:
+/// - contact is always modeled with a node cloud on the tread nodes (i.e., the nodes within the outer band of the
+///   tire, see SetContactBand); the TRIANGLE_MESH contact surface type is not supported.
+/// - the tire pressure is applied as nodal forces, re-evaluated at each Synchronize() from the current configuration of
+///   the mesh (including the internal nodes recovered from the modal coordinates). As such, any other forces applied
+///   directly to the tire nodes are overwritten.
+/// - the damping of the reduced model is obtained by projecting the damping matrix of the full mesh.
+/// - the modes can be cached to disk (see SetModesCacheFile), so that the eigenvalue problem is only solved once for a
+///   given tire mesh and modal settings.
+class CH_VEHICLE_API ChModalTire : public ChDeformableTire {
+  public:
+    /// Construct a modal tire with the specified name, from the given (not initialized) Reissner tire.
+    ChModalTire(const std::string& name, std::shared_ptr<ChReissnerTire> tire);
+
+    virtual ~ChModalTire();
+
+    /// Get the name of the vehicle subsystem template.
+    virtual std::string GetTemplateName() const override { return "ModalTire"; }
+
+    /// Get the tire radius.
+    virtual double GetRadius() const override { return m_tire->GetRadius(); }
+
+    /// Get the rim radius (inner tire radius).
+    virtual double GetRimRadius() const override { return m_tire->GetRimRadius(); }
+
+    /// Get the tire width.
+    virtual double GetWidth() const override { return m_tire->GetWidth(); }
+
+    /// Set the number of dynamic modes retained in the reduced model (default: 30).
+    void SetNumModes(int num_modes) { m_num_modes = num_modes; }
+
+    /// Enable/disable the static correction mode (default: true).
+    /// The static correction captures the quasi-static deformation of the internal nodes under the pressure load.
+    void SetUseStaticCorrection(bool val) { m_use_static_correction = val; }
+
+    /// Set the name of a file used to cache the tire modes (default: none).
+    /// See ChModalAssembly::SetModesCacheFile.
+    void SetModesCacheFile(const std::string& filename) { m_modes_cache_file = filename; }
+
+    /// Set the fraction of the tire height (from the outer radius towards the rim) defining the tread band (default:
+    /// 0.2). Nodes in this band are retained as boundary nodes and carry the tire contact surface.
+    void SetContactBand(double fraction) { m_contact_band = fraction; }
+
+    /// Get the underlying modal assembly.
+    /// Note that this is not set until after tire initialization.
+    std::shared_ptr<modal::ChModalAssembly> GetModalAssembly() const { return m_assembly; }
+
+    /// Get the mesh with the internal nodes and all tire elements.
+    /// The boundary nodes (rim and tread nodes) are in the mesh returned by GetMesh().
+    std::shared_ptr<fea::ChMesh> GetInternalMesh() const { return m_internal_mesh; }
+
+    /// Get the number of tread nodes (carrying the contact surface).
+    int GetNumContactNodes() const { return (int)m_contact_nodes.size(); }
+
+    /// Add visualization assets for the modal tire subsystem.
+    virtual void AddVisualizationAssets(VisualizationType vis) override;
+
+    /// Remove visualization assets for the modal tire subsystem.
+    virtual void RemoveVisualizationAssets() override;
+
+    /// Update the state of this tire system at the current time.
+    /// This evaluates the pressure forces on the tire nodes.
+    virtual void Synchronize(double time, const ChTerrain& terrain) override;
+
+  protected:
+    /// Return the default tire pressure.
+    virtual double GetDefaultPressure() const override { return m_tire->GetDefaultPressure(); }
+
+    /// Return list of nodes connected to the rim.
+    virtual std::vector<std::shared_ptr<fea::ChNodeFEAbase>> GetConnectedNodes() const override {
+        return m_connected_nodes;
+    }
+
+    /// Create the FEA nodes and elements and split them between the boundary and internal meshes.
+    virtual void CreateMesh(const ChFrameMoving<>& wheel_frame, VehicleSide side) override;
+
+    /// Create the pressure loads on the tire elements.
+    virtual void CreatePressureLoad() override;
+
+    /// Create the node cloud contact surface on the tread nodes.
+    virtual void CreateContactSurface() override;
+
+    /// Create the tire-rim connections.
+    virtual void CreateRimConnections(std::shared_ptr<ChBody> wheel) override;
+
+    /// Create the SMC contact material.
+    virtual void CreateContactMaterial() override;
+
+    /// Calculate the tire mass properties (from all tire elements).
+    virtual void InitializeInertiaProperties() override;
+
+    /// Initialize this tire by associating it to the specified wheel.
+    /// This creates the tire mesh and performs the modal reduction.
+    virtual void Initialize(std::shared_ptr<ChWheel> wheel) override;
+
+  private:
+    /// Evaluate the pressure loads and apply them as nodal forces.
+    void ApplyPressure();
+
+    std::shared_ptr<ChReissnerTire> m_tire;  ///< full tire model (mesh definition)
+
+    int m_num_modes;                 ///< number of dynamic modes
+    bool m_use_static_correction;    ///< use the static correction mode?
+    std::string m_modes_cache_file;  ///< name of the modes cache file (if any)
+    double m_contact_band;           ///< fraction of the tire height with contact nodes
+
+    std::shared_ptr<modal::ChModalAssembly> m_assembly;  ///< modal assembly
+    std::shared_ptr<fea::ChMesh> m_internal_mesh;        ///< internal nodes and all elements
+
+    std::vector<std::shared_ptr<fea::ChNodeFEAbase>> m_connected_nodes;  ///< nodes connected to the rim
+    std::vector<std::shared_ptr<fea::ChNodeFEAxyzrot>> m_contact_nodes;  ///< tread nodes
+    std::vector<std::shared_ptr<fea::ChNodeFEAxyzrot>> m_nodes;          ///< all tire nodes
+    std::vector<std::shared_ptr<ChLoad>> m_pressure_loads;               ///< pressure load on each element
+};
+
+/// @} vehicle_wheeled_tire
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
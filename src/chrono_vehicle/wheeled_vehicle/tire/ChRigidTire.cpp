@@ -25,6 +25,7 @@
 #include "chrono_vehicle/wheeled_vehicle/tire/ChRigidTire.h"
 
 #include "chrono_vehicle/terrain/SCMTerrain.h"
+#include "chrono_vehicle/utils/ChVehicleModelCache.h"
 
 namespace chrono {
 namespace vehicle {
@@ -54,12 +55,14 @@ void ChRigidTire::Initialize(std::shared_ptr<ChWheel> wheel) {
 
     if (m_use_contact_mesh) {
         // Mesh contact
-        m_trimesh = ChTriangleMeshConnected::CreateFromWavefrontFile(m_contact_meshFile, true, false);
+        m_trimesh = ChVehicleModelCache::ReadMesh(m_contact_meshFile, true, false);
 
         //// RADU
         // Hack to deal with current limitation: cannot set offset on a trimesh collision shape!
+        // The offset is applied to a copy of the (shared) cached mesh.
         double offset = GetOffset();
         if (std::abs(offset) > 1e-3) {
+            m_trimesh = std::shared_ptr<ChTriangleMeshConnected>(m_trimesh->Clone());
             for (int i = 0; i < m_trimesh->m_vertices.size(); i++)
                 m_trimesh->m_vertices[i].y() += offset;
         }
@@ -19,6 +19,9 @@
 #include <cctype>
 #include <sstream>
 #include <iomanip>
+#include <chrono>
+#include <future>
+#include <unordered_map>
 
 #include "chrono/utils/ChUtils.h"
 
@@ -396,6 +399,8 @@ ChVisualSystemVSG::ChVisualSystemVSG(int num_divs)
       m_useSkybox(false),
       m_capture_image(false),
       m_wireframe(false),
+      m_use_instancing(true),
+      m_instancing_threshold(16),
       m_show_gui(true),
       m_show_base_gui(true),
       m_camera_trackball(true),
@@ -409,7 +414,11 @@ ChVisualSystemVSG::ChVisualSystemVSG(int num_divs)
       m_old_time(0),
       m_current_time(0),
       m_fps(0),
-      m_verbose(false) {
+      m_verbose(false),
+      m_snapshot(nullptr),
+      m_render_active(false),
+      m_render_stop(false),
+      m_snapshot_update_camera(false) {
     m_windowTitle = string("Window Title");
     m_clearColor = ChColor(0, 0, 0);
     m_skyboxPath = string("vsg/textures/chrono_skybox.ktx2");
@@ -451,7 +460,9 @@ ChVisualSystemVSG::ChVisualSystemVSG(int num_divs)
 #endif
 }
 
-ChVisualSystemVSG::~ChVisualSystemVSG() {}
+ChVisualSystemVSG::~ChVisualSystemVSG() {
+    StopRenderThread();
+}
 
 void ChVisualSystemVSG::SetOutputScreen(int screenNum) {
     if (m_initialized) {
@@ -507,6 +518,11 @@ void ChVisualSystemVSG::AddEventHandler(std::shared_ptr<ChEventHandlerVSG> eh) {
 }
 
 void ChVisualSystemVSG::Quit() {
+    // If rendering in a separate thread, let the render thread close the viewer
+    if (m_render_active) {
+        m_render_stop = true;
+        return;
+    }
     m_viewer->close();
 }
 
@@ -927,10 +943,198 @@ void ChVisualSystemVSG::Initialize() {
 }
 
 bool ChVisualSystemVSG::Run() {
+    if (m_render_thread.joinable())
+        return m_render_active;
     return m_viewer->active();
 }
 
 void ChVisualSystemVSG::Render() {
+    // If rendering in a separate thread, only publish the current state
+    if (m_render_thread.joinable()) {
+        PublishSnapshot();
+        return;
+    }
+
+    RenderFrame();
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVisualSystemVSG::StartRenderThread(double fps) {
+    if (m_initialized || m_render_thread.joinable()) {
+        std::cerr << "Function ChVisualSystemVSG::StartRenderThread must be used before initialization!" << std::endl;
+        return;
+    }
+
+    // Collect the items with state included in the snapshots (in the same order as in BindAll)
+    auto add_meshes = [this](const std::shared_ptr<ChPhysicsItem>& item) {
+        if (!item->GetVisualModel())
+            return;
+        for (auto& shape_instance : item->GetVisualModel()->GetShapeInstances()) {
+            auto trimesh = std::dynamic_pointer_cast<ChVisualShapeTriangleMesh>(shape_instance.first);
+            if (!trimesh || trimesh->GetMesh()->GetNumVertices() == 0)
+                continue;
+            m_snapshot_mesh_index[trimesh->GetMesh().get()] = m_snapshot_meshes.size();
+            m_snapshot_meshes.push_back(trimesh->GetMesh());
+        }
+    };
+
+    for (auto sys : m_systems) {
+        for (const auto& body : sys->GetAssembly().GetBodies()) {
+            m_snapshot_body_index[body.get()] = m_snapshot_bodies.size();
+            m_snapshot_bodies.push_back(body);
+        }
+        for (const auto& mesh : sys->GetAssembly().GetMeshes()) {
+            mesh->UpdateVisualModel();
+            add_meshes(mesh);
+        }
+        for (const auto& item : sys->GetOtherPhysicsItems()) {
+            add_meshes(item);
+            if (const auto& pcloud = std::dynamic_pointer_cast<ChParticleCloud>(item)) {
+                m_snapshot_cloud_index[pcloud.get()] = m_snapshot_clouds.size();
+                m_snapshot_clouds.push_back(pcloud);
+            }
+        }
+    }
+
+    // Publish an initial snapshot, so that one is available as soon as the render thread starts
+    PublishSnapshot();
+
+    // Initialize the visualization system in the render thread and wait until all visual models are bound
+    std::promise<void> initialized;
+    auto ready = initialized.get_future();
+    m_render_stop = false;
+    m_render_active = true;
+    m_render_thread = std::thread([this, fps, &initialized]() {
+        Initialize();
+        initialized.set_value();
+        RenderLoop(fps);
+    });
+    ready.wait();
+}
+
+void ChVisualSystemVSG::StopRenderThread() {
+    if (!m_render_thread.joinable())
+        return;
+
+    m_render_stop = true;
+    m_render_thread.join();
+    m_render_thread = std::thread();
+}
+
+void ChVisualSystemVSG::RenderLoop(double fps) {
+    using Clock = std::chrono::steady_clock;
+    auto frame_time = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1 / fps));
+    auto next_frame = Clock::now();
+
+    while (!m_render_stop && m_viewer->active()) {
+        // Render the most recent snapshot (keep the current one if no new snapshot was published)
+        m_snapshots.Acquire();
+        m_snapshot = &m_snapshots.GetReadBuffer();
+        RenderFrame();
+
+        // Maintain the target frame rate (do not try to catch up on missed frames)
+        next_frame += frame_time;
+        auto now = Clock::now();
+        if (next_frame > now)
+            std::this_thread::sleep_until(next_frame);
+        else
+            next_frame = now;
+    }
+
+    m_viewer->close();
+    m_render_active = false;
+}
+
+void ChVisualSystemVSG::PublishSnapshot() {
+    auto& snapshot = m_snapshots.GetWriteBuffer();
+
+    snapshot.time = ChVisualSystem::GetSimulationTime();
+    snapshot.rtf = ChVisualSystem::GetSimulationRTF();
+
+    snapshot.update_camera = m_snapshot_update_camera;
+    snapshot.camera_eye = m_snapshot_camera_eye;
+    snapshot.camera_target = m_snapshot_camera_target;
+    m_snapshot_update_camera = false;
+
+    auto num_bodies = m_snapshot_bodies.size();
+    snapshot.body_frames.resize(num_bodies);
+    snapshot.body_com_frames.resize(num_bodies);
+    for (size_t i = 0; i < num_bodies; i++) {
+        snapshot.body_frames[i] = m_snapshot_bodies[i]->GetVisualModelFrame();
+        snapshot.body_com_frames[i] = m_snapshot_bodies[i]->GetFrameCOMToAbs();
+    }
+
+    // Deformable meshes are rendered as triangle soups (see BindMesh)
+    auto num_meshes = m_snapshot_meshes.size();
+    snapshot.mesh_vertices.resize(num_meshes);
+    snapshot.mesh_normals.resize(num_meshes);
+    snapshot.mesh_colors.resize(num_meshes);
+    for (size_t i = 0; i < num_meshes; i++) {
+        const auto& trimesh = m_snapshot_meshes[i];
+        const auto& vertices = trimesh->getFaceVertices();
+        snapshot.mesh_vertices[i].assign(vertices.begin(), vertices.end());
+        const auto& normals = trimesh->getFaceNormals();
+        snapshot.mesh_normals[i].assign(normals.begin(), normals.end());
+        const auto& colors = trimesh->getFaceColors();
+        snapshot.mesh_colors[i].assign(colors.begin(), colors.end());
+    }
+
+    auto num_clouds = m_snapshot_clouds.size();
+    snapshot.cloud_positions.resize(num_clouds);
+    snapshot.cloud_colors.resize(num_clouds);
+    for (size_t i = 0; i < num_clouds; i++) {
+        const auto& pcloud = m_snapshot_clouds[i];
+        auto num_particles = pcloud->GetNumParticles();
+        snapshot.cloud_positions[i].resize(num_particles);
+        for (unsigned int k = 0; k < num_particles; k++)
+            snapshot.cloud_positions[i][k] = pcloud->Particle(k).GetPos();
+        snapshot.cloud_colors[i].resize(pcloud->UseDynamicColors() ? num_particles : 0);
+        for (unsigned int k = 0; k < snapshot.cloud_colors[i].size(); k++)
+            snapshot.cloud_colors[i][k] = pcloud->GetVisualColor(k);
+    }
+
+    m_snapshots.Publish();
+}
+
+const ChFrame<>& ChVisualSystemVSG::GetBodyVisualFrame(const std::shared_ptr<ChBody>& body) const {
+    if (m_snapshot) {
+        auto it = m_snapshot_body_index.find(body.get());
+        if (it != m_snapshot_body_index.end())
+            return m_snapshot->body_frames[it->second];
+    }
+    return body->GetVisualModelFrame();
+}
+
+double ChVisualSystemVSG::GetSimulationRTF() const {
+    if (m_snapshot)
+        return m_snapshot->rtf;
+    return ChVisualSystem::GetSimulationRTF();
+}
+
+double ChVisualSystemVSG::GetSimulationTime() const {
+    if (m_snapshot)
+        return m_snapshot->time;
+    return ChVisualSystem::GetSimulationTime();
+}
+
+void ChVisualSystemVSG::SetCameraLookAt(const ChVector3d& eye, const ChVector3d& target) {
+    if (m_render_thread.joinable()) {
+        m_snapshot_camera_eye = eye;
+        m_snapshot_camera_target = target;
+        m_snapshot_update_camera = true;
+        return;
+    }
+
+    m_vsg_cameraEye.set(eye.x(), eye.y(), eye.z());
+    m_vsg_cameraTarget.set(target.x(), target.y(), target.z());
+    m_lookAt->eye.set(eye.x(), eye.y(), eye.z());
+    m_lookAt->center.set(target.x(), target.y(), target.z());
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVisualSystemVSG::RenderFrame() {
     if (m_write_images && m_frame_number > 0) {
         // Zero-pad frame numbers in file names for postprocessing
         std::ostringstream filename;
@@ -944,6 +1148,16 @@ void ChVisualSystemVSG::Render() {
     m_timer_render.reset();
     m_timer_render.start();
 
+    // Apply a camera update published by the simulation thread
+    if (m_snapshot && m_snapshot->update_camera) {
+        const auto& eye = m_snapshot->camera_eye;
+        const auto& target = m_snapshot->camera_target;
+        m_vsg_cameraEye.set(eye.x(), eye.y(), eye.z());
+        m_vsg_cameraTarget.set(target.x(), target.y(), target.z());
+        m_lookAt->eye.set(eye.x(), eye.y(), eye.z());
+        m_lookAt->center.set(target.x(), target.y(), target.z());
+    }
+
     UpdateFromMBS();
 
     if (!m_viewer->advanceToNextFrame()) {
@@ -957,6 +1171,26 @@ void ChVisualSystemVSG::Render() {
 
     // Dynamic data transfer CPU->GPU for point clouds
     for (const auto& cloud : m_clouds) {
+        if (m_snapshot) {
+            auto it = m_snapshot_cloud_index.find(cloud.pcloud.get());
+            if (it == m_snapshot_cloud_index.end())
+                continue;
+            const auto& new_positions = m_snapshot->cloud_positions[it->second];
+            const auto& new_colors = m_snapshot->cloud_colors[it->second];
+            if (cloud.dynamic_positions && new_positions.size() == cloud.positions->size()) {
+                size_t k = 0;
+                for (auto& p : *cloud.positions)
+                    p = vsg::vec3CH(new_positions[k++]);
+                cloud.positions->dirty();
+            }
+            if (cloud.dynamic_colors && new_colors.size() == cloud.colors->size()) {
+                size_t k = 0;
+                for (auto& c : *cloud.colors)
+                    c = vsg::vec4CH(new_colors[k++]);
+                cloud.colors->dirty();
+            }
+            continue;
+        }
         if (cloud.dynamic_positions) {
             unsigned int k = 0;
             for (auto& p : *cloud.positions)
@@ -973,6 +1207,34 @@ void ChVisualSystemVSG::Render() {
 
     // Dynamic data transfer CPU->GPU for deformable meshes
     for (auto& def_mesh : m_def_meshes) {
+        if (m_snapshot) {
+            auto it = m_snapshot_mesh_index.find(def_mesh.trimesh.get());
+            if (it == m_snapshot_mesh_index.end())
+                continue;
+            const auto& new_vertices = m_snapshot->mesh_vertices[it->second];
+            const auto& new_normals = m_snapshot->mesh_normals[it->second];
+            const auto& new_colors = m_snapshot->mesh_colors[it->second];
+            if (def_mesh.dynamic_vertices && new_vertices.size() == def_mesh.vertices->size()) {
+                size_t k = 0;
+                for (auto& v : *def_mesh.vertices)
+                    v = vsg::vec3CH(new_vertices[k++]);
+                def_mesh.vertices->dirty();
+            }
+            if (def_mesh.dynamic_normals && new_normals.size() == def_mesh.normals->size()) {
+                size_t k = 0;
+                for (auto& n : *def_mesh.normals)
+                    n = vsg::vec3CH(new_normals[k++]);
+                def_mesh.normals->dirty();
+            }
+            if (def_mesh.dynamic_colors && new_colors.size() == def_mesh.colors->size()) {
+                size_t k = 0;
+                for (auto& c : *def_mesh.colors)
+                    c = vsg::vec4CH(new_colors[k++]);
+                def_mesh.colors->dirty();
+            }
+            continue;
+        }
+
         if (def_mesh.dynamic_vertices) {
             const auto& new_vertices =
                 def_mesh.mesh_soup ? def_mesh.trimesh->getFaceVertices() : def_mesh.trimesh->GetCoordsVertices();
@@ -1004,6 +1266,17 @@ void ChVisualSystemVSG::Render() {
         }
     }
 
+    // Dynamic data transfer CPU->GPU for instanced body shapes
+    for (auto& instanced : m_instanced_shapes) {
+        size_t k = 0;
+        for (auto& M : *instanced.transforms) {
+            M = vsg::mat4(vsg::dmat4CH(GetBodyVisualFrame(instanced.bodies[k]), 1.0) *
+                          instanced.shape_transforms[k]);
+            k++;
+        }
+        instanced.transforms->dirty();
+    }
+
     m_viewer->recordAndSubmit();
 
     if (m_capture_image) {
@@ -1089,6 +1362,41 @@ ChFrame<> PointPointFrame(const ChVector3d& P1, const ChVector3d& P2, double& di
     return ChFrame<>(0.5 * (P2 + P1), R_CS);
 }
 
+// Utility function to identify primitive shapes which can be rendered with instancing.
+// Return the type of the corresponding VSG primitive and its scaling.
+static bool GetInstancedShapeType(const std::shared_ptr<ChVisualShape>& shape,
+                                  ShapeBuilder::ShapeType& type,
+                                  ChVector3d& scale) {
+    if (auto box = std::dynamic_pointer_cast<ChVisualShapeBox>(shape)) {
+        // Dice (boxes with a cube texture) are always rendered individually
+        if (shape->GetNumMaterials() > 0 && shape->GetMaterial(0)->GetKdTexture().find("cubetexture") != string::npos)
+            return false;
+        type = ShapeBuilder::ShapeType::BOX_SHAPE;
+        scale = box->GetHalflengths();
+    } else if (auto sphere = std::dynamic_pointer_cast<ChVisualShapeSphere>(shape)) {
+        type = ShapeBuilder::ShapeType::SPHERE_SHAPE;
+        scale = ChVector3d(sphere->GetRadius());
+    } else if (auto ellipsoid = std::dynamic_pointer_cast<ChVisualShapeEllipsoid>(shape)) {
+        type = ShapeBuilder::ShapeType::SPHERE_SHAPE;
+        scale = ellipsoid->GetSemiaxes();
+    } else if (auto cylinder = std::dynamic_pointer_cast<ChVisualShapeCylinder>(shape)) {
+        double rad = cylinder->GetRadius();
+        type = ShapeBuilder::ShapeType::CYLINDER_SHAPE;
+        scale = ChVector3d(rad, rad, cylinder->GetHeight());
+    } else if (auto capsule = std::dynamic_pointer_cast<ChVisualShapeCapsule>(shape)) {
+        double rad = capsule->GetRadius();
+        type = ShapeBuilder::ShapeType::CAPSULE_SHAPE;
+        scale = ChVector3d(rad, rad, rad / 2 + capsule->GetHeight() / 4);
+    } else if (auto cone = std::dynamic_pointer_cast<ChVisualShapeCone>(shape)) {
+        double rad = cone->GetRadius();
+        type = ShapeBuilder::ShapeType::CONE_SHAPE;
+        scale = ChVector3d(rad, rad, cone->GetHeight());
+    } else {
+        return false;
+    }
+    return true;
+}
+
 // Utility function to populate a VSG group with shape groups (from the given visual model).
 // The visual model may or may not be associated with a Chrono physics item.
 void ChVisualSystemVSG::PopulateGroup(vsg::ref_ptr<vsg::Group> group,
@@ -1247,6 +1555,67 @@ void ChVisualSystemVSG::BindBody(const std::shared_ptr<ChBody>& body) {
     m_bodyScene->addChild(modelGroup);
 }
 
+std::vector<bool> ChVisualSystemVSG::BindInstancedBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    std::vector<bool> bound(bodies.size(), false);
+    if (!m_use_instancing)
+        return bound;
+
+    // Group the bodies with a single-shape visual model by their (shared) visual shape
+    std::vector<std::shared_ptr<ChVisualShape>> shapes;
+    std::vector<std::vector<size_t>> shape_bodies;
+    std::unordered_map<ChVisualShape*, size_t> shape_index;
+    for (size_t i = 0; i < bodies.size(); i++) {
+        const auto& vis_model = bodies[i]->GetVisualModel();
+        if (!vis_model || vis_model->GetNumShapes() != 1)
+            continue;
+        const auto& shape = vis_model->GetShape(0);
+        ShapeBuilder::ShapeType type;
+        ChVector3d scale;
+        if (!shape->IsVisible() || !GetInstancedShapeType(shape, type, scale))
+            continue;
+        auto found = shape_index.find(shape.get());
+        if (found == shape_index.end()) {
+            found = shape_index.insert({shape.get(), shapes.size()}).first;
+            shapes.push_back(shape);
+            shape_bodies.push_back({});
+        }
+        shape_bodies[found->second].push_back(i);
+    }
+
+    // Create one instanced node for each shape shared by sufficiently many bodies
+    for (size_t j = 0; j < shapes.size(); j++) {
+        if (shape_bodies[j].size() < m_instancing_threshold)
+            continue;
+
+        const auto& shape = shapes[j];
+        ShapeBuilder::ShapeType type;
+        ChVector3d scale;
+        GetInstancedShapeType(shape, type, scale);
+        std::shared_ptr<ChVisualMaterial> material =
+            shape->GetMaterials().empty() ? ChVisualMaterial::Default() : shape->GetMaterial(0);
+
+        InstancedShape instanced;
+        instanced.shape = shape;
+        instanced.transforms = vsg::mat4Array::create(shape_bodies[j].size());
+        for (auto i : shape_bodies[j]) {
+            const auto& body = bodies[i];
+            auto X_SM = vsg::dmat4CH(body->GetVisualModel()->GetShapeFrame(0), scale);
+            instanced.transforms->set(instanced.bodies.size(),
+                                      vsg::mat4(vsg::dmat4CH(body->GetVisualModelFrame(), 1.0) * X_SM));
+            instanced.bodies.push_back(body);
+            instanced.shape_transforms.push_back(X_SM);
+            bound[i] = true;
+        }
+        instanced.transforms->properties.dataVariance = vsg::DYNAMIC_DATA;
+
+        auto node = m_shapeBuilder->CreateInstancedPbrShape(type, material, instanced.transforms, m_wireframe);
+        m_bodyScene->addChild(node);
+        m_instanced_shapes.push_back(instanced);
+    }
+
+    return bound;
+}
+
 void ChVisualSystemVSG::BindMesh(const std::shared_ptr<ChPhysicsItem>& item) {
     const auto& vis_model = item->GetVisualModel();
 
@@ -1525,9 +1894,13 @@ void ChVisualSystemVSG::BindItem(std::shared_ptr<ChPhysicsItem> item) {
 void ChVisualSystemVSG::BindAll() {
     for (auto sys : m_systems) {
         // Bind visual models associated with bodies in the system
-        for (const auto& body : sys->GetAssembly().GetBodies()) {
-            BindBodyFrame(body);
-            BindBody(body);
+        // (bodies sharing a visual shape are bound as instances of that shape, if possible)
+        const auto& bodies = sys->GetAssembly().GetBodies();
+        auto instanced = BindInstancedBodies(bodies);
+        for (size_t i = 0; i < bodies.size(); i++) {
+            BindBodyFrame(bodies[i]);
+            if (!instanced[i])
+                BindBody(bodies[i]);
         }
 
         // Bind visual models associated with links in the system
@@ -1567,12 +1940,20 @@ void ChVisualSystemVSG::UpdateFromMBS() {
             if (!child.node->getValue("Transform", transform))
                 continue;
 
+            if (m_snapshot) {
+                auto it = m_snapshot_body_index.find(body.get());
+                if (it != m_snapshot_body_index.end())
+                    transform->matrix = vsg::dmat4CH(m_snapshot->body_com_frames[it->second], m_cog_frame_scale);
+                continue;
+            }
+
             transform->matrix = vsg::dmat4CH(body->GetFrameCOMToAbs(), m_cog_frame_scale);
         }
     }
 
     // Update VSG nodes for joint frame visualization
-    if (m_show_joint_frames) {
+    // (link states are not included in the snapshots rendered in a separate thread)
+    if (m_show_joint_frames && !m_snapshot) {
         for (auto& child : m_jointFrameScene->children) {
             std::shared_ptr<ChLinkBase> link;
             vsg::ref_ptr<vsg::MatrixTransform> transform;
@@ -1603,10 +1984,12 @@ void ChVisualSystemVSG::UpdateFromMBS() {
             continue;
         if (!child->getValue("Transform", transform))
             continue;
-        transform->matrix = vsg::dmat4CH(body->GetVisualModelFrame(), 1.0);
+        transform->matrix = vsg::dmat4CH(GetBodyVisualFrame(body), 1.0);
     }
 
     // Update VSG nodes for link visualization
+    if (m_snapshot)
+        return;
     for (const auto& child : m_linkScene->children) {
         std::shared_ptr<ChLinkBase> link;
         ChVisualModel::ShapeInstance shapeInstance;
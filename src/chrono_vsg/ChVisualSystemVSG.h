@@ -17,6 +17,9 @@
 
 #include <iostream>
 #include <string>
+#include <atomic>
+#include <thread>
+#include <unordered_map>
 
 #include <vsg/all.h>
 #include <vsgXchange/all.h>
@@ -46,6 +49,8 @@
 #include "chrono/physics/ChLoadContainer.h"
 #include "chrono/physics/ChParticleCloud.h"
 
+#include "chrono/utils/ChTripleBuffer.h"
+
 #include "chrono_vsg/ChApiVSG.h"
 #include "chrono_vsg/ChGuiComponentVSG.h"
 #include "chrono_vsg/ChEventHandlerVSG.h"
@@ -96,6 +101,32 @@ class CH_VSG_API ChVisualSystemVSG : virtual public ChVisualSystem {
     /// </pre>
     virtual void Render() override;
 
+    /// Start rendering in a separate thread, at the specified target frame rate.
+    /// This function must be called instead of Initialize(), after all visual models were created. The visualization
+    /// window is then created and managed by a dedicated render thread, which draws the most recent state snapshot at
+    /// its own rate. Calls to Render() from the simulation thread only publish a snapshot of the current state (body
+    /// poses, deformable mesh and particle cloud data) through a lock-free triple buffer and never wait for the frame
+    /// being drawn. Run() returns false once the window is closed.
+    /// Notes:
+    /// - link shapes (springs, segments) and joint frames are not updated in this mode;
+    /// - GUI components and event handlers are executed on the render thread and must not modify the simulation,
+    ///   other than through plain data fields (such as driver inputs) which are read at the next step.
+    void StartRenderThread(double fps = 60);
+
+    /// Stop the render thread and close the visualization window.
+    void StopRenderThread();
+
+    /// Return true if rendering is performed in a separate thread.
+    bool IsRenderThreadRunning() const { return m_render_thread.joinable(); }
+
+    /// Return the simulation real-time factor.
+    /// If rendering in a separate thread, this is the value at the time of the currently rendered snapshot.
+    virtual double GetSimulationRTF() const override;
+
+    /// Return the current simulated time.
+    /// If rendering in a separate thread, this is the time of the currently rendered snapshot.
+    virtual double GetSimulationTime() const override;
+
     /// Render COG frames for all bodies in the system.
     virtual void RenderCOGFrames(double axis_length = 1) override;
 
@@ -128,6 +159,15 @@ class CH_VSG_API ChVisualSystemVSG : virtual public ChVisualSystem {
     /// Draw the scene objects as wireframes.
     void SetWireFrameMode(bool mode = true) { m_wireframe = mode; }
 
+    /// Enable/disable instanced rendering of bodies that share a visual shape (default: true).
+    /// If enabled, bodies whose visual model consists of a single primitive shape (box, sphere, ellipsoid, cylinder,
+    /// capsule, or cone), shared with at least as many other bodies as the instancing threshold, are rendered with a
+    /// single draw call per shape. The model matrices of all instances are streamed at each frame into one GPU buffer,
+    /// instead of updating one scene graph transform per body. Must be called before Initialize().
+    void EnableInstancing(bool val) { m_use_instancing = val; }
+
+    /// Set the minimum number of bodies sharing a visual shape for which instanced rendering is used (default: 16).
+    void SetInstancingThreshold(unsigned int num_bodies) { m_instancing_threshold = num_bodies; }
     /// Set the camera up vector (default: Z).
     void SetCameraVertical(CameraVerticalDir upDir);
 
@@ -217,6 +257,10 @@ class CH_VSG_API ChVisualSystemVSG : virtual public ChVisualSystem {
 
     void UpdateFromMBS();
 
+    /// Set the camera position and target from the simulation thread.
+    /// If rendering in a separate thread, the camera is updated with the next published snapshot.
+    void SetCameraLookAt(const ChVector3d& eye, const ChVector3d& target);
+
     int m_screen_num = -1;
     bool m_use_fullscreen = false;
     bool m_use_shadows = false;
@@ -263,10 +307,12 @@ class CH_VSG_API ChVisualSystemVSG : virtual public ChVisualSystem {
     vsg::ref_ptr<vsg::Builder> m_vsgBuilder;
     vsg::ref_ptr<ShapeBuilder> m_shapeBuilder;
 
-    bool m_verbose;               ///< VSG terminal initialization output
-    bool m_wireframe;             ///< draw as wireframes
-    bool m_capture_image;         ///< export current frame to image file
-    std::string m_imageFilename;  ///< name of file to export current frame
+    bool m_verbose;                       ///< VSG terminal initialization output
+    bool m_wireframe;                     ///< draw as wireframes
+    bool m_use_instancing;                ///< render bodies sharing a visual shape with instancing
+    unsigned int m_instancing_threshold;  ///< minimum number of bodies sharing a shape for instanced rendering
+    bool m_capture_image;                 ///< export current frame to image file
+    std::string m_imageFilename;          ///< name of file to export current frame
 
     /// Data related to deformable meshes (FEA and SCM).
     struct DeformableMesh {
@@ -291,13 +337,70 @@ class CH_VSG_API ChVisualSystemVSG : virtual public ChVisualSystem {
     };
     std::vector<ParticleCloud> m_clouds;
 
+    /// Data for bodies rendered as instances of a shared visual shape.
+    struct InstancedShape {
+        std::shared_ptr<ChVisualShape> shape;         ///< visual shape shared by all instances
+        std::vector<std::shared_ptr<ChBody>> bodies;  ///< bodies rendered as instances of this shape
+        std::vector<vsg::dmat4> shape_transforms;     ///< shape transforms (with scaling) in body visual frames
+        vsg::ref_ptr<vsg::mat4Array> transforms;      ///< model matrices of all instances (streamed to the GPU)
+    };
+    std::vector<InstancedShape> m_instanced_shapes;
+
+    /// State snapshot published by the simulation thread, when rendering in a separate thread.
+    struct Snapshot {
+        double time;                                           ///< simulation time
+        double rtf;                                            ///< simulation real-time factor
+        bool update_camera;                                    ///< camera position and target were set
+        ChVector3d camera_eye;                                 ///< camera position
+        ChVector3d camera_target;                              ///< camera target
+        std::vector<ChFrame<>> body_frames;                    ///< body visual model frames
+        std::vector<ChFrame<>> body_com_frames;                ///< body COM frames
+        std::vector<std::vector<ChVector3d>> mesh_vertices;    ///< deformable mesh vertices
+        std::vector<std::vector<ChVector3d>> mesh_normals;     ///< deformable mesh normals
+        std::vector<std::vector<ChColor>> mesh_colors;         ///< deformable mesh vertex colors
+        std::vector<std::vector<ChVector3d>> cloud_positions;  ///< particle positions
+        std::vector<std::vector<ChColor>> cloud_colors;        ///< particle colors
+    };
+
+    /// Collect the current state of all bound items and publish it to the render thread.
+    void PublishSnapshot();
+
+    /// Main loop of the render thread (after initialization).
+    void RenderLoop(double fps);
+
+    /// Return the visual model frame of the given body (from the current snapshot, if rendering in a separate thread).
+    const ChFrame<>& GetBodyVisualFrame(const std::shared_ptr<ChBody>& body) const;
+
+    utils::ChTripleBuffer<Snapshot> m_snapshots;  ///< snapshots passed from the simulation to the render thread
+    const Snapshot* m_snapshot;                   ///< snapshot currently rendered (render thread only)
+    std::thread m_render_thread;                  ///< render thread
+    std::atomic<bool> m_render_active;            ///< render thread running and window open
+    std::atomic<bool> m_render_stop;              ///< request to stop the render thread
+
+    std::vector<std::shared_ptr<ChBody>> m_snapshot_bodies;                            ///< bodies in the snapshot
+    std::unordered_map<const ChBody*, size_t> m_snapshot_body_index;                   ///< body -> snapshot index
+    std::vector<std::shared_ptr<ChTriangleMeshConnected>> m_snapshot_meshes;           ///< meshes in the snapshot
+    std::unordered_map<const ChTriangleMeshConnected*, size_t> m_snapshot_mesh_index;  ///< mesh -> snapshot index
+    std::vector<std::shared_ptr<ChParticleCloud>> m_snapshot_clouds;                   ///< clouds in the snapshot
+    std::unordered_map<const ChParticleCloud*, size_t> m_snapshot_cloud_index;         ///< cloud -> snapshot index
+    bool m_snapshot_update_camera;                                                     ///< new camera set
+    ChVector3d m_snapshot_camera_eye;                                                  ///< last camera position
+    ChVector3d m_snapshot_camera_target;                                               ///< last camera target
+
     /// export screen image as file (png, bmp, tga, jpg)
     void exportScreenImage();
 
   private:
+    /// Draw all 3D shapes and GUI elements (from the current snapshot, if rendering in a separate thread).
+    void RenderFrame();
+
     /// Bind the visual model associated with a body.
     void BindBody(const std::shared_ptr<ChBody>& body);
 
+    /// Bind the bodies in the given list that can be rendered as instances of a shared visual shape.
+    /// Return a flag for each body in the list, indicating whether or not it was bound.
+    std::vector<bool> BindInstancedBodies(const std::vector<std::shared_ptr<ChBody>>& bodies);
+
     /// Bind meshes in the visual model associated with the given physics item.
     void BindMesh(const std::shared_ptr<ChPhysicsItem>& item);
 
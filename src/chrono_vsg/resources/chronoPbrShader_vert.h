@@ -16,7 +16,7 @@ Root id=1 vsg::ShaderStage
     source "#version 450
 #extension GL_ARB_separate_shader_objects : enable
 
-#pragma import_defines (VSG_INSTANCE_POSITIONS, VSG_BILLBOARD, VSG_DISPLACEMENT_MAP, VSG_SKINNING)
+#pragma import_defines (VSG_INSTANCE_POSITIONS, VSG_INSTANCE_TRANSFORMS, VSG_BILLBOARD, VSG_DISPLACEMENT_MAP, VSG_SKINNING)
 
 #define VIEW_DESCRIPTOR_SET 0
 #define MATERIAL_DESCRIPTOR_SET 1
@@ -52,6 +52,13 @@ layout(set = MATERIAL_DESCRIPTOR_SET, binding = 11) buffer JointMatrices
 } joint;
 #endif
 
+#ifdef VSG_INSTANCE_TRANSFORMS
+layout(set = MATERIAL_DESCRIPTOR_SET, binding = 12) readonly buffer InstanceTransforms
+{
+	mat4 matrices[];
+} instances;
+#endif
+
 layout(location = 0) out vec3 eyePos;
 layout(location = 1) out vec3 normalDir;
 layout(location = 2) out vec4 vertexColor;
@@ -130,6 +137,8 @@ void main()
         vsg_JointWeights.w * joint.matrices[vsg_JointIndices.w];
 
     mat4 mv = pc.modelView * skinMat;
+#elif defined(VSG_INSTANCE_TRANSFORMS)
+    mat4 mv = pc.modelView * instances.matrices[gl_InstanceIndex];
 #else
     mat4 mv = pc.modelView;
 #endif
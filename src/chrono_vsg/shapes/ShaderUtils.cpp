@@ -118,6 +118,9 @@ vsg::ref_ptr<vsg::ShaderSet> createPbrShaderSet(vsg::ref_ptr<const vsg::Options>
     shaderSet->addDescriptorBinding("jointMatrices", "VSG_SKINNING", MATERIAL_DESCRIPTOR_SET, 11,
                                     VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT,
                                     vsg::mat4Value::create());
+    shaderSet->addDescriptorBinding("instanceTransforms", "VSG_INSTANCE_TRANSFORMS", MATERIAL_DESCRIPTOR_SET, 12,
+                                    VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT,
+                                    vsg::mat4Array::create(1));
 
     shaderSet->addDescriptorBinding("lightData", "", VIEW_DESCRIPTOR_SET, 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1,
                                     VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
@@ -205,7 +208,8 @@ vsg::ref_ptr<vsg::StateGroup> createLineStateGroup(vsg::ref_ptr<const vsg::Optio
 
 vsg::ref_ptr<vsg::StateGroup> createPbrStateGroup(vsg::ref_ptr<const vsg::Options> options,
                                                   std::shared_ptr<ChVisualMaterial> material,
-                                                  bool wireframe) {
+                                                  bool wireframe,
+                                                  vsg::ref_ptr<vsg::mat4Array> instance_transforms) {
     vsg::ref_ptr<vsg::SharedObjects> sharedObjects;
 
     bool use_blending = (material->GetOpacity() < 1.0) || (!material->GetOpacityTexture().empty());
@@ -235,6 +239,10 @@ vsg::ref_ptr<vsg::StateGroup> createPbrStateGroup(vsg::ref_ptr<const vsg::Option
     graphicsPipelineConfig->enableArray("vsg_TexCoord0", VK_VERTEX_INPUT_RATE_VERTEX, 8);
     graphicsPipelineConfig->enableArray("vsg_Color", VK_VERTEX_INPUT_RATE_VERTEX, 16);
 
+    // per-instance model matrices, read in the vertex shader from a storage buffer indexed by the instance index
+    if (instance_transforms)
+        graphicsPipelineConfig->assignDescriptor("instanceTransforms", instance_transforms);
+
     /*
     if (wireframe) {
         graphicsPipelineConfig->rasterizationState->polygonMode = VK_POLYGON_MODE_LINE;
@@ -443,6 +451,9 @@ vsg::ref_ptr<vsg::StateGroup> createPbrStateGroup(vsg::ref_ptr<const vsg::Option
     graphicsPipelineConfig->accept(sps);
 
     // if required initialize GraphicsPipeline/Layout etc.
+    // (a state group with per-instance transforms is not shared, as its descriptor data changes at each frame)
+    if (instance_transforms)
+        sharedObjects = {};
     if (sharedObjects)
         sharedObjects->share(graphicsPipelineConfig, [](auto gpc) { gpc->init(); });
     else
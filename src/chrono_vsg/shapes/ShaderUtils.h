@@ -31,9 +31,12 @@ vsg::ref_ptr<vsg::ShaderSet> createPbrShaderSet(vsg::ref_ptr<const vsg::Options>
 vsg::ref_ptr<vsg::StateGroup> createLineStateGroup(vsg::ref_ptr<const vsg::Options> options,
                                                    VkPrimitiveTopology topology);
 
+/// Create the PBR state group for the given material.
+/// If instance transforms are provided, the model matrix of each drawn instance is read from this array.
 vsg::ref_ptr<vsg::StateGroup> createPbrStateGroup(vsg::ref_ptr<const vsg::Options> options,
                                                   std::shared_ptr<ChVisualMaterial> material,
-                                                  bool wireframe);
+                                                  bool wireframe,
+                                                  vsg::ref_ptr<vsg::mat4Array> instance_transforms = {});
 
 vsg::ref_ptr<vsg::PbrMaterialValue> createPbrMaterialFromChronoMaterial(std::shared_ptr<ChVisualMaterial> chronoMat);
 vsg::ref_ptr<vsg::PhongMaterialValue> createPhongMaterialFromChronoMaterial(
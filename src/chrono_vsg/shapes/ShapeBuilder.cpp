@@ -49,8 +49,9 @@ vsg::ref_ptr<vsg::Group> ShapeBuilder::CreatePbrShape(vsg::ref_ptr<vsg::vec3Arra
                                                       vsg::ref_ptr<vsg::ushortArray>& indices,
                                                       std::shared_ptr<ChVisualMaterial> material,
                                                       vsg::ref_ptr<vsg::MatrixTransform> transform,
-                                                      bool wireframe) {
-    const uint32_t instanceCount = 1;
+                                                      bool wireframe,
+                                                      vsg::ref_ptr<vsg::mat4Array> instances) {
+    const uint32_t instanceCount = instances ? static_cast<uint32_t>(instances->size()) : 1;
 
     // apply texture scaling
     for (size_t i = 0; i < texcoords->size(); i++) {
@@ -62,7 +63,7 @@ vsg::ref_ptr<vsg::Group> ShapeBuilder::CreatePbrShape(vsg::ref_ptr<vsg::vec3Arra
     auto colors =
         vsg::vec4Array::create(vertices->size(), vsg::vec4CH(material->GetDiffuseColor(), material->GetOpacity()));
     auto scenegraph = vsg::Group::create();
-    auto stategraph = createPbrStateGroup(m_options, material, wireframe);
+    auto stategraph = createPbrStateGroup(m_options, material, wireframe, instances);
     transform->subgraphRequiresLocalFrustum = false;
 
     // setup geometry
@@ -100,7 +101,34 @@ vsg::ref_ptr<vsg::Group> ShapeBuilder::CreatePbrShape(ShapeType shape_type,
     vsg::ref_ptr<vsg::vec3Array> normals;
     vsg::ref_ptr<vsg::vec2Array> texcoords;
     vsg::ref_ptr<vsg::ushortArray> indices;
+    GetPrimitiveShapeData(shape_type, vertices, normals, texcoords, indices);
+
+    auto scenegraph = CreatePbrShape(vertices, normals, texcoords, indices, material, transform, wireframe);
+    return scenegraph;
+}
 
+vsg::ref_ptr<vsg::Group> ShapeBuilder::CreateInstancedPbrShape(ShapeType shape_type,
+                                                               std::shared_ptr<ChVisualMaterial> material,
+                                                               vsg::ref_ptr<vsg::mat4Array> transforms,
+                                                               bool wireframe) {
+    vsg::ref_ptr<vsg::vec3Array> vertices;
+    vsg::ref_ptr<vsg::vec3Array> normals;
+    vsg::ref_ptr<vsg::vec2Array> texcoords;
+    vsg::ref_ptr<vsg::ushortArray> indices;
+    GetPrimitiveShapeData(shape_type, vertices, normals, texcoords, indices);
+
+    // All placement information is in the per-instance transforms
+    auto transform = vsg::MatrixTransform::create();
+
+    auto scenegraph = CreatePbrShape(vertices, normals, texcoords, indices, material, transform, wireframe, transforms);
+    return scenegraph;
+}
+
+void ShapeBuilder::GetPrimitiveShapeData(ShapeType shape_type,
+                                         vsg::ref_ptr<vsg::vec3Array>& vertices,
+                                         vsg::ref_ptr<vsg::vec3Array>& normals,
+                                         vsg::ref_ptr<vsg::vec2Array>& texcoords,
+                                         vsg::ref_ptr<vsg::ushortArray>& indices) {
     // Important:
     // the unique texcoords cannot be used directly to allow individual scaling
     // a copy is taken therefore
@@ -160,8 +188,6 @@ vsg::ref_ptr<vsg::Group> ShapeBuilder::CreatePbrShape(ShapeType shape_type,
             indices = m_cone_data->indices;
             break;
     }
-    auto scenegraph = CreatePbrShape(vertices, normals, texcoords, indices, material, transform, wireframe);
-    return scenegraph;
 }
 
 vsg::ref_ptr<vsg::Group> ShapeBuilder::CreatePbrSurfaceShape(std::shared_ptr<ChVisualShapeSurface> surface,
@@ -48,6 +48,14 @@ class CH_VSG_API ShapeBuilder : public vsg::Inherit<vsg::Object, ShapeBuilder> {
                                             vsg::ref_ptr<vsg::MatrixTransform> transform,
                                             bool wireframe);
 
+    /// Create a primitive shape drawn once for each of the specified model matrices, with a single draw call.
+    /// The transforms array is referenced (not copied) by the returned node; changes to its values, followed by a call
+    /// to its dirty() function, are uploaded to the GPU at the next frame.
+    vsg::ref_ptr<vsg::Group> CreateInstancedPbrShape(ShapeType shape_type,
+                                                     std::shared_ptr<ChVisualMaterial> material,
+                                                     vsg::ref_ptr<vsg::mat4Array> transforms,
+                                                     bool wireframe);
+
     vsg::ref_ptr<vsg::Group> CreatePbrSurfaceShape(std::shared_ptr<ChVisualShapeSurface> surface,
                                                    std::shared_ptr<ChVisualMaterial> material,
                                                    vsg::ref_ptr<vsg::MatrixTransform> transform,
@@ -137,7 +145,14 @@ class CH_VSG_API ShapeBuilder : public vsg::Inherit<vsg::Object, ShapeBuilder> {
                                             vsg::ref_ptr<vsg::ushortArray>& indices,
                                             std::shared_ptr<ChVisualMaterial> material,
                                             vsg::ref_ptr<vsg::MatrixTransform> transform,
-                                            bool wireframe);
+                                            bool wireframe,
+                                            vsg::ref_ptr<vsg::mat4Array> instances = {});
+
+    void GetPrimitiveShapeData(ShapeType shape_type,
+                               vsg::ref_ptr<vsg::vec3Array>& vertices,
+                               vsg::ref_ptr<vsg::vec3Array>& normals,
+                               vsg::ref_ptr<vsg::vec2Array>& texcoords,
+                               vsg::ref_ptr<vsg::ushortArray>& indices);
 
     vsg::ref_ptr<vsg::Options> m_options;
     vsg::ref_ptr<vsg::CompileTraversal> compileTraversal;
@@ -33,6 +33,7 @@
 
 #include "chrono_gpu/physics/ChSystemGpu.h"
 #include "chrono_gpu/utils/ChGpuJsonParser.h"
+#include "chrono_gpu/utils/ChGpuRigidBodyCoupling.h"
 #include "chrono_gpu/utils/ChGpuVisualization.h"
 
 #include "chrono_thirdparty/filesystem/path.h"
@@ -78,6 +79,10 @@ void runBallDrop(ChSystemGpuMesh& gpu_sys, ChGpuSimulationParameters& params) {
     ball_body->AddVisualShape(sph);
     sys_ball.AddBody(ball_body);
 
+    // Couple the ball body with the GPU mesh (only the body state and the mesh contact wrench are exchanged)
+    ChGpuRigidBodyCoupling coupling(&gpu_sys, &sys_ball);
+    coupling.AddBody(ball_body, 0);
+
     ChGpuVisualization gpu_vis(&gpu_sys);
     if (render) {
         gpu_vis.SetTitle("Chrono::Gpu ball cosim demo");
@@ -103,17 +108,6 @@ void runBallDrop(ChSystemGpuMesh& gpu_sys, ChGpuSimulationParameters& params) {
 
     clock_t start = std::clock();
     for (double t = 0; t < (double)params.time_end; t += iteration_step, curr_step++) {
-        gpu_sys.ApplyMeshMotion(0, ball_body->GetPos(), ball_body->GetRot(), ball_body->GetPosDt(),
-                                ball_body->GetAngVelParent());
-
-        ChVector3d ball_force;
-        ChVector3d ball_torque;
-        gpu_sys.CollectMeshContactForces(0, ball_force, ball_torque);
-
-        ball_body->EmptyAccumulators();
-        ball_body->AccumulateForce(ball_force, ball_body->GetPos(), false);
-        ball_body->AccumulateTorque(ball_torque, false);
-
         if (curr_step % out_steps == 0) {
             std::cout << "Output frame " << currframe + 1 << " of " << total_frames << std::endl;
             char filename[100];
@@ -129,8 +123,7 @@ void runBallDrop(ChSystemGpuMesh& gpu_sys, ChGpuSimulationParameters& params) {
                 break;
         }
 
-        gpu_sys.AdvanceSimulation(iteration_step);
-        sys_ball.DoStepDynamics(iteration_step);
+        coupling.Advance(iteration_step);
     }
 
     clock_t end = std::clock();
@@ -148,6 +148,7 @@ int main(int argc, char* argv[]) {
     actuator->Cylinder().SetInitialChamberPressures(4.4e6, 3.3e6);
     actuator->DirectionalValve().SetInitialSpoolPosition(0);
     actuator->SetInitialLoad(F0);
+    ////actuator->EnableSubIntegration(true, 10);  // integrate hydraulics separately (allows larger step sizes)
     actuator->Initialize(ground, crane, true, attachment_ground, attachment_crane);
     sys.Add(actuator);
 
@@ -343,6 +343,10 @@ int main(int argc, char* argv[]) {
         true      // show a pointed tip on the end of the arrow, otherwise leave a simple cylinder
     );
 
+    // Optionally, save body positions and rotations in compact binary files (only bodies that moved since the
+    // previous frame), instead of Python commands at each frame
+    ////blender_exporter.SetUseBinaryStates(true);
+
     //
     // RUN THE SIMULATION AND SAVE THE BLENDER FILES AT EACH FRAME
     //
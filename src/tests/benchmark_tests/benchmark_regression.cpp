@@ -0,0 +1,144 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Performance regression harness for the Chrono benchmark tests.
+//
+// Each benchmark program is run with a fixed number of repetitions and its JSON
+// output (per-repetition times and ChBenchmarkTest timer breakdown) is either
+// stored as a baseline ("record" mode) or compared against the stored baseline
+// ("compare" mode), reporting statistically significant slowdowns. In compare
+// mode, the program exits with a non-zero code if any regression is found.
+//
+// The "benchmark_baseline" and "benchmark_regression_check" build targets run this
+// program for all benchmark tests.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include "chrono/utils/ChBenchmarkRegression.h"
+
+#include "chrono_thirdparty/cxxopts/ChCLI.h"
+#include "chrono_thirdparty/filesystem/path.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+// Run a benchmark program and collect its results.
+bool RunBenchmark(const std::string& program,
+                  const std::string& out_file,
+                  int repetitions,
+                  const std::string& filter,
+                  ChBenchmarkResults& results) {
+    std::string cmd = "\"" + program + "\" --benchmark_out=\"" + out_file + "\" --benchmark_out_format=json" +
+                      " --benchmark_repetitions=" + std::to_string(repetitions);
+    if (!filter.empty())
+        cmd += " --benchmark_filter=\"" + filter + "\"";
+
+    std::cout << "Running " << program << std::endl;
+    if (std::system(cmd.c_str()) != 0) {
+        std::cerr << "  ERROR: " << program << " failed" << std::endl;
+        return false;
+    }
+    return results.AddBenchmarkOutput(out_file);
+}
+
+int main(int argc, char* argv[]) {
+    ChCLI cli(argv[0], " - performance regression harness for Chrono benchmark tests");
+    cli.AddOption<std::string>("Harness", "m,mode", "record (store baselines) or compare (against baselines)",
+                               "compare");
+    cli.AddOption<std::string>("Harness", "b,baseline_dir", "Directory of the baseline files", "baselines");
+    cli.AddOption<std::string>("Harness", "o,output_dir", "Directory of the benchmark output files", ".");
+    cli.AddOption<std::vector<std::string>>("Harness", "p,programs", "Benchmark programs (comma separated)");
+    cli.AddOption<std::string>("Harness", "f,filter", "Benchmark filter passed to all programs", "");
+    cli.AddOption<int>("Statistics", "r,repetitions", "Number of repetitions of each benchmark", "10");
+    cli.AddOption<double>("Statistics", "a,alpha", "Significance level of the slowdown test", "0.01");
+    cli.AddOption<double>("Statistics", "t,threshold", "Minimum relative slowdown reported", "0.05");
+    cli.AddOption<double>("Statistics", "floor", "Ignore metrics with a baseline mean below this value", "0.001");
+
+    if (!cli.Parse(argc, argv, true) || !cli.CheckOption("programs")) {
+        cli.Help();
+        return 1;
+    }
+
+    std::string mode = cli.GetAsType<std::string>("mode");
+    std::string baseline_dir = cli.GetAsType<std::string>("baseline_dir");
+    std::string output_dir = cli.GetAsType<std::string>("output_dir");
+    auto programs = cli.GetAsType<std::vector<std::string>>("programs");
+    std::string filter = cli.GetAsType<std::string>("filter");
+    int repetitions = cli.GetAsType<int>("repetitions");
+    double alpha = cli.GetAsType<double>("alpha");
+    double threshold = cli.GetAsType<double>("threshold");
+    double floor = cli.GetAsType<double>("floor");
+
+    if (mode != "record" && mode != "compare") {
+        std::cerr << "Unknown mode " << mode << std::endl;
+        return 1;
+    }
+    if (!filesystem::create_subdirectory(filesystem::path(output_dir)) ||
+        (mode == "record" && !filesystem::create_subdirectory(filesystem::path(baseline_dir)))) {
+        std::cerr << "Error creating output directories" << std::endl;
+        return 1;
+    }
+
+    int num_failed = 0;
+    int num_regressions = 0;
+    std::vector<std::string> missing;
+
+    for (const auto& program : programs) {
+        std::string name = filesystem::path(program).stem();
+        std::string out_file = output_dir + "/" + name + ".json";
+        std::string baseline_file = baseline_dir + "/" + name + ".json";
+
+        ChBenchmarkResults current;
+        if (!RunBenchmark(program, out_file, repetitions, filter, current)) {
+            num_failed++;
+            continue;
+        }
+
+        if (mode == "record") {
+            if (!current.WriteBaseline(baseline_file))
+                num_failed++;
+            continue;
+        }
+
+        ChBenchmarkResults baseline;
+        if (!filesystem::path(baseline_file).exists() || !baseline.ReadBaseline(baseline_file)) {
+            missing.push_back(name);
+            continue;
+        }
+
+        auto regressions = CompareBenchmarkResults(baseline, current, alpha, threshold, floor);
+        for (const auto& r : regressions) {
+            std::cout << "  REGRESSION  " << r.benchmark << "  " << r.metric << ": " << r.baseline_mean << " -> "
+                      << r.current_mean << "  (+" << std::fixed << std::setprecision(1) << 100 * r.change
+                      << "%, p=" << std::scientific << std::setprecision(2) << r.p_value << ")" << std::defaultfloat
+                      << std::endl;
+        }
+        num_regressions += (int)regressions.size();
+    }
+
+    std::cout << std::endl;
+    for (const auto& name : missing)
+        std::cout << "No baseline for " << name << std::endl;
+    if (mode == "compare")
+        std::cout << "Significant slowdowns: " << num_regressions << std::endl;
+    if (num_failed > 0)
+        std::cout << "Failed benchmark programs: " << num_failed << std::endl;
+
+    return (num_failed > 0 || num_regressions > 0) ? 1 : 0;
+}
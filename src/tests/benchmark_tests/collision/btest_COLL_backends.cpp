@@ -0,0 +1,169 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Benchmarks comparing the Bullet and multicore collision systems.
+//
+// Each benchmark builds a scene of randomly placed and oriented bodies with the
+// same collision shape and times only the collision detection pipeline (sync of
+// collision models, broadphase, narrowphase, and contact reporting), with no
+// dynamics. Benchmarks are parameterized by the shape type, the number of
+// bodies, the packing density (volume fraction, in percent), and the number of
+// collision threads. The following counters are reported:
+//   CD_Broad         - broadphase time per collision pass (ms)
+//   CD_Narrow        - narrowphase time per collision pass (ms)
+//   Contacts         - number of contacts found in the scene
+//   Contacts_per_sec - number of contacts reported per second (wall clock)
+//
+// The multicore collision system benchmarks are available only if Chrono was
+// built with Thrust support. Use --benchmark_format=json for machine-readable
+// output and --benchmark_filter=<regex> to run a subset of the benchmarks.
+//
+// =============================================================================
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "chrono/ChConfig.h"
+#include "chrono/collision/ChCollisionShapeBox.h"
+#include "chrono/collision/ChCollisionShapeConvexHull.h"
+#include "chrono/collision/ChCollisionShapeSphere.h"
+#include "chrono/collision/ChCollisionShapeTriangleMesh.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChBenchmark.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+enum ShapeType { SPHERE, BOX, HULL, MESH };
+
+// Create an icosahedron mesh with circumradius 0.5
+static std::shared_ptr<ChTriangleMeshConnected> CreateIcosahedron() {
+    auto mesh = chrono_types::make_shared<ChTriangleMeshConnected>();
+    double t = (1 + std::sqrt(5.0)) / 2;
+    double s = 0.5 / std::sqrt(1 + t * t);
+
+    mesh->GetCoordsVertices() = {{-s, t * s, 0}, {s, t * s, 0},   {-s, -t * s, 0}, {s, -t * s, 0},
+                                 {0, -s, t * s}, {0, s, t * s},   {0, -s, -t * s}, {0, s, -t * s},
+                                 {t * s, 0, -s}, {t * s, 0, s},   {-t * s, 0, -s}, {-t * s, 0, s}};
+    mesh->GetIndicesVertexes() = {{0, 11, 5}, {0, 5, 1},  {0, 1, 7},   {0, 7, 10}, {0, 10, 11},
+                                  {1, 5, 9},  {5, 11, 4}, {11, 10, 2}, {10, 7, 6}, {7, 1, 8},
+                                  {3, 9, 4},  {3, 4, 2},  {3, 2, 6},   {3, 6, 8},  {3, 8, 9},
+                                  {4, 9, 5},  {2, 4, 11}, {6, 2, 10},  {8, 6, 7},  {9, 8, 1}};
+
+    return mesh;
+}
+
+// Create a scene with bodies of unit size, randomly placed in a cube and randomly oriented.
+// The cube size is set so that the bounding boxes of the bodies occupy the specified volume fraction.
+static void CreateScene(ChSystem& sys, ShapeType shape_type, int num_bodies, double density) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    double size = std::cbrt(num_bodies / density);
+
+    std::vector<ChVector3d> hull_points;
+    for (int i = 0; i < 20; i++) {
+        double phi = CH_2PI * dist(gen);
+        double z = 2 * dist(gen) - 1;
+        double r = std::sqrt(1 - z * z);
+        hull_points.push_back(0.5 * ChVector3d(r * std::cos(phi), r * std::sin(phi), z));
+    }
+
+    auto mesh = CreateIcosahedron();
+
+    for (int i = 0; i < num_bodies; i++) {
+        std::shared_ptr<ChCollisionShape> shape;
+        switch (shape_type) {
+            case SPHERE:
+                shape = chrono_types::make_shared<ChCollisionShapeSphere>(mat, 0.5);
+                break;
+            case BOX:
+                shape = chrono_types::make_shared<ChCollisionShapeBox>(mat, 1.0, 1.0, 1.0);
+                break;
+            case HULL:
+                shape = chrono_types::make_shared<ChCollisionShapeConvexHull>(mat, hull_points);
+                break;
+            case MESH:
+                shape = chrono_types::make_shared<ChCollisionShapeTriangleMesh>(mat, mesh, false, false, 0.01);
+                break;
+        }
+
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetPos(size * ChVector3d(dist(gen), dist(gen), dist(gen)));
+        body->SetRot(QuatFromAngleAxis(CH_2PI * dist(gen), ChVector3d(dist(gen), dist(gen), dist(gen) + 0.1)));
+        body->AddCollisionShape(shape);
+        body->EnableCollision(true);
+        sys.AddBody(body);
+    }
+}
+
+// =============================================================================
+
+// Benchmark arguments: shape type, number of bodies, density (percent), number of threads
+template <ChCollisionSystem::Type COLLISION_TYPE>
+static void Collision(benchmark::State& st) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(COLLISION_TYPE);
+    CreateScene(sys, (ShapeType)st.range(0), (int)st.range(1), st.range(2) / 100.0);
+
+    auto coll_sys = sys.GetCollisionSystem();
+    coll_sys->SetNumThreads((int)st.range(3));
+    coll_sys->Initialize();
+
+    // Warm up (initial broadphase construction and contact caches)
+    sys.ComputeCollisions();
+    sys.ResetTimers();
+
+    unsigned int num_contacts = 0;
+    for (auto _ : st) {
+        sys.ComputeCollisions();
+        num_contacts = sys.GetNumContacts();
+    }
+
+    auto avg = benchmark::Counter::kAvgIterations;
+    st.counters["CD_Broad"] = benchmark::Counter(sys.GetTimerCollisionBroad() * 1e3, avg);
+    st.counters["CD_Narrow"] = benchmark::Counter(sys.GetTimerCollisionNarrow() * 1e3, avg);
+    st.counters["Contacts"] = num_contacts;
+    st.counters["Contacts_per_sec"] = benchmark::Counter(num_contacts, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Sweep the scene size and density and the number of threads, for each shape type
+static void CollisionArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"shape", "bodies", "density", "threads"});
+    for (int shape : {SPHERE, BOX, HULL, MESH}) {
+        int max_bodies = (shape == SPHERE || shape == BOX) ? 100000 : 10000;
+        for (int num_bodies = 1000; num_bodies <= max_bodies; num_bodies *= 10) {
+            for (int density : {5, 30}) {
+                for (int num_threads = 1; num_threads <= 8; num_threads *= 2)
+                    b->Args({shape, num_bodies, density, num_threads});
+            }
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE(Collision, ChCollisionSystem::Type::BULLET)
+    ->Apply(CollisionArgs)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+#ifdef CHRONO_COLLISION
+BENCHMARK_TEMPLATE(Collision, ChCollisionSystem::Type::MULTICORE)
+    ->Apply(CollisionArgs)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+#endif
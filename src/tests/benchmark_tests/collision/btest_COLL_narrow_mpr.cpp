@@ -0,0 +1,67 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Microbenchmarks for the MPR narrowphase in the multicore collision system.
+// Each benchmark processes a batch of randomly placed and oriented shape pairs.
+//
+// =============================================================================
+
+#include <random>
+#include <vector>
+
+#include "chrono/collision/multicore/ChNarrowphase.h"
+#include "chrono/collision/multicore/ChConvexShape.h"
+#include "chrono/utils/ChBenchmark.h"
+
+using namespace chrono;
+
+static const int N = 1024;
+
+// Benchmark argument: shape type of both shapes in a pair (ChCollisionShape::Type)
+static void MPRCollision(benchmark::State& st) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    int type = (int)st.range(0);
+    std::vector<ConvexShapeCustom> shapesA(N);
+    std::vector<ConvexShapeCustom> shapesB(N);
+    for (int i = 0; i < N; i++) {
+        quaternion qA = Normalize(quaternion((real)dist(gen), (real)dist(gen), (real)dist(gen), (real)dist(gen)));
+        quaternion qB = Normalize(quaternion((real)dist(gen), (real)dist(gen), (real)dist(gen), (real)dist(gen)));
+        real3 pB((real)(0.5 * dist(gen)), (real)(0.5 * dist(gen)), (real)(1.5 + 0.5 * dist(gen)));
+        shapesA[i] = ConvexShapeCustom(type, real3(0, 0, 0), qA, real3(0.5, 0.75, 1.0));
+        shapesB[i] = ConvexShapeCustom(type, pB, qB, real3(0.5, 0.75, 1.0));
+    }
+
+    int num_contacts = 0;
+    for (auto _ : st) {
+        num_contacts = 0;
+        for (int i = 0; i < N; i++) {
+            real3 normal, pointA, pointB;
+            real depth;
+            if (ChNarrowphase::MPRCollision(&shapesA[i], &shapesB[i], 0, normal, pointA, pointB, depth))
+                num_contacts++;
+            benchmark::DoNotOptimize(depth);
+        }
+    }
+    st.SetItemsProcessed(st.iterations() * N);
+    st.counters["contacts"] = num_contacts;
+}
+BENCHMARK(MPRCollision)
+    ->Arg(ChCollisionShape::Type::SPHERE)
+    ->Arg(ChCollisionShape::Type::ELLIPSOID)
+    ->Arg(ChCollisionShape::Type::BOX)
+    ->Arg(ChCollisionShape::Type::CYLINDER)
+    ->Arg(ChCollisionShape::Type::CAPSULE)
+    ->Unit(benchmark::kNanosecond);
@@ -0,0 +1,94 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Microbenchmarks for core math operations (ChMatrix33, ChQuaternion, ChFrame).
+// Each benchmark processes a batch of random operands, so that the reported
+// items/second is a per-operation throughput.
+//
+// =============================================================================
+
+#include <random>
+#include <vector>
+
+#include "chrono/core/ChFrame.h"
+#include "chrono/core/ChMatrix33.h"
+#include "chrono/core/ChQuaternion.h"
+#include "chrono/utils/ChBenchmark.h"
+
+using namespace chrono;
+
+// Benchmarking fixture: generate random vectors, rotations, and frames
+
+class MathBM : public ::benchmark::Fixture {
+  public:
+    static const int N = 1024;
+
+    void SetUp(const ::benchmark::State& st) override {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+        vectors.resize(N);
+        quats.resize(N);
+        mats.resize(N);
+        frames.resize(N);
+        for (int i = 0; i < N; i++) {
+            vectors[i] = ChVector3d(dist(gen), dist(gen), dist(gen));
+            quats[i] = ChQuaterniond(dist(gen), dist(gen), dist(gen), dist(gen)).GetNormalized();
+            mats[i] = ChMatrix33<>(quats[i]);
+            frames[i] = ChFrame<>(ChVector3d(dist(gen), dist(gen), dist(gen)), quats[i]);
+        }
+    }
+
+    void TearDown(const ::benchmark::State&) override {}
+
+    std::vector<ChVector3d> vectors;
+    std::vector<ChQuaterniond> quats;
+    std::vector<ChMatrix33<>> mats;
+    std::vector<ChFrame<>> frames;
+};
+
+// Utility macro for benchmarking an operation on the i-th set of operands
+
+#define BM_MATH_OP(TEST_NAME, OP)                                       \
+    BENCHMARK_DEFINE_F(MathBM, TEST_NAME)(benchmark::State & st) {      \
+        for (auto _ : st) {                                             \
+            for (int i = 0; i < N; i++) {                               \
+                int j = (i + 1) % N;                                    \
+                auto res = OP;                                          \
+                benchmark::DoNotOptimize(res);                          \
+            }                                                           \
+        }                                                               \
+        st.SetItemsProcessed(st.iterations() * N);                      \
+    }                                                                   \
+    BENCHMARK_REGISTER_F(MathBM, TEST_NAME)->Unit(benchmark::kNanosecond);
+
+// ChMatrix33 operations
+BM_MATH_OP(Mat33_times_vector, mats[i] * vectors[j])
+BM_MATH_OP(Mat33_transpose_times_vector, mats[i].transpose() * vectors[j])
+BM_MATH_OP(Mat33_times_mat33, ChMatrix33<>(mats[i] * mats[j]))
+BM_MATH_OP(Mat33_from_quaternion, ChMatrix33<>(quats[i]))
+BM_MATH_OP(Mat33_get_quaternion, mats[i].GetQuaternion())
+
+// ChQuaternion operations
+BM_MATH_OP(Quat_product, quats[i] * quats[j])
+BM_MATH_OP(Quat_rotate, quats[i].Rotate(vectors[j]))
+BM_MATH_OP(Quat_rotate_back, quats[i].RotateBack(vectors[j]))
+BM_MATH_OP(Quat_normalize, quats[i].GetNormalized())
+
+// ChFrame transforms
+BM_MATH_OP(Frame_point_to_parent, frames[i].TransformPointLocalToParent(vectors[j]))
+BM_MATH_OP(Frame_point_to_local, frames[i].TransformPointParentToLocal(vectors[j]))
+BM_MATH_OP(Frame_dir_to_parent, frames[i].TransformDirectionLocalToParent(vectors[j]))
+BM_MATH_OP(Frame_frame_to_parent, frames[i].TransformLocalToParent(frames[j]))
+BM_MATH_OP(Frame_inverse, frames[i].GetInverse())
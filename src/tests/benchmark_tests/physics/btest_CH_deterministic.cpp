@@ -0,0 +1,93 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Benchmark test for the overhead of deterministic parallel execution.
+// A pile of spheres settles on a fixed box using SMC contact, with parallel
+// evaluation of contact forces, with and without deterministic mode.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChContactContainerSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+template <int N, bool DETERMINISTIC>
+class PileTestSMC : public utils::ChBenchmarkTest {
+  public:
+    PileTestSMC();
+    ~PileTestSMC() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override { m_system->DoStepDynamics(m_step); }
+
+  private:
+    ChSystemSMC* m_system;
+    double m_step;
+};
+
+template <int N, bool DETERMINISTIC>
+PileTestSMC<N, DETERMINISTIC>::PileTestSMC() : m_system(new ChSystemSMC()), m_step(1e-4) {
+    m_system->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    m_system->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    m_system->SetNumThreads(4);
+    m_system->EnableDeterministic(DETERMINISTIC);
+
+    auto container = std::static_pointer_cast<ChContactContainerSMC>(m_system->GetContactContainer());
+    container->EnableParallelForces(true);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    mat->SetYoungModulus(2.0e5f);
+    mat->SetRestitution(0.3f);
+    mat->SetSlidingFriction(0.3f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(2.0 * N, 1.0, 2.0 * N, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, -0.5, 0));
+    ground->SetFixed(true);
+    m_system->AddBody(ground);
+
+    for (int layer = 0; layer < 4; layer++) {
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < N; j++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.3, 1000, false, true, mat);
+                ball->SetPos(ChVector3d(-0.6 * N / 2 + 0.6 * i + 0.1 * layer, 0.35 + 0.6 * layer,
+                                        -0.6 * N / 2 + 0.6 * j + 0.1 * layer));
+                m_system->AddBody(ball);
+            }
+        }
+    }
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 500  // number of steps for hot start
+#define NUM_SIM_STEPS 500   // number of simulation steps for each benchmark
+
+using PileTestSMC16 = PileTestSMC<16, false>;
+using PileTestSMC16det = PileTestSMC<16, true>;
+using PileTestSMC32 = PileTestSMC<32, false>;
+using PileTestSMC32det = PileTestSMC<32, true>;
+
+CH_BM_SIMULATION_LOOP(PileSMC16, PileTestSMC16, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(PileSMC16_deterministic, PileTestSMC16det, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(PileSMC32, PileTestSMC32, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(PileSMC32_deterministic, PileTestSMC32det, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,176 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Microbenchmarks for solver and contact kernels:
+// - ChVariablesBody::ComputeMassInverseTimesVector
+// - ChConstraintTwoTuplesContactN::Project (friction cone projection)
+// - default SMC contact force calculation (ChDefaultContactForceTorqueSMC)
+// - batched SMC contact force calculation (ChSystemSMC::CalculateContactForces)
+//
+// =============================================================================
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "chrono/physics/ChContactSMC.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChConstraintTwoTuplesContactN.h"
+#include "chrono/solver/ChConstraintTwoTuplesFrictionT.h"
+#include "chrono/solver/ChVariablesBodyOwnMass.h"
+#include "chrono/utils/ChBenchmark.h"
+
+using namespace chrono;
+
+static const int N = 1024;
+
+// -----------------------------------------------------------------------------
+
+static void MassInverseTimesVector(benchmark::State& st) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(0.5, 1.5);
+
+    std::vector<ChVariablesBodyOwnMass> variables(N);
+    for (auto& var : variables) {
+        var.SetBodyMass(dist(gen));
+        ChMatrix33<> inertia(ChVector3d(dist(gen), dist(gen), dist(gen)));
+        var.SetBodyInertia(inertia);
+    }
+    ChVectorDynamic<> vect(6 * N);
+    ChVectorDynamic<> result(6 * N);
+    for (int i = 0; i < 6 * N; i++)
+        vect(i) = dist(gen);
+
+    for (auto _ : st) {
+        for (int i = 0; i < N; i++)
+            variables[i].ComputeMassInverseTimesVector(result.segment(6 * i, 6), vect.segment(6 * i, 6));
+        benchmark::DoNotOptimize(result.data());
+    }
+    st.SetItemsProcessed(st.iterations() * N);
+}
+BENCHMARK(MassInverseTimesVector)->Unit(benchmark::kNanosecond);
+
+// -----------------------------------------------------------------------------
+
+typedef ChVariableTupleCarrier_1vars<6> BodyTupleCarrier;
+
+static void ContactProject(benchmark::State& st) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    // Random multipliers covering all branches of the projection (inside upper cone, inside lower cone, outside)
+    std::vector<ChConstraintTwoTuplesContactN<BodyTupleCarrier, BodyTupleCarrier>> Nx(N);
+    std::vector<ChConstraintTwoTuplesFrictionT<BodyTupleCarrier, BodyTupleCarrier>> Tu(N);
+    std::vector<ChConstraintTwoTuplesFrictionT<BodyTupleCarrier, BodyTupleCarrier>> Tv(N);
+    std::vector<ChVector3d> lambda(N);
+    for (int i = 0; i < N; i++) {
+        Nx[i].SetTangentialConstraintU(&Tu[i]);
+        Nx[i].SetTangentialConstraintV(&Tv[i]);
+        Nx[i].SetFrictionCoefficient(0.5);
+        lambda[i] = ChVector3d(dist(gen), dist(gen), dist(gen));
+    }
+
+    for (auto _ : st) {
+        for (int i = 0; i < N; i++) {
+            Nx[i].SetLagrangeMultiplier(lambda[i].x());
+            Tu[i].SetLagrangeMultiplier(lambda[i].y());
+            Tv[i].SetLagrangeMultiplier(lambda[i].z());
+            Nx[i].Project();
+        }
+        benchmark::ClobberMemory();
+    }
+    st.SetItemsProcessed(st.iterations() * N);
+}
+BENCHMARK(ContactProject)->Unit(benchmark::kNanosecond);
+
+// -----------------------------------------------------------------------------
+
+// Benchmark argument: SMC normal contact force model (ChSystemSMC::ContactForceModel)
+static void ContactForceSMC(benchmark::State& st) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    ChSystemSMC sys;
+    sys.SetContactForceModel(static_cast<ChSystemSMC::ContactForceModel>(st.range(0)));
+    sys.UseMaterialProperties(true);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    ChContactMaterialCompositionStrategy strategy;
+    ChContactMaterialCompositeSMC cmat(&strategy, mat, mat);
+
+    ChDefaultContactForceTorqueSMC algorithm;
+
+    std::vector<ChVector3d> normal(N);
+    std::vector<ChVector3d> vel1(N);
+    std::vector<ChVector3d> vel2(N);
+    std::vector<double> delta(N);
+    for (int i = 0; i < N; i++) {
+        normal[i] = ChVector3d(dist(gen), dist(gen), dist(gen)).GetNormalized();
+        vel1[i] = ChVector3d(dist(gen), dist(gen), dist(gen));
+        vel2[i] = ChVector3d(dist(gen), dist(gen), dist(gen));
+        delta[i] = 1e-3 * (1 + dist(gen));
+    }
+
+    for (auto _ : st) {
+        for (int i = 0; i < N; i++) {
+            auto wrench = algorithm.CalculateForceTorque(sys, normal[i], VNULL, VNULL, vel1[i], vel2[i], cmat,
+                                                         delta[i], 0.1, 1.0, 1.0, nullptr, nullptr);
+            benchmark::DoNotOptimize(wrench);
+        }
+    }
+    st.SetItemsProcessed(st.iterations() * N);
+}
+BENCHMARK(ContactForceSMC)
+    ->Arg(ChSystemSMC::Hooke)
+    ->Arg(ChSystemSMC::Hertz)
+    ->Arg(ChSystemSMC::PlainCoulomb)
+    ->Unit(benchmark::kNanosecond);
+
+static void ContactForceSMCBatch(benchmark::State& st) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    ChSystemSMC sys;
+    sys.SetContactForceModel(static_cast<ChSystemSMC::ContactForceModel>(st.range(0)));
+    sys.UseMaterialProperties(true);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    ChContactMaterialCompositionStrategy strategy;
+    ChContactMaterialCompositeSMC cmat(&strategy, mat, mat);
+
+    std::vector<ChVector3d> normal(N);
+    std::vector<ChVector3d> relvel(N);
+    std::vector<double> delta(N);
+    std::vector<double> eff_radius(N, 0.1);
+    std::vector<double> mass(N, 1.0);
+    std::vector<ChContactMaterialCompositeSMC> cmats(N, cmat);
+    std::vector<ChVector3d> force(N);
+    for (int i = 0; i < N; i++) {
+        normal[i] = ChVector3d(dist(gen), dist(gen), dist(gen)).GetNormalized();
+        relvel[i] = ChVector3d(dist(gen), dist(gen), dist(gen)) - ChVector3d(dist(gen), dist(gen), dist(gen));
+        delta[i] = 1e-3 * (1 + dist(gen));
+    }
+
+    for (auto _ : st) {
+        sys.CalculateContactForces(N, delta.data(), eff_radius.data(), mass.data(), mass.data(), normal.data(),
+                                   relvel.data(), cmats.data(), force.data());
+        benchmark::DoNotOptimize(force.data());
+    }
+    st.SetItemsProcessed(st.iterations() * N);
+}
+BENCHMARK(ContactForceSMCBatch)
+    ->Arg(ChSystemSMC::Hooke)
+    ->Arg(ChSystemSMC::Hertz)
+    ->Arg(ChSystemSMC::PlainCoulomb)
+    ->Unit(benchmark::kNanosecond);
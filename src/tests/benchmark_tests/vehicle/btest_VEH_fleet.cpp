@@ -0,0 +1,332 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Scaling benchmark for fleets of HMMWV vehicles in a shared Chrono system,
+// processed with ChWheeledVehicleFleet.
+//
+// Each benchmark is parameterized by the number of vehicles and the number of
+// threads (used for both the fleet and the Chrono system), for a given tire
+// model and terrain type. Besides the Chrono system timers, the following
+// counters are reported:
+//   Steps_per_sec  - simulation steps per second (wall clock)
+//   Fleet_Sync     - time for synchronizing the fleet vehicles and drivers
+//   Fleet_Advance  - time for advancing the fleet vehicles and drivers
+//   Terrain        - time for synchronizing and advancing the terrain
+// All times are in ms, cumulative over the timed simulation steps.
+//
+// Use --benchmark_format=json (or --benchmark_out=<file>
+// --benchmark_out_format=json) to obtain machine-readable results and
+// --benchmark_filter=<regex> to run a subset of the benchmarks.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/core/ChTimer.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
+
+#include "chrono_vehicle/ChConfigVehicle.h"
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/terrain/SCMTerrain.h"
+#include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicleFleet.h"
+#ifdef CHRONO_OPENCRG
+    #include "chrono_vehicle/terrain/CRGTerrain.h"
+#endif
+
+#include "chrono_models/vehicle/hmmwv/HMMWV.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::vehicle::hmmwv;
+
+// =============================================================================
+
+enum class TerrainType { RIGID, CRG, SCM };
+
+// Spacing of the vehicle grid (longitudinal and lateral)
+double spacing_x = 10.0;
+double spacing_y = 5.0;
+
+// Length of free terrain ahead of the vehicle grid
+double run_length = 50.0;
+
+// =============================================================================
+
+// Driver with a throttle ramp and no steering
+class FleetDriver : public ChDriver {
+  public:
+    FleetDriver(ChVehicle& vehicle, double delay) : ChDriver(vehicle), m_delay(delay) {}
+    ~FleetDriver() {}
+
+    virtual void Synchronize(double time) override {
+        m_steering = 0;
+        m_braking = 0;
+        double eff_time = time - m_delay;
+        m_throttle = (eff_time < 0) ? 0 : std::min(2 * eff_time, 0.5);
+    }
+
+  private:
+    double m_delay;
+};
+
+// =============================================================================
+
+template <TireModelType TIRE_MODEL, TerrainType TERRAIN>
+class FleetTest : public utils::ChBenchmarkTest {
+  public:
+    FleetTest(int num_vehicles, int num_threads);
+    ~FleetTest();
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override;
+
+    void ReportFleetTimers(benchmark::State& st) const;
+    void ResetFleetTimers();
+
+  private:
+    ChSystemSMC* m_system;
+    ChTerrain* m_terrain;
+    std::vector<HMMWV_Reduced*> m_hmmwvs;
+    std::vector<FleetDriver*> m_drivers;
+    ChWheeledVehicleFleet m_fleet;
+
+    double m_step;
+
+    ChTimer m_timer_fleet_sync;
+    ChTimer m_timer_fleet_advance;
+    ChTimer m_timer_terrain;
+};
+
+template <TireModelType TIRE_MODEL, TerrainType TERRAIN>
+FleetTest<TIRE_MODEL, TERRAIN>::FleetTest(int num_vehicles, int num_threads) {
+    bool fea_tires = (TIRE_MODEL == TireModelType::ANCF);
+    m_step = fea_tires ? 5e-5 : 2e-3;
+
+    // Vehicles arranged in a grid with num_cols vehicles per row
+    int num_cols = (int)std::ceil(std::sqrt((double)num_vehicles));
+    int num_rows = (num_vehicles + num_cols - 1) / num_cols;
+    double length = num_cols * spacing_x + run_length;
+    double width = num_rows * spacing_y + spacing_y;
+
+    // Create the shared Chrono system
+    m_system = new ChSystemSMC;
+    m_system->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    m_system->SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    m_system->SetNumThreads(num_threads, num_threads, 1);
+    if (fea_tires) {
+        m_system->SetSolverType(ChSolver::Type::MINRES);
+        auto solver = std::static_pointer_cast<ChIterativeSolverLS>(m_system->GetSolver());
+        solver->SetMaxIterations(200);
+        solver->SetTolerance(1e-10);
+        solver->EnableDiagonalPreconditioner(true);
+        m_system->SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_PROJECTED);
+    }
+
+    // Create the terrain (before the vehicles, as CRG sets their start locations)
+    ChCoordsys<> start(ChVector3d(-length / 2 + spacing_x, -width / 2 + spacing_y, 0), QUNIT);
+    switch (TERRAIN) {
+        case TerrainType::RIGID: {
+            auto terrain = new RigidTerrain(m_system);
+            auto patch_material = chrono_types::make_shared<ChContactMaterialSMC>();
+            patch_material->SetFriction(0.9f);
+            patch_material->SetRestitution(0.01f);
+            patch_material->SetYoungModulus(2e7f);
+            terrain->AddPatch(patch_material, CSYSNORM, length, width);
+            terrain->Initialize();
+            m_terrain = terrain;
+            break;
+        }
+        case TerrainType::CRG: {
+#ifdef CHRONO_OPENCRG
+            auto terrain = new CRGTerrain(m_system);
+            terrain->UseMeshVisualization(false);
+            terrain->Initialize(vehicle::GetDataFile("terrain/crg_roads/RoadCourse.crg"));
+            start = terrain->GetStartPosition();
+            m_terrain = terrain;
+#endif
+            break;
+        }
+        case TerrainType::SCM: {
+            auto terrain = new SCMTerrain(m_system);
+            terrain->SetSoilParameters(2e6,   // Bekker Kphi
+                                       0,     // Bekker Kc
+                                       1.1,   // Bekker n exponent
+                                       0,     // Mohr cohesive limit (Pa)
+                                       30,    // Mohr friction limit (degrees)
+                                       0.01,  // Janosi shear coefficient (m)
+                                       2e8,   // Elastic stiffness (Pa/m), before plastic yield
+                                       3e4    // Damping (Pa s/m), proportional to negative vertical speed (optional)
+            );
+            terrain->Initialize(length, width, 0.05);
+            m_terrain = terrain;
+            break;
+        }
+    }
+
+    // Create the vehicles and their drivers and add them to the fleet.
+    // The CRG road is not safe for concurrent queries, so fleet vehicles are then processed sequentially.
+    m_fleet.SetNumThreads(TERRAIN == TerrainType::CRG ? 1 : num_threads);
+    for (int i = 0; i < num_vehicles; i++) {
+        ChVector3d offset(spacing_x * (i % num_cols), spacing_y * (i / num_cols), 0.7);
+
+        auto hmmwv = new HMMWV_Reduced(m_system);
+        hmmwv->SetChassisFixed(false);
+        hmmwv->SetInitPosition(ChCoordsys<>(start.pos + start.rot.Rotate(offset), start.rot));
+        hmmwv->SetEngineType(EngineModelType::SIMPLE_MAP);
+        hmmwv->SetTransmissionType(TransmissionModelType::AUTOMATIC_SIMPLE_MAP);
+        hmmwv->SetDriveType(DrivelineTypeWV::RWD);
+        hmmwv->SetTireType(TIRE_MODEL);
+        hmmwv->SetTireStepSize(m_step);
+        hmmwv->Initialize();
+
+        hmmwv->SetChassisVisualizationType(VisualizationType::NONE);
+        hmmwv->SetSuspensionVisualizationType(VisualizationType::NONE);
+        hmmwv->SetSteeringVisualizationType(VisualizationType::NONE);
+        hmmwv->SetWheelVisualizationType(VisualizationType::NONE);
+        hmmwv->SetTireVisualizationType(VisualizationType::NONE);
+
+        auto driver = new FleetDriver(hmmwv->GetVehicle(), 0.5);
+        driver->Initialize();
+
+        if (TERRAIN == TerrainType::SCM) {
+            auto scm = static_cast<SCMTerrain*>(m_terrain);
+            for (auto& axle : hmmwv->GetVehicle().GetAxles()) {
+                for (auto& wheel : axle->GetWheels())
+                    scm->AddMovingPatch(wheel->GetSpindle(), ChVector3d(0, 0, 0), ChVector3d(1.0, 0.3, 1.0));
+            }
+        }
+
+        m_fleet.AddVehicle(&hmmwv->GetVehicle(), driver);
+        m_hmmwvs.push_back(hmmwv);
+        m_drivers.push_back(driver);
+    }
+}
+
+template <TireModelType TIRE_MODEL, TerrainType TERRAIN>
+FleetTest<TIRE_MODEL, TERRAIN>::~FleetTest() {
+    for (auto driver : m_drivers)
+        delete driver;
+    for (auto hmmwv : m_hmmwvs)
+        delete hmmwv;
+    delete m_terrain;
+    delete m_system;
+}
+
+template <TireModelType TIRE_MODEL, TerrainType TERRAIN>
+void FleetTest<TIRE_MODEL, TERRAIN>::ExecuteStep() {
+    double time = m_system->GetChTime();
+
+    // Update modules (process inputs from other modules)
+    m_timer_terrain.start();
+    m_terrain->Synchronize(time);
+    m_timer_terrain.stop();
+
+    m_timer_fleet_sync.start();
+    m_fleet.Synchronize(time, *m_terrain);
+    m_timer_fleet_sync.stop();
+
+    // Advance simulation for one timestep for all modules
+    m_timer_terrain.start();
+    m_terrain->Advance(m_step);
+    m_timer_terrain.stop();
+
+    m_timer_fleet_advance.start();
+    m_fleet.Advance(m_step);
+    m_timer_fleet_advance.stop();
+
+    m_system->DoStepDynamics(m_step);
+}
+
+template <TireModelType TIRE_MODEL, TerrainType TERRAIN>
+void FleetTest<TIRE_MODEL, TERRAIN>::ReportFleetTimers(benchmark::State& st) const {
+    st.counters["Fleet_Sync"] = m_timer_fleet_sync.GetTimeSeconds() * 1e3;
+    st.counters["Fleet_Advance"] = m_timer_fleet_advance.GetTimeSeconds() * 1e3;
+    st.counters["Terrain"] = m_timer_terrain.GetTimeSeconds() * 1e3;
+}
+
+template <TireModelType TIRE_MODEL, TerrainType TERRAIN>
+void FleetTest<TIRE_MODEL, TERRAIN>::ResetFleetTimers() {
+    m_timer_fleet_sync.reset();
+    m_timer_fleet_advance.reset();
+    m_timer_terrain.reset();
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 250  // number of steps for hot start
+#define NUM_SIM_STEPS 250   // number of simulation steps for each benchmark
+
+template <TireModelType TIRE_MODEL, TerrainType TERRAIN>
+static void Fleet(benchmark::State& st) {
+#ifndef CHRONO_OPENCRG
+    if (TERRAIN == TerrainType::CRG) {
+        st.SkipWithError("OpenCRG support not available");
+        return;
+    }
+#endif
+
+    FleetTest<TIRE_MODEL, TERRAIN> test((int)st.range(0), (int)st.range(1));
+    test.Simulate(NUM_SKIP_STEPS);
+    test.ResetFleetTimers();
+
+    while (st.KeepRunning()) {
+        test.Simulate(NUM_SIM_STEPS);
+    }
+
+    test.ReportTimers(st);
+    test.ReportFleetTimers(st);
+    st.counters["Steps_per_sec"] = benchmark::Counter(NUM_SIM_STEPS, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Sweep the fleet size (up to the specified maximum) and the number of threads
+template <int MAX_VEHICLES>
+static void FleetArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"vehicles", "threads"});
+    for (int num_vehicles = 1; num_vehicles <= MAX_VEHICLES; num_vehicles *= 10) {
+        for (int num_threads = 1; num_threads <= 8; num_threads *= 2)
+            b->Args({num_vehicles, num_threads});
+    }
+}
+
+#define CH_BM_FLEET(TIRE_MODEL, TERRAIN, MAX_VEHICLES)     \
+    BENCHMARK_TEMPLATE2(Fleet, TIRE_MODEL, TERRAIN)        \
+        ->Apply(FleetArgs<MAX_VEHICLES>)                   \
+        ->Unit(benchmark::kMillisecond)                    \
+        ->Iterations(1)                                    \
+        ->UseRealTime();
+
+// Force-element tires on rigid and CRG terrain
+CH_BM_FLEET(TireModelType::TMEASY, TerrainType::RIGID, 1000)
+CH_BM_FLEET(TireModelType::PAC02, TerrainType::RIGID, 1000)
+CH_BM_FLEET(TireModelType::TMEASY, TerrainType::CRG, 10)
+CH_BM_FLEET(TireModelType::PAC02, TerrainType::CRG, 10)
+
+// Rigid tires on rigid and SCM terrain (the CRG road has no collision geometry)
+CH_BM_FLEET(TireModelType::RIGID, TerrainType::RIGID, 1000)
+CH_BM_FLEET(TireModelType::RIGID, TerrainType::SCM, 10)
+
+// FEA tires on rigid and SCM terrain
+CH_BM_FLEET(TireModelType::ANCF, TerrainType::RIGID, 1)
+CH_BM_FLEET(TireModelType::ANCF, TerrainType::SCM, 1)
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
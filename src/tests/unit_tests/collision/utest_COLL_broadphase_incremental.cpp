@@ -0,0 +1,84 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Chrono::Multicore unit test for the incremental broadphase.
+// A layer of touching spheres is created, with a few spheres moved at each
+// step. The candidate pairs found by the incremental broadphase are compared
+// against those found by the regular broadphase.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+class BedModel {
+  public:
+    BedModel(bool incremental) {
+        sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+        coll_sys = std::static_pointer_cast<ChCollisionSystemMulticore>(sys.GetCollisionSystem());
+        coll_sys->SetBroadphaseGridResolution(ChVector3i(8, 8, 2));
+        coll_sys->EnableIncrementalBroadphase(incremental);
+
+        auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+        for (int i = 0; i < 20; i++) {
+            for (int j = 0; j < 20; j++) {
+                auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+                sphere->SetPos(ChVector3d(i * 0.99, j * 0.99, 0));
+                sys.AddBody(sphere);
+                spheres.push_back(sphere);
+            }
+        }
+
+        sys.GetCollisionSystem()->Initialize();
+    }
+
+    // Move every 17th sphere (starting at the specified offset) and return the sorted list of candidate pairs.
+    std::vector<std::pair<int, int>> Step(int offset, double dz) {
+        for (size_t k = offset; k < spheres.size(); k += 17)
+            spheres[k]->SetPos(spheres[k]->GetPos() + ChVector3d(0.3 * dz, 0, dz));
+
+        sys.ComputeCollisions();
+
+        std::vector<std::pair<int, int>> pairs;
+        for (const auto& p : coll_sys->GetOverlappingPairs())
+            pairs.push_back(std::make_pair(p.x, p.y));
+        std::sort(pairs.begin(), pairs.end());
+        return pairs;
+    }
+
+    ChSystemNSC sys;
+    std::shared_ptr<ChCollisionSystemMulticore> coll_sys;
+    std::vector<std::shared_ptr<ChBody>> spheres;
+};
+
+TEST(ChBroadphase, incremental) {
+    BedModel model_ref(false);
+    BedModel model_inc(true);
+
+    for (int step = 0; step < 40; step++) {
+        // Alternate small motions (mostly within the same bins) and larger ones (crossing bin boundaries)
+        double dz = (step % 4 == 0) ? 0.4 : 0.02 * ((step % 2) ? 1 : -1);
+        auto pairs_ref = model_ref.Step(step % 17, dz);
+        auto pairs_inc = model_inc.Step(step % 17, dz);
+        ASSERT_FALSE(pairs_ref.empty());
+        ASSERT_EQ(pairs_ref, pairs_inc) << "step " << step;
+    }
+}
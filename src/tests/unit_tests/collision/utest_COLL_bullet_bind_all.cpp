@@ -0,0 +1,86 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for bulk addition of bodies and parallel processing of their collision
+// models in the Bullet collision system. The contacts found for a bed of
+// bodies added in bulk must match those found when adding bodies one at a time.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainer.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static std::vector<std::shared_ptr<ChBody>> CreateBed(std::shared_ptr<ChContactMaterialNSC> mat) {
+    std::vector<std::shared_ptr<ChBody>> bodies;
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 20, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    bodies.push_back(ground);
+
+    // Alternate spheres and (off-center, compound) boxes, so that all bodies touch the ground
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j++) {
+            ChVector3d pos(-9.5 + i, -9.5 + j, 0.2);
+            if ((i + j) % 2 == 0) {
+                auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.25, 1000, false, true, mat);
+                sphere->SetPos(pos + ChVector3d(0, 0, 0.04));
+                bodies.push_back(sphere);
+            } else {
+                auto box = chrono_types::make_shared<ChBody>();
+                box->SetPos(pos);
+                box->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeBox>(mat, 0.4, 0.4, 0.4),
+                                       ChFrame<>(ChVector3d(0, 0, 0.05)));
+                box->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeSphere>(mat, 0.1),
+                                       ChFrame<>(ChVector3d(0, 0, 0.3)));
+                box->EnableCollision(true);
+                bodies.push_back(box);
+            }
+        }
+    }
+
+    return bodies;
+}
+
+static unsigned int CountContacts(ChSystem& sys) {
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetNumThreads(1, 4, 1);
+    sys.DoStepDynamics(1e-3);
+    return sys.GetNumContacts();
+}
+
+TEST(ChCollisionSystemBullet, bind_all) {
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    ChSystemNSC sys1;
+    for (auto& body : CreateBed(mat))
+        sys1.AddBody(body);
+    auto num_contacts1 = CountContacts(sys1);
+
+    ChSystemNSC sys2;
+    auto bodies = CreateBed(mat);
+    sys2.AddBodies(bodies);
+    ASSERT_EQ(sys2.GetBodies().size(), bodies.size());
+    for (unsigned int i = 0; i < bodies.size(); i++)
+        ASSERT_EQ(sys2.GetBodies()[i]->GetIndex(), i);
+    auto num_contacts2 = CountContacts(sys2);
+
+    ASSERT_GE(num_contacts1, 400);
+    ASSERT_EQ(num_contacts1, num_contacts2);
+}
@@ -0,0 +1,83 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for multithreaded collision detection with the Bullet collision system.
+// A bed of spheres and compound boxes settles on the ground. With deterministic
+// contact generation, the contacts and the resulting motion must not depend on
+// the number of collision threads.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+class BedModel {
+  public:
+    BedModel(int num_threads_collision) {
+        sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+        sys.SetNumThreads(1, num_threads_collision, 1);
+        sys.EnableDeterministic(true);
+
+        auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+        mat->SetFriction(0.5f);
+
+        auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 20, 1, 1000, false, true, mat);
+        ground->SetPos(ChVector3d(0, 0, -0.5));
+        ground->SetFixed(true);
+        sys.AddBody(ground);
+
+        for (int i = 0; i < 16; i++) {
+            for (int j = 0; j < 16; j++) {
+                ChVector3d pos(-7.5 + i * 0.9, -7.5 + j * 0.9, 0.3 + 0.1 * ((i * 7 + j * 3) % 5));
+                std::shared_ptr<ChBody> body;
+                if ((i + j) % 2 == 0) {
+                    body = chrono_types::make_shared<ChBodyEasySphere>(0.25, 1000, false, true, mat);
+                } else {
+                    body = chrono_types::make_shared<ChBody>();
+                    body->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeBox>(mat, 0.4, 0.4, 0.4),
+                                            ChFrame<>(ChVector3d(0, 0, 0.05)));
+                    body->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeSphere>(mat, 0.1),
+                                            ChFrame<>(ChVector3d(0, 0, 0.3)));
+                    body->EnableCollision(true);
+                }
+                body->SetPos(pos);
+                sys.AddBody(body);
+                bodies.push_back(body);
+            }
+        }
+    }
+
+    ChSystemNSC sys;
+    std::vector<std::shared_ptr<ChBody>> bodies;
+};
+
+TEST(ChCollisionSystemBullet, parallel) {
+    BedModel model1(1);
+    BedModel model4(4);
+
+    for (int i = 0; i < 300; i++) {
+        model1.sys.DoStepDynamics(1e-3);
+        model4.sys.DoStepDynamics(1e-3);
+        ASSERT_EQ(model1.sys.GetNumContacts(), model4.sys.GetNumContacts());
+    }
+
+    ASSERT_GE(model1.sys.GetNumContacts(), 256);
+    for (size_t k = 0; k < model1.bodies.size(); k++) {
+        ASSERT_NEAR((model1.bodies[k]->GetPos() - model4.bodies[k]->GetPos()).Length(), 0.0, 1e-10);
+    }
+}
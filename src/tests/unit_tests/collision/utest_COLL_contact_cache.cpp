@@ -0,0 +1,83 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for the Bullet narrowphase contact cache.
+// A set of spheres and boxes settle on a ground box. The final configuration and
+// contacts obtained with the contact cache enabled are compared against those
+// obtained with a full narrowphase at each step.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/bullet/ChCollisionSystemBullet.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+class SettlingModel {
+  public:
+    SettlingModel(bool contact_cache) {
+        sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+        coll_sys = std::static_pointer_cast<ChCollisionSystemBullet>(sys.GetCollisionSystem());
+        coll_sys->EnableContactCache(contact_cache, 1e-4, 1e-3);
+
+        auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+        mat->SetFriction(0.6f);
+
+        auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 10, 1, 1000, false, true, mat);
+        ground->SetPos(ChVector3d(0, 0, -0.5));
+        ground->SetFixed(true);
+        sys.AddBody(ground);
+
+        for (int i = 0; i < 4; i++) {
+            auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+            sphere->SetPos(ChVector3d(-3 + 2 * i, -1.5, 0.52));
+            sys.AddBody(sphere);
+            bodies.push_back(sphere);
+
+            auto box = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, false, true, mat);
+            box->SetPos(ChVector3d(-3 + 2 * i, 1.5, 0.52));
+            sys.AddBody(box);
+            bodies.push_back(box);
+        }
+    }
+
+    ChSystemNSC sys;
+    std::shared_ptr<ChCollisionSystemBullet> coll_sys;
+    std::vector<std::shared_ptr<ChBody>> bodies;
+};
+
+TEST(ChCollisionSystemBullet, contact_cache) {
+    SettlingModel model_ref(false);
+    SettlingModel model_cache(true);
+
+    double step = 1e-3;
+    int num_cached = 0;
+    for (int i = 0; i < 1000; i++) {
+        model_ref.sys.DoStepDynamics(step);
+        model_cache.sys.DoStepDynamics(step);
+        num_cached = std::max(num_cached, model_cache.coll_sys->GetNumCachedPairs());
+        ASSERT_EQ(model_ref.coll_sys->GetNumCachedPairs(), 0);
+    }
+
+    std::cout << "Max. number of cached pairs: " << num_cached << std::endl;
+    ASSERT_GT(num_cached, 0);
+
+    ASSERT_EQ(model_ref.sys.GetNumContacts(), model_cache.sys.GetNumContacts());
+    for (size_t k = 0; k < model_ref.bodies.size(); k++) {
+        ASSERT_NEAR((model_ref.bodies[k]->GetPos() - model_cache.bodies[k]->GetPos()).Length(), 0.0, 1e-3);
+    }
+}
@@ -0,0 +1,156 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the contact reduction stage.
+// Dense grids of contact points (as generated for mesh-mesh contact) between
+// pairs of bodies are passed through contact reduction into an NSC contact
+// container. Checks include the number of retained contacts, the retention of
+// the deepest point, and the extent of the retained contact patch.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono/collision/ChContactReduction.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+class ContactCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& cforce,
+                                 const ChVector3d& ctorque,
+                                 ChContactable* modA,
+                                 ChContactable* modB) override {
+        points.push_back(pA);
+        distances.push_back(distance);
+        return true;
+    }
+
+    std::vector<ChVector3d> points;
+    std::vector<double> distances;
+};
+
+class ContactReductionTest : public ::testing::Test {
+  protected:
+    ContactReductionTest() {
+        auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+        for (int i = 0; i < 3; i++) {
+            auto body = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, false, true, mat);
+            sys.AddBody(body);
+            bodies.push_back(body);
+        }
+    }
+
+    // Create a contact between the specified bodies at the given point.
+    ChCollisionInfo Contact(int a, int b, const ChVector3d& pos, const ChVector3d& normal, double distance) {
+        ChCollisionInfo cinfo;
+        cinfo.modelA = bodies[a]->GetCollisionModel().get();
+        cinfo.modelB = bodies[b]->GetCollisionModel().get();
+        cinfo.shapeA = cinfo.modelA->GetShapeInstance(0).first.get();
+        cinfo.shapeB = cinfo.modelB->GetShapeInstance(0).first.get();
+        cinfo.vpA = pos;
+        cinfo.vpB = pos;
+        cinfo.vN = normal;
+        cinfo.distance = distance;
+        return cinfo;
+    }
+
+    // Add a grid of 11x11 contact points in the plane with given normal (the center point being the deepest).
+    void AddGrid(int a, int b, const ChVector3d& center, const ChVector3d& normal) {
+        ChMatrix33<> R;
+        R.SetFromAxisX(normal);
+        for (int i = -5; i <= 5; i++) {
+            for (int j = -5; j <= 5; j++) {
+                ChVector3d pos = center + R * ChVector3d(0, 0.2 * i, 0.2 * j);
+                double distance = (i == 0 && j == 0) ? -0.02 : -0.01;
+                reduction.AddContact(Contact(a, b, pos, normal, distance));
+            }
+        }
+    }
+
+    // Run the contact reduction into the system contact container and collect the resulting contacts.
+    void Report() {
+        auto container = sys.GetContactContainer();
+        container->BeginAddContact();
+        reduction.ReportContacts(container.get());
+        container->EndAddContact();
+
+        collector = chrono_types::make_shared<ContactCollector>();
+        container->ReportAllContacts(collector);
+    }
+
+    ChSystemNSC sys;
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    ChContactReduction reduction;
+    std::shared_ptr<ContactCollector> collector;
+};
+
+TEST_F(ContactReductionTest, planar_patch) {
+    for (int max_points : {4, 8}) {
+        reduction.SetMaxPoints(max_points);
+        reduction.Reset();
+        AddGrid(0, 1, ChVector3d(0, 0, 0), ChVector3d(0, 0, 1));
+        Report();
+
+        ASSERT_EQ(reduction.GetNumInputContacts(), 121u);
+        ASSERT_EQ(reduction.GetNumOutputContacts(), (unsigned int)max_points);
+        ASSERT_EQ(sys.GetNumContacts(), (unsigned int)max_points);
+
+        // The deepest point is retained
+        ASSERT_DOUBLE_EQ(*std::min_element(collector->distances.begin(), collector->distances.end()), -0.02);
+
+        // The retained points span the contact patch
+        double xmin = 1e10, xmax = -1e10, ymin = 1e10, ymax = -1e10;
+        for (const auto& p : collector->points) {
+            xmin = std::min(xmin, p.x());
+            xmax = std::max(xmax, p.x());
+            ymin = std::min(ymin, p.y());
+            ymax = std::max(ymax, p.y());
+        }
+        ASSERT_NEAR(xmin, -1.0, 1e-12);
+        ASSERT_NEAR(xmax, +1.0, 1e-12);
+        ASSERT_NEAR(ymin, -1.0, 1e-12);
+        ASSERT_NEAR(ymax, +1.0, 1e-12);
+    }
+}
+
+TEST_F(ContactReductionTest, clusters) {
+    reduction.SetMaxPoints(4);
+    reduction.Reset();
+
+    // Two patches with different normals between bodies 0 and 1 (the second one reported with swapped bodies)
+    AddGrid(0, 1, ChVector3d(0, 0, 0), ChVector3d(0, 0, 1));
+    AddGrid(1, 0, ChVector3d(2, 0, 1), ChVector3d(-1, 0, 0));
+
+    // A patch between bodies 0 and 2, and a few contacts between bodies 1 and 2 (below the limit)
+    AddGrid(0, 2, ChVector3d(0, 0, 3), ChVector3d(0, 0, 1));
+    for (int i = 0; i < 3; i++)
+        reduction.AddContact(Contact(1, 2, ChVector3d(i, 0, 5), ChVector3d(0, 1, 0), -0.01));
+
+    Report();
+
+    ASSERT_EQ(reduction.GetNumInputContacts(), 3u * 121 + 3);
+    ASSERT_EQ(reduction.GetNumOutputContacts(), 3u * 4 + 3);
+    ASSERT_EQ(sys.GetNumContacts(), 3u * 4 + 3);
+}
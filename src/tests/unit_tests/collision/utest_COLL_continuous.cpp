@@ -0,0 +1,89 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for continuous collision detection with the Bullet collision system.
+// A small sphere is shot at a thin fixed plate with a step size for which the
+// sphere travels several times the plate thickness in one step. Without CCD the
+// sphere tunnels through the plate; with CCD enabled on the sphere it does not.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/bullet/ChCollisionSystemBullet.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Return the final x position of a sphere shot along the x axis at a plate at x = 0 (thickness 0.02).
+static double ShootSphere(bool ccd, double x0, double speed, double step) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, 0));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.0f);
+    mat->SetRestitution(0.0f);
+
+    auto plate = chrono_types::make_shared<ChBodyEasyBox>(0.02, 4, 4, 1000, false, true, mat);
+    plate->SetPos(ChVector3d(0, 0, 0));
+    plate->SetFixed(true);
+    sys.AddBody(plate);
+
+    auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.05, 1000, false, true, mat);
+    sphere->SetPos(ChVector3d(x0, 0.1, 0.2));
+    sphere->SetPosDt(ChVector3d(speed, 0, 0));
+    sphere->GetCollisionModel()->EnableContinuousCollision(ccd);
+    sys.AddBody(sphere);
+
+    for (int i = 0; i < 50; i++)
+        sys.DoStepDynamics(step);
+
+    return sphere->GetPos().x();
+}
+
+TEST(ChCollisionSystemBullet, continuous_thin_plate) {
+    // The sphere (radius 0.05) moves by 0.5 per step and is never within the envelope of the plate
+    double x0 = -1.13;
+    double speed = 50;
+    double step = 1e-2;
+
+    double x_discrete = ShootSphere(false, x0, speed, step);
+    double x_continuous = ShootSphere(true, x0, speed, step);
+
+    std::cout << "Final sphere position.  discrete: " << x_discrete << "  continuous: " << x_continuous << std::endl;
+
+    // Without CCD the sphere passes through the plate
+    ASSERT_GT(x_discrete, 0.0);
+
+    // With CCD the sphere is stopped in front of the plate, without significant penetration
+    ASSERT_LT(x_continuous, 0.0);
+    ASSERT_GT(x_continuous, -0.01 - 0.05 - 0.01);
+}
+
+TEST(ChCollisionSystemBullet, continuous_slow_motion) {
+    // For motions within the envelope, CCD does not change the results of discrete collision detection
+    double x0 = -0.15;
+    double speed = 2;
+    double step = 1e-3;
+
+    double x_discrete = ShootSphere(false, x0, speed, step);
+    double x_continuous = ShootSphere(true, x0, speed, step);
+
+    // The sphere is stopped by the plate
+    ASSERT_NEAR(x_continuous, -0.01 - 0.05, 5e-3);
+
+    ASSERT_NEAR(x_discrete, x_continuous, 1e-10);
+}
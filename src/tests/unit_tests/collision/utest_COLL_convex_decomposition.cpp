@@ -0,0 +1,112 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the parallel and cached HACDv2 convex decomposition
+// =============================================================================
+
+#include "chrono/collision/ChConvexDecomposition.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Add the 12 triangles (oriented outwards) of an axis-aligned box
+static void AddBox(ChTriangleMeshSoup& mesh, const ChVector3d& center, double hlen) {
+    ChVector3d v[8];
+    for (int i = 0; i < 8; i++)
+        v[i] = center + hlen * ChVector3d((i & 1) ? 1 : -1, (i & 2) ? 1 : -1, (i & 4) ? 1 : -1);
+    int faces[6][4] = {{0, 2, 3, 1}, {4, 5, 7, 6}, {0, 1, 5, 4}, {2, 6, 7, 3}, {0, 4, 6, 2}, {1, 3, 7, 5}};
+    for (const auto& f : faces) {
+        mesh.AddTriangle(v[f[0]], v[f[1]], v[f[2]]);
+        mesh.AddTriangle(v[f[0]], v[f[2]], v[f[3]]);
+    }
+}
+
+// Mesh with 3 disconnected boxes
+static ChTriangleMeshSoup CreateMesh() {
+    ChTriangleMeshSoup mesh;
+    AddBox(mesh, ChVector3d(0, 0, 0), 0.5);
+    AddBox(mesh, ChVector3d(3, 0, 0), 0.5);
+    AddBox(mesh, ChVector3d(0, 3, 0), 1.0);
+    return mesh;
+}
+
+// Sorted x coordinates of the hull centroids
+static std::vector<double> HullCenters(ChConvexDecomposition& decomposition) {
+    std::vector<double> centers;
+    for (unsigned int i = 0; i < decomposition.GetHullCount(); i++) {
+        std::vector<ChVector3d> hull;
+        EXPECT_TRUE(decomposition.GetConvexHullResult(i, hull));
+        ChVector3d c = VNULL;
+        for (const auto& v : hull)
+            c += v / (double)hull.size();
+        centers.push_back(c.x() + 10 * c.y());
+    }
+    std::sort(centers.begin(), centers.end());
+    return centers;
+}
+
+TEST(ChConvexDecomposition, parallel) {
+    auto mesh = CreateMesh();
+
+    ChConvexDecompositionHACDv2 serial;
+    serial.AddTriangleMesh(mesh);
+    serial.ComputeConvexDecomposition();
+
+    ChConvexDecompositionHACDv2 parallel;
+    parallel.EnableParallelDecomposition(true);
+    parallel.AddTriangleMesh(mesh);
+    parallel.ComputeConvexDecomposition();
+
+    // Each box is convex and yields one hull
+    ASSERT_EQ(parallel.GetHullCount(), 3u);
+    ASSERT_EQ(serial.GetHullCount(), parallel.GetHullCount());
+
+    auto cs = HullCenters(serial);
+    auto cp = HullCenters(parallel);
+    for (size_t i = 0; i < cs.size(); i++)
+        ASSERT_NEAR(cs[i], cp[i], 1e-5);
+}
+
+TEST(ChConvexDecomposition, cache) {
+    auto mesh = CreateMesh();
+
+    ChConvexDecompositionHACDv2 first;
+    first.SetCacheDirectory(".");
+    first.AddTriangleMesh(mesh);
+    first.ComputeConvexDecomposition();
+
+    ChConvexDecompositionHACDv2 second;
+    second.SetCacheDirectory(".");
+    second.AddTriangleMesh(mesh);
+    second.ComputeConvexDecomposition();
+    ASSERT_TRUE(second.IsCacheHit());
+    ASSERT_EQ(first.GetHullCount(), second.GetHullCount());
+    for (unsigned int i = 0; i < first.GetHullCount(); i++) {
+        std::vector<ChVector3d> h1, h2;
+        first.GetConvexHullResult(i, h1);
+        second.GetConvexHullResult(i, h2);
+        ASSERT_EQ(h1.size(), h2.size());
+        for (size_t k = 0; k < h1.size(); k++)
+            ASSERT_TRUE(h1[k].Equals(h2[k]));
+    }
+
+    // Different parameters do not reuse the cached hulls
+    ChConvexDecompositionHACDv2 third;
+    third.SetCacheDirectory(".");
+    third.AddTriangleMesh(mesh);
+    third.SetParameters(128, 128, 32);
+    third.ComputeConvexDecomposition();
+    ASSERT_FALSE(third.IsCacheHit());
+}
@@ -0,0 +1,110 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Chrono::Multicore unit test for the batched narrowphase.
+// A mix of spheres and rotated boxes is placed in a grid, with overlaps between
+// neighbors. The contacts found with batched processing of sphere-sphere and
+// box-sphere pairs are compared against those found processing one pair at a
+// time. The sphere-only fast path is similarly checked on a grid of spheres.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <array>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+typedef std::array<double, 11> ContactData;
+
+class ContactCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& cforce,
+                                 const ChVector3d& ctorque,
+                                 ChContactable* modA,
+                                 ChContactable* modB) override {
+        ChVector3d n = plane_coord.GetAxisX();
+        contacts.push_back({pA.x(), pA.y(), pA.z(), pB.x(), pB.y(), pB.z(), n.x(), n.y(), n.z(), distance, eff_radius});
+        return true;
+    }
+
+    std::vector<ContactData> contacts;
+};
+
+std::vector<ContactData> FindContacts(ChNarrowphase::Algorithm algorithm, bool batched, bool spheres_only = false) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+    auto coll_sys = std::static_pointer_cast<ChCollisionSystemMulticore>(sys.GetCollisionSystem());
+    coll_sys->SetNarrowphaseAlgorithm(algorithm);
+    coll_sys->EnableBatchedNarrowphase(batched);
+    coll_sys->EnableSphereFastPath(batched);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    for (int i = 0; i < 12; i++) {
+        for (int j = 0; j < 12; j++) {
+            std::shared_ptr<ChBody> body;
+            if (!spheres_only && (i + 2 * j) % 5 == 0) {
+                body = chrono_types::make_shared<ChBodyEasyBox>(0.9, 0.8, 1.1, 1000, false, true, mat);
+                body->SetRot(QuatFromAngleAxis(0.1 * (i + j), ChVector3d(i, j, 1).GetNormalized()));
+            } else {
+                body = chrono_types::make_shared<ChBodyEasySphere>(0.45 + 0.01 * ((i * j) % 7), 1000, false, true,
+                                                                    mat);
+            }
+            body->SetPos(ChVector3d(i * 0.9, j * 0.9, 0.05 * ((i + j) % 3)));
+            sys.AddBody(body);
+        }
+    }
+
+    sys.GetCollisionSystem()->Initialize();
+    sys.ComputeCollisions();
+
+    auto collector = chrono_types::make_shared<ContactCollector>();
+    sys.GetContactContainer()->ReportAllContacts(collector);
+    std::sort(collector->contacts.begin(), collector->contacts.end());
+    return collector->contacts;
+}
+
+void CompareContacts(ChNarrowphase::Algorithm algorithm, bool spheres_only = false) {
+    auto contacts_ref = FindContacts(algorithm, false, spheres_only);
+    auto contacts = FindContacts(algorithm, true, spheres_only);
+
+    ASSERT_FALSE(contacts_ref.empty());
+    ASSERT_EQ(contacts_ref.size(), contacts.size());
+    for (size_t k = 0; k < contacts.size(); k++) {
+        for (size_t i = 0; i < contacts[k].size(); i++)
+            ASSERT_NEAR(contacts_ref[k][i], contacts[k][i], 1e-10) << "contact " << k << " entry " << i;
+    }
+}
+
+TEST(ChNarrowphase, batched_prims) {
+    CompareContacts(ChNarrowphase::Algorithm::PRIMS);
+}
+
+TEST(ChNarrowphase, batched_hybrid) {
+    CompareContacts(ChNarrowphase::Algorithm::HYBRID);
+}
+
+TEST(ChNarrowphase, sphere_fast_path) {
+    CompareContacts(ChNarrowphase::Algorithm::HYBRID, true);
+}
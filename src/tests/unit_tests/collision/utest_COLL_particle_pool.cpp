@@ -0,0 +1,171 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for the parking of pooled particles in the collision system.
+// Spheres released to a particle pool must keep their collision models in the
+// collision system (no removal and re-insertion) and must not generate contacts
+// while pooled. Recycled spheres with unchanged dimensions must collide again
+// with the same collision models.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/bullet/ChCollisionSystemBullet.h"
+#include "chrono/particlefactory/ChParticlePool.h"
+#include "chrono/particlefactory/ChRandomShapeCreator.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::particlefactory;
+
+static const int num_particles = 8;
+
+// Particles (spheres resting on a ground box) and free probe spheres overlapping the particles
+class PoolModel {
+  public:
+    PoolModel(ChCollisionSystem::Type type) {
+        sys.SetCollisionSystemType(type);
+
+        auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+        auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 10, 1, 1000, false, true, mat);
+        ground->SetPos(ChVector3d(0, 0, -0.5));
+        ground->SetFixed(true);
+        sys.AddBody(ground);
+
+        creator = chrono_types::make_shared<ChRandomShapeCreatorSpheres>();
+        creator->SetDiameterDistribution(chrono_types::make_shared<ChConstantDistribution>(0.2));
+
+        pool = chrono_types::make_shared<ChParticlePool>();
+
+        for (int i = 0; i < num_particles; i++) {
+            auto particle = creator->RandomGenerateAndCallbacks(ChCoordsys<>(ParticlePos(i), QUNIT));
+            particle->GetCollisionModel()->SetFamily(2);
+            sys.AddBody(particle);
+            particles.push_back(particle);
+
+            auto probe = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, false, true, mat);
+            probe->SetPos(ParticlePos(i) + ChVector3d(0, 0, 0.18));
+            sys.AddBody(probe);
+        }
+
+        sys.GetCollisionSystem()->Initialize();
+    }
+
+    static ChVector3d ParticlePos(int i) { return ChVector3d(-2.0 + 0.5 * i, 0, 0.1); }
+
+    // Recycle the pooled particles (as done by a particle emitter), at their original positions
+    void Recycle() {
+        for (int i = 0; i < num_particles; i++) {
+            auto particle = pool->Acquire();
+            ASSERT_TRUE(particle);
+            ASSERT_TRUE(creator->RandomRecycleAndCallbacks(particle, ChCoordsys<>(particle->GetPos(), QUNIT)));
+            pool->Activate(particle);
+        }
+        ASSERT_EQ(pool->GetNumBodies(), 0);
+    }
+
+    ChSystemNSC sys;
+    std::shared_ptr<ChRandomShapeCreatorSpheres> creator;
+    std::shared_ptr<ChParticlePool> pool;
+    std::vector<std::shared_ptr<ChBody>> particles;
+};
+
+static void TestParking(ChCollisionSystem::Type type) {
+    PoolModel model(type);
+
+    model.sys.ComputeCollisions();
+    ASSERT_GE(model.sys.GetNumContacts(), (unsigned int)num_particles);
+
+    std::vector<ChCollisionModelImpl*> impls;
+    std::vector<short int> masks;
+    for (const auto& particle : model.particles) {
+        impls.push_back(particle->GetCollisionModel()->GetImplementation());
+        masks.push_back(particle->GetCollisionModel()->GetFamilyMask());
+    }
+
+    // Pooled particles stay in the collision system, but collide with nothing
+    for (const auto& particle : model.particles)
+        model.pool->Release(particle);
+    ASSERT_EQ(model.pool->GetNumBodies(), num_particles);
+
+    model.sys.ComputeCollisions();
+    ASSERT_EQ(model.sys.GetNumContacts(), 0);
+
+    // Recycled particles collide again, with their original collision models and families
+    model.Recycle();
+
+    model.sys.ComputeCollisions();
+    ASSERT_GE(model.sys.GetNumContacts(), (unsigned int)num_particles);
+
+    for (int i = 0; i < num_particles; i++) {
+        const auto& coll_model = model.particles[i]->GetCollisionModel();
+        ASSERT_TRUE(model.particles[i]->IsCollisionEnabled());
+        ASSERT_EQ(coll_model->GetImplementation(), impls[i]);
+        ASSERT_EQ(coll_model->GetFamily(), 2);
+        ASSERT_EQ(coll_model->GetFamilyMask(), masks[i]);
+    }
+}
+
+TEST(ChParticlePool, parking_bullet) {
+    TestParking(ChCollisionSystem::Type::BULLET);
+}
+
+// Recycling with new dimensions re-inserts the collision model, with the new shapes, in the Bullet collision system
+TEST(ChParticlePool, reset_shapes_bullet) {
+    PoolModel model(ChCollisionSystem::Type::BULLET);
+    auto coll_sys = std::static_pointer_cast<ChCollisionSystemBullet>(model.sys.GetCollisionSystem());
+    int num_objects = coll_sys->GetBulletCollisionWorld()->getNumCollisionObjects();
+
+    for (const auto& particle : model.particles)
+        model.pool->Release(particle);
+
+    model.creator->SetDiameterDistribution(chrono_types::make_shared<ChConstantDistribution>(0.3));
+    model.Recycle();
+    ASSERT_EQ(coll_sys->GetBulletCollisionWorld()->getNumCollisionObjects(), num_objects);
+
+    for (const auto& particle : model.particles) {
+        auto shape = std::dynamic_pointer_cast<ChCollisionShapeSphere>(
+            particle->GetCollisionModel()->GetShapeInstance(0).first);
+        ASSERT_TRUE(shape);
+        ASSERT_EQ(shape->GetRadius(), 0.15);
+    }
+
+    model.sys.ComputeCollisions();
+    ASSERT_GE(model.sys.GetNumContacts(), (unsigned int)num_particles);
+}
+
+#ifdef CHRONO_COLLISION
+TEST(ChParticlePool, parking_multicore) {
+    TestParking(ChCollisionSystem::Type::MULTICORE);
+}
+
+// The multicore collision system does not support removal of collision models, so particles cannot be recycled with
+// new dimensions (and are left unchanged)
+TEST(ChParticlePool, reset_shapes_multicore) {
+    PoolModel model(ChCollisionSystem::Type::MULTICORE);
+    auto particle = model.particles[0];
+    auto impl = particle->GetCollisionModel()->GetImplementation();
+    double mass = particle->GetMass();
+    model.pool->Release(particle);
+
+    model.creator->SetDiameterDistribution(chrono_types::make_shared<ChConstantDistribution>(0.3));
+    ASSERT_EQ(model.pool->Acquire(), particle);
+    ASSERT_FALSE(model.creator->RandomRecycleAndCallbacks(particle, ChCoordsys<>(particle->GetPos(), QUNIT)));
+    ASSERT_EQ(particle->GetCollisionModel()->GetImplementation(), impl);
+    ASSERT_EQ(particle->GetMass(), mass);
+}
+#endif
@@ -0,0 +1,193 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Tests for batched ray-hit tests.
+// A grid of vertical rays is cast over a set of spheres and boxes resting on a
+// ground box. The results of the batched ray-hit tests are compared against
+// those of individual ray-hit tests. Ray-hit tests with a specified model are
+// checked on a stack of boxes. For the multicore collision system, the closest
+// hit shape along a row of spheres, boxes, and capsules is also checked.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/ChCollisionShapeCapsule.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+void TestRayHitBatch(ChCollisionSystem::Type type) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(type);
+    sys.SetNumThreads(1, 2, 1);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 10, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < 4; i++) {
+        auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+        sphere->SetPos(ChVector3d(-3 + 2 * i, -1.5, 0.5));
+        sys.AddBody(sphere);
+
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1 + 0.25 * i, 1000, false, true, mat);
+        box->SetPos(ChVector3d(-3 + 2 * i, 1.5, 0.5));
+        sys.AddBody(box);
+    }
+
+    sys.DoStepDynamics(1e-4);
+
+    // Grid of vertical rays
+    std::vector<ChCollisionSystem::ChRay> rays;
+    for (int ix = -40; ix <= 40; ix++) {
+        for (int iy = -30; iy <= 30; iy++) {
+            ChVector3d to(0.1 * ix + 0.013, 0.1 * iy + 0.017, -0.2);
+            rays.push_back({to + ChVector3d(0, 0, 3), to});
+        }
+    }
+
+    std::vector<ChCollisionSystem::ChRayhitResult> results;
+    int num_hits = sys.GetCollisionSystem()->RayHitBatch(rays, results);
+    ASSERT_EQ(results.size(), rays.size());
+    ASSERT_GT(num_hits, 0);
+
+    int num_hits_ref = 0;
+    for (size_t i = 0; i < rays.size(); i++) {
+        ChCollisionSystem::ChRayhitResult result;
+        bool hit = sys.GetCollisionSystem()->RayHit(rays[i].from, rays[i].to, result);
+        ASSERT_EQ(results[i].hit, hit);
+        if (!hit)
+            continue;
+        num_hits_ref++;
+        ASSERT_EQ(results[i].hitModel, result.hitModel);
+        ASSERT_NEAR(results[i].dist_factor, result.dist_factor, 1e-12);
+        ASSERT_NEAR((results[i].abs_hitPoint - result.abs_hitPoint).Length(), 0.0, 1e-12);
+        ASSERT_NEAR((results[i].abs_hitNormal - result.abs_hitNormal).Length(), 0.0, 1e-12);
+    }
+    ASSERT_EQ(num_hits, num_hits_ref);
+}
+
+TEST(ChCollisionSystemBullet, ray_hit_batch) {
+    TestRayHitBatch(ChCollisionSystem::Type::BULLET);
+}
+
+#ifdef CHRONO_COLLISION
+TEST(ChCollisionSystemMulticore, ray_hit_batch) {
+    TestRayHitBatch(ChCollisionSystem::Type::MULTICORE);
+}
+#endif
+
+#ifdef CHRONO_COLLISION
+// Rays along a row of shapes (spanning several broadphase bins) must report the closest shape, for both single and
+// batched ray-hit tests
+TEST(ChCollisionSystemMulticore, ray_hit_closest) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int i = 0; i < 9; i++) {
+        std::shared_ptr<ChBody> body;
+        switch (i % 3) {
+            case 0:
+                body = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+                break;
+            case 1:
+                body = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, false, true, mat);
+                break;
+            case 2:
+                // Vertical capsule (along z) with radius 0.4 and total length 2
+                body = chrono_types::make_shared<ChBody>();
+                body->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeCapsule>(mat, 0.4, 1.2));
+                body->EnableCollision(true);
+                break;
+        }
+        body->SetPos(ChVector3d(2.0 * i, 0, 0));
+        body->SetFixed(true);
+        sys.AddBody(body);
+        bodies.push_back(body);
+    }
+
+    sys.DoStepDynamics(1e-4);
+
+    // Horizontal rays starting between consecutive shapes, in both directions
+    std::vector<ChCollisionSystem::ChRay> rays;
+    for (int i = 0; i < 8; i++) {
+        ChVector3d from(2.0 * i + 1, 0.1, 0.05);
+        rays.push_back({from, from + ChVector3d(20, 0, 0)});
+        rays.push_back({from, from - ChVector3d(20, 0, 0)});
+    }
+
+    std::vector<ChCollisionSystem::ChRayhitResult> results;
+    sys.GetCollisionSystem()->RayHitBatch(rays, results);
+
+    for (int i = 0; i < 8; i++) {
+        for (int k = 0; k < 2; k++) {
+            int expected = i + 1 - k;
+            ChCollisionSystem::ChRayhitResult result;
+            ASSERT_TRUE(sys.GetCollisionSystem()->RayHit(rays[2 * i + k].from, rays[2 * i + k].to, result));
+            ASSERT_EQ(result.hitModel, bodies[expected]->GetCollisionModel().get());
+            ASSERT_TRUE(results[2 * i + k].hit);
+            ASSERT_EQ(results[2 * i + k].hitModel, result.hitModel);
+            ASSERT_NEAR(std::abs(result.abs_hitNormal.x()), 1.0, 0.05);
+        }
+    }
+
+    // Vertical ray onto the top endcap of a capsule
+    ChCollisionSystem::ChRayhitResult result;
+    ASSERT_TRUE(sys.GetCollisionSystem()->RayHit(ChVector3d(4.1, 0, 3), ChVector3d(4.1, 0, -3), result));
+    ASSERT_EQ(result.hitModel, bodies[2]->GetCollisionModel().get());
+    ASSERT_NEAR(result.abs_hitPoint.z(), 0.6 + std::sqrt(0.4 * 0.4 - 0.1 * 0.1), 1e-5);
+    ASSERT_NEAR(result.abs_hitNormal.Length(), 1.0, 1e-5);
+}
+#endif
+
+// Ray-hit tests with a specified model, for rays also hitting other models (on both sides of the specified one)
+TEST(ChCollisionSystemBullet, ray_hit_model) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    std::vector<std::shared_ptr<ChBody>> boxes;
+    for (int i = 0; i < 3; i++) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 0.5, 1000, false, true, mat);
+        box->SetPos(ChVector3d(0, 0, 2.0 * i));
+        box->SetFixed(true);
+        sys.AddBody(box);
+        boxes.push_back(box);
+    }
+
+    sys.DoStepDynamics(1e-4);
+
+    ChVector3d from(0.1, 0.2, 10);
+    ChVector3d to(0.1, 0.2, -10);
+    for (int i = 0; i < 3; i++) {
+        auto model = boxes[i]->GetCollisionModel().get();
+        ChCollisionSystem::ChRayhitResult result;
+        ASSERT_TRUE(sys.GetCollisionSystem()->RayHit(from, to, model, result));
+        ASSERT_EQ(result.hitModel, model);
+        ASSERT_NEAR(result.abs_hitPoint.z(), 2.0 * i + 0.25, 1e-5);
+    }
+
+    // Ray missing the specified model
+    ChCollisionSystem::ChRayhitResult result;
+    ASSERT_FALSE(sys.GetCollisionSystem()->RayHit(from, ChVector3d(0.1, 0.2, 3), boxes[0]->GetCollisionModel().get(),
+                                                  result));
+}
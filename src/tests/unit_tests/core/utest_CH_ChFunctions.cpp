@@ -19,7 +19,15 @@
 
 #include "gtest/gtest.h"
 #include "chrono/functions/ChFunctionLambda.h"
+#include "chrono/functions/ChFunctionCompiled.h"
 #include "chrono/functions/ChFunctionInterp.h"
+#include "chrono/functions/ChFunctionMirror.h"
+#include "chrono/functions/ChFunctionOperator.h"
+#include "chrono/functions/ChFunctionPoly.h"
+#include "chrono/functions/ChFunctionPoly345.h"
+#include "chrono/functions/ChFunctionRamp.h"
+#include "chrono/functions/ChFunctionSequence.h"
+#include "chrono/functions/ChFunctionSine.h"
 #include "chrono/utils/ChConstants.h"
 
 using namespace chrono;
@@ -92,6 +100,127 @@ TEST(ChFunctionInterp, interp1_extrap) {
     // ASSERT_DOUBLE_EQ(fun_table.GetVal(-0.7), fun_table(-0.7));
 }
 
+TEST(ChFunctionInterp, hint_and_batch) {
+    // Same function sampled on a uniform and a non-uniform grid
+    ChFunctionInterp fun_uniform;
+    ChFunctionInterp fun_sorted;
+    for (int i = 0; i <= 20; i++) {
+        double x = -1.0 + 0.1 * i;
+        fun_uniform.AddPoint(x, x * x);
+        fun_sorted.AddPoint(x * std::abs(x), x * x);
+    }
+    fun_uniform.AddPoint(0.0, -1.0, true);
+    ASSERT_TRUE(fun_uniform.IsUniform());
+    ASSERT_FALSE(fun_sorted.IsUniform());
+    ASSERT_NEAR(fun_uniform.GetVal(0.05), -0.495, TOL_FUN);
+    ASSERT_NEAR(fun_uniform.GetDer(0.0), 10.1, TOL_FUN);
+    ASSERT_NEAR(fun_uniform.GetMin(), -1.0, TOL_FUN);
+
+    // Queries with a hint, in arbitrary order, match queries without
+    size_t hint = 0;
+    for (double x : {0.37, 0.38, -0.9, 1.5, 0.99, -0.01, -1.0, 0.4}) {
+        ASSERT_DOUBLE_EQ(fun_uniform.GetVal(x, hint), fun_uniform.GetVal(x));
+        ASSERT_DOUBLE_EQ(fun_sorted.GetVal(x, hint), fun_sorted.GetVal(x));
+        ASSERT_DOUBLE_EQ(fun_sorted.GetDer(x, hint), fun_sorted.GetDer(x));
+    }
+
+    // Batch evaluation
+    ChVectorDynamic<> x = ChVectorDynamic<>::LinSpaced(101, -1.2, 1.2);
+    ChVectorDynamic<> y;
+    fun_sorted.GetVal(x, y);
+    ASSERT_EQ(y.size(), x.size());
+    for (int i = 0; i < x.size(); i++)
+        ASSERT_DOUBLE_EQ(y(i), fun_sorted.GetVal(x(i)));
+    ASSERT_NEAR(y(0), 1.0, TOL_FUN);
+    ASSERT_NEAR(y(50), 0.0, TOL_FUN);
+}
+
+TEST(ChFunctionCompiled, composite) {
+    // m(u) = 1.5 sin(2u) (1 + 0.5u + 0.25u^2)
+    auto sine = chrono_types::make_shared<ChFunctionSine>();
+    sine->SetAmplitude(1.5);
+    sine->SetAngularRate(2);
+    auto poly = chrono_types::make_shared<ChFunctionPoly>();
+    poly->SetCoefficients({1, 0.5, 0.25});
+    auto mul = chrono_types::make_shared<ChFunctionOperator>();
+    mul->SetOperationType(ChFunctionOperator::MUL);
+    mul->SetFirstOperandFunction(sine);
+    mul->SetSecondOperandFunction(poly);
+
+    // g(t) = m(0.1 + 0.8t)
+    auto g = chrono_types::make_shared<ChFunctionOperator>();
+    g->SetOperationType(ChFunctionOperator::FUNCT);
+    g->SetFirstOperandFunction(mul);
+    g->SetSecondOperandFunction(chrono_types::make_shared<ChFunctionRamp>(0.1, 0.8));
+
+    // s(x) = x on [0,1), g(x-1) + offset on [1,3), mirrored about x = 2.5
+    auto seq = chrono_types::make_shared<ChFunctionSequence>();
+    seq->InsertFunct(chrono_types::make_shared<ChFunctionRamp>(0, 1), 1);
+    seq->InsertFunct(g, 2, 1, true);
+    auto mirror = chrono_types::make_shared<ChFunctionMirror>();
+    mirror->SetOperandFunction(seq);
+    mirror->SetMirrorAxis(2.5);
+
+    // f(x) = s(x) + h(x), with h evaluated through virtual calls
+    auto h = chrono_types::make_shared<ChFunctionPoly345>(0.3, 4);
+    auto f = chrono_types::make_shared<ChFunctionOperator>();
+    f->SetOperationType(ChFunctionOperator::ADD);
+    f->SetFirstOperandFunction(mirror);
+    f->SetSecondOperandFunction(h);
+
+    ChFunctionCompiled fc(f);
+    ASSERT_EQ(fc.GetNumLeaves(), (size_t)1);
+
+    auto m = [](double u, int der) {
+        double P = 1 + 0.5 * u + 0.25 * u * u, P1 = 0.5 + 0.5 * u, P2 = 0.5;
+        double s = std::sin(2 * u), c = std::cos(2 * u);
+        if (der == 0)
+            return 1.5 * s * P;
+        if (der == 1)
+            return 1.5 * (2 * c * P + s * P1);
+        return 1.5 * (-4 * s * P + 4 * c * P1 + s * P2);
+    };
+    double offset = 1 - m(0.1, 0);
+
+    for (double x : {0.5, 1.3, 2.2, 2.7, 3.5, 5.5}) {
+        double xs = (x <= 2.5) ? x : 5 - x;
+        double sign = (x <= 2.5) ? 1 : -1;
+        double val, der, der2;
+        if (xs < 0) {
+            val = der = der2 = 0;
+        } else if (xs < 1) {
+            val = xs;
+            der = sign;
+            der2 = 0;
+        } else {
+            double u = 0.1 + 0.8 * (xs - 1);
+            val = m(u, 0) + offset;
+            der = sign * 0.8 * m(u, 1);
+            der2 = 0.64 * m(u, 2);
+        }
+
+        ASSERT_NEAR(fc.GetVal(x), f->GetVal(x), 1e-12);
+        ASSERT_NEAR(fc.GetVal(x), val + h->GetVal(x), 1e-12);
+        ASSERT_NEAR(fc.GetDer(x), der + h->GetDer(x), 1e-10);
+        ASSERT_NEAR(fc.GetDer2(x), der2 + h->GetDer2(x), 1e-10);
+        ASSERT_NEAR(fc.GetDer(x), f->GetDer(x), 1e-5);
+
+        double y, y_dx, y_dxdx;
+        fc.GetValDer2(x, y, y_dx, y_dxdx);
+        ASSERT_DOUBLE_EQ(y, fc.GetVal(x));
+        ASSERT_DOUBLE_EQ(y_dx, fc.GetDer(x));
+        ASSERT_DOUBLE_EQ(y_dxdx, fc.GetDer2(x));
+    }
+
+    // A copy compiles a clone of the source graph
+    ChFunctionCompiled fc_copy(fc);
+    sine->SetAmplitude(2);
+    ASSERT_NEAR(fc_copy.GetVal(1.3), fc.GetVal(1.3), 1e-12);
+    fc.Compile();
+    ASSERT_NEAR(fc.GetVal(1.3), f->GetVal(1.3), 1e-12);
+    ASSERT_GT(std::abs(fc.GetVal(1.3) - fc_copy.GetVal(1.3)), 1e-3);
+}
+
 // TEST(ChFunctionInterp, wrong_insertions) {
 //    ChFunctionInterp fun_table_noovr;
 //    fun_table_noovr.AddPoint(0.0, 2.7);
@@ -0,0 +1,125 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the asynchronous output writer: task ordering, bounded queue,
+// error reporting, and asynchronous CSV output.
+//
+// =============================================================================
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChAsyncWriter.h"
+#include "chrono/utils/ChUtilsInputOutput.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+static std::string ReadFile(const std::string& filename) {
+    std::ifstream file(filename);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+TEST(ChAsyncWriter, ordering) {
+    std::vector<int> done;
+    {
+        ChAsyncWriter writer(3);
+        for (int i = 0; i < 100; i++) {
+            writer.Submit([&done, i]() { done.push_back(i); });
+            ASSERT_LE(writer.GetNumPending(), 3u);
+        }
+    }
+
+    // All tasks are executed, in submission order, before the writer is destroyed
+    ASSERT_EQ(done.size(), 100u);
+    for (int i = 0; i < 100; i++)
+        ASSERT_EQ(done[i], i);
+}
+
+TEST(ChAsyncWriter, bounded) {
+    ChAsyncWriter writer(2);
+    std::atomic<bool> release(false);
+    std::atomic<int> count(0);
+    auto task = [&]() {
+        while (!release)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        count++;
+    };
+
+    writer.Submit(task);
+    writer.Submit(task);
+    ASSERT_EQ(writer.GetNumPending(), 2u);
+
+    // A third task can only be submitted once the first one completes
+    std::thread producer([&]() { writer.Submit(task); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(count, 0);
+    release = true;
+    producer.join();
+    writer.Flush();
+    ASSERT_EQ(count, 3);
+}
+
+TEST(ChAsyncWriter, errors) {
+    ChAsyncWriter writer;
+    int count = 0;
+    writer.Submit([]() { throw std::runtime_error("task failed"); });
+    writer.Submit([&count]() { count++; });
+    ASSERT_THROW(writer.Flush(), std::runtime_error);
+    ASSERT_EQ(count, 1);
+
+    // The error is reported only once
+    writer.Flush();
+}
+
+TEST(ChAsyncWriter, csv) {
+    ChSystemNSC sys;
+    for (int i = 0; i < 5; i++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetPos(ChVector3d(i, 0.5 * i, -0.25 * i));
+        body->SetPosDt(ChVector3d(0, 0, i));
+        sys.AddBody(body);
+    }
+
+    ChAsyncWriter writer;
+    WriteBodies(&sys, "bodies_sync.csv", false, true);
+    WriteBodies(writer, &sys, "bodies_async.csv", false, true);
+
+    // Later changes to the system do not affect the submitted snapshot
+    sys.GetBodies()[0]->SetPos(ChVector3d(100, 100, 100));
+
+    ChWriterCSV csv(" ");
+    csv << 1.5 << "x" << std::endl;
+    csv.WriteToFile(writer, "writer_async.csv", "header");
+    csv << 2.5 << std::endl;
+
+    writer.Flush();
+    ASSERT_EQ(ReadFile("bodies_async.csv"), ReadFile("bodies_sync.csv"));
+    ASSERT_EQ(ReadFile("writer_async.csv"), "header\n1.5 x \n");
+
+    std::remove("bodies_sync.csv");
+    std::remove("bodies_async.csv");
+    std::remove("writer_async.csv");
+}
@@ -0,0 +1,130 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the benchmark regression utilities: parsing of benchmark output,
+// baseline files, and detection of significant slowdowns.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+
+#include "chrono/utils/ChBenchmarkRegression.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+// Generate n samples of the given metric with given mean and relative noise.
+static void AddSamples(ChBenchmarkResults& results,
+                       const std::string& metric,
+                       double mean,
+                       double noise,
+                       int n,
+                       std::mt19937& gen) {
+    std::normal_distribution<double> dist(mean, noise * mean);
+    for (int i = 0; i < n; i++)
+        results.AddSample("BM_test", metric, dist(gen));
+}
+
+TEST(BenchmarkRegression, WelchTest) {
+    // Identical samples: no evidence of an increase
+    std::vector<double> x = {1.0, 1.1, 0.9, 1.05, 0.95};
+    ASSERT_NEAR(WelchTestGreater(x, x), 0.5, 1e-10);
+
+    // Symmetry of the one-sided tests
+    std::vector<double> y = {1.2, 1.3, 1.1, 1.25, 1.15};
+    double p_up = WelchTestGreater(x, y);
+    double p_down = WelchTestGreater(y, x);
+    ASSERT_LT(p_up, 0.01);
+    ASSERT_NEAR(p_up + p_down, 1.0, 1e-10);
+
+    // Not enough samples
+    ASSERT_EQ(WelchTestGreater({1.0}, y), 1.0);
+}
+
+TEST(BenchmarkRegression, Compare) {
+    std::mt19937 gen(42);
+
+    ChBenchmarkResults baseline;
+    AddSamples(baseline, "real_time", 100, 0.02, 10, gen);
+    AddSamples(baseline, "LS_Solve", 20, 0.02, 10, gen);
+    AddSamples(baseline, "CD_Total", 30, 0.02, 10, gen);
+    AddSamples(baseline, "CD_Broad", 1e-4, 0.02, 10, gen);
+
+    ChBenchmarkResults current;
+    AddSamples(current, "real_time", 120, 0.02, 10, gen);  // 20% slowdown
+    AddSamples(current, "LS_Solve", 20, 0.02, 10, gen);    // unchanged
+    AddSamples(current, "CD_Total", 24, 0.02, 10, gen);    // speedup
+    AddSamples(current, "CD_Broad", 2e-4, 0.02, 10, gen);  // below floor
+
+    auto regressions = CompareBenchmarkResults(baseline, current, 0.01, 0.05);
+    ASSERT_EQ(regressions.size(), 1);
+    ASSERT_EQ(regressions[0].benchmark, "BM_test");
+    ASSERT_EQ(regressions[0].metric, "real_time");
+    ASSERT_NEAR(regressions[0].change, 0.2, 0.03);
+    ASSERT_LT(regressions[0].p_value, 0.01);
+
+    // A slowdown below the threshold is not reported
+    ASSERT_TRUE(CompareBenchmarkResults(baseline, current, 0.01, 0.5).empty());
+}
+
+TEST(BenchmarkRegression, Files) {
+    const std::string out_file = "benchmark_regression_out.json";
+    const std::string baseline_file = "benchmark_regression_baseline.json";
+
+    // Google benchmark output with 2 repetitions and one aggregate
+    {
+        std::ofstream ofs(out_file);
+        ofs << R"({
+  "context": {"num_cpus": 4},
+  "benchmarks": [
+    {"name": "BM_a/repeats:2", "run_name": "BM_a", "run_type": "iteration", "repetitions": 2,
+     "repetition_index": 0, "threads": 1, "iterations": 5, "real_time": 10.0, "cpu_time": 9.0,
+     "time_unit": "ms", "Step_Total": 2.0, "LS_Solve": 0.5},
+    {"name": "BM_a/repeats:2", "run_name": "BM_a", "run_type": "iteration", "repetitions": 2,
+     "repetition_index": 1, "threads": 1, "iterations": 5, "real_time": 12.0, "cpu_time": 11.0,
+     "time_unit": "ms", "Step_Total": 2.5, "LS_Solve": 0.6},
+    {"name": "BM_a/repeats:2_mean", "run_name": "BM_a", "run_type": "aggregate", "aggregate_name": "mean",
+     "repetitions": 2, "threads": 1, "iterations": 2, "real_time": 11.0, "cpu_time": 10.0,
+     "time_unit": "ms", "Step_Total": 2.25, "LS_Solve": 0.55}
+  ]
+})";
+    }
+
+    ChBenchmarkResults results;
+    ASSERT_TRUE(results.AddBenchmarkOutput(out_file));
+    const auto& samples = results.GetSamples();
+    ASSERT_EQ(samples.size(), 1);
+    const auto& metrics = samples.at("BM_a");
+    ASSERT_EQ(metrics.count("iterations"), 0);
+    ASSERT_EQ(metrics.count("repetition_index"), 0);
+    ASSERT_EQ(metrics.at("real_time"), std::vector<double>({10.0, 12.0}));
+    ASSERT_EQ(metrics.at("Step_Total"), std::vector<double>({2.0, 2.5}));
+    ASSERT_EQ(metrics.at("LS_Solve"), std::vector<double>({0.5, 0.6}));
+
+    // Baseline round trip
+    ASSERT_TRUE(results.WriteBaseline(baseline_file));
+    ChBenchmarkResults baseline;
+    ASSERT_TRUE(baseline.ReadBaseline(baseline_file));
+    ASSERT_EQ(baseline.GetSamples(), samples);
+
+    // Output files are not baselines
+    ChBenchmarkResults invalid;
+    ASSERT_FALSE(invalid.ReadBaseline(out_file));
+
+    std::remove(out_file.c_str());
+    std::remove(baseline_file.c_str());
+}
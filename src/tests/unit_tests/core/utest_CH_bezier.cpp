@@ -0,0 +1,105 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit tests for closest-point queries on Bezier curves:
+// - global search using the curve spatial index (compared to a brute-force search);
+// - local search of a curve tracker moving over several intervals per query;
+// - tracking across the end point of a closed curve.
+//
+// =============================================================================
+
+#include <cmath>
+#include <random>
+
+#include "chrono/core/ChBezierCurve.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Brute-force search over all curve intervals
+static double BruteForceDistance2(const ChBezierCurve& curve, const ChVector3d& loc) {
+    double d2_min = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < curve.GetNumSegments(); i++) {
+        double t;
+        d2_min = std::min(d2_min, (curve.CalcClosestPoint(loc, i, t) - loc).Length2());
+    }
+    return d2_min;
+}
+
+// Winding road with knots 1 m apart
+static std::shared_ptr<ChBezierCurve> CreateRoad(size_t num_points) {
+    std::vector<ChVector3d> points;
+    for (size_t i = 0; i < num_points; i++) {
+        double s = (double)i;
+        points.push_back(ChVector3d(s, 50 * std::sin(s / 100), 0.01 * s));
+    }
+    return chrono_types::make_shared<ChBezierCurve>(points);
+}
+
+TEST(ChBezierCurve, global_search) {
+    auto road = CreateRoad(2000);
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> x(-100, 2100);
+    std::uniform_real_distribution<double> y(-100, 100);
+
+    for (int k = 0; k < 200; k++) {
+        ChVector3d loc(x(gen), y(gen), 0);
+        size_t i;
+        double t;
+        auto point = road->FindClosestPoint(loc, i, t);
+        ASSERT_LT(i, road->GetNumSegments());
+        ASSERT_NEAR((road->Eval(i, t) - point).Length(), 0, 1e-12);
+        ASSERT_NEAR((point - loc).Length2(), BruteForceDistance2(*road, loc), 1e-6);
+    }
+}
+
+TEST(ChBezierCurve, tracker) {
+    auto road = CreateRoad(2000);
+    ChBezierCurveTracker tracker(road);
+
+    // Sentinel travelling along the road, 2 m to its side, advancing 5 m per query
+    ChVector3d offset(0, 2, 0);
+    tracker.Reset(road->GetPoint(10) + offset);
+    for (size_t i = 10; i < 1990; i += 5) {
+        ChVector3d loc = road->GetPoint(i) + offset;
+        ChVector3d point;
+        int flag = tracker.CalcClosestPoint(loc, point);
+        ASSERT_EQ(flag, 0);
+        ASSERT_NEAR((point - loc).Length2(), BruteForceDistance2(*road, loc), 1e-6);
+    }
+
+    // End of path
+    ChVector3d point;
+    ASSERT_EQ(tracker.CalcClosestPoint(road->GetPoint(1999) + ChVector3d(5, 0, 0), point), +1);
+}
+
+TEST(ChBezierCurve, tracker_closed) {
+    std::vector<ChVector3d> points;
+    for (int i = 0; i < 100; i++)
+        points.push_back(ChVector3d(100 * std::cos(i * CH_2PI / 100), 100 * std::sin(i * CH_2PI / 100), 0));
+    auto loop = chrono_types::make_shared<ChBezierCurve>(points, true);
+    ChBezierCurveTracker tracker(loop);
+
+    // Two laps on a circle of radius 110, crossing the end point of the loop
+    tracker.Reset(ChVector3d(110, 0, 0));
+    for (int k = 0; k <= 400; k++) {
+        double a = k * 2 * CH_2PI / 400;
+        ChVector3d loc(110 * std::cos(a), 110 * std::sin(a), 0);
+        ChVector3d point;
+        ASSERT_EQ(tracker.CalcClosestPoint(loc, point), 0);
+        ASSERT_NEAR((point - loc).Length(), 10, 1e-2);
+    }
+}
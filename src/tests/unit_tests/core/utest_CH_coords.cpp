@@ -218,3 +218,47 @@ TEST(CoordsTest, global_to_local_3frames) {
     cout << mvect1 << " ..inv three transf (another method) \n";
     check_vector(mvect1, mvect1_ref, ABS_ERR);
 }
+
+static ChFrameMoving<> MovingTestFrame(const ChVector3d& pos, const ChQuaternion<>& rot) {
+    ChFrameMoving<> frame(pos, rot.GetNormalized());
+    frame.SetPosDt(ChVector3d(0.3, -1.0, 0.5));
+    frame.SetAngVelLocal(ChVector3d(0.2, 0.7, -0.4));
+    frame.SetPosDt2(ChVector3d(-0.1, 0.2, 1.1));
+    frame.SetAngAccLocal(ChVector3d(0.5, -0.3, 0.1));
+    return frame;
+}
+
+TEST(CoordsTest, moving_composition_levels) {
+    ChFrameMoving<> f10 = MovingTestFrame(ChVector3d(1, 2, 3), ChQuaternion<>(3, 9, -1, 1));
+    ChFrameMoving<> f21 = MovingTestFrame(ChVector3d(-2, 1, 0.5), ChQuaternion<>(1, -2, 3, 4));
+    ChFrameMoving<> f32 = MovingTestFrame(ChVector3d(0, -1, 2), ChQuaternion<>(4, 1, 3, 1));
+
+    ChFrameMoving<> ref = f10 * f21;
+
+    // Full composition matches operator*
+    ChFrameMoving<> full;
+    f10.TransformLocalToParent<ChFrameLevel::ACCELERATION>(f21, full);
+    ASSERT_TRUE(full.Equals(ref, ABS_ERR));
+
+    // Lower levels compute the same leading terms and leave the higher derivatives untouched
+    ChFrameMoving<> pos_only;
+    f10.TransformLocalToParent<ChFrameLevel::POSITION>(f21, pos_only);
+    ASSERT_TRUE(pos_only.GetCoordsys().Equals(ref.GetCoordsys(), ABS_ERR));
+    ASSERT_TRUE(pos_only.GetCoordsysDt().Equals(ChFrameMoving<>().GetCoordsysDt()));
+
+    ChFrameMoving<> vel_only;
+    f10.TransformLocalToParent<ChFrameLevel::VELOCITY>(f21, vel_only);
+    ASSERT_TRUE(vel_only.GetCoordsys().Equals(ref.GetCoordsys(), ABS_ERR));
+    ASSERT_TRUE(vel_only.GetCoordsysDt().Equals(ref.GetCoordsysDt(), ABS_ERR));
+    ASSERT_TRUE(vel_only.GetCoordsysDt2().Equals(ChFrameMoving<>().GetCoordsysDt2()));
+
+    // In-place composition
+    ChFrameMoving<> inplace = f21;
+    f10.TransformLocalToParent<ChFrameLevel::ACCELERATION>(inplace, inplace);
+    ASSERT_TRUE(inplace.Equals(ref, ABS_ERR));
+
+    // Chain composition
+    ChFrameMoving<> chain;
+    ComposeFrames<ChFrameLevel::ACCELERATION>(chain, f10, f21, f32);
+    ASSERT_TRUE(chain.Equals(f10 * f21 * f32, ABS_ERR));
+}
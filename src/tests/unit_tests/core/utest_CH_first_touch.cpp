@@ -0,0 +1,69 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the aligned allocator with parallel first-touch initialization:
+// zero initialization and propagation of the number of threads.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/core/ChAlignedAllocator.h"
+#include "chrono/core/ChVector3.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+template <typename T>
+using FirstTouchVector = std::vector<T, first_touch_allocator<T, 64>>;
+
+TEST(first_touch_allocator, allocation) {
+    size_t n = 1 << 20;
+    FirstTouchVector<double> a(n, 0.0, first_touch_allocator<double, 64>(4));
+    ASSERT_EQ(a.get_allocator().GetNumThreads(), 4);
+
+    // The allocator zero-fills the memory in parallel before element construction
+    first_touch_allocator<ChVector3d, 64> alloc(4);
+    ChVector3d* v = alloc.allocate(n);
+    bool zero = true;
+    for (size_t i = 0; i < n; i++)
+        zero = zero && v[i] == ChVector3d(0, 0, 0);
+    ASSERT_TRUE(zero);
+    alloc.deallocate(v, n);
+}
+
+TEST(first_touch_allocator, propagation) {
+    FirstTouchVector<double> a(1000, 1.0, first_touch_allocator<double, 64>(4));
+
+    // Copies, moves, and rebinds keep the number of threads
+    FirstTouchVector<double> b(a);
+    ASSERT_EQ(b.get_allocator().GetNumThreads(), 4);
+    ASSERT_EQ(b, a);
+
+    FirstTouchVector<double> c;
+    c = a;
+    ASSERT_EQ(c.get_allocator().GetNumThreads(), 4);
+
+    FirstTouchVector<double> d(std::move(c));
+    ASSERT_EQ(d.get_allocator().GetNumThreads(), 4);
+
+    first_touch_allocator<int, 64> rebound(a.get_allocator());
+    ASSERT_EQ(rebound.GetNumThreads(), 4);
+
+    // Reallocation on growth uses the same number of threads
+    d.resize(100000, 2.0);
+    ASSERT_EQ(d.get_allocator().GetNumThreads(), 4);
+    ASSERT_EQ(d[999], 1.0);
+    ASSERT_EQ(d[1000], 2.0);
+}
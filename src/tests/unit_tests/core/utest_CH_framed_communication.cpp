@@ -0,0 +1,129 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Tests for the framed co-simulation interface:
+// - encoding and decoding of frames with typed, variable-length channels;
+// - synchronous and pipelined exchange over a shared-memory transport.
+//
+// =============================================================================
+
+#include <string>
+#include <thread>
+
+#include "chrono/utils/ChFramedCommunication.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+using DataType = ChFramedCommunication::DataType;
+
+static const int num_steps = 200;
+
+TEST(ChFramedCommunication, frame) {
+    std::vector<double> a = {1.5, -2.5, 3.25};
+    std::vector<float> b = {0.5f};
+    std::vector<uint8_t> c;
+
+    std::vector<ChFramedCommunication::ChannelData> channels = {
+        {DataType::FLOAT64, 3, reinterpret_cast<const char*>(a.data())},
+        {DataType::FLOAT32, 1, reinterpret_cast<const char*>(b.data())},
+        {DataType::UINT8, 0, nullptr}};
+
+    std::vector<char> frame;
+    ChFramedCommunication::EncodeFrame(7, 0.125, channels, frame);
+    ASSERT_EQ(frame.size(), 32 + (8 + 3 * 8) + (8 + 4) + 8);
+
+    uint64_t step;
+    double time;
+    std::vector<ChFramedCommunication::ChannelData> decoded;
+    ChFramedCommunication::DecodeFrame(frame, {DataType::FLOAT64, DataType::FLOAT32, DataType::UINT8}, step, time,
+                                       decoded);
+    ASSERT_EQ(step, 7);
+    ASSERT_EQ(time, 0.125);
+    ASSERT_EQ(decoded.size(), 3);
+    ASSERT_EQ(decoded[0].count, 3);
+    ASSERT_EQ(reinterpret_cast<const double*>(decoded[0].data)[2], 3.25);
+    ASSERT_EQ(decoded[1].count, 1);
+    ASSERT_EQ(reinterpret_cast<const float*>(decoded[1].data)[0], 0.5f);
+    ASSERT_EQ(decoded[2].count, 0);
+
+    // Mismatched channel types and truncated frames are rejected
+    ASSERT_THROW(ChFramedCommunication::DecodeFrame(frame, {DataType::FLOAT64, DataType::FLOAT64, DataType::UINT8},
+                                                    step, time, decoded),
+                 std::runtime_error);
+    frame.pop_back();
+    ASSERT_THROW(ChFramedCommunication::DecodeFrame(frame, {DataType::FLOAT64, DataType::FLOAT32, DataType::UINT8},
+                                                    step, time, decoded),
+                 std::runtime_error);
+}
+
+// Peer sending, at each exchange, the values received at the previous one doubled, on a channel of variable length.
+static void RunPeer(const std::string& name) {
+    ChFramedCommunication peer;
+    int in = peer.AddInputChannel("u", DataType::FLOAT64);
+    int out = peer.AddOutputChannel("y", DataType::FLOAT32);
+    peer.OpenSharedMemory(name, false);
+
+    ChVectorDynamic<> u;
+    for (int k = 0; k < num_steps; k++) {
+        peer.Exchange(0.0);
+        peer.GetInput(in, u);
+        peer.SetOutput(out, 2 * u);
+    }
+}
+
+static void RunServer(bool pipelined) {
+    std::string name = pipelined ? "chrono_utest_framed_p" : "chrono_utest_framed_s";
+
+    ChFramedCommunication server;
+    int out = server.AddOutputChannel("u", DataType::FLOAT64);
+    int in = server.AddInputChannel("y", DataType::FLOAT32);
+    server.SetPipelined(pipelined);
+    server.OpenSharedMemory(name, true);
+
+    // The peer outputs are initially empty
+    std::thread peer(RunPeer, name);
+
+    ChVectorDynamic<> y;
+    for (int k = 0; k < num_steps; k++) {
+        ChVectorDynamic<> u = ChVectorDynamic<>::Constant(1 + k % 5, (double)k);
+        server.SetOutput(out, u);
+        bool received = server.Exchange(0.001 * k);
+        ASSERT_EQ(received, !pipelined || k > 0);
+        server.GetInput(in, y);
+
+        // Values sent at exchange k-1 (synchronous) or k-2 (pipelined)
+        int lag = pipelined ? 2 : 1;
+        if (k < lag) {
+            ASSERT_EQ(y.size(), 0);
+        } else {
+            ASSERT_EQ(y.size(), 1 + (k - lag) % 5);
+            ASSERT_EQ(y(0), 2.0 * (k - lag));
+        }
+    }
+
+    server.Flush();
+    ASSERT_EQ(server.GetReceivedStep(), num_steps - 1);
+    peer.join();
+}
+
+TEST(ChFramedCommunication, shared_memory) {
+    RunServer(false);
+}
+
+TEST(ChFramedCommunication, shared_memory_pipelined) {
+    RunServer(true);
+}
@@ -0,0 +1,72 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the content-hashed triangle mesh cache
+//
+// =============================================================================
+
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+#include "chrono/geometry/ChTriangleMeshCache.h"
+
+using namespace chrono;
+
+// write a unit tetrahedron in Wavefront OBJ format
+static void WriteTetrahedron(const std::string& filename) {
+    std::ofstream file(filename);
+    file << "v 0 0 0\nv 1 0 0\nv 0 1 0\nv 0 0 1\n";
+    file << "f 1 3 2\nf 1 2 4\nf 1 4 3\nf 2 3 4\n";
+}
+
+TEST(ChTriangleMeshCache, shared_instances) {
+    WriteTetrahedron("mesh_cache_A.obj");
+    WriteTetrahedron("mesh_cache_B.obj");
+    ChTriangleMeshCache::Clear();
+
+    auto meshA = ChTriangleMeshCache::LoadWavefrontMesh("mesh_cache_A.obj");
+    ASSERT_TRUE(meshA);
+    ASSERT_EQ(meshA->GetNumTriangles(), 4u);
+    ASSERT_TRUE(ChTriangleMeshCache::IsCached(meshA.get()));
+    ASSERT_EQ(ChTriangleMeshCache::GetNumMisses(), 1u);
+
+    // same file, same variant: shared instance
+    auto meshA2 = ChTriangleMeshCache::LoadWavefrontMesh("mesh_cache_A.obj");
+    ASSERT_EQ(meshA, meshA2);
+    ASSERT_EQ(ChTriangleMeshCache::GetNumHits(), 1u);
+
+    // different file with identical contents: shared instance (content hashing)
+    auto meshB = ChTriangleMeshCache::LoadWavefrontMesh("mesh_cache_B.obj");
+    ASSERT_EQ(meshA, meshB);
+    ASSERT_EQ(ChTriangleMeshCache::GetNumHits(), 2u);
+
+    // different load options: separate instance
+    auto meshC = ChTriangleMeshCache::LoadWavefrontMesh("mesh_cache_A.obj", false);
+    ASSERT_NE(meshA, meshC);
+    ASSERT_EQ(ChTriangleMeshCache::GetNumEntries(), 2u);
+
+    // clones are not managed by the cache
+    auto clone = std::shared_ptr<ChTriangleMeshConnected>(meshA->Clone());
+    ASSERT_FALSE(ChTriangleMeshCache::IsCached(clone.get()));
+
+    // only entries not referenced elsewhere are released
+    meshC.reset();
+    ChTriangleMeshCache::ReleaseUnused();
+    ASSERT_EQ(ChTriangleMeshCache::GetNumEntries(), 1u);
+    ASSERT_TRUE(ChTriangleMeshCache::IsCached(meshA.get()));
+
+    ChTriangleMeshCache::Clear();
+    ASSERT_EQ(ChTriangleMeshCache::GetNumEntries(), 0u);
+}
@@ -0,0 +1,82 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the mesh simplification used for the level-of-detail meshes
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/utils/ChMeshSimplification.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+// create a unit square in the xy plane, made of n x n quads with two triangles each
+static std::shared_ptr<ChTriangleMeshConnected> CreateGrid(int n) {
+    auto mesh = chrono_types::make_shared<ChTriangleMeshConnected>();
+    for (int j = 0; j <= n; j++)
+        for (int i = 0; i <= n; i++)
+            mesh->GetCoordsVertices().push_back(ChVector3d(double(i) / n, double(j) / n, 0));
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < n; i++) {
+            int v = j * (n + 1) + i;
+            mesh->GetIndicesVertexes().push_back(ChVector3i(v, v + 1, v + n + 2));
+            mesh->GetIndicesVertexes().push_back(ChVector3i(v, v + n + 2, v + n + 1));
+            mesh->GetIndicesMaterials().push_back(i < n / 2 ? 0 : 1);
+            mesh->GetIndicesMaterials().push_back(i < n / 2 ? 0 : 1);
+        }
+    }
+    return mesh;
+}
+
+TEST(ChMeshSimplification, vertex_clustering) {
+    auto mesh = CreateGrid(64);
+
+    unsigned int prev_triangles = mesh->GetNumTriangles();
+    for (double cell_size : {1.0 / 32, 1.0 / 16, 1.0 / 8, 1.0 / 4}) {
+        auto simplified = SimplifyMesh(*mesh, cell_size * 1.01);
+
+        // each level has fewer triangles, and keeps the material of each face
+        ASSERT_GT(simplified->GetNumTriangles(), 0u);
+        ASSERT_LT(simplified->GetNumTriangles(), prev_triangles);
+        ASSERT_EQ(simplified->GetIndicesMaterials().size(), simplified->GetNumTriangles());
+        prev_triangles = simplified->GetNumTriangles();
+
+        // the vertices stay within the original mesh and are all referenced by valid faces
+        for (const auto& v : simplified->GetCoordsVertices()) {
+            ASSERT_GE(v.x(), 0.0);
+            ASSERT_LE(v.x(), 1.0);
+            ASSERT_GE(v.y(), 0.0);
+            ASSERT_LE(v.y(), 1.0);
+            ASSERT_DOUBLE_EQ(v.z(), 0.0);
+        }
+        std::vector<bool> used(simplified->GetNumVertices(), false);
+        for (const auto& f : simplified->GetIndicesVertexes()) {
+            for (int k = 0; k < 3; k++) {
+                ASSERT_LT(f[k], (int)simplified->GetNumVertices());
+                used[f[k]] = true;
+            }
+            ASSERT_NE(f.x(), f.y());
+            ASSERT_NE(f.y(), f.z());
+            ASSERT_NE(f.z(), f.x());
+        }
+        for (bool u : used)
+            ASSERT_TRUE(u);
+    }
+
+    // a single cell collapses the whole mesh
+    auto collapsed = SimplifyMesh(*mesh, 10.0);
+    ASSERT_EQ(collapsed->GetNumTriangles(), 0u);
+}
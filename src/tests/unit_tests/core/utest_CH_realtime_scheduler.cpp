@@ -0,0 +1,104 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit tests for the deadline-aware real-time scheduler:
+// - reduction of the solver iteration cap when steps exceed their budget;
+// - scaling of the collision envelope once the iteration cap is exhausted;
+// - pacing of steps to the real-time frame.
+//
+// =============================================================================
+
+#include <chrono>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChIterativeSolver.h"
+#include "chrono/utils/ChRealtimeScheduler.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Custom collision callback with a cost proportional to the solver iteration cap (10 us per iteration)
+class CostlyStep : public ChSystem::CustomCollisionCallback {
+  public:
+    virtual void OnCustomCollision(ChSystem* sys) override {
+        int iterations = sys->GetSolver()->AsIterative()->GetMaxIterations();
+        auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(10 * iterations);
+        while (std::chrono::steady_clock::now() < end) {
+        }
+    }
+};
+
+class RealtimeScheduler : public ::testing::Test {
+  protected:
+    RealtimeScheduler() {
+        sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+        sys.GetSolver()->AsIterative()->SetMaxIterations(400);
+        sys.RegisterCustomCollisionCallback(chrono_types::make_shared<CostlyStep>());
+    }
+
+    ChSystemNSC sys;
+};
+
+TEST_F(RealtimeScheduler, iterations) {
+    // Frames of 2 ms, with a budget of 1.6 ms (initial step cost: 4 ms)
+    utils::ChRealtimeScheduler scheduler(sys, 2e-3);
+    ASSERT_EQ(scheduler.GetMaxIterations(), 400);
+
+    int num_reported = 0;
+    scheduler.SetMissCallback([&](const utils::ChRealtimeScheduler::MissInfo& info) {
+        num_reported++;
+        ASSERT_GT(info.overrun, 0);
+    });
+
+    for (int i = 0; i < 50; i++)
+        scheduler.Advance();
+
+    ASSERT_EQ(scheduler.GetNumSteps(), 50u);
+    ASSERT_EQ(num_reported, (int)scheduler.GetNumMisses());
+    ASSERT_GE(scheduler.GetNumMisses(), 1u);
+    ASSERT_LT(scheduler.GetNumMisses(), 25u);
+    ASSERT_LT(scheduler.GetMaxIterations(), 200);
+    ASSERT_GE(scheduler.GetMaxIterations(), 100);
+    ASSERT_EQ(sys.GetSolver()->AsIterative()->GetMaxIterations(), scheduler.GetMaxIterations());
+    ASSERT_NEAR(sys.GetChTime(), 0.1, 1e-9);
+}
+
+TEST_F(RealtimeScheduler, envelope) {
+    utils::ChRealtimeScheduler scheduler(sys, 2e-3);
+    scheduler.SetIterationRange(400, 400);
+    scheduler.SetEnvelopeRange(0.25);
+
+    for (int i = 0; i < 10; i++)
+        scheduler.Advance();
+
+    // The iteration cap cannot be reduced, so the envelope is shrunk down to its lower bound
+    ASSERT_EQ(scheduler.GetMaxIterations(), 400);
+    ASSERT_NEAR(scheduler.GetEnvelopeFactor(), 0.25, 1e-12);
+}
+
+TEST_F(RealtimeScheduler, pacing) {
+    // Frames of 20 ms (step cost well within budget)
+    sys.GetSolver()->AsIterative()->SetMaxIterations(10);
+    utils::ChRealtimeScheduler scheduler(sys, 20e-3);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 10; i++)
+        scheduler.Advance();
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    ASSERT_EQ(scheduler.GetNumMisses(), 0u);
+    ASSERT_GE(elapsed, 0.2);
+    ASSERT_LT(elapsed, 0.3);
+}
@@ -0,0 +1,92 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Tests for the multithreaded point samplers.
+//
+// =============================================================================
+
+#include "chrono/utils/ChUtilsSamplers.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+static double MinDistance(const PointVectorD& points) {
+    double min_dist2 = 1e30;
+    for (size_t i = 0; i < points.size(); i++)
+        for (size_t j = i + 1; j < points.size(); j++)
+            min_dist2 = std::min(min_dist2, (points[i] - points[j]).Length2());
+    return std::sqrt(min_dist2);
+}
+
+static void CheckEqual(const PointVectorD& p1, const PointVectorD& p2) {
+    ASSERT_EQ(p1.size(), p2.size());
+    for (size_t i = 0; i < p1.size(); i++)
+        ASSERT_TRUE(p1[i].Equals(p2[i]));
+}
+
+TEST(ChSampler, grid_hcp_threads) {
+    ChVector3d center(1, 2, 3);
+    ChVector3d hdims(2, 1.5, 1);
+
+    ChGridSampler<> grid(0.1);
+    auto points1 = grid.SampleBox(center, hdims);
+    ASSERT_EQ(points1.size(), (size_t)(41 * 31 * 21));
+
+    PointVectorD points4;
+    grid.SetNumThreads(4);
+    grid.SampleBox(center, hdims, points4);
+    CheckEqual(points1, points4);
+
+    ChHCPSampler<> hcp(0.1);
+    points1 = hcp.SampleCylinderZ(center, 1, 1);
+    hcp.SetNumThreads(4);
+    hcp.SampleCylinderZ(center, 1, 1, points4);
+    ASSERT_GT(points1.size(), (size_t)0);
+    CheckEqual(points1, points4);
+}
+
+TEST(ChSampler, tiled_poisson_disk) {
+    double sep = 0.1;
+    ChVector3d center(0, 0, 1);
+    ChVector3d hdims(1, 0.4, 0.2);
+
+    ChPDSampler<> serial(sep);
+    auto points_serial = serial.SampleBox(center, hdims);
+
+    ChPDTiledSampler<> tiled(sep, 4);
+    PointVectorD points1;
+    tiled.SampleBox(center, hdims, points1);
+
+    // Minimum separation holds across tile boundaries, and the density is comparable to the serial sampler
+    ASSERT_GE(MinDistance(points1), sep);
+    ASSERT_GT(points1.size(), 0.9 * points_serial.size());
+    for (const auto& p : points1) {
+        ASSERT_LE(std::abs(p.x() - center.x()), hdims.x() + 1e-6);
+        ASSERT_LE(std::abs(p.y() - center.y()), hdims.y() + 1e-6);
+        ASSERT_LE(std::abs(p.z() - center.z()), hdims.z() + 1e-6);
+    }
+
+    // Reproducible for a given number of threads
+    PointVectorD points2;
+    tiled.SampleBox(center, hdims, points2);
+    CheckEqual(points1, points2);
+
+    // 2D sampling
+    tiled.SampleCylinderZ(center, 1, 0, points2);
+    ASSERT_GE(MinDistance(points2), sep);
+    for (const auto& p : points2)
+        ASSERT_EQ(p.z(), center.z());
+}
@@ -0,0 +1,115 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the work-stealing task scheduler: task groups, parallel loops,
+// nested parallelism, and exception propagation.
+//
+// =============================================================================
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "chrono/core/ChTaskScheduler.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+TEST(ChTaskScheduler, task_group) {
+    ChTaskScheduler scheduler(4);
+    ASSERT_EQ(scheduler.GetNumThreads(), 4);
+
+    std::atomic<int> sum(0);
+    ChTaskScheduler::TaskGroup group(scheduler);
+    for (int i = 1; i <= 100; i++)
+        group.Run([&sum, i]() { sum += i; });
+    group.Wait();
+    ASSERT_EQ(sum.load(), 5050);
+}
+
+TEST(ChTaskScheduler, parallel_for) {
+    ChTaskScheduler scheduler(4);
+
+    const int n = 10007;
+    std::vector<int> count(n, 0);
+    scheduler.ParallelFor(0, n, [&count](int i) { count[i]++; });
+    for (int i = 0; i < n; i++)
+        ASSERT_EQ(count[i], 1);
+
+    // Explicit number of tasks, sequential execution, and empty range
+    scheduler.ParallelFor(0, n, [&count](int i) { count[i]++; }, 3);
+    scheduler.ParallelFor(0, n, [&count](int i) { count[i]++; }, 1);
+    scheduler.ParallelFor(5, 5, [&count](int i) { count[i]++; });
+    for (int i = 0; i < n; i++)
+        ASSERT_EQ(count[i], 3);
+}
+
+TEST(ChTaskScheduler, nested) {
+    ChTaskScheduler scheduler(3);
+
+    // Nested loops (inner loops waited on from worker threads)
+    const int n = 64;
+    std::vector<std::atomic<int>> rows(n);
+    scheduler.ParallelFor(0, n, [&](int i) {
+        rows[i] = 0;
+        scheduler.ParallelFor(0, n, [&](int j) { rows[i] += j; });
+    });
+    for (int i = 0; i < n; i++)
+        ASSERT_EQ(rows[i].load(), n * (n - 1) / 2);
+}
+
+TEST(ChTaskScheduler, resize_and_pinning) {
+    ChTaskScheduler scheduler(2);
+    scheduler.SetNumThreads(5);
+    ASSERT_EQ(scheduler.GetNumThreads(), 5);
+    scheduler.EnableCorePinning(true);
+    ASSERT_EQ(scheduler.GetNumThreads(), 5);
+
+    std::atomic<int> sum(0);
+    scheduler.ParallelFor(0, 1000, [&sum](int i) { sum += i; });
+    ASSERT_EQ(sum.load(), 999 * 1000 / 2);
+
+    // Single-threaded scheduler executes all work in the calling thread
+    scheduler.SetNumThreads(1);
+    ChTaskScheduler::TaskGroup group(scheduler);
+    group.Run([&sum]() { sum = -1; });
+    group.Wait();
+    ASSERT_EQ(sum.load(), -1);
+}
+
+TEST(ChTaskScheduler, exception) {
+    ChTaskScheduler scheduler(4);
+
+    std::atomic<int> count(0);
+    ChTaskScheduler::TaskGroup group(scheduler);
+    for (int i = 0; i < 20; i++) {
+        group.Run([&count, i]() {
+            count++;
+            if (i == 7)
+                throw std::runtime_error("task failure");
+        });
+    }
+    ASSERT_THROW(group.Wait(), std::runtime_error);
+    ASSERT_EQ(count.load(), 20);
+}
+
+TEST(ChTaskScheduler, global) {
+    auto& scheduler = ChTaskScheduler::GetGlobal();
+    ASSERT_EQ(&scheduler, &ChTaskScheduler::GetGlobal());
+    ASSERT_GE(scheduler.GetNumThreads(), 1);
+
+    std::atomic<int> sum(0);
+    scheduler.ParallelFor(0, 100, [&sum](int i) { sum += i; });
+    ASSERT_EQ(sum.load(), 4950);
+}
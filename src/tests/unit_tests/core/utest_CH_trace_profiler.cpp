@@ -0,0 +1,94 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the trace profiler: record nested scopes on several threads and
+// check the events written in Chrome trace format.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chrono/utils/ChTraceProfiler.h"
+#include "gtest/gtest.h"
+
+using namespace chrono::utils;
+
+static void TracedWork(int n) {
+    CH_TRACE("outer");
+    for (int i = 0; i < n; i++) {
+        CH_TRACE("inner");
+    }
+}
+
+static int CountOccurrences(const std::string& str, const std::string& sub) {
+    int count = 0;
+    for (size_t pos = str.find(sub); pos != std::string::npos; pos = str.find(sub, pos + sub.size()))
+        count++;
+    return count;
+}
+
+TEST(ChTraceProfiler, disabled) {
+    ChTraceProfiler::Enable(false);
+    ChTraceProfiler::Clear();
+    TracedWork(10);
+    ASSERT_EQ(ChTraceProfiler::GetNumEvents(), 0);
+}
+
+TEST(ChTraceProfiler, same_scope) {
+    ChTraceProfiler::Enable(true);
+    ChTraceProfiler::Clear();
+    {
+        CH_TRACE("first");
+        CH_TRACE("second");
+    }
+    ChTraceProfiler::Enable(false);
+    ASSERT_EQ(ChTraceProfiler::GetNumEvents(), 2);
+    ChTraceProfiler::Clear();
+}
+
+TEST(ChTraceProfiler, threads) {
+    ChTraceProfiler::Enable(true);
+    ChTraceProfiler::Clear();
+
+    int num_threads = 3;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++)
+        threads.push_back(std::thread(TracedWork, 5));
+    TracedWork(5);
+    for (auto& thread : threads)
+        thread.join();
+
+    ChTraceProfiler::Enable(false);
+    ASSERT_EQ(ChTraceProfiler::GetNumEvents(), (num_threads + 1) * 6);
+
+    std::string filename = "trace_profiler_test.json";
+    ASSERT_TRUE(ChTraceProfiler::WriteChromeTrace(filename));
+    ASSERT_EQ(ChTraceProfiler::GetNumEvents(), 0);
+
+    std::ifstream file(filename);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string trace = buffer.str();
+    file.close();
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(CountOccurrences(trace, "\"ph\":\"X\""), (num_threads + 1) * 6);
+    ASSERT_EQ(CountOccurrences(trace, "\"name\":\"outer\""), num_threads + 1);
+    ASSERT_EQ(CountOccurrences(trace, "\"name\":\"thread_name\""), num_threads + 1);
+}
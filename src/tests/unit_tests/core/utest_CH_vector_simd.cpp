@@ -0,0 +1,100 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the SIMD frame and quaternion kernels (comparison with the
+// scalar ChQuaternion and ChFrame operations).
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/core/ChVectorSIMD.h"
+#include "chrono/core/ChRotation.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+const double ABS_ERR = 1e-12;
+
+static ChFrame<> TestFrame() {
+    ChQuaterniond q = QuatFromAngleAxis(0.7, ChVector3d(1, -2, 3).GetNormalized());
+    return ChFrame<>(ChVector3d(1.5, -0.5, 2.0), q);
+}
+
+TEST(ChVectorSIMD, quaternion_product) {
+    ChQuaterniond qa = QuatFromAngleAxis(0.3, ChVector3d(0, 1, 1).GetNormalized());
+    ChQuaterniond qb = QuatFromAngleAxis(-1.2, ChVector3d(2, 1, -1).GetNormalized());
+    ChQuaterniond qc(0.1, -0.4, 2.5, 0.25);  // not normalized
+
+    for (const auto& q : {qb, qc}) {
+        ChQuaterniond res = QuatProductSIMD(qa, q);
+        ChQuaterniond ref = qa * q;
+        for (int i = 0; i < 4; i++)
+            ASSERT_NEAR(res[i], ref[i], ABS_ERR);
+    }
+}
+
+TEST(ChVectorSIMD, transform_point) {
+    ChFrame<> frame = TestFrame();
+    ChVector3d v(0.3, -1.7, 4.2);
+    ChVector3d res = TransformPointLocalToParentSIMD(frame, v);
+    ChVector3d ref = frame.TransformPointLocalToParent(v);
+    ASSERT_NEAR((res - ref).Length(), 0.0, ABS_ERR);
+}
+
+TEST(ChVectorSIMD, transform_points_soa) {
+    ChFrame<> frame = TestFrame();
+
+    // Number of points not a multiple of the SIMD width
+    const size_t n = 13;
+    std::vector<double> x(n), y(n), z(n), X(n), Y(n), Z(n);
+    for (size_t i = 0; i < n; i++) {
+        x[i] = 0.1 * i;
+        y[i] = 1.0 - 0.3 * i;
+        z[i] = 0.05 * i * i;
+    }
+
+    TransformPointsLocalToParentSIMD(frame, n, x.data(), y.data(), z.data(), X.data(), Y.data(), Z.data());
+    for (size_t i = 0; i < n; i++) {
+        ChVector3d ref = frame.TransformPointLocalToParent(ChVector3d(x[i], y[i], z[i]));
+        ASSERT_NEAR(X[i], ref.x(), ABS_ERR);
+        ASSERT_NEAR(Y[i], ref.y(), ABS_ERR);
+        ASSERT_NEAR(Z[i], ref.z(), ABS_ERR);
+    }
+
+    // In-place transformation back to the local frame recovers the original points
+    TransformPointsParentToLocalSIMD(frame, n, X.data(), Y.data(), Z.data(), X.data(), Y.data(), Z.data());
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_NEAR(X[i], x[i], ABS_ERR);
+        ASSERT_NEAR(Y[i], y[i], ABS_ERR);
+        ASSERT_NEAR(Z[i], z[i], ABS_ERR);
+    }
+}
+
+TEST(ChVectorSIMD, transform_points_aos) {
+    ChMatrix33<> A(1.5);
+    A(0, 1) = 0.2;
+    A(2, 0) = -0.4;
+    ChVector3d displ(-1, 2, 0.5);
+
+    // More points than the block size used internally
+    std::vector<ChVector3d> points(301);
+    for (size_t i = 0; i < points.size(); i++)
+        points[i] = ChVector3d(0.01 * i, std::sin(0.1 * i), 2.0 - 0.02 * i);
+    std::vector<ChVector3d> ref(points);
+
+    TransformPointsSIMD(A, displ, points);
+    for (size_t i = 0; i < points.size(); i++)
+        ASSERT_NEAR((points[i] - (A * ref[i] + displ)).Length(), 0.0, ABS_ERR);
+}
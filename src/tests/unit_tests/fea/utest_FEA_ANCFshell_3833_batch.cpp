@@ -0,0 +1,111 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the batched evaluation of internal forces of ANCF 3833 shell
+// elements. The generalized internal forces of a randomly deformed plate mesh
+// with elements of different settings (number of layers, damping, internal
+// force calculation method) are compared with the per-element evaluation.
+//
+// =============================================================================
+
+#include <map>
+#include <random>
+#include <utility>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/fea/ChElementShellANCF_3833.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/utils/ChConstants.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+TEST(ChElementShellANCF_3833, batched_internal_forces) {
+    ChSystemSMC sys;
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseQR>());
+
+    auto material = chrono_types::make_shared<ChMaterialShellANCF>(7850, 210e9, 0.3);
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    mesh->SetAutomaticGravity(false);
+    sys.Add(mesh);
+
+    // Plate of NX x NY elements, with nodes at the element corners and midsides, fixed at x = 0
+    int NX = 6;
+    int NY = 3;
+    double h = 0.1;
+    std::map<std::pair<int, int>, std::shared_ptr<ChNodeFEAxyzDD>> nodes;
+    auto node = [&](int i, int j) {
+        auto& n = nodes[{i, j}];
+        if (!n) {
+            n = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector3d(0.5 * i * h, 0.5 * j * h, 0), VECT_Z, VNULL);
+            n->SetFixed(i == 0);
+            mesh->AddNode(n);
+        }
+        return n;
+    };
+
+    for (int ix = 0; ix < NX; ix++) {
+        for (int iy = 0; iy < NY; iy++) {
+            int i = 2 * ix;
+            int j = 2 * iy;
+            int k = ix * NY + iy;
+            auto element = chrono_types::make_shared<ChElementShellANCF_3833>();
+            element->SetNodes(node(i, j), node(i + 2, j), node(i + 2, j + 2), node(i, j + 2),  //
+                              node(i + 1, j), node(i + 2, j + 1), node(i + 1, j + 2), node(i, j + 1));
+            element->SetDimensions(h, h);
+            if (k % 3 == 0) {
+                element->AddLayer(0.005, 0, material);
+                element->AddLayer(0.005, 30 * CH_DEG_TO_RAD, material);
+            } else {
+                element->AddLayer(0.01, 0, material);
+            }
+            element->SetAlphaDamp(k % 2 == 0 ? 0.01 : 0.0);
+            if (k == 7)
+                element->SetIntFrcCalcMethod(ChElementShellANCF_3833::IntFrcMethod::PreInt);
+            mesh->AddElement(element);
+        }
+    }
+
+    // Initialize the system and perturb the nodal coordinates and their time derivatives
+    sys.DoStepDynamics(1e-4);
+
+    std::default_random_engine generator(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    auto rnd = [&](double scale) { return scale * ChVector3d(dist(generator), dist(generator), dist(generator)); };
+    for (auto& n : nodes) {
+        if (n.second->IsFixed())
+            continue;
+        n.second->SetPos(n.second->GetPos() + rnd(1e-3));
+        n.second->SetSlope1(n.second->GetSlope1() + rnd(1e-2));
+        n.second->SetSlope2(n.second->GetSlope2() + rnd(1e-2));
+        n.second->SetPosDt(rnd(1e-1));
+        n.second->SetSlope1Dt(rnd(1.0));
+        n.second->SetSlope2Dt(rnd(1.0));
+    }
+
+    // Compare the generalized internal forces with and without batched evaluation
+    ChVectorDynamic<> R[2];
+    for (int pass = 0; pass < 2; pass++) {
+        mesh->SetBatchedInternalForces(pass == 1);
+        R[pass].setZero(sys.GetNumCoordsVelLevel());
+        mesh->IntLoadResidual_F(mesh->GetOffset_w(), R[pass], -0.5);
+    }
+
+    double norm = R[0].lpNorm<Eigen::Infinity>();
+    ASSERT_GT(norm, 0.0);
+    ASSERT_LE((R[1] - R[0]).lpNorm<Eigen::Infinity>(), 1e-12 * norm);
+}
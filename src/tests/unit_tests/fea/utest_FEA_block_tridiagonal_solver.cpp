@@ -0,0 +1,212 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for the block-tridiagonal direct solver.
+//
+// Saddle-point systems of node chains (open chains with boundary constraints,
+// rings, and chains attached to a common hub) are solved and checked against
+// known solutions. A set of ANCF cables and Euler beams, clamped at one end,
+// is simulated with the block-tridiagonal and the Eigen SparseLU solvers;
+// results must coincide.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/fea/ChBuilderBeam.h"
+#include "chrono/fea/ChLinkNodeFrame.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/solver/ChSolverBlockTridiagonal.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Append the triplets of a chain of nodes with 'b' unknowns each, starting at the specified unknown.
+// If 'ring' is true, the last node is coupled to the first one.
+static void AddChain(int first, int num_nodes, int b, bool ring, std::vector<Eigen::Triplet<double>>& triplets) {
+    auto id = [&](int k, int i) { return first + (k % num_nodes) * b + i; };
+    for (int k = 0; k < num_nodes; k++) {
+        bool coupled = ring || k + 1 < num_nodes;
+        for (int i = 0; i < b; i++) {
+            triplets.push_back({id(k, i), id(k, i), 10.0 + 0.1 * ((k + i) % 5)});
+            for (int j = 0; j < b; j++) {
+                if (j != i)
+                    triplets.push_back({id(k, i), id(k, j), 0.2 * std::sin(k + i - 2.0 * j)});
+                if (coupled) {
+                    double v = std::cos(0.3 * k + i + 0.7 * j);
+                    triplets.push_back({id(k, i), id(k + 1, j), v});
+                    triplets.push_back({id(k + 1, j), id(k, i), v});
+                }
+            }
+        }
+    }
+}
+
+// Append the triplets of a constraint coupling unknown 'i' to the multiplier 'row'.
+static void AddConstraint(int row, int i, double g, std::vector<Eigen::Triplet<double>>& triplets) {
+    triplets.push_back({row, i, g});
+    triplets.push_back({i, row, g});
+}
+
+// Solve and return the error with respect to a known solution.
+static double SolveSystem(ChSolverBlockTridiagonal& solver, const ChSparseMatrix& A) {
+    ChVectorDynamic<> x_ref(A.rows());
+    for (int i = 0; i < A.rows(); i++)
+        x_ref(i) = std::sin(0.1 * i) + 1;
+    solver.A() = A;
+    solver.b() = A * x_ref;
+    EXPECT_TRUE(solver.SetupCurrent());
+    EXPECT_TRUE(solver.SolveCurrent());
+    return (solver.x() - x_ref).lpNorm<Eigen::Infinity>() / x_ref.lpNorm<Eigen::Infinity>();
+}
+
+TEST(ChSolverBlockTridiagonal, chain) {
+    // Chain of 6-DOF nodes, with 3 constraints at each end
+    const int num_nodes = 400;
+    const int nq = 6 * num_nodes;
+    std::vector<Eigen::Triplet<double>> triplets;
+    AddChain(0, num_nodes, 6, false, triplets);
+    for (int c = 0; c < 3; c++) {
+        AddConstraint(nq + c, c, 1.0, triplets);
+        AddConstraint(nq + 3 + c, nq - 6 + c, 1.0, triplets);
+    }
+    ChSparseMatrix A(nq + 6, nq + 6);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+
+    ChSolverBlockTridiagonal solver(2);
+    ASSERT_LT(SolveSystem(solver, A), 1e-12);
+    ASSERT_EQ(solver.GetNumChains(), 1);
+    ASSERT_EQ(solver.GetChainSize(), nq);
+    ASSERT_EQ(solver.GetBorderSize(), 6);
+
+    // Without chains, the solver reduces to a sparse LU factorization of the whole matrix
+    solver.SetMaxBlockSize(1);
+    ASSERT_LT(SolveSystem(solver, A), 1e-12);
+    ASSERT_EQ(solver.GetNumChains(), 0);
+    ASSERT_EQ(solver.GetBorderSize(), nq + 6);
+}
+
+TEST(ChSolverBlockTridiagonal, hub) {
+    // Chains and a ring of 3-DOF nodes, each attached to a common 6-DOF hub through constraints
+    const int num_chains = 40;
+    const int num_nodes = 25;
+    const int chain_size = 3 * num_nodes;
+    const int hub = num_chains * chain_size;
+    const int nq = hub + 6;
+    const int n = nq + 3 * num_chains;
+
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int c = 0; c < num_chains; c++)
+        AddChain(c * chain_size, num_nodes, 3, c == 0, triplets);
+    for (int i = 0; i < 6; i++)
+        triplets.push_back({hub + i, hub + i, 5.0});
+    for (int c = 0; c < num_chains; c++) {
+        for (int d = 0; d < 3; d++) {
+            int row = nq + 3 * c + d;
+            AddConstraint(row, (c + 1) * chain_size - 3 + d, 1.0, triplets);
+            AddConstraint(row, hub + d, -1.0, triplets);
+            AddConstraint(row, hub + 3 + (d + c) % 3, 0.1 * (c % 4), triplets);
+        }
+    }
+    ChSparseMatrix A(n, n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+
+    ChSolverBlockTridiagonal solver(4);
+    ASSERT_LT(SolveSystem(solver, A), 1e-11);
+    ASSERT_EQ(solver.GetChainSize(), nq);
+    ASSERT_EQ(solver.GetBorderSize(), 3 * num_chains);
+
+    // Reuse of the symbolic analysis with new matrix values
+    A *= 2;
+    solver.A() = A;
+    ChVectorDynamic<> x_ref = ChVectorDynamic<>::Ones(n);
+    solver.b() = A * x_ref;
+    ASSERT_TRUE(solver.SetupCurrent());
+    ASSERT_TRUE(solver.SolveCurrent());
+    ASSERT_LT((solver.x() - x_ref).lpNorm<Eigen::Infinity>(), 1e-11);
+}
+
+// Simulate ANCF cables and Euler beams, clamped at one end, with the cable ends attached to a common body.
+// Return the position of the body and of the free end of the last beam.
+static std::pair<ChVector3d, ChVector3d> Simulate(std::shared_ptr<ChDirectSolverLS> solver) {
+    const int num_cables = 4;
+    const int num_beams = 2;
+    const int num_elements = 20;
+
+    ChSystemSMC sys;
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    auto body = chrono_types::make_shared<ChBodyEasyBox>(0.2, 0.2, 0.2, 1000);
+    body->SetPos(ChVector3d(1, -0.5, 0));
+    sys.Add(body);
+
+    auto section_cable = chrono_types::make_shared<ChBeamSectionCable>();
+    section_cable->SetDiameter(0.01);
+    section_cable->SetYoungModulus(1e8);
+    section_cable->SetRayleighDamping(0.001);
+
+    for (int c = 0; c < num_cables; c++) {
+        ChVector3d end = body->GetPos() + ChVector3d(0, 0.1 * std::cos(CH_PI_2 * c), 0.1 * std::sin(CH_PI_2 * c));
+        ChBuilderCableANCF builder;
+        builder.BuildBeam(mesh, section_cable, num_elements, ChVector3d(0, 0, 0.2 * c), end);
+        builder.GetLastBeamNodes().front()->SetFixed(true);
+
+        auto link = chrono_types::make_shared<ChLinkNodeFrame>();
+        link->Initialize(builder.GetLastBeamNodes().back(), body);
+        sys.Add(link);
+    }
+
+    auto section_beam = chrono_types::make_shared<ChBeamSectionEulerEasyRectangular>(0.01, 0.01, 2e8, 8e7, 1000);
+
+    std::shared_ptr<ChNodeFEAxyzrot> tip;
+    for (int b = 0; b < num_beams; b++) {
+        ChBuilderBeamEuler builder;
+        builder.BuildBeam(mesh, section_beam, num_elements, ChVector3d(0, 0.5, 0.3 * b), ChVector3d(1, 0.5, 0.3 * b),
+                          VECT_Y);
+        builder.GetLastBeamNodes().front()->SetFixed(true);
+        tip = builder.GetLastBeamNodes().back();
+    }
+
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    solver->LockSparsityPattern(true);
+    solver->ReuseSymbolicAnalysis(true);
+    sys.SetSolver(solver);
+
+    for (int i = 0; i < 50; i++)
+        sys.DoStepDynamics(1e-3);
+
+    return {body->GetPos(), tip->GetPos()};
+}
+
+TEST(ChSolverBlockTridiagonal, cables) {
+    auto solver_lu = chrono_types::make_shared<ChSolverSparseLU>();
+    auto pos_lu = Simulate(solver_lu);
+
+    auto solver_bt = chrono_types::make_shared<ChSolverBlockTridiagonal>(4);
+    auto pos_bt = Simulate(solver_bt);
+    ASSERT_EQ(solver_bt->GetNumAnalysisCalls(), 1);
+
+    // One chain per cable and per beam, plus the body; the border consists of the cable-body constraints
+    ASSERT_EQ(solver_bt->GetNumChains(), 4 + 2 + 1);
+    ASSERT_EQ(solver_bt->GetBorderSize(), 4 * 3);
+
+    ASSERT_LT((pos_bt.first - pos_lu.first).Length(), 1e-10);
+    ASSERT_LT((pos_bt.second - pos_lu.second).Length(), 1e-10);
+}
@@ -0,0 +1,143 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the BVH collision detection of a contact surface mesh against
+// FEA node clouds and rigid body spheres. A flat triangulated plate is tested
+// against spheres at different locations, before and after deformation of
+// the plate (refit of the hierarchy).
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChContactContainer.h"
+#include "chrono/collision/ChCollisionShapeSphere.h"
+#include "chrono/fea/ChContactSurfaceMeshBVH.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Contact callback collecting the contact points and normals.
+class ContactCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& cforce,
+                                 const ChVector3d& ctorque,
+                                 ChContactable* modA,
+                                 ChContactable* modB) override {
+        distances.push_back(distance);
+        normals.push_back(plane_coord.GetAxisX());
+        return true;
+    }
+    std::vector<double> distances;
+    std::vector<ChVector3d> normals;
+};
+
+TEST(ChContactSurfaceMeshBVH, node_to_face) {
+    ChSystemSMC sys;
+    auto material = chrono_types::make_shared<ChContactMaterialSMC>();
+
+    // Plate of N x N squares (2 triangles each) in the plane z = 0, with upward normals
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+    int N = 20;
+    double h = 0.1;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    for (int i = 0; i <= N; i++) {
+        for (int j = 0; j <= N; j++) {
+            nodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(i * h, j * h, 0)));
+            nodes.back()->SetFixed(true);
+            mesh->AddNode(nodes.back());
+        }
+    }
+    auto surface = chrono_types::make_shared<ChContactSurfaceMesh>(material, mesh.get());
+    auto id = [N](int i, int j) { return i * (N + 1) + j; };
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            surface->AddFace(nodes[id(i, j)], nodes[id(i + 1, j)], nodes[id(i + 1, j + 1)],  //
+                             nullptr, nullptr, nullptr, true, true, true, true, true, true);
+            surface->AddFace(nodes[id(i, j)], nodes[id(i + 1, j + 1)], nodes[id(i, j + 1)],  //
+                             nullptr, nullptr, nullptr, true, true, true, true, true, true);
+        }
+    }
+    mesh->AddContactSurface(surface);
+
+    // Node cloud with a node slightly penetrating the plate, one above the envelope, and one far below the plate
+    auto mesh_nodes = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh_nodes);
+    ChVector3d node_pos[3] = {{0.33, 0.12, 0.0005}, {0.53, 0.52, 0.1}, {1.13, 0.22, -0.2}};
+    for (const auto& p : node_pos)
+        mesh_nodes->AddNode(chrono_types::make_shared<ChNodeFEAxyz>(p));
+    auto cloud = chrono_types::make_shared<ChContactSurfaceNodeCloud>(material, mesh_nodes.get());
+    cloud->AddAllNodes(0.001);
+    mesh_nodes->AddContactSurface(cloud);
+
+    // Rigid body with a sphere penetrating the plate
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetPos(ChVector3d(1.02, 1.47, 0.09));
+    body->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeSphere>(material, 0.1));
+    body->EnableCollision(true);
+    sys.AddBody(body);
+
+    ChContactSurfaceMeshBVH bvh(surface);
+    bvh.SetEnvelope(0.01);
+    bvh.AddNodeCloud(cloud);
+    bvh.AddBody(body);
+    ASSERT_FALSE(surface->IsCollisionSystemEnabled());
+
+    auto container = sys.GetContactContainer();
+    auto collide = [&]() {
+        container->BeginAddContact();
+        bvh.OnCustomCollision(&sys);
+        container->EndAddContact();
+    };
+
+    collide();
+    ASSERT_EQ(bvh.GetNumBuilds(), 1u);
+    ASSERT_EQ(bvh.GetNumContacts(), 2u);
+    ASSERT_EQ(container->GetNumContacts(), 2u);
+
+    auto collector = chrono_types::make_shared<ContactCollector>();
+    container->ReportAllContacts(collector);
+    std::sort(collector->distances.begin(), collector->distances.end());
+    ASSERT_NEAR(collector->distances[0], -0.01, 1e-12);
+    ASSERT_NEAR(collector->distances[1], -0.0005, 1e-12);
+    for (const auto& n : collector->normals)
+        ASSERT_NEAR(std::abs(n.z()), 1.0, 1e-12);
+
+    // Lift the plate under the second node: the hierarchy is refit, not rebuilt
+    for (int i = 4; i <= 6; i++) {
+        for (int j = 4; j <= 6; j++) {
+            auto& node = nodes[id(i, j)];
+            node->SetPos(node->GetPos() + ChVector3d(0, 0, 0.0995));
+        }
+    }
+    collide();
+    ASSERT_EQ(bvh.GetNumBuilds(), 1u);
+    ASSERT_EQ(bvh.GetNumContacts(), 3u);
+
+    // A forced rebuild of the hierarchy gives the same contacts
+    bvh.Rebuild();
+    collide();
+    ASSERT_EQ(bvh.GetNumBuilds(), 2u);
+    ASSERT_EQ(bvh.GetNumContacts(), 3u);
+}
@@ -0,0 +1,190 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit tests for the reduced-integration hexahedron with hourglass control:
+// - internal forces of a distorted element under uniform strain, compared with
+//   the fully integrated ChElementHexaCorot_8;
+// - hourglass forces and consistency with the element stiffness matrix;
+// - free fall of a block with an explicit integrator and mass lumping.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChElementHexaCorot_8.h"
+#include "chrono/fea/ChElementHexaCorot_8R.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Nodes of a distorted hexahedron
+static const ChVector3d hexa_pos[8] = {{0.0, 0.0, 0.0},   {1.1, 0.1, 0.0}, {1.0, 0.9, 0.1}, {-0.1, 1.0, 0.0},
+                                       {0.1, -0.1, 1.0}, {1.0, 0.0, 1.2}, {1.2, 1.1, 1.0}, {0.0, 1.0, 0.9}};
+
+// Create the nodes of a distorted hexahedron and add them to the mesh
+static std::vector<std::shared_ptr<ChNodeFEAxyz>> CreateNodes(std::shared_ptr<ChMesh> mesh) {
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    for (const auto& p : hexa_pos) {
+        nodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(p));
+        nodes.back()->SetFixed(true);
+        mesh->AddNode(nodes.back());
+    }
+    return nodes;
+}
+
+TEST(ChElementHexaCorot_8R, internal_forces) {
+    ChSystemSMC sys;
+    sys.SetGravitationalAcceleration(VNULL);
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    auto material = chrono_types::make_shared<ChContinuumElastic>(1e7, 0.3, 1000);
+
+    auto nodes = CreateNodes(mesh);
+    auto element = chrono_types::make_shared<ChElementHexaCorot_8R>();
+    element->SetNodes(nodes[0], nodes[1], nodes[2], nodes[3], nodes[4], nodes[5], nodes[6], nodes[7]);
+    element->SetMaterial(material);
+    mesh->AddElement(element);
+
+    auto nodes_full = CreateNodes(mesh);
+    auto element_full = chrono_types::make_shared<ChElementHexaCorot_8>();
+    element_full->SetNodes(nodes_full[0], nodes_full[1], nodes_full[2], nodes_full[3], nodes_full[4], nodes_full[5],
+                           nodes_full[6], nodes_full[7]);
+    element_full->SetMaterial(material);
+    mesh->AddElement(element_full);
+
+    // Initialize the system (all nodes fixed)
+    sys.DoStepDynamics(1e-4);
+    ASSERT_NEAR(element->GetVolume(), element_full->GetVolume(), 1e-12);
+
+    ChVectorDynamic<> Fi(24);
+    ChVectorDynamic<> Fi_full(24);
+    auto set_positions = [&](std::function<ChVector3d(const ChVector3d&, int)> f) {
+        for (int i = 0; i < 8; i++) {
+            nodes[i]->SetPos(f(hexa_pos[i], i));
+            nodes_full[i]->SetPos(f(hexa_pos[i], i));
+        }
+        sys.Update(false);
+        element->ComputeInternalForces(Fi);
+        element_full->ComputeInternalForces(Fi_full);
+    };
+
+    // Uniform strain (linear displacement field): same forces as the fully integrated element
+    ChMatrix33<> E(ChVector3d(1e-3, -2e-3, 5e-4));
+    E(0, 1) = E(1, 0) = 3e-4;
+    E(1, 2) = E(2, 1) = -1e-4;
+    set_positions([&E](const ChVector3d& p, int i) { return p + E * p + ChVector3d(0.1, 0.2, 0.3); });
+    ASSERT_GT(Fi_full.lpNorm<Eigen::Infinity>(), 1e3);
+    ASSERT_LE((Fi - Fi_full).lpNorm<Eigen::Infinity>(), 1e-8 * Fi_full.lpNorm<Eigen::Infinity>());
+
+    // Rigid body motion: no forces
+    ChMatrix33<> R(QuatFromAngleAxis(0.3, ChVector3d(1, 2, 3).GetNormalized()));
+    set_positions([&R](const ChVector3d& p, int i) { return R * p + ChVector3d(1, 2, 3); });
+    ASSERT_LE(Fi.lpNorm<Eigen::Infinity>(), 1e-6);
+
+    // Hourglass mode (xi * eta): restoring forces consistent with the element stiffness matrix
+    const double hg_mode[8] = {+1, -1, +1, -1, +1, -1, +1, -1};
+    ChVectorDynamic<> d(24);
+    for (int i = 0; i < 8; i++)
+        d.segment(3 * i, 3) = ChVector3d(1e-4 * hg_mode[i], 0, 0).eigen();
+    set_positions([&d](const ChVector3d& p, int i) { return p + ChVector3d(d.segment(3 * i, 3)); });
+    ChMatrixDynamic<> K(24, 24);
+    element->ComputeKRMmatricesGlobal(K, 1.0);
+    ASSERT_GT(Fi.lpNorm<Eigen::Infinity>(), 1);
+    ASSERT_LE((Fi + K * d).lpNorm<Eigen::Infinity>(), 1e-6 * Fi.lpNorm<Eigen::Infinity>());
+    ASSERT_GT(d.dot(K * d), 0);
+}
+
+TEST(ChElementHexaCorot_8R, no_hourglass_control) {
+    ChSystemSMC sys;
+    sys.SetGravitationalAcceleration(VNULL);
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    auto material = chrono_types::make_shared<ChContinuumElastic>(1e7, 0.3, 1000);
+    auto nodes = CreateNodes(mesh);
+    auto element = chrono_types::make_shared<ChElementHexaCorot_8R>();
+    element->SetNodes(nodes[0], nodes[1], nodes[2], nodes[3], nodes[4], nodes[5], nodes[6], nodes[7]);
+    element->SetMaterial(material);
+    element->SetHourglassCoefficient(0);
+    mesh->AddElement(element);
+    sys.DoStepDynamics(1e-4);
+
+    // Without hourglass control, the 12 hourglass modes (4 per direction) are zero-energy modes
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eig(element->GetStiffnessMatrix());
+    const auto& ev = eig.eigenvalues();
+    int num_zero = 0;
+    for (int i = 0; i < 24; i++)
+        if (std::abs(ev(i)) < 1e-8 * ev(23))
+            num_zero++;
+    ASSERT_EQ(num_zero, 6 + 12);
+}
+
+TEST(ChElementHexaCorot_8R, explicit_free_fall) {
+    double g = 9.81;
+    ChSystemSMC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -g));
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    // Block of N x N x N elements, with initial velocity
+    auto material = chrono_types::make_shared<ChContinuumElastic>(1e6, 0.3, 1000);
+    int N = 2;
+    double h = 0.1;
+    double v0 = 0.5;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    for (int i = 0; i <= N; i++)
+        for (int j = 0; j <= N; j++)
+            for (int k = 0; k <= N; k++) {
+                nodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(i * h, j * h, k * h)));
+                nodes.back()->SetPosDt(ChVector3d(0, 0, v0));
+                mesh->AddNode(nodes.back());
+            }
+    auto id = [N](int i, int j, int k) { return (i * (N + 1) + j) * (N + 1) + k; };
+    for (int i = 0; i < N; i++)
+        for (int j = 0; j < N; j++)
+            for (int k = 0; k < N; k++) {
+                auto element = chrono_types::make_shared<ChElementHexaCorot_8R>();
+                element->SetNodes(nodes[id(i, j, k)], nodes[id(i + 1, j, k)], nodes[id(i + 1, j + 1, k)],
+                                  nodes[id(i, j + 1, k)], nodes[id(i, j, k + 1)], nodes[id(i + 1, j, k + 1)],
+                                  nodes[id(i + 1, j + 1, k + 1)], nodes[id(i, j + 1, k + 1)]);
+                element->SetMaterial(material);
+                mesh->AddElement(element);
+            }
+
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_EXPLICIT);
+    auto integrator = std::dynamic_pointer_cast<ChExplicitTimestepper>(sys.GetTimestepper());
+    ASSERT_TRUE(integrator);
+    integrator->SetDiagonalLumpingON();
+
+    double step = 1e-4;
+    int num_steps = 1000;
+    for (int n = 0; n < num_steps; n++)
+        sys.DoStepDynamics(step);
+    ASSERT_EQ(integrator->GetLumpingError(), 0);
+
+    // All nodes move as a rigid body in free fall
+    double t = num_steps * step;
+    double dz = v0 * t - 0.5 * g * t * t;
+    for (int i = 0; i <= N; i++)
+        for (int j = 0; j <= N; j++)
+            for (int k = 0; k <= N; k++) {
+                const auto& node = nodes[id(i, j, k)];
+                ASSERT_NEAR(node->GetPos().z(), k * h + dz, g * t * step);
+                ASSERT_NEAR(node->GetPosDt().z(), v0 - g * t, 1e-9);
+                ASSERT_NEAR(node->GetPos().x(), i * h, 1e-12);
+            }
+}
@@ -0,0 +1,134 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the lazy recomputation of the KRM blocks of corotational
+// elements. A mesh with tetrahedra and Euler beams is rotated and perturbed and
+// the recomputation of the element KRM blocks is checked, as well as the values
+// of the loaded blocks.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/fea/ChBuilderBeam.h"
+#include "chrono/fea/ChElementTetraCorot_4.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Maximum difference between the loaded KRM blocks and the blocks recomputed in the current configuration.
+double MaxBlockError(std::shared_ptr<ChMesh> mesh, double Kfactor, double Rfactor, double Mfactor) {
+    double error = 0;
+    for (const auto& element : mesh->GetElements()) {
+        auto generic = std::dynamic_pointer_cast<ChElementGeneric>(element);
+        const auto& H = generic->Kstiffness().GetMatrix();
+        ChMatrixDynamic<> H_exact(H.rows(), H.cols());
+        generic->ComputeKRMmatricesGlobal(H_exact, Kfactor, Rfactor, Mfactor);
+        error = std::max(error, (H - H_exact).lpNorm<Eigen::Infinity>() / H_exact.lpNorm<Eigen::Infinity>());
+    }
+    return error;
+}
+
+TEST(ChElementCorotational, lazy_KRM) {
+    ChSystemSMC sys;
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    // Tetrahedra
+    auto material = chrono_types::make_shared<ChContinuumElastic>();
+    material->SetYoungModulus(1e6);
+    material->SetPoissonRatio(0.3);
+    material->SetDensity(1000);
+    material->SetRayleighDampingBeta(0.01);
+
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    ChVector3d pos[5] = {{0, 0, 0}, {0.1, 0, 0}, {0, 0.1, 0}, {0, 0, 0.1}, {0.1, 0.1, 0.1}};
+    for (const auto& p : pos) {
+        nodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(p));
+        mesh->AddNode(nodes.back());
+    }
+    int tets[2][4] = {{0, 1, 2, 3}, {1, 2, 3, 4}};
+    for (const auto& t : tets) {
+        auto element = chrono_types::make_shared<ChElementTetraCorot_4>();
+        element->SetNodes(nodes[t[0]], nodes[t[1]], nodes[t[2]], nodes[t[3]]);
+        element->SetMaterial(material);
+        mesh->AddElement(element);
+    }
+
+    // Euler beams (without geometric stiffness and state-dependent inertial matrices)
+    auto section = chrono_types::make_shared<ChBeamSectionEulerSimple>();
+    section->SetAsRectangularSection(0.01, 0.02);
+    section->SetYoungModulus(2e9);
+    section->SetShearModulus(0.8e9);
+    section->SetDensity(1000);
+    section->compute_inertia_damping_matrix = false;
+    section->compute_inertia_stiffness_matrix = false;
+    ChBuilderBeamEuler builder;
+    builder.BuildBeam(mesh, section, 3, ChVector3d(0, 0.5, 0), ChVector3d(0.6, 0.5, 0), ChVector3d(0, 1, 0));
+    for (auto& beam : builder.GetLastBeamElements())
+        beam->SetUseGeometricStiffness(false);
+
+    unsigned int num_elements = mesh->GetNumElements();
+
+    // Initialize the system (no loads, so the mesh remains in its reference configuration)
+    sys.SetGravitationalAcceleration(VNULL);
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseQR>());
+    sys.DoStepDynamics(1e-4);
+    mesh->SetLazyKRM(true, 1e-6);
+
+    // First load computes all blocks
+    mesh->LoadKRMMatrices(1.0, 0.1, 0.01);
+    ASSERT_EQ(mesh->GetNumKRMChanged(), num_elements);
+    ASSERT_LE(MaxBlockError(mesh, 1.0, 0.1, 0.01), 1e-14);
+
+    // Unchanged configuration: no recomputation
+    mesh->LoadKRMMatrices(1.0, 0.1, 0.01);
+    ASSERT_EQ(mesh->GetNumKRMChanged(), 0u);
+    ASSERT_FALSE(mesh->HasKRMChanged());
+
+    // Changed factors: all blocks recomputed
+    mesh->LoadKRMMatrices(2.0, 0.1, 0.01);
+    ASSERT_EQ(mesh->GetNumKRMChanged(), num_elements);
+    ASSERT_LE(MaxBlockError(mesh, 2.0, 0.1, 0.01), 1e-14);
+
+    // Perturbation below the rotation tolerance: loaded blocks kept
+    nodes[4]->SetPos(nodes[4]->GetPos() + ChVector3d(1e-9, 0, 0));
+    sys.Update(false);
+    mesh->LoadKRMMatrices(2.0, 0.1, 0.01);
+    ASSERT_EQ(mesh->GetNumKRMChanged(), 0u);
+    ASSERT_LE(MaxBlockError(mesh, 2.0, 0.1, 0.01), 1e-6);
+
+    // Rigid rotation of the mesh: all blocks recomputed
+    ChQuaterniond q = QuatFromAngleZ(0.01);
+    for (const auto& node : mesh->GetNodes()) {
+        if (auto node_xyz = std::dynamic_pointer_cast<ChNodeFEAxyz>(node))
+            node_xyz->SetPos(q.Rotate(node_xyz->GetPos()));
+        if (auto node_xyzrot = std::dynamic_pointer_cast<ChNodeFEAxyzrot>(node)) {
+            node_xyzrot->SetPos(q.Rotate(node_xyzrot->GetPos()));
+            node_xyzrot->SetRot(q * node_xyzrot->GetRot());
+        }
+    }
+    sys.Update(false);
+    mesh->LoadKRMMatrices(2.0, 0.1, 0.01);
+    ASSERT_EQ(mesh->GetNumKRMChanged(), num_elements);
+    ASSERT_LE(MaxBlockError(mesh, 2.0, 0.1, 0.01), 1e-14);
+
+    // Lazy recomputation disabled: all blocks recomputed
+    mesh->SetLazyKRM(false);
+    mesh->LoadKRMMatrices(2.0, 0.1, 0.01);
+    ASSERT_EQ(mesh->GetNumKRMChanged(), num_elements);
+}
@@ -0,0 +1,151 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Tests for the evaluation of loads in a ChLoadContainer.
+//
+// - analytical Jacobians of node-node springs and bushings must match the
+//   Jacobians obtained through numerical differentiation;
+// - multithreaded evaluation of the loads in a container must give the same
+//   generalized forces as sequential evaluation.
+//
+// =============================================================================
+
+#include "chrono/physics/ChLoadContainer.h"
+#include "chrono/physics/ChLoadsNodeXYZ.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/functions/ChFunctionPoly.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/fea/ChNodeFEAxyz.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Node-node spring with the default (numerical) Jacobians
+class NumericalSpring : public ChLoadNodeXYZNodeXYZSpring {
+  public:
+    NumericalSpring(std::shared_ptr<ChNodeXYZ> nodeA, std::shared_ptr<ChNodeXYZ> nodeB, double k, double r, double l0)
+        : ChLoadNodeXYZNodeXYZSpring(nodeA, nodeB, k, r, l0) {}
+    virtual void ComputeJacobian(ChState* state_x, ChStateDelta* state_w) override {
+        ChLoadCustomMultiple::ComputeJacobian(state_x, state_w);
+    }
+};
+
+// Node-node bushing with the default (numerical) Jacobians
+class NumericalBushing : public ChLoadNodeXYZNodeXYZBushing {
+  public:
+    NumericalBushing(std::shared_ptr<ChNodeXYZ> nodeA, std::shared_ptr<ChNodeXYZ> nodeB)
+        : ChLoadNodeXYZNodeXYZBushing(nodeA, nodeB) {}
+    virtual void ComputeJacobian(ChState* state_x, ChStateDelta* state_w) override {
+        ChLoadCustomMultiple::ComputeJacobian(state_x, state_w);
+    }
+};
+
+static void CompareJacobians(ChLoadBase& load1, ChLoadBase& load2, double tol) {
+    load1.Update(0);
+    load2.Update(0);
+    const auto& K1 = load1.GetJacobians()->K;
+    const auto& K2 = load2.GetJacobians()->K;
+    const auto& R1 = load1.GetJacobians()->R;
+    const auto& R2 = load2.GetJacobians()->R;
+    ASSERT_EQ(K1.rows(), 6);
+    ASSERT_EQ(K2.rows(), 6);
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 6; j++) {
+            EXPECT_NEAR(K1(i, j), K2(i, j), tol);
+            EXPECT_NEAR(R1(i, j), R2(i, j), tol);
+        }
+    }
+}
+
+TEST(ChLoadContainer, spring_jacobians) {
+    auto nodeA = chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(0.1, 0.2, 0.3));
+    auto nodeB = chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(1.0, -0.4, 0.7));
+    nodeA->SetPosDt(ChVector3d(0.5, -1.0, 0.2));
+    nodeB->SetPosDt(ChVector3d(-0.3, 0.1, 0.4));
+
+    auto spring1 = chrono_types::make_shared<ChLoadNodeXYZNodeXYZSpring>(nodeA, nodeB, 100, 5, 0.5);
+    auto spring2 = chrono_types::make_shared<NumericalSpring>(nodeA, nodeB, 100, 5, 0.5);
+    spring1->SetStiff(true);
+    spring2->SetStiff(true);
+    CompareJacobians(*spring1, *spring2, 1e-4);
+}
+
+TEST(ChLoadContainer, bushing_jacobians) {
+    auto nodeA = chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(0.1, 0.2, 0.3));
+    auto nodeB = chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(1.0, -0.4, 0.7));
+    nodeA->SetPosDt(ChVector3d(0.5, -1.0, 0.2));
+    nodeB->SetPosDt(ChVector3d(-0.3, 0.1, 0.4));
+
+    auto fx = chrono_types::make_shared<ChFunctionPoly>();
+    fx->SetCoefficients({0.0, -200.0, 0.0, -50.0});
+    auto fy = chrono_types::make_shared<ChFunctionPoly>();
+    fy->SetCoefficients({1.0, -100.0});
+
+    auto bushing1 = chrono_types::make_shared<ChLoadNodeXYZNodeXYZBushing>(nodeA, nodeB);
+    auto bushing2 = chrono_types::make_shared<NumericalBushing>(nodeA, nodeB);
+    for (ChLoadNodeXYZNodeXYZBushing* bushing : {(ChLoadNodeXYZNodeXYZBushing*)bushing1.get(),
+                                                 (ChLoadNodeXYZNodeXYZBushing*)bushing2.get()}) {
+        bushing->SetFunctionForceX(fx);
+        bushing->SetFunctionForceY(fy);
+        bushing->SetDamping(ChVector3d(2, 3, 4));
+        bushing->SetStiff(true);
+    }
+    CompareJacobians(*bushing1, *bushing2, 1e-3);
+}
+
+TEST(ChLoadContainer, parallel_evaluation) {
+    ChSystemSMC sys;
+    sys.SetNumThreads(4);
+
+    // Chain of nodes connected by springs; each node is shared by two loads
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+    int num_nodes = 200;
+    for (int i = 0; i < num_nodes; i++) {
+        auto node = chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(0.1 * i, 0.01 * std::sin(i), 0));
+        node->SetPosDt(ChVector3d(0, 0.1 * std::cos(i), 0.05 * i));
+        mesh->AddNode(node);
+    }
+
+    auto loads = chrono_types::make_shared<ChLoadContainer>();
+    sys.Add(loads);
+    for (int i = 0; i < num_nodes - 1; i++) {
+        auto nodeA = std::dynamic_pointer_cast<ChNodeFEAxyz>(mesh->GetNode(i));
+        auto nodeB = std::dynamic_pointer_cast<ChNodeFEAxyz>(mesh->GetNode(i + 1));
+        auto spring = chrono_types::make_shared<ChLoadNodeXYZNodeXYZSpring>(nodeA, nodeB, 1000, 10, 0.09);
+        spring->SetStiff(true);
+        loads->Add(spring);
+    }
+
+    sys.Setup();
+    sys.Update();
+
+    int n = (int)sys.GetNumCoordsVelLevel();
+
+    loads->EnableParallelEvaluation(false);
+    loads->Update(0);
+    ChVectorDynamic<> R_seq = ChVectorDynamic<>::Zero(n);
+    loads->IntLoadResidual_F(0, R_seq, 0.5);
+
+    loads->EnableParallelEvaluation(true);
+    loads->Update(0);
+    ChVectorDynamic<> R_par = ChVectorDynamic<>::Zero(n);
+    loads->IntLoadResidual_F(0, R_par, 0.5);
+
+    ASSERT_GT(R_seq.norm(), 0);
+    for (int i = 0; i < n; i++)
+        ASSERT_NEAR(R_par(i), R_seq(i), 1e-10 * R_seq.norm());
+}
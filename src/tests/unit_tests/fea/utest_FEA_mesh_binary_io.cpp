@@ -0,0 +1,96 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the binary mesh file format of ChMeshFileLoader. A tetrahedral
+// mesh with two materials is saved to a binary file and loaded back, and the
+// node positions, element connectivity, and element materials are compared.
+//
+// =============================================================================
+
+#include <cstdio>
+
+#include "chrono/fea/ChElementTetraCorot_4.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/fea/ChMeshFileLoader.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+TEST(ChMeshFileLoader, binary_roundtrip) {
+    auto mat1 = chrono_types::make_shared<ChContinuumElastic>(1e6, 0.3, 1000);
+    auto mat2 = chrono_types::make_shared<ChContinuumElastic>(2e6, 0.4, 2000);
+
+    // Block of N x N x N cubes, each split into 5 tetrahedra, with a different material in the upper half
+    int N = 4;
+    double h = 0.1;
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    for (int i = 0; i <= N; i++)
+        for (int j = 0; j <= N; j++)
+            for (int k = 0; k <= N; k++) {
+                nodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(i * h, j * h, k * h)));
+                mesh->AddNode(nodes.back());
+            }
+    auto id = [N](int i, int j, int k) { return (i * (N + 1) + j) * (N + 1) + k; };
+    int tets[2][5][4] = {{{0, 1, 3, 4}, {1, 2, 3, 6}, {1, 4, 5, 6}, {3, 4, 6, 7}, {1, 3, 4, 6}},
+                         {{0, 1, 2, 5}, {0, 2, 3, 7}, {0, 4, 5, 7}, {2, 5, 6, 7}, {0, 2, 5, 7}}};
+    for (int i = 0; i < N; i++)
+        for (int j = 0; j < N; j++)
+            for (int k = 0; k < N; k++) {
+                int c[8] = {id(i, j, k),         id(i + 1, j, k),     id(i + 1, j + 1, k),     id(i, j + 1, k),
+                            id(i, j, k + 1),     id(i + 1, j, k + 1), id(i + 1, j + 1, k + 1), id(i, j + 1, k + 1)};
+                for (auto& t : tets[(i + j + k) % 2]) {
+                    auto element = chrono_types::make_shared<ChElementTetraCorot_4>();
+                    element->SetNodes(nodes[c[t[0]]], nodes[c[t[1]]], nodes[c[t[2]]], nodes[c[t[3]]]);
+                    element->SetMaterial(k < N / 2 ? mat1 : mat2);
+                    mesh->AddElement(element);
+                }
+            }
+
+    std::string filename = "utest_FEA_mesh_binary_io.bin";
+    auto materials = ChMeshFileLoader::ToBinaryFile(mesh, filename);
+    ASSERT_EQ(materials.size(), 2u);
+    ASSERT_EQ(materials[0], mat1);
+    ASSERT_EQ(materials[1], mat2);
+
+    // Load into a mesh with an existing node, with a translation
+    ChVector3d offset(1, 2, 3);
+    auto mesh_bin = chrono_types::make_shared<ChMesh>();
+    mesh_bin->AddNode(chrono_types::make_shared<ChNodeFEAxyz>());
+    ChMeshFileLoader::FromBinaryFile(mesh_bin, filename, materials, offset);
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(mesh_bin->GetNumNodes(), mesh->GetNumNodes() + 1);
+    ASSERT_EQ(mesh_bin->GetNumElements(), mesh->GetNumElements());
+
+    for (unsigned int i = 0; i < mesh->GetNumNodes(); i++) {
+        auto node_bin = std::dynamic_pointer_cast<ChNodeFEAxyz>(mesh_bin->GetNode(i + 1));
+        ASSERT_TRUE(node_bin);
+        ASSERT_EQ(node_bin->GetPos(), nodes[i]->GetPos() + offset);
+    }
+
+    for (unsigned int e = 0; e < mesh->GetNumElements(); e++) {
+        auto element = std::static_pointer_cast<ChElementTetraCorot_4>(mesh->GetElement(e));
+        auto element_bin = std::dynamic_pointer_cast<ChElementTetraCorot_4>(mesh_bin->GetElement(e));
+        ASSERT_TRUE(element_bin);
+        ASSERT_EQ(element_bin->GetMaterial(), element->GetMaterial());
+        for (unsigned int i = 0; i < 4; i++) {
+            auto node = std::static_pointer_cast<ChNodeFEAxyz>(element->GetNode(i));
+            auto node_bin = std::static_pointer_cast<ChNodeFEAxyz>(element_bin->GetNode(i));
+            ASSERT_EQ(node_bin->GetPos(), node->GetPos() + offset);
+        }
+    }
+}
@@ -0,0 +1,207 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit tests for the FEA mesh partitioner:
+// - consistency of the element, node, and ghost node partitions;
+// - balance and edge cut for a block of hexahedral elements;
+// - nodal internal forces accumulated per partition, with ghost node
+//   contributions added to the owning partitions, match the global ones.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChElementHexaCorot_8.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/fea/ChMeshPartitioner.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Create a block of Nx x Ny x Nz hexahedral elements, with the origin at (x0, 0, 0)
+static void CreateBlock(std::shared_ptr<ChMesh> mesh, int Nx, int Ny, int Nz, double x0) {
+    auto material = chrono_types::make_shared<ChContinuumElastic>(1e7, 0.3, 1000);
+    double h = 0.1;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    for (int i = 0; i <= Nx; i++)
+        for (int j = 0; j <= Ny; j++)
+            for (int k = 0; k <= Nz; k++) {
+                nodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(x0 + i * h, j * h, k * h)));
+                mesh->AddNode(nodes.back());
+            }
+    auto id = [Ny, Nz](int i, int j, int k) { return (i * (Ny + 1) + j) * (Nz + 1) + k; };
+    for (int i = 0; i < Nx; i++)
+        for (int j = 0; j < Ny; j++)
+            for (int k = 0; k < Nz; k++) {
+                auto element = chrono_types::make_shared<ChElementHexaCorot_8>();
+                element->SetNodes(nodes[id(i, j, k)], nodes[id(i + 1, j, k)], nodes[id(i + 1, j + 1, k)],
+                                  nodes[id(i, j + 1, k)], nodes[id(i, j, k + 1)], nodes[id(i + 1, j, k + 1)],
+                                  nodes[id(i + 1, j + 1, k + 1)], nodes[id(i, j + 1, k + 1)]);
+                element->SetMaterial(material);
+                mesh->AddElement(element);
+            }
+}
+
+// Check that the partitions are consistent with the mesh
+static void CheckPartitions(ChMesh& mesh, const ChMeshPartitioner& partitioner) {
+    unsigned int num_parts = partitioner.GetNumParts();
+    const auto& elem_part = partitioner.GetElementPartition();
+    const auto& node_part = partitioner.GetNodePartition();
+    ASSERT_EQ(elem_part.size(), mesh.GetNumElements());
+    ASSERT_EQ(node_part.size(), mesh.GetNumNodes());
+
+    std::unordered_map<ChNodeFEAbase*, unsigned int> node_index;
+    for (unsigned int i = 0; i < mesh.GetNumNodes(); i++)
+        node_index.emplace(mesh.GetNodes()[i].get(), i);
+
+    unsigned int num_elements = 0;
+    unsigned int num_nodes = 0;
+    for (unsigned int p = 0; p < num_parts; p++) {
+        const auto& part = partitioner.GetPartition(p);
+        num_elements += (unsigned int)part.elements.size();
+        num_nodes += (unsigned int)part.nodes.size();
+        for (auto ie : part.elements)
+            ASSERT_EQ(elem_part[ie], p);
+        for (auto n : part.nodes)
+            ASSERT_EQ(node_part[n], p);
+
+        // Ghost nodes are exactly the nodes of the partition elements owned by other partitions
+        std::vector<unsigned int> ghosts;
+        for (auto ie : part.elements) {
+            auto element = mesh.GetElement(ie);
+            for (unsigned int in = 0; in < element->GetNumNodes(); in++) {
+                auto n = node_index[element->GetNode(in).get()];
+                if (node_part[n] != p)
+                    ghosts.push_back(n);
+            }
+        }
+        std::sort(ghosts.begin(), ghosts.end());
+        ghosts.erase(std::unique(ghosts.begin(), ghosts.end()), ghosts.end());
+        ASSERT_EQ(ghosts, part.ghost_nodes);
+    }
+    ASSERT_EQ(num_elements, mesh.GetNumElements());
+    ASSERT_EQ(num_nodes, mesh.GetNumNodes());
+}
+
+TEST(ChMeshPartitioner, block) {
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    int Nx = 16, Ny = 4, Nz = 4;
+    CreateBlock(mesh, Nx, Ny, Nz, 0);
+
+    ChMeshPartitioner partitioner;
+    partitioner.Partition(*mesh, 4);
+    ASSERT_EQ(partitioner.GetNumParts(), 4u);
+    CheckPartitions(*mesh, partitioner);
+    ASSERT_LE(partitioner.GetImbalance(), 1.05);
+
+    // Edge cut of the partition in 4 slabs along the block length
+    unsigned int slab_cut = 0;
+    auto slab = [Ny, Nz](unsigned int ie) { return ie / (4 * Ny * Nz); };
+    for (unsigned int ie = 0; ie < mesh->GetNumElements(); ie++)
+        for (unsigned int je = ie + 1; je < mesh->GetNumElements(); je++) {
+            int di = std::abs((int)(ie / (Ny * Nz)) - (int)(je / (Ny * Nz)));
+            int dj = std::abs((int)((ie / Nz) % Ny) - (int)((je / Nz) % Ny));
+            int dk = std::abs((int)(ie % Nz) - (int)(je % Nz));
+            if (di <= 1 && dj <= 1 && dk <= 1 && slab(ie) != slab(je))
+                slab_cut++;
+        }
+    ASSERT_GT(partitioner.GetEdgeCut(), 0u);
+    ASSERT_LE(partitioner.GetEdgeCut(), 2 * slab_cut);
+
+    // A single partition has no cut and no ghost nodes
+    partitioner.Partition(*mesh, 1);
+    CheckPartitions(*mesh, partitioner);
+    ASSERT_EQ(partitioner.GetEdgeCut(), 0u);
+    ASSERT_TRUE(partitioner.GetPartition(0).ghost_nodes.empty());
+}
+
+TEST(ChMeshPartitioner, disconnected) {
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    CreateBlock(mesh, 3, 2, 2, 0);
+    CreateBlock(mesh, 3, 2, 2, 1);
+
+    // Each partition is one of the two blocks
+    ChMeshPartitioner partitioner;
+    partitioner.Partition(*mesh, 2);
+    CheckPartitions(*mesh, partitioner);
+    ASSERT_EQ(partitioner.GetEdgeCut(), 0u);
+    ASSERT_EQ(partitioner.GetPartition(0).elements.size(), 12u);
+    ASSERT_TRUE(partitioner.GetPartition(0).ghost_nodes.empty());
+    ASSERT_TRUE(partitioner.GetPartition(1).ghost_nodes.empty());
+
+    // More partitions than elements in each block
+    partitioner.Partition(*mesh, 5);
+    CheckPartitions(*mesh, partitioner);
+    ASSERT_LE(partitioner.GetImbalance(), 1.25);
+}
+
+TEST(ChMeshPartitioner, internal_forces) {
+    ChSystemSMC sys;
+    sys.SetGravitationalAcceleration(VNULL);
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+    CreateBlock(mesh, 6, 3, 3, 0);
+    for (auto& node : mesh->GetNodes()) {
+        auto n = std::static_pointer_cast<ChNodeFEAxyz>(node);
+        auto p = n->GetPos();
+        n->SetPos(p + ChVector3d(1e-3 * p.y() * p.z(), -2e-3 * p.x() * p.x(), 1e-3 * p.x() * p.y()));
+    }
+    sys.Setup();
+    sys.Update(false);
+
+    std::unordered_map<ChNodeFEAbase*, unsigned int> node_index;
+    for (unsigned int i = 0; i < mesh->GetNumNodes(); i++)
+        node_index.emplace(mesh->GetNodes()[i].get(), i);
+
+    // Accumulate the element internal forces at the nodes of the given elements
+    auto load_forces = [&](const std::vector<unsigned int>& elements, std::vector<ChVector3d>& forces) {
+        forces.assign(mesh->GetNumNodes(), VNULL);
+        ChVectorDynamic<> Fi(24);
+        for (auto ie : elements) {
+            auto element = mesh->GetElement(ie);
+            element->ComputeInternalForces(Fi);
+            for (unsigned int in = 0; in < 8; in++)
+                forces[node_index[element->GetNode(in).get()]] += ChVector3d(Fi.segment(3 * in, 3));
+        }
+    };
+
+    std::vector<unsigned int> all_elements(mesh->GetNumElements());
+    for (unsigned int ie = 0; ie < mesh->GetNumElements(); ie++)
+        all_elements[ie] = ie;
+    std::vector<ChVector3d> forces;
+    load_forces(all_elements, forces);
+
+    ChMeshPartitioner partitioner;
+    partitioner.Partition(*mesh, 3);
+
+    // Owned node forces from the partition elements, plus the contributions sent by other partitions for ghost nodes
+    std::vector<ChVector3d> forces_dist(mesh->GetNumNodes(), VNULL);
+    std::vector<ChVector3d> forces_part;
+    for (unsigned int p = 0; p < 3; p++) {
+        const auto& part = partitioner.GetPartition(p);
+        load_forces(part.elements, forces_part);
+        for (auto n : part.nodes)
+            forces_dist[n] += forces_part[n];
+        for (auto n : part.ghost_nodes)
+            forces_dist[n] += forces_part[n];
+    }
+
+    double max_force = 0;
+    for (unsigned int n = 0; n < mesh->GetNumNodes(); n++) {
+        max_force = std::max(max_force, forces[n].Length());
+        ASSERT_LE((forces_dist[n] - forces[n]).Length(), 1e-9 * (1 + forces[n].Length()));
+    }
+    ASSERT_GT(max_force, 1);
+}
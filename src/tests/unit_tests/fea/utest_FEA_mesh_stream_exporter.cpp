@@ -0,0 +1,196 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the streaming mesh exporter. A small mesh with tetrahedron and
+// spring elements is simulated and several frames are exported; the contents of
+// the binary data file are read back and compared with the mesh state.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "chrono/fea/ChElementSpring.h"
+#include "chrono/fea/ChElementTetraCorot_4.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/fea/ChMeshStreamExporter.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+struct MeshSetup {
+    ChSystemSMC sys;
+    std::shared_ptr<ChMesh> mesh;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    std::vector<std::shared_ptr<ChElementTetraCorot_4>> tets;
+
+    MeshSetup() {
+        sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+        mesh = chrono_types::make_shared<ChMesh>();
+        auto material = chrono_types::make_shared<ChContinuumElastic>(1e5, 0.3, 1000);
+
+        ChVector3d pos[6] = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {1, 1, 1}, {2, 0, 0}};
+        for (const auto& p : pos) {
+            nodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(p));
+            mesh->AddNode(nodes.back());
+        }
+        nodes[0]->SetFixed(true);
+        nodes[2]->SetFixed(true);
+
+        int conn[2][4] = {{0, 1, 2, 3}, {1, 2, 3, 4}};
+        for (auto& c : conn) {
+            auto tet = chrono_types::make_shared<ChElementTetraCorot_4>();
+            tet->SetNodes(nodes[c[0]], nodes[c[1]], nodes[c[2]], nodes[c[3]]);
+            tet->SetMaterial(material);
+            mesh->AddElement(tet);
+            tets.push_back(tet);
+        }
+
+        auto spring = chrono_types::make_shared<ChElementSpring>();
+        spring->SetNodes(nodes[1], nodes[5]);
+        spring->SetSpringCoefficient(1e3);
+        mesh->AddElement(spring);
+
+        sys.Add(mesh);
+    }
+};
+
+static std::vector<char> ReadFile(const std::string& filename) {
+    std::ifstream ifs(filename, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+}
+
+template <typename T>
+static T ReadValue(const std::vector<char>& data, size_t offset) {
+    T value;
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    return value;
+}
+
+TEST(ChMeshStreamExporter, double_precision) {
+    MeshSetup setup;
+    std::vector<ChVector3d> ref;
+    for (const auto& n : setup.nodes)
+        ref.push_back(n->GetPos());
+
+    int num_frames = 3;
+    std::vector<std::vector<double>> expected(num_frames);
+    {
+        ChMeshStreamExporter exporter(setup.mesh, "utest_FEA_stream_double", ChMeshStreamExporter::Precision::DOUBLE);
+        ASSERT_EQ(exporter.GetNumNodes(), 6);
+        ASSERT_EQ(exporter.GetNumCells(), 3);
+
+        for (int f = 0; f < num_frames; f++) {
+            for (int i = 0; i < 10; i++)
+                setup.sys.DoStepDynamics(1e-3);
+            exporter.WriteFrame(setup.sys.GetChTime());
+
+            // displacements, velocities, stresses
+            for (size_t i = 0; i < setup.nodes.size(); i++)
+                for (int k = 0; k < 3; k++)
+                    expected[f].push_back(setup.nodes[i]->GetPos()[k] - ref[i][k]);
+            for (size_t i = 0; i < setup.nodes.size(); i++)
+                for (int k = 0; k < 3; k++)
+                    expected[f].push_back(setup.nodes[i]->GetPosDt()[k]);
+            for (const auto& tet : setup.tets)
+                expected[f].push_back(tet->GetStress().GetEquivalentVonMises());
+            expected[f].push_back(0);
+        }
+        exporter.Flush();
+        ASSERT_EQ(exporter.GetNumFrames(), num_frames);
+    }
+
+    auto data = ReadFile("utest_FEA_stream_double.bin");
+
+    // Topology: 2 tetrahedra (1 + 4 entries each) and one polyline (1 + 1 + 2 entries)
+    size_t topology_size = 2 * 5 + 4;
+    ASSERT_EQ(ReadValue<int32_t>(data, 0), 6);
+    ASSERT_EQ(ReadValue<int32_t>(data, 4 * 4), 3);
+    ASSERT_EQ(ReadValue<int32_t>(data, 5 * 4), 6);
+    ASSERT_EQ(ReadValue<int32_t>(data, 10 * 4), 2);
+    ASSERT_EQ(ReadValue<int32_t>(data, 11 * 4), 2);
+    ASSERT_EQ(ReadValue<int32_t>(data, 12 * 4), 1);
+    ASSERT_EQ(ReadValue<int32_t>(data, 13 * 4), 5);
+
+    // Reference geometry
+    size_t offset = topology_size * sizeof(int32_t);
+    for (size_t i = 0; i < ref.size(); i++)
+        for (int k = 0; k < 3; k++)
+            ASSERT_EQ(ReadValue<double>(data, offset + (3 * i + k) * sizeof(double)), ref[i][k]);
+    offset += 3 * ref.size() * sizeof(double);
+
+    // Frames
+    size_t frame_size = expected[0].size();
+    ASSERT_EQ(data.size(), offset + num_frames * frame_size * sizeof(double));
+    for (int f = 0; f < num_frames; f++)
+        for (size_t i = 0; i < frame_size; i++)
+            ASSERT_EQ(ReadValue<double>(data, offset + (f * frame_size + i) * sizeof(double)), expected[f][i]);
+
+    // The index references all frames
+    std::ifstream xmf("utest_FEA_stream_double.xmf");
+    std::string xml((std::istreambuf_iterator<char>(xmf)), std::istreambuf_iterator<char>());
+    size_t count = 0;
+    for (size_t pos = xml.find("<Time "); pos != std::string::npos; pos = xml.find("<Time ", pos + 1))
+        count++;
+    ASSERT_EQ(count, num_frames);
+    ASSERT_EQ(xml.find("<Xdmf"), xml.rfind("<Xdmf"));
+    ASSERT_EQ(xml.rfind("</Xdmf>\n"), xml.size() - 8);
+    xmf.close();
+
+    std::remove("utest_FEA_stream_double.bin");
+    std::remove("utest_FEA_stream_double.xmf");
+}
+
+TEST(ChMeshStreamExporter, quantized) {
+    MeshSetup setup;
+    std::vector<ChVector3d> ref;
+    for (const auto& n : setup.nodes)
+        ref.push_back(n->GetPos());
+
+    std::vector<double> expected;
+    {
+        ChMeshStreamExporter exporter(setup.mesh, "utest_FEA_stream_quant", ChMeshStreamExporter::Precision::QUANTIZED);
+        for (int i = 0; i < 20; i++)
+            setup.sys.DoStepDynamics(1e-3);
+        exporter.WriteFrame(setup.sys.GetChTime());
+        for (size_t i = 0; i < setup.nodes.size(); i++)
+            for (int k = 0; k < 3; k++)
+                expected.push_back(setup.nodes[i]->GetPos()[k] - ref[i][k]);
+    }
+
+    // Displacements are the first array of the first frame
+    auto data = ReadFile("utest_FEA_stream_quant.bin");
+    size_t offset = (2 * 5 + 4) * sizeof(int32_t) + 3 * ref.size() * sizeof(double);
+    size_t num_values = 2 * expected.size() + 3;
+    ASSERT_EQ(data.size(), offset + num_values * sizeof(uint16_t));
+
+    // Quantized values span the full range of the array
+    double vmin = *std::min_element(expected.begin(), expected.end());
+    double vmax = *std::max_element(expected.begin(), expected.end());
+    double scale = (vmax - vmin) / 65535;
+    ASSERT_GT(scale, 0);
+    for (size_t i = 0; i < expected.size(); i++) {
+        double value = ReadValue<uint16_t>(data, offset + i * sizeof(uint16_t)) * scale + vmin;
+        ASSERT_NEAR(value, expected[i], 0.5 * scale + 1e-15);
+    }
+
+    std::remove("utest_FEA_stream_quant.bin");
+    std::remove("utest_FEA_stream_quant.xmf");
+}
@@ -0,0 +1,130 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for mixed precision factorization with iterative refinement in the
+// sparse direct linear solvers.
+//
+// A cantilever of hexahedral elements is simulated with double and mixed
+// precision LU factorizations; results must coincide. An ill-conditioned
+// system, for which refinement stagnates, must trigger the fallback to a
+// double precision factorization.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChElementHexaCorot_8.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Simulate a cantilever of hexahedral elements, clamped at x = 0, and return the position of its free end.
+static ChVector3d Simulate(std::shared_ptr<ChSolverSparseLU> solver) {
+    const int nx = 12;
+    const int ny = 3;
+    const int nz = 3;
+    const double h = 0.05;
+
+    ChSystemSMC sys;
+
+    auto material = chrono_types::make_shared<ChContinuumElastic>();
+    material->SetYoungModulus(1e7);
+    material->SetPoissonRatio(0.3);
+    material->SetDensity(1000);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    for (int i = 0; i <= nx; i++) {
+        for (int j = 0; j <= ny; j++) {
+            for (int k = 0; k <= nz; k++) {
+                auto node = chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(i * h, j * h, k * h));
+                node->SetFixed(i == 0);
+                mesh->AddNode(node);
+                nodes.push_back(node);
+            }
+        }
+    }
+    auto id = [&](int i, int j, int k) { return nodes[(i * (ny + 1) + j) * (nz + 1) + k]; };
+    for (int i = 0; i < nx; i++) {
+        for (int j = 0; j < ny; j++) {
+            for (int k = 0; k < nz; k++) {
+                auto element = chrono_types::make_shared<ChElementHexaCorot_8>();
+                element->SetNodes(id(i, j, k), id(i, j, k + 1), id(i + 1, j, k + 1), id(i + 1, j, k),
+                                  id(i, j + 1, k), id(i, j + 1, k + 1), id(i + 1, j + 1, k + 1), id(i + 1, j + 1, k));
+                element->SetMaterial(material);
+                mesh->AddElement(element);
+            }
+        }
+    }
+    sys.Add(mesh);
+
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    solver->LockSparsityPattern(true);
+    sys.SetSolver(solver);
+
+    for (int i = 0; i < 20; i++)
+        sys.DoStepDynamics(1e-3);
+
+    return id(nx, ny / 2, nz)->GetPos();
+}
+
+TEST(ChDirectSolverLS, mixed_precision) {
+    auto solver_double = chrono_types::make_shared<ChSolverSparseLU>();
+    auto pos_double = Simulate(solver_double);
+    ASSERT_FALSE(solver_double->IsSinglePrecisionFactorization());
+    ASSERT_EQ(solver_double->GetNumRefinementSteps(), 0);
+
+    auto solver_mixed = chrono_types::make_shared<ChSolverSparseLU>();
+    solver_mixed->UseMixedPrecision(true);
+    auto pos_mixed = Simulate(solver_mixed);
+    ASSERT_TRUE(solver_mixed->IsSinglePrecisionFactorization());
+    ASSERT_EQ(solver_mixed->GetNumPrecisionFallbacks(), 0);
+    ASSERT_GT(solver_mixed->GetNumRefinementSteps(), 0);
+
+    ASSERT_LT((pos_double - ChVector3d(0.6, 0.05, 0.15)).Length(), 0.1);
+    ASSERT_LT((pos_mixed - pos_double).Length(), 1e-10);
+}
+
+TEST(ChDirectSolverLS, mixed_precision_fallback) {
+    // Hilbert matrix (condition number ~1e13), for which single precision refinement cannot converge
+    const int n = 10;
+    ChSolverSparseLU solver;
+    solver.UseMixedPrecision(true);
+    solver.A().resize(n, n);
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            triplets.push_back({i, j, 1.0 / (i + j + 1)});
+    solver.A().setFromTriplets(triplets.begin(), triplets.end());
+
+    ChVectorDynamic<> x_ref = ChVectorDynamic<>::Ones(n);
+    solver.b() = solver.A() * x_ref;
+
+    ASSERT_TRUE(solver.SetupCurrent());
+    ASSERT_TRUE(solver.IsSinglePrecisionFactorization());
+    ASSERT_TRUE(solver.SolveCurrent());
+    ASSERT_FALSE(solver.IsSinglePrecisionFactorization());
+    ASSERT_EQ(solver.GetNumPrecisionFallbacks(), 1);
+
+    // Double precision accuracy with the fallback factorization
+    ChVectorDynamic<> r = solver.b() - solver.A() * solver.x();
+    ASSERT_LT(r.lpNorm<Eigen::Infinity>(), 1e-12);
+
+    // Double precision is used for subsequent factorizations
+    ASSERT_TRUE(solver.SetupCurrent());
+    ASSERT_FALSE(solver.IsSinglePrecisionFactorization());
+}
@@ -0,0 +1,172 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for the parallel in-place assembly of the system matrix.
+//
+// ANCF cables hinged to the ground and to rigid bodies are simulated with a
+// locked sparsity pattern. The matrix assembled in place at the cached value
+// positions must match the one assembled serially, as must the simulation
+// results. The cached value positions must also be invalidated when a
+// constraint connects different variables with the same number of entries.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/fea/ChBuilderBeam.h"
+#include "chrono/fea/ChLinkNodeFrame.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChVariablesGeneric.h"
+#include "chrono/solver/ChConstraintTwoGeneric.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+static std::shared_ptr<ChBody> CreateModel(ChSystem& sys, bool parallel) {
+    sys.SetNumThreads(4);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto section = chrono_types::make_shared<ChBeamSectionCable>();
+    section->SetDiameter(0.015);
+    section->SetYoungModulus(0.01e9);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    std::shared_ptr<ChBody> box;
+    for (int i = 0; i < 4; i++) {
+        ChBuilderCableANCF builder;
+        builder.BuildBeam(mesh, section, 10, ChVector3d(0, 0, 0.1 * i), ChVector3d(0.5, 0, 0.1 * i));
+
+        auto hinge = chrono_types::make_shared<ChLinkNodeFrame>();
+        hinge->Initialize(builder.GetLastBeamNodes().front(), ground);
+        sys.Add(hinge);
+
+        box = chrono_types::make_shared<ChBodyEasyBox>(0.05, 0.05, 0.05, 1000);
+        box->SetPos(builder.GetLastBeamNodes().back()->GetPos());
+        sys.AddBody(box);
+
+        auto joint = chrono_types::make_shared<ChLinkNodeFrame>();
+        joint->Initialize(builder.GetLastBeamNodes().back(), box);
+        sys.Add(joint);
+    }
+    sys.Add(mesh);
+
+    auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+    solver->LockSparsityPattern(true);
+    solver->UseParallelAssembly(parallel);
+    sys.SetSolver(solver);
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+    return box;
+}
+
+TEST(ChSystemDescriptor, parallel_assembly) {
+    ChSystemSMC sys;
+    CreateModel(sys, false);
+    sys.DoStepDynamics(1e-3);
+
+    auto& descriptor = *sys.GetSystemDescriptor();
+    ASSERT_EQ(descriptor.GetNumThreads(), 4);
+
+    // Serial assembly into a compressed matrix
+    ChSparseMatrix Z;
+    descriptor.BuildSystemMatrix(&Z, nullptr);
+    Z.makeCompressed();
+    ChSparseMatrix Z_serial = Z;
+
+    // In-place assembly in the same pattern
+    ASSERT_TRUE(descriptor.BuildSystemMatrixInPlace(Z, true));
+    ASSERT_EQ(Z.nonZeros(), Z_serial.nonZeros());
+    ASSERT_LT((Z - Z_serial).norm(), 1e-10 * Z_serial.norm());
+
+    // Again, with the cached value positions
+    Z.setZeroValues();
+    ASSERT_TRUE(descriptor.BuildSystemMatrixInPlace(Z, false));
+    ASSERT_LT((Z - Z_serial).norm(), 1e-10 * Z_serial.norm());
+
+    // A pattern missing entries of the problem is rejected
+    ChSparseMatrix Z_diag(Z.rows(), Z.cols());
+    for (int i = 0; i < Z.rows(); i++)
+        Z_diag.insert(i, i) = 1;
+    Z_diag.makeCompressed();
+    ASSERT_FALSE(descriptor.BuildSystemMatrixInPlace(Z_diag, true));
+}
+
+// A constraint moved to a different pair of variables (with the same number of entries, so that the topology revision
+// is unchanged) must not be written at the cached value positions
+TEST(ChSystemDescriptor, parallel_assembly_connectivity) {
+    ChVariablesGeneric v0(3), v1(3), v2(3);
+    ChConstraintTwoGeneric constr(&v0, &v1);
+    constr.Get_Cq_a() << 1, 2, 3;
+    constr.Get_Cq_b() << -1, -2, -3;
+
+    ChSystemDescriptor descriptor;
+    descriptor.SetNumThreads(4);
+    descriptor.BeginInsertion();
+    descriptor.InsertVariables(&v0);
+    descriptor.InsertVariables(&v1);
+    descriptor.InsertVariables(&v2);
+    descriptor.InsertConstraint(&constr);
+    descriptor.EndInsertion();
+    unsigned int revision = descriptor.GetTopologyRevision();
+
+    // Dense pattern, containing the entries of the constraint for any pair of variables
+    int n = 10;
+    ChSparseMatrix Z(n, n);
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            Z.insert(i, j) = 0;
+    Z.makeCompressed();
+    ASSERT_TRUE(descriptor.BuildSystemMatrixInPlace(Z, true));
+
+    constr.SetVariables(&v0, &v2);
+    constr.Get_Cq_a() << 1, 2, 3;
+    constr.Get_Cq_b() << -1, -2, -3;
+    descriptor.BeginInsertion();
+    descriptor.InsertVariables(&v0);
+    descriptor.InsertVariables(&v1);
+    descriptor.InsertVariables(&v2);
+    descriptor.InsertConstraint(&constr);
+    descriptor.EndInsertion();
+    ASSERT_EQ(descriptor.GetTopologyRevision(), revision);
+
+    ChSparseMatrix Z_serial;
+    descriptor.BuildSystemMatrix(&Z_serial, nullptr);
+
+    // The change of connectivity is detected with the cached positions, and the map is then recomputed
+    ASSERT_FALSE(descriptor.BuildSystemMatrixInPlace(Z, false));
+    ASSERT_TRUE(descriptor.BuildSystemMatrixInPlace(Z, false));
+    ASSERT_EQ((Z - Z_serial).norm(), 0);
+    ASSERT_EQ(Z.coeff(9, 6), -1);
+    ASSERT_EQ(Z.coeff(9, 3), 0);
+}
+
+TEST(ChDirectSolverLS, parallel_assembly) {
+    ChSystemSMC sys_serial;
+    ChSystemSMC sys_parallel;
+    auto box_serial = CreateModel(sys_serial, false);
+    auto box_parallel = CreateModel(sys_parallel, true);
+
+    for (int i = 0; i < 200; i++) {
+        sys_serial.DoStepDynamics(1e-3);
+        sys_parallel.DoStepDynamics(1e-3);
+    }
+
+    ASSERT_GT((box_serial->GetPos() - ChVector3d(0.5, 0, 0.3)).Length(), 1e-3);
+    ASSERT_LT((box_parallel->GetPos() - box_serial->GetPos()).Length(), 1e-9);
+}
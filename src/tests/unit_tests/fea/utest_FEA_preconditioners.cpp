@@ -0,0 +1,199 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for the preconditioners of the iterative linear solvers.
+//
+// The algebraic multigrid V-cycle must converge as a stationary iteration on a
+// Poisson problem. A cantilever of hexahedral elements, with a rigid body
+// attached to its free end, is simulated with GMRES and MINRES using each of
+// the preconditioners; results must match those obtained with a direct solver,
+// with fewer iterations than with diagonal preconditioning.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/fea/ChElementHexaCorot_8.h"
+#include "chrono/fea/ChLinkNodeFrame.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+using Preconditioner = ChIterativeSolverLS::Preconditioner;
+
+TEST(ChAlgebraicMultigrid, poisson) {
+    // 5-point Laplacian on an n x n grid
+    int n = 40;
+    int N = n * n;
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            int k = i * n + j;
+            triplets.push_back({k, k, 4.0});
+            if (i > 0)
+                triplets.push_back({k, k - n, -1.0});
+            if (i < n - 1)
+                triplets.push_back({k, k + n, -1.0});
+            if (j > 0)
+                triplets.push_back({k, k - 1, -1.0});
+            if (j < n - 1)
+                triplets.push_back({k, k + 1, -1.0});
+        }
+    }
+    ChSparseMatrix A(N, N);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+
+    ChAlgebraicMultigrid amg;
+    amg.SetCoarseSize(50);
+    ASSERT_FALSE(amg.Setup(A, true));
+    ASSERT_GT(amg.GetNumLevels(), 2);
+    ASSERT_LT(amg.GetLevelSize(1), N / 4);
+    ASSERT_LT(amg.GetOperatorComplexity(), 2.0);
+
+    // Stationary iteration x <- x + M*(b - A*x), with M the V-cycle
+    ChVectorDynamic<> b = ChVectorDynamic<>::Ones(N);
+    ChVectorDynamic<> x = ChVectorDynamic<>::Zero(N);
+    ChVectorDynamic<> dx(N);
+    double res0 = b.norm();
+    for (int it = 0; it < 20; it++) {
+        amg.Apply(b - A * x, dx);
+        x += dx;
+    }
+    ASSERT_LT((b - A * x).norm(), 1e-3 * res0);
+
+    // The V-cycle is symmetric
+    ChVectorDynamic<> u = ChVectorDynamic<>::Random(N);
+    ChVectorDynamic<> v = ChVectorDynamic<>::Random(N);
+    ChVectorDynamic<> Mu(N);
+    ChVectorDynamic<> Mv(N);
+    amg.Apply(u, Mu);
+    amg.Apply(v, Mv);
+    ASSERT_NEAR(v.dot(Mu), u.dot(Mv), 1e-10 * std::abs(u.dot(Mv)));
+
+    // Setup with the same matrix pattern reuses the aggregates
+    ASSERT_TRUE(amg.Setup(2.0 * A, true));
+}
+
+// Create a cantilever of hexahedral elements, clamped at x = 0, with a rigid body attached to its free end.
+// Return the node at the free end.
+static std::shared_ptr<ChNodeFEAxyz> CreateCantilever(ChSystem& sys) {
+    const int nx = 16;
+    const int ny = 4;
+    const int nz = 4;
+    const double h = 0.05;
+
+    auto material = chrono_types::make_shared<ChContinuumElastic>();
+    material->SetYoungModulus(1e7);
+    material->SetPoissonRatio(0.3);
+    material->SetDensity(1000);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    for (int i = 0; i <= nx; i++) {
+        for (int j = 0; j <= ny; j++) {
+            for (int k = 0; k <= nz; k++) {
+                auto node = chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(i * h, j * h, k * h));
+                node->SetFixed(i == 0);
+                mesh->AddNode(node);
+                nodes.push_back(node);
+            }
+        }
+    }
+    auto id = [&](int i, int j, int k) { return nodes[(i * (ny + 1) + j) * (nz + 1) + k]; };
+    for (int i = 0; i < nx; i++) {
+        for (int j = 0; j < ny; j++) {
+            for (int k = 0; k < nz; k++) {
+                auto element = chrono_types::make_shared<ChElementHexaCorot_8>();
+                element->SetNodes(id(i, j, k), id(i, j, k + 1), id(i + 1, j, k + 1), id(i + 1, j, k),
+                                  id(i, j + 1, k), id(i, j + 1, k + 1), id(i + 1, j + 1, k + 1), id(i + 1, j + 1, k));
+                element->SetMaterial(material);
+                mesh->AddElement(element);
+            }
+        }
+    }
+    sys.Add(mesh);
+
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(0.05, 0.05, 0.05, 5000);
+    box->SetPos(id(nx, ny, nz)->GetPos());
+    sys.AddBody(box);
+    for (int j = 0; j <= ny; j += ny) {
+        auto link = chrono_types::make_shared<ChLinkNodeFrame>();
+        link->Initialize(id(nx, j, nz), box);
+        sys.Add(link);
+    }
+
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+    return id(nx, ny / 2, nz);
+}
+
+// Simulate the cantilever with an iterative solver and the specified preconditioner.
+// Return the position of the free end and the maximum number of solver iterations per step.
+template <typename Solver>
+static ChVector3d Simulate(Preconditioner type, int& iterations) {
+    ChSystemSMC sys;
+    auto tip = CreateCantilever(sys);
+    auto solver = chrono_types::make_shared<Solver>();
+    solver->SetMaxIterations(5000);
+    solver->SetTolerance(1e-12);
+    solver->SetPreconditioner(type);
+    solver->GetAlgebraicMultigrid().SetCoarseSize(100);
+    sys.SetSolver(solver);
+
+    iterations = 0;
+    for (int i = 0; i < 10; i++) {
+        sys.DoStepDynamics(1e-3);
+        iterations = std::max(iterations, solver->GetIterations());
+    }
+    return tip->GetPos();
+}
+
+TEST(ChIterativeSolverLS, preconditioners) {
+    ChVector3d tip_ref;
+    {
+        ChSystemSMC sys;
+        auto tip = CreateCantilever(sys);
+        sys.SetSolver(chrono_types::make_shared<ChSolverSparseLU>());
+        for (int i = 0; i < 10; i++)
+            sys.DoStepDynamics(1e-3);
+        tip_ref = tip->GetPos();
+    }
+    ASSERT_LT(tip_ref.y(), 0.1 - 1e-6);
+
+    int iter_diag;
+    auto pos_gmres = Simulate<ChSolverGMRES>(Preconditioner::DIAGONAL, iter_diag);
+    ASSERT_LT((pos_gmres - tip_ref).Length(), 1e-8);
+
+    for (auto type : {Preconditioner::INCOMPLETE_LU, Preconditioner::INCOMPLETE_CHOLESKY, Preconditioner::AMG}) {
+        int iter;
+        auto pos = Simulate<ChSolverGMRES>(type, iter);
+        ASSERT_LT((pos - tip_ref).Length(), 1e-8);
+        ASSERT_LT(iter, iter_diag);
+    }
+
+    // Symmetric preconditioners with MINRES
+    int iter_minres_diag;
+    Simulate<ChSolverMINRES>(Preconditioner::DIAGONAL, iter_minres_diag);
+    for (auto type : {Preconditioner::INCOMPLETE_CHOLESKY, Preconditioner::AMG}) {
+        int iter;
+        auto pos = Simulate<ChSolverMINRES>(type, iter);
+        ASSERT_LT((pos - tip_ref).Length(), 1e-8);
+        ASSERT_LT(iter, iter_minres_diag);
+    }
+}
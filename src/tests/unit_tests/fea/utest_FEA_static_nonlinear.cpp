@@ -0,0 +1,127 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the nonlinear static analyses of a cantilever with large
+// deflection: full Newton, factorization reuse with modified Newton and Broyden
+// updates, line search, and arc-length continuation of the tip load.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChStaticAnalysis.h"
+#include "chrono/fea/ChBuilderBeam.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+static const ChVector3d tip_load(0, -8, 0);
+
+// Cantilever of corotational Euler beams, returning the tip node
+std::shared_ptr<ChNodeFEAxyzrot> CreateCantilever(ChSystem& sys) {
+    sys.SetGravitationalAcceleration(VNULL);
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseLU>());
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    mesh->SetAutomaticGravity(false);
+    sys.Add(mesh);
+
+    auto section = chrono_types::make_shared<ChBeamSectionEulerSimple>();
+    section->SetAsRectangularSection(0.02, 0.01);
+    section->SetYoungModulus(2e9);
+    section->SetShearModulus(0.8e9);
+    section->SetDensity(1000);
+
+    ChBuilderBeamEuler builder;
+    builder.BuildBeam(mesh, section, 10, ChVector3d(0, 0, 0), ChVector3d(1, 0, 0), ChVector3d(0, 1, 0));
+    builder.GetLastBeamNodes().front()->SetFixed(true);
+
+    return builder.GetLastBeamNodes().back();
+}
+
+ChVector3d SolveNonLinear(ChStaticAnalysis::JacobianUpdate update, bool line_search, int& num_factorizations) {
+    ChSystemSMC sys;
+    auto tip = CreateCantilever(sys);
+    tip->SetForce(tip_load);
+
+    ChStaticNonLinearAnalysis analysis;
+    analysis.SetMaxIterations(100);
+    analysis.SetIncrementalSteps(0);
+    analysis.SetCorrectionTolerance(1e-8, 1e-10);
+    analysis.SetJacobianUpdate(update);
+    analysis.SetLineSearch(line_search);
+    sys.DoStaticAnalysis(analysis);
+
+    num_factorizations = analysis.GetNumFactorizations();
+    return tip->GetPos();
+}
+
+TEST(ChStaticAnalysis, factorization_reuse) {
+    int num_ref;
+    auto pos_ref = SolveNonLinear(ChStaticAnalysis::JacobianUpdate::EVERY_ITERATION, false, num_ref);
+    ASSERT_LT(pos_ref.y(), -0.1);
+
+    int num_modified;
+    auto pos_modified = SolveNonLinear(ChStaticAnalysis::JacobianUpdate::MODIFIED_NEWTON, true, num_modified);
+    ASSERT_NEAR((pos_modified - pos_ref).Length(), 0, 1e-6);
+    ASSERT_LT(num_modified, num_ref);
+
+    int num_broyden;
+    auto pos_broyden = SolveNonLinear(ChStaticAnalysis::JacobianUpdate::BROYDEN, true, num_broyden);
+    ASSERT_NEAR((pos_broyden - pos_ref).Length(), 0, 1e-6);
+    ASSERT_LT(num_broyden, num_ref);
+}
+
+class TipLoad : public ChStaticNonLinearIncremental::LoadIncrementCallback {
+  public:
+    TipLoad(std::shared_ptr<ChNodeFEAxyzrot> tip) : m_tip(tip) {}
+    virtual void OnLoadScaling(const double load_scaling,
+                               const int iteration_n,
+                               ChStaticNonLinearIncremental* analysis) override {
+        m_tip->SetForce(tip_load * load_scaling);
+    }
+
+  private:
+    std::shared_ptr<ChNodeFEAxyzrot> m_tip;
+};
+
+ChVector3d SolveIncremental(bool arc_length, double& load_scaling) {
+    ChSystemSMC sys;
+    auto tip = CreateCantilever(sys);
+
+    ChStaticNonLinearIncremental analysis;
+    analysis.SetLoadIncrementCallback(chrono_types::make_shared<TipLoad>(tip));
+    analysis.SetIncrementalSteps(10);
+    analysis.SetMaxIterationsNewton(20);
+    analysis.SetCorrectionTolerance(1e-8, 1e-10);
+    analysis.SetArcLength(arc_length);
+    sys.DoStaticAnalysis(analysis);
+
+    load_scaling = analysis.GetLoadScaling();
+    return tip->GetPos();
+}
+
+TEST(ChStaticAnalysis, arc_length) {
+    double scaling_ref;
+    auto pos_ref = SolveIncremental(false, scaling_ref);
+    ASSERT_DOUBLE_EQ(scaling_ref, 1.0);
+
+    double scaling_arc;
+    auto pos_arc = SolveIncremental(true, scaling_arc);
+    ASSERT_DOUBLE_EQ(scaling_arc, 1.0);
+    ASSERT_NEAR((pos_arc - pos_ref).Length(), 0, 1e-6);
+}
@@ -0,0 +1,215 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for the in-tree supernodal sparse direct solver.
+//
+// Sparse systems (symmetric positive definite, unsymmetric, and saddle-point)
+// are solved with both orderings and both factorization types and checked
+// against known solutions. A cantilever of hexahedral elements is simulated
+// with the supernodal and the Eigen SparseLU solvers; results must coincide.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChElementHexaCorot_8.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/solver/ChSolverSparseSupernodal.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Load the 7-point Laplacian of an n x n x n grid, shifted to be positive definite.
+// If 'unsymmetric' is true, a convection term makes the matrix unsymmetric (with symmetric pattern).
+static void LoadGridMatrix(int n, bool unsymmetric, ChSparseMatrix& A) {
+    auto id = [n](int i, int j, int k) { return (i * n + j) * n + k; };
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            for (int k = 0; k < n; k++) {
+                int row = id(i, j, k);
+                triplets.push_back({row, row, 6.1});
+                int nbr[6][3] = {{i - 1, j, k}, {i + 1, j, k}, {i, j - 1, k},
+                                 {i, j + 1, k}, {i, j, k - 1}, {i, j, k + 1}};
+                for (int m = 0; m < 6; m++) {
+                    int a = nbr[m][0];
+                    int b = nbr[m][1];
+                    int c = nbr[m][2];
+                    if (a < 0 || a >= n || b < 0 || b >= n || c < 0 || c >= n)
+                        continue;
+                    double conv = unsymmetric ? 0.4 * (m % 2 == 0 ? 1 : -1) : 0;
+                    triplets.push_back({row, id(a, b, c), -1.0 + conv});
+                }
+            }
+        }
+    }
+    A.resize(n * n * n, n * n * n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+}
+
+// Solve with the specified settings and return the error with respect to the known solution.
+static double SolveSystem(ChSolverSparseSupernodal& solver, const ChSparseMatrix& A) {
+    ChVectorDynamic<> x_ref(A.rows());
+    for (int i = 0; i < A.rows(); i++)
+        x_ref(i) = std::sin(0.1 * i) + 1;
+    solver.A() = A;
+    solver.b() = A * x_ref;
+    EXPECT_TRUE(solver.SetupCurrent());
+    EXPECT_TRUE(solver.SolveCurrent());
+    return (solver.x() - x_ref).lpNorm<Eigen::Infinity>() / x_ref.lpNorm<Eigen::Infinity>();
+}
+
+TEST(ChSolverSparseSupernodal, orderings) {
+    ChSparseMatrix A;
+    LoadGridMatrix(12, false, A);
+
+    for (auto ordering : {ChSolverSparseSupernodal::Ordering::NESTED_DISSECTION,
+                          ChSolverSparseSupernodal::Ordering::AMD, ChSolverSparseSupernodal::Ordering::AUTO}) {
+        for (auto symmetry : {ChDirectSolverLS::MatrixSymmetryType::GENERAL,
+                              ChDirectSolverLS::MatrixSymmetryType::SYMMETRIC_POSDEF}) {
+            ChSolverSparseSupernodal solver(4);
+            solver.SetOrdering(ordering);
+            solver.SetMatrixSymmetryType(symmetry);
+            ASSERT_LT(SolveSystem(solver, A), 1e-12);
+            ASSERT_EQ(solver.IsSymmetricFactorization(),
+                      symmetry == ChDirectSolverLS::MatrixSymmetryType::SYMMETRIC_POSDEF);
+            ASSERT_EQ(solver.GetNumPerturbedPivots(), 0);
+            ASSERT_LT(solver.GetNumSupernodes(), (int)A.rows());
+        }
+    }
+
+    // Nested dissection of a 3D grid requires less fill than the dense factors of its band
+    ChSolverSparseSupernodal solver(4);
+    solver.SetOrdering(ChSolverSparseSupernodal::Ordering::NESTED_DISSECTION);
+    solver.SetMatrixSymmetryType(ChDirectSolverLS::MatrixSymmetryType::SYMMETRIC_POSDEF);
+    SolveSystem(solver, A);
+    ASSERT_LT(solver.GetFactorNonZeros(), (size_t)(A.rows() * 144));
+}
+
+TEST(ChSolverSparseSupernodal, unsymmetric) {
+    ChSparseMatrix A;
+    LoadGridMatrix(10, true, A);
+
+    ChSolverSparseSupernodal solver(4);
+    ASSERT_LT(SolveSystem(solver, A), 1e-12);
+    ASSERT_FALSE(solver.IsSymmetricFactorization());
+
+    // Reuse of the symbolic analysis with new matrix values
+    A *= 2;
+    solver.A() = A;
+    ChVectorDynamic<> x_ref = ChVectorDynamic<>::Ones(A.rows());
+    solver.b() = A * x_ref;
+    ASSERT_TRUE(solver.SetupCurrent());
+    ASSERT_TRUE(solver.SolveCurrent());
+    ASSERT_LT((solver.x() - x_ref).lpNorm<Eigen::Infinity>(), 1e-12);
+}
+
+TEST(ChSolverSparseSupernodal, saddle_point) {
+    // KKT matrix [M C'; C 0] of a chain of point masses connected by distance constraints
+    const int num_bodies = 200;
+    const int n = 3 * num_bodies + (num_bodies - 1);
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < 3 * num_bodies; i++)
+        triplets.push_back({i, i, 1.0 + 0.01 * (i % 7)});
+    for (int c = 0; c < num_bodies - 1; c++) {
+        int row = 3 * num_bodies + c;
+        for (int d = 0; d < 3; d++) {
+            double g = 0.5 + 0.1 * d;
+            triplets.push_back({row, 3 * c + d, g});
+            triplets.push_back({3 * c + d, row, g});
+            triplets.push_back({row, 3 * (c + 1) + d, -g});
+            triplets.push_back({3 * (c + 1) + d, row, -g});
+        }
+    }
+    ChSparseMatrix A(n, n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+
+    for (auto ordering : {ChSolverSparseSupernodal::Ordering::NESTED_DISSECTION,
+                          ChSolverSparseSupernodal::Ordering::AMD}) {
+        ChSolverSparseSupernodal solver(2);
+        solver.SetOrdering(ordering);
+        solver.SetMatrixSymmetryType(ChDirectSolverLS::MatrixSymmetryType::SYMMETRIC_INDEF);
+        ASSERT_LT(SolveSystem(solver, A), 1e-10);
+        ASSERT_FALSE(solver.IsSymmetricFactorization());
+    }
+}
+
+// Simulate a cantilever of hexahedral elements, clamped at x = 0, and return the position of its free end.
+static ChVector3d Simulate(std::shared_ptr<ChDirectSolverLS> solver) {
+    const int nx = 12;
+    const int ny = 3;
+    const int nz = 3;
+    const double h = 0.05;
+
+    ChSystemSMC sys;
+
+    auto material = chrono_types::make_shared<ChContinuumElastic>();
+    material->SetYoungModulus(1e7);
+    material->SetPoissonRatio(0.3);
+    material->SetDensity(1000);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    for (int i = 0; i <= nx; i++) {
+        for (int j = 0; j <= ny; j++) {
+            for (int k = 0; k <= nz; k++) {
+                auto node = chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(i * h, j * h, k * h));
+                node->SetFixed(i == 0);
+                mesh->AddNode(node);
+                nodes.push_back(node);
+            }
+        }
+    }
+    auto id = [&](int i, int j, int k) { return nodes[(i * (ny + 1) + j) * (nz + 1) + k]; };
+    for (int i = 0; i < nx; i++) {
+        for (int j = 0; j < ny; j++) {
+            for (int k = 0; k < nz; k++) {
+                auto element = chrono_types::make_shared<ChElementHexaCorot_8>();
+                element->SetNodes(id(i, j, k), id(i, j, k + 1), id(i + 1, j, k + 1), id(i + 1, j, k),
+                                  id(i, j + 1, k), id(i, j + 1, k + 1), id(i + 1, j + 1, k + 1), id(i + 1, j + 1, k));
+                element->SetMaterial(material);
+                mesh->AddElement(element);
+            }
+        }
+    }
+    sys.Add(mesh);
+
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    solver->LockSparsityPattern(true);
+    solver->ReuseSymbolicAnalysis(true);
+    sys.SetSolver(solver);
+
+    for (int i = 0; i < 20; i++)
+        sys.DoStepDynamics(1e-3);
+
+    return id(nx, ny / 2, nz)->GetPos();
+}
+
+TEST(ChSolverSparseSupernodal, cantilever) {
+    auto solver_lu = chrono_types::make_shared<ChSolverSparseLU>();
+    auto pos_lu = Simulate(solver_lu);
+
+    auto solver_sn = chrono_types::make_shared<ChSolverSparseSupernodal>(4);
+    auto pos_sn = Simulate(solver_sn);
+    ASSERT_EQ(solver_sn->GetNumAnalysisCalls(), 1);
+
+    auto solver_ldlt = chrono_types::make_shared<ChSolverSparseSupernodal>(4);
+    solver_ldlt->SetMatrixSymmetryType(ChDirectSolverLS::MatrixSymmetryType::SYMMETRIC_POSDEF);
+    auto pos_ldlt = Simulate(solver_ldlt);
+    ASSERT_TRUE(solver_ldlt->IsSymmetricFactorization());
+
+    ASSERT_LT((pos_sn - pos_lu).Length(), 1e-10);
+    ASSERT_LT((pos_ldlt - pos_lu).Length(), 1e-10);
+}
@@ -0,0 +1,116 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+// Validation test: settling of a column of granular material (CRM) with the
+// force calculation distributed over two devices (see ChSystemFsi::SetDevices),
+// compared to a single device. The test is skipped if fewer than two CUDA
+// devices are available.
+// =============================================================================
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#include <cuda_runtime.h>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono_fsi/ChSystemFsi.h"
+
+using namespace chrono;
+using namespace chrono::fsi;
+
+// Settle a column of granular material elongated along Z (the slab direction), with the force calculation
+// distributed over the specified devices. Return the final marker positions.
+static std::vector<ChVector3d> RunSettling(const std::vector<int>& devices) {
+    double bxDim = 0.1;
+    double byDim = 0.1;
+    double bzDim = 0.4;
+    double spacing = 0.01;
+
+    ChSystemSMC sysMBS;
+    ChSystemFsi sysFSI(&sysMBS);
+    sysFSI.SetVerbose(false);
+
+    ChVector3d gravity(0, 0, -9.81);
+    sysMBS.SetGravitationalAcceleration(gravity);
+    sysFSI.SetGravitationalAcceleration(gravity);
+
+    ChSystemFsi::ElasticMaterialProperties mat_props;
+    mat_props.Young_modulus = 1e6;
+    mat_props.Poisson_ratio = 0.3;
+    mat_props.stress = 0;
+    mat_props.viscosity_alpha = 0.5;
+    mat_props.viscosity_beta = 0;
+    mat_props.mu_I0 = 0.04;
+    mat_props.mu_fric_s = 0.8;
+    mat_props.mu_fric_2 = 0.8;
+    mat_props.average_diam = 0.005;
+    mat_props.friction_angle = CH_PI / 10;
+    mat_props.dilation_angle = CH_PI / 10;
+    mat_props.cohesion_coeff = 0;
+    sysFSI.SetElasticSPH(mat_props);
+
+    sysFSI.SetSPHMethod(FluidDynamics::WCSPH);
+    sysFSI.SetInitialSpacing(spacing);
+    sysFSI.SetKernelLength(spacing);
+    sysFSI.SetDensity(1700);
+    sysFSI.SetStepSize(2.5e-4);
+    sysFSI.SetContainerDim(ChVector3d(bxDim, byDim, bzDim));
+    sysFSI.SetDiscreType(false, false);
+    sysFSI.SetWallBC(BceVersion::ADAMI);
+    sysFSI.SetRigidBodyBC(BceVersion::ADAMI);
+    sysFSI.SetOutputLength(0);
+
+    ChVector3d cMin(-bxDim, -byDim, -bzDim);
+    ChVector3d cMax(bxDim, byDim, 2 * bzDim);
+    sysFSI.SetBoundaries(cMin, cMax);
+
+    sysFSI.AddBoxSPH(ChVector3d(0, 0, bzDim / 2),
+                     ChVector3d(bxDim / 2 - spacing, byDim / 2 - spacing, bzDim / 2 - spacing));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sysMBS.AddBody(ground);
+    sysFSI.AddBoxContainerBCE(ground, ChFrame<>(ChVector3d(0, 0, bzDim / 2), QUNIT), ChVector3d(bxDim, byDim, bzDim),
+                              ChVector3i(2, 2, -1));
+
+    sysFSI.SetDevices(devices);
+    sysFSI.Initialize();
+
+    for (int step = 0; step < 200; step++)
+        sysFSI.DoStepDynamics_FSI();
+
+    return sysFSI.GetParticlePositions();
+}
+
+TEST(fsiMultiDevice, settling) {
+    int num_devices = 0;
+    if (cudaGetDeviceCount(&num_devices) != cudaSuccess || num_devices < 2)
+        GTEST_SKIP() << "Test requires at least two CUDA devices";
+
+    cudaSetDevice(0);
+    auto single = RunSettling({0});
+    auto multi = RunSettling({0, 1});
+
+    ASSERT_EQ(single.size(), multi.size());
+
+    double max_diff = 0;
+    for (size_t i = 0; i < single.size(); i++)
+        max_diff = std::max(max_diff, (multi[i] - single[i]).Length());
+    std::cout << "Max marker position difference: " << max_diff << std::endl;
+
+    // Each marker is processed with the same arithmetic on either device, so differences only come from code
+    // generation for different architectures
+    ASSERT_LT(max_diff, 1e-6);
+}
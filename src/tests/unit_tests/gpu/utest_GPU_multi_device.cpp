@@ -0,0 +1,107 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+// Validation test: settling of a granular bed with the step kernels distributed
+// over two devices (see ChSystemGpu::SetDevices), compared to a single device.
+// The test is skipped if fewer than two CUDA devices are available.
+// =============================================================================
+
+#include "gtest/gtest.h"
+#include <cmath>
+#include <iostream>
+#include <string>
+
+#include <cuda_runtime.h>
+
+#include "chrono/core/ChGlobal.h"
+#include "chrono/utils/ChUtilsSamplers.h"
+#include "chrono_gpu/physics/ChSystemGpu.h"
+
+using namespace chrono;
+using namespace chrono::gpu;
+
+struct SettlingResult {
+    float plane_force;     // vertical force on the bottom plane
+    float expected_force;  // weight of all spheres (pointing down)
+    float mean_height;     // average sphere height
+};
+
+// Settle a bed of spheres filling the bottom half of a box elongated along X (the slab direction), with the step
+// kernels distributed over the specified devices.
+static SettlingResult RunSettling(const std::vector<int>& devices) {
+    float radius = 0.5f;
+    float density = 2.5f;
+    float g = 980.f;
+    ChVector3f box(40.f, 10.f, 20.f);
+
+    ChSystemGpu gpu_sys(radius, density, box);
+    gpu_sys.SetGravitationalAcceleration(ChVector3f(0, 0, -g));
+    gpu_sys.SetFrictionMode(CHGPU_FRICTION_MODE::FRICTIONLESS);
+    gpu_sys.SetTimeIntegrator(CHGPU_TIME_INTEGRATOR::CENTERED_DIFFERENCE);
+    gpu_sys.SetKn_SPH2SPH(1e7f);
+    gpu_sys.SetKn_SPH2WALL(1e7f);
+    gpu_sys.SetGn_SPH2SPH(2e4f);
+    gpu_sys.SetGn_SPH2WALL(2e4f);
+    gpu_sys.SetVerbosity(CHGPU_VERBOSITY::QUIET);
+
+    chrono::utils::HCPSampler<float> sampler(2.1f * radius);
+    ChVector3f center(0, 0, -box.z() / 4);
+    ChVector3f hdims(box.x() / 2 - radius, box.y() / 2 - radius, box.z() / 4 - radius);
+    std::vector<ChVector3f> points = sampler.SampleBox(center, hdims);
+    gpu_sys.SetParticles(points);
+
+    size_t plane_id = gpu_sys.CreateBCPlane(ChVector3f(0, 0, -box.z() / 2 + 2 * radius), ChVector3f(0, 0, 1), true);
+
+    gpu_sys.SetBDFixed(true);
+    gpu_sys.SetFixedStepSize(5e-5f);
+    gpu_sys.SetDevices(devices);
+    gpu_sys.Initialize();
+
+    gpu_sys.AdvanceSimulation(0.5f);
+
+    SettlingResult result;
+    ChVector3f force;
+    EXPECT_TRUE(gpu_sys.GetBCReactionForces(plane_id, force));
+    result.plane_force = force.z();
+
+    double height = 0;
+    for (int i = 0; i < (int)gpu_sys.GetNumParticles(); i++)
+        height += gpu_sys.GetParticlePosition(i).z();
+    result.mean_height = (float)(height / gpu_sys.GetNumParticles());
+
+    float mass = 4.f / 3.f * (float)CH_PI * radius * radius * radius * density;
+    result.expected_force = -(float)points.size() * mass * g;
+
+    return result;
+}
+
+TEST(gpuMultiDevice, settling) {
+    int num_devices = 0;
+    if (cudaGetDeviceCount(&num_devices) != cudaSuccess || num_devices < 2)
+        GTEST_SKIP() << "Test requires at least two CUDA devices";
+
+    auto single = RunSettling({0});
+    auto multi = RunSettling({0, 1});
+
+    std::cout << "Plane force:  1 device " << single.plane_force << "  2 devices " << multi.plane_force
+              << "  expected " << single.expected_force << std::endl;
+    std::cout << "Mean height:  1 device " << single.mean_height << "  2 devices " << multi.mean_height << std::endl;
+
+    // Both runs carry the weight of the bed (1% error allowed)
+    ASSERT_NEAR(single.plane_force, single.expected_force, 0.01f * std::abs(single.expected_force));
+    ASSERT_NEAR(multi.plane_force, multi.expected_force, 0.01f * std::abs(multi.expected_force));
+
+    // The settled beds match (the order of atomic accumulations differs across devices, so results are not bitwise
+    // identical)
+    ASSERT_NEAR(multi.mean_height, single.mean_height, 1e-2f);
+}
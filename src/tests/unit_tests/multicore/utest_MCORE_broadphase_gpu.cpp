@@ -0,0 +1,99 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Chrono::Multicore unit test for the GPU broadphase backend.
+// A layer of touching spheres and boxes (some in a separate collision family)
+// is created, with a few shapes moved at each step. The candidate pairs found
+// with the GPU backend are compared against those found on the host.
+//
+// =============================================================================
+
+#include <cuda_runtime.h>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
+
+#include "chrono_multicore/collision/ChBroadphaseGPU.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+class BedModel {
+  public:
+    BedModel(bool gpu) {
+        sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+        coll_sys = std::static_pointer_cast<ChCollisionSystemMulticore>(sys.GetCollisionSystem());
+        coll_sys->SetBroadphaseGridResolution(ChVector3i(8, 8, 2));
+        if (gpu)
+            coll_sys->SetBroadphaseBackend(chrono_types::make_shared<ChBroadphaseGPU>());
+
+        auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+        for (int i = 0; i < 20; i++) {
+            for (int j = 0; j < 20; j++) {
+                std::shared_ptr<ChBody> body;
+                if ((i + j) % 5 == 0)
+                    body = chrono_types::make_shared<ChBodyEasyBox>(0.9, 0.9, 0.9, 1000, false, true, mat);
+                else
+                    body = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+                body->SetPos(ChVector3d(i * 0.99, j * 0.99, 0));
+                if (i % 7 == 3) {
+                    body->GetCollisionModel()->SetFamily(2);
+                    body->GetCollisionModel()->DisallowCollisionsWith(2);
+                }
+                if (j == 0)
+                    body->SetFixed(true);
+                sys.AddBody(body);
+                bodies.push_back(body);
+            }
+        }
+
+        sys.GetCollisionSystem()->Initialize();
+    }
+
+    // Move every 17th body (starting at the specified offset) and return the list of candidate pairs.
+    std::vector<std::pair<int, int>> Step(int offset, double dz) {
+        for (size_t k = offset; k < bodies.size(); k += 17)
+            bodies[k]->SetPos(bodies[k]->GetPos() + ChVector3d(0.3 * dz, 0, dz));
+
+        sys.ComputeCollisions();
+
+        std::vector<std::pair<int, int>> pairs;
+        for (const auto& p : coll_sys->GetOverlappingPairs())
+            pairs.push_back(std::make_pair(p.x, p.y));
+        return pairs;
+    }
+
+    ChSystemNSC sys;
+    std::shared_ptr<ChCollisionSystemMulticore> coll_sys;
+    std::vector<std::shared_ptr<ChBody>> bodies;
+};
+
+TEST(ChBroadphaseGPU, pairs) {
+    int num_devices = 0;
+    if (cudaGetDeviceCount(&num_devices) != cudaSuccess || num_devices < 1)
+        GTEST_SKIP() << "Test requires a CUDA device";
+
+    BedModel model_ref(false);
+    BedModel model_gpu(true);
+
+    for (int step = 0; step < 20; step++) {
+        double dz = (step % 4 == 0) ? 0.4 : 0.02 * ((step % 2) ? 1 : -1);
+        auto pairs_ref = model_ref.Step(step % 17, dz);
+        auto pairs_gpu = model_gpu.Step(step % 17, dz);
+        ASSERT_FALSE(pairs_ref.empty());
+        ASSERT_EQ(pairs_ref, pairs_gpu) << "step " << step;
+    }
+}
@@ -0,0 +1,73 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Chrono::Multicore unit test for the spatial decomposition of bodies into
+// subdomains (ownership, balance, and ghost layers)
+// =============================================================================
+
+#include <random>
+
+#include "chrono_multicore/ChDomainDecomposition.h"
+
+#include "unit_testing.h"
+
+using namespace chrono;
+
+static void CheckDecomposition(ChDomainDecomposition::Type type, int num_subdomains) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(0, 1);
+    std::vector<real3> pos(1000);
+    for (auto& p : pos)
+        p = real3(4 * dist(gen), dist(gen), 2 * dist(gen));
+
+    real width = 0.05;
+    ChDomainDecomposition dd(type, num_subdomains);
+    dd.SetGhostWidth(width);
+    dd.Partition(pos);
+
+    size_t total = 0;
+    for (int s = 0; s < num_subdomains; s++) {
+        const auto& owned = dd.GetOwnedBodies(s);
+        total += owned.size();
+
+        // Subdomains are balanced and contain their owned bodies
+        ASSERT_LE(owned.size(), pos.size() / num_subdomains + 1);
+        ASSERT_GE(owned.size(), pos.size() / num_subdomains);
+        for (auto b : owned) {
+            ASSERT_EQ(dd.GetOwner(b), s);
+            ASSERT_TRUE(dd.Contains(s, pos[b]));
+        }
+
+        // Ghosts are owned by other subdomains and lie within the ghost width of the subdomain
+        real3 min_point, max_point;
+        dd.GetSubdomainBounds(s, min_point, max_point);
+        for (auto b : dd.GetGhostBodies(s)) {
+            ASSERT_NE(dd.GetOwner(b), s);
+            ASSERT_TRUE(pos[b].x > min_point.x - width && pos[b].x < max_point.x + width);
+            ASSERT_TRUE(pos[b].y > min_point.y - width && pos[b].y < max_point.y + width);
+            ASSERT_TRUE(pos[b].z > min_point.z - width && pos[b].z < max_point.z + width);
+        }
+    }
+    ASSERT_EQ(total, pos.size());
+}
+
+TEST(ChronoMulticore, decomposition_slab) {
+    CheckDecomposition(ChDomainDecomposition::Type::SLAB, 1);
+    CheckDecomposition(ChDomainDecomposition::Type::SLAB, 6);
+}
+
+TEST(ChronoMulticore, decomposition_rcb) {
+    CheckDecomposition(ChDomainDecomposition::Type::RCB, 5);
+    CheckDecomposition(ChDomainDecomposition::Type::RCB, 8);
+}
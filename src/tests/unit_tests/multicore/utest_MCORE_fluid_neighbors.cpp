@@ -0,0 +1,112 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Chrono::Multicore unit test comparing fluid simulations with neighbor lists
+// rebuilt at each step and with neighbor lists reused through a Verlet skin.
+//
+// =============================================================================
+
+#include <numeric>
+
+#include "chrono_multicore/physics/ChSystemMulticore.h"
+
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "unit_testing.h"
+
+using namespace chrono;
+
+static const double kernel_radius = 0.032;
+static const double time_step = 1e-3;
+static const int num_steps = 100;
+
+std::shared_ptr<ChFluidContainer> CreateSystem(ChSystemMulticoreNSC& sys, double skin) {
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+    sys.SetNumThreads(2);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    sys.GetSettings()->solver.solver_mode = SolverMode::SLIDING;
+    sys.GetSettings()->solver.max_iteration_normal = 0;
+    sys.GetSettings()->solver.max_iteration_sliding = 20;
+    sys.GetSettings()->solver.max_iteration_spinning = 0;
+    sys.GetSettings()->solver.max_iteration_bilateral = 0;
+    sys.GetSettings()->solver.tolerance = 1e-3;
+    sys.GetSettings()->solver.alpha = 0;
+    sys.GetSettings()->solver.contact_recovery_speed = 100000;
+    sys.ChangeSolverType(SolverType::BB);
+    sys.GetSettings()->collision.collision_envelope = kernel_radius * 0.05;
+    sys.GetSettings()->collision.bins_per_axis = vec3(2, 2, 2);
+
+    // Fixed floor
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    ground->EnableCollision(true);
+    utils::AddBoxGeometry(ground.get(), mat, ChVector3d(1, 1, 0.1), ChVector3d(0, 0, -0.05));
+    sys.AddBody(ground);
+
+    // Block of fluid nodes above the floor
+    auto fluid = chrono_types::make_shared<ChFluidContainer>();
+    sys.Add3DOFContainer(fluid);
+    fluid->tau = time_step * 4;
+    fluid->epsilon = 1e-3;
+    fluid->kernel_radius = kernel_radius;
+    fluid->rho = 1000;
+    fluid->contact_mu = 0;
+    fluid->collision_envelope = 0;
+    fluid->verlet_skin = skin;
+
+    double dist = kernel_radius * 0.9;
+    std::vector<real3> pos;
+    for (int i = 0; i < 8; i++)
+        for (int j = 0; j < 8; j++)
+            for (int k = 0; k < 8; k++)
+                pos.push_back(real3(i * dist, j * dist, 0.01 + k * dist));
+    std::vector<real3> vel(pos.size(), real3(0));
+
+    fluid->mass = fluid->rho * dist * dist * dist;
+    fluid->UpdatePosition(0);
+    fluid->AddBodies(pos, vel);
+
+    return fluid;
+}
+
+TEST(ChronoMulticore, fluid_verlet_lists) {
+    ChSystemMulticoreNSC sys_ref;
+    ChSystemMulticoreNSC sys_vrl;
+    auto fluid_ref = CreateSystem(sys_ref, 0);
+    auto fluid_vrl = CreateSystem(sys_vrl, 0.25 * kernel_radius);
+
+    custom_vector<real> dens_ref;
+    custom_vector<real> dens_vrl;
+
+    for (int i = 0; i < num_steps; i++) {
+        sys_ref.DoStepDynamics(time_step);
+        sys_vrl.DoStepDynamics(time_step);
+
+        // Same neighbor pairs and same densities (up to the node ordering)
+        ASSERT_EQ(sys_ref.data_manager->cd_data->num_fluid_contacts, sys_vrl.data_manager->cd_data->num_fluid_contacts);
+
+        fluid_ref->GetFluidDensity(dens_ref);
+        fluid_vrl->GetFluidDensity(dens_vrl);
+        real total_ref = std::accumulate(dens_ref.begin(), dens_ref.end(), real(0));
+        real total_vrl = std::accumulate(dens_vrl.begin(), dens_vrl.end(), real(0));
+        ASSERT_NEAR(total_ref, total_vrl, 1e-6 * total_ref);
+    }
+
+    // The lists must have been reused for some of the steps
+    ASSERT_EQ(sys_ref.data_manager->cd_data->num_verlet_builds, 0);
+    ASSERT_GT(sys_vrl.data_manager->cd_data->num_verlet_builds, 0);
+    ASSERT_LT(sys_vrl.data_manager->cd_data->num_verlet_builds, num_steps);
+}
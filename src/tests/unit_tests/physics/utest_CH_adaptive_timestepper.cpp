@@ -0,0 +1,131 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the adaptive timesteppers.
+//
+// A body attached to the ground through a spring oscillates along the spring
+// direction. The embedded Runge-Kutta integrators must reproduce the analytic
+// solution, and the IMEX Euler integrator must take large steps for a stiff
+// spring only if its Jacobians are provided.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChLinkTSDA.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static std::shared_ptr<ChBody> CreateOscillator(ChSystem& sys, double k, double r, double x0, bool stiff) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, 0));
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseQR>());
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetMass(1.0);
+    body->SetPos(ChVector3d(1 + x0, 0, 0));
+    sys.AddBody(body);
+
+    auto spring = chrono_types::make_shared<ChLinkTSDA>();
+    spring->Initialize(ground, body, true, ChVector3d(0, 0, 0), ChVector3d(0, 0, 0));
+    spring->SetRestLength(1.0);
+    spring->SetSpringCoefficient(k);
+    spring->SetDampingCoefficient(r);
+    spring->IsStiff(stiff);
+    sys.AddLink(spring);
+
+    return body;
+}
+
+class RungeKuttaAdaptiveTest : public ::testing::TestWithParam<ChTimestepperRungeKuttaAdaptive::Method> {};
+
+TEST_P(RungeKuttaAdaptiveTest, oscillator) {
+    double omega = 10;
+    double x0 = 0.5;
+
+    ChSystemSMC sys;
+    auto body = CreateOscillator(sys, omega * omega, 0, x0, false);
+    auto integrator = chrono_types::make_shared<ChTimestepperRungeKuttaAdaptive>(&sys, GetParam());
+    integrator->SetTolerances(1e-8, 1e-10);
+    sys.SetTimestepper(integrator);
+    ASSERT_EQ(sys.GetTimestepperType(), ChTimestepper::Type::RUNGEKUTTA_ADAPTIVE);
+
+    double step = 0.05;
+    for (int n = 1; n <= 20; n++) {
+        sys.DoStepDynamics(step);
+        double t = n * step;
+        ASSERT_NEAR(sys.GetChTime(), t, 1e-12);
+        ASSERT_NEAR(body->GetPos().x(), 1 + x0 * std::cos(omega * t), 1e-6);
+        ASSERT_NEAR(body->GetPosDt().x(), -x0 * omega * std::sin(omega * t), 1e-5);
+    }
+
+    // The tolerances require several internal steps per step
+    ASSERT_GT(integrator->GetNumStepsAccepted(), 20u);
+}
+
+INSTANTIATE_TEST_SUITE_P(ChTimestepperRungeKuttaAdaptive,
+                         RungeKuttaAdaptiveTest,
+                         ::testing::Values(ChTimestepperRungeKuttaAdaptive::Method::BOGACKI_SHAMPINE,
+                                           ChTimestepperRungeKuttaAdaptive::Method::DORMAND_PRINCE));
+
+TEST(ChTimestepperRungeKuttaAdaptive, order) {
+    // For the same tolerances, the higher order pair requires fewer steps
+    unsigned int num_steps[2];
+    int i = 0;
+    for (auto method : {ChTimestepperRungeKuttaAdaptive::Method::BOGACKI_SHAMPINE,
+                        ChTimestepperRungeKuttaAdaptive::Method::DORMAND_PRINCE}) {
+        ChSystemSMC sys;
+        CreateOscillator(sys, 100, 0, 0.5, false);
+        auto integrator = chrono_types::make_shared<ChTimestepperRungeKuttaAdaptive>(&sys, method);
+        integrator->SetTolerances(1e-8, 1e-10);
+        sys.SetTimestepper(integrator);
+        while (sys.GetChTime() < 1)
+            sys.DoStepDynamics(0.1);
+        num_steps[i++] = integrator->GetNumStepsAccepted() + integrator->GetNumStepsRejected();
+    }
+    ASSERT_LT(num_steps[1], num_steps[0]);
+}
+
+TEST(ChTimestepperEulerIMEXAdaptive, stiff_spring) {
+    // Stiff damped spring: the stability limit of an explicit treatment is about 2e-3
+    double k = 1e6;
+    double r = 500;
+    double step = 1e-2;
+
+    unsigned int num_steps[2];
+    for (int stiff = 0; stiff < 2; stiff++) {
+        ChSystemSMC sys;
+        auto body = CreateOscillator(sys, k, r, 0.01, stiff == 1);
+        sys.SetTimestepperType(ChTimestepper::Type::EULER_IMEX_ADAPTIVE);
+        auto integrator = std::static_pointer_cast<ChTimestepperEulerIMEXAdaptive>(sys.GetTimestepper());
+
+        while (sys.GetChTime() < 0.5)
+            sys.DoStepDynamics(step);
+
+        ASSERT_NEAR(sys.GetChTime(), 0.5, 1e-12);
+        ASSERT_NEAR(body->GetPos().x(), 1.0, 1e-4);
+        ASSERT_NEAR(body->GetPosDt().x(), 0.0, 1e-3);
+        num_steps[stiff] = integrator->GetNumStepsAccepted() + integrator->GetNumStepsRejected();
+    }
+
+    // With the spring Jacobians, the spring is treated implicitly and the step size is not limited by stability
+    ASSERT_LT(2 * num_steps[1], num_steps[0]);
+}
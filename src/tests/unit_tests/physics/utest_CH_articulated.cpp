@@ -0,0 +1,342 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Tests for articulated mechanisms in reduced coordinates.
+//
+// - mass matrix products (recursive algorithms) against the dense mass matrix
+// - serial chain and floating-base chain against maximal-coordinate models
+// - SMC contact of a floating link against an equivalent rigid body
+// - rejection of links with collision in NSC systems
+// - four-bar mechanism closed with a loop-closure constraint
+//
+// =============================================================================
+
+#include "chrono/collision/ChCollisionShapeBox.h"
+#include "chrono/physics/ChArticulatedMechanism.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChIterativeSolver.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+using JointType = ChArticulatedMechanism::JointType;
+
+// Create a slender link between the two given points.
+template <class T>
+std::shared_ptr<T> CreateLink(const ChVector3d& p1, const ChVector3d& p2, double mass) {
+    auto link = chrono_types::make_shared<T>();
+    double length = (p2 - p1).Length();
+    link->SetMass(mass);
+    link->SetInertiaXX(ChVector3d(0.01, mass * length * length / 12, mass * length * length / 12));
+    link->SetPos(0.5 * (p1 + p2));
+    ChVector3d dir = (p2 - p1).GetNormalized();
+    link->SetRot(QuatFromVec2Vec(VECT_X, dir));
+    return link;
+}
+
+TEST(ChArticulatedMechanism, mass_matrix) {
+    ChSystemNSC sys;
+
+    // Branched tree with revolute and prismatic joints, in a generic configuration
+    auto mech = chrono_types::make_shared<ChArticulatedMechanism>();
+    auto link0 = CreateLink<ChArticulatedLink>(ChVector3d(0, 0, 0), ChVector3d(1, 0, 0), 2.0);
+    auto link1 = CreateLink<ChArticulatedLink>(ChVector3d(1, 0, 0), ChVector3d(2, 0.5, 0), 1.0);
+    auto link2 = CreateLink<ChArticulatedLink>(ChVector3d(1, 0, 0), ChVector3d(1, 1, 0.5), 1.5);
+    auto link3 = CreateLink<ChArticulatedLink>(ChVector3d(1, 1, 0.5), ChVector3d(1, 2, 1), 0.5);
+    mech->AddLink(link0, nullptr, JointType::REVOLUTE, ChFrame<>(VNULL, QuatFromAngleX(0.3)));
+    mech->AddLink(link1, link0, JointType::PRISMATIC, ChFrame<>(ChVector3d(1, 0, 0), QuatFromAngleY(CH_PI_2)));
+    mech->AddLink(link2, link0, JointType::REVOLUTE, ChFrame<>(ChVector3d(1, 0, 0), QuatFromAngleY(0.4)));
+    mech->AddLink(link3, link2, JointType::REVOLUTE, ChFrame<>(ChVector3d(1, 1, 0.5), QuatFromAngleX(-0.7)));
+    sys.Add(mech);
+
+    mech->SetJointPos(0, 0.4);
+    mech->SetJointPos(1, 0.2);
+    mech->SetJointPos(2, -0.9);
+    mech->SetJointPos(3, 1.3);
+    mech->Update(0.0);
+
+    ChMatrixDynamic<> M;
+    mech->GetMassMatrix(M);
+    ASSERT_EQ(M.rows(), 4);
+    ASSERT_LT((M - M.transpose()).norm(), 1e-12);
+
+    ChVectorDynamic<> x(4);
+    x << 0.3, -1.2, 0.7, 2.1;
+    ChVectorDynamic<> Mx = ChVectorDynamic<>::Zero(4);
+    mech->Variables().AddMassTimesVector(Mx, x);
+    ASSERT_LT((Mx - M * x).norm(), 1e-12);
+
+    ChVectorDynamic<> y(4);
+    mech->Variables().ComputeMassInverseTimesVector(y, Mx);
+    ASSERT_LT((y - x).norm(), 1e-10);
+}
+
+// Simulate a 3-link pendulum, in reduced or maximal coordinates, and return the location of the last link.
+static ChVector3d SimulateChain(bool reduced, bool direct, double step, double duration) {
+    ChSystemNSC sys;
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    if (direct)
+        sys.SetSolverType(ChSolver::Type::SPARSE_QR);
+    else
+        sys.GetSolver()->AsIterative()->SetMaxIterations(200);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto mech = chrono_types::make_shared<ChArticulatedMechanism>();
+    if (reduced)
+        sys.Add(mech);
+
+    const int num_links = 3;
+    std::shared_ptr<ChBody> last;
+    std::shared_ptr<ChArticulatedLink> parent;
+    std::shared_ptr<ChBody> prev = ground;
+    for (int i = 0; i < num_links; i++) {
+        ChVector3d p1(i * 1.0, 0, 0);
+        ChVector3d p2((i + 1) * 1.0, 0, 0);
+        ChFrame<> joint(p1, QUNIT);
+        if (reduced) {
+            auto link = CreateLink<ChArticulatedLink>(p1, p2, 1.0 + 0.5 * i);
+            mech->AddLink(link, parent, JointType::REVOLUTE, joint);
+            parent = link;
+            last = link;
+        } else {
+            auto body = CreateLink<ChBody>(p1, p2, 1.0 + 0.5 * i);
+            sys.AddBody(body);
+            auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+            rev->Initialize(body, prev, joint);
+            sys.AddLink(rev);
+            prev = body;
+            last = body;
+        }
+    }
+
+    while (sys.GetChTime() < duration - step / 2)
+        sys.DoStepDynamics(step);
+
+    return last->GetPos();
+}
+
+TEST(ChArticulatedMechanism, serial_chain) {
+    double step = 1e-4;
+    double duration = 0.5;
+    auto pos_max = SimulateChain(false, true, step, duration);
+    auto pos_direct = SimulateChain(true, true, step, duration);
+    auto pos_iterative = SimulateChain(true, false, step, duration);
+
+    ASSERT_LT((pos_direct - pos_iterative).Length(), 1e-8);
+    ASSERT_LT((pos_direct - pos_max).Length(), 2e-3);
+    ASSERT_LT(pos_direct.y(), -0.5);
+}
+
+// Simulate a floating chain in zero gravity, in reduced or maximal coordinates.
+// Return the location of the last link and the total linear momentum.
+static void SimulateFloating(bool reduced, ChVector3d& pos, ChVector3d& momentum) {
+    ChSystemNSC sys;
+    sys.SetGravitationalAcceleration(VNULL);
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    sys.SetSolverType(ChSolver::Type::SPARSE_QR);
+
+    ChVector3d vel(0.2, -0.1, 0.3);
+    ChVector3d omega(0.5, 1.0, -2.0);
+
+    auto mech = chrono_types::make_shared<ChArticulatedMechanism>();
+    sys.Add(mech);
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    std::shared_ptr<ChArticulatedLink> parent;
+    for (int i = 0; i < 3; i++) {
+        ChVector3d p1(i * 1.0, 0, 0);
+        ChVector3d p2((i + 1) * 1.0, 0, 0);
+        ChFrame<> joint(p1, QuatFromAngleX(0.5 * i));
+        std::shared_ptr<ChBody> body;
+        if (reduced) {
+            auto link = CreateLink<ChArticulatedLink>(p1, p2, 1.0 + i);
+            if (i == 0) {
+                link->SetPosDt(vel);
+                link->SetAngVelParent(omega);
+            }
+            mech->AddLink(link, parent, i == 0 ? JointType::FREE : JointType::REVOLUTE, joint);
+            parent = link;
+            body = link;
+        } else {
+            body = CreateLink<ChBody>(p1, p2, 1.0 + i);
+            body->SetPosDt(vel + Vcross(omega, body->GetPos() - ChVector3d(0.5, 0, 0)));
+            body->SetAngVelParent(omega);
+            sys.AddBody(body);
+            if (i > 0) {
+                auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+                rev->Initialize(body, bodies.back(), joint);
+                sys.AddLink(rev);
+            }
+        }
+        bodies.push_back(body);
+    }
+
+    double step = 1e-4;
+    while (sys.GetChTime() < 0.5 - step / 2)
+        sys.DoStepDynamics(step);
+
+    pos = bodies.back()->GetPos();
+    momentum = VNULL;
+    for (const auto& body : bodies)
+        momentum += body->GetMass() * body->GetPosDt();
+}
+
+TEST(ChArticulatedMechanism, floating_base) {
+    ChVector3d pos_max, mom_max;
+    ChVector3d pos_red, mom_red;
+    SimulateFloating(false, pos_max, mom_max);
+    SimulateFloating(true, pos_red, mom_red);
+
+    // Initial linear momentum
+    double mass = 1.0 + 2.0 + 3.0;
+    ChVector3d mom0 = mass * ChVector3d(0.2, -0.1, 0.3) +
+                      Vcross(ChVector3d(0.5, 1.0, -2.0), ChVector3d(2.0 * 1 + 3.0 * 2, 0, 0));
+
+    ASSERT_LT((mom_red - mom0).Length(), 1e-3 * mom0.Length());
+    ASSERT_LT((pos_red - pos_max).Length(), 2e-3);
+}
+
+// Drop a box on the ground, as a floating link or as a rigid body, and return its final height.
+static double SimulateDrop(bool reduced) {
+    ChSystemSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    mat->SetYoungModulus(1e7f);
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    ground->SetPos(ChVector3d(0, -0.5, 0));
+    ground->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeBox>(mat, 4, 1, 4));
+    ground->EnableCollision(true);
+    sys.AddBody(ground);
+
+    std::shared_ptr<ChBody> box;
+    auto link = chrono_types::make_shared<ChArticulatedLink>();
+    if (reduced)
+        box = link;
+    else
+        box = chrono_types::make_shared<ChBody>();
+    box->SetMass(10);
+    box->SetInertiaXX(ChVector3d(10 * 0.5 / 12, 10 * 0.5 / 12, 10 * 0.5 / 12));
+    box->SetPos(ChVector3d(0, 0.3, 0));
+    box->SetRot(QuatFromAngleZ(0.2));
+    box->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeBox>(mat, 0.5, 0.5, 0.5));
+    box->EnableCollision(true);
+    if (reduced) {
+        auto mech = chrono_types::make_shared<ChArticulatedMechanism>();
+        mech->AddLink(link, nullptr, JointType::FREE);
+        sys.Add(mech);
+    } else {
+        sys.AddBody(box);
+    }
+
+    double step = 1e-4;
+    while (sys.GetChTime() < 1.0)
+        sys.DoStepDynamics(step);
+
+    return box->GetPos().y();
+}
+
+TEST(ChArticulatedMechanism, contact_smc) {
+    double height_max = SimulateDrop(false);
+    double height_red = SimulateDrop(true);
+
+    ASSERT_NEAR(height_red, 0.25, 5e-3);
+    ASSERT_NEAR(height_red, height_max, 1e-3);
+}
+
+TEST(ChArticulatedMechanism, contact_nsc) {
+    // Links with collision are rejected in a system with NSC contact, whether collision is enabled before or after
+    // adding the mechanism to the system
+    for (bool before : {true, false}) {
+        ChSystemNSC sys;
+        sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+        auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+        auto platform = chrono_types::make_shared<ChArticulatedLink>();
+        platform->SetMass(10);
+        platform->SetInertiaXX(ChVector3d(1, 1, 1));
+        platform->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeBox>(mat, 1, 0.2, 1));
+
+        auto mech = chrono_types::make_shared<ChArticulatedMechanism>();
+        mech->AddLink(platform, nullptr, JointType::PRISMATIC, ChFrame<>(VNULL, QuatFromAngleX(-CH_PI_2)));
+
+        if (before) {
+            platform->EnableCollision(true);
+            ASSERT_THROW(sys.Add(mech), std::runtime_error);
+        } else {
+            sys.Add(mech);
+            platform->EnableCollision(true);
+            ASSERT_THROW(sys.DoStepDynamics(1e-3), std::runtime_error);
+        }
+    }
+}
+
+// Simulate a four-bar (parallelogram) mechanism, closed with a loop-closure constraint, under gravity.
+static void SimulateFourBar(bool direct) {
+    ChSystemNSC sys;
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    if (direct)
+        sys.SetSolverType(ChSolver::Type::SPARSE_QR);
+    else
+        sys.GetSolver()->AsIterative()->SetMaxIterations(500);
+
+    ChVector3d A(0, 0, 0);
+    ChVector3d B(0.6, 0.8, 0);
+    ChVector3d C(2.6, 0.8, 0);
+    ChVector3d D(2.0, 0, 0);
+
+    auto crank = CreateLink<ChArticulatedLink>(A, B, 1.0);
+    auto coupler = CreateLink<ChArticulatedLink>(B, C, 2.0);
+    auto rocker = CreateLink<ChArticulatedLink>(C, D, 1.0);
+
+    auto mech = chrono_types::make_shared<ChArticulatedMechanism>();
+    mech->AddLink(crank, nullptr, JointType::REVOLUTE, ChFrame<>(A, QUNIT));
+    mech->AddLink(coupler, crank, JointType::REVOLUTE, ChFrame<>(B, QUNIT));
+    mech->AddLink(rocker, coupler, JointType::REVOLUTE, ChFrame<>(C, QUNIT));
+    mech->AddLoopClosure(rocker, nullptr, ChFrame<>(D, QUNIT), true, true, false);
+    sys.Add(mech);
+
+    ASSERT_EQ(mech->GetNumDOFs(), 3);
+    ASSERT_EQ(mech->GetNumConstraintsBilateral(), 2);
+
+    double step = 1e-3;
+    double max_violation = 0;
+    ChQuaternion<> rot0 = coupler->GetRot();
+    while (sys.GetChTime() < 1.0) {
+        sys.DoStepDynamics(step);
+        max_violation = std::max(max_violation, mech->GetLoopClosureViolation(0).lpNorm<Eigen::Infinity>());
+    }
+
+    // The loop stays closed and the coupler of the parallelogram translates without rotating
+    ASSERT_LT(max_violation, direct ? 1e-5 : 1e-3);
+    ASSERT_GT(std::abs(mech->GetJointPos(0)), 0.3);
+    ASSERT_LT((coupler->GetRot() - rot0).Length(), direct ? 1e-4 : 1e-2);
+    ASSERT_GT(mech->GetLoopClosureReaction(0).norm(), 1.0);
+}
+
+TEST(ChArticulatedMechanism, loop_closure) {
+    SimulateFourBar(true);
+    SimulateFourBar(false);
+}
@@ -20,11 +20,14 @@
 ////unsigned int fp_control_state = _controlfp(_EM_INEXACT, _MCW_EM);
 
 #include <cmath>
+#include <cstdio>
 
 #include "gtest/gtest.h"
 
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChBody.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
 
 using namespace chrono;
 
@@ -149,3 +152,175 @@ TEST(FullAssembly, Assemble) {
     TestVector(rfrc, rfrc_ref, 1e-2);
     TestVector(rtrq, rtrq_ref, 1e-2);
 }
+
+// Create a chain of pendulums connected through revolute joints and return the list of bodies.
+static std::vector<std::shared_ptr<ChBody>> CreateChain(ChSystemNSC& sys, int num_links) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    sys.SetSolverType(ChSolver::Type::PSOR);
+    sys.GetSolver()->AsIterative()->SetMaxIterations(50);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    auto prev = ground;
+    for (int i = 0; i < num_links; i++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetPos(ChVector3d(i + 0.5, 0, 0));
+        body->SetMass(1.0 + 0.1 * i);
+        body->SetInertiaXX(ChVector3d(0.01, 0.1, 0.1));
+        body->SetAngVelLocal(ChVector3d(0.1 * i, 0, 0));
+        sys.AddBody(body);
+
+        auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+        joint->Initialize(body, prev, ChFrame<>(ChVector3d(i, 0, 0), QuatFromAngleX(CH_PI_2)));
+        sys.AddLink(joint);
+
+        bodies.push_back(body);
+        prev = body;
+    }
+
+    return bodies;
+}
+
+TEST(FullAssembly, ParallelStatePasses) {
+    int num_links = 100;
+
+    ChSystemNSC sys_seq;
+    auto bodies_seq = CreateChain(sys_seq, num_links);
+
+    ChSystemNSC sys_par;
+    auto bodies_par = CreateChain(sys_par, num_links);
+    sys_par.SetNumThreads(4);
+    sys_par.EnableParallelStatePasses(true);
+    ASSERT_TRUE(sys_par.GetAssembly().IsParallelStatePassesEnabled());
+
+    for (int i = 0; i < 100; i++) {
+        sys_seq.DoStepDynamics(1e-3);
+        sys_par.DoStepDynamics(1e-3);
+    }
+
+    // Results must be bit-identical
+    for (int i = 0; i < num_links; i++) {
+        ASSERT_EQ(bodies_seq[i]->GetPos(), bodies_par[i]->GetPos());
+        ASSERT_EQ(bodies_seq[i]->GetRot(), bodies_par[i]->GetRot());
+        ASSERT_EQ(bodies_seq[i]->GetPosDt(), bodies_par[i]->GetPosDt());
+        ASSERT_EQ(bodies_seq[i]->GetAngVelLocal(), bodies_par[i]->GetAngVelLocal());
+    }
+}
+
+static void TestFusedStatePasses(ChTimestepper::Type type) {
+    int num_links = 20;
+
+    ChSystemNSC sys_ref;
+    auto bodies_ref = CreateChain(sys_ref, num_links);
+
+    ChSystemNSC sys_fused;
+    auto bodies_fused = CreateChain(sys_fused, num_links);
+    sys_fused.EnableFusedStatePasses(true);
+    ASSERT_TRUE(sys_fused.GetAssembly().IsFusedStatePassesEnabled());
+
+    for (auto sys : {&sys_ref, &sys_fused}) {
+        sys->SetTimestepperType(type);
+        sys->SetSolverType(ChSolver::Type::SPARSE_QR);
+        if (auto hht = std::dynamic_pointer_cast<ChTimestepperHHT>(sys->GetTimestepper()))
+            hht->SetStepControl(false);
+    }
+
+    for (int i = 0; i < 100; i++) {
+        sys_ref.DoStepDynamics(1e-3);
+        sys_fused.DoStepDynamics(1e-3);
+    }
+
+    // Results agree to round-off
+    for (int i = 0; i < num_links; i++) {
+        TestVector(bodies_ref[i]->GetPos(), bodies_fused[i]->GetPos(), 1e-10);
+        TestQuaternion(bodies_ref[i]->GetRot(), bodies_fused[i]->GetRot(), 1e-10);
+        TestVector(bodies_ref[i]->GetPosDt(), bodies_fused[i]->GetPosDt(), 1e-8);
+        TestVector(bodies_ref[i]->GetAngVelLocal(), bodies_fused[i]->GetAngVelLocal(), 1e-8);
+    }
+}
+
+TEST(FullAssembly, FusedStatePassesEuler) {
+    TestFusedStatePasses(ChTimestepper::Type::EULER_IMPLICIT);
+}
+
+TEST(FullAssembly, FusedStatePassesHHT) {
+    TestFusedStatePasses(ChTimestepper::Type::HHT);
+}
+
+// Create a chain with bodies moved away from their assembled configuration and a direct linear solver.
+static std::vector<std::shared_ptr<ChBody>> CreatePerturbedChain(ChSystemNSC& sys, int num_links) {
+    auto bodies = CreateChain(sys, num_links);
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseQR>());
+    for (int i = 0; i < num_links; i++)
+        bodies[i]->SetPos(bodies[i]->GetPos() + ChVector3d(0.02, 0.05 * std::sin(i), 0.01 * std::cos(i)));
+    return bodies;
+}
+
+static double MaxConstraintViolation(const ChSystem& sys) {
+    double violation = 0;
+    for (const auto& link : sys.GetLinks())
+        violation = std::max(violation, link->GetConstraintViolation().lpNorm<Eigen::Infinity>());
+    return violation;
+}
+
+TEST(FullAssembly, FactorizationReuse) {
+    int num_links = 20;
+
+    ChSystemNSC sys_ref;
+    CreatePerturbedChain(sys_ref, num_links);
+    sys_ref.DoAssembly(AssemblyLevel::POSITION, 10);
+
+    ChSystemNSC sys_reuse;
+    CreatePerturbedChain(sys_reuse, num_links);
+    sys_reuse.EnableAssemblyFactorizationReuse(true);
+    sys_reuse.DoAssembly(AssemblyLevel::POSITION, 50);
+
+    ASSERT_LT(MaxConstraintViolation(sys_ref), 1e-8);
+    ASSERT_LT(MaxConstraintViolation(sys_reuse), 1e-8);
+    ASSERT_LT(sys_reuse.GetSolverSetupCount(), sys_ref.GetSolverSetupCount());
+}
+
+TEST(FullAssembly, Cache) {
+    int num_links = 20;
+    const std::string filename = "assembly_cache.dat";
+
+    auto cache = chrono_types::make_shared<ChAssemblyCache>();
+    ChSystemNSC sys1;
+    auto bodies1 = CreatePerturbedChain(sys1, num_links);
+    sys1.SetAssemblyCache(cache);
+    sys1.DoAssembly(AssemblyLevel::FULL);
+    ASSERT_EQ(cache->GetNumEntries(), 1);
+    ASSERT_EQ(cache->GetNumMisses(), 1);
+    ASSERT_TRUE(cache->Save(filename));
+
+    // An identical system assembled with the persisted cache does not solve
+    auto cache_loaded = chrono_types::make_shared<ChAssemblyCache>();
+    ASSERT_TRUE(cache_loaded->Load(filename));
+    ChSystemNSC sys2;
+    auto bodies2 = CreatePerturbedChain(sys2, num_links);
+    sys2.SetAssemblyCache(cache_loaded);
+    sys2.DoAssembly(AssemblyLevel::FULL);
+    ASSERT_EQ(cache_loaded->GetNumHits(), 1);
+    ASSERT_EQ(sys2.GetSolverSolveCount(), 0);
+    for (int i = 0; i < num_links; i++) {
+        ASSERT_LT((bodies1[i]->GetPos() - bodies2[i]->GetPos()).Length(), 1e-14);
+        ASSERT_LT((bodies1[i]->GetPosDt() - bodies2[i]->GetPosDt()).Length(), 1e-14);
+        ASSERT_LT((bodies1[i]->GetPosDt2() - bodies2[i]->GetPosDt2()).Length(), 1e-12);
+    }
+
+    // A change in a model parameter is a cache miss
+    ChSystemNSC sys3;
+    auto bodies3 = CreatePerturbedChain(sys3, num_links);
+    bodies3[5]->SetMass(2.0);
+    sys3.SetAssemblyCache(cache_loaded);
+    sys3.DoAssembly(AssemblyLevel::FULL);
+    ASSERT_EQ(cache_loaded->GetNumMisses(), 1);
+    ASSERT_EQ(cache_loaded->GetNumEntries(), 2);
+    ASSERT_LT(MaxConstraintViolation(sys3), 1e-8);
+
+    std::remove(filename.c_str());
+}
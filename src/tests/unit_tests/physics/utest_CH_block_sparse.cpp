@@ -0,0 +1,132 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for the block-sparse system matrix and the iterative linear solvers
+// using it.
+//
+// A chain of bodies connected through spherical joints, hinged to the ground,
+// is simulated with MINRES, using either the matrix-free descriptor product
+// or the block-sparse system matrix with block Jacobi preconditioning.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const int num_links = 10;
+
+static std::shared_ptr<ChBody> CreateChain(ChSystem& sys, bool block) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+    auto solver = chrono_types::make_shared<ChSolverMINRES>();
+    solver->SetMaxIterations(2000);
+    solver->SetTolerance(1e-12);
+    solver->UseBlockSparseMatrix(block);
+    sys.SetSolver(solver);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+    auto prev = ground;
+    for (int i = 0; i < num_links; i++) {
+        auto link = chrono_types::make_shared<ChBodyEasyBox>(1, 0.1, 0.1, 1000, false, false);
+        link->SetPos(ChVector3d(i + 0.5, 0, 0));
+        sys.AddBody(link);
+
+        if (i == 0) {
+            rev->Initialize(ground, link, ChFrame<>(ChVector3d(0, 0, 0)));
+            sys.AddLink(rev);
+        } else {
+            auto sph = chrono_types::make_shared<ChLinkLockSpherical>();
+            sph->Initialize(prev, link, ChFrame<>(ChVector3d(i, 0, 0)));
+            sys.AddLink(sph);
+        }
+        prev = link;
+    }
+
+    return prev;
+}
+
+TEST(ChBlockSparseMatrix, system_product) {
+    ChSystemSMC sys;
+    CreateChain(sys, false);
+    sys.DoStepDynamics(1e-3);
+
+    auto& sysd = *sys.GetSystemDescriptor();
+    int n = sysd.CountActiveVariables() + sysd.CountActiveConstraints();
+
+    // One block per moving body and per joint
+    std::vector<int> block_start;
+    sysd.ComputeBlockPartition(block_start);
+    ASSERT_EQ((int)block_start.size(), 2 * num_links + 1);
+    ASSERT_EQ(block_start[1] - block_start[0], 6);
+    ASSERT_EQ(block_start[num_links + 1] - block_start[num_links], 5);
+    ASSERT_EQ(block_start[num_links + 2] - block_start[num_links + 1], 3);
+    ASSERT_EQ(block_start.back(), n);
+
+    ChSparseMatrix Z;
+    sysd.BuildSystemMatrix(&Z, nullptr);
+    ChBlockSparseMatrix A;
+    A.SetNumThreads(2);
+    A.Build(Z, block_start);
+    ASSERT_EQ(A.GetNumRows(), n);
+    ASSERT_EQ(A.GetNumBlocks(), 2 * num_links);
+
+    // Products with the block matrix, the scalar matrix, and the descriptor coincide
+    ChVectorDynamic<> x = ChVectorDynamic<>::Random(n);
+    ChVectorDynamic<> y(n);
+    ChVectorDynamic<> y_desc(n);
+    A.Multiply(x, y);
+    sysd.SystemProduct(y_desc, x);
+    ChVectorDynamic<> y_sparse = Z * x;
+    ASSERT_LT((y - y_sparse).lpNorm<Eigen::Infinity>(), 1e-10 * y_sparse.lpNorm<Eigen::Infinity>());
+    ASSERT_LT((y - y_desc).lpNorm<Eigen::Infinity>(), 1e-10 * y_desc.lpNorm<Eigen::Infinity>());
+
+    // Block Jacobi: body blocks are inverted, joint blocks (no compliance) fall back to unit scaling
+    ASSERT_EQ(A.SetupBlockJacobi(), num_links);
+    ChVectorDynamic<> z(n);
+    A.ApplyBlockJacobi(y, z);
+    ChMatrixDynamic<> D = Z.block(0, 0, 6, 6).toDense();
+    ASSERT_LT((D * z.head(6) - y.head(6)).norm(), 1e-10 * y.head(6).norm());
+    ASSERT_EQ(z.tail(n - block_start[num_links]), y.tail(n - block_start[num_links]));
+}
+
+TEST(ChSolverMINRES, block_sparse) {
+    ChSystemSMC sys_free;
+    ChSystemSMC sys_block;
+    auto end_free = CreateChain(sys_free, false);
+    auto end_block = CreateChain(sys_block, true);
+
+    for (int i = 0; i < 100; i++) {
+        sys_free.DoStepDynamics(1e-3);
+        sys_block.DoStepDynamics(1e-3);
+    }
+
+    ASSERT_GT((end_free->GetPos() - ChVector3d(num_links - 0.5, 0, 0)).Length(), 1e-2);
+    ASSERT_LT((end_block->GetPos() - end_free->GetPos()).Length(), 1e-6);
+
+    // The block Jacobi preconditioner does not require more iterations than the diagonal one
+    auto solver_free = std::static_pointer_cast<ChSolverMINRES>(sys_free.GetSolver());
+    auto solver_block = std::static_pointer_cast<ChSolverMINRES>(sys_block.GetSolver());
+    ASSERT_LE(solver_block->GetIterations(), solver_free->GetIterations());
+}
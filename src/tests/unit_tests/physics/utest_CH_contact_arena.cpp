@@ -0,0 +1,164 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Tests for the arena storage of contact objects.
+// Contacts are added over several cycles with a varying number of contacts, as
+// done by the contact containers at each step. Checks include the stability of
+// contact addresses, the reuse of contact objects, and their destruction.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChContactArena.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Dummy contact type, counting constructions and destructions
+struct DummyContact {
+    DummyContact(int id) : id(id) { num_constructed++; }
+    ~DummyContact() { num_destroyed++; }
+    int id;
+    double data[5];
+    static int num_constructed;
+    static int num_destroyed;
+};
+
+int DummyContact::num_constructed = 0;
+int DummyContact::num_destroyed = 0;
+
+// Add the specified number of contacts, reusing existing ones when possible
+void AddContacts(ChContactArena<DummyContact, 16>& arena, int num_contacts) {
+    arena.Rewind();
+    for (int i = 0; i < num_contacts; i++) {
+        if (DummyContact* c = arena.ReuseNext())
+            c->id = i;
+        else
+            arena.Emplace(i);
+    }
+}
+
+TEST(ChContactArena, reuse) {
+    DummyContact::num_constructed = 0;
+    DummyContact::num_destroyed = 0;
+
+    {
+        ChContactArena<DummyContact, 16> arena;
+        ASSERT_TRUE(arena.empty());
+
+        AddContacts(arena, 40);
+        ASSERT_EQ(arena.size(), 40);
+        ASSERT_EQ(DummyContact::num_constructed, 40);
+
+        std::vector<DummyContact*> addresses;
+        for (auto c : arena)
+            addresses.push_back(c);
+
+        // Growing beyond the current capacity must not move existing contacts
+        AddContacts(arena, 100);
+        ASSERT_EQ(arena.size(), 100);
+        ASSERT_EQ(DummyContact::num_constructed, 100);
+        for (size_t i = 0; i < addresses.size(); i++)
+            ASSERT_EQ(arena[i], addresses[i]);
+
+        // Fewer contacts: no constructions or destructions, contacts reused in order
+        AddContacts(arena, 25);
+        ASSERT_EQ(arena.size(), 25);
+        ASSERT_EQ(arena.capacity(), 100);
+        ASSERT_EQ(DummyContact::num_constructed, 100);
+        ASSERT_EQ(DummyContact::num_destroyed, 0);
+        int k = 0;
+        for (auto c : arena) {
+            ASSERT_EQ(c->id, k);
+            ASSERT_EQ(c, arena[k]);
+            k++;
+        }
+        ASSERT_EQ(k, 25);
+
+        // Up to the previous maximum: still no new constructions
+        AddContacts(arena, 100);
+        ASSERT_EQ(DummyContact::num_constructed, 100);
+
+        arena.Clear();
+        ASSERT_EQ(DummyContact::num_destroyed, 100);
+        ASSERT_EQ(arena.capacity(), 0);
+
+        AddContacts(arena, 10);
+    }
+
+    // Destruction of the arena destroys all constructed contacts
+    ASSERT_EQ(DummyContact::num_constructed, 110);
+    ASSERT_EQ(DummyContact::num_destroyed, 110);
+}
+
+// Drop a few boxes on a ground box and check the number of contacts reported by the container.
+template <class Tsys, class Tmat>
+void TestContainer() {
+    Tsys sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    auto mat = chrono_types::make_shared<Tmat>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 10, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < 5; i++) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, false, true, mat);
+        box->SetPos(ChVector3d(-4 + 2 * i, 0, 0.5 + 0.1 * i));
+        sys.AddBody(box);
+    }
+
+    unsigned int max_contacts = 0;
+    for (int i = 0; i < 500; i++) {
+        sys.DoStepDynamics(1e-3);
+        max_contacts = std::max(max_contacts, sys.GetNumContacts());
+
+        class ContactCounter : public ChContactContainer::ReportContactCallback {
+          public:
+            virtual bool OnReportContact(const ChVector3d&,
+                                         const ChVector3d&,
+                                         const ChMatrix33<>&,
+                                         const double&,
+                                         const double&,
+                                         const ChVector3d&,
+                                         const ChVector3d&,
+                                         ChContactable*,
+                                         ChContactable*) override {
+                count++;
+                return true;
+            }
+            unsigned int count = 0;
+        };
+        auto counter = chrono_types::make_shared<ContactCounter>();
+        sys.GetContactContainer()->ReportAllContacts(counter);
+        ASSERT_EQ(counter->count, sys.GetNumContacts());
+    }
+
+    ASSERT_GT(max_contacts, 0);
+}
+
+TEST(ChContactArena, container_NSC) {
+    TestContainer<ChSystemNSC, ChContactMaterialNSC>();
+}
+
+TEST(ChContactArena, container_SMC) {
+    TestContainer<ChSystemSMC, ChContactMaterialSMC>();
+}
@@ -0,0 +1,145 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for the persistent contact identity used to warm start NSC contact
+// multipliers. Contacts between two boxes are added directly to the contact
+// container, over several (collision) steps. The initial reactions of each new
+// contact must be those of the matching contact at the previous step (scaled by
+// the decay factor), or zero if no contact matches.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerNSC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+class WarmStartModel {
+  public:
+    WarmStartModel() {
+        auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+        ground = chrono_types::make_shared<ChBodyEasyBox>(4, 4, 1, 1000, false, true, mat);
+        ground->SetPos(ChVector3d(0, 0, -0.5));
+        ground->SetFixed(true);
+        sys.AddBody(ground);
+
+        box = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, false, true, mat);
+        box->SetPos(ChVector3d(0, 0, 0.5));
+        sys.AddBody(box);
+
+        container = std::dynamic_pointer_cast<ChContactContainerNSC>(sys.GetContactContainer());
+        container->EnableWarmStart(true);
+        container->SetWarmStartDecay(0.5);
+        container->SetWarmStartTolerance(0.01);
+    }
+
+    // Contact between the box (A) and the ground (B) at the specified point on the box bottom face
+    ChCollisionInfo Contact(const ChVector3d& point) {
+        ChCollisionInfo cinfo;
+        cinfo.modelA = box->GetCollisionModel().get();
+        cinfo.modelB = ground->GetCollisionModel().get();
+        cinfo.shapeA = box->GetCollisionModel()->GetShapeInstance(0).first.get();
+        cinfo.shapeB = ground->GetCollisionModel()->GetShapeInstance(0).first.get();
+        cinfo.vpA = point;
+        cinfo.vpB = point;
+        cinfo.vN = ChVector3d(0, 0, -1);
+        cinfo.distance = 0;
+        return cinfo;
+    }
+
+    // Add the given contacts (as done by the collision system at each step) and return their initial reactions
+    ChVectorDynamic<> AddContacts(const std::vector<ChCollisionInfo>& contacts) {
+        container->BeginAddContact();
+        for (const auto& cinfo : contacts)
+            container->AddContact(cinfo);
+        container->EndAddContact();
+
+        ChVectorDynamic<> L(container->GetNumConstraints());
+        container->IntStateGatherReactions(0, L);
+        return L;
+    }
+
+    // Set the reactions of the current contacts (as done after the solver call)
+    void SetReactions(const ChVectorDynamic<>& L) { container->IntStateScatterReactions(0, L); }
+
+    ChSystemNSC sys;
+    std::shared_ptr<ChBody> ground;
+    std::shared_ptr<ChBody> box;
+    std::shared_ptr<ChContactContainerNSC> container;
+};
+
+TEST(ChContactContainerNSC, warm_start) {
+    WarmStartModel model;
+    ChVector3d p1(-0.5, -0.5, 0);
+    ChVector3d p2(+0.5, +0.5, 0);
+
+    // New contacts start from zero reactions
+    auto L = model.AddContacts({model.Contact(p1), model.Contact(p2)});
+    ASSERT_EQ(L.size(), 6);
+    ASSERT_EQ(L.norm(), 0);
+
+    ChVectorDynamic<> R(6);
+    R << 4, 0.5, -0.25, 2, -1, 1;
+    model.SetReactions(R);
+
+    // Matching contacts (reported in a different order, and moved within the tolerance) reuse the scaled reactions
+    L = model.AddContacts({model.Contact(p2 + ChVector3d(0.005, 0, 0)), model.Contact(p1)});
+    ASSERT_EQ(L.size(), 6);
+    for (int i = 0; i < 3; i++) {
+        ASSERT_NEAR(L(i), 0.5 * R(3 + i), 1e-6);
+        ASSERT_NEAR(L(3 + i), 0.5 * R(i), 1e-6);
+    }
+
+    // Contacts moved beyond the tolerance (or on a different shape pair) are reset
+    model.SetReactions(R);
+    L = model.AddContacts({model.Contact(p1 + ChVector3d(0.05, 0, 0)), model.Contact(p2)});
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQ(L(i), 0);
+        ASSERT_NEAR(L(3 + i), 0.5 * R(3 + i), 1e-6);
+    }
+
+    // Each contact of the previous step is matched at most once
+    model.SetReactions(R);
+    L = model.AddContacts({model.Contact(p2), model.Contact(p2)});
+    ASSERT_NEAR(L(0), 0.5 * R(3), 1e-6);
+    ASSERT_EQ(L(3), 0);
+
+    // The warm start cache is relative to the box frame, so contacts moving with the box are matched
+    model.AddContacts({model.Contact(p2)});
+    model.SetReactions(R.head(3));
+    model.box->SetPos(model.box->GetPos() + ChVector3d(1, 0, 0));
+    L = model.AddContacts({model.Contact(p2 + ChVector3d(1, 0, 0))});
+    ASSERT_NEAR(L(0), 0.5 * R(0), 1e-6);
+
+    // Contacts with a reaction cache provided by the collision system are not affected
+    float cache[6] = {1, 2, 3, 0, 0, 0};
+    auto cinfo = model.Contact(p2 + ChVector3d(1, 0, 0));
+    cinfo.reaction_cache = cache;
+    L = model.AddContacts({cinfo});
+    ASSERT_EQ(L(0), 1);
+    ASSERT_EQ(L(1), 2);
+    ASSERT_EQ(L(2), 3);
+
+    // Without warm starting, all contacts start from zero reactions
+    model.SetReactions(R.head(3));
+    model.AddContacts({model.Contact(p2 + ChVector3d(1, 0, 0))});
+    model.SetReactions(R.head(3));
+    model.container->EnableWarmStart(false);
+    L = model.AddContacts({model.Contact(p2 + ChVector3d(1, 0, 0))});
+    ASSERT_EQ(L.norm(), 0);
+}
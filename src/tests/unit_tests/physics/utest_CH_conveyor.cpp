@@ -0,0 +1,104 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for conveyor belts with and without analytical belt-part contact.
+// A box-shaped part dropped on a fixed conveyor must come to rest on the belt
+// and travel with the belt speed.
+//
+// =============================================================================
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChConveyor.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static void TransportPart(bool analytical) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+    double belt_thickness = 0.1;
+    double belt_speed = 0.5;
+    auto conveyor = chrono_types::make_shared<ChConveyor>(4.0, belt_thickness, 1.0);
+    conveyor->SetFixed(true);
+    conveyor->SetConveyorSpeed(belt_speed);
+    conveyor->EnableAnalyticalContact(analytical);
+    sys.Add(conveyor);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.6f);
+
+    ChVector3d size(0.2, 0.1, 0.2);
+    auto part = chrono_types::make_shared<ChBodyEasyBox>(size.x(), size.y(), size.z(), 500, false, true, mat);
+    part->SetPos(ChVector3d(-1.0, belt_thickness / 2 + size.y() / 2 + 0.01, 0));
+    sys.AddBody(part);
+    if (analytical)
+        conveyor->AddBoxPart(part, size);
+
+    ASSERT_EQ(conveyor->IsAnalyticalContactEnabled(), analytical);
+    ASSERT_EQ(conveyor->GetNumParts(), analytical ? 1 : 0);
+
+    while (sys.GetChTime() < 1.0) {
+        sys.DoStepDynamics(1e-3);
+    }
+
+    // The part rests on the belt and moves with the belt
+    ASSERT_GT(sys.GetNumContacts(), 0);
+    ASSERT_NEAR(part->GetPos().y(), belt_thickness / 2 + size.y() / 2, 5e-3);
+    ASSERT_NEAR(part->GetPosDt().x(), belt_speed, 1e-2);
+    ASSERT_NEAR(part->GetPosDt().y(), 0.0, 1e-2);
+    ASSERT_GT(part->GetPos().x(), -1.0 + 0.5 * belt_speed);
+}
+
+TEST(ChConveyor, collision) {
+    TransportPart(false);
+}
+
+TEST(ChConveyor, analytical_contact) {
+    TransportPart(true);
+}
+
+TEST(ChConveyor, analytical_contact_only) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto conveyor = chrono_types::make_shared<ChConveyor>(4.0, 0.1, 1.0);
+    conveyor->SetFixed(true);
+    sys.Add(conveyor);
+
+    // Parts not registered with the conveyor do not collide with the belt in analytical mode,
+    // also when the mode is switched after the conveyor was added to the system.
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    auto part = chrono_types::make_shared<ChBodyEasySphere>(0.1, 500, false, true, mat);
+    part->SetPos(ChVector3d(0, 0.1, 0));
+    sys.AddBody(part);
+
+    sys.DoStepDynamics(1e-3);
+    ASSERT_GT(sys.GetNumContacts(), 0);
+
+    conveyor->EnableAnalyticalContact(true);
+    sys.DoStepDynamics(1e-3);
+    ASSERT_EQ(sys.GetNumContacts(), 0);
+
+    conveyor->AddPart(part, {ChVector3d(0, 0, 0)}, 0.1);
+    sys.DoStepDynamics(1e-3);
+    ASSERT_EQ(sys.GetNumContacts(), 1);
+
+    conveyor->RemoveAllParts();
+    conveyor->EnableAnalyticalContact(false);
+    sys.DoStepDynamics(1e-3);
+    ASSERT_GT(sys.GetNumContacts(), 0);
+}
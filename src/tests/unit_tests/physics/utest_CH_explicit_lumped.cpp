@@ -0,0 +1,80 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for explicit integration with diagonal mass lumping. For systems
+// without constraints, the system descriptor is not used and the results must
+// match those obtained with the (non-lumped) solver path.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChLinkLock.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Create a system with two free spinning bodies, integrated with the explicit Euler method
+static void CreateSystem(ChSystemSMC& sys, std::vector<std::shared_ptr<ChBody>>& bodies, bool lumping) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    for (int i = 0; i < 2; i++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetMass(2.0 + i);
+        body->SetInertiaXX(ChVector3d(0.1, 0.2 + 0.1 * i, 0.3));
+        body->SetPos(ChVector3d(i, 0, 0));
+        body->SetPosDt(ChVector3d(1, 2, 0));
+        body->SetAngVelLocal(ChVector3d(1, 2, 3));
+        sys.AddBody(body);
+        bodies.push_back(body);
+    }
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_EXPLICIT);
+    if (lumping)
+        std::dynamic_pointer_cast<ChExplicitTimestepper>(sys.GetTimestepper())->SetDiagonalLumpingON();
+}
+
+TEST(ChSystem, explicit_lumped) {
+    ChSystemSMC sys_lumped;
+    ChSystemSMC sys_solver;
+    std::vector<std::shared_ptr<ChBody>> bodies_lumped;
+    std::vector<std::shared_ptr<ChBody>> bodies_solver;
+    CreateSystem(sys_lumped, bodies_lumped, true);
+    CreateSystem(sys_solver, bodies_solver, false);
+
+    double step = 1e-3;
+    for (int n = 0; n < 500; n++) {
+        sys_lumped.DoStepDynamics(step);
+        sys_solver.DoStepDynamics(step);
+    }
+
+    // No descriptor construction with lumping
+    ASSERT_TRUE(sys_lumped.GetSystemDescriptor()->GetVariables().empty());
+    ASSERT_EQ(sys_solver.GetSystemDescriptor()->GetVariables().size(), 2u);
+
+    for (int i = 0; i < 2; i++) {
+        ASSERT_LE((bodies_lumped[i]->GetPos() - bodies_solver[i]->GetPos()).Length(), 1e-10);
+        ASSERT_LE((bodies_lumped[i]->GetPosDt() - bodies_solver[i]->GetPosDt()).Length(), 1e-10);
+        ASSERT_LE((bodies_lumped[i]->GetRot() - bodies_solver[i]->GetRot()).Length(), 1e-10);
+        ASSERT_LE((bodies_lumped[i]->GetAngVelLocal() - bodies_solver[i]->GetAngVelLocal()).Length(), 1e-10);
+    }
+
+    // With constraints (handled with penalty), the descriptor is used
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys_lumped.AddBody(ground);
+    auto joint = chrono_types::make_shared<ChLinkLockSpherical>();
+    joint->Initialize(ground, bodies_lumped[0], ChFrame<>(bodies_lumped[0]->GetPos()));
+    sys_lumped.AddLink(joint);
+    sys_lumped.DoStepDynamics(step);
+    ASSERT_FALSE(sys_lumped.GetSystemDescriptor()->GetVariables().empty());
+}
@@ -0,0 +1,107 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Tests for the Newton matrix update policies of implicit timesteppers.
+//
+// The model consists of a pendulum connected to ground through a revolute joint
+// and moving under gravity. The simulation results obtained with automatic
+// Newton matrix updates are compared against those obtained with updates at
+// each step (HHT) or at each iteration (Euler implicit).
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Simulate the pendulum for 1 s with the given timestepper and Newton matrix update policy.
+// Return the final position of the pendulum body and the number of solver Setup and Solve calls.
+ChVector3d SimulatePendulum(ChTimestepper::Type type,
+                            ChImplicitIterativeTimestepper::JacobianUpdate method,
+                            unsigned long& num_setups,
+                            unsigned long& num_solves) {
+    ChSystemNSC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto pend = chrono_types::make_shared<ChBodyEasyBox>(1.0, 0.1, 0.1, 1000, false, false);
+    pend->SetPos(ChVector3d(0.5, 0, 0));
+    sys.AddBody(pend);
+
+    auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev->Initialize(ground, pend, ChFrame<>(ChVector3d(0, 0, 0), QUNIT));
+    sys.AddLink(rev);
+
+    auto solver = chrono_types::make_shared<ChSolverSparseQR>();
+    sys.SetSolver(solver);
+
+    sys.SetTimestepperType(type);
+    auto integrator = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(sys.GetTimestepper());
+    integrator->SetMaxIters(20);
+    integrator->SetAbsTolerances(1e-8);
+    integrator->SetJacobianUpdateMethod(method);
+    if (auto hht = std::dynamic_pointer_cast<ChTimestepperHHT>(integrator))
+        hht->SetStepControl(false);
+
+    double step = 1e-3;
+    while (sys.GetChTime() < 1.0 - step / 2)
+        sys.DoStepDynamics(step);
+
+    num_setups = integrator->GetTotalNumSetupCalls();
+    num_solves = integrator->GetTotalNumSolveCalls();
+
+    return pend->GetPos();
+}
+
+TEST(ChTimestepperHHT, jacobian_reuse) {
+    unsigned long setups_ref, solves_ref;
+    unsigned long setups, solves;
+    auto pos_ref = SimulatePendulum(ChTimestepper::Type::HHT,
+                                    ChImplicitIterativeTimestepper::JacobianUpdate::EVERY_STEP, setups_ref, solves_ref);
+    auto pos = SimulatePendulum(ChTimestepper::Type::HHT, ChImplicitIterativeTimestepper::JacobianUpdate::AUTOMATIC,
+                                setups, solves);
+
+    std::cout << "HHT  EVERY_STEP: setups = " << setups_ref << "  solves = " << solves_ref << std::endl;
+    std::cout << "HHT  AUTOMATIC:  setups = " << setups << "  solves = " << solves << std::endl;
+
+    ASSERT_NEAR((pos - pos_ref).Length(), 0.0, 1e-4);
+    ASSERT_EQ(setups_ref, 1000);
+    ASSERT_LT(setups, setups_ref);
+}
+
+TEST(ChTimestepperEulerImplicit, jacobian_reuse) {
+    unsigned long setups_ref, solves_ref;
+    unsigned long setups, solves;
+    auto pos_ref = SimulatePendulum(ChTimestepper::Type::EULER_IMPLICIT,
+                                    ChImplicitIterativeTimestepper::JacobianUpdate::EVERY_ITERATION, setups_ref,
+                                    solves_ref);
+    auto pos = SimulatePendulum(ChTimestepper::Type::EULER_IMPLICIT,
+                                ChImplicitIterativeTimestepper::JacobianUpdate::AUTOMATIC, setups, solves);
+
+    std::cout << "Euler  EVERY_ITERATION: setups = " << setups_ref << "  solves = " << solves_ref << std::endl;
+    std::cout << "Euler  AUTOMATIC:       setups = " << setups << "  solves = " << solves << std::endl;
+
+    ASSERT_NEAR((pos - pos_ref).Length(), 0.0, 1e-4);
+    ASSERT_EQ(setups_ref, solves_ref);
+    ASSERT_LT(setups, setups_ref);
+}
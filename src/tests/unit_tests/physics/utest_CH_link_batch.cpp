@@ -0,0 +1,117 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Tests for the batched update of mate links.
+//
+// The model consists of a chain of bodies with arbitrary initial orientations,
+// connected through a mix of spherical, revolute, cylindrical, and planar mates
+// and lock-formulation revolute and spherical joints, moving under gravity. The
+// planar mate is not batched and is updated individually. The simulation results obtained with batched link updates are
+// compared against those obtained with individual link updates.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkMate.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Create a link of type Tlink, initialized through the frame-based initialization of its base class Tbase.
+template <class Tlink, class Tbase>
+std::shared_ptr<ChLinkBase> CreateLink(std::shared_ptr<ChBody> body1,
+                                       std::shared_ptr<ChBody> body2,
+                                       const ChFrame<>& frame) {
+    auto link = chrono_types::make_shared<Tlink>();
+    std::static_pointer_cast<Tbase>(link)->Initialize(body1, body2, frame);
+    return link;
+}
+
+// Simulate the chain for 0.5 s, with or without batched link updates.
+// Return the final positions of all bodies in the chain.
+std::vector<ChVector3d> SimulateChain(bool batch, int num_threads) {
+    ChSystemNSC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys.SetNumThreads(num_threads);
+    sys.EnableLinkBatching(batch);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    int num_bodies = 12;
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    std::shared_ptr<ChBody> prev = ground;
+    for (int i = 0; i < num_bodies; i++) {
+        auto body = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.1, 0.1, 1000, false, false);
+        body->SetPos(ChVector3d(0.5 * i + 0.25, 0, 0));
+        body->SetRot(QuatFromAngleAxis(0.3 * i, ChVector3d(1, 2, 3).GetNormalized()));
+        sys.AddBody(body);
+        bodies.push_back(body);
+
+        ChQuaternion<> joint_rot = QuatFromAngleAxis(0.2 * i, ChVector3d(3, 1, 2).GetNormalized());
+        ChFrame<> joint_frame(ChVector3d(0.5 * i, 0, 0), joint_rot);
+        std::shared_ptr<ChLinkBase> link;
+        switch (i % 6) {
+            case 0:
+                link = CreateLink<ChLinkMateRevolute, ChLinkMateGeneric>(body, prev, joint_frame);
+                break;
+            case 1:
+                link = CreateLink<ChLinkMateSpherical, ChLinkMateGeneric>(body, prev, joint_frame);
+                break;
+            case 2:
+                link = CreateLink<ChLinkMateCylindrical, ChLinkMateGeneric>(body, prev, joint_frame);
+                break;
+            case 3:
+                link = CreateLink<ChLinkMatePlanar, ChLinkMateGeneric>(body, prev, joint_frame);
+                break;
+            case 4:
+                link = CreateLink<ChLinkLockRevolute, ChLinkMarkers>(body, prev, joint_frame);
+                break;
+            case 5:
+                link = CreateLink<ChLinkLockSpherical, ChLinkMarkers>(body, prev, joint_frame);
+                break;
+        }
+        sys.AddLink(link);
+        prev = body;
+    }
+
+    auto solver = chrono_types::make_shared<ChSolverSparseQR>();
+    sys.SetSolver(solver);
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+    double step = 1e-3;
+    while (sys.GetChTime() < 0.5 - step / 2)
+        sys.DoStepDynamics(step);
+
+    std::vector<ChVector3d> pos;
+    for (const auto& body : bodies)
+        pos.push_back(body->GetPos());
+    return pos;
+}
+
+TEST(ChLinkMateBatch, simulation) {
+    auto pos_ref = SimulateChain(false, 1);
+    auto pos_seq = SimulateChain(true, 1);
+    auto pos_par = SimulateChain(true, 4);
+
+    for (size_t i = 0; i < pos_ref.size(); i++) {
+        ASSERT_NEAR((pos_seq[i] - pos_ref[i]).Length(), 0.0, 1e-10);
+        ASSERT_NEAR((pos_par[i] - pos_ref[i]).Length(), 0.0, 1e-10);
+    }
+}
@@ -0,0 +1,117 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Tests for the material-pair table of composite contact materials.
+// Checks that the composition strategy is invoked once per material pair and
+// step, and that cached composites match directly composed ones, also for
+// materials that cannot be stored in the table.
+//
+// =============================================================================
+
+#include "chrono/physics/ChContactMaterialTable.h"
+#include "chrono/physics/ChContactMaterialNSC.h"
+#include "chrono/physics/ChContactMaterialSMC.h"
+#include "chrono/collision/ChCollisionShapeSphere.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Composition strategy counting the number of friction combinations
+class CountingStrategy : public ChContactMaterialCompositionStrategy {
+  public:
+    virtual float CombineFriction(float a1, float a2) const override {
+        num_calls++;
+        return a1 * a2;
+    }
+    mutable int num_calls = 0;
+};
+
+TEST(ChContactMaterialTable, composition) {
+    auto mat1 = chrono_types::make_shared<ChContactMaterialNSC>();
+    auto mat2 = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat1->SetFriction(0.5f);
+    mat2->SetFriction(0.8f);
+
+    // Materials receive identifiers when attached to collision shapes
+    ASSERT_LT(mat1->GetId(), 0);
+    ChCollisionShapeSphere shape1(mat1, 1.0);
+    ChCollisionShapeSphere shape2(mat2, 1.0);
+    ASSERT_GE(mat1->GetId(), 0);
+    ASSERT_NE(mat1->GetId(), mat2->GetId());
+
+    // Copies do not inherit the identifier
+    std::shared_ptr<ChContactMaterialNSC> mat3(mat1->Clone());
+    ASSERT_LT(mat3->GetId(), 0);
+
+    CountingStrategy strategy;
+    ChContactMaterialTable<ChContactMaterialNSC, ChContactMaterialCompositeNSC> table;
+
+    for (int step = 0; step < 2; step++) {
+        table.Reset();
+        strategy.num_calls = 0;
+        for (int i = 0; i < 100; i++) {
+            auto cmat12 = table.GetComposite(&strategy, mat1, mat2);
+            auto cmat21 = table.GetComposite(&strategy, mat2, mat1);
+            auto cmat11 = table.GetComposite(&strategy, mat1, mat1);
+            ASSERT_FLOAT_EQ(cmat12.static_friction, 0.4f);
+            ASSERT_FLOAT_EQ(cmat21.static_friction, 0.4f);
+            ASSERT_FLOAT_EQ(cmat11.static_friction, 0.25f);
+        }
+        // 3 pairs, 4 friction combinations (static, sliding, rolling, spinning) for each
+        ASSERT_EQ(table.GetNumComposites(), 3);
+        ASSERT_EQ(strategy.num_calls, 12);
+
+        // Materials without identifier are composed directly
+        strategy.num_calls = 0;
+        table.GetComposite(&strategy, mat3, mat2);
+        table.GetComposite(&strategy, mat3, mat2);
+        ASSERT_EQ(table.GetNumComposites(), 3);
+        ASSERT_EQ(strategy.num_calls, 8);
+    }
+
+    // Changes to material properties are picked up after a reset
+    mat2->SetFriction(0.2f);
+    table.Reset();
+    ASSERT_FLOAT_EQ(table.GetComposite(&strategy, mat1, mat2).static_friction, 0.1f);
+}
+
+TEST(ChContactMaterialTable, capacity) {
+    std::vector<std::shared_ptr<ChContactMaterialSMC>> mats;
+    std::vector<std::shared_ptr<ChCollisionShapeSphere>> shapes;
+    for (int i = 0; i < 6; i++) {
+        auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+        mat->SetYoungModulus(1e7f * (i + 1));
+        mat->SetFriction(0.1f * (i + 1));
+        shapes.push_back(chrono_types::make_shared<ChCollisionShapeSphere>(mat, 1.0));
+        mats.push_back(mat);
+    }
+
+    ChContactMaterialCompositionStrategy strategy;
+    ChContactMaterialTable<ChContactMaterialSMC, ChContactMaterialCompositeSMC> table(4);
+    table.Reset();
+
+    // Pairs beyond the table capacity are still composed correctly
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 6; j++) {
+            auto cmat = table.GetComposite(&strategy, mats[i], mats[j]);
+            ChContactMaterialCompositeSMC cmat_ref(&strategy, mats[i], mats[j]);
+            ASSERT_FLOAT_EQ(cmat.E_eff, cmat_ref.E_eff);
+            ASSERT_FLOAT_EQ(cmat.G_eff, cmat_ref.G_eff);
+            ASSERT_FLOAT_EQ(cmat.mu_eff, cmat_ref.mu_eff);
+            ASSERT_FLOAT_EQ(cmat.kn, cmat_ref.kn);
+        }
+    }
+    ASSERT_EQ(table.GetNumComposites(), 16);
+}
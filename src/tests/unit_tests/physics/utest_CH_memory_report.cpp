@@ -0,0 +1,86 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Tests for the per-subsystem memory report of a Chrono system.
+// A few boxes are dropped on a ground box; the reported memory of the collision
+// system, contact container, descriptor, and solver must be non-zero and the
+// high-water marks must bound the current values.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+template <class Tsys, class Tmat>
+void TestMemoryReport(bool direct_solver) {
+    Tsys sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    if (direct_solver)
+        sys.SetSolver(chrono_types::make_shared<ChSolverSparseLU>());
+    sys.EnableMemoryTracking(true);
+    auto mat = chrono_types::make_shared<Tmat>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 10, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < 5; i++) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, false, true, mat);
+        box->SetPos(ChVector3d(-4 + 2 * i, 0, 0.5 + 0.1 * i));
+        sys.AddBody(box);
+    }
+
+    // No memory tracked before the first step
+    ASSERT_EQ(sys.GetMemoryPeakReport().GetTotal(), 0);
+
+    for (int i = 0; i < 200; i++)
+        sys.DoStepDynamics(1e-3);
+    ASSERT_GT(sys.GetNumContacts(), 0);
+
+    auto report = sys.GetMemoryReport();
+    ASSERT_GT(report.collision_system, 0);
+    ASSERT_GT(report.contact_container, 0);
+    ASSERT_GT(report.descriptor, 0);
+    if (direct_solver)
+        ASSERT_GT(report.solver, 0);
+    ASSERT_EQ(report.meshes, 0);
+    ASSERT_EQ(report.GetTotal(), report.collision_system + report.contact_container + report.descriptor +
+                                     report.solver + report.meshes + report.other_items);
+
+    const auto& peak = sys.GetMemoryPeakReport();
+    ASSERT_GE(peak.collision_system, report.collision_system);
+    ASSERT_GE(peak.contact_container, report.contact_container);
+    ASSERT_GE(peak.descriptor, report.descriptor);
+    ASSERT_GE(peak.solver, report.solver);
+    ASSERT_GE(peak.GetTotal(), report.GetTotal());
+
+    sys.ResetMemoryPeakReport();
+    ASSERT_EQ(sys.GetMemoryPeakReport().GetTotal(), 0);
+}
+
+TEST(ChSystem, memory_report_NSC) {
+    TestMemoryReport<ChSystemNSC, ChContactMaterialNSC>(false);
+}
+
+TEST(ChSystem, memory_report_SMC) {
+    TestMemoryReport<ChSystemSMC, ChContactMaterialSMC>(true);
+}
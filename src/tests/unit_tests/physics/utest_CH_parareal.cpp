@@ -0,0 +1,107 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for the Parareal driver.
+//
+// A double pendulum is simulated with a coarse and a fine step size. The
+// Parareal solution must approach the serial fine solution as iterations are
+// performed, and coincide with it when iterating over all time slices.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/utils/ChParareal.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static std::shared_ptr<ChSystem> CreatePendulum() {
+    auto sys = chrono_types::make_shared<ChSystemNSC>();
+    sys->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys->SetSolver(chrono_types::make_shared<ChSolverSparseQR>());
+    sys->SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys->AddBody(ground);
+
+    auto body1 = chrono_types::make_shared<ChBodyEasyBox>(2, 0.2, 0.2, 1000, false, false);
+    body1->SetPos(ChVector3d(1, 0, 0));
+    sys->AddBody(body1);
+
+    auto body2 = chrono_types::make_shared<ChBodyEasyBox>(2, 0.2, 0.2, 1000, false, false);
+    body2->SetPos(ChVector3d(3, 0, 0));
+    sys->AddBody(body2);
+
+    auto rev1 = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev1->Initialize(ground, body1, ChFrame<>(ChVector3d(0, 0, 0)));
+    sys->AddLink(rev1);
+
+    auto rev2 = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev2->Initialize(body1, body2, ChFrame<>(ChVector3d(2, 0, 0)));
+    sys->AddLink(rev2);
+
+    return sys;
+}
+
+// Position of the free end of the pendulum after a serial simulation
+static ChVector3d SimulateSerial(double step, double t_end) {
+    auto sys = CreatePendulum();
+    while (sys->GetChTime() < t_end - 1e-6 * step)
+        sys->DoStepDynamics(step);
+    return sys->GetBodies()[2]->GetPos();
+}
+
+TEST(ChParareal, pendulum) {
+    double t_end = 1.6;
+    double coarse_step = 2e-2;
+    double fine_step = 1e-3;
+    int num_slices = 8;
+
+    auto pos_coarse = SimulateSerial(coarse_step, t_end);
+    auto pos_fine = SimulateSerial(fine_step, t_end);
+    double err_coarse = (pos_coarse - pos_fine).Length();
+    ASSERT_GT(err_coarse, 1e-3);
+
+    utils::ChParareal parareal(CreatePendulum);
+    parareal.SetCoarsePropagator(coarse_step);
+    parareal.SetFinePropagator(fine_step);
+    parareal.SetNumSlices(num_slices);
+    parareal.SetNumThreads(4);
+
+    // The error decreases with the number of iterations
+    double err_prev = err_coarse;
+    for (int iterations = 1; iterations <= 3; iterations++) {
+        parareal.SetMaxIterations(iterations);
+        parareal.SetTolerance(0);
+        parareal.Run(t_end);
+        ASSERT_EQ(parareal.GetNumIterations(), iterations);
+        ASSERT_NEAR(parareal.GetSliceTime(num_slices), t_end, 1e-12);
+
+        double err = (parareal.GetSystem()->GetBodies()[2]->GetPos() - pos_fine).Length();
+        ASSERT_LT(err, err_prev);
+        err_prev = err;
+    }
+
+    // Iterating over all slices yields the serial fine solution
+    parareal.SetMaxIterations(num_slices);
+    ASSERT_TRUE(parareal.Run(t_end));
+    auto sys = CreatePendulum();
+    parareal.LoadSliceState(num_slices, *sys);
+    ASSERT_LT((sys->GetBodies()[2]->GetPos() - pos_fine).Length(), 1e-8);
+}
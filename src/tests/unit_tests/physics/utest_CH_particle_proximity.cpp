@@ -0,0 +1,109 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Tests for the Verlet-list proximity container for particle clouds.
+// A cloud of particles with random initial velocities is simulated with a
+// repulsive pairwise force. At each step, the pairs reported by the container
+// are compared against a brute-force search over all particle pairs.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChParticleCloud.h"
+#include "chrono/physics/ChProximityContainerParticles.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+typedef std::vector<std::pair<unsigned int, unsigned int>> PairList;
+
+class PairCollector : public ChProximityContainerParticles::ReportPairCallback {
+  public:
+    virtual bool OnReportPair(unsigned int i, unsigned int j, const ChVector3d& rel_pos) override {
+        pairs.push_back({i, j});
+        return true;
+    }
+    PairList pairs;
+};
+
+class RepulsiveForce : public ChProximityContainerParticles::PairForceCallback {
+  public:
+    RepulsiveForce(double cutoff) : m_cutoff(cutoff) {}
+    virtual ChVector3d CalculateForce(const ChParticleCloud& cloud,
+                                      unsigned int i,
+                                      unsigned int j,
+                                      const ChVector3d& rel_pos,
+                                      const ChVector3d& rel_vel) override {
+        double dist = rel_pos.Length();
+        return (10 * (m_cutoff - dist) / dist) * rel_pos;
+    }
+    double m_cutoff;
+};
+
+PairList BruteForcePairs(const ChParticleCloud& cloud, double cutoff) {
+    PairList pairs;
+    auto n = (unsigned int)cloud.GetNumParticles();
+    for (unsigned int i = 0; i < n; i++)
+        for (unsigned int j = i + 1; j < n; j++)
+            if ((cloud.GetParticlePos(j) - cloud.GetParticlePos(i)).Length() <= cutoff)
+                pairs.push_back({i, j});
+    return pairs;
+}
+
+TEST(ChProximityContainerParticles, neighbor_list) {
+    double cutoff = 0.2;
+    double skin = 0.05;
+
+    ChSystemNSC sys;
+    sys.SetGravitationalAcceleration(VNULL);
+
+    auto cloud = chrono_types::make_shared<ChParticleCloud>();
+    cloud->SetMass(0.01);
+    std::default_random_engine generator(42);
+    std::uniform_real_distribution<double> pos_dist(0.0, 2.0);
+    std::uniform_real_distribution<double> vel_dist(-0.5, 0.5);
+    for (int i = 0; i < 1000; i++) {
+        cloud->AddParticle(ChCoordsys<>(ChVector3d(pos_dist(generator), pos_dist(generator), pos_dist(generator))));
+        cloud->Particle(i).SetPosDt(ChVector3d(vel_dist(generator), vel_dist(generator), vel_dist(generator)));
+    }
+    sys.Add(cloud);
+
+    auto container = chrono_types::make_shared<ChProximityContainerParticles>(cloud, cutoff, skin);
+    container->RegisterPairForceCallback(chrono_types::make_shared<RepulsiveForce>(cutoff));
+    sys.Add(container);
+
+    int num_steps = 200;
+    for (int k = 0; k < num_steps; k++) {
+        sys.DoStepDynamics(1e-3);
+
+        PairCollector collector;
+        container->ReportAllPairs(&collector);
+        std::sort(collector.pairs.begin(), collector.pairs.end());
+
+        auto ref_pairs = BruteForcePairs(*cloud, cutoff);
+        ASSERT_EQ(collector.pairs, ref_pairs) << "step " << k;
+        ASSERT_EQ(container->GetNproximities(), (int)ref_pairs.size());
+        ASSERT_GE(container->GetNumNeighborPairs(), ref_pairs.size());
+    }
+
+    // The neighbor list must have been rebuilt, but not at every step
+    ASSERT_GT(container->GetNumRebuilds(), 1u);
+    ASSERT_LT(container->GetNumRebuilds(), (unsigned int)num_steps / 4);
+}
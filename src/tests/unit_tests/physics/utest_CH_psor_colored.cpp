@@ -0,0 +1,116 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the graph-colored PSOR solver.
+// A pile of balls settles on a fixed ground box. Check that the solution does
+// not depend on the number of threads and that, at rest, the total contact
+// force on the ground balances the weight of the balls.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSORcolored.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const double mass = 1.0;
+static const int num_balls = 4 * 4 * 3;
+
+// Create a pile of 3 layers of 4 x 4 balls on a ground box. Each layer is shifted along x by the specified offset.
+std::vector<std::shared_ptr<ChBody>> CreatePile(ChSystemNSC& sys, std::shared_ptr<ChBody>& ground, double shift) {
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    ground = chrono_types::make_shared<ChBodyEasyBox>(2, 2, 0.2, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.1));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    double radius = 0.05;
+    double density = mass / ((4.0 / 3.0) * CH_PI * radius * radius * radius);
+    std::vector<std::shared_ptr<ChBody>> balls;
+    for (int k = 0; k < 3; k++) {
+        for (int i = 0; i < 4; i++) {
+            for (int j = 0; j < 4; j++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(radius, density, false, true, mat);
+                ball->SetPos(ChVector3d((i - 1.5) * 2.01 * radius + shift * k, (j - 1.5) * 2.01 * radius,
+                                        (2 * k + 1) * 1.01 * radius));
+                sys.AddBody(ball);
+                balls.push_back(ball);
+            }
+        }
+    }
+
+    auto solver = chrono_types::make_shared<ChSolverPSORcolored>();
+    solver->SetMaxIterations(100);
+    sys.SetSolver(solver);
+
+    return balls;
+}
+
+TEST(ChSolverPSORcolored, thread_independence) {
+    ChSystemNSC sys1;
+    ChSystemNSC sys4;
+    std::shared_ptr<ChBody> ground1;
+    std::shared_ptr<ChBody> ground4;
+    auto balls1 = CreatePile(sys1, ground1, 0.01);
+    auto balls4 = CreatePile(sys4, ground4, 0.01);
+    sys1.SetNumThreads(1);
+    sys4.SetNumThreads(4);
+
+    auto solver4 = std::static_pointer_cast<ChSolverPSORcolored>(sys4.GetSolver());
+    ASSERT_EQ(solver4->GetNumThreads(), 4);
+
+    for (int i = 0; i < 200; i++) {
+        sys1.DoStepDynamics(1e-3);
+        sys4.DoStepDynamics(1e-3);
+    }
+
+    ASSERT_GT(solver4->GetNumColors(), 1);
+    ASSERT_EQ(sys1.GetSolver()->AsIterative()->GetIterations(), solver4->GetIterations());
+    for (size_t i = 0; i < balls1.size(); i++) {
+        ASSERT_EQ(balls1[i]->GetPos(), balls4[i]->GetPos());
+        ASSERT_EQ(balls1[i]->GetPosDt(), balls4[i]->GetPosDt());
+    }
+}
+
+TEST(ChSolverPSORcolored, pile_at_rest) {
+    ChSystemNSC sys;
+    std::shared_ptr<ChBody> ground;
+    // Aligned columns of balls, which settle at rest
+    auto balls = CreatePile(sys, ground, 0);
+    sys.SetNumThreads(4);
+
+    auto solver = std::static_pointer_cast<ChSolverPSORcolored>(sys.GetSolver());
+    solver->EnableSymmetricSweep(true);
+
+    while (sys.GetChTime() < 1.0)
+        sys.DoStepDynamics(1e-3);
+
+    sys.GetContactContainer()->ComputeContactForces();
+    ChVector3d force = ground->GetContactForce();
+    double weight = num_balls * mass * 9.81;
+
+    // The balls press on the ground with their total weight
+    ASSERT_NEAR(-force.z(), weight, 1e-2 * weight);
+    for (const auto& ball : balls)
+        ASSERT_LT(ball->GetPosDt().Length(), 1e-2);
+}
@@ -0,0 +1,180 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for the parallel implementation of the Schur complement product in the
+// system descriptor. The descriptor of a system with joints and frictional
+// contacts (a pendulum chain and a stack of spheres) is used to evaluate the
+// product with the sequential and parallel implementations, which must agree up
+// to round-off (for all and for a subset of the constraints), also when the
+// parallel region runs with fewer threads than requested.
+//
+// =============================================================================
+
+#include <random>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/utils/ChOpenMP.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+class SchurModel {
+  public:
+    SchurModel(int num_threads) {
+        sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+        sys.SetNumThreads(num_threads);
+        sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+        auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+        mat->SetFriction(0.4f);
+
+        auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 4, 0.2, 1000, false, true, mat);
+        ground->SetPos(ChVector3d(0, 0, -0.1));
+        ground->SetFixed(true);
+        sys.AddBody(ground);
+
+        // Stack of spheres resting on the ground
+        for (int ix = 0; ix < 5; ix++) {
+            for (int iy = 0; iy < 5; iy++) {
+                for (int iz = 0; iz < 3; iz++) {
+                    auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, false, true, mat);
+                    sphere->SetPos(ChVector3d(-0.4 + 0.2 * ix, -0.4 + 0.2 * iy, 0.1 + 0.2 * iz));
+                    sys.AddBody(sphere);
+                }
+            }
+        }
+
+        // Pendulum chain (away from the spheres)
+        std::shared_ptr<ChBody> prev = ground;
+        for (int i = 0; i < 5; i++) {
+            auto link = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.05, 0.05, 1000, false, false);
+            link->SetPos(ChVector3d(1.0 + 0.5 * i + 0.25, 0, 2));
+            sys.AddBody(link);
+
+            auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+            rev->Initialize(prev, link, ChFrame<>(ChVector3d(1.0 + 0.5 * i, 0, 2), QuatFromAngleX(CH_PI_2)));
+            sys.AddLink(rev);
+            prev = link;
+        }
+
+        for (int k = 0; k < 20; k++)
+            sys.DoStepDynamics(1e-3);
+    }
+
+    ChSystemNSC sys;
+};
+
+static void CompareProducts(std::shared_ptr<ChSystemDescriptor> descriptor, std::vector<bool>* enabled) {
+    int nc = (int)descriptor->CountActiveConstraints();
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    ChVectorDynamic<> l(nc);
+    for (int i = 0; i < nc; i++)
+        l(i) = dist(gen);
+
+    ChVectorDynamic<> result_seq, result_par;
+    ChVectorDynamic<> q_seq, q_par;
+
+    descriptor->EnableParallelSchurComplementProduct(false);
+    descriptor->SchurComplementProduct(result_seq, l, enabled);
+    descriptor->FromVariablesToVector(q_seq);
+
+    descriptor->EnableParallelSchurComplementProduct(true);
+    descriptor->SchurComplementProduct(result_par, l, enabled);
+    descriptor->FromVariablesToVector(q_par);
+
+    ASSERT_EQ(result_par.size(), nc);
+    ASSERT_GT(result_seq.norm(), 0);
+    ASSERT_NEAR((result_par - result_seq).norm(), 0, 1e-12 * result_seq.norm());
+    ASSERT_NEAR((q_par - q_seq).norm(), 0, 1e-12 * q_seq.norm());
+
+    if (enabled) {
+        for (int i = 0; i < nc; i++) {
+            if (!(*enabled)[i])
+                ASSERT_EQ(result_par(i), 0);
+        }
+    }
+}
+
+static void TestSchurProduct(int num_threads) {
+    SchurModel model(num_threads);
+    auto descriptor = model.sys.GetSystemDescriptor();
+    ASSERT_EQ(descriptor->GetNumThreads(), num_threads);
+
+    // Joint constraints and (friction) contact constraints
+    ASSERT_GT(model.sys.GetNumContacts(), 50u);
+    int nc = (int)descriptor->CountActiveConstraints();
+    ASSERT_GT(nc, 3 * 50);
+
+    CompareProducts(descriptor, nullptr);
+
+    std::vector<bool> enabled(nc);
+    for (int i = 0; i < nc; i++)
+        enabled[i] = (i % 3 != 1);
+    CompareProducts(descriptor, &enabled);
+
+    // In deterministic mode, the sequential implementation is always used
+    descriptor->SetDeterministic(true);
+    ChVectorDynamic<> l = ChVectorDynamic<>::Ones(nc);
+    ChVectorDynamic<> result_seq, result_det;
+    descriptor->EnableParallelSchurComplementProduct(false);
+    descriptor->SchurComplementProduct(result_seq, l);
+    descriptor->EnableParallelSchurComplementProduct(true);
+    descriptor->SchurComplementProduct(result_det, l);
+    ASSERT_EQ(result_det, result_seq);
+}
+
+TEST(ChSystemDescriptor, schur_product_1_thread) {
+    TestSchurProduct(1);
+}
+
+TEST(ChSystemDescriptor, schur_product_4_threads) {
+    TestSchurProduct(4);
+}
+
+// Product evaluated from a nested parallel region, in which the team has a single thread
+TEST(ChSystemDescriptor, schur_product_nested) {
+    SchurModel model(4);
+    auto descriptor = model.sys.GetSystemDescriptor();
+    int nc = (int)descriptor->CountActiveConstraints();
+    ChVectorDynamic<> l = ChVectorDynamic<>::Ones(nc);
+
+    // Sequential product, and parallel product with a full team (leaving data in all per-thread buffers)
+    ChVectorDynamic<> result_seq, result_par, result_nested;
+    descriptor->EnableParallelSchurComplementProduct(false);
+    descriptor->SchurComplementProduct(result_seq, l);
+    descriptor->EnableParallelSchurComplementProduct(true);
+    descriptor->SchurComplementProduct(result_par, l);
+    ASSERT_NEAR((result_par - result_seq).norm(), 0, 1e-12 * result_seq.norm());
+
+#ifdef _OPENMP
+    int max_levels = omp_get_max_active_levels();
+    omp_set_max_active_levels(1);
+#endif
+#pragma omp parallel num_threads(2)
+    {
+#pragma omp master
+        descriptor->SchurComplementProduct(result_nested, l);
+    }
+#ifdef _OPENMP
+    omp_set_max_active_levels(max_levels);
+#endif
+
+    ASSERT_EQ(result_nested.size(), nc);
+    ASSERT_NEAR((result_nested - result_seq).norm(), 0, 1e-12 * result_seq.norm());
+}
@@ -19,6 +19,7 @@
 #include "chrono/physics/ChShaftBodyConstraint.h"
 #include "chrono/physics/ChShaftsClutch.h"
 #include "chrono/physics/ChShaftsGear.h"
+#include "chrono/physics/ChShaftsNetwork.h"
 #include "chrono/physics/ChShaftsPlanetary.h"
 #include "chrono/physics/ChShaftsTorsionSpring.h"
 
@@ -77,8 +78,8 @@ TEST_P(ChShaftTest, shaft_shaft) {
     // Parameters
     double J1 = 10;   // inertia of first shaft
     double J2 = 100;  // inertia of second shaft
-    double r = -0.1;  // gear transmission ratio
-    double T = 6;     // torque applied to first shaft
+    double r = -0.1;   // gear transmission ratio
+    double T = 6;      // torque applied to first shaft
 
     // Create two 1-D shaft objects, with a constant torque applied to the first shaft.
     // By default, a ChShaft is free to rotate.
@@ -396,4 +397,104 @@ TEST_P(ChShaftTest, shaft_shaft_shaft) {
     ////          << "     on C: " << planetaryBAC->GetTorqueReactionOn3() << "\n\n\n";
 }
 
+// -----------------------------------------------------------------------------
+// Test for a reduced shaft network: a driveshaft (with applied torque T) connected
+// through a gear to the box of a differential which drives two external axles.
+// The same driveline is modeled with ChShaft, ChShaftsGear, and ChShaftsPlanetary
+// objects and with a ChShaftsNetwork; both models must give the same axle motion
+// and the same torques on the axles.
+//
+//         T  ||---[ r ]---||---[ diff ]---|| L
+//                                    |
+//                                    +----|| R
+// -----------------------------------------------------------------------------
+TEST_P(ChShaftTest, network) {
+    double J_ds = 0.5;   // driveshaft inertia
+    double J_box = 0.6;  // differential box inertia
+    double J_L = 1.0;    // left axle inertia
+    double J_R = 2.0;    // right axle inertia
+    double r = -0.25;    // gear transmission ratio
+    double T = 10;       // torque applied to driveshaft
+    double T_L = -2;     // torque applied to left axle
+    double T_R = -1;     // torque applied to right axle
+
+    // Full model
+    auto ds = chrono_types::make_shared<ChShaft>();
+    ds->SetInertia(J_ds);
+    ds->SetAppliedLoad(T);
+    system->Add(ds);
+
+    auto box = chrono_types::make_shared<ChShaft>();
+    box->SetInertia(J_box);
+    system->Add(box);
+
+    auto axle_L1 = chrono_types::make_shared<ChShaft>();
+    axle_L1->SetInertia(J_L);
+    axle_L1->SetAppliedLoad(T_L);
+    system->Add(axle_L1);
+
+    auto axle_R1 = chrono_types::make_shared<ChShaft>();
+    axle_R1->SetInertia(J_R);
+    axle_R1->SetAppliedLoad(T_R);
+    system->Add(axle_R1);
+
+    auto gear = chrono_types::make_shared<ChShaftsGear>();
+    gear->Initialize(ds, box);
+    gear->SetTransmissionRatio(r);
+    system->Add(gear);
+
+    auto diff = chrono_types::make_shared<ChShaftsPlanetary>();
+    diff->Initialize(box, axle_L1, axle_R1);
+    diff->SetTransmissionRatioOrdinary(-1.0);
+    system->Add(diff);
+
+    // Reduced model
+    auto axle_L2 = chrono_types::make_shared<ChShaft>();
+    axle_L2->SetInertia(J_L);
+    axle_L2->SetAppliedLoad(T_L);
+    system->Add(axle_L2);
+
+    auto axle_R2 = chrono_types::make_shared<ChShaft>();
+    axle_R2->SetInertia(J_R);
+    axle_R2->SetAppliedLoad(T_R);
+    system->Add(axle_R2);
+
+    auto network = chrono_types::make_shared<ChShaftsNetwork>();
+    int ds_index = network->AddShaft(J_ds);
+    int box_index = network->AddShaft(J_box);
+    int L_index = network->AddShaft(axle_L2);
+    int R_index = network->AddShaft(axle_R2);
+    network->AddGear(ds_index, box_index, r);
+    network->AddPlanetary(box_index, L_index, R_index, -1.0);
+    network->SetAppliedLoad(ds_index, T);
+    network->Initialize();
+    system->Add(network);
+
+    ASSERT_EQ(network->GetNumReducedCoords(), 1);
+
+    // Perform the simulation and compare results
+    double tol_pos = 1e-3;
+    double tol_vel = 1e-4;
+    double tol_trq = 5e-2;  // the full model is solved with an iterative solver in the NSC case
+
+    double time_end = 0.5;
+    double time_step = 1e-3;
+    double time = 0;
+
+    while (time < time_end) {
+        system->DoStepDynamics(time_step);
+        time += time_step;
+
+        ASSERT_NEAR(axle_L2->GetPos(), axle_L1->GetPos(), tol_pos);
+        ASSERT_NEAR(axle_R2->GetPos(), axle_R1->GetPos(), tol_pos);
+
+        ASSERT_NEAR(axle_L2->GetPosDt(), axle_L1->GetPosDt(), tol_vel);
+        ASSERT_NEAR(axle_R2->GetPosDt(), axle_R1->GetPosDt(), tol_vel);
+        ASSERT_NEAR(network->GetShaftSpeed(ds_index), ds->GetPosDt(), tol_vel);
+
+        ASSERT_NEAR(network->GetReactionTorque(L_index), diff->GetReaction2(), tol_trq);
+        ASSERT_NEAR(network->GetReactionTorque(R_index), diff->GetTorqueReactionOn3(), tol_trq);
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(Physics, ChShaftTest, ::testing::Values(ChContactMethod::NSC, ChContactMethod::SMC));
@@ -0,0 +1,110 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the ADMM solver variants.
+// A pile of balls settles on a fixed ground box, using basic, Nesterov, and
+// Anderson accelerated ADMM, with and without reuse of the KKT factorization
+// across rho adjustments. Check that, at rest, the total contact force on the
+// ground balances the weight of the balls.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverADMM.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const double mass = 1.0;
+static const int num_balls = 2 * 2 * 2;
+
+// Settle a pile of 2 layers of 2 x 2 balls on a ground box, using the given solver
+void SettlePile(std::shared_ptr<ChSolverADMM> solver) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(2, 2, 0.2, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.1));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    double radius = 0.05;
+    double density = mass / ((4.0 / 3.0) * CH_PI * radius * radius * radius);
+    std::vector<std::shared_ptr<ChBody>> balls;
+    for (int k = 0; k < 2; k++) {
+        for (int i = 0; i < 2; i++) {
+            for (int j = 0; j < 2; j++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(radius, density, false, true, mat);
+                ball->SetPos(ChVector3d((i - 0.5) * 2.01 * radius, (j - 0.5) * 2.01 * radius,
+                                        (2 * k + 1) * 1.01 * radius));
+                sys.AddBody(ball);
+                balls.push_back(ball);
+            }
+        }
+    }
+
+    solver->SetMaxIterations(200);
+    solver->SetTolerancePrimal(1e-8);
+    solver->SetToleranceDual(1e-8);
+    solver->EnableWarmStart(true);
+    sys.SetSolver(solver);
+
+    while (sys.GetChTime() < 0.5) {
+        sys.DoStepDynamics(1e-3);
+        ASSERT_GE(solver->GetNumFactorizations(), 1);
+        ASSERT_LE(solver->GetIterations(), 200);
+    }
+
+    sys.GetContactContainer()->ComputeContactForces();
+    ChVector3d force = ground->GetContactForce();
+    double weight = num_balls * mass * 9.81;
+
+    // The balls press on the ground with their total weight
+    ASSERT_NEAR(-force.z(), weight, 1e-2 * weight);
+    for (const auto& ball : balls)
+        ASSERT_LT(ball->GetPosDt().Length(), 1e-2);
+}
+
+TEST(ChSolverADMM, basic) {
+    auto solver = chrono_types::make_shared<ChSolverADMM>();
+    solver->SetAcceleration(ChSolverADMM::AdmmAcceleration::BASIC);
+    SettlePile(solver);
+}
+
+TEST(ChSolverADMM, nesterov) {
+    auto solver = chrono_types::make_shared<ChSolverADMM>();
+    solver->SetAcceleration(ChSolverADMM::AdmmAcceleration::NESTEROV);
+    SettlePile(solver);
+}
+
+TEST(ChSolverADMM, anderson) {
+    auto solver = chrono_types::make_shared<ChSolverADMM>();
+    solver->SetAcceleration(ChSolverADMM::AdmmAcceleration::ANDERSON);
+    solver->SetAndersonMemory(5);
+    SettlePile(solver);
+}
+
+TEST(ChSolverADMM, factorization_reuse) {
+    auto solver = chrono_types::make_shared<ChSolverADMM>();
+    solver->SetAcceleration(ChSolverADMM::AdmmAcceleration::ANDERSON);
+    solver->SetRhoRefactorThreshold(0.5);
+    SettlePile(solver);
+}
@@ -0,0 +1,97 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the island-decomposition solver.
+// Two separate stacks of balls settle on a fixed ground box, while a third ball
+// falls freely. The fixed ground does not connect the two stacks, so the problem
+// splits into independent islands. With a fixed number of iterations, the island
+// solver with PSOR island solvers must reproduce the results of a PSOR solver
+// applied to the entire system.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverIslands.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+std::vector<std::shared_ptr<ChBody>> CreateStacks(ChSystemNSC& sys) {
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 2, 0.2, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.1));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    double radius = 0.1;
+    std::vector<std::shared_ptr<ChBody>> balls;
+    for (int i = 0; i < 2; i++) {
+        for (int k = 0; k < 3; k++) {
+            auto ball = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, mat);
+            ball->SetPos(ChVector3d((2 * i - 1) * 1.0 + 0.01 * k, 0, (2 * k + 1) * 1.01 * radius));
+            sys.AddBody(ball);
+            balls.push_back(ball);
+        }
+    }
+
+    auto ball = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, mat);
+    ball->SetPos(ChVector3d(0, 0, 5));
+    sys.AddBody(ball);
+    balls.push_back(ball);
+
+    return balls;
+}
+
+TEST(ChSolverIslands, psor_equivalence) {
+    ChSystemNSC sys_ref;
+    ChSystemNSC sys;
+    auto balls_ref = CreateStacks(sys_ref);
+    auto balls = CreateStacks(sys);
+
+    auto solver_ref = chrono_types::make_shared<ChSolverPSOR>();
+    solver_ref->SetMaxIterations(50);
+    sys_ref.SetSolver(solver_ref);
+
+    auto solver = chrono_types::make_shared<ChSolverIslands>(ChSolver::Type::PSOR);
+    solver->SetMaxIterations(50);
+    sys.SetSolver(solver);
+    sys.SetNumThreads(2);
+    ASSERT_EQ(solver->GetNumThreads(), 2);
+
+    while (sys.GetChTime() < 0.5) {
+        sys_ref.DoStepDynamics(1e-3);
+        sys.DoStepDynamics(1e-3);
+    }
+
+    ASSERT_EQ(solver->GetNumIslands(), 3);
+    ASSERT_EQ(solver->GetNumConstrainedIslands(), 2);
+    ASSERT_EQ(solver->GetIterations(), solver_ref->GetIterations());
+    for (size_t i = 0; i < balls.size(); i++) {
+        ASSERT_NEAR((balls[i]->GetPos() - balls_ref[i]->GetPos()).Length(), 0.0, 1e-10);
+        ASSERT_NEAR((balls[i]->GetPosDt() - balls_ref[i]->GetPosDt()).Length(), 0.0, 1e-10);
+    }
+}
+
+TEST(ChSolverIslands, unsupported_type) {
+    ASSERT_THROW(ChSolverIslands(ChSolver::Type::ADMM), std::invalid_argument);
+}
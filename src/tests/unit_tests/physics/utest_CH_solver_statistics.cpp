@@ -0,0 +1,106 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the statistics of iterative VI solvers.
+// A pendulum (bilateral constraints) swings above a ball resting on a fixed
+// ground box (frictional contact). Check the sampling and ring buffer of the
+// statistics records and the per-class constraint counts.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+TEST(ChIterativeSolverVI, statistics) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(2, 2, 0.2, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.1));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, false, true, mat);
+    ball->SetPos(ChVector3d(0, 0, 0.099));
+    sys.AddBody(ball);
+
+    auto pendulum = chrono_types::make_shared<ChBodyEasyBox>(0.1, 0.1, 1.0, 1000, false, false);
+    pendulum->SetPos(ChVector3d(1, 0, 1.5));
+    sys.AddBody(pendulum);
+
+    auto revolute = chrono_types::make_shared<ChLinkLockRevolute>();
+    revolute->Initialize(ground, pendulum, ChFrame<>(ChVector3d(1, 0, 2), QuatFromAngleX(CH_PI_2)));
+    sys.AddLink(revolute);
+
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->SetMaxIterations(50);
+    solver->EnableStatistics(true, 3, 4);
+    sys.SetSolver(solver);
+
+    for (int i = 0; i < 20; i++)
+        sys.DoStepDynamics(1e-3);
+
+    // Solves are sampled every 3 solves and only the last 4 samples are kept
+    ASSERT_EQ(solver->GetNumStatistics(), 4);
+    auto stats = solver->GetStatistics();
+    ASSERT_EQ(stats.size(), 4);
+    for (size_t i = 1; i < stats.size(); i++)
+        ASSERT_EQ(stats[i].solve_index, stats[i - 1].solve_index + 3);
+    ASSERT_EQ(solver->GetLastStatistics().solve_index, stats.back().solve_index);
+    ASSERT_GE(stats.front().solve_index, 9);
+
+    for (const auto& s : stats) {
+        ASSERT_GT(s.iterations, 0);
+        ASSERT_EQ(s.violation_history.size(), (size_t)s.iterations);
+        ASSERT_EQ(s.dlambda_history.size(), (size_t)s.iterations);
+        ASSERT_GE(s.solve_time, 0);
+
+        // The revolute joint has 5 bilateral constraints; the ball rests on the ground with one contact
+        ASSERT_EQ(s.bilateral.num_constraints, 5);
+        ASSERT_EQ(s.unilateral.num_constraints, 0);
+        ASSERT_GE(s.contact.num_constraints, 1);
+
+        double max_class = std::max(s.bilateral.max_violation, s.contact.max_violation);
+        ASSERT_DOUBLE_EQ(s.max_violation, max_class);
+        ASSERT_LE(s.bilateral.rms_violation, s.bilateral.max_violation);
+
+        // The constraint with maximum violation acts on two bodies, identified by the system
+        if (s.max_violation_constraint >= 0) {
+            ASSERT_EQ(s.max_violation_variables.size(), 2);
+            ASSERT_EQ(s.max_violation_bodies.size(), 2);
+            for (auto id : s.max_violation_bodies) {
+                ASSERT_TRUE(id == ground->GetIdentifier() || id == ball->GetIdentifier() ||
+                            id == pendulum->GetIdentifier());
+            }
+        }
+    }
+
+    // Clearing the statistics
+    solver->ClearStatistics();
+    ASSERT_EQ(solver->GetNumStatistics(), 0);
+    for (int i = 0; i < 3; i++)
+        sys.DoStepDynamics(1e-3);
+    ASSERT_EQ(solver->GetNumStatistics(), 1);
+}
@@ -0,0 +1,152 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for bulk state access through contiguous arrays.
+//
+// Boxes dropped on a fixed ground are simulated; the per-body arrays must match
+// the values reported by each body, the arrays must not be reallocated across
+// updates, and the system state must round-trip through the state vectors.
+// Forces applied in bulk must produce the expected accelerations.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/fea/ChNodeFEAxyz.h"
+#include "chrono/utils/ChStateArrays.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const int num_boxes = 5;
+
+static void CreateBoxes(ChSystem& sys) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 20, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < num_boxes; i++) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.5, 1000, false, true, mat);
+        box->SetPos(ChVector3d(2.0 * i, 0, 0.3 + 0.1 * i));
+        box->SetRot(QuatFromAngleZ(0.1 * i));
+        sys.AddBody(box);
+    }
+}
+
+TEST(ChStateArrays, gather) {
+    ChSystemSMC sys;
+    CreateBoxes(sys);
+
+    utils::ChStateArrays arrays(sys);
+    ASSERT_EQ(arrays.GetNumBodies(), num_boxes + 1);
+
+    arrays.Update();
+    const double* data = arrays.GetBodyPositions().data();
+
+    for (int i = 0; i < 1500; i++)
+        sys.DoStepDynamics(1e-3);
+
+    arrays.Update();
+    ASSERT_EQ(arrays.GetBodyPositions().data(), data);
+
+    const auto& bodies = sys.GetBodies();
+    ChVector3d total_force;
+    for (unsigned int i = 0; i < arrays.GetNumBodies(); i++) {
+        ASSERT_EQ(ChVector3d(arrays.GetBodyPositions().row(i)), bodies[i]->GetPos());
+        ASSERT_EQ(arrays.GetBodyRotations()(i, 0), bodies[i]->GetRot().e0());
+        ASSERT_EQ(arrays.GetBodyRotations()(i, 3), bodies[i]->GetRot().e3());
+        ASSERT_EQ(ChVector3d(arrays.GetBodyLinVelocities().row(i)), bodies[i]->GetLinVel());
+        ASSERT_EQ(ChVector3d(arrays.GetBodyAngVelocities().row(i)), bodies[i]->GetAngVelParent());
+        if (i > 0)
+            total_force += ChVector3d(arrays.GetBodyContactForces().row(i));
+    }
+
+    // The boxes settled on the ground: contact forces balance their weight
+    double weight = num_boxes * 0.125 * 1000 * 9.81;
+    ASSERT_NEAR(total_force.z(), weight, 0.05 * weight);
+}
+
+TEST(ChStateArrays, state) {
+    ChSystemSMC sys;
+    CreateBoxes(sys);
+    for (int i = 0; i < 50; i++)
+        sys.DoStepDynamics(1e-3);
+
+    utils::ChStateArrays arrays(sys);
+    arrays.GatherState();
+    ASSERT_EQ(arrays.GetState().size(), 7 * (num_boxes + 1));
+    ASSERT_EQ(arrays.GetStateDelta().size(), 6 * (num_boxes + 1));
+    ASSERT_DOUBLE_EQ(arrays.GetTime(), sys.GetChTime());
+
+    // Move the last box through the state vector
+    ChVector3d pos = sys.GetBodies().back()->GetPos();
+    unsigned int off_x = sys.GetBodies().back()->GetOffset_x();
+    arrays.GetState()(off_x + 2) += 1;
+    arrays.ScatterState();
+    ASSERT_NEAR(sys.GetBodies().back()->GetPos().z(), pos.z() + 1, 1e-12);
+
+    // Gathering again does not reallocate the state vectors
+    const double* data = arrays.GetState().data();
+    arrays.GatherState();
+    ASSERT_EQ(arrays.GetState().data(), data);
+}
+
+TEST(ChStateArrays, forces) {
+    ChSystemSMC sys;
+    sys.SetGravitationalAcceleration(VNULL);
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int i = 0; i < num_boxes; i++) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000 * (i + 1), false, false);
+        box->SetPos(ChVector3d(2.0 * i, 0, 0));
+        sys.AddBody(box);
+        bodies.push_back(box);
+    }
+
+    auto node = chrono_types::make_shared<fea::ChNodeFEAxyz>(ChVector3d(0, 0, 5));
+    node->SetMass(2);
+    auto mesh = chrono_types::make_shared<fea::ChMesh>();
+    mesh->AddNode(node);
+    sys.Add(mesh);
+
+    utils::ChStateArrays arrays(sys);
+    arrays.SetBodies(bodies);
+    arrays.AddNodes(*mesh);
+    ASSERT_EQ(arrays.GetNumNodes(), 1);
+
+    ChMatrixDynamic<> forces(num_boxes, 3);
+    ChMatrixDynamic<> torques = ChMatrixDynamic<>::Zero(num_boxes, 3);
+    for (int i = 0; i < num_boxes; i++)
+        forces.row(i) << 1000, 0, 0;
+    arrays.SetBodyForces(forces, torques);
+    arrays.SetNodeForces(ChMatrixDynamic<>::Constant(1, 3, 4.0));
+
+    double step = 1e-3;
+    for (int i = 0; i < 100; i++)
+        sys.DoStepDynamics(step);
+
+    arrays.Update();
+    for (int i = 0; i < num_boxes; i++)
+        ASSERT_NEAR(arrays.GetBodyLinVelocities()(i, 0), 1000 * 0.1 / bodies[i]->GetMass(), 1e-6);
+    ASSERT_NEAR(arrays.GetNodeVelocities()(0, 2), 4 * 0.1 / 2, 1e-6);
+
+    ASSERT_THROW(arrays.SetBodyForces(forces.topRows(2), torques), std::runtime_error);
+}
@@ -0,0 +1,161 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for binary state checkpoints.
+//
+// A double pendulum is simulated for some time and its state checkpointed. The
+// simulation continued from a second, identically constructed system loaded
+// from the checkpoint must match the continuation of the original simulation.
+// The same is checked for a box resting on the ground with warm started NSC
+// contacts, whose persistent contact points must also be restored.
+//
+// =============================================================================
+
+#include <cstdio>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChIterativeSolverVI.h"
+#include "chrono/utils/ChUtilsInputOutput.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static std::shared_ptr<ChBody> CreatePendulum(ChSystem& sys) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseQR>());
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto body1 = chrono_types::make_shared<ChBodyEasyBox>(2, 0.2, 0.2, 1000, false, false);
+    body1->SetPos(ChVector3d(1, 0, 0));
+    sys.AddBody(body1);
+
+    auto body2 = chrono_types::make_shared<ChBodyEasyBox>(2, 0.2, 0.2, 1000, false, false);
+    body2->SetPos(ChVector3d(3, 0, 0));
+    sys.AddBody(body2);
+
+    auto rev1 = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev1->Initialize(ground, body1, ChFrame<>(ChVector3d(0, 0, 0)));
+    sys.AddLink(rev1);
+
+    auto rev2 = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev2->Initialize(body1, body2, ChFrame<>(ChVector3d(2, 0, 0)));
+    sys.AddLink(rev2);
+
+    return body2;
+}
+
+static std::shared_ptr<ChBody> CreateBoxOnGround(ChSystem& sys) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetSolverType(ChSolver::Type::PSOR);
+    sys.GetSolver()->AsIterative()->SetMaxIterations(20);
+    sys.GetSolver()->AsIterative()->EnableWarmStart(true);
+    std::static_pointer_cast<ChContactContainerNSC>(sys.GetContactContainer())->EnableWarmStart(true);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 4, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, false, true, mat);
+    box->SetPos(ChVector3d(0, 0, 0.55));
+    sys.AddBody(box);
+
+    return box;
+}
+
+TEST(ChUtilsInputOutput, state_checkpoint) {
+    const std::string filename = "state_checkpoint.dat";
+    double step = 1e-3;
+
+    ChSystemNSC sys1;
+    auto body1 = CreatePendulum(sys1);
+    while (sys1.GetChTime() < 0.5)
+        sys1.DoStepDynamics(step);
+    ASSERT_TRUE(utils::WriteStateCheckpoint(&sys1, filename));
+
+    ChSystemNSC sys2;
+    auto body2 = CreatePendulum(sys2);
+    ASSERT_TRUE(utils::ReadStateCheckpoint(&sys2, filename));
+    ASSERT_DOUBLE_EQ(sys2.GetChTime(), sys1.GetChTime());
+    ASSERT_LT((body2->GetPos() - body1->GetPos()).Length(), 1e-12);
+
+    for (int i = 0; i < 500; i++) {
+        sys1.DoStepDynamics(step);
+        sys2.DoStepDynamics(step);
+    }
+    ASSERT_LT((body2->GetPos() - body1->GetPos()).Length(), 1e-9);
+    ASSERT_LT((body2->GetPosDt() - body1->GetPosDt()).Length(), 1e-8);
+
+    // A system with a different topology is rejected
+    ChSystemNSC sys3;
+    CreatePendulum(sys3);
+    sys3.AddBody(chrono_types::make_shared<ChBody>());
+    ASSERT_FALSE(utils::ReadStateCheckpoint(&sys3, filename));
+
+    std::remove(filename.c_str());
+}
+
+TEST(ChUtilsInputOutput, state_checkpoint_contacts) {
+    const std::string filename = "state_checkpoint_contacts.dat";
+    double step = 1e-3;
+
+    ChSystemNSC sys1;
+    auto box1 = CreateBoxOnGround(sys1);
+    while (sys1.GetChTime() < 0.5)
+        sys1.DoStepDynamics(step);
+    auto container1 = std::static_pointer_cast<ChContactContainerNSC>(sys1.GetContactContainer());
+    auto cache1 = container1->ExportWarmStartCache();
+    ASSERT_GT(cache1.size(), 0);
+    ASSERT_TRUE(utils::WriteStateCheckpoint(&sys1, filename));
+
+    ChSystemNSC sys2;
+    auto box2 = CreateBoxOnGround(sys2);
+    ASSERT_TRUE(utils::ReadStateCheckpoint(&sys2, filename));
+    ASSERT_LT((box2->GetPos() - box1->GetPos()).Length(), 1e-12);
+
+    // The persistent contact points are restored, on the corresponding shapes of the second system
+    auto container2 = std::static_pointer_cast<ChContactContainerNSC>(sys2.GetContactContainer());
+    auto cache2 = container2->ExportWarmStartCache();
+    ASSERT_EQ(cache2.size(), cache1.size());
+    const void* shape1 = box1->GetCollisionModel()->GetShapeInstance(0).first.get();
+    const void* shape2 = box2->GetCollisionModel()->GetShapeInstance(0).first.get();
+    for (size_t i = 0; i < cache1.size(); i++) {
+        ASSERT_EQ(cache1[i].shapeA == shape1, cache2[i].shapeA == shape2);
+        ASSERT_EQ(cache1[i].shapeB == shape1, cache2[i].shapeB == shape2);
+        ASSERT_LT((cache2[i].pos - cache1[i].pos).Length(), 1e-12);
+        for (int j = 0; j < 6; j++)
+            ASSERT_FLOAT_EQ(cache2[i].reactions[j], cache1[i].reactions[j]);
+    }
+
+    for (int i = 0; i < 200; i++) {
+        sys1.DoStepDynamics(step);
+        sys2.DoStepDynamics(step);
+    }
+    ASSERT_LT((box2->GetPos() - box1->GetPos()).Length(), 1e-6);
+    ASSERT_EQ(container2->GetNumContacts(), container1->GetNumContacts());
+
+    std::remove(filename.c_str());
+}
@@ -0,0 +1,148 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for the reuse of the symbolic analysis in direct sparse linear solvers.
+//
+// The model is a chain of pendulums, to which a pendulum is added and later
+// removed, and one joint of which is temporarily disabled. The symbolic analysis
+// must be performed only at the first step and after each of these topology
+// changes, and results must match (up to roundoff) those obtained with a full
+// factorization at each step.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const int num_links = 4;
+
+class PendulumChain {
+  public:
+    PendulumChain(bool reuse) {
+        sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+        ground = chrono_types::make_shared<ChBody>();
+        ground->SetFixed(true);
+        sys.AddBody(ground);
+
+        std::shared_ptr<ChBody> prev = ground;
+        for (int i = 0; i < num_links; i++) {
+            prev = AddLink(prev, i);
+            links.push_back(prev);
+        }
+
+        solver = chrono_types::make_shared<ChSolverSparseLU>();
+        solver->LockSparsityPattern(reuse);
+        solver->ReuseSymbolicAnalysis(reuse);
+        sys.SetSolver(solver);
+    }
+
+    std::shared_ptr<ChBody> AddLink(std::shared_ptr<ChBody> prev, int i) {
+        auto body = chrono_types::make_shared<ChBodyEasyBox>(1.0, 0.1, 0.1, 1000, false, false);
+        body->SetPos(ChVector3d(i + 0.5, 0, 0));
+        sys.AddBody(body);
+
+        auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+        rev->Initialize(prev, body, ChFrame<>(ChVector3d(i, 0, 0), QUNIT));
+        sys.AddLink(rev);
+        joints.push_back(rev);
+
+        return body;
+    }
+
+    void Advance(int num_steps) {
+        for (int k = 0; k < num_steps; k++)
+            sys.DoStepDynamics(1e-3);
+    }
+
+    unsigned int GetRevision() { return sys.GetSystemDescriptor()->GetTopologyRevision(); }
+
+    ChSystemNSC sys;
+    std::shared_ptr<ChBody> ground;
+    std::vector<std::shared_ptr<ChBody>> links;
+    std::vector<std::shared_ptr<ChLinkLockRevolute>> joints;
+    std::shared_ptr<ChSolverSparseLU> solver;
+};
+
+static void Compare(PendulumChain& chain, PendulumChain& ref) {
+    ASSERT_EQ(chain.links.size(), ref.links.size());
+    for (size_t i = 0; i < chain.links.size(); i++) {
+        ASSERT_NEAR((chain.links[i]->GetPos() - ref.links[i]->GetPos()).Length(), 0, 1e-10);
+        ASSERT_NEAR((chain.links[i]->GetPosDt() - ref.links[i]->GetPosDt()).Length(), 0, 1e-8);
+    }
+}
+
+TEST(ChDirectSolverLS, symbolic_reuse) {
+    PendulumChain chain(true);
+    PendulumChain ref(false);
+
+    // Constant topology: a single symbolic analysis
+    chain.Advance(100);
+    ref.Advance(100);
+    unsigned int revision = chain.GetRevision();
+    ASSERT_EQ(chain.solver->GetNumSetupCalls(), 100u);
+    ASSERT_EQ(chain.solver->GetNumAnalysisCalls(), 1u);
+    ASSERT_EQ(ref.solver->GetNumAnalysisCalls(), 100u);
+    Compare(chain, ref);
+
+    // Added pendulum: new analysis at the next step only
+    for (auto c : {&chain, &ref})
+        c->links.push_back(c->AddLink(c->links.back(), num_links));
+    chain.Advance(50);
+    ref.Advance(50);
+    ASSERT_GT(chain.GetRevision(), revision);
+    revision = chain.GetRevision();
+    ASSERT_EQ(chain.solver->GetNumAnalysisCalls(), 2u);
+    Compare(chain, ref);
+
+    // Disabled joint: fewer active constraints
+    for (auto c : {&chain, &ref})
+        c->joints[1]->SetDisabled(true);
+    chain.Advance(50);
+    ref.Advance(50);
+    ASSERT_GT(chain.GetRevision(), revision);
+    revision = chain.GetRevision();
+    ASSERT_EQ(chain.solver->GetNumAnalysisCalls(), 3u);
+    Compare(chain, ref);
+
+    // Re-enabled joint
+    for (auto c : {&chain, &ref})
+        c->joints[1]->SetDisabled(false);
+    chain.Advance(50);
+    ref.Advance(50);
+    ASSERT_GT(chain.GetRevision(), revision);
+    revision = chain.GetRevision();
+    ASSERT_EQ(chain.solver->GetNumAnalysisCalls(), 4u);
+    Compare(chain, ref);
+
+    // Removed pendulum
+    for (auto c : {&chain, &ref}) {
+        c->sys.RemoveLink(c->joints.back());
+        c->sys.RemoveBody(c->links.back());
+        c->joints.pop_back();
+        c->links.pop_back();
+    }
+    chain.Advance(50);
+    ref.Advance(50);
+    ASSERT_GT(chain.GetRevision(), revision);
+    ASSERT_EQ(chain.solver->GetNumAnalysisCalls(), 5u);
+    ASSERT_EQ(chain.solver->GetNumSetupCalls(), 300u);
+    Compare(chain, ref);
+}
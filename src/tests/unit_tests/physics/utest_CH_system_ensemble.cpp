@@ -0,0 +1,185 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for an ensemble of systems advanced in parallel.
+//
+// Each environment is a single falling body pushed horizontally by an action
+// force. Results of the ensemble must match those of the same systems advanced
+// sequentially, and terminated environments must be reset automatically.
+// Environments with contacts are repeatedly stepped on several threads, to check
+// that concurrent steps (including their profiling scopes) do not interfere.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/core/ChTaskScheduler.h"
+#include "chrono/utils/ChSystemEnsemble.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const int num_envs = 8;
+static const double step = 1e-3;
+
+static std::shared_ptr<ChSystem> CreateSystem(int env) {
+    auto sys = chrono_types::make_shared<ChSystemNSC>();
+    sys->SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetMass(1.0 + env);
+    body->SetPos(ChVector3d(0, 0, 1));
+    sys->AddBody(body);
+
+    return sys;
+}
+
+static void ApplyAction(int env, ChSystem& sys, ChVectorConstRef action) {
+    auto body = sys.GetBodies()[0];
+    body->EmptyAccumulators();
+    body->AccumulateForce(ChVector3d(action(0), 0, 0), body->GetPos(), false);
+}
+
+static void Observe(int env, ChSystem& sys, ChVectorRef obs) {
+    auto body = sys.GetBodies()[0];
+    obs(0) = body->GetPos().x();
+    obs(1) = body->GetPos().z();
+    obs(2) = body->GetLinVel().x();
+}
+
+TEST(ChSystemEnsemble, step) {
+    utils::ChSystemEnsemble ensemble(num_envs, CreateSystem);
+    ensemble.SetActionFunction(1, ApplyAction);
+    ensemble.SetObservationFunction(3, Observe);
+    ensemble.SetRewardFunction([](int env, ChSystem& sys) { return -sys.GetBodies()[0]->GetPos().x(); });
+    ensemble.SetNumSubsteps(2);
+    ensemble.Reset();
+    ASSERT_EQ(ensemble.GetObservations().rows(), num_envs);
+    ASSERT_EQ(ensemble.GetObservations()(num_envs - 1, 1), 1.0);
+
+    // Reference systems, advanced sequentially
+    std::vector<std::shared_ptr<ChSystem>> systems;
+    for (int env = 0; env < num_envs; env++)
+        systems.push_back(CreateSystem(env));
+
+    const double* data = ensemble.GetObservations().data();
+
+    ChMatrixDynamic<> actions(num_envs, 1);
+    ChVectorDynamic<> obs(3);
+    for (int k = 0; k < 100; k++) {
+        for (int env = 0; env < num_envs; env++)
+            actions(env, 0) = 10.0 * (env + 1) * std::sin(0.1 * k);
+        ensemble.Step(step, actions);
+
+        for (int env = 0; env < num_envs; env++) {
+            ApplyAction(env, *systems[env], actions.row(env).transpose());
+            systems[env]->DoStepDynamics(step);
+            systems[env]->DoStepDynamics(step);
+        }
+    }
+
+    ASSERT_EQ(ensemble.GetObservations().data(), data);
+    for (int env = 0; env < num_envs; env++) {
+        Observe(env, *systems[env], obs);
+        ASSERT_EQ(ensemble.GetSystem(env).GetChTime(), systems[env]->GetChTime());
+        ASSERT_EQ(ensemble.GetObservations()(env, 0), obs(0));
+        ASSERT_EQ(ensemble.GetObservations()(env, 1), obs(1));
+        ASSERT_EQ(ensemble.GetObservations()(env, 2), obs(2));
+        ASSERT_EQ(ensemble.GetRewards()(env), -obs(0));
+        ASSERT_EQ(ensemble.GetDone()(env), 0);
+    }
+
+    ASSERT_THROW(ensemble.Step(step, actions.topRows(2)), std::runtime_error);
+}
+
+TEST(ChSystemEnsemble, auto_reset) {
+    utils::ChSystemEnsemble ensemble(num_envs, CreateSystem);
+    ensemble.SetObservationFunction(3, Observe);
+    ensemble.SetDoneFunction([](int env, ChSystem& sys) { return sys.GetChTime() > 0.05 * (env + 1) - 1e-9; });
+    ensemble.SetAutoReset(true);
+    ensemble.Reset();
+
+    // Environment 0 terminates after 50 steps and is re-created; all others continue
+    for (int k = 0; k < 50; k++)
+        ensemble.Step(step);
+
+    ASSERT_EQ(ensemble.GetDone()(0), 1);
+    ASSERT_EQ(ensemble.GetSystem(0).GetChTime(), 0.0);
+    ASSERT_EQ(ensemble.GetObservations()(0, 1), 1.0);
+    for (int env = 1; env < num_envs; env++) {
+        ASSERT_EQ(ensemble.GetDone()(env), 0);
+        ASSERT_LT(ensemble.GetObservations()(env, 1), 1.0);
+    }
+}
+
+static std::shared_ptr<ChSystem> CreateContactSystem(int env) {
+    auto sys = chrono_types::make_shared<ChSystemNSC>();
+    sys->SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 4, 0.2, 1000, false, true, mat);
+    ground->SetFixed(true);
+    sys->AddBody(ground);
+
+    for (int i = 0; i < 4; i++) {
+        auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.2, 1000, false, true, mat);
+        ball->SetPos(ChVector3d(0.5 * i - 0.75, 0.1 * env, 0.5 + 0.3 * i));
+        sys->AddBody(ball);
+    }
+
+    return sys;
+}
+
+static void ObserveBalls(int env, ChSystem& sys, ChVectorRef obs) {
+    for (int i = 0; i < 4; i++)
+        obs(i) = sys.GetBodies()[i + 1]->GetPos().z();
+}
+
+TEST(ChSystemEnsemble, concurrent_steps) {
+    auto& scheduler = ChTaskScheduler::GetGlobal();
+    int num_threads = scheduler.GetNumThreads();
+    scheduler.SetNumThreads(4);
+
+    utils::ChSystemEnsemble ensemble(num_envs, CreateContactSystem);
+    ensemble.SetObservationFunction(4, ObserveBalls);
+    ensemble.SetNumTasks(num_envs);
+    ensemble.Reset();
+
+    std::vector<std::shared_ptr<ChSystem>> systems;
+    for (int env = 0; env < num_envs; env++)
+        systems.push_back(CreateContactSystem(env));
+
+    ChVectorDynamic<> obs(4);
+    for (int k = 0; k < 40; k++) {
+        for (int i = 0; i < 25; i++)
+            ensemble.Step(step);
+        for (int env = 0; env < num_envs; env++) {
+            for (int i = 0; i < 25; i++)
+                systems[env]->DoStepDynamics(step);
+            ObserveBalls(env, *systems[env], obs);
+            for (int i = 0; i < 4; i++)
+                ASSERT_EQ(ensemble.GetObservations()(env, i), obs(i));
+        }
+    }
+
+    // The balls came to rest on the ground
+    ASSERT_NEAR(ensemble.GetObservations()(0, 3), 0.3, 0.05);
+
+    scheduler.SetNumThreads(num_threads);
+}
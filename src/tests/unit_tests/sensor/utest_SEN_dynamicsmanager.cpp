@@ -0,0 +1,101 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the dynamic sensor manager: the outputs of IMU sensors updated
+// with parallel and background filter processing match serial updates
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono_sensor/ChDynamicsManager.h"
+#include "chrono_sensor/filters/ChFilterAccess.h"
+#include "chrono_sensor/sensors/ChIMUSensor.h"
+
+using namespace chrono;
+using namespace sensor;
+
+static const int num_imus = 6;
+
+struct IMUSetup {
+    ChSystemNSC sys;
+    std::shared_ptr<ChDynamicsManager> manager;
+    std::vector<std::shared_ptr<ChAccelerometerSensor>> acc;
+    std::vector<std::shared_ptr<ChGyroscopeSensor>> gyro;
+
+    IMUSetup() {
+        sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+        auto body = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, false, false);
+        body->SetAngVelLocal(ChVector3d(0.1, 0.5, 2.0));
+        sys.AddBody(body);
+
+        manager = chrono_types::make_shared<ChDynamicsManager>(&sys);
+
+        // interleave sensor types; the manager groups them by type
+        for (int i = 0; i < num_imus; i++) {
+            ChFrame<double> offset(ChVector3d(0.1 * i, -0.05 * i, 0.2), QuatFromAngleZ(0.3 * i));
+            float rate = (i % 2 == 0) ? 1000.f : 500.f;
+            auto a = chrono_types::make_shared<ChAccelerometerSensor>(body, rate, offset, nullptr);
+            a->PushFilter(chrono_types::make_shared<ChFilterAccelAccess>());
+            manager->AssignSensor(a);
+            acc.push_back(a);
+
+            auto g = chrono_types::make_shared<ChGyroscopeSensor>(body, rate, offset, nullptr);
+            g->PushFilter(chrono_types::make_shared<ChFilterGyroAccess>());
+            manager->AssignSensor(g);
+            gyro.push_back(g);
+        }
+    }
+
+    void Advance(int num_steps) {
+        for (int i = 0; i < num_steps; i++) {
+            sys.DoStepDynamics(1e-3);
+            manager->UpdateSensors();
+        }
+        manager->Synchronize();
+    }
+};
+
+TEST(ChDynamicsManager, parallel_updates) {
+    IMUSetup serial;
+    IMUSetup parallel;
+    parallel.manager->SetParallelUpdates(true);
+    parallel.manager->SetAsynchronousUpdates(true);
+
+    for (int k = 0; k < 5; k++) {
+        serial.Advance(10);
+        parallel.Advance(10);
+
+        for (int i = 0; i < num_imus; i++) {
+            auto a_s = serial.acc[i]->GetMostRecentBuffer<UserAccelBufferPtr>();
+            auto a_p = parallel.acc[i]->GetMostRecentBuffer<UserAccelBufferPtr>();
+            ASSERT_TRUE(a_s->Buffer && a_p->Buffer);
+            ASSERT_EQ(a_s->LaunchedCount, a_p->LaunchedCount);
+            ASSERT_EQ(a_s->TimeStamp, a_p->TimeStamp);
+            ASSERT_EQ(a_s->Buffer[0].X, a_p->Buffer[0].X);
+            ASSERT_EQ(a_s->Buffer[0].Y, a_p->Buffer[0].Y);
+            ASSERT_EQ(a_s->Buffer[0].Z, a_p->Buffer[0].Z);
+
+            auto g_s = serial.gyro[i]->GetMostRecentBuffer<UserGyroBufferPtr>();
+            auto g_p = parallel.gyro[i]->GetMostRecentBuffer<UserGyroBufferPtr>();
+            ASSERT_TRUE(g_s->Buffer && g_p->Buffer);
+            ASSERT_EQ(g_s->LaunchedCount, g_p->LaunchedCount);
+            ASSERT_EQ(g_s->Buffer[0].Roll, g_p->Buffer[0].Roll);
+            ASSERT_EQ(g_s->Buffer[0].Pitch, g_p->Buffer[0].Pitch);
+            ASSERT_EQ(g_s->Buffer[0].Yaw, g_p->Buffer[0].Yaw);
+        }
+    }
+}
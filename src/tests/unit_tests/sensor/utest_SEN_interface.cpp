@@ -24,6 +24,8 @@
 #include "chrono/physics/ChLoadContainer.h"
 
 #include "chrono_sensor/sensors/ChCameraSensor.h"
+#include "chrono_sensor/sensors/ChDepthCamera.h"
+#include "chrono_sensor/sensors/ChMultiCameraSensor.h"
 #include "chrono_sensor/sensors/ChLidarSensor.h"
 #include "chrono_sensor/sensors/ChRadarSensor.h"
 #include "chrono_sensor/sensors/ChGPSSensor.h"
@@ -267,3 +269,58 @@ TEST(SensorInterface, mesh_channels) {
     ASSERT_GT(buffer->Buffer[0].intensity, 0.f);
     ASSERT_FLOAT_EQ(buffer->Buffer[0].range, 2.f);
 }
+
+// additional outputs of a multi-output camera, rendered from the same rays as the color image
+TEST(SensorInterface, multi_camera) {
+    ChSystemNSC sys;
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 100, false, false);
+    box->SetFixed(true);
+    sys.Add(box);
+
+    auto b = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 100, true, false);
+    b->SetPos({2.5, 0.0, 0.0});
+    b->SetFixed(true);
+    sys.Add(b);
+
+    auto manager = chrono_types::make_shared<ChSensorManager>(&sys);
+    manager->scene->AddPointLight({-100, 0, 0}, {1, 1, 1}, 500);
+
+    using Output = ChMultiCameraSensor::Output;
+    auto cam = chrono_types::make_shared<ChMultiCameraSensor>(box, 10, chrono::ChFrame<double>(), 3, 3, 0.1f);
+    cam->SetLag(0.f);
+    cam->PushFilter(chrono_types::make_shared<ChFilterRGBA8Access>());
+    cam->PushOutputFilter(Output::DEPTH, chrono_types::make_shared<ChFilterDepthAccess>());
+    cam->PushOutputFilter(Output::NORMALS, chrono_types::make_shared<ChFilterFloat4Access>());
+    manager->AddSensor(cam);
+
+    auto depth_cam = chrono_types::make_shared<ChDepthCamera>(box, 10, chrono::ChFrame<double>(), 3, 3, 0.1f);
+    depth_cam->SetLag(0.f);
+    depth_cam->PushFilter(chrono_types::make_shared<ChFilterDepthAccess>());
+    manager->AddSensor(depth_cam);
+
+    ASSERT_TRUE(cam->IsOutputEnabled(Output::DEPTH));
+    ASSERT_FALSE(cam->IsOutputEnabled(Output::SEGMENTATION));
+
+    while (sys.GetChTime() < 0.15) {
+        manager->Update();
+        sys.DoStepDynamics(0.01);
+    }
+
+    auto rgba = cam->GetMostRecentBuffer<UserRGBA8BufferPtr>();
+    auto depth = cam->GetMostRecentOutputBuffer<UserDepthBufferPtr, ChFilterDepthAccess>(Output::DEPTH);
+    auto normals = cam->GetMostRecentOutputBuffer<UserFloat4BufferPtr, ChFilterFloat4Access>(Output::NORMALS);
+    auto ref_depth = depth_cam->GetMostRecentBuffer<UserDepthBufferPtr>();
+    ASSERT_TRUE(rgba->Buffer);
+    ASSERT_TRUE(depth->Buffer);
+    ASSERT_TRUE(normals->Buffer);
+    ASSERT_EQ(depth->TimeStamp, rgba->TimeStamp);
+
+    // center pixel hits the box face facing the camera
+    ASSERT_NEAR(depth->Buffer[4].depth, 2.f, 1e-4f);
+    ASSERT_FLOAT_EQ(depth->Buffer[4].depth, ref_depth->Buffer[4].depth);
+    ASSERT_NEAR(normals->Buffer[4].B, 1.f, 1e-4f);
+    ASSERT_FLOAT_EQ(normals->Buffer[4].A, 1.f);
+
+    ASSERT_THROW((cam->GetMostRecentOutputBuffer<UserSemanticBufferPtr, ChFilterSemanticAccess>(Output::SEGMENTATION)),
+                 std::runtime_error);
+}
@@ -0,0 +1,73 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the interpolation of the state between steps, used for sampling
+// the sensors at their exact update times
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/core/ChRotation.h"
+#include "chrono_sensor/utils/ChStateInterpolation.h"
+
+using namespace chrono;
+using namespace sensor;
+
+TEST(ChStateInterpolation, frame_interpolation) {
+    ChFrame<double> f0(ChVector3d(0, 0, 0), QuatFromAngleZ(0));
+    ChFrame<double> f1(ChVector3d(2, 4, -2), QuatFromAngleZ(0.2));
+
+    ChFrame<double> f = InterpolateFrame(f0, f1, 0.5);
+    ASSERT_NEAR(f.GetPos().x(), 1, 1e-12);
+    ASSERT_NEAR(f.GetPos().y(), 2, 1e-12);
+    ASSERT_NEAR(f.GetPos().z(), -1, 1e-12);
+    ASSERT_NEAR(f.GetRot().GetCardanAnglesXYZ().z(), 0.1, 1e-9);
+
+    // the interpolation follows the shortest arc when the quaternions have opposite signs
+    ChFrame<double> f2(ChVector3d(0, 0, 0), -QuatFromAngleZ(0.2));
+    ASSERT_NEAR(InterpolateFrame(f0, f2, 0.5).GetRot().GetCardanAnglesXYZ().z(), 0.1, 1e-9);
+
+    ASSERT_NEAR((InterpolateFrame(f0, f1, 0).GetPos() - f0.GetPos()).Length(), 0, 1e-12);
+    ASSERT_NEAR((InterpolateFrame(f0, f1, 1).GetPos() - f1.GetPos()).Length(), 0, 1e-12);
+}
+
+TEST(ChStateInterpolation, pose_history) {
+    ChPoseHistory history(2);
+    std::vector<ChFrame<double>> frames;
+
+    history.Record(0.0, {ChFrame<double>(ChVector3d(0, 0, 0)), ChFrame<double>(ChVector3d(1, 0, 0))});
+    ASSERT_FALSE(history.Interpolate(0.5, frames));
+
+    history.Record(1.0, {ChFrame<double>(ChVector3d(1, 0, 0)), ChFrame<double>(ChVector3d(1, 2, 0))});
+    ASSERT_TRUE(history.Interpolate(0.25, frames));
+    ASSERT_EQ(frames.size(), 2);
+    ASSERT_NEAR(frames[0].GetPos().x(), 0.25, 1e-12);
+    ASSERT_NEAR(frames[1].GetPos().y(), 0.5, 1e-12);
+
+    ChFrame<double> frame;
+    ASSERT_TRUE(history.Interpolate(0.75, 1, frame));
+    ASSERT_NEAR(frame.GetPos().y(), 1.5, 1e-12);
+    ASSERT_FALSE(history.Interpolate(0.75, 2, frame));
+
+    // the oldest step is dropped when the buffer is full
+    history.Record(2.0, {ChFrame<double>(ChVector3d(3, 0, 0)), ChFrame<double>(ChVector3d(1, 2, 0))});
+    ASSERT_FALSE(history.Interpolate(0.5, frames));
+    ASSERT_TRUE(history.Interpolate(1.5, frames));
+    ASSERT_NEAR(frames[0].GetPos().x(), 2, 1e-12);
+
+    // the buffer is reset when the number of objects changes
+    history.Record(3.0, {ChFrame<double>(ChVector3d(3, 0, 0))});
+    ASSERT_FALSE(history.Interpolate(2.5, frames));
+}
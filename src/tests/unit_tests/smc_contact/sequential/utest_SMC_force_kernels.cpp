@@ -0,0 +1,178 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for the specialized SMC contact force kernels.
+// For every combination of normal force model, use of material properties,
+// tangential displacement model, and adhesion model, the batched evaluation
+// must reproduce the per-contact evaluation of the default force algorithm.
+// The Hooke model with explicit coefficients is also checked against its
+// closed-form expression.
+//
+// =============================================================================
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChContactSMC.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+using namespace chrono;
+
+static const int N = 200;
+
+class ContactData {
+  public:
+    ContactData() : delta(N), eff_radius(N), mass1(N), mass2(N), normal(N), vel1(N), vel2(N), relvel(N), mat(N) {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+        auto mat1 = chrono_types::make_shared<ChContactMaterialSMC>();
+        mat1->SetYoungModulus(2.0e5f);
+        mat1->SetRestitution(0.4f);
+        mat1->SetFriction(0.3f);
+        mat1->SetAdhesion(0.1f);
+        mat1->SetAdhesionMultDMT(0.2f);
+        auto mat2 = chrono_types::make_shared<ChContactMaterialSMC>();
+        mat2->SetYoungModulus(1.0e6f);
+        mat2->SetRestitution(0.8f);
+        mat2->SetFriction(0.5f);
+        ChContactMaterialCompositionStrategy strategy;
+
+        for (int i = 0; i < N; i++) {
+            // Include a few contacts without overlap
+            delta[i] = (i % 10 == 0) ? -1e-3 : 1e-3 * (1 + dist(gen));
+            eff_radius[i] = 0.1 * (2 + dist(gen));
+            mass1[i] = 2 + dist(gen);
+            mass2[i] = 3 + dist(gen);
+            normal[i] = ChVector3d(dist(gen), dist(gen), dist(gen)).GetNormalized();
+            vel1[i] = ChVector3d(dist(gen), dist(gen), dist(gen));
+            vel2[i] = ChVector3d(dist(gen), dist(gen), dist(gen));
+            relvel[i] = vel2[i] - vel1[i];
+            mat[i] = (i % 2 == 0) ? ChContactMaterialCompositeSMC(&strategy, mat1, mat2)
+                                  : ChContactMaterialCompositeSMC(&strategy, mat2, mat2);
+        }
+    }
+
+    std::vector<double> delta;
+    std::vector<double> eff_radius;
+    std::vector<double> mass1;
+    std::vector<double> mass2;
+    std::vector<ChVector3d> normal;
+    std::vector<ChVector3d> vel1;
+    std::vector<ChVector3d> vel2;
+    std::vector<ChVector3d> relvel;
+    std::vector<ChContactMaterialCompositeSMC> mat;
+};
+
+TEST(SMCForceKernels, batch_vs_single) {
+    ContactData data;
+    ChDefaultContactForceTorqueSMC algorithm;
+    std::vector<ChVector3d> force(N);
+
+    ChSystemSMC sys;
+    sys.SetSlipVelocityThreshold(0.05);
+
+    for (auto fmodel : {ChSystemSMC::Hooke, ChSystemSMC::Hertz, ChSystemSMC::PlainCoulomb, ChSystemSMC::Flores}) {
+        for (auto mat_props : {true, false}) {
+            for (auto tdispl : {ChSystemSMC::None, ChSystemSMC::OneStep, ChSystemSMC::MultiStep}) {
+                for (auto adhesion : {ChSystemSMC::AdhesionForceModel::Constant, ChSystemSMC::AdhesionForceModel::DMT,
+                                      ChSystemSMC::AdhesionForceModel::Perko}) {
+                    sys.SetContactForceModel(fmodel);
+                    sys.UseMaterialProperties(mat_props);
+                    sys.SetTangentialDisplacementModel(tdispl);
+                    sys.SetAdhesionForceModel(adhesion);
+
+                    sys.CalculateContactForces(N, data.delta.data(), data.eff_radius.data(), data.mass1.data(),
+                                               data.mass2.data(), data.normal.data(), data.relvel.data(),
+                                               data.mat.data(), force.data());
+
+                    for (int i = 0; i < N; i++) {
+                        auto wrench = algorithm.CalculateForceTorque(
+                            sys, data.normal[i], VNULL, VNULL, data.vel1[i], data.vel2[i], data.mat[i], data.delta[i],
+                            data.eff_radius[i], data.mass1[i], data.mass2[i], nullptr, nullptr);
+                        ASSERT_EQ(force[i], wrench.force) << "model " << fmodel << " contact " << i;
+                        ASSERT_EQ(wrench.torque, VNULL);
+                        if (data.delta[i] <= 0)
+                            ASSERT_EQ(force[i], VNULL);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(SMCForceKernels, hooke_coefficients) {
+    ContactData data;
+    std::vector<ChVector3d> force(N);
+
+    ChSystemSMC sys;
+    sys.SetContactForceModel(ChSystemSMC::Hooke);
+    sys.UseMaterialProperties(false);
+    sys.SetTangentialDisplacementModel(ChSystemSMC::None);
+    sys.SetAdhesionForceModel(ChSystemSMC::AdhesionForceModel::Constant);
+    sys.SetSlipVelocityThreshold(1e-4);
+
+    sys.CalculateContactForces(N, data.delta.data(), data.eff_radius.data(), data.mass1.data(), data.mass2.data(),
+                               data.normal.data(), data.relvel.data(), data.mat.data(), force.data());
+
+    for (int i = 0; i < N; i++) {
+        if (data.delta[i] <= 0)
+            continue;
+        const auto& mat = data.mat[i];
+        double eff_mass = data.mass1[i] * data.mass2[i] / (data.mass1[i] + data.mass2[i]);
+        double vn = data.relvel[i].Dot(data.normal[i]);
+        ChVector3d vt = data.relvel[i] - vn * data.normal[i];
+
+        double forceN = std::max(mat.kn * data.delta[i] - eff_mass * mat.gn * vn, 0.0);
+        double forceT = (forceN > 0) ? eff_mass * mat.gt * vt.Length() : 0.0;
+        forceN -= mat.adhesion_eff;
+        forceT = std::min(forceT, mat.mu_eff * std::abs(forceN));
+        ChVector3d expected = forceN * data.normal[i] - (forceT / vt.Length()) * vt;
+
+        ASSERT_NEAR((force[i] - expected).Length(), 0.0, 1e-10 * (1 + expected.Length())) << "contact " << i;
+    }
+}
+
+TEST(SMCForceKernels, kernel_selection) {
+    ChSystemSMC sys;
+
+    // Models without a dedicated implementation share the kernel of their fallback
+    sys.SetContactForceModel(ChSystemSMC::Hooke);
+    auto hooke = sys.GetContactForceKernel();
+    sys.SetContactForceModel(ChSystemSMC::Flores);
+    ASSERT_EQ(sys.GetContactForceKernel(), hooke);
+
+    sys.SetTangentialDisplacementModel(ChSystemSMC::OneStep);
+    auto one_step = sys.GetContactForceKernel();
+    sys.SetTangentialDisplacementModel(ChSystemSMC::MultiStep);
+    ASSERT_EQ(sys.GetContactForceKernel(), one_step);
+
+    sys.SetAdhesionForceModel(ChSystemSMC::AdhesionForceModel::Constant);
+    auto constant = sys.GetContactForceKernel();
+    sys.SetAdhesionForceModel(ChSystemSMC::AdhesionForceModel::Perko);
+    ASSERT_EQ(sys.GetContactForceKernel(), constant);
+
+    // Changing any setting reselects the kernel
+    sys.SetContactForceModel(ChSystemSMC::Hertz);
+    ASSERT_NE(sys.GetContactForceKernel(), constant);
+    auto hertz = sys.GetContactForceKernel();
+    sys.UseMaterialProperties(!sys.UsingMaterialProperties());
+    ASSERT_NE(sys.GetContactForceKernel(), hertz);
+
+    // A copy of the system uses the same kernel
+    ChSystemSMC copy(sys);
+    ASSERT_EQ(copy.GetContactForceKernel(), sys.GetContactForceKernel());
+}
@@ -0,0 +1,110 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for multithreaded SMC contact force evaluation.
+// A set of spheres is dropped in a layered arrangement on a fixed wall. The
+// results obtained with parallel evaluation and loading of contact forces are
+// compared against those obtained with sequential processing. In deterministic
+// mode, results must be bit-identical for any number of threads.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#define SMC_SEQUENTIAL
+#include "../utest_SMC.h"
+
+#include "chrono/physics/ChContactContainerSMC.h"
+
+class PileModel {
+  public:
+    PileModel(ChSystemSMC::ContactForceModel fmodel, int nthreads, bool deterministic = false) {
+        bool parallel = nthreads > 1;
+
+        auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+        mat->SetYoungModulus(2.0e5f);
+        mat->SetPoissonRatio(0.3f);
+        mat->SetSlidingFriction(0.3f);
+        mat->SetRestitution(0.3f);
+
+        SetSimParameters(&sys, ChVector3d(0, -9.81, 0), fmodel);
+        sys.SetNumThreads(nthreads);
+        sys.EnableDeterministic(deterministic);
+
+        auto container = std::static_pointer_cast<ChContactContainerSMC>(sys.GetContactContainer());
+        container->EnableParallelForces(parallel);
+
+        AddWall(&sys, mat, ChVector3d(8, 1, 8), 10.0, ChVector3d(0, -0.5, 0), ChVector3d(0, 0, 0), true);
+
+        // Spheres in each layer overlap slightly, with the layers offset from each other
+        for (int layer = 0; layer < 3; layer++) {
+            double offset = 0.25 * layer;
+            for (int i = 0; i < 6; i++) {
+                for (int j = 0; j < 6; j++) {
+                    ChVector3d pos(-1.5 + 0.59 * i + offset, 0.3 + 0.58 * layer, -1.5 + 0.59 * j + offset);
+                    bodies.push_back(AddSphere(&sys, mat, 0.3, 1.0, pos, ChVector3d(0, 0, 0)));
+                }
+            }
+        }
+    }
+
+    ChSystemSMC sys;
+    std::vector<std::shared_ptr<ChBody>> bodies;
+};
+
+class ParallelForcesTest : public ::testing::TestWithParam<ChSystemSMC::ContactForceModel> {};
+
+TEST_P(ParallelForcesTest, compare_sequential) {
+    PileModel model_ref(GetParam(), 1);
+    PileModel model_par(GetParam(), 4);
+
+    double step = 1e-4;
+    for (int i = 0; i < 2000; i++) {
+        model_ref.sys.DoStepDynamics(step);
+        model_par.sys.DoStepDynamics(step);
+        ASSERT_EQ(model_ref.sys.GetNumContacts(), model_par.sys.GetNumContacts()) << "step " << i;
+    }
+
+    ASSERT_GT(model_ref.sys.GetNumContacts(), 0);
+    for (size_t k = 0; k < model_ref.bodies.size(); k++) {
+        ASSERT_NEAR((model_ref.bodies[k]->GetPos() - model_par.bodies[k]->GetPos()).Length(), 0.0, 1e-6);
+        ASSERT_NEAR((model_ref.bodies[k]->GetPosDt() - model_par.bodies[k]->GetPosDt()).Length(), 0.0, 1e-6);
+    }
+}
+
+TEST_P(ParallelForcesTest, deterministic) {
+    PileModel model_ref(GetParam(), 1, true);
+    PileModel model_par(GetParam(), 3, true);
+
+    double step = 1e-4;
+    for (int i = 0; i < 1000; i++) {
+        model_ref.sys.DoStepDynamics(step);
+        model_par.sys.DoStepDynamics(step);
+        ASSERT_EQ(model_ref.sys.GetNumContacts(), model_par.sys.GetNumContacts()) << "step " << i;
+    }
+
+    ASSERT_GT(model_ref.sys.GetNumContacts(), 0);
+    for (size_t k = 0; k < model_ref.bodies.size(); k++) {
+        const auto& pos_ref = model_ref.bodies[k]->GetPos();
+        const auto& pos_par = model_par.bodies[k]->GetPos();
+        ASSERT_EQ(pos_ref.x(), pos_par.x());
+        ASSERT_EQ(pos_ref.y(), pos_par.y());
+        ASSERT_EQ(pos_ref.z(), pos_par.z());
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ChronoSequential,
+                         ParallelForcesTest,
+                         ::testing::Values(ChSystemSMC::ContactForceModel::Hooke,
+                                           ChSystemSMC::ContactForceModel::Hertz));
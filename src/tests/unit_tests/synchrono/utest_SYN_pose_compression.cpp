@@ -0,0 +1,114 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the quantized, keyframe-relative encoding of agent poses
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/core/ChRotation.h"
+
+#include "chrono_synchrono/utils/SynPoseCompressor.h"
+
+using namespace chrono;
+using namespace synchrono;
+
+static std::vector<ChFrameMoving<>> MakeFrames(double t) {
+    std::vector<ChFrameMoving<>> frames;
+    for (int i = 0; i < 5; i++) {
+        ChFrameMoving<> frame(ChVector3d(100 + 10 * t + i, -50 + 2 * i, 0.5), QuatFromAngleZ(0.3 * t + i));
+        frame.SetPosDt(ChVector3d(10, 0, 0.1 * i));
+        frame.SetAngVelParent(ChVector3d(0, 20.0 * i, 0.3));
+        frames.push_back(frame);
+    }
+    return frames;
+}
+
+static void CheckFrames(const std::vector<ChFrameMoving<>>& expected, const std::vector<ChFrameMoving<>>& decoded) {
+    ASSERT_EQ(expected.size(), decoded.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_LT((expected[i].GetPos() - decoded[i].GetPos()).Length(), 1e-3);
+        ASSERT_LT((expected[i].GetPosDt() - decoded[i].GetPosDt()).Length(), 1e-2);
+        ASSERT_LT((expected[i].GetAngVelParent() - decoded[i].GetAngVelParent()).Length(), 1e-2);
+
+        // Rotations are compared up to the sign of the quaternion
+        double dot = std::abs(expected[i].GetRot().Dot(decoded[i].GetRot()));
+        ASSERT_GT(dot, 1 - 1e-8);
+    }
+}
+
+TEST(SynPoseCompressor, keyframes_and_deltas) {
+    SynPoseCompressor encoder(1e-3, 4);
+    SynPoseCompressor decoder;
+
+    std::vector<uint8_t> data;
+    std::vector<ChFrameMoving<>> decoded;
+    for (int k = 0; k < 10; k++) {
+        auto frames = MakeFrames(0.1 * k);
+        encoder.Encode(frames, data);
+
+        // One keyframe every 4 messages
+        ASSERT_EQ(SynPoseCompressor::IsKeyframe(data), k % 4 == 0);
+
+        ASSERT_TRUE(decoder.Decode(data, decoded));
+        CheckFrames(frames, decoded);
+    }
+
+    // 25 bytes per frame in a delta, against 104 bytes for the double precision position, rotation and velocities
+    encoder.Encode(MakeFrames(1.0), data);
+    ASSERT_FALSE(SynPoseCompressor::IsKeyframe(data));
+    ASSERT_EQ(data.size(), 9 + 5 * 25);
+}
+
+TEST(SynPoseCompressor, missed_keyframe) {
+    SynPoseCompressor encoder(1e-3, 3);
+    SynPoseCompressor decoder;
+
+    std::vector<uint8_t> data;
+    std::vector<ChFrameMoving<>> decoded;
+
+    // The receiver joins after the first keyframe: deltas cannot be decoded until the next keyframe
+    encoder.Encode(MakeFrames(0), data);
+    encoder.Encode(MakeFrames(0.1), data);
+    ASSERT_FALSE(decoder.Decode(data, decoded));
+    encoder.Encode(MakeFrames(0.2), data);
+    ASSERT_FALSE(decoder.Decode(data, decoded));
+
+    encoder.Encode(MakeFrames(0.3), data);
+    ASSERT_TRUE(SynPoseCompressor::IsKeyframe(data));
+    ASSERT_TRUE(decoder.Decode(data, decoded));
+
+    // Deltas only reference the keyframe, so skipped messages do not matter
+    encoder.Encode(MakeFrames(0.4), data);
+    encoder.Encode(MakeFrames(0.5), data);
+    ASSERT_TRUE(decoder.Decode(data, decoded));
+    CheckFrames(MakeFrames(0.5), decoded);
+}
+
+TEST(SynPoseCompressor, large_motion) {
+    SynPoseCompressor encoder(1e-3, 100);
+    SynPoseCompressor decoder;
+
+    std::vector<uint8_t> data;
+    std::vector<ChFrameMoving<>> decoded;
+
+    // A motion beyond the delta range (32.767 m at 1 mm resolution) forces a keyframe
+    encoder.Encode(MakeFrames(0), data);
+    ASSERT_TRUE(decoder.Decode(data, decoded));
+    encoder.Encode(MakeFrames(10), data);
+    ASSERT_TRUE(SynPoseCompressor::IsKeyframe(data));
+    ASSERT_TRUE(decoder.Decode(data, decoded));
+    CheckFrames(MakeFrames(10), decoded);
+}
@@ -0,0 +1,184 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit tests for the SCM terrain grid storage and force evaluation:
+// - static sinkage of a box, compared with the Bekker pressure-sinkage relation;
+// - box driven over the terrain with 1 and 4 threads (parallel ray casting and
+//   contact force evaluation), with paging and with coarsening of the grid
+//   tiles left behind, all of which must match the sequential reference run.
+//
+// =============================================================================
+
+#include <cmath>
+#include <string>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkMotorLinearSpeed.h"
+#include "chrono/functions/ChFunctionConst.h"
+#include "chrono_vehicle/terrain/SCMTerrain.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+static const double box_size = 0.4;
+static const double delta = 0.02;
+static const double Kphi = 2e6;
+static const double n = 1.1;
+static const double R = 2e5;  // large damping, for a quasi-static sinkage without overshoot
+
+// Box on a flat SCM terrain (grid nodes not on the box edges), optionally driven along X at constant speed
+class SCMModel {
+  public:
+    SCMModel(int num_threads, double mass, double x, double speed) : terrain(&sys, false) {
+        sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+        sys.SetNumThreads(num_threads);
+        sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+        auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+        double density = mass / (box_size * box_size * box_size);
+        box = chrono_types::make_shared<ChBodyEasyBox>(box_size, box_size, box_size, density, false, true, mat);
+        box->SetPos(ChVector3d(x + delta / 2, delta / 2, box_size / 2));
+        sys.AddBody(box);
+
+        if (speed > 0) {
+            auto ground = chrono_types::make_shared<ChBody>();
+            ground->SetFixed(true);
+            sys.AddBody(ground);
+
+            auto motor = chrono_types::make_shared<ChLinkMotorLinearSpeed>();
+            motor->SetGuideConstraint(ChLinkMotorLinear::GuideConstraint::FREE);
+            motor->SetSpeedFunction(chrono_types::make_shared<ChFunctionConst>(speed));
+            motor->Initialize(box, ground, ChFrame<>(box->GetPos(), QUNIT));
+            sys.AddLink(motor);
+        }
+
+        terrain.SetSoilParameters(Kphi, 0, n, 0, 30, 0.01, 4e7, R);
+        terrain.AddMovingPatch(box, VNULL, ChVector3d(1.5 * box_size, 1.5 * box_size, box_size));
+        terrain.Initialize(10, 2, delta);
+    }
+
+    void Advance(double time) {
+        while (sys.GetChTime() < time - 1e-9)
+            sys.DoStepDynamics(1e-3);
+    }
+
+    ChSystemSMC sys;
+    SCMTerrain terrain;
+    std::shared_ptr<ChBody> box;
+};
+
+// Static sinkage of a box resting on the terrain: the Bekker pressure (without the cohesive term) must balance the
+// box weight, and the terrain force and node state must be consistent with the box position
+TEST(SCMTerrain, static_sinkage) {
+    double mass = 500;
+    SCMModel model(1, mass, 0, 0);
+    model.Advance(2.0);
+
+    double weight = mass * 9.81;
+    double pressure = weight / (box_size * box_size);
+    double sinkage = std::pow(pressure / Kphi, 1 / n);
+
+    double box_sinkage = box_size / 2 - model.box->GetPos().z();
+    ASSERT_NEAR(box_sinkage, sinkage, 0.02 * sinkage);
+
+    ChVector3d force, torque;
+    ASSERT_TRUE(model.terrain.GetContactForceBody(model.box, force, torque));
+    ASSERT_NEAR(force.z(), weight, 0.01 * weight);
+
+    auto info = model.terrain.GetNodeInfo(ChVector3d(0, 0, 0));
+    ASSERT_NEAR(info.sinkage, box_sinkage, 1e-3 * sinkage);
+    ASSERT_NEAR(info.sigma, pressure, 0.05 * pressure);
+    ASSERT_NEAR(model.terrain.GetHeight(ChVector3d(0, 0, 1)), -box_sinkage, 1e-3 * sinkage);
+
+    // Nodes under the box (20 x 20) and no other nodes are modified
+    ASSERT_EQ(model.terrain.GetModifiedNodes(true).size(), 400u);
+}
+
+// Compare a box driven over the terrain with the sequential reference run (bit-identical results)
+static void CompareDriven(SCMModel& model, SCMModel& ref) {
+    for (int k = 1; k <= 6; k++) {
+        model.Advance(0.5 * k);
+        ref.Advance(0.5 * k);
+
+        ASSERT_EQ(model.box->GetPos(), ref.box->GetPos());
+        ASSERT_EQ(model.box->GetRot(), ref.box->GetRot());
+
+        ChVector3d force, torque, ref_force, ref_torque;
+        ASSERT_TRUE(model.terrain.GetContactForceBody(model.box, force, torque));
+        ASSERT_TRUE(ref.terrain.GetContactForceBody(ref.box, ref_force, ref_torque));
+        ASSERT_EQ(force, ref_force);
+        ASSERT_EQ(torque, ref_torque);
+    }
+
+    ASSERT_GT(ref.box->GetPos().x(), 1.5);
+    ASSERT_GT(box_size / 2 - ref.box->GetPos().z(), 0.003);
+}
+
+TEST(SCMTerrain, parallel_driven) {
+    SCMModel model(4, 200, -4, 2);
+    SCMModel ref(1, 200, -4, 2);
+    CompareDriven(model, ref);
+
+    ASSERT_EQ(model.terrain.GetNumRayHits(), ref.terrain.GetNumRayHits());
+    ASSERT_EQ(model.terrain.GetModifiedNodes(true).size(), ref.terrain.GetModifiedNodes(true).size());
+}
+
+// Tiles evicted (to disk) behind the box do not change its motion and are still reported as modified nodes
+TEST(SCMTerrain, paging_driven) {
+    std::string dir = "scm_paging";
+    SCMModel model(4, 200, -4, 2);
+    SCMModel ref(1, 200, -4, 2);
+    model.terrain.EnablePaging(1.0, dir);
+    CompareDriven(model, ref);
+
+    auto tiles = model.terrain.GetNumTiles();
+    ASSERT_GT(tiles.second, 0);
+    ASSERT_LT(model.terrain.GetMemoryUsage(), ref.terrain.GetMemoryUsage());
+    ASSERT_EQ(model.terrain.GetModifiedNodes(true).size(), ref.terrain.GetModifiedNodes(true).size());
+
+    // A query in an evicted region reloads the terrain state
+    ASSERT_EQ(model.terrain.GetHeight(ChVector3d(-3.5, 0, 1)), ref.terrain.GetHeight(ChVector3d(-3.5, 0, 1)));
+    ASSERT_EQ(model.terrain.GetNumTiles().second, tiles.second - 1);
+
+    for (int tx = -5; tx <= 5; tx++) {
+        for (int ty = -2; ty <= 2; ty++) {
+            filesystem::path file(dir + "/tile_" + std::to_string(tx) + "_" + std::to_string(ty) + ".dat");
+            if (file.exists())
+                file.remove_file();
+        }
+    }
+    filesystem::path(dir).remove_file();
+}
+
+// Tiles coarsened behind the box do not change its motion
+TEST(SCMTerrain, coarsening_driven) {
+    SCMModel model(4, 200, -4, 2);
+    SCMModel ref(1, 200, -4, 2);
+    model.terrain.EnableCoarsening(0.5, 4);
+    CompareDriven(model, ref);
+
+    ASSERT_GT(model.terrain.GetNumCoarseTiles(), 0);
+    ASSERT_LT(model.terrain.GetMemoryUsage(), ref.terrain.GetMemoryUsage());
+
+    // The refined terrain approximates the rut left by the box
+    double h = model.terrain.GetHeight(ChVector3d(-3.0, 0, 1));
+    double ref_h = ref.terrain.GetHeight(ChVector3d(-3.0, 0, 1));
+    ASSERT_LT(ref_h, -0.003);
+    ASSERT_NEAR(h, ref_h, 0.2 * std::abs(ref_h));
+}
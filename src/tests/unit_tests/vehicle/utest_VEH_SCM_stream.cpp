@@ -0,0 +1,130 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit tests for the compact encoding of SCM terrain changes:
+// - round trip of node levels (with duplicates and negative grid indices);
+// - skipping of stale tile revisions;
+// - terrain checkpoint and restore.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono_vehicle/terrain/SCMTerrainStream.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+static std::vector<SCMTerrain::NodeLevel> CreateNodes(int n, double offset) {
+    std::vector<SCMTerrain::NodeLevel> nodes;
+    for (int i = -n; i < n; i++)
+        for (int j = -n; j < n; j++)
+            nodes.push_back(std::make_pair(ChVector2i(i, j), offset - 0.01 * std::exp(-0.01 * (i * i + j * j))));
+    return nodes;
+}
+
+static void Sort(std::vector<SCMTerrain::NodeLevel>& nodes) {
+    std::sort(nodes.begin(), nodes.end(), [](const SCMTerrain::NodeLevel& a, const SCMTerrain::NodeLevel& b) {
+        return a.first.x() < b.first.x() || (a.first.x() == b.first.x() && a.first.y() < b.first.y());
+    });
+}
+
+TEST(SCMTerrainStream, round_trip) {
+    auto nodes = CreateNodes(50, 0.5);
+
+    // Duplicate node: the last level must be encoded
+    auto input = nodes;
+    input.insert(input.begin(), std::make_pair(ChVector2i(3, -7), 10.0));
+
+    SCMTerrainStream encoder(1e-6);
+    SCMTerrainStream decoder;
+    auto data = encoder.Encode(input);
+    auto output = decoder.Decode(data);
+
+    // Compact encoding (vs. 16 bytes per node in the uncompressed list)
+    ASSERT_LT(data.size(), 4 * nodes.size());
+
+    Sort(nodes);
+    Sort(output);
+    ASSERT_EQ(output.size(), nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        ASSERT_EQ(output[i].first, nodes[i].first);
+        ASSERT_NEAR(output[i].second, nodes[i].second, 0.5e-6);
+    }
+
+    ASSERT_EQ(encoder.GetRevision(ChVector2i(-50, -50)), 1u);
+    ASSERT_EQ(decoder.GetRevision(ChVector2i(-50, -50)), 1u);
+    ASSERT_EQ(decoder.GetRevision(ChVector2i(1000, 1000)), 0u);
+
+    // Invalid streams
+    data.resize(data.size() / 2);
+    ASSERT_THROW(decoder.Decode(data), std::runtime_error);
+    data[0] = 'X';
+    ASSERT_THROW(decoder.Decode(data), std::runtime_error);
+}
+
+TEST(SCMTerrainStream, revisions) {
+    SCMTerrainStream encoder;
+    SCMTerrainStream decoder;
+
+    auto data1 = encoder.Encode(CreateNodes(10, 0.1));
+    auto data2 = encoder.Encode(CreateNodes(10, 0.2));
+    ASSERT_EQ(encoder.GetRevision(ChVector2i(0, 0)), 2u);
+
+    // Newer changes are applied, stale or duplicated ones are skipped
+    auto nodes2 = decoder.Decode(data2);
+    ASSERT_EQ(nodes2.size(), 400u);
+    ASSERT_TRUE(decoder.Decode(data1).empty());
+    ASSERT_TRUE(decoder.Decode(data2).empty());
+
+    // Changes in a tile with a newer revision
+    auto data3 = encoder.Encode({std::make_pair(ChVector2i(1, 2), 0.3)});
+    auto nodes3 = decoder.Decode(data3);
+    ASSERT_EQ(nodes3.size(), 1u);
+    ASSERT_EQ(nodes3[0].first, ChVector2i(1, 2));
+    ASSERT_NEAR(nodes3[0].second, 0.3, 1e-6);
+}
+
+TEST(SCMTerrainStream, checkpoint) {
+    ChSystemSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    SCMTerrain terrain(&sys, false);
+    terrain.Initialize(2, 2, 0.02);
+    terrain.SetModifiedNodes(CreateNodes(20, -0.05));
+
+    SCMTerrainStream stream;
+    std::string filename = "scm_checkpoint.dat";
+    stream.WriteCheckpoint(terrain, filename);
+
+    SCMTerrain terrain_restored(&sys, false);
+    terrain_restored.Initialize(2, 2, 0.02);
+    stream.ReadCheckpoint(terrain_restored, filename);
+    std::remove(filename.c_str());
+
+    auto nodes = terrain.GetModifiedNodes(true);
+    auto nodes_restored = terrain_restored.GetModifiedNodes(true);
+    Sort(nodes);
+    Sort(nodes_restored);
+    ASSERT_EQ(nodes_restored.size(), nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        ASSERT_EQ(nodes_restored[i].first, nodes[i].first);
+        ASSERT_NEAR(nodes_restored[i].second, nodes[i].second, 1e-6);
+    }
+}
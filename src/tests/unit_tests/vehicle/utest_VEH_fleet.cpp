@@ -0,0 +1,119 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the wheeled vehicle fleet manager: vehicles owning their Chrono
+// systems are synchronized and advanced on several threads (including the
+// concurrent system steps) and must match the same vehicles advanced
+// sequentially.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "chrono_vehicle/terrain/FlatTerrain.h"
+#include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicleFleet.h"
+
+#include "chrono_models/vehicle/hmmwv/HMMWV.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::vehicle::hmmwv;
+
+static const int num_vehicles = 4;
+static const double step = 2e-3;
+
+// Driver with a throttle ramp and a constant steering input
+class TestDriver : public ChDriver {
+  public:
+    TestDriver(ChVehicle& vehicle, double steering) : ChDriver(vehicle), m_steering_val(steering) {}
+
+    virtual void Synchronize(double time) override {
+        m_steering = m_steering_val;
+        m_braking = 0;
+        m_throttle = std::min(time, 0.5);
+    }
+
+  private:
+    double m_steering_val;
+};
+
+struct FleetVehicle {
+    FleetVehicle(int index) {
+        hmmwv = std::unique_ptr<HMMWV_Reduced>(new HMMWV_Reduced());
+        hmmwv->SetContactMethod(ChContactMethod::SMC);
+        hmmwv->SetChassisFixed(false);
+        hmmwv->SetInitPosition(ChCoordsys<>(ChVector3d(0, 5.0 * index, 0.7), QUNIT));
+        hmmwv->SetEngineType(EngineModelType::SIMPLE_MAP);
+        hmmwv->SetTransmissionType(TransmissionModelType::AUTOMATIC_SIMPLE_MAP);
+        hmmwv->SetDriveType(DrivelineTypeWV::RWD);
+        hmmwv->SetTireType(TireModelType::TMEASY);
+        hmmwv->SetTireStepSize(step);
+        hmmwv->Initialize();
+
+        driver = std::unique_ptr<TestDriver>(new TestDriver(hmmwv->GetVehicle(), 0.1 * index));
+        driver->Initialize();
+    }
+
+    std::unique_ptr<HMMWV_Reduced> hmmwv;
+    std::unique_ptr<TestDriver> driver;
+};
+
+TEST(ChWheeledVehicleFleet, parallel_advance) {
+    FlatTerrain terrain(0, 0.8f);
+
+    std::vector<std::unique_ptr<FleetVehicle>> fleet_vehicles;
+    std::vector<std::unique_ptr<FleetVehicle>> ref_vehicles;
+    for (int i = 0; i < num_vehicles; i++) {
+        fleet_vehicles.push_back(std::unique_ptr<FleetVehicle>(new FleetVehicle(i)));
+        ref_vehicles.push_back(std::unique_ptr<FleetVehicle>(new FleetVehicle(i)));
+    }
+
+    ChWheeledVehicleFleet fleet;
+    fleet.SetNumThreads(num_vehicles);
+    ASSERT_EQ(fleet.GetNumThreads(), num_vehicles);
+    for (auto& v : fleet_vehicles)
+        fleet.AddVehicle(&v->hmmwv->GetVehicle(), v->driver.get());
+
+    // A vehicle owning its system cannot share it with another fleet vehicle
+    ASSERT_THROW(fleet.AddVehicle(&fleet_vehicles[0]->hmmwv->GetVehicle()), std::invalid_argument);
+
+    for (int k = 0; k < 500; k++) {
+        double time = fleet_vehicles[0]->hmmwv->GetSystem()->GetChTime();
+        fleet.Synchronize(time, terrain);
+        fleet.Advance(step);
+
+        for (auto& v : ref_vehicles) {
+            v->driver->Synchronize(time);
+            v->hmmwv->GetVehicle().Synchronize(time, v->driver->GetInputs(), terrain);
+            v->driver->Advance(step);
+            v->hmmwv->GetVehicle().Advance(step);
+        }
+    }
+
+    for (int i = 0; i < num_vehicles; i++) {
+        auto& vehicle = fleet_vehicles[i]->hmmwv->GetVehicle();
+        auto& ref_vehicle = ref_vehicles[i]->hmmwv->GetVehicle();
+        ASSERT_EQ(vehicle.GetSystem()->GetChTime(), ref_vehicle.GetSystem()->GetChTime());
+        ASSERT_EQ(vehicle.GetPos(), ref_vehicle.GetPos());
+        ASSERT_EQ(vehicle.GetRot(), ref_vehicle.GetRot());
+        ASSERT_EQ(vehicle.GetSpeed(), ref_vehicle.GetSpeed());
+    }
+
+    // The vehicles are driving
+    ASSERT_GT(fleet_vehicles[0]->hmmwv->GetVehicle().GetSpeed(), 0.1);
+}
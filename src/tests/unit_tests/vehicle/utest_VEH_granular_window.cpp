@@ -0,0 +1,111 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the moving patch of granular terrain.
+// A settled granular patch is shifted repeatedly ahead of a monitored body.
+// Check that relocated particles are placed within the new front slab without
+// overlapping, in a configuration that does not need to settle again.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono_vehicle/terrain/GranularTerrain.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+static const double radius = 0.01;
+static const double step_size = 1e-4;
+
+// Collect the particle bodies of the granular terrain
+static std::vector<std::shared_ptr<ChBody>> GetParticles(ChSystem& sys) {
+    std::vector<std::shared_ptr<ChBody>> particles;
+    for (const auto& body : sys.GetBodies()) {
+        if (body->GetTag() >= 100)
+            particles.push_back(body);
+    }
+    return particles;
+}
+
+// Smallest center distance between any two particles
+static double MinDistance(const std::vector<std::shared_ptr<ChBody>>& particles) {
+    double dist = 1e30;
+    for (size_t i = 0; i < particles.size(); i++)
+        for (size_t j = i + 1; j < particles.size(); j++)
+            dist = std::min(dist, (particles[i]->GetPos() - particles[j]->GetPos()).Length());
+    return dist;
+}
+
+TEST(GranularTerrain, moving_patch) {
+    ChSystemSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetFixed(true);
+    sys.AddBody(body);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    mat->SetYoungModulus(1e7f);
+    mat->SetFriction(0.5f);
+    mat->SetRestitution(0.0f);
+
+    double shift = 0.1;
+    GranularTerrain terrain(&sys);
+    terrain.SetContactMaterial(mat);
+    terrain.EnableMovingPatch(body, 0.05, shift);
+    terrain.Initialize(ChVector3d(0, 0, 0), 0.4, 0.1, 3, radius, 2500);
+
+    auto particles = GetParticles(sys);
+    ASSERT_EQ(particles.size(), terrain.GetNumParticles());
+
+    // Settle the granular material
+    body->SetPos(ChVector3d(-1, 0, 0));
+    while (sys.GetChTime() < 0.6) {
+        terrain.Synchronize(sys.GetChTime());
+        ASSERT_FALSE(terrain.PatchMoved());
+        sys.DoStepDynamics(step_size);
+    }
+    double height = terrain.GetHeight(VNULL);
+
+    for (int move = 0; move < 3; move++) {
+        // Bring the monitored body within the buffer distance of the front boundary
+        double front = terrain.GetPatchFront();
+        body->SetPos(ChVector3d(front - 0.01, 0, 0));
+        terrain.Synchronize(sys.GetChTime());
+        ASSERT_TRUE(terrain.PatchMoved());
+        ASSERT_NEAR(terrain.GetPatchFront(), front + shift, 1e-12);
+
+        // All particles are within the patch and do not overlap
+        for (const auto& p : particles) {
+            ASSERT_GE(p->GetPos().x(), terrain.GetPatchRear() - radius);
+            ASSERT_LE(p->GetPos().x(), terrain.GetPatchFront() + radius);
+        }
+        ASSERT_GT(MinDistance(particles), 1.8 * radius);
+
+        // Relocated particles are placed in a settled configuration, not in layers above the patch
+        ASSERT_LT(terrain.GetHeight(VNULL), height + 2 * radius);
+        body->SetPos(ChVector3d(-1, 0, 0));
+        double time_end = sys.GetChTime() + 0.02;
+        while (sys.GetChTime() < time_end) {
+            terrain.Synchronize(sys.GetChTime());
+            sys.DoStepDynamics(step_size);
+        }
+    }
+}
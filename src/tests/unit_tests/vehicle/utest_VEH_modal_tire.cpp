@@ -0,0 +1,133 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit tests for the modal reduced deformable tire:
+// - partition of the tire nodes in boundary (rim and tread) and internal nodes;
+// - size of the reduced model and reuse of cached modes;
+// - short simulation of the inflated tire mounted on a fixed spindle.
+//
+// =============================================================================
+
+#include <cmath>
+#include <cstdio>
+
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/ChTerrain.h"
+#include "chrono_vehicle/wheeled_vehicle/ChWheel.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChModalTire.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ReissnerToroidalTire.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+static const int div_circumference = 20;
+static const int div_width = 6;
+static const int num_modes = 8;
+static const char* cache_file = "modal_tire_test.bin";
+
+class TestWheel : public ChWheel {
+  public:
+    TestWheel() : ChWheel("wheel"), m_inertia(0.2, 0.4, 0.2) {}
+    virtual std::string GetTemplateName() const override { return "TestWheel"; }
+    virtual double GetWheelMass() const override { return 10; }
+    virtual const ChVector3d& GetWheelInertia() const override { return m_inertia; }
+    virtual double GetRadius() const override { return 0.35; }
+    virtual double GetWidth() const override { return 0.2; }
+
+  private:
+    ChVector3d m_inertia;
+};
+
+// Create a system with a fixed spindle and a modal tire mounted on it.
+static std::shared_ptr<ChModalTire> CreateTire(ChSystemSMC& sys) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto spindle = chrono_types::make_shared<ChBody>();
+    spindle->SetFixed(true);
+    spindle->SetPos(ChVector3d(0, 0, 1));
+    sys.AddBody(spindle);
+
+    auto wheel = chrono_types::make_shared<TestWheel>();
+    wheel->Initialize(nullptr, spindle, LEFT);
+
+    auto full_tire = chrono_types::make_shared<ReissnerToroidalTire>("full_tire");
+    full_tire->SetDivCircumference(div_circumference);
+    full_tire->SetDivWidth(div_width);
+
+    auto tire = chrono_types::make_shared<ChModalTire>("modal_tire", full_tire);
+    tire->SetNumModes(num_modes);
+    tire->SetModesCacheFile(cache_file);
+    std::static_pointer_cast<ChTire>(tire)->Initialize(wheel);
+
+    return tire;
+}
+
+TEST(ChModalTire, reduction) {
+    std::remove(cache_file);
+
+    ChSystemSMC sys1;
+    auto tire1 = CreateTire(sys1);
+
+    // Rim nodes (2 per cross section) and tread nodes are boundary nodes
+    int num_nodes = div_circumference * (div_width + 1);
+    int num_boundary = (int)tire1->GetMesh()->GetNumNodes();
+    int num_internal = (int)tire1->GetInternalMesh()->GetNumNodes();
+    ASSERT_EQ(num_boundary + num_internal, num_nodes);
+    ASSERT_GT(tire1->GetNumContactNodes(), 0);
+    ASSERT_EQ(num_boundary, 2 * div_circumference + tire1->GetNumContactNodes());
+    ASSERT_EQ(tire1->GetInternalMesh()->GetNumElements(), div_circumference * div_width);
+
+    // Dynamic modes plus the static correction mode
+    auto assembly1 = tire1->GetModalAssembly();
+    ASSERT_EQ(assembly1->GetNumCoordinatesModal(), num_modes + 1);
+
+    // A second tire loads the modes from the cache file
+    ChSystemSMC sys2;
+    auto tire2 = CreateTire(sys2);
+    auto assembly2 = tire2->GetModalAssembly();
+    ASSERT_EQ(assembly2->GetNumCoordinatesModal(), num_modes + 1);
+    ASSERT_EQ(assembly2->GetUndampedFrequencies(), assembly1->GetUndampedFrequencies());
+    ASSERT_TRUE(assembly2->GetModalMassMatrix().isApprox(assembly1->GetModalMassMatrix()));
+
+    std::remove(cache_file);
+}
+
+TEST(ChModalTire, simulation) {
+    std::remove(cache_file);
+
+    ChSystemSMC sys;
+    auto tire = CreateTire(sys);
+    ChTerrain terrain;
+
+    double step = 1e-4;
+    for (int i = 0; i < 100; i++) {
+        tire->Synchronize(sys.GetChTime(), terrain);
+        sys.DoStepDynamics(step);
+    }
+
+    // The inflated tire stays attached to the fixed spindle, with small deformations
+    double radius = tire->GetRadius();
+    for (const auto& node : tire->GetInternalMesh()->GetNodes()) {
+        auto pos = std::static_pointer_cast<fea::ChNodeFEAxyzrot>(node)->GetPos();
+        ASSERT_LT((pos - ChVector3d(0, 0, 1)).Length(), 1.1 * radius);
+    }
+
+    auto force = tire->ReportTireForce(&terrain);
+    ASSERT_TRUE(std::isfinite(force.force.Length()));
+
+    std::remove(cache_file);
+}
@@ -0,0 +1,118 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit tests for the binary cache of vehicle model specification files:
+// - recording, writing, and loading of JSON files and meshes;
+// - validation of cache entries against modified source files.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+
+#include "chrono_vehicle/utils/ChUtilsJSON.h"
+#include "chrono_vehicle/utils/ChVehicleModelCache.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+static const char* json_file = "model_cache_test.json";
+static const char* mesh_file = "model_cache_test.obj";
+static const char* cache_file = "model_cache_test.bin";
+
+class ModelCache : public ::testing::Test {
+  protected:
+    ModelCache() {
+        std::ofstream json(json_file);
+        json << "{\n  // comment\n  \"Name\": \"Test\",\n  \"Mass\": 1250.5,\n  \"Table\": [[0, 1], [2, 3.5]]\n}\n";
+        std::ofstream obj(mesh_file);
+        obj << "v 0 0 0\nv 1 0 0\nv 0 1 0\nv 0 0 1\nvn 0 0 1\nvt 0 0\nvt 1 1\n";
+        obj << "f 1/1/1 2/2/1 3/1/1\nf 1/2/1 3/1/1 4/2/1\n";
+    }
+
+    ~ModelCache() {
+        ChVehicleModelCache::StopRecording();
+        ChVehicleModelCache::Unload();
+        std::remove(json_file);
+        std::remove(mesh_file);
+        std::remove(cache_file);
+    }
+
+    void CreateCache() {
+        ChVehicleModelCache::StartRecording();
+        rapidjson::Document d;
+        ReadFileJSON(json_file, d);
+        ChVehicleModelCache::ReadMesh(mesh_file, true, true);
+        ChVehicleModelCache::StopRecording();
+        ASSERT_TRUE(ChVehicleModelCache::Write(cache_file));
+    }
+};
+
+TEST_F(ModelCache, round_trip) {
+    CreateCache();
+
+    // Entries are read from the cache, even after the source files are removed
+    ASSERT_TRUE(ChVehicleModelCache::Load(cache_file));
+    ASSERT_EQ(ChVehicleModelCache::GetNumEntries(), 2u);
+    std::remove(json_file);
+    std::remove(mesh_file);
+
+    rapidjson::Document d;
+    ReadFileJSON(json_file, d);
+    ASSERT_TRUE(d.IsObject());
+    ASSERT_STREQ(d["Name"].GetString(), "Test");
+    ASSERT_EQ(d["Mass"].GetDouble(), 1250.5);
+    ASSERT_EQ(d["Table"][1][1].GetDouble(), 3.5);
+
+    auto trimesh = ChVehicleModelCache::ReadMesh(mesh_file, true, true);
+    ASSERT_TRUE(trimesh);
+    ASSERT_EQ(trimesh->GetNumVertices(), 4u);
+    ASSERT_EQ(trimesh->GetNumTriangles(), 2u);
+    ASSERT_EQ(trimesh->GetCoordsNormals().size(), 1u);
+    ASSERT_EQ(trimesh->GetCoordsUV().size(), 2u);
+    ASSERT_EQ(trimesh->GetIndicesVertexes()[1], ChVector3i(0, 2, 3));
+    ASSERT_EQ(trimesh->GetIndicesUV()[1], ChVector3i(1, 0, 1));
+    ASSERT_EQ(trimesh->GetCoordsVertices()[3], ChVector3d(0, 0, 1));
+    ASSERT_EQ(trimesh->GetFileName(), mesh_file);
+
+    // Optional mesh data is dropped as requested
+    auto trimesh_v = ChVehicleModelCache::ReadMesh(mesh_file, false, false);
+    ASSERT_TRUE(trimesh_v->GetCoordsNormals().empty());
+    ASSERT_TRUE(trimesh_v->GetIndicesUV().empty());
+    ASSERT_EQ(trimesh_v->GetNumTriangles(), 2u);
+}
+
+TEST_F(ModelCache, validation) {
+    CreateCache();
+    ASSERT_TRUE(ChVehicleModelCache::Load(cache_file));
+
+    // A modified source file takes precedence over its cache entry
+    {
+        std::ofstream json(json_file);
+        json << "{\"Name\": \"Modified version\"}";
+    }
+    rapidjson::Document d;
+    ReadFileJSON(json_file, d);
+    ASSERT_STREQ(d["Name"].GetString(), "Modified version");
+
+    // Invalid cache files are rejected (and the loaded cache is kept)
+    {
+        std::ofstream file(json_file, std::ios::binary);
+        file << "not a cache file";
+    }
+    ASSERT_FALSE(ChVehicleModelCache::Load(json_file));
+    ASSERT_TRUE(ChVehicleModelCache::IsLoaded());
+}
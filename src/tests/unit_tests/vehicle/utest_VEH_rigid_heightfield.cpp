@@ -0,0 +1,133 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit tests for the tiled heightfield RigidTerrain patch:
+// - height and normal from direct grid lookup;
+// - streaming of tiles around an active domain;
+// - contact of a body with the heightfield tiles.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Heightmap image with gray level 4 * i + 2 * j at pixel (i, j), with j counted from the bottom row
+static const int nx = 33;
+static const int ny = 17;
+static const char* heightmap_file = "rigid_heightfield.pgm";
+
+static void WriteHeightmap() {
+    std::ofstream file(heightmap_file, std::ios::binary);
+    file << "P5\n" << nx << " " << ny << "\n255\n";
+    for (int row = 0; row < ny; row++) {
+        for (int i = 0; i < nx; i++)
+            file.put((char)(4 * i + 2 * (ny - 1 - row)));
+    }
+}
+
+// Patch of 32 x 16 m (1 m grid spacing), with heights in [0, 2.55] and tiles of 8 x 8 cells
+class RigidHeightfield : public ::testing::Test {
+  protected:
+    RigidHeightfield() : terrain(&sys) {
+        WriteHeightmap();
+        sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+        sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+        auto material = chrono_types::make_shared<ChContactMaterialNSC>();
+        patch = terrain.AddHeightfieldPatch(material, ChCoordsys<>(ChVector3d(10, 5, 0), QUNIT), heightmap_file, 32,
+                                            16, 0, 2.55, 8, false);
+        std::remove(heightmap_file);
+    }
+
+    // Height of the plane through the grid nodes
+    double Height(double x, double y) const { return 0.04 * (x - 10 + 16) + 0.02 * (y - 5 + 8); }
+
+    ChSystemNSC sys;
+    RigidTerrain terrain;
+    std::shared_ptr<RigidTerrain::Patch> patch;
+};
+
+TEST_F(RigidHeightfield, lookup) {
+    terrain.Initialize();
+
+    // All 4 x 2 tiles (plus the patch reference body) are in the system in the absence of active domains
+    ASSERT_EQ(sys.GetBodies().size(), 9u);
+
+    ChVector3d normal_exact = ChVector3d(-0.04, -0.02, 1).GetNormalized();
+    for (double x : {-5.3, 0.0, 10.25, 25.9}) {
+        for (double y : {-2.9, 1.5, 12.7}) {
+            ChVector3d loc(x, y, 10);
+            ASSERT_NEAR(terrain.GetHeight(loc), Height(x, y), 1e-5);
+            ASSERT_NEAR((terrain.GetNormal(loc) - normal_exact).Length(), 0, 1e-5);
+        }
+    }
+
+    // Outside the patch
+    ASSERT_EQ(terrain.GetHeight(ChVector3d(30, 0, 10)), 0.0);
+}
+
+TEST_F(RigidHeightfield, streaming) {
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetPos(ChVector3d(-2, -1, 5));
+    sys.AddBody(body);
+
+    // Disk of radius 1 around (-2,-1) intersects only the tile [-6,2] x [-3,5]
+    terrain.AddActiveDomain(body, VNULL, 1);
+    terrain.Initialize();
+    ASSERT_EQ(sys.GetBodies().size(), 3u);
+
+    // Disk of radius 1 around (2.5,-1) intersects also the tile [2,10] x [-3,5]
+    body->SetPos(ChVector3d(2.5, -1, 5));
+    terrain.Synchronize(0);
+    ASSERT_EQ(sys.GetBodies().size(), 4u);
+
+    // The first tile is kept within the hysteresis distance, then removed
+    body->SetPos(ChVector3d(6, -1, 5));
+    terrain.Synchronize(0);
+    ASSERT_EQ(sys.GetBodies().size(), 4u);
+    body->SetPos(ChVector3d(7.5, -1, 5));
+    terrain.Synchronize(0);
+    ASSERT_EQ(sys.GetBodies().size(), 3u);
+
+    // Height lookup does not depend on the tiles in the system
+    ASSERT_NEAR(terrain.GetHeight(ChVector3d(-5, 10, 10)), Height(-5, 10), 1e-5);
+}
+
+TEST_F(RigidHeightfield, contact) {
+    auto material = chrono_types::make_shared<ChContactMaterialNSC>();
+    auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, material);
+    ball->SetPos(ChVector3d(13.3, 6.6, Height(13.3, 6.6) + 1));
+    sys.AddBody(ball);
+
+    terrain.AddActiveDomain(ball, VNULL, 2);
+    terrain.Initialize();
+
+    for (int i = 0; i < 1000; i++) {
+        terrain.Synchronize(sys.GetChTime());
+        sys.DoStepDynamics(1e-3);
+    }
+
+    // The ball rests on (or rolls along) the inclined terrain surface
+    const auto& pos = ball->GetPos();
+    double distance = (pos.z() - Height(pos.x(), pos.y())) * ChVector3d(-0.04, -0.02, 1).GetNormalized().z();
+    ASSERT_NEAR(distance, 0.5, 0.02);
+}
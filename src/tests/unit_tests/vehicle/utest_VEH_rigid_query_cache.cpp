@@ -0,0 +1,117 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit tests for the RigidTerrain query cache:
+// - cached height and normal queries on a heightmap mesh patch (vs. ray casting);
+// - fall back to ray casting outside the sampled surface;
+// - batched terrain queries.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Heightmap image with gray level 4 * i + 2 * j at pixel (i, j), with j counted from the bottom row
+static const int nx = 33;
+static const int ny = 17;
+static const char* heightmap_file = "rigid_query_cache.pgm";
+
+static void WriteHeightmap() {
+    std::ofstream file(heightmap_file, std::ios::binary);
+    file << "P5\n" << nx << " " << ny << "\n255\n";
+    for (int row = 0; row < ny; row++) {
+        for (int i = 0; i < nx; i++)
+            file.put((char)(4 * i + 2 * (ny - 1 - row)));
+    }
+}
+
+// Identical heightmap patches of 32 x 16 m, with and without query cache, next to a box patch
+class RigidQueryCache : public ::testing::Test {
+  protected:
+    RigidQueryCache() : terrain(&sys), terrain_cached(&sys) {
+        WriteHeightmap();
+        sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+        auto material = chrono_types::make_shared<ChContactMaterialNSC>();
+        for (auto t : {&terrain, &terrain_cached}) {
+            t->AddPatch(material, ChCoordsys<>(ChVector3d(10, 5, 0), QUNIT), heightmap_file, 32, 16, 0, 2.55, true, 0,
+                        false);
+            t->AddPatch(material, ChCoordsys<>(ChVector3d(40, 5, -1), QUNIT), 20, 16, 1, false, 1, false);
+        }
+        std::remove(heightmap_file);
+        terrain_cached.EnableQueryCache(0.25);
+        terrain.Initialize();
+        terrain_cached.Initialize();
+
+        // Ray casting requires an up-to-date collision system
+        sys.DoStepDynamics(1e-3);
+    }
+
+    // Height of the plane through the mesh vertices
+    double Height(double x, double y) const { return 0.04 * (x - 10 + 16) + 0.02 * (y - 5 + 8); }
+
+    ChSystemNSC sys;
+    RigidTerrain terrain;
+    RigidTerrain terrain_cached;
+};
+
+// Cached heights and normals are exact for the planar mesh; heights from ray casting are only approximate
+TEST_F(RigidQueryCache, mesh_patch) {
+    ChVector3d normal_exact = ChVector3d(-0.04, -0.02, 1).GetNormalized();
+    for (double x : {-5.3, 0.0, 10.13, 25.9}) {
+        for (double y : {-2.9, 1.5, 12.71}) {
+            ChVector3d loc(x, y, 10);
+            ASSERT_NEAR(terrain_cached.GetHeight(loc), Height(x, y), 1e-5);
+            ASSERT_NEAR(terrain_cached.GetHeight(loc), terrain.GetHeight(loc), 1e-2);
+            ASSERT_NEAR((terrain_cached.GetNormal(loc) - normal_exact).Length(), 0, 1e-5);
+        }
+    }
+}
+
+TEST_F(RigidQueryCache, fallback) {
+    // Box patch and outside all patches
+    for (double x : {35.0, 60.0}) {
+        ChVector3d loc(x, 5, 10);
+        ASSERT_NEAR(terrain_cached.GetHeight(loc), terrain.GetHeight(loc), 1e-10);
+    }
+
+    // Location below the mesh surface (no terrain below)
+    ChVector3d loc(25, 5, -0.5);
+    ASSERT_NEAR(terrain_cached.GetHeight(loc), terrain.GetHeight(loc), 1e-10);
+}
+
+TEST_F(RigidQueryCache, batch) {
+    std::vector<ChVector3d> locs = {ChVector3d(0.3, 0.1, 10), ChVector3d(12.2, 7.3, 10), ChVector3d(40, 0, 10)};
+    std::vector<double> heights;
+    std::vector<ChVector3d> normals;
+    std::vector<float> frictions;
+    terrain_cached.GetPropertiesBatch(locs, heights, normals, frictions);
+    ASSERT_EQ(heights.size(), locs.size());
+    for (size_t i = 0; i < locs.size(); i++) {
+        double height;
+        ChVector3d normal;
+        float friction;
+        terrain_cached.GetProperties(locs[i], height, normal, friction);
+        ASSERT_EQ(heights[i], height);
+        ASSERT_EQ(normals[i], normal);
+        ASSERT_EQ(frictions[i], friction);
+    }
+}
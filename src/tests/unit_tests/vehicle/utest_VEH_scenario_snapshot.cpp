@@ -0,0 +1,126 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit tests for scenario snapshots:
+// - forked copies of a settled scenario reproduce the continued original run;
+// - snapshot files and SCM terrain state;
+// - rejection of incompatible systems.
+//
+// =============================================================================
+
+#include <cstdio>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono_vehicle/utils/ChScenarioSnapshot.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Scenario with a pendulum and a box dropped on the ground
+struct Scenario {
+    Scenario() {
+        sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+        auto material = chrono_types::make_shared<ChContactMaterialSMC>();
+
+        auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 10, 1, 1000, false, true, material);
+        ground->SetPos(ChVector3d(0, 0, -0.5));
+        ground->SetFixed(true);
+        sys.AddBody(ground);
+
+        box = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.5, 1000, false, true, material);
+        box->SetPos(ChVector3d(2, 0, 1));
+        sys.AddBody(box);
+
+        pendulum = chrono_types::make_shared<ChBody>();
+        pendulum->SetPos(ChVector3d(1, 0, 3));
+        sys.AddBody(pendulum);
+        auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+        joint->Initialize(ground, pendulum, ChFrame<>(ChVector3d(0, 0, 3), QuatFromAngleX(CH_PI_2)));
+        sys.AddLink(joint);
+    }
+
+    void Advance(int num_steps) {
+        for (int i = 0; i < num_steps; i++)
+            sys.DoStepDynamics(1e-3);
+    }
+
+    ChSystemSMC sys;
+    std::shared_ptr<ChBody> box;
+    std::shared_ptr<ChBody> pendulum;
+};
+
+TEST(ChScenarioSnapshot, fork) {
+    Scenario original;
+    original.Advance(500);
+
+    ChScenarioSnapshot snapshot;
+    snapshot.Capture(original.sys);
+    ASSERT_NEAR(snapshot.GetTime(), 0.5, 1e-9);
+
+    std::vector<std::unique_ptr<Scenario>> copies(4);
+    snapshot.Fork(
+        4,
+        [&copies](int i) {
+            copies[i] = std::unique_ptr<Scenario>(new Scenario);
+            return ChScenarioSnapshot::Target{&copies[i]->sys, {}};
+        },
+        2);
+
+    original.Advance(500);
+    for (auto& copy : copies) {
+        ASSERT_NEAR(copy->sys.GetChTime(), 0.5, 1e-9);
+        copy->Advance(500);
+        ASSERT_NEAR((copy->box->GetPos() - original.box->GetPos()).Length(), 0, 1e-6);
+        ASSERT_NEAR((copy->pendulum->GetPos() - original.pendulum->GetPos()).Length(), 0, 1e-6);
+        ASSERT_NEAR((copy->pendulum->GetPosDt() - original.pendulum->GetPosDt()).Length(), 0, 1e-6);
+    }
+}
+
+TEST(ChScenarioSnapshot, file) {
+    ChSystemSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    SCMTerrain terrain(&sys, false);
+    terrain.Initialize(2, 2, 0.02);
+    terrain.SetModifiedNodes({std::make_pair(ChVector2i(3, -4), -0.05), std::make_pair(ChVector2i(0, 1), -0.02)});
+
+    Scenario scenario;
+    scenario.Advance(100);
+    ChScenarioSnapshot snapshot;
+    snapshot.Capture(scenario.sys, {chrono_types::make_shared<ChScenarioSnapshot::SCMStateProvider>(terrain)});
+    snapshot.Write("scenario_snapshot.dat");
+
+    ChScenarioSnapshot loaded;
+    loaded.Read("scenario_snapshot.dat");
+    std::remove("scenario_snapshot.dat");
+    ASSERT_TRUE(loaded.IsValid());
+
+    Scenario copy;
+    SCMTerrain terrain_copy(&sys, false);
+    terrain_copy.Initialize(2, 2, 0.02);
+    auto terrain_state = chrono_types::make_shared<ChScenarioSnapshot::SCMStateProvider>(terrain_copy);
+    loaded.Restore(copy.sys, {terrain_state});
+    ASSERT_NEAR((copy.pendulum->GetPos() - scenario.pendulum->GetPos()).Length(), 0, 1e-12);
+    ASSERT_EQ(terrain_copy.GetModifiedNodes(true).size(), 2u);
+
+    // Missing state provider
+    ASSERT_THROW(loaded.Restore(copy.sys), std::runtime_error);
+
+    // Incompatible system
+    copy.sys.AddBody(chrono_types::make_shared<ChBody>());
+    ASSERT_THROW(loaded.Restore(copy.sys, {terrain_state}), std::runtime_error);
+}
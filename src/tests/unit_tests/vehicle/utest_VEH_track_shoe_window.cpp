@@ -0,0 +1,93 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit tests for the window of track shoes within reach of a track wheel:
+// - tracking of a range of shoes moving along the chain (with wrap-around);
+// - detection of shoes reaching the wheel from a different part of the chain.
+//
+// =============================================================================
+
+#include <set>
+
+#include "chrono_vehicle/tracked_vehicle/ChTrackShoeWindow.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono::vehicle;
+
+static std::set<size_t> WindowShoes(const ChTrackShoeWindow& window) {
+    std::set<size_t> shoes;
+    for (size_t k = 0; k < window.GetNumShoes(); k++)
+        shoes.insert(window.GetShoeIndex(k));
+    return shoes;
+}
+
+TEST(ChTrackShoeWindow, moving) {
+    const size_t n = 20;
+    ChTrackShoeWindow window;
+    int num_tests = 0;
+
+    // Range of 4 shoes within reach, advancing by one shoe at each update
+    for (size_t step = 0; step < 2 * n; step++) {
+        auto in_reach = [&](size_t is) {
+            num_tests++;
+            return (is + n - step % n) % n < 4;
+        };
+        num_tests = 0;
+        window.Update(n, in_reach);
+
+        std::set<size_t> expected;
+        for (size_t i = 0; i < 4; i++)
+            expected.insert((step + i) % n);
+        ASSERT_EQ(WindowShoes(window), expected);
+
+        // Only the first update performs a full scan
+        if (step > 0)
+            ASSERT_LT(num_tests, 9);
+    }
+}
+
+TEST(ChTrackShoeWindow, rescan) {
+    const size_t n = 30;
+    ChTrackShoeWindow window(10);
+
+    std::set<size_t> reach = {5, 6, 7};
+    auto in_reach = [&](size_t is) { return reach.count(is) > 0; };
+
+    window.Update(n, in_reach);
+    ASSERT_EQ(WindowShoes(window), reach);
+
+    // Shoes from a different part of the chain come within reach; these are found at the next full scan
+    reach = {5, 6, 7, 20};
+    int num_updates = 0;
+    while (WindowShoes(window).count(20) == 0) {
+        window.Update(n, in_reach);
+        num_updates++;
+    }
+    ASSERT_EQ(num_updates, 10);
+
+    // The window is the shortest range containing all shoes within reach
+    ASSERT_EQ(window.GetNumShoes(), 16u);
+
+    // No shoe within reach
+    reach.clear();
+    window.Update(n, in_reach);
+    ASSERT_EQ(window.GetNumShoes(), 0u);
+
+    // All shoes within reach
+    for (size_t is = 0; is < n; is++)
+        reach.insert(is);
+    window.Update(n, in_reach);
+    ASSERT_EQ(window.GetNumShoes(), n);
+}